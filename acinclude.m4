@@ -1,18 +1,221 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20200713
+dnl Version: 20201014
 
 dnl Function to detect if libscca dependencies are available
 AC_DEFUN([AX_LIBSCCA_CHECK_LOCAL],
   [dnl Check for internationalization functions in libscca/libscca_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for the monotonic clock function in libscca/libscca_statistics.c
+  AC_CHECK_FUNCS([clock_gettime])
+
+  dnl Check for memory-mapped file functions in libscca/libscca_mapped_file.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([close fstat madvise mmap munmap open])
+
+  dnl Check for directory change notification functions in libscca/libscca_watcher.c
+  AC_CHECK_HEADERS([poll.h sys/inotify.h])
+
+  AC_CHECK_FUNCS([inotify_init1 poll])
+
+  dnl Check for directory functions in libscca/libscca_directory.c
+  AC_CHECK_HEADERS([dirent.h])
+
+  AC_CHECK_FUNCS([closedir opendir readdir])
+
+  dnl Check for processor affinity functions in libscca/libscca_batch.c
+  AC_CHECK_HEADERS([sched.h])
+
+  AC_CHECK_FUNCS([sched_getaffinity sched_setaffinity])
+
+  dnl Check for processor feature detection and vector intrinsics in libscca/libscca_cpu.c
+  AC_CHECK_HEADERS([arm_neon.h cpuid.h immintrin.h sys/auxv.h])
+
+  AC_CHECK_FUNCS([getauxval])
+])
+
+dnl Function to detect whether tracing spans should be enabled
+AC_DEFUN([AX_LIBSCCA_CHECK_ENABLE_TRACING],
+  [AX_COMMON_ARG_ENABLE(
+    [tracing],
+    [tracing],
+    [enable tracing spans of the read stages],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_tracing" != xno ],
+    [AC_DEFINE(
+      [HAVE_TRACING],
+      [1],
+      [Define to 1 if tracing spans should be used.])
+
+    ac_cv_enable_tracing=yes])
+])
+
+dnl Function to detect whether static tracepoints should be enabled
+AC_DEFUN([AX_LIBSCCA_CHECK_ENABLE_STATIC_TRACEPOINTS],
+  [AX_COMMON_ARG_ENABLE(
+    [static-tracepoints],
+    [static_tracepoints],
+    [enable USDT or ETW static tracepoints of the read stages],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_static_tracepoints" != xno],
+    [dnl The USDT probes are defined by sys/sdt.h of SystemTap and the ETW
+    dnl events by TraceLoggingProvider.h of the Windows SDK
+    AC_CHECK_HEADERS([sys/sdt.h])
+
+    AC_CHECK_HEADERS(
+      [TraceLoggingProvider.h],
+      [],
+      [],
+      [[#include <windows.h>]])
+
+    AS_IF(
+      [test "x$ac_cv_header_sys_sdt_h" != xyes && test "x$ac_cv_header_TraceLoggingProvider_h" != xyes],
+      [AC_MSG_FAILURE(
+        [Missing header: sys/sdt.h or TraceLoggingProvider.h required for static tracepoints],
+        [1])
+      ])
+
+    dnl The TraceLogging provider is registered with the event functions of advapi32
+    AS_IF(
+      [test "x$ac_cv_header_TraceLoggingProvider_h" = xyes],
+      [LIBS="$LIBS -ladvapi32"])
+
+    AC_DEFINE(
+      [HAVE_STATIC_TRACEPOINTS],
+      [1],
+      [Define to 1 if static tracepoints should be used.])
+
+    ac_cv_enable_static_tracepoints=yes])
+])
+
+dnl Function to detect whether profile guided optimization should be enabled
+AC_DEFUN([AX_LIBSCCA_CHECK_ENABLE_PROFILE_GUIDED_OPTIMIZATION],
+  [AX_COMMON_ARG_ENABLE(
+    [profile-guided-optimization],
+    [profile_guided_optimization],
+    [enable the profile-opt target that builds with profile guided and link time optimization],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_profile_guided_optimization" != xno],
+    [dnl The profiles are stored in the build directory so that the training
+    dnl workload can be run from any of the sub directories
+    ax_libscca_pgo_profile_directory='$(abs_top_builddir)/pgo-profiles'
+
+    AC_CACHE_CHECK(
+      [if the C compiler is clang],
+      [ac_cv_libscca_pgo_compiler_clang],
+      [AC_COMPILE_IFELSE(
+        [AC_LANG_PROGRAM(
+          [[#if !defined( __clang__ )
+#error not clang
+#endif]],
+          [[]])],
+        [ac_cv_libscca_pgo_compiler_clang=yes],
+        [ac_cv_libscca_pgo_compiler_clang=no])])
+
+    dnl Clang writes raw profiles that need to be merged before they can be used
+    AS_IF(
+      [test "x$ac_cv_libscca_pgo_compiler_clang" = xyes],
+      [AC_PATH_PROGS(
+        [LLVM_PROFDATA],
+        [llvm-profdata])
+
+      AS_IF(
+        [test "x$LLVM_PROFDATA" = x],
+        [AC_MSG_FAILURE(
+          [Missing program: llvm-profdata required for profile guided optimization with clang],
+          [1])
+        ])
+
+      ax_libscca_pgo_generate_cflags="-fprofile-generate=${ax_libscca_pgo_profile_directory}"
+      ax_libscca_pgo_use_cflags="-fprofile-use=${ax_libscca_pgo_profile_directory}/libscca.profdata -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date"
+      ],
+      [ax_libscca_pgo_generate_cflags="-fprofile-generate=${ax_libscca_pgo_profile_directory}"
+      ax_libscca_pgo_use_cflags="-fprofile-use=${ax_libscca_pgo_profile_directory} -fprofile-correction -Wno-missing-profile"
+      ])
+
+    dnl Make sure the compiler and linker support the flags before the
+    dnl profile-opt target depends on them
+    ac_cv_libscca_pgo_cflags_backup="$CFLAGS"
+    ac_cv_libscca_pgo_ldflags_backup="$LDFLAGS"
+
+    CFLAGS="$CFLAGS -fprofile-generate -flto"
+    LDFLAGS="$LDFLAGS -fprofile-generate -flto"
+
+    AC_CACHE_CHECK(
+      [if the C compiler supports profile guided and link time optimization],
+      [ac_cv_libscca_pgo_flags],
+      [AC_LINK_IFELSE(
+        [AC_LANG_PROGRAM(
+          [[]],
+          [[]])],
+        [ac_cv_libscca_pgo_flags=yes],
+        [ac_cv_libscca_pgo_flags=no])])
+
+    CFLAGS="$ac_cv_libscca_pgo_cflags_backup"
+    LDFLAGS="$ac_cv_libscca_pgo_ldflags_backup"
+
+    AS_IF(
+      [test "x$ac_cv_libscca_pgo_flags" != xyes],
+      [AC_MSG_FAILURE(
+        [C compiler does not support: -fprofile-generate -flto],
+        [1])
+      ])
+
+    AC_SUBST(
+      [PGO_PROFILE_DIRECTORY],
+      [$ax_libscca_pgo_profile_directory])
+
+    AC_SUBST(
+      [PGO_GENERATE_CFLAGS],
+      ["$ax_libscca_pgo_generate_cflags -flto"])
+
+    AC_SUBST(
+      [PGO_USE_CFLAGS],
+      ["$ax_libscca_pgo_use_cflags -flto"])
+
+    AC_SUBST(
+      [PGO_COMPILER_CLANG],
+      [$ac_cv_libscca_pgo_compiler_clang])
+
+    ac_cv_enable_profile_guided_optimization=yes])
+
+  AC_SUBST(
+    [PGO_ENABLED],
+    [$ac_cv_enable_profile_guided_optimization])
 ])
 
 dnl Function to detect if sccatools dependencies are available
 AC_DEFUN([AX_SCCATOOLS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([signal.h sys/signal.h unistd.h])
+  [AC_CHECK_HEADERS([dirent.h signal.h sys/signal.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([close closedir getopt opendir readdir setvbuf stat])
+
+  dnl Check for the sleep function in sccatools/progress_handle.c
+  AC_CHECK_FUNCS([nanosleep])
+
+  dnl Check for the read-ahead hint function in sccatools/path_list.c
+  AC_CHECK_HEADERS([fcntl.h])
+
+  AC_CHECK_FUNCS([open posix_fadvise])
+
+  dnl Check for the file synchronization and offset functions in sccatools/journal_handle.c
+  AC_CHECK_FUNCS([fsync ftello])
+
+  dnl Check for the Unix domain socket functions in sccatools/daemon_handle.c
+  AC_CHECK_HEADERS([errno.h poll.h sys/socket.h sys/un.h])
+
+  AC_CHECK_FUNCS([accept bind listen lstat poll socket umask unlink])
 
-  AC_CHECK_FUNCS([close getopt setvbuf])
+  dnl Check for the hardware performance counters in bench/bench_counters.c
+  AC_CHECK_HEADERS([linux/perf_event.h sys/ioctl.h sys/syscall.h])
 
   AS_IF(
    [test "x$ac_cv_func_close" != xyes],
@@ -0,0 +1,488 @@
+/*
+ * Hardware performance counter functions for the benchmarks
+ *
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_LINUX_PERF_EVENT_H ) && defined( HAVE_SYS_IOCTL_H ) && defined( HAVE_SYS_SYSCALL_H ) && defined( HAVE_UNISTD_H )
+#define BENCH_COUNTERS_HAVE_PERF_EVENT
+#endif
+
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "bench_counters.h"
+#include "bench_libcerror.h"
+#include "bench_output.h"
+
+const char *bench_counters_names[ BENCH_COUNTERS_NUMBER_OF_COUNTERS ] = {
+	"cycles", "instructions", "branch_misses", "cache_misses" };
+
+const char *bench_counters_descriptions[ BENCH_COUNTERS_NUMBER_OF_COUNTERS ] = {
+	"Cycles per byte\t\t\t", "Instructions per byte\t\t", "Branch misses per byte\t\t", "Cache misses per byte\t\t" };
+
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+
+const uint64_t bench_counters_perf_event_configs[ BENCH_COUNTERS_NUMBER_OF_COUNTERS ] = {
+	PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES };
+
+#endif /* defined( BENCH_COUNTERS_HAVE_PERF_EVENT ) */
+
+/* Creates counters
+ * Make sure the value counters is referencing, is set to NULL
+ * A counter that cannot be opened, for example due to the perf_event_paranoid setting
+ * or a virtual machine that does not expose it, is marked as not available
+ * Returns 1 if successful or -1 on error
+ */
+int bench_counters_initialize(
+     bench_counters_t **counters,
+     libcerror_error_t **error )
+{
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+	struct perf_event_attr attributes;
+#endif
+
+	static char *function = "bench_counters_initialize";
+	int counter_index     = 0;
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( *counters != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid counters value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*counters = memory_allocate_structure(
+	             bench_counters_t );
+
+	if( *counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create counters.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *counters,
+	     0,
+	     sizeof( bench_counters_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear counters.",
+		 function );
+
+		goto on_error;
+	}
+	for( counter_index = 0;
+	     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		( *counters )->file_descriptors[ counter_index ] = -1;
+
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+		if( memory_set(
+		     &attributes,
+		     0,
+		     sizeof( struct perf_event_attr ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear perf event attributes.",
+			 function );
+
+			goto on_error;
+		}
+		attributes.type           = PERF_TYPE_HARDWARE;
+		attributes.size           = sizeof( struct perf_event_attr );
+		attributes.config         = bench_counters_perf_event_configs[ counter_index ];
+		attributes.disabled       = 1;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv     = 1;
+
+		/* The counters are opened separately rather than as a group
+		 * so that one unsupported counter does not disable the others
+		 */
+		( *counters )->file_descriptors[ counter_index ] = (int) syscall(
+		                                                          __NR_perf_event_open,
+		                                                          &attributes,
+		                                                          0,
+		                                                          -1,
+		                                                          -1,
+		                                                          0 );
+
+		if( ( *counters )->file_descriptors[ counter_index ] < 0 )
+		{
+			( *counters )->file_descriptors[ counter_index ] = -1;
+		}
+#endif /* defined( BENCH_COUNTERS_HAVE_PERF_EVENT ) */
+	}
+	return( 1 );
+
+on_error:
+	if( *counters != NULL )
+	{
+		bench_counters_free(
+		 counters,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees counters
+ * Returns 1 if successful or -1 on error
+ */
+int bench_counters_free(
+     bench_counters_t **counters,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_counters_free";
+	int counter_index     = 0;
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( *counters != NULL )
+	{
+		for( counter_index = 0;
+		     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+		     counter_index++ )
+		{
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+			if( ( *counters )->file_descriptors[ counter_index ] >= 0 )
+			{
+				close(
+				 ( *counters )->file_descriptors[ counter_index ] );
+			}
+#endif
+			( *counters )->file_descriptors[ counter_index ] = -1;
+		}
+		memory_free(
+		 *counters );
+
+		*counters = NULL;
+	}
+	return( 1 );
+}
+
+/* Determines if at least one of the counters is available
+ * Returns 1 if available, 0 if not or -1 on error
+ */
+int bench_counters_has_counters(
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_counters_has_counters";
+	int counter_index     = 0;
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter_index = 0;
+	     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		if( counters->file_descriptors[ counter_index ] >= 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Empties the accumulated values of the counters
+ * Returns 1 if successful or -1 on error
+ */
+int bench_counters_empty(
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_counters_empty";
+	int counter_index     = 0;
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter_index = 0;
+	     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		counters->values[ counter_index ] = 0;
+	}
+	return( 1 );
+}
+
+/* Resets and enables the available counters
+ * Returns 1 if successful or -1 on error
+ */
+int bench_counters_start(
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_counters_start";
+	int counter_index     = 0;
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter_index = 0;
+	     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		if( counters->file_descriptors[ counter_index ] < 0 )
+		{
+			continue;
+		}
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+		if( ( ioctl(
+		       counters->file_descriptors[ counter_index ],
+		       PERF_EVENT_IOC_RESET,
+		       0 ) != 0 )
+		 || ( ioctl(
+		       counters->file_descriptors[ counter_index ],
+		       PERF_EVENT_IOC_ENABLE,
+		       0 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to enable %s counter.",
+			 function,
+			 bench_counters_names[ counter_index ] );
+
+			return( -1 );
+		}
+#endif /* defined( BENCH_COUNTERS_HAVE_PERF_EVENT ) */
+	}
+	return( 1 );
+}
+
+/* Disables the available counters and adds their values to the accumulated values
+ * Returns 1 if successful or -1 on error
+ */
+int bench_counters_stop(
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_counters_stop";
+	int counter_index     = 0;
+
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+	uint64_t value        = 0;
+#endif
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter_index = 0;
+	     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		if( counters->file_descriptors[ counter_index ] < 0 )
+		{
+			continue;
+		}
+#if defined( BENCH_COUNTERS_HAVE_PERF_EVENT )
+		if( ioctl(
+		     counters->file_descriptors[ counter_index ],
+		     PERF_EVENT_IOC_DISABLE,
+		     0 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to disable %s counter.",
+			 function,
+			 bench_counters_names[ counter_index ] );
+
+			return( -1 );
+		}
+		if( read(
+		     counters->file_descriptors[ counter_index ],
+		     &value,
+		     sizeof( uint64_t ) ) != (ssize_t) sizeof( uint64_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read %s counter.",
+			 function,
+			 bench_counters_names[ counter_index ] );
+
+			return( -1 );
+		}
+		counters->values[ counter_index ] += value;
+#endif /* defined( BENCH_COUNTERS_HAVE_PERF_EVENT ) */
+	}
+	return( 1 );
+}
+
+/* Prints the accumulated values of the counters per byte
+ * In JSON Lines the values are printed as additional fields of the current record,
+ * where a counter that is not available is printed as null
+ * Returns 1 if successful or -1 on error
+ */
+int bench_counters_fprint(
+     bench_counters_t *counters,
+     FILE *stream,
+     int output_format,
+     uint64_t number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_counters_fprint";
+	double value_per_byte = 0.0;
+	int counter_index     = 0;
+
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( counter_index = 0;
+	     counter_index < BENCH_COUNTERS_NUMBER_OF_COUNTERS;
+	     counter_index++ )
+	{
+		value_per_byte = 0.0;
+
+		if( number_of_bytes > 0 )
+		{
+			value_per_byte = (double) counters->values[ counter_index ] / (double) number_of_bytes;
+		}
+		if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+		{
+			if( counters->file_descriptors[ counter_index ] < 0 )
+			{
+				fprintf(
+				 stream,
+				 ", \"%s_per_byte\": null",
+				 bench_counters_names[ counter_index ] );
+			}
+			else
+			{
+				fprintf(
+				 stream,
+				 ", \"%s_per_byte\": %.4f",
+				 bench_counters_names[ counter_index ],
+				 value_per_byte );
+			}
+		}
+		else if( counters->file_descriptors[ counter_index ] >= 0 )
+		{
+			fprintf(
+			 stream,
+			 "\t%s: %.4f\n",
+			 bench_counters_descriptions[ counter_index ],
+			 value_per_byte );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Hardware performance counter functions for the benchmarks
+ *
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_COUNTERS_H )
+#define _BENCH_COUNTERS_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "bench_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum BENCH_COUNTERS
+{
+	BENCH_COUNTER_CYCLES					= 0,
+	BENCH_COUNTER_INSTRUCTIONS				= 1,
+	BENCH_COUNTER_BRANCH_MISSES				= 2,
+	BENCH_COUNTER_CACHE_MISSES				= 3
+};
+
+#define BENCH_COUNTERS_NUMBER_OF_COUNTERS			4
+
+typedef struct bench_counters bench_counters_t;
+
+struct bench_counters
+{
+	/* The file descriptors of the counters, where -1 indicates the counter is not available
+	 */
+	int file_descriptors[ BENCH_COUNTERS_NUMBER_OF_COUNTERS ];
+
+	/* The accumulated values of the counters
+	 */
+	uint64_t values[ BENCH_COUNTERS_NUMBER_OF_COUNTERS ];
+};
+
+int bench_counters_initialize(
+     bench_counters_t **counters,
+     libcerror_error_t **error );
+
+int bench_counters_free(
+     bench_counters_t **counters,
+     libcerror_error_t **error );
+
+int bench_counters_has_counters(
+     bench_counters_t *counters,
+     libcerror_error_t **error );
+
+int bench_counters_empty(
+     bench_counters_t *counters,
+     libcerror_error_t **error );
+
+int bench_counters_start(
+     bench_counters_t *counters,
+     libcerror_error_t **error );
+
+int bench_counters_stop(
+     bench_counters_t *counters,
+     libcerror_error_t **error );
+
+int bench_counters_fprint(
+     bench_counters_t *counters,
+     FILE *stream,
+     int output_format,
+     uint64_t number_of_bytes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_COUNTERS_H ) */
+
@@ -0,0 +1,57 @@
+/*
+ * Input functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_INPUT_H )
+#define _BENCH_INPUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "bench_libbfio.h"
+#include "bench_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int bench_input_determine_number(
+     const system_character_t *string,
+     int maximum_value,
+     int *number,
+     libcerror_error_t **error );
+
+int bench_input_open_file(
+     const system_character_t *filename,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int bench_input_read_file(
+     const system_character_t *filename,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_INPUT_H ) */
+
@@ -0,0 +1,140 @@
+/*
+ * Output functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "bench_libcerror.h"
+#include "bench_output.h"
+
+/* Determines the output format from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int bench_output_determine_format(
+     const system_character_t *string,
+     int *output_format,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_output_determine_format";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_format == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output format.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			*output_format = BENCH_OUTPUT_FORMAT_TEXT;
+			result         = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
+		{
+			*output_format = BENCH_OUTPUT_FORMAT_JSONL;
+			result         = 1;
+		}
+	}
+	return( result );
+}
+
+/* Prints a string as a JSON string value
+ */
+void bench_output_json_string_fprint(
+      FILE *stream,
+      const system_character_t *string )
+{
+	size_t string_index = 0;
+
+	if( ( stream == NULL )
+	 || ( string == NULL ) )
+	{
+		return;
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] == (system_character_t) '"' )
+		 || ( string[ string_index ] == (system_character_t) '\\' ) )
+		{
+			fprintf(
+			 stream,
+			 "\\%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+		else if( (uint32_t) string[ string_index ] < 0x20 )
+		{
+			fprintf(
+			 stream,
+			 "\\u%04" PRIx32 "",
+			 (uint32_t) string[ string_index ] );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "%" PRIc_SYSTEM "",
+			 string[ string_index ] );
+		}
+	}
+	fprintf(
+	 stream,
+	 "\"" );
+}
+
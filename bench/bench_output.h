@@ -0,0 +1,55 @@
+/*
+ * Output functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_OUTPUT_H )
+#define _BENCH_OUTPUT_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "bench_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum BENCH_OUTPUT_FORMATS
+{
+	BENCH_OUTPUT_FORMAT_TEXT		= 0,
+	BENCH_OUTPUT_FORMAT_JSONL		= 1
+};
+
+int bench_output_determine_format(
+     const system_character_t *string,
+     int *output_format,
+     libcerror_error_t **error );
+
+void bench_output_json_string_fprint(
+      FILE *stream,
+      const system_character_t *string );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_OUTPUT_H ) */
+
@@ -0,0 +1,348 @@
+/*
+ * Samples functions for the benchmarks
+ *
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_libcerror.h"
+#include "bench_samples.h"
+
+/* Creates samples
+ * Make sure the value samples is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int bench_samples_initialize(
+     bench_samples_t **samples,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_samples_initialize";
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( *samples != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid samples value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*samples = memory_allocate_structure(
+	            bench_samples_t );
+
+	if( *samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create samples.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *samples,
+	     0,
+	     sizeof( bench_samples_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear samples.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *samples != NULL )
+	{
+		memory_free(
+		 *samples );
+
+		*samples = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees samples
+ * Returns 1 if successful or -1 on error
+ */
+int bench_samples_free(
+     bench_samples_t **samples,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_samples_free";
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( *samples != NULL )
+	{
+		if( ( *samples )->values != NULL )
+		{
+			memory_free(
+			 ( *samples )->values );
+		}
+		memory_free(
+		 *samples );
+
+		*samples = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties the samples
+ * The allocated values are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int bench_samples_empty(
+     bench_samples_t *samples,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_samples_empty";
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	samples->number_of_values = 0;
+	samples->total            = 0;
+	samples->is_sorted        = 0;
+
+	return( 1 );
+}
+
+/* Appends a value
+ * The values are allocated in increasing blocks to limit the number of reallocations
+ * Returns 1 if successful or -1 on error
+ */
+int bench_samples_append_value(
+     bench_samples_t *samples,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	uint64_t *reallocation         = NULL;
+	static char *function          = "bench_samples_append_value";
+	int number_of_allocated_values = 0;
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples->number_of_values >= samples->number_of_allocated_values )
+	{
+		if( samples->number_of_allocated_values == 0 )
+		{
+			number_of_allocated_values = 1024;
+		}
+		else if( samples->number_of_allocated_values < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_values = samples->number_of_allocated_values * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated values value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_values > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated values value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (uint64_t *) memory_reallocate(
+		                             samples->values,
+		                             sizeof( uint64_t ) * number_of_allocated_values );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize values.",
+			 function );
+
+			return( -1 );
+		}
+		samples->values                     = reallocation;
+		samples->number_of_allocated_values = number_of_allocated_values;
+	}
+	samples->values[ samples->number_of_values ] = value;
+
+	samples->number_of_values += 1;
+	samples->total            += value;
+	samples->is_sorted         = 0;
+
+	return( 1 );
+}
+
+/* Compares two values
+ * Callback function for qsort
+ * Returns -1 if the first value is smaller, 1 if larger or 0 if equal
+ */
+int bench_samples_compare_values(
+     const void *first_value,
+     const void *second_value )
+{
+	uint64_t first_value_64bit  = *( (const uint64_t *) first_value );
+	uint64_t second_value_64bit = *( (const uint64_t *) second_value );
+
+	if( first_value_64bit < second_value_64bit )
+	{
+		return( -1 );
+	}
+	else if( first_value_64bit > second_value_64bit )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves a percentile of the values using the nearest-rank method
+ * A percentile of 0 returns the smallest and 100 the largest value
+ * Returns 1 if successful, 0 if no values are available or -1 on error
+ */
+int bench_samples_get_percentile(
+     bench_samples_t *samples,
+     int percentile,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "bench_samples_get_percentile";
+	uint64_t rank         = 0;
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( percentile < 0 )
+	 || ( percentile > 100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid percentile value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples->number_of_values == 0 )
+	{
+		return( 0 );
+	}
+	if( samples->is_sorted == 0 )
+	{
+		qsort(
+		 samples->values,
+		 (size_t) samples->number_of_values,
+		 sizeof( uint64_t ),
+		 &bench_samples_compare_values );
+
+		samples->is_sorted = 1;
+	}
+	/* The nearest-rank is the smallest rank that is larger than or equal to percentile * N / 100
+	 */
+	rank = ( ( (uint64_t) percentile * (uint64_t) samples->number_of_values ) + 99 ) / 100;
+
+	if( rank > 0 )
+	{
+		rank -= 1;
+	}
+	*value = samples->values[ rank ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,92 @@
+/*
+ * Samples functions for the benchmarks
+ *
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _BENCH_SAMPLES_H )
+#define _BENCH_SAMPLES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "bench_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct bench_samples bench_samples_t;
+
+struct bench_samples
+{
+	/* The values
+	 */
+	uint64_t *values;
+
+	/* The number of values
+	 */
+	int number_of_values;
+
+	/* The number of allocated values
+	 */
+	int number_of_allocated_values;
+
+	/* The total of the values
+	 */
+	uint64_t total;
+
+	/* Value to indicate the values are sorted
+	 */
+	uint8_t is_sorted;
+};
+
+int bench_samples_initialize(
+     bench_samples_t **samples,
+     libcerror_error_t **error );
+
+int bench_samples_free(
+     bench_samples_t **samples,
+     libcerror_error_t **error );
+
+int bench_samples_empty(
+     bench_samples_t *samples,
+     libcerror_error_t **error );
+
+int bench_samples_append_value(
+     bench_samples_t *samples,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int bench_samples_compare_values(
+     const void *first_value,
+     const void *second_value );
+
+int bench_samples_get_percentile(
+     bench_samples_t *samples,
+     int percentile,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _BENCH_SAMPLES_H ) */
+
@@ -0,0 +1,84 @@
+/*
+ * Timer functions for the benchmarks
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_CLOCK_GETTIME )
+#include <time.h>
+#endif
+
+#include "bench_timer.h"
+
+/* Retrieves a monotonic timestamp in nano seconds
+ * Returns 1 if successful or 0 if no monotonic clock is available
+ */
+int bench_timer_get_timestamp(
+     uint64_t *timestamp )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter   = { 0 };
+	LARGE_INTEGER frequency = { 0 };
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	if( timestamp == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	*timestamp = ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	           + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart;
+
+	return( 1 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	*timestamp = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+	return( 1 );
+
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,2206 @@
+/*
+ * Generator of synthetic prefetch files
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "bench_libcerror.h"
+#include "generator.h"
+
+#include "../libscca/scca_file_header.h"
+#include "../libscca/scca_file_information.h"
+#include "../libscca/scca_file_metrics_array.h"
+#include "../libscca/scca_trace_chain_array.h"
+#include "../libscca/scca_volume_information.h"
+
+/* Creates a generator
+ * Make sure the value generator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int generator_initialize(
+     generator_t **generator,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_initialize";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid generator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*generator = memory_allocate_structure(
+	              generator_t );
+
+	if( *generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *generator,
+	     0,
+	     sizeof( generator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear generator.",
+		 function );
+
+		goto on_error;
+	}
+	( *generator )->format_version                 = 30;
+	( *generator )->metrics_array_offset           = 0x00000130UL;
+	( *generator )->number_of_file_metrics_entries = 1;
+	( *generator )->number_of_filenames            = 1;
+	( *generator )->seed                           = 1;
+
+	return( 1 );
+
+on_error:
+	if( *generator != NULL )
+	{
+		memory_free(
+		 *generator );
+
+		*generator = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a generator
+ * Returns 1 if successful or -1 on error
+ */
+int generator_free(
+     generator_t **generator,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_free";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *generator != NULL )
+	{
+		memory_free(
+		 *generator );
+
+		*generator = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the format version
+ * The metrics array offset is only used by format version 30 to select the file information
+ * variant, where 0x00000130 selects variant 1 and 0x00000128 variant 2, 0 selects the default
+ * Returns 1 if successful or -1 on error
+ */
+int generator_set_format_version(
+     generator_t *generator,
+     uint32_t format_version,
+     uint32_t metrics_array_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_set_format_version";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format_version != 17 )
+	 && ( format_version != 23 )
+	 && ( format_version != 26 )
+	 && ( format_version != 30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( format_version == 30 )
+	{
+		if( metrics_array_offset == 0 )
+		{
+			metrics_array_offset = 0x00000130UL;
+		}
+		if( ( metrics_array_offset != 0x00000128UL )
+		 && ( metrics_array_offset != 0x00000130UL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported metrics array offset: 0x%08" PRIx32 ".",
+			 function,
+			 metrics_array_offset );
+
+			return( -1 );
+		}
+		if( metrics_array_offset == 0x00000130UL )
+		{
+			generator->file_information_size = (uint32_t) sizeof( scca_file_information_v26_t );
+		}
+		else
+		{
+			generator->file_information_size = (uint32_t) sizeof( scca_file_information_v30_2_t );
+		}
+	}
+	else
+	{
+		if( format_version == 17 )
+		{
+			generator->file_information_size = (uint32_t) sizeof( scca_file_information_v17_t );
+		}
+		else if( format_version == 23 )
+		{
+			generator->file_information_size = (uint32_t) sizeof( scca_file_information_v23_t );
+		}
+		else
+		{
+			generator->file_information_size = (uint32_t) sizeof( scca_file_information_v26_t );
+		}
+		/* The metrics array of format version 26 overlaps the last 4 bytes of the file information
+		 */
+		if( format_version == 26 )
+		{
+			metrics_array_offset = 0x00000130UL;
+		}
+		else
+		{
+			metrics_array_offset = (uint32_t) sizeof( scca_file_header_t ) + generator->file_information_size;
+		}
+	}
+	generator->format_version       = format_version;
+	generator->metrics_array_offset = metrics_array_offset;
+
+	return( 1 );
+}
+
+/* Sets the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int generator_set_number_of_entries(
+     generator_t *generator,
+     uint32_t number_of_file_metrics_entries,
+     uint32_t number_of_filenames,
+     uint32_t number_of_trace_chain_entries,
+     uint32_t number_of_volumes,
+     uint32_t number_of_directory_strings,
+     uint32_t number_of_file_references,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_set_number_of_entries";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_file_metrics_entries == 0 )
+	 || ( number_of_file_metrics_entries > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file metrics entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames == 0 )
+	 || ( number_of_filenames > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_FILENAMES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_trace_chain_entries > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of trace chain entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volumes > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_directory_strings > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of directory strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_references > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file references value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	generator->number_of_file_metrics_entries = number_of_file_metrics_entries;
+	generator->number_of_filenames            = number_of_filenames;
+	generator->number_of_trace_chain_entries  = number_of_trace_chain_entries;
+	generator->number_of_volumes              = number_of_volumes;
+	generator->number_of_directory_strings    = number_of_directory_strings;
+	generator->number_of_file_references      = number_of_file_references;
+
+	return( 1 );
+}
+
+/* Sets the seed of the pseudo random number generator
+ * Returns 1 if successful or -1 on error
+ */
+int generator_set_seed(
+     generator_t *generator,
+     uint32_t seed,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_set_seed";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	generator->seed = seed;
+
+	return( 1 );
+}
+
+/* Retrieves a pseudo random value using xorshift
+ * Returns the pseudo random value
+ */
+uint32_t generator_get_random_value(
+          generator_t *generator )
+{
+	uint32_t value = 0;
+
+	if( generator == NULL )
+	{
+		return( 0 );
+	}
+	value = generator->random_state;
+
+	if( value == 0 )
+	{
+		value = 0x2545f491UL;
+	}
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	generator->random_state = value;
+
+	return( value );
+}
+
+/* Calculates the offsets and sizes of the sections of the prefetch file
+ * Returns 1 if successful or -1 on error
+ */
+int generator_calculate_layout(
+     generator_t *generator,
+     libcerror_error_t **error )
+{
+	static char *function              = "generator_calculate_layout";
+	uint64_t data_offset               = 0;
+	uint64_t file_references_data_size = 0;
+	uint64_t volume_data_size          = 0;
+	uint64_t volumes_information_size  = 0;
+	size_t file_metrics_entry_size     = 0;
+	size_t trace_chain_entry_size      = 0;
+	size_t volume_information_size     = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator->format_version == 17 )
+	{
+		file_metrics_entry_size = sizeof( scca_file_metrics_array_entry_v17_t );
+		volume_information_size = sizeof( scca_volume_information_v17_t );
+	}
+	else
+	{
+		file_metrics_entry_size = sizeof( scca_file_metrics_array_entry_v23_t );
+
+		if( generator->format_version == 30 )
+		{
+			volume_information_size = sizeof( scca_volume_information_v30_t );
+		}
+		else
+		{
+			volume_information_size = sizeof( scca_volume_information_v23_t );
+		}
+	}
+	if( generator->format_version == 30 )
+	{
+		trace_chain_entry_size = sizeof( scca_trace_chain_array_entry_v30_t );
+	}
+	else
+	{
+		trace_chain_entry_size = sizeof( scca_trace_chain_array_entry_v17_t );
+	}
+	data_offset  = generator->metrics_array_offset;
+	data_offset += (uint64_t) generator->number_of_file_metrics_entries * file_metrics_entry_size;
+
+	generator->trace_chain_array_offset = 0;
+
+	if( generator->number_of_trace_chain_entries > 0 )
+	{
+		generator->trace_chain_array_offset = (uint32_t) data_offset;
+
+		data_offset += (uint64_t) generator->number_of_trace_chain_entries * trace_chain_entry_size;
+	}
+	if( data_offset > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	generator->filename_strings_offset = (uint32_t) data_offset;
+	generator->filename_strings_size   = generator->number_of_filenames * ( GENERATOR_FILENAME_LENGTH + 1 ) * 2;
+
+	data_offset += generator->filename_strings_size;
+
+	generator->volumes_information_offset = 0;
+	generator->volumes_information_size   = 0;
+
+	if( generator->number_of_volumes > 0 )
+	{
+		/* The file references start with a version and number of file references
+		 */
+		file_references_data_size = 8 + ( (uint64_t) generator->number_of_file_references * 8 );
+
+		if( generator->format_version >= 23 )
+		{
+			file_references_data_size += 8;
+		}
+		volume_data_size = volume_information_size
+		                 + ( ( GENERATOR_DEVICE_PATH_LENGTH + 1 ) * 2 )
+		                 + file_references_data_size
+		                 + ( (uint64_t) generator->number_of_directory_strings * ( 2 + ( ( GENERATOR_DIRECTORY_STRING_LENGTH + 1 ) * 2 ) ) );
+
+		/* The trailing padding keeps the last strings and file references away from the end of the volumes information
+		 */
+		volumes_information_size = ( (uint64_t) generator->number_of_volumes * volume_data_size ) + 8;
+
+		if( volumes_information_size > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		generator->volumes_information_offset = (uint32_t) data_offset;
+		generator->volumes_information_size   = (uint32_t) volumes_information_size;
+
+		data_offset += volumes_information_size;
+	}
+	if( ( data_offset > (uint64_t) UINT32_MAX )
+	 || ( data_offset > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	generator->data_size = (size_t) data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data of a generated prefetch file
+ * Returns 1 if successful or -1 on error
+ */
+int generator_get_data_size(
+     generator_t *generator,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_get_data_size";
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator_calculate_layout(
+	     generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate layout.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = generator->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the values of a volume
+ * The values only depend on the seed and the volume index, so that the filenames
+ * and the volume information of a prefetch file refer to the same device paths
+ * Returns 1 if successful or -1 on error
+ */
+int generator_get_volume_values(
+     generator_t *generator,
+     uint32_t volume_index,
+     uint64_t *creation_time,
+     uint32_t *serial_number,
+     char *device_path,
+     size_t device_path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_get_volume_values";
+	int print_count       = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( creation_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid creation time.",
+		 function );
+
+		return( -1 );
+	}
+	if( serial_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path_size < ( GENERATOR_DEVICE_PATH_LENGTH + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid device path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	*creation_time = GENERATOR_BASE_FILETIME - ( (uint64_t) ( volume_index + 1 ) << 32 );
+	*serial_number = generator->seed ^ ( ( volume_index + 1 ) * 0x9e3779b9UL );
+
+	print_count = narrow_string_snprintf(
+	               device_path,
+	               device_path_size,
+	               "\\VOLUME{%016" PRIx64 "-%08" PRIX32 "}",
+	               *creation_time,
+	               *serial_number );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count != GENERATOR_DEVICE_PATH_LENGTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to format device path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an ASCII string to an UTF-16 little-endian string including the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int generator_copy_utf16_string(
+     uint8_t *data,
+     size_t data_size,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_copy_utf16_string";
+	size_t string_index   = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_length >= ( data_size / 2 ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		data[ string_index * 2 ]         = (uint8_t) string[ string_index ];
+		data[ ( string_index * 2 ) + 1 ] = 0;
+	}
+	data[ string_length * 2 ]         = 0;
+	data[ ( string_length * 2 ) + 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Writes the data of a generated prefetch file
+ * The data size must match the size retrieved with generator_get_data_size
+ * Every file index results in different values, e.g. timestamps and the prefetch hash
+ * Returns 1 if successful or -1 on error
+ */
+int generator_write_data(
+     generator_t *generator,
+     uint32_t file_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	char device_path[ 64 ];
+	char string[ 128 ];
+
+	uint8_t *entry_data                 = NULL;
+	uint8_t *last_run_time_data         = NULL;
+	uint8_t *run_count_data             = NULL;
+	static char *function               = "generator_write_data";
+	size_t data_offset                  = 0;
+	size_t file_metrics_entry_size      = 0;
+	size_t trace_chain_entry_size       = 0;
+	size_t volume_data_offset           = 0;
+	size_t volume_information_size      = 0;
+	uint64_t creation_time              = 0;
+	uint64_t file_reference             = 0;
+	uint64_t last_run_time              = 0;
+	uint32_t directory_string_index     = 0;
+	uint32_t entry_index                = 0;
+	uint32_t file_references_offset     = 0;
+	uint32_t file_references_size       = 0;
+	uint32_t number_of_last_run_times   = 0;
+	uint32_t prefetch_hash              = 0;
+	uint32_t serial_number              = 0;
+	uint32_t volume_index               = 0;
+	int print_count                     = 0;
+
+	if( generator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid generator.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator_calculate_layout(
+	     generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != generator->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	generator->random_state = generator->seed ^ ( ( file_index + 1 ) * 0x85ebca6bUL );
+
+	if( generator->format_version == 17 )
+	{
+		file_metrics_entry_size  = sizeof( scca_file_metrics_array_entry_v17_t );
+		volume_information_size  = sizeof( scca_volume_information_v17_t );
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		file_metrics_entry_size = sizeof( scca_file_metrics_array_entry_v23_t );
+
+		if( generator->format_version == 30 )
+		{
+			volume_information_size = sizeof( scca_volume_information_v30_t );
+		}
+		else
+		{
+			volume_information_size = sizeof( scca_volume_information_v23_t );
+		}
+		if( generator->format_version == 23 )
+		{
+			number_of_last_run_times = 1;
+		}
+		else
+		{
+			number_of_last_run_times = 8;
+		}
+	}
+	if( generator->format_version == 30 )
+	{
+		trace_chain_entry_size = sizeof( scca_trace_chain_array_entry_v30_t );
+	}
+	else
+	{
+		trace_chain_entry_size = sizeof( scca_trace_chain_array_entry_v17_t );
+	}
+	/* Write the file header
+	 */
+	prefetch_hash = generator_get_random_value(
+	                 generator );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->format_version,
+	 generator->format_version );
+
+	if( memory_copy(
+	     ( (scca_file_header_t *) data )->signature,
+	     "SCCA",
+	     4 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator->format_version == 17 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_file_header_t *) data )->unknown1,
+		 0x0000000fUL );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_file_header_t *) data )->unknown1,
+		 0x00000011UL );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->file_size,
+	 (uint32_t) data_size );
+
+	print_count = narrow_string_snprintf(
+	               string,
+	               128,
+	               "GEN%08" PRIX32 ".EXE",
+	               prefetch_hash );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count != GENERATOR_EXECUTABLE_FILENAME_LENGTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to format executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator_copy_utf16_string(
+	     ( (scca_file_header_t *) data )->executable_filename,
+	     60,
+	     string,
+	     GENERATOR_EXECUTABLE_FILENAME_LENGTH,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->prefetch_hash,
+	 prefetch_hash );
+
+	/* Write the file information, the values at the start are the same for every format version
+	 */
+	entry_data = &( data[ sizeof( scca_file_header_t ) ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->metrics_array_offset,
+	 generator->metrics_array_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->number_of_file_metrics_entries,
+	 generator->number_of_file_metrics_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->trace_chain_array_offset,
+	 generator->trace_chain_array_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->number_of_trace_chain_array_entries,
+	 generator->number_of_trace_chain_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->filename_strings_offset,
+	 generator->filename_strings_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->filename_strings_size,
+	 generator->filename_strings_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->volumes_information_offset,
+	 generator->volumes_information_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->number_of_volumes,
+	 generator->number_of_volumes );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) entry_data )->volumes_information_size,
+	 generator->volumes_information_size );
+
+	if( generator->format_version == 17 )
+	{
+		last_run_time_data = ( (scca_file_information_v17_t *) entry_data )->last_run_time;
+		run_count_data     = ( (scca_file_information_v17_t *) entry_data )->run_count;
+	}
+	else if( generator->format_version == 23 )
+	{
+		last_run_time_data = ( (scca_file_information_v23_t *) entry_data )->last_run_time;
+		run_count_data     = ( (scca_file_information_v23_t *) entry_data )->run_count;
+	}
+	else if( generator->file_information_size == (uint32_t) sizeof( scca_file_information_v26_t ) )
+	{
+		last_run_time_data = ( (scca_file_information_v26_t *) entry_data )->last_run_time;
+		run_count_data     = ( (scca_file_information_v26_t *) entry_data )->run_count;
+	}
+	else
+	{
+		last_run_time_data = ( (scca_file_information_v30_2_t *) entry_data )->last_run_time;
+		run_count_data     = ( (scca_file_information_v30_2_t *) entry_data )->run_count;
+	}
+	/* The last run times are stored from the most to the least recent
+	 */
+	last_run_time = GENERATOR_BASE_FILETIME + ( (uint64_t) generator_get_random_value( generator ) << 24 );
+
+	for( entry_index = 0;
+	     entry_index < number_of_last_run_times;
+	     entry_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( last_run_time_data[ entry_index * 8 ] ),
+		 last_run_time );
+
+		last_run_time -= (uint64_t) ( generator_get_random_value( generator ) % 86400 ) * 10000000UL;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 run_count_data,
+	 number_of_last_run_times + ( generator_get_random_value( generator ) % 256 ) );
+
+	/* Write the file metrics array
+	 */
+	data_offset = (size_t) generator->metrics_array_offset;
+
+	for( entry_index = 0;
+	     entry_index < generator->number_of_file_metrics_entries;
+	     entry_index++ )
+	{
+		entry_data = &( data[ data_offset ] );
+
+		if( generator->number_of_trace_chain_entries > 0 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->start_time,
+			 entry_index % generator->number_of_trace_chain_entries );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->duration,
+		 generator_get_random_value( generator ) % 4096 );
+
+		if( generator->format_version == 17 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->filename_string_offset,
+			 ( entry_index % generator->number_of_filenames ) * ( GENERATOR_FILENAME_LENGTH + 1 ) * 2 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->filename_string_numbers_of_characters,
+			 GENERATOR_FILENAME_LENGTH );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v17_t *) entry_data )->flags,
+			 0x00000200UL );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->average_duration,
+			 generator_get_random_value( generator ) % 4096 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->filename_string_offset,
+			 ( entry_index % generator->number_of_filenames ) * ( GENERATOR_FILENAME_LENGTH + 1 ) * 2 );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->filename_string_numbers_of_characters,
+			 GENERATOR_FILENAME_LENGTH );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->flags,
+			 0x00000200UL );
+
+			/* The file reference consists of a 48-bit MFT entry and a 16-bit sequence number
+			 */
+			file_reference = ( (uint64_t) 1 << 48 ) | ( 64 + ( entry_index % generator->number_of_filenames ) );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->file_reference,
+			 file_reference );
+		}
+		data_offset += file_metrics_entry_size;
+	}
+	/* Write the trace chain array
+	 */
+	for( entry_index = 0;
+	     entry_index < generator->number_of_trace_chain_entries;
+	     entry_index++ )
+	{
+		entry_data = &( data[ data_offset ] );
+
+		if( generator->format_version == 30 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_trace_chain_array_entry_v30_t *) entry_data )->total_block_load_count,
+			 1 + ( generator_get_random_value( generator ) % 64 ) );
+		}
+		else
+		{
+			if( ( entry_index + 1 ) < generator->number_of_trace_chain_entries )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->next_array_entry_index,
+				 entry_index + 1 );
+			}
+			else
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->next_array_entry_index,
+				 0xffffffffUL );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->total_block_load_count,
+			 1 + ( generator_get_random_value( generator ) % 64 ) );
+		}
+		data_offset += trace_chain_entry_size;
+	}
+	/* Write the filename strings
+	 */
+	for( entry_index = 0;
+	     entry_index < generator->number_of_filenames;
+	     entry_index++ )
+	{
+		if( generator->number_of_volumes > 0 )
+		{
+			volume_index = entry_index % generator->number_of_volumes;
+		}
+		if( generator_get_volume_values(
+		     generator,
+		     volume_index,
+		     &creation_time,
+		     &serial_number,
+		     device_path,
+		     64,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %" PRIu32 " values.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		print_count = narrow_string_snprintf(
+		               string,
+		               128,
+		               "%s\\WINDOWS\\SYSTEM32\\GEN%08" PRIX32 ".DLL",
+		               device_path,
+		               entry_index );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count != GENERATOR_FILENAME_LENGTH ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to format filename: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( generator_copy_utf16_string(
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     string,
+		     GENERATOR_FILENAME_LENGTH,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy filename: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		data_offset += ( GENERATOR_FILENAME_LENGTH + 1 ) * 2;
+	}
+	/* Write the volumes information, the volume information entries are followed by
+	 * the device path, file references and directory strings of every volume.
+	 * The offsets are relative to the start of the volumes information.
+	 */
+	volume_data_offset = generator->number_of_volumes * volume_information_size;
+
+	for( volume_index = 0;
+	     volume_index < generator->number_of_volumes;
+	     volume_index++ )
+	{
+		if( generator_get_volume_values(
+		     generator,
+		     volume_index,
+		     &creation_time,
+		     &serial_number,
+		     device_path,
+		     64,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %" PRIu32 " values.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		entry_data = &( data[ data_offset + ( volume_index * volume_information_size ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) entry_data )->device_path_offset,
+		 (uint32_t) volume_data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) entry_data )->device_path_number_of_characters,
+		 GENERATOR_DEVICE_PATH_LENGTH );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (scca_volume_information_v17_t *) entry_data )->creation_time,
+		 creation_time );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) entry_data )->serial_number,
+		 serial_number );
+
+		if( generator_copy_utf16_string(
+		     &( data[ data_offset + volume_data_offset ] ),
+		     data_size - ( data_offset + volume_data_offset ),
+		     device_path,
+		     GENERATOR_DEVICE_PATH_LENGTH,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy volume: %" PRIu32 " device path.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		volume_data_offset += ( GENERATOR_DEVICE_PATH_LENGTH + 1 ) * 2;
+
+		file_references_offset = (uint32_t) volume_data_offset;
+		file_references_size   = 8 + ( generator->number_of_file_references * 8 );
+
+		if( generator->format_version == 17 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + volume_data_offset ] ),
+			 1 );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + volume_data_offset ] ),
+			 3 );
+
+			file_references_size += 8;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + volume_data_offset + 4 ] ),
+		 generator->number_of_file_references );
+
+		volume_data_offset += file_references_size - ( generator->number_of_file_references * 8 );
+
+		for( entry_index = 0;
+		     entry_index < generator->number_of_file_references;
+		     entry_index++ )
+		{
+			file_reference = ( (uint64_t) ( 1 + ( generator_get_random_value( generator ) % 8 ) ) << 48 ) | ( 64 + entry_index );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset + volume_data_offset ] ),
+			 file_reference );
+
+			volume_data_offset += 8;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) entry_data )->file_references_offset,
+		 file_references_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) entry_data )->file_references_size,
+		 file_references_size );
+
+		if( generator->number_of_directory_strings > 0 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_volume_information_v17_t *) entry_data )->directory_strings_array_offset,
+			 (uint32_t) volume_data_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_volume_information_v17_t *) entry_data )->number_of_directory_strings,
+			 generator->number_of_directory_strings );
+		}
+		for( directory_string_index = 0;
+		     directory_string_index < generator->number_of_directory_strings;
+		     directory_string_index++ )
+		{
+			print_count = narrow_string_snprintf(
+			               string,
+			               128,
+			               "%s\\DIRECTORY%08" PRIX32 "",
+			               device_path,
+			               directory_string_index );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count != GENERATOR_DIRECTORY_STRING_LENGTH ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to format volume: %" PRIu32 " directory string: %" PRIu32 ".",
+				 function,
+				 volume_index,
+				 directory_string_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( data[ data_offset + volume_data_offset ] ),
+			 GENERATOR_DIRECTORY_STRING_LENGTH );
+
+			volume_data_offset += 2;
+
+			if( generator_copy_utf16_string(
+			     &( data[ data_offset + volume_data_offset ] ),
+			     data_size - ( data_offset + volume_data_offset ),
+			     string,
+			     GENERATOR_DIRECTORY_STRING_LENGTH,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to copy volume: %" PRIu32 " directory string: %" PRIu32 ".",
+				 function,
+				 volume_index,
+				 directory_string_index );
+
+				return( -1 );
+			}
+			volume_data_offset += ( GENERATOR_DIRECTORY_STRING_LENGTH + 1 ) * 2;
+		}
+	}
+	return( 1 );
+}
+
+/* Starts writing compressed data to the bit stream
+ * Two 16-bit words are reserved, which corresponds with the 32-bit look ahead of the decoder
+ * Returns 1 if successful or -1 on error
+ */
+int generator_bit_stream_start(
+     generator_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_bit_stream_start";
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_stream->byte_stream_offset > bit_stream->byte_stream_size )
+	 || ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->word_offsets[ 0 ] = bit_stream->byte_stream_offset;
+	bit_stream->word_offsets[ 1 ] = bit_stream->byte_stream_offset + 2;
+	bit_stream->bit_buffer        = 0;
+	bit_stream->bit_buffer_size   = 0;
+
+	bit_stream->byte_stream_offset += 4;
+
+	return( 1 );
+}
+
+/* Writes bits to the bit stream
+ * The bits are stored from the most to the least significant bit in 16-bit little-endian words
+ * Returns 1 if successful or -1 on error
+ */
+int generator_bit_stream_write(
+     generator_bit_stream_t *bit_stream,
+     uint32_t value,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_bit_stream_write";
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits == 0 )
+	{
+		return( 1 );
+	}
+	bit_stream->bit_buffer      <<= number_of_bits;
+	bit_stream->bit_buffer       |= value & ( ( (uint32_t) 1 << number_of_bits ) - 1 );
+	bit_stream->bit_buffer_size  += number_of_bits;
+
+	/* A word is only written when a bit of the next word is available, at which point
+	 * the decoder also reads the next word
+	 */
+	while( bit_stream->bit_buffer_size > 16 )
+	{
+		if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid byte stream size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		bit_stream->bit_buffer_size -= 16;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->word_offsets[ 0 ] ] ),
+		 (uint16_t) ( bit_stream->bit_buffer >> bit_stream->bit_buffer_size ) );
+
+		bit_stream->word_offsets[ 0 ] = bit_stream->word_offsets[ 1 ];
+		bit_stream->word_offsets[ 1 ] = bit_stream->byte_stream_offset;
+
+		bit_stream->byte_stream_offset += 2;
+	}
+	return( 1 );
+}
+
+/* Flushes the remaining bits to the reserved words of the bit stream
+ * Returns 1 if successful or -1 on error
+ */
+int generator_bit_stream_flush(
+     generator_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "generator_bit_stream_flush";
+	uint16_t value_16bit  = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream->bit_buffer_size > 0 )
+	{
+		value_16bit = (uint16_t) ( bit_stream->bit_buffer << ( 16 - bit_stream->bit_buffer_size ) );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( bit_stream->byte_stream[ bit_stream->word_offsets[ 0 ] ] ),
+	 value_16bit );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( bit_stream->byte_stream[ bit_stream->word_offsets[ 1 ] ] ),
+	 0 );
+
+	bit_stream->bit_buffer      = 0;
+	bit_stream->bit_buffer_size = 0;
+
+	return( 1 );
+}
+
+/* Builds the Huffman code sizes of the symbols
+ * The frequencies are halved until none of the code sizes exceeds the maximum code size
+ * Returns 1 if successful or -1 on error
+ */
+int generator_build_code_sizes(
+     const uint32_t *symbol_frequencies,
+     uint8_t *code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t node_weights[ 2 * GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ];
+	int16_t node_parents[ 2 * GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ];
+
+	static char *function       = "generator_build_code_sizes";
+	uint8_t code_size           = 0;
+	uint8_t maximum_code_size   = 0;
+	int node_index              = 0;
+	int number_of_nodes         = 0;
+	int number_of_roots         = 0;
+	int number_of_used_symbols  = 0;
+	int smallest_node_index     = 0;
+	int second_node_index       = 0;
+	int symbol                  = 0;
+
+	if( symbol_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		node_weights[ symbol ] = symbol_frequencies[ symbol ];
+
+		if( node_weights[ symbol ] > 0 )
+		{
+			number_of_used_symbols++;
+		}
+	}
+	/* A Huffman code requires at least 2 symbols
+	 */
+	for( symbol = 0;
+	     ( symbol < GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ) && ( number_of_used_symbols < 2 );
+	     symbol++ )
+	{
+		if( node_weights[ symbol ] == 0 )
+		{
+			node_weights[ symbol ] = 1;
+
+			number_of_used_symbols++;
+		}
+	}
+	do
+	{
+		for( node_index = 0;
+		     node_index < ( 2 * GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS );
+		     node_index++ )
+		{
+			node_parents[ node_index ] = -1;
+		}
+		number_of_nodes = GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS;
+
+		for( number_of_roots = number_of_used_symbols;
+		     number_of_roots > 1;
+		     number_of_roots-- )
+		{
+			smallest_node_index = -1;
+			second_node_index   = -1;
+
+			for( node_index = 0;
+			     node_index < number_of_nodes;
+			     node_index++ )
+			{
+				if( ( node_weights[ node_index ] == 0 )
+				 || ( node_parents[ node_index ] != -1 ) )
+				{
+					continue;
+				}
+				if( ( smallest_node_index == -1 )
+				 || ( node_weights[ node_index ] < node_weights[ smallest_node_index ] ) )
+				{
+					second_node_index   = smallest_node_index;
+					smallest_node_index = node_index;
+				}
+				else if( ( second_node_index == -1 )
+				      || ( node_weights[ node_index ] < node_weights[ second_node_index ] ) )
+				{
+					second_node_index = node_index;
+				}
+			}
+			node_weights[ number_of_nodes ] = node_weights[ smallest_node_index ] + node_weights[ second_node_index ];
+
+			node_parents[ smallest_node_index ] = (int16_t) number_of_nodes;
+			node_parents[ second_node_index ]   = (int16_t) number_of_nodes;
+
+			number_of_nodes++;
+		}
+		maximum_code_size = 0;
+
+		for( symbol = 0;
+		     symbol < GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS;
+		     symbol++ )
+		{
+			code_size = 0;
+
+			if( node_weights[ symbol ] > 0 )
+			{
+				for( node_index = symbol;
+				     node_parents[ node_index ] != -1;
+				     node_index = node_parents[ node_index ] )
+				{
+					code_size++;
+				}
+			}
+			code_sizes[ symbol ] = code_size;
+
+			if( code_size > maximum_code_size )
+			{
+				maximum_code_size = code_size;
+			}
+		}
+		if( maximum_code_size > GENERATOR_COMPRESSION_MAXIMUM_CODE_SIZE )
+		{
+			for( symbol = 0;
+			     symbol < GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS;
+			     symbol++ )
+			{
+				if( node_weights[ symbol ] > 0 )
+				{
+					node_weights[ symbol ] = ( node_weights[ symbol ] >> 1 ) | 1;
+				}
+			}
+		}
+	}
+	while( maximum_code_size > GENERATOR_COMPRESSION_MAXIMUM_CODE_SIZE );
+
+	return( 1 );
+}
+
+/* Compresses a chunk of at most 65536 bytes using LZXpress Huffman compression
+ * Matches do not cross the chunk boundary and are limited to 17 bytes, so that
+ * no additional length bytes are needed
+ * Returns 1 if successful or -1 on error
+ */
+int generator_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int is_last_chunk,
+     int32_t *hash_table,
+     uint32_t *tokens,
+     generator_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	uint32_t symbol_frequencies[ GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ];
+	uint16_t symbol_codes[ GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ];
+	uint8_t code_sizes[ GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ];
+
+	static char *function           = "generator_compress_chunk";
+	size_t match_index              = 0;
+	size_t match_size               = 0;
+	size_t maximum_match_size       = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t distance               = 0;
+	uint32_t hash_value             = 0;
+	uint32_t number_of_tokens       = 0;
+	uint32_t symbol                 = 0;
+	uint32_t token_index            = 0;
+	uint16_t code                   = 0;
+	uint8_t code_size               = 0;
+	uint8_t offset_size             = 0;
+	int32_t match_offset            = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) GENERATOR_COMPRESSION_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tokens.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_stream->byte_stream_offset > bit_stream->byte_stream_size )
+	 || ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     symbol_frequencies,
+	     0,
+	     sizeof( uint32_t ) * GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear symbol frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0xff,
+	     sizeof( int32_t ) * GENERATOR_COMPRESSION_HASH_TABLE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the literals and matches, where a token contains the symbol
+	 * in the upper 16 bits and the match offset bits in the lower 16 bits
+	 */
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		match_size = 0;
+
+		if( ( uncompressed_data_size - uncompressed_data_offset ) >= 3 )
+		{
+			hash_value = ( (uint32_t) uncompressed_data[ uncompressed_data_offset ] << 10 )
+			           ^ ( (uint32_t) uncompressed_data[ uncompressed_data_offset + 1 ] << 5 )
+			           ^ (uint32_t) uncompressed_data[ uncompressed_data_offset + 2 ];
+			hash_value &= GENERATOR_COMPRESSION_HASH_TABLE_SIZE - 1;
+
+			match_offset = hash_table[ hash_value ];
+
+			hash_table[ hash_value ] = (int32_t) uncompressed_data_offset;
+
+			if( match_offset >= 0 )
+			{
+				maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+				if( maximum_match_size > GENERATOR_COMPRESSION_MAXIMUM_MATCH_SIZE )
+				{
+					maximum_match_size = GENERATOR_COMPRESSION_MAXIMUM_MATCH_SIZE;
+				}
+				while( ( match_size < maximum_match_size )
+				    && ( uncompressed_data[ (size_t) match_offset + match_size ] == uncompressed_data[ uncompressed_data_offset + match_size ] ) )
+				{
+					match_size++;
+				}
+			}
+		}
+		if( match_size >= 3 )
+		{
+			distance    = (uint32_t) ( uncompressed_data_offset - (size_t) match_offset );
+			offset_size = 0;
+
+			while( ( distance >> ( offset_size + 1 ) ) != 0 )
+			{
+				offset_size++;
+			}
+			symbol = 256 + ( (uint32_t) offset_size << 4 ) + (uint32_t) ( match_size - 3 );
+
+			tokens[ number_of_tokens++ ] = ( symbol << 16 ) | ( distance - ( (uint32_t) 1 << offset_size ) );
+
+			for( match_index = 1;
+			     match_index < match_size;
+			     match_index++ )
+			{
+				if( ( uncompressed_data_size - ( uncompressed_data_offset + match_index ) ) >= 3 )
+				{
+					hash_value = ( (uint32_t) uncompressed_data[ uncompressed_data_offset + match_index ] << 10 )
+					           ^ ( (uint32_t) uncompressed_data[ uncompressed_data_offset + match_index + 1 ] << 5 )
+					           ^ (uint32_t) uncompressed_data[ uncompressed_data_offset + match_index + 2 ];
+					hash_value &= GENERATOR_COMPRESSION_HASH_TABLE_SIZE - 1;
+
+					hash_table[ hash_value ] = (int32_t) ( uncompressed_data_offset + match_index );
+				}
+			}
+			uncompressed_data_offset += match_size;
+		}
+		else
+		{
+			symbol = uncompressed_data[ uncompressed_data_offset ];
+
+			tokens[ number_of_tokens++ ] = symbol << 16;
+
+			uncompressed_data_offset += 1;
+		}
+		symbol_frequencies[ symbol ] += 1;
+	}
+	/* The last chunk is terminated by the end-of-block symbol
+	 */
+	if( is_last_chunk != 0 )
+	{
+		tokens[ number_of_tokens++ ] = (uint32_t) 256 << 16;
+
+		symbol_frequencies[ 256 ] += 1;
+	}
+	if( generator_build_code_sizes(
+	     symbol_frequencies,
+	     code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Assign the canonical Huffman codes ordered by code size and symbol
+	 */
+	for( code_size = 1;
+	     code_size <= GENERATOR_COMPRESSION_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		for( symbol = 0;
+		     symbol < GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS;
+		     symbol++ )
+		{
+			if( code_sizes[ symbol ] == code_size )
+			{
+				symbol_codes[ symbol ] = code++;
+			}
+		}
+		code <<= 1;
+	}
+	/* The code sizes are stored as 4-bit values, the first symbol in the lower nibble
+	 */
+	for( symbol = 0;
+	     symbol < GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS;
+	     symbol += 2 )
+	{
+		bit_stream->byte_stream[ bit_stream->byte_stream_offset++ ] = code_sizes[ symbol ] | (uint8_t) ( code_sizes[ symbol + 1 ] << 4 );
+	}
+	if( generator_bit_stream_start(
+	     bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to start bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( token_index = 0;
+	     token_index < number_of_tokens;
+	     token_index++ )
+	{
+		symbol = tokens[ token_index ] >> 16;
+
+		if( generator_bit_stream_write(
+		     bit_stream,
+		     symbol_codes[ symbol ],
+		     code_sizes[ symbol ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write symbol: %" PRIu32 ".",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		if( symbol >= 256 )
+		{
+			offset_size = (uint8_t) ( ( symbol - 256 ) >> 4 );
+
+			if( generator_bit_stream_write(
+			     bit_stream,
+			     tokens[ token_index ] & 0x0000ffffUL,
+			     offset_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write match offset.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( generator_bit_stream_flush(
+	     bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to flush bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum size of the LZXpress Huffman compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int generator_get_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "generator_get_compressed_data_size";
+	size_t number_of_chunks = 0;
+
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_chunks = ( uncompressed_data_size + GENERATOR_COMPRESSION_CHUNK_SIZE - 1 ) / GENERATOR_COMPRESSION_CHUNK_SIZE;
+
+	/* Every chunk consists of a 256 bytes code sizes table and at most 15 bits for
+	 * every byte and the end-of-block symbol, plus the 2 reserved words
+	 */
+	*compressed_data_size = ( number_of_chunks * ( 256 + 8 ) ) + ( 2 * uncompressed_data_size );
+
+	return( 1 );
+}
+
+/* Compresses data using LZXpress Huffman compression
+ * On input compressed_data_size contains the size of the compressed data buffer
+ * and on output the size of the compressed data
+ * Returns 1 if successful or -1 on error
+ */
+int generator_compress_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	generator_bit_stream_t bit_stream;
+
+	int32_t *hash_table             = NULL;
+	uint32_t *tokens                = NULL;
+	static char *function           = "generator_compress_data";
+	size_t chunk_size               = 0;
+	size_t uncompressed_data_offset = 0;
+	int is_last_chunk               = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table = (int32_t *) memory_allocate(
+	                          sizeof( int32_t ) * GENERATOR_COMPRESSION_HASH_TABLE_SIZE );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	tokens = (uint32_t *) memory_allocate(
+	                       sizeof( uint32_t ) * ( GENERATOR_COMPRESSION_CHUNK_SIZE + 1 ) );
+
+	if( tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tokens.",
+		 function );
+
+		goto on_error;
+	}
+	bit_stream.byte_stream        = compressed_data;
+	bit_stream.byte_stream_size   = *compressed_data_size;
+	bit_stream.byte_stream_offset = 0;
+
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		chunk_size = uncompressed_data_size - uncompressed_data_offset;
+
+		if( chunk_size > GENERATOR_COMPRESSION_CHUNK_SIZE )
+		{
+			chunk_size = GENERATOR_COMPRESSION_CHUNK_SIZE;
+		}
+		is_last_chunk = (int) ( ( uncompressed_data_offset + chunk_size ) == uncompressed_data_size );
+
+		if( generator_compress_chunk(
+		     &( uncompressed_data[ uncompressed_data_offset ] ),
+		     chunk_size,
+		     is_last_chunk,
+		     hash_table,
+		     tokens,
+		     &bit_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk at offset: %" PRIzd ".",
+			 function,
+			 uncompressed_data_offset );
+
+			goto on_error;
+		}
+		uncompressed_data_offset += chunk_size;
+	}
+	*compressed_data_size = bit_stream.byte_stream_offset;
+
+	memory_free(
+	 tokens );
+
+	memory_free(
+	 hash_table );
+
+	return( 1 );
+
+on_error:
+	if( tokens != NULL )
+	{
+		memory_free(
+		 tokens );
+	}
+	if( hash_table != NULL )
+	{
+		memory_free(
+		 hash_table );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,284 @@
+/*
+ * Generator of synthetic prefetch files
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GENERATOR_H )
+#define _GENERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "bench_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of entries of the generated arrays
+ */
+#define GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES		1048576
+
+/* The maximum number of filenames, which matches the maximum supported by libscca
+ */
+#define GENERATOR_MAXIMUM_NUMBER_OF_FILENAMES		8192
+
+/* The number of characters of the generated strings without the end-of-string character
+ */
+#define GENERATOR_DEVICE_PATH_LENGTH			34
+#define GENERATOR_DIRECTORY_STRING_LENGTH		( GENERATOR_DEVICE_PATH_LENGTH + 18 )
+#define GENERATOR_EXECUTABLE_FILENAME_LENGTH		15
+#define GENERATOR_FILENAME_LENGTH			( GENERATOR_DEVICE_PATH_LENGTH + 33 )
+
+/* The FILETIME the generated date and time values are based on
+ */
+#define GENERATOR_BASE_FILETIME				0x01d5000000000000ULL
+
+/* The size of an uncompressed chunk of the LZXpress Huffman compressed data
+ */
+#define GENERATOR_COMPRESSION_CHUNK_SIZE		65536
+
+/* The number of Huffman symbols of the LZXpress Huffman compressed data
+ */
+#define GENERATOR_COMPRESSION_NUMBER_OF_SYMBOLS		512
+
+/* The maximum Huffman code size of the LZXpress Huffman compressed data
+ */
+#define GENERATOR_COMPRESSION_MAXIMUM_CODE_SIZE		15
+
+/* The maximum compression match size, larger sizes require additional length bytes
+ */
+#define GENERATOR_COMPRESSION_MAXIMUM_MATCH_SIZE	17
+
+/* The number of entries of the compression match hash table
+ */
+#define GENERATOR_COMPRESSION_HASH_TABLE_SIZE		32768
+
+typedef struct generator generator_t;
+
+struct generator
+{
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The number of file metrics entries
+	 */
+	uint32_t number_of_file_metrics_entries;
+
+	/* The number of filenames
+	 */
+	uint32_t number_of_filenames;
+
+	/* The number of trace chain entries
+	 */
+	uint32_t number_of_trace_chain_entries;
+
+	/* The number of volumes
+	 */
+	uint32_t number_of_volumes;
+
+	/* The number of directory strings per volume
+	 */
+	uint32_t number_of_directory_strings;
+
+	/* The number of file references per volume
+	 */
+	uint32_t number_of_file_references;
+
+	/* The seed of the pseudo random number generator
+	 */
+	uint32_t seed;
+
+	/* The state of the pseudo random number generator
+	 */
+	uint32_t random_state;
+
+	/* The file information size
+	 */
+	uint32_t file_information_size;
+
+	/* The metrics array offset, which determines the file information variant
+	 */
+	uint32_t metrics_array_offset;
+
+	/* The trace chain array offset
+	 */
+	uint32_t trace_chain_array_offset;
+
+	/* The filename strings offset
+	 */
+	uint32_t filename_strings_offset;
+
+	/* The filename strings size
+	 */
+	uint32_t filename_strings_size;
+
+	/* The volumes information offset
+	 */
+	uint32_t volumes_information_offset;
+
+	/* The volumes information size
+	 */
+	uint32_t volumes_information_size;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct generator_bit_stream generator_bit_stream_t;
+
+struct generator_bit_stream
+{
+	/* The byte stream
+	 */
+	uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The byte stream offset
+	 */
+	size_t byte_stream_offset;
+
+	/* The offsets of the 16-bit words reserved in the byte stream
+	 */
+	size_t word_offsets[ 2 ];
+
+	/* The bit buffer
+	 */
+	uint32_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
+};
+
+int generator_initialize(
+     generator_t **generator,
+     libcerror_error_t **error );
+
+int generator_free(
+     generator_t **generator,
+     libcerror_error_t **error );
+
+int generator_set_format_version(
+     generator_t *generator,
+     uint32_t format_version,
+     uint32_t metrics_array_offset,
+     libcerror_error_t **error );
+
+int generator_set_number_of_entries(
+     generator_t *generator,
+     uint32_t number_of_file_metrics_entries,
+     uint32_t number_of_filenames,
+     uint32_t number_of_trace_chain_entries,
+     uint32_t number_of_volumes,
+     uint32_t number_of_directory_strings,
+     uint32_t number_of_file_references,
+     libcerror_error_t **error );
+
+int generator_set_seed(
+     generator_t *generator,
+     uint32_t seed,
+     libcerror_error_t **error );
+
+uint32_t generator_get_random_value(
+          generator_t *generator );
+
+int generator_calculate_layout(
+     generator_t *generator,
+     libcerror_error_t **error );
+
+int generator_get_data_size(
+     generator_t *generator,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int generator_get_volume_values(
+     generator_t *generator,
+     uint32_t volume_index,
+     uint64_t *creation_time,
+     uint32_t *serial_number,
+     char *device_path,
+     size_t device_path_size,
+     libcerror_error_t **error );
+
+int generator_copy_utf16_string(
+     uint8_t *data,
+     size_t data_size,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int generator_write_data(
+     generator_t *generator,
+     uint32_t file_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int generator_bit_stream_start(
+     generator_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int generator_bit_stream_write(
+     generator_bit_stream_t *bit_stream,
+     uint32_t value,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+int generator_bit_stream_flush(
+     generator_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int generator_build_code_sizes(
+     const uint32_t *symbol_frequencies,
+     uint8_t *code_sizes,
+     libcerror_error_t **error );
+
+int generator_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int is_last_chunk,
+     int32_t *hash_table,
+     uint32_t *tokens,
+     generator_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+int generator_get_compressed_data_size(
+     size_t uncompressed_data_size,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+int generator_compress_data(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GENERATOR_H ) */
+
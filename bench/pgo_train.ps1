@@ -0,0 +1,109 @@
+# Profile guided optimization training workload script
+#
+# Version: 20201014
+#
+# Runs sccainfo and pyscca on a set of source files so that the binaries
+# built with: .\build.ps1 -ProfileGuidedOptimization Instrument
+# record the hot paths in .pgc files, after which the binaries are rebuilt
+# with: .\build.ps1 -ProfileGuidedOptimization Optimize
+#
+# The script is run from the bench directory. The instrumented binaries
+# require the pgort DLL of Visual Studio to be in the PATH.
+
+Param (
+	[string]$Sources = "..\tests\input\public",
+	[string]$PythonPath = "C:\Python37"
+)
+
+$ExitSuccess = 0
+$ExitFailure = 1
+
+$Python = "${PythonPath}\python.exe"
+
+Function GetExecutablesDirectory
+{
+	$ExecutablesDirectory = ""
+
+	ForEach (${VSDirectory} in "msvscpp vs2008 vs2010 vs2012 vs2013 vs2015 vs2017 vs2019" -split " ")
+	{
+		ForEach (${VSPlatform} in "Win32 x64" -split " ")
+		{
+			$ExecutablesDirectory = "..\${VSDirectory}\Release\${VSPlatform}"
+
+			If (Test-Path ${ExecutablesDirectory})
+			{
+				Return ${ExecutablesDirectory}
+			}
+		}
+		$ExecutablesDirectory = "..\${VSDirectory}\Release"
+
+		If (Test-Path ${ExecutablesDirectory})
+		{
+			Return ${ExecutablesDirectory}
+		}
+	}
+	Return ${ExecutablesDirectory}
+}
+
+$ExecutablesDirectory = GetExecutablesDirectory
+
+$InfoExecutable = "${ExecutablesDirectory}\sccainfo.exe"
+
+If (-Not (Test-Path ${InfoExecutable}))
+{
+	Write-Host "Missing training executable: ${InfoExecutable}" -foreground Red
+	Write-Host "Run: .\build.ps1 -ProfileGuidedOptimization Instrument in the top directory first."
+
+	Exit ${ExitFailure}
+}
+$SourceFiles = Get-ChildItem -Path "${Sources}" -Filter "*.pf" -Recurse | ForEach-Object { $_.FullName }
+
+If (-Not ${SourceFiles})
+{
+	Write-Host "Missing training sources in: ${Sources}" -foreground Red
+
+	Exit ${ExitFailure}
+}
+Write-Host "Training: sccainfo"
+
+ForEach (${SourceFile} in ${SourceFiles})
+{
+	$Output = Invoke-Expression -Command "& '${InfoExecutable}' '${SourceFile}' 2>&1"
+
+	If (${LastExitCode} -ne ${ExitSuccess})
+	{
+		Write-Host "Training workload failed on: ${SourceFile}" -foreground Red
+
+		Exit ${ExitFailure}
+	}
+}
+$Output = Invoke-Expression -Command "& '${InfoExecutable}' -s $((${SourceFiles} | ForEach-Object { "'$_'" }) -join ' ') 2>&1"
+
+If (${LastExitCode} -ne ${ExitSuccess})
+{
+	Write-Host "Training workload failed on: sccainfo -s" -foreground Red
+
+	Exit ${ExitFailure}
+}
+If ((Test-Path ${Python}) -And (Test-Path "${ExecutablesDirectory}\pyscca.pyd"))
+{
+	Write-Host "Training: pyscca"
+
+	${Env:PYTHONPATH} = ${ExecutablesDirectory}
+
+	$Script = "import sys`nimport pyscca`nfor path in sys.argv[1:]:`n  scca_file = pyscca.file()`n  scca_file.open(path)`n  _ = scca_file.executable_filename`n  _ = [filename for filename in scca_file.filenames]`n  _ = [(entry.filename, entry.file_reference) for entry in scca_file.file_metrics_entries]`n  _ = [list(volume.directory_strings) for volume in scca_file.volumes]`n  scca_file.close()`n"
+
+	& ${Python} -c ${Script} ${SourceFiles}
+
+	If (${LastExitCode} -ne ${ExitSuccess})
+	{
+		Write-Host "Training workload failed on: pyscca" -foreground Red
+
+		Exit ${ExitFailure}
+	}
+}
+Else
+{
+	Write-Host "Training: pyscca (SKIP)"
+}
+Exit ${ExitSuccess}
@@ -0,0 +1,194 @@
+#!/bin/bash
+# Profile guided optimization training workload script
+#
+# Version: 20201014
+#
+# Runs the benchmarks, sccainfo and pyscca on a generated corpus so that the
+# instrumented binaries of "make profile-generate" record the hot paths of
+# the MAM decoding, the filename strings, the file metrics and the volume
+# information. The script is run from the bench directory by "make profile-train".
+#
+# When PGO_TRAIN_SOURCES is set it contains additional source files that
+# are added to the generated corpus, for example a set of representative
+# Prefetch files.
+#
+# When PYTHON is set it contains the Python interpreter used to run the
+# pyscca workload, otherwise the pyscca workload is skipped.
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+
+# The profiles of the corpus, every profile is generated with the same seed.
+PROFILES=("format_17" "format_23" "format_26" "format_30" "format_30_compressed");
+OPTIONS_PER_PROFILE=("-F 17" "-F 23" "-F 26" "-F 30" "-F 30 -c");
+
+CORPUS_OPTIONS="-n 16 -s 1 -m 1024 -f 1024 -t 16384 -v 4 -d 64 -r 256";
+BENCH_OPTIONS="-i 20 -o jsonl";
+SECTIONS_FORMAT_VERSIONS="17 23 26 30";
+
+# Retrieves the path of an executable, taking the extension into account.
+#
+# Arguments:
+#   a string containing the path of the executable without extension
+#
+# Returns:
+#   a string containing the path of the executable or an empty string if not available
+#
+get_executable()
+{
+	local EXECUTABLE=$1;
+
+	if test -x "${EXECUTABLE}";
+	then
+		echo "${EXECUTABLE}";
+
+	elif test -x "${EXECUTABLE}.exe";
+	then
+		echo "${EXECUTABLE}.exe";
+	fi
+}
+
+BENCH_EXECUTABLE=$(get_executable "./scca_bench");
+DECOMPRESS_EXECUTABLE=$(get_executable "./scca_bench_decompress");
+SECTIONS_EXECUTABLE=$(get_executable "./scca_bench_sections");
+GENERATE_EXECUTABLE=$(get_executable "./scca_generate");
+INFO_EXECUTABLE=$(get_executable "../sccatools/sccainfo");
+
+for EXECUTABLE in "${BENCH_EXECUTABLE}" "${DECOMPRESS_EXECUTABLE}" "${SECTIONS_EXECUTABLE}" "${GENERATE_EXECUTABLE}" "${INFO_EXECUTABLE}";
+do
+	if test -z "${EXECUTABLE}";
+	then
+		echo "Missing training executable.";
+		echo "Run: 'make profile-generate' in the top directory first.";
+
+		exit ${EXIT_FAILURE};
+	fi
+done
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+RESULT=${EXIT_SUCCESS};
+
+for PROFILE_INDEX in ${!PROFILES[*]};
+do
+	TRAIN_PROFILE=${PROFILES[${PROFILE_INDEX}]};
+
+	IFS=" " read -a OPTIONS <<< "${OPTIONS_PER_PROFILE[${PROFILE_INDEX}]} ${CORPUS_OPTIONS}";
+
+	echo "Generating corpus of profile: ${TRAIN_PROFILE}";
+
+	${GENERATE_EXECUTABLE} ${OPTIONS[@]} ${TMPDIR}/${TRAIN_PROFILE} > /dev/null;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate corpus of profile: ${TRAIN_PROFILE}";
+
+		break;
+	fi
+done
+
+if test ${RESULT} -eq ${EXIT_SUCCESS} && test -n "${PGO_TRAIN_SOURCES}";
+then
+	cp ${PGO_TRAIN_SOURCES} ${TMPDIR}/;
+	RESULT=$?;
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	echo "Training: open and parse";
+
+	${BENCH_EXECUTABLE} ${BENCH_OPTIONS} ${TMPDIR}/*.pf > /dev/null;
+	RESULT=$?;
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	echo "Training: MAM decompression";
+
+	${DECOMPRESS_EXECUTABLE} ${BENCH_OPTIONS} ${TMPDIR}/format_30_compressed-*.pf > /dev/null;
+	RESULT=$?;
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	for FORMAT_VERSION in ${SECTIONS_FORMAT_VERSIONS};
+	do
+		echo "Training: sections of format version: ${FORMAT_VERSION}";
+
+		${SECTIONS_EXECUTABLE} -F ${FORMAT_VERSION} ${BENCH_OPTIONS} > /dev/null;
+		RESULT=$?;
+
+		if test ${RESULT} -ne ${EXIT_SUCCESS};
+		then
+			break;
+		fi
+	done
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	echo "Training: sccainfo";
+
+	${INFO_EXECUTABLE} ${TMPDIR}/*.pf > /dev/null;
+	RESULT=$?;
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS};
+then
+	${INFO_EXECUTABLE} -s ${TMPDIR}/*.pf > /dev/null;
+	RESULT=$?;
+fi
+
+if test ${RESULT} -eq ${EXIT_SUCCESS} && test -n "${PYTHON}";
+then
+	PYTHONPATH="../pyscca/.libs" ${PYTHON} -c "import pyscca" 2> /dev/null;
+
+	if test $? -ne ${EXIT_SUCCESS};
+	then
+		echo "Training: pyscca (SKIP)";
+	else
+		echo "Training: pyscca";
+
+		PYTHONPATH="../pyscca/.libs" ${PYTHON} - ${TMPDIR}/*.pf <<EOT
+import sys
+
+import pyscca
+
+for path in sys.argv[1:]:
+  scca_file = pyscca.file()
+  scca_file.open(path)
+
+  _ = scca_file.executable_filename
+  _ = scca_file.get_last_run_times()
+
+  for filename in scca_file.filenames:
+    pass
+
+  for file_metrics in scca_file.file_metrics_entries:
+    _ = file_metrics.filename
+    _ = file_metrics.file_reference
+
+  for volume_information in scca_file.volumes:
+    _ = volume_information.device_path
+
+    for directory_string in volume_information.directory_strings:
+      pass
+
+  scca_file.close()
+EOT
+		RESULT=$?;
+	fi
+fi
+
+if test ${RESULT} -ne ${EXIT_SUCCESS};
+then
+	echo "Training workload failed.";
+fi
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
@@ -0,0 +1,179 @@
+#!/usr/bin/env python
+#
+# Benchmarks the time needed to import pyscca and open a first file
+#
+# Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import subprocess
+import sys
+
+
+# Every run is a new interpreter so that the module is not already imported.
+# The interpreter start up is not part of the measured time.
+CHILD_SCRIPT = """
+import sys
+import time
+
+timer = getattr(time, "perf_counter", time.time)
+
+start_time = timer()
+
+import pyscca
+
+import_time = timer()
+
+if len(sys.argv) > 1:
+  scca_file = pyscca.open(sys.argv[1])
+  _ = scca_file.executable_filename
+  scca_file.close()
+
+open_time = timer()
+
+sys.stdout.write("{0:d} {1:d}\\n".format(
+    int((import_time - start_time) * 1000000000),
+    int((open_time - start_time) * 1000000000)))
+"""
+
+
+def GetPercentile(values, percentile):
+  """Retrieves a percentile of sorted values.
+
+  Args:
+    values (list[int]): sorted values.
+    percentile (int): percentile.
+
+  Returns:
+    int: value of the percentile.
+  """
+  index = ((len(values) - 1) * percentile) // 100
+  return values[index]
+
+
+def RunChild(source):
+  """Runs the benchmark in a new interpreter.
+
+  Args:
+    source (str): path of the source to open or None.
+
+  Returns:
+    tuple[int, int]: nanoseconds needed to import and to import and open.
+
+  Raises:
+    RuntimeError: if the child interpreter failed.
+  """
+  arguments = [sys.executable, "-c", CHILD_SCRIPT]
+  if source:
+    arguments.append(source)
+
+  process = subprocess.Popen(arguments, stdout=subprocess.PIPE)
+  output, _ = process.communicate()
+  if process.returncode != 0:
+    raise RuntimeError("child interpreter failed with: {0:d}".format(
+        process.returncode))
+
+  import_time, open_time = output.decode("ascii").split()
+  return int(import_time), int(open_time)
+
+
+def PrintResult(output_format, benchmark_type, source, values):
+  """Prints the result of a benchmark.
+
+  Args:
+    output_format (str): output format, either text or jsonl.
+    benchmark_type (str): benchmark type, either import or import_and_open.
+    source (str): path of the source or None.
+    values (list[int]): sorted nanoseconds per run.
+  """
+  minimum = values[0]
+  p50 = GetPercentile(values, 50)
+  maximum = values[-1]
+
+  if output_format == "jsonl":
+    source_string = "null"
+    if source:
+      source_string = "\"{0:s}\"".format(
+          source.replace("\\", "\\\\").replace("\"", "\\\""))
+
+    sys.stdout.write((
+        "{{\"type\": \"{0:s}\", \"source\": {1:s}, \"number_of_runs\": {2:d}"
+        ", \"latency_minimum_ns\": {3:d}, \"latency_p50_ns\": {4:d}"
+        ", \"latency_maximum_ns\": {5:d}}}\n").format(
+            benchmark_type, source_string, len(values), minimum, p50,
+            maximum))
+  else:
+    sys.stdout.write("{0:s}".format(benchmark_type))
+    if source:
+      sys.stdout.write(" of: {0:s}".format(source))
+    sys.stdout.write((
+        "\n\truns\t\t: {0:d}\n\tminimum\t\t: {1:d} ns\n"
+        "\tmedian\t\t: {2:d} ns\n\tmaximum\t\t: {3:d} ns\n\n").format(
+            len(values), minimum, p50, maximum))
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      "Benchmarks the time needed to import pyscca and open a first file."))
+
+  argument_parser.add_argument(
+      "-i", "--iterations", dest="iterations", type=int, default=20,
+      help="number of runs per benchmark, default is 20.")
+
+  argument_parser.add_argument(
+      "-o", "--output", dest="output_format", choices=["text", "jsonl"],
+      default="text", help="output format, default is text.")
+
+  argument_parser.add_argument(
+      "sources", nargs="*", metavar="PATH", default=[],
+      help="paths of the sources opened after the import.")
+
+  options = argument_parser.parse_args()
+
+  if options.iterations < 1:
+    sys.stderr.write("Unsupported number of iterations.\n")
+    return False
+
+  import_times = []
+  for _ in range(options.iterations):
+    import_time, _ = RunChild(None)
+    import_times.append(import_time)
+
+  PrintResult(options.output_format, "import", None, sorted(import_times))
+
+  for source in options.sources:
+    open_times = []
+    for _ in range(options.iterations):
+      _, open_time = RunChild(source)
+      open_times.append(open_time)
+
+    PrintResult(
+        options.output_format, "import_and_open", source, sorted(open_times))
+
+  return True
+
+
+if __name__ == "__main__":
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
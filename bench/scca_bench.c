@@ -0,0 +1,1335 @@
+/*
+ * Benchmarks the open and parse throughput of Windows Prefetch Files (PF)
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_input.h"
+#include "bench_libbfio.h"
+#include "bench_libcerror.h"
+#include "bench_libscca.h"
+#include "bench_output.h"
+#include "bench_samples.h"
+#include "bench_timer.h"
+#include "../sccatools/sccatools_getopt.h"
+
+#if !defined( LIBSCCA_HAVE_BFIO )
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+LIBSCCA_EXTERN \
+int libscca_file_open_file_io_handle(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libscca_error_t **error );
+
+#endif /* !defined( LIBSCCA_HAVE_BFIO ) */
+
+/* The default number of times every source is opened and parsed
+ */
+#define SCCA_BENCH_DEFAULT_NUMBER_OF_ITERATIONS		100
+
+/* The maximum number of times every source is opened and parsed
+ */
+#define SCCA_BENCH_MAXIMUM_NUMBER_OF_ITERATIONS		1000000
+
+/* The size of the buffer the strings are copied into during the traversal
+ */
+#define SCCA_BENCH_STRING_BUFFER_SIZE			( 128 * 1024 )
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use scca_bench to measure the open and parse throughput of\n"
+	                 "Windows Prefetch Files (PF).\n\n" );
+
+	fprintf( stream, "Usage: scca_bench [ -i iterations ] [ -o format ] [ -hV ] sources\n\n" );
+
+	fprintf( stream, "\tsources: one or more source files\n\n" );
+
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-i:      the number of times every source is opened and\n"
+	                 "\t         fully traversed (default is 100), the sources are\n"
+	                 "\t         read into memory and opened once beforehand to\n"
+	                 "\t         warm up\n" );
+	fprintf( stream, "\t-o:      output format, options: text (default) or jsonl\n"
+	                 "\t         (JSON Lines), jsonl prints one record per source\n"
+	                 "\t         and a final record with the totals\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+/* Retrieves all the values of a file in the same way a consumer would
+ * The strings are copied into the string buffer as UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_traverse_file(
+     libscca_file_t *file,
+     uint8_t *string_buffer,
+     size_t string_buffer_size,
+     libcerror_error_t **error )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	libscca_file_metrics_t *file_metrics             = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	static char *function                            = "scca_bench_traverse_file";
+	size_t string_size                               = 0;
+	uint64_t value_64bit                             = 0;
+	uint32_t value_32bit                             = 0;
+	int directory_string_index                       = 0;
+	int entry_index                                  = 0;
+	int number_of_directory_strings                  = 0;
+	int number_of_entries                            = 0;
+	int number_of_filetimes                          = 0;
+	int number_of_values                             = 0;
+
+	if( libscca_file_get_utf8_executable_filename_size(
+	     file,
+	     &string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( string_size > string_buffer_size )
+	 || ( libscca_file_get_utf8_executable_filename(
+	       file,
+	       string_buffer,
+	       string_size,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_run_count(
+	     file,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_last_run_times(
+	     file,
+	     filetimes,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_file_get_file_metrics_entry(
+		     file,
+		     entry_index,
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_file_metrics_get_utf8_filename_size(
+		     file_metrics,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d filename size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( string_size > string_buffer_size )
+		 || ( libscca_file_metrics_get_utf8_filename(
+		       file_metrics,
+		       string_buffer,
+		       string_size,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d filename.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_file_metrics_get_file_reference(
+		     file_metrics,
+		     &value_64bit,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d file reference.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_file_metrics_free(
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_number_of_filenames(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_file_get_utf8_filename_size(
+		     file,
+		     entry_index,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( string_size > string_buffer_size )
+		 || ( libscca_file_get_utf8_filename(
+		       file,
+		       entry_index,
+		       string_buffer,
+		       string_size,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_number_of_volumes(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     file,
+		     entry_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_creation_time(
+		     volume_information,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d creation time.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_serial_number(
+		     volume_information,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d serial number.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_utf8_device_path_size(
+		     volume_information,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d device path size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( ( string_size > string_buffer_size )
+		 || ( libscca_volume_information_get_utf8_device_path(
+		       volume_information,
+		       string_buffer,
+		       string_size,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d device path.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_number_of_file_references(
+		     volume_information,
+		     &number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d number of file references.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_number_of_directory_strings(
+		     volume_information,
+		     &number_of_directory_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d number of directory strings.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		for( directory_string_index = 0;
+		     directory_string_index < number_of_directory_strings;
+		     directory_string_index++ )
+		{
+			if( libscca_volume_information_get_utf8_directory_string_size(
+			     volume_information,
+			     directory_string_index,
+			     &string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d directory string: %d size.",
+				 function,
+				 entry_index,
+				 directory_string_index );
+
+				goto on_error;
+			}
+			if( ( string_size > string_buffer_size )
+			 || ( libscca_volume_information_get_utf8_directory_string(
+			       volume_information,
+			       directory_string_index,
+			       string_buffer,
+			       string_size,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d directory string: %d.",
+				 function,
+				 entry_index,
+				 directory_string_index );
+
+				goto on_error;
+			}
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume: %d information.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the results of a benchmark
+ * The source is NULL for the totals over all sources
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_results_fprint(
+     FILE *stream,
+     int output_format,
+     const system_character_t *source,
+     uint32_t format_version,
+     uint64_t number_of_bytes,
+     uint64_t number_of_allocations,
+     bench_samples_t *samples,
+     libcerror_error_t **error )
+{
+	static char *function         = "scca_bench_results_fprint";
+	double allocations_per_file   = 0.0;
+	double files_per_second       = 0.0;
+	double mebibytes_per_second   = 0.0;
+	double seconds                = 0.0;
+	uint64_t latency_maximum      = 0;
+	uint64_t latency_minimum      = 0;
+	uint64_t latency_p50          = 0;
+	uint64_t latency_p99          = 0;
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_samples_get_percentile(
+	       samples,
+	       0,
+	       &latency_minimum,
+	       error ) == -1 )
+	 || ( bench_samples_get_percentile(
+	       samples,
+	       50,
+	       &latency_p50,
+	       error ) == -1 )
+	 || ( bench_samples_get_percentile(
+	       samples,
+	       99,
+	       &latency_p99,
+	       error ) == -1 )
+	 || ( bench_samples_get_percentile(
+	       samples,
+	       100,
+	       &latency_maximum,
+	       error ) == -1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve latency percentiles.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples->total > 0 )
+	{
+		seconds              = (double) samples->total / 1000000000.0;
+		files_per_second     = (double) samples->number_of_values / seconds;
+		mebibytes_per_second = ( (double) number_of_bytes / ( 1024.0 * 1024.0 ) ) / seconds;
+	}
+	if( samples->number_of_values > 0 )
+	{
+		allocations_per_file = (double) number_of_allocations / (double) samples->number_of_values;
+	}
+	if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+	{
+		fprintf(
+		 stream,
+		 "{\"type\": " );
+
+		if( source == NULL )
+		{
+			fprintf(
+			 stream,
+			 "\"total\"" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "\"source\", \"source\": " );
+
+			bench_output_json_string_fprint(
+			 stream,
+			 source );
+
+			fprintf(
+			 stream,
+			 ", \"format_version\": %" PRIu32 "",
+			 format_version );
+		}
+		fprintf(
+		 stream,
+		 ", \"number_of_files\": %d, \"number_of_bytes\": %" PRIu64 ", \"seconds\": %.6f"
+		 ", \"files_per_second\": %.1f, \"mebibytes_per_second\": %.3f, \"allocations_per_file\": %.1f"
+		 ", \"latency_minimum_ns\": %" PRIu64 ", \"latency_p50_ns\": %" PRIu64 ""
+		 ", \"latency_p99_ns\": %" PRIu64 ", \"latency_maximum_ns\": %" PRIu64 "}\n",
+		 samples->number_of_values,
+		 number_of_bytes,
+		 seconds,
+		 files_per_second,
+		 mebibytes_per_second,
+		 allocations_per_file,
+		 latency_minimum,
+		 latency_p50,
+		 latency_p99,
+		 latency_maximum );
+	}
+	else
+	{
+		if( source == NULL )
+		{
+			fprintf(
+			 stream,
+			 "Total:\n" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "Source: %" PRIs_SYSTEM "\n",
+			 source );
+
+			fprintf(
+			 stream,
+			 "\tFormat version\t\t\t: %" PRIu32 "\n",
+			 format_version );
+		}
+		fprintf(
+		 stream,
+		 "\tNumber of files\t\t\t: %d\n",
+		 samples->number_of_values );
+
+		fprintf(
+		 stream,
+		 "\tUncompressed data\t\t: %" PRIu64 " bytes\n",
+		 number_of_bytes );
+
+		fprintf(
+		 stream,
+		 "\tFiles per second\t\t: %.1f\n",
+		 files_per_second );
+
+		fprintf(
+		 stream,
+		 "\tMiB per second\t\t\t: %.3f\n",
+		 mebibytes_per_second );
+
+		fprintf(
+		 stream,
+		 "\tAllocations per file\t\t: %.1f\n",
+		 allocations_per_file );
+
+		fprintf(
+		 stream,
+		 "\tLatency p50\t\t\t: %" PRIu64 " ns\n",
+		 latency_p50 );
+
+		fprintf(
+		 stream,
+		 "\tLatency p99\t\t\t: %" PRIu64 " ns\n",
+		 latency_p99 );
+
+		fprintf(
+		 stream,
+		 "\tLatency minimum and maximum\t: %" PRIu64 " - %" PRIu64 " ns\n",
+		 latency_minimum,
+		 latency_maximum );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Benchmarks a source
+ * The source is read into memory and opened using a memory range file IO handle
+ * so that the results only contain the time spent in libscca
+ * Every iteration opens the file, retrieves all its values and closes the file
+ * The latencies are appended to the source and total samples
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_source(
+     const system_character_t *source,
+     int number_of_iterations,
+     int output_format,
+     bench_samples_t *total_samples,
+     uint64_t *total_number_of_bytes,
+     uint64_t *total_number_of_allocations,
+     libcerror_error_t **error )
+{
+	bench_samples_t *samples         = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libscca_file_t *file             = NULL;
+	uint8_t *data                    = NULL;
+	uint8_t *string_buffer           = NULL;
+	static char *function            = "scca_bench_source";
+	size_t data_size                 = 0;
+	uint64_t number_of_allocations   = 0;
+	uint64_t number_of_bytes         = 0;
+	uint64_t start_timestamp         = 0;
+	uint64_t statistic_value         = 0;
+	uint64_t stop_timestamp          = 0;
+	uint32_t format_version          = 0;
+	uint32_t uncompressed_data_size  = 0;
+	int iteration                    = 0;
+
+	if( total_samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_number_of_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total number of bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( total_number_of_allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid total number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_input_read_file(
+	     source,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read source.",
+		 function );
+
+		goto on_error;
+	}
+	/* The throughput is based on the uncompressed data size so that
+	 * compressed and uncompressed files can be compared
+	 */
+	uncompressed_data_size = (uint32_t) data_size;
+
+	if( ( data_size >= 8 )
+	 && ( memory_compare(
+	       data,
+	       "MAM\x04",
+	       4 ) == 0 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 uncompressed_data_size );
+	}
+	string_buffer = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * SCCA_BENCH_STRING_BUFFER_SIZE );
+
+	if( string_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_samples_initialize(
+	     &samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize samples.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first iteration warms up the caches and the buffers retained by the file
+	 * and is not part of the results
+	 */
+	for( iteration = 0;
+	     iteration <= number_of_iterations;
+	     iteration++ )
+	{
+		if( bench_timer_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_open_file_io_handle(
+		     file,
+		     file_io_handle,
+		     LIBSCCA_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+		if( scca_bench_traverse_file(
+		     file,
+		     string_buffer,
+		     SCCA_BENCH_STRING_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to traverse file.",
+			 function );
+
+			goto on_error;
+		}
+		/* The statistics are reset when the file is closed
+		 */
+		if( libscca_file_get_statistic(
+		     file,
+		     LIBSCCA_STATISTIC_TYPE_NUMBER_OF_ALLOCATIONS,
+		     &statistic_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of allocations.",
+			 function );
+
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			if( libscca_file_get_format_version(
+			     file,
+			     &format_version,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve format version.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &stop_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			continue;
+		}
+		if( ( bench_samples_append_value(
+		       samples,
+		       stop_timestamp - start_timestamp,
+		       error ) != 1 )
+		 || ( bench_samples_append_value(
+		       total_samples,
+		       stop_timestamp - start_timestamp,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append latency.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_allocations += statistic_value;
+		number_of_bytes       += uncompressed_data_size;
+	}
+	if( scca_bench_results_fprint(
+	     stdout,
+	     output_format,
+	     source,
+	     format_version,
+	     number_of_bytes,
+	     number_of_allocations,
+	     samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print results.",
+		 function );
+
+		goto on_error;
+	}
+	*total_number_of_allocations += number_of_allocations;
+	*total_number_of_bytes       += number_of_bytes;
+
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_samples_free(
+	     &samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free samples.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 string_buffer );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( samples != NULL )
+	{
+		bench_samples_free(
+		 &samples,
+		 NULL );
+	}
+	if( string_buffer != NULL )
+	{
+		memory_free(
+		 string_buffer );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	bench_samples_t *total_samples                  = NULL;
+	libcerror_error_t *error                        = NULL;
+	system_character_t *option_number_of_iterations = NULL;
+	system_character_t *option_output_format        = NULL;
+	uint64_t total_number_of_allocations            = 0;
+	uint64_t total_number_of_bytes                  = 0;
+	system_integer_t option                         = 0;
+	int argument_index                              = 0;
+	int number_of_failures                          = 0;
+	int number_of_iterations                        = SCCA_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int output_format                               = BENCH_OUTPUT_FORMAT_TEXT;
+	int result                                      = 0;
+
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:o:V" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_number_of_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fprintf(
+				 stdout,
+				 "scca_bench %s\n",
+				 LIBSCCA_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_number_of_iterations != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_number_of_iterations,
+		          SCCA_BENCH_MAXIMUM_NUMBER_OF_ITERATIONS,
+		          &number_of_iterations,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of iterations.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations defaulting to: %d.\n",
+			 SCCA_BENCH_DEFAULT_NUMBER_OF_ITERATIONS );
+		}
+	}
+	if( option_output_format != NULL )
+	{
+		result = bench_output_determine_format(
+		          option_output_format,
+		          &output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( bench_samples_initialize(
+	     &total_samples,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize total samples.\n" );
+
+		goto on_error;
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( scca_bench_source(
+		     argv[ argument_index ],
+		     number_of_iterations,
+		     output_format,
+		     total_samples,
+		     &total_number_of_bytes,
+		     &total_number_of_allocations,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			libcerror_error_backtrace_fprint(
+			 error,
+			 stderr );
+			libcerror_error_free(
+			 &error );
+
+			number_of_failures++;
+		}
+	}
+	if( scca_bench_results_fprint(
+	     stdout,
+	     output_format,
+	     NULL,
+	     0,
+	     total_number_of_bytes,
+	     total_number_of_allocations,
+	     total_samples,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to print total results.\n" );
+
+		goto on_error;
+	}
+	if( bench_samples_free(
+	     &total_samples,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free total samples.\n" );
+
+		goto on_error;
+	}
+	if( number_of_failures > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( total_samples != NULL )
+	{
+		bench_samples_free(
+		 &total_samples,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1802 @@
+/*
+ * Benchmarks the decompression of the compressed blocks of Windows 10 (MAM) Prefetch Files (PF)
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_counters.h"
+#include "bench_input.h"
+#include "bench_libbfio.h"
+#include "bench_libcerror.h"
+#include "bench_libscca.h"
+#include "bench_output.h"
+#include "bench_samples.h"
+#include "bench_timer.h"
+#include "../sccatools/sccatools_getopt.h"
+
+/* The compressed block functions are not exported and are only accessible
+ * when libscca is not used as a DLL
+ */
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+#define SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS	1
+#endif
+
+#if defined( SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS )
+
+#include "../libscca/libscca_compressed_block.h"
+#include "../libscca/libscca_definitions.h"
+#include "../libscca/libscca_io_handle.h"
+#include "../libscca/libscca_libfcache.h"
+#include "../libscca/libscca_libfdata.h"
+
+#endif /* defined( SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS ) */
+
+/* The default number of times every stage is run
+ */
+#define SCCA_BENCH_DECOMPRESS_DEFAULT_NUMBER_OF_ITERATIONS	100
+
+/* The maximum number of times every stage is run
+ */
+#define SCCA_BENCH_DECOMPRESS_MAXIMUM_NUMBER_OF_ITERATIONS	1000000
+
+/* The default maximum number of compressed blocks in the list
+ */
+#define SCCA_BENCH_DECOMPRESS_DEFAULT_NUMBER_OF_BLOCKS		64
+
+/* The maximum number of compressed blocks in the list
+ */
+#define SCCA_BENCH_DECOMPRESS_MAXIMUM_NUMBER_OF_BLOCKS		4096
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use scca_bench_decompress to measure the decompression of the\n"
+	                 "compressed blocks of Windows 10 (MAM) Prefetch Files (PF).\n\n" );
+
+	fprintf( stream, "Usage: scca_bench_decompress [ -b number_of_blocks ] [ -i iterations ]\n"
+	                 "                             [ -o format ] [ -chV ] sources\n\n" );
+
+	fprintf( stream, "\tsources: one or more MAM compressed source files\n\n" );
+
+	fprintf( stream, "\t-b:      the maximum number of compressed blocks in the list\n"
+	                 "\t         (default is 64), the list is benchmarked with 1, 2,\n"
+	                 "\t         4, etc. blocks up to the maximum, where every block\n"
+	                 "\t         refers to the compressed data of the source\n" );
+	fprintf( stream, "\t-c:      measure the cycles, instructions, branch misses and\n"
+	                 "\t         cache misses per uncompressed byte of the decode,\n"
+	                 "\t         read and element read stages, requires Linux\n"
+	                 "\t         perf_event support\n" );
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-i:      the number of times every stage is run (default is\n"
+	                 "\t         100), every stage is run once beforehand to warm up\n" );
+	fprintf( stream, "\t-o:      output format, options: text (default) or jsonl\n"
+	                 "\t         (JSON Lines)\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+#if defined( SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS )
+
+/* Times the decoding of the compressed data from memory
+ * This corresponds to the time spent in libfwnt
+ * The counters are optional, they are emptied and accumulate the timed iterations
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_decompress_time_decode(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t uncompressed_data_size,
+     int number_of_iterations,
+     bench_samples_t *samples,
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	libscca_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "scca_bench_decompress_time_decode";
+	uint64_t start_timestamp                     = 0;
+	uint64_t stop_timestamp                      = 0;
+	int iteration                                = 0;
+
+	if( libscca_compressed_block_initialize(
+	     &compressed_block,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( counters != NULL )
+	 && ( bench_counters_empty(
+	       counters,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to empty counters.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first iteration warms up the caches and is not part of the results
+	 */
+	for( iteration = 0;
+	     iteration <= number_of_iterations;
+	     iteration++ )
+	{
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_start(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start counters.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_compressed_block_read_data(
+		     compressed_block,
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed block data.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &stop_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_stop(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop counters.",
+			 function );
+
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			continue;
+		}
+		if( bench_samples_append_value(
+		     samples,
+		     stop_timestamp - start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append latency.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_compressed_block_free(
+	     &compressed_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_block != NULL )
+	{
+		libscca_compressed_block_free(
+		 &compressed_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Times the creation and freeing of a compressed block
+ * This corresponds to the allocations made for every block read
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_decompress_time_allocate(
+     size_t uncompressed_data_size,
+     int number_of_iterations,
+     bench_samples_t *samples,
+     libcerror_error_t **error )
+{
+	libscca_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "scca_bench_decompress_time_allocate";
+	uint64_t start_timestamp                     = 0;
+	uint64_t stop_timestamp                      = 0;
+	int iteration                                = 0;
+
+	for( iteration = 0;
+	     iteration <= number_of_iterations;
+	     iteration++ )
+	{
+		if( bench_timer_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_compressed_block_initialize(
+		     &compressed_block,
+		     uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_compressed_block_free(
+		     &compressed_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed block.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &stop_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			continue;
+		}
+		if( bench_samples_append_value(
+		     samples,
+		     stop_timestamp - start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append latency.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_block != NULL )
+	{
+		libscca_compressed_block_free(
+		 &compressed_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Times the reading of a compressed block using a file IO handle
+ * This corresponds to the time spent on IO and decoding
+ * The counters are optional, they are emptied and accumulate the timed iterations
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_decompress_time_read(
+     libscca_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t compressed_block_size,
+     size_t uncompressed_block_size,
+     int number_of_iterations,
+     bench_samples_t *samples,
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	libscca_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "scca_bench_decompress_time_read";
+	uint64_t start_timestamp                     = 0;
+	uint64_t stop_timestamp                      = 0;
+	ssize_t read_count                           = 0;
+	int iteration                                = 0;
+
+	if( libscca_compressed_block_initialize(
+	     &compressed_block,
+	     uncompressed_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( counters != NULL )
+	 && ( bench_counters_empty(
+	       counters,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to empty counters.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration <= number_of_iterations;
+	     iteration++ )
+	{
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_start(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start counters.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libscca_compressed_block_read(
+		              compressed_block,
+		              io_handle,
+		              file_io_handle,
+		              8,
+		              compressed_block_size,
+		              error );
+
+		if( read_count != (ssize_t) compressed_block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed block.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &stop_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_stop(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop counters.",
+			 function );
+
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			continue;
+		}
+		if( bench_samples_append_value(
+		     samples,
+		     stop_timestamp - start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append latency.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_compressed_block_free(
+	     &compressed_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free compressed block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_block != NULL )
+	{
+		libscca_compressed_block_free(
+		 &compressed_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Times the reading of the compressed blocks through a compressed blocks list and cache
+ * in the same way libscca_file_open_read does, where every block refers to the same
+ * compressed data
+ * This corresponds to the time spent on IO, allocation, decoding and block management
+ * The latency of every iteration is divided by the number of blocks
+ * The counters are optional, they are emptied and accumulate the timed iterations
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_decompress_time_element_read(
+     libscca_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t compressed_block_size,
+     size_t uncompressed_block_size,
+     int number_of_blocks,
+     int number_of_iterations,
+     bench_samples_t *samples,
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *compressed_blocks_cache   = NULL;
+	libfdata_list_t *compressed_blocks_list      = NULL;
+	libscca_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "scca_bench_decompress_time_element_read";
+	uint64_t start_timestamp                     = 0;
+	uint64_t stop_timestamp                      = 0;
+	int block_index                              = 0;
+	int element_index                            = 0;
+	int iteration                                = 0;
+
+	if( number_of_blocks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of blocks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counters != NULL )
+	 && ( bench_counters_empty(
+	       counters,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to empty counters.",
+		 function );
+
+		goto on_error;
+	}
+	for( iteration = 0;
+	     iteration <= number_of_iterations;
+	     iteration++ )
+	{
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_start(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start counters.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_list_initialize(
+		     &compressed_blocks_list,
+		     (intptr_t *) io_handle,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_compressed_block_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_initialize(
+		     &compressed_blocks_cache,
+		     LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks cache.",
+			 function );
+
+			goto on_error;
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( libfdata_list_append_element_with_mapped_size(
+			     compressed_blocks_list,
+			     &element_index,
+			     0,
+			     8,
+			     (size64_t) compressed_block_size,
+			     LIBFDATA_RANGE_FLAG_IS_COMPRESSED,
+			     (size64_t) uncompressed_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append compressed block: %d to list.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		for( block_index = 0;
+		     block_index < number_of_blocks;
+		     block_index++ )
+		{
+			if( libfdata_list_get_element_value_by_index(
+			     compressed_blocks_list,
+			     (intptr_t *) file_io_handle,
+			     (libfdata_cache_t *) compressed_blocks_cache,
+			     block_index,
+			     (intptr_t **) &compressed_block,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve compressed block: %d from list.",
+				 function,
+				 block_index );
+
+				goto on_error;
+			}
+		}
+		if( libfdata_list_free(
+		     &compressed_blocks_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_free(
+		     &compressed_blocks_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_timer_get_timestamp(
+		     &stop_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop timestamp.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_stop(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop counters.",
+			 function );
+
+			goto on_error;
+		}
+		if( iteration == 0 )
+		{
+			continue;
+		}
+		if( bench_samples_append_value(
+		     samples,
+		     ( stop_timestamp - start_timestamp ) / (uint64_t) number_of_blocks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append latency.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( compressed_blocks_list != NULL )
+	{
+		libfdata_list_free(
+		 &compressed_blocks_list,
+		 NULL );
+	}
+	if( compressed_blocks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &compressed_blocks_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the results of a stage
+ * The latencies are per block and the counters, if any, per uncompressed byte
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_decompress_stage_fprint(
+     FILE *stream,
+     int output_format,
+     const system_character_t *source,
+     const char *backend,
+     const char *stage,
+     int number_of_blocks,
+     size_t uncompressed_block_size,
+     bench_samples_t *samples,
+     bench_counters_t *counters,
+     uint64_t *latency_p50,
+     libcerror_error_t **error )
+{
+	static char *function       = "scca_bench_decompress_stage_fprint";
+	double mebibytes_per_second = 0.0;
+	uint64_t latency_p99        = 0;
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( latency_p50 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency p50.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_samples_get_percentile(
+	       samples,
+	       50,
+	       latency_p50,
+	       error ) == -1 )
+	 || ( bench_samples_get_percentile(
+	       samples,
+	       99,
+	       &latency_p99,
+	       error ) == -1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve latency percentiles.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples->total > 0 )
+	{
+		mebibytes_per_second = ( (double) uncompressed_block_size * (double) samples->number_of_values / ( 1024.0 * 1024.0 ) )
+		                     / ( (double) samples->total / 1000000000.0 );
+	}
+	if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+	{
+		fprintf(
+		 stream,
+		 "{\"type\": \"stage\", \"source\": " );
+
+		bench_output_json_string_fprint(
+		 stream,
+		 source );
+
+		fprintf(
+		 stream,
+		 ", \"backend\": \"%s\", \"stage\": \"%s\", \"number_of_blocks\": %d, \"uncompressed_block_size\": %" PRIzd ""
+		 ", \"number_of_samples\": %d, \"latency_p50_ns\": %" PRIu64 ", \"latency_p99_ns\": %" PRIu64 ""
+		 ", \"mebibytes_per_second\": %.3f",
+		 backend,
+		 stage,
+		 number_of_blocks,
+		 uncompressed_block_size,
+		 samples->number_of_values,
+		 *latency_p50,
+		 latency_p99,
+		 mebibytes_per_second );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Stage: %s (%s, %d blocks)\n",
+		 stage,
+		 backend,
+		 number_of_blocks );
+
+		fprintf(
+		 stream,
+		 "\tLatency p50 per block\t\t: %" PRIu64 " ns\n",
+		 *latency_p50 );
+
+		fprintf(
+		 stream,
+		 "\tLatency p99 per block\t\t: %" PRIu64 " ns\n",
+		 latency_p99 );
+
+		fprintf(
+		 stream,
+		 "\tMiB per second\t\t\t: %.3f\n",
+		 mebibytes_per_second );
+	}
+	if( counters != NULL )
+	{
+		if( bench_counters_fprint(
+		     counters,
+		     stream,
+		     output_format,
+		     (uint64_t) uncompressed_block_size * (uint64_t) number_of_blocks * (uint64_t) samples->number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print counters.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+	{
+		fprintf(
+		 stream,
+		 "}\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Prints where the time of reading a compressed block through the compressed blocks list is spent
+ * The breakdown is based on the p50 latencies per block of the stages
+ */
+void scca_bench_decompress_breakdown_fprint(
+      FILE *stream,
+      int output_format,
+      const system_character_t *source,
+      const char *backend,
+      int number_of_blocks,
+      uint64_t decode_latency,
+      uint64_t allocate_latency,
+      uint64_t read_latency,
+      uint64_t element_read_latency )
+{
+	double decode_percentage          = 0.0;
+	double management_percentage      = 0.0;
+	uint64_t io_latency               = 0;
+	uint64_t management_latency       = 0;
+
+	if( read_latency > decode_latency )
+	{
+		io_latency = read_latency - decode_latency;
+	}
+	if( element_read_latency > ( read_latency + allocate_latency ) )
+	{
+		management_latency = element_read_latency - read_latency - allocate_latency;
+	}
+	if( element_read_latency > 0 )
+	{
+		decode_percentage     = ( (double) decode_latency * 100.0 ) / (double) element_read_latency;
+		management_percentage = ( (double) ( allocate_latency + management_latency ) * 100.0 ) / (double) element_read_latency;
+	}
+	if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+	{
+		fprintf(
+		 stream,
+		 "{\"type\": \"breakdown\", \"source\": " );
+
+		bench_output_json_string_fprint(
+		 stream,
+		 source );
+
+		fprintf(
+		 stream,
+		 ", \"backend\": \"%s\", \"number_of_blocks\": %d, \"decode_ns\": %" PRIu64 ", \"io_ns\": %" PRIu64 ""
+		 ", \"allocation_ns\": %" PRIu64 ", \"block_management_ns\": %" PRIu64 ", \"decode_percentage\": %.1f"
+		 ", \"management_percentage\": %.1f}\n",
+		 backend,
+		 number_of_blocks,
+		 decode_latency,
+		 io_latency,
+		 allocate_latency,
+		 management_latency,
+		 decode_percentage,
+		 management_percentage );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Breakdown per block (%s, %d blocks)\n",
+		 backend,
+		 number_of_blocks );
+
+		fprintf(
+		 stream,
+		 "\tDecoding (libfwnt)\t\t: %" PRIu64 " ns (%.1f%%)\n",
+		 decode_latency,
+		 decode_percentage );
+
+		fprintf(
+		 stream,
+		 "\tIO\t\t\t\t: %" PRIu64 " ns\n",
+		 io_latency );
+
+		fprintf(
+		 stream,
+		 "\tAllocation\t\t\t: %" PRIu64 " ns\n",
+		 allocate_latency );
+
+		fprintf(
+		 stream,
+		 "\tBlock management\t\t: %" PRIu64 " ns\n",
+		 management_latency );
+
+		fprintf(
+		 stream,
+		 "\tAllocation and management\t: %.1f%%\n",
+		 management_percentage );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+}
+
+/* Benchmarks a source
+ * Returns 1 if successful, 0 if the source is not compressed or -1 on error
+ */
+int scca_bench_decompress_source(
+     const system_character_t *source,
+     int number_of_iterations,
+     int maximum_number_of_blocks,
+     int output_format,
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handles[ 2 ]      = { NULL, NULL };
+	const char *backends[ 2 ]                  = { "memory", "file" };
+
+	bench_samples_t *samples                    = NULL;
+	libscca_io_handle_t *io_handle              = NULL;
+	uint8_t *data                               = NULL;
+	static char *function                       = "scca_bench_decompress_source";
+	size_t compressed_block_size                = 0;
+	size_t data_size                            = 0;
+	size_t uncompressed_block_size              = 0;
+	uint64_t allocate_latency                   = 0;
+	uint64_t decode_latency                     = 0;
+	uint64_t element_read_latency               = 0;
+	uint64_t read_latency                       = 0;
+	int backend_index                           = 0;
+	int number_of_blocks                        = 0;
+	int result                                  = 0;
+
+	if( bench_input_read_file(
+	     source,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &( file_io_handles[ 0 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize memory range file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handles[ 0 ],
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handles[ 0 ],
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory range file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_input_open_file(
+	     source,
+	     &( file_io_handles[ 1 ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_io_handle_read_compressed_file_header(
+	     io_handle,
+	     file_io_handles[ 0 ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle->file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	{
+		/* libscca_io_handle_read_compressed_blocks maps the compressed data onto a single block
+		 */
+		compressed_block_size   = (size_t) io_handle->file_size - 8;
+		uncompressed_block_size = (size_t) io_handle->uncompressed_data_size;
+
+		result = 1;
+	}
+	if( result != 0 )
+	{
+		if( bench_samples_initialize(
+		     &samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize samples.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_format == BENCH_OUTPUT_FORMAT_TEXT )
+		{
+			fprintf(
+			 stdout,
+			 "Source: %" PRIs_SYSTEM "\n",
+			 source );
+
+			fprintf(
+			 stdout,
+			 "\tCompressed block size\t\t: %" PRIzd " bytes\n",
+			 compressed_block_size );
+
+			fprintf(
+			 stdout,
+			 "\tUncompressed block size\t\t: %" PRIzd " bytes\n",
+			 uncompressed_block_size );
+
+			fprintf(
+			 stdout,
+			 "\n" );
+		}
+		if( scca_bench_decompress_time_decode(
+		     &( data[ 8 ] ),
+		     compressed_block_size,
+		     uncompressed_block_size,
+		     number_of_iterations,
+		     samples,
+		     counters,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to time decode stage.",
+			 function );
+
+			goto on_error;
+		}
+		if( scca_bench_decompress_stage_fprint(
+		     stdout,
+		     output_format,
+		     source,
+		     "none",
+		     "decode",
+		     1,
+		     uncompressed_block_size,
+		     samples,
+		     counters,
+		     &decode_latency,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print decode stage results.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( bench_samples_empty(
+		       samples,
+		       error ) != 1 )
+		 || ( scca_bench_decompress_time_allocate(
+		       uncompressed_block_size,
+		       number_of_iterations,
+		       samples,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to time allocate stage.",
+			 function );
+
+			goto on_error;
+		}
+		if( scca_bench_decompress_stage_fprint(
+		     stdout,
+		     output_format,
+		     source,
+		     "none",
+		     "allocate",
+		     1,
+		     uncompressed_block_size,
+		     samples,
+		     NULL,
+		     &allocate_latency,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print allocate stage results.",
+			 function );
+
+			goto on_error;
+		}
+		for( backend_index = 0;
+		     backend_index < 2;
+		     backend_index++ )
+		{
+			if( ( bench_samples_empty(
+			       samples,
+			       error ) != 1 )
+			 || ( scca_bench_decompress_time_read(
+			       io_handle,
+			       file_io_handles[ backend_index ],
+			       compressed_block_size,
+			       uncompressed_block_size,
+			       number_of_iterations,
+			       samples,
+			       counters,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to time %s read stage.",
+				 function,
+				 backends[ backend_index ] );
+
+				goto on_error;
+			}
+			if( scca_bench_decompress_stage_fprint(
+			     stdout,
+			     output_format,
+			     source,
+			     backends[ backend_index ],
+			     "read",
+			     1,
+			     uncompressed_block_size,
+			     samples,
+			     counters,
+			     &read_latency,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print %s read stage results.",
+				 function,
+				 backends[ backend_index ] );
+
+				goto on_error;
+			}
+			for( number_of_blocks = 1;
+			     number_of_blocks <= maximum_number_of_blocks;
+			     number_of_blocks *= 2 )
+			{
+				if( ( bench_samples_empty(
+				       samples,
+				       error ) != 1 )
+				 || ( scca_bench_decompress_time_element_read(
+				       io_handle,
+				       file_io_handles[ backend_index ],
+				       compressed_block_size,
+				       uncompressed_block_size,
+				       number_of_blocks,
+				       number_of_iterations,
+				       samples,
+				       counters,
+				       error ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to time %s element read stage with %d blocks.",
+					 function,
+					 backends[ backend_index ],
+					 number_of_blocks );
+
+					goto on_error;
+				}
+				if( scca_bench_decompress_stage_fprint(
+				     stdout,
+				     output_format,
+				     source,
+				     backends[ backend_index ],
+				     "element_read",
+				     number_of_blocks,
+				     uncompressed_block_size,
+				     samples,
+				     counters,
+				     &element_read_latency,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print %s element read stage results.",
+					 function,
+					 backends[ backend_index ] );
+
+					goto on_error;
+				}
+				scca_bench_decompress_breakdown_fprint(
+				 stdout,
+				 output_format,
+				 source,
+				 backends[ backend_index ],
+				 number_of_blocks,
+				 decode_latency,
+				 allocate_latency,
+				 read_latency,
+				 element_read_latency );
+
+				if( number_of_blocks > ( maximum_number_of_blocks / 2 ) )
+				{
+					break;
+				}
+			}
+		}
+		if( bench_samples_free(
+		     &samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free samples.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( backend_index = 0;
+	     backend_index < 2;
+	     backend_index++ )
+	{
+		if( libbfio_handle_close(
+		     file_io_handles[ backend_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close %s file IO handle.",
+			 function,
+			 backends[ backend_index ] );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &( file_io_handles[ backend_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free %s file IO handle.",
+			 function,
+			 backends[ backend_index ] );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 data );
+
+	return( result );
+
+on_error:
+	if( samples != NULL )
+	{
+		bench_samples_free(
+		 &samples,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	for( backend_index = 0;
+	     backend_index < 2;
+	     backend_index++ )
+	{
+		if( file_io_handles[ backend_index ] != NULL )
+		{
+			libbfio_handle_free(
+			 &( file_io_handles[ backend_index ] ),
+			 NULL );
+		}
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	bench_counters_t *counters                      = NULL;
+	libcerror_error_t *error                        = NULL;
+	system_character_t *option_number_of_blocks     = NULL;
+	system_character_t *option_number_of_iterations = NULL;
+	system_character_t *option_output_format        = NULL;
+	system_integer_t option                         = 0;
+	int argument_index                              = 0;
+	int maximum_number_of_blocks                    = SCCA_BENCH_DECOMPRESS_DEFAULT_NUMBER_OF_BLOCKS;
+	int number_of_failures                          = 0;
+	int number_of_iterations                        = SCCA_BENCH_DECOMPRESS_DEFAULT_NUMBER_OF_ITERATIONS;
+	int output_format                               = BENCH_OUTPUT_FORMAT_TEXT;
+	int result                                      = 0;
+	uint8_t use_counters                            = 0;
+
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:chi:o:V" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'b':
+				option_number_of_blocks = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				use_counters = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_number_of_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fprintf(
+				 stdout,
+				 "scca_bench_decompress %s\n",
+				 LIBSCCA_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+#if !defined( SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS )
+	fprintf(
+	 stderr,
+	 "Benchmarking the compressed blocks requires access to the libscca internals.\n" );
+
+	return( EXIT_FAILURE );
+#else
+	if( option_number_of_blocks != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_number_of_blocks,
+		          SCCA_BENCH_DECOMPRESS_MAXIMUM_NUMBER_OF_BLOCKS,
+		          &maximum_number_of_blocks,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of blocks.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of blocks defaulting to: %d.\n",
+			 SCCA_BENCH_DECOMPRESS_DEFAULT_NUMBER_OF_BLOCKS );
+		}
+	}
+	if( option_number_of_iterations != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_number_of_iterations,
+		          SCCA_BENCH_DECOMPRESS_MAXIMUM_NUMBER_OF_ITERATIONS,
+		          &number_of_iterations,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of iterations.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations defaulting to: %d.\n",
+			 SCCA_BENCH_DECOMPRESS_DEFAULT_NUMBER_OF_ITERATIONS );
+		}
+	}
+	if( option_output_format != NULL )
+	{
+		result = bench_output_determine_format(
+		          option_output_format,
+		          &output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( use_counters != 0 )
+	{
+		if( bench_counters_initialize(
+		     &counters,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize counters.\n" );
+
+			goto on_error;
+		}
+		result = bench_counters_has_counters(
+		          counters,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine if counters are available.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Hardware counters are not available, continuing without.\n" );
+
+			if( bench_counters_free(
+			     &counters,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free counters.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		result = scca_bench_decompress_source(
+		          argv[ argument_index ],
+		          number_of_iterations,
+		          maximum_number_of_blocks,
+		          output_format,
+		          counters,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			libcerror_error_backtrace_fprint(
+			 error,
+			 stderr );
+			libcerror_error_free(
+			 &error );
+
+			number_of_failures++;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Skipping: %" PRIs_SYSTEM " the source is not compressed.\n",
+			 argv[ argument_index ] );
+		}
+	}
+	if( counters != NULL )
+	{
+		if( bench_counters_free(
+		     &counters,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free counters.\n" );
+
+			goto on_error;
+		}
+	}
+	if( number_of_failures > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( counters != NULL )
+	{
+		bench_counters_free(
+		 &counters,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+#endif /* !defined( SCCA_BENCH_DECOMPRESS_HAVE_INTERNALS ) */
+}
+
@@ -0,0 +1,1854 @@
+/*
+ * Benchmarks the parsing of the sections of Windows Prefetch Files (PF)
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_counters.h"
+#include "bench_input.h"
+#include "bench_libcerror.h"
+#include "bench_libscca.h"
+#include "bench_output.h"
+#include "bench_samples.h"
+#include "bench_timer.h"
+#include "generator.h"
+#include "../sccatools/sccatools_getopt.h"
+
+/* The section functions are not exported and are only accessible
+ * when libscca is not used as a DLL
+ */
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+#define SCCA_BENCH_SECTIONS_HAVE_INTERNALS	1
+#endif
+
+#if defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS )
+
+#include "../libscca/libscca_file_information.h"
+#include "../libscca/libscca_file_metrics_values.h"
+#include "../libscca/libscca_filename_strings.h"
+#include "../libscca/libscca_io_handle.h"
+#include "../libscca/libscca_volumes.h"
+
+#include "../libscca/scca_file_metrics_array.h"
+
+#endif /* defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS ) */
+
+/* The default number of times every section is parsed
+ */
+#define SCCA_BENCH_SECTIONS_DEFAULT_NUMBER_OF_ITERATIONS	100
+
+/* The maximum number of times every section is parsed
+ */
+#define SCCA_BENCH_SECTIONS_MAXIMUM_NUMBER_OF_ITERATIONS	1000000
+
+/* The number of entries the scaling of the generated sections starts with
+ */
+#define SCCA_BENCH_SECTIONS_MINIMUM_NUMBER_OF_ENTRIES		64
+
+/* The default maximum number of entries of the generated sections
+ */
+#define SCCA_BENCH_SECTIONS_DEFAULT_NUMBER_OF_ENTRIES		8192
+
+/* The default maximum parse time of a source in milliseconds
+ */
+#define SCCA_BENCH_SECTIONS_DEFAULT_TIMEOUT			100
+
+/* The maximum of the maximum parse time of a source in milliseconds
+ */
+#define SCCA_BENCH_SECTIONS_MAXIMUM_TIMEOUT			3600000
+
+/* The parse time ratio between a section and a section with half the number
+ * of entries above which the parse time is considered superlinear, where
+ * a linear parse time has a ratio of 2.0 and a quadratic one of 4.0
+ */
+#define SCCA_BENCH_SECTIONS_SUPERLINEAR_RATIO			3.0
+
+/* The number of format versions the first byte of a source selects from,
+ * which corresponds with the OSS-Fuzz section targets
+ */
+#define SCCA_BENCH_SECTIONS_NUMBER_OF_FORMAT_VERSIONS		4
+
+enum SCCA_BENCH_SECTIONS
+{
+	SCCA_BENCH_SECTION_FILE_INFORMATION			= 0,
+	SCCA_BENCH_SECTION_FILE_METRICS				= 1,
+	SCCA_BENCH_SECTION_FILENAME_STRINGS			= 2,
+	SCCA_BENCH_SECTION_VOLUMES_INFORMATION			= 3
+};
+
+#define SCCA_BENCH_SECTIONS_NUMBER_OF_SECTIONS			4
+
+const char *scca_bench_sections_section_names[ SCCA_BENCH_SECTIONS_NUMBER_OF_SECTIONS ] = {
+	"file_information", "file_metrics", "filename_strings", "volumes_information" };
+
+const uint32_t scca_bench_sections_format_versions[ SCCA_BENCH_SECTIONS_NUMBER_OF_FORMAT_VERSIONS ] = {
+	17, 23, 26, 30 };
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use scca_bench_sections to measure the parsing of the sections\n"
+	                 "of Windows Prefetch Files (PF) from memory.\n\n" );
+
+	fprintf( stream, "Usage: scca_bench_sections [ -F format_version ] [ -i iterations ]\n"
+	                 "                           [ -m number_of_entries ] [ -o format ]\n"
+	                 "                           [ -t timeout ] [ -chV ] [ sources ]\n\n" );
+
+	fprintf( stream, "\tsources: zero or more inputs of the OSS-Fuzz section targets,\n"
+	                 "\t         every source is parsed as every section, without\n"
+	                 "\t         sources the parsing of generated sections with an\n"
+	                 "\t         increasing number of entries is measured\n\n" );
+
+	fprintf( stream, "\t-c:      measure the cycles, instructions, branch misses and\n"
+	                 "\t         cache misses per byte of section data, requires\n"
+	                 "\t         Linux perf_event support\n" );
+	fprintf( stream, "\t-F:      the format version of the generated sections, options:\n"
+	                 "\t         17, 23, 26, 30 (default)\n" );
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-i:      the number of times every section is parsed (default\n"
+	                 "\t         is 100), every section is parsed once beforehand to\n"
+	                 "\t         warm up\n" );
+	fprintf( stream, "\t-m:      the maximum number of entries of the generated sections\n"
+	                 "\t         (default is 8192), the sections are generated with 64,\n"
+	                 "\t         128, etc. entries up to the maximum and flagged when\n"
+	                 "\t         doubling the number of entries more than triples the\n"
+	                 "\t         parse time\n" );
+	fprintf( stream, "\t-o:      output format, options: text (default) or jsonl\n"
+	                 "\t         (JSON Lines)\n" );
+	fprintf( stream, "\t-t:      the maximum parse time of a source in milliseconds\n"
+	                 "\t         (default is 100), sources with a larger median parse\n"
+	                 "\t         time are flagged\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+#if defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS )
+
+/* Parses a section once
+ * The filename strings are only used by the file metrics section
+ * Returns 1 if successful, 0 if the section could not be parsed or -1 on error
+ */
+int scca_bench_sections_parse(
+     libscca_io_handle_t *io_handle,
+     int section,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error                       = NULL;
+	libscca_file_information_t *file_information        = NULL;
+	libscca_file_metrics_values_t *file_metrics_values  = NULL;
+	libscca_filename_strings_t *section_filename_strings = NULL;
+	libscca_volumes_t *volumes                          = NULL;
+	static char *function                               = "scca_bench_sections_parse";
+	int result                                          = 0;
+
+	switch( section )
+	{
+		case SCCA_BENCH_SECTION_FILE_INFORMATION:
+			if( libscca_file_information_initialize(
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file information.",
+				 function );
+
+				goto on_error;
+			}
+			result = libscca_file_information_read_data(
+			          file_information,
+			          io_handle,
+			          data,
+			          data_size,
+			          &read_error );
+
+			if( libscca_file_information_free(
+			     &file_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file information.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case SCCA_BENCH_SECTION_FILE_METRICS:
+			if( libscca_file_metrics_values_initialize(
+			     &file_metrics_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create file metrics values.",
+				 function );
+
+				goto on_error;
+			}
+			result = libscca_io_handle_read_file_metrics_array_data(
+			          io_handle,
+			          data,
+			          data_size,
+			          number_of_entries,
+			          file_metrics_values,
+			          &read_error );
+
+			/* The filename of a file metrics entry is resolved on demand
+			 * and therefore resolved here to be part of the parse time
+			 */
+			if( result == 1 )
+			{
+				if( libscca_file_metrics_values_resolve_filename_indexes(
+				     file_metrics_values,
+				     filename_strings,
+				     &read_error ) != 1 )
+				{
+					result = 0;
+				}
+			}
+			if( libscca_file_metrics_values_free(
+			     &file_metrics_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file metrics values.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case SCCA_BENCH_SECTION_FILENAME_STRINGS:
+			if( libscca_filename_strings_initialize(
+			     &section_filename_strings,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create filename strings.",
+				 function );
+
+				goto on_error;
+			}
+			result = libscca_filename_strings_read_data(
+			          section_filename_strings,
+			          data,
+			          data_size,
+			          &read_error );
+
+			if( libscca_filename_strings_free(
+			     &section_filename_strings,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filename strings.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case SCCA_BENCH_SECTION_VOLUMES_INFORMATION:
+			if( libscca_volumes_initialize(
+			     &volumes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create volumes.",
+				 function );
+
+				goto on_error;
+			}
+			result = libscca_io_handle_read_volumes_information_data(
+			          io_handle,
+			          data,
+			          data_size,
+			          number_of_entries,
+			          volumes,
+			          &read_error );
+
+			if( libscca_volumes_free(
+			     &volumes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volumes.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported section.",
+			 function );
+
+			return( -1 );
+	}
+	/* Failing to parse the section is a valid outcome of an input
+	 */
+	if( read_error != NULL )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( read_error != NULL )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( section_filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &section_filename_strings,
+		 NULL );
+	}
+	if( volumes != NULL )
+	{
+		libscca_volumes_free(
+		 &volumes,
+		 NULL );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	if( file_information != NULL )
+	{
+		libscca_file_information_free(
+		 &file_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Times the parsing of a section
+ * The counters are optional, they are emptied and accumulate the timed iterations
+ * Returns 1 if successful, 0 if the section could not be parsed or -1 on error
+ */
+int scca_bench_sections_time_parse(
+     libscca_io_handle_t *io_handle,
+     int section,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libscca_filename_strings_t *filename_strings,
+     int number_of_iterations,
+     bench_samples_t *samples,
+     bench_counters_t *counters,
+     libcerror_error_t **error )
+{
+	static char *function    = "scca_bench_sections_time_parse";
+	uint64_t start_timestamp = 0;
+	uint64_t stop_timestamp  = 0;
+	int iteration            = 0;
+	int result               = 0;
+
+	if( ( counters != NULL )
+	 && ( bench_counters_empty(
+	       counters,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to empty counters.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first iteration warms up the caches and is not part of the results
+	 */
+	for( iteration = 0;
+	     iteration <= number_of_iterations;
+	     iteration++ )
+	{
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_start(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start counters.",
+			 function );
+
+			return( -1 );
+		}
+		if( bench_timer_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start timestamp.",
+			 function );
+
+			return( -1 );
+		}
+		result = scca_bench_sections_parse(
+		          io_handle,
+		          section,
+		          data,
+		          data_size,
+		          number_of_entries,
+		          filename_strings,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse section.",
+			 function );
+
+			return( -1 );
+		}
+		if( bench_timer_get_timestamp(
+		     &stop_timestamp ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stop timestamp.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( counters != NULL )
+		 && ( iteration > 0 )
+		 && ( bench_counters_stop(
+		       counters,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop counters.",
+			 function );
+
+			return( -1 );
+		}
+		if( iteration == 0 )
+		{
+			continue;
+		}
+		if( bench_samples_append_value(
+		     samples,
+		     stop_timestamp - start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append latency.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Prints the results of parsing a section
+ * The ratio is the parse time relative to that of the section with half the number of entries,
+ * where a ratio of 0.0 indicates there is no such section
+ * The counters, if any, are printed per byte of section data
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_sections_result_fprint(
+     FILE *stream,
+     int output_format,
+     const system_character_t *source,
+     int section,
+     uint32_t format_version,
+     uint32_t number_of_entries,
+     size_t data_size,
+     int is_parsed,
+     bench_samples_t *samples,
+     bench_counters_t *counters,
+     double ratio,
+     uint8_t is_flagged,
+     uint64_t *latency_p50,
+     libcerror_error_t **error )
+{
+	static char *function       = "scca_bench_sections_result_fprint";
+	double mebibytes_per_second = 0.0;
+	uint64_t latency_p99        = 0;
+
+	if( samples == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid samples.",
+		 function );
+
+		return( -1 );
+	}
+	if( latency_p50 == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latency p50.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bench_samples_get_percentile(
+	       samples,
+	       50,
+	       latency_p50,
+	       error ) == -1 )
+	 || ( bench_samples_get_percentile(
+	       samples,
+	       99,
+	       &latency_p99,
+	       error ) == -1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve latency percentiles.",
+		 function );
+
+		return( -1 );
+	}
+	if( samples->total > 0 )
+	{
+		mebibytes_per_second = ( (double) data_size * (double) samples->number_of_values / ( 1024.0 * 1024.0 ) )
+		                     / ( (double) samples->total / 1000000000.0 );
+	}
+	if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+	{
+		fprintf(
+		 stream,
+		 "{\"type\": \"section\", \"source\": " );
+
+		if( source != NULL )
+		{
+			bench_output_json_string_fprint(
+			 stream,
+			 source );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "null" );
+		}
+		fprintf(
+		 stream,
+		 ", \"section\": \"%s\", \"format_version\": %" PRIu32 ", \"number_of_entries\": %" PRIu32 ""
+		 ", \"data_size\": %" PRIzd ", \"parsed\": %s, \"number_of_samples\": %d, \"latency_p50_ns\": %" PRIu64 ""
+		 ", \"latency_p99_ns\": %" PRIu64 ", \"mebibytes_per_second\": %.3f, \"ratio\": %.3f, \"flagged\": %s}\n",
+		 scca_bench_sections_section_names[ section ],
+		 format_version,
+		 number_of_entries,
+		 data_size,
+		 ( is_parsed != 0 ) ? "true" : "false",
+		 samples->number_of_values,
+		 *latency_p50,
+		 latency_p99,
+		 mebibytes_per_second,
+		 ratio,
+		 ( is_flagged != 0 ) ? "true" : "false" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "Section: %s (version: %" PRIu32 ", %" PRIu32 " entries, %" PRIzd " bytes)%s%s\n",
+		 scca_bench_sections_section_names[ section ],
+		 format_version,
+		 number_of_entries,
+		 data_size,
+		 ( is_parsed != 0 ) ? "" : " not parsed",
+		 ( is_flagged != 0 ) ? " FLAGGED" : "" );
+
+		fprintf(
+		 stream,
+		 "\tLatency p50\t\t\t: %" PRIu64 " ns\n",
+		 *latency_p50 );
+
+		fprintf(
+		 stream,
+		 "\tLatency p99\t\t\t: %" PRIu64 " ns\n",
+		 latency_p99 );
+
+		fprintf(
+		 stream,
+		 "\tMiB per second\t\t\t: %.3f\n",
+		 mebibytes_per_second );
+
+		if( ratio > 0.0 )
+		{
+			fprintf(
+			 stream,
+			 "\tRatio to half the entries\t: %.3f\n",
+			 ratio );
+		}
+	}
+	if( counters != NULL )
+	{
+		if( bench_counters_fprint(
+		     counters,
+		     stream,
+		     output_format,
+		     (uint64_t) data_size * (uint64_t) samples->number_of_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print counters.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( output_format == BENCH_OUTPUT_FORMAT_JSONL )
+	{
+		fprintf(
+		 stream,
+		 "}\n" );
+	}
+	else
+	{
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
+/* Measures the parsing of generated sections with a doubling number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_sections_scale(
+     int section,
+     uint32_t format_version,
+     uint32_t maximum_number_of_entries,
+     int number_of_iterations,
+     int output_format,
+     bench_counters_t *counters,
+     int *number_of_flagged,
+     libcerror_error_t **error )
+{
+	bench_samples_t *samples                     = NULL;
+	generator_t *generator                       = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	libscca_io_handle_t *io_handle               = NULL;
+	uint8_t *data                                = NULL;
+	uint8_t *section_data                        = NULL;
+	static char *function                        = "scca_bench_sections_scale";
+	double ratio                                 = 0.0;
+	size_t data_size                             = 0;
+	size_t section_data_size                     = 0;
+	uint64_t latency_p50                         = 0;
+	uint64_t previous_latency_p50                = 0;
+	uint32_t number_of_entries                   = 0;
+	uint32_t number_of_filenames                 = 0;
+	uint32_t number_of_volumes                   = 0;
+	uint8_t is_flagged                           = 0;
+	int result                                   = 0;
+
+	if( number_of_flagged == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of flagged.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator_initialize(
+	     &generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create generator.",
+		 function );
+
+		goto on_error;
+	}
+	if( generator_set_format_version(
+	     generator,
+	     format_version,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->format_version = format_version;
+
+	if( bench_samples_initialize(
+	     &samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create samples.",
+		 function );
+
+		goto on_error;
+	}
+	for( number_of_entries = SCCA_BENCH_SECTIONS_MINIMUM_NUMBER_OF_ENTRIES;
+	     number_of_entries <= maximum_number_of_entries;
+	     number_of_entries *= 2 )
+	{
+		/* The file metrics entries refer to the filenames hence the number of filenames
+		 * is scaled along with the file metrics but is bounded by the generator
+		 */
+		number_of_filenames = SCCA_BENCH_SECTIONS_MINIMUM_NUMBER_OF_ENTRIES;
+		number_of_volumes   = 1;
+
+		if( section == SCCA_BENCH_SECTION_FILENAME_STRINGS )
+		{
+			if( number_of_entries > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_FILENAMES )
+			{
+				break;
+			}
+			number_of_filenames = number_of_entries;
+		}
+		else if( section == SCCA_BENCH_SECTION_FILE_METRICS )
+		{
+			number_of_filenames = number_of_entries;
+
+			if( number_of_filenames > (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_FILENAMES )
+			{
+				number_of_filenames = (uint32_t) GENERATOR_MAXIMUM_NUMBER_OF_FILENAMES;
+			}
+		}
+		else if( section == SCCA_BENCH_SECTION_VOLUMES_INFORMATION )
+		{
+			number_of_volumes = number_of_entries;
+		}
+		if( generator_set_number_of_entries(
+		     generator,
+		     ( section == SCCA_BENCH_SECTION_FILE_METRICS ) ? number_of_entries : SCCA_BENCH_SECTIONS_MINIMUM_NUMBER_OF_ENTRIES,
+		     number_of_filenames,
+		     0,
+		     number_of_volumes,
+		     1,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set number of entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( generator_get_data_size(
+		     generator,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size.",
+			 function );
+
+			goto on_error;
+		}
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		if( generator_write_data(
+		     generator,
+		     0,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_filename_strings_initialize(
+		     &filename_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filename strings.",
+			 function );
+
+			goto on_error;
+		}
+		if( section == SCCA_BENCH_SECTION_FILE_METRICS )
+		{
+			/* The filename strings are read beforehand since they are measured separately
+			 */
+			if( libscca_filename_strings_read_data(
+			     filename_strings,
+			     &( data[ generator->filename_strings_offset ] ),
+			     (size_t) generator->filename_strings_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read filename strings.",
+				 function );
+
+				goto on_error;
+			}
+			section_data = &( data[ generator->metrics_array_offset ] );
+
+			if( format_version == 17 )
+			{
+				section_data_size = sizeof( scca_file_metrics_array_entry_v17_t );
+			}
+			else
+			{
+				section_data_size = sizeof( scca_file_metrics_array_entry_v23_t );
+			}
+			section_data_size *= number_of_entries;
+		}
+		else if( section == SCCA_BENCH_SECTION_FILENAME_STRINGS )
+		{
+			section_data      = &( data[ generator->filename_strings_offset ] );
+			section_data_size = (size_t) generator->filename_strings_size;
+		}
+		else
+		{
+			section_data      = &( data[ generator->volumes_information_offset ] );
+			section_data_size = (size_t) generator->volumes_information_size;
+		}
+		result = scca_bench_sections_time_parse(
+		          io_handle,
+		          section,
+		          section_data,
+		          section_data_size,
+		          number_of_entries,
+		          filename_strings,
+		          number_of_iterations,
+		          samples,
+		          counters,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse generated %s section with %" PRIu32 " entries.",
+			 function,
+			 scca_bench_sections_section_names[ section ],
+			 number_of_entries );
+
+			goto on_error;
+		}
+		if( bench_samples_get_percentile(
+		     samples,
+		     50,
+		     &latency_p50,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve latency p50.",
+			 function );
+
+			goto on_error;
+		}
+		ratio      = 0.0;
+		is_flagged = 0;
+
+		if( previous_latency_p50 > 0 )
+		{
+			ratio = (double) latency_p50 / (double) previous_latency_p50;
+
+			if( ratio > SCCA_BENCH_SECTIONS_SUPERLINEAR_RATIO )
+			{
+				is_flagged = 1;
+
+				*number_of_flagged += 1;
+			}
+		}
+		if( scca_bench_sections_result_fprint(
+		     stdout,
+		     output_format,
+		     NULL,
+		     section,
+		     format_version,
+		     number_of_entries,
+		     section_data_size,
+		     1,
+		     samples,
+		     counters,
+		     ratio,
+		     is_flagged,
+		     &latency_p50,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print results.",
+			 function );
+
+			goto on_error;
+		}
+		previous_latency_p50 = latency_p50;
+
+		if( bench_samples_empty(
+		     samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to empty samples.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_filename_strings_free(
+		     &filename_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filename strings.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 data );
+
+		data = NULL;
+
+		/* Prevent the number of entries from overflowing
+		 */
+		if( number_of_entries > ( maximum_number_of_entries / 2 ) )
+		{
+			break;
+		}
+	}
+	if( bench_samples_free(
+	     &samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free samples.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( generator_free(
+	     &generator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free generator.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( samples != NULL )
+	{
+		bench_samples_free(
+		 &samples,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( generator != NULL )
+	{
+		generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Measures the parsing of a source as every section
+ * The source uses the layout of the inputs of the OSS-Fuzz section targets
+ * Returns 1 if successful or -1 on error
+ */
+int scca_bench_sections_source(
+     const system_character_t *source,
+     int number_of_iterations,
+     uint64_t timeout,
+     int output_format,
+     bench_counters_t *counters,
+     int *number_of_flagged,
+     libcerror_error_t **error )
+{
+	bench_samples_t *samples                     = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	libscca_io_handle_t *io_handle               = NULL;
+	const uint8_t *section_data                  = NULL;
+	uint8_t *data                                = NULL;
+	static char *function                        = "scca_bench_sections_source";
+	size_t data_size                             = 0;
+	size_t entry_data_size                       = 0;
+	size_t section_data_size                     = 0;
+	uint64_t latency_p50                         = 0;
+	uint32_t number_of_entries                   = 0;
+	uint8_t is_flagged                           = 0;
+	int result                                   = 0;
+	int section                                  = 0;
+
+	if( number_of_flagged == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of flagged.",
+		 function );
+
+		return( -1 );
+	}
+	if( bench_input_read_file(
+	     source,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read source.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first byte selects the format version
+	 */
+	io_handle->format_version = scca_bench_sections_format_versions[ data[ 0 ] % SCCA_BENCH_SECTIONS_NUMBER_OF_FORMAT_VERSIONS ];
+
+	if( libscca_filename_strings_initialize(
+	     &filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filename strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( bench_samples_initialize(
+	     &samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create samples.",
+		 function );
+
+		goto on_error;
+	}
+	for( section = 0;
+	     section < SCCA_BENCH_SECTIONS_NUMBER_OF_SECTIONS;
+	     section++ )
+	{
+		section_data      = &( data[ 1 ] );
+		section_data_size = data_size - 1;
+		number_of_entries = 0;
+
+		if( section == SCCA_BENCH_SECTION_FILE_METRICS )
+		{
+			/* The second byte contains the number of entries, the entries are followed
+			 * by the filename strings the entries refer to
+			 */
+			if( io_handle->format_version == 17 )
+			{
+				entry_data_size = sizeof( scca_file_metrics_array_entry_v17_t );
+			}
+			else
+			{
+				entry_data_size = sizeof( scca_file_metrics_array_entry_v23_t );
+			}
+			number_of_entries = (uint32_t) data[ 1 ] + 1;
+			section_data      = &( data[ 2 ] );
+			section_data_size = (size_t) number_of_entries * entry_data_size;
+
+			if( section_data_size > ( data_size - 2 ) )
+			{
+				continue;
+			}
+			if( libscca_filename_strings_clear(
+			     filename_strings,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear filename strings.",
+				 function );
+
+				goto on_error;
+			}
+			/* The filename strings are read beforehand and allowed to be invalid
+			 */
+			if( ( data_size - 2 ) > section_data_size )
+			{
+				if( libscca_filename_strings_read_data(
+				     filename_strings,
+				     &( data[ 2 + section_data_size ] ),
+				     data_size - 2 - section_data_size,
+				     NULL ) != 1 )
+				{
+					libscca_filename_strings_clear(
+					 filename_strings,
+					 NULL );
+				}
+			}
+		}
+		else if( section == SCCA_BENCH_SECTION_VOLUMES_INFORMATION )
+		{
+			/* The second byte contains the number of volumes
+			 */
+			number_of_entries = (uint32_t) ( data[ 1 ] & 0x0f ) + 1;
+			section_data      = &( data[ 2 ] );
+			section_data_size = data_size - 2;
+		}
+		result = scca_bench_sections_time_parse(
+		          io_handle,
+		          section,
+		          section_data,
+		          section_data_size,
+		          number_of_entries,
+		          filename_strings,
+		          number_of_iterations,
+		          samples,
+		          counters,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse %s section.",
+			 function,
+			 scca_bench_sections_section_names[ section ] );
+
+			goto on_error;
+		}
+		if( bench_samples_get_percentile(
+		     samples,
+		     50,
+		     &latency_p50,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve latency p50.",
+			 function );
+
+			goto on_error;
+		}
+		/* A section that fails to parse can still take too long
+		 */
+		is_flagged = 0;
+
+		if( latency_p50 > ( timeout * 1000000 ) )
+		{
+			is_flagged = 1;
+
+			*number_of_flagged += 1;
+		}
+		if( scca_bench_sections_result_fprint(
+		     stdout,
+		     output_format,
+		     source,
+		     section,
+		     io_handle->format_version,
+		     number_of_entries,
+		     section_data_size,
+		     result,
+		     samples,
+		     counters,
+		     0.0,
+		     is_flagged,
+		     &latency_p50,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print results.",
+			 function );
+
+			goto on_error;
+		}
+		if( bench_samples_empty(
+		     samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to empty samples.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( bench_samples_free(
+	     &samples,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free samples.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_filename_strings_free(
+	     &filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free filename strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( samples != NULL )
+	{
+		bench_samples_free(
+		 &samples,
+		 NULL );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	bench_counters_t *counters                       = NULL;
+	libcerror_error_t *error                         = NULL;
+	system_character_t *option_format_version        = NULL;
+	system_character_t *option_number_of_entries     = NULL;
+	system_character_t *option_number_of_iterations  = NULL;
+	system_character_t *option_output_format         = NULL;
+	system_character_t *option_timeout               = NULL;
+	system_integer_t option                          = 0;
+	int argument_index                               = 0;
+	int format_version                               = 30;
+	int maximum_number_of_entries                    = SCCA_BENCH_SECTIONS_DEFAULT_NUMBER_OF_ENTRIES;
+	int number_of_failures                           = 0;
+	int number_of_flagged                            = 0;
+	int number_of_iterations                         = SCCA_BENCH_SECTIONS_DEFAULT_NUMBER_OF_ITERATIONS;
+	int output_format                                = BENCH_OUTPUT_FORMAT_TEXT;
+	int result                                       = 0;
+	int timeout                                      = SCCA_BENCH_SECTIONS_DEFAULT_TIMEOUT;
+	uint8_t use_counters                             = 0;
+
+#if defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS )
+	int section                                      = 0;
+#endif
+
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "cF:hi:m:o:t:V" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				use_counters = 1;
+
+				break;
+
+			case (system_integer_t) 'F':
+				option_format_version = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_number_of_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_number_of_entries = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_timeout = optarg;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fprintf(
+				 stdout,
+				 "scca_bench_sections %s\n",
+				 LIBSCCA_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+#if !defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS )
+	fprintf(
+	 stderr,
+	 "Benchmarking the sections requires access to the libscca internals.\n" );
+
+	return( EXIT_FAILURE );
+#else
+	if( option_format_version != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_format_version,
+		          30,
+		          &format_version,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine format version.\n" );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( ( format_version != 17 )
+		       &&  ( format_version != 23 )
+		       &&  ( format_version != 26 )
+		       &&  ( format_version != 30 ) ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported format version defaulting to: 30.\n" );
+
+			format_version = 30;
+		}
+	}
+	if( option_number_of_entries != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_number_of_entries,
+		          GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES,
+		          &maximum_number_of_entries,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of entries.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of entries defaulting to: %d.\n",
+			 SCCA_BENCH_SECTIONS_DEFAULT_NUMBER_OF_ENTRIES );
+		}
+	}
+	if( option_number_of_iterations != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_number_of_iterations,
+		          SCCA_BENCH_SECTIONS_MAXIMUM_NUMBER_OF_ITERATIONS,
+		          &number_of_iterations,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of iterations.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations defaulting to: %d.\n",
+			 SCCA_BENCH_SECTIONS_DEFAULT_NUMBER_OF_ITERATIONS );
+		}
+	}
+	if( option_output_format != NULL )
+	{
+		result = bench_output_determine_format(
+		          option_output_format,
+		          &output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( option_timeout != NULL )
+	{
+		result = bench_input_determine_number(
+		          option_timeout,
+		          SCCA_BENCH_SECTIONS_MAXIMUM_TIMEOUT,
+		          &timeout,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine timeout.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported timeout defaulting to: %d.\n",
+			 SCCA_BENCH_SECTIONS_DEFAULT_TIMEOUT );
+		}
+	}
+	if( use_counters != 0 )
+	{
+		if( bench_counters_initialize(
+		     &counters,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize counters.\n" );
+
+			goto on_error;
+		}
+		result = bench_counters_has_counters(
+		          counters,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine if counters are available.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Hardware counters are not available, continuing without.\n" );
+
+			if( bench_counters_free(
+			     &counters,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to free counters.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( optind == argc )
+	{
+		/* The file information has a fixed size and is therefore not scaled
+		 */
+		for( section = SCCA_BENCH_SECTION_FILE_METRICS;
+		     section < SCCA_BENCH_SECTIONS_NUMBER_OF_SECTIONS;
+		     section++ )
+		{
+			if( scca_bench_sections_scale(
+			     section,
+			     (uint32_t) format_version,
+			     (uint32_t) maximum_number_of_entries,
+			     number_of_iterations,
+			     output_format,
+			     counters,
+			     &number_of_flagged,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to benchmark generated %s section.\n",
+				 scca_bench_sections_section_names[ section ] );
+
+				libcerror_error_backtrace_fprint(
+				 error,
+				 stderr );
+				libcerror_error_free(
+				 &error );
+
+				number_of_failures++;
+			}
+		}
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( scca_bench_sections_source(
+		     argv[ argument_index ],
+		     number_of_iterations,
+		     (uint64_t) timeout,
+		     output_format,
+		     counters,
+		     &number_of_flagged,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to benchmark: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			libcerror_error_backtrace_fprint(
+			 error,
+			 stderr );
+			libcerror_error_free(
+			 &error );
+
+			number_of_failures++;
+		}
+	}
+	if( number_of_flagged > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Flagged: %d sections with a superlinear or too long parse time.\n",
+		 number_of_flagged );
+	}
+	if( counters != NULL )
+	{
+		if( bench_counters_free(
+		     &counters,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free counters.\n" );
+
+			goto on_error;
+		}
+	}
+	if( number_of_failures > 0 )
+	{
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( counters != NULL )
+	{
+		bench_counters_free(
+		 &counters,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+#endif /* !defined( SCCA_BENCH_SECTIONS_HAVE_INTERNALS ) */
+}
+
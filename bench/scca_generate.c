@@ -0,0 +1,1082 @@
+/*
+ * Generates synthetic Windows Prefetch Files (PF) for benchmarks
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_libbfio.h"
+#include "bench_libcerror.h"
+#include "bench_libscca.h"
+#include "generator.h"
+#include "../sccatools/sccatools_getopt.h"
+
+#include "../libscca/scca_file_header.h"
+
+/* The default number of entries of the generated prefetch files
+ */
+#define SCCA_GENERATE_DEFAULT_NUMBER_OF_FILE_METRICS_ENTRIES	64
+#define SCCA_GENERATE_DEFAULT_NUMBER_OF_FILENAMES		64
+#define SCCA_GENERATE_DEFAULT_NUMBER_OF_TRACE_CHAIN_ENTRIES	256
+#define SCCA_GENERATE_DEFAULT_NUMBER_OF_VOLUMES			1
+#define SCCA_GENERATE_DEFAULT_NUMBER_OF_DIRECTORY_STRINGS	8
+#define SCCA_GENERATE_DEFAULT_NUMBER_OF_FILE_REFERENCES		32
+
+/* The maximum number of generated prefetch files
+ */
+#define SCCA_GENERATE_MAXIMUM_NUMBER_OF_FILES			9999
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use scca_generate to generate synthetic Windows Prefetch Files (PF)\n"
+	                 "for benchmarks.\n\n" );
+
+	fprintf( stream, "Usage: scca_generate [ -d number_of_directory_strings ]\n"
+	                 "                     [ -f number_of_filenames ] [ -F format ]\n"
+	                 "                     [ -m number_of_file_metrics_entries ]\n"
+	                 "                     [ -n number_of_files ]\n"
+	                 "                     [ -r number_of_file_references ] [ -s seed ]\n"
+	                 "                     [ -t number_of_trace_chain_entries ]\n"
+	                 "                     [ -v number_of_volumes ] [ -chV ] target\n\n" );
+
+	fprintf( stream, "\ttarget: the target file, if more than one file is generated\n"
+	                 "\t        -0000.pf, -0001.pf, etc. is appended to the target\n\n" );
+
+	fprintf( stream, "\t-c:     compress the files as Windows 10 (MAM) Prefetch Files\n" );
+	fprintf( stream, "\t-d:     the number of directory strings per volume (default\n"
+	                 "\t        is 8)\n" );
+	fprintf( stream, "\t-f:     the number of filenames (default is 64), the maximum\n"
+	                 "\t        is 8192\n" );
+	fprintf( stream, "\t-F:     the format version, options: 17, 23, 26, 30 (default)\n"
+	                 "\t        or 30-2, where 30-2 is the variant of version 30 with\n"
+	                 "\t        the metrics array at offset 0x128\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     the number of file metrics entries (default is 64)\n" );
+	fprintf( stream, "\t-n:     the number of files (default is 1)\n" );
+	fprintf( stream, "\t-r:     the number of file references per volume (default\n"
+	                 "\t        is 32)\n" );
+	fprintf( stream, "\t-s:     the seed of the pseudo random values (default is 1)\n" );
+	fprintf( stream, "\t-t:     the number of trace chain entries (default is 256)\n" );
+	fprintf( stream, "\t-v:     the number of volumes (default is 1)\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Determines a value from a string, where 0 is a supported value
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scca_generate_determine_value(
+     const system_character_t *string,
+     uint32_t maximum_value,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "scca_generate_determine_value";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint64_t safe_value   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 10 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		safe_value *= 10;
+		safe_value += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( safe_value > (uint64_t) maximum_value )
+	{
+		return( 0 );
+	}
+	*value = (uint32_t) safe_value;
+
+	return( 1 );
+}
+
+/* Determines the format version from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scca_generate_determine_format_version(
+     const system_character_t *string,
+     uint32_t *format_version,
+     uint32_t *metrics_array_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "scca_generate_determine_format_version";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_array_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics array offset.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 2 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "17" ),
+		     2 ) == 0 )
+		{
+			*format_version = 17;
+			result          = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "23" ),
+		          2 ) == 0 )
+		{
+			*format_version = 23;
+			result          = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "26" ),
+		          2 ) == 0 )
+		{
+			*format_version = 26;
+			result          = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "30" ),
+		          2 ) == 0 )
+		{
+			*format_version = 30;
+			result          = 1;
+		}
+		*metrics_array_offset = 0;
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "30-2" ),
+		     4 ) == 0 )
+		{
+			*format_version       = 30;
+			*metrics_array_offset = 0x00000128UL;
+			result                = 1;
+		}
+	}
+	return( result );
+}
+
+/* Writes data to a file
+ * Returns 1 if successful or -1 on error
+ */
+int scca_generate_write_file(
+     const system_character_t *filename,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "scca_generate_write_file";
+	ssize_t write_count              = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     system_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     system_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Generates the prefetch files
+ * Returns 1 if successful or -1 on error
+ */
+int scca_generate_files(
+     generator_t *generator,
+     const system_character_t *target,
+     uint32_t number_of_files,
+     uint8_t compress,
+     libcerror_error_t **error )
+{
+	system_character_t *filename   = NULL;
+	uint8_t *compressed_data       = NULL;
+	uint8_t *data                  = NULL;
+	uint8_t *file_data             = NULL;
+	static char *function          = "scca_generate_files";
+	size_t compressed_data_size    = 0;
+	size_t data_size               = 0;
+	size_t file_data_size          = 0;
+	size_t filename_size           = 0;
+	size_t maximum_compressed_size = 0;
+	uint32_t file_index            = 0;
+	int print_count                = 0;
+
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( generator_get_data_size(
+	     generator,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	file_data      = data;
+	file_data_size = data_size;
+
+	if( compress != 0 )
+	{
+		if( generator_get_compressed_data_size(
+		     data_size,
+		     &maximum_compressed_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed data size.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * ( sizeof( scca_mam_file_header_t ) + maximum_compressed_size ) );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		file_data = compressed_data;
+	}
+	if( number_of_files > 1 )
+	{
+		filename_size = system_string_length(
+		                 target ) + 9;
+
+		filename = system_string_allocate(
+		            filename_size );
+
+		if( filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( generator_write_data(
+		     generator,
+		     file_index,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write data of file: %" PRIu32 ".",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( compress != 0 )
+		{
+			if( memory_copy(
+			     ( (scca_mam_file_header_t *) compressed_data )->signature,
+			     "MAM\x04",
+			     4 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy signature.",
+				 function );
+
+				goto on_error;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (scca_mam_file_header_t *) compressed_data )->uncompressed_data_size,
+			 (uint32_t) data_size );
+
+			compressed_data_size = maximum_compressed_size;
+
+			if( generator_compress_data(
+			     data,
+			     data_size,
+			     &( compressed_data[ sizeof( scca_mam_file_header_t ) ] ),
+			     &compressed_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+				 "%s: unable to compress data of file: %" PRIu32 ".",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			/* libscca reads the compressed data as a single block of at most the uncompressed data size
+			 */
+			if( compressed_data_size > data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid compressed data size of file: %" PRIu32 " value exceeds uncompressed data size.",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+			file_data_size = sizeof( scca_mam_file_header_t ) + compressed_data_size;
+		}
+		if( filename != NULL )
+		{
+			print_count = system_string_sprintf(
+			               filename,
+			               filename_size,
+			               _SYSTEM_STRING( "%" PRIs_SYSTEM "-%04" PRIu32 ".pf" ),
+			               target,
+			               file_index );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= filename_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to format filename of file: %" PRIu32 ".",
+				 function,
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		if( scca_generate_write_file(
+		     ( filename != NULL ) ? filename : target,
+		     file_data,
+		     file_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file: %" PRIu32 ".",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Determines the value of an option
+ * Prints a message and retains the default value if the option value is unsupported
+ * Returns 1 if successful or -1 on error
+ */
+int scca_generate_determine_option_value(
+     const system_character_t *string,
+     const char *description,
+     uint32_t maximum_value,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "scca_generate_determine_option_value";
+	int result            = 0;
+
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		return( 1 );
+	}
+	result = scca_generate_determine_value(
+	          string,
+	          maximum_value,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine %s.",
+		 function,
+		 description );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unsupported %s defaulting to: %" PRIu32 ".\n",
+		 description,
+		 *value );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	generator_t *generator                                 = NULL;
+	libcerror_error_t *error                               = NULL;
+	system_character_t *option_format                      = NULL;
+	system_character_t *option_number_of_directory_strings = NULL;
+	system_character_t *option_number_of_file_metrics      = NULL;
+	system_character_t *option_number_of_file_references   = NULL;
+	system_character_t *option_number_of_filenames         = NULL;
+	system_character_t *option_number_of_files             = NULL;
+	system_character_t *option_number_of_trace_chain       = NULL;
+	system_character_t *option_number_of_volumes           = NULL;
+	system_character_t *option_seed                        = NULL;
+	system_integer_t option                                = 0;
+	uint32_t format_version                                = 30;
+	uint32_t metrics_array_offset                          = 0;
+	uint32_t number_of_directory_strings                   = SCCA_GENERATE_DEFAULT_NUMBER_OF_DIRECTORY_STRINGS;
+	uint32_t number_of_file_metrics_entries                = SCCA_GENERATE_DEFAULT_NUMBER_OF_FILE_METRICS_ENTRIES;
+	uint32_t number_of_file_references                     = SCCA_GENERATE_DEFAULT_NUMBER_OF_FILE_REFERENCES;
+	uint32_t number_of_filenames                           = SCCA_GENERATE_DEFAULT_NUMBER_OF_FILENAMES;
+	uint32_t number_of_files                               = 1;
+	uint32_t number_of_trace_chain_entries                 = SCCA_GENERATE_DEFAULT_NUMBER_OF_TRACE_CHAIN_ENTRIES;
+	uint32_t number_of_volumes                             = SCCA_GENERATE_DEFAULT_NUMBER_OF_VOLUMES;
+	uint32_t seed                                          = 1;
+	uint8_t compress                                       = 0;
+	int result                                             = 0;
+
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "cd:f:F:hm:n:r:s:t:v:V" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				compress = 1;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_number_of_directory_strings = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				option_number_of_filenames = optarg;
+
+				break;
+
+			case (system_integer_t) 'F':
+				option_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				option_number_of_file_metrics = optarg;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_number_of_files = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_number_of_file_references = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_seed = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_trace_chain = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				option_number_of_volumes = optarg;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fprintf(
+				 stdout,
+				 "scca_generate %s\n",
+				 LIBSCCA_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_format != NULL )
+	{
+		result = scca_generate_determine_format_version(
+		          option_format,
+		          &format_version,
+		          &metrics_array_offset,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine format version.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported format version defaulting to: 30.\n" );
+
+			format_version       = 30;
+			metrics_array_offset = 0;
+		}
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_directory_strings,
+	     "number of directory strings",
+	     GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES,
+	     &number_of_directory_strings,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of directory strings.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_filenames,
+	     "number of filenames",
+	     GENERATOR_MAXIMUM_NUMBER_OF_FILENAMES,
+	     &number_of_filenames,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of filenames.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_file_metrics,
+	     "number of file metrics entries",
+	     GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES,
+	     &number_of_file_metrics_entries,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of file metrics entries.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_files,
+	     "number of files",
+	     SCCA_GENERATE_MAXIMUM_NUMBER_OF_FILES,
+	     &number_of_files,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of files.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_file_references,
+	     "number of file references",
+	     GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES,
+	     &number_of_file_references,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of file references.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_seed,
+	     "seed",
+	     UINT32_MAX,
+	     &seed,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine seed.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_trace_chain,
+	     "number of trace chain entries",
+	     GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES,
+	     &number_of_trace_chain_entries,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of trace chain entries.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_determine_option_value(
+	     option_number_of_volumes,
+	     "number of volumes",
+	     GENERATOR_MAXIMUM_NUMBER_OF_ENTRIES,
+	     &number_of_volumes,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine number of volumes.\n" );
+
+		goto on_error;
+	}
+	if( generator_initialize(
+	     &generator,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize generator.\n" );
+
+		goto on_error;
+	}
+	if( generator_set_format_version(
+	     generator,
+	     format_version,
+	     metrics_array_offset,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set format version.\n" );
+
+		goto on_error;
+	}
+	if( generator_set_number_of_entries(
+	     generator,
+	     number_of_file_metrics_entries,
+	     number_of_filenames,
+	     number_of_trace_chain_entries,
+	     number_of_volumes,
+	     number_of_directory_strings,
+	     number_of_file_references,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set number of entries.\n" );
+
+		goto on_error;
+	}
+	if( generator_set_seed(
+	     generator,
+	     seed,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set seed.\n" );
+
+		goto on_error;
+	}
+	if( number_of_files == 0 )
+	{
+		number_of_files = 1;
+	}
+	if( scca_generate_files(
+	     generator,
+	     argv[ optind ],
+	     number_of_files,
+	     compress,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( generator_free(
+	     &generator,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free generator.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( generator != NULL )
+	{
+		generator_free(
+		 &generator,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
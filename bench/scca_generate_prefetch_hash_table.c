@@ -0,0 +1,924 @@
+/*
+ * Generates the prefetch hash table of libscca from a list of executable paths
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "bench_libcerror.h"
+#include "bench_libscca.h"
+#include "../sccatools/sccatools_getopt.h"
+
+/* The device prefix of the executable paths
+ */
+#define SCCA_GENERATE_PREFETCH_HASH_TABLE_DEVICE_PREFIX		"\\DEVICE\\HARDDISKVOLUME"
+
+/* The default number of volumes
+ */
+#define SCCA_GENERATE_PREFETCH_HASH_TABLE_DEFAULT_NUMBER_OF_VOLUMES	8
+
+/* The maximum number of volumes, the volume number is stored in 8 bits
+ */
+#define SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_NUMBER_OF_VOLUMES	255
+
+/* The maximum number of paths, the path index is stored in 16 bits
+ */
+#define SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_NUMBER_OF_PATHS	65535
+
+/* The maximum size of a path, including the end of string character
+ */
+#define SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_PATH_SIZE		512
+
+/* The number of distinct hash types, the 2008 hash type is equivalent to the Vista hash type
+ */
+#define SCCA_GENERATE_PREFETCH_HASH_TABLE_NUMBER_OF_HASH_TYPES		2
+
+typedef struct scca_generate_prefetch_hash_table_entry scca_generate_prefetch_hash_table_entry_t;
+
+struct scca_generate_prefetch_hash_table_entry
+{
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The index of the path
+	 */
+	uint16_t path_index;
+
+	/* The hash type
+	 */
+	uint8_t hash_type;
+
+	/* The volume number
+	 */
+	uint8_t volume_number;
+};
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use scca_generate_prefetch_hash_table to generate the prefetch hash\n"
+	                 "table of libscca from a list of executable paths.\n\n" );
+
+	fprintf( stream, "Usage: scca_generate_prefetch_hash_table [ -v number_of_volumes ]\n"
+	                 "                                         [ -hV ] source target\n\n" );
+
+	fprintf( stream, "\tsource: the file that contains the executable paths, one per line\n"
+	                 "\t        relative to the root of the volume, such as:\n"
+	                 "\t        \\WINDOWS\\SYSTEM32\\CMD.EXE\n"
+	                 "\t        empty lines and lines that start with # are ignored\n" );
+	fprintf( stream, "\ttarget: the C source file to write the table to, such as:\n"
+	                 "\t        libscca/libscca_prefetch_hash_table_data.c\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-v:     the number of volumes, the paths are hashed for\n"
+	                 "\t        \\DEVICE\\HARDDISKVOLUME1 up to and including the\n"
+	                 "\t        number of volumes (default is 8)\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Determines the number of volumes from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scca_generate_prefetch_hash_table_determine_number_of_volumes(
+     const system_character_t *string,
+     uint32_t *number_of_volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "scca_generate_prefetch_hash_table_determine_number_of_volumes";
+	size_t string_index   = 0;
+	uint32_t safe_value   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	while( string[ string_index ] != 0 )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		safe_value *= 10;
+		safe_value += (uint32_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value > SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_NUMBER_OF_VOLUMES )
+		{
+			return( 0 );
+		}
+		string_index++;
+	}
+	if( safe_value == 0 )
+	{
+		return( 0 );
+	}
+	*number_of_volumes = safe_value;
+
+	return( 1 );
+}
+
+/* Frees the paths
+ */
+void scca_generate_prefetch_hash_table_free_paths(
+      char **paths,
+      int number_of_paths )
+{
+	int path_index = 0;
+
+	if( paths == NULL )
+	{
+		return;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( paths[ path_index ] != NULL )
+		{
+			memory_free(
+			 paths[ path_index ] );
+		}
+	}
+	memory_free(
+	 paths );
+}
+
+/* Reads the executable paths from a stream
+ * Returns 1 if successful or -1 on error
+ */
+int scca_generate_prefetch_hash_table_read_paths(
+     FILE *stream,
+     char ***paths,
+     int *number_of_paths,
+     libcerror_error_t **error )
+{
+	char line[ SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_PATH_SIZE ];
+
+	char **reallocation      = NULL;
+	char **safe_paths        = NULL;
+	static char *function    = "scca_generate_prefetch_hash_table_read_paths";
+	size_t line_length       = 0;
+	int line_number          = 0;
+	int maximum_paths        = 0;
+	int safe_number_of_paths = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of paths.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        stream,
+	        line,
+	        SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_PATH_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != '\n' )
+		 && ( file_stream_at_end(
+		       stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: line: %d exceeds maximum path size.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' )
+		     ||  ( line[ line_length - 1 ] == ' ' ) ) )
+		{
+			line_length--;
+		}
+		line[ line_length ] = 0;
+
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		if( line[ 0 ] != '\\' )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported path on line: %d, path should start with a backslash.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( safe_number_of_paths >= SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_NUMBER_OF_PATHS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: number of paths exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( safe_number_of_paths >= maximum_paths )
+		{
+			maximum_paths += 256;
+
+			reallocation = (char **) memory_reallocate(
+			                          safe_paths,
+			                          sizeof( char * ) * maximum_paths );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize paths.",
+				 function );
+
+				goto on_error;
+			}
+			safe_paths = reallocation;
+		}
+		safe_paths[ safe_number_of_paths ] = narrow_string_allocate(
+		                                      line_length + 1 );
+
+		if( safe_paths[ safe_number_of_paths ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create path.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_paths[ safe_number_of_paths ],
+		     line,
+		     line_length + 1 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			safe_number_of_paths++;
+
+			goto on_error;
+		}
+		safe_number_of_paths++;
+	}
+	*paths           = safe_paths;
+	*number_of_paths = safe_number_of_paths;
+
+	return( 1 );
+
+on_error:
+	scca_generate_prefetch_hash_table_free_paths(
+	 safe_paths,
+	 safe_number_of_paths );
+
+	return( -1 );
+}
+
+/* Compares two prefetch hash table entries
+ * The entries are sorted by prefetch hash, hash type, volume number and path index
+ * Returns -1 if the first entry is less than, 0 if equal to or 1 if greater than the second
+ */
+int scca_generate_prefetch_hash_table_compare_entries(
+     const void *first_value,
+     const void *second_value )
+{
+	const scca_generate_prefetch_hash_table_entry_t *first_entry  = (const scca_generate_prefetch_hash_table_entry_t *) first_value;
+	const scca_generate_prefetch_hash_table_entry_t *second_entry = (const scca_generate_prefetch_hash_table_entry_t *) second_value;
+
+	if( first_entry->prefetch_hash != second_entry->prefetch_hash )
+	{
+		return( ( first_entry->prefetch_hash < second_entry->prefetch_hash ) ? -1 : 1 );
+	}
+	if( first_entry->hash_type != second_entry->hash_type )
+	{
+		return( ( first_entry->hash_type < second_entry->hash_type ) ? -1 : 1 );
+	}
+	if( first_entry->volume_number != second_entry->volume_number )
+	{
+		return( ( first_entry->volume_number < second_entry->volume_number ) ? -1 : 1 );
+	}
+	if( first_entry->path_index != second_entry->path_index )
+	{
+		return( ( first_entry->path_index < second_entry->path_index ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Computes the prefetch hash table entries
+ * Returns 1 if successful or -1 on error
+ */
+int scca_generate_prefetch_hash_table_compute_entries(
+     char **paths,
+     int number_of_paths,
+     uint32_t number_of_volumes,
+     scca_generate_prefetch_hash_table_entry_t *entries,
+     libcerror_error_t **error )
+{
+	char device_path[ SCCA_GENERATE_PREFETCH_HASH_TABLE_MAXIMUM_PATH_SIZE + 32 ];
+
+	const int hash_types[ SCCA_GENERATE_PREFETCH_HASH_TABLE_NUMBER_OF_HASH_TYPES ] = {
+		LIBSCCA_PREFETCH_HASH_TYPE_XP,
+		LIBSCCA_PREFETCH_HASH_TYPE_VISTA };
+
+	static char *function     = "scca_generate_prefetch_hash_table_compute_entries";
+	size_t device_path_length = 0;
+	uint32_t volume_number    = 0;
+	int entry_index           = 0;
+	int hash_type_index       = 0;
+	int path_index            = 0;
+	int print_count           = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		for( volume_number = 1;
+		     volume_number <= number_of_volumes;
+		     volume_number++ )
+		{
+			print_count = snprintf(
+			               device_path,
+			               sizeof( device_path ),
+			               "%s%" PRIu32 "%s",
+			               SCCA_GENERATE_PREFETCH_HASH_TABLE_DEVICE_PREFIX,
+			               volume_number,
+			               paths[ path_index ] );
+
+			if( ( print_count < 0 )
+			 || ( (size_t) print_count >= sizeof( device_path ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set device path of path: %d.",
+				 function,
+				 path_index );
+
+				return( -1 );
+			}
+			device_path_length = (size_t) print_count;
+
+			for( hash_type_index = 0;
+			     hash_type_index < SCCA_GENERATE_PREFETCH_HASH_TABLE_NUMBER_OF_HASH_TYPES;
+			     hash_type_index++ )
+			{
+				if( libscca_compute_prefetch_hash(
+				     (uint8_t *) device_path,
+				     device_path_length,
+				     hash_types[ hash_type_index ],
+				     &( entries[ entry_index ].prefetch_hash ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compute prefetch hash of: %s.",
+					 function,
+					 device_path );
+
+					return( -1 );
+				}
+				entries[ entry_index ].path_index    = (uint16_t) path_index;
+				entries[ entry_index ].hash_type     = (uint8_t) hash_types[ hash_type_index ];
+				entries[ entry_index ].volume_number = (uint8_t) volume_number;
+
+				entry_index++;
+			}
+		}
+	}
+	qsort(
+	 entries,
+	 (size_t) entry_index,
+	 sizeof( scca_generate_prefetch_hash_table_entry_t ),
+	 &scca_generate_prefetch_hash_table_compare_entries );
+
+	return( 1 );
+}
+
+/* Writes the prefetch hash table as C source
+ * Returns 1 if successful or -1 on error
+ */
+int scca_generate_prefetch_hash_table_write(
+     FILE *stream,
+     char **paths,
+     int number_of_paths,
+     uint32_t number_of_volumes,
+     const scca_generate_prefetch_hash_table_entry_t *entries,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "scca_generate_prefetch_hash_table_write";
+	size_t string_index   = 0;
+	int entry_index       = 0;
+	int path_index        = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf( stream, "/*\n"
+	                 " * Prefetch hash table data\n"
+	                 " *\n"
+	                 " * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>\n"
+	                 " *\n"
+	                 " * Refer to AUTHORS for acknowledgements.\n"
+	                 " *\n"
+	                 " * This program is free software: you can redistribute it and/or modify\n"
+	                 " * it under the terms of the GNU Lesser General Public License as published by\n"
+	                 " * the Free Software Foundation, either version 3 of the License, or\n"
+	                 " * (at your option) any later version.\n"
+	                 " *\n"
+	                 " * This program is distributed in the hope that it will be useful,\n"
+	                 " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+	                 " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+	                 " * GNU General Public License for more details.\n"
+	                 " *\n"
+	                 " * You should have received a copy of the GNU Lesser General Public License\n"
+	                 " * along with this program.  If not, see <https://www.gnu.org/licenses/>.\n"
+	                 " */\n"
+	                 "\n"
+	                 "#include <common.h>\n"
+	                 "#include <types.h>\n"
+	                 "\n"
+	                 "#include \"libscca_definitions.h\"\n"
+	                 "#include \"libscca_prefetch_hash_table.h\"\n"
+	                 "\n" );
+
+	fprintf( stream, "/* This file is generated by bench/scca_generate_prefetch_hash_table from\n"
+	                 " * bench/prefetch_hash_paths.txt, do not edit it by hand.\n"
+	                 " * The paths are hashed for \\DEVICE\\HARDDISKVOLUME1 up to and including\n"
+	                 " * \\DEVICE\\HARDDISKVOLUME%" PRIu32 " with the XP and Vista hash types,\n"
+	                 " * where the 2008 hash type is equivalent to the Vista hash type.\n"
+	                 " */\n"
+	                 "\n",
+	         number_of_volumes );
+
+	fprintf( stream, "/* The paths, relative to the root of the volume\n"
+	                 " */\n"
+	                 "const char *libscca_prefetch_hash_table_paths[ %d ] = {\n",
+	         number_of_paths );
+
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		fprintf( stream, "\t\"" );
+
+		for( string_index = 0;
+		     paths[ path_index ][ string_index ] != 0;
+		     string_index++ )
+		{
+			if( ( paths[ path_index ][ string_index ] == '\\' )
+			 || ( paths[ path_index ][ string_index ] == '"' ) )
+			{
+				fputc( '\\', stream );
+			}
+			fputc( paths[ path_index ][ string_index ], stream );
+		}
+		fprintf( stream, "\"%s\n",
+		         ( path_index + 1 < number_of_paths ) ? "," : " };" );
+	}
+	fprintf( stream, "\n"
+	                 "const int libscca_prefetch_hash_table_number_of_paths = %d;\n"
+	                 "\n",
+	         number_of_paths );
+
+	fprintf( stream, "/* The entries, sorted by prefetch hash, hash type, volume number and path index\n"
+	                 " * Every entry contains: prefetch hash, path index, hash type and volume number\n"
+	                 " */\n"
+	                 "const libscca_prefetch_hash_table_entry_t libscca_prefetch_hash_table_entries[ %d ] = {\n",
+	         number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		fprintf( stream, "\t{ 0x%08" PRIx32 "UL, %" PRIu16 ", %s, %" PRIu8 " }%s\n",
+		         entries[ entry_index ].prefetch_hash,
+		         entries[ entry_index ].path_index,
+		         ( entries[ entry_index ].hash_type == LIBSCCA_PREFETCH_HASH_TYPE_XP ) ? "LIBSCCA_PREFETCH_HASH_TYPE_XP" : "LIBSCCA_PREFETCH_HASH_TYPE_VISTA",
+		         entries[ entry_index ].volume_number,
+		         ( entry_index + 1 < number_of_entries ) ? "," : " };" );
+	}
+	fprintf( stream, "\n"
+	                 "const int libscca_prefetch_hash_table_number_of_entries = %d;\n"
+	                 "\n",
+	         number_of_entries );
+
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	scca_generate_prefetch_hash_table_entry_t *entries = NULL;
+	libcerror_error_t *error                           = NULL;
+	system_character_t *option_number_of_volumes       = NULL;
+	char **paths                                       = NULL;
+	FILE *source_stream                                = NULL;
+	FILE *target_stream                                = NULL;
+	system_integer_t option                            = 0;
+	uint32_t number_of_volumes                         = SCCA_GENERATE_PREFETCH_HASH_TABLE_DEFAULT_NUMBER_OF_VOLUMES;
+	int number_of_entries                              = 0;
+	int number_of_paths                                = 0;
+	int result                                         = 0;
+
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hv:V" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				option_number_of_volumes = optarg;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fprintf(
+				 stdout,
+				 "scca_generate_prefetch_hash_table %s\n",
+				 LIBSCCA_VERSION_STRING );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( ( optind + 2 ) > argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source or target file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_number_of_volumes != NULL )
+	{
+		result = scca_generate_prefetch_hash_table_determine_number_of_volumes(
+		          option_number_of_volumes,
+		          &number_of_volumes,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of volumes.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of volumes defaulting to: %d.\n",
+			 SCCA_GENERATE_PREFETCH_HASH_TABLE_DEFAULT_NUMBER_OF_VOLUMES );
+
+			number_of_volumes = SCCA_GENERATE_PREFETCH_HASH_TABLE_DEFAULT_NUMBER_OF_VOLUMES;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	source_stream = file_stream_open_wide(
+	                 argv[ optind ],
+	                 _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	source_stream = file_stream_open(
+	                 argv[ optind ],
+	                 FILE_STREAM_OPEN_READ );
+#endif
+	if( source_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( scca_generate_prefetch_hash_table_read_paths(
+	     source_stream,
+	     &paths,
+	     &number_of_paths,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read paths.\n" );
+
+		goto on_error;
+	}
+	file_stream_close(
+	 source_stream );
+
+	source_stream = NULL;
+
+	if( number_of_paths == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing paths in source file.\n" );
+
+		goto on_error;
+	}
+	if( (uint64_t) number_of_paths * number_of_volumes * SCCA_GENERATE_PREFETCH_HASH_TABLE_NUMBER_OF_HASH_TYPES > (uint64_t) INT32_MAX )
+	{
+		fprintf(
+		 stderr,
+		 "Number of entries exceeds maximum.\n" );
+
+		goto on_error;
+	}
+	number_of_entries = number_of_paths * (int) number_of_volumes * SCCA_GENERATE_PREFETCH_HASH_TABLE_NUMBER_OF_HASH_TYPES;
+
+	entries = (scca_generate_prefetch_hash_table_entry_t *) memory_allocate(
+	                                                         sizeof( scca_generate_prefetch_hash_table_entry_t ) * number_of_entries );
+
+	if( entries == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create entries.\n" );
+
+		goto on_error;
+	}
+	if( scca_generate_prefetch_hash_table_compute_entries(
+	     paths,
+	     number_of_paths,
+	     number_of_volumes,
+	     entries,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compute entries.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	target_stream = file_stream_open_wide(
+	                 argv[ optind + 1 ],
+	                 _SYSTEM_STRING( FILE_STREAM_OPEN_WRITE ) );
+#else
+	target_stream = file_stream_open(
+	                 argv[ optind + 1 ],
+	                 FILE_STREAM_OPEN_WRITE );
+#endif
+	if( target_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open target file: %" PRIs_SYSTEM ".\n",
+		 argv[ optind + 1 ] );
+
+		goto on_error;
+	}
+	if( scca_generate_prefetch_hash_table_write(
+	     target_stream,
+	     paths,
+	     number_of_paths,
+	     number_of_volumes,
+	     entries,
+	     number_of_entries,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write prefetch hash table.\n" );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     target_stream ) != 0 )
+	{
+		target_stream = NULL;
+
+		fprintf(
+		 stderr,
+		 "Unable to close target file.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 entries );
+
+	scca_generate_prefetch_hash_table_free_paths(
+	 paths,
+	 number_of_paths );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( target_stream != NULL )
+	{
+		file_stream_close(
+		 target_stream );
+	}
+	if( source_stream != NULL )
+	{
+		file_stream_close(
+		 source_stream );
+	}
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	if( paths != NULL )
+	{
+		scca_generate_prefetch_hash_table_free_paths(
+		 paths,
+		 number_of_paths );
+	}
+	return( EXIT_FAILURE );
+}
+
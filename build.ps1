@@ -1,11 +1,12 @@
 # Script that builds libscca
 #
-# Version: 20200130
+# Version: 20201014
 
 Param (
 	[string]$Configuration = ${Env:Configuration},
 	[string]$Platform = ${Env:Platform},
 	[string]$PlatformToolset = "",
+	[string]$ProfileGuidedOptimization = "",
 	[string]$PythonPath = "C:\Python37",
 	[string]$VisualStudioVersion = "",
 	[string]$VSToolsOptions = "--extend-with-x64",
@@ -174,6 +175,40 @@ If (${PlatformToolset})
 {
 	$MSBuildOptions = "${MSBuildOptions} /property:PlatformToolset=${PlatformToolset}"
 }
+# Profile guided optimization is done in 2 builds, the Instrument build is
+# followed by running bench\pgo_train.ps1 and the Optimize build.
+If (${ProfileGuidedOptimization})
+{
+	If ((${ProfileGuidedOptimization} -ne "Instrument") -And (${ProfileGuidedOptimization} -ne "Optimize"))
+	{
+		Write-Host "Unsupported profile guided optimization: ${ProfileGuidedOptimization}" -foreground Red
+
+		Exit ${ExitFailure}
+	}
+	If (${VisualStudioVersion} -eq "2008")
+	{
+		Write-Host "Profile guided optimization requires Visual Studio 2010 or later" -foreground Red
+
+		Exit ${ExitFailure}
+	}
+	If (${Configuration} -ne "Release")
+	{
+		Write-Host "Profile guided optimization requires the Release configuration" -foreground Red
+
+		Exit ${ExitFailure}
+	}
+	# The binaries are rebuilt since the link time code generation differs per build.
+	$MSBuildOptions = ${MSBuildOptions}.Replace("/target:Build", "/target:Rebuild")
+
+	If (${ProfileGuidedOptimization} -eq "Instrument")
+	{
+		$MSBuildOptions = "${MSBuildOptions} /property:WholeProgramOptimization=PGInstrument"
+	}
+	Else
+	{
+		$MSBuildOptions = "${MSBuildOptions} /property:WholeProgramOptimization=PGOptimize"
+	}
+}
 If (${Env:APPVEYOR} -eq "True")
 {
 	Invoke-Expression -Command "& '${MSBuild}' ${MSBuildOptions} ${VSSolutionFile} /logger:'C:\Program Files\AppVeyor\BuildAgent\Appveyor.MSBuildLogger.dll'";
@@ -72,6 +72,10 @@
 #define HAVE_DEBUG_OUTPUT		1
  */
 
+/* Enable the ETW static tracepoints
+#define HAVE_STATIC_TRACEPOINTS		1
+ */
+
 /* Enable both the narrow and wide character functions
  */
 #if !defined( HAVE_WIDE_CHARACTER_TYPE )
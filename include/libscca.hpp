@@ -0,0 +1,922 @@
+/*
+ * C++ binding of the library to access the Windows Prefetch File (PF) format
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* The binding requires C++20 and is header-only
+ *
+ * Errors are reported by return value, where the last error of a file can be retrieved
+ * with libscca::file::last_error(). Define LIBSCCA_CPP_EXCEPTIONS before including
+ * this header to throw libscca::exception instead.
+ *
+ * libscca::async_open adapts the incremental parser to C++20 coroutines, for example
+ * to open files fetched over the network without blocking on reads.
+ *
+ * The views returned by the binding reference the data stored in the file,
+ * no memory is allocated and they remain valid until the file is closed or updated.
+ * The UTF-16 string views are not transcoded hence the binding requires a little-endian host.
+ */
+
+#if !defined( _LIBSCCA_HPP )
+#define _LIBSCCA_HPP
+
+#include <libscca.h>
+
+#include <bit>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#if defined( LIBSCCA_CPP_EXCEPTIONS )
+#include <stdexcept>
+#endif
+
+namespace libscca
+{
+
+static_assert(
+ std::endian::native == std::endian::little,
+ "libscca.hpp requires a little-endian host" );
+
+/* Move-only owner of a libscca_error_t
+ */
+class error
+{
+	public:
+		error( void ) noexcept = default;
+
+		explicit error( libscca_error_t *error ) noexcept
+		 : error_( error )
+		{
+		}
+
+		error( error &&other ) noexcept
+		 : error_( std::exchange( other.error_, nullptr ) )
+		{
+		}
+
+		error &operator=( error &&other ) noexcept
+		{
+			if( this != &other )
+			{
+				reset( std::exchange( other.error_, nullptr ) );
+			}
+			return( *this );
+		}
+
+		error( const error & ) = delete;
+		error &operator=( const error & ) = delete;
+
+		~error( void )
+		{
+			reset( nullptr );
+		}
+
+		explicit operator bool( void ) const noexcept
+		{
+			return( error_ != nullptr );
+		}
+
+		libscca_error_t *get( void ) const noexcept
+		{
+			return( error_ );
+		}
+
+		/* Replaces the error, the previous error is freed
+		 */
+		void reset( libscca_error_t *error ) noexcept
+		{
+			if( error_ != nullptr )
+			{
+				libscca_error_free(
+				 &error_ );
+			}
+			error_ = error;
+		}
+
+		/* Prints a descriptive string of the error to the string
+		 * Returns the number of printed characters if successful or -1 on error
+		 */
+		int sprint( char *string, std::size_t size ) const noexcept
+		{
+			if( error_ == nullptr )
+			{
+				return( -1 );
+			}
+			return( libscca_error_sprint(
+			         error_,
+			         string,
+			         size ) );
+		}
+
+	private:
+		libscca_error_t *error_ = nullptr;
+};
+
+#if defined( LIBSCCA_CPP_EXCEPTIONS )
+
+/* Exception thrown when a libscca function fails
+ */
+class exception : public std::runtime_error
+{
+	public:
+		explicit exception( libscca::error &&error )
+		 : std::runtime_error( describe( error ) )
+		{
+		}
+
+	private:
+		static const char *describe( const libscca::error &error ) noexcept
+		{
+			thread_local char message[ 512 ];
+
+			if( error.sprint( message, sizeof( message ) ) <= 0 )
+			{
+				return( "libscca: unknown error" );
+			}
+			return( message );
+		}
+};
+
+#endif /* defined( LIBSCCA_CPP_EXCEPTIONS ) */
+
+/* The values of a file metrics entry
+ */
+struct file_metrics_entry
+{
+	std::uint32_t start_time;
+	std::uint32_t duration;
+	std::uint32_t flags;
+
+	/* The file reference, which is 0 if not set
+	 */
+	std::uint64_t file_reference;
+
+	/* The filename index, which is -1 if not available
+	 */
+	int filename_index;
+};
+
+/* The file metrics values as columns, where every column contains size() values
+ * except file_references, which is empty if the format version does not store file references
+ */
+struct file_metrics_columns
+{
+	std::span<const std::uint32_t> start_times;
+	std::span<const std::uint32_t> durations;
+	std::span<const std::uint32_t> flags;
+	std::span<const std::uint64_t> file_references;
+	std::span<const int> filename_indexes;
+
+	std::size_t size( void ) const noexcept
+	{
+		return( start_times.size() );
+	}
+};
+
+namespace detail
+{
+
+/* Converts an UTF-16 little-endian stream into a string view without the end-of-string characters
+ */
+inline std::u16string_view make_utf16_view(
+                            const std::uint8_t *utf16_stream,
+                            std::size_t utf16_stream_size ) noexcept
+{
+	if( utf16_stream == nullptr )
+	{
+		return( std::u16string_view() );
+	}
+	std::u16string_view view(
+	 reinterpret_cast<const char16_t *>( utf16_stream ),
+	 utf16_stream_size / 2 );
+
+	while( !view.empty()
+	    && ( view.back() == 0 ) )
+	{
+		view.remove_suffix( 1 );
+	}
+	return( view );
+}
+
+/* Iterator over the elements of a range by index
+ * The range must provide value_type operator[]( int ) const
+ */
+template<typename Range>
+class index_iterator
+{
+	public:
+		using value_type        = typename Range::value_type;
+		using reference         = value_type;
+		using difference_type   = std::ptrdiff_t;
+		using iterator_concept  = std::forward_iterator_tag;
+		using iterator_category = std::input_iterator_tag;
+
+		index_iterator( void ) noexcept = default;
+
+		index_iterator( const Range *range, int index ) noexcept
+		 : range_( range ), index_( index )
+		{
+		}
+
+		value_type operator*( void ) const
+		{
+			return( ( *range_ )[ index_ ] );
+		}
+
+		index_iterator &operator++( void ) noexcept
+		{
+			index_++;
+
+			return( *this );
+		}
+
+		index_iterator operator++( int ) noexcept
+		{
+			index_iterator iterator = *this;
+
+			index_++;
+
+			return( iterator );
+		}
+
+		bool operator==( const index_iterator &other ) const noexcept
+		{
+			return( index_ == other.index_ );
+		}
+
+	private:
+		const Range *range_ = nullptr;
+		int index_          = 0;
+};
+
+} /* namespace detail */
+
+class file;
+
+/* Non-owning view of a volume information stored in a file
+ */
+class volume
+{
+	public:
+		volume( void ) noexcept = default;
+
+		volume( const file *file, libscca_volume_information_t *volume_information ) noexcept
+		 : file_( file ), volume_information_( volume_information )
+		{
+		}
+
+		libscca_volume_information_t *get( void ) const noexcept
+		{
+			return( volume_information_ );
+		}
+
+		bool serial_number( std::uint32_t &serial_number ) const;
+
+		bool creation_time( std::uint64_t &filetime ) const;
+
+		std::u16string_view device_path( void ) const;
+
+		int number_of_directory_strings( void ) const;
+
+		std::u16string_view directory_string( int directory_string_index ) const;
+
+	private:
+		const file *file_                                = nullptr;
+		libscca_volume_information_t *volume_information_ = nullptr;
+};
+
+/* Range of the file metrics entries of a file
+ */
+class file_metrics_range
+{
+	public:
+		using value_type = file_metrics_entry;
+		using iterator   = detail::index_iterator<file_metrics_range>;
+
+		file_metrics_range( void ) noexcept = default;
+
+		explicit file_metrics_range( const file_metrics_columns &columns ) noexcept
+		 : columns_( columns )
+		{
+		}
+
+		value_type operator[]( int entry_index ) const noexcept
+		{
+			std::size_t index = static_cast<std::size_t>( entry_index );
+
+			return( file_metrics_entry {
+			         columns_.start_times[ index ],
+			         columns_.durations[ index ],
+			         columns_.flags[ index ],
+			         columns_.file_references.empty() ? 0 : columns_.file_references[ index ],
+			         columns_.filename_indexes[ index ] } );
+		}
+
+		iterator begin( void ) const noexcept
+		{
+			return( iterator( this, 0 ) );
+		}
+
+		iterator end( void ) const noexcept
+		{
+			return( iterator( this, static_cast<int>( columns_.size() ) ) );
+		}
+
+		std::size_t size( void ) const noexcept
+		{
+			return( columns_.size() );
+		}
+
+	private:
+		file_metrics_columns columns_ {};
+};
+
+/* Range of the filenames of a file
+ */
+class filename_range
+{
+	public:
+		using value_type = std::u16string_view;
+		using iterator   = detail::index_iterator<filename_range>;
+
+		filename_range( void ) noexcept = default;
+
+		filename_range( const file *file, int number_of_filenames ) noexcept
+		 : file_( file ), number_of_filenames_( number_of_filenames )
+		{
+		}
+
+		value_type operator[]( int filename_index ) const;
+
+		iterator begin( void ) const noexcept
+		{
+			return( iterator( this, 0 ) );
+		}
+
+		iterator end( void ) const noexcept
+		{
+			return( iterator( this, number_of_filenames_ ) );
+		}
+
+		std::size_t size( void ) const noexcept
+		{
+			return( static_cast<std::size_t>( number_of_filenames_ ) );
+		}
+
+	private:
+		const file *file_        = nullptr;
+		int number_of_filenames_ = 0;
+};
+
+/* Range of the volumes of a file
+ */
+class volume_range
+{
+	public:
+		using value_type = volume;
+		using iterator   = detail::index_iterator<volume_range>;
+
+		volume_range( void ) noexcept = default;
+
+		volume_range( const file *file, int number_of_volumes ) noexcept
+		 : file_( file ), number_of_volumes_( number_of_volumes )
+		{
+		}
+
+		value_type operator[]( int volume_index ) const;
+
+		iterator begin( void ) const noexcept
+		{
+			return( iterator( this, 0 ) );
+		}
+
+		iterator end( void ) const noexcept
+		{
+			return( iterator( this, number_of_volumes_ ) );
+		}
+
+		std::size_t size( void ) const noexcept
+		{
+			return( static_cast<std::size_t>( number_of_volumes_ ) );
+		}
+
+	private:
+		const file *file_      = nullptr;
+		int number_of_volumes_ = 0;
+};
+
+/* Move-only owner of a libscca_file_t
+ * Without LIBSCCA_CPP_EXCEPTIONS functions return false, an empty view or an empty range on error
+ */
+class file
+{
+	public:
+		file( void ) = default;
+
+		file( file &&other ) noexcept
+		 : file_( std::exchange( other.file_, nullptr ) ),
+		   last_error_( std::move( other.last_error_ ) ),
+		   is_open_( std::exchange( other.is_open_, false ) )
+		{
+		}
+
+		file &operator=( file &&other ) noexcept
+		{
+			if( this != &other )
+			{
+				release();
+
+				file_       = std::exchange( other.file_, nullptr );
+				last_error_ = std::move( other.last_error_ );
+				is_open_    = std::exchange( other.is_open_, false );
+			}
+			return( *this );
+		}
+
+		file( const file & ) = delete;
+		file &operator=( const file & ) = delete;
+
+		~file( void )
+		{
+			release();
+		}
+
+		libscca_file_t *get( void ) const noexcept
+		{
+			return( file_ );
+		}
+
+		/* Retrieves the last error, which is only set without LIBSCCA_CPP_EXCEPTIONS
+		 */
+		const libscca::error &last_error( void ) const noexcept
+		{
+			return( last_error_ );
+		}
+
+		bool open( const char *filename, int access_flags = LIBSCCA_OPEN_READ )
+		{
+			libscca_error_t *error = nullptr;
+
+			if( !close()
+			 || !initialize_handle() )
+			{
+				return( false );
+			}
+			if( !check( libscca_file_open( file_, filename, access_flags, &error ), error ) )
+			{
+				return( false );
+			}
+			is_open_ = true;
+
+			return( true );
+		}
+
+		bool close( void )
+		{
+			libscca_error_t *error = nullptr;
+
+			if( !is_open_ )
+			{
+				return( true );
+			}
+			is_open_ = false;
+
+			return( check( libscca_file_close( file_, &error ) == 0 ? 1 : -1, error ) );
+		}
+
+		bool is_open( void ) const noexcept
+		{
+			return( is_open_ );
+		}
+
+		bool format_version( std::uint32_t &format_version ) const
+		{
+			libscca_error_t *error = nullptr;
+
+			return( check( libscca_file_get_format_version( file_, &format_version, &error ), error ) );
+		}
+
+		bool run_count( std::uint32_t &run_count ) const
+		{
+			libscca_error_t *error = nullptr;
+
+			return( check( libscca_file_get_run_count( file_, &run_count, &error ), error ) );
+		}
+
+		/* Retrieves the file metrics values as columns
+		 */
+		file_metrics_columns file_metrics_values( void ) const
+		{
+			const std::uint32_t *start_times     = nullptr;
+			const std::uint32_t *durations       = nullptr;
+			const std::uint32_t *flags           = nullptr;
+			const std::uint64_t *file_references = nullptr;
+			const int *filename_indexes          = nullptr;
+			libscca_error_t *error               = nullptr;
+			int number_of_entries                = 0;
+
+			if( !check( libscca_file_get_file_metrics_columns( file_, &start_times, &durations, &flags, &file_references, &filename_indexes, &number_of_entries, &error ), error ) )
+			{
+				return( file_metrics_columns {} );
+			}
+			std::size_t size = static_cast<std::size_t>( number_of_entries );
+
+			return( file_metrics_columns {
+			         std::span<const std::uint32_t>( start_times, size ),
+			         std::span<const std::uint32_t>( durations, size ),
+			         std::span<const std::uint32_t>( flags, size ),
+			         std::span<const std::uint64_t>( file_references, file_references != nullptr ? size : 0 ),
+			         std::span<const int>( filename_indexes, size ) } );
+		}
+
+		file_metrics_range file_metrics( void ) const
+		{
+			return( file_metrics_range( file_metrics_values() ) );
+		}
+
+		std::u16string_view filename( int filename_index ) const
+		{
+			const std::uint8_t *utf16_stream = nullptr;
+			libscca_error_t *error           = nullptr;
+			std::size_t utf16_stream_size    = 0;
+
+			if( !check( libscca_file_get_utf16_filename_stream( file_, filename_index, &utf16_stream, &utf16_stream_size, &error ), error ) )
+			{
+				return( std::u16string_view() );
+			}
+			return( detail::make_utf16_view( utf16_stream, utf16_stream_size ) );
+		}
+
+		filename_range filenames( void ) const
+		{
+			libscca_error_t *error  = nullptr;
+			int number_of_filenames = 0;
+
+			if( !check( libscca_file_get_number_of_filenames( file_, &number_of_filenames, &error ), error ) )
+			{
+				return( filename_range() );
+			}
+			return( filename_range( this, number_of_filenames ) );
+		}
+
+		libscca::volume volume( int volume_index ) const
+		{
+			libscca_volume_information_t *volume_information = nullptr;
+			libscca_error_t *error                           = nullptr;
+
+			if( !check( libscca_file_get_volume_information( file_, volume_index, &volume_information, &error ), error ) )
+			{
+				return( libscca::volume() );
+			}
+			return( libscca::volume( this, volume_information ) );
+		}
+
+		volume_range volumes( void ) const
+		{
+			libscca_error_t *error = nullptr;
+			int number_of_volumes  = 0;
+
+			if( !check( libscca_file_get_number_of_volumes( file_, &number_of_volumes, &error ), error ) )
+			{
+				return( volume_range() );
+			}
+			return( volume_range( this, number_of_volumes ) );
+		}
+
+		/* Handles the result of a libscca function, where error is freed
+		 * Returns true if result is 1
+		 */
+		bool check( int result, libscca_error_t *error ) const
+		{
+			if( result != -1 )
+			{
+				return( result == 1 );
+			}
+#if defined( LIBSCCA_CPP_EXCEPTIONS )
+			throw exception( libscca::error( error ) );
+#else
+			last_error_.reset( error );
+
+			return( false );
+#endif
+		}
+
+	private:
+		friend class parser;
+
+		/* Creates the libscca_file_t if not already created
+		 */
+		bool initialize_handle( void )
+		{
+			libscca_error_t *error = nullptr;
+
+			if( file_ != nullptr )
+			{
+				return( true );
+			}
+			return( check( libscca_file_initialize( &file_, &error ), error ) );
+		}
+
+		void release( void ) noexcept
+		{
+			if( file_ != nullptr )
+			{
+				if( is_open_ )
+				{
+					libscca_file_close( file_, nullptr );
+				}
+				libscca_file_free( &file_, nullptr );
+			}
+			is_open_ = false;
+		}
+
+		libscca_file_t *file_ = nullptr;
+
+		mutable libscca::error last_error_;
+
+		bool is_open_ = false;
+};
+
+inline bool volume::serial_number( std::uint32_t &serial_number ) const
+{
+	libscca_error_t *error = nullptr;
+
+	return( file_->check( libscca_volume_information_get_serial_number( volume_information_, &serial_number, &error ), error ) );
+}
+
+inline bool volume::creation_time( std::uint64_t &filetime ) const
+{
+	libscca_error_t *error = nullptr;
+
+	return( file_->check( libscca_volume_information_get_creation_time( volume_information_, &filetime, &error ), error ) );
+}
+
+inline std::u16string_view volume::device_path( void ) const
+{
+	const std::uint8_t *utf16_stream = nullptr;
+	libscca_error_t *error           = nullptr;
+	std::size_t utf16_stream_size    = 0;
+
+	if( !file_->check( libscca_volume_information_get_utf16_device_path_stream( volume_information_, &utf16_stream, &utf16_stream_size, &error ), error ) )
+	{
+		return( std::u16string_view() );
+	}
+	return( detail::make_utf16_view( utf16_stream, utf16_stream_size ) );
+}
+
+inline int volume::number_of_directory_strings( void ) const
+{
+	libscca_error_t *error          = nullptr;
+	int number_of_directory_strings = 0;
+
+	if( !file_->check( libscca_volume_information_get_number_of_directory_strings( volume_information_, &number_of_directory_strings, &error ), error ) )
+	{
+		return( 0 );
+	}
+	return( number_of_directory_strings );
+}
+
+inline std::u16string_view volume::directory_string( int directory_string_index ) const
+{
+	const std::uint8_t *utf16_stream = nullptr;
+	libscca_error_t *error           = nullptr;
+	std::size_t utf16_stream_size    = 0;
+
+	if( !file_->check( libscca_volume_information_get_utf16_directory_string_stream( volume_information_, directory_string_index, &utf16_stream, &utf16_stream_size, &error ), error ) )
+	{
+		return( std::u16string_view() );
+	}
+	return( detail::make_utf16_view( utf16_stream, utf16_stream_size ) );
+}
+
+inline filename_range::value_type filename_range::operator[]( int filename_index ) const
+{
+	return( file_->filename( filename_index ) );
+}
+
+inline volume_range::value_type volume_range::operator[]( int volume_index ) const
+{
+	return( file_->volume( volume_index ) );
+}
+
+/* Move-only owner of a libscca_parser_t that opens a file from data that is fed
+ * The parser does not read the data itself hence it never blocks on I/O
+ */
+class parser
+{
+	public:
+		parser( void ) noexcept = default;
+
+		parser( parser &&other ) noexcept
+		 : file_( std::exchange( other.file_, nullptr ) ),
+		   parser_( std::exchange( other.parser_, nullptr ) )
+		{
+		}
+
+		parser &operator=( parser &&other ) noexcept
+		{
+			if( this != &other )
+			{
+				release();
+
+				file_   = std::exchange( other.file_, nullptr );
+				parser_ = std::exchange( other.parser_, nullptr );
+			}
+			return( *this );
+		}
+
+		parser( const parser & ) = delete;
+		parser &operator=( const parser & ) = delete;
+
+		~parser( void )
+		{
+			release();
+		}
+
+		libscca_parser_t *get( void ) const noexcept
+		{
+			return( parser_ );
+		}
+
+		/* Starts parsing into the file, which is closed first and must outlive the parser
+		 * Errors are reported through the file
+		 */
+		bool initialize( libscca::file &file, int access_flags = LIBSCCA_OPEN_READ )
+		{
+			libscca_error_t *error = nullptr;
+
+			release();
+
+			if( !file.close()
+			 || !file.initialize_handle() )
+			{
+				return( false );
+			}
+			file_ = &file;
+
+			return( file_->check( libscca_parser_initialize( &parser_, file_->get(), access_flags, &error ), error ) );
+		}
+
+		/* Sets the size of all the data, if known
+		 */
+		bool set_data_size( std::uint64_t data_size )
+		{
+			libscca_error_t *error = nullptr;
+
+			return( file_->check( libscca_parser_set_data_size( parser_, data_size, &error ), error ) );
+		}
+
+		/* Retrieves the offset and size of the data that is required next
+		 * Returns true if data is required
+		 */
+		bool required_data( std::uint64_t &offset, std::uint64_t &size )
+		{
+			libscca_error_t *error = nullptr;
+			off64_t data_offset    = 0;
+			size64_t data_size     = 0;
+
+			if( !file_->check( libscca_parser_get_required_data( parser_, &data_offset, &data_size, &error ), error ) )
+			{
+				return( false );
+			}
+			offset = static_cast<std::uint64_t>( data_offset );
+			size   = data_size;
+
+			return( true );
+		}
+
+		/* Feeds the next part of the data, where empty data signals the end of the data
+		 * Returns true if successful, where the file is open once the state is complete
+		 */
+		bool feed( std::span<const std::uint8_t> data )
+		{
+			libscca_error_t *error = nullptr;
+
+			if( !file_->check( libscca_parser_feed( parser_, data.data(), data.size(), &error ) == -1 ? -1 : 1, error ) )
+			{
+				return( false );
+			}
+			if( is_complete() )
+			{
+				file_->is_open_ = true;
+			}
+			return( true );
+		}
+
+		bool is_complete( void ) const noexcept
+		{
+			int state = 0;
+
+			if( libscca_parser_get_state( parser_, &state, nullptr ) != 1 )
+			{
+				return( false );
+			}
+			return( state == LIBSCCA_PARSER_STATE_COMPLETE );
+		}
+
+	private:
+		void release( void ) noexcept
+		{
+			if( parser_ != nullptr )
+			{
+				libscca_parser_free( &parser_, nullptr );
+			}
+			file_ = nullptr;
+		}
+
+		libscca::file *file_       = nullptr;
+		libscca_parser_t *parser_ = nullptr;
+};
+
+/* Opens a file asynchronously from data that is read by a coroutine
+ *
+ * Task is the coroutine type of the caller that returns a bool, for example asio::awaitable<bool>
+ * read is called as read( offset, buffer ) and must return an awaitable of the number of bytes
+ * read into the buffer, where 0 signals the end of the data
+ * The buffer is used for every read, hence the memory of a parse in progress is the buffer
+ * and the data retained by the parser
+ * data_size is the size of all the data or 0 if not known
+ *
+ * Usage:
+ *   bool result = co_await libscca::async_open<asio::awaitable<bool>>(
+ *                  file,
+ *                  [&]( std::uint64_t offset, std::span<std::uint8_t> buffer ) -> asio::awaitable<std::size_t> { ... },
+ *                  buffer );
+ */
+template<typename Task, typename ReadFunction>
+Task async_open(
+      libscca::file &file,
+      ReadFunction read,
+      std::span<std::uint8_t> buffer,
+      std::uint64_t data_size = 0,
+      int access_flags = LIBSCCA_OPEN_READ )
+{
+	libscca::parser parser;
+
+	std::uint64_t required_offset = 0;
+	std::uint64_t required_size   = 0;
+
+	if( buffer.empty()
+	 || !parser.initialize( file, access_flags ) )
+	{
+		co_return( false );
+	}
+	if( ( data_size != 0 )
+	 && !parser.set_data_size( data_size ) )
+	{
+		co_return( false );
+	}
+	while( !parser.is_complete() )
+	{
+		if( !parser.required_data( required_offset, required_size ) )
+		{
+			co_return( false );
+		}
+		std::size_t read_size = buffer.size();
+
+		if( ( required_size != 0 )
+		 && ( required_size < read_size ) )
+		{
+			read_size = static_cast<std::size_t>( required_size );
+		}
+		std::size_t read_count = co_await read(
+		                                   required_offset,
+		                                   buffer.first( read_size ) );
+
+		if( read_count > read_size )
+		{
+			co_return( false );
+		}
+		if( !parser.feed( buffer.first( read_count ) ) )
+		{
+			co_return( false );
+		}
+	}
+	co_return( true );
+}
+
+} /* namespace libscca */
+
+#endif /* !defined( _LIBSCCA_HPP ) */
+
@@ -284,7 +284,15 @@ enum LIBSCCA_RUNTIME_ERROR
 
 	/* An abort was requested
 	 */
-	LIBSCCA_RUNTIME_ERROR_ABORT_REQUESTED		= 15
+	LIBSCCA_RUNTIME_ERROR_ABORT_REQUESTED		= 15,
+
+	/* The parse budget was exceeded, which is specific to libscca
+	 */
+	LIBSCCA_RUNTIME_ERROR_BUDGET_EXCEEDED		= 16,
+
+	/* The parse deadline was exceeded, which is specific to libscca
+	 */
+	LIBSCCA_RUNTIME_ERROR_DEADLINE_EXCEEDED		= 17
 };
 
 #endif /* !defined( _LIBSCCA_ERROR_H ) */
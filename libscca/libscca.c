@@ -25,6 +25,7 @@
 #include <windows.h>
 #endif
 
+#include "libscca_tracepoint.h"
 #include "libscca_unused.h"
 
 /* Define HAVE_LOCAL_LIBSCCA for local use of libscca
@@ -60,6 +61,9 @@ BOOL WINAPI DllMain(
 			break;
 
 		case DLL_PROCESS_DETACH:
+#if defined( LIBSCCA_TRACEPOINT_HAVE_ETW )
+			libscca_tracepoint_unregister_provider();
+#endif
 			break;
 	}
 	return( TRUE );
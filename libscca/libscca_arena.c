@@ -0,0 +1,323 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_arena.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+
+/* The size of the arena block header rounded up to the alignment
+ */
+#define libscca_arena_block_header_size \
+	( ( sizeof( libscca_arena_block_t ) + ( LIBSCCA_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBSCCA_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * The block size is the minimum size of the blocks the allocations are made from
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_arena_initialize(
+     libscca_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - libscca_arena_block_header_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libscca_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libscca_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * This releases all the allocations made from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_arena_free(
+     libscca_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libscca_arena_block_t *block      = NULL;
+	libscca_arena_block_t *next_block = NULL;
+	static char *function             = "libscca_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		block = ( *arena )->first_block;
+
+		while( block != NULL )
+		{
+			next_block = block->next_block;
+
+			memory_free(
+			 block );
+
+			block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears an arena
+ * This releases all the allocations made from the arena in one step,
+ * the blocks are retained so that they can be reused by later allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_arena_clear(
+     libscca_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libscca_arena_block_t *block = NULL;
+	static char *function        = "libscca_arena_clear";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	for( block = arena->first_block;
+	     block != NULL;
+	     block = block->next_block )
+	{
+		block->data_offset = 0;
+	}
+	arena->current_block              = arena->first_block;
+	arena->number_of_allocated_blocks = 0;
+
+	return( 1 );
+}
+
+/* Allocates data from an arena
+ * The data is aligned to LIBSCCA_ARENA_ALIGNMENT and remains valid
+ * until the arena is cleared or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_arena_allocate(
+     libscca_arena_t *arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libscca_arena_block_t *block = NULL;
+	static char *function        = "libscca_arena_allocate";
+	size_t aligned_size          = 0;
+	size_t block_data_size       = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - libscca_arena_block_header_size - LIBSCCA_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + ( LIBSCCA_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBSCCA_ARENA_ALIGNMENT - 1 );
+
+	/* Continue in the current block or in one of the blocks retained by clear
+	 * that has sufficient space left
+	 */
+	block = arena->current_block;
+
+	while( block != NULL )
+	{
+		if( aligned_size <= ( block->data_size - block->data_offset ) )
+		{
+			break;
+		}
+		block = block->next_block;
+	}
+	if( block == NULL )
+	{
+		block_data_size = arena->block_size;
+
+		if( block_data_size < aligned_size )
+		{
+			block_data_size = aligned_size;
+		}
+		block = (libscca_arena_block_t *) memory_allocate(
+		                                   libscca_arena_block_header_size + block_data_size );
+
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block.",
+			 function );
+
+			return( -1 );
+		}
+		block->next_block  = NULL;
+		block->data        = &( ( (uint8_t *) block )[ libscca_arena_block_header_size ] );
+		block->data_size   = block_data_size;
+		block->data_offset = 0;
+
+		arena->number_of_allocated_blocks += 1;
+		arena->allocated_size             += libscca_arena_block_header_size + block_data_size;
+
+		/* Append the block so that the blocks are reused in the order they were created
+		 */
+		if( arena->first_block == NULL )
+		{
+			arena->first_block = block;
+		}
+		else
+		{
+			arena->current_block = arena->first_block;
+
+			while( arena->current_block->next_block != NULL )
+			{
+				arena->current_block = arena->current_block->next_block;
+			}
+			arena->current_block->next_block = block;
+		}
+	}
+	arena->current_block = block;
+
+	*data = &( block->data[ block->data_offset ] );
+
+	block->data_offset += aligned_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,112 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_ARENA_H )
+#define _LIBSCCA_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default arena block size
+ */
+#define LIBSCCA_ARENA_DEFAULT_BLOCK_SIZE	65536
+
+/* The alignment of the arena allocations
+ */
+#define LIBSCCA_ARENA_ALIGNMENT			16
+
+typedef struct libscca_arena_block libscca_arena_block_t;
+
+struct libscca_arena_block
+{
+	/* The next block
+	 */
+	libscca_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+};
+
+typedef struct libscca_arena libscca_arena_t;
+
+struct libscca_arena
+{
+	/* The first block
+	 */
+	libscca_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	libscca_arena_block_t *current_block;
+
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The number of blocks allocated since the arena was last cleared
+	 */
+	int number_of_allocated_blocks;
+
+	/* The size of all the blocks including their headers, the blocks are retained when cleared
+	 */
+	size_t allocated_size;
+};
+
+int libscca_arena_initialize(
+     libscca_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libscca_arena_free(
+     libscca_arena_t **arena,
+     libcerror_error_t **error );
+
+int libscca_arena_clear(
+     libscca_arena_t *arena,
+     libcerror_error_t **error );
+
+int libscca_arena_allocate(
+     libscca_arena_t *arena,
+     size_t size,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_ARENA_H ) */
+
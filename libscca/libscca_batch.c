@@ -0,0 +1,2212 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* The processor affinity functions require _GNU_SOURCE on Linux
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_SCHED_H )
+#include <sched.h>
+#endif
+
+#include "libscca_batch.h"
+#include "libscca_context.h"
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcnotify.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+#include "libscca_run_time_histogram.h"
+
+#if !defined( WINAPI ) && defined( HAVE_SCHED_GETAFFINITY ) && defined( HAVE_SCHED_SETAFFINITY ) && defined( CPU_SET ) && defined( CPU_COUNT )
+#define LIBSCCA_HAVE_SCHED_AFFINITY	1
+#endif
+
+/* Opens and parses a batch of files
+ * The files are distributed over a pool of number_of_threads worker threads,
+ * if multi-threading support is not available the files are processed sequentially
+ * The callback function is called once for every path with the opened file or,
+ * if the file could not be opened, with a NULL file and the error of the open.
+ * The file is closed and freed after the callback function returns
+ * The callback function should return 1 if successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_open_paths(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_threads,
+     int access_flags,
+     int (*callback_function)(
+            int path_index,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_batch_open_paths";
+
+	if( libscca_batch_open_paths_with_flags(
+	     paths,
+	     number_of_paths,
+	     number_of_threads,
+	     access_flags,
+	     0,
+	     callback_function,
+	     callback_arguments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to open batch of paths.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens and parses a batch of files using batch flags
+ * Every worker thread uses its own context, hence the scratch buffers are reused
+ * for the files of a worker and are allocated by the worker itself
+ * If LIBSCCA_BATCH_FLAG_PIN_THREADS is set every worker thread is pinned to a processor,
+ * the worker threads are spread evenly over the processors available to the process.
+ * Since a pinned worker allocates its context and files itself, operating systems
+ * that allocate memory on the node of the first access keep this memory local to the worker
+ * If LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY is set every worker thread processes a contiguous
+ * range of the paths in order, so that paths that are adjacent, such as the files
+ * of the same directory or volume, are processed by the same worker. A worker that finished
+ * its range takes the remaining paths from the end of the largest range of another worker
+ * Otherwise the workers take the next path in order
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_open_paths_with_flags(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_threads,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int path_index,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t batch_context;
+
+	static char *function = "libscca_batch_open_paths_with_flags";
+	int supported_flags   = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBSCCA_BATCH_FLAG_PIN_THREADS
+	                | LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY;
+
+	if( ( batch_flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported batch flags: 0x%08x.",
+		 function,
+		 batch_flags );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &batch_context,
+	     0,
+	     sizeof( libscca_batch_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch context.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context.paths              = paths;
+	batch_context.number_of_items    = number_of_paths;
+	batch_context.access_flags       = access_flags;
+	batch_context.batch_flags        = batch_flags;
+	batch_context.callback_function  = callback_function;
+	batch_context.callback_arguments = callback_arguments;
+
+	if( libscca_batch_run(
+	     &batch_context,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context.number_of_failed_items > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for: %d paths.",
+		 function,
+		 batch_context.number_of_failed_items );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens and parses a batch of files from the file IO handles of a file IO pool
+ * The entries of the pool are distributed over the worker threads in the same way
+ * as the paths of libscca_batch_open_paths_with_flags
+ * The callback function is called once for every entry with the opened file or,
+ * if the file could not be opened, with a NULL file and the error of the open.
+ * A file IO handle that is not open is opened for the file and closed after
+ * the callback function returns, hence it does not use a file descriptor or handle
+ * of the operating system before or after its file is processed
+ * Since a worker processes a single file at a time, the number of worker threads
+ * is reduced to maximum_number_of_open_handles to bound the number of file IO handles
+ * that are open concurrently. A maximum_number_of_open_handles of 0 represents no limit
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_open_file_io_pool(
+     libbfio_pool_t *file_io_pool,
+     int number_of_threads,
+     int maximum_number_of_open_handles,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int entry,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t batch_context;
+
+	static char *function = "libscca_batch_open_file_io_pool";
+	int number_of_handles = 0;
+	int supported_flags   = 0;
+
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_open_handles < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of open handles value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBSCCA_BATCH_FLAG_PIN_THREADS
+	                | LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY;
+
+	if( ( batch_flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported batch flags: 0x%08x.",
+		 function,
+		 batch_flags );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of handles in file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_open_handles > 0 )
+	 && ( number_of_threads > maximum_number_of_open_handles ) )
+	{
+		number_of_threads = maximum_number_of_open_handles;
+	}
+	if( memory_set(
+	     &batch_context,
+	     0,
+	     sizeof( libscca_batch_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch context.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context.file_io_pool       = file_io_pool;
+	batch_context.number_of_items    = number_of_handles;
+	batch_context.access_flags       = access_flags;
+	batch_context.batch_flags        = batch_flags;
+	batch_context.callback_function  = callback_function;
+	batch_context.callback_arguments = callback_arguments;
+
+	if( libscca_batch_run(
+	     &batch_context,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context.number_of_failed_items > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for: %d entries.",
+		 function,
+		 batch_context.number_of_failed_items );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens and parses a batch of files from memory buffers
+ * The buffers are distributed over a pool of number_of_threads worker threads
+ * in the same way as libscca_batch_open_paths_with_flags, if multi-threading
+ * support is not available the buffers are processed sequentially
+ * Every worker thread reuses a single file and context for all of its buffers,
+ * hence the data and scratch buffers are allocated once per worker and not per buffer
+ * The data of the buffers is not copied and must remain available until the function returns
+ * The key metadata of every buffer is stored in the result with the same index.
+ * A buffer that cannot be opened does not cause the function to fail, instead
+ * the result value of its result is -1
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_open_memory_buffers(
+     const uint8_t * const buffers[],
+     const size_t buffer_sizes[],
+     int number_of_buffers,
+     int number_of_threads,
+     int access_flags,
+     int batch_flags,
+     libscca_batch_result_t results[],
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t batch_context;
+
+	static char *function = "libscca_batch_open_memory_buffers";
+	int supported_flags   = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBSCCA_BATCH_FLAG_PIN_THREADS
+	                | LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY;
+
+	if( ( batch_flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported batch flags: 0x%08x.",
+		 function,
+		 batch_flags );
+
+		return( -1 );
+	}
+	if( results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid results.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &batch_context,
+	     0,
+	     sizeof( libscca_batch_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch context.",
+		 function );
+
+		return( -1 );
+	}
+	/* The errors of the buffers are only stored as error domain and code
+	 * in the results, hence there is no need to format the error messages
+	 */
+	batch_context.buffers         = buffers;
+	batch_context.buffer_sizes    = buffer_sizes;
+	batch_context.results         = results;
+	batch_context.number_of_items = number_of_buffers;
+	batch_context.access_flags    = access_flags | LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS;
+	batch_context.batch_flags     = batch_flags;
+
+	if( libscca_batch_run(
+	     &batch_context,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context.number_of_failed_items > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process: %d buffers.",
+		 function,
+		 batch_context.number_of_failed_items );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Aggregates the last run times of a batch of files in a run time histogram
+ * The paths are distributed over the worker threads in the same way as
+ * libscca_batch_open_paths_with_flags. Every worker aggregates the runs of its
+ * files in its own run time histogram, which are merged into the run time histogram
+ * after the workers have finished, hence the workers do not share the histogram
+ * and the individual runs are never stored or sorted
+ * A file that cannot be opened is skipped and not counted as a file of the histogram
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_aggregate_run_times(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_threads,
+     int access_flags,
+     int batch_flags,
+     libscca_run_time_histogram_t *run_time_histogram,
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t batch_context;
+
+	static char *function = "libscca_batch_aggregate_run_times";
+	int supported_flags   = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBSCCA_BATCH_FLAG_PIN_THREADS
+	                | LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY;
+
+	if( ( batch_flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported batch flags: 0x%08x.",
+		 function,
+		 batch_flags );
+
+		return( -1 );
+	}
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &batch_context,
+	     0,
+	     sizeof( libscca_batch_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch context.",
+		 function );
+
+		return( -1 );
+	}
+	/* The errors of the files that cannot be opened are not reported
+	 * hence there is no need to format the error messages
+	 */
+	batch_context.paths              = paths;
+	batch_context.number_of_items    = number_of_paths;
+	batch_context.access_flags       = access_flags | LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS;
+	batch_context.batch_flags        = batch_flags;
+	batch_context.run_time_histogram = run_time_histogram;
+
+	if( libscca_batch_run(
+	     &batch_context,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context.number_of_failed_items > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to aggregate: %d paths.",
+		 function,
+		 batch_context.number_of_failed_items );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Runs the workers of a batch
+ * The items are split over at most number_of_threads workers
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_run(
+     libscca_batch_context_t *batch_context,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libscca_batch_worker_t *worker = NULL;
+	static char *function          = "libscca_batch_run";
+	uint64_t bucket_width          = 0;
+	int worker_index               = 0;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch context - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid batch context - number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context->number_of_workers = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( batch_context->number_of_items > 1 ) )
+	{
+		batch_context->number_of_workers = number_of_threads;
+
+		if( batch_context->number_of_workers > batch_context->number_of_items )
+		{
+			batch_context->number_of_workers = batch_context->number_of_items;
+		}
+	}
+#endif
+	batch_context->workers = (libscca_batch_worker_t *) memory_allocate(
+	                                                     sizeof( libscca_batch_worker_t ) * batch_context->number_of_workers );
+
+	if( batch_context->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     batch_context->workers,
+	     0,
+	     sizeof( libscca_batch_worker_t ) * batch_context->number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The items are split into ranges that differ at most 1 item in size
+	 */
+	for( worker_index = 0;
+	     worker_index < batch_context->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( batch_context->workers[ worker_index ] );
+
+		worker->batch_context   = batch_context;
+		worker->worker_index    = worker_index;
+		worker->next_item_index = (int) ( ( (int64_t) batch_context->number_of_items * worker_index ) / batch_context->number_of_workers );
+		worker->end_item_index  = (int) ( ( (int64_t) batch_context->number_of_items * ( worker_index + 1 ) ) / batch_context->number_of_workers );
+	}
+	/* Every worker aggregates its runs in its own run time histogram
+	 * so that the workers do not need to synchronize on the histogram
+	 */
+	if( batch_context->run_time_histogram != NULL )
+	{
+		if( libscca_run_time_histogram_get_bucket_width(
+		     batch_context->run_time_histogram,
+		     &bucket_width,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bucket width.",
+			 function );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < batch_context->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( batch_context->workers[ worker_index ] );
+
+			if( libscca_run_time_histogram_initialize(
+			     &( worker->run_time_histogram ),
+			     bucket_width,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create run time histogram of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_context->number_of_workers > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( batch_context->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < batch_context->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( batch_context->workers[ worker_index ] );
+
+			if( libcthreads_thread_create(
+			     &( worker->thread ),
+			     NULL,
+			     (int (*)(void *)) &libscca_batch_worker_thread_callback,
+			     (void *) worker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create worker thread: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < batch_context->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( batch_context->workers[ worker_index ] );
+
+			if( libcthreads_thread_join(
+			     &( worker->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( batch_context->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		/* The calling thread is not pinned since that would change its affinity
+		 * after the batch has been processed
+		 */
+		libscca_batch_worker_run(
+		 &( batch_context->workers[ 0 ] ) );
+	}
+	/* The workers have finished hence their run time histograms are merged
+	 * by the calling thread without locking
+	 */
+	for( worker_index = 0;
+	     worker_index < batch_context->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( batch_context->workers[ worker_index ] );
+
+		if( worker->run_time_histogram == NULL )
+		{
+			continue;
+		}
+		if( libscca_run_time_histogram_merge(
+		     batch_context->run_time_histogram,
+		     worker->run_time_histogram,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to merge run time histogram of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libscca_run_time_histogram_free(
+		     &( worker->run_time_histogram ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free run time histogram of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 batch_context->workers );
+
+	batch_context->workers = NULL;
+
+	return( 1 );
+
+on_error:
+	if( batch_context->workers != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The worker threads that were created are joined before the batch context
+		 * they reference goes out of scope
+		 */
+		for( worker_index = 0;
+		     worker_index < batch_context->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( batch_context->workers[ worker_index ] );
+
+			if( worker->thread != NULL )
+			{
+				libcthreads_thread_join(
+				 &( worker->thread ),
+				 NULL );
+			}
+		}
+#endif
+		for( worker_index = 0;
+		     worker_index < batch_context->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( batch_context->workers[ worker_index ] );
+
+			if( worker->run_time_histogram != NULL )
+			{
+				libscca_run_time_histogram_free(
+				 &( worker->run_time_histogram ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 batch_context->workers );
+
+		batch_context->workers = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_context->mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( batch_context->mutex ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the index of the next item a worker should process
+ * Returns 1 if successful, 0 if no more items are available or -1 on error
+ */
+int libscca_batch_get_next_item_index(
+     libscca_batch_context_t *batch_context,
+     libscca_batch_worker_t *worker,
+     int *item_index,
+     libcerror_error_t **error )
+{
+	libscca_batch_worker_t *other_worker = NULL;
+	libscca_batch_worker_t *steal_worker = NULL;
+	static char *function                = "libscca_batch_get_next_item_index";
+	int number_of_remaining_items        = 0;
+	int result                           = 0;
+	int worker_index                     = 0;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_context->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     batch_context->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( ( batch_context->batch_flags & LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY ) == 0 )
+	{
+		if( batch_context->next_item_index < batch_context->number_of_items )
+		{
+			*item_index = batch_context->next_item_index;
+
+			batch_context->next_item_index += 1;
+
+			result = 1;
+		}
+	}
+	else if( worker->next_item_index < worker->end_item_index )
+	{
+		*item_index = worker->next_item_index;
+
+		worker->next_item_index += 1;
+
+		result = 1;
+	}
+	else
+	{
+		/* The item is taken from the end of the range so that the other worker
+		 * can continue with the start of its range in order
+		 */
+		for( worker_index = 0;
+		     worker_index < batch_context->number_of_workers;
+		     worker_index++ )
+		{
+			other_worker = &( batch_context->workers[ worker_index ] );
+
+			if( ( other_worker->end_item_index - other_worker->next_item_index ) > number_of_remaining_items )
+			{
+				number_of_remaining_items = other_worker->end_item_index - other_worker->next_item_index;
+				steal_worker              = other_worker;
+			}
+		}
+		if( steal_worker != NULL )
+		{
+			steal_worker->end_item_index -= 1;
+
+			*item_index = steal_worker->end_item_index;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( batch_context->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     batch_context->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Opens and parses the file of a specific path and passes it to the callback function
+ * The file is created with the context if not NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_process_path(
+     libscca_batch_context_t *batch_context,
+     libscca_context_t *context,
+     int path_index,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *open_error = NULL;
+	libscca_file_t *file          = NULL;
+	static char *function         = "libscca_batch_process_path";
+	int result                    = 0;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( context != NULL )
+	{
+		result = libscca_file_initialize_with_context(
+		          &file,
+		          context,
+		          error );
+	}
+	else
+	{
+		result = libscca_file_initialize(
+		          &file,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open(
+	     file,
+	     batch_context->paths[ path_index ],
+	     batch_context->access_flags,
+	     &open_error ) != 1 )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	result = batch_context->callback_function(
+	          path_index,
+	          file,
+	          open_error,
+	          batch_context->callback_arguments );
+
+	if( open_error != NULL )
+	{
+		libcerror_error_free(
+		 &open_error );
+	}
+	if( file != NULL )
+	{
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_free(
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for path: %d.",
+		 function,
+		 path_index );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens and parses the file of a specific path and aggregates its last run times
+ * The file is created with the context if not NULL
+ * A file that cannot be opened is skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_aggregate_path(
+     libscca_batch_context_t *batch_context,
+     libscca_context_t *context,
+     libscca_run_time_histogram_t *run_time_histogram,
+     int path_index,
+     libcerror_error_t **error )
+{
+	libscca_file_t *file  = NULL;
+	static char *function = "libscca_batch_aggregate_path";
+	int result            = 0;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_index < 0 )
+	 || ( path_index >= batch_context->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( context != NULL )
+	{
+		result = libscca_file_initialize_with_context(
+		          &file,
+		          context,
+		          error );
+	}
+	else
+	{
+		result = libscca_file_initialize(
+		          &file,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_file_open(
+	          file,
+	          batch_context->paths[ path_index ],
+	          batch_context->access_flags,
+	          NULL );
+
+	if( result == 1 )
+	{
+		if( libscca_run_time_histogram_append_file(
+		     run_time_histogram,
+		     file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file of path: %d to run time histogram.",
+			 function,
+			 path_index );
+
+			goto on_error;
+		}
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens and parses the file of a specific file IO pool entry and passes it to the callback function
+ * The file is created with the context if not NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_process_file_io_pool_entry(
+     libscca_batch_context_t *batch_context,
+     libscca_context_t *context,
+     int entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *open_error    = NULL;
+	libscca_file_t *file             = NULL;
+	static char *function            = "libscca_batch_process_file_io_pool_entry";
+	int result                       = 0;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_handle(
+	     batch_context->file_io_pool,
+	     entry,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 entry );
+
+		goto on_error;
+	}
+	if( context != NULL )
+	{
+		result = libscca_file_initialize_with_context(
+		          &file,
+		          context,
+		          error );
+	}
+	else
+	{
+		result = libscca_file_initialize(
+		          &file,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO handle is opened by the file if it is not open
+	 * and is then closed when the file is closed
+	 */
+	if( libscca_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     batch_context->access_flags,
+	     &open_error ) != 1 )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	result = batch_context->callback_function(
+	          entry,
+	          file,
+	          open_error,
+	          batch_context->callback_arguments );
+
+	if( open_error != NULL )
+	{
+		libcerror_error_free(
+		 &open_error );
+	}
+	if( file != NULL )
+	{
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_free(
+		     &file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for entry: %d.",
+		 function,
+		 entry );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens and parses the file of a specific memory buffer and stores its key metadata in the result
+ * The file is reused and closed after the key metadata has been retrieved
+ * A buffer that cannot be opened is not considered an error, instead the result value
+ * of its result is set to -1 and the error domain and code of the open are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_process_buffer(
+     libscca_batch_context_t *batch_context,
+     libscca_file_t *file,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libscca_batch_result_t *batch_result = NULL;
+	static char *function                = "libscca_batch_process_buffer";
+	size_t utf8_string_size              = 0;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( batch_context->buffers == NULL )
+	 || ( batch_context->buffer_sizes == NULL )
+	 || ( batch_context->results == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing buffers, buffer sizes or results.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_index < 0 )
+	 || ( item_index >= batch_context->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	batch_result = &( batch_context->results[ item_index ] );
+
+	if( memory_set(
+	     batch_result,
+	     0,
+	     sizeof( libscca_batch_result_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear result: %d.",
+		 function,
+		 item_index );
+
+		return( -1 );
+	}
+	batch_result->result = -1;
+
+	if( libscca_file_open_memory(
+	     file,
+	     batch_context->buffers[ item_index ],
+	     batch_context->buffer_sizes[ item_index ],
+	     batch_context->access_flags,
+	     NULL ) != 1 )
+	{
+		libscca_file_get_open_error(
+		 file,
+		 &( batch_result->error_domain ),
+		 &( batch_result->error_code ),
+		 NULL );
+
+		return( 1 );
+	}
+	if( libscca_file_get_format_version(
+	     file,
+	     &( batch_result->format_version ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &( batch_result->prefetch_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_run_count(
+	     file,
+	     &( batch_result->run_count ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_last_run_times(
+	     file,
+	     batch_result->last_run_times,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &( batch_result->number_of_last_run_times ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &( batch_result->number_of_file_metrics_entries ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_volumes(
+	     file,
+	     &( batch_result->number_of_volumes ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_utf8_executable_filename_size(
+	     file,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The executable filename in the file header is at most 30 UTF-16 characters
+	 * hence its UTF-8 representation always fits in the result
+	 */
+	if( utf8_string_size > LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 executable filename size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_utf8_executable_filename(
+	     file,
+	     batch_result->utf8_executable_filename,
+	     LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	batch_result->result = 1;
+
+	return( 1 );
+
+on_error:
+	libscca_file_close(
+	 file,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Processes items until no more items are available
+ * The paths are opened with a new file for every path, the memory buffers
+ * are opened with a single file that is reused for all the buffers of the worker
+ * The errors of the items are counted in the batch context
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_worker_run(
+     libscca_batch_worker_t *worker )
+{
+	libcerror_error_t *error               = NULL;
+	libscca_batch_context_t *batch_context = NULL;
+	libscca_context_t *context             = NULL;
+	libscca_file_t *file                   = NULL;
+	int item_index                         = 0;
+	int number_of_errors                   = 0;
+	int result                             = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	batch_context = worker->batch_context;
+
+	if( batch_context == NULL )
+	{
+		return( -1 );
+	}
+	/* The context is created by the worker so that the scratch buffers are allocated
+	 * by the thread that uses them. If the context cannot be created the files are
+	 * created without context
+	 */
+	if( libscca_context_initialize(
+	     &context,
+	     NULL ) != 1 )
+	{
+		context = NULL;
+	}
+	if( batch_context->buffers != NULL )
+	{
+		if( context != NULL )
+		{
+			result = libscca_file_initialize_with_context(
+			          &file,
+			          context,
+			          &error );
+		}
+		else
+		{
+			result = libscca_file_initialize(
+			          &file,
+			          &error );
+		}
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+
+			file = NULL;
+		}
+	}
+	do
+	{
+		result = libscca_batch_get_next_item_index(
+		          batch_context,
+		          worker,
+		          &item_index,
+		          &error );
+
+		if( result == 1 )
+		{
+			if( worker->run_time_histogram != NULL )
+			{
+				result = libscca_batch_aggregate_path(
+				          batch_context,
+				          context,
+				          worker->run_time_histogram,
+				          item_index,
+				          &error );
+			}
+			else if( batch_context->file_io_pool != NULL )
+			{
+				result = libscca_batch_process_file_io_pool_entry(
+				          batch_context,
+				          context,
+				          item_index,
+				          &error );
+			}
+			else if( batch_context->buffers == NULL )
+			{
+				result = libscca_batch_process_path(
+				          batch_context,
+				          context,
+				          item_index,
+				          &error );
+			}
+			else if( file != NULL )
+			{
+				result = libscca_batch_process_buffer(
+				          batch_context,
+				          file,
+				          item_index,
+				          &error );
+			}
+			else
+			{
+				result = -1;
+			}
+			if( result != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				number_of_errors += 1;
+			}
+			/* An item that failed does not stop the worker
+			 */
+			result = 1;
+		}
+		else if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+
+			number_of_errors += 1;
+		}
+	}
+	while( result == 1 );
+
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		libscca_context_free(
+		 &context,
+		 NULL );
+	}
+	if( number_of_errors > 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( batch_context->mutex != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     batch_context->mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+#endif
+		batch_context->number_of_failed_items += number_of_errors;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( batch_context->mutex != NULL )
+		{
+			if( libcthreads_mutex_release(
+			     batch_context->mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+#endif
+	}
+	return( 1 );
+}
+
+/* Pins the calling thread to a processor
+ * The workers are spread evenly over the processors that are available to the process,
+ * on Windows only the processors of the processor group of the process are used
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libscca_batch_pin_thread(
+     int worker_index,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	DWORD_PTR process_affinity_mask = 0;
+	DWORD_PTR system_affinity_mask  = 0;
+	DWORD_PTR thread_affinity_mask  = 0;
+
+#elif defined( LIBSCCA_HAVE_SCHED_AFFINITY )
+	cpu_set_t process_cpu_set;
+	cpu_set_t thread_cpu_set;
+#endif
+
+	static char *function           = "libscca_batch_pin_thread";
+
+#if defined( WINAPI ) || defined( LIBSCCA_HAVE_SCHED_AFFINITY )
+	int cpu_index                   = 0;
+	int number_of_cpus              = 0;
+	int processor_index             = 0;
+#endif
+
+	if( worker_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid worker index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( worker_index >= number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) || defined( LIBSCCA_HAVE_SCHED_AFFINITY )
+#if defined( WINAPI )
+	if( GetProcessAffinityMask(
+	     GetCurrentProcess(),
+	     &process_affinity_mask,
+	     &system_affinity_mask ) == 0 )
+	{
+		return( 0 );
+	}
+	for( processor_index = 0;
+	     processor_index < (int) ( sizeof( DWORD_PTR ) * 8 );
+	     processor_index++ )
+	{
+		if( ( process_affinity_mask & ( (DWORD_PTR) 1 << processor_index ) ) != 0 )
+		{
+			number_of_cpus++;
+		}
+	}
+#elif defined( LIBSCCA_HAVE_SCHED_AFFINITY )
+	if( sched_getaffinity(
+	     0,
+	     sizeof( cpu_set_t ),
+	     &process_cpu_set ) != 0 )
+	{
+		return( 0 );
+	}
+	number_of_cpus = CPU_COUNT(
+	                  &process_cpu_set );
+#endif
+	if( number_of_cpus <= 0 )
+	{
+		return( 0 );
+	}
+	/* Spreading the workers, instead of using the first processors, makes sure
+	 * all the processors packages, and their memory nodes, are used
+	 */
+	cpu_index = (int) ( ( (int64_t) worker_index * number_of_cpus ) / number_of_workers );
+
+#if defined( WINAPI )
+	for( processor_index = 0;
+	     processor_index < (int) ( sizeof( DWORD_PTR ) * 8 );
+	     processor_index++ )
+	{
+		if( ( process_affinity_mask & ( (DWORD_PTR) 1 << processor_index ) ) != 0 )
+		{
+			if( cpu_index == 0 )
+			{
+				break;
+			}
+			cpu_index--;
+		}
+	}
+	thread_affinity_mask = (DWORD_PTR) 1 << processor_index;
+
+	if( SetThreadAffinityMask(
+	     GetCurrentThread(),
+	     thread_affinity_mask ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+#elif defined( LIBSCCA_HAVE_SCHED_AFFINITY )
+	for( processor_index = 0;
+	     processor_index < CPU_SETSIZE;
+	     processor_index++ )
+	{
+		if( CPU_ISSET(
+		     processor_index,
+		     &process_cpu_set ) )
+		{
+			if( cpu_index == 0 )
+			{
+				break;
+			}
+			cpu_index--;
+		}
+	}
+	CPU_ZERO(
+	 &thread_cpu_set );
+
+	CPU_SET(
+	 processor_index,
+	 &thread_cpu_set );
+
+	if( sched_setaffinity(
+	     0,
+	     sizeof( cpu_set_t ),
+	     &thread_cpu_set ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#endif
+#else
+	return( 0 );
+
+#endif /* defined( WINAPI ) || defined( LIBSCCA_HAVE_SCHED_AFFINITY ) */
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Runs a worker on a worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_worker_thread_callback(
+     libscca_batch_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+
+	if( ( worker == NULL )
+	 || ( worker->batch_context == NULL ) )
+	{
+		return( -1 );
+	}
+	/* Processor affinity is an optimization hence a worker that cannot be pinned
+	 * still processes its items
+	 */
+	if( ( worker->batch_context->batch_flags & LIBSCCA_BATCH_FLAG_PIN_THREADS ) != 0 )
+	{
+		if( libscca_batch_pin_thread(
+		     worker->worker_index,
+		     worker->batch_context->number_of_workers,
+		     &error ) == -1 )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	return( libscca_batch_worker_run(
+	         worker ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
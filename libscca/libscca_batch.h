@@ -0,0 +1,272 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_BATCH_H )
+#define _LIBSCCA_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_batch_context libscca_batch_context_t;
+typedef struct libscca_batch_worker libscca_batch_worker_t;
+
+struct libscca_batch_context
+{
+	/* The paths
+	 * This value is only used if the items are paths
+	 */
+	char * const *paths;
+
+	/* The file IO pool
+	 * This value is only used if the items are file IO pool entries
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The memory buffers
+	 * This value is only used if the items are memory buffers
+	 */
+	const uint8_t * const *buffers;
+
+	/* The memory buffer sizes
+	 */
+	const size_t *buffer_sizes;
+
+	/* The results of the memory buffers
+	 */
+	libscca_batch_result_t *results;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The index of the next item that is shared by the workers
+	 * This value is only used if the items are not split by locality
+	 */
+	int next_item_index;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The batch flags
+	 */
+	int batch_flags;
+
+	/* The workers
+	 */
+	libscca_batch_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       int path_index,
+	       libscca_file_t *file,
+	       libcerror_error_t *error,
+	       void *callback_arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_arguments;
+
+	/* The run time histogram the runs are aggregated in
+	 * This value is only used if the run times of the items are aggregated
+	 */
+	libscca_run_time_histogram_t *run_time_histogram;
+
+	/* The number of items that failed
+	 */
+	int number_of_failed_items;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+struct libscca_batch_worker
+{
+	/* The batch context
+	 */
+	libscca_batch_context_t *batch_context;
+
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The index of the next item in the range of the worker
+	 * This value is only used if the items are split by locality
+	 */
+	int next_item_index;
+
+	/* The index of the item after the last item in the range of the worker
+	 * This value is only used if the items are split by locality
+	 */
+	int end_item_index;
+
+	/* The run time histogram the worker aggregates its runs in
+	 * This value is only used if the run times of the items are aggregated
+	 */
+	libscca_run_time_histogram_t *run_time_histogram;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_batch_open_paths(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_threads,
+     int access_flags,
+     int (*callback_function)(
+            int path_index,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_batch_open_paths_with_flags(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_threads,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int path_index,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_batch_open_file_io_pool(
+     libbfio_pool_t *file_io_pool,
+     int number_of_threads,
+     int maximum_number_of_open_handles,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int entry,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_batch_open_memory_buffers(
+     const uint8_t * const buffers[],
+     const size_t buffer_sizes[],
+     int number_of_buffers,
+     int number_of_threads,
+     int access_flags,
+     int batch_flags,
+     libscca_batch_result_t results[],
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_batch_aggregate_run_times(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_threads,
+     int access_flags,
+     int batch_flags,
+     libscca_run_time_histogram_t *run_time_histogram,
+     libcerror_error_t **error );
+
+int libscca_batch_run(
+     libscca_batch_context_t *batch_context,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libscca_batch_get_next_item_index(
+     libscca_batch_context_t *batch_context,
+     libscca_batch_worker_t *worker,
+     int *item_index,
+     libcerror_error_t **error );
+
+int libscca_batch_process_path(
+     libscca_batch_context_t *batch_context,
+     libscca_context_t *context,
+     int path_index,
+     libcerror_error_t **error );
+
+int libscca_batch_aggregate_path(
+     libscca_batch_context_t *batch_context,
+     libscca_context_t *context,
+     libscca_run_time_histogram_t *run_time_histogram,
+     int path_index,
+     libcerror_error_t **error );
+
+int libscca_batch_process_file_io_pool_entry(
+     libscca_batch_context_t *batch_context,
+     libscca_context_t *context,
+     int entry,
+     libcerror_error_t **error );
+
+int libscca_batch_process_buffer(
+     libscca_batch_context_t *batch_context,
+     libscca_file_t *file,
+     int item_index,
+     libcerror_error_t **error );
+
+int libscca_batch_worker_run(
+     libscca_batch_worker_t *worker );
+
+int libscca_batch_pin_thread(
+     int worker_index,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libscca_batch_worker_thread_callback(
+     libscca_batch_worker_t *worker );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_BATCH_H ) */
+
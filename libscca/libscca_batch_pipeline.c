@@ -0,0 +1,1955 @@
+/*
+ * Batch pipeline functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#include "libscca_batch.h"
+#include "libscca_batch_pipeline.h"
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcnotify.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+
+/* Opens and parses a batch of files in a pipeline of stages
+ * The read stage reads every file into a buffer of a pool of number_of_buffers buffers,
+ * the parse stage opens and parses the file from its buffer and the output stage calls
+ * the callback function and returns the buffer to the pool. Every stage has its own
+ * number of threads and the stages are connected by bounded queues, hence a thread
+ * that waits for its storage does not stop the other threads from parsing the files
+ * that were already read. A number_of_buffers of 0 represents the default, which is
+ * LIBSCCA_BATCH_PIPELINE_NUMBER_OF_BUFFERS_PER_THREAD buffers per thread
+ * The number of buffers bounds the memory used, since a buffer retains its allocation
+ * when it is reused, and the number of files that are open concurrently
+ * If multi-threading support is not available the files are processed sequentially
+ * The callback function is called once for every path in the same way
+ * as libscca_batch_open_paths, but by the threads of the output stage
+ * Only LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY is supported, which applies to the read stage
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_open_paths_pipelined(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_read_threads,
+     int number_of_parse_threads,
+     int number_of_output_threads,
+     int number_of_buffers,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int path_index,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t batch_context;
+	libscca_batch_pipeline_t pipeline;
+
+	static char *function = "libscca_batch_open_paths_pipelined";
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_read_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of read threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parse_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of parse threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_output_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of output threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers < 0 )
+	 || ( number_of_buffers > LIBSCCA_BATCH_PIPELINE_MAXIMUM_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( batch_flags & ~( LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported batch flags: 0x%08x.",
+		 function,
+		 batch_flags );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     &batch_context,
+	     0,
+	     sizeof( libscca_batch_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &pipeline,
+	     0,
+	     sizeof( libscca_batch_pipeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context.paths              = paths;
+	batch_context.number_of_items    = number_of_paths;
+	batch_context.access_flags       = access_flags;
+	batch_context.batch_flags        = batch_flags;
+	batch_context.callback_function  = callback_function;
+	batch_context.callback_arguments = callback_arguments;
+
+	/* A stage never needs more threads than there are paths
+	 */
+	if( number_of_read_threads > number_of_paths )
+	{
+		number_of_read_threads = number_of_paths;
+	}
+	if( number_of_parse_threads > number_of_paths )
+	{
+		number_of_parse_threads = number_of_paths;
+	}
+	if( number_of_output_threads > number_of_paths )
+	{
+		number_of_output_threads = number_of_paths;
+	}
+	if( number_of_buffers == 0 )
+	{
+		number_of_buffers = ( number_of_read_threads + number_of_parse_threads + number_of_output_threads )
+		                  * LIBSCCA_BATCH_PIPELINE_NUMBER_OF_BUFFERS_PER_THREAD;
+	}
+	if( number_of_buffers > number_of_paths )
+	{
+		number_of_buffers = number_of_paths;
+	}
+	pipeline.batch_context            = &batch_context;
+	pipeline.number_of_items          = number_of_buffers;
+	pipeline.number_of_read_threads   = number_of_read_threads;
+	pipeline.number_of_parse_threads  = number_of_parse_threads;
+	pipeline.number_of_output_threads = number_of_output_threads;
+	pipeline.end_of_items.path_index  = -1;
+
+	if( libscca_batch_pipeline_run(
+	     &pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context.number_of_failed_items > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for: %d paths.",
+		 function,
+		 batch_context.number_of_failed_items );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Runs the stages of a pipeline until all the paths have been processed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_run(
+     libscca_batch_pipeline_t *pipeline,
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t *batch_context = NULL;
+	libscca_batch_pipeline_item_t *item    = NULL;
+	libscca_batch_worker_t *worker         = NULL;
+	static char *function                  = "libscca_batch_pipeline_run";
+	int item_index                         = 0;
+	int result                             = 1;
+	int worker_index                       = 0;
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	int number_of_failed_items             = 0;
+	int path_index                         = 0;
+#endif
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context = pipeline->batch_context;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch context - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->items != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pipeline - items value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pipeline->number_of_items < 1 )
+	 || ( pipeline->number_of_items > LIBSCCA_BATCH_PIPELINE_MAXIMUM_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pipeline - number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pipeline->number_of_read_threads < 1 )
+	 || ( pipeline->number_of_parse_threads < 1 )
+	 || ( pipeline->number_of_output_threads < 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pipeline - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context->number_of_workers = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	batch_context->number_of_workers = pipeline->number_of_read_threads;
+#endif
+	batch_context->workers = (libscca_batch_worker_t *) memory_allocate(
+	                                                     sizeof( libscca_batch_worker_t ) * batch_context->number_of_workers );
+
+	if( batch_context->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     batch_context->workers,
+	     0,
+	     sizeof( libscca_batch_worker_t ) * batch_context->number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The workers of the read stage determine the order in which the paths are read
+	 * in the same way as the workers of libscca_batch_run
+	 */
+	for( worker_index = 0;
+	     worker_index < batch_context->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( batch_context->workers[ worker_index ] );
+
+		worker->batch_context   = batch_context;
+		worker->worker_index    = worker_index;
+		worker->next_item_index = (int) ( ( (int64_t) batch_context->number_of_items * worker_index ) / batch_context->number_of_workers );
+		worker->end_item_index  = (int) ( ( (int64_t) batch_context->number_of_items * ( worker_index + 1 ) ) / batch_context->number_of_workers );
+	}
+	pipeline->items = (libscca_batch_pipeline_item_t *) memory_allocate(
+	                                                     sizeof( libscca_batch_pipeline_item_t ) * pipeline->number_of_items );
+
+	if( pipeline->items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create items.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     pipeline->items,
+	     0,
+	     sizeof( libscca_batch_pipeline_item_t ) * pipeline->number_of_items ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear items.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( batch_context->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* The threads that were started are always stopped, also when starting
+	 * another thread failed, since they reference the pipeline
+	 */
+	if( libscca_batch_pipeline_start(
+	     pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start pipeline.",
+		 function );
+
+		result = -1;
+	}
+	if( libscca_batch_pipeline_stop(
+	     pipeline,
+	     ( result == 1 ) ? error : NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop pipeline.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( batch_context->mutex ),
+	     ( result == 1 ) ? error : NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+#else
+	/* Without threads the stages are run one after the other with a single item
+	 */
+	worker = &( batch_context->workers[ 0 ] );
+	item   = &( pipeline->items[ 0 ] );
+
+	while( libscca_batch_get_next_item_index(
+	        batch_context,
+	        worker,
+	        &path_index,
+	        error ) == 1 )
+	{
+		item->path_index = path_index;
+		item->data_size  = 0;
+
+		/* The error of the read or open is passed to the callback function
+		 */
+		if( libscca_batch_pipeline_read_item(
+		     pipeline,
+		     item,
+		     &( item->error ) ) == 1 )
+		{
+			libscca_batch_pipeline_parse_item(
+			 pipeline,
+			 item,
+			 &( item->error ) );
+		}
+		if( libscca_batch_pipeline_output_item(
+		     pipeline,
+		     item,
+		     NULL ) != 1 )
+		{
+			number_of_failed_items += 1;
+		}
+	}
+	batch_context->number_of_failed_items += number_of_failed_items;
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( item_index = 0;
+	     item_index < pipeline->number_of_items;
+	     item_index++ )
+	{
+		item = &( pipeline->items[ item_index ] );
+
+		if( item->data != NULL )
+		{
+			memory_free(
+			 item->data );
+		}
+	}
+	memory_free(
+	 pipeline->items );
+
+	pipeline->items = NULL;
+
+	memory_free(
+	 batch_context->workers );
+
+	batch_context->workers = NULL;
+
+	return( result );
+
+on_error:
+	if( pipeline->items != NULL )
+	{
+		memory_free(
+		 pipeline->items );
+
+		pipeline->items = NULL;
+	}
+	if( batch_context->workers != NULL )
+	{
+		memory_free(
+		 batch_context->workers );
+
+		batch_context->workers = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the file of the path of an item into the data of the item
+ * The data of the item is resized if it is too small for the file
+ * On Windows the file is opened directly, sharing read, write and delete access
+ * with backup semantics, so that a prefetch file that is open by the prefetcher does
+ * not cause a sharing violation and the file can be read by a process that holds the
+ * backup privilege, and read with a single read of the whole file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_read_item(
+     libscca_batch_pipeline_t *pipeline,
+     libscca_batch_pipeline_item_t *item,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER large_integer_size;
+
+	HANDLE file_handle               = INVALID_HANDLE_VALUE;
+	DWORD read_count                 = 0;
+	size_t data_offset               = 0;
+#else
+	libbfio_handle_t *file_io_handle = NULL;
+	ssize_t read_count               = 0;
+#endif
+	const char *path                 = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "libscca_batch_pipeline_read_item";
+	size64_t file_size               = 0;
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->batch_context->paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item->path_index < 0 )
+	 || ( item->path_index >= pipeline->batch_context->number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item - path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	path = pipeline->batch_context->paths[ item->path_index ];
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing path: %d.",
+		 function,
+		 item->path_index );
+
+		return( -1 );
+	}
+	item->data_size = 0;
+
+#if defined( WINAPI )
+	file_handle = CreateFileA(
+	               (LPCSTR) path,
+	               GENERIC_READ,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL | FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_SEQUENTIAL_SCAN,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to open file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( GetFileSizeEx(
+	     file_handle,
+	     &large_integer_size ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 GetLastError(),
+		 "%s: unable to retrieve size of file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( large_integer_size.QuadPart < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size of file: %s value out of bounds.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	file_size = (size64_t) large_integer_size.QuadPart;
+#else
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     path,
+	     narrow_string_length(
+	      path ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+#endif /* defined( WINAPI ) */
+
+	/* The size of a prefetch file is stored as a 32-bit value
+	 */
+	if( ( file_size == 0 )
+	 || ( file_size > (size64_t) UINT32_MAX )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size of file: %s value out of bounds.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( (size_t) file_size > item->allocated_data_size )
+	{
+		data = (uint8_t *) memory_reallocate(
+		                    item->data,
+		                    (size_t) file_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			goto on_error;
+		}
+		item->data                = data;
+		item->allocated_data_size = (size_t) file_size;
+	}
+#if defined( WINAPI )
+	/* A read can return less data than requested, for example for a file
+	 * on a network share, hence the remainder is read until the end of the file
+	 */
+	while( data_offset < (size_t) file_size )
+	{
+		if( ReadFile(
+		     file_handle,
+		     &( item->data[ data_offset ] ),
+		     (DWORD) ( (size_t) file_size - data_offset ),
+		     &read_count,
+		     NULL ) == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 GetLastError(),
+			 "%s: unable to read file: %s.",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file: %s.",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+		data_offset += (size_t) read_count;
+	}
+	if( CloseHandle(
+	     file_handle ) == 0 )
+	{
+		file_handle = INVALID_HANDLE_VALUE;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 GetLastError(),
+		 "%s: unable to close file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	file_handle = INVALID_HANDLE_VALUE;
+#else
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              item->data,
+	              (size_t) file_size,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( WINAPI ) */
+
+	item->data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+#if defined( WINAPI )
+	if( file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 file_handle );
+	}
+#else
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Opens and parses the file from the data of an item
+ * The file references the data of the item and is closed by the output stage
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_parse_item(
+     libscca_batch_pipeline_t *pipeline,
+     libscca_batch_pipeline_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_batch_pipeline_parse_item";
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( item->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_initialize(
+	     &( item->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_memory(
+	     item->file,
+	     item->data,
+	     item->data_size,
+	     pipeline->batch_context->access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file of path: %d.",
+		 function,
+		 item->path_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( item->file != NULL )
+	{
+		libscca_file_free(
+		 &( item->file ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Passes the file of an item to the callback function and closes the file
+ * If the file of the item was not opened the callback function is called with
+ * a NULL file and the error of the read or open
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_output_item(
+     libscca_batch_pipeline_t *pipeline,
+     libscca_batch_pipeline_item_t *item,
+     libcerror_error_t **error )
+{
+	libscca_batch_context_t *batch_context = NULL;
+	static char *function                  = "libscca_batch_pipeline_output_item";
+	int result                             = 0;
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	batch_context = pipeline->batch_context;
+
+	if( batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_context->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid batch context - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	result = batch_context->callback_function(
+	          item->path_index,
+	          item->file,
+	          item->error,
+	          batch_context->callback_arguments );
+
+	if( item->error != NULL )
+	{
+		libcerror_error_free(
+		 &( item->error ) );
+	}
+	if( item->file != NULL )
+	{
+		if( libscca_file_close(
+		     item->file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		if( libscca_file_free(
+		     &( item->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for path: %d.",
+		 function,
+		 item->path_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds failed items to the number of failed items of the batch context
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_add_failed_items(
+     libscca_batch_pipeline_t *pipeline,
+     int number_of_failed_items,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_batch_pipeline_add_failed_items";
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_failed_items <= 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( pipeline->batch_context->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     pipeline->batch_context->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	pipeline->batch_context->number_of_failed_items += number_of_failed_items;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( pipeline->batch_context->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     pipeline->batch_context->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates the queues and starts the threads of the stages of a pipeline
+ * The threads are started from the last stage to the first stage so that
+ * every item that is produced has a stage that consumes it
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_start(
+     libscca_batch_pipeline_t *pipeline,
+     libcerror_error_t **error )
+{
+	libscca_batch_pipeline_thread_t *pipeline_thread = NULL;
+	static char *function                            = "libscca_batch_pipeline_start";
+	int item_index                                   = 0;
+	int thread_index                                 = 0;
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->batch_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing batch context.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pipeline - missing items.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pipeline->read_threads != NULL )
+	 || ( pipeline->parse_threads != NULL )
+	 || ( pipeline->output_threads != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pipeline - threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The queues that follow a stage also hold the end of items of every
+	 * thread of the next stage, hence a push never blocks indefinitely
+	 */
+	if( libcthreads_queue_initialize(
+	     &( pipeline->free_items_queue ),
+	     pipeline->number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free items queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_initialize(
+	     &( pipeline->read_items_queue ),
+	     pipeline->number_of_items + pipeline->number_of_parse_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read items queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_queue_initialize(
+	     &( pipeline->parsed_items_queue ),
+	     pipeline->number_of_items + pipeline->number_of_output_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create parsed items queue.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < pipeline->number_of_items;
+	     item_index++ )
+	{
+		if( libcthreads_queue_push(
+		     pipeline->free_items_queue,
+		     (intptr_t *) &( pipeline->items[ item_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push item: %d onto free items queue.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	pipeline->read_threads = (libscca_batch_pipeline_thread_t *) memory_allocate(
+	                                                              sizeof( libscca_batch_pipeline_thread_t ) * pipeline->number_of_read_threads );
+
+	pipeline->parse_threads = (libscca_batch_pipeline_thread_t *) memory_allocate(
+	                                                               sizeof( libscca_batch_pipeline_thread_t ) * pipeline->number_of_parse_threads );
+
+	pipeline->output_threads = (libscca_batch_pipeline_thread_t *) memory_allocate(
+	                                                                sizeof( libscca_batch_pipeline_thread_t ) * pipeline->number_of_output_threads );
+
+	if( ( pipeline->read_threads == NULL )
+	 || ( pipeline->parse_threads == NULL )
+	 || ( pipeline->output_threads == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_set(
+	       pipeline->read_threads,
+	       0,
+	       sizeof( libscca_batch_pipeline_thread_t ) * pipeline->number_of_read_threads ) == NULL )
+	 || ( memory_set(
+	       pipeline->parse_threads,
+	       0,
+	       sizeof( libscca_batch_pipeline_thread_t ) * pipeline->number_of_parse_threads ) == NULL )
+	 || ( memory_set(
+	       pipeline->output_threads,
+	       0,
+	       sizeof( libscca_batch_pipeline_thread_t ) * pipeline->number_of_output_threads ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < pipeline->number_of_output_threads;
+	     thread_index++ )
+	{
+		pipeline_thread = &( pipeline->output_threads[ thread_index ] );
+
+		pipeline_thread->pipeline = pipeline;
+
+		if( libcthreads_thread_create(
+		     &( pipeline_thread->thread ),
+		     NULL,
+		     (int (*)(void *)) &libscca_batch_pipeline_output_thread_callback,
+		     (void *) pipeline_thread,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output thread: %d.",
+			 function,
+			 thread_index );
+
+			return( -1 );
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < pipeline->number_of_parse_threads;
+	     thread_index++ )
+	{
+		pipeline_thread = &( pipeline->parse_threads[ thread_index ] );
+
+		pipeline_thread->pipeline = pipeline;
+
+		if( libcthreads_thread_create(
+		     &( pipeline_thread->thread ),
+		     NULL,
+		     (int (*)(void *)) &libscca_batch_pipeline_parse_thread_callback,
+		     (void *) pipeline_thread,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create parse thread: %d.",
+			 function,
+			 thread_index );
+
+			return( -1 );
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < pipeline->number_of_read_threads;
+	     thread_index++ )
+	{
+		pipeline_thread = &( pipeline->read_threads[ thread_index ] );
+
+		pipeline_thread->pipeline = pipeline;
+		pipeline_thread->worker   = &( pipeline->batch_context->workers[ thread_index ] );
+
+		if( libcthreads_thread_create(
+		     &( pipeline_thread->thread ),
+		     NULL,
+		     (int (*)(void *)) &libscca_batch_pipeline_read_thread_callback,
+		     (void *) pipeline_thread,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read thread: %d.",
+			 function,
+			 thread_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Stops the threads and frees the queues of the stages of a pipeline
+ * The stages are stopped from the first stage to the last stage, a stage is
+ * stopped by pushing an end of items for every thread after the threads of the
+ * previous stage finished. Only the threads that were started are stopped
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_stop(
+     libscca_batch_pipeline_t *pipeline,
+     libcerror_error_t **error )
+{
+	libscca_batch_pipeline_thread_t *pipeline_thread = NULL;
+	static char *function                            = "libscca_batch_pipeline_stop";
+	int result                                       = 1;
+	int thread_index                                 = 0;
+
+	if( pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( pipeline->read_threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < pipeline->number_of_read_threads;
+		     thread_index++ )
+		{
+			pipeline_thread = &( pipeline->read_threads[ thread_index ] );
+
+			if( pipeline_thread->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( pipeline_thread->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join read thread: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+		}
+	}
+	if( pipeline->parse_threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < pipeline->number_of_parse_threads;
+		     thread_index++ )
+		{
+			pipeline_thread = &( pipeline->parse_threads[ thread_index ] );
+
+			if( pipeline_thread->thread != NULL )
+			{
+				if( libcthreads_queue_push(
+				     pipeline->read_items_queue,
+				     (intptr_t *) &( pipeline->end_of_items ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push end of items onto read items queue.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < pipeline->number_of_parse_threads;
+		     thread_index++ )
+		{
+			pipeline_thread = &( pipeline->parse_threads[ thread_index ] );
+
+			if( pipeline_thread->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( pipeline_thread->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join parse thread: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+		}
+	}
+	if( pipeline->output_threads != NULL )
+	{
+		for( thread_index = 0;
+		     thread_index < pipeline->number_of_output_threads;
+		     thread_index++ )
+		{
+			pipeline_thread = &( pipeline->output_threads[ thread_index ] );
+
+			if( pipeline_thread->thread != NULL )
+			{
+				if( libcthreads_queue_push(
+				     pipeline->parsed_items_queue,
+				     (intptr_t *) &( pipeline->end_of_items ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push end of items onto parsed items queue.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < pipeline->number_of_output_threads;
+		     thread_index++ )
+		{
+			pipeline_thread = &( pipeline->output_threads[ thread_index ] );
+
+			if( pipeline_thread->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( pipeline_thread->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join output thread: %d.",
+					 function,
+					 thread_index );
+
+					result = -1;
+				}
+			}
+		}
+	}
+	if( pipeline->read_threads != NULL )
+	{
+		memory_free(
+		 pipeline->read_threads );
+
+		pipeline->read_threads = NULL;
+	}
+	if( pipeline->parse_threads != NULL )
+	{
+		memory_free(
+		 pipeline->parse_threads );
+
+		pipeline->parse_threads = NULL;
+	}
+	if( pipeline->output_threads != NULL )
+	{
+		memory_free(
+		 pipeline->output_threads );
+
+		pipeline->output_threads = NULL;
+	}
+	if( pipeline->parsed_items_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( pipeline->parsed_items_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parsed items queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( pipeline->read_items_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( pipeline->read_items_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read items queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( pipeline->free_items_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( pipeline->free_items_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free free items queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Reads the files of the paths of a worker into free items
+ * This function is the start function of the threads of the read stage
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_read_thread_callback(
+     libscca_batch_pipeline_thread_t *pipeline_thread )
+{
+	libcerror_error_t *error               = NULL;
+	libscca_batch_pipeline_item_t *item    = NULL;
+	libscca_batch_pipeline_t *pipeline     = NULL;
+	int number_of_failed_items             = 0;
+	int path_index                         = 0;
+	int result                             = 0;
+
+	if( ( pipeline_thread == NULL )
+	 || ( pipeline_thread->pipeline == NULL )
+	 || ( pipeline_thread->worker == NULL ) )
+	{
+		return( -1 );
+	}
+	pipeline = pipeline_thread->pipeline;
+
+	do
+	{
+		result = libscca_batch_get_next_item_index(
+		          pipeline->batch_context,
+		          pipeline_thread->worker,
+		          &path_index,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		/* The read stage waits here when all the items are in use by the
+		 * later stages, which bounds the memory used by the pipeline
+		 */
+		result = libcthreads_queue_pop(
+		          pipeline->free_items_queue,
+		          (intptr_t **) &item,
+		          &error );
+
+		if( result != 1 )
+		{
+			break;
+		}
+		item->path_index = path_index;
+
+		/* The error of the read is passed to the callback function
+		 */
+		libscca_batch_pipeline_read_item(
+		 pipeline,
+		 item,
+		 &( item->error ) );
+
+		result = libcthreads_queue_push(
+		          pipeline->read_items_queue,
+		          (intptr_t *) item,
+		          &error );
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		number_of_failed_items += 1;
+	}
+	if( libscca_batch_pipeline_add_failed_items(
+	     pipeline,
+	     number_of_failed_items,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens and parses the files of the items that were read
+ * This function is the start function of the threads of the parse stage
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_parse_thread_callback(
+     libscca_batch_pipeline_thread_t *pipeline_thread )
+{
+	libcerror_error_t *error               = NULL;
+	libscca_batch_pipeline_item_t *item    = NULL;
+	libscca_batch_pipeline_t *pipeline     = NULL;
+	int number_of_failed_items             = 0;
+	int result                             = 0;
+
+	if( ( pipeline_thread == NULL )
+	 || ( pipeline_thread->pipeline == NULL ) )
+	{
+		return( -1 );
+	}
+	pipeline = pipeline_thread->pipeline;
+
+	do
+	{
+		result = libcthreads_queue_pop(
+		          pipeline->read_items_queue,
+		          (intptr_t **) &item,
+		          &error );
+
+		if( ( result != 1 )
+		 || ( item == &( pipeline->end_of_items ) ) )
+		{
+			break;
+		}
+		/* The error of the open is passed to the callback function
+		 */
+		if( item->error == NULL )
+		{
+			libscca_batch_pipeline_parse_item(
+			 pipeline,
+			 item,
+			 &( item->error ) );
+		}
+		result = libcthreads_queue_push(
+		          pipeline->parsed_items_queue,
+		          (intptr_t *) item,
+		          &error );
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		number_of_failed_items += 1;
+	}
+	if( libscca_batch_pipeline_add_failed_items(
+	     pipeline,
+	     number_of_failed_items,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Passes the files of the parsed items to the callback function and frees the items
+ * This function is the start function of the threads of the output stage
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_batch_pipeline_output_thread_callback(
+     libscca_batch_pipeline_thread_t *pipeline_thread )
+{
+	libcerror_error_t *error               = NULL;
+	libscca_batch_pipeline_item_t *item    = NULL;
+	libscca_batch_pipeline_t *pipeline     = NULL;
+	int number_of_failed_items             = 0;
+	int result                             = 0;
+
+	if( ( pipeline_thread == NULL )
+	 || ( pipeline_thread->pipeline == NULL ) )
+	{
+		return( -1 );
+	}
+	pipeline = pipeline_thread->pipeline;
+
+	do
+	{
+		result = libcthreads_queue_pop(
+		          pipeline->parsed_items_queue,
+		          (intptr_t **) &item,
+		          &error );
+
+		if( ( result != 1 )
+		 || ( item == &( pipeline->end_of_items ) ) )
+		{
+			break;
+		}
+		if( libscca_batch_pipeline_output_item(
+		     pipeline,
+		     item,
+		     &error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+
+			/* An item that failed does not stop the output stage
+			 */
+			number_of_failed_items += 1;
+		}
+		result = libcthreads_queue_push(
+		          pipeline->free_items_queue,
+		          (intptr_t *) item,
+		          &error );
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		number_of_failed_items += 1;
+	}
+	if( libscca_batch_pipeline_add_failed_items(
+	     pipeline,
+	     number_of_failed_items,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
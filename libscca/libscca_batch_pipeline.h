@@ -0,0 +1,216 @@
+/*
+ * Batch pipeline functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_BATCH_PIPELINE_H )
+#define _LIBSCCA_BATCH_PIPELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_batch.h"
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_batch_pipeline libscca_batch_pipeline_t;
+typedef struct libscca_batch_pipeline_item libscca_batch_pipeline_item_t;
+typedef struct libscca_batch_pipeline_thread libscca_batch_pipeline_thread_t;
+
+/* An item is a pooled buffer that is passed from stage to stage
+ */
+struct libscca_batch_pipeline_item
+{
+	/* The index of the path the item currently contains
+	 */
+	int path_index;
+
+	/* The data of the file
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size, which is retained when the item is reused
+	 */
+	size_t allocated_data_size;
+
+	/* The file that was opened from the data
+	 * Contains NULL if the file was not opened
+	 */
+	libscca_file_t *file;
+
+	/* The error of the read or open of the file
+	 * Contains NULL if no error occurred
+	 */
+	libcerror_error_t *error;
+};
+
+struct libscca_batch_pipeline_thread
+{
+	/* The pipeline
+	 */
+	libscca_batch_pipeline_t *pipeline;
+
+	/* The worker that determines the paths that are read
+	 * This value is only used by the threads of the read stage
+	 */
+	libscca_batch_worker_t *worker;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct libscca_batch_pipeline
+{
+	/* The batch context
+	 */
+	libscca_batch_context_t *batch_context;
+
+	/* The items
+	 */
+	libscca_batch_pipeline_item_t *items;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The item that signals the threads of a stage that no more items follow
+	 */
+	libscca_batch_pipeline_item_t end_of_items;
+
+	/* The threads of the read stage
+	 */
+	libscca_batch_pipeline_thread_t *read_threads;
+
+	/* The number of threads of the read stage
+	 */
+	int number_of_read_threads;
+
+	/* The threads of the parse stage
+	 */
+	libscca_batch_pipeline_thread_t *parse_threads;
+
+	/* The number of threads of the parse stage
+	 */
+	int number_of_parse_threads;
+
+	/* The threads of the output stage
+	 */
+	libscca_batch_pipeline_thread_t *output_threads;
+
+	/* The number of threads of the output stage
+	 */
+	int number_of_output_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue of the items available to the read stage
+	 */
+	libcthreads_queue_t *free_items_queue;
+
+	/* The queue of the items read by the read stage
+	 */
+	libcthreads_queue_t *read_items_queue;
+
+	/* The queue of the items parsed by the parse stage
+	 */
+	libcthreads_queue_t *parsed_items_queue;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_batch_open_paths_pipelined(
+     char * const paths[],
+     int number_of_paths,
+     int number_of_read_threads,
+     int number_of_parse_threads,
+     int number_of_output_threads,
+     int number_of_buffers,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int path_index,
+            libscca_file_t *file,
+            libcerror_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_run(
+     libscca_batch_pipeline_t *pipeline,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_read_item(
+     libscca_batch_pipeline_t *pipeline,
+     libscca_batch_pipeline_item_t *item,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_parse_item(
+     libscca_batch_pipeline_t *pipeline,
+     libscca_batch_pipeline_item_t *item,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_output_item(
+     libscca_batch_pipeline_t *pipeline,
+     libscca_batch_pipeline_item_t *item,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_add_failed_items(
+     libscca_batch_pipeline_t *pipeline,
+     int number_of_failed_items,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libscca_batch_pipeline_start(
+     libscca_batch_pipeline_t *pipeline,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_stop(
+     libscca_batch_pipeline_t *pipeline,
+     libcerror_error_t **error );
+
+int libscca_batch_pipeline_read_thread_callback(
+     libscca_batch_pipeline_thread_t *pipeline_thread );
+
+int libscca_batch_pipeline_parse_thread_callback(
+     libscca_batch_pipeline_thread_t *pipeline_thread );
+
+int libscca_batch_pipeline_output_thread_callback(
+     libscca_batch_pipeline_thread_t *pipeline_thread );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_BATCH_PIPELINE_H ) */
+
@@ -0,0 +1,891 @@
+/*
+ * Shared block cache functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_block_cache.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+
+/* Determines the bucket index of an entry
+ */
+#define libscca_block_cache_get_bucket_index( identifier, block_offset ) \
+	(int) ( ( ( identifier ) ^ (uint64_t) ( block_offset ) ) & ( LIBSCCA_BLOCK_CACHE_NUMBER_OF_BUCKETS - 1 ) )
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * The block cache can be shared between files, see libscca_file_set_block_cache,
+ * and keeps the uncompressed data of the compressed blocks of at most maximum_size bytes
+ * The least recently used blocks are removed when the maximum size is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_block_cache_initialize(
+     libscca_block_cache_t **block_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                                = "libscca_block_cache_initialize";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = memory_allocate_structure(
+	                        libscca_internal_block_cache_t );
+
+	if( internal_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_block_cache,
+	     0,
+	     sizeof( libscca_internal_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 internal_block_cache );
+
+		return( -1 );
+	}
+	internal_block_cache->maximum_size = maximum_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_block_cache->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*block_cache = (libscca_block_cache_t *) internal_block_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_block_cache != NULL )
+	{
+		memory_free(
+		 internal_block_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * The block cache must not be freed while it is set for a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_block_cache_free(
+     libscca_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	libscca_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                                = "libscca_block_cache_free";
+	int result                                           = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		internal_block_cache = (libscca_internal_block_cache_t *) *block_cache;
+		*block_cache         = NULL;
+
+		while( internal_block_cache->first_entry != NULL )
+		{
+			if( libscca_internal_block_cache_remove_entry(
+			     internal_block_cache,
+			     internal_block_cache->first_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_block_cache->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_block_cache );
+	}
+	return( result );
+}
+
+/* Retrieves the statistics of a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_block_cache_get_statistics(
+     libscca_block_cache_t *block_cache,
+     size64_t *size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libscca_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                                = "libscca_block_cache_get_statistics";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = (libscca_internal_block_cache_t *) block_cache;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size             = internal_block_cache->size;
+	*number_of_hits   = internal_block_cache->number_of_hits;
+	*number_of_misses = internal_block_cache->number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Trims a block cache
+ * Removes the least recently used entries until the size of the cached entries
+ * does not exceed maximum_size, where a maximum size of 0 empties the block cache.
+ * The maximum size of the block cache itself is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_block_cache_trim(
+     libscca_block_cache_t *block_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                                = "libscca_block_cache_trim";
+	int result                                           = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = (libscca_internal_block_cache_t *) block_cache;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( ( internal_block_cache->last_entry != NULL )
+	    && ( internal_block_cache->size > maximum_size ) )
+	{
+		if( libscca_internal_block_cache_remove_entry(
+		     internal_block_cache,
+		     internal_block_cache->last_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes an entry from the block cache and frees it
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_block_cache_remove_entry(
+     libscca_internal_block_cache_t *internal_block_cache,
+     libscca_block_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libscca_block_cache_entry_t **bucket_entry = NULL;
+	static char *function                      = "libscca_internal_block_cache_remove_entry";
+	int bucket_index                           = 0;
+
+	if( internal_block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libscca_block_cache_get_bucket_index(
+	                entry->identifier,
+	                entry->block_offset );
+
+	bucket_entry = &( internal_block_cache->buckets[ bucket_index ] );
+
+	while( ( *bucket_entry != NULL )
+	    && ( *bucket_entry != entry ) )
+	{
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	if( *bucket_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entry - missing in bucket: %d.",
+		 function,
+		 bucket_index );
+
+		return( -1 );
+	}
+	*bucket_entry = entry->next_bucket_entry;
+
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		internal_block_cache->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		internal_block_cache->last_entry = entry->previous_entry;
+	}
+	internal_block_cache->size              -= sizeof( libscca_block_cache_entry_t ) + entry->data_size;
+	internal_block_cache->number_of_entries -= 1;
+
+	if( entry->data != NULL )
+	{
+		memory_free(
+		 entry->data );
+	}
+	memory_free(
+	 entry );
+
+	return( 1 );
+}
+
+/* Finds an entry in the block cache and marks it as the most recently used
+ * The mutex must be grabbed by the caller
+ * Returns the entry or NULL if not available
+ */
+libscca_block_cache_entry_t *libscca_internal_block_cache_find_entry(
+                              libscca_internal_block_cache_t *internal_block_cache,
+                              uint64_t identifier,
+                              off64_t block_offset,
+                              size_t compressed_data_size,
+                              size_t maximum_data_size )
+{
+	libscca_block_cache_entry_t *entry = NULL;
+
+	if( internal_block_cache == NULL )
+	{
+		return( NULL );
+	}
+	entry = internal_block_cache->buckets[ libscca_block_cache_get_bucket_index( identifier, block_offset ) ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->identifier == identifier )
+		 && ( entry->block_offset == block_offset )
+		 && ( entry->compressed_data_size == compressed_data_size )
+		 && ( entry->maximum_data_size == maximum_data_size ) )
+		{
+			break;
+		}
+		entry = entry->next_bucket_entry;
+	}
+	if( ( entry != NULL )
+	 && ( entry != internal_block_cache->first_entry ) )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+
+		if( entry->next_entry != NULL )
+		{
+			entry->next_entry->previous_entry = entry->previous_entry;
+		}
+		else
+		{
+			internal_block_cache->last_entry = entry->previous_entry;
+		}
+		entry->previous_entry = NULL;
+		entry->next_entry     = internal_block_cache->first_entry;
+
+		internal_block_cache->first_entry->previous_entry = entry;
+		internal_block_cache->first_entry                 = entry;
+	}
+	return( entry );
+}
+
+/* Retrieves the uncompressed data of a compressed block from the block cache
+ * The compressed block is identified by the hash of its compressed data, its offset,
+ * its compressed data size and the size of the buffer it was decompressed into,
+ * hence the same block of different files or of a file opened again is shared
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libscca_block_cache_get_data(
+     libscca_block_cache_t *block_cache,
+     uint64_t identifier,
+     off64_t block_offset,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t maximum_data_size,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_block_cache_entry_t *entry                   = NULL;
+	libscca_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                                = "libscca_block_cache_get_data";
+	int result                                           = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = (libscca_internal_block_cache_t *) block_cache;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = libscca_internal_block_cache_find_entry(
+	         internal_block_cache,
+	         identifier,
+	         block_offset,
+	         compressed_data_size,
+	         maximum_data_size );
+
+	if( entry == NULL )
+	{
+		internal_block_cache->number_of_misses += 1;
+	}
+	else if( memory_copy(
+	          data,
+	          entry->data,
+	          entry->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_block_cache->number_of_hits += 1;
+
+		*data_size = entry->data_size;
+
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the uncompressed data of a compressed block in the block cache
+ * The least recently used entries are removed to stay within the maximum size
+ * Returns 1 if successful, 0 if the data is empty or exceeds the maximum size or -1 on error
+ */
+int libscca_block_cache_set_data(
+     libscca_block_cache_t *block_cache,
+     uint64_t identifier,
+     off64_t block_offset,
+     size_t compressed_data_size,
+     size_t maximum_data_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_block_cache_entry_t *entry                   = NULL;
+	libscca_internal_block_cache_t *internal_block_cache = NULL;
+	static char *function                                = "libscca_block_cache_set_data";
+	size64_t entry_size                                  = 0;
+	int bucket_index                                     = 0;
+	int result                                           = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_cache = (libscca_internal_block_cache_t *) block_cache;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > maximum_data_size )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_size = (size64_t) sizeof( libscca_block_cache_entry_t ) + data_size;
+
+	if( ( data_size == 0 )
+	 || ( entry_size > internal_block_cache->maximum_size ) )
+	{
+		return( 0 );
+	}
+	entry = memory_allocate_structure(
+	         libscca_block_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry->data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * data_size );
+
+	if( entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data.",
+		 function );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     entry->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		memory_free(
+		 entry->data );
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	entry->identifier           = identifier;
+	entry->block_offset         = block_offset;
+	entry->compressed_data_size = compressed_data_size;
+	entry->maximum_data_size    = maximum_data_size;
+	entry->data_size            = data_size;
+	entry->previous_entry       = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		memory_free(
+		 entry->data );
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+#endif
+	/* The block can have been set by another file while it was decompressed
+	 */
+	if( libscca_internal_block_cache_find_entry(
+	     internal_block_cache,
+	     identifier,
+	     block_offset,
+	     compressed_data_size,
+	     maximum_data_size ) != NULL )
+	{
+		memory_free(
+		 entry->data );
+		memory_free(
+		 entry );
+	}
+	else
+	{
+		while( ( internal_block_cache->last_entry != NULL )
+		    && ( ( internal_block_cache->maximum_size - internal_block_cache->size ) < entry_size ) )
+		{
+			if( libscca_internal_block_cache_remove_entry(
+			     internal_block_cache,
+			     internal_block_cache->last_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove least recently used entry.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result != 1 )
+		{
+			memory_free(
+			 entry->data );
+			memory_free(
+			 entry );
+		}
+		else
+		{
+			bucket_index = libscca_block_cache_get_bucket_index(
+			                identifier,
+			                block_offset );
+
+			entry->next_bucket_entry                      = internal_block_cache->buckets[ bucket_index ];
+			internal_block_cache->buckets[ bucket_index ] = entry;
+
+			entry->next_entry = internal_block_cache->first_entry;
+
+			if( internal_block_cache->first_entry != NULL )
+			{
+				internal_block_cache->first_entry->previous_entry = entry;
+			}
+			else
+			{
+				internal_block_cache->last_entry = entry;
+			}
+			internal_block_cache->first_entry = entry;
+
+			internal_block_cache->size              += entry_size;
+			internal_block_cache->number_of_entries += 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_block_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
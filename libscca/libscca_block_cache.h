@@ -0,0 +1,188 @@
+/*
+ * Shared block cache functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_BLOCK_CACHE_H )
+#define _LIBSCCA_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of buckets of the block cache, which must be a power of 2
+ */
+#define LIBSCCA_BLOCK_CACHE_NUMBER_OF_BUCKETS		1024
+
+typedef struct libscca_block_cache_entry libscca_block_cache_entry_t;
+
+struct libscca_block_cache_entry
+{
+	/* The identifier, which is the XXH64 hash of the compressed data
+	 */
+	uint64_t identifier;
+
+	/* The offset of the compressed block in the file
+	 */
+	off64_t block_offset;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The size of the buffer the data was decompressed into
+	 */
+	size_t maximum_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *data;
+
+	/* The uncompressed data size
+	 */
+	size_t data_size;
+
+	/* The previous entry, which was used more recently
+	 */
+	libscca_block_cache_entry_t *previous_entry;
+
+	/* The next entry, which was used less recently
+	 */
+	libscca_block_cache_entry_t *next_entry;
+
+	/* The next entry in the same bucket
+	 */
+	libscca_block_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct libscca_internal_block_cache libscca_internal_block_cache_t;
+
+struct libscca_internal_block_cache
+{
+	/* The maximum size of the cached entries
+	 */
+	size64_t maximum_size;
+
+	/* The size of the cached entries
+	 */
+	size64_t size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The buckets of entries by identifier and block offset
+	 */
+	libscca_block_cache_entry_t *buckets[ LIBSCCA_BLOCK_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used entry
+	 */
+	libscca_block_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libscca_block_cache_entry_t *last_entry;
+
+	/* The number of lookups that found an entry
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of lookups that did not find an entry
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The block cache is shared between files, which can be read on different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_block_cache_initialize(
+     libscca_block_cache_t **block_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_block_cache_free(
+     libscca_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_block_cache_get_statistics(
+     libscca_block_cache_t *block_cache,
+     size64_t *size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_block_cache_trim(
+     libscca_block_cache_t *block_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int libscca_internal_block_cache_remove_entry(
+     libscca_internal_block_cache_t *internal_block_cache,
+     libscca_block_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+libscca_block_cache_entry_t *libscca_internal_block_cache_find_entry(
+                              libscca_internal_block_cache_t *internal_block_cache,
+                              uint64_t identifier,
+                              off64_t block_offset,
+                              size_t compressed_data_size,
+                              size_t maximum_data_size );
+
+int libscca_block_cache_get_data(
+     libscca_block_cache_t *block_cache,
+     uint64_t identifier,
+     off64_t block_offset,
+     size_t compressed_data_size,
+     uint8_t *data,
+     size_t maximum_data_size,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libscca_block_cache_set_data(
+     libscca_block_cache_t *block_cache,
+     uint64_t identifier,
+     off64_t block_offset,
+     size_t compressed_data_size,
+     size_t maximum_data_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_BLOCK_CACHE_H ) */
+
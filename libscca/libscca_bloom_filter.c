@@ -0,0 +1,320 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_bloom_filter.h"
+#include "libscca_definitions.h"
+#include "libscca_libcerror.h"
+
+/* The bits of a Bloom filter are stored in bytes with the least significant bit first,
+ * so that the Bloom filter data does not depend on the byte order of the host.
+ * The bit indexes of a hash are determined using double hashing, where the lower and upper
+ * 32-bit of the 64-bit hash are the 2 base hashes
+ */
+
+/* Determines the size of a Bloom filter for a specific number of values
+ * The size is a multiple of 8 bytes with at least LIBSCCA_BLOOM_FILTER_BITS_PER_VALUE bits per value
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_bloom_filter_get_size(
+     int number_of_values,
+     size_t *bloom_filter_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libscca_bloom_filter_get_size";
+	uint64_t number_of_bits = 0;
+
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( bloom_filter_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = (uint64_t) number_of_values * LIBSCCA_BLOOM_FILTER_BITS_PER_VALUE;
+
+	/* Round up to a multiple of 64 bits with a minimum of 64 bits
+	 */
+	number_of_bits = ( ( number_of_bits + 63 ) / 64 ) * 64;
+
+	if( number_of_bits == 0 )
+	{
+		number_of_bits = 64;
+	}
+	*bloom_filter_size = (size_t) ( number_of_bits / 8 );
+
+	return( 1 );
+}
+
+/* Builds a Bloom filter from hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_bloom_filter_build(
+     uint8_t *bloom_filter,
+     size_t bloom_filter_size,
+     uint32_t number_of_hashes,
+     const uint64_t *hashes,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_bloom_filter_build";
+	int value_index       = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bloom_filter_size == 0 )
+	 || ( bloom_filter_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Bloom filter size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hashes == NULL )
+	 && ( number_of_values > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     bloom_filter,
+	     0,
+	     bloom_filter_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libscca_bloom_filter_insert_hash(
+		     bloom_filter,
+		     bloom_filter_size,
+		     number_of_hashes,
+		     hashes[ value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert hash: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Inserts a hash into a Bloom filter
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_bloom_filter_insert_hash(
+     uint8_t *bloom_filter,
+     size_t bloom_filter_size,
+     uint32_t number_of_hashes,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function   = "libscca_bloom_filter_insert_hash";
+	uint64_t bit_index      = 0;
+	uint64_t first_hash     = 0;
+	uint64_t number_of_bits = 0;
+	uint64_t second_hash    = 0;
+	uint32_t hash_index     = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bloom_filter_size == 0 )
+	 || ( bloom_filter_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Bloom filter size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_hashes == 0 )
+	 || ( number_of_hashes > LIBSCCA_BLOOM_FILTER_MAXIMUM_NUMBER_OF_HASHES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hashes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = (uint64_t) bloom_filter_size * 8;
+	first_hash     = hash & 0xffffffffUL;
+	second_hash    = ( hash >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < number_of_hashes;
+	     hash_index++ )
+	{
+		bit_index = ( first_hash + ( (uint64_t) hash_index * second_hash ) ) % number_of_bits;
+
+		bloom_filter[ bit_index / 8 ] |= (uint8_t) ( 1 << ( bit_index % 8 ) );
+	}
+	return( 1 );
+}
+
+/* Determines if a Bloom filter contains a hash
+ * Returns 1 if the hash is possibly contained, 0 if not or -1 on error
+ */
+int libscca_bloom_filter_contains_hash(
+     const uint8_t *bloom_filter,
+     size_t bloom_filter_size,
+     uint32_t number_of_hashes,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	static char *function   = "libscca_bloom_filter_contains_hash";
+	uint64_t bit_index      = 0;
+	uint64_t first_hash     = 0;
+	uint64_t number_of_bits = 0;
+	uint64_t second_hash    = 0;
+	uint32_t hash_index     = 0;
+
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bloom_filter_size == 0 )
+	 || ( bloom_filter_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Bloom filter size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_hashes == 0 )
+	 || ( number_of_hashes > LIBSCCA_BLOOM_FILTER_MAXIMUM_NUMBER_OF_HASHES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of hashes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = (uint64_t) bloom_filter_size * 8;
+	first_hash     = hash & 0xffffffffUL;
+	second_hash    = ( hash >> 32 ) | 1;
+
+	for( hash_index = 0;
+	     hash_index < number_of_hashes;
+	     hash_index++ )
+	{
+		bit_index = ( first_hash + ( (uint64_t) hash_index * second_hash ) ) % number_of_bits;
+
+		if( ( bloom_filter[ bit_index / 8 ] & (uint8_t) ( 1 << ( bit_index % 8 ) ) ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
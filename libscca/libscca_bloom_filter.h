@@ -0,0 +1,66 @@
+/*
+ * Bloom filter functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_BLOOM_FILTER_H )
+#define _LIBSCCA_BLOOM_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libscca_bloom_filter_get_size(
+     int number_of_values,
+     size_t *bloom_filter_size,
+     libcerror_error_t **error );
+
+int libscca_bloom_filter_build(
+     uint8_t *bloom_filter,
+     size_t bloom_filter_size,
+     uint32_t number_of_hashes,
+     const uint64_t *hashes,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libscca_bloom_filter_insert_hash(
+     uint8_t *bloom_filter,
+     size_t bloom_filter_size,
+     uint32_t number_of_hashes,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int libscca_bloom_filter_contains_hash(
+     const uint8_t *bloom_filter,
+     size_t bloom_filter_size,
+     uint32_t number_of_hashes,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_BLOOM_FILTER_H ) */
+
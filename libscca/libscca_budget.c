@@ -0,0 +1,269 @@
+/*
+ * Parse budget functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_budget.h"
+#include "libscca_libcerror.h"
+#include "libscca_statistics.h"
+
+/* Checks if a number of entries is within the budget
+ * The abort value is set if the budget is exceeded, to stop any other activity of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_budget_check_number_of_entries(
+     libscca_budget_t *budget,
+     uint32_t number_of_entries,
+     int *abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_budget_check_number_of_entries";
+
+	if( budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( budget->maximum_number_of_entries != 0 )
+	 && ( number_of_entries > budget->maximum_number_of_entries ) )
+	{
+		*abort = 1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED,
+		 "%s: number of entries: %" PRIu32 " exceeds budget maximum: %" PRIu32 ".",
+		 function,
+		 number_of_entries,
+		 budget->maximum_number_of_entries );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Checks if an uncompressed data size is within the budget
+ * The abort value is set if the budget is exceeded, to stop any other activity of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_budget_check_uncompressed_data_size(
+     libscca_budget_t *budget,
+     uint64_t uncompressed_data_size,
+     int *abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_budget_check_uncompressed_data_size";
+
+	if( budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( budget->maximum_uncompressed_data_size != 0 )
+	 && ( uncompressed_data_size > budget->maximum_uncompressed_data_size ) )
+	{
+		*abort = 1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED,
+		 "%s: uncompressed data size: %" PRIu64 " exceeds budget maximum: %" PRIu64 ".",
+		 function,
+		 uncompressed_data_size,
+		 budget->maximum_uncompressed_data_size );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds steps to the number of steps and checks if they are within the budget
+ * The abort value is set if the budget is exceeded, to stop any other activity of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_budget_add_steps(
+     libscca_budget_t *budget,
+     uint64_t number_of_steps,
+     int *abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_budget_add_steps";
+
+	if( budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_steps > ( UINT64_MAX - budget->number_of_steps ) )
+	{
+		budget->number_of_steps = UINT64_MAX;
+	}
+	else
+	{
+		budget->number_of_steps += number_of_steps;
+	}
+	if( ( budget->maximum_number_of_steps != 0 )
+	 && ( budget->number_of_steps > budget->maximum_number_of_steps ) )
+	{
+		*abort = 1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED,
+		 "%s: number of steps: %" PRIu64 " exceeds budget maximum: %" PRIu64 ".",
+		 function,
+		 budget->number_of_steps,
+		 budget->maximum_number_of_steps );
+
+		return( -1 );
+	}
+	/* The steps are taken per compressed block and per section hence the deadline
+	 * is checked here instead of in every loop that can take long
+	 */
+	if( libscca_budget_check_deadline(
+	     budget,
+	     abort,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Checks if the deadline has not passed
+ * The abort value is set if the deadline has passed, to stop any other activity of the file
+ * The deadline is not checked if no monotonic clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_budget_check_deadline(
+     libscca_budget_t *budget,
+     int *abort,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_budget_check_deadline";
+	uint64_t timestamp    = 0;
+
+	if( budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( abort == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid abort.",
+		 function );
+
+		return( -1 );
+	}
+	if( budget->deadline == 0 )
+	{
+		return( 1 );
+	}
+	if( libscca_statistics_get_timestamp(
+	     &timestamp ) != 1 )
+	{
+		return( 1 );
+	}
+	if( timestamp >= budget->deadline )
+	{
+		budget->deadline_exceeded = 1;
+
+		*abort = 1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBSCCA_BUDGET_RUNTIME_ERROR_DEADLINE_EXCEEDED,
+		 "%s: deadline: %" PRIu64 " exceeded at: %" PRIu64 ".",
+		 function,
+		 budget->deadline,
+		 timestamp );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
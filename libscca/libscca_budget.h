@@ -0,0 +1,105 @@
+/*
+ * Parse budget functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_BUDGET_H )
+#define _LIBSCCA_BUDGET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The runtime error code of an exceeded parse budget, which extends the libcerror
+ * runtime error codes and corresponds with LIBSCCA_RUNTIME_ERROR_BUDGET_EXCEEDED
+ */
+#define LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED			16
+
+/* The runtime error code of an exceeded parse deadline, which extends the libcerror
+ * runtime error codes and corresponds with LIBSCCA_RUNTIME_ERROR_DEADLINE_EXCEEDED
+ */
+#define LIBSCCA_BUDGET_RUNTIME_ERROR_DEADLINE_EXCEEDED		17
+
+/* The number of bytes of decompressed data that accounts for a single step
+ */
+#define LIBSCCA_BUDGET_DECOMPRESSION_STEP_SIZE			4096
+
+typedef struct libscca_budget libscca_budget_t;
+
+struct libscca_budget
+{
+	/* The maximum number of entries of a section, where 0 represents no maximum
+	 */
+	uint32_t maximum_number_of_entries;
+
+	/* The maximum uncompressed data size, where 0 represents no maximum
+	 */
+	uint64_t maximum_uncompressed_data_size;
+
+	/* The maximum number of steps, where 0 represents no maximum
+	 */
+	uint64_t maximum_number_of_steps;
+
+	/* The number of steps since the file was opened
+	 */
+	uint64_t number_of_steps;
+
+	/* The deadline as a monotonic timestamp in nano seconds, where 0 represents no deadline
+	 */
+	uint64_t deadline;
+
+	/* Value to indicate the deadline was exceeded since the file was opened
+	 */
+	uint8_t deadline_exceeded;
+};
+
+int libscca_budget_check_number_of_entries(
+     libscca_budget_t *budget,
+     uint32_t number_of_entries,
+     int *abort,
+     libcerror_error_t **error );
+
+int libscca_budget_check_uncompressed_data_size(
+     libscca_budget_t *budget,
+     uint64_t uncompressed_data_size,
+     int *abort,
+     libcerror_error_t **error );
+
+int libscca_budget_add_steps(
+     libscca_budget_t *budget,
+     uint64_t number_of_steps,
+     int *abort,
+     libcerror_error_t **error );
+
+int libscca_budget_check_deadline(
+     libscca_budget_t *budget,
+     int *abort,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_BUDGET_H ) */
+
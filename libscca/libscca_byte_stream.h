@@ -0,0 +1,88 @@
+/*
+ * Byte stream functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_BYTE_STREAM_H )
+#define _LIBSCCA_BYTE_STREAM_H
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Little-endian hosts can load little-endian values without byte swapping
+ */
+#if defined( __BYTE_ORDER__ ) && defined( __ORDER_LITTLE_ENDIAN__ )
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define LIBSCCA_HAVE_LITTLE_ENDIAN_HOST	1
+#endif
+#elif defined( _M_IX86 ) || defined( _M_X64 ) || defined( _M_ARM64 )
+#define LIBSCCA_HAVE_LITTLE_ENDIAN_HOST	1
+#endif
+
+#if defined( LIBSCCA_HAVE_LITTLE_ENDIAN_HOST )
+
+/* The on-disk values are not necessarily aligned, hence they are copied into
+ * a local value, which the compiler turns into a single unaligned load
+ */
+#define libscca_byte_stream_copy_to_uint16_little_endian( byte_stream, value ) \
+	{ \
+		uint16_t libscca_byte_stream_value_16bit; \
+		memory_copy( &libscca_byte_stream_value_16bit, byte_stream, sizeof( uint16_t ) ); \
+		( value ) = libscca_byte_stream_value_16bit; \
+	}
+
+#define libscca_byte_stream_copy_to_uint32_little_endian( byte_stream, value ) \
+	{ \
+		uint32_t libscca_byte_stream_value_32bit; \
+		memory_copy( &libscca_byte_stream_value_32bit, byte_stream, sizeof( uint32_t ) ); \
+		( value ) = libscca_byte_stream_value_32bit; \
+	}
+
+#define libscca_byte_stream_copy_to_uint64_little_endian( byte_stream, value ) \
+	{ \
+		uint64_t libscca_byte_stream_value_64bit; \
+		memory_copy( &libscca_byte_stream_value_64bit, byte_stream, sizeof( uint64_t ) ); \
+		( value ) = libscca_byte_stream_value_64bit; \
+	}
+
+#else
+
+#define libscca_byte_stream_copy_to_uint16_little_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint16_little_endian( byte_stream, value )
+
+#define libscca_byte_stream_copy_to_uint32_little_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint32_little_endian( byte_stream, value )
+
+#define libscca_byte_stream_copy_to_uint64_little_endian( byte_stream, value ) \
+	byte_stream_copy_to_uint64_little_endian( byte_stream, value )
+
+#endif /* defined( LIBSCCA_HAVE_LITTLE_ENDIAN_HOST ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_BYTE_STREAM_H ) */
+
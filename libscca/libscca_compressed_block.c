@@ -24,14 +24,19 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libscca_block_cache.h"
+#include "libscca_budget.h"
 #include "libscca_compressed_block.h"
 #include "libscca_definitions.h"
 #include "libscca_file.h"
+#include "libscca_hash.h"
 #include "libscca_io_handle.h"
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
-#include "libscca_libfwnt.h"
+#include "libscca_lzxpress.h"
+#include "libscca_memory.h"
+#include "libscca_tracepoint.h"
 #include "libscca_unused.h"
 
 /* Creates compressed block
@@ -168,6 +173,7 @@ int libscca_compressed_block_free(
      libcerror_error_t **error )
 {
 	static char *function = "libscca_compressed_block_free";
+	int result            = 1;
 
 	if( compressed_block == NULL )
 	{
@@ -182,6 +188,23 @@ int libscca_compressed_block_free(
 	}
 	if( *compressed_block != NULL )
 	{
+		if( ( *compressed_block )->statistics != NULL )
+		{
+			if( libscca_statistics_remove_allocated_size(
+			     ( *compressed_block )->statistics,
+			     sizeof( libscca_compressed_block_t ) + ( *compressed_block )->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove compressed block allocated size.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *compressed_block )->data != NULL )
 		{
 			memory_free(
@@ -192,23 +215,130 @@ int libscca_compressed_block_free(
 
 		*compressed_block = NULL;
 	}
+	return( result );
+}
+
+/* Reads a compressed block from data
+ * The compressed data is decompressed directly from the buffer without an intermediate copy
+ * The decoder cache is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_compressed_block_read_data(
+     libscca_compressed_block_t *compressed_block,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function         = "libscca_compressed_block_read_data";
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data_size = compressed_block->data_size;
+
+	LIBSCCA_TRACEPOINT_BLOCK_DECODE_BEGIN(
+	 compressed_data_size,
+	 uncompressed_data_size )
+
+	result = libscca_lzxpress_huffman_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          compressed_block->data,
+	          &uncompressed_data_size,
+	          0,
+	          decoder_cache,
+	          error );
+
+	LIBSCCA_TRACEPOINT_BLOCK_DECODE_END(
+	 result,
+	 compressed_data_size,
+	 uncompressed_data_size )
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data size is set to the size of the data that was actually decompressed
+	 */
+	compressed_block->data_size = uncompressed_data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: uncompressed data:\n",
+		 function );
+		libcnotify_print_data(
+		 compressed_block->data,
+		 compressed_block->data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
 	return( 1 );
 }
 
 /* Reads a compressed block
+ * The compressed data is read into the scratch buffer of the IO handle
+ * The uncompressed data is retrieved from the shared block cache if set for the IO handle
  * Returns the number of bytes of read on success or -1 on error
  */
 ssize_t libscca_compressed_block_read(
          libscca_compressed_block_t *compressed_block,
+         libscca_io_handle_t *io_handle,
          libbfio_handle_t *file_io_handle,
          off64_t compressed_block_offset,
          size_t compressed_block_size,
          libcerror_error_t **error )
 {
-	uint8_t *compressed_data      = NULL;
-	static char *function         = "libscca_compressed_block_read";
-	size_t uncompressed_data_size = 0;
-	ssize_t read_count            = 0;
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache = NULL;
+	uint8_t *compressed_data                                = NULL;
+	static char *function                                   = "libscca_compressed_block_read";
+	size_t data_size                                        = 0;
+	size_t maximum_data_size                                = 0;
+	ssize_t read_count                                      = 0;
+	uint64_t identifier                                     = 0;
+	int result                                              = 0;
 
 	if( compressed_block == NULL )
 	{
@@ -233,6 +363,11 @@ ssize_t libscca_compressed_block_read(
 
 		return( -1 );
 	}
+	/* The data size is reduced to the size of the data that was actually decompressed
+	 * hence the size of the buffer is retained to identify the block in the block cache
+	 */
+	maximum_data_size = compressed_block->data_size;
+
 	if( libbfio_handle_seek_offset(
 	     file_io_handle,
 	     compressed_block_offset,
@@ -247,21 +382,22 @@ ssize_t libscca_compressed_block_read(
 		 function,
 		 compressed_block_offset );
 
-		goto on_error;
+		return( -1 );
 	}
-	compressed_data = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * compressed_block_size );
-
-	if( compressed_data == NULL )
+	if( libscca_io_handle_get_compressed_data_buffer(
+	     io_handle,
+	     compressed_block_size,
+	     &compressed_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed data buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	read_count = libbfio_handle_read_buffer(
 		      file_io_handle,
@@ -278,52 +414,115 @@ ssize_t libscca_compressed_block_read(
 		 "%s: unable to read compressed block.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	uncompressed_data_size = compressed_block->data_size;
+	io_handle->statistics.number_of_bytes_read += (uint64_t) read_count;
 
-	if( libfwnt_lzxpress_huffman_decompress(
-	     compressed_data,
-	     (size_t) read_count,
-	     compressed_block->data,
-	     &uncompressed_data_size,
+	/* The shared block cache is looked up by the hash of the compressed data
+	 * since the compressed data is read anyway and hashing it is cheap compared
+	 * to decompressing it
+	 */
+	if( io_handle->block_cache != NULL )
+	{
+		if( libscca_hash_calculate_xxh64(
+		     compressed_data,
+		     (size_t) read_count,
+		     0,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate compressed data hash.",
+			 function );
+
+			return( -1 );
+		}
+		result = libscca_block_cache_get_data(
+		          io_handle->block_cache,
+		          identifier,
+		          compressed_block_offset,
+		          (size_t) read_count,
+		          compressed_block->data,
+		          maximum_data_size,
+		          &data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compressed block data from block cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		compressed_block->data_size = data_size;
+
+		return( read_count );
+	}
+	if( libscca_io_handle_get_decoder_cache(
+	     io_handle,
+	     &decoder_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable to decompress compressed data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve decoder cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libscca_compressed_block_read_data(
+	     compressed_block,
+	     compressed_data,
+	     (size_t) read_count,
+	     decoder_cache,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: uncompressed data:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed block data.",
 		 function );
-		libcnotify_print_data(
-		 compressed_block->data,
-		 compressed_block->data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	memory_free(
-	 compressed_data );
 
-	compressed_data = NULL;
-
-	return( read_count );
+		return( -1 );
+	}
+	io_handle->statistics.number_of_decompressed_blocks += 1;
 
-on_error:
-	if( compressed_data != NULL )
+	if( io_handle->block_cache != NULL )
 	{
-		memory_free(
-		 compressed_data );
+		if( libscca_block_cache_set_data(
+		     io_handle->block_cache,
+		     identifier,
+		     compressed_block_offset,
+		     (size_t) read_count,
+		     maximum_data_size,
+		     compressed_block->data,
+		     compressed_block->data_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set compressed block data in block cache.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	return( -1 );
+	return( read_count );
 }
 
 /* Reads a compressed block
@@ -394,6 +593,20 @@ int libscca_compressed_block_read_element_data(
 
 		return( -1 );
 	}
+	/* A compressed block is decompressed when its data is first read
+	 * hence the abort is checked before every block
+	 */
+	if( io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_element_get_mapped_size(
 	     element,
 	     &uncompressed_size,
@@ -408,6 +621,21 @@ int libscca_compressed_block_read_element_data(
 
 		goto on_error;
 	}
+	if( libscca_budget_add_steps(
+	     &( io_handle->budget ),
+	     ( uncompressed_size / LIBSCCA_BUDGET_DECOMPRESSION_STEP_SIZE ) + 1,
+	     &( io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add decompression to budget.",
+		 function );
+
+		goto on_error;
+	}
 	if( libscca_compressed_block_initialize(
 	     &compressed_block,
 	     (size_t) uncompressed_size,
@@ -424,6 +652,7 @@ int libscca_compressed_block_read_element_data(
 	}
 	read_count = libscca_compressed_block_read(
 	              compressed_block,
+	              io_handle,
 	              file_io_handle,
 	              compressed_block_offset,
 	              (size_t) compressed_block_size,
@@ -440,6 +669,31 @@ int libscca_compressed_block_read_element_data(
 
 		goto on_error;
 	}
+	/* The compressed block data and structure are allocated for every block read
+	 * and remain allocated until the block is evicted from the cache
+	 */
+	if( ( libscca_statistics_add_allocation(
+	       &( io_handle->statistics ),
+	       sizeof( libscca_compressed_block_t ),
+	       error ) != 1 )
+	 || ( libscca_statistics_add_allocation(
+	       &( io_handle->statistics ),
+	       compressed_block->data_size,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add compressed block allocations.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_block->statistics = &( io_handle->statistics );
+
+	io_handle->statistics.number_of_block_reads += 1;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -28,6 +28,8 @@
 #include "libscca_io_handle.h"
 #include "libscca_libcerror.h"
 #include "libscca_libfdata.h"
+#include "libscca_lzxpress.h"
+#include "libscca_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -44,6 +46,10 @@ struct libscca_compressed_block
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The statistics the compressed block is accounted for in
+	 */
+	libscca_statistics_t *statistics;
 };
 
 int libscca_compressed_block_initialize(
@@ -55,8 +61,16 @@ int libscca_compressed_block_free(
      libscca_compressed_block_t **compressed_block,
      libcerror_error_t **error );
 
+int libscca_compressed_block_read_data(
+     libscca_compressed_block_t *compressed_block,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error );
+
 ssize_t libscca_compressed_block_read(
          libscca_compressed_block_t *compressed_block,
+         libscca_io_handle_t *io_handle,
          libbfio_handle_t *file_io_handle,
          off64_t compressed_block_offset,
          size_t compressed_block_size,
@@ -29,6 +29,8 @@
 #include "libscca_libcerror.h"
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
+#include "libscca_memory.h"
+#include "libscca_statistics.h"
 #include "libscca_unused.h"
 
 /* Creates a data handle
@@ -198,6 +200,10 @@ ssize_t libscca_compressed_blocks_stream_data_handle_read_segment_data(
 
 		return( -1 );
 	}
+	if( data_handle->statistics != NULL )
+	{
+		data_handle->statistics->number_of_block_lookups += 1;
+	}
 	if( libfdata_list_get_element_value_at_offset(
 	     data_handle->compressed_blocks_list,
 	     (intptr_t *) file_io_handle,
@@ -313,14 +319,129 @@ off64_t libscca_compressed_blocks_stream_data_handle_seek_segment_offset(
 	return( segment_offset );
 }
 
+/* Retrieves a span of the data that references the decompressed block data
+ * The span is only available if the data is contained by a single compressed block
+ * and is valid until the compressed block is evicted from the cache
+ * The statistics are optional and are updated with the compressed block lookup
+ * Returns 1 if successful, 0 if the data is not contained by a single block or -1 on error
+ */
+int libscca_compressed_blocks_stream_get_data_span(
+     libfdata_list_t *compressed_blocks_list,
+     libfcache_cache_t *compressed_blocks_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     size_t data_size,
+     libscca_statistics_t *statistics,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	libscca_compressed_block_t *compressed_block = NULL;
+	static char *function                        = "libscca_compressed_blocks_stream_get_data_span";
+	off64_t block_data_offset                    = 0;
+	int block_index                              = 0;
+
+	if( compressed_blocks_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed blocks list.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics != NULL )
+	{
+		statistics->number_of_block_lookups += 1;
+	}
+	if( libfdata_list_get_element_value_at_offset(
+	     compressed_blocks_list,
+	     (intptr_t *) file_io_handle,
+	     (libfdata_cache_t *) compressed_blocks_cache,
+	     data_offset,
+	     &block_index,
+	     &block_data_offset,
+	     (intptr_t **) &compressed_block,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed block at offset: %" PRIi64 ".",
+		 function,
+		 data_offset );
+
+		return( -1 );
+	}
+	if( compressed_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing compressed block: %d.",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	if( ( block_data_offset < 0 )
+	 || ( (size64_t) block_data_offset > compressed_block->data_size )
+	 || ( data_size > ( compressed_block->data_size - (size_t) block_data_offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( compressed_block->data[ block_data_offset ] );
+
+	return( 1 );
+}
+
 /* Creates a compressed block stream
  * Make sure the value compressed_blocks_stream is referencing, is set to NULL
+ * The statistics are optional and are updated with the compressed block lookups
  * Returns 1 if successful or -1 on error
  */
 int libscca_compressed_blocks_stream_initialize(
      libfdata_stream_t **compressed_blocks_stream,
      libfdata_list_t *compressed_blocks_list,
      libfcache_cache_t *compressed_blocks_cache,
+     libscca_statistics_t *statistics,
      libcerror_error_t **error )
 {
 	libscca_compressed_blocks_stream_data_handle_t *data_handle = NULL;
@@ -379,6 +500,7 @@ int libscca_compressed_blocks_stream_initialize(
 	}
 	data_handle->compressed_blocks_list  = compressed_blocks_list;
 	data_handle->compressed_blocks_cache = compressed_blocks_cache;
+	data_handle->statistics              = statistics;
 
 	if( libfdata_stream_initialize(
 	     compressed_blocks_stream,
@@ -25,9 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libscca_libbfio.h"
 #include "libscca_libcerror.h"
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
+#include "libscca_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -48,6 +50,10 @@ struct libscca_compressed_blocks_stream_data_handle
 	/* The compressed blocks cache
 	 */
 	libfcache_cache_t *compressed_blocks_cache;
+
+	/* The parse statistics
+	 */
+	libscca_statistics_t *statistics;
 };
 
 int libscca_compressed_blocks_stream_data_handle_initialize(
@@ -77,10 +83,21 @@ off64_t libscca_compressed_blocks_stream_data_handle_seek_segment_offset(
          off64_t segment_offset,
          libcerror_error_t **error );
 
+int libscca_compressed_blocks_stream_get_data_span(
+     libfdata_list_t *compressed_blocks_list,
+     libfcache_cache_t *compressed_blocks_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     size_t data_size,
+     libscca_statistics_t *statistics,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 int libscca_compressed_blocks_stream_initialize(
      libfdata_stream_t **compressed_blocks_stream,
      libfdata_list_t *compressed_blocks_list,
      libfcache_cache_t *compressed_blocks_cache,
+     libscca_statistics_t *statistics,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,635 @@
+/*
+ * Context functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_context.h"
+#include "libscca_libcerror.h"
+#include "libscca_lzxpress.h"
+#include "libscca_memory.h"
+
+/* Creates a context
+ * Make sure the value context is referencing, is set to NULL
+ * The context holds the caches and scratch buffers that are shared by the files
+ * created with libscca_file_initialize_with_context. A context is not locked,
+ * hence it should be used by a single thread, for example one context per worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_initialize(
+     libscca_context_t **context,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	static char *function                        = "libscca_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = memory_allocate_structure(
+	                    libscca_internal_context_t );
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_context,
+	     0,
+	     sizeof( libscca_internal_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		memory_free(
+		 internal_context );
+
+		return( -1 );
+	}
+	*context = (libscca_context_t *) internal_context;
+
+	return( 1 );
+}
+
+/* Frees a context
+ * The context cannot be freed while it is used by a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_free(
+     libscca_context_t **context,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	static char *function                        = "libscca_context_free";
+	int buffer_type                              = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		internal_context = (libscca_internal_context_t *) *context;
+
+		if( internal_context->number_of_files > 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid context - context is used by: %d files.",
+			 function,
+			 internal_context->number_of_files );
+
+			return( -1 );
+		}
+		*context = NULL;
+
+		for( buffer_type = 0;
+		     buffer_type < LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES;
+		     buffer_type++ )
+		{
+			if( internal_context->buffers[ buffer_type ] != NULL )
+			{
+				memory_free(
+				 internal_context->buffers[ buffer_type ] );
+			}
+		}
+		if( internal_context->decoder_cache != NULL )
+		{
+			libscca_lzxpress_huffman_decoder_cache_free(
+			 &( internal_context->decoder_cache ),
+			 NULL );
+		}
+		memory_free(
+		 internal_context );
+	}
+	return( 1 );
+}
+
+/* Sets the block cache
+ * The block cache is set for the files that are created with the context afterwards,
+ * see libscca_file_set_block_cache
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_set_block_cache(
+     libscca_context_t *context,
+     libscca_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	static char *function                        = "libscca_context_set_block_cache";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libscca_internal_context_t *) context;
+
+	internal_context->block_cache = block_cache;
+
+	return( 1 );
+}
+
+/* Sets the string pool
+ * The string pool is set for the files that are created with the context afterwards,
+ * see libscca_file_set_string_pool
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_set_string_pool(
+     libscca_context_t *context,
+     libscca_string_pool_t *string_pool,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	static char *function                        = "libscca_context_set_string_pool";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libscca_internal_context_t *) context;
+
+	internal_context->string_pool = string_pool;
+
+	return( 1 );
+}
+
+/* Sets the volume dictionary
+ * The volume dictionary is set for the files that are created with the context afterwards,
+ * see libscca_file_set_volume_dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_set_volume_dictionary(
+     libscca_context_t *context,
+     libscca_volume_dictionary_t *volume_dictionary,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	static char *function                        = "libscca_context_set_volume_dictionary";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libscca_internal_context_t *) context;
+
+	internal_context->volume_dictionary = volume_dictionary;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the scratch buffers that are held by the context
+ * Scratch buffers that are in use by a file are not included
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_get_scratch_buffers_size(
+     libscca_context_t *context,
+     size_t *scratch_buffers_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	static char *function                        = "libscca_context_get_scratch_buffers_size";
+	size_t safe_scratch_buffers_size             = 0;
+	int buffer_type                              = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libscca_internal_context_t *) context;
+
+	if( scratch_buffers_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch buffers size.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_type = 0;
+	     buffer_type < LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES;
+	     buffer_type++ )
+	{
+		safe_scratch_buffers_size += internal_context->buffer_sizes[ buffer_type ];
+	}
+	if( internal_context->decoder_cache != NULL )
+	{
+		safe_scratch_buffers_size += sizeof( libscca_lzxpress_huffman_decoder_cache_t );
+	}
+	*scratch_buffers_size = safe_scratch_buffers_size;
+
+	return( 1 );
+}
+
+/* Registers a file that uses the context
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_attach_file(
+     libscca_internal_context_t *internal_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_context_attach_file";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_context->number_of_files == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid context - number of files value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Unregisters a file that uses the context
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_detach_file(
+     libscca_internal_context_t *internal_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_context_detach_file";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_context->number_of_files <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context->number_of_files -= 1;
+
+	return( 1 );
+}
+
+/* Takes a scratch buffer from the context
+ * The buffer is set to NULL and its size to 0 if the context holds no buffer of the type
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_take_buffer(
+     libscca_internal_context_t *internal_context,
+     int buffer_type,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_context_take_buffer";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_type < 0 )
+	 || ( buffer_type >= LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer type.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = internal_context->buffers[ buffer_type ];
+	*buffer_size = internal_context->buffer_sizes[ buffer_type ];
+
+	internal_context->buffers[ buffer_type ]      = NULL;
+	internal_context->buffer_sizes[ buffer_type ] = 0;
+
+	return( 1 );
+}
+
+/* Releases a scratch buffer to the context
+ * The context keeps the largest buffer of every type and the other buffer is freed
+ * The buffer is set to NULL and its size to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_release_buffer(
+     libscca_internal_context_t *internal_context,
+     int buffer_type,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_context_release_buffer";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_type < 0 )
+	 || ( buffer_type >= LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported buffer type.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		*buffer_size = 0;
+
+		return( 1 );
+	}
+	if( *buffer_size > internal_context->buffer_sizes[ buffer_type ] )
+	{
+		if( internal_context->buffers[ buffer_type ] != NULL )
+		{
+			memory_free(
+			 internal_context->buffers[ buffer_type ] );
+		}
+		internal_context->buffers[ buffer_type ]      = *buffer;
+		internal_context->buffer_sizes[ buffer_type ] = *buffer_size;
+	}
+	else
+	{
+		memory_free(
+		 *buffer );
+	}
+	*buffer      = NULL;
+	*buffer_size = 0;
+
+	return( 1 );
+}
+
+/* Takes the Huffman decoder cache from the context
+ * The decoder cache is NULL if the context does not hold one
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_take_decoder_cache(
+     libscca_internal_context_t *internal_context,
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_context_take_decoder_cache";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder_cache = internal_context->decoder_cache;
+
+	internal_context->decoder_cache = NULL;
+
+	return( 1 );
+}
+
+/* Releases a Huffman decoder cache to the context
+ * The decoder cache is kept by the context if it does not hold one, otherwise it is freed,
+ * hence the decoders built for one file can be reused by the next file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_context_release_decoder_cache(
+     libscca_internal_context_t *internal_context,
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_context_release_decoder_cache";
+
+	if( internal_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder_cache == NULL )
+	{
+		return( 1 );
+	}
+	if( internal_context->decoder_cache == NULL )
+	{
+		internal_context->decoder_cache = *decoder_cache;
+		*decoder_cache                  = NULL;
+	}
+	else if( libscca_lzxpress_huffman_decoder_cache_free(
+	          decoder_cache,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
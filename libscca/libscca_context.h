@@ -0,0 +1,158 @@
+/*
+ * Context functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_CONTEXT_H )
+#define _LIBSCCA_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_lzxpress.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The scratch buffer types
+ */
+enum LIBSCCA_CONTEXT_BUFFER_TYPES
+{
+	LIBSCCA_CONTEXT_BUFFER_TYPE_COMPRESSED_DATA	= 0,
+	LIBSCCA_CONTEXT_BUFFER_TYPE_UNCOMPRESSED_DATA	= 1,
+	LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA	= 2
+};
+
+/* The number of scratch buffer types
+ */
+#define LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES		3
+
+typedef struct libscca_internal_context libscca_internal_context_t;
+
+struct libscca_internal_context
+{
+	/* The block cache that is set for every file created with the context
+	 * Contains NULL if not set
+	 */
+	libscca_block_cache_t *block_cache;
+
+	/* The string pool that is set for every file created with the context
+	 * Contains NULL if not set
+	 */
+	libscca_string_pool_t *string_pool;
+
+	/* The volume dictionary that is set for every file created with the context
+	 * Contains NULL if not set
+	 */
+	libscca_volume_dictionary_t *volume_dictionary;
+
+	/* The scratch buffers that are not in use by a file
+	 */
+	uint8_t *buffers[ LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES ];
+
+	/* The scratch buffer sizes
+	 */
+	size_t buffer_sizes[ LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES ];
+
+	/* The Huffman decoder cache that is not in use by a file
+	 * Contains NULL if not set
+	 */
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache;
+
+	/* The number of files that use the context
+	 */
+	int number_of_files;
+};
+
+LIBSCCA_EXTERN \
+int libscca_context_initialize(
+     libscca_context_t **context,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_context_free(
+     libscca_context_t **context,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_context_set_block_cache(
+     libscca_context_t *context,
+     libscca_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_context_set_string_pool(
+     libscca_context_t *context,
+     libscca_string_pool_t *string_pool,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_context_set_volume_dictionary(
+     libscca_context_t *context,
+     libscca_volume_dictionary_t *volume_dictionary,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_context_get_scratch_buffers_size(
+     libscca_context_t *context,
+     size_t *scratch_buffers_size,
+     libcerror_error_t **error );
+
+int libscca_context_attach_file(
+     libscca_internal_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libscca_context_detach_file(
+     libscca_internal_context_t *internal_context,
+     libcerror_error_t **error );
+
+int libscca_context_take_buffer(
+     libscca_internal_context_t *internal_context,
+     int buffer_type,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int libscca_context_release_buffer(
+     libscca_internal_context_t *internal_context,
+     int buffer_type,
+     uint8_t **buffer,
+     size_t *buffer_size,
+     libcerror_error_t **error );
+
+int libscca_context_take_decoder_cache(
+     libscca_internal_context_t *internal_context,
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error );
+
+int libscca_context_release_decoder_cache(
+     libscca_internal_context_t *internal_context,
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_CONTEXT_H ) */
+
@@ -0,0 +1,276 @@
+/*
+ * Processor feature functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_cpu.h"
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+#if defined( _MSC_VER )
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+#if defined( LIBSCCA_CPU_HAVE_NEON_KERNELS ) && defined( HAVE_SYS_AUXV_H ) && defined( HAVE_GETAUXVAL )
+#include <sys/auxv.h>
+#endif
+
+#if defined( _MSC_VER )
+#include <windows.h>
+#endif
+
+/* The features and the flag are accessed atomically, where the features are
+ * stored before the flag is set with release semantics and the flag is loaded
+ * with acquire semantics before the features are read
+ */
+#if defined( _MSC_VER )
+#define libscca_cpu_atomic_load( value ) \
+	(uint32_t) InterlockedCompareExchange( value, 0, 0 )
+
+#define libscca_cpu_atomic_store( value, new_value ) \
+	InterlockedExchange( value, (LONG) new_value )
+
+typedef LONG volatile libscca_cpu_atomic_t;
+
+#elif defined( __GNUC__ ) || defined( __clang__ )
+#define libscca_cpu_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libscca_cpu_atomic_store( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+typedef uint32_t libscca_cpu_atomic_t;
+
+#else
+#define libscca_cpu_atomic_load( value ) \
+	*( value )
+
+#define libscca_cpu_atomic_store( value, new_value ) \
+	*( value ) = new_value
+
+typedef uint32_t volatile libscca_cpu_atomic_t;
+
+#endif /* defined( _MSC_VER ) */
+
+/* The features of the processor, which are detected on first use
+ * Detection always results in the same value, hence concurrent first uses
+ * store the same features
+ */
+static libscca_cpu_atomic_t libscca_cpu_features = 0;
+
+static libscca_cpu_atomic_t libscca_cpu_features_are_set = 0;
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+
+/* Determines the features of an x86 processor
+ * The AVX2 and AVX-512 registers are only usable if the operating system saves them,
+ * which is indicated by the extended control register
+ * Returns the features
+ */
+uint32_t libscca_cpu_detect_x86_features(
+          void )
+{
+	uint64_t control_value = 0;
+	uint32_t features      = 0;
+
+#if defined( _MSC_VER )
+	int register_values[ 4 ];
+
+	__cpuid(
+	 register_values,
+	 0 );
+
+	if( register_values[ 0 ] < 1 )
+	{
+		return( 0 );
+	}
+	__cpuid(
+	 register_values,
+	 1 );
+
+	if( ( register_values[ 3 ] & ( 1 << 26 ) ) != 0 )
+	{
+		features |= LIBSCCA_CPU_FEATURE_SSE2;
+	}
+	if( ( register_values[ 2 ] & ( 1 << 27 ) ) == 0 )
+	{
+		return( features );
+	}
+	control_value = (uint64_t) _xgetbv(
+	                            0 );
+
+	__cpuid(
+	 register_values,
+	 0 );
+
+	if( register_values[ 0 ] < 7 )
+	{
+		return( features );
+	}
+	__cpuidex(
+	 register_values,
+	 7,
+	 0 );
+
+	if( ( ( control_value & 0x06 ) == 0x06 )
+	 && ( ( register_values[ 1 ] & ( 1 << 5 ) ) != 0 ) )
+	{
+		features |= LIBSCCA_CPU_FEATURE_AVX2;
+	}
+	if( ( ( control_value & 0xe6 ) == 0xe6 )
+	 && ( ( register_values[ 1 ] & ( 1 << 16 ) ) != 0 )
+	 && ( ( register_values[ 1 ] & ( 1 << 30 ) ) != 0 ) )
+	{
+		features |= LIBSCCA_CPU_FEATURE_AVX512BW;
+	}
+#else
+	unsigned int eax_value = 0;
+	unsigned int ebx_value = 0;
+	unsigned int ecx_value = 0;
+	unsigned int edx_value = 0;
+	uint32_t control_lower = 0;
+	uint32_t control_upper = 0;
+
+	if( __get_cpuid(
+	     1,
+	     &eax_value,
+	     &ebx_value,
+	     &ecx_value,
+	     &edx_value ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( edx_value & ( 1 << 26 ) ) != 0 )
+	{
+		features |= LIBSCCA_CPU_FEATURE_SSE2;
+	}
+	if( ( ecx_value & ( 1 << 27 ) ) == 0 )
+	{
+		return( features );
+	}
+	/* xgetbv is emitted directly so that the build does not require -mxsave
+	 */
+	__asm__ __volatile__(
+	 "xgetbv"
+	 : "=a" ( control_lower ), "=d" ( control_upper )
+	 : "c" ( 0 ) );
+
+	control_value = ( (uint64_t) control_upper << 32 ) | control_lower;
+
+	if( __get_cpuid_max(
+	     0,
+	     NULL ) < 7 )
+	{
+		return( features );
+	}
+	__cpuid_count(
+	 7,
+	 0,
+	 eax_value,
+	 ebx_value,
+	 ecx_value,
+	 edx_value );
+
+	if( ( ( control_value & 0x06 ) == 0x06 )
+	 && ( ( ebx_value & ( 1 << 5 ) ) != 0 ) )
+	{
+		features |= LIBSCCA_CPU_FEATURE_AVX2;
+	}
+	if( ( ( control_value & 0xe6 ) == 0xe6 )
+	 && ( ( ebx_value & ( 1 << 16 ) ) != 0 )
+	 && ( ( ebx_value & ( 1 << 30 ) ) != 0 ) )
+	{
+		features |= LIBSCCA_CPU_FEATURE_AVX512BW;
+	}
+#endif /* defined( _MSC_VER ) */
+
+	return( features );
+}
+
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+/* Determines the features of the processor that the vector kernels can use
+ * Features for which no kernels were compiled are not reported
+ * Returns the features
+ */
+uint32_t libscca_cpu_detect_features(
+          void )
+{
+	uint32_t features = 0;
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+	features = libscca_cpu_detect_x86_features();
+
+#elif defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+#if defined( HAVE_SYS_AUXV_H ) && defined( HAVE_GETAUXVAL ) && defined( HWCAP_ASIMD )
+	if( ( getauxval( AT_HWCAP ) & HWCAP_ASIMD ) != 0 )
+	{
+		features = LIBSCCA_CPU_FEATURE_NEON;
+	}
+#else
+	features = LIBSCCA_CPU_FEATURE_NEON;
+#endif
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+	return( features );
+}
+
+/* Retrieves the features of the processor that the vector kernels use
+ * Returns the features
+ */
+uint32_t libscca_cpu_get_features(
+          void )
+{
+	if( libscca_cpu_atomic_load(
+	     &libscca_cpu_features_are_set ) == 0 )
+	{
+		libscca_cpu_atomic_store(
+		 &libscca_cpu_features,
+		 libscca_cpu_detect_features() );
+
+		libscca_cpu_atomic_store(
+		 &libscca_cpu_features_are_set,
+		 1 );
+	}
+	return( libscca_cpu_atomic_load(
+	         &libscca_cpu_features ) );
+}
+
+/* Sets the features of the processor that the vector kernels use
+ * This restricts the kernels, for example to test the portable kernels,
+ * features that are not detected are ignored
+ */
+void libscca_cpu_set_features(
+      uint32_t features )
+{
+	libscca_cpu_atomic_store(
+	 &libscca_cpu_features,
+	 features & libscca_cpu_detect_features() );
+
+	libscca_cpu_atomic_store(
+	 &libscca_cpu_features_are_set,
+	 1 );
+}
+
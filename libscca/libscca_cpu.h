@@ -0,0 +1,90 @@
+/*
+ * Processor feature functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_CPU_H )
+#define _LIBSCCA_CPU_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The processor feature flags
+ */
+#define LIBSCCA_CPU_FEATURE_SSE2			0x00000001UL
+#define LIBSCCA_CPU_FEATURE_AVX2			0x00000002UL
+#define LIBSCCA_CPU_FEATURE_AVX512BW			0x00000004UL
+#define LIBSCCA_CPU_FEATURE_NEON			0x00000008UL
+
+/* The x86 vector kernels are compiled with a per function target, so that
+ * a build for the baseline instruction set still contains them
+ */
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( HAVE_CPUID_H ) && defined( HAVE_IMMINTRIN_H )
+#define LIBSCCA_CPU_HAVE_X86_KERNELS			1
+
+#define LIBSCCA_CPU_TARGET_SSE2				__attribute__((target("sse2")))
+#define LIBSCCA_CPU_TARGET_AVX2				__attribute__((target("avx2")))
+#define LIBSCCA_CPU_TARGET_AVX512BW			__attribute__((target("avx512f,avx512bw")))
+
+#elif defined( _MSC_VER ) && ( _MSC_VER >= 1600 ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#define LIBSCCA_CPU_HAVE_X86_KERNELS			1
+
+#define LIBSCCA_CPU_TARGET_SSE2
+#define LIBSCCA_CPU_TARGET_AVX2
+#define LIBSCCA_CPU_TARGET_AVX512BW
+
+#endif
+
+/* The NEON kernels are only used on little-endian 64-bit ARM, where NEON is part
+ * of the baseline instruction set
+ */
+#if defined( __aarch64__ ) && defined( __ARM_NEON ) && defined( HAVE_ARM_NEON_H ) && ( !defined( __BYTE_ORDER__ ) || ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ ) )
+#define LIBSCCA_CPU_HAVE_NEON_KERNELS			1
+
+#elif defined( _MSC_VER ) && defined( _M_ARM64 )
+#define LIBSCCA_CPU_HAVE_NEON_KERNELS			1
+
+#endif
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+
+uint32_t libscca_cpu_detect_x86_features(
+          void );
+
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+uint32_t libscca_cpu_detect_features(
+          void );
+
+uint32_t libscca_cpu_get_features(
+          void );
+
+void libscca_cpu_set_features(
+      uint32_t features );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_CPU_H ) */
+
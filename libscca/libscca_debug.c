@@ -33,6 +33,7 @@
 #include "libscca_libcnotify.h"
 #include "libscca_libfdatetime.h"
 #include "libscca_libuna.h"
+#include "libscca_memory.h"
 
 #if defined( HAVE_DEBUG_OUTPUT )
 
@@ -0,0 +1,1711 @@
+/*
+ * Diff functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_diff.h"
+#include "libscca_file.h"
+#include "libscca_file_metrics_values.h"
+#include "libscca_filename_strings.h"
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+#include "libscca_volume_information.h"
+#include "libscca_volumes.h"
+
+/* Creates a diff
+ * Make sure the value diff is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_diff_initialize(
+     libscca_diff_t **diff,
+     libcerror_error_t **error )
+{
+	libscca_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libscca_diff_initialize";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid diff value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = memory_allocate_structure(
+	                 libscca_internal_diff_t );
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_diff,
+	     0,
+	     sizeof( libscca_internal_diff_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear diff.",
+		 function );
+
+		memory_free(
+		 internal_diff );
+
+		return( -1 );
+	}
+	*diff = (libscca_diff_t *) internal_diff;
+
+	return( 1 );
+}
+
+/* Frees a diff
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_diff_free(
+     libscca_diff_t **diff,
+     libcerror_error_t **error )
+{
+	libscca_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libscca_diff_free";
+	int entry_type_index                   = 0;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( *diff != NULL )
+	{
+		internal_diff = (libscca_internal_diff_t *) *diff;
+		*diff         = NULL;
+
+		for( entry_type_index = 0;
+		     entry_type_index < LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES;
+		     entry_type_index++ )
+		{
+			if( internal_diff->entries[ entry_type_index ] != NULL )
+			{
+				memory_free(
+				 internal_diff->entries[ entry_type_index ] );
+			}
+		}
+		if( internal_diff->set_values != NULL )
+		{
+			libscca_internal_diff_clear_set_values(
+			 internal_diff,
+			 NULL );
+
+			memory_free(
+			 internal_diff->set_values );
+		}
+		if( internal_diff->hash_table != NULL )
+		{
+			memory_free(
+			 internal_diff->hash_table );
+		}
+		memory_free(
+		 internal_diff );
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_append_entry(
+     libscca_internal_diff_t *internal_diff,
+     int entry_type,
+     int volume_index,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libscca_diff_entry_t *entries = NULL;
+	static char *function         = "libscca_internal_diff_append_entry";
+	size_t entries_size           = 0;
+	int entry_type_index          = 0;
+	int number_of_entries         = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_type < LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME )
+	 || ( entry_type > LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry type.",
+		 function );
+
+		return( -1 );
+	}
+	entry_type_index = entry_type - 1;
+
+	if( internal_diff->number_of_entries[ entry_type_index ] >= internal_diff->number_of_allocated_entries[ entry_type_index ] )
+	{
+		number_of_entries = internal_diff->number_of_allocated_entries[ entry_type_index ];
+
+		if( number_of_entries == 0 )
+		{
+			number_of_entries = 16;
+		}
+		else if( number_of_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_entries *= 2;
+		}
+		entries_size = sizeof( libscca_diff_entry_t ) * (size_t) number_of_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entries size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libscca_diff_entry_t *) memory_reallocate(
+		                                    internal_diff->entries[ entry_type_index ],
+		                                    entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_diff->entries[ entry_type_index ]                     = entries;
+		internal_diff->number_of_allocated_entries[ entry_type_index ] = number_of_entries;
+	}
+	entries = internal_diff->entries[ entry_type_index ];
+
+	entries[ internal_diff->number_of_entries[ entry_type_index ] ].volume_index = volume_index;
+	entries[ internal_diff->number_of_entries[ entry_type_index ] ].item_index   = item_index;
+
+	internal_diff->number_of_entries[ entry_type_index ] += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of items of a file for a specific entry type
+ * The volume index is only used for directory strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_get_number_of_items(
+     libscca_internal_file_t *internal_file,
+     int entry_type,
+     int volume_index,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *volume_information = NULL;
+	static char *function                                     = "libscca_internal_diff_get_number_of_items";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of items.",
+		 function );
+
+		return( -1 );
+	}
+	switch( entry_type )
+	{
+		case LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME:
+		case LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_FILENAME:
+			if( libscca_filename_strings_get_number_of_filenames(
+			     internal_file->filename_strings,
+			     number_of_items,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of filenames.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILE_METRICS:
+		case LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_FILE_METRICS:
+			if( internal_file->file_metrics_values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid file - missing file metrics values.",
+				 function );
+
+				return( -1 );
+			}
+			*number_of_items = (int) internal_file->file_metrics_values->number_of_entries;
+
+			break;
+
+		case LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING:
+		case LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING:
+			if( libscca_volumes_get_volume_information_by_index(
+			     internal_file->volumes,
+			     volume_index,
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d information.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			if( volume_information == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing volume: %d information.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			*number_of_items = volume_information->number_of_directory_strings;
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported entry type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the raw UTF-16 little-endian string data and key of an item of a file
+ * for a specific entry type
+ * The volume index is only used for directory strings
+ * The data is referenced in the file and not copied, except for front-coded filenames
+ * which are decoded into decoded data that must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_get_item(
+     libscca_internal_file_t *internal_file,
+     int entry_type,
+     int volume_index,
+     int item_index,
+     const uint8_t **data,
+     size_t *data_size,
+     uint8_t **decoded_data,
+     uint64_t *key,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_values_t *file_metrics_values        = NULL;
+	libscca_internal_volume_information_t *volume_information = NULL;
+	static char *function                                     = "libscca_internal_diff_get_item";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	switch( entry_type )
+	{
+		case LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME:
+		case LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_FILENAME:
+			if( libscca_filename_strings_get_decoded_string_data(
+			     internal_file->filename_strings,
+			     item_index,
+			     data,
+			     data_size,
+			     decoded_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename: %d data.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			*key = 0;
+
+			break;
+
+		case LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILE_METRICS:
+		case LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_FILE_METRICS:
+			file_metrics_values = internal_file->file_metrics_values;
+
+			if( ( file_metrics_values == NULL )
+			 || ( item_index < 0 )
+			 || ( (uint32_t) item_index >= file_metrics_values->number_of_entries ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing file metrics: %d.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			/* A file metrics entry is identified by its filename and file reference,
+			 * where the filename is empty if the filenames were not read
+			 */
+			if( file_metrics_values->filename_indexes[ item_index ] >= 0 )
+			{
+				if( libscca_filename_strings_get_decoded_string_data(
+				     internal_file->filename_strings,
+				     file_metrics_values->filename_indexes[ item_index ],
+				     data,
+				     data_size,
+				     decoded_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve file metrics: %d filename data.",
+					 function,
+					 item_index );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				*data      = (const uint8_t *) "";
+				*data_size = 0;
+			}
+			*key = file_metrics_values->file_references[ item_index ];
+
+			break;
+
+		case LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING:
+		case LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING:
+			if( libscca_volumes_get_volume_information_by_index(
+			     internal_file->volumes,
+			     volume_index,
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d information.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			if( volume_information == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing volume: %d information.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			if( ( item_index < 0 )
+			 || ( item_index >= volume_information->number_of_directory_strings ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid item index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_internal_volume_information_get_directory_string_data(
+			     volume_information,
+			     item_index,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory string: %d data.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			*key = 0;
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported entry type.",
+			 function );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a set value
+ * The set value takes over the decoded data if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_append_set_value(
+     libscca_internal_diff_t *internal_diff,
+     uint64_t hash,
+     uint64_t key,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *decoded_data,
+     int volume_index,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libscca_diff_set_value_t *set_value  = NULL;
+	libscca_diff_set_value_t *set_values = NULL;
+	static char *function                = "libscca_internal_diff_append_set_value";
+	size_t set_values_size               = 0;
+	int number_of_set_values             = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_diff->number_of_set_values >= internal_diff->number_of_allocated_set_values )
+	{
+		number_of_set_values = internal_diff->number_of_allocated_set_values;
+
+		if( number_of_set_values == 0 )
+		{
+			number_of_set_values = 256;
+		}
+		else if( number_of_set_values > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of set values value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_set_values *= 2;
+		}
+		set_values_size = sizeof( libscca_diff_set_value_t ) * (size_t) number_of_set_values;
+
+		if( set_values_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid set values size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		set_values = (libscca_diff_set_value_t *) memory_reallocate(
+		                                           internal_diff->set_values,
+		                                           set_values_size );
+
+		if( set_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize set values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_diff->set_values                     = set_values;
+		internal_diff->number_of_allocated_set_values = number_of_set_values;
+	}
+	set_value = &( internal_diff->set_values[ internal_diff->number_of_set_values ] );
+
+	set_value->hash         = hash;
+	set_value->key          = key;
+	set_value->data         = data;
+	set_value->data_size    = data_size;
+	set_value->decoded_data = decoded_data;
+	set_value->volume_index = volume_index;
+	set_value->item_index   = item_index;
+	set_value->is_matched   = 0;
+
+	internal_diff->number_of_set_values += 1;
+
+	return( 1 );
+}
+
+/* Clears the set values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_clear_set_values(
+     libscca_internal_diff_t *internal_diff,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_diff_clear_set_values";
+	int set_value_index   = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	for( set_value_index = 0;
+	     set_value_index < internal_diff->number_of_set_values;
+	     set_value_index++ )
+	{
+		if( internal_diff->set_values[ set_value_index ].decoded_data != NULL )
+		{
+			memory_free(
+			 internal_diff->set_values[ set_value_index ].decoded_data );
+
+			internal_diff->set_values[ set_value_index ].decoded_data = NULL;
+		}
+	}
+	internal_diff->number_of_set_values = 0;
+
+	return( 1 );
+}
+
+/* Builds the hash table of the set values
+ * The hash table is resized when it has less than 2 entries per set value
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_build_hash_table(
+     libscca_internal_diff_t *internal_diff,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table      = NULL;
+	static char *function     = "libscca_internal_diff_build_hash_table";
+	uint32_t hash_table_index = 0;
+	uint32_t hash_table_size  = 0;
+	int set_value_index       = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_diff->number_of_set_values > (int) ( UINT32_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of set values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = LIBSCCA_DIFF_MINIMUM_HASH_TABLE_SIZE;
+
+	while( hash_table_size < ( 2 * (uint32_t) internal_diff->number_of_set_values ) )
+	{
+		hash_table_size *= 2;
+	}
+	if( hash_table_size > internal_diff->hash_table_size )
+	{
+		if( ( (size_t) hash_table_size * sizeof( uint32_t ) ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hash table size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		hash_table = (uint32_t *) memory_reallocate(
+		                           internal_diff->hash_table,
+		                           sizeof( uint32_t ) * (size_t) hash_table_size );
+
+		if( hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+		internal_diff->hash_table      = hash_table;
+		internal_diff->hash_table_size = hash_table_size;
+	}
+	if( memory_set(
+	     internal_diff->hash_table,
+	     0,
+	     sizeof( uint32_t ) * (size_t) internal_diff->hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	for( set_value_index = 0;
+	     set_value_index < internal_diff->number_of_set_values;
+	     set_value_index++ )
+	{
+		hash_table_index = (uint32_t) ( internal_diff->set_values[ set_value_index ].hash & ( internal_diff->hash_table_size - 1 ) );
+
+		while( internal_diff->hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & ( internal_diff->hash_table_size - 1 );
+		}
+		internal_diff->hash_table[ hash_table_index ] = (uint32_t) set_value_index + 1;
+	}
+	return( 1 );
+}
+
+/* Matches the set values that are equal to specific data and key
+ * All the equal set values are marked as matched
+ * Returns 1 if a set value matched or 0 if not
+ */
+int libscca_internal_diff_match_set_values(
+     libscca_internal_diff_t *internal_diff,
+     uint64_t hash,
+     uint64_t key,
+     const uint8_t *data,
+     size_t data_size )
+{
+	libscca_diff_set_value_t *set_value = NULL;
+	uint32_t hash_table_index           = 0;
+	int result                          = 0;
+
+	if( ( internal_diff == NULL )
+	 || ( internal_diff->hash_table == NULL )
+	 || ( internal_diff->hash_table_size == 0 ) )
+	{
+		return( 0 );
+	}
+	hash_table_index = (uint32_t) ( hash & ( internal_diff->hash_table_size - 1 ) );
+
+	while( internal_diff->hash_table[ hash_table_index ] != 0 )
+	{
+		set_value = &( internal_diff->set_values[ internal_diff->hash_table[ hash_table_index ] - 1 ] );
+
+		if( ( set_value->hash == hash )
+		 && ( set_value->key == key )
+		 && ( set_value->data_size == data_size )
+		 && ( memory_compare(
+		       set_value->data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			set_value->is_matched = 1;
+
+			result = 1;
+		}
+		hash_table_index = ( hash_table_index + 1 ) & ( internal_diff->hash_table_size - 1 );
+	}
+	return( result );
+}
+
+/* Compares the items of a specific entry type of two files
+ * The items of the previous file are stored in a hash set and the items of the file
+ * are looked up, where the entry type is the added entry type of the items
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_compare_items(
+     libscca_internal_diff_t *internal_diff,
+     libscca_internal_file_t *previous_internal_file,
+     libscca_internal_file_t *internal_file,
+     int entry_type,
+     libcerror_error_t **error )
+{
+	libscca_diff_set_value_t *set_value = NULL;
+	const uint8_t *data                 = NULL;
+	uint8_t *decoded_data               = NULL;
+	static char *function               = "libscca_internal_diff_compare_items";
+	size_t data_size                    = 0;
+	uint64_t hash                       = 0;
+	uint64_t key                        = 0;
+	int item_index                      = 0;
+	int number_of_items                 = 0;
+	int number_of_volumes               = 1;
+	int result                          = 0;
+	int set_value_index                 = 0;
+	int volume_index                    = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_type != LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME )
+	 && ( entry_type != LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILE_METRICS )
+	 && ( entry_type != LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_diff_clear_set_values(
+	     internal_diff,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear set values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only directory strings are stored per volume
+	 */
+	if( entry_type == LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING )
+	{
+		if( libscca_volumes_get_number_of_volumes(
+		     previous_internal_file->volumes,
+		     &number_of_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of volumes of previous file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_internal_diff_get_number_of_items(
+		     previous_internal_file,
+		     entry_type,
+		     volume_index,
+		     &number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items of previous file.",
+			 function );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( libscca_internal_diff_get_item(
+			     previous_internal_file,
+			     entry_type,
+			     volume_index,
+			     item_index,
+			     &data,
+			     &data_size,
+			     &decoded_data,
+			     &key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item: %d of previous file.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( libscca_hash_calculate_xxh64(
+			     data,
+			     data_size,
+			     key,
+			     &hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate hash of item: %d of previous file.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( libscca_internal_diff_append_set_value(
+			     internal_diff,
+			     hash,
+			     key,
+			     data,
+			     data_size,
+			     decoded_data,
+			     volume_index,
+			     item_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append set value.",
+				 function );
+
+				goto on_error;
+			}
+			decoded_data = NULL;
+		}
+	}
+	if( libscca_internal_diff_build_hash_table(
+	     internal_diff,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_type == LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING )
+	{
+		if( libscca_volumes_get_number_of_volumes(
+		     internal_file->volumes,
+		     &number_of_volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of volumes of file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_internal_diff_get_number_of_items(
+		     internal_file,
+		     entry_type,
+		     volume_index,
+		     &number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items of file.",
+			 function );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( libscca_internal_diff_get_item(
+			     internal_file,
+			     entry_type,
+			     volume_index,
+			     item_index,
+			     &data,
+			     &data_size,
+			     &decoded_data,
+			     &key,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item: %d of file.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( libscca_hash_calculate_xxh64(
+			     data,
+			     data_size,
+			     key,
+			     &hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to calculate hash of item: %d of file.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			result = libscca_internal_diff_match_set_values(
+			          internal_diff,
+			          hash,
+			          key,
+			          data,
+			          data_size );
+
+			if( decoded_data != NULL )
+			{
+				memory_free(
+				 decoded_data );
+
+				decoded_data = NULL;
+			}
+			if( result == 0 )
+			{
+				if( libscca_internal_diff_append_entry(
+				     internal_diff,
+				     entry_type,
+				     ( entry_type == LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING ) ? volume_index : -1,
+				     item_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append added entry.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	for( set_value_index = 0;
+	     set_value_index < internal_diff->number_of_set_values;
+	     set_value_index++ )
+	{
+		set_value = &( internal_diff->set_values[ set_value_index ] );
+
+		if( set_value->is_matched == 0 )
+		{
+			if( libscca_internal_diff_append_entry(
+			     internal_diff,
+			     entry_type + 1,
+			     ( entry_type == LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING ) ? set_value->volume_index : -1,
+			     set_value->item_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append removed entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The set values reference data of the previous file
+	 */
+	if( libscca_internal_diff_clear_set_values(
+	     internal_diff,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear set values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( decoded_data != NULL )
+	{
+		memory_free(
+		 decoded_data );
+	}
+	libscca_internal_diff_clear_set_values(
+	 internal_diff,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Compares the last run times of two files
+ * The last run times of the file that are more recent than the most recent
+ * last run time of the previous file are new
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_diff_compare_last_run_times(
+     libscca_internal_diff_t *internal_diff,
+     libscca_internal_file_t *previous_internal_file,
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function         = "libscca_internal_diff_compare_last_run_times";
+	uint64_t last_run_time        = 0;
+	uint64_t previous_run_time    = 0;
+	int last_run_time_index       = 0;
+	int number_of_last_run_times  = 0;
+
+	if( internal_diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( previous_internal_file == NULL )
+	 || ( previous_internal_file->io_handle == NULL )
+	 || ( previous_internal_file->file_information == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file == NULL )
+	 || ( internal_file->io_handle == NULL )
+	 || ( internal_file->file_information == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Format versions before 26 only store a single last run time
+	 */
+	if( previous_internal_file->io_handle->format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES;
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		if( previous_internal_file->file_information->last_run_time[ last_run_time_index ] > previous_run_time )
+		{
+			previous_run_time = previous_internal_file->file_information->last_run_time[ last_run_time_index ];
+		}
+	}
+	if( internal_file->io_handle->format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES;
+	}
+	internal_diff->number_of_new_last_run_times = 0;
+
+	for( last_run_time_index = 0;
+	     last_run_time_index < number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		last_run_time = internal_file->file_information->last_run_time[ last_run_time_index ];
+
+		if( last_run_time > previous_run_time )
+		{
+			internal_diff->new_last_run_times[ internal_diff->number_of_new_last_run_times++ ] = last_run_time;
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two versions of the same prefetch file
+ * The files can also be opened from snapshots, see libscca_file_open_snapshot
+ * Filenames, file metrics entries and directory strings are compared by their
+ * raw UTF-16 little-endian string data, where file metrics entries are also compared
+ * by their file reference, and the results of a previous compare are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_diff_compare(
+     libscca_diff_t *diff,
+     libscca_file_t *previous_file,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	libscca_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libscca_diff_compare";
+	int entry_type_index                   = 0;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libscca_internal_diff_t *) diff;
+
+	if( previous_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_type_index = 0;
+	     entry_type_index < LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES;
+	     entry_type_index++ )
+	{
+		internal_diff->number_of_entries[ entry_type_index ] = 0;
+	}
+	internal_diff->number_of_new_last_run_times = 0;
+
+	if( libscca_internal_diff_compare_last_run_times(
+	     internal_diff,
+	     (libscca_internal_file_t *) previous_file,
+	     (libscca_internal_file_t *) file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare last run times.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_diff_compare_items(
+	     internal_diff,
+	     (libscca_internal_file_t *) previous_file,
+	     (libscca_internal_file_t *) file,
+	     LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_diff_compare_items(
+	     internal_diff,
+	     (libscca_internal_file_t *) previous_file,
+	     (libscca_internal_file_t *) file,
+	     LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILE_METRICS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_diff_compare_items(
+	     internal_diff,
+	     (libscca_internal_file_t *) previous_file,
+	     (libscca_internal_file_t *) file,
+	     LIBSCCA_DIFF_ENTRY_TYPE_ADDED_DIRECTORY_STRING,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare directory strings.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	for( entry_type_index = 0;
+	     entry_type_index < LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES;
+	     entry_type_index++ )
+	{
+		internal_diff->number_of_entries[ entry_type_index ] = 0;
+	}
+	libscca_internal_diff_clear_set_values(
+	 internal_diff,
+	 NULL );
+
+	internal_diff->number_of_new_last_run_times = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of entries of a specific entry type
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_diff_get_number_of_entries(
+     libscca_diff_t *diff,
+     int entry_type,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libscca_diff_get_number_of_entries";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libscca_internal_diff_t *) diff;
+
+	if( ( entry_type < LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME )
+	 || ( entry_type > LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_diff->number_of_entries[ entry_type - 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry of a specific entry type
+ * The item index is the index of the filename, file metrics entry or directory string
+ * in the file for added entries and in the previous file for removed entries
+ * The volume index is -1 for entries that are not directory strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_diff_get_entry(
+     libscca_diff_t *diff,
+     int entry_type,
+     int entry_index,
+     int *volume_index,
+     int *item_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libscca_diff_get_entry";
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libscca_internal_diff_t *) diff;
+
+	if( ( entry_type < LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME )
+	 || ( entry_type > LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_diff->number_of_entries[ entry_type - 1 ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item index.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_index = internal_diff->entries[ entry_type - 1 ][ entry_index ].volume_index;
+	*item_index   = internal_diff->entries[ entry_type - 1 ][ entry_index ].item_index;
+
+	return( 1 );
+}
+
+/* Retrieves the new last run times
+ * The new last run times are the last run times of the file that are more recent
+ * than the most recent last run time of the previous file
+ * The maximum number of filetimes must be at least LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_diff_get_new_last_run_times(
+     libscca_diff_t *diff,
+     uint64_t *filetimes,
+     int maximum_number_of_filetimes,
+     int *number_of_filetimes,
+     libcerror_error_t **error )
+{
+	libscca_internal_diff_t *internal_diff = NULL;
+	static char *function                  = "libscca_diff_get_new_last_run_times";
+	int last_run_time_index                = 0;
+
+	if( diff == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid diff.",
+		 function );
+
+		return( -1 );
+	}
+	internal_diff = (libscca_internal_diff_t *) diff;
+
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_filetimes < LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum number of filetimes value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < internal_diff->number_of_new_last_run_times;
+	     last_run_time_index++ )
+	{
+		filetimes[ last_run_time_index ] = internal_diff->new_last_run_times[ last_run_time_index ];
+	}
+	*number_of_filetimes = internal_diff->number_of_new_last_run_times;
+
+	return( 1 );
+}
+
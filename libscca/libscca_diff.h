@@ -0,0 +1,255 @@
+/*
+ * Diff functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_DIFF_H )
+#define _LIBSCCA_DIFF_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_extern.h"
+#include "libscca_file.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of diff entry types
+ */
+#define LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES		6
+
+/* The minimum number of hash table entries
+ */
+#define LIBSCCA_DIFF_MINIMUM_HASH_TABLE_SIZE		64
+
+typedef struct libscca_diff_entry libscca_diff_entry_t;
+
+struct libscca_diff_entry
+{
+	/* The volume index
+	 * Contains -1 if the entry is not a directory string
+	 */
+	int volume_index;
+
+	/* The index of the filename, file metrics entry or directory string
+	 */
+	int item_index;
+};
+
+typedef struct libscca_diff_set_value libscca_diff_set_value_t;
+
+struct libscca_diff_set_value
+{
+	/* The XXH64 hash of the data and key
+	 */
+	uint64_t hash;
+
+	/* The key, which is the file reference of a file metrics entry and 0 otherwise
+	 */
+	uint64_t key;
+
+	/* The raw UTF-16 little-endian string data
+	 * The data is referenced in the previous file and not copied
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The decoded data, which contains the data of a front-coded filename
+	 * Contains NULL if the data is referenced
+	 */
+	uint8_t *decoded_data;
+
+	/* The volume index
+	 */
+	int volume_index;
+
+	/* The item index
+	 */
+	int item_index;
+
+	/* Value to indicate the value is contained in both files
+	 */
+	uint8_t is_matched;
+};
+
+typedef struct libscca_internal_diff libscca_internal_diff_t;
+
+struct libscca_internal_diff
+{
+	/* The entries per entry type
+	 */
+	libscca_diff_entry_t *entries[ LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES ];
+
+	/* The number of entries per entry type
+	 */
+	int number_of_entries[ LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES ];
+
+	/* The number of allocated entries per entry type
+	 */
+	int number_of_allocated_entries[ LIBSCCA_DIFF_NUMBER_OF_ENTRY_TYPES ];
+
+	/* The set values of the previous file
+	 */
+	libscca_diff_set_value_t *set_values;
+
+	/* The number of set values
+	 */
+	int number_of_set_values;
+
+	/* The number of allocated set values
+	 */
+	int number_of_allocated_set_values;
+
+	/* The hash table of the set values
+	 * Contains the set value index + 1 or 0 if the entry is not used
+	 */
+	uint32_t *hash_table;
+
+	/* The number of hash table entries, which is a power of 2
+	 */
+	uint32_t hash_table_size;
+
+	/* The last run times that are more recent than those of the previous file
+	 */
+	uint64_t new_last_run_times[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	/* The number of new last run times
+	 */
+	int number_of_new_last_run_times;
+};
+
+LIBSCCA_EXTERN \
+int libscca_diff_initialize(
+     libscca_diff_t **diff,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_diff_free(
+     libscca_diff_t **diff,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_append_entry(
+     libscca_internal_diff_t *internal_diff,
+     int entry_type,
+     int volume_index,
+     int item_index,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_get_number_of_items(
+     libscca_internal_file_t *internal_file,
+     int entry_type,
+     int volume_index,
+     int *number_of_items,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_get_item(
+     libscca_internal_file_t *internal_file,
+     int entry_type,
+     int volume_index,
+     int item_index,
+     const uint8_t **data,
+     size_t *data_size,
+     uint8_t **decoded_data,
+     uint64_t *key,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_append_set_value(
+     libscca_internal_diff_t *internal_diff,
+     uint64_t hash,
+     uint64_t key,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *decoded_data,
+     int volume_index,
+     int item_index,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_clear_set_values(
+     libscca_internal_diff_t *internal_diff,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_build_hash_table(
+     libscca_internal_diff_t *internal_diff,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_match_set_values(
+     libscca_internal_diff_t *internal_diff,
+     uint64_t hash,
+     uint64_t key,
+     const uint8_t *data,
+     size_t data_size );
+
+int libscca_internal_diff_compare_items(
+     libscca_internal_diff_t *internal_diff,
+     libscca_internal_file_t *previous_internal_file,
+     libscca_internal_file_t *internal_file,
+     int entry_type,
+     libcerror_error_t **error );
+
+int libscca_internal_diff_compare_last_run_times(
+     libscca_internal_diff_t *internal_diff,
+     libscca_internal_file_t *previous_internal_file,
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_diff_compare(
+     libscca_diff_t *diff,
+     libscca_file_t *previous_file,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_diff_get_number_of_entries(
+     libscca_diff_t *diff,
+     int entry_type,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_diff_get_entry(
+     libscca_diff_t *diff,
+     int entry_type,
+     int entry_index,
+     int *volume_index,
+     int *item_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_diff_get_new_last_run_times(
+     libscca_diff_t *diff,
+     uint64_t *filetimes,
+     int maximum_number_of_filetimes,
+     int *number_of_filetimes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_DIFF_H ) */
+
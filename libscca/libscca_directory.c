@@ -0,0 +1,4032 @@
+/*
+ * Prefetch directory functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#include <errno.h>
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "libscca_definitions.h"
+#include "libscca_directory.h"
+#include "libscca_file.h"
+#include "libscca_file_header.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+#include "libscca_string_pool.h"
+#include "libscca_upcase.h"
+#include "libscca_utf16_stream.h"
+#include "libscca_volume_dictionary.h"
+#include "libscca_volume_information.h"
+#include "libscca_watcher.h"
+
+#if defined( WINAPI )
+#define LIBSCCA_DIRECTORY_PATH_SEPARATOR	'\\'
+#else
+#define LIBSCCA_DIRECTORY_PATH_SEPARATOR	'/'
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_DIRENT_H ) && defined( HAVE_OPENDIR ) && defined( HAVE_READDIR ) && defined( HAVE_CLOSEDIR )
+#define LIBSCCA_DIRECTORY_HAVE_OPENDIR	1
+#endif
+
+/* Creates a directory
+ * Make sure the value directory is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_initialize(
+     libscca_directory_t **directory,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_initialize";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = memory_allocate_structure(
+	                      libscca_internal_directory_t );
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_directory,
+	     0,
+	     sizeof( libscca_internal_directory_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory.",
+		 function );
+
+		memory_free(
+		 internal_directory );
+
+		return( -1 );
+	}
+	if( libscca_string_pool_initialize(
+	     &( internal_directory->string_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_volume_dictionary_initialize(
+	     &( internal_directory->volume_dictionary ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	*directory = (libscca_directory_t *) internal_directory;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory != NULL )
+	{
+		if( internal_directory->string_pool != NULL )
+		{
+			libscca_string_pool_free(
+			 &( internal_directory->string_pool ),
+			 NULL );
+		}
+		memory_free(
+		 internal_directory );
+	}
+	return( -1 );
+}
+
+/* Frees a directory
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_free(
+     libscca_directory_t **directory,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_free";
+	int result                                       = 1;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		internal_directory = (libscca_internal_directory_t *) *directory;
+		*directory         = NULL;
+
+		if( libscca_volume_dictionary_free(
+		     &( internal_directory->volume_dictionary ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume dictionary.",
+			 function );
+
+			result = -1;
+		}
+		if( libscca_string_pool_free(
+		     &( internal_directory->string_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string pool.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_directory->string_hashes != NULL )
+		{
+			memory_free(
+			 internal_directory->string_hashes );
+		}
+		if( internal_directory->executables != NULL )
+		{
+			memory_free(
+			 internal_directory->executables );
+		}
+		if( internal_directory->labels_data != NULL )
+		{
+			memory_free(
+			 internal_directory->labels_data );
+		}
+		if( internal_directory->run_times != NULL )
+		{
+			memory_free(
+			 internal_directory->run_times );
+		}
+		if( internal_directory->volume_identifiers != NULL )
+		{
+			memory_free(
+			 internal_directory->volume_identifiers );
+		}
+		if( internal_directory->start_times != NULL )
+		{
+			memory_free(
+			 internal_directory->start_times );
+		}
+		if( internal_directory->durations != NULL )
+		{
+			memory_free(
+			 internal_directory->durations );
+		}
+		if( internal_directory->flags != NULL )
+		{
+			memory_free(
+			 internal_directory->flags );
+		}
+		if( internal_directory->file_references != NULL )
+		{
+			memory_free(
+			 internal_directory->file_references );
+		}
+		if( internal_directory->string_identifiers != NULL )
+		{
+			memory_free(
+			 internal_directory->string_identifiers );
+		}
+		memory_free(
+		 internal_directory );
+	}
+	return( result );
+}
+
+/* Resizes a column
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_resize_column(
+     uint8_t **column,
+     size_t value_size,
+     uint32_t number_of_values,
+     libcerror_error_t **error )
+{
+	uint8_t *resized_column = NULL;
+	static char *function   = "libscca_directory_resize_column";
+	size_t column_size      = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_size == 0 )
+	 || ( number_of_values == 0 )
+	 || ( (size_t) number_of_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / value_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	column_size = value_size * (size_t) number_of_values;
+
+	resized_column = (uint8_t *) memory_reallocate(
+	                              *column,
+	                              column_size );
+
+	if( resized_column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize column.",
+		 function );
+
+		return( -1 );
+	}
+	*column = resized_column;
+
+	return( 1 );
+}
+
+/* Determines the number of values to allocate to contain a number of values
+ * The number of allocated values is doubled until it is sufficient, so that
+ * appending values has an amortized constant cost
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_allocation_size(
+     uint32_t number_of_allocated_values,
+     uint32_t number_of_values,
+     uint32_t *allocation_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_directory_get_allocation_size";
+	uint32_t safe_allocation_size = 0;
+
+	if( allocation_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_allocation_size = number_of_allocated_values;
+
+	if( safe_allocation_size == 0 )
+	{
+		safe_allocation_size = 16;
+	}
+	while( safe_allocation_size < number_of_values )
+	{
+		safe_allocation_size *= 2;
+	}
+	*allocation_size = safe_allocation_size;
+
+	return( 1 );
+}
+
+/* Makes sure the executables can contain a number of executables
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_reserve_executables(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_executables,
+     libcerror_error_t **error )
+{
+	static char *function    = "libscca_internal_directory_reserve_executables";
+	uint32_t allocation_size = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_executables <= internal_directory->number_of_allocated_executables )
+	{
+		return( 1 );
+	}
+	if( libscca_directory_get_allocation_size(
+	     internal_directory->number_of_allocated_executables,
+	     number_of_executables,
+	     &allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of executables to allocate.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->executables ),
+	     sizeof( libscca_directory_executable_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize executables.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->number_of_allocated_executables = allocation_size;
+
+	return( 1 );
+}
+
+/* Makes sure the run times column can contain a number of run times
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_reserve_run_times(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_run_times,
+     libcerror_error_t **error )
+{
+	static char *function    = "libscca_internal_directory_reserve_run_times";
+	uint32_t allocation_size = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_run_times <= internal_directory->number_of_allocated_run_times )
+	{
+		return( 1 );
+	}
+	if( libscca_directory_get_allocation_size(
+	     internal_directory->number_of_allocated_run_times,
+	     number_of_run_times,
+	     &allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of run times to allocate.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->run_times ),
+	     sizeof( uint64_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize run times.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->number_of_allocated_run_times = allocation_size;
+
+	return( 1 );
+}
+
+/* Makes sure the volume identifiers column can contain a number of volume identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_reserve_volume_identifiers(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_volume_identifiers,
+     libcerror_error_t **error )
+{
+	static char *function    = "libscca_internal_directory_reserve_volume_identifiers";
+	uint32_t allocation_size = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volume_identifiers <= internal_directory->number_of_allocated_volume_identifiers )
+	{
+		return( 1 );
+	}
+	if( libscca_directory_get_allocation_size(
+	     internal_directory->number_of_allocated_volume_identifiers,
+	     number_of_volume_identifiers,
+	     &allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of volume identifiers to allocate.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->volume_identifiers ),
+	     sizeof( uint32_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize volume identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->number_of_allocated_volume_identifiers = allocation_size;
+
+	return( 1 );
+}
+
+/* Makes sure the file metrics columns can contain a number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_reserve_file_metrics_entries(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function    = "libscca_internal_directory_reserve_file_metrics_entries";
+	uint32_t allocation_size = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries <= internal_directory->number_of_allocated_file_metrics_entries )
+	{
+		return( 1 );
+	}
+	if( libscca_directory_get_allocation_size(
+	     internal_directory->number_of_allocated_file_metrics_entries,
+	     number_of_entries,
+	     &allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of file metrics entries to allocate.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of allocated entries is only updated when all columns were resized
+	 */
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->start_times ),
+	     sizeof( uint32_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize start times.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->durations ),
+	     sizeof( uint32_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize durations.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->flags ),
+	     sizeof( uint32_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->file_references ),
+	     sizeof( uint64_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize file references.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_directory_resize_column(
+	     (uint8_t **) &( internal_directory->string_identifiers ),
+	     sizeof( uint32_t ),
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory->number_of_allocated_file_metrics_entries = allocation_size;
+
+	return( 1 );
+}
+
+/* Appends an UTF-8 encoded label to the labels data
+ * A label of NULL is stored as an empty string
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_append_label(
+     libscca_internal_directory_t *internal_directory,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     size_t *label_offset,
+     size_t *label_size,
+     libcerror_error_t **error )
+{
+	uint8_t *labels_data      = NULL;
+	static char *function     = "libscca_internal_directory_append_label";
+	size_t allocation_size    = 0;
+	size_t safe_label_size    = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_label == NULL )
+	{
+		utf8_label_length = 0;
+	}
+	if( utf8_label_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 label length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( label_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid label offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( label_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid label size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_label_size = utf8_label_length + 1;
+
+	if( safe_label_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_directory->labels_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid labels data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_directory->labels_data_size + safe_label_size ) > internal_directory->allocated_labels_data_size )
+	{
+		allocation_size = internal_directory->allocated_labels_data_size;
+
+		if( allocation_size == 0 )
+		{
+			allocation_size = 1024;
+		}
+		while( allocation_size < ( internal_directory->labels_data_size + safe_label_size ) )
+		{
+			if( allocation_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocation_size = internal_directory->labels_data_size + safe_label_size;
+
+				break;
+			}
+			allocation_size *= 2;
+		}
+		labels_data = (uint8_t *) memory_reallocate(
+		                           internal_directory->labels_data,
+		                           allocation_size );
+
+		if( labels_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize labels data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_directory->labels_data                = labels_data;
+		internal_directory->allocated_labels_data_size = allocation_size;
+	}
+	if( utf8_label_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_directory->labels_data[ internal_directory->labels_data_size ] ),
+		     utf8_label,
+		     utf8_label_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy label.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_directory->labels_data[ internal_directory->labels_data_size + utf8_label_length ] = 0;
+
+	*label_offset = internal_directory->labels_data_size;
+	*label_size   = safe_label_size;
+
+	internal_directory->labels_data_size += safe_label_size;
+
+	return( 1 );
+}
+
+/* Interns an UTF-16 little-endian string
+ * The case folded hash of the string is calculated when the string is added
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_intern_string(
+     libscca_internal_directory_t *internal_directory,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	static char *function            = "libscca_internal_directory_intern_string";
+	uint32_t allocation_size         = 0;
+	uint32_t number_of_strings       = 0;
+	uint32_t safe_string_identifier  = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string identifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string pool is not shared, hence its entries do not change while
+	 * the string is interned
+	 */
+	number_of_strings = ( (libscca_internal_string_pool_t *) internal_directory->string_pool )->number_of_entries;
+
+	if( libscca_string_pool_intern_string(
+	     internal_directory->string_pool,
+	     utf16_stream,
+	     utf16_stream_size,
+	     &safe_string_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to intern string.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_string_identifier >= number_of_strings )
+	{
+		if( safe_string_identifier >= internal_directory->number_of_allocated_string_hashes )
+		{
+			if( libscca_directory_get_allocation_size(
+			     internal_directory->number_of_allocated_string_hashes,
+			     safe_string_identifier + 1,
+			     &allocation_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine number of string hashes to allocate.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_directory_resize_column(
+			     (uint8_t **) &( internal_directory->string_hashes ),
+			     sizeof( uint64_t ),
+			     allocation_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize string hashes.",
+				 function );
+
+				return( -1 );
+			}
+			internal_directory->number_of_allocated_string_hashes = allocation_size;
+		}
+		if( libscca_upcase_calculate_hash_utf16_stream(
+		     utf16_stream,
+		     utf16_stream_size,
+		     &( internal_directory->string_hashes[ safe_string_identifier ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate case folded hash of string: %" PRIu32 ".",
+			 function,
+			 safe_string_identifier );
+
+			return( -1 );
+		}
+	}
+	*string_identifier = safe_string_identifier;
+
+	return( 1 );
+}
+
+/* Appends the file metrics entries of a file to the file metrics columns
+ * The filenames of the file metrics entries are interned when they are first referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_append_file_metrics_entries(
+     libscca_internal_directory_t *internal_directory,
+     libscca_file_t *file,
+     libscca_directory_executable_t *executable,
+     libcerror_error_t **error )
+{
+	const uint8_t *utf16_stream           = NULL;
+	static char *function                 = "libscca_internal_directory_append_file_metrics_entries";
+	size_t utf16_stream_size              = 0;
+	uint32_t first_entry_index            = 0;
+	uint32_t *filename_string_identifiers = NULL;
+	int *filename_indexes                 = NULL;
+	int entry_index                       = 0;
+	int filename_index                    = 0;
+	int number_of_entries                 = 0;
+	int number_of_filenames               = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_filenames(
+	     file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	first_entry_index = internal_directory->number_of_file_metrics_entries;
+
+	executable->first_file_metrics_entry_index = first_entry_index;
+	executable->number_of_file_metrics_entries = 0;
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( (uint32_t) number_of_entries > ( (uint32_t) INT_MAX - first_entry_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file metrics entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_directory_reserve_file_metrics_entries(
+	     internal_directory,
+	     first_entry_index + (uint32_t) number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	filename_indexes = (int *) memory_allocate(
+	                            sizeof( int ) * (size_t) number_of_entries );
+
+	if( filename_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_file_metrics_table(
+	     file,
+	     &( internal_directory->start_times[ first_entry_index ] ),
+	     &( internal_directory->durations[ first_entry_index ] ),
+	     &( internal_directory->flags[ first_entry_index ] ),
+	     &( internal_directory->file_references[ first_entry_index ] ),
+	     filename_indexes,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file metrics table.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_filenames > 0 )
+	{
+		filename_string_identifiers = (uint32_t *) memory_allocate(
+		                                            sizeof( uint32_t ) * (size_t) number_of_filenames );
+
+		if( filename_string_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename string identifiers.",
+			 function );
+
+			goto on_error;
+		}
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			filename_string_identifiers[ filename_index ] = LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		filename_index = filename_indexes[ entry_index ];
+
+		if( ( filename_index >= 0 )
+		 && ( filename_index < number_of_filenames )
+		 && ( filename_string_identifiers[ filename_index ] == LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET ) )
+		{
+			if( libscca_file_get_utf16_filename_stream(
+			     file,
+			     filename_index,
+			     &utf16_stream,
+			     &utf16_stream_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename: %d.",
+				 function,
+				 filename_index );
+
+				goto on_error;
+			}
+			if( utf16_stream_size > 0 )
+			{
+				if( libscca_internal_directory_intern_string(
+				     internal_directory,
+				     utf16_stream,
+				     utf16_stream_size,
+				     &( filename_string_identifiers[ filename_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to intern filename: %d.",
+					 function,
+					 filename_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( ( filename_index >= 0 )
+		 && ( filename_index < number_of_filenames ) )
+		{
+			internal_directory->string_identifiers[ first_entry_index + entry_index ] = filename_string_identifiers[ filename_index ];
+		}
+		else
+		{
+			internal_directory->string_identifiers[ first_entry_index + entry_index ] = LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET;
+		}
+	}
+	if( filename_string_identifiers != NULL )
+	{
+		memory_free(
+		 filename_string_identifiers );
+	}
+	memory_free(
+	 filename_indexes );
+
+	executable->number_of_file_metrics_entries = (uint32_t) number_of_entries;
+
+	internal_directory->number_of_file_metrics_entries += (uint32_t) number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( filename_string_identifiers != NULL )
+	{
+		memory_free(
+		 filename_string_identifiers );
+	}
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	return( -1 );
+}
+
+/* Appends the volumes of a file to the volume identifiers column
+ * Every distinct volume is stored once in the volume dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_append_volumes(
+     libscca_internal_directory_t *internal_directory,
+     libscca_file_t *file,
+     libscca_directory_executable_t *executable,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	const uint8_t *utf16_stream                      = NULL;
+	static char *function                            = "libscca_internal_directory_append_volumes";
+	size_t utf16_stream_size                         = 0;
+	uint64_t creation_time                           = 0;
+	uint32_t first_volume_index                      = 0;
+	uint32_t serial_number                           = 0;
+	uint32_t volume_identifier                       = 0;
+	int number_of_volumes                            = 0;
+	int volume_index                                 = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_volumes(
+	     file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	first_volume_index = internal_directory->number_of_volume_identifiers;
+
+	executable->first_volume_index = first_volume_index;
+	executable->number_of_volumes  = 0;
+
+	if( number_of_volumes == 0 )
+	{
+		return( 1 );
+	}
+	if( (uint32_t) number_of_volumes > ( (uint32_t) INT_MAX - first_volume_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_directory_reserve_volume_identifiers(
+	     internal_directory,
+	     first_volume_index + (uint32_t) number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve volume identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_utf16_device_path_stream(
+		     volume_information,
+		     &utf16_stream,
+		     &utf16_stream_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d device path.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_serial_number(
+		     volume_information,
+		     &serial_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d serial number.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_creation_time(
+		     volume_information,
+		     &creation_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d creation time.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_dictionary_get_volume_identifier(
+		     internal_directory->volume_dictionary,
+		     ( utf16_stream_size > 0 ) ? utf16_stream : NULL,
+		     utf16_stream_size,
+		     serial_number,
+		     creation_time,
+		     &volume_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d identifier.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		internal_directory->volume_identifiers[ first_volume_index + volume_index ] = volume_identifier;
+
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	executable->number_of_volumes = (uint32_t) number_of_volumes;
+
+	internal_directory->number_of_volume_identifiers += (uint32_t) number_of_volumes;
+
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a file to the directory
+ * The values of the file are copied into the directory, hence the file can be
+ * closed once it has been appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_append_file(
+     libscca_directory_t *directory,
+     libscca_file_t *file,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	libscca_internal_file_t *internal_file           = NULL;
+	static char *function                            = "libscca_directory_append_file";
+	size_t labels_data_size                          = 0;
+	uint32_t number_of_file_metrics_entries          = 0;
+	uint32_t number_of_run_times                     = 0;
+	uint32_t number_of_volume_identifiers            = 0;
+	int number_of_filetimes                          = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory->number_of_executables >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of executables value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sizes of the columns are restored when the file cannot be appended
+	 */
+	labels_data_size               = internal_directory->labels_data_size;
+	number_of_file_metrics_entries = internal_directory->number_of_file_metrics_entries;
+	number_of_run_times            = internal_directory->number_of_run_times;
+	number_of_volume_identifiers   = internal_directory->number_of_volume_identifiers;
+
+	if( libscca_internal_directory_reserve_executables(
+	     internal_directory,
+	     internal_directory->number_of_executables + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve executable.",
+		 function );
+
+		goto on_error;
+	}
+	executable = &( internal_directory->executables[ internal_directory->number_of_executables ] );
+
+	if( memory_set(
+	     executable,
+	     0,
+	     sizeof( libscca_directory_executable_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear executable.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_directory_append_label(
+	     internal_directory,
+	     utf8_label,
+	     utf8_label_length,
+	     &( executable->label_offset ),
+	     &( executable->label_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append label.",
+		 function );
+
+		goto on_error;
+	}
+	executable->executable_filename_string_identifier = LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET;
+
+	if( internal_file->file_header->executable_filename_size > 0 )
+	{
+		if( libscca_internal_directory_intern_string(
+		     internal_directory,
+		     internal_file->file_header->executable_filename,
+		     internal_file->file_header->executable_filename_size,
+		     &( executable->executable_filename_string_identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to intern executable filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &( executable->prefetch_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_format_version(
+	     file,
+	     &( executable->format_version ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_run_count(
+	     file,
+	     &( executable->run_count ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_directory_reserve_run_times(
+	     internal_directory,
+	     number_of_run_times + LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve run times.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_last_run_times(
+	     file,
+	     &( internal_directory->run_times[ number_of_run_times ] ),
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		goto on_error;
+	}
+	executable->first_run_time_index = number_of_run_times;
+	executable->number_of_run_times  = (uint32_t) number_of_filetimes;
+
+	if( libscca_internal_directory_append_file_metrics_entries(
+	     internal_directory,
+	     file,
+	     executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_directory_append_volumes(
+	     internal_directory,
+	     file,
+	     executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append volumes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory->number_of_run_times   += (uint32_t) number_of_filetimes;
+	internal_directory->number_of_executables += 1;
+
+	return( 1 );
+
+on_error:
+	internal_directory->labels_data_size               = labels_data_size;
+	internal_directory->number_of_file_metrics_entries = number_of_file_metrics_entries;
+	internal_directory->number_of_run_times            = number_of_run_times;
+	internal_directory->number_of_volume_identifiers   = number_of_volume_identifiers;
+
+	return( -1 );
+}
+
+/* Opens a file in a directory and appends it to the directory
+ * The name of the file is used as its label
+ * A file that cannot be opened is counted as a failed file
+ * Returns 1 if successful, 0 if the file could not be opened or -1 on error
+ */
+int libscca_internal_directory_append_path(
+     libscca_internal_directory_t *internal_directory,
+     libscca_file_t *file,
+     const char *directory_path,
+     size_t directory_path_length,
+     const char *name,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *open_error = NULL;
+	char *path                    = NULL;
+	static char *function         = "libscca_internal_directory_append_path";
+	size_t name_length            = 0;
+	size_t path_size              = 0;
+	int result                    = 0;
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	if( ( directory_path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) )
+	 || ( name_length > ( (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 2 ) - directory_path_length ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	path_size = directory_path_length + 1 + name_length + 1;
+
+	path = narrow_string_allocate(
+	        path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     path,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	path[ directory_path_length ] = LIBSCCA_DIRECTORY_PATH_SEPARATOR;
+
+	if( memory_copy(
+	     &( path[ directory_path_length + 1 ] ),
+	     name,
+	     name_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	/* A file that is corrupt or was removed after the directory was read does not
+	 * stop the other files from being appended
+	 */
+	if( libscca_file_open(
+	     file,
+	     path,
+	     LIBSCCA_OPEN_READ,
+	     &open_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &open_error );
+
+		internal_directory->number_of_failed_files += 1;
+	}
+	else
+	{
+		result = libscca_directory_append_file(
+		          (libscca_directory_t *) internal_directory,
+		          file,
+		          (uint8_t *) name,
+		          name_length,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file: %s.",
+			 function,
+			 path );
+
+			libscca_file_close(
+			 file,
+			 NULL );
+
+			goto on_error;
+		}
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file: %s.",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 path );
+
+	return( result );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Opens the prefetch files in a directory
+ * Every file with the prefetch file (.pf) extension in the directory is parsed and appended,
+ * the sub directories are not read. The files are appended in the order of the directory entries
+ * A file that cannot be opened does not cause the function to fail, instead it is
+ * counted, see libscca_directory_get_number_of_failed_files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_open(
+     libscca_directory_t *directory,
+     const char *directory_path,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	WIN32_FIND_DATAA find_data;
+
+	HANDLE find_handle                               = INVALID_HANDLE_VALUE;
+	char *search_pattern                             = NULL;
+
+#elif defined( LIBSCCA_DIRECTORY_HAVE_OPENDIR )
+	struct dirent *directory_entry                   = NULL;
+	DIR *directory_stream                            = NULL;
+#endif
+	libscca_file_t *file                             = NULL;
+	static char *function                            = "libscca_directory_open";
+	size_t directory_path_length                     = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	directory_path_length = narrow_string_length(
+	                         directory_path );
+
+	if( directory_path_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path[ directory_path_length - 1 ] == LIBSCCA_DIRECTORY_PATH_SEPARATOR )
+	{
+		directory_path_length -= 1;
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	if( directory_path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory path length value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	search_pattern = narrow_string_allocate(
+	                  directory_path_length + 6 );
+
+	if( search_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create search pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     search_pattern,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( search_pattern[ directory_path_length ] ),
+	     "\\*.pf",
+	     6 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy search pattern.",
+		 function );
+
+		goto on_error;
+	}
+	find_handle = FindFirstFileA(
+	               search_pattern,
+	               &find_data );
+
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		/* A directory without prefetch files contains no matching entries
+		 */
+		if( GetLastError() != ERROR_FILE_NOT_FOUND )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 GetLastError(),
+			 "%s: unable to open directory: %s.",
+			 function,
+			 directory_path );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		do
+		{
+			if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+			{
+				continue;
+			}
+			/* The search pattern also matches extensions that start with .pf
+			 */
+			if( libscca_internal_watcher_is_prefetch_filename(
+			     find_data.cFileName,
+			     narrow_string_length(
+			      find_data.cFileName ) ) == 0 )
+			{
+				continue;
+			}
+			if( libscca_internal_directory_append_path(
+			     (libscca_internal_directory_t *) directory,
+			     file,
+			     directory_path,
+			     directory_path_length,
+			     find_data.cFileName,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( FindNextFileA(
+		        find_handle,
+		        &find_data ) != 0 );
+
+		FindClose(
+		 find_handle );
+
+		find_handle = INVALID_HANDLE_VALUE;
+	}
+	memory_free(
+	 search_pattern );
+
+	search_pattern = NULL;
+
+#elif defined( LIBSCCA_DIRECTORY_HAVE_OPENDIR )
+	directory_stream = opendir(
+	                    directory_path );
+
+	if( directory_stream == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory: %s.",
+		 function,
+		 directory_path );
+
+		goto on_error;
+	}
+	while( ( directory_entry = readdir(
+	                            directory_stream ) ) != NULL )
+	{
+		if( libscca_internal_watcher_is_prefetch_filename(
+		     directory_entry->d_name,
+		     narrow_string_length(
+		      directory_entry->d_name ) ) == 0 )
+		{
+			continue;
+		}
+		if( libscca_internal_directory_append_path(
+		     (libscca_internal_directory_t *) directory,
+		     file,
+		     directory_path,
+		     directory_path_length,
+		     directory_entry->d_name,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( closedir(
+	     directory_stream ) != 0 )
+	{
+		directory_stream = NULL;
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close directory: %s.",
+		 function,
+		 directory_path );
+
+		goto on_error;
+	}
+	directory_stream = NULL;
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: reading directories is not supported.",
+	 function );
+
+	goto on_error;
+
+#endif /* defined( WINAPI ) */
+
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( WINAPI )
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( search_pattern != NULL )
+	{
+		memory_free(
+		 search_pattern );
+	}
+#elif defined( LIBSCCA_DIRECTORY_HAVE_OPENDIR )
+	if( directory_stream != NULL )
+	{
+		closedir(
+		 directory_stream );
+	}
+#endif
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of files that could not be opened
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_number_of_failed_files(
+     libscca_directory_t *directory,
+     int *number_of_failed_files,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_number_of_failed_files";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( number_of_failed_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of failed files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_failed_files = internal_directory->number_of_failed_files;
+
+	return( 1 );
+}
+
+/* Retrieves the number of executables
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_number_of_executables(
+     libscca_directory_t *directory,
+     int *number_of_executables,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_number_of_executables";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( number_of_executables == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of executables.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_executables = (int) internal_directory->number_of_executables;
+
+	return( 1 );
+}
+
+/* Retrieves a specific executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_directory_get_executable(
+     libscca_internal_directory_t *internal_directory,
+     int executable_index,
+     libscca_directory_executable_t **executable,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_directory_get_executable";
+
+	if( internal_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( executable_index < 0 )
+	 || ( (uint32_t) executable_index >= internal_directory->number_of_executables ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid executable index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable.",
+		 function );
+
+		return( -1 );
+	}
+	*executable = &( internal_directory->executables[ executable_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded label of a specific executable
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_utf8_executable_label_size(
+     libscca_directory_t *directory,
+     int executable_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_utf8_executable_label_size";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	*utf8_string_size = executable->label_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded label of a specific executable
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_utf8_executable_label(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_utf8_executable_label";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     internal_directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	if( utf8_string_size < executable->label_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     &( internal_directory->labels_data[ executable->label_offset ] ),
+	     executable->label_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy label.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded executable filename of a specific executable
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libscca_directory_get_utf8_executable_filename_size(
+     libscca_directory_t *directory,
+     int executable_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_utf8_executable_filename_size";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	if( executable->executable_filename_string_identifier == LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET )
+	{
+		return( 0 );
+	}
+	if( libscca_directory_get_utf8_string_size(
+	     directory,
+	     (int) executable->executable_filename_string_identifier,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded executable filename of a specific executable
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libscca_directory_get_utf8_executable_filename(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_utf8_executable_filename";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	if( executable->executable_filename_string_identifier == LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET )
+	{
+		return( 0 );
+	}
+	if( libscca_directory_get_utf8_string(
+	     directory,
+	     (int) executable->executable_filename_string_identifier,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the prefetch hash of a specific executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_prefetch_hash(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_executable_prefetch_hash";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	*prefetch_hash = executable->prefetch_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the format version of a specific executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_format_version(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *format_version,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_executable_format_version";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	*format_version = executable->format_version;
+
+	return( 1 );
+}
+
+/* Retrieves the run count of a specific executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_run_count(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *run_count,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_executable_run_count";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run count.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	*run_count = executable->run_count;
+
+	return( 1 );
+}
+
+/* Retrieves the last run times of a specific executable
+ * Only the last run times that are set are stored, in the order they are stored in the file
+ * The maximum number of filetimes must be LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES or greater
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_last_run_times(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint64_t *filetimes,
+     int maximum_number_of_filetimes,
+     int *number_of_filetimes,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_executable_last_run_times";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_filetimes < LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum number of filetimes value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     internal_directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	if( executable->number_of_run_times > 0 )
+	{
+		if( memory_copy(
+		     filetimes,
+		     &( internal_directory->run_times[ executable->first_run_time_index ] ),
+		     sizeof( uint64_t ) * (size_t) executable->number_of_run_times ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy last run times.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*number_of_filetimes = (int) executable->number_of_run_times;
+
+	return( 1 );
+}
+
+/* Retrieves the number of volumes of a specific executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_number_of_volumes(
+     libscca_directory_t *directory,
+     int executable_index,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_executable_number_of_volumes";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	*number_of_volumes = (int) executable->number_of_volumes;
+
+	return( 1 );
+}
+
+/* Retrieves the volume identifiers of the volumes of a specific executable
+ * The identifier of the volume with index N is stored in volume_identifiers[ N ],
+ * the array must contain at least number_of_volume_identifiers values, which must
+ * be equal to or greater than the number of volumes of the executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_volume_identifiers(
+     libscca_directory_t *directory,
+     int executable_index,
+     int *volume_identifiers,
+     int number_of_volume_identifiers,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_executable_volume_identifiers";
+	uint32_t volume_index                            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( volume_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     internal_directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	if( ( number_of_volume_identifiers < 0 )
+	 || ( (uint32_t) number_of_volume_identifiers < executable->number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of volume identifiers value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( volume_index = 0;
+	     volume_index < executable->number_of_volumes;
+	     volume_index++ )
+	{
+		volume_identifiers[ volume_index ] = (int) internal_directory->volume_identifiers[ executable->first_volume_index + volume_index ];
+	}
+	return( 1 );
+}
+
+/* Retrieves the volume dictionary
+ * The volume dictionary is managed by the directory and must not be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_volume_dictionary(
+     libscca_directory_t *directory,
+     libscca_volume_dictionary_t **volume_dictionary,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_volume_dictionary";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_dictionary = internal_directory->volume_dictionary;
+
+	return( 1 );
+}
+
+/* Retrieves the number of file metrics entries of a specific executable
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_number_of_file_metrics_entries(
+     libscca_directory_t *directory,
+     int executable_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable = NULL;
+	static char *function                      = "libscca_directory_get_executable_number_of_file_metrics_entries";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_directory_get_executable(
+	     (libscca_internal_directory_t *) directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) executable->number_of_file_metrics_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the values of the file metrics entries of a specific executable as columns
+ * Every column array that is not NULL must contain at least number_of_entries values
+ * The string index refers to the strings of the directory and is -1 if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_executable_file_metrics_table(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int *string_indexes,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_executable_file_metrics_table";
+	uint32_t entry_index                             = 0;
+	uint32_t first_entry_index                       = 0;
+	uint32_t string_identifier                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( libscca_internal_directory_get_executable(
+	     internal_directory,
+	     executable_index,
+	     &executable,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable: %d.",
+		 function,
+		 executable_index );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( (uint32_t) number_of_entries < executable->number_of_file_metrics_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of entries value too small.",
+		 function );
+
+		return( -1 );
+	}
+	first_entry_index = executable->first_file_metrics_entry_index;
+
+	for( entry_index = 0;
+	     entry_index < executable->number_of_file_metrics_entries;
+	     entry_index++ )
+	{
+		if( start_times != NULL )
+		{
+			start_times[ entry_index ] = internal_directory->start_times[ first_entry_index + entry_index ];
+		}
+		if( durations != NULL )
+		{
+			durations[ entry_index ] = internal_directory->durations[ first_entry_index + entry_index ];
+		}
+		if( flags != NULL )
+		{
+			flags[ entry_index ] = internal_directory->flags[ first_entry_index + entry_index ];
+		}
+		if( file_references != NULL )
+		{
+			file_references[ entry_index ] = internal_directory->file_references[ first_entry_index + entry_index ];
+		}
+		if( string_indexes != NULL )
+		{
+			string_identifier = internal_directory->string_identifiers[ first_entry_index + entry_index ];
+
+			if( string_identifier == LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET )
+			{
+				string_indexes[ entry_index ] = -1;
+			}
+			else
+			{
+				string_indexes[ entry_index ] = (int) string_identifier;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of strings
+ * The strings are the distinct executable filenames and file metrics filenames of all executables
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_number_of_strings(
+     libscca_directory_t *directory,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_number_of_strings";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_strings = (int) ( (libscca_internal_string_pool_t *) internal_directory->string_pool )->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_utf8_string_size(
+     libscca_directory_t *directory,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	const uint8_t *utf16_stream                      = NULL;
+	static char *function                            = "libscca_directory_get_utf8_string_size";
+	size_t utf16_stream_size                         = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( string_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid string index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_string_pool_get_string(
+	     internal_directory->string_pool,
+	     (uint32_t) string_index,
+	     &utf16_stream,
+	     &utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     utf16_stream,
+	     utf16_stream_size,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d size.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_utf8_string(
+     libscca_directory_t *directory,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	const uint8_t *utf16_stream                      = NULL;
+	static char *function                            = "libscca_directory_get_utf8_string";
+	size_t utf16_stream_size                         = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( string_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid string index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_string_pool_get_string(
+	     internal_directory->string_pool,
+	     (uint32_t) string_index,
+	     &utf16_stream,
+	     &utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_copy_to_utf8_string(
+	     utf16_stream,
+	     utf16_stream_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string: %d to UTF-8 string.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the first string at or after a specific string index
+ * that has a specific case folded hash
+ * The case folded hash can be calculated using libscca_compute_case_folded_hash
+ * Returns 1 if successful, 0 if no such string or -1 on error
+ */
+int libscca_directory_get_next_string_index_by_filename_hash(
+     libscca_directory_t *directory,
+     int first_string_index,
+     uint64_t case_folded_hash,
+     int *string_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_next_string_index_by_filename_hash";
+	uint32_t number_of_strings                       = 0;
+	uint32_t string_identifier                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( first_string_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first string index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_strings = ( (libscca_internal_string_pool_t *) internal_directory->string_pool )->number_of_entries;
+
+	for( string_identifier = (uint32_t) first_string_index;
+	     string_identifier < number_of_strings;
+	     string_identifier++ )
+	{
+		if( internal_directory->string_hashes[ string_identifier ] == case_folded_hash )
+		{
+			*string_index = (int) string_identifier;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the first executable at or after a specific executable index
+ * that has a file metrics entry with a specific filename string
+ * Calling this function with the previous executable index plus 1 iterates over all
+ * executables that loaded the filename
+ * Returns 1 if successful, 0 if no such executable or -1 on error
+ */
+int libscca_directory_get_next_executable_index_by_string_index(
+     libscca_directory_t *directory,
+     int first_executable_index,
+     int string_index,
+     int *executable_index,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_next_executable_index_by_string_index";
+	uint32_t entry_index                             = 0;
+	uint32_t last_entry_index                        = 0;
+	uint32_t safe_executable_index                   = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( first_executable_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first executable index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid string index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( executable_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executable index.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_executable_index = (uint32_t) first_executable_index;
+	     safe_executable_index < internal_directory->number_of_executables;
+	     safe_executable_index++ )
+	{
+		executable = &( internal_directory->executables[ safe_executable_index ] );
+
+		last_entry_index = executable->first_file_metrics_entry_index + executable->number_of_file_metrics_entries;
+
+		for( entry_index = executable->first_file_metrics_entry_index;
+		     entry_index < last_entry_index;
+		     entry_index++ )
+		{
+			if( internal_directory->string_identifiers[ entry_index ] == (uint32_t) string_index )
+			{
+				*executable_index = (int) safe_executable_index;
+
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of file metrics entries of all executables
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_number_of_file_metrics_entries(
+     libscca_directory_t *directory,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_number_of_file_metrics_entries";
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) internal_directory->number_of_file_metrics_entries;
+
+	return( 1 );
+}
+
+/* Exports the values of the file metrics entries of all executables as columns
+ * The entries are stored in the order of the executables, where the executable index
+ * identifies the executable of every entry
+ * Every column array that is not NULL must contain at least number_of_entries values
+ * The string index refers to the strings of the directory and is -1 if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_export_file_metrics_table(
+     libscca_directory_t *directory,
+     int *executable_indexes,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int *string_indexes,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_directory_executable_t *executable       = NULL;
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_export_file_metrics_table";
+	size_t number_of_values                          = 0;
+	uint32_t entry_index                             = 0;
+	uint32_t executable_index                        = 0;
+	uint32_t last_entry_index                        = 0;
+	uint32_t string_identifier                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( ( number_of_entries < 0 )
+	 || ( (uint32_t) number_of_entries < internal_directory->number_of_file_metrics_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of entries value too small.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_values = (size_t) internal_directory->number_of_file_metrics_entries;
+
+	if( number_of_values == 0 )
+	{
+		return( 1 );
+	}
+	/* The columns are stored contiguously hence they are copied at once
+	 */
+	if( start_times != NULL )
+	{
+		if( memory_copy(
+		     start_times,
+		     internal_directory->start_times,
+		     sizeof( uint32_t ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy start times.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( durations != NULL )
+	{
+		if( memory_copy(
+		     durations,
+		     internal_directory->durations,
+		     sizeof( uint32_t ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy durations.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( flags != NULL )
+	{
+		if( memory_copy(
+		     flags,
+		     internal_directory->flags,
+		     sizeof( uint32_t ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy flags.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( file_references != NULL )
+	{
+		if( memory_copy(
+		     file_references,
+		     internal_directory->file_references,
+		     sizeof( uint64_t ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file references.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( string_indexes != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < internal_directory->number_of_file_metrics_entries;
+		     entry_index++ )
+		{
+			string_identifier = internal_directory->string_identifiers[ entry_index ];
+
+			if( string_identifier == LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET )
+			{
+				string_indexes[ entry_index ] = -1;
+			}
+			else
+			{
+				string_indexes[ entry_index ] = (int) string_identifier;
+			}
+		}
+	}
+	if( executable_indexes != NULL )
+	{
+		for( executable_index = 0;
+		     executable_index < internal_directory->number_of_executables;
+		     executable_index++ )
+		{
+			executable = &( internal_directory->executables[ executable_index ] );
+
+			last_entry_index = executable->first_file_metrics_entry_index + executable->number_of_file_metrics_entries;
+
+			for( entry_index = executable->first_file_metrics_entry_index;
+			     entry_index < last_entry_index;
+			     entry_index++ )
+			{
+				executable_indexes[ entry_index ] = (int) executable_index;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of all UTF-8 encoded strings packed into a single buffer
+ * The returned size includes the end of string character of every string
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_utf8_strings_table_size(
+     libscca_directory_t *directory,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_utf8_strings_table_size";
+	size_t safe_utf8_strings_size                    = 0;
+	size_t utf8_string_size                          = 0;
+	int number_of_strings                            = 0;
+	int string_index                                 = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( utf8_strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_strings = (int) ( (libscca_internal_string_pool_t *) internal_directory->string_pool )->number_of_entries;
+
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libscca_directory_get_utf8_string_size(
+		     directory,
+		     string_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string: %d size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( utf8_string_size > ( (size_t) SSIZE_MAX - safe_utf8_strings_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 strings size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_utf8_strings_size += utf8_string_size;
+	}
+	*utf8_strings_size = safe_utf8_strings_size;
+
+	return( 1 );
+}
+
+/* Retrieves all UTF-8 encoded strings packed into a single buffer
+ * Every string is stored including its end of string character and
+ * the offset of each string in the buffer is stored in the offsets
+ * The number of offsets must be equal to or greater than the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_utf8_strings_table(
+     libscca_directory_t *directory,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_utf8_strings_table";
+	size_t utf8_string_offset                        = 0;
+	size_t utf8_string_size                          = 0;
+	int number_of_strings                            = 0;
+	int string_index                                 = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 strings size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_strings = (int) ( (libscca_internal_string_pool_t *) internal_directory->string_pool )->number_of_entries;
+
+	if( number_of_offsets < number_of_strings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of offsets value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( libscca_directory_get_utf8_string_size(
+		     directory,
+		     string_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string: %d size.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( utf8_string_size > ( utf8_strings_size - utf8_string_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 strings size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_directory_get_utf8_string(
+		     directory,
+		     string_index,
+		     &( utf8_strings[ utf8_string_offset ] ),
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		utf8_string_offsets[ string_index ] = utf8_string_offset;
+
+		utf8_string_offset += utf8_string_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the memory usage of the directory
+ * The memory usage is the size of the allocated columns, labels and string data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_directory_get_memory_usage(
+     libscca_directory_t *directory,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libscca_internal_directory_t *internal_directory = NULL;
+	static char *function                            = "libscca_directory_get_memory_usage";
+	size64_t safe_memory_usage                       = 0;
+	size64_t strings_size                            = 0;
+	uint64_t number_of_hits                          = 0;
+	uint64_t number_of_misses                        = 0;
+	int number_of_strings                            = 0;
+	int number_of_volumes                            = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory = (libscca_internal_directory_t *) directory;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_string_pool_get_statistics(
+	     internal_directory->string_pool,
+	     &number_of_strings,
+	     &strings_size,
+	     &number_of_hits,
+	     &number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string pool statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_volume_dictionary_get_number_of_volumes(
+	     internal_directory->volume_dictionary,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage = sizeof( libscca_internal_directory_t )
+	                  + strings_size
+	                  + ( (size64_t) number_of_strings * sizeof( libscca_string_pool_entry_t ) )
+	                  + ( (size64_t) number_of_volumes * sizeof( libscca_volume_dictionary_entry_t ) )
+	                  + ( (size64_t) internal_directory->number_of_allocated_string_hashes * sizeof( uint64_t ) )
+	                  + ( (size64_t) internal_directory->number_of_allocated_executables * sizeof( libscca_directory_executable_t ) )
+	                  + (size64_t) internal_directory->allocated_labels_data_size
+	                  + ( (size64_t) internal_directory->number_of_allocated_run_times * sizeof( uint64_t ) )
+	                  + ( (size64_t) internal_directory->number_of_allocated_volume_identifiers * sizeof( uint32_t ) )
+	                  + ( (size64_t) internal_directory->number_of_allocated_file_metrics_entries * ( ( 4 * sizeof( uint32_t ) ) + sizeof( uint64_t ) ) );
+
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
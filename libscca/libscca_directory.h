@@ -0,0 +1,491 @@
+/*
+ * Prefetch directory functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_DIRECTORY_H )
+#define _LIBSCCA_DIRECTORY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_string_pool.h"
+#include "libscca_types.h"
+#include "libscca_volume_dictionary.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The string identifier of a value that is not available
+ */
+#define LIBSCCA_DIRECTORY_STRING_IDENTIFIER_NOT_SET	0xffffffffUL
+
+typedef struct libscca_directory_executable libscca_directory_executable_t;
+
+/* The executable is a fixed-size record, its run times, volumes and file metrics entries
+ * are ranges of the columns of the directory
+ */
+struct libscca_directory_executable
+{
+	/* The offset of the UTF-8 encoded label in the labels data
+	 */
+	size_t label_offset;
+
+	/* The UTF-8 encoded label size, which includes the end of string character
+	 */
+	size_t label_size;
+
+	/* The string identifier of the executable filename
+	 */
+	uint32_t executable_filename_string_identifier;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The run count
+	 */
+	uint32_t run_count;
+
+	/* The index of the first run time in the run times column
+	 */
+	uint32_t first_run_time_index;
+
+	/* The number of run times
+	 */
+	uint32_t number_of_run_times;
+
+	/* The index of the first volume in the volume identifiers column
+	 */
+	uint32_t first_volume_index;
+
+	/* The number of volumes
+	 */
+	uint32_t number_of_volumes;
+
+	/* The index of the first file metrics entry in the file metrics columns
+	 */
+	uint32_t first_file_metrics_entry_index;
+
+	/* The number of file metrics entries
+	 */
+	uint32_t number_of_file_metrics_entries;
+};
+
+typedef struct libscca_internal_directory libscca_internal_directory_t;
+
+struct libscca_internal_directory
+{
+	/* The string pool, which contains every distinct UTF-16 little-endian
+	 * executable filename and file metrics filename of the directory once
+	 */
+	libscca_string_pool_t *string_pool;
+
+	/* The case folded hashes of the strings, indexed by string identifier
+	 */
+	uint64_t *string_hashes;
+
+	/* The number of allocated string hashes
+	 */
+	uint32_t number_of_allocated_string_hashes;
+
+	/* The volume dictionary, which contains every distinct volume of the directory once
+	 */
+	libscca_volume_dictionary_t *volume_dictionary;
+
+	/* The executables
+	 */
+	libscca_directory_executable_t *executables;
+
+	/* The number of executables
+	 */
+	uint32_t number_of_executables;
+
+	/* The number of allocated executables
+	 */
+	uint32_t number_of_allocated_executables;
+
+	/* The labels data
+	 */
+	uint8_t *labels_data;
+
+	/* The labels data size
+	 */
+	size_t labels_data_size;
+
+	/* The allocated labels data size
+	 */
+	size_t allocated_labels_data_size;
+
+	/* The run times column
+	 */
+	uint64_t *run_times;
+
+	/* The number of run times
+	 */
+	uint32_t number_of_run_times;
+
+	/* The number of allocated run times
+	 */
+	uint32_t number_of_allocated_run_times;
+
+	/* The volume identifiers column
+	 */
+	uint32_t *volume_identifiers;
+
+	/* The number of volume identifiers
+	 */
+	uint32_t number_of_volume_identifiers;
+
+	/* The number of allocated volume identifiers
+	 */
+	uint32_t number_of_allocated_volume_identifiers;
+
+	/* The file metrics start times column
+	 */
+	uint32_t *start_times;
+
+	/* The file metrics durations column
+	 */
+	uint32_t *durations;
+
+	/* The file metrics flags column
+	 */
+	uint32_t *flags;
+
+	/* The file metrics file references column
+	 */
+	uint64_t *file_references;
+
+	/* The file metrics filename string identifiers column
+	 */
+	uint32_t *string_identifiers;
+
+	/* The number of file metrics entries
+	 */
+	uint32_t number_of_file_metrics_entries;
+
+	/* The number of allocated file metrics entries
+	 */
+	uint32_t number_of_allocated_file_metrics_entries;
+
+	/* The number of files that could not be opened by libscca_directory_open
+	 */
+	int number_of_failed_files;
+};
+
+LIBSCCA_EXTERN \
+int libscca_directory_initialize(
+     libscca_directory_t **directory,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_free(
+     libscca_directory_t **directory,
+     libcerror_error_t **error );
+
+int libscca_directory_resize_column(
+     uint8_t **column,
+     size_t value_size,
+     uint32_t number_of_values,
+     libcerror_error_t **error );
+
+int libscca_directory_get_allocation_size(
+     uint32_t number_of_allocated_values,
+     uint32_t number_of_values,
+     uint32_t *allocation_size,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_reserve_executables(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_executables,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_reserve_run_times(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_run_times,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_reserve_volume_identifiers(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_volume_identifiers,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_reserve_file_metrics_entries(
+     libscca_internal_directory_t *internal_directory,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_append_label(
+     libscca_internal_directory_t *internal_directory,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     size_t *label_offset,
+     size_t *label_size,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_intern_string(
+     libscca_internal_directory_t *internal_directory,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_append_file_metrics_entries(
+     libscca_internal_directory_t *internal_directory,
+     libscca_file_t *file,
+     libscca_directory_executable_t *executable,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_append_volumes(
+     libscca_internal_directory_t *internal_directory,
+     libscca_file_t *file,
+     libscca_directory_executable_t *executable,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_append_file(
+     libscca_directory_t *directory,
+     libscca_file_t *file,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_append_path(
+     libscca_internal_directory_t *internal_directory,
+     libscca_file_t *file,
+     const char *directory_path,
+     size_t directory_path_length,
+     const char *name,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_open(
+     libscca_directory_t *directory,
+     const char *directory_path,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_number_of_failed_files(
+     libscca_directory_t *directory,
+     int *number_of_failed_files,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_number_of_executables(
+     libscca_directory_t *directory,
+     int *number_of_executables,
+     libcerror_error_t **error );
+
+int libscca_internal_directory_get_executable(
+     libscca_internal_directory_t *internal_directory,
+     int executable_index,
+     libscca_directory_executable_t **executable,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_executable_label_size(
+     libscca_directory_t *directory,
+     int executable_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_executable_label(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_executable_filename_size(
+     libscca_directory_t *directory,
+     int executable_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_executable_filename(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_prefetch_hash(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_format_version(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *format_version,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_run_count(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *run_count,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_last_run_times(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint64_t *filetimes,
+     int maximum_number_of_filetimes,
+     int *number_of_filetimes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_number_of_volumes(
+     libscca_directory_t *directory,
+     int executable_index,
+     int *number_of_volumes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_volume_identifiers(
+     libscca_directory_t *directory,
+     int executable_index,
+     int *volume_identifiers,
+     int number_of_volume_identifiers,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_volume_dictionary(
+     libscca_directory_t *directory,
+     libscca_volume_dictionary_t **volume_dictionary,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_number_of_file_metrics_entries(
+     libscca_directory_t *directory,
+     int executable_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_executable_file_metrics_table(
+     libscca_directory_t *directory,
+     int executable_index,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int *string_indexes,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_number_of_strings(
+     libscca_directory_t *directory,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_string_size(
+     libscca_directory_t *directory,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_string(
+     libscca_directory_t *directory,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_next_string_index_by_filename_hash(
+     libscca_directory_t *directory,
+     int first_string_index,
+     uint64_t case_folded_hash,
+     int *string_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_next_executable_index_by_string_index(
+     libscca_directory_t *directory,
+     int first_executable_index,
+     int string_index,
+     int *executable_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_number_of_file_metrics_entries(
+     libscca_directory_t *directory,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_export_file_metrics_table(
+     libscca_directory_t *directory,
+     int *executable_indexes,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int *string_indexes,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_strings_table_size(
+     libscca_directory_t *directory,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_utf8_strings_table(
+     libscca_directory_t *directory,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_directory_get_memory_usage(
+     libscca_directory_t *directory,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_DIRECTORY_H ) */
+
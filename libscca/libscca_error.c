@@ -107,5 +107,23 @@ int libscca_error_backtrace_sprint(
 	return( print_count );
 }
 
+/* Determines if an error matches an error domain and code
+ * Returns 1 if the error matches or 0 if not
+ */
+int libscca_error_matches(
+     libscca_error_t *error,
+     int error_domain,
+     int error_code )
+{
+	int result = 0;
+
+	result = libcerror_error_matches(
+	          (libcerror_error_t *) error,
+	          error_domain,
+	          error_code );
+
+	return( result );
+}
+
 #endif /* !defined( HAVE_LOCAL_LIBSCCA ) */
 
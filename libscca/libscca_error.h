@@ -64,6 +64,12 @@ int libscca_error_backtrace_sprint(
      char *string,
      size_t size );
 
+LIBSCCA_EXTERN \
+int libscca_error_matches(
+     libscca_error_t *error,
+     int error_domain,
+     int error_code );
+
 #endif /* !defined( HAVE_LOCAL_LIBSCCA ) */
 
 #if defined( __cplusplus )
@@ -20,14 +20,20 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
+#include "libscca_budget.h"
 #include "libscca_codepage.h"
 #include "libscca_compressed_block.h"
+#include "libscca_arena.h"
+#include "libscca_block_cache.h"
+#include "libscca_bloom_filter.h"
 #include "libscca_compressed_blocks_stream.h"
+#include "libscca_context.h"
 #include "libscca_debug.h"
 #include "libscca_definitions.h"
 #include "libscca_io_handle.h"
@@ -35,16 +41,40 @@
 #include "libscca_file_header.h"
 #include "libscca_file_information.h"
 #include "libscca_file_metrics.h"
+#include "libscca_file_metrics_values.h"
 #include "libscca_filename_strings.h"
+#include "libscca_hash.h"
 #include "libscca_libbfio.h"
-#include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
+#include "libscca_libcthreads.h"
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
 #include "libscca_libuna.h"
+#include "libscca_lzxpress.h"
+#include "libscca_mapped_file.h"
+#include "libscca_memory.h"
+#include "libscca_prefetch_hash.h"
+#include "libscca_shared_file.h"
+#include "libscca_statistics.h"
+#include "libscca_string_pool.h"
+#include "libscca_support.h"
+#include "libscca_trace_chain.h"
+#include "libscca_tracepoint.h"
+#include "libscca_tracing.h"
+#include "libscca_unused.h"
+#include "libscca_upcase.h"
+#include "libscca_utf16_stream.h"
+#include "libscca_volume_dictionary.h"
 #include "libscca_volume_information.h"
+#include "libscca_volumes.h"
+
+#include "scca_file_header.h"
+#include "scca_file_information.h"
+#include "scca_file_metrics_array.h"
+#include "scca_snapshot_header.h"
+#include "scca_trace_chain_array.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -79,6 +109,12 @@ int libscca_file_initialize(
 
 		return( -1 );
 	}
+#if defined( LIBSCCA_TRACEPOINT_HAVE_ETW )
+	/* The TraceLogging provider is registered on first use, since a static library has no entry point
+	 */
+	libscca_tracepoint_register_provider();
+#endif
+
 	internal_file = memory_allocate_structure(
 	                 libscca_internal_file_t );
 
@@ -110,16 +146,29 @@ int libscca_file_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( internal_file->file_metrics_array ),
-	     0,
+	if( libscca_file_metrics_values_initialize(
+	     &( internal_file->file_metrics_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file metrics values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_arena_initialize(
+	     &( internal_file->arena ),
+	     LIBSCCA_ARENA_DEFAULT_BLOCK_SIZE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file metrics array.",
+		 "%s: unable to create arena.",
 		 function );
 
 		goto on_error;
@@ -137,16 +186,28 @@ int libscca_file_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
-	     &( internal_file->volumes_array ),
-	     0,
+	if( libscca_trace_chain_initialize(
+	     &( internal_file->trace_chain ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create trace chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_volumes_initialize(
+	     &( internal_file->volumes ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create volumes array.",
+		 "%s: unable to create volumes.",
 		 function );
 
 		goto on_error;
@@ -164,6 +225,21 @@ int libscca_file_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*file = (libscca_file_t *) internal_file;
 
 	return( 1 );
@@ -171,11 +247,22 @@ int libscca_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
-		if( internal_file->volumes_array != NULL )
+		if( internal_file->io_handle != NULL )
+		{
+			libscca_io_handle_free(
+			 &( internal_file->io_handle ),
+			 NULL );
+		}
+		if( internal_file->volumes != NULL )
+		{
+			libscca_volumes_free(
+			 &( internal_file->volumes ),
+			 NULL );
+		}
+		if( internal_file->trace_chain != NULL )
 		{
-			libcdata_array_free(
-			 &( internal_file->volumes_array ),
-			 NULL,
+			libscca_trace_chain_free(
+			 &( internal_file->trace_chain ),
 			 NULL );
 		}
 		if( internal_file->filename_strings != NULL )
@@ -184,11 +271,16 @@ on_error:
 			 &( internal_file->filename_strings ),
 			 NULL );
 		}
-		if( internal_file->file_metrics_array != NULL )
+		if( internal_file->arena != NULL )
+		{
+			libscca_arena_free(
+			 &( internal_file->arena ),
+			 NULL );
+		}
+		if( internal_file->file_metrics_values != NULL )
 		{
-			libcdata_array_free(
-			 &( internal_file->file_metrics_array ),
-			 NULL,
+			libscca_file_metrics_values_free(
+			 &( internal_file->file_metrics_values ),
 			 NULL );
 		}
 		memory_free(
@@ -197,6 +289,144 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a file that shares the caches and scratch buffers of a context
+ * Make sure the value file is referencing, is set to NULL
+ * The scratch buffers are taken from the context and released to it when the file is freed
+ * hence the context should be used by a single thread and cannot be freed before the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_initialize_with_context(
+     libscca_file_t **file,
+     libscca_context_t *context,
+     libcerror_error_t **error )
+{
+	libscca_internal_context_t *internal_context = NULL;
+	libscca_internal_file_t *internal_file       = NULL;
+	libscca_io_handle_t *io_handle               = NULL;
+	static char *function                        = "libscca_file_initialize_with_context";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_context = (libscca_internal_context_t *) context;
+
+	if( libscca_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) *file;
+	io_handle     = internal_file->io_handle;
+
+	if( libscca_context_attach_file(
+	     internal_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to attach file to context.",
+		 function );
+
+		goto on_error;
+	}
+	/* The context is set after the file was attached so that freeing the file detaches it
+	 */
+	io_handle->context = internal_context;
+
+	if( libscca_context_take_buffer(
+	     internal_context,
+	     LIBSCCA_CONTEXT_BUFFER_TYPE_COMPRESSED_DATA,
+	     &( io_handle->compressed_data ),
+	     &( io_handle->compressed_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to take compressed data buffer from context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_context_take_buffer(
+	     internal_context,
+	     LIBSCCA_CONTEXT_BUFFER_TYPE_UNCOMPRESSED_DATA,
+	     &( io_handle->uncompressed_data ),
+	     &( io_handle->uncompressed_data_buffer_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to take uncompressed data buffer from context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_context_take_buffer(
+	     internal_context,
+	     LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	     &( io_handle->section_data ),
+	     &( io_handle->section_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to take section data buffer from context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_context_take_decoder_cache(
+	     internal_context,
+	     &( io_handle->decoder_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to take decoder cache from context.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->block_cache       = internal_context->block_cache;
+	io_handle->string_pool       = internal_context->string_pool;
+	io_handle->volume_dictionary = internal_context->volume_dictionary;
+
+	return( 1 );
+
+on_error:
+	libscca_file_free(
+	 file,
+	 NULL );
+
+	return( -1 );
+}
+
 /* Frees a file
  * Returns 1 if successful or -1 on error
  */
@@ -223,6 +453,28 @@ int libscca_file_free(
 	{
 		internal_file = (libscca_internal_file_t *) *file;
 
+		if( internal_file->parse_cache_entry != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - file is shared by parse cache, use libscca_parse_cache_release_file instead.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->shared_file != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - file is shared, use libscca_file_release instead.",
+			 function );
+
+			return( -1 );
+		}
 		if( internal_file->file_io_handle != NULL )
 		{
 			if( libscca_file_close(
@@ -241,16 +493,44 @@ int libscca_file_free(
 		}
 		*file = NULL;
 
-		if( libcdata_array_free(
-		     &( internal_file->volumes_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
+		if( internal_file->mapped_file != NULL )
+		{
+			if( libscca_mapped_file_free(
+			     &( internal_file->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libscca_volumes_free(
+		     &( internal_file->volumes ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volumes.",
+			 function );
+
+			result = -1;
+		}
+		if( libscca_trace_chain_free(
+		     &( internal_file->trace_chain ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free volumes array.",
+			 "%s: unable to free trace chain.",
 			 function );
 
 			result = -1;
@@ -268,16 +548,46 @@ int libscca_file_free(
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( internal_file->file_metrics_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
+		if( internal_file->mount_points != NULL )
+		{
+			if( libscca_mount_points_free(
+			     &( internal_file->mount_points ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mount points.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file metrics handles are allocated from the arena
+		 */
+		if( libscca_file_metrics_values_free(
+		     &( internal_file->file_metrics_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file metrics values.",
+			 function );
+
+			result = -1;
+		}
+		if( libscca_arena_free(
+		     &( internal_file->arena ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file metrics array.",
+			 "%s: unable to free arena.",
 			 function );
 
 			result = -1;
@@ -295,6 +605,21 @@ int libscca_file_free(
 
 			result = -1;
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -340,18 +665,19 @@ int libscca_file_signal_abort(
 	return( 1 );
 }
 
-/* Opens a file
- * Returns 1 if successful or -1 on error
+/* Retrieves the error domain and code of the last failed read
+ * The error domain and code are only recorded when the file was opened
+ * with LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libscca_file_open(
+int libscca_file_get_open_error(
      libscca_file_t *file,
-     const char *filename,
-     int access_flags,
+     int *error_domain,
+     int *error_code,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_open";
+	static char *function                  = "libscca_file_get_open_error";
 
 	if( file == NULL )
 	{
@@ -366,129 +692,154 @@ int libscca_file_open(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( error_domain == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid error domain.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	if( internal_file->open_error_domain == 0 )
+	{
+		return( 0 );
+	}
+	*error_domain = internal_file->open_error_domain;
+	*error_code   = internal_file->open_error_code;
+
+	return( 1 );
+}
+
+/* Retrieves the corruption flags
+ * The file metrics, trace chain, filename strings and volumes information are only
+ * flagged as corrupted when the file was opened with LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA
+ * A corrupted section is read as if it contains no entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_corruption_flags(
+     libscca_file_t *file,
+     uint32_t *corruption_flags,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_corruption_flags";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( corruption_flags == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid corruption flags.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
+	*corruption_flags = internal_file->io_handle->corruption_flags;
+
+	return( 1 );
+}
+
+/* Sets the parse budget
+ * The budget limits the number of entries of a section, the uncompressed data size
+ * and the number of steps, which are the entries and filenames parsed or matched
+ * and every 4 KiB of data decompressed, from the moment the file is opened.
+ * A maximum of 0 represents no maximum. If the budget is exceeded the file is
+ * signalled to abort and the error has the LIBSCCA_RUNTIME_ERROR_BUDGET_EXCEEDED code
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_parse_budget(
+     libscca_file_t *file,
+     uint32_t maximum_number_of_entries,
+     uint64_t maximum_uncompressed_data_size,
+     uint64_t maximum_number_of_steps,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_parse_budget";
+
+	if( file == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libscca_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->io_handle->budget.maximum_number_of_entries      = maximum_number_of_entries;
+	internal_file->io_handle->budget.maximum_uncompressed_data_size = maximum_uncompressed_data_size;
+	internal_file->io_handle->budget.maximum_number_of_steps        = maximum_number_of_steps;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a file
+/* Retrieves the parse budget and the number of steps taken since the file was opened
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_open_wide(
+int libscca_file_get_parse_budget(
      libscca_file_t *file,
-     const wchar_t *filename,
-     int access_flags,
+     uint32_t *maximum_number_of_entries,
+     uint64_t *maximum_uncompressed_data_size,
+     uint64_t *maximum_number_of_steps,
+     uint64_t *number_of_steps,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle       = NULL;
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_open_wide";
+	static char *function                  = "libscca_file_get_parse_budget";
 
 	if( file == NULL )
 	{
@@ -503,131 +854,125 @@ int libscca_file_open_wide(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( filename == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	if( maximum_number_of_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of entries.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	if( maximum_uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum uncompressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( maximum_number_of_steps == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of steps.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( number_of_steps == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of steps.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     wide_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
+	*maximum_number_of_entries      = internal_file->io_handle->budget.maximum_number_of_entries;
+	*maximum_uncompressed_data_size = internal_file->io_handle->budget.maximum_uncompressed_data_size;
+	*maximum_number_of_steps        = internal_file->io_handle->budget.maximum_number_of_steps;
+	*number_of_steps                = internal_file->io_handle->budget.number_of_steps;
+
+	return( 1 );
+}
+
+/* Sets the parse deadline
+ * The deadline is a monotonic timestamp in nano seconds, which is based on CLOCK_MONOTONIC
+ * or on QueryPerformanceCounter on Windows, where 0 represents no deadline
+ * The deadline is checked per compressed block and per section. If the deadline is exceeded
+ * while reading the sections, the sections that were read are retained and the sections
+ * that were not read are flagged as corrupted together with LIBSCCA_CORRUPTION_FLAG_DEADLINE_EXCEEDED,
+ * otherwise the error has the LIBSCCA_RUNTIME_ERROR_DEADLINE_EXCEEDED code
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_deadline(
+     libscca_file_t *file,
+     uint64_t deadline,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_deadline";
+
+	if( file == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libscca_file_open_file_io_handle(
-	     file,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open file: %ls.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->io_handle->budget.deadline = deadline;
 
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Opens a file using a Basic File IO (bfio) handle
+/* Retrieves the parse deadline
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_open_file_io_handle(
+int libscca_file_get_deadline(
      libscca_file_t *file,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+     uint64_t *deadline,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_open_file_io_handle";
-	int bfio_access_flags                  = 0;
-	int file_io_handle_is_open             = 0;
-	int file_io_handle_opened_in_library   = 0;
+	static char *function                  = "libscca_file_get_deadline";
 
 	if( file == NULL )
 	{
@@ -642,129 +987,155 @@ int libscca_file_open_file_io_handle(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( deadline == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid deadline.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	*deadline = internal_file->io_handle->budget.deadline;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of cached compressed blocks
+ * The maximum applies to the compressed blocks cache created when the file is opened next
+ * A maximum of 0 represents the default of LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_maximum_number_of_cached_blocks(
+     libscca_file_t *file,
+     int maximum_number_of_cached_blocks,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_maximum_number_of_cached_blocks";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) != 0 )
+	if( maximum_number_of_cached_blocks < 0 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of cached blocks value less than zero.",
+		 function );
+
+		return( -1 );
 	}
-	internal_file->file_io_handle = file_io_handle;
+	internal_file->io_handle->maximum_number_of_cached_blocks = maximum_number_of_cached_blocks;
 
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          internal_file->file_io_handle,
-	                          error );
+	return( 1 );
+}
 
-	if( file_io_handle_is_open == -1 )
+/* Retrieves the maximum number of cached compressed blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_maximum_number_of_cached_blocks(
+     libscca_file_t *file,
+     int *maximum_number_of_cached_blocks,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_maximum_number_of_cached_blocks";
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( file_io_handle_is_open == 0 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
-		if( libbfio_handle_open(
-		     internal_file->file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		return( -1 );
 	}
-	if( libscca_file_open_read(
-	     internal_file,
-	     file_io_handle,
-	     error ) != 1 )
+	if( maximum_number_of_cached_blocks == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cached blocks.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
-
-	return( 1 );
+	*maximum_number_of_cached_blocks = internal_file->io_handle->maximum_number_of_cached_blocks;
 
-on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	if( *maximum_number_of_cached_blocks == 0 )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		*maximum_number_of_cached_blocks = LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS;
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Sets the maximum number of file metrics entries
+ * Only the first maximum number of file metrics entries are read when the file is
+ * opened next and the remainder of the file metrics array is skipped, the total number
+ * of entries remains available, see libscca_file_get_total_number_of_file_metrics_entries
+ * A maximum of 0 represents all entries
+ * Returns 1 if successful or -1 on error
  */
-int libscca_file_close(
+int libscca_file_set_maximum_number_of_file_metrics_entries(
      libscca_file_t *file,
+     int maximum_number_of_file_metrics_entries,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_close";
-	int result                             = 0;
+	static char *function                  = "libscca_file_set_maximum_number_of_file_metrics_entries";
 
 	if( file == NULL )
 	{
@@ -779,226 +1150,101 @@ int libscca_file_close(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libscca_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
-
-				result = -1;
-			}
-		}
-	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
-	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
-	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
-	}
-	internal_file->file_io_handle = NULL;
-
-	if( libscca_io_handle_clear(
-	     internal_file->io_handle,
-	     error ) != 1 )
+	if( maximum_number_of_file_metrics_entries < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of file metrics entries value less than zero.",
 		 function );
 
-		result = -1;
-	}
-	if( internal_file->compressed_blocks_list != NULL )
-	{
-		if( libfdata_list_free(
-		     &( internal_file->compressed_blocks_list ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks list.",
-			 function );
-
-			result = -1;
-		}
-	}
-	if( internal_file->compressed_blocks_cache != NULL )
-	{
-		if( libfcache_cache_free(
-		     &( internal_file->compressed_blocks_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free compressed blocks cache.",
-			 function );
-
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->uncompressed_data_stream != NULL )
-	{
-		if( libfdata_stream_free(
-		     &( internal_file->uncompressed_data_stream ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free uncompressed data strea,.",
-			 function );
+	internal_file->io_handle->maximum_number_of_file_metrics_entries = maximum_number_of_file_metrics_entries;
 
-			result = -1;
-		}
-	}
-	if( internal_file->file_header != NULL )
-	{
-		if( libscca_file_header_free(
-		     &( internal_file->file_header ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file header.",
-			 function );
+	return( 1 );
+}
 
-			result = -1;
-		}
-	}
-	if( internal_file->file_information != NULL )
-	{
-		if( libscca_file_information_free(
-		     &( internal_file->file_information ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file information.",
-			 function );
+/* Retrieves the maximum number of file metrics entries
+ * A maximum of 0 represents all entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_maximum_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int *maximum_number_of_file_metrics_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_maximum_number_of_file_metrics_entries";
 
-			result = -1;
-		}
-	}
-	if( libcdata_array_empty(
-	     internal_file->file_metrics_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
-	     error ) != 1 )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to empty file metrics array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libscca_filename_strings_clear(
-	     internal_file->filename_strings,
-	     error ) != 1 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear filename strings.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_file->volumes_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
-	     error ) != 1 )
+	if( maximum_number_of_file_metrics_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to empty volumes array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of file metrics entries.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	return( result );
+	*maximum_number_of_file_metrics_entries = internal_file->io_handle->maximum_number_of_file_metrics_entries;
+
+	return( 1 );
 }
 
-/* Opens a file for reading
+/* Sets the shared block cache
+ * The uncompressed data of the compressed blocks is retrieved from and stored in
+ * the block cache, which can be shared between files. A block cache of NULL stops
+ * sharing. The block cache is used from the next open and must not be freed
+ * while it is set for the file
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_open_read(
-     libscca_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libscca_file_set_block_cache(
+     libscca_file_t *file,
+     libscca_block_cache_t *block_cache,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_file_open_read";
-	size64_t file_size    = 0;
-	off64_t file_offset   = 0;
-	off64_t next_offset   = 0;
-	int segment_index     = 0;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_block_cache";
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1009,6 +1255,8 @@ int libscca_file_open_read(
 
 		return( -1 );
 	}
+	internal_file = (libscca_internal_file_t *) file;
+
 	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1020,616 +1268,10306 @@ int libscca_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_list != NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks list value already set.",
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->compressed_blocks_cache != NULL )
-	{
-		libcerror_error_set(
+	internal_file->io_handle->block_cache = block_cache;
+
+	return( 1 );
+}
+
+/* Sets the shared string pool
+ * The filenames and volume device paths are interned in the string pool, which can
+ * be shared between files so that a string that is used by many files is stored once.
+ * A string pool of NULL stops sharing. The string pool is used from the next open and
+ * must not be freed while it is set for the file or while the file is open
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_string_pool(
+     libscca_file_t *file,
+     libscca_string_pool_t *string_pool,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_string_pool";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - compressed blocks cache value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_header != NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file header value already set.",
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_information != NULL )
+	internal_file->io_handle->string_pool = string_pool;
+
+	return( 1 );
+}
+
+/* Sets the shared volume dictionary
+ * The volumes are added to the volume dictionary when the file is opened, which can
+ * be shared between files so that a volume that is used by many files has a single
+ * identifier, see libscca_file_get_volume_identifiers. A volume dictionary of NULL stops
+ * sharing. The volume dictionary is used from the next open and must not be freed
+ * while it is set for the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_volume_dictionary(
+     libscca_file_t *file,
+     libscca_volume_dictionary_t *volume_dictionary,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_set_volume_dictionary";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file information value already set.",
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->abort != 0 )
+	internal_file->io_handle->volume_dictionary = volume_dictionary;
+
+	return( 1 );
+}
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open(
+     libscca_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open";
+	int result                             = 0;
+
+	if( file == NULL )
 	{
-		internal_file->io_handle->abort = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	internal_file->open_error_domain = 0;
+	internal_file->open_error_code   = 0;
+
+	if( filename == NULL )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libscca_io_handle_read_compressed_file_header(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     error ) != 1 )
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_file->io_handle->file_type != LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libfdata_list_initialize(
-		     &( internal_file->compressed_blocks_list ),
-		     (intptr_t *) internal_file->io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_compressed_block_read_element_data,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks list.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_file->compressed_blocks_cache ),
-		     LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS,
-		     error ) != 1 )
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( internal_file->file_io_handle != NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks cache.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - file IO handle already set.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading compressed blocks:\n" );
+			return( -1 );
 		}
-#endif
-		if( libscca_io_handle_read_compressed_blocks(
-		     internal_file->io_handle,
-		     file_io_handle,
-		     internal_file->compressed_blocks_list,
-		     internal_file->compressed_blocks_cache,
-		     error ) != 1 )
+		if( internal_file->mapped_file == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed blocks.",
-			 function );
+			if( libscca_mapped_file_initialize(
+			     &( internal_file->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create mapped file.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( libscca_compressed_blocks_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     internal_file->compressed_blocks_list,
-		     internal_file->compressed_blocks_cache,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed blocks stream.",
-			 function );
+		/* If the file cannot be mapped, e.g. it is empty or not a regular file,
+		 * it is opened using the file IO handle instead
+		 */
+		result = libscca_mapped_file_open(
+		          internal_file->mapped_file,
+		          filename,
+		          error );
 
-			goto on_error;
-		}
-	}
-	else
-	{
-		if( libfdata_stream_initialize(
-		     &( internal_file->uncompressed_data_stream ),
-		     NULL,
-		     NULL,
-		     NULL,
-		     NULL,
-		     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_io_handle_read_segment_data,
-		     NULL,
-		     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libscca_io_handle_seek_segment_offset,
-		     0,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create uncompressed data stream.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %s.",
+			 function,
+			 filename );
 
 			goto on_error;
 		}
-		if( libfdata_stream_append_segment(
-		     internal_file->uncompressed_data_stream,
-		     &segment_index,
-		     0,
-		     0,
-		     (size64_t) internal_file->io_handle->uncompressed_data_size,
-		     0,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append uncompressed data stream segment: 0.",
-			 function );
+			if( libscca_file_open_memory(
+			     file,
+			     internal_file->mapped_file->data,
+			     internal_file->mapped_file->data_size,
+			     access_flags,
+			     error ) != 1 )
+			{
+				/* A read failure was recorded without an error with lightweight errors
+				 */
+				if( internal_file->open_error_domain == 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open file: %s.",
+					 function,
+					 filename );
+				}
 
-			goto on_error;
+				goto on_error;
+			}
+			return( 1 );
 		}
 	}
-	if( libscca_file_header_initialize(
-	     &( internal_file->file_header ),
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libscca_file_header_read_data_stream(
-	     internal_file->file_header,
-	     internal_file->uncompressed_data_stream,
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
 	     file_io_handle,
+	     1,
 	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		/* A read failure was recorded without an error with lightweight errors
+		 */
+		if( internal_file->open_error_domain == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %s.",
+			 function,
+			 filename );
+		}
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	/* Only unmap when the mapped data is not in use by an open file
+	 */
+	if( ( internal_file->mapped_file != NULL )
+	 && ( internal_file->file_io_handle == NULL ) )
+	{
+		libscca_mapped_file_close(
+		 internal_file->mapped_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_wide(
+     libscca_file_t *file,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open_wide";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	internal_file->open_error_domain = 0;
+	internal_file->open_error_code   = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( internal_file->file_io_handle != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid file - file IO handle already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->mapped_file == NULL )
+		{
+			if( libscca_mapped_file_initialize(
+			     &( internal_file->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create mapped file.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* If the file cannot be mapped, e.g. it is empty or not a regular file,
+		 * it is opened using the file IO handle instead
+		 */
+		result = libscca_mapped_file_open_wide(
+		          internal_file->mapped_file,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to map file: %ls.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libscca_file_open_memory(
+			     file,
+			     internal_file->mapped_file->data,
+			     internal_file->mapped_file->data_size,
+			     access_flags,
+			     error ) != 1 )
+			{
+				/* A read failure was recorded without an error with lightweight errors
+				 */
+				if( internal_file->open_error_domain == 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open file: %ls.",
+					 function,
+					 filename );
+				}
+
+				goto on_error;
+			}
+			return( 1 );
+		}
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		/* A read failure was recorded without an error with lightweight errors
+		 */
+		if( internal_file->open_error_domain == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %ls.",
+			 function,
+			 filename );
+		}
+
+		goto on_error;
+	}
+	internal_file->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	/* Only unmap when the mapped data is not in use by an open file
+	 */
+	if( ( internal_file->mapped_file != NULL )
+	 && ( internal_file->file_io_handle == NULL ) )
+	{
+		libscca_mapped_file_close(
+		 internal_file->mapped_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_file_io_handle(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libcerror_error_t **read_error         = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open_file_io_handle";
+	int bfio_access_flags                  = 0;
+	int file_io_handle_is_open             = 0;
+	int file_io_handle_opened_in_library   = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	internal_file->open_error_domain = 0;
+	internal_file->open_error_code   = 0;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	internal_file->file_io_handle = file_io_handle;
+
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          internal_file->file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     internal_file->file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->access_flags = access_flags;
+
+	/* With lightweight errors the read does not set an error, which avoids
+	 * formatting and allocating the error messages of rejected data
+	 */
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS ) == 0 )
+	{
+		read_error = error;
+	}
+	result = libscca_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          read_error );
+
+	if( result != 1 )
+	{
+		if( read_error == NULL )
+		{
+			libscca_file_set_open_error(
+			 internal_file );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file handle.",
+			 function );
+		}
+	}
+	else
+	{
+		internal_file->file_io_handle                   = file_io_handle;
+		internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens a file using a Basic File IO (bfio) handle and data already read by the caller
+ * The prefix data contains the first prefix_data_size bytes of the file, for example
+ * the first 4 KiB the caller read to detect the file type, the data is used instead
+ * of reading the same data again from the file IO handle
+ * The file size is the size of the file, where 0 represents unknown, which saves
+ * retrieving the size from the file IO handle
+ * The prefix data is only used while the file is opened and is not retained
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_file_io_handle_with_prefix(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     const uint8_t *prefix_data,
+     size_t prefix_data_size,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open_file_io_handle_with_prefix";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefix_data == NULL )
+	 && ( prefix_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix data.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid prefix data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_size != 0 )
+	 && ( (size64_t) prefix_data_size > file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid prefix data size value exceeds file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefix_data_size != 0 )
+	{
+		internal_file->io_handle->prefix_data      = prefix_data;
+		internal_file->io_handle->prefix_data_size = prefix_data_size;
+	}
+	internal_file->io_handle->file_size_hint = file_size;
+
+	result = libscca_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          access_flags,
+	          error );
+
+	/* The prefix data is owned by the caller and can be freed after the open
+	 */
+	internal_file->io_handle->prefix_data      = NULL;
+	internal_file->io_handle->prefix_data_size = 0;
+	internal_file->io_handle->file_size_hint   = 0;
+
+	if( result != 1 )
+	{
+		/* With lightweight errors a rejected file does not set an error
+		 */
+		if( ( access_flags & LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file from a memory buffer
+ * The data is not copied and must remain available until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_memory(
+     libscca_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t **read_error         = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_open_memory";
+	int file_io_handle_is_open             = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	internal_file->open_error_domain = 0;
+	internal_file->open_error_code   = 0;
+
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	/* The memory range file IO handle references the data without copying it
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->access_flags = access_flags;
+
+	/* With lightweight errors the read does not set an error, which avoids
+	 * formatting and allocating the error messages of rejected data
+	 */
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS ) == 0 )
+	{
+		read_error = error;
+	}
+	result = libscca_file_open_read_data(
+	          internal_file,
+	          data,
+	          data_size,
+	          read_error );
+
+	if( result != 1 )
+	{
+		if( read_error == NULL )
+		{
+			libscca_file_set_open_error(
+			 internal_file );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data.",
+			 function );
+		}
+	}
+	else
+	{
+		internal_file->file_io_handle                    = file_io_handle;
+		internal_file->file_io_handle_created_in_library = 1;
+		internal_file->file_io_handle_opened_in_library  = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		if( file_io_handle_is_open != 0 )
+		{
+			libbfio_handle_close(
+			 file_io_handle,
+			 NULL );
+		}
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file from snapshot data
+ * The snapshot data is created by libscca_file_write_snapshot and contains
+ * the uncompressed data, which is parsed in place without decompression
+ * The snapshot data is referenced by the file and must remain available
+ * until the file is closed, which allows the snapshot data to be memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_snapshot(
+     libscca_file_t *file,
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	const uint8_t *bloom_filter            = NULL;
+	static char *function                  = "libscca_file_open_snapshot";
+	size_t bloom_filter_size               = 0;
+	uint64_t calculated_checksum           = 0;
+	uint64_t data_size                     = 0;
+	uint64_t stored_checksum               = 0;
+	uint32_t data_offset                   = 0;
+	uint32_t format_version                = 0;
+	uint32_t number_of_hashes              = 0;
+	uint32_t snapshot_format_version       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( snapshot_data_size < sizeof( scca_snapshot_header_t ) )
+	 || ( snapshot_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (scca_snapshot_header_t *) snapshot_data )->signature,
+	     "SCCASNAP",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported snapshot signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_snapshot_header_t *) snapshot_data )->snapshot_format_version,
+	 snapshot_format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_snapshot_header_t *) snapshot_data )->data_offset,
+	 data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (scca_snapshot_header_t *) snapshot_data )->data_size,
+	 data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (scca_snapshot_header_t *) snapshot_data )->data_checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_snapshot_header_t *) snapshot_data )->format_version,
+	 format_version );
+
+	if( snapshot_format_version != LIBSCCA_SNAPSHOT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported snapshot format version: %" PRIu32 ".",
+		 function,
+		 snapshot_format_version );
+
+		return( -1 );
+	}
+	if( ( data_offset < sizeof( scca_snapshot_header_t ) )
+	 || ( (size_t) data_offset > snapshot_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (uint64_t) ( snapshot_data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     &( snapshot_data[ data_offset ] ),
+	     (size_t) data_size,
+	     0,
+	     &calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate snapshot data checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculated_checksum != stored_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in snapshot data checksum ( 0x%08" PRIx64 " != 0x%08" PRIx64 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	/* The filename Bloom filter is validated so that a corrupted Bloom filter
+	 * is detected before it is used by libscca_snapshot_may_contain_filename_hash
+	 */
+	if( libscca_snapshot_get_bloom_filter(
+	     snapshot_data,
+	     snapshot_data_size,
+	     &bloom_filter,
+	     &bloom_filter_size,
+	     &number_of_hashes,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_open_memory(
+	     file,
+	     &( snapshot_data[ data_offset ] ),
+	     (size_t) data_size,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from snapshot data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->format_version != format_version )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in format version ( %" PRIu32 " != %" PRIu32 " ).",
+		 function,
+		 format_version,
+		 internal_file->io_handle->format_version );
+
+		libscca_file_close(
+		 file,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file from a forward-only stream
+ * The read function is called to read the data sequentially and only once,
+ * hence the stream does not need to be seekable
+ * The read function returns the number of bytes read, 0 at the end of the stream
+ * or -1 on error and can return less bytes than requested
+ * The data of an uncompressed file is read up to the file size in the file header,
+ * the data of a compressed file is read up to the end of the stream
+ * The data is buffered by the file and parsed when the stream has been read
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_stream(
+     libscca_file_t *file,
+     ssize_t (*read_function)(
+              uint8_t *buffer,
+              size_t buffer_size,
+              void *read_arguments ),
+     void *read_arguments,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	uint8_t *data                          = NULL;
+	static char *function                  = "libscca_file_open_stream";
+	size_t buffer_size                     = 0;
+	size_t data_size                       = 0;
+	size_t read_size                       = 0;
+	ssize_t read_count                     = 0;
+	uint32_t file_size                     = 0;
+	uint32_t uncompressed_data_size        = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+	/* The data is buffered in the compressed data scratch buffer of the IO handle,
+	 * which is retained until the file is closed and not used when parsing data from memory
+	 */
+	buffer_size = LIBSCCA_STREAM_READ_SIZE;
+
+	if( libscca_io_handle_get_compressed_data_buffer(
+	     internal_file->io_handle,
+	     buffer_size,
+	     &data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libscca_file_read_stream_buffer(
+	              read_function,
+	              read_arguments,
+	              data,
+	              16,
+	              error );
+
+	if( read_count != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = 16;
+
+	if( memory_compare(
+	     &( data[ 4 ] ),
+	     scca_file_signature,
+	     4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_header_t *) data )->file_size,
+		 file_size );
+
+		if( ( file_size < 16 )
+		 || ( (size_t) file_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) file_size > buffer_size )
+		{
+			buffer_size = (size_t) file_size;
+
+			if( libscca_io_handle_get_compressed_data_buffer(
+			     internal_file->io_handle,
+			     buffer_size,
+			     &data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		read_size = (size_t) file_size - data_size;
+
+		read_count = libscca_file_read_stream_buffer(
+		              read_function,
+		              read_arguments,
+		              &( data[ data_size ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data.",
+			 function );
+
+			return( -1 );
+		}
+		data_size = (size_t) file_size;
+	}
+	else if( memory_compare(
+	          data,
+	          scca_mam_file_signature_win10,
+	          4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 uncompressed_data_size );
+
+		/* Check the uncompressed data size before the compressed data is read
+		 */
+		if( libscca_budget_check_uncompressed_data_size(
+		     &( internal_file->io_handle->budget ),
+		     (uint64_t) uncompressed_data_size,
+		     &( internal_file->io_handle->abort ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The size of the compressed data is not stored hence it is read
+		 * up to the end of the stream
+		 */
+		do
+		{
+			if( internal_file->io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				return( -1 );
+			}
+			if( data_size == buffer_size )
+			{
+				if( buffer_size >= (size_t) UINT32_MAX )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid file size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( buffer_size > ( (size_t) UINT32_MAX / 2 ) )
+				{
+					buffer_size = (size_t) UINT32_MAX;
+				}
+				else
+				{
+					buffer_size *= 2;
+				}
+				if( libscca_io_handle_get_compressed_data_buffer(
+				     internal_file->io_handle,
+				     buffer_size,
+				     &data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve data buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			read_size = buffer_size - data_size;
+
+			read_count = libscca_file_read_stream_buffer(
+			              read_function,
+			              read_arguments,
+			              &( data[ data_size ] ),
+			              read_size,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data.",
+				 function );
+
+				return( -1 );
+			}
+			data_size += (size_t) read_count;
+		}
+		while( (size_t) read_count == read_size );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_open_memory(
+	     file,
+	     data,
+	     data_size,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from stream data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from a forward-only stream
+ * The read function is called until the buffer is filled or the end of the stream is reached
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libscca_file_read_stream_buffer(
+         ssize_t (*read_function)(
+                  uint8_t *buffer,
+                  size_t buffer_size,
+                  void *read_arguments ),
+         void *read_arguments,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libscca_file_read_stream_buffer";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( read_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read function.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		read_count = read_function(
+		              &( buffer[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              read_arguments );
+
+		if( ( read_count < 0 )
+		 || ( (size_t) read_count > ( buffer_size - buffer_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Closes a file
+ * The data buffers, arena and array capacity are retained so that
+ * the file can be reused to open another file with few allocations
+ * Returns 0 if successful or -1 on error
+ */
+int libscca_file_close(
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_close";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->parse_cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file is shared by parse cache, use libscca_parse_cache_release_file instead.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->shared_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file is shared, use libscca_file_release instead.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libscca_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+	internal_file->access_flags   = 0;
+
+	/* The data is unmapped after the memory range file IO handle
+	 * that references it was freed
+	 */
+	if( internal_file->mapped_file != NULL )
+	{
+		if( libscca_mapped_file_close(
+		     internal_file->mapped_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close mapped file.",
+			 function );
+
+			result = -1;
+		}
+	}
+
+	if( libscca_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		if( libfdata_list_free(
+		     &( internal_file->compressed_blocks_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->compressed_blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		if( libfdata_stream_free(
+		     &( internal_file->uncompressed_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncompressed data strea,.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->uncompressed_data      = NULL;
+	internal_file->uncompressed_data_size = 0;
+
+	if( internal_file->file_header != NULL )
+	{
+		if( libscca_file_header_free(
+		     &( internal_file->file_header ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file header.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->file_information != NULL )
+	{
+		if( libscca_file_information_free(
+		     &( internal_file->file_information ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file information.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The file metrics handles are allocated from the arena and released
+	 * in one step when the arena is cleared
+	 */
+	if( libscca_file_metrics_values_clear(
+	     internal_file->file_metrics_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear file metrics values.",
+		 function );
+
+		result = -1;
+	}
+	internal_file->file_metrics_handles            = NULL;
+	internal_file->file_metrics_start_time_order    = NULL;
+	internal_file->file_metrics_filename_hash_table = NULL;
+
+	if( libscca_arena_clear(
+	     internal_file->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		result = -1;
+	}
+	if( libscca_trace_chain_clear(
+	     internal_file->trace_chain,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear trace chain.",
+		 function );
+
+		result = -1;
+	}
+	if( libscca_filename_strings_clear(
+	     internal_file->filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear filename strings.",
+		 function );
+
+		result = -1;
+	}
+	if( libscca_volumes_clear(
+	     internal_file->volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear volumes.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Compares the file with its current data and updates the parsed data
+ * The file header and file information are read again and only the sections
+ * of which the offset or size changed are read again, the other sections are retained
+ * The parse statistics cover the update, hence the allocated size of retained sections is not included
+ * If the update fails the file must be closed
+ * Returns 1 if the file changed, 0 if not or -1 on error
+ */
+int libscca_file_compare_and_update(
+     libscca_file_t *file,
+     uint32_t *update_flags,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_compare_and_update";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->parse_cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file is shared by parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->shared_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file is shared.",
+		 function );
+
+		return( -1 );
+	}
+	if( update_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid update flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO handle is reopened, when it was opened by the library,
+	 * so that the data of a file that was replaced is read
+	 */
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_reopen(
+		     internal_file->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to reopen file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The parsed sections are retained and compared with the current data
+	 * by libscca_file_clear_updated_sections
+	 */
+	internal_file->previous_file_header      = internal_file->file_header;
+	internal_file->previous_file_information = internal_file->file_information;
+	internal_file->file_header               = NULL;
+	internal_file->file_information          = NULL;
+	internal_file->update_flags              = 0;
+
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		if( libfdata_list_free(
+		     &( internal_file->compressed_blocks_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_file->compressed_blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free compressed blocks cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file->uncompressed_data_stream != NULL )
+	{
+		if( libfdata_stream_free(
+		     &( internal_file->uncompressed_data_stream ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncompressed data stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->uncompressed_data      = NULL;
+	internal_file->uncompressed_data_size = 0;
+
+	if( libscca_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_read(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_header_free(
+	     &( internal_file->previous_file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_information_free(
+	     &( internal_file->previous_file_information ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous file information.",
+		 function );
+
+		goto on_error;
+	}
+	*update_flags = internal_file->update_flags;
+
+	if( internal_file->update_flags != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( internal_file->previous_file_information != NULL )
+	{
+		libscca_file_information_free(
+		 &( internal_file->previous_file_information ),
+		 NULL );
+	}
+	if( internal_file->previous_file_header != NULL )
+	{
+		libscca_file_header_free(
+		 &( internal_file->previous_file_header ),
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Records the error domain and code of a failed read without setting an error
+ * A read that exceeded the deadline is recorded as such, a read that was otherwise
+ * aborted, which includes an exceeded parse budget, is recorded as an abort request
+ * and any other failure as a read failure
+ */
+void libscca_file_set_open_error(
+      libscca_internal_file_t *internal_file )
+{
+	if( internal_file == NULL )
+	{
+		return;
+	}
+	if( ( internal_file->io_handle != NULL )
+	 && ( internal_file->io_handle->budget.deadline_exceeded != 0 ) )
+	{
+		internal_file->open_error_domain = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+		internal_file->open_error_code   = LIBSCCA_BUDGET_RUNTIME_ERROR_DEADLINE_EXCEEDED;
+	}
+	else if( ( internal_file->io_handle != NULL )
+	      && ( internal_file->io_handle->abort != 0 ) )
+	{
+		internal_file->open_error_domain = LIBCERROR_ERROR_DOMAIN_RUNTIME;
+		internal_file->open_error_code   = LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED;
+	}
+	else
+	{
+		internal_file->open_error_domain = LIBCERROR_ERROR_DOMAIN_IO;
+		internal_file->open_error_code   = LIBCERROR_IO_ERROR_READ_FAILED;
+	}
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_read(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function               = "libscca_file_open_read";
+	int maximum_number_of_cache_entries = 0;
+	int result                          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed blocks list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - compressed blocks cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+	internal_file->io_handle->budget.number_of_steps   = 0;
+	internal_file->io_handle->budget.deadline_exceeded = 0;
+
+	if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_MEASURE_READ_TIMES ) != 0 )
+	{
+		internal_file->io_handle->statistics.measure_read_times = 1;
+	}
+	/* The data buffers and arena blocks retained from a previous open
+	 * are part of the memory usage of the file
+	 */
+	internal_file->io_handle->statistics.allocated_size = (uint64_t) internal_file->io_handle->compressed_data_size
+	                                                    + (uint64_t) internal_file->io_handle->uncompressed_data_buffer_size
+	                                                    + (uint64_t) internal_file->io_handle->section_data_size;
+
+	if( internal_file->arena != NULL )
+	{
+		internal_file->io_handle->statistics.allocated_size += (uint64_t) internal_file->arena->allocated_size;
+	}
+	internal_file->io_handle->statistics.maximum_allocated_size = internal_file->io_handle->statistics.allocated_size;
+
+	LIBSCCA_TRACEPOINT_OPEN_BEGIN( internal_file->io_handle->file_size_hint )
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_OPEN )
+
+	if( libscca_statistics_start_timer(
+	     &( internal_file->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start section read timer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER )
+
+	if( libscca_io_handle_read_compressed_file_header(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER )
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER )
+
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_COMPRESSED_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed header read time.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->io_handle->file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		/* The data of an uncompressed file is read directly from the file IO handle
+		 * with a single read instead of a read per section
+		 */
+		if( libscca_file_read_uncompressed_file_data(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read uncompressed file data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_CONTIGUOUS_DATA ) != 0 )
+	{
+		LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+		if( libscca_file_read_compressed_data(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+	}
+	else
+	{
+		if( libfdata_list_initialize(
+		     &( internal_file->compressed_blocks_list ),
+		     (intptr_t *) internal_file->io_handle,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libscca_compressed_block_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks list.",
+			 function );
+
+			goto on_error;
+		}
+		maximum_number_of_cache_entries = internal_file->io_handle->maximum_number_of_cached_blocks;
+
+		if( maximum_number_of_cache_entries == 0 )
+		{
+			maximum_number_of_cache_entries = LIBSCCA_MAXIMUM_CACHE_ENTRIES_COMPRESSED_BLOCKS;
+		}
+		if( libfcache_cache_initialize(
+		     &( internal_file->compressed_blocks_cache ),
+		     maximum_number_of_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks cache.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading compressed blocks:\n" );
+		}
+#endif
+		LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+		if( libscca_io_handle_read_compressed_blocks(
+		     internal_file->io_handle,
+		     internal_file->compressed_blocks_list,
+		     error ) != 1 )
+		{
+			LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read compressed blocks.",
+			 function );
+
+			goto on_error;
+		}
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+		if( libscca_compressed_blocks_stream_initialize(
+		     &( internal_file->uncompressed_data_stream ),
+		     internal_file->compressed_blocks_list,
+		     internal_file->compressed_blocks_cache,
+		     &( internal_file->io_handle->statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compressed blocks stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The compressed blocks read time covers either the block scan or
+	 * the contiguous decompression of the compressed data
+	 */
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_COMPRESSED_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compressed blocks read time.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		result = libscca_file_read_uncompressed_data(
+		          internal_file,
+		          error );
+	}
+	else
+	{
+		result = libscca_file_read_uncompressed_data_stream(
+		          internal_file,
+		          file_io_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_OPEN )
+	LIBSCCA_TRACEPOINT_OPEN_END(
+	 1,
+	 internal_file->io_handle->file_size,
+	 internal_file->io_handle->format_version,
+	 internal_file->file_information->number_of_file_metrics_entries,
+	 internal_file->file_information->number_of_trace_chain_array_entries,
+	 internal_file->file_information->number_of_volumes )
+
+	return( 1 );
+
+on_error:
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_OPEN )
+	LIBSCCA_TRACEPOINT_OPEN_END(
+	 -1,
+	 internal_file->io_handle->file_size,
+	 internal_file->io_handle->format_version,
+	 0,
+	 0,
+	 0 )
+
+	if( internal_file->file_information != NULL )
+	{
+		libscca_file_information_free(
+		 &( internal_file->file_information ),
+		 NULL );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libscca_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	libscca_file_metrics_values_clear(
+	 internal_file->file_metrics_values,
+	 NULL );
+
+	internal_file->file_metrics_handles            = NULL;
+	internal_file->file_metrics_start_time_order    = NULL;
+	internal_file->file_metrics_filename_hash_table = NULL;
+
+	libscca_arena_clear(
+	 internal_file->arena,
+	 NULL );
+
+	libscca_trace_chain_clear(
+	 internal_file->trace_chain,
+	 NULL );
+
+	libscca_filename_strings_clear(
+	 internal_file->filename_strings,
+	 NULL );
+
+	libscca_volumes_clear(
+	 internal_file->volumes,
+	 NULL );
+
+	internal_file->uncompressed_data      = NULL;
+	internal_file->uncompressed_data_size = 0;
+
+	return( -1 );
+}
+/* Reads the compressed data and decompresses it into a single uncompressed data buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_compressed_data(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *compressed_data    = NULL;
+	static char *function       = "libscca_file_read_compressed_data";
+	size_t compressed_data_size = 0;
+	ssize_t read_count          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->file_size <= 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The compressed data directly follows the 8 byte compressed file header
+	 */
+	compressed_data_size = (size_t) internal_file->io_handle->file_size - 8;
+
+	if( libscca_io_handle_get_compressed_data_buffer(
+	     internal_file->io_handle,
+	     compressed_data_size,
+	     &compressed_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libscca_io_handle_read_buffer_at_offset(
+	              internal_file->io_handle,
+	              file_io_handle,
+	              8,
+	              compressed_data,
+	              compressed_data_size,
+	              error );
+
+	if( read_count != (ssize_t) compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read compressed data.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( libscca_file_decompress_data(
+	     internal_file,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of an uncompressed file into a single uncompressed data buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_uncompressed_file_data(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function         = "libscca_file_read_uncompressed_file_data";
+	size_t uncompressed_data_size = 0;
+	ssize_t read_count            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->uncompressed_data_size == 0 )
+	 || ( internal_file->io_handle->uncompressed_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The uncompressed data of an uncompressed file is the data of the file itself
+	 */
+	uncompressed_data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+
+	if( libscca_io_handle_get_uncompressed_data_buffer(
+	     internal_file->io_handle,
+	     uncompressed_data_size,
+	     &( internal_file->uncompressed_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libscca_io_handle_read_buffer_at_offset(
+	              internal_file->io_handle,
+	              file_io_handle,
+	              0,
+	              internal_file->uncompressed_data,
+	              uncompressed_data_size,
+	              error );
+
+	if( read_count != (ssize_t) uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+
+	internal_file->uncompressed_data_size = uncompressed_data_size;
+
+	return( 1 );
+
+on_error:
+	internal_file->uncompressed_data = NULL;
+
+	return( -1 );
+}
+
+/* Reads the file header, file information and sections from the uncompressed data stream
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_uncompressed_data_stream(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_read_uncompressed_data_stream";
+	size64_t file_size    = 0;
+	off64_t file_offset   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_header_initialize(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_FILE_HEADER )
+
+	if( libscca_file_header_read_data_stream(
+	     internal_file->file_header,
+	     internal_file->uncompressed_data_stream,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_HEADER )
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_HEADER )
+
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_FILE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file header read time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_io_handle_set_format_version(
+	     internal_file->io_handle,
+	     internal_file->file_header->format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format version.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( internal_file->io_handle->uncompressed_data_size != internal_file->file_header->file_size )
+	{
+		internal_file->io_handle->corruption_flags |= LIBSCCA_CORRUPTION_FLAG_SIZE_MISMATCH;
+	}
+	else
+	{
+		internal_file->io_handle->corruption_flags &= ~( LIBSCCA_CORRUPTION_FLAG_SIZE_MISMATCH );
+	}
+	if( libfdata_stream_get_size(
+	     internal_file->uncompressed_data_stream,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file information:\n" );
+	}
+#endif
+	if( libscca_file_information_initialize(
+	     &( internal_file->file_information ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file information.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_FILE_INFORMATION )
+
+	if( libscca_file_information_read_stream(
+	     internal_file->file_information,
+	     internal_file->uncompressed_data_stream,
+	     file_io_handle,
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_INFORMATION )
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file information from stream.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_INFORMATION )
+
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_FILE_INFORMATION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file information read time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_get_offset(
+	     internal_file->uncompressed_data_stream,
+	     &file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data stream current offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_read_sections(
+	     internal_file,
+	     file_io_handle,
+	     file_size,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sections.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Opens a file for reading from a memory buffer
+ * Uncompressed data is parsed in place, compressed data is decompressed into a single buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_open_read_data(
+     libscca_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_open_read_data";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+	internal_file->io_handle->budget.number_of_steps   = 0;
+	internal_file->io_handle->budget.deadline_exceeded = 0;
+
+	if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_MEASURE_READ_TIMES ) != 0 )
+	{
+		internal_file->io_handle->statistics.measure_read_times = 1;
+	}
+	/* The data buffers and arena blocks retained from a previous open
+	 * are part of the memory usage of the file
+	 */
+	internal_file->io_handle->statistics.allocated_size = (uint64_t) internal_file->io_handle->compressed_data_size
+	                                                    + (uint64_t) internal_file->io_handle->uncompressed_data_buffer_size
+	                                                    + (uint64_t) internal_file->io_handle->section_data_size;
+
+	if( internal_file->arena != NULL )
+	{
+		internal_file->io_handle->statistics.allocated_size += (uint64_t) internal_file->arena->allocated_size;
+	}
+	internal_file->io_handle->statistics.maximum_allocated_size = internal_file->io_handle->statistics.allocated_size;
+
+	LIBSCCA_TRACEPOINT_OPEN_BEGIN( data_size )
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_OPEN )
+
+	if( libscca_statistics_start_timer(
+	     &( internal_file->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start section read timer.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->file_size = (uint32_t) data_size;
+
+	/* The data is provided by the caller hence it is counted as read as a whole
+	 */
+	internal_file->io_handle->statistics.number_of_bytes_read += (uint64_t) data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER )
+
+	if( libscca_io_handle_read_compressed_file_header_data(
+	     internal_file->io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER )
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER )
+
+	if( internal_file->io_handle->file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		internal_file->uncompressed_data      = (uint8_t *) data;
+		internal_file->uncompressed_data_size = data_size;
+	}
+	else
+	{
+		LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+		result = libscca_file_decompress_data(
+		          internal_file,
+		          &( data[ 8 ] ),
+		          data_size - 8,
+		          error );
+
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS )
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_read_uncompressed_data(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_OPEN )
+	LIBSCCA_TRACEPOINT_OPEN_END(
+	 1,
+	 internal_file->io_handle->file_size,
+	 internal_file->io_handle->format_version,
+	 internal_file->file_information->number_of_file_metrics_entries,
+	 internal_file->file_information->number_of_trace_chain_array_entries,
+	 internal_file->file_information->number_of_volumes )
+
+	return( 1 );
+
+on_error:
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_OPEN )
+	LIBSCCA_TRACEPOINT_OPEN_END(
+	 -1,
+	 internal_file->io_handle->file_size,
+	 internal_file->io_handle->format_version,
+	 0,
+	 0,
+	 0 )
+
+	if( internal_file->file_information != NULL )
+	{
+		libscca_file_information_free(
+		 &( internal_file->file_information ),
+		 NULL );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libscca_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	libscca_file_metrics_values_clear(
+	 internal_file->file_metrics_values,
+	 NULL );
+
+	internal_file->file_metrics_handles            = NULL;
+	internal_file->file_metrics_start_time_order    = NULL;
+	internal_file->file_metrics_filename_hash_table = NULL;
+
+	libscca_arena_clear(
+	 internal_file->arena,
+	 NULL );
+
+	libscca_trace_chain_clear(
+	 internal_file->trace_chain,
+	 NULL );
+
+	libscca_filename_strings_clear(
+	 internal_file->filename_strings,
+	 NULL );
+
+	libscca_volumes_clear(
+	 internal_file->volumes,
+	 NULL );
+
+	internal_file->uncompressed_data      = NULL;
+	internal_file->uncompressed_data_size = 0;
+
+	return( -1 );
+}
+/* Decompresses the compressed data into a single uncompressed data buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_decompress_data(
+     libscca_internal_file_t *internal_file,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache = NULL;
+	static char *function                                   = "libscca_file_decompress_data";
+	size_t uncompressed_data_size                           = 0;
+	uint64_t identifier                                     = 0;
+	uint8_t decompression_flags                             = 0;
+	int result                                              = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - uncompressed data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->uncompressed_data_size == 0 )
+	 || ( internal_file->io_handle->uncompressed_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+
+	/* The uncompressed data buffer is owned by the IO handle and is reused by later opens
+	 */
+	if( libscca_io_handle_get_uncompressed_data_buffer(
+	     internal_file->io_handle,
+	     uncompressed_data_size,
+	     &( internal_file->uncompressed_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data is decompressed in a single step which cannot be interrupted
+	 */
+	if( internal_file->io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_budget_add_steps(
+	     &( internal_file->io_handle->budget ),
+	     ( (uint64_t) uncompressed_data_size / LIBSCCA_BUDGET_DECOMPRESSION_STEP_SIZE ) + 1,
+	     &( internal_file->io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add decompression to budget.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compressed data follows the 8-byte compressed file header, which
+	 * is used as the block offset in the shared block cache
+	 */
+	if( internal_file->io_handle->block_cache != NULL )
+	{
+		if( libscca_hash_calculate_xxh64(
+		     compressed_data,
+		     compressed_data_size,
+		     0,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate compressed data hash.",
+			 function );
+
+			goto on_error;
+		}
+		result = libscca_block_cache_get_data(
+		          internal_file->io_handle->block_cache,
+		          identifier,
+		          8,
+		          compressed_data_size,
+		          internal_file->uncompressed_data,
+		          uncompressed_data_size,
+		          &uncompressed_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve uncompressed data from block cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		/* The decoding of the chunks and the expanding of the matches are overlapped,
+		 * the chunks themselves cannot be decompressed independently
+		 */
+		if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_PARALLEL_DECOMPRESSION ) != 0 )
+		{
+			decompression_flags = LIBSCCA_LZXPRESS_HUFFMAN_FLAG_TWO_PHASE;
+		}
+		if( libscca_io_handle_get_decoder_cache(
+		     internal_file->io_handle,
+		     &decoder_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve decoder cache.",
+			 function );
+
+			goto on_error;
+		}
+		LIBSCCA_TRACEPOINT_BLOCK_DECODE_BEGIN(
+		 compressed_data_size,
+		 uncompressed_data_size )
+
+		result = libscca_lzxpress_huffman_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          internal_file->uncompressed_data,
+		          &uncompressed_data_size,
+		          decompression_flags,
+		          decoder_cache,
+		          error );
+
+		LIBSCCA_TRACEPOINT_BLOCK_DECODE_END(
+		 result,
+		 compressed_data_size,
+		 uncompressed_data_size )
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress compressed data.",
+			 function );
+
+			goto on_error;
+		}
+		/* The compressed data is decompressed in one step and counted as a single block
+		 */
+		internal_file->io_handle->statistics.number_of_decompressed_blocks += 1;
+
+		if( internal_file->io_handle->block_cache != NULL )
+		{
+			if( libscca_block_cache_set_data(
+			     internal_file->io_handle->block_cache,
+			     identifier,
+			     8,
+			     compressed_data_size,
+			     (size_t) internal_file->io_handle->uncompressed_data_size,
+			     internal_file->uncompressed_data,
+			     uncompressed_data_size,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set uncompressed data in block cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	internal_file->uncompressed_data_size = uncompressed_data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: uncompressed data:\n",
+		 function );
+		libcnotify_print_data(
+		 internal_file->uncompressed_data,
+		 internal_file->uncompressed_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	internal_file->uncompressed_data = NULL;
+
+	return( -1 );
+}
+
+/* Reads the file header, file information and sections from the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_uncompressed_data(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function        = "libscca_file_read_uncompressed_data";
+	size_t file_information_size = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_header_initialize(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_FILE_HEADER )
+
+	if( libscca_file_header_read_data(
+	     internal_file->file_header,
+	     internal_file->uncompressed_data,
+	     internal_file->uncompressed_data_size,
+	     error ) != 1 )
+	{
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_HEADER )
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_HEADER )
+
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_FILE_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file header read time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_io_handle_set_format_version(
+	     internal_file->io_handle,
+	     internal_file->file_header->format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set format version.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( internal_file->io_handle->uncompressed_data_size != internal_file->file_header->file_size )
+	{
+		internal_file->io_handle->corruption_flags |= LIBSCCA_CORRUPTION_FLAG_SIZE_MISMATCH;
+	}
+	else
+	{
+		internal_file->io_handle->corruption_flags &= ~( LIBSCCA_CORRUPTION_FLAG_SIZE_MISMATCH );
+	}
+	file_information_size = internal_file->io_handle->format_layout->file_information_data_size;
+
+	if( file_information_size > ( internal_file->uncompressed_data_size - sizeof( scca_file_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file information:\n" );
+	}
+#endif
+	if( libscca_file_information_initialize(
+	     &( internal_file->file_information ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file information.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_FILE_INFORMATION )
+
+	if( libscca_file_information_read_data(
+	     internal_file->file_information,
+	     internal_file->io_handle,
+	     &( internal_file->uncompressed_data[ sizeof( scca_file_header_t ) ] ),
+	     file_information_size,
+	     error ) != 1 )
+	{
+		LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_INFORMATION )
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file information.",
+		 function );
+
+		return( -1 );
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_INFORMATION )
+
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_FILE_INFORMATION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file information read time.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_read_sections(
+	     internal_file,
+	     NULL,
+	     (size64_t) internal_file->uncompressed_data_size,
+	     (off64_t) ( sizeof( scca_file_header_t ) + file_information_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sections.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a section
+ * The data is referenced in the uncompressed data or in the decompressed block
+ * that contains the section, otherwise it is read into the section data buffer
+ * of the IO handle, which is shared by all sections
+ * The data is only valid until the next section data is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_section_data(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t section_offset,
+     size64_t section_size,
+     const uint8_t **section_data,
+     libcerror_error_t **error )
+{
+	uint8_t *section_data_buffer = NULL;
+	static char *function        = "libscca_file_get_section_data";
+	size64_t data_size           = 0;
+	ssize_t read_count           = 0;
+	int result                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_size == 0 )
+	 || ( section_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		data_size = (size64_t) internal_file->uncompressed_data_size;
+	}
+	else
+	{
+		data_size = (size64_t) internal_file->io_handle->uncompressed_data_size;
+	}
+	if( ( (size64_t) section_offset > data_size )
+	 || ( section_size > ( data_size - section_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section offset: %" PRIu32 " and size: %" PRIu64 " value out of bounds.",
+		 function,
+		 section_offset,
+		 section_size );
+
+		return( -1 );
+	}
+	if( internal_file->uncompressed_data != NULL )
+	{
+		*section_data = &( internal_file->uncompressed_data[ section_offset ] );
+
+		return( 1 );
+	}
+	/* A section that is contained by a single block is referenced in the decompressed block data
+	 */
+	if( internal_file->compressed_blocks_list != NULL )
+	{
+		result = libscca_compressed_blocks_stream_get_data_span(
+		          internal_file->compressed_blocks_list,
+		          internal_file->compressed_blocks_cache,
+		          file_io_handle,
+		          (off64_t) section_offset,
+		          (size_t) section_size,
+		          &( internal_file->io_handle->statistics ),
+		          section_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve section data span at offset: %" PRIu32 ".",
+			 function,
+			 section_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libscca_io_handle_get_section_data_buffer(
+	     internal_file->io_handle,
+	     (size_t) section_size,
+	     &section_data_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve section data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfdata_stream_seek_offset(
+	     internal_file->uncompressed_data_stream,
+	     (off64_t) section_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek section offset: %" PRIu32 ".",
+		 function,
+		 section_offset );
+
+		return( -1 );
+	}
+	read_count = libfdata_stream_read_buffer(
+	              internal_file->uncompressed_data_stream,
+	              (intptr_t *) file_io_handle,
+	              section_data_buffer,
+	              (size_t) section_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) section_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read section data.",
+		 function );
+
+		return( -1 );
+	}
+	*section_data = section_data_buffer;
+
+	return( 1 );
+}
+
+/* Compares the file header and file information with those of the previous parse
+ * and clears the sections of which the offset or size changed, so that they are read again
+ * The update flags are set for the changed run information and sections
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_clear_updated_sections(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libscca_file_header_t *previous_file_header           = NULL;
+	libscca_file_information_t *previous_file_information = NULL;
+	static char *function                                 = "libscca_file_clear_updated_sections";
+	uint32_t update_flags                                 = 0;
+	int last_run_time_index                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->previous_file_header == NULL )
+	 || ( internal_file->previous_file_information == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing previous file header or file information.",
+		 function );
+
+		return( -1 );
+	}
+	previous_file_header      = internal_file->previous_file_header;
+	previous_file_information = internal_file->previous_file_information;
+
+	/* A different format version, prefetch hash or executable filename
+	 * indicates that the file was replaced, hence all sections are read again
+	 */
+	if( ( internal_file->file_header->format_version != previous_file_header->format_version )
+	 || ( internal_file->file_header->prefetch_hash != previous_file_header->prefetch_hash )
+	 || ( internal_file->file_header->executable_filename_size != previous_file_header->executable_filename_size )
+	 || ( memory_compare(
+	       internal_file->file_header->executable_filename,
+	       previous_file_header->executable_filename,
+	       previous_file_header->executable_filename_size ) != 0 ) )
+	{
+		update_flags = LIBSCCA_UPDATE_FLAG_REPARSED
+		             | LIBSCCA_UPDATE_FLAG_RUN_INFORMATION
+		             | LIBSCCA_UPDATE_FLAG_FILE_METRICS
+		             | LIBSCCA_UPDATE_FLAG_TRACE_CHAIN
+		             | LIBSCCA_UPDATE_FLAG_FILENAMES
+		             | LIBSCCA_UPDATE_FLAG_VOLUMES;
+	}
+	else
+	{
+		if( internal_file->file_information->run_count != previous_file_information->run_count )
+		{
+			update_flags |= LIBSCCA_UPDATE_FLAG_RUN_INFORMATION;
+		}
+		for( last_run_time_index = 0;
+		     last_run_time_index < LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES;
+		     last_run_time_index++ )
+		{
+			if( internal_file->file_information->last_run_time[ last_run_time_index ] != previous_file_information->last_run_time[ last_run_time_index ] )
+			{
+				update_flags |= LIBSCCA_UPDATE_FLAG_RUN_INFORMATION;
+			}
+		}
+		if( ( internal_file->file_information->metrics_array_offset != previous_file_information->metrics_array_offset )
+		 || ( internal_file->file_information->number_of_file_metrics_entries != previous_file_information->number_of_file_metrics_entries ) )
+		{
+			update_flags |= LIBSCCA_UPDATE_FLAG_FILE_METRICS;
+		}
+		if( ( internal_file->file_information->trace_chain_array_offset != previous_file_information->trace_chain_array_offset )
+		 || ( internal_file->file_information->number_of_trace_chain_array_entries != previous_file_information->number_of_trace_chain_array_entries ) )
+		{
+			update_flags |= LIBSCCA_UPDATE_FLAG_TRACE_CHAIN;
+		}
+		if( ( internal_file->file_information->filename_strings_offset != previous_file_information->filename_strings_offset )
+		 || ( internal_file->file_information->filename_strings_size != previous_file_information->filename_strings_size ) )
+		{
+			update_flags |= LIBSCCA_UPDATE_FLAG_FILENAMES;
+		}
+		if( ( internal_file->file_information->volumes_information_offset != previous_file_information->volumes_information_offset )
+		 || ( internal_file->file_information->volumes_information_size != previous_file_information->volumes_information_size )
+		 || ( internal_file->file_information->number_of_volumes != previous_file_information->number_of_volumes ) )
+		{
+			update_flags |= LIBSCCA_UPDATE_FLAG_VOLUMES;
+		}
+	}
+	/* The file metrics handles are allocated from the arena and released
+	 * in one step when the arena is cleared
+	 */
+	if( ( update_flags & LIBSCCA_UPDATE_FLAG_FILE_METRICS ) != 0 )
+	{
+		if( libscca_file_metrics_values_clear(
+		     internal_file->file_metrics_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear file metrics values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->file_metrics_handles            = NULL;
+		internal_file->file_metrics_start_time_order    = NULL;
+		internal_file->file_metrics_filename_hash_table = NULL;
+
+		if( libscca_arena_clear(
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( update_flags & LIBSCCA_UPDATE_FLAG_TRACE_CHAIN ) != 0 )
+	{
+		if( libscca_trace_chain_clear(
+		     internal_file->trace_chain,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear trace chain.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( update_flags & LIBSCCA_UPDATE_FLAG_FILENAMES ) != 0 )
+	{
+		if( libscca_filename_strings_clear(
+		     internal_file->filename_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear filename strings.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( update_flags & LIBSCCA_UPDATE_FLAG_VOLUMES ) != 0 )
+	{
+		if( libscca_volumes_clear(
+		     internal_file->volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear volumes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->update_flags = update_flags;
+
+	return( 1 );
+}
+
+/* Reads the sections that follow the file information
+ * The sections are read from the uncompressed data when available
+ * otherwise from the uncompressed data stream
+ * A section that cannot be read is flagged as corrupted instead when the file
+ * is opened with LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_sections(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_read_sections";
+	uint32_t update_flags = 0;
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->uncompressed_data != NULL )
+	 && ( file_size > (size64_t) internal_file->uncompressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* When the file is updated only the sections that changed are read again
+	 * otherwise all sections are read
+	 */
+	if( internal_file->previous_file_information != NULL )
+	{
+		if( libscca_file_clear_updated_sections(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear updated sections.",
+			 function );
+
+			return( -1 );
+		}
+		update_flags = internal_file->update_flags;
+
+		/* Sections that are read again are no longer flagged as corrupted
+		 */
+		if( ( update_flags & LIBSCCA_UPDATE_FLAG_FILE_METRICS ) != 0 )
+		{
+			internal_file->io_handle->corruption_flags &= ~( LIBSCCA_CORRUPTION_FLAG_FILE_METRICS );
+		}
+		if( ( update_flags & LIBSCCA_UPDATE_FLAG_TRACE_CHAIN ) != 0 )
+		{
+			internal_file->io_handle->corruption_flags &= ~( LIBSCCA_CORRUPTION_FLAG_TRACE_CHAIN );
+		}
+		if( ( update_flags & LIBSCCA_UPDATE_FLAG_FILENAMES ) != 0 )
+		{
+			internal_file->io_handle->corruption_flags &= ~( LIBSCCA_CORRUPTION_FLAG_FILENAMES );
+		}
+		if( ( update_flags & LIBSCCA_UPDATE_FLAG_VOLUMES ) != 0 )
+		{
+			internal_file->io_handle->corruption_flags &= ~( LIBSCCA_CORRUPTION_FLAG_VOLUMES );
+		}
+	}
+	else
+	{
+		update_flags = LIBSCCA_UPDATE_FLAG_FILE_METRICS
+		             | LIBSCCA_UPDATE_FLAG_FILENAMES
+		             | LIBSCCA_UPDATE_FLAG_VOLUMES;
+	}
+	if( libscca_file_validate_sections(
+	     internal_file,
+	     file_size,
+	     file_offset,
+	     update_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unable to validate sections.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_read_file_metrics_section(
+	          internal_file,
+	          file_io_handle,
+	          update_flags,
+	          error );
+
+	if( result != 1 )
+	{
+		result = libscca_file_recover_section(
+		          internal_file,
+		          LIBSCCA_CORRUPTION_FLAG_FILE_METRICS,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file metrics section.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_read_trace_chain_section(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		result = libscca_file_recover_section(
+		          internal_file,
+		          LIBSCCA_CORRUPTION_FLAG_TRACE_CHAIN,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trace chain section.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_read_filename_strings_section(
+	          internal_file,
+	          file_io_handle,
+	          update_flags,
+	          error );
+
+	if( result != 1 )
+	{
+		result = libscca_file_recover_section(
+		          internal_file,
+		          LIBSCCA_CORRUPTION_FLAG_FILENAMES,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read filename strings section.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_read_volumes_section(
+	          internal_file,
+	          file_io_handle,
+	          update_flags,
+	          error );
+
+	if( result != 1 )
+	{
+		result = libscca_file_recover_section(
+		          internal_file,
+		          LIBSCCA_CORRUPTION_FLAG_VOLUMES,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volumes section.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Validates the sections that follow the file information
+ * The offsets and sizes of the sections are validated once against the file size
+ * and the sections that precede them. The sections are then read from the resulting
+ * section views without validating their offsets again.
+ * The offsets of sections that are skipped, due to the access flags, are still validated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_validate_sections(
+     libscca_internal_file_t *internal_file,
+     size64_t file_size,
+     off64_t file_offset,
+     uint32_t update_flags,
+     libcerror_error_t **error )
+{
+	libscca_file_information_t *file_information = NULL;
+	static char *function                        = "libscca_file_validate_sections";
+	size64_t section_size                        = 0;
+	off64_t next_offset                          = 0;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	file_information = internal_file->file_information;
+
+	internal_file->file_metrics_view.offset     = 0;
+	internal_file->file_metrics_view.size       = 0;
+	internal_file->trace_chain_view.offset      = 0;
+	internal_file->trace_chain_view.size        = 0;
+	internal_file->filename_strings_view.offset = 0;
+	internal_file->filename_strings_view.size   = 0;
+	internal_file->volumes_view.offset          = 0;
+	internal_file->volumes_view.size            = 0;
+
+	internal_file->number_of_file_metrics_entries = 0;
+
+	if( file_information->metrics_array_offset != 0 )
+	{
+		next_offset = file_information->trace_chain_array_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = file_information->filename_strings_offset;
+		}
+		if( next_offset == 0 )
+		{
+			next_offset = file_information->volumes_information_offset;
+		}
+		if( ( next_offset == 0 )
+		 || ( next_offset > (off64_t) file_size ) )
+		{
+			next_offset = (off64_t) file_size;
+		}
+		section_size = (size64_t) file_information->number_of_file_metrics_entries
+		             * (size64_t) internal_file->io_handle->format_layout->file_metrics_entry_data_size;
+
+		/* Allow for a margin of 8 + 4 bytes for version 30 variant 2
+		 */
+		if( ( file_information->metrics_array_offset < ( file_offset - 12 ) )
+		 || ( file_information->metrics_array_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid metrics array offset value out of bounds: %jd > %jd > %jd.",
+			 function, file_offset, file_information->metrics_array_offset, next_offset );
+
+			result = 0;
+		}
+		else if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS ) == 0 )
+		      && ( section_size > ( file_size - file_information->metrics_array_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of file metrics entries value out of bounds.",
+			 function );
+
+			result = 0;
+		}
+		else
+		{
+			internal_file->number_of_file_metrics_entries = file_information->number_of_file_metrics_entries;
+
+			/* The bounds of all entries are validated but only the entries that are
+			 * read are part of the section, the remainder is skipped
+			 */
+			if( ( internal_file->io_handle->maximum_number_of_file_metrics_entries > 0 )
+			 && ( internal_file->number_of_file_metrics_entries > (uint32_t) internal_file->io_handle->maximum_number_of_file_metrics_entries ) )
+			{
+				internal_file->number_of_file_metrics_entries = (uint32_t) internal_file->io_handle->maximum_number_of_file_metrics_entries;
+			}
+			internal_file->file_metrics_view.offset = file_information->metrics_array_offset;
+			internal_file->file_metrics_view.size   = (size64_t) internal_file->number_of_file_metrics_entries
+			                                        * (size64_t) internal_file->io_handle->format_layout->file_metrics_entry_data_size;
+
+			if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS ) == 0 )
+			 && ( ( update_flags & LIBSCCA_UPDATE_FLAG_FILE_METRICS ) != 0 ) )
+			{
+				file_offset = (off64_t) file_information->metrics_array_offset
+				            + (off64_t) section_size;
+			}
+			result = 1;
+		}
+		if( result == 0 )
+		{
+			if( libscca_file_recover_section(
+			     internal_file,
+			     LIBSCCA_CORRUPTION_FLAG_FILE_METRICS,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	if( file_information->trace_chain_array_offset != 0 )
+	{
+		next_offset = file_information->filename_strings_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = file_information->volumes_information_offset;
+		}
+		if( ( next_offset == 0 )
+		 || ( next_offset > (off64_t) file_size ) )
+		{
+			next_offset = (off64_t) file_size;
+		}
+		if( ( file_information->trace_chain_array_offset < file_offset )
+		 || ( file_information->trace_chain_array_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid trace chain array offset value out of bounds.",
+			 function );
+
+			if( libscca_file_recover_section(
+			     internal_file,
+			     LIBSCCA_CORRUPTION_FLAG_TRACE_CHAIN,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		else
+		{
+			internal_file->trace_chain_view.offset = file_information->trace_chain_array_offset;
+			internal_file->trace_chain_view.size   = (size64_t) ( next_offset - file_information->trace_chain_array_offset );
+		}
+	}
+	if( file_information->filename_strings_offset != 0 )
+	{
+		next_offset = file_information->volumes_information_offset;
+
+		if( ( next_offset == 0 )
+		 || ( next_offset > (off64_t) file_size ) )
+		{
+			next_offset = (off64_t) file_size;
+		}
+		if( ( file_information->filename_strings_offset < file_offset )
+		 || ( file_information->filename_strings_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename strings offset value out of bounds.",
+			 function );
+
+			result = 0;
+		}
+		else if( file_information->filename_strings_size > ( next_offset - file_information->filename_strings_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename strings size value out of bounds.",
+			 function );
+
+			result = 0;
+		}
+		else
+		{
+			internal_file->filename_strings_view.offset = file_information->filename_strings_offset;
+			internal_file->filename_strings_view.size   = (size64_t) file_information->filename_strings_size;
+
+			if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) == 0 )
+			 && ( ( update_flags & LIBSCCA_UPDATE_FLAG_FILENAMES ) != 0 ) )
+			{
+				file_offset = (off64_t) file_information->filename_strings_offset
+				            + file_information->filename_strings_size;
+			}
+			result = 1;
+		}
+		if( result == 0 )
+		{
+			if( libscca_file_recover_section(
+			     internal_file,
+			     LIBSCCA_CORRUPTION_FLAG_FILENAMES,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	if( file_information->volumes_information_offset != 0 )
+	{
+		if( ( file_information->volumes_information_offset < file_offset )
+		 || ( file_information->volumes_information_offset > file_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information offset value out of bounds.",
+			 function );
+
+			result = 0;
+		}
+		else if( file_information->volumes_information_size > ( file_size - file_information->volumes_information_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information size value out of bounds.",
+			 function );
+
+			result = 0;
+		}
+		else
+		{
+			internal_file->volumes_view.offset = file_information->volumes_information_offset;
+			internal_file->volumes_view.size   = (size64_t) file_information->volumes_information_size;
+
+			result = 1;
+		}
+		if( result == 0 )
+		{
+			if( libscca_file_recover_section(
+			     internal_file,
+			     LIBSCCA_CORRUPTION_FLAG_VOLUMES,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the file metrics array section
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_file_metrics_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t update_flags,
+     libcerror_error_t **error )
+{
+	const uint8_t *section_data = NULL;
+	static char *function       = "libscca_file_read_file_metrics_section";
+	int result                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_view.offset != 0 )
+	{
+		if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS ) == 0 )
+		 && ( ( update_flags & LIBSCCA_UPDATE_FLAG_FILE_METRICS ) != 0 ) )
+		{
+			if( internal_file->io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_statistics_start_timer(
+			     &( internal_file->io_handle->statistics ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to start section read timer.",
+				 function );
+
+				return( -1 );
+			}
+			LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_FILE_METRICS )
+
+			result = libscca_file_get_section_data(
+			          internal_file,
+			          file_io_handle,
+			          internal_file->file_metrics_view.offset,
+			          internal_file->file_metrics_view.size,
+			          &section_data,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libscca_io_handle_read_file_metrics_array_data(
+				          internal_file->io_handle,
+				          section_data,
+				          (size_t) internal_file->file_metrics_view.size,
+				          internal_file->number_of_file_metrics_entries,
+				          internal_file->file_metrics_values,
+				          error );
+			}
+			LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILE_METRICS )
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file metrics array.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_statistics_add_section_read_time(
+			     &( internal_file->io_handle->statistics ),
+			     LIBSCCA_STATISTICS_SECTION_FILE_METRICS,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set file metrics read time.",
+				 function );
+
+				return( -1 );
+			}
+			/* The filename indexes are resolved here when the update retains the filename strings
+			 */
+			if( ( ( update_flags & LIBSCCA_UPDATE_FLAG_FILENAMES ) == 0 )
+			 && ( internal_file->filename_strings_view.offset != 0 )
+			 && ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) == 0 ) )
+			{
+				if( libscca_file_resolve_filename_indexes(
+				     internal_file,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to resolve file metrics filename indexes.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the trace chain array section
+ * The trace chain array is only read when verbose debug output is enabled
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_trace_chain_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_read_trace_chain_section";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_DEBUG_OUTPUT )
+	LIBSCCA_UNREFERENCED_PARAMETER( file_io_handle )
+#endif
+
+	if( internal_file->trace_chain_view.offset != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libscca_file_read_trace_chain(
+			     internal_file,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trace chain array.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	}
+	return( 1 );
+}
+
+/* Reads the filename strings section
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_filename_strings_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t update_flags,
+     libcerror_error_t **error )
+{
+	const uint8_t *section_data            = NULL;
+	static char *function                  = "libscca_file_read_filename_strings_section";
+	size_t filename_strings_allocated_size = 0;
+	int result                             = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->filename_strings_view.offset != 0 )
+	{
+		if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) == 0 )
+		 && ( ( update_flags & LIBSCCA_UPDATE_FLAG_FILENAMES ) != 0 ) )
+		{
+			if( internal_file->io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_statistics_start_timer(
+			     &( internal_file->io_handle->statistics ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to start section read timer.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_CACHE_UTF8_FILENAMES ) != 0 )
+			{
+				internal_file->filename_strings->use_utf8_cache = 1;
+			}
+			else
+			{
+				internal_file->filename_strings->use_utf8_cache = 0;
+			}
+			if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_FILENAME_BLOOM_FILTER ) != 0 )
+			{
+				internal_file->filename_strings->use_bloom_filter = 1;
+			}
+			else
+			{
+				internal_file->filename_strings->use_bloom_filter = 0;
+			}
+			if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_FRONT_CODED_FILENAMES ) != 0 )
+			{
+				internal_file->filename_strings->use_front_coding = 1;
+			}
+			else
+			{
+				internal_file->filename_strings->use_front_coding = 0;
+			}
+			internal_file->filename_strings->string_pool = internal_file->io_handle->string_pool;
+
+			LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_FILENAMES )
+
+			result = libscca_file_get_section_data(
+			          internal_file,
+			          file_io_handle,
+			          internal_file->filename_strings_view.offset,
+			          internal_file->filename_strings_view.size,
+			          &section_data,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libscca_filename_strings_read_data(
+				          internal_file->filename_strings,
+				          section_data,
+				          (size_t) internal_file->filename_strings_view.size,
+				          error );
+			}
+			LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_FILENAMES )
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read filename strings.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( libscca_budget_check_number_of_entries(
+			       &( internal_file->io_handle->budget ),
+			       (uint32_t) internal_file->filename_strings->number_of_offsets,
+			       &( internal_file->io_handle->abort ),
+			       error ) != 1 )
+			 || ( libscca_budget_add_steps(
+			       &( internal_file->io_handle->budget ),
+			       (uint64_t) internal_file->filename_strings->number_of_offsets,
+			       &( internal_file->io_handle->abort ),
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: filename strings exceed budget.",
+				 function );
+
+				return( -1 );
+			}
+			/* The filename strings are copied into the strings value and the offsets,
+			 * case folded hashes and UTF-8 strings remain allocated until the file is closed
+			 * Interned filename strings are accounted for by the string pool
+			 * Front-coded filename strings are not copied into the strings value
+			 */
+			filename_strings_allocated_size = ( sizeof( uint32_t ) + sizeof( uint64_t ) ) * (size_t) internal_file->filename_strings->number_of_offsets;
+
+			if( internal_file->filename_strings->string_identifiers != NULL )
+			{
+				filename_strings_allocated_size += sizeof( uint32_t ) * (size_t) internal_file->filename_strings->number_of_offsets;
+			}
+			else if( internal_file->filename_strings->front_coded_strings != NULL )
+			{
+				filename_strings_allocated_size += internal_file->filename_strings->front_coded_strings->data_size
+				                                 + ( sizeof( uint32_t ) * (size_t) internal_file->filename_strings->front_coded_strings->number_of_blocks );
+			}
+			else
+			{
+				filename_strings_allocated_size += (size_t) internal_file->filename_strings_view.size;
+			}
+			if( internal_file->filename_strings->utf8_strings != NULL )
+			{
+				filename_strings_allocated_size += internal_file->filename_strings->utf8_strings_size
+				                                 + ( sizeof( uint32_t ) * (size_t) ( internal_file->filename_strings->number_of_offsets + 1 ) );
+			}
+			if( libscca_statistics_add_allocated_size(
+			     &( internal_file->io_handle->statistics ),
+			     filename_strings_allocated_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add filename strings allocated size.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_file_resolve_filename_indexes(
+			     internal_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to resolve file metrics filename indexes.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_statistics_add_section_read_time(
+			     &( internal_file->io_handle->statistics ),
+			     LIBSCCA_STATISTICS_SECTION_FILENAMES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set filenames read time.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the volumes information section
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_volumes_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t update_flags,
+     libcerror_error_t **error )
+{
+	const uint8_t *section_data = NULL;
+	static char *function       = "libscca_file_read_volumes_section";
+	int result                  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->volumes_view.offset != 0 )
+	{
+		if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES ) == 0 )
+		 && ( ( update_flags & LIBSCCA_UPDATE_FLAG_VOLUMES ) != 0 ) )
+		{
+			if( internal_file->io_handle->abort != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+				 "%s: abort requested.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_statistics_start_timer(
+			     &( internal_file->io_handle->statistics ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to start section read timer.",
+				 function );
+
+				return( -1 );
+			}
+			LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_VOLUMES )
+
+			result = libscca_file_get_section_data(
+			          internal_file,
+			          file_io_handle,
+			          internal_file->volumes_view.offset,
+			          internal_file->volumes_view.size,
+			          &section_data,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libscca_io_handle_read_volumes_information_data(
+				          internal_file->io_handle,
+				          section_data,
+				          (size_t) internal_file->volumes_view.size,
+				          internal_file->file_information->number_of_volumes,
+				          internal_file->volumes,
+				          error );
+			}
+			LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_VOLUMES )
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read volumes information.",
+				 function );
+
+				return( -1 );
+			}
+			if( libscca_statistics_add_section_read_time(
+			     &( internal_file->io_handle->statistics ),
+			     LIBSCCA_STATISTICS_SECTION_VOLUMES,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set volumes read time.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Recovers from a section that could not be read
+ * When the file is opened with LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA the section
+ * is flagged as corrupted, the data that was partially read is cleared and the error
+ * of the section is discarded, so that the remaining sections can still be read
+ * An abort, which includes exceeding the parse budget, is never recovered from
+ * except when the deadline was exceeded, in which case the section and every section
+ * after it are flagged, regardless of the access flags, so that the sections that were
+ * read before the deadline are retained
+ * Returns 1 if recovered, 0 if not or -1 on error
+ */
+int libscca_file_recover_section(
+     libscca_internal_file_t *internal_file,
+     uint32_t corruption_flag,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_recover_section";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->budget.deadline_exceeded != 0 )
+	{
+		internal_file->io_handle->corruption_flags |= LIBSCCA_CORRUPTION_FLAG_DEADLINE_EXCEEDED;
+	}
+	else if( ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA ) == 0 )
+	      || ( internal_file->io_handle->abort != 0 ) )
+	{
+		return( 0 );
+	}
+	libcerror_error_free(
+	 error );
+
+	if( corruption_flag == LIBSCCA_CORRUPTION_FLAG_FILE_METRICS )
+	{
+		if( libscca_file_metrics_values_clear(
+		     internal_file->file_metrics_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear file metrics values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->file_metrics_handles            = NULL;
+		internal_file->file_metrics_start_time_order    = NULL;
+		internal_file->file_metrics_filename_hash_table = NULL;
+
+		if( libscca_arena_clear(
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( corruption_flag == LIBSCCA_CORRUPTION_FLAG_TRACE_CHAIN )
+	{
+		if( libscca_trace_chain_clear(
+		     internal_file->trace_chain,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear trace chain.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( corruption_flag == LIBSCCA_CORRUPTION_FLAG_FILENAMES )
+	{
+		if( libscca_filename_strings_clear(
+		     internal_file->filename_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear filename strings.",
+			 function );
+
+			return( -1 );
+		}
+		/* Filename indexes that were resolved against the corrupted filename strings are reset
+		 */
+		if( libscca_file_resolve_filename_indexes(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve file metrics filename indexes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( corruption_flag == LIBSCCA_CORRUPTION_FLAG_VOLUMES )
+	{
+		if( libscca_volumes_clear(
+		     internal_file->volumes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear volumes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->io_handle->corruption_flags |= corruption_flag;
+
+	return( 1 );
+}
+
+/* Resolves the filename indexes of the file metrics
+ * The file metrics array is stored before the filename strings
+ * hence the filename indexes are resolved once both are read
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_resolve_filename_indexes(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_resolve_filename_indexes";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filename indexes of file metrics retained by an update
+	 * can refer to filename strings that were read again
+	 */
+	if( libscca_file_metrics_values_resolve_filename_indexes(
+	     internal_file->file_metrics_values,
+	     internal_file->filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve file metrics filename indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filename hash table is rebuilt from the resolved filename indexes when next requested
+	 */
+	internal_file->file_metrics_filename_hash_table = NULL;
+
+	return( 1 );
+}
+
+/* Retrieves the file metrics handle of a specific entry
+ * The file metrics handles are allocated from the arena when a file metrics entry
+ * is first requested and reference the file metrics values stored in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_handle(
+     libscca_internal_file_t *internal_file,
+     int entry_index,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_t *file_metrics_handle = NULL;
+	static char *function                                = "libscca_file_get_file_metrics_handle";
+	size_t file_metrics_handles_size                     = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( (uint32_t) entry_index >= internal_file->file_metrics_values->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_metrics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_handles == NULL )
+	{
+		file_metrics_handles_size = sizeof( libscca_internal_file_metrics_t )
+		                          * internal_file->file_metrics_values->number_of_entries;
+
+		if( libscca_arena_allocate(
+		     internal_file->arena,
+		     file_metrics_handles_size,
+		     (uint8_t **) &( internal_file->file_metrics_handles ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file metrics handles.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     internal_file->file_metrics_handles,
+		     0,
+		     file_metrics_handles_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear file metrics handles.",
+			 function );
+
+			internal_file->file_metrics_handles = NULL;
+
+			return( -1 );
+		}
+	}
+	file_metrics_handle = &( internal_file->file_metrics_handles[ entry_index ] );
+
+	if( file_metrics_handle->file_metrics_values == NULL )
+	{
+		file_metrics_handle->file_metrics_values = internal_file->file_metrics_values;
+		file_metrics_handle->entry_index         = (uint32_t) entry_index;
+		file_metrics_handle->filename_strings    = internal_file->filename_strings;
+	}
+	*file_metrics = (libscca_file_metrics_t *) file_metrics_handle;
+
+	return( 1 );
+}
+
+/* Builds the file metrics entry indexes sorted by start time if they were not built before
+ * The entry indexes are allocated from the arena and remain valid until the file metrics change
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_build_file_metrics_start_time_order(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	int *scratch_entry_indexes = NULL;
+	static char *function      = "libscca_file_build_file_metrics_start_time_order";
+	size_t entry_indexes_size  = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->file_metrics_start_time_order != NULL )
+	 || ( internal_file->file_metrics_values->number_of_entries == 0 ) )
+	{
+		return( 1 );
+	}
+	if( internal_file->file_metrics_values->number_of_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file - number of file metrics entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entry_indexes_size = sizeof( int ) * (size_t) internal_file->file_metrics_values->number_of_entries;
+
+	if( entry_indexes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entry indexes size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	scratch_entry_indexes = (int *) memory_allocate(
+	                                 entry_indexes_size );
+
+	if( scratch_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scratch entry indexes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_arena_allocate(
+	     internal_file->arena,
+	     entry_indexes_size,
+	     (uint8_t **) &( internal_file->file_metrics_start_time_order ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create start time order.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_metrics_values_sort_by_start_time(
+	     internal_file->file_metrics_values,
+	     internal_file->file_metrics_start_time_order,
+	     scratch_entry_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort file metrics entries by start time.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 scratch_entry_indexes );
+
+	return( 1 );
+
+on_error:
+	/* The arena memory is released when the arena is cleared
+	 */
+	internal_file->file_metrics_start_time_order = NULL;
+
+	if( scratch_entry_indexes != NULL )
+	{
+		memory_free(
+		 scratch_entry_indexes );
+	}
+	return( -1 );
+}
+
+/* Builds the file metrics filename hash table if it was not built before
+ * The hash table is allocated from the arena and remains valid until the file metrics or filenames change
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_build_file_metrics_filename_hash_table(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table       = NULL;
+	static char *function      = "libscca_file_build_file_metrics_filename_hash_table";
+	uint32_t hash_table_size   = 16;
+	uint32_t number_of_entries = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_filename_hash_table != NULL )
+	{
+		return( 1 );
+	}
+	number_of_entries = internal_file->file_metrics_values->number_of_entries;
+
+	if( number_of_entries > (uint32_t) ( INT_MAX / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file - number of file metrics entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table is kept at most half full to keep the probe sequences short
+	 */
+	while( hash_table_size < ( number_of_entries * 2 ) )
+	{
+		hash_table_size *= 2;
+	}
+	if( libscca_arena_allocate(
+	     internal_file->arena,
+	     sizeof( uint32_t ) * (size_t) hash_table_size,
+	     (uint8_t **) &hash_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_metrics_values_build_filename_hash_table(
+	     internal_file->file_metrics_values,
+	     internal_file->filename_strings->case_folded_hashes,
+	     internal_file->filename_strings->number_of_offsets,
+	     hash_table,
+	     hash_table_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build filename hash table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->file_metrics_filename_hash_table      = hash_table;
+	internal_file->file_metrics_filename_hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Reads the trace chain array if it was not read before
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_read_trace_chain(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	const uint8_t *section_data   = NULL;
+	static char *function         = "libscca_file_read_trace_chain";
+	size64_t section_size         = 0;
+	size_t trace_chain_entry_size = 0;
+	int result                    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->trace_chain->is_read != 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_file->file_information->trace_chain_array_offset == 0 )
+	 || ( internal_file->file_information->number_of_trace_chain_array_entries == 0 ) )
+	{
+		internal_file->trace_chain->is_read = 1;
+
+		return( 1 );
+	}
+	if( libscca_statistics_start_timer(
+	     &( internal_file->io_handle->statistics ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start section read timer.",
+		 function );
+
+		return( -1 );
+	}
+	trace_chain_entry_size = internal_file->io_handle->format_layout->trace_chain_entry_data_size;
+
+	/* The trace chain array offset was validated by libscca_file_read_sections
+	 */
+	LIBSCCA_TRACING_BEGIN( LIBSCCA_TRACING_SPAN_TRACE_CHAIN )
+
+	section_size = (size64_t) internal_file->file_information->number_of_trace_chain_array_entries * (size64_t) trace_chain_entry_size;
+
+	result = libscca_file_get_section_data(
+	          internal_file,
+	          file_io_handle,
+	          internal_file->file_information->trace_chain_array_offset,
+	          section_size,
+	          &section_data,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libscca_trace_chain_read_data(
+		          internal_file->trace_chain,
+		          internal_file->io_handle,
+		          section_data,
+		          (size_t) section_size,
+		          internal_file->file_information->number_of_trace_chain_array_entries,
+		          error );
+	}
+	LIBSCCA_TRACING_END( LIBSCCA_TRACING_SPAN_TRACE_CHAIN )
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trace chain array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_statistics_add_section_read_time(
+	     &( internal_file->io_handle->statistics ),
+	     LIBSCCA_STATISTICS_SECTION_TRACE_CHAIN,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set trace chain read time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_format_version(
+     libscca_file_t *file,
+     uint32_t *format_version,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	*format_version = internal_file->io_handle->format_version;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded executable filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_executable_filename_size(
+     libscca_file_t *file,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_executable_filename_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_header_get_utf8_executable_filename_size(
+	     internal_file->file_header,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 executable filename string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded executable filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_executable_filename(
+     libscca_file_t *file,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_executable_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_header_get_utf8_executable_filename(
+	     internal_file->file_header,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-8 executable filename string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded executable filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_executable_filename_size(
+     libscca_file_t *file,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_executable_filename_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO add function to file header */
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     internal_file->file_header->executable_filename,
+	     internal_file->file_header->executable_filename_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-16 executable filename string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded executable filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_executable_filename(
+     libscca_file_t *file,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_executable_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO add function to file header */
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     (libuna_utf16_character_t *) utf16_string,
+	     utf16_string_size,
+	     internal_file->file_header->executable_filename,
+	     internal_file->file_header->executable_filename_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set UTF-16 executable filename string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the prefetch hash
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_prefetch_hash(
+     libscca_file_t *file,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_prefetch_hash";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	*prefetch_hash = internal_file->file_header->prefetch_hash;
+
+	return( 1 );
+}
+
+/* Retrieves a specific last run time
+ * The timestamp is a 64-bit FILETIME date and time value
+ * Files of format version 23 and earlier contain a single last run time
+ * Files of format version 26 and later contain up to 8 last run times
+ * A value if 0 means the last run time is not set
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_last_run_time(
+     libscca_file_t *file,
+     int last_run_time_index,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_last_run_time";
+	int number_of_last_run_times           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = 8;
+	}
+	if( ( last_run_time_index < 0 )
+	 || ( last_run_time_index >= number_of_last_run_times ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last run time index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	*filetime = internal_file->file_information->last_run_time[ last_run_time_index ];
+
+	return( 1 );
+}
+
+/* Retrieves all last run times that are set
+ * Only the last run times with a value other than 0 are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_last_run_times(
+     libscca_file_t *file,
+     uint64_t *filetimes,
+     int maximum_number_of_filetimes,
+     int *number_of_filetimes,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_last_run_times";
+	int last_run_time_index                = 0;
+	int number_of_last_run_times           = 0;
+	int safe_number_of_filetimes           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_filetimes < LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid maximum number of filetimes value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES;
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		if( internal_file->file_information->last_run_time[ last_run_time_index ] != 0 )
+		{
+			filetimes[ safe_number_of_filetimes++ ] = internal_file->file_information->last_run_time[ last_run_time_index ];
+		}
+	}
+	*number_of_filetimes = safe_number_of_filetimes;
+
+	return( 1 );
+}
+
+/* Retrieves the run count
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_run_count(
+     libscca_file_t *file,
+     uint32_t *run_count,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_run_count";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run count.",
+		 function );
+
+		return( -1 );
+	}
+	*run_count = internal_file->file_information->run_count;
+
+	return( 1 );
+}
+
+/* Retrieves the number of file metrics entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_number_of_file_metrics_entries";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_metrics_values->number_of_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of file metrics entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) internal_file->file_metrics_values->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the total number of file metrics entries stored in the file
+ * This value can be larger than the number of file metrics entries if
+ * the file metrics were capped by libscca_file_set_maximum_number_of_file_metrics_entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_total_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_total_number_of_file_metrics_entries";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information->number_of_file_metrics_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of file metrics entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) internal_file->file_information->number_of_file_metrics_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific file metrics entry
+ * The file metrics entry is a handle to the entry stored in the file, which
+ * is created on first request and remains valid until the file is closed
+ * libscca_file_metrics_free only clears the reference
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_entry(
+     libscca_file_t *file,
+     int entry_index,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_file_metrics_entry";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libscca_file_get_file_metrics_handle(
+	     internal_file,
+	     entry_index,
+	     file_metrics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file metrics entry: %d.",
+		 function,
+		 entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the values of all file metrics entries as columns
+ * Every column array that is not NULL must contain at least number_of_entries values
+ * The file reference is 0 if not set and the filename index is -1 if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_table(
+     libscca_file_t *file,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int *filename_indexes,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	libscca_internal_file_t *internal_file             = NULL;
+	static char *function                              = "libscca_file_get_file_metrics_table";
+	size_t number_of_file_metrics_entries              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	file_metrics_values            = internal_file->file_metrics_values;
+	number_of_file_metrics_entries = (size_t) file_metrics_values->number_of_entries;
+
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries < number_of_file_metrics_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of entries value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_metrics_entries == 0 )
+	{
+		return( 1 );
+	}
+	/* The values are stored as columns hence every column is copied at once
+	 */
+	if( start_times != NULL )
+	{
+		if( memory_copy(
+		     start_times,
+		     file_metrics_values->start_times,
+		     sizeof( uint32_t ) * number_of_file_metrics_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy start times.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( durations != NULL )
+	{
+		if( memory_copy(
+		     durations,
+		     file_metrics_values->durations,
+		     sizeof( uint32_t ) * number_of_file_metrics_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy durations.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( flags != NULL )
+	{
+		if( memory_copy(
+		     flags,
+		     file_metrics_values->flags,
+		     sizeof( uint32_t ) * number_of_file_metrics_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy flags.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( file_references != NULL )
+	{
+		if( memory_copy(
+		     file_references,
+		     file_metrics_values->file_references,
+		     sizeof( uint64_t ) * number_of_file_metrics_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file references.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( filename_indexes != NULL )
+	{
+		if( memory_copy(
+		     filename_indexes,
+		     file_metrics_values->filename_indexes,
+		     sizeof( int ) * number_of_file_metrics_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename indexes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the values of all file metrics entries as columns without copying them
+ * The columns reference the values stored in the file, no memory is allocated
+ * and they remain valid until the file is closed or updated
+ * The file references column is NULL if the format version does not store file references
+ * and the filename index is -1 if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_columns(
+     libscca_file_t *file,
+     const uint32_t **start_times,
+     const uint32_t **durations,
+     const uint32_t **flags,
+     const uint64_t **file_references,
+     const int **filename_indexes,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	libscca_internal_file_t *internal_file             = NULL;
+	static char *function                              = "libscca_file_get_file_metrics_columns";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	file_metrics_values = internal_file->file_metrics_values;
+
+	if( file_metrics_values->number_of_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file - number of file metrics entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_times != NULL )
+	{
+		*start_times = file_metrics_values->start_times;
+	}
+	if( durations != NULL )
+	{
+		*durations = file_metrics_values->durations;
+	}
+	if( flags != NULL )
+	{
+		*flags = file_metrics_values->flags;
+	}
+	if( file_references != NULL )
+	{
+		if( file_metrics_values->has_file_references != 0 )
+		{
+			*file_references = file_metrics_values->file_references;
+		}
+		else
+		{
+			*file_references = NULL;
+		}
+	}
+	if( filename_indexes != NULL )
+	{
+		*filename_indexes = file_metrics_values->filename_indexes;
+	}
+	*number_of_entries = (int) file_metrics_values->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the file metrics entry indexes sorted by start time
+ * Entries with the same start time are ordered by entry index
+ * The entry indexes are sorted once when first requested and reference memory held by the file,
+ * no memory is allocated by the caller and they remain valid until the file is closed or updated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_start_time_order(
+     libscca_file_t *file,
+     const int **entry_indexes,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_file_metrics_start_time_order";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libscca_file_build_file_metrics_start_time_order(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build file metrics start time order.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*entry_indexes     = internal_file->file_metrics_start_time_order;
+		*number_of_entries = (int) internal_file->file_metrics_values->number_of_entries;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific file metrics entry in start time order
+ * The sort index is the position of the entry when sorted by start time
+ * Calling this function with sort index 0 to the number of entries - 1 iterates
+ * over the entries from the earliest to the latest start time
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_entry_by_start_time(
+     libscca_file_t *file,
+     int sort_index,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_file_metrics_entry_by_start_time";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libscca_file_build_file_metrics_start_time_order(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build file metrics start time order.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( sort_index < 0 )
+	      || ( (uint32_t) sort_index >= internal_file->file_metrics_values->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sort index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else if( libscca_file_get_file_metrics_handle(
+	          internal_file,
+	          internal_file->file_metrics_start_time_order[ sort_index ],
+	          file_metrics,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file metrics entry: %d.",
+		 function,
+		 internal_file->file_metrics_start_time_order[ sort_index ] );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index of the first file metrics entry with a specific filename
+ * The filename is an UTF-8 encoded string that is compared case-insensitive using its case folded hash
+ * Returns 1 if successful, 0 if no file metrics entry has the filename or -1 on error
+ */
+int libscca_file_get_file_metrics_entry_index_by_utf8_filename(
+     libscca_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_file_get_file_metrics_entry_index_by_utf8_filename";
+	uint64_t case_folded_hash = 0;
+	int result                = 0;
+
+	if( libscca_compute_case_folded_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &case_folded_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compute case folded hash.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_get_next_file_metrics_entry_index_by_filename_hash(
+	          file,
+	          0,
+	          case_folded_hash,
+	          entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file metrics entry index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the index of the first file metrics entry at or after a specific entry index
+ * of which the filename has a specific case folded hash
+ * The case folded hash can be calculated using libscca_compute_case_folded_hash
+ * Calling this function with the previous entry index plus 1 iterates over all entries with the filename
+ * The filename hash table is built once when first requested
+ * Returns 1 if successful, 0 if no file metrics entry has the filename or -1 on error
+ */
+int libscca_file_get_next_file_metrics_entry_index_by_filename_hash(
+     libscca_file_t *file,
+     int first_entry_index,
+     uint64_t case_folded_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_next_file_metrics_entry_index_by_filename_hash";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - filenames were skipped.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libscca_file_build_file_metrics_filename_hash_table(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build file metrics filename hash table.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+		          internal_file->file_metrics_values,
+		          internal_file->filename_strings->case_folded_hashes,
+		          internal_file->filename_strings->number_of_offsets,
+		          internal_file->file_metrics_filename_hash_table,
+		          internal_file->file_metrics_filename_hash_table_size,
+		          (uint32_t) first_entry_index,
+		          case_folded_hash,
+		          entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry index.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of trace chain entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_number_of_trace_chain_entries(
+     libscca_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_number_of_trace_chain_entries";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_file_read_trace_chain(
+	          internal_file,
+	          internal_file->file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trace chain.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libscca_trace_chain_get_number_of_entries(
+		          internal_file->trace_chain,
+		          number_of_entries,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of trace chain entries.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Copies the total block load counts of all trace chain entries
+ * The number of load counts must be equal to or greater than the number of trace chain entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_copy_trace_chain_load_counts(
+     libscca_file_t *file,
+     uint32_t *load_counts,
+     int number_of_load_counts,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_copy_trace_chain_load_counts";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_file_read_trace_chain(
+	          internal_file,
+	          internal_file->file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trace chain.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libscca_trace_chain_copy_load_counts(
+		          internal_file->trace_chain,
+		          load_counts,
+		          number_of_load_counts,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy trace chain load counts.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Copies the next entry indexes of all trace chain entries
+ * The number of next entry indexes must be equal to or greater than the number of trace chain entries
+ * Format version 30 does not store next entry indexes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libscca_file_copy_trace_chain_next_entry_indexes(
+     libscca_file_t *file,
+     uint32_t *next_entry_indexes,
+     int number_of_next_entry_indexes,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_copy_trace_chain_next_entry_indexes";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_file_read_trace_chain(
+	          internal_file,
+	          internal_file->file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read trace chain.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libscca_trace_chain_copy_next_entry_indexes(
+		          internal_file->trace_chain,
+		          next_entry_indexes,
+		          number_of_next_entry_indexes,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy trace chain next entry indexes.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the block load summaries of all file metrics entries
+ * The block load count of a file metrics entry is the sum of the load counts of
+ * the trace chain entries it references and the loaded size is the block load count
+ * multiplied by the trace chain block size
+ * Every summary array that is not NULL must contain at least number_of_entries values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_file_metrics_block_load_summaries(
+     libscca_file_t *file,
+     uint64_t *block_load_counts,
+     uint64_t *loaded_sizes,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	libscca_internal_file_t *internal_file             = NULL;
+	uint64_t *load_counts                              = NULL;
+	static char *function                              = "libscca_file_get_file_metrics_block_load_summaries";
+	uint32_t entry_index                               = 0;
+	int result                                         = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	file_metrics_values = internal_file->file_metrics_values;
+
+	if( ( number_of_entries < 0 )
+	 || ( (size_t) number_of_entries < (size_t) file_metrics_values->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of entries value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The loaded sizes are derived from the block load counts hence
+	 * they are used to store the block load counts if not requested
+	 */
+	if( block_load_counts != NULL )
+	{
+		load_counts = block_load_counts;
+	}
+	else
+	{
+		load_counts = loaded_sizes;
+	}
+	if( ( load_counts == NULL )
+	 || ( file_metrics_values->number_of_entries == 0 ) )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_file_read_trace_chain(
+	          internal_file,
+	          internal_file->file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 "%s: unable to read trace chain.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The start time and duration of a file metrics entry are the index of
+		 * its first trace chain entry and its number of trace chain entries
+		 */
+		result = libscca_trace_chain_get_range_load_counts(
+		          internal_file->trace_chain,
+		          file_metrics_values->start_times,
+		          file_metrics_values->durations,
+		          file_metrics_values->number_of_entries,
+		          load_counts,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve trace chain range load counts.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( result == 1 )
+	 && ( loaded_sizes != NULL ) )
+	{
+		for( entry_index = 0;
+		     entry_index < file_metrics_values->number_of_entries;
+		     entry_index++ )
+		{
+			loaded_sizes[ entry_index ] = load_counts[ entry_index ] * LIBSCCA_TRACE_CHAIN_BLOCK_SIZE;
+		}
+	}
+	return( result );
+}
+
+/* Visits the file metrics entries in the file metrics array section
+ * The entries are decoded one at a time, directly from the section data, into a file
+ * metrics that is reused for every entry, hence the file metrics is only valid during
+ * the callback and the visit also works if the file was opened with LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS
+ * The visit stops at the first entry for which the callback function returns 0 and
+ * the remaining entries are not decoded
+ * The callback function is called while the file is locked and should not call other
+ * file functions
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all entries were visited, 0 if the visit was stopped or -1 on error
+ */
+int libscca_file_visit_file_metrics(
+     libscca_file_t *file,
+     int (*callback_function)(
+            int entry_index,
+            libscca_file_metrics_t *file_metrics,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_t *file_metrics   = NULL;
+	libscca_internal_file_t *internal_file = NULL;
+	const uint8_t *section_data            = NULL;
+	static char *function                  = "libscca_file_visit_file_metrics";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->file_metrics_view.offset == 0 )
+	 || ( internal_file->number_of_file_metrics_entries == 0 ) )
+	{
+		return( 1 );
+	}
+	if( libscca_file_metrics_initialize(
+	     &file_metrics,
+	     internal_file->filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file metrics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libscca_file_get_section_data(
+	          internal_file,
+	          internal_file->file_io_handle,
+	          internal_file->file_metrics_view.offset,
+	          internal_file->file_metrics_view.size,
+	          &section_data,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libscca_io_handle_visit_file_metrics_array_data(
+		          internal_file->io_handle,
+		          section_data,
+		          (size_t) internal_file->file_metrics_view.size,
+		          internal_file->number_of_file_metrics_entries,
+		          file_metrics,
+		          callback_function,
+		          callback_arguments,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit file metrics array.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libscca_file_metrics_free(
+	     &file_metrics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file metrics.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_number_of_filenames(
+     libscca_file_t *file,
+     int *number_of_filenames,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_number_of_filenames";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_number_of_filenames(
+	     internal_file->filename_strings,
+	     number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_filename_size(
+     libscca_file_t *file,
+     int filename_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_filename_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_utf8_filename_size(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d UTF-8 string size.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_filename(
+     libscca_file_t *file,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_utf8_filename(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-8 string.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_filename_size(
+     libscca_file_t *file,
+     int filename_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_filename_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_utf16_filename_size(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d UTF-16 string size.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_filename(
+     libscca_file_t *file,
+     int filename_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_utf16_filename(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-16 string.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian stream of a specific filename
+ * The stream references the filename as stored in the file, including the end-of-string character,
+ * no memory is allocated and it remains valid until the file is closed or updated
+ * This is not supported if the filenames are stored front-coded
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf16_filename_stream(
+     libscca_file_t *file,
+     int filename_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf16_filename_stream";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_string_data(
+	     internal_file->filename_strings,
+	     filename_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d data.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the case folded hash of a specific filename
+ * The hash is the XXH64 of the upper case UTF-16 little-endian filename,
+ * which is calculated once when the filenames are read
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_filename_case_folded_hash(
+     libscca_file_t *file,
+     int filename_index,
+     uint64_t *case_folded_hash,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_filename_case_folded_hash";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_case_folded_hash(
+	     internal_file->filename_strings,
+	     filename_index,
+	     case_folded_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve case folded hash of filename: %d.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the case folded hashes of all filenames
+ * The number of case folded hashes must be equal to or greater than the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_copy_filename_case_folded_hashes(
+     libscca_file_t *file,
+     uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_copy_filename_case_folded_hashes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_copy_case_folded_hashes(
+	     internal_file->filename_strings,
+	     case_folded_hashes,
+	     number_of_case_folded_hashes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy case folded hashes of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the file possibly contains a specific filename
+ * The filename is compared case-insensitive using its case folded hash, which
+ * is checked against the filename Bloom filter when the file was opened with
+ * LIBSCCA_ACCESS_FLAG_FILENAME_BLOOM_FILTER and against the case folded hashes otherwise
+ * A return value of 0 means the filename is definitely not contained, a return value of 1
+ * requires the filenames to be compared to rule out a false positive
+ * Returns 1 if the filename is possibly contained, 0 if not or -1 on error
+ */
+int libscca_file_may_contain_filename(
+     libscca_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_file_may_contain_filename";
+	uint64_t case_folded_hash = 0;
+	int result                = 0;
+
+	if( libscca_compute_case_folded_hash(
+	     utf8_string,
+	     utf8_string_length,
+	     &case_folded_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to compute case folded hash.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_may_contain_filename_hash(
+	          file,
+	          case_folded_hash,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file contains filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines if the file possibly contains a filename with a specific case folded hash
+ * The case folded hash can be calculated using libscca_compute_case_folded_hash
+ * Returns 1 if a filename is possibly contained, 0 if not or -1 on error
+ */
+int libscca_file_may_contain_filename_hash(
+     libscca_file_t *file,
+     uint64_t case_folded_hash,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_may_contain_filename_hash";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	/* Without the filenames a filename cannot be ruled out
+	 */
+	if( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - filenames were skipped.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_filename_strings_may_contain_hash(
+	          internal_file->filename_strings,
+	          case_folded_hash,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if filename strings contain hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the mount points that are used to map the device paths of the filenames
+ * The device path at a specific index is mapped to the mount point path at the same index,
+ * for example "\VOLUME{01d08f4a24cc8b06-3a2b12a8}" to "C:"
+ * Setting 0 mount points removes the previously set mount points
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_set_mount_points(
+     libscca_file_t *file,
+     const char * const device_paths[],
+     const char * const mount_point_paths[],
+     int number_of_mount_points,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	libscca_mount_points_t *mount_points   = NULL;
+	static char *function                  = "libscca_file_set_mount_points";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( number_of_mount_points < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of mount points value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_mount_points > 0 )
+	{
+		if( libscca_mount_points_initialize(
+		     &mount_points,
+		     device_paths,
+		     mount_point_paths,
+		     number_of_mount_points,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mount points.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libscca_mount_points_free(
+		 &mount_points,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->mount_points != NULL )
+	{
+		if( libscca_mount_points_free(
+		     &( internal_file->mount_points ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mount points.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->mount_points = mount_points;
+
+	/* The mount point indexes are determined again on the next access
+	 */
+	if( libscca_filename_strings_clear_mount_point_indexes(
+	     internal_file->filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear mount point indexes.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded filename, where the device path
+ * is replaced by the path of its mount point
+ * The mount point of every filename is determined once on first access
+ * The filename is returned unchanged if it has no mount point
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_mapped_filename_size(
+     libscca_file_t *file,
+     int filename_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_mapped_filename_size";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->mount_points != NULL )
+	 && ( internal_file->filename_strings->mount_point_indexes == NULL ) )
+	{
+		if( libscca_filename_strings_read_mount_point_indexes(
+		     internal_file->filename_strings,
+		     internal_file->mount_points,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine mount point indexes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libscca_filename_strings_get_utf8_mapped_filename_size(
+		     internal_file->filename_strings,
+		     internal_file->mount_points,
+		     filename_index,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped filename: %d UTF-8 string size.",
+			 function,
+			 filename_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific UTF-8 encoded filename, where the device path
+ * is replaced by the path of its mount point
+ * The mount point of every filename is determined once on first access
+ * The filename is returned unchanged if it has no mount point
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_mapped_filename(
+     libscca_file_t *file,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_mapped_filename";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->mount_points != NULL )
+	 && ( internal_file->filename_strings->mount_point_indexes == NULL ) )
+	{
+		if( libscca_filename_strings_read_mount_point_indexes(
+		     internal_file->filename_strings,
+		     internal_file->mount_points,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine mount point indexes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libscca_filename_strings_get_utf8_mapped_filename(
+		     internal_file->filename_strings,
+		     internal_file->mount_points,
+		     filename_index,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy mapped filename: %d to UTF-8 string.",
+			 function,
+			 filename_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the index of the first filename that matches an UTF-8 encoded pattern
+ * The pattern is converted to UTF-16 once and compared with the UTF-16 little-endian
+ * filename strings as stored in the file, the filenames are not converted
+ * Returns 1 if successful, 0 if no filename matches or -1 on error
+ */
+int libscca_file_get_filename_index_by_utf8_pattern(
+     libscca_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	uint16_t *utf16_pattern                = NULL;
+	static char *function                  = "libscca_file_get_filename_index_by_utf8_pattern";
+	size_t utf16_pattern_size              = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == 0 )
+	{
+		utf16_pattern_size = 1;
+	}
+	else if( libuna_utf16_string_size_from_utf8(
+	          (libuna_utf8_character_t *) utf8_string,
+	          utf8_string_length,
+	          &utf16_pattern_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-16 pattern size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf16_pattern_size == 0 )
+	 || ( utf16_pattern_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 pattern size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf16_pattern = (uint16_t *) memory_allocate(
+	                              sizeof( uint16_t ) * utf16_pattern_size );
+
+	if( utf16_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_length == 0 )
+	{
+		utf16_pattern[ 0 ] = 0;
+	}
+	else if( libuna_utf16_string_copy_from_utf8(
+	          (libuna_utf16_character_t *) utf16_pattern,
+	          utf16_pattern_size,
+	          (libuna_utf8_character_t *) utf8_string,
+	          utf8_string_length,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to UTF-16 pattern.",
+		 function );
+
+		goto on_error;
+	}
+	/* The filenames are matched one by one hence every filename accounts for a step
+	 */
+	if( libscca_budget_add_steps(
+	     &( internal_file->io_handle->budget ),
+	     (uint64_t) internal_file->filename_strings->number_of_offsets,
+	     &( internal_file->io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add filename matches to budget.",
+		 function );
+
+		goto on_error;
+	}
+	/* The UTF-16 pattern size includes the end of string character
+	 */
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          internal_file->filename_strings,
+	          utf16_pattern,
+	          utf16_pattern_size - 1,
+	          match_type,
+	          match_flags,
+	          filename_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename index by UTF-16 pattern.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_pattern );
+
+	return( result );
+
+on_error:
+	if( utf16_pattern != NULL )
+	{
+		memory_free(
+		 utf16_pattern );
+	}
+	return( -1 );
+}
+
+/* Retrieves the index of the first filename that matches an UTF-16 encoded pattern
+ * The pattern is compared with the UTF-16 little-endian filename strings
+ * as stored in the file, the filenames are not converted
+ * Returns 1 if successful, 0 if no filename matches or -1 on error
+ */
+int libscca_file_get_filename_index_by_utf16_pattern(
+     libscca_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_filename_index_by_utf16_pattern";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	/* The filenames are matched one by one hence every filename accounts for a step
+	 */
+	if( libscca_budget_add_steps(
+	     &( internal_file->io_handle->budget ),
+	     (uint64_t) internal_file->filename_strings->number_of_offsets,
+	     &( internal_file->io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add filename matches to budget.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          internal_file->filename_strings,
+	          utf16_string,
+	          utf16_string_length,
+	          match_type,
+	          match_flags,
+	          filename_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename index by UTF-16 pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the index of the first filename, starting at a specific index, that matches an UTF-16 encoded pattern
+ * The pattern is compared with the UTF-16 little-endian filename strings
+ * as stored in the file, the filenames are not converted
+ * Returns 1 if successful, 0 if no filename matches or -1 on error
+ */
+int libscca_file_get_next_filename_index_by_utf16_pattern(
+     libscca_file_t *file,
+     int first_filename_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_next_filename_index_by_utf16_pattern";
+	uint64_t number_of_steps               = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( first_filename_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first filename index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the filenames from the first filename index onwards are matched
+	 */
+	if( first_filename_index < internal_file->filename_strings->number_of_offsets )
+	{
+		number_of_steps = (uint64_t) ( internal_file->filename_strings->number_of_offsets - first_filename_index );
+	}
+	if( libscca_budget_add_steps(
+	     &( internal_file->io_handle->budget ),
+	     number_of_steps,
+	     &( internal_file->io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add filename matches to budget.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_filename_strings_get_next_index_by_utf16_pattern(
+	          internal_file->filename_strings,
+	          first_filename_index,
+	          utf16_string,
+	          utf16_string_length,
+	          match_type,
+	          match_flags,
+	          filename_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next filename index by UTF-16 pattern.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Verifies the prefetch hash
+ * The prefetch hash is computed of every filename, using the hash type of
+ * the format version, until one matches the prefetch hash in the file header
+ * The filename that matches is the path of the executable
+ * The prefetch hash of hosting executables, such as dllhost.exe, is computed
+ * over the command line as well, hence these cannot be verified
+ * Returns 1 if successful, 0 if no filename matches or -1 on error
+ */
+int libscca_file_verify_prefetch_hash(
+     libscca_file_t *file,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	const uint8_t *string_data             = NULL;
+	uint8_t *decoded_string_data           = NULL;
+	static char *function                  = "libscca_file_verify_prefetch_hash";
+	size_t string_data_size                = 0;
+	uint32_t prefetch_hash                 = 0;
+	int hash_type                          = 0;
+	int number_of_filenames                = 0;
+	int result                             = 0;
+	int safe_filename_index                = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_prefetch_hash_get_type_by_format_version(
+	          internal_file->file_header->format_version,
+	          &hash_type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hash type.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 internal_file->file_header->format_version );
+
+		return( -1 );
+	}
+	if( libscca_filename_strings_get_number_of_filenames(
+	     internal_file->filename_strings,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	/* The filenames are hashed one by one hence every filename accounts for a step
+	 */
+	if( libscca_budget_add_steps(
+	     &( internal_file->io_handle->budget ),
+	     (uint64_t) number_of_filenames,
+	     &( internal_file->io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add filename hashes to budget.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_filename_index = 0;
+	     safe_filename_index < number_of_filenames;
+	     safe_filename_index++ )
+	{
+		if( libscca_filename_strings_get_decoded_string_data(
+		     internal_file->filename_strings,
+		     safe_filename_index,
+		     &string_data,
+		     &string_data_size,
+		     &decoded_string_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 safe_filename_index );
+
+			return( -1 );
+		}
+		/* The filenames are stored in upper case and are hashed without conversion
+		 * but without the end of string characters
+		 */
+		while( ( string_data_size >= 2 )
+		    && ( string_data[ string_data_size - 2 ] == 0 )
+		    && ( string_data[ string_data_size - 1 ] == 0 ) )
+		{
+			string_data_size -= 2;
+		}
+		result = libscca_prefetch_hash_calculate_utf16_stream(
+		          string_data,
+		          string_data_size,
+		          hash_type,
+		          &prefetch_hash,
+		          error );
+
+		if( decoded_string_data != NULL )
+		{
+			memory_free(
+			 decoded_string_data );
+
+			decoded_string_data = NULL;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate prefetch hash of filename: %d.",
+			 function,
+			 safe_filename_index );
+
+			return( -1 );
+		}
+		if( prefetch_hash == internal_file->file_header->prefetch_hash )
+		{
+			*filename_index = safe_filename_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the size of all UTF-8 encoded filenames packed into a single buffer
+ * The returned size includes the end of string character of every filename
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_filenames_table_size(
+     libscca_file_t *file,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_filenames_table_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_get_utf8_filenames_size(
+	     internal_file->filename_strings,
+	     utf8_strings_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 filenames size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves all UTF-8 encoded filenames packed into a single buffer
+ * Every filename is stored including its end of string character and
+ * the offset of each filename in the buffer is stored in the offsets
+ * The number of offsets must be equal to or greater than the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_utf8_filenames_table(
+     libscca_file_t *file,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_utf8_filenames_table";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_filename_strings_copy_utf8_filenames(
+	     internal_file->filename_strings,
+	     utf8_strings,
+	     utf8_strings_size,
+	     utf8_string_offsets,
+	     number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 filenames.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Visits the filenames in the filename strings section
+ * The filenames are scanned directly from the section data, without storing them,
+ * hence the UTF-16 little-endian stream, which includes the end of string character,
+ * is only valid during the callback and the visit also works if the file was opened
+ * with LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES
+ * The visit stops at the first filename for which the callback function returns 0 and
+ * the remaining filenames are not scanned
+ * The callback function is called while the file is locked and should not call other
+ * file functions
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all filenames were visited, 0 if the visit was stopped or -1 on error
+ */
+int libscca_file_visit_filenames(
+     libscca_file_t *file,
+     int (*callback_function)(
+            int filename_index,
+            const uint8_t *utf16_stream,
+            size_t utf16_stream_size,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	const uint8_t *section_data            = NULL;
+	static char *function                  = "libscca_file_visit_filenames";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->filename_strings_view.offset == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_file_get_section_data(
+	          internal_file,
+	          internal_file->file_io_handle,
+	          internal_file->filename_strings_view.offset,
+	          internal_file->filename_strings_view.size,
+	          &section_data,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libscca_filename_strings_visit_data(
+		          section_data,
+		          (size_t) internal_file->filename_strings_view.size,
+		          callback_function,
+		          callback_arguments,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit filename strings.",
+		 function );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_number_of_volumes(
+     libscca_file_t *file,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_number_of_volumes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_volumes_get_number_of_volumes(
+	     internal_file->volumes,
+	     number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->io_handle->format_version = internal_file->file_header->format_version;
+	return( 1 );
+}
 
-	if( internal_file->io_handle->uncompressed_data_size != internal_file->file_header->file_size )
+/* Retrieves a specific volume information
+ * The volume information is a reference to the volume information stored in the file,
+ * no memory is allocated and it remains valid until the file is closed
+ * libscca_volume_information_free only clears the reference
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_volume_information(
+     libscca_file_t *file,
+     int volume_index,
+     libscca_volume_information_t **volume_information,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_file_get_volume_information";
+
+	if( file == NULL )
 	{
-/* TODO flag mismatch and file as corrupted? */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfdata_stream_get_size(
-	     internal_file->uncompressed_data_stream,
-	     &file_size,
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( libscca_volumes_get_volume_information_by_index(
+	     internal_file->volumes,
+	     volume_index,
+	     (libscca_internal_volume_information_t **) volume_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve uncompressed data stream size.",
+		 "%s: unable to retrieve volume: %d information.",
+		 function,
+		 volume_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the volume dictionary identifiers of the volumes
+ * The identifier of the volume with index N is stored in volume_identifiers[ N ],
+ * the array must contain at least number_of_volume_identifiers values, which must
+ * not be smaller than the number of volumes. Requires the file to be opened with
+ * a volume dictionary, see libscca_file_set_volume_dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_volume_identifiers(
+     libscca_file_t *file,
+     int *volume_identifiers,
+     int number_of_volume_identifiers,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file                    = NULL;
+	libscca_internal_volume_information_t *volume_information = NULL;
+	static char *function                                     = "libscca_file_get_volume_identifiers";
+	int number_of_volumes                                     = 0;
+	int volume_index                                          = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
-		libcnotify_printf(
-		 "Reading file information:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libscca_file_information_initialize(
-	     &( internal_file->file_information ),
-	     error ) != 1 )
+	if( internal_file->io_handle->volume_dictionary == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file information.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing volume dictionary.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libscca_file_information_read_stream(
-	     internal_file->file_information,
-	     internal_file->uncompressed_data_stream,
-	     file_io_handle,
-	     internal_file->io_handle,
-	     error ) != 1 )
+	if( volume_identifiers == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file information from stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume identifiers.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_stream_get_offset(
-	     internal_file->uncompressed_data_stream,
-	     &file_offset,
+	if( libscca_volumes_get_number_of_volumes(
+	     internal_file->volumes,
+	     &number_of_volumes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve uncompressed data stream current offset.",
+		 "%s: unable to retrieve number of volumes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_file->file_information->metrics_array_offset != 0 )
+	if( number_of_volume_identifiers < number_of_volumes )
 	{
-		next_offset = internal_file->file_information->trace_chain_array_offset;
-
-		if( next_offset == 0 )
-		{
-			next_offset = internal_file->file_information->filename_strings_offset;
-		}
-		if( next_offset == 0 )
-		{
-			next_offset = internal_file->file_information->volumes_information_offset;
-		}
-		if( next_offset == 0 )
-		{
-			next_offset = file_size;
-		}
-		/* Allow for a margin of 8 + 4 bytes for version 30 variant 2
-		 */
-		if( ( internal_file->file_information->metrics_array_offset < ( file_offset - 12 ) )
-		 || ( internal_file->file_information->metrics_array_offset >= next_offset ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid metrics array offset value out of bounds: %jd > %jd > %jd.",
-			 function, file_offset, internal_file->file_information->metrics_array_offset, next_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of volume identifiers value too small.",
+		 function );
 
-			goto on_error;
-		}
-		if( libscca_io_handle_read_file_metrics_array(
-		     internal_file->io_handle,
-		     internal_file->uncompressed_data_stream,
-		     file_io_handle,
-		     internal_file->file_information->metrics_array_offset,
-		     internal_file->file_information->number_of_file_metrics_entries,
-		     internal_file->filename_strings,
-		     internal_file->file_metrics_array,
+		return( -1 );
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_volumes_get_volume_information_by_index(
+		     internal_file->volumes,
+		     volume_index,
+		     &volume_information,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file metrics array.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdata_stream_get_offset(
-		     internal_file->uncompressed_data_stream,
-		     &file_offset,
-		     error ) != 1 )
+		if( volume_information == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve uncompressed data stream current offset.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
+		volume_identifiers[ volume_index ] = (int) volume_information->volume_identifier;
+	}
+	return( 1 );
+}
+
+/* Retrieves the fingerprint of the file
+ * The fingerprint is a 128-bit digest of the executable filename, the prefetch hash,
+ * the format version, the filenames and the volume serial numbers. The run count
+ * and last run times are not part of the fingerprint, hence files that differ only
+ * in these values have the same fingerprint.
+ *
+ * The filenames are compared case insensitive and, like the volume serial numbers,
+ * independent of their order. Filenames and volumes that were not read, due to
+ * the access flags, are not part of the fingerprint.
+ *
+ * The fingerprint must be at least LIBSCCA_FINGERPRINT_SIZE bytes in size
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_get_fingerprint(
+     libscca_file_t *file,
+     uint8_t *fingerprint,
+     size_t fingerprint_size,
+     libcerror_error_t **error )
+{
+	uint8_t fingerprint_data[ 112 ];
+	uint8_t value_data[ 8 ];
+
+	libscca_internal_file_t *internal_file                    = NULL;
+	libscca_internal_volume_information_t *volume_information = NULL;
+	static char *function                                     = "libscca_file_get_fingerprint";
+	size_t fingerprint_data_size                              = 0;
+	uint64_t case_folded_hash                                 = 0;
+	uint64_t filenames_high_sum                               = 0;
+	uint64_t filenames_low_sum                                = 0;
+	uint64_t hash_value                                       = 0;
+	uint64_t high_hash_value                                  = 0;
+	uint64_t low_hash_value                                   = 0;
+	uint64_t volumes_high_sum                                 = 0;
+	uint64_t volumes_low_sum                                  = 0;
+	int filename_index                                        = 0;
+	int number_of_filenames                                   = 0;
+	int number_of_volumes                                     = 0;
+	int volume_index                                          = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->file_information->trace_chain_array_offset != 0 )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
 	{
-		next_offset = internal_file->file_information->filename_strings_offset;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal file - missing file header.",
+		 function );
 
-		if( next_offset == 0 )
-		{
-			next_offset = internal_file->file_information->volumes_information_offset;
-		}
-		if( next_offset == 0 )
-		{
-			next_offset = file_size;
-		}
-		if( ( internal_file->file_information->trace_chain_array_offset < file_offset )
-		 || ( internal_file->file_information->trace_chain_array_offset >= next_offset ) )
+		return( -1 );
+	}
+	if( internal_file->file_header->executable_filename_size > 60 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid internal file - executable filename size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint_size < LIBSCCA_FINGERPRINT_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid fingerprint size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( fingerprint_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid fingerprint size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->filename_strings != NULL )
+	{
+		if( libscca_filename_strings_get_number_of_filenames(
+		     internal_file->filename_strings,
+		     &number_of_filenames,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid trace chain array offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of filenames.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libscca_io_handle_read_trace_chain_array(
-			     internal_file->io_handle,
-			     internal_file->uncompressed_data_stream,
-			     file_io_handle,
-			     internal_file->file_information->trace_chain_array_offset,
-			     internal_file->file_information->number_of_trace_chain_array_entries,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trace chain array.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdata_stream_get_offset(
-			     internal_file->uncompressed_data_stream,
-			     &file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve uncompressed data stream current offset.",
-				 function );
-
-				goto on_error;
-			}
+			return( -1 );
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
-	if( internal_file->file_information->filename_strings_offset != 0 )
+	/* The filenames are combined by the sum of a hash per filename, which does not
+	 * depend on the order of the filenames, hence they do not need to be sorted
+	 */
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
 	{
-		next_offset = internal_file->file_information->volumes_information_offset;
-
-		if( next_offset == 0 )
-		{
-			next_offset = file_size;
-		}
-		if( ( internal_file->file_information->filename_strings_offset < file_offset )
-		 || ( internal_file->file_information->filename_strings_offset >= next_offset ) )
+		if( libscca_filename_strings_get_case_folded_hash(
+		     internal_file->filename_strings,
+		     filename_index,
+		     &case_folded_hash,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid filename strings offset value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve case folded hash of filename: %d.",
+			 function,
+			 filename_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( internal_file->file_information->filename_strings_size > ( next_offset - internal_file->file_information->filename_strings_offset ) )
+		byte_stream_copy_from_uint64_little_endian(
+		 value_data,
+		 case_folded_hash );
+
+		if( libscca_hash_calculate_xxh64(
+		     value_data,
+		     8,
+		     LIBSCCA_FINGERPRINT_SEED_HIGH,
+		     &hash_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid filename strings size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of filename: %d.",
+			 function,
+			 filename_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libscca_filename_strings_read_stream(
-		     internal_file->filename_strings,
-		     internal_file->uncompressed_data_stream,
-		     file_io_handle,
-		     internal_file->file_information->filename_strings_offset,
-		     internal_file->file_information->filename_strings_size,
+		filenames_high_sum += hash_value;
+
+		if( libscca_hash_calculate_xxh64(
+		     value_data,
+		     8,
+		     LIBSCCA_FINGERPRINT_SEED_LOW,
+		     &hash_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read filename strings from stream.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of filename: %d.",
+			 function,
+			 filename_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfdata_stream_get_offset(
-		     internal_file->uncompressed_data_stream,
-		     &file_offset,
+		filenames_low_sum += hash_value;
+	}
+	if( internal_file->volumes != NULL )
+	{
+		if( libscca_volumes_get_number_of_volumes(
+		     internal_file->volumes,
+		     &number_of_volumes,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve uncompressed data stream current offset.",
+			 "%s: unable to retrieve number of volumes.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( internal_file->file_information->volumes_information_offset != 0 )
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
 	{
-		if( ( internal_file->file_information->volumes_information_offset < file_offset )
-		 || ( internal_file->file_information->volumes_information_offset > file_size ) )
+		if( libscca_volumes_get_volume_information_by_index(
+		     internal_file->volumes,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid volumes information offset value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( internal_file->file_information->volumes_information_size > ( file_size - internal_file->file_information->volumes_information_offset ) )
+		if( volume_information == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid volumes information size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing volume: %d information.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libscca_io_handle_read_volumes_information(
-		     internal_file->io_handle,
-		     internal_file->uncompressed_data_stream,
-		     internal_file->file_io_handle,
-		     internal_file->file_information->volumes_information_offset,
-		     internal_file->file_information->volumes_information_size,
-		     internal_file->file_information->number_of_volumes,
-		     internal_file->volumes_array,
+		byte_stream_copy_from_uint32_little_endian(
+		 value_data,
+		 volume_information->serial_number );
+
+		if( libscca_hash_calculate_xxh64(
+		     value_data,
+		     4,
+		     LIBSCCA_FINGERPRINT_SEED_HIGH,
+		     &hash_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read volumes information.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of volume: %d serial number.",
+			 function,
+			 volume_index );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	return( 1 );
+		volumes_high_sum += hash_value;
 
-on_error:
-	if( internal_file->file_information != NULL )
-	{
-		libscca_file_information_free(
-		 &( internal_file->file_information ),
-		 NULL );
+		if( libscca_hash_calculate_xxh64(
+		     value_data,
+		     4,
+		     LIBSCCA_FINGERPRINT_SEED_LOW,
+		     &hash_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash of volume: %d serial number.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		volumes_low_sum += hash_value;
 	}
-	if( internal_file->file_header != NULL )
+	/* The fingerprint data consists of:
+	 * format version, prefetch hash, executable filename size and executable filename
+	 * number of filenames and filenames sums, number of volumes and volumes sums
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( fingerprint_data[ 0 ] ),
+	 internal_file->file_header->format_version );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( fingerprint_data[ 4 ] ),
+	 internal_file->file_header->prefetch_hash );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( fingerprint_data[ 8 ] ),
+	 (uint32_t) internal_file->file_header->executable_filename_size );
+
+	fingerprint_data_size = 12;
+
+	if( internal_file->file_header->executable_filename_size > 0 )
 	{
-		libscca_file_header_free(
-		 &( internal_file->file_header ),
-		 NULL );
+		if( memory_copy(
+		     &( fingerprint_data[ fingerprint_data_size ] ),
+		     internal_file->file_header->executable_filename,
+		     internal_file->file_header->executable_filename_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy executable filename.",
+			 function );
+
+			return( -1 );
+		}
+		fingerprint_data_size += internal_file->file_header->executable_filename_size;
 	}
-	libcdata_array_empty(
-	 internal_file->file_metrics_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_file_metrics_free,
-	 NULL );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( fingerprint_data[ fingerprint_data_size ] ),
+	 (uint32_t) number_of_filenames );
 
-	libscca_filename_strings_clear(
-	 internal_file->filename_strings,
-	 NULL );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fingerprint_data[ fingerprint_data_size + 4 ] ),
+	 filenames_high_sum );
 
-	libcdata_array_empty(
-	 internal_file->volumes_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
-	 NULL );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fingerprint_data[ fingerprint_data_size + 12 ] ),
+	 filenames_low_sum );
 
-	return( -1 );
-}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( fingerprint_data[ fingerprint_data_size + 20 ] ),
+	 (uint32_t) number_of_volumes );
 
-/* Retrieves the format version
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_format_version(
-     libscca_file_t *file,
-     uint32_t *format_version,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_format_version";
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fingerprint_data[ fingerprint_data_size + 24 ] ),
+	 volumes_high_sum );
 
-	if( file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+	byte_stream_copy_from_uint64_little_endian(
+	 &( fingerprint_data[ fingerprint_data_size + 32 ] ),
+	 volumes_low_sum );
 
-		return( -1 );
-	}
-	internal_file = (libscca_internal_file_t *) file;
+	fingerprint_data_size += 40;
 
-	if( internal_file->io_handle == NULL )
+	if( libscca_hash_calculate_xxh64(
+	     fingerprint_data,
+	     fingerprint_data_size,
+	     LIBSCCA_FINGERPRINT_SEED_HIGH,
+	     &high_hash_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate fingerprint high hash.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( libscca_hash_calculate_xxh64(
+	     fingerprint_data,
+	     fingerprint_data_size,
+	     LIBSCCA_FINGERPRINT_SEED_LOW,
+	     &low_hash_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate fingerprint low hash.",
 		 function );
 
 		return( -1 );
 	}
-	*format_version = internal_file->io_handle->format_version;
+	byte_stream_copy_from_uint64_big_endian(
+	 &( fingerprint[ 0 ] ),
+	 high_hash_value );
+
+	byte_stream_copy_from_uint64_big_endian(
+	 &( fingerprint[ 8 ] ),
+	 low_hash_value );
 
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded executable filename
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves a specific parse statistic of the file
+ * The statistics are gathered while the file is opened and are reset when it is closed
+ * The number of allocations covers the buffers, compressed blocks and arena blocks of the library
+ * The read times are in nano seconds and are only available when the file was opened
+ * with LIBSCCA_ACCESS_FLAG_MEASURE_READ_TIMES and a monotonic clock is available
+ * The uncompressed data size is only available while the file is open
+ * Returns 1 if successful, 0 if the statistic is not available or -1 on error
  */
-int libscca_file_get_utf8_executable_filename_size(
+int libscca_file_get_statistic(
      libscca_file_t *file,
-     size_t *utf8_string_size,
+     int statistic_type,
+     uint64_t *value,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_executable_filename_size";
+	static char *function                  = "libscca_file_get_statistic";
+	int result                             = 0;
 
 	if( file == NULL )
 	{
@@ -1644,144 +11582,156 @@ int libscca_file_get_utf8_executable_filename_size(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( internal_file->file_header == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file header.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO add function to file header */
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_file->file_header->executable_filename,
-	     internal_file->file_header->executable_filename_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf8_string_size,
-	     error ) != 1 )
+	/* The uncompressed data size is a value of the IO handle instead of a gathered statistic
+	 */
+	if( statistic_type == LIBSCCA_STATISTIC_TYPE_UNCOMPRESSED_DATA_SIZE )
+	{
+		if( value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid value.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->io_handle->uncompressed_data_size == 0 )
+		{
+			return( 0 );
+		}
+		*value = (uint64_t) internal_file->io_handle->uncompressed_data_size;
+
+		return( 1 );
+	}
+	result = libscca_statistics_get_value(
+	          &( internal_file->io_handle->statistics ),
+	          statistic_type,
+	          value,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of UTF-8 executable filename string.",
-		 function );
+		 "%s: unable to retrieve statistic: %d.",
+		 function,
+		 statistic_type );
 
 		return( -1 );
 	}
-	return( 1 );
+	if( ( result == 1 )
+	 && ( statistic_type == LIBSCCA_STATISTIC_TYPE_NUMBER_OF_ALLOCATIONS )
+	 && ( internal_file->arena != NULL ) )
+	{
+		*value += (uint64_t) internal_file->arena->number_of_allocated_blocks;
+	}
+	return( result );
 }
 
-/* Retrieves a specific UTF-8 encoded executable filename
- * The size should include the end of string character
+/* Retrieves the memory usage of the file
+ * The allocated size covers the data buffers, compressed blocks, arena blocks,
+ * trace chain, filename strings and volumes information of the library and
+ * the maximum allocated size is its high-water mark since the file was opened
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf8_executable_filename(
+int libscca_file_get_memory_usage(
      libscca_file_t *file,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     uint64_t *number_of_allocations,
+     uint64_t *allocated_size,
+     uint64_t *maximum_allocated_size,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_executable_filename";
+	static char *function = "libscca_file_get_memory_usage";
 
-	if( file == NULL )
+	if( number_of_allocations == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid number of allocations.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( internal_file->file_header == NULL )
+	if( allocated_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO add function to file header */
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     (libuna_utf8_character_t *) utf8_string,
-	     utf8_string_size,
-	     internal_file->file_header->executable_filename,
-	     internal_file->file_header->executable_filename_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     error ) != 1 )
+	if( maximum_allocated_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set UTF-8 executable filename string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum allocated size.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the size of a specific UTF-16 encoded executable filename
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_utf16_executable_filename_size(
-     libscca_file_t *file,
-     size_t *utf16_string_size,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_executable_filename_size";
-
-	if( file == NULL )
+	if( libscca_file_get_statistic(
+	     file,
+	     LIBSCCA_STATISTIC_TYPE_NUMBER_OF_ALLOCATIONS,
+	     number_of_allocations,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of allocations.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( internal_file->file_header == NULL )
+	if( libscca_file_get_statistic(
+	     file,
+	     LIBSCCA_STATISTIC_TYPE_ALLOCATED_SIZE,
+	     allocated_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file header.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve allocated size.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO add function to file header */
-	if( libuna_utf16_string_size_from_utf16_stream(
-	     internal_file->file_header->executable_filename,
-	     internal_file->file_header->executable_filename_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf16_string_size,
+	if( libscca_file_get_statistic(
+	     file,
+	     LIBSCCA_STATISTIC_TYPE_MAXIMUM_ALLOCATED_SIZE,
+	     maximum_allocated_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of UTF-16 executable filename string.",
+		 "%s: unable to retrieve maximum allocated size.",
 		 function );
 
 		return( -1 );
@@ -1789,18 +11739,18 @@ int libscca_file_get_utf16_executable_filename_size(
 	return( 1 );
 }
 
-/* Retrieves a specific UTF-16 encoded executable filename
- * The size should include the end of string character
+/* Retrieves the size of the snapshot data of the file
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf16_executable_filename(
+int libscca_file_get_snapshot_size(
      libscca_file_t *file,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *snapshot_size,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_executable_filename";
+	static char *function                  = "libscca_file_get_snapshot_size";
+	size_t bloom_filter_size               = 0;
+	size_t data_size                       = 0;
 
 	if( file == NULL )
 	{
@@ -1813,52 +11763,84 @@ int libscca_file_get_utf16_executable_filename(
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( internal_file->file_header == NULL )
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot size.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO add function to file header */
-	if( libuna_utf16_string_copy_from_utf16_stream(
-	     (libuna_utf16_character_t *) utf16_string,
-	     utf16_string_size,
-	     internal_file->file_header->executable_filename,
-	     internal_file->file_header->executable_filename_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	if( internal_file->uncompressed_data != NULL )
+	{
+		data_size = internal_file->uncompressed_data_size;
+	}
+	else
+	{
+		data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+	}
+	if( libscca_file_get_snapshot_bloom_filter_size(
+	     internal_file,
+	     &bloom_filter_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set UTF-16 executable filename string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot Bloom filter size.",
 		 function );
 
 		return( -1 );
 	}
+	*snapshot_size = sizeof( scca_snapshot_header_t ) + data_size;
+
+	if( bloom_filter_size != 0 )
+	{
+		*snapshot_size = ( ( *snapshot_size + 7 ) / 8 ) * 8 + bloom_filter_size;
+	}
 	return( 1 );
 }
 
-/* Retrieves the prefetch hash
+/* Retrieves the size of the filename Bloom filter in the snapshot data of the file
+ * The size is 0 if the filenames were not read, in which case no Bloom filter is written
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_prefetch_hash(
-     libscca_file_t *file,
-     uint32_t *prefetch_hash,
+int libscca_file_get_snapshot_bloom_filter_size(
+     libscca_internal_file_t *internal_file,
+     size_t *bloom_filter_size,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_prefetch_hash";
+	static char *function = "libscca_file_get_snapshot_bloom_filter_size";
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1869,51 +11851,72 @@ int libscca_file_get_prefetch_hash(
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( internal_file->file_header == NULL )
+	if( bloom_filter_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter size.",
 		 function );
 
 		return( -1 );
 	}
-	if( prefetch_hash == NULL )
+	if( ( internal_file->filename_strings == NULL )
+	 || ( internal_file->filename_strings->number_of_offsets == 0 )
+	 || ( ( internal_file->access_flags & LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 0 ) )
+	{
+		*bloom_filter_size = 0;
+
+		return( 1 );
+	}
+	if( internal_file->filename_strings->bloom_filter != NULL )
+	{
+		*bloom_filter_size = internal_file->filename_strings->bloom_filter_size;
+
+		return( 1 );
+	}
+	if( libscca_bloom_filter_get_size(
+	     internal_file->filename_strings->number_of_offsets,
+	     bloom_filter_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid prefetch hash.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine Bloom filter size.",
 		 function );
 
 		return( -1 );
 	}
-	*prefetch_hash = internal_file->file_header->prefetch_hash;
-
 	return( 1 );
 }
 
-/* Retrieves a specific last run time
- * The timestamp is a 64-bit FILETIME date and time value
- * Files of format version 23 and earlier contain a single last run time
- * Files of format version 26 and later contain up to 8 last run times
- * A value if 0 means the last run time is not set
+/* Writes the snapshot data of the file
+ * The snapshot data consists of a snapshot header followed by the uncompressed data,
+ * which is 8-byte aligned when the snapshot data is, so that it can be parsed in place
+ * by libscca_file_open_snapshot without decompression
+ * If the filenames were read the uncompressed data is followed by an 8-byte aligned
+ * Bloom filter of the case folded hashes of the filenames
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_last_run_time(
+int libscca_file_write_snapshot(
      libscca_file_t *file,
-     int last_run_time_index,
-     uint64_t *filetime,
+     uint8_t *snapshot_data,
+     size_t snapshot_data_size,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_last_run_time";
-	int number_of_last_run_times           = 0;
+	libscca_internal_file_t *internal_file  = NULL;
+	scca_snapshot_header_t *snapshot_header = NULL;
+	static char *function                   = "libscca_file_write_snapshot";
+	size_t bloom_filter_offset              = 0;
+	size_t bloom_filter_size                = 0;
+	size_t data_size                        = 0;
+	ssize_t read_count                      = 0;
+	uint64_t bloom_filter_checksum          = 0;
+	uint64_t checksum                       = 0;
+	int result                              = 1;
 
 	if( file == NULL )
 	{
@@ -1934,247 +11937,385 @@ int libscca_file_get_last_run_time(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing IO handle.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_information == NULL )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file information.",
+		 "%s: invalid file - missing file header.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle->format_version < 26 )
-	{
-		number_of_last_run_times = 1;
-	}
-	else
-	{
-		number_of_last_run_times = 8;
-	}
-	if( ( last_run_time_index < 0 )
-	 || ( last_run_time_index >= number_of_last_run_times ) )
+	if( ( internal_file->uncompressed_data == NULL )
+	 && ( internal_file->uncompressed_data_stream == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid last run time index value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing uncompressed data stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( filetime == NULL )
+	if( snapshot_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
+		 "%s: invalid snapshot data.",
 		 function );
 
 		return( -1 );
 	}
-	*filetime = internal_file->file_information->last_run_time[ last_run_time_index ];
-
-	return( 1 );
-}
-
-/* Retrieves the run count
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_run_count(
-     libscca_file_t *file,
-     uint32_t *run_count,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_run_count";
-
-	if( file == NULL )
+	if( snapshot_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid snapshot data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	if( internal_file->uncompressed_data != NULL )
+	{
+		data_size = internal_file->uncompressed_data_size;
+	}
+	else
+	{
+		data_size = (size_t) internal_file->io_handle->uncompressed_data_size;
+	}
+	if( libscca_file_get_snapshot_bloom_filter_size(
+	     internal_file,
+	     &bloom_filter_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid internal file - missing file information.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot Bloom filter size.",
 		 function );
 
 		return( -1 );
 	}
-	if( run_count == NULL )
+	if( bloom_filter_size != 0 )
+	{
+		bloom_filter_offset = ( ( sizeof( scca_snapshot_header_t ) + data_size + 7 ) / 8 ) * 8;
+
+		if( ( bloom_filter_offset > (size_t) UINT32_MAX )
+		 || ( bloom_filter_size > (size_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid Bloom filter offset or size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( snapshot_data_size < ( sizeof( scca_snapshot_header_t ) + data_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid run count.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid snapshot data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	*run_count = internal_file->file_information->run_count;
-
-	return( 1 );
-}
-
-/* Retrieves the number of file metrics entries
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_number_of_file_metrics_entries(
-     libscca_file_t *file,
-     int *number_of_entries,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_number_of_file_metrics_entries";
-
-	if( file == NULL )
+	if( ( bloom_filter_size != 0 )
+	 && ( snapshot_data_size < ( bloom_filter_offset + bloom_filter_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid snapshot data size value too small.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->file_metrics_array,
-	     number_of_entries,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Reading the uncompressed data stream changes its current offset
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of file metrics entries.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+#endif
+	if( internal_file->uncompressed_data != NULL )
+	{
+		if( memory_copy(
+		     &( snapshot_data[ sizeof( scca_snapshot_header_t ) ] ),
+		     internal_file->uncompressed_data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy uncompressed data.",
+			 function );
 
-/* Retrieves a specific file metrics entry
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_file_metrics_entry(
-     libscca_file_t *file,
-     int entry_index,
-     libscca_file_metrics_t **file_metrics,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_file_metrics_entry";
+			result = -1;
+		}
+	}
+	else
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_file->uncompressed_data_stream,
+		     0,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek uncompressed data stream offset: 0.",
+			 function );
 
-	if( file == NULL )
+			result = -1;
+		}
+		else
+		{
+			read_count = libfdata_stream_read_buffer(
+			              internal_file->uncompressed_data_stream,
+			              (intptr_t *) internal_file->file_io_handle,
+			              &( snapshot_data[ sizeof( scca_snapshot_header_t ) ] ),
+			              data_size,
+			              0,
+			              error );
+
+			if( read_count != (ssize_t) data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read uncompressed data from stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->file_metrics_array,
-	     entry_index,
-	     (intptr_t **) file_metrics,
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     &( snapshot_data[ sizeof( scca_snapshot_header_t ) ] ),
+	     data_size,
+	     0,
+	     &checksum,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file metrics entry: %d.",
-		 function,
-		 entry_index );
+		 "%s: unable to calculate snapshot data checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bloom_filter_size != 0 )
+	{
+		if( memory_set(
+		     &( snapshot_data[ sizeof( scca_snapshot_header_t ) + data_size ] ),
+		     0,
+		     bloom_filter_offset - ( sizeof( scca_snapshot_header_t ) + data_size ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear Bloom filter alignment padding.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->filename_strings->bloom_filter != NULL )
+		{
+			if( memory_copy(
+			     &( snapshot_data[ bloom_filter_offset ] ),
+			     internal_file->filename_strings->bloom_filter,
+			     bloom_filter_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy Bloom filter.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else if( libscca_bloom_filter_build(
+		          &( snapshot_data[ bloom_filter_offset ] ),
+		          bloom_filter_size,
+		          LIBSCCA_BLOOM_FILTER_NUMBER_OF_HASHES,
+		          internal_file->filename_strings->case_folded_hashes,
+		          internal_file->filename_strings->number_of_offsets,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to build Bloom filter.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_hash_calculate_xxh64(
+		     &( snapshot_data[ bloom_filter_offset ] ),
+		     bloom_filter_size,
+		     0,
+		     &bloom_filter_checksum,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate snapshot Bloom filter checksum.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
-	return( 1 );
-}
-
-/* Retrieves the number of filenames
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_number_of_filenames(
-     libscca_file_t *file,
-     int *number_of_filenames,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_number_of_filenames";
+	snapshot_header = (scca_snapshot_header_t *) snapshot_data;
 
-	if( file == NULL )
+	if( memory_set(
+	     snapshot_header,
+	     0,
+	     sizeof( scca_snapshot_header_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear snapshot header.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libscca_filename_strings_get_number_of_filenames(
-	     internal_file->filename_strings,
-	     number_of_filenames,
-	     error ) != 1 )
+	if( memory_copy(
+	     snapshot_header->signature,
+	     "SCCASNAP",
+	     8 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of filename strings.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy snapshot signature.",
 		 function );
 
 		return( -1 );
 	}
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->snapshot_format_version,
+	 LIBSCCA_SNAPSHOT_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->data_offset,
+	 (uint32_t) sizeof( scca_snapshot_header_t ) );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 snapshot_header->data_size,
+	 (uint64_t) data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 snapshot_header->data_checksum,
+	 checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->format_version,
+	 internal_file->io_handle->format_version );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 snapshot_header->file_size,
+	 internal_file->io_handle->file_size );
+
+	if( bloom_filter_size != 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->bloom_filter_offset,
+		 (uint32_t) bloom_filter_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->bloom_filter_size,
+		 (uint32_t) bloom_filter_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 snapshot_header->bloom_filter_checksum,
+		 bloom_filter_checksum );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 snapshot_header->bloom_filter_number_of_hashes,
+		 LIBSCCA_BLOOM_FILTER_NUMBER_OF_HASHES );
+	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded filename
- * The returned size includes the end of string character
+/* Shares the parsed state of the file
+ * The shared file is a read-only file that is opened from a snapshot of the file,
+ * hence it does not depend on the file, which can be closed, and it can be read
+ * by multiple threads concurrently
+ * If the file is a shared file a reference is added and the same file is returned
+ * The shared file must be released with libscca_file_release
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf8_filename_size(
+int libscca_file_share(
      libscca_file_t *file,
-     int filename_index,
-     size_t *utf8_string_size,
+     libscca_file_t **shared_file,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_filename_size";
+	libscca_shared_file_t *new_shared_file = NULL;
+	static char *function                  = "libscca_file_share";
 
 	if( file == NULL )
 	{
@@ -2189,174 +12330,159 @@ int libscca_file_get_utf8_filename_size(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libscca_filename_strings_get_utf8_filename_size(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( shared_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename: %d UTF-8 string size.",
-		 function,
-		 filename_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific UTF-8 encoded filename
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_utf8_filename(
-     libscca_file_t *file,
-     int filename_index,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf8_filename";
-
-	if( file == NULL )
+	if( *shared_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared file value already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
+	if( internal_file->shared_file != NULL )
+	{
+		if( libscca_shared_file_add_reference(
+		     (libscca_shared_file_t *) internal_file->shared_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add reference to shared file.",
+			 function );
 
-	if( libscca_filename_strings_get_utf8_filename(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf8_string,
-	     utf8_string_size,
+			return( -1 );
+		}
+		*shared_file = file;
+
+		return( 1 );
+	}
+	if( libscca_shared_file_initialize(
+	     &new_shared_file,
+	     file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename: %d to UTF-8 string.",
-		 function,
-		 filename_index );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create shared file.",
+		 function );
 
 		return( -1 );
 	}
+	*shared_file = new_shared_file->file;
+
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded filename
- * The returned size includes the end of string character
+/* Releases a reference to a shared file
+ * The shared file is freed when its last reference is released
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_utf16_filename_size(
-     libscca_file_t *file,
-     int filename_index,
-     size_t *utf16_string_size,
+int libscca_file_release(
+     libscca_file_t **shared_file,
      libcerror_error_t **error )
 {
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_filename_size";
+	libscca_internal_file_t *internal_file  = NULL;
+	libscca_shared_file_t *free_shared_file = NULL;
+	static char *function                   = "libscca_file_release";
+	int number_of_references                = 0;
 
-	if( file == NULL )
+	if( shared_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid shared file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libscca_filename_strings_get_utf16_filename_size(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( *shared_file == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename: %d UTF-16 string size.",
-		 function,
-		 filename_index );
-
-		return( -1 );
+		return( 1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific UTF-16 encoded filename
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_utf16_filename(
-     libscca_file_t *file,
-     int filename_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_utf16_filename";
+	internal_file = (libscca_internal_file_t *) *shared_file;
 
-	if( file == NULL )
+	if( internal_file->shared_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid shared file - file is not shared, use libscca_file_free instead.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
-
-	if( libscca_filename_strings_get_utf16_filename(
-	     internal_file->filename_strings,
-	     filename_index,
-	     utf16_string,
-	     utf16_string_size,
+	if( libscca_shared_file_remove_reference(
+	     (libscca_shared_file_t *) internal_file->shared_file,
+	     &number_of_references,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename: %d to UTF-16 string.",
-		 function,
-		 filename_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to remove reference from shared file.",
+		 function );
 
 		return( -1 );
 	}
+	if( number_of_references == 0 )
+	{
+		free_shared_file = (libscca_shared_file_t *) internal_file->shared_file;
+	}
+	*shared_file = NULL;
+
+	if( free_shared_file != NULL )
+	{
+		if( libscca_shared_file_free(
+		     &free_shared_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free shared file.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Retrieves the number of volumes
+/* Trims the caches of the file
+ * Empties the cache of decompressed blocks and frees the trace chain, which is read
+ * again from the file IO handle when it is used. The parsed values are kept, since
+ * the values retrieved from the file can reference them
  * Returns 1 if successful or -1 on error
  */
-int libscca_file_get_number_of_volumes(
+int libscca_file_trim_caches(
      libscca_file_t *file,
-     int *number_of_volumes,
      libcerror_error_t **error )
 {
 	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_number_of_volumes";
+	static char *function                  = "libscca_file_trim_caches";
+	int result                             = 1;
 
 	if( file == NULL )
 	{
@@ -2371,64 +12497,85 @@ int libscca_file_get_number_of_volumes(
 	}
 	internal_file = (libscca_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->volumes_array,
-	     number_of_volumes,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific volume information
- * Returns 1 if successful or -1 on error
- */
-int libscca_file_get_volume_information(
-     libscca_file_t *file,
-     int volume_index,
-     libscca_volume_information_t **volume_information,
-     libcerror_error_t **error )
-{
-	libscca_internal_file_t *internal_file = NULL;
-	static char *function                  = "libscca_file_get_volume_information";
-
-	if( file == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libscca_internal_file_t *) file;
+#endif
+	if( internal_file->compressed_blocks_cache != NULL )
+	{
+		if( libfcache_cache_empty(
+		     internal_file->compressed_blocks_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty compressed blocks cache.",
+			 function );
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->volumes_array,
-	     volume_index,
-	     (intptr_t **) volume_information,
+			result = -1;
+		}
+	}
+	/* The trace chain can only be read again if the file IO handle is set
+	 * and a recovered trace chain is kept
+	 */
+	if( ( result == 1 )
+	 && ( internal_file->trace_chain != NULL )
+	 && ( internal_file->file_io_handle != NULL )
+	 && ( ( internal_file->io_handle->corruption_flags & LIBSCCA_CORRUPTION_FLAG_TRACE_CHAIN ) == 0 ) )
+	{
+		if( libscca_trace_chain_clear(
+		     internal_file->trace_chain,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear trace chain.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume: %d information.",
-		 function,
-		 volume_index );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
@@ -25,23 +25,45 @@
 #include <common.h>
 #include <types.h>
 
+#include "libscca_arena.h"
+#include "libscca_context.h"
 #include "libscca_extern.h"
 #include "libscca_file_header.h"
 #include "libscca_file_information.h"
+#include "libscca_file_metrics.h"
+#include "libscca_file_metrics_values.h"
 #include "libscca_filename_strings.h"
 #include "libscca_io_handle.h"
 #include "libscca_libbfio.h"
-#include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
+#include "libscca_mapped_file.h"
+#include "libscca_mount_points.h"
+#include "libscca_trace_chain.h"
 #include "libscca_types.h"
+#include "libscca_volumes.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libscca_section_view libscca_section_view_t;
+
+struct libscca_section_view
+{
+	/* The offset of the section
+	 * Contains 0 if the section is not present or is corrupted
+	 */
+	off64_t offset;
+
+	/* The size of the section
+	 */
+	size64_t size;
+};
+
 typedef struct libscca_internal_file libscca_internal_file_t;
 
 struct libscca_internal_file
@@ -50,6 +72,18 @@ struct libscca_internal_file
 	 */
 	libscca_io_handle_t *io_handle;
 
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The error domain of the last failed read when opened with LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS
+	 */
+	int open_error_domain;
+
+	/* The error code of the last failed read when opened with LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS
+	 */
+	int open_error_code;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -62,6 +96,11 @@ struct libscca_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The memory-mapped file
+	 * Created on the first open with the memory mapped access flag
+	 */
+	libscca_mapped_file_t *mapped_file;
+
 	/* The compressed blocks list
 	 */
 	libfdata_list_t *compressed_blocks_list;
@@ -74,6 +113,16 @@ struct libscca_internal_file
 	 */
 	libfdata_stream_t *uncompressed_data_stream;
 
+	/* The uncompressed data
+	 * Contains NULL if the file was not opened from memory
+	 * The buffer of decompressed data is owned by the IO handle
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
 	/* The (uncompressed) file header
 	 */
 	libscca_file_header_t *file_header;
@@ -82,17 +131,105 @@ struct libscca_internal_file
 	 */
 	libscca_file_information_t *file_information;
 
-	/* The file metrics array
+	/* The (uncompressed) file header of the previous parse
+	 * Contains NULL if the file is not being updated
+	 */
+	libscca_file_header_t *previous_file_header;
+
+	/* The file information of the previous parse
+	 * Contains NULL if the file is not being updated
+	 */
+	libscca_file_information_t *previous_file_information;
+
+	/* The update flags, which indicate what changed in the last update
+	 */
+	uint32_t update_flags;
+
+	/* The file metrics array section, which is validated before the sections are read
+	 * The section only contains the entries that are read
+	 */
+	libscca_section_view_t file_metrics_view;
+
+	/* The number of file metrics entries that are read, which is less than the number
+	 * of entries in the file information if the number of entries is capped
+	 */
+	uint32_t number_of_file_metrics_entries;
+
+	/* The trace chain array section, which is validated before the sections are read
+	 */
+	libscca_section_view_t trace_chain_view;
+
+	/* The filename strings section, which is validated before the sections are read
+	 */
+	libscca_section_view_t filename_strings_view;
+
+	/* The volumes information section, which is validated before the sections are read
+	 */
+	libscca_section_view_t volumes_view;
+
+	/* The file metrics values, which contain the values of all file metrics entries as columns
+	 */
+	libscca_file_metrics_values_t *file_metrics_values;
+
+	/* The file metrics handles
+	 * The handles are allocated from the arena when a file metrics entry is first requested
+	 */
+	libscca_internal_file_metrics_t *file_metrics_handles;
+
+	/* The arena the file metrics handles are allocated from
+	 */
+	libscca_arena_t *arena;
+
+	/* The file metrics entry indexes sorted by start time
+	 * Allocated from the arena when first requested
+	 */
+	int *file_metrics_start_time_order;
+
+	/* The hash table that maps the case folded hashes of the filenames to the file metrics entries
+	 * Allocated from the arena when first requested
+	 */
+	uint32_t *file_metrics_filename_hash_table;
+
+	/* The number of file metrics filename hash table entries, which is a power of 2
+	 */
+	uint32_t file_metrics_filename_hash_table_size;
+
+	/* The trace chain
+	 * The trace chain array is read on first access
 	 */
-	libcdata_array_t *file_metrics_array;
+	libscca_trace_chain_t *trace_chain;
 
 	/* The filename strings
 	 */
 	libscca_filename_strings_t *filename_strings;
 
-	/* The volumes array
+	/* The mount points, which map the device paths of the filenames to mount points
+	 * Contains NULL if no mount points were set
 	 */
-	libcdata_array_t *volumes_array;
+	libscca_mount_points_t *mount_points;
+
+	/* The volumes
+	 */
+	libscca_volumes_t *volumes;
+
+	/* The parse cache entry
+	 * Contains NULL if the file was not opened using a parse cache
+	 */
+	intptr_t *parse_cache_entry;
+
+	/* The shared file
+	 * Contains NULL if the file was not created by libscca_file_share
+	 */
+	intptr_t *shared_file;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 * The parsed sections are not changed after open, hence only open, close, update
+	 * and the trace chain functions, that read the trace chain array on first
+	 * access, grab the lock and the other get functions can be called concurrently
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBSCCA_EXTERN \
@@ -100,6 +237,12 @@ int libscca_file_initialize(
      libscca_file_t **file,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_initialize_with_context(
+     libscca_file_t **file,
+     libscca_context_t *context,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_free(
      libscca_file_t **file,
@@ -110,6 +253,90 @@ int libscca_file_signal_abort(
      libscca_file_t *file,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_open_error(
+     libscca_file_t *file,
+     int *error_domain,
+     int *error_code,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_corruption_flags(
+     libscca_file_t *file,
+     uint32_t *corruption_flags,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_parse_budget(
+     libscca_file_t *file,
+     uint32_t maximum_number_of_entries,
+     uint64_t maximum_uncompressed_data_size,
+     uint64_t maximum_number_of_steps,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_parse_budget(
+     libscca_file_t *file,
+     uint32_t *maximum_number_of_entries,
+     uint64_t *maximum_uncompressed_data_size,
+     uint64_t *maximum_number_of_steps,
+     uint64_t *number_of_steps,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_deadline(
+     libscca_file_t *file,
+     uint64_t deadline,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_deadline(
+     libscca_file_t *file,
+     uint64_t *deadline,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_maximum_number_of_cached_blocks(
+     libscca_file_t *file,
+     int maximum_number_of_cached_blocks,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_maximum_number_of_cached_blocks(
+     libscca_file_t *file,
+     int *maximum_number_of_cached_blocks,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_maximum_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int maximum_number_of_file_metrics_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_maximum_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int *maximum_number_of_file_metrics_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_block_cache(
+     libscca_file_t *file,
+     libscca_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_string_pool(
+     libscca_file_t *file,
+     libscca_string_pool_t *string_pool,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_volume_dictionary(
+     libscca_file_t *file,
+     libscca_volume_dictionary_t *volume_dictionary,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_open(
      libscca_file_t *file,
@@ -133,16 +360,180 @@ int libscca_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_open_file_io_handle_with_prefix(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     const uint8_t *prefix_data,
+     size_t prefix_data_size,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_open_memory(
+     libscca_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_open_snapshot(
+     libscca_file_t *file,
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_open_stream(
+     libscca_file_t *file,
+     ssize_t (*read_function)(
+              uint8_t *buffer,
+              size_t buffer_size,
+              void *read_arguments ),
+     void *read_arguments,
+     int access_flags,
+     libcerror_error_t **error );
+
+ssize_t libscca_file_read_stream_buffer(
+         ssize_t (*read_function)(
+                  uint8_t *buffer,
+                  size_t buffer_size,
+                  void *read_arguments ),
+         void *read_arguments,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_close(
      libscca_file_t *file,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_compare_and_update(
+     libscca_file_t *file,
+     uint32_t *update_flags,
+     libcerror_error_t **error );
+
+void libscca_file_set_open_error(
+      libscca_internal_file_t *internal_file );
+
 int libscca_file_open_read(
      libscca_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libscca_file_open_read_data(
+     libscca_internal_file_t *internal_file,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_file_read_compressed_data(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libscca_file_read_uncompressed_file_data(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libscca_file_read_uncompressed_data_stream(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libscca_file_decompress_data(
+     libscca_internal_file_t *internal_file,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int libscca_file_read_uncompressed_data(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libscca_file_read_trace_chain(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libscca_file_get_section_data(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t section_offset,
+     size64_t section_size,
+     const uint8_t **section_data,
+     libcerror_error_t **error );
+
+int libscca_file_clear_updated_sections(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libscca_file_read_sections(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libscca_file_validate_sections(
+     libscca_internal_file_t *internal_file,
+     size64_t file_size,
+     off64_t file_offset,
+     uint32_t update_flags,
+     libcerror_error_t **error );
+
+int libscca_file_read_file_metrics_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t update_flags,
+     libcerror_error_t **error );
+
+int libscca_file_read_trace_chain_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libscca_file_read_filename_strings_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t update_flags,
+     libcerror_error_t **error );
+
+int libscca_file_read_volumes_section(
+     libscca_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     uint32_t update_flags,
+     libcerror_error_t **error );
+
+int libscca_file_recover_section(
+     libscca_internal_file_t *internal_file,
+     uint32_t corruption_flag,
+     libcerror_error_t **error );
+
+int libscca_file_resolve_filename_indexes(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libscca_file_get_file_metrics_handle(
+     libscca_internal_file_t *internal_file,
+     int entry_index,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error );
+
+int libscca_file_build_file_metrics_start_time_order(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libscca_file_build_file_metrics_filename_hash_table(
+     libscca_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_format_version(
      libscca_file_t *file,
@@ -188,6 +579,14 @@ int libscca_file_get_last_run_time(
      uint64_t *filetime,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_last_run_times(
+     libscca_file_t *file,
+     uint64_t *filetimes,
+     int maximum_number_of_filetimes,
+     int *number_of_filetimes,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_run_count(
      libscca_file_t *file,
@@ -200,6 +599,12 @@ int libscca_file_get_number_of_file_metrics_entries(
      int *number_of_entries,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_total_number_of_file_metrics_entries(
+     libscca_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_file_metrics_entry(
      libscca_file_t *file,
@@ -207,6 +612,96 @@ int libscca_file_get_file_metrics_entry(
      libscca_file_metrics_t **file_metrics,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_table(
+     libscca_file_t *file,
+     uint32_t *start_times,
+     uint32_t *durations,
+     uint32_t *flags,
+     uint64_t *file_references,
+     int *filename_indexes,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_columns(
+     libscca_file_t *file,
+     const uint32_t **start_times,
+     const uint32_t **durations,
+     const uint32_t **flags,
+     const uint64_t **file_references,
+     const int **filename_indexes,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_start_time_order(
+     libscca_file_t *file,
+     const int **entry_indexes,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_entry_by_start_time(
+     libscca_file_t *file,
+     int sort_index,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_entry_index_by_utf8_filename(
+     libscca_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_next_file_metrics_entry_index_by_filename_hash(
+     libscca_file_t *file,
+     int first_entry_index,
+     uint64_t case_folded_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_number_of_trace_chain_entries(
+     libscca_file_t *file,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_copy_trace_chain_load_counts(
+     libscca_file_t *file,
+     uint32_t *load_counts,
+     int number_of_load_counts,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_copy_trace_chain_next_entry_indexes(
+     libscca_file_t *file,
+     uint32_t *next_entry_indexes,
+     int number_of_next_entry_indexes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_file_metrics_block_load_summaries(
+     libscca_file_t *file,
+     uint64_t *block_load_counts,
+     uint64_t *loaded_sizes,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_visit_file_metrics(
+     libscca_file_t *file,
+     int (*callback_function)(
+            int entry_index,
+            libscca_file_metrics_t *file_metrics,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_number_of_filenames(
      libscca_file_t *file,
@@ -243,6 +738,127 @@ int libscca_file_get_utf16_filename(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_utf16_filename_stream(
+     libscca_file_t *file,
+     int filename_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_filename_case_folded_hash(
+     libscca_file_t *file,
+     int filename_index,
+     uint64_t *case_folded_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_copy_filename_case_folded_hashes(
+     libscca_file_t *file,
+     uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_may_contain_filename(
+     libscca_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_may_contain_filename_hash(
+     libscca_file_t *file,
+     uint64_t case_folded_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_set_mount_points(
+     libscca_file_t *file,
+     const char * const device_paths[],
+     const char * const mount_point_paths[],
+     int number_of_mount_points,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_utf8_mapped_filename_size(
+     libscca_file_t *file,
+     int filename_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_utf8_mapped_filename(
+     libscca_file_t *file,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_filename_index_by_utf8_pattern(
+     libscca_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_filename_index_by_utf16_pattern(
+     libscca_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_next_filename_index_by_utf16_pattern(
+     libscca_file_t *file,
+     int first_filename_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_verify_prefetch_hash(
+     libscca_file_t *file,
+     int *filename_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_utf8_filenames_table_size(
+     libscca_file_t *file,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_utf8_filenames_table(
+     libscca_file_t *file,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_visit_filenames(
+     libscca_file_t *file,
+     int (*callback_function)(
+            int filename_index,
+            const uint8_t *utf16_stream,
+            size_t utf16_stream_size,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_get_number_of_volumes(
      libscca_file_t *file,
@@ -256,6 +872,69 @@ int libscca_file_get_volume_information(
      libscca_volume_information_t **volume_information,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_get_volume_identifiers(
+     libscca_file_t *file,
+     int *volume_identifiers,
+     int number_of_volume_identifiers,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_fingerprint(
+     libscca_file_t *file,
+     uint8_t *fingerprint,
+     size_t fingerprint_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_statistic(
+     libscca_file_t *file,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_memory_usage(
+     libscca_file_t *file,
+     uint64_t *number_of_allocations,
+     uint64_t *allocated_size,
+     uint64_t *maximum_allocated_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_get_snapshot_size(
+     libscca_file_t *file,
+     size_t *snapshot_size,
+     libcerror_error_t **error );
+
+int libscca_file_get_snapshot_bloom_filter_size(
+     libscca_internal_file_t *internal_file,
+     size_t *bloom_filter_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_write_snapshot(
+     libscca_file_t *file,
+     uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_share(
+     libscca_file_t *file,
+     libscca_file_t **shared_file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_release(
+     libscca_file_t **shared_file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_trim_caches(
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
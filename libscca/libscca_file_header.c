@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libscca_byte_stream.h"
 #include "libscca_debug.h"
 #include "libscca_file_header.h"
 #include "libscca_io_handle.h"
@@ -32,6 +33,8 @@
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
 #include "libscca_libuna.h"
+#include "libscca_memory.h"
+#include "libscca_utf16_stream.h"
 
 #include "scca_file_header.h"
 
@@ -147,7 +150,8 @@ int libscca_file_header_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_file_header_read_data";
+	static char *function   = "libscca_file_header_read_data";
+	size_t utf8_string_size = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit  = 0;
@@ -213,15 +217,15 @@ int libscca_file_header_read_data(
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_header_t *) data )->format_version,
 	 file_header->format_version );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_header_t *) data )->file_size,
 	 file_header->file_size );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_header_t *) data )->prefetch_hash,
 	 file_header->prefetch_hash );
 
@@ -249,6 +253,29 @@ int libscca_file_header_read_data(
 			break;
 		}
 	}
+	/* The executable filename is converted once since it is typically retrieved
+	 * by its size followed by its value. A filename that cannot be converted is
+	 * converted again when retrieved so that the error is reported at that time
+	 */
+	file_header->utf8_executable_filename_size = 0;
+
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     file_header->executable_filename,
+	     file_header->executable_filename_size,
+	     &utf8_string_size,
+	     NULL ) == 1 )
+	{
+		if( ( utf8_string_size <= sizeof( file_header->utf8_executable_filename ) )
+		 && ( libscca_utf16_stream_copy_to_utf8_string(
+		       file_header->executable_filename,
+		       file_header->executable_filename_size,
+		       file_header->utf8_executable_filename,
+		       utf8_string_size,
+		       NULL ) == 1 ) )
+		{
+			file_header->utf8_executable_filename_size = utf8_string_size;
+		}
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -265,7 +292,7 @@ int libscca_file_header_read_data(
 		 ( (scca_file_header_t *) data )->signature[ 2 ],
 		 ( (scca_file_header_t *) data )->signature[ 3 ] );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_file_header_t *) data )->unknown1,
 		 value_32bit );
 		libcnotify_printf(
@@ -300,7 +327,7 @@ int libscca_file_header_read_data(
 		 function,
 		 file_header->prefetch_hash );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_file_header_t *) data )->unknown2,
 		 value_32bit );
 		libcnotify_printf(
@@ -401,3 +428,153 @@ int libscca_file_header_read_data_stream(
 	return( 1 );
 }
 
+/* Retrieves the size of the UTF-8 encoded executable filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_header_get_utf8_executable_filename_size(
+     libscca_file_header_t *file_header,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_header_get_utf8_executable_filename_size";
+
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header->utf8_executable_filename_size != 0 )
+	{
+		*utf8_string_size = file_header->utf8_executable_filename_size;
+
+		return( 1 );
+	}
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     file_header->executable_filename,
+	     file_header->executable_filename_size,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 executable filename string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded executable filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_header_get_utf8_executable_filename(
+     libscca_file_header_t *file_header,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_header_get_utf8_executable_filename";
+
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header->utf8_executable_filename_size != 0 )
+	{
+		if( utf8_string_size < file_header->utf8_executable_filename_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     file_header->utf8_executable_filename,
+		     file_header->utf8_executable_filename_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 executable filename string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libscca_utf16_stream_copy_to_utf8_string(
+	     file_header->executable_filename,
+	     file_header->executable_filename_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy UTF-8 executable filename string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -56,6 +56,17 @@ struct libscca_file_header
 	/* The executable filename size
 	 */
 	size_t executable_filename_size;
+
+	/* The UTF-8 encoded executable filename
+	 * The executable filename is converted once when the file header is read,
+	 * where a UTF-16 character is converted into at most 3 UTF-8 bytes
+	 */
+	uint8_t utf8_executable_filename[ 91 ];
+
+	/* The UTF-8 encoded executable filename size, which includes the end of string character
+	 * The value is 0 if the executable filename could not be converted
+	 */
+	size_t utf8_executable_filename_size;
 };
 
 int libscca_file_header_initialize(
@@ -78,6 +89,17 @@ int libscca_file_header_read_data_stream(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libscca_file_header_get_utf8_executable_filename_size(
+     libscca_file_header_t *file_header,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libscca_file_header_get_utf8_executable_filename(
+     libscca_file_header_t *file_header,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
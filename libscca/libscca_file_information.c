@@ -24,15 +24,18 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libscca_byte_stream.h"
 #include "libscca_debug.h"
 #include "libscca_definitions.h"
 #include "libscca_file_information.h"
+#include "libscca_format_layout.h"
 #include "libscca_io_handle.h"
 #include "libscca_libbfio.h"
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfdatetime.h"
+#include "libscca_memory.h"
 
 #include "scca_file_information.h"
 
@@ -149,15 +152,17 @@ int libscca_file_information_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function             = "libscca_file_information_read_data";
-	size_t file_information_data_size = 0;
-	int last_run_time_index           = 0;
-	int number_of_last_run_times      = 0;
+	const libscca_format_layout_t *format_layout = NULL;
+	const uint8_t *last_run_time_data            = NULL;
+	static char *function                        = "libscca_file_information_read_data";
+	size_t file_information_data_size            = 0;
+	int last_run_time_index                      = 0;
+	int number_of_last_run_times                 = 0;
+	int result                                   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit              = 0;
-	uint32_t value_32bit              = 0;
-	int result                        = 0;
+	uint64_t value_64bit                         = 0;
+	uint32_t value_32bit                         = 0;
 #endif
 
 	if( file_information == NULL )
@@ -182,16 +187,13 @@ int libscca_file_information_read_data(
 
 		return( -1 );
 	}
-	if( ( io_handle->format_version != 17 )
-	 && ( io_handle->format_version != 23 )
-	 && ( io_handle->format_version != 26 )
-	 && ( io_handle->format_version != 30 ) )
+	if( io_handle->format_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid IO handle - unsupported format version.",
+		 "%s: invalid IO handle - missing format layout.",
 		 function );
 
 		return( -1 );
@@ -219,13 +221,28 @@ int libscca_file_information_read_data(
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->metrics_array_offset,
 	 file_information->metrics_array_offset );
 
-	if( ( io_handle->format_version == 30 )
-	 && ( file_information->metrics_array_offset != 0x00000128 )
-	 && ( file_information->metrics_array_offset != 0x00000130 ) )
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          io_handle->format_layout,
+	          file_information->metrics_array_offset,
+	          &format_layout,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format layout.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -236,25 +253,8 @@ int libscca_file_information_read_data(
 
 		return( -1 );
 	}
-	if( io_handle->format_version == 17 )
-	{
-		file_information_data_size = sizeof( scca_file_information_v17_t );
-	}
-	else if( io_handle->format_version == 23 )
-	{
-		file_information_data_size = sizeof( scca_file_information_v23_t );
-	}
-	else if( ( io_handle->format_version == 26 )
-	      || ( ( io_handle->format_version == 30 )
-	       &&  ( file_information->metrics_array_offset == 0x00000130 ) ) )
-	{
-		file_information_data_size = sizeof( scca_file_information_v26_t );
-	}
-	else if( ( io_handle->format_version == 30 )
-	      && ( file_information->metrics_array_offset == 0x00000128 ) )
-	{
-		file_information_data_size = sizeof( scca_file_information_v30_2_t );
-	}
+	file_information_data_size = format_layout->file_information_data_size;
+
 	if( data_size < file_information_data_size )
 	{
 		libcerror_error_set(
@@ -278,97 +278,55 @@ int libscca_file_information_read_data(
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->number_of_file_metrics_entries,
 	 file_information->number_of_file_metrics_entries );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->trace_chain_array_offset,
 	 file_information->trace_chain_array_offset );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->number_of_trace_chain_array_entries,
 	 file_information->number_of_trace_chain_array_entries );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->filename_strings_offset,
 	 file_information->filename_strings_offset );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->filename_strings_size,
 	 file_information->filename_strings_size );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->volumes_information_offset,
 	 file_information->volumes_information_offset );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->number_of_volumes,
 	 file_information->number_of_volumes );
 
-	byte_stream_copy_to_uint32_little_endian(
+	libscca_byte_stream_copy_to_uint32_little_endian(
 	 ( (scca_file_information_v17_t *) data )->volumes_information_size,
 	 file_information->volumes_information_size );
 
-	if( io_handle->format_version < 26 )
-	{
-		number_of_last_run_times = 1;
-	}
-	else
-	{
-		number_of_last_run_times = 8;
-	}
+	number_of_last_run_times = format_layout->number_of_last_run_times;
+	last_run_time_data       = &( data[ format_layout->last_run_times_offset ] );
+
 	for( last_run_time_index = 0;
 	     last_run_time_index < number_of_last_run_times;
 	     last_run_time_index++ )
 	{
-		if( io_handle->format_version == 17 )
-		{
-			byte_stream_copy_to_uint64_little_endian(
-			 &( ( (scca_file_information_v17_t *) data )->last_run_time[ last_run_time_index * 8 ] ),
-			 file_information->last_run_time[ last_run_time_index ] );
-		}
-		else if( io_handle->format_version == 23 )
-		{
-			byte_stream_copy_to_uint64_little_endian(
-			 &( ( (scca_file_information_v23_t *) data )->last_run_time[ last_run_time_index * 8 ] ),
-			 file_information->last_run_time[ last_run_time_index ] );
-		}
-		else if( ( io_handle->format_version == 26 )
-		      || ( io_handle->format_version == 30 ) )
-		{
-			byte_stream_copy_to_uint64_little_endian(
-			 &( ( (scca_file_information_v26_t *) data )->last_run_time[ last_run_time_index * 8 ] ),
-			 file_information->last_run_time[ last_run_time_index ] );
-		}
-	}
-	if( io_handle->format_version == 17 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_information_v17_t *) data )->run_count,
-		 file_information->run_count );
-	}
-	else if( io_handle->format_version == 23 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_information_v23_t *) data )->run_count,
-		 file_information->run_count );
-	}
-	else if( ( io_handle->format_version == 26 )
-	      || ( ( io_handle->format_version == 30 )
-	       &&  ( file_information->metrics_array_offset == 0x00000130 ) ) )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_information_v26_t *) data )->run_count,
-		 file_information->run_count );
-	}
-	else if( ( io_handle->format_version == 30 )
-	      && ( file_information->metrics_array_offset == 0x00000128 ) )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_information_v30_2_t *) data )->run_count,
-		 file_information->run_count );
+		libscca_byte_stream_copy_to_uint64_little_endian(
+		 last_run_time_data,
+		 file_information->last_run_time[ last_run_time_index ] );
+
+		last_run_time_data += 8;
 	}
+	libscca_byte_stream_copy_to_uint32_little_endian(
+	 &( data[ format_layout->run_count_offset ] ),
+	 file_information->run_count );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -419,7 +377,7 @@ int libscca_file_information_read_data(
 
 		if( io_handle->format_version == 23 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v23_t *) data )->unknown3c,
 			 value_32bit );
 			libcnotify_printf(
@@ -519,7 +477,7 @@ int libscca_file_information_read_data(
 
 		if( io_handle->format_version == 17 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v17_t *) data )->unknown5,
 			 value_32bit );
 			libcnotify_printf(
@@ -532,7 +490,7 @@ int libscca_file_information_read_data(
 		}
 		else if( io_handle->format_version == 23 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v23_t *) data )->unknown5,
 			 value_32bit );
 			libcnotify_printf(
@@ -552,7 +510,7 @@ int libscca_file_information_read_data(
 		      || ( ( io_handle->format_version == 30 )
 		       &&  ( file_information->metrics_array_offset == 0x00000130 ) ) )
 		{
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v26_t *) data )->unknown5a,
 			 value_32bit );
 			libcnotify_printf(
@@ -560,7 +518,7 @@ int libscca_file_information_read_data(
 			 function,
 			 value_32bit );
 
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v26_t *) data )->unknown5b,
 			 value_32bit );
 			libcnotify_printf(
@@ -579,7 +537,7 @@ int libscca_file_information_read_data(
 		else if( ( io_handle->format_version == 30 )
 		      && ( file_information->metrics_array_offset == 0x00000128 ) )
 		{
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v30_2_t *) data )->unknown5a,
 			 value_32bit );
 			libcnotify_printf(
@@ -587,7 +545,7 @@ int libscca_file_information_read_data(
 			 function,
 			 value_32bit );
 
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_information_v30_2_t *) data )->unknown5b,
 			 value_32bit );
 			libcnotify_printf(
@@ -646,46 +604,33 @@ int libscca_file_information_read_stream(
 
 		return( -1 );
 	}
-	if( ( io_handle->format_version != 17 )
-	 && ( io_handle->format_version != 23 )
-	 && ( io_handle->format_version != 26 )
-	 && ( io_handle->format_version != 30 ) )
+	if( io_handle->format_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid IO handle - unsupported format version.",
+		 "%s: invalid IO handle - missing format layout.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->format_version == 17 )
-	{
-		file_information_data_size = sizeof( scca_file_information_v17_t );
-	}
-	else if( io_handle->format_version == 23 )
-	{
-		file_information_data_size = sizeof( scca_file_information_v23_t );
-	}
-	else if( ( io_handle->format_version == 26 )
-	      || ( io_handle->format_version == 30 ) )
-	{
-		file_information_data_size = sizeof( scca_file_information_v26_t );
-	}
-	file_information_data = (uint8_t *) memory_allocate(
-	                                     sizeof( uint8_t ) * file_information_data_size );
+	file_information_data_size = io_handle->format_layout->file_information_data_size;
 
-	if( file_information_data == NULL )
+	if( libscca_io_handle_get_section_data_buffer(
+	     io_handle,
+	     file_information_data_size,
+	     &file_information_data,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file information data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file information data buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	read_count = libfdata_stream_read_buffer(
 	              uncompressed_data_stream,
@@ -704,7 +649,7 @@ int libscca_file_information_read_stream(
 		 "%s: unable to read file information data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libscca_file_information_read_data(
 	     file_information,
@@ -720,19 +665,8 @@ int libscca_file_information_read_stream(
 		 "%s: unable to read file information data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
-	 file_information_data );
-
 	return( 1 );
-
-on_error:
-	if( file_information_data != NULL )
-	{
-		memory_free(
-		 file_information_data );
-	}
-	return( -1 );
 }
 
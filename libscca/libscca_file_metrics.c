@@ -23,11 +23,15 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libscca_byte_stream.h"
 #include "libscca_definitions.h"
 #include "libscca_file_metrics.h"
+#include "libscca_file_metrics_values.h"
+#include "libscca_format_layout.h"
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
 #include "libscca_libuna.h"
+#include "libscca_memory.h"
 
 #include "scca_file_metrics_array.h"
 
@@ -123,6 +127,7 @@ on_error:
 }
 
 /* Frees file metrics
+ * The file metrics are a reference to an entry stored in the file hence only the reference is cleared
  * Returns 1 if successful or -1 on error
  */
 int libscca_file_metrics_free(
@@ -156,7 +161,8 @@ int libscca_internal_file_metrics_free(
      libscca_internal_file_metrics_t **file_metrics,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_file_metrics_free";
+	static char *function = "libscca_internal_file_metrics_free";
+	int result            = 1;
 
 	if( file_metrics == NULL )
 	{
@@ -171,15 +177,32 @@ int libscca_internal_file_metrics_free(
 	}
 	if( *file_metrics != NULL )
 	{
+		if( ( *file_metrics )->free_file_metrics_values != 0 )
+		{
+			if( libscca_file_metrics_values_free(
+			     &( ( *file_metrics )->file_metrics_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file metrics values.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 ( *file_metrics ) );
 
 		*file_metrics = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Reads file metrics from data
+ * The values are stored in file metrics values that are managed by the file metrics
  * Returns 1 if successful or -1 on error
  */
 int libscca_file_metrics_read_data(
@@ -191,9 +214,9 @@ int libscca_file_metrics_read_data(
 {
 	libscca_internal_file_metrics_t *internal_file_metrics = NULL;
 	static char *function                                  = "libscca_file_metrics_read_data";
-	size_t file_metrics_data_size                          = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
+	libscca_file_metrics_values_t *file_metrics_values     = NULL;
 	uint32_t value_32bit                                   = 0;
 #endif
 
@@ -221,15 +244,16 @@ int libscca_file_metrics_read_data(
 
 		return( -1 );
 	}
-	if( io_handle->format_version == 17 )
+	if( io_handle->format_layout == NULL )
 	{
-		file_metrics_data_size = sizeof( scca_file_metrics_array_entry_v17_t );
-	}
-	else if( ( io_handle->format_version == 23 )
-	      || ( io_handle->format_version == 26 )
-	      || ( io_handle->format_version == 30 ) )
-	{
-		file_metrics_data_size = sizeof( scca_file_metrics_array_entry_v23_t );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO handle - missing format layout.",
+		 function );
+
+		return( -1 );
 	}
 	if( data == NULL )
 	{
@@ -242,7 +266,7 @@ int libscca_file_metrics_read_data(
 
 		return( -1 );
 	}
-	if( data_size < file_metrics_data_size )
+	if( data_size < io_handle->format_layout->file_metrics_entry_data_size )
 	{
 		libcerror_error_set(
 		 error,
@@ -264,6 +288,34 @@ int libscca_file_metrics_read_data(
 
 		return( -1 );
 	}
+	if( internal_file_metrics->file_metrics_values == NULL )
+	{
+		if( libscca_file_metrics_values_initialize(
+		     &( internal_file_metrics->file_metrics_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file metrics values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file_metrics->free_file_metrics_values = 1;
+	}
+	else if( internal_file_metrics->free_file_metrics_values == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file metrics - file metrics values already set.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -272,64 +324,47 @@ int libscca_file_metrics_read_data(
 		 function );
 		libcnotify_print_data(
 		 data,
-		 file_metrics_data_size,
+		 io_handle->format_layout->file_metrics_entry_data_size,
 		 0 );
 	}
 #endif
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (scca_file_metrics_array_entry_v17_t *) data )->start_time,
-	 internal_file_metrics->start_time );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (scca_file_metrics_array_entry_v17_t *) data )->duration,
-	 internal_file_metrics->duration );
-
-	if( io_handle->format_version == 17 )
+	if( libscca_file_metrics_values_read_data(
+	     internal_file_metrics->file_metrics_values,
+	     io_handle->format_layout,
+	     data,
+	     data_size,
+	     1,
+	     error ) != 1 )
 	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_metrics_array_entry_v17_t *) data )->filename_string_offset,
-		 internal_file_metrics->filename_string_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file metrics values.",
+		 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_metrics_array_entry_v17_t *) data )->flags,
-		 internal_file_metrics->flags );
+		return( -1 );
 	}
-	else if( ( io_handle->format_version == 23 )
-	      || ( io_handle->format_version == 26 )
-	      || ( io_handle->format_version == 30 ) )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_metrics_array_entry_v23_t *) data )->filename_string_offset,
-		 internal_file_metrics->filename_string_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (scca_file_metrics_array_entry_v23_t *) data )->flags,
-		 internal_file_metrics->flags );
+	internal_file_metrics->entry_index = 0;
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (scca_file_metrics_array_entry_v23_t *) data )->file_reference,
-		 internal_file_metrics->file_reference );
-
-		internal_file_metrics->file_reference_is_set = 1;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
+		file_metrics_values = internal_file_metrics->file_metrics_values;
+
 		libcnotify_printf(
 		 "%s: start time\t\t\t\t: %" PRIu32 " ms\n",
 		 function,
-		 internal_file_metrics->start_time );
+		 file_metrics_values->start_times[ 0 ] );
 
 		libcnotify_printf(
 		 "%s: duration\t\t\t\t: %" PRIu32 " ms\n",
 		 function,
-		 internal_file_metrics->duration );
+		 file_metrics_values->durations[ 0 ] );
 
-		if( ( io_handle->format_version == 23 )
-		 || ( io_handle->format_version == 26 )
-		 || ( io_handle->format_version == 30 ) )
+		if( file_metrics_values->has_file_references != 0 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_file_metrics_array_entry_v23_t *) data )->average_duration,
 			 value_32bit );
 			libcnotify_printf(
@@ -340,48 +375,34 @@ int libscca_file_metrics_read_data(
 		libcnotify_printf(
 		 "%s: filename string offset\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 internal_file_metrics->filename_string_offset );
+		 file_metrics_values->filename_string_offsets[ 0 ] );
 
-		if( io_handle->format_version == 17 )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (scca_file_metrics_array_entry_v17_t *) data )->filename_string_numbers_of_characters,
-			 value_32bit );
-		}
-		else if( ( io_handle->format_version == 23 )
-		      || ( io_handle->format_version == 26 )
-		      || ( io_handle->format_version == 30 ) )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (scca_file_metrics_array_entry_v23_t *) data )->filename_string_numbers_of_characters,
-			 value_32bit );
-		}
 		libcnotify_printf(
 		 "%s: filename string number of characters\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 file_metrics_values->filename_string_numbers_of_characters[ 0 ] );
 
 		libcnotify_printf(
 		 "%s: flags\t\t\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 internal_file_metrics->flags );
+		 file_metrics_values->flags[ 0 ] );
 
-		if( internal_file_metrics->file_reference_is_set != 0 )
+		if( file_metrics_values->has_file_references != 0 )
 		{
-			if( internal_file_metrics->file_reference == 0 )
+			if( file_metrics_values->file_references[ 0 ] == 0 )
 			{
 				libcnotify_printf(
 				 "%s: file reference\t\t\t\t: %" PRIu64 "\n",
 				 function,
-				 internal_file_metrics->file_reference );
+				 file_metrics_values->file_references[ 0 ] );
 			}
 			else
 			{
 				libcnotify_printf(
 				 "%s: file reference\t\t\t\t: MFT entry: %" PRIu64 ", sequence: %" PRIu64 "\n",
 				 function,
-				 internal_file_metrics->file_reference & 0xffffffffffffUL,
-				 internal_file_metrics->file_reference >> 48 );
+				 file_metrics_values->file_references[ 0 ] & 0xffffffffffffUL,
+				 file_metrics_values->file_references[ 0 ] >> 48 );
 			}
 		}
 		libcnotify_printf(
@@ -392,6 +413,130 @@ int libscca_file_metrics_read_data(
 	return( 1 );
 }
 
+/* Sets the file metrics to reference an entry of the file metrics values
+ * The file metrics values are not managed by the file metrics and must remain
+ * valid for the lifetime of the file metrics
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_set_values(
+     libscca_file_metrics_t *file_metrics,
+     libscca_file_metrics_values_t *file_metrics_values,
+     uint32_t entry_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_t *internal_file_metrics = NULL;
+	static char *function                                  = "libscca_file_metrics_set_values";
+
+	if( file_metrics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
+
+	if( internal_file_metrics->free_file_metrics_values != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file metrics - file metrics values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index >= file_metrics_values->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_metrics->file_metrics_values = file_metrics_values;
+	internal_file_metrics->entry_index         = entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the filename index
+ * The filename index is resolved from the filename string offset if this was not done before
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libscca_internal_file_metrics_get_filename_index(
+     libscca_internal_file_metrics_t *internal_file_metrics,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_file_metrics_get_filename_index";
+	int result            = 0;
+
+	if( internal_file_metrics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_file_metrics_values_resolve_filename_index(
+	          internal_file_metrics->file_metrics_values,
+	          internal_file_metrics->filename_strings,
+	          internal_file_metrics->entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve filename index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*filename_index = internal_file_metrics->file_metrics_values->filename_indexes[ internal_file_metrics->entry_index ];
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 encoded filename
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -418,9 +563,8 @@ int libscca_file_metrics_get_utf8_filename_size(
 	}
 	internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
 
-	if( libscca_filename_strings_get_index_by_offset(
-	     internal_file_metrics->filename_strings,
-	     internal_file_metrics->filename_string_offset,
+	if( libscca_internal_file_metrics_get_filename_index(
+	     internal_file_metrics,
 	     &filename_index,
 	     error ) != 1 )
 	{
@@ -428,9 +572,8 @@ int libscca_file_metrics_get_utf8_filename_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index for offset: 0x%08" PRIx32 "",
-		 function,
-		 internal_file_metrics->filename_string_offset );
+		 "%s: unable to retrieve filename index.",
+		 function );
 
 		return( -1 );
 	}
@@ -480,9 +623,8 @@ int libscca_file_metrics_get_utf8_filename(
 	}
 	internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
 
-	if( libscca_filename_strings_get_index_by_offset(
-	     internal_file_metrics->filename_strings,
-	     internal_file_metrics->filename_string_offset,
+	if( libscca_internal_file_metrics_get_filename_index(
+	     internal_file_metrics,
 	     &filename_index,
 	     error ) != 1 )
 	{
@@ -490,9 +632,8 @@ int libscca_file_metrics_get_utf8_filename(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index for offset: 0x%08" PRIx32 "",
-		 function,
-		 internal_file_metrics->filename_string_offset );
+		 "%s: unable to retrieve filename index.",
+		 function );
 
 		return( -1 );
 	}
@@ -542,9 +683,8 @@ int libscca_file_metrics_get_utf16_filename_size(
 	}
 	internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
 
-	if( libscca_filename_strings_get_index_by_offset(
-	     internal_file_metrics->filename_strings,
-	     internal_file_metrics->filename_string_offset,
+	if( libscca_internal_file_metrics_get_filename_index(
+	     internal_file_metrics,
 	     &filename_index,
 	     error ) != 1 )
 	{
@@ -552,9 +692,8 @@ int libscca_file_metrics_get_utf16_filename_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index for offset: 0x%08" PRIx32 "",
-		 function,
-		 internal_file_metrics->filename_string_offset );
+		 "%s: unable to retrieve filename index.",
+		 function );
 
 		return( -1 );
 	}
@@ -604,9 +743,8 @@ int libscca_file_metrics_get_utf16_filename(
 	}
 	internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
 
-	if( libscca_filename_strings_get_index_by_offset(
-	     internal_file_metrics->filename_strings,
-	     internal_file_metrics->filename_string_offset,
+	if( libscca_internal_file_metrics_get_filename_index(
+	     internal_file_metrics,
 	     &filename_index,
 	     error ) != 1 )
 	{
@@ -614,9 +752,8 @@ int libscca_file_metrics_get_utf16_filename(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve index for offset: 0x%08" PRIx32 "",
-		 function,
-		 internal_file_metrics->filename_string_offset );
+		 "%s: unable to retrieve filename index.",
+		 function );
 
 		return( -1 );
 	}
@@ -640,6 +777,69 @@ int libscca_file_metrics_get_utf16_filename(
 	return( 1 );
 }
 
+/* Retrieves the UTF-16 little-endian stream of the filename
+ * The stream references the filename as stored in the file, including the end-of-string character,
+ * no memory is allocated and it remains valid until the file is closed or updated
+ * This is not supported if the filenames are stored front-coded
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_get_utf16_filename_stream(
+     libscca_file_metrics_t *file_metrics,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_t *internal_file_metrics = NULL;
+	static char *function                                  = "libscca_file_metrics_get_utf16_filename_stream";
+	int filename_index                                     = 0;
+
+	if( file_metrics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_metrics = (libscca_internal_file_metrics_t *) file_metrics;
+
+	if( libscca_internal_file_metrics_get_filename_index(
+	     internal_file_metrics,
+	     &filename_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_filename_strings_get_string_data(
+	     internal_file_metrics->filename_strings,
+	     filename_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d data.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the file reference
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -675,11 +875,22 @@ int libscca_file_metrics_get_file_reference(
 
 		return( -1 );
 	}
-	if( internal_file_metrics->file_reference_is_set == 0 )
+	if( internal_file_metrics->file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file metrics - missing file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_metrics->file_metrics_values->has_file_references == 0 )
 	{
 		return( 0 );
 	}
-	*file_reference = internal_file_metrics->file_reference;
+	*file_reference = internal_file_metrics->file_metrics_values->file_references[ internal_file_metrics->entry_index ];
 
 	return( 1 );
 }
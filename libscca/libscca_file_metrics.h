@@ -26,6 +26,7 @@
 #include <types.h>
 
 #include "libscca_extern.h"
+#include "libscca_file_metrics_values.h"
 #include "libscca_filename_strings.h"
 #include "libscca_io_handle.h"
 #include "libscca_libcerror.h"
@@ -39,33 +40,21 @@ typedef struct libscca_internal_file_metrics libscca_internal_file_metrics_t;
 
 struct libscca_internal_file_metrics
 {
-	/* The filename strings
-	 */
-	libscca_filename_strings_t *filename_strings;
-
-	/* The start time
-	 */
-	uint32_t start_time;
-
-	/* The duration
-	 */
-	uint32_t duration;
-
-	/* The filename string offset
+	/* The file metrics values, which contain the values of the entry
 	 */
-	uint32_t filename_string_offset;
+	libscca_file_metrics_values_t *file_metrics_values;
 
-	/* The flags
+	/* The index of the entry in the file metrics values
 	 */
-	uint32_t flags;
+	uint32_t entry_index;
 
-	/* The file reference
+	/* The filename strings
 	 */
-	uint64_t file_reference;
+	libscca_filename_strings_t *filename_strings;
 
-	/* Value to indicate the file reference was set
+	/* Value to indicate the file metrics values are managed by the file metrics
 	 */
-	uint8_t file_reference_is_set;
+	uint8_t free_file_metrics_values;
 };
 
 int libscca_file_metrics_initialize(
@@ -89,6 +78,17 @@ int libscca_file_metrics_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libscca_file_metrics_set_values(
+     libscca_file_metrics_t *file_metrics,
+     libscca_file_metrics_values_t *file_metrics_values,
+     uint32_t entry_index,
+     libcerror_error_t **error );
+
+int libscca_internal_file_metrics_get_filename_index(
+     libscca_internal_file_metrics_t *internal_file_metrics,
+     int *filename_index,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_metrics_get_utf8_filename_size(
      libscca_file_metrics_t *file_metrics,
@@ -115,6 +115,13 @@ int libscca_file_metrics_get_utf16_filename(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_file_metrics_get_utf16_filename_stream(
+     libscca_file_metrics_t *file_metrics,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_file_metrics_get_file_reference(
      libscca_file_metrics_t *file_metrics,
@@ -0,0 +1,546 @@
+/*
+ * File metrics iterator functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_compressed_blocks_stream.h"
+#include "libscca_file.h"
+#include "libscca_file_information.h"
+#include "libscca_file_metrics.h"
+#include "libscca_file_metrics_iterator.h"
+#include "libscca_io_handle.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_libfdata.h"
+#include "libscca_memory.h"
+
+#include "scca_file_metrics_array.h"
+
+/* Creates a file metrics iterator
+ * Make sure the value file_metrics_iterator is referencing, is set to NULL
+ * The file metrics entries are read on demand from the file, which must be open
+ * and must remain open until the file metrics iterator is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_iterator_initialize(
+     libscca_file_metrics_iterator_t **file_metrics_iterator,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_iterator_t *internal_file_metrics_iterator = NULL;
+	libscca_internal_file_t *internal_file                                   = NULL;
+	static char *function                                                    = "libscca_file_metrics_iterator_initialize";
+	size_t entry_data_size                                                   = 0;
+	uint32_t number_of_entries                                               = 0;
+
+	if( file_metrics_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_metrics_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file metrics iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file - missing format layout.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data_size = internal_file->io_handle->format_layout->file_metrics_entry_data_size;
+
+	/* The file metrics array offset was validated by libscca_file_validate_sections
+	 * the number of entries is only validated when the file metrics are read
+	 */
+	if( internal_file->file_metrics_view.offset != 0 )
+	{
+		number_of_entries = internal_file->number_of_file_metrics_entries;
+	}
+	if( ( internal_file->uncompressed_data != NULL )
+	 && ( number_of_entries > 0 ) )
+	{
+		if( ( (size_t) internal_file->file_information->metrics_array_offset > internal_file->uncompressed_data_size )
+		 || ( (size_t) number_of_entries > ( ( internal_file->uncompressed_data_size - internal_file->file_information->metrics_array_offset ) / entry_data_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of file metrics entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file_metrics_iterator = memory_allocate_structure(
+	                                  libscca_internal_file_metrics_iterator_t );
+
+	if( internal_file_metrics_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file metrics iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_file_metrics_iterator,
+	     0,
+	     sizeof( libscca_internal_file_metrics_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file metrics iterator.",
+		 function );
+
+		memory_free(
+		 internal_file_metrics_iterator );
+
+		return( -1 );
+	}
+	if( libscca_file_metrics_initialize(
+	     &( internal_file_metrics_iterator->file_metrics ),
+	     internal_file->filename_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file metrics.",
+		 function );
+
+		memory_free(
+		 internal_file_metrics_iterator );
+
+		return( -1 );
+	}
+	internal_file_metrics_iterator->internal_file     = internal_file;
+	internal_file_metrics_iterator->number_of_entries = number_of_entries;
+	internal_file_metrics_iterator->entry_data_size   = entry_data_size;
+
+	*file_metrics_iterator = (libscca_file_metrics_iterator_t *) internal_file_metrics_iterator;
+
+	return( 1 );
+}
+
+/* Frees a file metrics iterator
+ * File metrics returned by the iterator are no longer valid after it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_iterator_free(
+     libscca_file_metrics_iterator_t **file_metrics_iterator,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_iterator_t *internal_file_metrics_iterator = NULL;
+	static char *function                                                    = "libscca_file_metrics_iterator_free";
+	int result                                                               = 1;
+
+	if( file_metrics_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_metrics_iterator != NULL )
+	{
+		internal_file_metrics_iterator = (libscca_internal_file_metrics_iterator_t *) *file_metrics_iterator;
+		*file_metrics_iterator         = NULL;
+
+		if( libscca_internal_file_metrics_free(
+		     (libscca_internal_file_metrics_t **) &( internal_file_metrics_iterator->file_metrics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file metrics.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_file_metrics_iterator );
+	}
+	return( result );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_iterator_get_number_of_entries(
+     libscca_file_metrics_iterator_t *file_metrics_iterator,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_iterator_t *internal_file_metrics_iterator = NULL;
+	static char *function                                                    = "libscca_file_metrics_iterator_get_number_of_entries";
+
+	if( file_metrics_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_metrics_iterator = (libscca_internal_file_metrics_iterator_t *) file_metrics_iterator;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_metrics_iterator->number_of_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file metrics iterator - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = (int) internal_file_metrics_iterator->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the next file metrics entry
+ * The file metrics entry is a reference to the file metrics stored in the iterator,
+ * it remains valid until the next call to this function or until the iterator is freed
+ * libscca_file_metrics_free only clears the reference
+ * Returns 1 if successful, 0 if no more entries or -1 on error
+ */
+int libscca_file_metrics_iterator_next(
+     libscca_file_metrics_iterator_t *file_metrics_iterator,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_metrics_iterator_t *internal_file_metrics_iterator = NULL;
+	static char *function                                                    = "libscca_file_metrics_iterator_next";
+	int result                                                               = 0;
+
+	if( file_metrics_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_metrics_iterator = (libscca_internal_file_metrics_iterator_t *) file_metrics_iterator;
+
+	if( internal_file_metrics_iterator->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file metrics iterator - missing file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_metrics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_metrics_iterator->entry_index >= internal_file_metrics_iterator->number_of_entries )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_metrics_iterator->internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_internal_file_metrics_iterator_read_entry(
+	          internal_file_metrics_iterator,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file metrics entry: %" PRIu32 ".",
+		 function,
+		 internal_file_metrics_iterator->entry_index );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_metrics_iterator->internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		internal_file_metrics_iterator->entry_index += 1;
+
+		*file_metrics = internal_file_metrics_iterator->file_metrics;
+	}
+	return( result );
+}
+
+/* Reads the current file metrics entry into the file metrics of the iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_file_metrics_iterator_read_entry(
+     libscca_internal_file_metrics_iterator_t *internal_file_metrics_iterator,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	const uint8_t *entry_data              = NULL;
+	static char *function                  = "libscca_internal_file_metrics_iterator_read_entry";
+	ssize_t read_count                     = 0;
+	off64_t file_offset                    = 0;
+	int result                             = 0;
+
+	if( internal_file_metrics_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = internal_file_metrics_iterator->internal_file;
+
+	if( ( internal_file == NULL )
+	 || ( internal_file->file_information == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file metrics iterator - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = (off64_t) internal_file->file_information->metrics_array_offset
+	            + ( (off64_t) internal_file_metrics_iterator->entry_index * internal_file_metrics_iterator->entry_data_size );
+
+	if( internal_file->uncompressed_data != NULL )
+	{
+		/* The bounds of the file metrics array were validated by libscca_file_metrics_iterator_initialize
+		 */
+		entry_data = &( internal_file->uncompressed_data[ file_offset ] );
+	}
+	else if( internal_file->compressed_blocks_list != NULL )
+	{
+		/* An entry that is contained by a single block is referenced in the decompressed block data
+		 */
+		result = libscca_compressed_blocks_stream_get_data_span(
+		          internal_file->compressed_blocks_list,
+		          internal_file->compressed_blocks_cache,
+		          internal_file->file_io_handle,
+		          file_offset,
+		          internal_file_metrics_iterator->entry_data_size,
+		          &( internal_file->io_handle->statistics ),
+		          &entry_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry data span at offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	if( entry_data == NULL )
+	{
+		if( libfdata_stream_seek_offset(
+		     internal_file->uncompressed_data_stream,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek file metrics entry offset: %" PRIi64 ".",
+			 function,
+			 file_offset );
+
+			return( -1 );
+		}
+		read_count = libfdata_stream_read_buffer(
+		              internal_file->uncompressed_data_stream,
+		              (intptr_t *) internal_file->file_io_handle,
+		              internal_file_metrics_iterator->entry_data,
+		              internal_file_metrics_iterator->entry_data_size,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) internal_file_metrics_iterator->entry_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file metrics entry data.",
+			 function );
+
+			return( -1 );
+		}
+		entry_data = internal_file_metrics_iterator->entry_data;
+	}
+	if( libscca_file_metrics_read_data(
+	     internal_file_metrics_iterator->file_metrics,
+	     internal_file->io_handle,
+	     entry_data,
+	     internal_file_metrics_iterator->entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file metrics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,103 @@
+/*
+ * File metrics iterator functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FILE_METRICS_ITERATOR_H )
+#define _LIBSCCA_FILE_METRICS_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_file.h"
+#include "libscca_file_metrics.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#include "scca_file_metrics_array.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_internal_file_metrics_iterator libscca_internal_file_metrics_iterator_t;
+
+struct libscca_internal_file_metrics_iterator
+{
+	/* The file
+	 */
+	libscca_internal_file_t *internal_file;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The index of the next entry
+	 */
+	uint32_t entry_index;
+
+	/* The entry data size
+	 */
+	size_t entry_data_size;
+
+	/* The entry data
+	 * Holds the data of the current entry if the file was not opened from memory
+	 */
+	uint8_t entry_data[ sizeof( scca_file_metrics_array_entry_v23_t ) ];
+
+	/* The file metrics of the current entry
+	 * Reused for every entry
+	 */
+	libscca_file_metrics_t *file_metrics;
+};
+
+LIBSCCA_EXTERN \
+int libscca_file_metrics_iterator_initialize(
+     libscca_file_metrics_iterator_t **file_metrics_iterator,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_metrics_iterator_free(
+     libscca_file_metrics_iterator_t **file_metrics_iterator,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_metrics_iterator_get_number_of_entries(
+     libscca_file_metrics_iterator_t *file_metrics_iterator,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_file_metrics_iterator_next(
+     libscca_file_metrics_iterator_t *file_metrics_iterator,
+     libscca_file_metrics_t **file_metrics,
+     libcerror_error_t **error );
+
+int libscca_internal_file_metrics_iterator_read_entry(
+     libscca_internal_file_metrics_iterator_t *internal_file_metrics_iterator,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FILE_METRICS_ITERATOR_H ) */
+
@@ -0,0 +1,962 @@
+/*
+ * File metrics values functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_file_metrics_values.h"
+#include "libscca_filename_strings.h"
+#include "libscca_format_layout.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+
+#include "scca_file_metrics_array.h"
+
+/* Creates file metrics values
+ * Make sure the value file_metrics_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_initialize(
+     libscca_file_metrics_values_t **file_metrics_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_metrics_values_initialize";
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_metrics_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file metrics values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_metrics_values = memory_allocate_structure(
+	                        libscca_file_metrics_values_t );
+
+	if( *file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file metrics values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_metrics_values,
+	     0,
+	     sizeof( libscca_file_metrics_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file metrics values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_metrics_values != NULL )
+	{
+		memory_free(
+		 *file_metrics_values );
+
+		*file_metrics_values = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees file metrics values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_free(
+     libscca_file_metrics_values_t **file_metrics_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_metrics_values_free";
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_metrics_values != NULL )
+	{
+		if( ( *file_metrics_values )->values_data != NULL )
+		{
+			memory_free(
+			 ( *file_metrics_values )->values_data );
+		}
+		memory_free(
+		 *file_metrics_values );
+
+		*file_metrics_values = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the file metrics values to contain at least the number of entries
+ * The values are stored in a single allocation, where the 64-bit file references
+ * precede the 32-bit values and filename indexes to keep all the arrays aligned
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_resize(
+     libscca_file_metrics_values_t *file_metrics_values,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	uint8_t *values_data  = NULL;
+	static char *function = "libscca_file_metrics_values_resize";
+	size_t entry_size     = LIBSCCA_FILE_METRICS_VALUES_ENTRY_SIZE;
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / entry_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries > file_metrics_values->number_of_allocated_entries )
+	{
+		values_data = (uint8_t *) memory_allocate(
+		                           entry_size * number_of_entries );
+
+		if( values_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create values data.",
+			 function );
+
+			return( -1 );
+		}
+		if( file_metrics_values->values_data != NULL )
+		{
+			memory_free(
+			 file_metrics_values->values_data );
+		}
+		file_metrics_values->values_data                           = values_data;
+		file_metrics_values->number_of_allocated_entries           = number_of_entries;
+		file_metrics_values->file_references                       = (uint64_t *) values_data;
+		file_metrics_values->start_times                           = (uint32_t *) &( file_metrics_values->file_references[ number_of_entries ] );
+		file_metrics_values->durations                             = &( file_metrics_values->start_times[ number_of_entries ] );
+		file_metrics_values->filename_string_offsets               = &( file_metrics_values->durations[ number_of_entries ] );
+		file_metrics_values->filename_string_numbers_of_characters = &( file_metrics_values->filename_string_offsets[ number_of_entries ] );
+		file_metrics_values->flags                                 = &( file_metrics_values->filename_string_numbers_of_characters[ number_of_entries ] );
+		file_metrics_values->filename_indexes                      = (int *) &( file_metrics_values->flags[ number_of_entries ] );
+	}
+	file_metrics_values->number_of_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Clears the file metrics values
+ * The allocated values data is retained to be reused when the values are read again
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_clear(
+     libscca_file_metrics_values_t *file_metrics_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_metrics_values_clear";
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	file_metrics_values->number_of_entries   = 0;
+	file_metrics_values->has_file_references = 0;
+
+	return( 1 );
+}
+
+/* Reads the format version 17 file metrics array entries
+ * The data is expected to contain the number of 20 byte entries and
+ * the file metrics values are expected to contain the number of entries
+ */
+void libscca_file_metrics_values_read_v17_entries_data(
+      libscca_file_metrics_values_t *file_metrics_values,
+      const uint8_t *data,
+      uint32_t number_of_entries )
+{
+	uint32_t entry_index = 0;
+
+#if defined( LIBSCCA_HAVE_LITTLE_ENDIAN_HOST )
+	uint32_t entry_values[ 5 ];
+#endif
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+#if defined( LIBSCCA_HAVE_LITTLE_ENDIAN_HOST )
+		/* Load the whole entry at once, which the compiler turns into vector loads
+		 */
+		memory_copy(
+		 entry_values,
+		 data,
+		 sizeof( scca_file_metrics_array_entry_v17_t ) );
+
+		file_metrics_values->start_times[ entry_index ]                           = entry_values[ 0 ];
+		file_metrics_values->durations[ entry_index ]                             = entry_values[ 1 ];
+		file_metrics_values->filename_string_offsets[ entry_index ]               = entry_values[ 2 ];
+		file_metrics_values->filename_string_numbers_of_characters[ entry_index ] = entry_values[ 3 ];
+		file_metrics_values->flags[ entry_index ]                                 = entry_values[ 4 ];
+#else
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) data )->start_time,
+		 file_metrics_values->start_times[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) data )->duration,
+		 file_metrics_values->durations[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) data )->filename_string_offset,
+		 file_metrics_values->filename_string_offsets[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) data )->filename_string_numbers_of_characters,
+		 file_metrics_values->filename_string_numbers_of_characters[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v17_t *) data )->flags,
+		 file_metrics_values->flags[ entry_index ] );
+#endif
+		file_metrics_values->file_references[ entry_index ]  = 0;
+		file_metrics_values->filename_indexes[ entry_index ] = -1;
+
+		data += sizeof( scca_file_metrics_array_entry_v17_t );
+	}
+	file_metrics_values->has_file_references = 0;
+}
+
+/* Reads the format version 23, 26 and 30 file metrics array entries
+ * The data is expected to contain the number of 32 byte entries and
+ * the file metrics values are expected to contain the number of entries
+ */
+void libscca_file_metrics_values_read_v23_entries_data(
+      libscca_file_metrics_values_t *file_metrics_values,
+      const uint8_t *data,
+      uint32_t number_of_entries )
+{
+	uint32_t entry_index = 0;
+
+#if defined( LIBSCCA_HAVE_LITTLE_ENDIAN_HOST )
+	uint32_t entry_values[ 8 ];
+#endif
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+#if defined( LIBSCCA_HAVE_LITTLE_ENDIAN_HOST )
+		/* Load the whole entry at once, which the compiler turns into vector loads
+		 */
+		memory_copy(
+		 entry_values,
+		 data,
+		 sizeof( scca_file_metrics_array_entry_v23_t ) );
+
+		file_metrics_values->start_times[ entry_index ]                           = entry_values[ 0 ];
+		file_metrics_values->durations[ entry_index ]                             = entry_values[ 1 ];
+		file_metrics_values->filename_string_offsets[ entry_index ]               = entry_values[ 3 ];
+		file_metrics_values->filename_string_numbers_of_characters[ entry_index ] = entry_values[ 4 ];
+		file_metrics_values->flags[ entry_index ]                                 = entry_values[ 5 ];
+		file_metrics_values->file_references[ entry_index ]                       = ( (uint64_t) entry_values[ 7 ] << 32 )
+		                                                                          | entry_values[ 6 ];
+#else
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) data )->start_time,
+		 file_metrics_values->start_times[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) data )->duration,
+		 file_metrics_values->durations[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) data )->filename_string_offset,
+		 file_metrics_values->filename_string_offsets[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) data )->filename_string_numbers_of_characters,
+		 file_metrics_values->filename_string_numbers_of_characters[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) data )->flags,
+		 file_metrics_values->flags[ entry_index ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) data )->file_reference,
+		 file_metrics_values->file_references[ entry_index ] );
+#endif
+		file_metrics_values->filename_indexes[ entry_index ] = -1;
+
+		data += sizeof( scca_file_metrics_array_entry_v23_t );
+	}
+	file_metrics_values->has_file_references = 1;
+}
+
+/* Reads the file metrics array data into the file metrics values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_read_data(
+     libscca_file_metrics_values_t *file_metrics_values,
+     const libscca_format_layout_t *format_layout,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_metrics_values_read_data";
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format_layout->file_metrics_entry_data_size != sizeof( scca_file_metrics_array_entry_v17_t ) )
+	 && ( format_layout->file_metrics_entry_data_size != sizeof( scca_file_metrics_array_entry_v23_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format layout - file metrics entry data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( (size_t) number_of_entries > ( data_size / format_layout->file_metrics_entry_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_metrics_values_resize(
+	     file_metrics_values,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_layout->file_metrics_entry_data_size == sizeof( scca_file_metrics_array_entry_v17_t ) )
+	{
+		libscca_file_metrics_values_read_v17_entries_data(
+		 file_metrics_values,
+		 data,
+		 number_of_entries );
+	}
+	else
+	{
+		libscca_file_metrics_values_read_v23_entries_data(
+		 file_metrics_values,
+		 data,
+		 number_of_entries );
+	}
+	return( 1 );
+}
+
+/* Resolves the filename index of a specific entry from its filename string offset
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libscca_file_metrics_values_resolve_filename_index(
+     libscca_file_metrics_values_t *file_metrics_values,
+     libscca_filename_strings_t *filename_strings,
+     uint32_t entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_metrics_values_resolve_filename_index";
+	int filename_index    = 0;
+	int result            = 0;
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index >= file_metrics_values->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_metrics_values->filename_indexes[ entry_index ] != -1 )
+	{
+		return( 1 );
+	}
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          file_metrics_values->filename_string_offsets[ entry_index ],
+	          &filename_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index for offset: 0x%08" PRIx32 "",
+		 function,
+		 file_metrics_values->filename_string_offsets[ entry_index ] );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		file_metrics_values->filename_indexes[ entry_index ] = filename_index;
+	}
+	return( result );
+}
+
+/* Resolves the filename indexes of all entries
+ * Filename indexes that were resolved before are resolved again
+ * since the filename strings could have been read again
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_resolve_filename_indexes(
+     libscca_file_metrics_values_t *file_metrics_values,
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_file_metrics_values_resolve_filename_indexes";
+	uint32_t entry_index  = 0;
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < file_metrics_values->number_of_entries;
+	     entry_index++ )
+	{
+		file_metrics_values->filename_indexes[ entry_index ] = -1;
+
+		if( libscca_file_metrics_values_resolve_filename_index(
+		     file_metrics_values,
+		     filename_strings,
+		     entry_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve entry: %" PRIu32 " filename index.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sorts the entry indexes by start time
+ * The entries are sorted by a stable least significant byte first radix sort,
+ * hence entries with the same start time remain ordered by entry index
+ * The entry indexes and scratch entry indexes must contain number of entries values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_sort_by_start_time(
+     libscca_file_metrics_values_t *file_metrics_values,
+     int *entry_indexes,
+     int *scratch_entry_indexes,
+     libcerror_error_t **error )
+{
+	uint32_t byte_counts[ 256 ];
+
+	static char *function    = "libscca_file_metrics_values_sort_by_start_time";
+	int *destination_indexes = NULL;
+	int *source_indexes      = NULL;
+	int *swap_indexes        = NULL;
+	uint32_t byte_offset     = 0;
+	uint32_t byte_value      = 0;
+	uint32_t entry_index     = 0;
+	uint32_t number_of_bytes = 0;
+	uint8_t bit_shift        = 0;
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_metrics_values->number_of_entries > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file metrics values - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < file_metrics_values->number_of_entries;
+	     entry_index++ )
+	{
+		entry_indexes[ entry_index ] = (int) entry_index;
+	}
+	if( file_metrics_values->number_of_entries < 2 )
+	{
+		return( 1 );
+	}
+	source_indexes      = entry_indexes;
+	destination_indexes = scratch_entry_indexes;
+
+	for( bit_shift = 0;
+	     bit_shift < 32;
+	     bit_shift += 8 )
+	{
+		if( memory_set(
+		     byte_counts,
+		     0,
+		     sizeof( uint32_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear byte counts.",
+			 function );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < file_metrics_values->number_of_entries;
+		     entry_index++ )
+		{
+			byte_value = ( file_metrics_values->start_times[ entry_index ] >> bit_shift ) & 0x000000ffUL;
+
+			byte_counts[ byte_value ] += 1;
+		}
+		/* A pass in which all start times have the same byte value does not change the order
+		 */
+		byte_value = ( file_metrics_values->start_times[ 0 ] >> bit_shift ) & 0x000000ffUL;
+
+		if( byte_counts[ byte_value ] == file_metrics_values->number_of_entries )
+		{
+			continue;
+		}
+		byte_offset = 0;
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			number_of_bytes           = byte_counts[ byte_value ];
+			byte_counts[ byte_value ] = byte_offset;
+			byte_offset              += number_of_bytes;
+		}
+		for( entry_index = 0;
+		     entry_index < file_metrics_values->number_of_entries;
+		     entry_index++ )
+		{
+			byte_value = ( file_metrics_values->start_times[ source_indexes[ entry_index ] ] >> bit_shift ) & 0x000000ffUL;
+
+			destination_indexes[ byte_counts[ byte_value ] ] = source_indexes[ entry_index ];
+
+			byte_counts[ byte_value ] += 1;
+		}
+		swap_indexes        = source_indexes;
+		source_indexes      = destination_indexes;
+		destination_indexes = swap_indexes;
+	}
+	if( source_indexes != entry_indexes )
+	{
+		if( memory_copy(
+		     entry_indexes,
+		     source_indexes,
+		     sizeof( int ) * file_metrics_values->number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry indexes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the hash table that maps the case folded hashes of the filenames to the entries
+ * The hash table contains the entry index + 1 or 0 if the hash table entry is not used
+ * The hash table size must be a power of 2 and greater than the number of entries
+ * Entries without a filename index are not added
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_file_metrics_values_build_filename_hash_table(
+     libscca_file_metrics_values_t *file_metrics_values,
+     const uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     uint32_t *hash_table,
+     uint32_t hash_table_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_file_metrics_values_build_filename_hash_table";
+	uint32_t entry_index      = 0;
+	uint32_t hash_table_index = 0;
+	int filename_index        = 0;
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( case_folded_hashes == NULL )
+	 && ( number_of_case_folded_hashes != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_table_size <= file_metrics_values->number_of_entries )
+	 || ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hash table size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entries are added in order of entry index, hence entries with the same
+	 * case folded hash are found in order of entry index when probing
+	 */
+	for( entry_index = 0;
+	     entry_index < file_metrics_values->number_of_entries;
+	     entry_index++ )
+	{
+		filename_index = file_metrics_values->filename_indexes[ entry_index ];
+
+		if( ( filename_index < 0 )
+		 || ( filename_index >= number_of_case_folded_hashes ) )
+		{
+			continue;
+		}
+		hash_table_index = (uint32_t) case_folded_hashes[ filename_index ] & ( hash_table_size - 1 );
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+		}
+		hash_table[ hash_table_index ] = entry_index + 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the first entry at or after a specific entry index
+ * of which the filename has a specific case folded hash
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libscca_file_metrics_values_get_entry_index_by_filename_hash(
+     libscca_file_metrics_values_t *file_metrics_values,
+     const uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     const uint32_t *hash_table,
+     uint32_t hash_table_size,
+     uint32_t first_entry_index,
+     uint64_t case_folded_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_file_metrics_values_get_entry_index_by_filename_hash";
+	uint32_t hash_table_index = 0;
+	uint32_t safe_entry_index = 0;
+	int filename_index        = 0;
+
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( case_folded_hashes == NULL )
+	 && ( number_of_case_folded_hashes != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_table_size <= file_metrics_values->number_of_entries )
+	 || ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hash table size.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_index = (uint32_t) case_folded_hash & ( hash_table_size - 1 );
+
+	/* The hash table is larger than the number of entries hence it always contains an unused entry
+	 */
+	while( hash_table[ hash_table_index ] != 0 )
+	{
+		safe_entry_index = hash_table[ hash_table_index ] - 1;
+
+		if( ( safe_entry_index >= first_entry_index )
+		 && ( safe_entry_index < file_metrics_values->number_of_entries ) )
+		{
+			filename_index = file_metrics_values->filename_indexes[ safe_entry_index ];
+
+			if( ( filename_index >= 0 )
+			 && ( filename_index < number_of_case_folded_hashes )
+			 && ( case_folded_hashes[ filename_index ] == case_folded_hash ) )
+			{
+				*entry_index = (int) safe_entry_index;
+
+				return( 1 );
+			}
+		}
+		hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,170 @@
+/*
+ * File metrics values functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FILE_METRICS_VALUES_H )
+#define _LIBSCCA_FILE_METRICS_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_byte_stream.h"
+#include "libscca_filename_strings.h"
+#include "libscca_format_layout.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the values of a single entry
+ */
+#define LIBSCCA_FILE_METRICS_VALUES_ENTRY_SIZE \
+	( sizeof( uint64_t ) + ( 5 * sizeof( uint32_t ) ) + sizeof( int ) )
+
+typedef struct libscca_file_metrics_values libscca_file_metrics_values_t;
+
+/* The values of the file metrics array entries stored as a structure of arrays
+ */
+struct libscca_file_metrics_values
+{
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	uint32_t number_of_allocated_entries;
+
+	/* The values data, which contains all the arrays
+	 */
+	uint8_t *values_data;
+
+	/* The file references
+	 */
+	uint64_t *file_references;
+
+	/* Value to indicate the file references were set
+	 */
+	uint8_t has_file_references;
+
+	/* The start times
+	 */
+	uint32_t *start_times;
+
+	/* The durations
+	 */
+	uint32_t *durations;
+
+	/* The filename string offsets
+	 */
+	uint32_t *filename_string_offsets;
+
+	/* The filename string number of characters
+	 */
+	uint32_t *filename_string_numbers_of_characters;
+
+	/* The flags
+	 */
+	uint32_t *flags;
+
+	/* The filename indexes
+	 * Contains -1 if the filename string offset has not been resolved
+	 */
+	int *filename_indexes;
+};
+
+int libscca_file_metrics_values_initialize(
+     libscca_file_metrics_values_t **file_metrics_values,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_free(
+     libscca_file_metrics_values_t **file_metrics_values,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_resize(
+     libscca_file_metrics_values_t *file_metrics_values,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_clear(
+     libscca_file_metrics_values_t *file_metrics_values,
+     libcerror_error_t **error );
+
+void libscca_file_metrics_values_read_v17_entries_data(
+      libscca_file_metrics_values_t *file_metrics_values,
+      const uint8_t *data,
+      uint32_t number_of_entries );
+
+void libscca_file_metrics_values_read_v23_entries_data(
+      libscca_file_metrics_values_t *file_metrics_values,
+      const uint8_t *data,
+      uint32_t number_of_entries );
+
+int libscca_file_metrics_values_read_data(
+     libscca_file_metrics_values_t *file_metrics_values,
+     const libscca_format_layout_t *format_layout,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_resolve_filename_index(
+     libscca_file_metrics_values_t *file_metrics_values,
+     libscca_filename_strings_t *filename_strings,
+     uint32_t entry_index,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_resolve_filename_indexes(
+     libscca_file_metrics_values_t *file_metrics_values,
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_sort_by_start_time(
+     libscca_file_metrics_values_t *file_metrics_values,
+     int *entry_indexes,
+     int *scratch_entry_indexes,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_build_filename_hash_table(
+     libscca_file_metrics_values_t *file_metrics_values,
+     const uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     uint32_t *hash_table,
+     uint32_t hash_table_size,
+     libcerror_error_t **error );
+
+int libscca_file_metrics_values_get_entry_index_by_filename_hash(
+     libscca_file_metrics_values_t *file_metrics_values,
+     const uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     const uint32_t *hash_table,
+     uint32_t hash_table_size,
+     uint32_t first_entry_index,
+     uint64_t case_folded_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FILE_METRICS_VALUES_H ) */
+
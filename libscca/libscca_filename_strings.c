@@ -19,48 +19,25 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libscca_bloom_filter.h"
 #include "libscca_definitions.h"
 #include "libscca_filename_strings.h"
+#include "libscca_front_coded_strings.h"
 #include "libscca_libbfio.h"
-#include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
-
-/* Frees a filename string offset
- * Returns 1 if successful or -1 on error
- */
-int libscca_filename_string_offset_free(
-     uint32_t **filename_string_offset,
-     libcerror_error_t **error )
-{
-	static char *function = "libscca_filename_string_offset_free";
-
-	if( filename_string_offset == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename string offset.",
-		 function );
-
-		return( -1 );
-	}
-	if( *filename_string_offset != NULL )
-	{
-		memory_free(
-		 *filename_string_offset );
-
-		*filename_string_offset = NULL;
-	}
-	return( 1 );
-}
+#include "libscca_libuna.h"
+#include "libscca_memory.h"
+#include "libscca_string_pool.h"
+#include "libscca_upcase.h"
+#include "libscca_utf16_stream.h"
 
 /* Creates filename strings
  * Make sure the value filename_strings is referencing, is set to NULL
@@ -127,20 +104,6 @@ int libscca_filename_strings_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *filename_strings )->offsets_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create offsets array.",
-		 function );
-
-		goto on_error;
-	}
 	if( libfvalue_value_type_initialize(
 	     &( ( *filename_strings )->strings ),
 	     LIBFVALUE_VALUE_TYPE_STRING_UTF16,
@@ -160,13 +123,6 @@ int libscca_filename_strings_initialize(
 on_error:
 	if( *filename_strings != NULL )
 	{
-		if( ( *filename_strings )->offsets_array != NULL )
-		{
-			libcdata_array_free(
-			 &( ( *filename_strings )->offsets_array ),
-			 NULL,
-			 NULL );
-		}
 		memory_free(
 		 *filename_strings );
 
@@ -198,20 +154,54 @@ int libscca_filename_strings_free(
 	}
 	if( *filename_strings != NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *filename_strings )->offsets_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_filename_string_offset_free,
+		if( ( *filename_strings )->offsets != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->offsets );
+		}
+		if( ( *filename_strings )->utf8_string_offsets != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->utf8_string_offsets );
+		}
+		if( ( *filename_strings )->utf8_strings != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->utf8_strings );
+		}
+		if( libscca_front_coded_strings_free(
+		     &( ( *filename_strings )->front_coded_strings ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free offsets array.",
+			 "%s: unable to free front-coded strings.",
 			 function );
 
 			result = -1;
 		}
+		if( ( *filename_strings )->string_identifiers != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->string_identifiers );
+		}
+		if( ( *filename_strings )->case_folded_hashes != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->case_folded_hashes );
+		}
+		if( ( *filename_strings )->bloom_filter != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->bloom_filter );
+		}
+		if( ( *filename_strings )->mount_point_indexes != NULL )
+		{
+			memory_free(
+			 ( *filename_strings )->mount_point_indexes );
+		}
 		if( libfvalue_value_free(
 		     &( ( *filename_strings )->strings ),
 		     error ) != 1 )
@@ -254,20 +244,74 @@ int libscca_filename_strings_clear(
 
 		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     filename_strings->offsets_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_filename_string_offset_free,
+	if( filename_strings->offsets != NULL )
+	{
+		memory_free(
+		 filename_strings->offsets );
+
+		filename_strings->offsets = NULL;
+	}
+	filename_strings->number_of_offsets = 0;
+
+	if( filename_strings->utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 filename_strings->utf8_string_offsets );
+
+		filename_strings->utf8_string_offsets = NULL;
+	}
+	if( filename_strings->utf8_strings != NULL )
+	{
+		memory_free(
+		 filename_strings->utf8_strings );
+
+		filename_strings->utf8_strings = NULL;
+	}
+	filename_strings->utf8_strings_size = 0;
+
+	if( libscca_front_coded_strings_free(
+	     &( filename_strings->front_coded_strings ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty offsets array.",
+		 "%s: unable to free front-coded strings.",
 		 function );
 
 		result = -1;
 	}
+	if( filename_strings->string_identifiers != NULL )
+	{
+		memory_free(
+		 filename_strings->string_identifiers );
+
+		filename_strings->string_identifiers = NULL;
+	}
+	if( filename_strings->case_folded_hashes != NULL )
+	{
+		memory_free(
+		 filename_strings->case_folded_hashes );
+
+		filename_strings->case_folded_hashes = NULL;
+	}
+	if( filename_strings->bloom_filter != NULL )
+	{
+		memory_free(
+		 filename_strings->bloom_filter );
+
+		filename_strings->bloom_filter = NULL;
+	}
+	filename_strings->bloom_filter_size = 0;
+
+	if( filename_strings->mount_point_indexes != NULL )
+	{
+		memory_free(
+		 filename_strings->mount_point_indexes );
+
+		filename_strings->mount_point_indexes = NULL;
+	}
 	if( libfvalue_value_clear(
 	     filename_strings->strings,
 	     error ) != 1 )
@@ -293,12 +337,13 @@ int libscca_filename_strings_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	uint32_t *filename_string_offset = NULL;
-	static char *function            = "libscca_filename_strings_read_data";
-	ssize_t data_offset              = 0;
-	ssize_t last_data_offset         = 0;
-	int entry_index                  = 0;
-	int filename_strings_index       = 0;
+	static char *function      = "libscca_filename_strings_read_data";
+	size_t string_data_offset  = 0;
+	size_t string_data_size    = 0;
+	int entry_index            = 0;
+	int filename_strings_index = 0;
+	int number_of_offsets      = 0;
+	int result                 = 0;
 
 	if( filename_strings == NULL )
 	{
@@ -333,49 +378,216 @@ int libscca_filename_strings_read_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     filename_strings->offsets_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_filename_string_offset_free,
+	if( filename_strings->offsets != NULL )
+	{
+		memory_free(
+		 filename_strings->offsets );
+
+		filename_strings->offsets = NULL;
+	}
+	filename_strings->number_of_offsets = 0;
+
+	if( filename_strings->string_identifiers != NULL )
+	{
+		memory_free(
+		 filename_strings->string_identifiers );
+
+		filename_strings->string_identifiers = NULL;
+	}
+	if( filename_strings->case_folded_hashes != NULL )
+	{
+		memory_free(
+		 filename_strings->case_folded_hashes );
+
+		filename_strings->case_folded_hashes = NULL;
+	}
+	if( filename_strings->bloom_filter != NULL )
+	{
+		memory_free(
+		 filename_strings->bloom_filter );
+
+		filename_strings->bloom_filter = NULL;
+	}
+	filename_strings->bloom_filter_size = 0;
+
+	if( filename_strings->mount_point_indexes != NULL )
+	{
+		memory_free(
+		 filename_strings->mount_point_indexes );
+
+		filename_strings->mount_point_indexes = NULL;
+	}
+	if( libscca_front_coded_strings_free(
+	     &( filename_strings->front_coded_strings ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty offsets array.",
+		 "%s: unable to free front-coded strings.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the number of strings so that the offsets can be stored in a single allocation
+	 */
+	if( libscca_utf16_stream_get_string_offsets(
+	     data,
+	     data_size,
+	     NULL,
+	     0,
+	     &number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of filename strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_offsets > ( LIBSCCA_MAXIMUM_NUMBER_OF_FILENAME_STRINGS + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filename strings value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_offsets == 0 )
+	{
+		return( 1 );
+	}
+	filename_strings->offsets = (uint32_t *) memory_allocate(
+	                                          sizeof( uint32_t ) * number_of_offsets );
+
+	if( filename_strings->offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_utf16_stream_get_string_offsets(
+	     data,
+	     data_size,
+	     filename_strings->offsets,
+	     number_of_offsets,
+	     &number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine filename string offsets.",
+		 function );
+
+		goto on_error;
+	}
+	filename_strings->number_of_offsets = number_of_offsets;
+
+	filename_strings->case_folded_hashes = (uint64_t *) memory_allocate(
+	                                                     sizeof( uint64_t ) * number_of_offsets );
+
+	if( filename_strings->case_folded_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create case folded hashes.",
 		 function );
 
 		goto on_error;
 	}
-	while( (size_t) last_data_offset < data_size )
+	if( filename_strings->string_pool != NULL )
 	{
-		if( filename_strings_index > LIBSCCA_MAXIMUM_NUMBER_OF_FILENAME_STRINGS )
+		filename_strings->string_identifiers = (uint32_t *) memory_allocate(
+		                                                     sizeof( uint32_t ) * number_of_offsets );
+
+		if( filename_strings->string_identifiers == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid filename strings index value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string identifiers.",
 			 function );
 
 			goto on_error;
 		}
-		data_offset = libfvalue_value_type_get_string_size(
-			       filename_strings->strings,
-		               &( data[ last_data_offset ] ),
-		               data_size - last_data_offset,
-			       error );
-
-		if( data_offset == -1 )
+	}
+	else
+	{
+		if( filename_strings->use_front_coding != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to determine data string size.",
-			 function );
+			result = libscca_filename_strings_read_front_coded_strings(
+			          filename_strings,
+			          data,
+			          data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to read front-coded strings.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The filename strings data is copied into the strings value in a single allocation
+		 * and the strings are added as entries referencing that data, since appending
+		 * the data of every string separately reallocates the strings value data each time
+		 */
+		if( filename_strings->front_coded_strings == NULL )
+		{
+			if( libfvalue_value_set_data(
+			     filename_strings->strings,
+			     data,
+			     data_size,
+			     LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+			     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set filename strings value data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	for( filename_strings_index = 0;
+	     filename_strings_index < number_of_offsets;
+	     filename_strings_index++ )
+	{
+		string_data_offset = (size_t) filename_strings->offsets[ filename_strings_index ];
 
-			goto on_error;
+		if( ( filename_strings_index + 1 ) < number_of_offsets )
+		{
+			string_data_size = (size_t) filename_strings->offsets[ filename_strings_index + 1 ] - string_data_offset;
+		}
+		else
+		{
+			string_data_size = data_size - string_data_offset;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -384,234 +596,630 @@ int libscca_filename_strings_read_data(
 			 "%s: filename strings entry: %d data offset: 0x%08" PRIzx "\n",
 			 function,
 			 filename_strings_index, 
-			 last_data_offset );
+			 string_data_offset );
 
 			libcnotify_printf(
 			 "%s: filename strings entry: %d data:\n",
 			 function,
 			 filename_strings_index );
 			libcnotify_print_data(
-			 &( data[ last_data_offset ] ),
-			 (size_t) data_offset,
+			 &( data[ string_data_offset ] ),
+			 string_data_size,
 			 0 );
 		}
 #endif
-		filename_string_offset = (uint32_t *) memory_allocate(
-		                                       sizeof( uint32_t ) );
-
-		if( filename_string_offset == NULL )
+		if( libscca_upcase_calculate_hash_utf16_stream(
+		     &( data[ string_data_offset ] ),
+		     string_data_size,
+		     &( filename_strings->case_folded_hashes[ filename_strings_index ] ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create filename string offset.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate case folded hash of filename strings: %d.",
+			 function,
+			 filename_strings_index );
 
 			goto on_error;
 		}
-		*filename_string_offset = (uint32_t) last_data_offset;
-
-		if( libcdata_array_append_entry(
-		     filename_strings->offsets_array,
-		     &entry_index,
-		     (intptr_t *) filename_string_offset,
+		if( filename_strings->string_pool != NULL )
+		{
+			if( libscca_string_pool_intern_string(
+			     filename_strings->string_pool,
+			     &( data[ string_data_offset ] ),
+			     string_data_size,
+			     &( filename_strings->string_identifiers[ filename_strings_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to intern filename strings: %d.",
+				 function,
+				 filename_strings_index );
+
+				goto on_error;
+			}
+		}
+		else if( filename_strings->front_coded_strings == NULL )
+		{
+			if( libfvalue_value_append_entry(
+			     filename_strings->strings,
+			     &entry_index,
+			     string_data_offset,
+			     string_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append filename strings: %d value entry.",
+				 function,
+				 filename_strings_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( filename_strings->use_bloom_filter != 0 )
+	{
+		if( libscca_filename_strings_read_bloom_filter(
+		     filename_strings,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append filename strings: %d offset to array.",
-			 function,
-			 filename_strings_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to read Bloom filter.",
+			 function );
 
 			goto on_error;
 		}
-		filename_string_offset = NULL;
-
-		if( libfvalue_value_append_entry_data(
-		     filename_strings->strings,
-		     &entry_index,
-		     &( data[ last_data_offset ] ),
-		     (size_t) data_offset,
-		     LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	}
+	/* Interned filenames are not cached per file since that would store them again
+	 * and front-coded filenames are already stored UTF-8 encoded
+	 */
+	if( ( filename_strings->use_utf8_cache != 0 )
+	 && ( filename_strings->string_pool == NULL )
+	 && ( filename_strings->front_coded_strings == NULL ) )
+	{
+		if( libscca_filename_strings_read_utf8_strings(
+		     filename_strings,
+		     data,
+		     data_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append filename strings: %d value entry data.",
-			 function,
-			 filename_strings_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to read UTF-8 strings.",
+			 function );
 
 			goto on_error;
 		}
-		last_data_offset += data_offset;
-
-		filename_strings_index++;
 	}
 	return( 1 );
 
 on_error:
-	if( filename_string_offset != NULL )
+	if( filename_strings->string_identifiers != NULL )
+	{
+		memory_free(
+		 filename_strings->string_identifiers );
+
+		filename_strings->string_identifiers = NULL;
+	}
+	if( filename_strings->case_folded_hashes != NULL )
+	{
+		memory_free(
+		 filename_strings->case_folded_hashes );
+
+		filename_strings->case_folded_hashes = NULL;
+	}
+	if( filename_strings->bloom_filter != NULL )
+	{
+		memory_free(
+		 filename_strings->bloom_filter );
+
+		filename_strings->bloom_filter = NULL;
+	}
+	filename_strings->bloom_filter_size = 0;
+
+	if( filename_strings->mount_point_indexes != NULL )
 	{
 		memory_free(
-		 filename_string_offset );
+		 filename_strings->mount_point_indexes );
+
+		filename_strings->mount_point_indexes = NULL;
+	}
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		libscca_front_coded_strings_free(
+		 &( filename_strings->front_coded_strings ),
+		 NULL );
+	}
+	if( filename_strings->offsets != NULL )
+	{
+		memory_free(
+		 filename_strings->offsets );
+
+		filename_strings->offsets = NULL;
 	}
-	libcdata_array_empty(
-	 filename_strings->offsets_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_filename_string_offset_free,
-	 NULL );
+	filename_strings->number_of_offsets = 0;
 
 	return( -1 );
 }
 
-/* Reads the filename strings
- * Returns 1 if successful or -1 on error
+/* Visits the filename strings in the data without storing them
+ * The strings are delimited the same way as by libscca_filename_strings_read_data,
+ * but no offsets, hashes or strings are stored and the visit stops at the first string
+ * for which the callback function returns 0
+ * The UTF-16 little-endian stream passed to the callback function references the data
+ * and includes the end-of-string character, except for a last string without one
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all strings were visited, 0 if the visit was stopped or -1 on error
  */
-int libscca_filename_strings_read_stream(
-     libscca_filename_strings_t *filename_strings,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t filename_strings_offset,
-     uint32_t filename_strings_size,
+int libscca_filename_strings_visit_data(
+     const uint8_t *data,
+     size_t data_size,
+     int (*callback_function)(
+            int filename_index,
+            const uint8_t *utf16_stream,
+            size_t utf16_stream_size,
+            void *callback_arguments ),
+     void *callback_arguments,
      libcerror_error_t **error )
 {
-	uint8_t *filename_strings_data = NULL;
-	static char *function          = "libscca_filename_strings_read_stream";
-	ssize_t read_count             = 0;
+	static char *function      = "libscca_filename_strings_visit_data";
+	size_t stream_index        = 0;
+	size_t string_start_offset = 0;
+	int filename_index         = 0;
+	int result                 = 0;
 
-	if( filename_strings == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename strings.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( filename_strings_size == 0 )
-	 || ( filename_strings_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( data_size > (size_t) UINT32_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid filenames string size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading filename strings at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
-		 function,
-		 filename_strings_offset,
-		 filename_strings_offset );
-	}
-#endif
-	if( libfdata_stream_seek_offset(
-	     uncompressed_data_stream,
-	     (off64_t) filename_strings_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek filename strings offset: %" PRIu32 ".",
-		 function,
-		 filename_strings_offset );
-
-		goto on_error;
-	}
-	filename_strings_data = (uint8_t *) memory_allocate(
-	                                     sizeof( uint8_t ) * filename_strings_size );
-
-	if( filename_strings_data == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create filename strings data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libfdata_stream_read_buffer(
-	              uncompressed_data_stream,
-	              (intptr_t *) file_io_handle,
-	              filename_strings_data,
-	              (size_t) filename_strings_size,
-	              0,
-	              error );
+	while( string_start_offset < data_size )
+	{
+		if( filename_index > LIBSCCA_MAXIMUM_NUMBER_OF_FILENAME_STRINGS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of filename strings value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Only the blocks that contain an end of string character are inspected per character
+		 */
+		stream_index = libscca_utf16_stream_scan_end_of_string(
+		                data,
+		                data_size,
+		                string_start_offset );
+
+		while( ( stream_index + 1 ) < data_size )
+		{
+			if( ( data[ stream_index ] == 0 )
+			 && ( data[ stream_index + 1 ] == 0 ) )
+			{
+				break;
+			}
+			stream_index += 2;
+		}
+		if( ( stream_index + 1 ) < data_size )
+		{
+			stream_index += 2;
+		}
+		else
+		{
+			stream_index = data_size;
+		}
+		result = callback_function(
+		          filename_index,
+		          &( data[ string_start_offset ] ),
+		          stream_index - string_start_offset,
+		          callback_arguments );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for filename strings: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		string_start_offset = stream_index;
+
+		filename_index++;
+	}
+	return( 1 );
+}
+
+/* Stores the filename strings front-coded
+ * Consecutive filenames commonly share a directory prefix, which is only stored once per block
+ * If the filename strings cannot be restored exactly from their UTF-8 encoding
+ * no front-coded strings are stored and the filenames are stored in the strings value instead
+ * Returns 1 if successful, 0 if not stored front-coded or -1 on error
+ */
+int libscca_filename_strings_read_front_coded_strings(
+     libscca_filename_strings_t *filename_strings,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_read_front_coded_strings";
+	int result            = 0;
 
-	if( read_count != (ssize_t) filename_strings_size )
+	if( filename_strings == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read filename strings data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libscca_filename_strings_read_data(
-	     filename_strings,
-	     filename_strings_data,
-	     (size_t) filename_strings_size,
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename strings - front-coded strings value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_front_coded_strings_initialize(
+	     &( filename_strings->front_coded_strings ),
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create front-coded strings.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_front_coded_strings_read_utf16_streams(
+	          filename_strings->front_coded_strings,
+	          data,
+	          data_size,
+	          filename_strings->offsets,
+	          filename_strings->number_of_offsets,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read filename strings.",
+		 "%s: unable to read front-coded strings.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libscca_front_coded_strings_free(
+		     &( filename_strings->front_coded_strings ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free front-coded strings.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		libscca_front_coded_strings_free(
+		 &( filename_strings->front_coded_strings ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Converts the filename strings to UTF-8 once, into a single buffer
+ * Strings that only contain ASCII characters are narrowed without libuna
+ * If a string cannot be converted no UTF-8 strings are stored and
+ * the filenames are converted on access instead
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_read_utf8_strings(
+     libscca_filename_strings_t *filename_strings,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *conversion_error = NULL;
+	static char *function               = "libscca_filename_strings_read_utf8_strings";
+	size_t string_data_offset           = 0;
+	size_t string_data_size             = 0;
+	size_t utf8_string_offset           = 0;
+	size_t utf8_string_size             = 0;
+	int filename_strings_index          = 0;
+	int result                          = -1;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 filename_strings->utf8_string_offsets );
+
+		filename_strings->utf8_string_offsets = NULL;
+	}
+	if( filename_strings->utf8_strings != NULL )
+	{
+		memory_free(
+		 filename_strings->utf8_strings );
+
+		filename_strings->utf8_strings = NULL;
+	}
+	filename_strings->utf8_strings_size = 0;
+
+	if( filename_strings->number_of_offsets == 0 )
+	{
+		return( 1 );
+	}
+	filename_strings->utf8_string_offsets = (uint32_t *) memory_allocate(
+	                                                      sizeof( uint32_t ) * ( filename_strings->number_of_offsets + 1 ) );
+
+	if( filename_strings->utf8_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first pass determines the size of the UTF-8 strings
+	 */
+	for( filename_strings_index = 0;
+	     filename_strings_index < filename_strings->number_of_offsets;
+	     filename_strings_index++ )
+	{
+		string_data_offset = (size_t) filename_strings->offsets[ filename_strings_index ];
+
+		if( ( filename_strings_index + 1 ) < filename_strings->number_of_offsets )
+		{
+			string_data_size = (size_t) filename_strings->offsets[ filename_strings_index + 1 ];
+		}
+		else
+		{
+			string_data_size = data_size;
+		}
+		string_data_size -= string_data_offset;
+
+		if( libscca_utf16_stream_get_utf8_string_size(
+		     &( data[ string_data_offset ] ),
+		     string_data_size,
+		     &utf8_string_size,
+		     &conversion_error ) != 1 )
+		{
+			goto on_conversion_error;
+		}
+		if( utf8_string_size > ( (size_t) UINT32_MAX - utf8_string_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 strings size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		filename_strings->utf8_string_offsets[ filename_strings_index ] = (uint32_t) utf8_string_offset;
+
+		utf8_string_offset += utf8_string_size;
+	}
+	filename_strings->utf8_string_offsets[ filename_strings_index ] = (uint32_t) utf8_string_offset;
+
+	if( ( utf8_string_offset == 0 )
+	 || ( utf8_string_offset > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 strings size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	filename_strings->utf8_strings = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * utf8_string_offset );
+
+	if( filename_strings->utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 strings.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 filename_strings_data );
+	filename_strings->utf8_strings_size = utf8_string_offset;
+
+	/* The second pass converts the strings
+	 */
+	for( filename_strings_index = 0;
+	     filename_strings_index < filename_strings->number_of_offsets;
+	     filename_strings_index++ )
+	{
+		string_data_offset = (size_t) filename_strings->offsets[ filename_strings_index ];
+
+		if( ( filename_strings_index + 1 ) < filename_strings->number_of_offsets )
+		{
+			string_data_size = (size_t) filename_strings->offsets[ filename_strings_index + 1 ];
+		}
+		else
+		{
+			string_data_size = data_size;
+		}
+		string_data_size -= string_data_offset;
 
+		utf8_string_offset = (size_t) filename_strings->utf8_string_offsets[ filename_strings_index ];
+		utf8_string_size   = (size_t) filename_strings->utf8_string_offsets[ filename_strings_index + 1 ] - utf8_string_offset;
+
+		if( libscca_utf16_stream_copy_to_utf8_string(
+		     &( data[ string_data_offset ] ),
+		     string_data_size,
+		     &( filename_strings->utf8_strings[ utf8_string_offset ] ),
+		     utf8_string_size,
+		     &conversion_error ) != 1 )
+		{
+			goto on_conversion_error;
+		}
+	}
 	return( 1 );
 
+on_conversion_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: unable to convert filename strings entry: %d to UTF-8 string.\n",
+		 function,
+		 filename_strings_index );
+	}
+#endif
+	libcerror_error_free(
+	 &conversion_error );
+
+	result = 1;
+
 on_error:
-	if( filename_strings_data != NULL )
+	if( filename_strings->utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 filename_strings->utf8_string_offsets );
+
+		filename_strings->utf8_string_offsets = NULL;
+	}
+	if( filename_strings->utf8_strings != NULL )
 	{
 		memory_free(
-		 filename_strings_data );
+		 filename_strings->utf8_strings );
+
+		filename_strings->utf8_strings = NULL;
 	}
-	libcdata_array_empty(
-	 filename_strings->offsets_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_filename_string_offset_free,
-	 NULL );
+	filename_strings->utf8_strings_size = 0;
 
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves the filename index for a specific offset
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Retrieves the UTF-16 little-endian string data of a specific filename
+ * The data is referenced and not copied, an interned filename is retrieved from the string pool
+ * Front-coded filenames are not stored as string data, use
+ * libscca_filename_strings_get_decoded_string_data to retrieve these
+ * Returns 1 if successful or -1 on error
  */
-int libscca_filename_strings_get_index_by_offset(
+int libscca_filename_strings_get_string_data(
      libscca_filename_strings_t *filename_strings,
-     uint32_t filename_offset,
-     int *filename_index,
+     int filename_index,
+     const uint8_t **string_data,
+     size_t *string_data_size,
      libcerror_error_t **error )
 {
-	uint32_t *filename_string_offset = NULL;
-	static char *function            = "libscca_filename_strings_get_index_by_offset";
-	int entry_index                  = 0;
-	int number_of_entries            = 0;
+	uint8_t *entry_data   = NULL;
+	static char *function = "libscca_filename_strings_get_string_data";
+	int encoding          = 0;
 
 	if( filename_strings == NULL )
 	{
@@ -624,208 +1232,2207 @@ int libscca_filename_strings_get_index_by_offset(
 
 		return( -1 );
 	}
-	if( filename_index == NULL )
+	if( string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->string_identifiers != NULL )
+	{
+		if( ( filename_index < 0 )
+		 || ( filename_index >= filename_strings->number_of_offsets ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_string_pool_get_string(
+		     filename_strings->string_pool,
+		     filename_strings->string_identifiers[ filename_index ],
+		     string_data,
+		     string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d from string pool.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported filename strings - string data is stored front-coded.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     filename_strings->strings,
+	     filename_index,
+	     &entry_data,
+	     string_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d data.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	*string_data = entry_data;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian string data of a specific filename
+ * A front-coded filename is decoded into decoded string data, which must be
+ * freed by the caller, otherwise the string data is referenced and decoded string data is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_decoded_string_data(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     uint8_t **decoded_string_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_get_decoded_string_data";
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoded_string_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoded string data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->front_coded_strings == NULL )
+	{
+		if( libscca_filename_strings_get_string_data(
+		     filename_strings,
+		     filename_index,
+		     string_data,
+		     string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libscca_front_coded_strings_get_utf16_stream(
+	     filename_strings->front_coded_strings,
+	     filename_index,
+	     decoded_string_data,
+	     string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode filename: %d.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	*string_data = *decoded_string_data;
+
+	return( 1 );
+}
+
+/* Retrieves the case folded hash of a specific filename
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_case_folded_hash(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     uint64_t *case_folded_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_get_case_folded_hash";
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_index < 0 )
+	 || ( filename_index >= filename_strings->number_of_offsets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded hash.",
+		 function );
+
+		return( -1 );
+	}
+	*case_folded_hash = filename_strings->case_folded_hashes[ filename_index ];
+
+	return( 1 );
+}
+
+/* Copies the case folded hashes of all filenames
+ * The number of case folded hashes must be equal to or greater than the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_copy_case_folded_hashes(
+     libscca_filename_strings_t *filename_strings,
+     uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_copy_case_folded_hashes";
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( case_folded_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid case folded hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_case_folded_hashes < filename_strings->number_of_offsets )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of case folded hashes value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->number_of_offsets == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     case_folded_hashes,
+	     filename_strings->case_folded_hashes,
+	     sizeof( uint64_t ) * filename_strings->number_of_offsets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy case folded hashes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the Bloom filter of the case folded hashes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_read_bloom_filter(
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error )
+{
+	static char *function    = "libscca_filename_strings_read_bloom_filter";
+	size_t bloom_filter_size = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->bloom_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename strings - Bloom filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_bloom_filter_get_size(
+	     filename_strings->number_of_offsets,
+	     &bloom_filter_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine Bloom filter size.",
+		 function );
+
+		goto on_error;
+	}
+	filename_strings->bloom_filter = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * bloom_filter_size );
+
+	if( filename_strings->bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_bloom_filter_build(
+	     filename_strings->bloom_filter,
+	     bloom_filter_size,
+	     LIBSCCA_BLOOM_FILTER_NUMBER_OF_HASHES,
+	     filename_strings->case_folded_hashes,
+	     filename_strings->number_of_offsets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build Bloom filter.",
+		 function );
+
+		goto on_error;
+	}
+	filename_strings->bloom_filter_size = bloom_filter_size;
+
+	return( 1 );
+
+on_error:
+	if( filename_strings->bloom_filter != NULL )
+	{
+		memory_free(
+		 filename_strings->bloom_filter );
+
+		filename_strings->bloom_filter = NULL;
+	}
+	return( -1 );
+}
+
+/* Determines if the filename strings possibly contain a filename with a specific case folded hash
+ * The Bloom filter is used if available otherwise the case folded hashes are compared
+ * Returns 1 if a filename is possibly contained, 0 if not or -1 on error
+ */
+int libscca_filename_strings_may_contain_hash(
+     libscca_filename_strings_t *filename_strings,
+     uint64_t case_folded_hash,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_filename_strings_may_contain_hash";
+	int filename_strings_index = 0;
+	int result                 = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->bloom_filter != NULL )
+	{
+		result = libscca_bloom_filter_contains_hash(
+		          filename_strings->bloom_filter,
+		          filename_strings->bloom_filter_size,
+		          LIBSCCA_BLOOM_FILTER_NUMBER_OF_HASHES,
+		          case_folded_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if Bloom filter contains hash.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	for( filename_strings_index = 0;
+	     filename_strings_index < filename_strings->number_of_offsets;
+	     filename_strings_index++ )
+	{
+		if( filename_strings->case_folded_hashes[ filename_strings_index ] == case_folded_hash )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines the mount point of every filename
+ * The mount point indexes are determined once so that the filenames
+ * do not need to be matched against the device paths on every access
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_read_mount_point_indexes(
+     libscca_filename_strings_t *filename_strings,
+     libscca_mount_points_t *mount_points,
+     libcerror_error_t **error )
+{
+	uint8_t *decoded_string_data = NULL;
+	const uint8_t *string_data   = NULL;
+	static char *function        = "libscca_filename_strings_read_mount_point_indexes";
+	size_t string_data_size      = 0;
+	int filename_index           = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount points.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->mount_point_indexes != NULL )
+	{
+		memory_free(
+		 filename_strings->mount_point_indexes );
+
+		filename_strings->mount_point_indexes = NULL;
+	}
+	if( filename_strings->number_of_offsets == 0 )
+	{
+		return( 1 );
+	}
+	filename_strings->mount_point_indexes = (int *) memory_allocate(
+	                                                 sizeof( int ) * filename_strings->number_of_offsets );
+
+	if( filename_strings->mount_point_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mount point indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < filename_strings->number_of_offsets;
+	     filename_index++ )
+	{
+		if( libscca_filename_strings_get_decoded_string_data(
+		     filename_strings,
+		     filename_index,
+		     &string_data,
+		     &string_data_size,
+		     &decoded_string_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( libscca_mount_points_get_index_by_utf16_stream(
+		     mount_points,
+		     string_data,
+		     string_data_size,
+		     &( filename_strings->mount_point_indexes[ filename_index ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mount point of filename: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( decoded_string_data != NULL )
+		{
+			memory_free(
+			 decoded_string_data );
+
+			decoded_string_data = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( decoded_string_data != NULL )
+	{
+		memory_free(
+		 decoded_string_data );
+	}
+	if( filename_strings->mount_point_indexes != NULL )
+	{
+		memory_free(
+		 filename_strings->mount_point_indexes );
+
+		filename_strings->mount_point_indexes = NULL;
+	}
+	return( -1 );
+}
+
+/* Clears the mount point indexes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_clear_mount_point_indexes(
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_clear_mount_point_indexes";
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->mount_point_indexes != NULL )
+	{
+		memory_free(
+		 filename_strings->mount_point_indexes );
+
+		filename_strings->mount_point_indexes = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded filename, where the device path
+ * is replaced by the path of its mount point
+ * The filename is returned unchanged if it has no mount point or
+ * if the mount point indexes were not determined
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf8_mapped_filename_size(
+     libscca_filename_strings_t *filename_strings,
+     libscca_mount_points_t *mount_points,
+     int filename_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *decoded_string_data = NULL;
+	const uint8_t *mount_point   = NULL;
+	const uint8_t *string_data   = NULL;
+	static char *function        = "libscca_filename_strings_get_utf8_mapped_filename_size";
+	size_t device_path_size      = 0;
+	size_t mount_point_length    = 0;
+	size_t string_data_size      = 0;
+	size_t suffix_size           = 0;
+	int mount_point_index        = -1;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_index < 0 )
+	 || ( filename_index >= filename_strings->number_of_offsets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mount_points != NULL )
+	 && ( filename_strings->mount_point_indexes != NULL ) )
+	{
+		mount_point_index = filename_strings->mount_point_indexes[ filename_index ];
+	}
+	if( mount_point_index == -1 )
+	{
+		if( libscca_filename_strings_get_utf8_filename_size(
+		     filename_strings,
+		     filename_index,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d UTF-8 string size.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libscca_filename_strings_get_decoded_string_data(
+	     filename_strings,
+	     filename_index,
+	     &string_data,
+	     &string_data_size,
+	     &decoded_string_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d string data.",
+		 function,
+		 filename_index );
+
+		goto on_error;
+	}
+	if( libscca_mount_points_get_device_path_size(
+	     mount_points,
+	     mount_point_index,
+	     &device_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mount point: %d device path size.",
+		 function,
+		 mount_point_index );
+
+		goto on_error;
+	}
+	if( device_path_size > string_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount point: %d device path size value out of bounds.",
+		 function,
+		 mount_point_index );
+
+		goto on_error;
+	}
+	if( libscca_mount_points_get_mount_point(
+	     mount_points,
+	     mount_point_index,
+	     &mount_point,
+	     &mount_point_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mount point: %d.",
+		 function,
+		 mount_point_index );
+
+		goto on_error;
+	}
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     &( string_data[ device_path_size ] ),
+	     string_data_size - device_path_size,
+	     &suffix_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d UTF-8 string size.",
+		 function,
+		 filename_index );
+
+		goto on_error;
+	}
+	*utf8_string_size = mount_point_length + suffix_size;
+
+	if( decoded_string_data != NULL )
+	{
+		memory_free(
+		 decoded_string_data );
+	}
+	return( 1 );
+
+on_error:
+	if( decoded_string_data != NULL )
+	{
+		memory_free(
+		 decoded_string_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific UTF-8 encoded filename, where the device path
+ * is replaced by the path of its mount point
+ * The filename is returned unchanged if it has no mount point or
+ * if the mount point indexes were not determined
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf8_mapped_filename(
+     libscca_filename_strings_t *filename_strings,
+     libscca_mount_points_t *mount_points,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *decoded_string_data = NULL;
+	const uint8_t *mount_point   = NULL;
+	const uint8_t *string_data   = NULL;
+	static char *function        = "libscca_filename_strings_get_utf8_mapped_filename";
+	size_t device_path_size      = 0;
+	size_t mount_point_length    = 0;
+	size_t string_data_size      = 0;
+	int mount_point_index        = -1;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_index < 0 )
+	 || ( filename_index >= filename_strings->number_of_offsets ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mount_points != NULL )
+	 && ( filename_strings->mount_point_indexes != NULL ) )
+	{
+		mount_point_index = filename_strings->mount_point_indexes[ filename_index ];
+	}
+	if( mount_point_index == -1 )
+	{
+		if( libscca_filename_strings_get_utf8_filename(
+		     filename_strings,
+		     filename_index,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-8 string.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libscca_filename_strings_get_decoded_string_data(
+	     filename_strings,
+	     filename_index,
+	     &string_data,
+	     &string_data_size,
+	     &decoded_string_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d string data.",
+		 function,
+		 filename_index );
+
+		goto on_error;
+	}
+	if( libscca_mount_points_get_device_path_size(
+	     mount_points,
+	     mount_point_index,
+	     &device_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mount point: %d device path size.",
+		 function,
+		 mount_point_index );
+
+		goto on_error;
+	}
+	if( device_path_size > string_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount point: %d device path size value out of bounds.",
+		 function,
+		 mount_point_index );
+
+		goto on_error;
+	}
+	if( libscca_mount_points_get_mount_point(
+	     mount_points,
+	     mount_point_index,
+	     &mount_point,
+	     &mount_point_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mount point: %d.",
+		 function,
+		 mount_point_index );
+
+		goto on_error;
+	}
+	if( mount_point_length >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_point_length > 0 )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     mount_point,
+		     mount_point_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy mount point: %d.",
+			 function,
+			 mount_point_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_utf16_stream_copy_to_utf8_string(
+	     &( string_data[ device_path_size ] ),
+	     string_data_size - device_path_size,
+	     &( utf8_string[ mount_point_length ] ),
+	     utf8_string_size - mount_point_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-8 string.",
+		 function,
+		 filename_index );
+
+		goto on_error;
+	}
+	if( decoded_string_data != NULL )
+	{
+		memory_free(
+		 decoded_string_data );
+	}
+	return( 1 );
+
+on_error:
+	if( decoded_string_data != NULL )
+	{
+		memory_free(
+		 decoded_string_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the filename index for a specific offset
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libscca_filename_strings_get_index_by_offset(
+     libscca_filename_strings_t *filename_strings,
+     uint32_t filename_offset,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_get_index_by_offset";
+	int entry_index       = 0;
+	int lower_entry_index = 0;
+	int upper_entry_index = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offsets are stored in increasing order by libscca_filename_strings_read_data
+	 */
+	upper_entry_index = filename_strings->number_of_offsets;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( filename_strings->offsets[ entry_index ] == filename_offset )
+		{
+			*filename_index = entry_index;
+
+			return( 1 );
+		}
+		if( filename_strings->offsets[ entry_index ] < filename_offset )
+		{
+			lower_entry_index = entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = entry_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_number_of_filenames(
+     libscca_filename_strings_t *filename_strings,
+     int *number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_filename_strings_get_number_of_filenames";
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_strings->string_identifiers != NULL )
+	 || ( filename_strings->front_coded_strings != NULL ) )
+	{
+		if( number_of_filenames == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of filenames.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_filenames = filename_strings->number_of_offsets;
+
+		return( 1 );
+	}
+	if( libfvalue_value_get_number_of_value_entries(
+	     filename_strings->strings,
+	     number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf8_filename_size(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *string_data = NULL;
+	static char *function      = "libscca_filename_strings_get_utf8_filename_size";
+	size_t string_data_size    = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->utf8_strings != NULL )
+	{
+		if( ( filename_index < 0 )
+		 || ( filename_index >= filename_strings->number_of_offsets ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_size = (size_t) filename_strings->utf8_string_offsets[ filename_index + 1 ]
+		                  - (size_t) filename_strings->utf8_string_offsets[ filename_index ];
+
+		return( 1 );
+	}
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		if( libscca_front_coded_strings_get_utf8_string_size(
+		     filename_strings->front_coded_strings,
+		     filename_index,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d UTF-8 string size.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( filename_strings->string_identifiers != NULL )
+	{
+		if( libscca_filename_strings_get_string_data(
+		     filename_strings,
+		     filename_index,
+		     &string_data,
+		     &string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		if( libscca_utf16_stream_get_utf8_string_size(
+		     string_data,
+		     string_data_size,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d UTF-8 string size.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfvalue_value_get_utf8_string_size(
+	     filename_strings->strings,
+	     filename_index,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d UTF-8 string size.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf8_filename(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *string_data  = NULL;
+	static char *function       = "libscca_filename_strings_get_utf8_filename";
+	size_t cached_string_offset = 0;
+	size_t cached_string_size   = 0;
+	size_t string_data_size     = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->utf8_strings != NULL )
+	{
+		if( ( filename_index < 0 )
+		 || ( filename_index >= filename_strings->number_of_offsets ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		cached_string_offset = (size_t) filename_strings->utf8_string_offsets[ filename_index ];
+		cached_string_size   = (size_t) filename_strings->utf8_string_offsets[ filename_index + 1 ] - cached_string_offset;
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string_size < cached_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     &( filename_strings->utf8_strings[ cached_string_offset ] ),
+		     cached_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-8 string.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		if( libscca_front_coded_strings_copy_utf8_string(
+		     filename_strings->front_coded_strings,
+		     filename_index,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-8 string.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( filename_strings->string_identifiers != NULL )
+	{
+		if( libscca_filename_strings_get_string_data(
+		     filename_strings,
+		     filename_index,
+		     &string_data,
+		     &string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		if( libscca_utf16_stream_copy_to_utf8_string(
+		     string_data,
+		     string_data_size,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-8 string.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfvalue_value_copy_to_utf8_string(
+	     filename_strings->strings,
+	     filename_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-8 string.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded filename
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf16_filename_size(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *decoded_string_data = NULL;
+	const uint8_t *string_data   = NULL;
+	static char *function        = "libscca_filename_strings_get_utf16_filename_size";
+	size_t string_data_size      = 0;
+	int result                   = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		if( libscca_front_coded_strings_get_utf16_stream(
+		     filename_strings->front_coded_strings,
+		     filename_index,
+		     &decoded_string_data,
+		     &string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		result = libuna_utf16_string_size_from_utf16_stream(
+		          decoded_string_data,
+		          string_data_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          utf16_string_size,
+		          error );
+
+		memory_free(
+		 decoded_string_data );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d UTF-16 string size.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( filename_strings->string_identifiers != NULL )
+	{
+		if( libscca_filename_strings_get_string_data(
+		     filename_strings,
+		     filename_index,
+		     &string_data,
+		     &string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		if( libuna_utf16_string_size_from_utf16_stream(
+		     string_data,
+		     string_data_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d UTF-16 string size.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfvalue_value_get_utf16_string_size(
+	     filename_strings->strings,
+	     filename_index,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename: %d UTF-16 string size.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded filename
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf16_filename(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *decoded_string_data = NULL;
+	const uint8_t *string_data   = NULL;
+	static char *function        = "libscca_filename_strings_get_utf16_filename";
+	size_t string_data_size      = 0;
+	int result                   = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->front_coded_strings != NULL )
+	{
+		if( libscca_front_coded_strings_get_utf16_stream(
+		     filename_strings->front_coded_strings,
+		     filename_index,
+		     &decoded_string_data,
+		     &string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		result = libuna_utf16_string_copy_from_utf16_stream(
+		          utf16_string,
+		          utf16_string_size,
+		          decoded_string_data,
+		          string_data_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+
+		memory_free(
+		 decoded_string_data );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-16 string.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( filename_strings->string_identifiers != NULL )
+	{
+		if( libscca_filename_strings_get_string_data(
+		     filename_strings,
+		     filename_index,
+		     &string_data,
+		     &string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d string data.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		if( libuna_utf16_string_copy_from_utf16_stream(
+		     utf16_string,
+		     utf16_string_size,
+		     string_data,
+		     string_data_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-16 string.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfvalue_value_copy_to_utf16_string(
+	     filename_strings->strings,
+	     filename_index,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename: %d to UTF-16 string.",
+		 function,
+		 filename_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of all UTF-8 encoded filenames
+ * The returned size includes the end of string character of every filename
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_get_utf8_filenames_size(
+     libscca_filename_strings_t *filename_strings,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libscca_filename_strings_get_utf8_filenames_size";
+	size_t safe_utf8_size   = 0;
+	size_t utf8_string_size = 0;
+	int filename_index      = 0;
+	int number_of_filenames = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->utf8_strings != NULL )
+	{
+		*utf8_strings_size = filename_strings->utf8_strings_size;
+
+		return( 1 );
+	}
+	if( libscca_filename_strings_get_number_of_filenames(
+	     filename_strings,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( libscca_filename_strings_get_utf8_filename_size(
+		     filename_strings,
+		     filename_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d UTF-8 string size.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		safe_utf8_size += utf8_string_size;
+	}
+	*utf8_strings_size = safe_utf8_size;
+
+	return( 1 );
+}
+
+/* Copies all UTF-8 encoded filenames into a single packed buffer
+ * Every filename is stored including its end of string character and
+ * the offset of each filename in the buffer is stored in the offsets
+ * The number of offsets must be equal to or greater than the number of filenames
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_filename_strings_copy_utf8_filenames(
+     libscca_filename_strings_t *filename_strings,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_filename_strings_copy_utf8_filenames";
+	size_t utf8_string_offset = 0;
+	size_t utf8_string_size   = 0;
+	int filename_index        = 0;
+	int number_of_filenames   = 0;
+
+	if( filename_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 strings size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename index.",
+		 "%s: invalid UTF-8 string offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     filename_strings->offsets_array,
-	     &number_of_entries,
+	if( libscca_filename_strings_get_number_of_filenames(
+	     filename_strings,
+	     &number_of_filenames,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of offsets array entries.",
+		 "%s: unable to retrieve number of strings.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( number_of_offsets < number_of_filenames )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     filename_strings->offsets_array,
-		     entry_index,
-		     (intptr_t **) &filename_string_offset,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of offsets value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_strings->utf8_strings != NULL )
+	{
+		if( utf8_strings_size < filename_strings->utf8_strings_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 strings size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_strings,
+		     filename_strings->utf8_strings,
+		     filename_strings->utf8_strings_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 strings.",
+			 function );
+
+			return( -1 );
+		}
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			utf8_string_offsets[ filename_index ] = (size_t) filename_strings->utf8_string_offsets[ filename_index ];
+		}
+		return( 1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( libscca_filename_strings_get_utf8_filename_size(
+		     filename_strings,
+		     filename_index,
+		     &utf8_string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve offsets array entry: %d.",
+			 "%s: unable to retrieve filename: %d UTF-8 string size.",
 			 function,
-			 entry_index );
+			 filename_index );
 
 			return( -1 );
 		}
-		if( filename_string_offset == NULL )
+		if( utf8_string_size > ( utf8_strings_size - utf8_string_offset ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing offsets array entry: %d.",
-			 function,
-			 entry_index );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 strings size value too small.",
+			 function );
 
 			return( -1 );
 		}
-		if( *filename_string_offset == filename_offset )
+		if( libscca_filename_strings_get_utf8_filename(
+		     filename_strings,
+		     filename_index,
+		     &( utf8_strings[ utf8_string_offset ] ),
+		     utf8_string_size,
+		     error ) != 1 )
 		{
-			*filename_index = entry_index;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename: %d to UTF-8 string.",
+			 function,
+			 filename_index );
 
-			return( 1 );
+			return( -1 );
 		}
+		utf8_string_offsets[ filename_index ] = utf8_string_offset;
+
+		utf8_string_offset += utf8_string_size;
 	}
-	return( 0 );
+	return( 1 );
 }
 
-/* Retrieves the number of filenames
- * Returns 1 if successful or -1 on error
+/* Compares UTF-16 little-endian string data with a UTF-16 pattern
+ * The string data must contain at least pattern length characters
+ * Only ASCII characters are compared case-insensitive
+ * Returns 1 if equal or 0 if not
  */
-int libscca_filename_strings_get_number_of_filenames(
-     libscca_filename_strings_t *filename_strings,
-     int *number_of_filenames,
-     libcerror_error_t **error )
+int libscca_filename_strings_compare_utf16_pattern(
+     const uint8_t *string_data,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     uint8_t match_flags )
 {
-	static char *function = "libscca_filename_strings_get_number_of_filenames";
+	size_t pattern_index       = 0;
+	uint16_t pattern_character = 0;
+	uint16_t string_character  = 0;
 
-	if( filename_strings == NULL )
+	for( pattern_index = 0;
+	     pattern_index < utf16_pattern_length;
+	     pattern_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename strings.",
-		 function );
+		byte_stream_copy_to_uint16_little_endian(
+		 string_data,
+		 string_character );
 
-		return( -1 );
-	}
-	if( libfvalue_value_get_number_of_value_entries(
-	     filename_strings->strings,
-	     number_of_filenames,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings.",
-		 function );
+		string_data += 2;
 
-		return( -1 );
+		pattern_character = utf16_pattern[ pattern_index ];
+
+		if( string_character == pattern_character )
+		{
+			continue;
+		}
+		if( ( match_flags & LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE ) == 0 )
+		{
+			return( 0 );
+		}
+		if( ( string_character >= (uint16_t) 'a' )
+		 && ( string_character <= (uint16_t) 'z' ) )
+		{
+			string_character -= (uint16_t) 'a' - (uint16_t) 'A';
+		}
+		if( ( pattern_character >= (uint16_t) 'a' )
+		 && ( pattern_character <= (uint16_t) 'z' ) )
+		{
+			pattern_character -= (uint16_t) 'a' - (uint16_t) 'A';
+		}
+		if( string_character != pattern_character )
+		{
+			return( 0 );
+		}
 	}
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded filename
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Determines if UTF-16 little-endian string data matches a UTF-16 pattern
+ * Trailing end of string characters in the string data are ignored
+ * Returns 1 if the string data matches, 0 if not or -1 on error
  */
-int libscca_filename_strings_get_utf8_filename_size(
-     libscca_filename_strings_t *filename_strings,
-     int filename_index,
-     size_t *utf8_string_size,
+int libscca_filename_strings_match_string_data(
+     const uint8_t *string_data,
+     size_t string_data_size,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     int match_type,
+     uint8_t match_flags,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_filename_strings_get_utf8_filename_size";
+	static char *function = "libscca_filename_strings_match_string_data";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
 
-	if( filename_strings == NULL )
+	if( string_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename strings.",
+		 "%s: invalid string data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     filename_strings->strings,
-	     filename_index,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( string_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename: %d UTF-8 string size.",
-		 function,
-		 filename_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string data size value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific UTF-8 encoded filename
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_filename_strings_get_utf8_filename(
-     libscca_filename_strings_t *filename_strings,
-     int filename_index,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libscca_filename_strings_get_utf8_filename";
-
-	if( filename_strings == NULL )
+	if( utf16_pattern == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename strings.",
+		 "%s: invalid UTF-16 pattern.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     filename_strings->strings,
-	     filename_index,
-	     utf8_string,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( utf16_pattern_length > (size_t) ( SSIZE_MAX / 2 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename: %d to UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 pattern length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( match_flags & ~( LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported match flags: 0x%02" PRIx8 ".",
 		 function,
-		 filename_index );
+		 match_flags );
 
 		return( -1 );
 	}
-	return( 1 );
+	string_length = string_data_size / 2;
+
+	while( string_length > 0 )
+	{
+		if( ( string_data[ ( string_length * 2 ) - 2 ] != 0 )
+		 || ( string_data[ ( string_length * 2 ) - 1 ] != 0 ) )
+		{
+			break;
+		}
+		string_length--;
+	}
+	switch( match_type )
+	{
+		case LIBSCCA_FILENAME_MATCH_TYPE_EXACT:
+			if( string_length != utf16_pattern_length )
+			{
+				return( 0 );
+			}
+			return( libscca_filename_strings_compare_utf16_pattern(
+			         string_data,
+			         utf16_pattern,
+			         utf16_pattern_length,
+			         match_flags ) );
+
+		case LIBSCCA_FILENAME_MATCH_TYPE_PREFIX:
+			if( string_length < utf16_pattern_length )
+			{
+				return( 0 );
+			}
+			return( libscca_filename_strings_compare_utf16_pattern(
+			         string_data,
+			         utf16_pattern,
+			         utf16_pattern_length,
+			         match_flags ) );
+
+		case LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX:
+			if( string_length < utf16_pattern_length )
+			{
+				return( 0 );
+			}
+			return( libscca_filename_strings_compare_utf16_pattern(
+			         &( string_data[ ( string_length - utf16_pattern_length ) * 2 ] ),
+			         utf16_pattern,
+			         utf16_pattern_length,
+			         match_flags ) );
+
+		case LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING:
+			if( string_length < utf16_pattern_length )
+			{
+				return( 0 );
+			}
+			for( string_index = 0;
+			     string_index <= ( string_length - utf16_pattern_length );
+			     string_index++ )
+			{
+				if( libscca_filename_strings_compare_utf16_pattern(
+				     &( string_data[ string_index * 2 ] ),
+				     utf16_pattern,
+				     utf16_pattern_length,
+				     match_flags ) == 1 )
+				{
+					return( 1 );
+				}
+			}
+			return( 0 );
+
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+	 "%s: unsupported match type: %d.",
+	 function,
+	 match_type );
+
+	return( -1 );
 }
 
-/* Retrieves the size of a specific UTF-16 encoded filename
- * The returned size includes the end of string character
- * Returns 1 if successful or -1 on error
+/* Retrieves the index of the first filename that matches a UTF-16 pattern
+ * The filenames are matched against the UTF-16 little-endian string data
+ * as read from the file, without converting them
+ * Returns 1 if successful, 0 if no filename matches or -1 on error
  */
-int libscca_filename_strings_get_utf16_filename_size(
+int libscca_filename_strings_get_index_by_utf16_pattern(
      libscca_filename_strings_t *filename_strings,
-     int filename_index,
-     size_t *utf16_string_size,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error )
+{
+	return( libscca_filename_strings_get_next_index_by_utf16_pattern(
+	         filename_strings,
+	         0,
+	         utf16_pattern,
+	         utf16_pattern_length,
+	         match_type,
+	         match_flags,
+	         filename_index,
+	         error ) );
+}
+
+/* Retrieves the index of the first filename, starting at a specific index, that matches a UTF-16 pattern
+ * The filenames are matched against the UTF-16 little-endian string data
+ * as read from the file, without converting them
+ * Returns 1 if successful, 0 if no filename matches or -1 on error
+ */
+int libscca_filename_strings_get_next_index_by_utf16_pattern(
+     libscca_filename_strings_t *filename_strings,
+     int first_filename_index,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_filename_strings_get_utf16_filename_size";
+	uint8_t *decoded_entry_data = NULL;
+	const uint8_t *entry_data   = NULL;
+	static char *function       = "libscca_filename_strings_get_next_index_by_utf16_pattern";
+	size_t entry_data_size      = 0;
+	int entry_index             = 0;
+	int number_of_entries       = 0;
+	int result                  = 0;
 
 	if( filename_strings == NULL )
 	{
@@ -838,66 +3445,102 @@ int libscca_filename_strings_get_utf16_filename_size(
 
 		return( -1 );
 	}
-	if( libfvalue_value_get_utf16_string_size(
-	     filename_strings->strings,
-	     filename_index,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( filename_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename: %d UTF-16 string size.",
-		 function,
-		 filename_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename index.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a specific UTF-16 encoded filename
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libscca_filename_strings_get_utf16_filename(
-     libscca_filename_strings_t *filename_strings,
-     int filename_index,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libscca_filename_strings_get_utf16_filename";
-
-	if( filename_strings == NULL )
+	if( first_filename_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename strings.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first filename index value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvalue_value_copy_to_utf16_string(
-	     filename_strings->strings,
-	     filename_index,
-	     utf16_string,
-	     utf16_string_size,
+	if( libscca_filename_strings_get_number_of_filenames(
+	     filename_strings,
+	     &number_of_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename: %d to UTF-16 string.",
-		 function,
-		 filename_index );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
+	for( entry_index = first_filename_index;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_filename_strings_get_decoded_string_data(
+		     filename_strings,
+		     entry_index,
+		     &entry_data,
+		     &entry_data_size,
+		     &decoded_entry_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d data.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( entry_data == NULL )
+		{
+			continue;
+		}
+		result = libscca_filename_strings_match_string_data(
+		          entry_data,
+		          entry_data_size,
+		          utf16_pattern,
+		          utf16_pattern_length,
+		          match_type,
+		          match_flags,
+		          error );
+
+		if( decoded_entry_data != NULL )
+		{
+			memory_free(
+			 decoded_entry_data );
+
+			decoded_entry_data = NULL;
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match entry: %d data.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*filename_index = entry_index;
 
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
@@ -26,10 +26,13 @@
 #include <types.h>
 
 #include "libscca_libbfio.h"
-#include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
 #include "libscca_libfdata.h"
+#include "libscca_front_coded_strings.h"
 #include "libscca_libfvalue.h"
+#include "libscca_mount_points.h"
+#include "libscca_string_pool.h"
+#include "libscca_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -39,18 +42,80 @@ typedef struct libscca_filename_strings libscca_filename_strings_t;
 
 struct libscca_filename_strings
 {
-	/* The offsets array
+	/* The offsets
 	 */
-	libcdata_array_t *offsets_array;
+	uint32_t *offsets;
+
+	/* The number of offsets
+	 */
+	int number_of_offsets;
 
 	/* The filenames strings value
 	 */
 	libfvalue_value_t *strings;
-};
 
-int libscca_filename_string_offset_free(
-     uint32_t **filename_string_offset,
-     libcerror_error_t **error );
+	/* Value to indicate the filenames should be converted to UTF-8 once when read
+	 */
+	uint8_t use_utf8_cache;
+
+	/* The UTF-8 strings, contains the UTF-8 encoded filenames
+	 * including their end of string characters
+	 */
+	uint8_t *utf8_strings;
+
+	/* The UTF-8 strings size
+	 */
+	size_t utf8_strings_size;
+
+	/* The UTF-8 string offsets, the number of UTF-8 string offsets is
+	 * the number of offsets + 1 so that the last one marks the end of the UTF-8 strings
+	 */
+	uint32_t *utf8_string_offsets;
+
+	/* Value to indicate the filenames should be stored front-coded when read
+	 */
+	uint8_t use_front_coding;
+
+	/* The front-coded strings, contains the UTF-8 encoded filenames
+	 * Contains NULL if the filenames are not stored front-coded
+	 */
+	libscca_front_coded_strings_t *front_coded_strings;
+
+	/* The string pool that contains the filenames
+	 * Contains NULL if the filenames are stored in the strings value
+	 */
+	libscca_string_pool_t *string_pool;
+
+	/* The identifiers of the filenames in the string pool,
+	 * the number of string identifiers is the number of offsets
+	 */
+	uint32_t *string_identifiers;
+
+	/* The case folded hashes, which are the XXH64 of the upper case filenames,
+	 * the number of case folded hashes is the number of offsets
+	 */
+	uint64_t *case_folded_hashes;
+
+	/* Value to indicate a Bloom filter of the case folded hashes should be built when read
+	 */
+	uint8_t use_bloom_filter;
+
+	/* The Bloom filter of the case folded hashes
+	 * Contains NULL if no Bloom filter was built
+	 */
+	uint8_t *bloom_filter;
+
+	/* The Bloom filter size
+	 */
+	size_t bloom_filter_size;
+
+	/* The mount point indexes, which contain the index of the mount point of which
+	 * the device path is a prefix of the filename or -1 if there is no such mount point,
+	 * the number of mount point indexes is the number of offsets
+	 * Contains NULL if the mount point indexes were not determined
+	 */
+	int *mount_point_indexes;
+};
 
 int libscca_filename_strings_initialize(
      libscca_filename_strings_t **filename_strings,
@@ -70,12 +135,87 @@ int libscca_filename_strings_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
-int libscca_filename_strings_read_stream(
+int libscca_filename_strings_visit_data(
+     const uint8_t *data,
+     size_t data_size,
+     int (*callback_function)(
+            int filename_index,
+            const uint8_t *utf16_stream,
+            size_t utf16_stream_size,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_read_front_coded_strings(
+     libscca_filename_strings_t *filename_strings,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_read_utf8_strings(
+     libscca_filename_strings_t *filename_strings,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_string_data(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_decoded_string_data(
      libscca_filename_strings_t *filename_strings,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t filename_strings_offset,
-     uint32_t filename_strings_size,
+     int filename_index,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     uint8_t **decoded_string_data,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_case_folded_hash(
+     libscca_filename_strings_t *filename_strings,
+     int filename_index,
+     uint64_t *case_folded_hash,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_copy_case_folded_hashes(
+     libscca_filename_strings_t *filename_strings,
+     uint64_t *case_folded_hashes,
+     int number_of_case_folded_hashes,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_read_bloom_filter(
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_may_contain_hash(
+     libscca_filename_strings_t *filename_strings,
+     uint64_t case_folded_hash,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_read_mount_point_indexes(
+     libscca_filename_strings_t *filename_strings,
+     libscca_mount_points_t *mount_points,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_clear_mount_point_indexes(
+     libscca_filename_strings_t *filename_strings,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_utf8_mapped_filename_size(
+     libscca_filename_strings_t *filename_strings,
+     libscca_mount_points_t *mount_points,
+     int filename_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_utf8_mapped_filename(
+     libscca_filename_strings_t *filename_strings,
+     libscca_mount_points_t *mount_points,
+     int filename_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error );
 
 int libscca_filename_strings_get_index_by_offset(
@@ -115,6 +255,53 @@ int libscca_filename_strings_get_utf16_filename(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libscca_filename_strings_get_utf8_filenames_size(
+     libscca_filename_strings_t *filename_strings,
+     size_t *utf8_strings_size,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_copy_utf8_filenames(
+     libscca_filename_strings_t *filename_strings,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_compare_utf16_pattern(
+     const uint8_t *string_data,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     uint8_t match_flags );
+
+int libscca_filename_strings_match_string_data(
+     const uint8_t *string_data,
+     size_t string_data_size,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     int match_type,
+     uint8_t match_flags,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_index_by_utf16_pattern(
+     libscca_filename_strings_t *filename_strings,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error );
+
+int libscca_filename_strings_get_next_index_by_utf16_pattern(
+     libscca_filename_strings_t *filename_strings,
+     int first_filename_index,
+     const uint16_t *utf16_pattern,
+     size_t utf16_pattern_length,
+     int match_type,
+     uint8_t match_flags,
+     int *filename_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,216 @@
+/*
+ * Format layout functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_format_layout.h"
+#include "libscca_libcerror.h"
+
+#include "scca_file_information.h"
+#include "scca_file_metrics_array.h"
+#include "scca_trace_chain_array.h"
+#include "scca_volume_information.h"
+
+/* Format version 17 (Windows XP and 2003)
+ */
+const libscca_format_layout_t libscca_format_layout_v17 = {
+	17,
+	sizeof( scca_file_information_v17_t ),
+	36,
+	1,
+	60,
+	sizeof( scca_file_metrics_array_entry_v17_t ),
+	8,
+	16,
+	0,
+	sizeof( scca_trace_chain_array_entry_v17_t ),
+	sizeof( scca_volume_information_v17_t ),
+	8
+};
+
+/* Format version 23 (Windows Vista and 7)
+ */
+const libscca_format_layout_t libscca_format_layout_v23 = {
+	23,
+	sizeof( scca_file_information_v23_t ),
+	44,
+	1,
+	68,
+	sizeof( scca_file_metrics_array_entry_v23_t ),
+	12,
+	20,
+	1,
+	sizeof( scca_trace_chain_array_entry_v17_t ),
+	sizeof( scca_volume_information_v23_t ),
+	16
+};
+
+/* Format version 26 (Windows 8.1)
+ */
+const libscca_format_layout_t libscca_format_layout_v26 = {
+	26,
+	sizeof( scca_file_information_v26_t ),
+	44,
+	8,
+	124,
+	sizeof( scca_file_metrics_array_entry_v23_t ),
+	12,
+	20,
+	1,
+	sizeof( scca_trace_chain_array_entry_v17_t ),
+	sizeof( scca_volume_information_v23_t ),
+	16
+};
+
+/* Format version 30 (Windows 10) with the metrics array at offset 0x130
+ */
+const libscca_format_layout_t libscca_format_layout_v30 = {
+	30,
+	sizeof( scca_file_information_v26_t ),
+	44,
+	8,
+	124,
+	sizeof( scca_file_metrics_array_entry_v23_t ),
+	12,
+	20,
+	1,
+	sizeof( scca_trace_chain_array_entry_v30_t ),
+	sizeof( scca_volume_information_v30_t ),
+	16
+};
+
+/* Format version 30 (Windows 10) with the metrics array at offset 0x128
+ */
+const libscca_format_layout_t libscca_format_layout_v30_2 = {
+	30,
+	sizeof( scca_file_information_v30_2_t ),
+	44,
+	8,
+	116,
+	sizeof( scca_file_metrics_array_entry_v23_t ),
+	12,
+	20,
+	1,
+	sizeof( scca_trace_chain_array_entry_v30_t ),
+	sizeof( scca_volume_information_v30_t ),
+	16
+};
+
+/* Retrieves the format layout of a specific format version
+ * Returns 1 if successful, 0 if the format version is not supported or -1 on error
+ */
+int libscca_format_layout_get_by_format_version(
+     uint32_t format_version,
+     const libscca_format_layout_t **format_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_format_layout_get_by_format_version";
+
+	if( format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format layout.",
+		 function );
+
+		return( -1 );
+	}
+	switch( format_version )
+	{
+		case 17:
+			*format_layout = &libscca_format_layout_v17;
+			break;
+
+		case 23:
+			*format_layout = &libscca_format_layout_v23;
+			break;
+
+		case 26:
+			*format_layout = &libscca_format_layout_v26;
+			break;
+
+		case 30:
+			*format_layout = &libscca_format_layout_v30;
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the format layout variant that corresponds with the metrics array offset
+ * Format version 30 has 2 variants of the file information, which are distinguished
+ * by the metrics array offset, the other format versions have a single variant
+ * Returns 1 if successful, 0 if the variant is not supported or -1 on error
+ */
+int libscca_format_layout_get_by_metrics_array_offset(
+     const libscca_format_layout_t *format_layout,
+     uint32_t metrics_array_offset,
+     const libscca_format_layout_t **variant_format_layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_format_layout_get_by_metrics_array_offset";
+
+	if( format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( variant_format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid variant format layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_layout->format_version != 30 )
+	{
+		*variant_format_layout = format_layout;
+	}
+	else if( metrics_array_offset == 0x00000130 )
+	{
+		*variant_format_layout = &libscca_format_layout_v30;
+	}
+	else if( metrics_array_offset == 0x00000128 )
+	{
+		*variant_format_layout = &libscca_format_layout_v30_2;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
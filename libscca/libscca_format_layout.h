@@ -0,0 +1,113 @@
+/*
+ * Format layout functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FORMAT_LAYOUT_H )
+#define _LIBSCCA_FORMAT_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_format_layout libscca_format_layout_t;
+
+/* The sizes and offsets of the format version specific structures
+ * The layout is chosen once when the format version is read so that
+ * the parse routines do not need to branch on the format version per entry
+ */
+struct libscca_format_layout
+{
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The file information data size
+	 */
+	size_t file_information_data_size;
+
+	/* The offset of the last run times relative to the start of the file information
+	 */
+	size_t last_run_times_offset;
+
+	/* The number of last run times
+	 */
+	int number_of_last_run_times;
+
+	/* The offset of the run count relative to the start of the file information
+	 */
+	size_t run_count_offset;
+
+	/* The file metrics array entry data size
+	 */
+	size_t file_metrics_entry_data_size;
+
+	/* The offset of the filename string offset relative to the start of the file metrics array entry
+	 */
+	size_t filename_string_offset_offset;
+
+	/* The offset of the flags relative to the start of the file metrics array entry
+	 */
+	size_t file_metrics_flags_offset;
+
+	/* Value to indicate the file metrics array entry contains a file reference
+	 */
+	uint8_t file_metrics_has_file_reference;
+
+	/* The trace chain array entry data size
+	 */
+	size_t trace_chain_entry_data_size;
+
+	/* The volume information data size
+	 */
+	size_t volume_information_data_size;
+
+	/* The size of the header of the file references
+	 */
+	size_t file_references_header_size;
+};
+
+extern const libscca_format_layout_t libscca_format_layout_v17;
+extern const libscca_format_layout_t libscca_format_layout_v23;
+extern const libscca_format_layout_t libscca_format_layout_v26;
+extern const libscca_format_layout_t libscca_format_layout_v30;
+extern const libscca_format_layout_t libscca_format_layout_v30_2;
+
+int libscca_format_layout_get_by_format_version(
+     uint32_t format_version,
+     const libscca_format_layout_t **format_layout,
+     libcerror_error_t **error );
+
+int libscca_format_layout_get_by_metrics_array_offset(
+     const libscca_format_layout_t *format_layout,
+     uint32_t metrics_array_offset,
+     const libscca_format_layout_t **variant_format_layout,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FORMAT_LAYOUT_H ) */
+
@@ -0,0 +1,1457 @@
+/*
+ * Front-coded strings functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_front_coded_strings.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+
+/* Creates front-coded strings
+ * Make sure the value front_coded_strings is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_initialize(
+     libscca_front_coded_strings_t **front_coded_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_front_coded_strings_initialize";
+
+	if( front_coded_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front-coded strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( *front_coded_strings != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid front-coded strings value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*front_coded_strings = memory_allocate_structure(
+	                        libscca_front_coded_strings_t );
+
+	if( *front_coded_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create front-coded strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *front_coded_strings,
+	     0,
+	     sizeof( libscca_front_coded_strings_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear front-coded strings.",
+		 function );
+
+		memory_free(
+		 *front_coded_strings );
+
+		*front_coded_strings = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees front-coded strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_free(
+     libscca_front_coded_strings_t **front_coded_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_front_coded_strings_free";
+
+	if( front_coded_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front-coded strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( *front_coded_strings != NULL )
+	{
+		if( ( *front_coded_strings )->block_offsets != NULL )
+		{
+			memory_free(
+			 ( *front_coded_strings )->block_offsets );
+		}
+		if( ( *front_coded_strings )->data != NULL )
+		{
+			memory_free(
+			 ( *front_coded_strings )->data );
+		}
+		memory_free(
+		 *front_coded_strings );
+
+		*front_coded_strings = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a variable-length encoded value, which is stored 7 bits per byte
+ * with the most significant bit set if another byte follows
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_read_value(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_front_coded_strings_read_value";
+	size_t safe_offset    = 0;
+	uint64_t safe_value   = 0;
+	uint8_t byte_value    = 0;
+	uint8_t bit_shift     = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = *data_offset;
+
+	do
+	{
+		if( ( safe_offset >= data_size )
+		 || ( bit_shift > 56 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value - data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_value = data[ safe_offset++ ];
+
+		safe_value |= (uint64_t) ( byte_value & 0x7f ) << bit_shift;
+
+		bit_shift += 7;
+	}
+	while( ( byte_value & 0x80 ) != 0 );
+
+	*data_offset = safe_offset;
+	*value       = safe_value;
+
+	return( 1 );
+}
+
+/* Determines the length of the UTF-8 string of a little-endian UTF-16 stream
+ * The length does not include the end of string character, which is indicated by has end of string
+ * Returns 1 if successful, 0 if the stream cannot be stored front-coded or -1 on error
+ */
+int libscca_front_coded_strings_get_utf8_length_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_length,
+     uint8_t *has_end_of_string,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_front_coded_strings_get_utf8_length_from_utf16_stream";
+	size_t number_of_units     = 0;
+	size_t safe_string_length  = 0;
+	size_t unit_index          = 0;
+	uint16_t next_unit         = 0;
+	uint16_t unit              = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_end_of_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has end of string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only streams that can be restored exactly are stored front-coded
+	 */
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	number_of_units    = utf16_stream_size / 2;
+	*has_end_of_string = 0;
+
+	if( ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	{
+		*has_end_of_string = 1;
+
+		number_of_units--;
+	}
+	for( unit_index = 0;
+	     unit_index < number_of_units;
+	     unit_index++ )
+	{
+		unit = (uint16_t) utf16_stream[ unit_index * 2 ]
+		     | ( (uint16_t) utf16_stream[ ( unit_index * 2 ) + 1 ] << 8 );
+
+		if( unit == 0 )
+		{
+			return( 0 );
+		}
+		else if( unit < 0x0080 )
+		{
+			safe_string_length += 1;
+		}
+		else if( unit < 0x0800 )
+		{
+			safe_string_length += 2;
+		}
+		else if( ( unit >= 0xd800 )
+		      && ( unit < 0xdc00 ) )
+		{
+			if( ( unit_index + 1 ) >= number_of_units )
+			{
+				return( 0 );
+			}
+			next_unit = (uint16_t) utf16_stream[ ( unit_index + 1 ) * 2 ]
+			          | ( (uint16_t) utf16_stream[ ( ( unit_index + 1 ) * 2 ) + 1 ] << 8 );
+
+			if( ( next_unit < 0xdc00 )
+			 || ( next_unit >= 0xe000 ) )
+			{
+				return( 0 );
+			}
+			safe_string_length += 4;
+
+			unit_index++;
+		}
+		else if( ( unit >= 0xdc00 )
+		      && ( unit < 0xe000 ) )
+		{
+			return( 0 );
+		}
+		else
+		{
+			safe_string_length += 3;
+		}
+	}
+	*utf8_string_length = safe_string_length;
+
+	return( 1 );
+}
+
+/* Copies the UTF-8 string of a little-endian UTF-16 stream
+ * The UTF-8 string length must match the length determined by
+ * libscca_front_coded_strings_get_utf8_length_from_utf16_stream, no end of string character is copied
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_copy_utf8_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function        = "libscca_front_coded_strings_copy_utf8_from_utf16_stream";
+	size_t number_of_units       = 0;
+	size_t string_index          = 0;
+	size_t unit_index            = 0;
+	uint32_t unicode_character   = 0;
+	uint16_t next_unit           = 0;
+	uint16_t unit                = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( utf16_stream_size > (size_t) SSIZE_MAX )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_units = utf16_stream_size / 2;
+
+	if( ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	{
+		number_of_units--;
+	}
+	for( unit_index = 0;
+	     unit_index < number_of_units;
+	     unit_index++ )
+	{
+		unit = (uint16_t) utf16_stream[ unit_index * 2 ]
+		     | ( (uint16_t) utf16_stream[ ( unit_index * 2 ) + 1 ] << 8 );
+
+		unicode_character = unit;
+
+		if( ( unit >= 0xd800 )
+		 && ( unit < 0xdc00 )
+		 && ( ( unit_index + 1 ) < number_of_units ) )
+		{
+			next_unit = (uint16_t) utf16_stream[ ( unit_index + 1 ) * 2 ]
+			          | ( (uint16_t) utf16_stream[ ( ( unit_index + 1 ) * 2 ) + 1 ] << 8 );
+
+			unicode_character = 0x10000
+			                  + ( ( (uint32_t) unit - 0xd800 ) << 10 )
+			                  + ( (uint32_t) next_unit - 0xdc00 );
+
+			unit_index++;
+		}
+		if( unicode_character < 0x80 )
+		{
+			if( ( utf8_string_length - string_index ) < 1 )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) unicode_character;
+		}
+		else if( unicode_character < 0x800 )
+		{
+			if( ( utf8_string_length - string_index ) < 2 )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else if( unicode_character < 0x10000 )
+		{
+			if( ( utf8_string_length - string_index ) < 3 )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+		else
+		{
+			if( ( utf8_string_length - string_index ) < 4 )
+			{
+				break;
+			}
+			utf8_string[ string_index++ ] = (uint8_t) ( 0xf0 | ( unicode_character >> 18 ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 12 ) & 0x3f ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+			utf8_string[ string_index++ ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+		}
+	}
+	if( ( unit_index < number_of_units )
+	 || ( string_index != utf8_string_length ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads front-coded strings from little-endian UTF-16 streams
+ * The streams are stored in the data at the offsets, where a stream
+ * ends at the next offset or at the end of the data
+ * Returns 1 if successful, 0 if the streams cannot be stored front-coded or -1 on error
+ */
+int libscca_front_coded_strings_read_utf16_streams(
+     libscca_front_coded_strings_t *front_coded_strings,
+     const uint8_t *data,
+     size_t data_size,
+     const uint32_t *offsets,
+     int number_of_offsets,
+     libcerror_error_t **error )
+{
+	uint8_t *current_string    = NULL;
+	uint8_t *previous_string   = NULL;
+	uint8_t *string_buffers    = NULL;
+	uint8_t *encoded_data      = NULL;
+	uint8_t *swap_string       = NULL;
+	static char *function      = "libscca_front_coded_strings_read_utf16_streams";
+	size_t encoded_data_offset = 0;
+	size_t encoded_data_size   = 0;
+	size_t maximum_length      = 0;
+	size_t prefix_length       = 0;
+	size_t previous_length     = 0;
+	size_t stream_offset       = 0;
+	size_t stream_size         = 0;
+	size_t string_length       = 0;
+	size_t total_length        = 0;
+	uint64_t value             = 0;
+	uint8_t byte_value         = 0;
+	uint8_t has_end_of_string  = 0;
+	int number_of_blocks       = 0;
+	int offset_index           = 0;
+	int result                 = 0;
+
+	if( front_coded_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front-coded strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( front_coded_strings->data != NULL )
+	 || ( front_coded_strings->block_offsets != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid front-coded strings - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offsets == NULL )
+	 && ( number_of_offsets > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of offsets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_offsets == 0 )
+	{
+		return( 1 );
+	}
+	/* The first pass determines the length of the longest and all UTF-8 strings
+	 */
+	for( offset_index = 0;
+	     offset_index < number_of_offsets;
+	     offset_index++ )
+	{
+		stream_offset = (size_t) offsets[ offset_index ];
+
+		if( ( offset_index + 1 ) < number_of_offsets )
+		{
+			stream_size = (size_t) offsets[ offset_index + 1 ];
+		}
+		else
+		{
+			stream_size = data_size;
+		}
+		if( ( stream_offset > data_size )
+		 || ( stream_size < stream_offset )
+		 || ( stream_size > data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset: %d value out of bounds.",
+			 function,
+			 offset_index );
+
+			return( -1 );
+		}
+		stream_size -= stream_offset;
+
+		result = libscca_front_coded_strings_get_utf8_length_from_utf16_stream(
+		          &( data[ stream_offset ] ),
+		          stream_size,
+		          &string_length,
+		          &has_end_of_string,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine length of string: %d.",
+			 function,
+			 offset_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( string_length > maximum_length )
+		{
+			maximum_length = string_length;
+		}
+		total_length += string_length;
+	}
+	/* Every string is stored with 2 values of at most 10 bytes each
+	 */
+	encoded_data_size = total_length + ( (size_t) number_of_offsets * 20 );
+
+	if( ( encoded_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( encoded_data_size > (size_t) UINT32_MAX )
+	 || ( maximum_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		return( 0 );
+	}
+	number_of_blocks = ( number_of_offsets + LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE - 1 ) / LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE;
+
+	string_buffers = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * ( ( maximum_length + 1 ) * 2 ) );
+
+	if( string_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string buffers.",
+		 function );
+
+		goto on_error;
+	}
+	front_coded_strings->data = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * encoded_data_size );
+
+	if( front_coded_strings->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	front_coded_strings->block_offsets = (uint32_t *) memory_allocate(
+	                                                   sizeof( uint32_t ) * number_of_blocks );
+
+	if( front_coded_strings->block_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block offsets.",
+		 function );
+
+		goto on_error;
+	}
+	previous_string = string_buffers;
+	current_string  = &( string_buffers[ maximum_length + 1 ] );
+
+	/* The second pass encodes the strings
+	 */
+	for( offset_index = 0;
+	     offset_index < number_of_offsets;
+	     offset_index++ )
+	{
+		stream_offset = (size_t) offsets[ offset_index ];
+
+		if( ( offset_index + 1 ) < number_of_offsets )
+		{
+			stream_size = (size_t) offsets[ offset_index + 1 ];
+		}
+		else
+		{
+			stream_size = data_size;
+		}
+		stream_size -= stream_offset;
+
+		if( libscca_front_coded_strings_get_utf8_length_from_utf16_stream(
+		     &( data[ stream_offset ] ),
+		     stream_size,
+		     &string_length,
+		     &has_end_of_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine length of string: %d.",
+			 function,
+			 offset_index );
+
+			goto on_error;
+		}
+		if( libscca_front_coded_strings_copy_utf8_from_utf16_stream(
+		     &( data[ stream_offset ] ),
+		     stream_size,
+		     current_string,
+		     string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy string: %d.",
+			 function,
+			 offset_index );
+
+			goto on_error;
+		}
+		prefix_length = 0;
+
+		if( ( offset_index % LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE ) == 0 )
+		{
+			front_coded_strings->block_offsets[ offset_index / LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE ] = (uint32_t) encoded_data_offset;
+		}
+		else
+		{
+			while( ( prefix_length < previous_length )
+			    && ( prefix_length < string_length )
+			    && ( previous_string[ prefix_length ] == current_string[ prefix_length ] ) )
+			{
+				prefix_length++;
+			}
+		}
+		value = (uint64_t) prefix_length;
+
+		do
+		{
+			byte_value = (uint8_t) ( value & 0x7f );
+			value    >>= 7;
+
+			if( value != 0 )
+			{
+				byte_value |= 0x80;
+			}
+			front_coded_strings->data[ encoded_data_offset++ ] = byte_value;
+		}
+		while( value != 0 );
+
+		value = ( (uint64_t) ( string_length - prefix_length ) << 1 ) | has_end_of_string;
+
+		do
+		{
+			byte_value = (uint8_t) ( value & 0x7f );
+			value    >>= 7;
+
+			if( value != 0 )
+			{
+				byte_value |= 0x80;
+			}
+			front_coded_strings->data[ encoded_data_offset++ ] = byte_value;
+		}
+		while( value != 0 );
+
+		if( string_length > prefix_length )
+		{
+			if( memory_copy(
+			     &( front_coded_strings->data[ encoded_data_offset ] ),
+			     &( current_string[ prefix_length ] ),
+			     string_length - prefix_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy suffix of string: %d.",
+				 function,
+				 offset_index );
+
+				goto on_error;
+			}
+			encoded_data_offset += string_length - prefix_length;
+		}
+		swap_string     = previous_string;
+		previous_string = current_string;
+		current_string  = swap_string;
+		previous_length = string_length;
+	}
+	memory_free(
+	 string_buffers );
+
+	string_buffers = NULL;
+
+	/* Release the space reserved for the worst case encoding
+	 */
+	if( encoded_data_offset < encoded_data_size )
+	{
+		encoded_data = (uint8_t *) memory_reallocate(
+		                            front_coded_strings->data,
+		                            sizeof( uint8_t ) * encoded_data_offset );
+
+		if( encoded_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			goto on_error;
+		}
+		front_coded_strings->data = encoded_data;
+	}
+	front_coded_strings->data_size         = encoded_data_offset;
+	front_coded_strings->number_of_blocks  = number_of_blocks;
+	front_coded_strings->number_of_strings = number_of_offsets;
+
+	return( 1 );
+
+on_error:
+	if( front_coded_strings->block_offsets != NULL )
+	{
+		memory_free(
+		 front_coded_strings->block_offsets );
+
+		front_coded_strings->block_offsets = NULL;
+	}
+	if( front_coded_strings->data != NULL )
+	{
+		memory_free(
+		 front_coded_strings->data );
+
+		front_coded_strings->data = NULL;
+	}
+	if( string_buffers != NULL )
+	{
+		memory_free(
+		 string_buffers );
+	}
+	return( -1 );
+}
+
+/* Decodes a specific string
+ * The strings are decoded from the first string of the block, where every string
+ * is truncated to the size of the UTF-8 string since a string never shares more
+ * than its own length with the previous string
+ * If the UTF-8 string is NULL only the length is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_decode_string(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_length,
+     uint8_t *has_end_of_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_front_coded_strings_decode_string";
+	size_t copy_size      = 0;
+	size_t data_offset    = 0;
+	size_t maximum_length = 0;
+	size_t string_length  = 0;
+	uint64_t prefix_size  = 0;
+	uint64_t suffix_size  = 0;
+	uint64_t value        = 0;
+	int entry_index       = 0;
+
+	if( front_coded_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid front-coded strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= front_coded_strings->number_of_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != NULL )
+	{
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		maximum_length = utf8_string_size - 1;
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_end_of_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has end of string.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = string_index - ( string_index % LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE );
+	data_offset = (size_t) front_coded_strings->block_offsets[ string_index / LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE ];
+
+	while( entry_index <= string_index )
+	{
+		if( libscca_front_coded_strings_read_value(
+		     front_coded_strings->data,
+		     front_coded_strings->data_size,
+		     &data_offset,
+		     &prefix_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read prefix size of string: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libscca_front_coded_strings_read_value(
+		     front_coded_strings->data,
+		     front_coded_strings->data_size,
+		     &data_offset,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read suffix size of string: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		suffix_size = value >> 1;
+
+		if( ( prefix_size > (uint64_t) string_length )
+		 || ( suffix_size > (uint64_t) ( front_coded_strings->data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid string: %d prefix or suffix size value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( utf8_string != NULL )
+		 && ( prefix_size < (uint64_t) maximum_length ) )
+		{
+			copy_size = maximum_length - (size_t) prefix_size;
+
+			if( (uint64_t) copy_size > suffix_size )
+			{
+				copy_size = (size_t) suffix_size;
+			}
+			if( copy_size > 0 )
+			{
+				if( memory_copy(
+				     &( utf8_string[ prefix_size ] ),
+				     &( front_coded_strings->data[ data_offset ] ),
+				     copy_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy suffix of string: %d.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+			}
+		}
+		data_offset  += (size_t) suffix_size;
+		string_length = (size_t) ( prefix_size + suffix_size );
+
+		entry_index++;
+	}
+	if( utf8_string != NULL )
+	{
+		if( string_length > maximum_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_length ] = 0;
+	}
+	*utf8_string_length = string_length;
+	*has_end_of_string  = (uint8_t) ( value & 1 );
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_get_utf8_string_size(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_front_coded_strings_get_utf8_string_size";
+	size_t utf8_string_length = 0;
+	uint8_t has_end_of_string = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_front_coded_strings_decode_string(
+	     front_coded_strings,
+	     string_index,
+	     NULL,
+	     0,
+	     &utf8_string_length,
+	     &has_end_of_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	*utf8_string_size = utf8_string_length + 1;
+
+	return( 1 );
+}
+
+/* Copies a specific UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_copy_utf8_string(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_front_coded_strings_copy_utf8_string";
+	size_t utf8_string_length = 0;
+	uint8_t has_end_of_string = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_front_coded_strings_decode_string(
+	     front_coded_strings,
+	     string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_length,
+	     &has_end_of_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the little-endian UTF-16 stream of a specific string
+ * The stream is restored exactly as it was read, including the end of string character
+ * The stream is allocated and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_front_coded_strings_get_utf16_stream(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_utf16_stream    = NULL;
+	uint8_t *utf8_string          = NULL;
+	static char *function         = "libscca_front_coded_strings_get_utf16_stream";
+	size_t safe_utf16_stream_size = 0;
+	size_t stream_index           = 0;
+	size_t string_index_utf8      = 0;
+	size_t utf8_string_length     = 0;
+	uint32_t unicode_character    = 0;
+	uint8_t byte_value            = 0;
+	uint8_t has_end_of_string     = 0;
+	uint8_t number_of_bytes       = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf16_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid UTF-16 stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_front_coded_strings_decode_string(
+	     front_coded_strings,
+	     string_index,
+	     NULL,
+	     0,
+	     &utf8_string_length,
+	     &has_end_of_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode string: %d.",
+		 function,
+		 string_index );
+
+		goto on_error;
+	}
+	if( utf8_string_length >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ( utf8_string_length + 1 ) );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_front_coded_strings_decode_string(
+	     front_coded_strings,
+	     string_index,
+	     utf8_string,
+	     utf8_string_length + 1,
+	     &utf8_string_length,
+	     &has_end_of_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to decode string: %d.",
+		 function,
+		 string_index );
+
+		goto on_error;
+	}
+	/* Characters of 4 UTF-8 bytes are stored as a surrogate pair, all others as 1 UTF-16 unit
+	 */
+	for( string_index_utf8 = 0;
+	     string_index_utf8 < utf8_string_length;
+	     string_index_utf8++ )
+	{
+		byte_value = utf8_string[ string_index_utf8 ];
+
+		if( ( byte_value & 0xc0 ) != 0x80 )
+		{
+			safe_utf16_stream_size += 2;
+		}
+		if( byte_value >= 0xf0 )
+		{
+			safe_utf16_stream_size += 2;
+		}
+	}
+	if( has_end_of_string != 0 )
+	{
+		safe_utf16_stream_size += 2;
+	}
+	if( safe_utf16_stream_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_utf16_stream = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * safe_utf16_stream_size );
+
+	if( safe_utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	string_index_utf8 = 0;
+
+	while( string_index_utf8 < utf8_string_length )
+	{
+		byte_value = utf8_string[ string_index_utf8 ];
+
+		if( byte_value < 0x80 )
+		{
+			unicode_character = byte_value;
+			number_of_bytes   = 1;
+		}
+		else if( byte_value < 0xe0 )
+		{
+			unicode_character = byte_value & 0x1f;
+			number_of_bytes   = 2;
+		}
+		else if( byte_value < 0xf0 )
+		{
+			unicode_character = byte_value & 0x0f;
+			number_of_bytes   = 3;
+		}
+		else
+		{
+			unicode_character = byte_value & 0x07;
+			number_of_bytes   = 4;
+		}
+		if( (size_t) number_of_bytes > ( utf8_string_length - string_index_utf8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string - missing continuation bytes.",
+			 function );
+
+			goto on_error;
+		}
+		string_index_utf8++;
+
+		while( number_of_bytes > 1 )
+		{
+			unicode_character <<= 6;
+			unicode_character  |= utf8_string[ string_index_utf8++ ] & 0x3f;
+
+			number_of_bytes--;
+		}
+		if( unicode_character >= 0x10000 )
+		{
+			if( ( safe_utf16_stream_size - stream_index ) < 4 )
+			{
+				break;
+			}
+			unicode_character -= 0x10000;
+
+			safe_utf16_stream[ stream_index++ ] = (uint8_t) ( ( unicode_character >> 10 ) & 0xff );
+			safe_utf16_stream[ stream_index++ ] = (uint8_t) ( 0xd8 | ( ( unicode_character >> 18 ) & 0x03 ) );
+			safe_utf16_stream[ stream_index++ ] = (uint8_t) ( unicode_character & 0xff );
+			safe_utf16_stream[ stream_index++ ] = (uint8_t) ( 0xdc | ( ( unicode_character >> 8 ) & 0x03 ) );
+		}
+		else
+		{
+			if( ( safe_utf16_stream_size - stream_index ) < 2 )
+			{
+				break;
+			}
+			safe_utf16_stream[ stream_index++ ] = (uint8_t) ( unicode_character & 0xff );
+			safe_utf16_stream[ stream_index++ ] = (uint8_t) ( unicode_character >> 8 );
+		}
+	}
+	if( has_end_of_string != 0 )
+	{
+		if( ( safe_utf16_stream_size - stream_index ) >= 2 )
+		{
+			safe_utf16_stream[ stream_index++ ] = 0;
+			safe_utf16_stream[ stream_index++ ] = 0;
+		}
+	}
+	if( stream_index != safe_utf16_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	*utf16_stream      = safe_utf16_stream;
+	*utf16_stream_size = safe_utf16_stream_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_utf16_stream != NULL )
+	{
+		memory_free(
+		 safe_utf16_stream );
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
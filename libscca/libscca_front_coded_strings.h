@@ -0,0 +1,138 @@
+/*
+ * Front-coded strings functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_FRONT_CODED_STRINGS_H )
+#define _LIBSCCA_FRONT_CODED_STRINGS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of strings per block, where the first string of a block
+ * is stored in full and is a restart point for decoding
+ */
+#define LIBSCCA_FRONT_CODED_STRINGS_BLOCK_SIZE	16
+
+typedef struct libscca_front_coded_strings libscca_front_coded_strings_t;
+
+struct libscca_front_coded_strings
+{
+	/* The encoded data
+	 * Every string is stored as a variable-length encoded length of the prefix it shares
+	 * with the previous string, a variable-length encoded size of the suffix, where the lowest bit
+	 * indicates an end of string character, followed by the UTF-8 encoded suffix
+	 */
+	uint8_t *data;
+
+	/* The encoded data size
+	 */
+	size_t data_size;
+
+	/* The offsets of the first string of every block in the encoded data
+	 */
+	uint32_t *block_offsets;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The number of strings
+	 */
+	int number_of_strings;
+};
+
+int libscca_front_coded_strings_initialize(
+     libscca_front_coded_strings_t **front_coded_strings,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_free(
+     libscca_front_coded_strings_t **front_coded_strings,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_read_value(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_get_utf8_length_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_length,
+     uint8_t *has_end_of_string,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_copy_utf8_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_read_utf16_streams(
+     libscca_front_coded_strings_t *front_coded_strings,
+     const uint8_t *data,
+     size_t data_size,
+     const uint32_t *offsets,
+     int number_of_offsets,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_decode_string(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_length,
+     uint8_t *has_end_of_string,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_get_utf8_string_size(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_copy_utf8_string(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libscca_front_coded_strings_get_utf16_stream(
+     libscca_front_coded_strings_t *front_coded_strings,
+     int string_index,
+     uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_FRONT_CODED_STRINGS_H ) */
+
@@ -0,0 +1,407 @@
+/*
+ * Hash functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+
+/* The XXH64 primes
+ */
+#define LIBSCCA_HASH_XXH64_PRIME1	0x9e3779b185ebca87ULL
+#define LIBSCCA_HASH_XXH64_PRIME2	0xc2b2ae3d27d4eb4fULL
+#define LIBSCCA_HASH_XXH64_PRIME3	0x165667b19e3779f9ULL
+#define LIBSCCA_HASH_XXH64_PRIME4	0x85ebca77c2b2ae63ULL
+#define LIBSCCA_HASH_XXH64_PRIME5	0x27d4eb2f165667c5ULL
+
+#define libscca_hash_rotate_left_64bit( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+#define libscca_hash_xxh64_round( accumulator, value ) \
+	accumulator += ( value ) * LIBSCCA_HASH_XXH64_PRIME2; \
+	accumulator  = libscca_hash_rotate_left_64bit( accumulator, 31 ); \
+	accumulator *= LIBSCCA_HASH_XXH64_PRIME1;
+
+/* Initializes a XXH64 hash context
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_hash_xxh64_initialize(
+     libscca_hash_xxh64_context_t *context,
+     uint64_t seed,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_hash_xxh64_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	context->accumulators[ 0 ] = seed + LIBSCCA_HASH_XXH64_PRIME1 + LIBSCCA_HASH_XXH64_PRIME2;
+	context->accumulators[ 1 ] = seed + LIBSCCA_HASH_XXH64_PRIME2;
+	context->accumulators[ 2 ] = seed;
+	context->accumulators[ 3 ] = seed - LIBSCCA_HASH_XXH64_PRIME1;
+	context->seed              = seed;
+	context->total_data_size   = 0;
+	context->buffer_size       = 0;
+
+	return( 1 );
+}
+
+/* Updates a XXH64 hash context with data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_hash_xxh64_update(
+     libscca_hash_xxh64_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_hash_xxh64_update";
+	size_t data_offset    = 0;
+	size_t copy_size      = 0;
+	uint64_t value_64bit  = 0;
+	int accumulator_index = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->buffer_size >= LIBSCCA_HASH_XXH64_STRIPE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->total_data_size += data_size;
+
+	if( context->buffer_size > 0 )
+	{
+		copy_size = LIBSCCA_HASH_XXH64_STRIPE_SIZE - context->buffer_size;
+
+		if( copy_size > data_size )
+		{
+			copy_size = data_size;
+		}
+		if( memory_copy(
+		     &( context->buffer[ context->buffer_size ] ),
+		     data,
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		context->buffer_size += copy_size;
+		data_offset           = copy_size;
+
+		if( context->buffer_size < LIBSCCA_HASH_XXH64_STRIPE_SIZE )
+		{
+			return( 1 );
+		}
+		for( accumulator_index = 0;
+		     accumulator_index < 4;
+		     accumulator_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( context->buffer[ accumulator_index * 8 ] ),
+			 value_64bit );
+
+			libscca_hash_xxh64_round(
+			 context->accumulators[ accumulator_index ],
+			 value_64bit )
+		}
+		context->buffer_size = 0;
+	}
+	while( ( data_size - data_offset ) >= LIBSCCA_HASH_XXH64_STRIPE_SIZE )
+	{
+		for( accumulator_index = 0;
+		     accumulator_index < 4;
+		     accumulator_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			libscca_hash_xxh64_round(
+			 context->accumulators[ accumulator_index ],
+			 value_64bit )
+
+			data_offset += 8;
+		}
+	}
+	if( data_offset < data_size )
+	{
+		context->buffer_size = data_size - data_offset;
+
+		if( memory_copy(
+		     context->buffer,
+		     &( data[ data_offset ] ),
+		     context->buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finalizes a XXH64 hash context
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_hash_xxh64_finalize(
+     libscca_hash_xxh64_context_t *context,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_hash_xxh64_finalize";
+	size_t buffer_offset  = 0;
+	uint64_t accumulator  = 0;
+	uint64_t safe_hash    = 0;
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	int accumulator_index = 0;
+
+	static const uint8_t rotate_bits[ 4 ] = { 1, 7, 12, 18 };
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->buffer_size >= LIBSCCA_HASH_XXH64_STRIPE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid context - buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->total_data_size >= LIBSCCA_HASH_XXH64_STRIPE_SIZE )
+	{
+		for( accumulator_index = 0;
+		     accumulator_index < 4;
+		     accumulator_index++ )
+		{
+			accumulator = context->accumulators[ accumulator_index ];
+
+			safe_hash += libscca_hash_rotate_left_64bit( accumulator, rotate_bits[ accumulator_index ] );
+		}
+		for( accumulator_index = 0;
+		     accumulator_index < 4;
+		     accumulator_index++ )
+		{
+			accumulator = 0;
+
+			libscca_hash_xxh64_round(
+			 accumulator,
+			 context->accumulators[ accumulator_index ] )
+
+			safe_hash ^= accumulator;
+			safe_hash  = ( safe_hash * LIBSCCA_HASH_XXH64_PRIME1 ) + LIBSCCA_HASH_XXH64_PRIME4;
+		}
+	}
+	else
+	{
+		safe_hash = context->seed + LIBSCCA_HASH_XXH64_PRIME5;
+	}
+	safe_hash += context->total_data_size;
+
+	while( ( context->buffer_size - buffer_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( context->buffer[ buffer_offset ] ),
+		 value_64bit );
+
+		accumulator = 0;
+
+		libscca_hash_xxh64_round(
+		 accumulator,
+		 value_64bit )
+
+		safe_hash ^= accumulator;
+		safe_hash  = ( libscca_hash_rotate_left_64bit( safe_hash, 27 ) * LIBSCCA_HASH_XXH64_PRIME1 ) + LIBSCCA_HASH_XXH64_PRIME4;
+
+		buffer_offset += 8;
+	}
+	if( ( context->buffer_size - buffer_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( context->buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		safe_hash ^= (uint64_t) value_32bit * LIBSCCA_HASH_XXH64_PRIME1;
+		safe_hash  = ( libscca_hash_rotate_left_64bit( safe_hash, 23 ) * LIBSCCA_HASH_XXH64_PRIME2 ) + LIBSCCA_HASH_XXH64_PRIME3;
+
+		buffer_offset += 4;
+	}
+	while( buffer_offset < context->buffer_size )
+	{
+		safe_hash ^= (uint64_t) context->buffer[ buffer_offset ] * LIBSCCA_HASH_XXH64_PRIME5;
+		safe_hash  = libscca_hash_rotate_left_64bit( safe_hash, 11 ) * LIBSCCA_HASH_XXH64_PRIME1;
+
+		buffer_offset += 1;
+	}
+	safe_hash ^= safe_hash >> 33;
+	safe_hash *= LIBSCCA_HASH_XXH64_PRIME2;
+	safe_hash ^= safe_hash >> 29;
+	safe_hash *= LIBSCCA_HASH_XXH64_PRIME3;
+	safe_hash ^= safe_hash >> 32;
+
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Calculates the XXH64 hash of data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_hash_calculate_xxh64(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t seed,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libscca_hash_xxh64_context_t context;
+
+	static char *function = "libscca_hash_calculate_xxh64";
+
+	if( libscca_hash_xxh64_initialize(
+	     &context,
+	     seed,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_xxh64_update(
+	     &context,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_xxh64_finalize(
+	     &context,
+	     hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
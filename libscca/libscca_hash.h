@@ -0,0 +1,91 @@
+/*
+ * Hash functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_HASH_H )
+#define _LIBSCCA_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a stripe of the XXH64 hash
+ */
+#define LIBSCCA_HASH_XXH64_STRIPE_SIZE		32
+
+typedef struct libscca_hash_xxh64_context libscca_hash_xxh64_context_t;
+
+struct libscca_hash_xxh64_context
+{
+	/* The accumulators
+	 */
+	uint64_t accumulators[ 4 ];
+
+	/* The seed
+	 */
+	uint64_t seed;
+
+	/* The total number of bytes hashed
+	 */
+	uint64_t total_data_size;
+
+	/* The data that does not fill a stripe yet
+	 */
+	uint8_t buffer[ LIBSCCA_HASH_XXH64_STRIPE_SIZE ];
+
+	/* The number of bytes in the buffer
+	 */
+	size_t buffer_size;
+};
+
+int libscca_hash_xxh64_initialize(
+     libscca_hash_xxh64_context_t *context,
+     uint64_t seed,
+     libcerror_error_t **error );
+
+int libscca_hash_xxh64_update(
+     libscca_hash_xxh64_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_hash_xxh64_finalize(
+     libscca_hash_xxh64_context_t *context,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+int libscca_hash_calculate_xxh64(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t seed,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_HASH_H ) */
+
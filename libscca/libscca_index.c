@@ -0,0 +1,3585 @@
+/*
+ * Filename index functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_file_metrics.h"
+#include "libscca_hash.h"
+#include "libscca_index.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_mapped_file.h"
+#include "libscca_memory.h"
+
+#include "scca_index_header.h"
+
+/* Determines the size of the data aligned to 8 bytes
+ */
+#define libscca_index_align_size( size ) \
+	( ( ( size ) + 7 ) & ~( (uint64_t) 7 ) )
+
+/* Creates an index
+ * Make sure the value index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_initialize(
+     libscca_index_t **index,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_initialize";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = memory_allocate_structure(
+	                  libscca_internal_index_t );
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_index,
+	     0,
+	     sizeof( libscca_internal_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		memory_free(
+		 internal_index );
+
+		return( -1 );
+	}
+	*index = (libscca_index_t *) internal_index;
+
+	return( 1 );
+}
+
+/* Frees an index
+ * The data the index was opened from is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_free(
+     libscca_index_t **index,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_free";
+	int result                               = 1;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		internal_index = (libscca_internal_index_t *) *index;
+		*index         = NULL;
+
+		if( internal_index->strings != NULL )
+		{
+			memory_free(
+			 internal_index->strings );
+		}
+		if( internal_index->hash_table != NULL )
+		{
+			memory_free(
+			 internal_index->hash_table );
+		}
+		if( internal_index->string_data != NULL )
+		{
+			memory_free(
+			 internal_index->string_data );
+		}
+		if( internal_index->postings != NULL )
+		{
+			memory_free(
+			 internal_index->postings );
+		}
+		if( internal_index->files != NULL )
+		{
+			memory_free(
+			 internal_index->files );
+		}
+		if( internal_index->label_data != NULL )
+		{
+			memory_free(
+			 internal_index->label_data );
+		}
+		if( internal_index->utf8_filename != NULL )
+		{
+			memory_free(
+			 internal_index->utf8_filename );
+		}
+		if( internal_index->file_data != NULL )
+		{
+			memory_free(
+			 internal_index->file_data );
+		}
+		if( internal_index->mapped_file != NULL )
+		{
+			if( libscca_mapped_file_free(
+			     &( internal_index->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_index );
+	}
+	return( result );
+}
+
+/* Makes sure a buffer of the index that is being built has at least the required size
+ * The buffer grows by doubling its size, it is not limited to MEMORY_MAXIMUM_ALLOCATION_SIZE
+ * since the index covers many files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_reserve(
+     void **buffer,
+     size_t *allocated_size,
+     size_t required_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libscca_internal_index_reserve";
+	size_t new_size       = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_size <= *allocated_size )
+	{
+		return( 1 );
+	}
+	new_size = *allocated_size;
+
+	if( new_size < 4096 )
+	{
+		new_size = 4096;
+	}
+	while( new_size < required_size )
+	{
+		if( new_size > ( (size_t) SSIZE_MAX / 2 ) )
+		{
+			new_size = required_size;
+
+			break;
+		}
+		new_size *= 2;
+	}
+	reallocation = memory_reallocate(
+	                *buffer,
+	                new_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer         = reallocation;
+	*allocated_size = new_size;
+
+	return( 1 );
+}
+
+/* Resizes the hash table of the index that is being built
+ * The strings are re-inserted using linear probing
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_resize_hash_table(
+     libscca_internal_index_t *internal_index,
+     uint32_t hash_table_size,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table  = NULL;
+	static char *function = "libscca_internal_index_resize_hash_table";
+	uint32_t bucket_index = 0;
+	uint32_t string_index = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table size must be a power of 2 and larger than the number of strings
+	 */
+	if( ( hash_table_size == 0 )
+	 || ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 )
+	 || ( hash_table_size <= internal_index->number_of_strings )
+	 || ( (size_t) hash_table_size > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table = (uint32_t *) memory_allocate(
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 hash_table );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < internal_index->number_of_strings;
+	     string_index++ )
+	{
+		bucket_index = (uint32_t) ( internal_index->strings[ string_index ].hash & ( hash_table_size - 1 ) );
+
+		while( hash_table[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & ( hash_table_size - 1 );
+		}
+		hash_table[ bucket_index ] = string_index + 1;
+	}
+	if( internal_index->hash_table != NULL )
+	{
+		memory_free(
+		 internal_index->hash_table );
+	}
+	internal_index->hash_table      = hash_table;
+	internal_index->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Appends a string to the string dictionary of the index that is being built
+ * A string that is already in the dictionary is not appended again
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_append_string(
+     libscca_internal_index_t *internal_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *string_index,
+     libcerror_error_t **error )
+{
+	libscca_index_string_t *string = NULL;
+	static char *function          = "libscca_internal_index_append_string";
+	uint64_t hash                  = 0;
+	uint32_t bucket_index          = 0;
+	uint32_t entry_value           = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     utf8_string,
+	     utf8_string_length,
+	     0,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate string hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->hash_table == NULL )
+	{
+		if( libscca_internal_index_resize_hash_table(
+		     internal_index,
+		     LIBSCCA_INDEX_MINIMUM_HASH_TABLE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to create hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (uint32_t) ( hash & ( internal_index->hash_table_size - 1 ) );
+
+	while( internal_index->hash_table[ bucket_index ] != 0 )
+	{
+		entry_value = internal_index->hash_table[ bucket_index ];
+		string      = &( internal_index->strings[ entry_value - 1 ] );
+
+		if( ( string->hash == hash )
+		 && ( (size_t) string->string_size == utf8_string_length )
+		 && ( memory_compare(
+		       &( internal_index->string_data[ string->string_offset ] ),
+		       utf8_string,
+		       utf8_string_length ) == 0 ) )
+		{
+			*string_index = entry_value - 1;
+
+			return( 1 );
+		}
+		bucket_index = ( bucket_index + 1 ) & ( internal_index->hash_table_size - 1 );
+	}
+	if( internal_index->number_of_strings >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index - number of strings value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > ( (size_t) UINT32_MAX - internal_index->string_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index - string data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load of the hash table at most 50%
+	 */
+	if( ( internal_index->number_of_strings + 1 ) > ( internal_index->hash_table_size / 2 ) )
+	{
+		if( libscca_internal_index_resize_hash_table(
+		     internal_index,
+		     internal_index->hash_table_size * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_index = (uint32_t) ( hash & ( internal_index->hash_table_size - 1 ) );
+
+		while( internal_index->hash_table[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & ( internal_index->hash_table_size - 1 );
+		}
+	}
+	if( libscca_internal_index_reserve(
+	     (void **) &( internal_index->strings ),
+	     &( internal_index->strings_allocated_size ),
+	     sizeof( libscca_index_string_t ) * ( (size_t) internal_index->number_of_strings + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_reserve(
+	     (void **) &( internal_index->string_data ),
+	     &( internal_index->string_data_allocated_size ),
+	     internal_index->string_data_size + utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_index->string_data[ internal_index->string_data_size ] ),
+		     utf8_string,
+		     utf8_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string = &( internal_index->strings[ internal_index->number_of_strings ] );
+
+	string->string_offset      = (uint32_t) internal_index->string_data_size;
+	string->string_size        = (uint32_t) utf8_string_length;
+	string->hash               = hash;
+	string->number_of_postings = 0;
+
+	internal_index->string_data_size += utf8_string_length;
+
+	*string_index = internal_index->number_of_strings;
+
+	internal_index->hash_table[ bucket_index ] = internal_index->number_of_strings + 1;
+
+	internal_index->number_of_strings += 1;
+
+	return( 1 );
+}
+
+/* Appends a posting to the index that is being built
+ * The posting refers to the file that is being appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_append_posting(
+     libscca_internal_index_t *internal_index,
+     uint32_t string_index,
+     uint32_t metrics_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_index_append_posting";
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_append_file_posting(
+	     internal_index,
+	     string_index,
+	     internal_index->number_of_files,
+	     metrics_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append posting.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a posting of a specific file to the index that is being built
+ * The file is either the file that is being appended or a file that was appended before
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_append_file_posting(
+     libscca_internal_index_t *internal_index,
+     uint32_t string_index,
+     uint32_t file_index,
+     uint32_t metrics_entry_index,
+     libcerror_error_t **error )
+{
+	libscca_index_posting_t *posting = NULL;
+	static char *function            = "libscca_internal_index_append_file_posting";
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index >= internal_index->number_of_strings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index > internal_index->number_of_files )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->number_of_postings >= (uint64_t) ( (size_t) SSIZE_MAX / sizeof( libscca_index_posting_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index - number of postings value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_reserve(
+	     (void **) &( internal_index->postings ),
+	     &( internal_index->postings_allocated_size ),
+	     sizeof( libscca_index_posting_t ) * ( (size_t) internal_index->number_of_postings + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize postings.",
+		 function );
+
+		return( -1 );
+	}
+	posting = &( internal_index->postings[ internal_index->number_of_postings ] );
+
+	posting->string_index        = string_index;
+	posting->file_index          = file_index;
+	posting->metrics_entry_index = metrics_entry_index;
+
+	internal_index->strings[ string_index ].number_of_postings += 1;
+
+	internal_index->number_of_postings += 1;
+
+	return( 1 );
+}
+
+/* Appends a file entry to the index that is being built
+ * The file entry completes the file that is being appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_append_file_entry(
+     libscca_internal_index_t *internal_index,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_index_append_file_entry";
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_label == NULL )
+	 && ( utf8_label_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 label.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_label_length > ( (size_t) UINT32_MAX - internal_index->label_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 label length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->number_of_files >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index - number of files value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_reserve(
+	     (void **) &( internal_index->files ),
+	     &( internal_index->files_allocated_size ),
+	     sizeof( libscca_index_file_t ) * ( (size_t) internal_index->number_of_files + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize files.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_label_length > 0 )
+	{
+		if( libscca_internal_index_reserve(
+		     (void **) &( internal_index->label_data ),
+		     &( internal_index->label_data_allocated_size ),
+		     internal_index->label_data_size + utf8_label_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize label data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( internal_index->label_data[ internal_index->label_data_size ] ),
+		     utf8_label,
+		     utf8_label_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy label.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_index->files[ internal_index->number_of_files ].label_offset = (uint32_t) internal_index->label_data_size;
+	internal_index->files[ internal_index->number_of_files ].label_size   = (uint32_t) utf8_label_length;
+
+	internal_index->label_data_size += utf8_label_length;
+	internal_index->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Appends a file to the index that is being built
+ * Every file metrics entry of the file adds a posting to the string of its filename
+ * The label identifies the file in the index, for example its path, and is optional
+ * The file can be closed once it has been appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_append_file(
+     libscca_index_t *index,
+     libscca_file_t *file,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     libcerror_error_t **error )
+{
+	libscca_file_metrics_t *file_metrics     = NULL;
+	libscca_index_posting_t *posting         = NULL;
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_append_file";
+	size_t utf8_filename_size                = 0;
+	uint64_t number_of_postings              = 0;
+	uint32_t string_index                    = 0;
+	int entry_index                          = 0;
+	int number_of_entries                    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_label == NULL )
+	 && ( utf8_label_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 label.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		return( -1 );
+	}
+	/* The postings are removed again if the file cannot be appended as a whole
+	 * the strings remain in the dictionary without postings
+	 */
+	number_of_postings = internal_index->number_of_postings;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_file_get_file_metrics_entry(
+		     file,
+		     entry_index,
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_file_metrics_get_utf8_filename_size(
+		     file_metrics,
+		     &utf8_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d UTF-8 filename size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* Entries without a filename are not indexed
+		 */
+		if( utf8_filename_size <= 1 )
+		{
+			continue;
+		}
+		if( utf8_filename_size > internal_index->utf8_filename_size )
+		{
+			if( libscca_internal_index_reserve(
+			     (void **) &( internal_index->utf8_filename ),
+			     &( internal_index->utf8_filename_size ),
+			     utf8_filename_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize UTF-8 filename.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libscca_file_metrics_get_utf8_filename(
+		     file_metrics,
+		     internal_index->utf8_filename,
+		     utf8_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d UTF-8 filename.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_internal_index_append_string(
+		     internal_index,
+		     internal_index->utf8_filename,
+		     utf8_filename_size - 1,
+		     &string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file metrics entry: %d filename.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_internal_index_append_posting(
+		     internal_index,
+		     string_index,
+		     (uint32_t) entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file metrics entry: %d posting.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_internal_index_append_file_entry(
+	     internal_index,
+	     utf8_label,
+	     utf8_label_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	while( internal_index->number_of_postings > number_of_postings )
+	{
+		internal_index->number_of_postings -= 1;
+
+		posting = &( internal_index->postings[ internal_index->number_of_postings ] );
+
+		internal_index->strings[ posting->string_index ].number_of_postings -= 1;
+	}
+	return( -1 );
+}
+
+/* Appends the files of an index that was opened to the index that is being built
+ * The postings are appended per string of the source index, hence a filename
+ * that is stored in both indexes is stored once, which allows to merge indexes
+ * The files of the source index are appended after the files that were already
+ * appended and strings without postings are not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_append_index(
+     libscca_index_t *index,
+     libscca_index_t *source_index,
+     libcerror_error_t **error )
+{
+	libscca_index_posting_t *posting                = NULL;
+	libscca_internal_index_t *internal_index        = NULL;
+	libscca_internal_index_t *internal_source_index = NULL;
+	const uint8_t *entry_data                       = NULL;
+	const uint8_t *utf8_string                      = NULL;
+	static char *function                           = "libscca_index_append_index";
+	size_t label_data_size                          = 0;
+	size_t utf8_string_length                       = 0;
+	uint64_t first_posting_index                    = 0;
+	uint64_t number_of_postings                     = 0;
+	uint64_t posting_index                          = 0;
+	uint64_t previous_number_of_postings            = 0;
+	uint32_t file_index                             = 0;
+	uint32_t first_file_index                       = 0;
+	uint32_t metrics_entry_index                    = 0;
+	uint32_t string_index                           = 0;
+	int source_file_index                           = 0;
+	int source_string_index                         = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_index = (libscca_internal_index_t *) source_index;
+
+	if( internal_source_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_source_index->number_of_files > ( (uint32_t) INT_MAX - internal_index->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid source index - number of files value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The files and postings are removed again if the source index cannot be appended
+	 * as a whole, the strings remain in the dictionary without postings
+	 */
+	first_file_index            = internal_index->number_of_files;
+	label_data_size             = internal_index->label_data_size;
+	previous_number_of_postings = internal_index->number_of_postings;
+
+	for( source_file_index = 0;
+	     (uint32_t) source_file_index < internal_source_index->number_of_files;
+	     source_file_index++ )
+	{
+		if( libscca_internal_index_get_file_label(
+		     internal_source_index,
+		     source_file_index,
+		     &utf8_string,
+		     &utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source file: %d label.",
+			 function,
+			 source_file_index );
+
+			goto on_error;
+		}
+		if( libscca_internal_index_append_file_entry(
+		     internal_index,
+		     utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source file: %d entry.",
+			 function,
+			 source_file_index );
+
+			goto on_error;
+		}
+	}
+	for( source_string_index = 0;
+	     (uint32_t) source_string_index < internal_source_index->number_of_strings;
+	     source_string_index++ )
+	{
+		if( libscca_internal_index_get_postings_range(
+		     internal_source_index,
+		     source_string_index,
+		     &first_posting_index,
+		     &number_of_postings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source string: %d postings range.",
+			 function,
+			 source_string_index );
+
+			goto on_error;
+		}
+		if( number_of_postings == 0 )
+		{
+			continue;
+		}
+		if( libscca_internal_index_get_string(
+		     internal_source_index,
+		     source_string_index,
+		     &utf8_string,
+		     &utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source string: %d.",
+			 function,
+			 source_string_index );
+
+			goto on_error;
+		}
+		if( libscca_internal_index_append_string(
+		     internal_index,
+		     utf8_string,
+		     utf8_string_length,
+		     &string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source string: %d.",
+			 function,
+			 source_string_index );
+
+			goto on_error;
+		}
+		entry_data = &( internal_source_index->data[ internal_source_index->postings_offset + ( (size_t) first_posting_index * sizeof( scca_index_posting_t ) ) ] );
+
+		for( posting_index = 0;
+		     posting_index < number_of_postings;
+		     posting_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_index_posting_t *) entry_data )->file_index,
+			 file_index );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_index_posting_t *) entry_data )->metrics_entry_index,
+			 metrics_entry_index );
+
+			entry_data += sizeof( scca_index_posting_t );
+
+			if( file_index >= internal_source_index->number_of_files )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid source posting: %" PRIu64 " file index value out of bounds.",
+				 function,
+				 first_posting_index + posting_index );
+
+				goto on_error;
+			}
+			if( libscca_internal_index_append_file_posting(
+			     internal_index,
+			     string_index,
+			     first_file_index + file_index,
+			     metrics_entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append source posting: %" PRIu64 ".",
+				 function,
+				 first_posting_index + posting_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	while( internal_index->number_of_postings > previous_number_of_postings )
+	{
+		internal_index->number_of_postings -= 1;
+
+		posting = &( internal_index->postings[ internal_index->number_of_postings ] );
+
+		internal_index->strings[ posting->string_index ].number_of_postings -= 1;
+	}
+	internal_index->number_of_files = first_file_index;
+	internal_index->label_data_size = label_data_size;
+
+	return( -1 );
+}
+
+/* Determines the layout of the data of the index that is being built
+ * The sections are stored in the order: header, string entries, hash table,
+ * postings, file entries, string data and label data
+ * The string entries, hash table and postings are 8-byte aligned when the data is
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_get_layout(
+     libscca_internal_index_t *internal_index,
+     size_t *strings_offset,
+     size_t *hash_table_offset,
+     size_t *postings_offset,
+     size_t *files_offset,
+     size_t *string_data_offset,
+     size_t *label_data_offset,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_index_get_layout";
+	uint64_t offset       = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( strings_offset == NULL )
+	 || ( hash_table_offset == NULL )
+	 || ( postings_offset == NULL )
+	 || ( files_offset == NULL )
+	 || ( string_data_offset == NULL )
+	 || ( label_data_offset == NULL )
+	 || ( data_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of postings is bounded by the postings allocated in memory
+	 * which keeps the offsets below from overflowing
+	 */
+	offset = libscca_index_align_size( (uint64_t) sizeof( scca_index_header_t ) );
+
+	*strings_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_index->number_of_strings * sizeof( scca_index_string_entry_t );
+
+	*hash_table_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_index->hash_table_size * sizeof( uint32_t );
+	offset  = libscca_index_align_size( offset );
+
+	*postings_offset = (size_t) offset;
+
+	offset += internal_index->number_of_postings * sizeof( scca_index_posting_t );
+
+	*files_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_index->number_of_files * sizeof( scca_index_file_entry_t );
+
+	*string_data_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_index->string_data_size;
+	offset  = libscca_index_align_size( offset );
+
+	*label_data_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_index->label_data_size;
+
+	if( offset > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data of the index that is being built
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_data_size(
+     libscca_index_t *index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_get_data_size";
+	size_t files_offset                      = 0;
+	size_t hash_table_offset                 = 0;
+	size_t label_data_offset                 = 0;
+	size_t postings_offset                   = 0;
+	size_t string_data_offset                = 0;
+	size_t strings_offset                    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_get_layout(
+	     internal_index,
+	     &strings_offset,
+	     &hash_table_offset,
+	     &postings_offset,
+	     &files_offset,
+	     &string_data_offset,
+	     &label_data_offset,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the data of the index that is being built
+ * The postings are grouped by string, in the order the files were appended,
+ * so that the postings of a filename can be read without searching
+ * The data can be opened by libscca_index_open_data or, once stored in a file,
+ * by libscca_index_open
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_write_data(
+     libscca_index_t *index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_index_posting_t *posting         = NULL;
+	libscca_index_string_t *string           = NULL;
+	libscca_internal_index_t *internal_index = NULL;
+	scca_index_header_t *index_header        = NULL;
+	uint8_t *entry_data                      = NULL;
+	uint64_t *posting_indexes                = NULL;
+	static char *function                    = "libscca_index_write_data";
+	size_t files_offset                      = 0;
+	size_t hash_table_offset                 = 0;
+	size_t label_data_offset                 = 0;
+	size_t postings_offset                   = 0;
+	size_t required_data_size                = 0;
+	size_t string_data_offset                = 0;
+	size_t strings_offset                    = 0;
+	uint64_t first_posting_index             = 0;
+	uint64_t posting_index                   = 0;
+	uint32_t bucket_index                    = 0;
+	uint32_t file_index                      = 0;
+	uint32_t string_index                    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_get_layout(
+	     internal_index,
+	     &strings_offset,
+	     &hash_table_offset,
+	     &postings_offset,
+	     &files_offset,
+	     &string_data_offset,
+	     &label_data_offset,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->number_of_strings > 0 )
+	{
+		/* The index of the next posting of every string while the postings are grouped
+		 */
+		posting_indexes = (uint64_t *) memory_allocate(
+		                                sizeof( uint64_t ) * internal_index->number_of_strings );
+
+		if( posting_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create posting indexes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Clear the data so that the alignment padding is deterministic
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     required_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	index_header = (scca_index_header_t *) data;
+
+	if( memory_copy(
+	     index_header->signature,
+	     "SCCAINDX",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_header->format_version,
+	 LIBSCCA_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_header->number_of_files,
+	 internal_index->number_of_files );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_header->number_of_strings,
+	 internal_index->number_of_strings );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_header->hash_table_size,
+	 internal_index->hash_table_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->number_of_postings,
+	 internal_index->number_of_postings );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->strings_offset,
+	 (uint64_t) strings_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->hash_table_offset,
+	 (uint64_t) hash_table_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->postings_offset,
+	 (uint64_t) postings_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->files_offset,
+	 (uint64_t) files_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->string_data_offset,
+	 (uint64_t) string_data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->string_data_size,
+	 (uint64_t) internal_index->string_data_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->label_data_offset,
+	 (uint64_t) label_data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_header->label_data_size,
+	 (uint64_t) internal_index->label_data_size );
+
+	entry_data = &( data[ strings_offset ] );
+
+	for( string_index = 0;
+	     string_index < internal_index->number_of_strings;
+	     string_index++ )
+	{
+		string = &( internal_index->strings[ string_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_index_string_entry_t *) entry_data )->string_offset,
+		 string->string_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_index_string_entry_t *) entry_data )->string_size,
+		 string->string_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (scca_index_string_entry_t *) entry_data )->first_posting_index,
+		 first_posting_index );
+
+		posting_indexes[ string_index ] = first_posting_index;
+
+		first_posting_index += string->number_of_postings;
+
+		entry_data += sizeof( scca_index_string_entry_t );
+	}
+	entry_data = &( data[ hash_table_offset ] );
+
+	for( bucket_index = 0;
+	     bucket_index < internal_index->hash_table_size;
+	     bucket_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_data,
+		 internal_index->hash_table[ bucket_index ] );
+
+		entry_data += sizeof( uint32_t );
+	}
+	for( posting_index = 0;
+	     posting_index < internal_index->number_of_postings;
+	     posting_index++ )
+	{
+		posting = &( internal_index->postings[ posting_index ] );
+
+		entry_data = &( data[ postings_offset + ( (size_t) posting_indexes[ posting->string_index ] * sizeof( scca_index_posting_t ) ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_index_posting_t *) entry_data )->file_index,
+		 posting->file_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_index_posting_t *) entry_data )->metrics_entry_index,
+		 posting->metrics_entry_index );
+
+		posting_indexes[ posting->string_index ] += 1;
+	}
+	entry_data = &( data[ files_offset ] );
+
+	for( file_index = 0;
+	     file_index < internal_index->number_of_files;
+	     file_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_index_file_entry_t *) entry_data )->label_offset,
+		 internal_index->files[ file_index ].label_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_index_file_entry_t *) entry_data )->label_size,
+		 internal_index->files[ file_index ].label_size );
+
+		entry_data += sizeof( scca_index_file_entry_t );
+	}
+	if( internal_index->string_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ string_data_offset ] ),
+		     internal_index->string_data,
+		     internal_index->string_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_index->label_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ label_data_offset ] ),
+		     internal_index->label_data,
+		     internal_index->label_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy label data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( posting_indexes != NULL )
+	{
+		memory_free(
+		 posting_indexes );
+	}
+	return( 1 );
+
+on_error:
+	if( posting_indexes != NULL )
+	{
+		memory_free(
+		 posting_indexes );
+	}
+	return( -1 );
+}
+
+/* Opens an index from data
+ * The data is created by libscca_index_write_data
+ * The data is referenced by the index and must remain available until
+ * the index is freed, which allows the data to be memory mapped
+ * Only the header is validated, the entries are validated when they are accessed
+ * so that opening does not depend on the size of the index
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_open_data(
+     libscca_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	scca_index_header_t *index_header        = NULL;
+	static char *function                    = "libscca_index_open_data";
+	uint64_t files_offset                    = 0;
+	uint64_t hash_table_offset               = 0;
+	uint64_t label_data_offset               = 0;
+	uint64_t label_data_size                 = 0;
+	uint64_t number_of_postings              = 0;
+	uint64_t postings_offset                 = 0;
+	uint64_t string_data_offset              = 0;
+	uint64_t string_data_size                = 0;
+	uint64_t strings_offset                  = 0;
+	uint32_t format_version                  = 0;
+	uint32_t hash_table_size                 = 0;
+	uint32_t number_of_files                 = 0;
+	uint32_t number_of_strings               = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_index->number_of_files != 0 )
+	 || ( internal_index->number_of_strings != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - index is being built.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( scca_index_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	index_header = (scca_index_header_t *) data;
+
+	if( memory_compare(
+	     index_header->signature,
+	     "SCCAINDX",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header->number_of_files,
+	 number_of_files );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header->number_of_strings,
+	 number_of_strings );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_header->hash_table_size,
+	 hash_table_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->number_of_postings,
+	 number_of_postings );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->strings_offset,
+	 strings_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->hash_table_offset,
+	 hash_table_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->postings_offset,
+	 postings_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->files_offset,
+	 files_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->string_data_offset,
+	 string_data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->string_data_size,
+	 string_data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->label_data_offset,
+	 label_data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_header->label_data_size,
+	 label_data_size );
+
+	if( format_version != LIBSCCA_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported index format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( ( number_of_files > (uint32_t) INT_MAX )
+	 || ( number_of_strings > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files or strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table size must be a power of 2 and larger than the number of strings
+	 */
+	if( ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 )
+	 || ( ( number_of_strings > 0 )
+	  &&  ( hash_table_size <= number_of_strings ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The section sizes are calculated with 64-bit values and the counts
+	 * are limited to 32-bit except for the number of postings
+	 */
+	if( ( strings_offset < sizeof( scca_index_header_t ) )
+	 || ( strings_offset > (uint64_t) data_size )
+	 || ( ( (uint64_t) number_of_strings * sizeof( scca_index_string_entry_t ) ) > ( (uint64_t) data_size - strings_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid strings offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_table_offset < sizeof( scca_index_header_t ) )
+	 || ( hash_table_offset > (uint64_t) data_size )
+	 || ( ( (uint64_t) hash_table_size * sizeof( uint32_t ) ) > ( (uint64_t) data_size - hash_table_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( postings_offset < sizeof( scca_index_header_t ) )
+	 || ( postings_offset > (uint64_t) data_size )
+	 || ( number_of_postings > ( ( (uint64_t) data_size - postings_offset ) / sizeof( scca_index_posting_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid postings offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( files_offset < sizeof( scca_index_header_t ) )
+	 || ( files_offset > (uint64_t) data_size )
+	 || ( ( (uint64_t) number_of_files * sizeof( scca_index_file_entry_t ) ) > ( (uint64_t) data_size - files_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid files offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_data_offset < sizeof( scca_index_header_t ) )
+	 || ( string_data_offset > (uint64_t) data_size )
+	 || ( string_data_size > ( (uint64_t) data_size - string_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( label_data_offset < sizeof( scca_index_header_t ) )
+	 || ( label_data_offset > (uint64_t) data_size )
+	 || ( label_data_size > ( (uint64_t) data_size - label_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid label data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index->data               = data;
+	internal_index->data_size          = data_size;
+	internal_index->number_of_files    = number_of_files;
+	internal_index->number_of_strings  = number_of_strings;
+	internal_index->hash_table_size    = hash_table_size;
+	internal_index->number_of_postings = number_of_postings;
+	internal_index->string_data_size   = (size_t) string_data_size;
+	internal_index->label_data_size    = (size_t) label_data_size;
+	internal_index->strings_offset     = (size_t) strings_offset;
+	internal_index->hash_table_offset  = (size_t) hash_table_offset;
+	internal_index->postings_offset    = (size_t) postings_offset;
+	internal_index->files_offset       = (size_t) files_offset;
+	internal_index->string_data_offset = (size_t) string_data_offset;
+	internal_index->label_data_offset  = (size_t) label_data_offset;
+
+	return( 1 );
+}
+
+/* Opens an index from a file
+ * The file is memory mapped when supported, otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_open(
+     libscca_index_t *index,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_open";
+	int result                               = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->mapped_file == NULL )
+	{
+		if( libscca_mapped_file_initialize(
+		     &( internal_index->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libscca_mapped_file_open(
+	          internal_index->mapped_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libscca_index_open_data(
+		     index,
+		     internal_index->mapped_file->data,
+		     internal_index->mapped_file->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_index_read_file_io_handle(
+	     internal_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( internal_index->mapped_file != NULL )
+	 && ( internal_index->data == NULL ) )
+	{
+		libscca_mapped_file_close(
+		 internal_index->mapped_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens an index from a file
+ * The file is memory mapped when supported, otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_open_wide(
+     libscca_index_t *index,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_open_wide";
+	int result                               = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->mapped_file == NULL )
+	{
+		if( libscca_mapped_file_initialize(
+		     &( internal_index->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libscca_mapped_file_open_wide(
+	          internal_index->mapped_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libscca_index_open_data(
+		     index,
+		     internal_index->mapped_file->data,
+		     internal_index->mapped_file->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index: %ls.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_index_read_file_io_handle(
+	     internal_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( internal_index->mapped_file != NULL )
+	 && ( internal_index->data == NULL ) )
+	{
+		libscca_mapped_file_close(
+		 internal_index->mapped_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the data of an index from a file IO handle into memory and opens the index from it
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_read_file_io_handle(
+     libscca_internal_index_t *internal_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_internal_index_read_file_io_handle";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->file_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( scca_index_header_t ) )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index covers many files, hence it is not limited to MEMORY_MAXIMUM_ALLOCATION_SIZE
+	 */
+	internal_index->file_data = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * (size_t) file_size );
+
+	if( internal_index->file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              internal_index->file_data,
+	              (size_t) file_size,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_index_open_data(
+	     (libscca_index_t *) internal_index,
+	     internal_index->file_data,
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index from file data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( internal_index->file_data != NULL )
+	{
+		memory_free(
+		 internal_index->file_data );
+
+		internal_index->file_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_number_of_files(
+     libscca_index_t *index,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_get_number_of_files";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = (int) internal_index->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the label of a specific file of an index that was opened
+ * The label references the data of the index and is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_get_file_label(
+     libscca_internal_index_t *internal_index,
+     int file_index,
+     const uint8_t **utf8_label,
+     size_t *utf8_label_length,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data = NULL;
+	static char *function     = "libscca_internal_index_get_file_label";
+	uint32_t label_offset     = 0;
+	uint32_t label_size       = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( (uint32_t) file_index >= internal_index->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_label == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 label.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_label_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 label length.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_index->data[ internal_index->files_offset + ( (size_t) file_index * sizeof( scca_index_file_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_file_entry_t *) entry_data )->label_offset,
+	 label_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_file_entry_t *) entry_data )->label_size,
+	 label_size );
+
+	if( ( (size_t) label_offset > internal_index->label_data_size )
+	 || ( (size_t) label_size > ( internal_index->label_data_size - label_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file: %d value out of bounds.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	*utf8_label        = &( internal_index->data[ internal_index->label_data_offset + label_offset ] );
+	*utf8_label_length = (size_t) label_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded label of a specific file
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_utf8_file_label_size(
+     libscca_index_t *index,
+     int file_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	const uint8_t *entry_data                = NULL;
+	static char *function                    = "libscca_index_get_utf8_file_label_size";
+	uint32_t label_offset                    = 0;
+	uint32_t label_size                      = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( (uint32_t) file_index >= internal_index->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_index->data[ internal_index->files_offset + ( (size_t) file_index * sizeof( scca_index_file_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_file_entry_t *) entry_data )->label_offset,
+	 label_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_file_entry_t *) entry_data )->label_size,
+	 label_size );
+
+	if( ( (size_t) label_offset > internal_index->label_data_size )
+	 || ( (size_t) label_size > ( internal_index->label_data_size - label_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file: %d label value out of bounds.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	*utf8_string_size = (size_t) label_size + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded label of a specific file
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_utf8_file_label(
+     libscca_index_t *index,
+     int file_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	const uint8_t *entry_data                = NULL;
+	static char *function                    = "libscca_index_get_utf8_file_label";
+	size_t label_size                        = 0;
+	uint32_t label_offset                    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_index_get_utf8_file_label_size(
+	     index,
+	     file_index,
+	     &label_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d UTF-8 label size.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	if( utf8_string_size < label_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_index->data[ internal_index->files_offset + ( (size_t) file_index * sizeof( scca_index_file_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_file_entry_t *) entry_data )->label_offset,
+	 label_offset );
+
+	label_size -= 1;
+
+	if( label_size > 0 )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     &( internal_index->data[ internal_index->label_data_offset + label_offset ] ),
+		     label_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy label.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	utf8_string[ label_size ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_number_of_strings(
+     libscca_index_t *index,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	static char *function                    = "libscca_index_get_number_of_strings";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_strings = (int) internal_index->number_of_strings;
+
+	return( 1 );
+}
+
+/* Retrieves a specific string of an index that was opened
+ * The string references the data of the index and is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_get_string(
+     libscca_internal_index_t *internal_index,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data = NULL;
+	static char *function     = "libscca_internal_index_get_string";
+	uint32_t string_offset    = 0;
+	uint32_t string_size      = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( (uint32_t) string_index >= internal_index->number_of_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_index->data[ internal_index->strings_offset + ( (size_t) string_index * sizeof( scca_index_string_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_string_entry_t *) entry_data )->string_offset,
+	 string_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_string_entry_t *) entry_data )->string_size,
+	 string_size );
+
+	if( ( (size_t) string_offset > internal_index->string_data_size )
+	 || ( (size_t) string_size > ( internal_index->string_data_size - string_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string: %d value out of bounds.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	*utf8_string        = &( internal_index->data[ internal_index->string_data_offset + string_offset ] );
+	*utf8_string_length = (size_t) string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the string of a specific UTF-8 encoded filename
+ * The filename is compared case-sensitive, as stored in the file metrics entries
+ * Returns 1 if successful, 0 if no such filename or -1 on error
+ */
+int libscca_index_get_string_index_by_utf8_filename(
+     libscca_index_t *index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	const uint8_t *entry_data                = NULL;
+	static char *function                    = "libscca_index_get_string_index_by_utf8_filename";
+	uint64_t hash                            = 0;
+	uint32_t bucket_index                    = 0;
+	uint32_t entry_value                     = 0;
+	uint32_t number_of_probes                = 0;
+	uint32_t string_offset                   = 0;
+	uint32_t string_size                     = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( internal_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->hash_table_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     utf8_string,
+	     utf8_string_length,
+	     0,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate string hash.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (uint32_t) ( hash & ( internal_index->hash_table_size - 1 ) );
+
+	/* The number of probes is bounded in case the hash table is corrupted
+	 */
+	for( number_of_probes = 0;
+	     number_of_probes < internal_index->hash_table_size;
+	     number_of_probes++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_index->data[ internal_index->hash_table_offset + ( (size_t) bucket_index * sizeof( uint32_t ) ) ] ),
+		 entry_value );
+
+		if( entry_value == 0 )
+		{
+			break;
+		}
+		if( entry_value > internal_index->number_of_strings )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hash table entry: %" PRIu32 " value out of bounds.",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+		entry_data = &( internal_index->data[ internal_index->strings_offset + ( (size_t) ( entry_value - 1 ) * sizeof( scca_index_string_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_index_string_entry_t *) entry_data )->string_size,
+		 string_size );
+
+		if( (size_t) string_size == utf8_string_length )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_index_string_entry_t *) entry_data )->string_offset,
+			 string_offset );
+
+			if( ( (size_t) string_offset > internal_index->string_data_size )
+			 || ( (size_t) string_size > ( internal_index->string_data_size - string_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid string: %" PRIu32 " value out of bounds.",
+				 function,
+				 entry_value - 1 );
+
+				return( -1 );
+			}
+			if( memory_compare(
+			     &( internal_index->data[ internal_index->string_data_offset + string_offset ] ),
+			     utf8_string,
+			     utf8_string_length ) == 0 )
+			{
+				*string_index = (int) ( entry_value - 1 );
+
+				return( 1 );
+			}
+		}
+		bucket_index = ( bucket_index + 1 ) & ( internal_index->hash_table_size - 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the first posting and the number of postings of a specific string
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_index_get_postings_range(
+     libscca_internal_index_t *internal_index,
+     int string_index,
+     uint64_t *first_posting_index,
+     uint64_t *number_of_postings,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data   = NULL;
+	static char *function       = "libscca_internal_index_get_postings_range";
+	uint64_t last_posting_index = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( (uint32_t) string_index >= internal_index->number_of_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_posting_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first posting index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_postings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of postings.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_index->data[ internal_index->strings_offset + ( (size_t) string_index * sizeof( scca_index_string_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (scca_index_string_entry_t *) entry_data )->first_posting_index,
+	 *first_posting_index );
+
+	/* The postings of a string end where the postings of the next string start
+	 */
+	if( (uint32_t) string_index < ( internal_index->number_of_strings - 1 ) )
+	{
+		entry_data += sizeof( scca_index_string_entry_t );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (scca_index_string_entry_t *) entry_data )->first_posting_index,
+		 last_posting_index );
+	}
+	else
+	{
+		last_posting_index = internal_index->number_of_postings;
+	}
+	if( ( *first_posting_index > last_posting_index )
+	 || ( last_posting_index > internal_index->number_of_postings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string: %d postings value out of bounds.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	*number_of_postings = last_posting_index - *first_posting_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of postings of a specific string
+ * Every posting refers to a file metrics entry of a file that loaded the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_number_of_postings(
+     libscca_index_t *index,
+     int string_index,
+     uint64_t *number_of_postings,
+     libcerror_error_t **error )
+{
+	static char *function        = "libscca_index_get_number_of_postings";
+	uint64_t first_posting_index = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_get_postings_range(
+	     (libscca_internal_index_t *) index,
+	     string_index,
+	     &first_posting_index,
+	     number_of_postings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d postings range.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific posting of a specific string
+ * The postings of a string are stored in the order the files were appended
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_index_get_posting(
+     libscca_index_t *index,
+     int string_index,
+     uint64_t posting_index,
+     int *file_index,
+     int *metrics_entry_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_index_t *internal_index = NULL;
+	const uint8_t *entry_data                = NULL;
+	static char *function                    = "libscca_index_get_posting";
+	uint64_t first_posting_index             = 0;
+	uint64_t number_of_postings              = 0;
+	uint32_t value_32bit                     = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libscca_internal_index_t *) index;
+
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_index_get_postings_range(
+	     internal_index,
+	     string_index,
+	     &first_posting_index,
+	     &number_of_postings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d postings range.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( posting_index >= number_of_postings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid posting index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_index->data[ internal_index->postings_offset + ( (size_t) ( first_posting_index + posting_index ) * sizeof( scca_index_posting_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_posting_t *) entry_data )->file_index,
+	 value_32bit );
+
+	if( value_32bit >= internal_index->number_of_files )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid posting file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_index = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_index_posting_t *) entry_data )->metrics_entry_index,
+	 value_32bit );
+
+	if( value_32bit > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid posting metrics entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*metrics_entry_index = (int) value_32bit;
+
+	return( 1 );
+}
+
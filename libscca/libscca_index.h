@@ -0,0 +1,406 @@
+/*
+ * Filename index functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_INDEX_H )
+#define _LIBSCCA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_mapped_file.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of hash table entries
+ */
+#define LIBSCCA_INDEX_MINIMUM_HASH_TABLE_SIZE		1024
+
+typedef struct libscca_index_string libscca_index_string_t;
+
+struct libscca_index_string
+{
+	/* The offset of the string in the string data
+	 */
+	uint32_t string_offset;
+
+	/* The size of the UTF-8 string without the end of string character
+	 */
+	uint32_t string_size;
+
+	/* The XXH64 hash of the string
+	 */
+	uint64_t hash;
+
+	/* The number of postings
+	 */
+	uint64_t number_of_postings;
+};
+
+typedef struct libscca_index_posting libscca_index_posting_t;
+
+struct libscca_index_posting
+{
+	/* The index of the string
+	 */
+	uint32_t string_index;
+
+	/* The index of the file
+	 */
+	uint32_t file_index;
+
+	/* The index of the file metrics entry
+	 */
+	uint32_t metrics_entry_index;
+};
+
+typedef struct libscca_index_file libscca_index_file_t;
+
+struct libscca_index_file
+{
+	/* The offset of the label in the label data
+	 */
+	uint32_t label_offset;
+
+	/* The size of the UTF-8 label without the end of string character
+	 */
+	uint32_t label_size;
+};
+
+typedef struct libscca_internal_index libscca_internal_index_t;
+
+struct libscca_internal_index
+{
+	/* The strings of the index that is being built
+	 */
+	libscca_index_string_t *strings;
+
+	/* The allocated size of the strings
+	 */
+	size_t strings_allocated_size;
+
+	/* The hash table of the index that is being built
+	 * Contains the string index + 1 or 0 if the entry is not used
+	 */
+	uint32_t *hash_table;
+
+	/* The string data of the index that is being built
+	 */
+	uint8_t *string_data;
+
+	/* The allocated size of the string data
+	 */
+	size_t string_data_allocated_size;
+
+	/* The postings of the index that is being built
+	 */
+	libscca_index_posting_t *postings;
+
+	/* The allocated size of the postings
+	 */
+	size_t postings_allocated_size;
+
+	/* The files of the index that is being built
+	 */
+	libscca_index_file_t *files;
+
+	/* The allocated size of the files
+	 */
+	size_t files_allocated_size;
+
+	/* The label data of the index that is being built
+	 */
+	uint8_t *label_data;
+
+	/* The allocated size of the label data
+	 */
+	size_t label_data_allocated_size;
+
+	/* The UTF-8 filename buffer
+	 */
+	uint8_t *utf8_filename;
+
+	/* The UTF-8 filename buffer size
+	 */
+	size_t utf8_filename_size;
+
+	/* The mapped file of the index that was opened
+	 */
+	libscca_mapped_file_t *mapped_file;
+
+	/* The data of the index that was opened and read into memory
+	 */
+	uint8_t *file_data;
+
+	/* The data of the index that was opened
+	 * The data is referenced and not copied
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of files
+	 */
+	uint32_t number_of_files;
+
+	/* The number of strings
+	 */
+	uint32_t number_of_strings;
+
+	/* The number of hash table entries
+	 */
+	uint32_t hash_table_size;
+
+	/* The number of postings
+	 */
+	uint64_t number_of_postings;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+
+	/* The label data size
+	 */
+	size_t label_data_size;
+
+	/* The offset of the string entries in the data
+	 */
+	size_t strings_offset;
+
+	/* The offset of the hash table in the data
+	 */
+	size_t hash_table_offset;
+
+	/* The offset of the postings in the data
+	 */
+	size_t postings_offset;
+
+	/* The offset of the file entries in the data
+	 */
+	size_t files_offset;
+
+	/* The offset of the string data in the data
+	 */
+	size_t string_data_offset;
+
+	/* The offset of the label data in the data
+	 */
+	size_t label_data_offset;
+};
+
+LIBSCCA_EXTERN \
+int libscca_index_initialize(
+     libscca_index_t **index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_free(
+     libscca_index_t **index,
+     libcerror_error_t **error );
+
+int libscca_internal_index_reserve(
+     void **buffer,
+     size_t *allocated_size,
+     size_t required_size,
+     libcerror_error_t **error );
+
+int libscca_internal_index_resize_hash_table(
+     libscca_internal_index_t *internal_index,
+     uint32_t hash_table_size,
+     libcerror_error_t **error );
+
+int libscca_internal_index_append_string(
+     libscca_internal_index_t *internal_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *string_index,
+     libcerror_error_t **error );
+
+int libscca_internal_index_append_posting(
+     libscca_internal_index_t *internal_index,
+     uint32_t string_index,
+     uint32_t metrics_entry_index,
+     libcerror_error_t **error );
+
+int libscca_internal_index_append_file_posting(
+     libscca_internal_index_t *internal_index,
+     uint32_t string_index,
+     uint32_t file_index,
+     uint32_t metrics_entry_index,
+     libcerror_error_t **error );
+
+int libscca_internal_index_append_file_entry(
+     libscca_internal_index_t *internal_index,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_append_file(
+     libscca_index_t *index,
+     libscca_file_t *file,
+     const uint8_t *utf8_label,
+     size_t utf8_label_length,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_append_index(
+     libscca_index_t *index,
+     libscca_index_t *source_index,
+     libcerror_error_t **error );
+
+int libscca_internal_index_get_layout(
+     libscca_internal_index_t *internal_index,
+     size_t *strings_offset,
+     size_t *hash_table_offset,
+     size_t *postings_offset,
+     size_t *files_offset,
+     size_t *string_data_offset,
+     size_t *label_data_offset,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_data_size(
+     libscca_index_t *index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_write_data(
+     libscca_index_t *index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_open_data(
+     libscca_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_open(
+     libscca_index_t *index,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSCCA_EXTERN \
+int libscca_index_open_wide(
+     libscca_index_t *index,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libscca_internal_index_read_file_io_handle(
+     libscca_internal_index_t *internal_index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_number_of_files(
+     libscca_index_t *index,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+int libscca_internal_index_get_file_label(
+     libscca_internal_index_t *internal_index,
+     int file_index,
+     const uint8_t **utf8_label,
+     size_t *utf8_label_length,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_utf8_file_label_size(
+     libscca_index_t *index,
+     int file_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_utf8_file_label(
+     libscca_index_t *index,
+     int file_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_number_of_strings(
+     libscca_index_t *index,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+int libscca_internal_index_get_string(
+     libscca_internal_index_t *internal_index,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_string_index_by_utf8_filename(
+     libscca_index_t *index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *string_index,
+     libcerror_error_t **error );
+
+int libscca_internal_index_get_postings_range(
+     libscca_internal_index_t *internal_index,
+     int string_index,
+     uint64_t *first_posting_index,
+     uint64_t *number_of_postings,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_number_of_postings(
+     libscca_index_t *index,
+     int string_index,
+     uint64_t *number_of_postings,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_index_get_posting(
+     libscca_index_t *index,
+     int string_index,
+     uint64_t posting_index,
+     int *file_index,
+     int *metrics_entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_INDEX_H ) */
+
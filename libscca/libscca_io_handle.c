@@ -24,23 +24,26 @@
 #include <memory.h>
 #include <types.h>
 
-#include "libscca_compressed_block.h"
+#include "libscca_budget.h"
+#include "libscca_byte_stream.h"
 #include "libscca_debug.h"
 #include "libscca_definitions.h"
 #include "libscca_file_metrics.h"
+#include "libscca_file_metrics_values.h"
+#include "libscca_format_layout.h"
 #include "libscca_io_handle.h"
 #include "libscca_libbfio.h"
-#include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
 #include "libscca_libcnotify.h"
 #include "libscca_libfdatetime.h"
-#include "libscca_libfvalue.h"
 #include "libscca_libuna.h"
+#include "libscca_lzxpress.h"
+#include "libscca_memory.h"
+#include "libscca_statistics.h"
 #include "libscca_unused.h"
 #include "libscca_volume_information.h"
+#include "libscca_volumes.h"
 
-#include "scca_file_metrics_array.h"
-#include "scca_trace_chain_array.h"
 #include "scca_volume_information.h"
 
 const char *scca_file_signature           = "SCCA";
@@ -120,6 +123,7 @@ on_error:
 }
 
 /* Frees a IO handle
+ * The scratch buffers are released to the context, if set, so they can be reused by other files
  * Returns 1 if successful or -1 on error
  */
 int libscca_io_handle_free(
@@ -127,6 +131,7 @@ int libscca_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libscca_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -141,22 +146,148 @@ int libscca_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->context != NULL )
+		{
+			if( libscca_context_release_buffer(
+			     ( *io_handle )->context,
+			     LIBSCCA_CONTEXT_BUFFER_TYPE_COMPRESSED_DATA,
+			     &( ( *io_handle )->compressed_data ),
+			     &( ( *io_handle )->compressed_data_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release compressed data buffer to context.",
+				 function );
+
+				result = -1;
+			}
+			if( libscca_context_release_buffer(
+			     ( *io_handle )->context,
+			     LIBSCCA_CONTEXT_BUFFER_TYPE_UNCOMPRESSED_DATA,
+			     &( ( *io_handle )->uncompressed_data ),
+			     &( ( *io_handle )->uncompressed_data_buffer_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release uncompressed data buffer to context.",
+				 function );
+
+				result = -1;
+			}
+			if( libscca_context_release_buffer(
+			     ( *io_handle )->context,
+			     LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+			     &( ( *io_handle )->section_data ),
+			     &( ( *io_handle )->section_data_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release section data buffer to context.",
+				 function );
+
+				result = -1;
+			}
+			if( libscca_context_release_decoder_cache(
+			     ( *io_handle )->context,
+			     &( ( *io_handle )->decoder_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release decoder cache to context.",
+				 function );
+
+				result = -1;
+			}
+			if( libscca_context_detach_file(
+			     ( *io_handle )->context,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to detach file from context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->compressed_data );
+		}
+		if( ( *io_handle )->uncompressed_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->uncompressed_data );
+		}
+		if( ( *io_handle )->section_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->section_data );
+		}
+		if( ( *io_handle )->decoder_cache != NULL )
+		{
+			if( libscca_lzxpress_huffman_decoder_cache_free(
+			     &( ( *io_handle )->decoder_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decoder cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
+ * The compressed data, uncompressed data and section data buffers and
+ * the decoder cache are retained so they can be reused
  * Returns 1 if successful or -1 on error
  */
 int libscca_io_handle_clear(
      libscca_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libscca_io_handle_clear";
+	libscca_budget_t budget;
+
+	libscca_block_cache_t *block_cache                      = NULL;
+	libscca_internal_context_t *context                     = NULL;
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache = NULL;
+	libscca_string_pool_t *string_pool                      = NULL;
+	libscca_volume_dictionary_t *volume_dictionary          = NULL;
+	uint8_t *compressed_data                                = NULL;
+	uint8_t *section_data                                   = NULL;
+	uint8_t *uncompressed_data                              = NULL;
+	static char *function                                   = "libscca_io_handle_clear";
+	size_t compressed_data_size                             = 0;
+	size_t section_data_size                                = 0;
+	size_t uncompressed_data_buffer_size                    = 0;
+	int maximum_number_of_cached_blocks                     = 0;
+	int maximum_number_of_file_metrics_entries              = 0;
 
 	if( io_handle == NULL )
 	{
@@ -169,6 +300,21 @@ int libscca_io_handle_clear(
 
 		return( -1 );
 	}
+	compressed_data                        = io_handle->compressed_data;
+	compressed_data_size                   = io_handle->compressed_data_size;
+	uncompressed_data                      = io_handle->uncompressed_data;
+	uncompressed_data_buffer_size          = io_handle->uncompressed_data_buffer_size;
+	section_data                           = io_handle->section_data;
+	section_data_size                      = io_handle->section_data_size;
+	decoder_cache                          = io_handle->decoder_cache;
+	budget                                 = io_handle->budget;
+	maximum_number_of_cached_blocks        = io_handle->maximum_number_of_cached_blocks;
+	maximum_number_of_file_metrics_entries = io_handle->maximum_number_of_file_metrics_entries;
+	block_cache                            = io_handle->block_cache;
+	string_pool                            = io_handle->string_pool;
+	volume_dictionary                      = io_handle->volume_dictionary;
+	context                                = io_handle->context;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -183,22 +329,43 @@ int libscca_io_handle_clear(
 
 		return( -1 );
 	}
+	io_handle->compressed_data               = compressed_data;
+	io_handle->compressed_data_size          = compressed_data_size;
+	io_handle->uncompressed_data             = uncompressed_data;
+	io_handle->uncompressed_data_buffer_size = uncompressed_data_buffer_size;
+	io_handle->section_data                  = section_data;
+	io_handle->section_data_size             = section_data_size;
+	io_handle->decoder_cache                 = decoder_cache;
+
+	/* The budget limits apply to every open while the steps are counted per open
+	 */
+	io_handle->budget                        = budget;
+	io_handle->budget.number_of_steps        = 0;
+	io_handle->budget.deadline_exceeded      = 0;
+
+	/* The cache and file metrics settings apply to every open
+	 */
+	io_handle->maximum_number_of_cached_blocks        = maximum_number_of_cached_blocks;
+	io_handle->maximum_number_of_file_metrics_entries = maximum_number_of_file_metrics_entries;
+	io_handle->block_cache                            = block_cache;
+	io_handle->string_pool                            = string_pool;
+	io_handle->volume_dictionary                      = volume_dictionary;
+	io_handle->context                                = context;
+
 	return( 1 );
 }
 
-/* Reads the compressed file header
+/* Sets the format version and the corresponding format layout
  * Returns 1 if successful or -1 on error
  */
-int libscca_io_handle_read_compressed_file_header(
+int libscca_io_handle_set_format_version(
      libscca_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
+     uint32_t format_version,
      libcerror_error_t **error )
 {
-	uint8_t file_header_data[ 8 ];
-
-	static char *function = "libscca_io_handle_read_compressed_file_header";
-	size64_t file_size    = 0;
-	ssize_t read_count    = 0;
+	const libscca_format_layout_t *format_layout = NULL;
+	static char *function                        = "libscca_io_handle_set_format_version";
+	int result                                   = 0;
 
 	if( io_handle == NULL )
 	{
@@ -211,165 +378,139 @@ int libscca_io_handle_read_compressed_file_header(
 
 		return( -1 );
 	}
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &file_size,
-	     error ) != 1 )
+	result = libscca_format_layout_get_by_format_version(
+	          format_version,
+	          &format_layout,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 "%s: unable to retrieve format layout.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( file_size < 8 )
-	 || ( file_size > (size64_t) UINT32_MAX ) )
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file size value out of bounds.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
 
 		return( -1 );
 	}
-	io_handle->file_size = (uint32_t) file_size;
+	io_handle->format_version = format_version;
+	io_handle->format_layout  = format_layout;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading compressed file header at offset: 0 (0x00000000)\n",
-		 function );
-	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     0,
-	     SEEK_SET,
-	     error ) == -1 )
+	return( 1 );
+}
+
+/* Retrieves the compressed data scratch buffer
+ * The buffer is resized if it is smaller than the requested size
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_get_compressed_data_buffer(
+     libscca_io_handle_t *io_handle,
+     size_t compressed_data_size,
+     uint8_t **compressed_data,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "libscca_io_handle_get_compressed_data_buffer";
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file header offset: 0.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              file_header_data,
-	              8,
-	              error );
-
-	if( read_count != (ssize_t) 8 )
+	if( ( compressed_data_size == 0 )
+	 || ( compressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( memory_compare(
-	     &( file_header_data[ 4 ] ),
-	     scca_file_signature,
-	     4 ) == 0 )
-	{
-		io_handle->file_type= LIBSCCA_FILE_TYPE_UNCOMPRESSED;
-	}
-	else if( memory_compare(
-	          file_header_data,
-	          scca_mam_file_signature_win10,
-	          4 ) == 0 )
-	{
-		io_handle->file_type = LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10;
-	}
-	else
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported signature.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
-	{
-		io_handle->uncompressed_data_size = io_handle->file_size;
-	}
-	else if( io_handle->file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	if( compressed_data_size > io_handle->compressed_data_size )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: signature\t\t: %c%c%c\\x%02x\n",
-			 function,
-			 file_header_data[ 0 ],
-			 file_header_data[ 1 ],
-			 file_header_data[ 2 ],
-			 file_header_data[ 3 ] );
-		}
-#endif
-		byte_stream_copy_to_uint32_little_endian(
-		 &( file_header_data[ 4 ] ),
-		 io_handle->uncompressed_data_size );
+		reallocation = (uint8_t *) memory_reallocate(
+		                            io_handle->compressed_data,
+		                            sizeof( uint8_t ) * compressed_data_size );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( reallocation == NULL )
 		{
-			libcnotify_printf(
-			 "%s: uncompressed data size\t: %" PRIu32 "\n",
-			 function,
-			 io_handle->uncompressed_data_size );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize compressed data.",
+			 function );
+
+			return( -1 );
 		}
-#endif
-		if( io_handle->uncompressed_data_size != ( io_handle->file_size - 8 )  )
+		io_handle->compressed_data = reallocation;
+
+		if( libscca_statistics_add_allocation(
+		     &( io_handle->statistics ),
+		     compressed_data_size - io_handle->compressed_data_size,
+		     error ) != 1 )
 		{
-/* TODO flag mismatch and file as corrupted? */
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add compressed data allocation.",
+			 function );
+
+			return( -1 );
 		}
+		io_handle->compressed_data_size = compressed_data_size;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
+	*compressed_data = io_handle->compressed_data;
+
 	return( 1 );
 }
 
-/* Reads the compressed blocks
+/* Retrieves the uncompressed data buffer
+ * The buffer is resized if it is smaller than the requested size
  * Returns 1 if successful or -1 on error
  */
-int libscca_io_handle_read_compressed_blocks(
+int libscca_io_handle_get_uncompressed_data_buffer(
      libscca_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_list_t *compressed_blocks_list,
-     libfcache_cache_t *compressed_blocks_cache,
+     size_t uncompressed_data_size,
+     uint8_t **uncompressed_data,
      libcerror_error_t **error )
 {
-	libfdata_list_element_t *compressed_blocks_list_element = NULL;
-	libscca_compressed_block_t *compressed_block            = NULL;
-	static char *function                                   = "libscca_io_handle_read_compressed_blocks";
-	off64_t file_offset                                     = 0;
-	size64_t compressed_data_size                           = 0;
-	ssize_t read_count                                      = 0;
-	uint32_t uncompressed_data_size                         = 0;
-	uint32_t uncompressed_block_size                        = 0;
-	int compressed_block_index                              = 0;
-	int element_index                                       = 0;
+	uint8_t *reallocation = NULL;
+	static char *function = "libscca_io_handle_get_uncompressed_data_buffer";
 
 	if( io_handle == NULL )
 	{
@@ -382,175 +523,81 @@ int libscca_io_handle_read_compressed_blocks(
 
 		return( -1 );
 	}
-	if( io_handle->file_type != LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid IO handle - unsupported file type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	file_offset = 8;
-
-	uncompressed_data_size = io_handle->uncompressed_data_size;
-	compressed_data_size   = io_handle->file_size - 8;
-
-	while( compressed_data_size > 2 )
+	if( uncompressed_data == NULL )
 	{
-		uncompressed_block_size = (size_t) uncompressed_data_size;
-
-		if( libscca_compressed_block_initialize(
-		     &compressed_block,
-		     uncompressed_block_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create compressed block.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: reading compressed data block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-			 function,
-			 file_offset,
-			 file_offset );
-		}
-#endif
-		read_count = libscca_compressed_block_read(
-		              compressed_block,
-		              file_io_handle,
-		              file_offset,
-		              (size_t) uncompressed_block_size,
-		              error );
+		return( -1 );
+	}
+	if( uncompressed_data_size > io_handle->uncompressed_data_buffer_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            io_handle->uncompressed_data,
+		                            sizeof( uint8_t ) * uncompressed_data_size );
 
-		if( read_count == -1 )
+		if( reallocation == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read compressed block data.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize uncompressed data.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: compressed block: %d size\t: %" PRIu32 "\n",
-			 function,
-			 compressed_block_index,
-			 compressed_block->data_size );
-		}
-#endif
-		if( libfdata_list_append_element_with_mapped_size(
-		     compressed_blocks_list,
-		     &element_index,
-		     0,
-		     file_offset,
-		     (size64_t) read_count,
-		     LIBFDATA_RANGE_FLAG_IS_COMPRESSED,
-		     compressed_block->data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append compressed block: %d to list.",
-			 function,
-			 compressed_block_index );
-
-			goto on_error;
+			return( -1 );
 		}
-		file_offset            += read_count;
-		compressed_data_size   -= read_count;
-		uncompressed_data_size -= uncompressed_block_size;
-
-		if( libfdata_list_get_list_element_by_index(
-		     compressed_blocks_list,
-		     element_index,
-		     &compressed_blocks_list_element,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve compressed block: %d list element.",
-			 function,
-			 element_index );
+		io_handle->uncompressed_data = reallocation;
 
-			goto on_error;
-		}
-		if( libfdata_list_element_set_element_value(
-		     compressed_blocks_list_element,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) compressed_blocks_cache,
-		     (intptr_t *) compressed_block,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libscca_compressed_block_free,
-		     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+		if( libscca_statistics_add_allocation(
+		     &( io_handle->statistics ),
+		     uncompressed_data_size - io_handle->uncompressed_data_buffer_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set compressed block: %d as element value.",
-			 function,
-			 element_index );
+			 "%s: unable to add uncompressed data allocation.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		compressed_block = NULL;
-
-		compressed_block_index++;
+		io_handle->uncompressed_data_buffer_size = uncompressed_data_size;
 	}
-	return( 1 );
+	*uncompressed_data = io_handle->uncompressed_data;
 
-on_error:
-	if( compressed_block != NULL )
-	{
-		libscca_compressed_block_free(
-		 &compressed_block,
-		 NULL );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Reads the file metrics array
+/* Retrieves the section data scratch buffer
+ * The buffer is resized if it is smaller than the requested size
  * Returns 1 if successful or -1 on error
  */
-int libscca_io_handle_read_file_metrics_array(
+int libscca_io_handle_get_section_data_buffer(
      libscca_io_handle_t *io_handle,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t file_offset,
-     uint32_t number_of_entries,
-     libscca_filename_strings_t *filename_strings,
-     libcdata_array_t *file_metrics_array,
+     size_t section_data_size,
+     uint8_t **section_data,
      libcerror_error_t **error )
 {
-	libscca_file_metrics_t *file_metrics = NULL;
-	uint8_t *entry_data                  = NULL;
-	uint8_t *file_metrics_array_data     = NULL;
-	static char *function                = "libscca_io_handle_read_file_metrics_array";
-	size_t entry_data_size               = 0;
-	size_t read_size                     = 0;
-	ssize_t read_count                   = 0;
-	uint32_t file_metrics_entry_index    = 0;
-	int entry_index                      = 0;
+	uint8_t *reallocation = NULL;
+	static char *function = "libscca_io_handle_get_section_data_buffer";
 
 	if( io_handle == NULL )
 	{
@@ -563,35 +610,580 @@ int libscca_io_handle_read_file_metrics_array(
 
 		return( -1 );
 	}
-	if( io_handle->format_version == 17 )
+	if( ( section_data_size == 0 )
+	 || ( section_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
-		entry_data_size = sizeof( scca_file_metrics_array_entry_v17_t );
-	}
-	else if( ( io_handle->format_version == 23 )
-	      || ( io_handle->format_version == 26 )
-	      || ( io_handle->format_version == 30 ) )
-	{
-		entry_data_size = sizeof( scca_file_metrics_array_entry_v23_t );
-	}
-	else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid section data.",
+		 function );
+
+		return( -1 );
+	}
+	if( section_data_size > io_handle->section_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            io_handle->section_data,
+		                            sizeof( uint8_t ) * section_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize section data.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->section_data = reallocation;
+
+		if( libscca_statistics_add_allocation(
+		     &( io_handle->statistics ),
+		     section_data_size - io_handle->section_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add section data allocation.",
+			 function );
+
+			return( -1 );
+		}
+		io_handle->section_data_size = section_data_size;
+	}
+	*section_data = io_handle->section_data;
+
+	return( 1 );
+}
+
+/* Retrieves the Huffman decoder cache
+ * The decoder cache is created if not set
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_get_decoder_cache(
+     libscca_io_handle_t *io_handle,
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_io_handle_get_decoder_cache";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->decoder_cache == NULL )
+	{
+		if( libscca_lzxpress_huffman_decoder_cache_initialize(
+		     &( io_handle->decoder_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decoder cache.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_statistics_add_allocation(
+		     &( io_handle->statistics ),
+		     sizeof( libscca_lzxpress_huffman_decoder_cache_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add decoder cache allocation.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*decoder_cache = io_handle->decoder_cache;
+
+	return( 1 );
+}
+
+/* Reads the compressed file header data
+ * The file size of the IO handle must be set before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_read_compressed_file_header_data(
+     libscca_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_io_handle_read_compressed_file_header_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( data[ 4 ] ),
+	     scca_file_signature,
+	     4 ) == 0 )
+	{
+		io_handle->file_type= LIBSCCA_FILE_TYPE_UNCOMPRESSED;
+	}
+	else if( memory_compare(
+	          data,
+	          scca_mam_file_signature_win10,
+	          4 ) == 0 )
+	{
+		io_handle->file_type = LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		io_handle->uncompressed_data_size = io_handle->file_size;
+	}
+	else if( io_handle->file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: signature\t\t: %c%c%c\\x%02x\n",
+			 function,
+			 data[ 0 ],
+			 data[ 1 ],
+			 data[ 2 ],
+			 data[ 3 ] );
+		}
+#endif
+		libscca_byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 io_handle->uncompressed_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: uncompressed data size\t: %" PRIu32 "\n",
+			 function,
+			 io_handle->uncompressed_data_size );
+		}
+#endif
+		/* The uncompressed data size is compared with the file size in the file header
+		 * once the data has been decompressed
+		 */
+	}
+	if( libscca_budget_check_uncompressed_data_size(
+	     &( io_handle->budget ),
+	     (uint64_t) io_handle->uncompressed_data_size,
+	     &( io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: uncompressed data size exceeds budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset of the file
+ * The part of the buffer that is contained in the prefix data provided by the caller
+ * of the open is copied from the prefix data instead of being read from the file IO handle,
+ * which saves a seek and read on high latency storage
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libscca_io_handle_read_buffer_at_offset(
+     libscca_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libscca_io_handle_read_buffer_at_offset";
+	size_t prefix_copy_size = 0;
+	ssize_t read_count      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->prefix_data != NULL )
+	 && ( (size64_t) offset < (size64_t) io_handle->prefix_data_size ) )
+	{
+		prefix_copy_size = io_handle->prefix_data_size - (size_t) offset;
+
+		if( prefix_copy_size > size )
+		{
+			prefix_copy_size = size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( io_handle->prefix_data[ offset ] ),
+		     prefix_copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( prefix_copy_size < size )
+	{
+		offset += (off64_t) prefix_copy_size;
+
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( buffer[ prefix_copy_size ] ),
+		              size - prefix_copy_size,
+		              error );
+
+		if( read_count != (ssize_t) ( size - prefix_copy_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		io_handle->statistics.number_of_bytes_read += (uint64_t) read_count;
+	}
+	return( (ssize_t) size );
+}
+
+/* Reads the compressed file header
+ * The file size hint and prefix data provided by the caller of the open are used
+ * when available, otherwise the file size and header are read from the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_read_compressed_file_header(
+     libscca_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ 8 ];
+
+	static char *function = "libscca_io_handle_read_compressed_file_header";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid IO handle - unsupported format version.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( number_of_entries == 0 )
-	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / entry_data_size ) ) )
+	if( io_handle->file_size_hint != 0 )
+	{
+		file_size = io_handle->file_size_hint;
+	}
+	else if( libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_size < 8 )
+	 || ( file_size > (size64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->file_size = (uint32_t) file_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading compressed file header at offset: 0 (0x00000000)\n",
+		 function );
+	}
+#endif
+	read_count = libscca_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              0,
+	              file_header_data,
+	              8,
+	              error );
+
+	if( read_count != (ssize_t) 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_io_handle_read_compressed_file_header_data(
+	     io_handle,
+	     file_header_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the compressed blocks
+ * The LZXpress Huffman compressed data is stored as a single stream of 64 KiB chunks
+ * where a chunk can reference the uncompressed data of the previous chunks and the
+ * compressed size of a chunk is only known after decoding it. Hence the stream is
+ * mapped as a single compressed block that is decompressed into one uncompressed
+ * image that all reads are sliced from
+ * The compressed block is not decompressed until its data is first read
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_read_compressed_blocks(
+     libscca_io_handle_t *io_handle,
+     libfdata_list_t *compressed_blocks_list,
+     libcerror_error_t **error )
+{
+	static char *function            = "libscca_io_handle_read_compressed_blocks";
+	off64_t file_offset              = 0;
+	size64_t compressed_block_size   = 0;
+	uint32_t uncompressed_block_size = 0;
+	int element_index                = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_type != LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO handle - unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_size <= 10 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of entries value out of bounds.",
+		 "%s: invalid IO handle - file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	uncompressed_block_size = io_handle->uncompressed_data_size;
+
+	if( ( uncompressed_block_size == 0 )
+	 || ( uncompressed_block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset           = 8;
+	compressed_block_size = io_handle->file_size - 8;
+
+	if( compressed_block_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -600,62 +1192,127 @@ int libscca_io_handle_read_file_metrics_array(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: reading file metrics array at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
+		 "%s: compressed block offset\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
 		 function,
 		 file_offset,
 		 file_offset );
+
+		libcnotify_printf(
+		 "%s: compressed block size\t\t: %" PRIu64 "\n",
+		 function,
+		 compressed_block_size );
+
+		libcnotify_printf(
+		 "%s: compressed block uncompressed size\t: %" PRIu32 "\n",
+		 function,
+		 uncompressed_block_size );
 	}
 #endif
-	if( libfdata_stream_seek_offset(
-	     uncompressed_data_stream,
-	     (off64_t) file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( libfdata_list_append_element_with_mapped_size(
+	     compressed_blocks_list,
+	     &element_index,
+	     0,
+	     file_offset,
+	     compressed_block_size,
+	     LIBFDATA_RANGE_FLAG_IS_COMPRESSED,
+	     (size64_t) uncompressed_block_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek file metrics array offset: %" PRIu32 ".",
-		 function,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compressed block to list.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_size = number_of_entries * entry_data_size;
+	return( 1 );
+}
 
-	file_metrics_array_data = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * read_size );
+/* Reads the file metrics array data into the file metrics values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_io_handle_read_file_metrics_array_data(
+     libscca_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libscca_file_metrics_values_t *file_metrics_values,
+     libcerror_error_t **error )
+{
+	static char *function                = "libscca_io_handle_read_file_metrics_array_data";
+	size_t entry_data_size               = 0;
+	uint32_t number_of_allocated_entries = 0;
 
-	if( file_metrics_array_data == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file metrics array data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libfdata_stream_read_buffer(
-	              uncompressed_data_stream,
-	              (intptr_t *) file_io_handle,
-	              file_metrics_array_data,
-	              read_size,
-	              0,
-	              error );
+	if( io_handle->format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO handle - missing format layout.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data_size = io_handle->format_layout->file_metrics_entry_data_size;
 
-	if( read_count != (ssize_t) read_size )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file metrics array data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( (size_t) number_of_entries > ( data_size / entry_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_metrics_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics values.",
+		 function );
+
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -664,113 +1321,120 @@ int libscca_io_handle_read_file_metrics_array(
 		 "%s: file metrics array data:\n",
 		 function );
 		libcnotify_print_data(
-		 file_metrics_array_data,
-		 read_size,
+		 data,
+		 (size_t) number_of_entries * entry_data_size,
 		 0 );
 	}
 #endif
-	entry_data = file_metrics_array_data;
+	if( libscca_budget_check_number_of_entries(
+	     &( io_handle->budget ),
+	     number_of_entries,
+	     &( io_handle->abort ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: number of file metrics entries exceeds budget.",
+		 function );
 
-	for( file_metrics_entry_index = 0;
-	     file_metrics_entry_index < number_of_entries;
-	     file_metrics_entry_index++ )
+		return( -1 );
+	}
+	if( libscca_budget_add_steps(
+	     &( io_handle->budget ),
+	     number_of_entries,
+	     &( io_handle->abort ),
+	     error ) != 1 )
 	{
-		if( libscca_file_metrics_initialize(
-		     &file_metrics,
-		     filename_strings,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file metrics: %" PRIu32 ".",
-			 function,
-			 file_metrics_entry_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add file metrics entries to budget.",
+		 function );
 
-			goto on_error;
-		}
-		if( libscca_file_metrics_read_data(
-		     file_metrics,
-		     io_handle,
-		     entry_data,
-		     entry_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file metrics: %" PRIu32 ".",
-			 function,
-			 file_metrics_entry_index );
+		return( -1 );
+	}
+	if( io_handle->abort != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
 
-			goto on_error;
-		}
-		entry_data += entry_data_size;
+		return( -1 );
+	}
+	number_of_allocated_entries = file_metrics_values->number_of_allocated_entries;
+
+	/* Decode the entire array in a single pass, the file metrics are only
+	 * created when they are requested and reference the decoded values
+	 */
+	if( libscca_file_metrics_values_read_data(
+	     file_metrics_values,
+	     io_handle->format_layout,
+	     data,
+	     data_size,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file metrics values.",
+		 function );
 
-		if( libcdata_array_append_entry(
-		     file_metrics_array,
-		     &entry_index,
-		     (intptr_t *) file_metrics,
+		return( -1 );
+	}
+	/* The values data is reused hence only the additionally allocated entries are accounted for
+	 */
+	if( file_metrics_values->number_of_allocated_entries > number_of_allocated_entries )
+	{
+		if( libscca_statistics_add_allocated_size(
+		     &( io_handle->statistics ),
+		     (size_t) ( file_metrics_values->number_of_allocated_entries - number_of_allocated_entries ) * LIBSCCA_FILE_METRICS_VALUES_ENTRY_SIZE,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append file metrics: %" PRIu32 " to array.",
-			 function,
-			 file_metrics_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add file metrics allocated size.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		file_metrics = NULL;
 	}
-	memory_free(
-	 file_metrics_array_data );
-
 	return( 1 );
-
-on_error:
-	if( file_metrics != NULL )
-	{
-		libscca_internal_file_metrics_free(
-		 (libscca_internal_file_metrics_t **) &file_metrics,
-		 NULL );
-	}
-	if( file_metrics_array_data != NULL )
-	{
-		memory_free(
-		 file_metrics_array_data );
-	}
-	return( -1 );
 }
 
-/* Reads the trace chain array
- * Returns 1 if successful or -1 on error
+/* Visits the entries of the file metrics array data without storing them
+ * Every entry is read into the file metrics, which is reused for every entry, before
+ * the callback function is called and the visit stops at the first entry for which
+ * the callback function returns 0
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if all entries were visited, 0 if the visit was stopped or -1 on error
  */
-int libscca_io_handle_read_trace_chain_array(
+int libscca_io_handle_visit_file_metrics_array_data(
      libscca_io_handle_t *io_handle,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint32_t number_of_entries,
+     libscca_file_metrics_t *file_metrics,
+     int (*callback_function)(
+            int entry_index,
+            libscca_file_metrics_t *file_metrics,
+            void *callback_arguments ),
+     void *callback_arguments,
      libcerror_error_t **error )
 {
-	uint8_t *entry_data             = NULL;
-	uint8_t *trace_chain_array_data = NULL;
-	static char *function           = "libscca_io_handle_read_trace_chain_array";
-	size_t entry_data_size          = 0;
-	size_t read_size                = 0;
-	ssize_t read_count              = 0;
-	uint32_t entry_index            = 0;
-	uint32_t next_table_index       = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit            = 0;
-	uint16_t value_16bit            = 0;
-#endif
+	static char *function  = "libscca_io_handle_visit_file_metrics_array_data";
+	size_t entry_data_size = 0;
+	uint32_t entry_index   = 0;
+	int result             = 1;
 
 	if( io_handle == NULL )
 	{
@@ -783,29 +1447,43 @@ int libscca_io_handle_read_trace_chain_array(
 
 		return( -1 );
 	}
-	if( ( io_handle->format_version == 17 )
-	 || ( io_handle->format_version == 23 )
-	 || ( io_handle->format_version == 26 ) )
+	if( io_handle->format_layout == NULL )
 	{
-		entry_data_size = sizeof( scca_trace_chain_array_entry_v17_t );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO handle - missing format layout.",
+		 function );
+
+		return( -1 );
 	}
-	else if( io_handle->format_version == 30 )
+	entry_data_size = io_handle->format_layout->file_metrics_entry_data_size;
+
+	if( data == NULL )
 	{
-		entry_data_size = sizeof( scca_trace_chain_array_entry_v30_t );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid IO handle - unsupported format version.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
 	if( ( number_of_entries == 0 )
-	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / entry_data_size ) ) )
+	 || ( (size_t) number_of_entries > ( data_size / entry_data_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -816,232 +1494,155 @@ int libscca_io_handle_read_trace_chain_array(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading trace chain array at offset: %" PRIu32 " (0x%08" PRIx32 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	if( libfdata_stream_seek_offset(
-	     uncompressed_data_stream,
-	     (off64_t) file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( file_metrics == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek trace chain array offset: %" PRIu32 ".",
-		 function,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file metrics.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_size = number_of_entries * entry_data_size;
-
-	trace_chain_array_data = (uint8_t *) memory_allocate(
-	                                      sizeof( uint8_t ) * read_size );
-
-	if( trace_chain_array_data == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create trace chain array data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libfdata_stream_read_buffer(
-	              uncompressed_data_stream,
-	              (intptr_t *) file_io_handle,
-	              trace_chain_array_data,
-	              read_size,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) read_size )
+	if( libscca_budget_check_number_of_entries(
+	     &( io_handle->budget ),
+	     number_of_entries,
+	     &( io_handle->abort ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read trace chain array data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: number of file metrics entries exceeds budget.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: trace chain array data:\n",
-		 function );
-		libcnotify_print_data(
-		 trace_chain_array_data,
-		 read_size,
-		 0 );
+		return( -1 );
 	}
-#endif
-	entry_data = trace_chain_array_data;
-
 	for( entry_index = 0;
 	     entry_index < number_of_entries;
 	     entry_index++ )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: trace chain array entry: %" PRIu32 " data:\n",
-			 function,
-			 entry_index );
-			libcnotify_print_data(
-			 entry_data,
-			 entry_data_size,
-			 0 );
-		}
-#endif
-		if( entry_data_size == 8 )
+		if( io_handle->abort != 0 )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (scca_trace_chain_array_entry_v30_t *) entry_data )->total_block_load_count,
-				 value_32bit );
-				libcnotify_printf(
-				 "%s: total block load count\t: %" PRIu32 " blocks (%" PRIu64 " bytes)\n",
-				 function,
-				 value_32bit,
-				 (uint64_t) value_32bit * 512 * 1024 );
-
-				libcnotify_printf(
-				 "%s: unknown1\t\t\t: 0x%02" PRIx8 "\n",
-				 function,
-				 ( (scca_trace_chain_array_entry_v30_t *) entry_data )->unknown1 );
-
-				libcnotify_printf(
-				 "%s: unknown2\t\t\t: 0x%02" PRIx8 "\n",
-				 function,
-				 ( (scca_trace_chain_array_entry_v30_t *) entry_data )->unknown2 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
 
-				byte_stream_copy_to_uint16_little_endian(
-				 ( (scca_trace_chain_array_entry_v30_t *) entry_data )->unknown3,
-				 value_16bit );
-				libcnotify_printf(
-				 "%s: unknown3\t\t\t: 0x%04" PRIx16 "\n",
-				 function,
-				 value_16bit );
-			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+			return( -1 );
 		}
-		else if( entry_data_size == 12 )
+		if( libscca_file_metrics_read_data(
+		     file_metrics,
+		     io_handle,
+		     &( data[ (size_t) entry_index * entry_data_size ] ),
+		     entry_data_size,
+		     error ) != 1 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
-			 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->next_array_entry_index,
-			 next_table_index );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( next_table_index == 0xffffffffUL )
-				{
-					libcnotify_printf(
-					 "%s: next table index\t\t: 0x%08" PRIx32 "\n",
-					 function,
-					 next_table_index );
-				}
-				else
-				{
-					libcnotify_printf(
-					 "%s: next table index\t\t: %" PRIu32 "\n",
-					 function,
-					 next_table_index );
-				}
-				byte_stream_copy_to_uint32_little_endian(
-				 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->total_block_load_count,
-				 value_32bit );
-				libcnotify_printf(
-				 "%s: total block load count\t: %" PRIu32 " blocks (%" PRIu64 " bytes)\n",
-				 function,
-				 value_32bit,
-				 (uint64_t) value_32bit * 512 * 1024 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file metrics entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
 
-				libcnotify_printf(
-				 "%s: unknown1\t\t\t: 0x%02" PRIx8 "\n",
-				 function,
-				 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->unknown1 );
+			return( -1 );
+		}
+		result = callback_function(
+		          (int) entry_index,
+		          file_metrics,
+		          callback_arguments );
 
-				libcnotify_printf(
-				 "%s: unknown2\t\t\t: 0x%02" PRIx8 "\n",
-				 function,
-				 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->unknown2 );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for file metrics entry: %" PRIu32 ".",
+			 function,
+			 entry_index );
 
-				byte_stream_copy_to_uint16_little_endian(
-				 ( (scca_trace_chain_array_entry_v17_t *) entry_data )->unknown3,
-				 value_16bit );
-				libcnotify_printf(
-				 "%s: unknown3\t\t\t: 0x%04" PRIx16 "\n",
-				 function,
-				 value_16bit );
-			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		else if( result == 0 )
 		{
-			libcnotify_printf(
-			 "\n" );
+			entry_index++;
+
+			break;
 		}
-#endif
-		entry_data += entry_data_size;
 	}
-	memory_free(
-	 trace_chain_array_data );
-
-	return( 1 );
-
-on_error:
-	if( trace_chain_array_data != NULL )
+	/* Only the visited entries are accounted for
+	 */
+	if( libscca_budget_add_steps(
+	     &( io_handle->budget ),
+	     entry_index,
+	     &( io_handle->abort ),
+	     error ) != 1 )
 	{
-		memory_free(
-		 trace_chain_array_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to add file metrics entries to budget.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Reads the volumes information
+/* Reads the volumes information data
+ * The volumes are stored in a single packed block, the first pass validates the volume
+ * information and determines the size of the block, the second pass fills the block
  * Returns 1 if successful or -1 on error
  */
-int libscca_io_handle_read_volumes_information(
+int libscca_io_handle_read_volumes_information_data(
      libscca_io_handle_t *io_handle,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t volumes_information_offset,
-     uint32_t volumes_information_size,
+     const uint8_t *data,
+     size_t data_size,
      uint32_t number_of_volumes,
-     libcdata_array_t *volumes_array,
+     libscca_volumes_t *volumes,
      libcerror_error_t **error )
 {
 	libscca_internal_volume_information_t *volume_information = NULL;
-	uint8_t *volume_information_data                          = NULL;
-	uint8_t *volumes_information_data                         = NULL;
-	static char *function                                     = "libscca_io_handle_read_volumes_information";
+	const uint8_t *volume_information_data                    = NULL;
+	uint64_t *file_references                                 = NULL;
+	uint32_t *directory_string_offsets                        = NULL;
+	uint8_t *strings_data                                     = NULL;
+	static char *function                                     = "libscca_io_handle_read_volumes_information_data";
 	size_t directory_string_size                              = 0;
-	ssize_t read_count                                        = 0;
+	size_t directory_strings_size                             = 0;
+	size_t records_size                                       = 0;
+	size_t reserved_data_size                                 = 0;
+	size_t strings_data_offset                                = 0;
+	size_t strings_data_size                                  = 0;
+	size_t total_number_of_directory_strings                  = 0;
+	size_t total_number_of_file_references                    = 0;
+	size_t volumes_data_size                                  = 0;
+	size_t previous_volumes_data_size                         = 0;
 	ssize_t volume_information_size                           = 0;
 	uint32_t device_path_offset                               = 0;
 	uint32_t device_path_size                                 = 0;
 	uint32_t directory_string_index                           = 0;
 	uint32_t directory_string_offset                          = 0;
 	uint32_t directory_strings_array_offset                   = 0;
+	uint32_t file_references_data_size                        = 0;
 	uint32_t file_references_index                            = 0;
 	uint32_t file_references_offset                           = 0;
 	uint32_t file_references_size                             = 0;
@@ -1050,8 +1651,8 @@ int libscca_io_handle_read_volumes_information(
 	uint32_t version                                          = 0;
 	uint32_t volume_index                                     = 0;
 	uint32_t volume_information_offset                        = 0;
+	uint32_t volumes_information_size                         = 0;
 	uint16_t number_of_characters                             = 0;
-	int entry_index                                           = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit                                      = 0;
@@ -1069,34 +1670,45 @@ int libscca_io_handle_read_volumes_information(
 
 		return( -1 );
 	}
-	if( ( io_handle->format_version != 17 )
-	 && ( io_handle->format_version != 23 )
-	 && ( io_handle->format_version != 26 )
-	 && ( io_handle->format_version != 30 ) )
+	if( io_handle->format_layout == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid IO handle - unsupported format version.",
+		 "%s: invalid IO handle - missing format layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( volumes_information_size < 2 )
-	 || ( volumes_information_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( ( data_size < 2 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volumes information size value out of bounds.",
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	volumes_information_size = (uint32_t) data_size;
+
 	if( ( number_of_volumes == 0 )
-	 || ( number_of_volumes > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	 || ( number_of_volumes > (uint32_t) INT_MAX )
+	 || ( (size_t) number_of_volumes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libscca_internal_volume_information_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1107,132 +1719,151 @@ int libscca_io_handle_read_volumes_information(
 
 		return( -1 );
 	}
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: reading volumes information at offset: %" PRIi32 " (0x%08" PRIx32 ")\n",
-		 function,
-		 volumes_information_offset,
-		 volumes_information_offset );
+		 "%s: volumes information data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 volumes_information_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	if( libfdata_stream_seek_offset(
-	     uncompressed_data_stream,
-	     (off64_t) volumes_information_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	volume_information_size = (ssize_t) io_handle->format_layout->volume_information_data_size;
+
+	if( volume_information_size > volumes_information_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek volumes information offset: %" PRIi32 " (0x%08" PRIx32 ").",
-		 function,
-		 volumes_information_offset,
-		 volumes_information_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume information size value out of bounds.",
+		 function );
 
 		goto on_error;
 	}
-	volumes_information_data = (uint8_t *) memory_allocate(
-	                                        sizeof( uint8_t ) * volumes_information_size );
-
-	if( volumes_information_data == NULL )
+	/* The volume information records are stored consecutively hence validating
+	 * them once here removes the need to validate every record in the loop
+	 */
+	if( (size_t) number_of_volumes > ( (size_t) volumes_information_size / (size_t) volume_information_size ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create volumes information data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	read_count = libfdata_stream_read_buffer(
-	              uncompressed_data_stream,
-	              (intptr_t *) file_io_handle,
-	              volumes_information_data,
-	              volumes_information_size,
-	              0,
-	              error );
-
-	if( read_count != (ssize_t) volumes_information_size )
+	if( libscca_budget_check_number_of_entries(
+	     &( io_handle->budget ),
+	     number_of_volumes,
+	     &( io_handle->abort ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read volumes information data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: number of volumes exceeds budget.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: volumes information data:\n",
-		 function,
-		 volume_index );
-		libcnotify_print_data(
-		 volumes_information_data,
-		 volumes_information_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	if( io_handle->format_version == 17 )
-	{
-		volume_information_size = sizeof( scca_volume_information_v17_t );
-	}
-	else if( ( io_handle->format_version == 23 )
-	      || ( io_handle->format_version == 26 ) )
+	previous_volumes_data_size = volumes->volumes_data_size;
+
+	volumes->number_of_volumes = 0;
+
+	/* The volume information records are stored at the start of the volumes data
+	 */
+	records_size = sizeof( libscca_internal_volume_information_t ) * (size_t) number_of_volumes;
+
+	/* The device paths, file references and directory strings are copied from the volumes
+	 * information data, hence the volumes data is reserved for the records and the size of
+	 * that data so that it normally does not need to be reallocated after the first pass
+	 */
+	reserved_data_size = records_size;
+
+	if( data_size <= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - records_size ) )
 	{
-		volume_information_size = sizeof( scca_volume_information_v23_t );
+		reserved_data_size += data_size;
 	}
-	else if( io_handle->format_version == 30 )
+	if( libscca_volumes_resize(
+	     volumes,
+	     reserved_data_size,
+	     error ) != 1 )
 	{
-		volume_information_size = sizeof( scca_volume_information_v30_t );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize volumes.",
+		 function );
+
+		goto on_error;
 	}
-	if( volume_information_size > volumes_information_size )
+	if( memory_set(
+	     volumes->volumes_data,
+	     0,
+	     records_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume information size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume information records.",
 		 function );
 
 		goto on_error;
 	}
+	volumes_data_size = records_size;
+
 	for( volume_index = 0;
 	     volume_index < number_of_volumes;
 	     volume_index++ )
 	{
-		if( libscca_volume_information_initialize(
-		     (libscca_volume_information_t **) &volume_information,
-		     error ) != 1 )
+		if( io_handle->abort != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create volume: %" PRIu32 " information.",
-			 function,
-			 volume_index );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
 
 			goto on_error;
 		}
-		if( volume_information_offset > ( volumes_information_size - volume_information_size ) )
+		if( libscca_budget_add_steps(
+		     &( io_handle->budget ),
+		     1,
+		     &( io_handle->abort ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid volume information offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to add volume to budget.",
 			 function );
 
 			goto on_error;
 		}
+		volume_information = &( volumes->volume_information[ volume_index ] );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1243,7 +1874,7 @@ int libscca_io_handle_read_volumes_information(
 			 volume_information_offset );
 		}
 #endif
-		volume_information_data = &( volumes_information_data[ volume_information_offset ] );
+		volume_information_data = &( data[ volume_information_offset ] );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1258,35 +1889,35 @@ int libscca_io_handle_read_volumes_information(
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_offset,
 		 device_path_offset );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_number_of_characters,
 		 device_path_size );
 
-		byte_stream_copy_to_uint64_little_endian(
+		libscca_byte_stream_copy_to_uint64_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->creation_time,
 		 volume_information->creation_time );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->serial_number,
 		 volume_information->serial_number );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_offset,
 		 file_references_offset );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_size,
 		 file_references_size );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->directory_strings_array_offset,
 		 directory_strings_array_offset );
 
-		byte_stream_copy_to_uint32_little_endian(
+		libscca_byte_stream_copy_to_uint32_little_endian(
 		 ( (scca_volume_information_v17_t *) volume_information_data )->number_of_directory_strings,
 		 number_of_directory_strings );
 
@@ -1346,7 +1977,7 @@ int libscca_io_handle_read_volumes_information(
 			 function,
 			 number_of_directory_strings );
 
-			byte_stream_copy_to_uint32_little_endian(
+			libscca_byte_stream_copy_to_uint32_little_endian(
 			 ( (scca_volume_information_v17_t *) volume_information_data )->unknown1,
 			 value_32bit );
 			libcnotify_printf(
@@ -1365,7 +1996,7 @@ int libscca_io_handle_read_volumes_information(
 				 28,
 				 0 );
 
-				byte_stream_copy_to_uint32_little_endian(
+				libscca_byte_stream_copy_to_uint32_little_endian(
 				 ( (scca_volume_information_v23_t *) volume_information_data )->unknown3,
 				 value_32bit );
 				libcnotify_printf(
@@ -1381,7 +2012,7 @@ int libscca_io_handle_read_volumes_information(
 				 28,
 				 0 );
 
-				byte_stream_copy_to_uint32_little_endian(
+				libscca_byte_stream_copy_to_uint32_little_endian(
 				 ( (scca_volume_information_v23_t *) volume_information_data )->unknown5,
 				 value_32bit );
 				libcnotify_printf(
@@ -1399,7 +2030,7 @@ int libscca_io_handle_read_volumes_information(
 				 24,
 				 0 );
 
-				byte_stream_copy_to_uint32_little_endian(
+				libscca_byte_stream_copy_to_uint32_little_endian(
 				 ( (scca_volume_information_v30_t *) volume_information_data )->unknown3,
 				 value_32bit );
 				libcnotify_printf(
@@ -1415,7 +2046,7 @@ int libscca_io_handle_read_volumes_information(
 				 24,
 				 0 );
 
-				byte_stream_copy_to_uint32_little_endian(
+				libscca_byte_stream_copy_to_uint32_little_endian(
 				 ( (scca_volume_information_v30_t *) volume_information_data )->unknown5,
 				 value_32bit );
 				libcnotify_printf(
@@ -1469,35 +2100,43 @@ int libscca_io_handle_read_volumes_information(
 
 				goto on_error;
 			}
-			volume_information->device_path = (uint8_t *) memory_allocate(
-			                                               sizeof( uint8_t ) * device_path_size );
+			volume_information->device_path_size = device_path_size;
 
-			if( volume_information->device_path == NULL )
+			if( io_handle->string_pool != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create device path.",
-				 function );
+				if( libscca_string_pool_intern_string(
+				     io_handle->string_pool,
+				     &( data[ device_path_offset ] ),
+				     (size_t) device_path_size,
+				     &( volume_information->device_path_string_identifier ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to intern device path.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				volume_information->string_pool = io_handle->string_pool;
 			}
-			volume_information->device_path_size = device_path_size;
-
-			if( memory_copy(
-			     volume_information->device_path,
-			     &( volumes_information_data[ device_path_offset ] ),
-			     device_path_size ) == NULL )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy device path.",
-				 function );
+				if( (size_t) device_path_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - volumes_data_size ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volumes data size value out of bounds.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				volumes_data_size += (size_t) device_path_size;
+				strings_data_size += (size_t) device_path_size;
 			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -1505,7 +2144,7 @@ int libscca_io_handle_read_volumes_information(
 				if( libscca_debug_print_utf16_string_value(
 				     function,
 				     "volume device path\t\t\t",
-				     volume_information->device_path,
+				     &( data[ device_path_offset ] ),
 				     volume_information->device_path_size,
 				     LIBUNA_ENDIAN_LITTLE,
 				     error ) != 1 )
@@ -1522,6 +2161,27 @@ int libscca_io_handle_read_volumes_information(
 			}
 #endif
 		}
+		if( io_handle->volume_dictionary != NULL )
+		{
+			if( libscca_volume_dictionary_get_volume_identifier(
+			     io_handle->volume_dictionary,
+			     ( volume_information->device_path_size > 0 ) ? &( data[ device_path_offset ] ) : NULL,
+			     (size_t) volume_information->device_path_size,
+			     volume_information->serial_number,
+			     volume_information->creation_time,
+			     &( volume_information->volume_identifier ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume identifier.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( file_references_offset != 0 )
 		{
 			if( ( file_references_offset < volume_information_offset )
@@ -1556,19 +2216,19 @@ int libscca_io_handle_read_volumes_information(
 				 "%s: file references data:\n",
 				 function );
 				libcnotify_print_data(
-				 &( volumes_information_data[ file_references_offset ] ),
+				 &( data[ file_references_offset ] ),
 				 file_references_size,
 				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 			}
 #endif
 			byte_stream_copy_to_uint32_little_endian(
-			 &( volumes_information_data[ file_references_offset ] ),
+			 &( data[ file_references_offset ] ),
 			 version );
 
 			file_references_offset += 4;
 
-			byte_stream_copy_to_uint32_little_endian(
-			 &( volumes_information_data[ file_references_offset ] ),
+			libscca_byte_stream_copy_to_uint32_little_endian(
+			 &( data[ file_references_offset ] ),
 			 number_of_file_references );
 
 			file_references_offset += 4;
@@ -1587,9 +2247,37 @@ int libscca_io_handle_read_volumes_information(
 				 number_of_file_references );
 			}
 #endif
-			if( ( number_of_file_references > ( ( file_references_size - 8 ) / 8 ) )
-			 || ( number_of_file_references > ( volumes_information_size / 8 ) )
-			 || ( file_references_offset >= ( volumes_information_size - ( (size_t) number_of_file_references * 8 ) ) ) )
+			file_references_data_size = file_references_size - 8;
+
+			if( io_handle->format_layout->file_references_header_size > 8 )
+			{
+				if( file_references_data_size < 8 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid file references size value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libscca_byte_stream_copy_to_uint64_little_endian(
+					 &( data[ file_references_offset ] ),
+					 value_64bit );
+					libcnotify_printf(
+					 "%s: unknown\t\t\t\t: 0x%08" PRIx64 "\n",
+					 function,
+					 value_64bit );
+				}
+#endif
+				file_references_offset    += 8;
+				file_references_data_size -= 8;
+			}
+			if( number_of_file_references > ( file_references_data_size / 8 ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -1600,27 +2288,62 @@ int libscca_io_handle_read_volumes_information(
 
 				goto on_error;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( libscca_budget_check_number_of_entries(
+			     &( io_handle->budget ),
+			     number_of_file_references,
+			     &( io_handle->abort ),
+			     error ) != 1 )
 			{
-				if( io_handle->format_version >= 23 )
-				{
-					byte_stream_copy_to_uint64_little_endian(
-					 &( volumes_information_data[ file_references_offset ] ),
-					 value_64bit );
-					libcnotify_printf(
-					 "%s: unknown\t\t\t\t: 0x%08" PRIx64 "\n",
-					 function,
-					 value_64bit );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: number of file references exceeds budget.",
+				 function );
 
-					file_references_offset += 8;
-				}
-				for( file_references_index = 0;
-				     file_references_index < number_of_file_references;
-				     file_references_index++ )
+				goto on_error;
+			}
+			if( libscca_budget_add_steps(
+			     &( io_handle->budget ),
+			     (uint64_t) number_of_file_references,
+			     &( io_handle->abort ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to add file references to budget.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( sizeof( uint64_t ) * (size_t) number_of_file_references ) > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - volumes_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volumes data size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			volumes_data_size += sizeof( uint64_t ) * (size_t) number_of_file_references;
+
+			total_number_of_file_references += (size_t) number_of_file_references;
+
+			volume_information->number_of_file_references = (int) number_of_file_references;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			for( file_references_index = 0;
+			     file_references_index < number_of_file_references;
+			     file_references_index++ )
+			{
+				if( libcnotify_verbose != 0 )
 				{
-					byte_stream_copy_to_uint64_little_endian(
-					 &( volumes_information_data[ file_references_offset ] ),
+					libscca_byte_stream_copy_to_uint64_little_endian(
+					 &( data[ file_references_offset ] ),
 					 value_64bit );
 
 					if( value_64bit == 0 )
@@ -1640,12 +2363,15 @@ int libscca_io_handle_read_volumes_information(
 						 value_64bit & 0xffffffffffffUL,
 						 value_64bit >> 48 );
 					}
-					file_references_offset += 8;
 				}
+				file_references_offset += 8;
+			}
+			if( libcnotify_verbose != 0 )
+			{
 				libcnotify_printf(
 				 "\n" );
 			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+#endif
 		}
 		if( directory_strings_array_offset != 0 )
 		{
@@ -1672,32 +2398,51 @@ int libscca_io_handle_read_volumes_information(
 
 				goto on_error;
 			}
-			if( libfvalue_value_type_initialize(
-			     &( volume_information->directory_strings ),
-			     LIBFVALUE_VALUE_TYPE_STRING_UTF16,
+			if( libscca_budget_check_number_of_entries(
+			     &( io_handle->budget ),
+			     number_of_directory_strings,
+			     &( io_handle->abort ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: number of directory strings exceeds budget.",
+				 function );
+
+				goto on_error;
+			}
+			if( libscca_budget_add_steps(
+			     &( io_handle->budget ),
+			     (uint64_t) number_of_directory_strings,
+			     &( io_handle->abort ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory strings value.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to add directory strings to budget.",
 				 function );
 
 				goto on_error;
 			}
+			/* The first pass validates the bounds of the directory strings and determines
+			 * the size of the directory strings array, the directory strings are not
+			 * tokenised until they are first accessed
+			 */
 			directory_string_index  = 0;
 			directory_string_offset = directory_strings_array_offset;
 
 			while( directory_string_offset < ( volumes_information_size - 4 ) )
 			{
-				if( ( number_of_directory_strings == 0 )
-				 || ( directory_string_index >= ( number_of_directory_strings - 1 ) ) )
+				if( directory_string_index >= number_of_directory_strings )
 				{
 					break;
 				}
-				byte_stream_copy_to_uint16_little_endian(
-				 &( volumes_information_data[ directory_string_offset ] ),
+				libscca_byte_stream_copy_to_uint16_little_endian(
+				 &( data[ directory_string_offset ] ),
 				 number_of_characters );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1743,160 +2488,186 @@ int libscca_io_handle_read_volumes_information(
 					 function,
 					 directory_string_index );
 					libcnotify_print_data(
-					 &( volumes_information_data[ directory_string_offset ] ),
+					 &( data[ directory_string_offset ] ),
 					 (size_t) directory_string_size,
 					 0 );
 				}
 #endif
-				if( libfvalue_value_append_entry_data(
-				     volume_information->directory_strings,
-				     &entry_index,
-				     &( volumes_information_data[ directory_string_offset ] ),
-				     (size_t) directory_string_size,
-				     LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append directory string.",
-					 function );
-
-					goto on_error;
-				}
 				directory_string_offset += directory_string_size;
 
 				directory_string_index++;
 			}
-		}
-		if( libcdata_array_append_entry(
-		     volumes_array,
-		     &entry_index,
-		     (intptr_t *) volume_information,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append volume: %" PRIu32 " information to array.",
-			 function,
-			 volume_index );
-
-			goto on_error;
-		}
-		volume_information = NULL;
-	}
-	memory_free(
-	 volumes_information_data );
-
-	return( 1 );
+			directory_strings_size = (size_t) ( directory_string_offset - directory_strings_array_offset );
 
-on_error:
-	if( volume_information != NULL )
-	{
-		libscca_internal_volume_information_free(
-		 &volume_information,
-		 NULL );
-	}
-	if( volumes_information_data != NULL )
-	{
-		memory_free(
-		 volumes_information_data );
-	}
-	return( -1 );
-}
+			if( ( ( sizeof( uint32_t ) * (size_t) directory_string_index ) > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - volumes_data_size ) )
+			 || ( directory_strings_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - volumes_data_size - ( sizeof( uint32_t ) * (size_t) directory_string_index ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volumes data size value out of bounds.",
+				 function );
 
-/* Reads data from the current offset into a buffer
- * Callback for the uncompressed block stream
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libscca_io_handle_read_segment_data(
-         intptr_t *data_handle LIBSCCA_ATTRIBUTE_UNUSED,
-         intptr_t *file_io_handle,
-         int segment_index,
-         int segment_file_index LIBSCCA_ATTRIBUTE_UNUSED,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags LIBSCCA_ATTRIBUTE_UNUSED,
-         uint8_t read_flags LIBSCCA_ATTRIBUTE_UNUSED,
-         libcerror_error_t **error )
-{
-	static char *function = "libscca_io_handle_read_segment_data";
-	ssize_t read_count    = 0;
+				goto on_error;
+			}
+			volumes_data_size += ( sizeof( uint32_t ) * (size_t) directory_string_index ) + directory_strings_size;
 
-	LIBSCCA_UNREFERENCED_PARAMETER( data_handle )
-	LIBSCCA_UNREFERENCED_PARAMETER( segment_file_index )
-	LIBSCCA_UNREFERENCED_PARAMETER( segment_flags )
-	LIBSCCA_UNREFERENCED_PARAMETER( read_flags )
+			total_number_of_directory_strings += (size_t) directory_string_index;
+			strings_data_size                 += directory_strings_size;
 
-	if( segment_data_size > (size64_t) SSIZE_MAX )
+			volume_information->number_of_directory_strings = (int) directory_string_index;
+			volume_information->directory_strings_data_size = directory_strings_size;
+		}
+	}
+	/* The volumes data contains the volume information records followed by the file references,
+	 * the directory string offsets and the strings area, which keeps the arrays aligned
+	 */
+	if( libscca_volumes_resize(
+	     volumes,
+	     volumes_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid segment data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize volumes.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer(
-	              (libbfio_handle_t *) file_io_handle,
-	              segment_data,
-	              segment_data_size,
-	              error );
+	file_references          = (uint64_t *) &( volumes->volumes_data[ records_size ] );
+	directory_string_offsets = (uint32_t *) &( file_references[ total_number_of_file_references ] );
+	strings_data             = (uint8_t *) &( directory_string_offsets[ total_number_of_directory_strings ] );
 
-	if( read_count != (ssize_t) segment_data_size )
+	/* The second pass fills the volumes data, the volume information data was validated by the first pass
+	 */
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment: %d data.",
-		 function,
-		 segment_index );
+		volume_information      = &( volumes->volume_information[ volume_index ] );
+		volume_information_data = &( data[ (size_t) volume_index * (size_t) volume_information_size ] );
 
-		return( -1 );
-	}
-	return( read_count );
-}
+		libscca_byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_offset,
+		 device_path_offset );
 
-/* Seeks a certain offset of the data
- * Callback for the uncompressed block stream
- * Returns the offset if seek is successful or -1 on error
- */
-off64_t libscca_io_handle_seek_segment_offset(
-         intptr_t *data_handle LIBSCCA_ATTRIBUTE_UNUSED,
-         intptr_t *file_io_handle,
-         int segment_index,
-         int segment_file_index LIBSCCA_ATTRIBUTE_UNUSED,
-         off64_t segment_offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libscca_io_handle_seek_segment_offset";
+		libscca_byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_offset,
+		 file_references_offset );
+
+		libscca_byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->directory_strings_array_offset,
+		 directory_strings_array_offset );
+
+		if( ( volume_information->device_path_size > 0 )
+		 && ( volume_information->string_pool == NULL ) )
+		{
+			if( memory_copy(
+			     &( strings_data[ strings_data_offset ] ),
+			     &( data[ device_path_offset ] ),
+			     (size_t) volume_information->device_path_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy volume: %" PRIu32 " device path.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			volume_information->device_path = &( strings_data[ strings_data_offset ] );
+
+			strings_data_offset += (size_t) volume_information->device_path_size;
+		}
+		if( volume_information->number_of_file_references > 0 )
+		{
+			if( io_handle->format_layout->file_references_header_size > 8 )
+			{
+				file_references_offset += 16;
+			}
+			else
+			{
+				file_references_offset += 8;
+			}
+			for( file_references_index = 0;
+			     file_references_index < (uint32_t) volume_information->number_of_file_references;
+			     file_references_index++ )
+			{
+				libscca_byte_stream_copy_to_uint64_little_endian(
+				 &( data[ file_references_offset ] ),
+				 file_references[ file_references_index ] );
+
+				file_references_offset += 8;
+			}
+			volume_information->file_references = file_references;
+
+			file_references += volume_information->number_of_file_references;
+		}
+		if( volume_information->number_of_directory_strings > 0 )
+		{
+			/* The directory strings array is copied as a whole, including the number
+			 * of characters, and the directory string offsets are determined on first access
+			 */
+			if( memory_copy(
+			     &( strings_data[ strings_data_offset ] ),
+			     &( data[ directory_strings_array_offset ] ),
+			     volume_information->directory_strings_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy volume: %" PRIu32 " directory strings.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			volume_information->directory_string_offsets         = directory_string_offsets;
+			volume_information->directory_string_offsets_are_set = 0;
+			volume_information->directory_strings_data           = &( strings_data[ strings_data_offset ] );
 
-	LIBSCCA_UNREFERENCED_PARAMETER( data_handle )
-	LIBSCCA_UNREFERENCED_PARAMETER( segment_file_index )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			volume_information->mutex = volumes->mutex;
+#endif
+			directory_string_offsets += volume_information->number_of_directory_strings;
+			strings_data_offset      += volume_information->directory_strings_data_size;
+		}
+	}
+	volumes->number_of_volumes = (int) number_of_volumes;
 
-	if( libbfio_handle_seek_offset(
-	     (libbfio_handle_t *) file_io_handle,
-	     segment_offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	/* The volumes data is reused hence only the additionally allocated size is accounted for,
+	 * an interned device path is accounted for by the string pool
+	 */
+	if( volumes->volumes_data_size > previous_volumes_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek segment: %d offset: %" PRIi64 ".",
-		 function,
-		 segment_index,
-		 segment_offset );
+		if( libscca_statistics_add_allocated_size(
+		     &( io_handle->statistics ),
+		     volumes->volumes_data_size - previous_volumes_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add volumes allocated size.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( volumes != NULL )
+	{
+		volumes->number_of_volumes = 0;
 	}
-	return( segment_offset );
+	return( -1 );
 }
 
@@ -25,13 +25,23 @@
 #include <common.h>
 #include <types.h>
 
+#include "libscca_block_cache.h"
+#include "libscca_budget.h"
+#include "libscca_context.h"
+#include "libscca_file_metrics_values.h"
 #include "libscca_filename_strings.h"
+#include "libscca_format_layout.h"
 #include "libscca_libbfio.h"
-#include "libscca_libcdata.h"
 #include "libscca_libcerror.h"
 #include "libscca_libfcache.h"
 #include "libscca_libfdata.h"
 #include "libscca_libfvalue.h"
+#include "libscca_lzxpress.h"
+#include "libscca_statistics.h"
+#include "libscca_string_pool.h"
+#include "libscca_types.h"
+#include "libscca_volume_dictionary.h"
+#include "libscca_volumes.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,10 +66,101 @@ struct libscca_io_handle
 	 */
 	uint32_t format_version;
 
+	/* The format layout of the format version
+	 */
+	const libscca_format_layout_t *format_layout;
+
 	/* The file size
 	 */
 	uint32_t file_size;
 
+	/* The file size provided by the caller of the open, where 0 represents unknown
+	 * Only set while the file is being opened
+	 */
+	size64_t file_size_hint;
+
+	/* The data at the start of the file provided by the caller of the open
+	 * Only set while the file is being opened, contains NULL if not available
+	 */
+	const uint8_t *prefix_data;
+
+	/* The prefix data size
+	 */
+	size_t prefix_data_size;
+
+	/* The compressed data scratch buffer
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data scratch buffer size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data buffer, used when the compressed data is decompressed
+	 * into a single buffer
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data buffer size
+	 */
+	size_t uncompressed_data_buffer_size;
+
+	/* The section data scratch buffer
+	 */
+	uint8_t *section_data;
+
+	/* The section data scratch buffer size
+	 */
+	size_t section_data_size;
+
+	/* The Huffman decoder cache, which is created when compressed data is first decompressed
+	 * Contains NULL if not created
+	 */
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache;
+
+	/* The parse statistics of the file currently open
+	 */
+	libscca_statistics_t statistics;
+
+	/* The parse budget, which is retained when the IO handle is cleared
+	 */
+	libscca_budget_t budget;
+
+	/* The maximum number of cached compressed blocks, where 0 represents the default,
+	 * which is retained when the IO handle is cleared
+	 */
+	int maximum_number_of_cached_blocks;
+
+	/* The maximum number of file metrics entries that are read, where 0 represents
+	 * all entries, which is retained when the IO handle is cleared
+	 */
+	int maximum_number_of_file_metrics_entries;
+
+	/* The shared block cache, which is retained when the IO handle is cleared
+	 * Contains NULL if the compressed blocks are not shared between files
+	 */
+	libscca_block_cache_t *block_cache;
+
+	/* The shared string pool, which is retained when the IO handle is cleared
+	 * Contains NULL if the strings are not shared between files
+	 */
+	libscca_string_pool_t *string_pool;
+
+	/* The shared volume dictionary, which is retained when the IO handle is cleared
+	 * Contains NULL if no volume identifiers are assigned
+	 */
+	libscca_volume_dictionary_t *volume_dictionary;
+
+	/* The context the scratch buffers are taken from and released to,
+	 * which is retained when the IO handle is cleared
+	 * Contains NULL if the file was not created with a context
+	 */
+	libscca_internal_context_t *context;
+
+	/* The corruption flags of the file currently open
+	 */
+	uint32_t corruption_flags;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -77,6 +178,48 @@ int libscca_io_handle_clear(
      libscca_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libscca_io_handle_set_format_version(
+     libscca_io_handle_t *io_handle,
+     uint32_t format_version,
+     libcerror_error_t **error );
+
+int libscca_io_handle_get_compressed_data_buffer(
+     libscca_io_handle_t *io_handle,
+     size_t compressed_data_size,
+     uint8_t **compressed_data,
+     libcerror_error_t **error );
+
+int libscca_io_handle_get_uncompressed_data_buffer(
+     libscca_io_handle_t *io_handle,
+     size_t uncompressed_data_size,
+     uint8_t **uncompressed_data,
+     libcerror_error_t **error );
+
+int libscca_io_handle_get_section_data_buffer(
+     libscca_io_handle_t *io_handle,
+     size_t section_data_size,
+     uint8_t **section_data,
+     libcerror_error_t **error );
+
+int libscca_io_handle_get_decoder_cache(
+     libscca_io_handle_t *io_handle,
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error );
+
+int libscca_io_handle_read_compressed_file_header_data(
+     libscca_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+ssize_t libscca_io_handle_read_buffer_at_offset(
+     libscca_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
 int libscca_io_handle_read_compressed_file_header(
      libscca_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -84,9 +227,7 @@ int libscca_io_handle_read_compressed_file_header(
 
 int libscca_io_handle_read_compressed_blocks(
      libscca_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
      libfdata_list_t *compressed_blocks_list,
-     libfcache_cache_t *compressed_blocks_cache,
      libcerror_error_t **error );
 
 int libscca_io_handle_read_uncompressed_file_header(
@@ -98,52 +239,34 @@ int libscca_io_handle_read_uncompressed_file_header(
      uint32_t *prefetch_hash,
      libcerror_error_t **error );
 
-int libscca_io_handle_read_file_metrics_array(
+int libscca_io_handle_read_file_metrics_array_data(
      libscca_io_handle_t *io_handle,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint32_t number_of_entries,
-     libscca_filename_strings_t *filename_strings,
-     libcdata_array_t *file_metrics_array,
+     libscca_file_metrics_values_t *file_metrics_values,
      libcerror_error_t **error );
 
-int libscca_io_handle_read_trace_chain_array(
+int libscca_io_handle_visit_file_metrics_array_data(
      libscca_io_handle_t *io_handle,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t file_offset,
+     const uint8_t *data,
+     size_t data_size,
      uint32_t number_of_entries,
+     libscca_file_metrics_t *file_metrics,
+     int (*callback_function)(
+            int entry_index,
+            libscca_file_metrics_t *file_metrics,
+            void *callback_arguments ),
+     void *callback_arguments,
      libcerror_error_t **error );
 
-int libscca_io_handle_read_volumes_information(
+int libscca_io_handle_read_volumes_information_data(
      libscca_io_handle_t *io_handle,
-     libfdata_stream_t *uncompressed_data_stream,
-     libbfio_handle_t *file_io_handle,
-     uint32_t volumes_information_offset,
-     uint32_t volumes_information_size,
+     const uint8_t *data,
+     size_t data_size,
      uint32_t number_of_volumes,
-     libcdata_array_t *volumes_array,
-     libcerror_error_t **error );
-
-ssize_t libscca_io_handle_read_segment_data(
-         intptr_t *data_handle,
-         intptr_t *file_io_handle,
-         int segment_index,
-         int segment_file_index,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags,
-         uint8_t read_flags,
-         libcerror_error_t **error );
-
-off64_t libscca_io_handle_seek_segment_offset(
-         intptr_t *data_handle,
-         intptr_t *file_io_handle,
-         int segment_index,
-         int segment_file_index,
-         off64_t segment_offset,
-         libcerror_error_t **error );
+     libscca_volumes_t *volumes,
+     libcerror_error_t **error );
 
 #if defined( __cplusplus )
 }
@@ -0,0 +1,1514 @@
+/*
+ * LZXpress Huffman decompression functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_libfwnt.h"
+#include "libscca_lzxpress.h"
+#include "libscca_memory.h"
+#include "libscca_unused.h"
+
+/* Builds the Huffman decoder from the 4-bit code sizes of the symbols
+ * The code size of the first symbol is stored in the lower nibble
+ * Returns 1 if successful, 0 if the code sizes do not form a valid prefix code or -1 on error
+ */
+int libscca_lzxpress_huffman_decoder_build(
+     libscca_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *code_sizes_data,
+     size_t code_sizes_data_size,
+     libcerror_error_t **error )
+{
+	uint16_t symbol_indexes[ LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	static char *function        = "libscca_lzxpress_huffman_decoder_build";
+	uint32_t code                = 0;
+	uint32_t code_index          = 0;
+	uint32_t lookup_table_index  = 0;
+	uint32_t number_of_entries   = 0;
+	uint16_t lookup_table_entry  = 0;
+	uint16_t symbol              = 0;
+	uint16_t symbol_index        = 0;
+	uint8_t code_size            = 0;
+	int32_t number_of_free_codes = 1;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes data.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_data_size < ( LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid code sizes data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     decoder->number_of_codes,
+	     0,
+	     sizeof( uint16_t ) * ( LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear number of codes.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		code_size = code_sizes_data[ symbol / 2 ];
+
+		if( ( symbol % 2 ) == 0 )
+		{
+			code_size &= 0x0f;
+		}
+		else
+		{
+			code_size >>= 4;
+		}
+		decoder->number_of_codes[ code_size ] += 1;
+	}
+	decoder->number_of_codes[ 0 ] = 0;
+
+	/* Overlapping codes cannot be decoded, incomplete codes are accepted
+	 * as long as the unused codes do not occur in the data
+	 */
+	for( code_size = 1;
+	     code_size <= LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		number_of_free_codes <<= 1;
+		number_of_free_codes  -= (int32_t) decoder->number_of_codes[ code_size ];
+
+		if( number_of_free_codes < 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_free_codes == ( 1 << LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE ) )
+	{
+		return( 0 );
+	}
+	code         = 0;
+	symbol_index = 0;
+
+	for( code_size = 1;
+	     code_size <= LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		decoder->first_codes[ code_size ]          = (uint16_t) code;
+		decoder->first_symbol_indexes[ code_size ] = symbol_index;
+		symbol_indexes[ code_size ]                = symbol_index;
+
+		code          = ( code + decoder->number_of_codes[ code_size ] ) << 1;
+		symbol_index += decoder->number_of_codes[ code_size ];
+	}
+	for( symbol = 0;
+	     symbol < LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS;
+	     symbol++ )
+	{
+		code_size = code_sizes_data[ symbol / 2 ];
+
+		if( ( symbol % 2 ) == 0 )
+		{
+			code_size &= 0x0f;
+		}
+		else
+		{
+			code_size >>= 4;
+		}
+		if( code_size != 0 )
+		{
+			decoder->sorted_symbols[ symbol_indexes[ code_size ]++ ] = symbol;
+		}
+	}
+	if( memory_set(
+	     decoder->lookup_table,
+	     0,
+	     sizeof( uint16_t ) * ( 1 << LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every code up to the lookup table bits fills all the entries that start with the code
+	 */
+	for( code_size = 1;
+	     code_size <= LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS;
+	     code_size++ )
+	{
+		number_of_entries = (uint32_t) 1 << ( LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS - code_size );
+
+		for( code_index = 0;
+		     code_index < decoder->number_of_codes[ code_size ];
+		     code_index++ )
+		{
+			symbol             = decoder->sorted_symbols[ decoder->first_symbol_indexes[ code_size ] + code_index ];
+			lookup_table_entry = (uint16_t) ( ( symbol << 4 ) | code_size );
+			lookup_table_index = ( decoder->first_codes[ code_size ] + code_index ) * number_of_entries;
+
+			for( code = 0;
+			     code < number_of_entries;
+			     code++ )
+			{
+				decoder->lookup_table[ lookup_table_index + code ] = lookup_table_entry;
+			}
+		}
+	}
+	return( 1 );
+}
+
+
+/* Creates a decoder cache
+ * Make sure the value decoder_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_lzxpress_huffman_decoder_cache_initialize(
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_lzxpress_huffman_decoder_cache_initialize";
+
+	if( decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder_cache = memory_allocate_structure(
+	                  libscca_lzxpress_huffman_decoder_cache_t );
+
+	if( *decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decoder_cache,
+	     0,
+	     sizeof( libscca_lzxpress_huffman_decoder_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoder_cache != NULL )
+	{
+		memory_free(
+		 *decoder_cache );
+
+		*decoder_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decoder cache
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_lzxpress_huffman_decoder_cache_free(
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_lzxpress_huffman_decoder_cache_free";
+
+	if( decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder_cache != NULL )
+	{
+		memory_free(
+		 *decoder_cache );
+
+		*decoder_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the decoder for specific 4-bit code sizes of the symbols
+ * If the cache does not contain a decoder built from the same code sizes, the decoder
+ * is built in the least recently added entry. Similar files and the chunks of the same
+ * file often use the same code sizes, in which case building the decoder is skipped
+ * The decoder remains valid until the next call
+ * Returns 1 if successful, 0 if the code sizes do not form a valid prefix code or -1 on error
+ */
+int libscca_lzxpress_huffman_decoder_cache_get_decoder(
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     const uint8_t *code_sizes_data,
+     size_t code_sizes_data_size,
+     libscca_lzxpress_huffman_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	libscca_lzxpress_huffman_decoder_cache_entry_t *entry = NULL;
+	static char *function                                  = "libscca_lzxpress_huffman_decoder_cache_get_decoder";
+	int entry_index                                        = 0;
+	int result                                             = 0;
+
+	if( decoder_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes data.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_data_size < ( LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid code sizes data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry that was used last is checked first since consecutive chunks
+	 * are likely to use the same code sizes
+	 */
+	entry_index = decoder_cache->last_entry_index;
+
+	do
+	{
+		entry = &( decoder_cache->entries[ entry_index ] );
+
+		if( ( entry->is_set != 0 )
+		 && ( memory_compare(
+		       entry->code_sizes_data,
+		       code_sizes_data,
+		       LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2 ) == 0 ) )
+		{
+			decoder_cache->last_entry_index = entry_index;
+			decoder_cache->number_of_hits  += 1;
+
+			*decoder = &( entry->decoder );
+
+			return( 1 );
+		}
+		entry_index = ( entry_index + 1 ) % LIBSCCA_LZXPRESS_HUFFMAN_DECODER_CACHE_NUMBER_OF_ENTRIES;
+	}
+	while( entry_index != decoder_cache->last_entry_index );
+
+	entry_index = decoder_cache->next_entry_index;
+	entry       = &( decoder_cache->entries[ entry_index ] );
+
+	entry->is_set = 0;
+
+	result = libscca_lzxpress_huffman_decoder_build(
+	          &( entry->decoder ),
+	          code_sizes_data,
+	          code_sizes_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build Huffman decoder.",
+			 function );
+		}
+		return( result );
+	}
+	if( memory_copy(
+	     entry->code_sizes_data,
+	     code_sizes_data,
+	     LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy code sizes data.",
+		 function );
+
+		return( -1 );
+	}
+	entry->is_set = 1;
+
+	decoder_cache->last_entry_index  = entry_index;
+	decoder_cache->next_entry_index  = ( entry_index + 1 ) % LIBSCCA_LZXPRESS_HUFFMAN_DECODER_CACHE_NUMBER_OF_ENTRIES;
+	decoder_cache->number_of_misses += 1;
+
+	*decoder = &( entry->decoder );
+
+	return( 1 );
+}
+
+/* Decodes a chunk of LZXpress Huffman compressed data
+ *
+ * The symbols are decoded from a 64-bit bit buffer using the lookup table.
+ * The bit buffer is synchronized with the 32-bit bit buffer of the reference decoder
+ * before the extended match lengths and the next chunk are read, so the byte positions
+ * are the same as those of the reference decoder.
+ *
+ * The literals are always stored in the uncompressed data. If chunk is NULL the matches
+ * are expanded using 8-byte copies where the match does not overlap within the copy,
+ * otherwise the matches are stored in the chunk to be expanded later in order.
+ *
+ * If decoder_cache is not NULL the decoder is retrieved from the cache, otherwise
+ * the decoder is built on the stack.
+ *
+ * Returns 1 on success, 0 if the data cannot be decompressed by the fast path or -1 on error
+ */
+int libscca_lzxpress_huffman_decode_chunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libscca_lzxpress_huffman_chunk_t *chunk,
+     int *end_of_stream,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error )
+{
+	libscca_lzxpress_huffman_decoder_t stack_decoder;
+
+	libscca_lzxpress_huffman_decoder_t *decoder = NULL;
+	const uint8_t *match_data                   = NULL;
+	uint8_t *match_end                          = NULL;
+	uint8_t *match_output                       = NULL;
+	static char *function                       = "libscca_lzxpress_huffman_decode_chunk";
+	size_t chunk_end_offset                     = 0;
+	size_t data_offset                          = 0;
+	size_t output_offset                        = 0;
+	size_t reference_data_offset                = 0;
+	uint64_t bit_buffer                         = 0;
+	uint32_t match_length                       = 0;
+	uint32_t match_offset                       = 0;
+	uint16_t lookup_bits                        = 0;
+	uint16_t lookup_table_entry                 = 0;
+	uint16_t symbol                             = 0;
+	uint16_t value_16bit                        = 0;
+	uint8_t bit_buffer_size                     = 0;
+	uint8_t code_size                           = 0;
+	uint8_t number_of_reference_bits            = 0;
+	uint8_t offset_size                         = 0;
+	int result                                  = 0;
+
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_of_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end of stream.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset   = *compressed_data_offset;
+	output_offset = *uncompressed_data_offset;
+
+	if( ( data_offset > compressed_data_size )
+	 || ( ( compressed_data_size - data_offset ) < ( ( LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2 ) + 4 ) ) )
+	{
+		return( 0 );
+	}
+	if( decoder_cache != NULL )
+	{
+		result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+		          decoder_cache,
+		          &( compressed_data[ data_offset ] ),
+		          LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2,
+		          &decoder,
+		          error );
+	}
+	else
+	{
+		decoder = &stack_decoder;
+
+		result = libscca_lzxpress_huffman_decoder_build(
+		          decoder,
+		          &( compressed_data[ data_offset ] ),
+		          LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2,
+		          error );
+	}
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build Huffman decoder.",
+			 function );
+		}
+		return( result );
+	}
+	if( chunk != NULL )
+	{
+		chunk->number_of_matches = 0;
+	}
+	data_offset += LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( compressed_data[ data_offset ] ),
+	 value_16bit );
+
+	bit_buffer = (uint64_t) value_16bit << 16;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( compressed_data[ data_offset + 2 ] ),
+	 value_16bit );
+
+	bit_buffer     |= value_16bit;
+	bit_buffer_size = 32;
+
+	data_offset += 4;
+
+	chunk_end_offset = output_offset + LIBSCCA_LZXPRESS_HUFFMAN_CHUNK_SIZE;
+
+	while( ( output_offset < chunk_end_offset )
+	    && ( output_offset < uncompressed_data_size ) )
+	{
+		/* A symbol and its match offset require at most 30 bits
+		 */
+		if( bit_buffer_size <= 32 )
+		{
+			if( ( compressed_data_size - data_offset ) >= 4 )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ data_offset ] ),
+				 value_16bit );
+
+				bit_buffer = ( bit_buffer << 16 ) | value_16bit;
+
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ data_offset + 2 ] ),
+				 value_16bit );
+
+				bit_buffer = ( bit_buffer << 16 ) | value_16bit;
+
+				bit_buffer_size += 32;
+				data_offset     += 4;
+			}
+			else if( ( compressed_data_size - data_offset ) >= 2 )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ data_offset ] ),
+				 value_16bit );
+
+				bit_buffer = ( bit_buffer << 16 ) | value_16bit;
+
+				bit_buffer_size += 16;
+				data_offset     += 2;
+			}
+		}
+		if( bit_buffer_size >= LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE )
+		{
+			lookup_bits = (uint16_t) ( bit_buffer >> ( bit_buffer_size - LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE ) );
+		}
+		else
+		{
+			lookup_bits = (uint16_t) ( bit_buffer << ( LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE - bit_buffer_size ) );
+		}
+		lookup_bits &= ( 1 << LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE ) - 1;
+
+		lookup_table_entry = decoder->lookup_table[ lookup_bits >> ( LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE - LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ) ];
+
+		if( lookup_table_entry != 0 )
+		{
+			symbol    = lookup_table_entry >> 4;
+			code_size = (uint8_t) ( lookup_table_entry & 0x0f );
+		}
+		else
+		{
+			for( code_size = LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS + 1;
+			     code_size <= LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE;
+			     code_size++ )
+			{
+				value_16bit = lookup_bits >> ( LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE - code_size );
+
+				if( ( value_16bit >= decoder->first_codes[ code_size ] )
+				 && ( ( value_16bit - decoder->first_codes[ code_size ] ) < decoder->number_of_codes[ code_size ] ) )
+				{
+					symbol = decoder->sorted_symbols[ decoder->first_symbol_indexes[ code_size ] + value_16bit - decoder->first_codes[ code_size ] ];
+
+					break;
+				}
+			}
+			if( code_size > LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE )
+			{
+				return( 0 );
+			}
+		}
+		if( code_size > bit_buffer_size )
+		{
+			return( 0 );
+		}
+		bit_buffer_size -= code_size;
+
+		if( symbol < 256 )
+		{
+			uncompressed_data[ output_offset++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		/* The reference decoder holds 16 to 31 bits after a symbol, any additional
+		 * bits in the bit buffer were read ahead, while 16 bits less means
+		 * the reference decoder already read the next 16-bit word
+		 */
+		number_of_reference_bits = 16 + ( bit_buffer_size % 16 );
+
+		if( bit_buffer_size < number_of_reference_bits )
+		{
+			reference_data_offset = data_offset + 2;
+		}
+		else
+		{
+			reference_data_offset = data_offset - ( ( bit_buffer_size - number_of_reference_bits ) / 8 );
+		}
+		if( ( symbol == 256 )
+		 && ( reference_data_offset >= compressed_data_size ) )
+		{
+			*end_of_stream = 1;
+
+			break;
+		}
+		symbol      -= 256;
+		match_length = symbol & 0x0f;
+		offset_size  = (uint8_t) ( symbol >> 4 );
+
+		if( match_length == 15 )
+		{
+			if( reference_data_offset > compressed_data_size )
+			{
+				return( 0 );
+			}
+			if( bit_buffer_size < number_of_reference_bits )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ data_offset ] ),
+				 value_16bit );
+
+				bit_buffer = ( bit_buffer << 16 ) | value_16bit;
+			}
+			else
+			{
+				bit_buffer >>= bit_buffer_size - number_of_reference_bits;
+			}
+			bit_buffer_size = number_of_reference_bits;
+			data_offset     = reference_data_offset;
+
+			if( data_offset >= compressed_data_size )
+			{
+				return( 0 );
+			}
+			match_length = compressed_data[ data_offset++ ];
+
+			if( match_length == 255 )
+			{
+				if( ( compressed_data_size - data_offset ) < 2 )
+				{
+					return( 0 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ data_offset ] ),
+				 match_length );
+
+				data_offset += 2;
+
+				if( match_length == 0 )
+				{
+					if( ( compressed_data_size - data_offset ) < 4 )
+					{
+						return( 0 );
+					}
+					byte_stream_copy_to_uint32_little_endian(
+					 &( compressed_data[ data_offset ] ),
+					 match_length );
+
+					data_offset += 4;
+				}
+				if( match_length < 15 )
+				{
+					return( 0 );
+				}
+				match_length -= 15;
+			}
+			match_length += 15;
+		}
+		match_length += 3;
+
+		if( offset_size > bit_buffer_size )
+		{
+			return( 0 );
+		}
+		match_offset = (uint32_t) 1 << offset_size;
+
+		if( offset_size > 0 )
+		{
+			bit_buffer_size -= offset_size;
+			match_offset    |= (uint32_t) ( bit_buffer >> bit_buffer_size ) & ( match_offset - 1 );
+		}
+		if( ( (size_t) match_offset > output_offset )
+		 || ( (size_t) match_length > ( uncompressed_data_size - output_offset ) ) )
+		{
+			return( 0 );
+		}
+		if( chunk != NULL )
+		{
+			if( chunk->number_of_matches >= LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_NUMBER_OF_MATCHES )
+			{
+				return( 0 );
+			}
+			chunk->matches[ chunk->number_of_matches ].uncompressed_data_offset = output_offset;
+			chunk->matches[ chunk->number_of_matches ].match_offset             = match_offset;
+			chunk->matches[ chunk->number_of_matches ].match_length             = match_length;
+
+			chunk->number_of_matches += 1;
+			output_offset            += match_length;
+
+			continue;
+		}
+		match_data   = &( uncompressed_data[ output_offset - match_offset ] );
+		match_output = &( uncompressed_data[ output_offset ] );
+		match_end    = &( match_output[ match_length ] );
+
+		/* The 8-byte copies can write up to 7 bytes beyond the end of the match
+		 */
+		if( ( match_offset >= 8 )
+		 && ( ( uncompressed_data_size - output_offset ) >= ( (size_t) match_length + 8 ) ) )
+		{
+			while( match_output < match_end )
+			{
+				memory_copy(
+				 match_output,
+				 match_data,
+				 8 );
+
+				match_output += 8;
+				match_data   += 8;
+			}
+		}
+		else
+		{
+			while( match_output < match_end )
+			{
+				*match_output++ = *match_data++;
+			}
+		}
+		output_offset += match_length;
+	}
+	if( *end_of_stream == 0 )
+	{
+		/* The next chunk starts after the 16-bit words read by the reference decoder
+		 */
+		number_of_reference_bits = 16 + ( bit_buffer_size % 16 );
+
+		if( bit_buffer_size < number_of_reference_bits )
+		{
+			data_offset += 2;
+		}
+		else
+		{
+			data_offset -= ( bit_buffer_size - number_of_reference_bits ) / 8;
+		}
+		if( data_offset > compressed_data_size )
+		{
+			data_offset = compressed_data_size;
+		}
+	}
+	*compressed_data_offset   = data_offset;
+	*uncompressed_data_offset = output_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZXpress Huffman compressed data using the table-driven fast path
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the size of the uncompressed data
+ * Returns 1 on success, 0 if the data cannot be decompressed by the fast path or -1 on error
+ */
+int libscca_lzxpress_huffman_decompress_fast(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function           = "libscca_lzxpress_huffman_decompress_fast";
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_offset = 0;
+	int end_of_stream               = 0;
+	int result                      = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( end_of_stream == 0 )
+	    && ( compressed_data_offset < compressed_data_size )
+	    && ( uncompressed_data_offset < *uncompressed_data_size ) )
+	{
+		result = libscca_lzxpress_huffman_decode_chunk(
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          uncompressed_data,
+		          *uncompressed_data_size,
+		          &uncompressed_data_offset,
+		          NULL,
+		          &end_of_stream,
+		          decoder_cache,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decode chunk.",
+				 function );
+			}
+			return( result );
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Expands the matches of the decoded chunks in order
+ * This function is the start function of the expand thread of the two-phase decompression
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_lzxpress_huffman_two_phase_expand_thread_callback(
+     libscca_lzxpress_huffman_two_phase_context_t *context )
+{
+	libscca_lzxpress_huffman_chunk_t *chunk = NULL;
+	libscca_lzxpress_huffman_match_t *match = NULL;
+	const uint8_t *match_data               = NULL;
+	uint8_t *match_end                      = NULL;
+	uint8_t *match_output                   = NULL;
+	int is_last                             = 0;
+	int match_index                         = 0;
+	int result                              = 1;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	while( is_last == 0 )
+	{
+		if( libcthreads_queue_pop(
+		     context->decoded_chunks_queue,
+		     (intptr_t **) &chunk,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		/* The matches are copied exactly since the literals after a match and
+		 * the next chunk are stored concurrently by the decode phase
+		 */
+		for( match_index = 0;
+		     match_index < chunk->number_of_matches;
+		     match_index++ )
+		{
+			match        = &( chunk->matches[ match_index ] );
+			match_output = &( context->uncompressed_data[ match->uncompressed_data_offset ] );
+			match_data   = match_output - match->match_offset;
+
+			if( match->match_offset >= match->match_length )
+			{
+				memory_copy(
+				 match_output,
+				 match_data,
+				 (size_t) match->match_length );
+			}
+			else
+			{
+				match_end = &( match_output[ match->match_length ] );
+
+				while( match_output < match_end )
+				{
+					*match_output++ = *match_data++;
+				}
+			}
+		}
+		is_last = chunk->is_last;
+
+		if( libcthreads_queue_push(
+		     context->free_chunks_queue,
+		     (intptr_t *) chunk,
+		     NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses LZXpress Huffman compressed data in two phases
+ *
+ * The chunks are decoded on the calling thread, which stores the literals and
+ * records the matches, while the matches of the previous chunks are expanded in
+ * order by the expand thread. The chunks cannot be decoded in parallel since the
+ * start of a chunk is only known after the previous chunk was decoded and since
+ * matches can refer to the uncompressed data of previous chunks.
+ *
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the size of the uncompressed data
+ * Returns 1 on success, 0 if the data cannot be decompressed in two phases or -1 on error
+ */
+int libscca_lzxpress_huffman_decompress_two_phase(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libscca_lzxpress_huffman_chunk_t *chunks[ LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS ];
+
+	libscca_lzxpress_huffman_two_phase_context_t context;
+
+	libcthreads_thread_t *expand_thread     = NULL;
+	libscca_lzxpress_huffman_chunk_t *chunk = NULL;
+	size_t compressed_data_offset           = 0;
+	size_t uncompressed_data_offset         = 0;
+	int chunk_index                         = 0;
+	int end_of_stream                       = 0;
+	int is_last                             = 0;
+#endif
+	static char *function                   = "libscca_lzxpress_huffman_decompress_two_phase";
+	int result                              = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( memory_set(
+	     chunks,
+	     0,
+	     sizeof( libscca_lzxpress_huffman_chunk_t * ) * LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &context,
+	     0,
+	     sizeof( libscca_lzxpress_huffman_two_phase_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear context.",
+		 function );
+
+		return( -1 );
+	}
+	context.uncompressed_data = uncompressed_data;
+
+	if( libcthreads_queue_initialize(
+	     &( context.decoded_chunks_queue ),
+	     LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoded chunks queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( context.free_chunks_queue ),
+	     LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free chunks queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS;
+	     chunk_index++ )
+	{
+		chunks[ chunk_index ] = memory_allocate_structure(
+		                         libscca_lzxpress_huffman_chunk_t );
+
+		if( chunks[ chunk_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunks[ chunk_index ]->number_of_matches = 0;
+		chunks[ chunk_index ]->is_last           = 0;
+
+		if( libcthreads_queue_push(
+		     context.free_chunks_queue,
+		     (intptr_t *) chunks[ chunk_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk: %d onto free chunks queue.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_create(
+	     &expand_thread,
+	     NULL,
+	     (int (*)(void *)) &libscca_lzxpress_huffman_two_phase_expand_thread_callback,
+	     (void *) &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create expand thread.",
+		 function );
+
+		goto on_error;
+	}
+	/* The last chunk is always pushed, also when decoding failed, so that the
+	 * expand thread stops before the uncompressed data is reused. If the queues
+	 * fail the expand thread cannot be stopped and the resources are not freed.
+	 */
+	while( is_last == 0 )
+	{
+		if( libcthreads_queue_pop(
+		     context.free_chunks_queue,
+		     (intptr_t **) &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop chunk from free chunks queue.",
+			 function );
+
+			return( -1 );
+		}
+		result = libscca_lzxpress_huffman_decode_chunk(
+		          compressed_data,
+		          compressed_data_size,
+		          &compressed_data_offset,
+		          uncompressed_data,
+		          *uncompressed_data_size,
+		          &uncompressed_data_offset,
+		          chunk,
+		          &end_of_stream,
+		          decoder_cache,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decode chunk.",
+				 function );
+			}
+			chunk->number_of_matches = 0;
+		}
+		if( ( result != 1 )
+		 || ( end_of_stream != 0 )
+		 || ( compressed_data_offset >= compressed_data_size )
+		 || ( uncompressed_data_offset >= *uncompressed_data_size ) )
+		{
+			is_last = 1;
+		}
+		chunk->is_last = is_last;
+
+		if( libcthreads_queue_push(
+		     context.decoded_chunks_queue,
+		     (intptr_t *) chunk,
+		     NULL ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push chunk onto decoded chunks queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_thread_join(
+	     &expand_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join expand thread.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_queue_free(
+	     &( context.free_chunks_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free free chunks queue.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_queue_free(
+	     &( context.decoded_chunks_queue ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoded chunks queue.",
+		 function );
+
+		result = -1;
+	}
+	for( chunk_index = 0;
+	     chunk_index < LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS;
+	     chunk_index++ )
+	{
+		memory_free(
+		 chunks[ chunk_index ] );
+	}
+	if( result == 1 )
+	{
+		*uncompressed_data_size = uncompressed_data_offset;
+	}
+	return( result );
+
+on_error:
+	if( context.free_chunks_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( context.free_chunks_queue ),
+		 NULL,
+		 NULL );
+	}
+	if( context.decoded_chunks_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( context.decoded_chunks_queue ),
+		 NULL,
+		 NULL );
+	}
+	for( chunk_index = 0;
+	     chunk_index < LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ] != NULL )
+		{
+			memory_free(
+			 chunks[ chunk_index ] );
+		}
+	}
+	return( -1 );
+#else
+	LIBSCCA_UNREFERENCED_PARAMETER( decoder_cache )
+
+	return( result );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Decompresses LZXpress Huffman compressed data
+ * The data is decompressed by the two-phase path if LIBSCCA_LZXPRESS_HUFFMAN_FLAG_TWO_PHASE is set
+ * and the uncompressed data is sufficiently large, otherwise or if the two-phase path cannot
+ * decompress the data by the fast path and by libfwnt if the fast path cannot decompress it
+ * If decoder_cache is not NULL the decoders of the chunks are retrieved from the cache
+ * On input uncompressed_data_size contains the size of the uncompressed data buffer
+ * and on output the size of the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libscca_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t decompression_flags,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libscca_lzxpress_huffman_decompress";
+	size_t fast_path_uncompressed_data_size = 0;
+	int result                              = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( decompression_flags & LIBSCCA_LZXPRESS_HUFFMAN_FLAG_TWO_PHASE ) != 0 )
+	 && ( *uncompressed_data_size >= LIBSCCA_LZXPRESS_HUFFMAN_TWO_PHASE_MINIMUM_DATA_SIZE ) )
+	{
+		fast_path_uncompressed_data_size = *uncompressed_data_size;
+
+		result = libscca_lzxpress_huffman_decompress_two_phase(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &fast_path_uncompressed_data_size,
+		          decoder_cache,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data using two-phase path.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*uncompressed_data_size = fast_path_uncompressed_data_size;
+
+			return( 1 );
+		}
+	}
+	fast_path_uncompressed_data_size = *uncompressed_data_size;
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &fast_path_uncompressed_data_size,
+	          decoder_cache,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data using fast path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*uncompressed_data_size = fast_path_uncompressed_data_size;
+
+		return( 1 );
+	}
+	if( libfwnt_lzxpress_huffman_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,271 @@
+/*
+ * LZXpress Huffman decompression functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_LZXPRESS_H )
+#define _LIBSCCA_LZXPRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of Huffman symbols
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS		512
+
+/* The maximum Huffman code size
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE		15
+
+/* The number of bits of the lookup table, longer codes are decoded per code size
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS		11
+
+/* The number of decoders in the decoder cache
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_DECODER_CACHE_NUMBER_OF_ENTRIES	4
+
+/* The size of an uncompressed chunk
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_CHUNK_SIZE			65536
+
+/* The maximum number of matches in a chunk, a match is at least 3 bytes
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_NUMBER_OF_MATCHES	( ( LIBSCCA_LZXPRESS_HUFFMAN_CHUNK_SIZE + 2 ) / 3 )
+
+/* The number of chunk buffers used by the two-phase decompression
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_CHUNK_BUFFERS	3
+
+/* The minimum uncompressed data size for which the two-phase decompression is used,
+ * smaller data is decompressed faster without the expand thread
+ */
+#define LIBSCCA_LZXPRESS_HUFFMAN_TWO_PHASE_MINIMUM_DATA_SIZE	( 4 * LIBSCCA_LZXPRESS_HUFFMAN_CHUNK_SIZE )
+
+/* The decompression flags
+ */
+enum LIBSCCA_LZXPRESS_HUFFMAN_FLAGS
+{
+	/* Decode the chunks and expand the matches on separate threads
+	 */
+	LIBSCCA_LZXPRESS_HUFFMAN_FLAG_TWO_PHASE			= 0x01
+};
+
+typedef struct libscca_lzxpress_huffman_decoder libscca_lzxpress_huffman_decoder_t;
+
+struct libscca_lzxpress_huffman_decoder
+{
+	/* The lookup table
+	 * Every entry contains the symbol in the upper 12 bits and the code size
+	 * in the lower 4 bits, or 0 if the code is longer than the lookup table bits
+	 */
+	uint16_t lookup_table[ 1 << LIBSCCA_LZXPRESS_HUFFMAN_LOOKUP_TABLE_BITS ];
+
+	/* The number of codes per code size
+	 */
+	uint16_t number_of_codes[ LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The first code per code size
+	 */
+	uint16_t first_codes[ LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The index of the first symbol in the sorted symbols per code size
+	 */
+	uint16_t first_symbol_indexes[ LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The symbols sorted by code size and symbol
+	 */
+	uint16_t sorted_symbols[ LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+};
+
+typedef struct libscca_lzxpress_huffman_decoder_cache_entry libscca_lzxpress_huffman_decoder_cache_entry_t;
+
+struct libscca_lzxpress_huffman_decoder_cache_entry
+{
+	/* The 4-bit code sizes of the symbols the decoder was built from
+	 */
+	uint8_t code_sizes_data[ LIBSCCA_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS / 2 ];
+
+	/* The decoder
+	 */
+	libscca_lzxpress_huffman_decoder_t decoder;
+
+	/* Value to indicate the entry contains a decoder
+	 */
+	int is_set;
+};
+
+typedef struct libscca_lzxpress_huffman_decoder_cache libscca_lzxpress_huffman_decoder_cache_t;
+
+struct libscca_lzxpress_huffman_decoder_cache
+{
+	/* The entries
+	 */
+	libscca_lzxpress_huffman_decoder_cache_entry_t entries[ LIBSCCA_LZXPRESS_HUFFMAN_DECODER_CACHE_NUMBER_OF_ENTRIES ];
+
+	/* The index of the entry that was used last
+	 */
+	int last_entry_index;
+
+	/* The index of the entry that is replaced next
+	 */
+	int next_entry_index;
+
+	/* The number of decoders that were found in the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of decoders that were built
+	 */
+	uint64_t number_of_misses;
+};
+
+typedef struct libscca_lzxpress_huffman_match libscca_lzxpress_huffman_match_t;
+
+struct libscca_lzxpress_huffman_match
+{
+	/* The offset of the match in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The match offset relative to the uncompressed data offset
+	 */
+	uint32_t match_offset;
+
+	/* The match length
+	 */
+	uint32_t match_length;
+};
+
+typedef struct libscca_lzxpress_huffman_chunk libscca_lzxpress_huffman_chunk_t;
+
+struct libscca_lzxpress_huffman_chunk
+{
+	/* The matches in order of the uncompressed data
+	 */
+	libscca_lzxpress_huffman_match_t matches[ LIBSCCA_LZXPRESS_HUFFMAN_MAXIMUM_NUMBER_OF_MATCHES ];
+
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* Value to indicate the chunk is the last chunk
+	 */
+	int is_last;
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libscca_lzxpress_huffman_two_phase_context libscca_lzxpress_huffman_two_phase_context_t;
+
+struct libscca_lzxpress_huffman_two_phase_context
+{
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The queue of the decoded chunks of which the matches need to be expanded
+	 */
+	libcthreads_queue_t *decoded_chunks_queue;
+
+	/* The queue of the chunks available for decoding
+	 */
+	libcthreads_queue_t *free_chunks_queue;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libscca_lzxpress_huffman_decoder_build(
+     libscca_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *code_sizes_data,
+     size_t code_sizes_data_size,
+     libcerror_error_t **error );
+
+int libscca_lzxpress_huffman_decoder_cache_initialize(
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error );
+
+int libscca_lzxpress_huffman_decoder_cache_free(
+     libscca_lzxpress_huffman_decoder_cache_t **decoder_cache,
+     libcerror_error_t **error );
+
+int libscca_lzxpress_huffman_decoder_cache_get_decoder(
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     const uint8_t *code_sizes_data,
+     size_t code_sizes_data_size,
+     libscca_lzxpress_huffman_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int libscca_lzxpress_huffman_decode_chunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libscca_lzxpress_huffman_chunk_t *chunk,
+     int *end_of_stream,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error );
+
+int libscca_lzxpress_huffman_decompress_fast(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libscca_lzxpress_huffman_two_phase_expand_thread_callback(
+     libscca_lzxpress_huffman_two_phase_context_t *context );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libscca_lzxpress_huffman_decompress_two_phase(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error );
+
+int libscca_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t decompression_flags,
+     libscca_lzxpress_huffman_decoder_cache_t *decoder_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_LZXPRESS_H ) */
+
@@ -0,0 +1,701 @@
+/*
+ * Memory-mapped file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "libscca_libcerror.h"
+#include "libscca_mapped_file.h"
+#include "libscca_memory.h"
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_FSTAT ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE )
+#define LIBSCCA_HAVE_MMAP	1
+#endif
+
+#if !defined( O_BINARY )
+#define O_BINARY		0
+#endif
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mapped_file_initialize(
+     libscca_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                libscca_mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( libscca_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mapped_file != NULL )
+	{
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file
+ * Unmaps the data if still mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mapped_file_free(
+     libscca_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( libscca_mapped_file_close(
+		     *mapped_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close mapped file.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+#if defined( WINAPI )
+
+/* Maps the data of an open file handle into memory
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libscca_mapped_file_map_handle(
+     libscca_mapped_file_t *mapped_file,
+     HANDLE file_handle,
+     libcerror_error_t **error )
+{
+	HANDLE mapping_handle = NULL;
+	static char *function = "libscca_mapped_file_map_handle";
+	DWORD error_code      = 0;
+	DWORD file_size_lower = 0;
+	DWORD file_size_upper = 0;
+	LPVOID data           = NULL;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	file_size_lower = GetFileSize(
+	                   file_handle,
+	                   &file_size_upper );
+
+	if( file_size_lower == INVALID_FILE_SIZE )
+	{
+		error_code = GetLastError();
+
+		if( error_code != NO_ERROR )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 error_code,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Empty files cannot be mapped and files that do not fit in
+	 * the address space are left to the file IO handle
+	 */
+	if( ( file_size_lower == 0 )
+	 && ( file_size_upper == 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( ( (uint64_t) file_size_upper << 32 ) | file_size_lower ) > (uint64_t) SSIZE_MAX )
+	{
+		return( 0 );
+	}
+	mapping_handle = CreateFileMapping(
+	                  file_handle,
+	                  NULL,
+	                  PAGE_READONLY,
+	                  0,
+	                  0,
+	                  NULL );
+
+	if( mapping_handle == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to create file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	data = MapViewOfFile(
+	        mapping_handle,
+	        FILE_MAP_READ,
+	        0,
+	        0,
+	        0 );
+
+	if( data == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to map view of file.",
+		 function );
+
+		CloseHandle(
+		 mapping_handle );
+
+		return( -1 );
+	}
+	/* The view keeps a reference to the mapping object
+	 */
+	CloseHandle(
+	 mapping_handle );
+
+	mapped_file->data      = (uint8_t *) data;
+	mapped_file->data_size = (size_t) ( ( (uint64_t) file_size_upper << 32 ) | file_size_lower );
+
+	return( 1 );
+}
+
+#else
+
+/* Maps the data of an open file descriptor into memory
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libscca_mapped_file_map_descriptor(
+     libscca_mapped_file_t *mapped_file,
+     int file_descriptor,
+     libcerror_error_t **error )
+{
+#if defined( LIBSCCA_HAVE_MMAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+#endif
+	static char *function = "libscca_mapped_file_map_descriptor";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBSCCA_HAVE_MMAP )
+	if( memory_set(
+	     &file_statistics,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only regular files are mapped, empty files cannot be mapped and
+	 * files that do not fit in the address space are left to the file IO handle
+	 */
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		return( 0 );
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_PRIVATE,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MADVISE ) && defined( MADV_WILLNEED )
+	/* The file is parsed in one pass right after it is mapped
+	 * hence a failing read-ahead hint is not considered an error
+	 */
+	madvise(
+	 data,
+	 (size_t) file_statistics.st_size,
+	 MADV_WILLNEED );
+#endif
+	mapped_file->data      = (uint8_t *) data;
+	mapped_file->data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+#else
+	return( 0 );
+
+#endif /* defined( LIBSCCA_HAVE_MMAP ) */
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Opens and maps a file into memory
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libscca_mapped_file_open(
+     libscca_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+#elif defined( LIBSCCA_HAVE_MMAP )
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libscca_mapped_file_open";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileA(
+	               (LPCSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	result = libscca_mapped_file_map_handle(
+	          mapped_file,
+	          file_handle,
+	          error );
+
+	/* The mapping remains valid after the file handle is closed
+	 */
+	CloseHandle(
+	 file_handle );
+
+#elif defined( LIBSCCA_HAVE_MMAP )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY | O_BINARY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	result = libscca_mapped_file_map_descriptor(
+	          mapped_file,
+	          file_descriptor,
+	          error );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+#endif /* defined( WINAPI ) */
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens and maps a file into memory
+ * Only supported on Windows, on other platforms the wide filename
+ * is left to the file IO handle to convert
+ * Returns 1 if successful, 0 if the file cannot be mapped or -1 on error
+ */
+int libscca_mapped_file_open_wide(
+     libscca_mapped_file_t *mapped_file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	HANDLE file_handle    = INVALID_HANDLE_VALUE;
+#endif
+	static char *function = "libscca_mapped_file_open_wide";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_handle = CreateFileW(
+	               (LPCWSTR) filename,
+	               GENERIC_READ,
+	               FILE_SHARE_READ | FILE_SHARE_WRITE,
+	               NULL,
+	               OPEN_EXISTING,
+	               FILE_ATTRIBUTE_NORMAL,
+	               NULL );
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	result = libscca_mapped_file_map_handle(
+	          mapped_file,
+	          file_handle,
+	          error );
+
+	CloseHandle(
+	 file_handle );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %ls.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+#endif /* defined( WINAPI ) */
+
+	return( result );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Unmaps the file data
+ * Returns 0 if successful or -1 on error
+ */
+int libscca_mapped_file_close(
+     libscca_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mapped_file_close";
+	int result            = 0;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( UnmapViewOfFile(
+	     (LPCVOID) mapped_file->data ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 GetLastError(),
+		 "%s: unable to unmap view of file.",
+		 function );
+
+		result = -1;
+	}
+#elif defined( LIBSCCA_HAVE_MMAP )
+	if( munmap(
+	     (void *) mapped_file->data,
+	     mapped_file->data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to unmap file.",
+		 function );
+
+		result = -1;
+	}
+#endif /* defined( WINAPI ) */
+
+	mapped_file->data      = NULL;
+	mapped_file->data_size = 0;
+
+	return( result );
+}
+
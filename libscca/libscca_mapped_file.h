@@ -0,0 +1,97 @@
+/*
+ * Memory-mapped file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_MAPPED_FILE_H )
+#define _LIBSCCA_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_mapped_file libscca_mapped_file_t;
+
+struct libscca_mapped_file
+{
+	/* The mapped data
+	 * Contains NULL if no file is mapped
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+};
+
+int libscca_mapped_file_initialize(
+     libscca_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libscca_mapped_file_free(
+     libscca_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+#if defined( WINAPI )
+int libscca_mapped_file_map_handle(
+     libscca_mapped_file_t *mapped_file,
+     HANDLE file_handle,
+     libcerror_error_t **error );
+
+#else
+int libscca_mapped_file_map_descriptor(
+     libscca_mapped_file_t *mapped_file,
+     int file_descriptor,
+     libcerror_error_t **error );
+
+#endif /* defined( WINAPI ) */
+
+int libscca_mapped_file_open(
+     libscca_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libscca_mapped_file_open_wide(
+     libscca_mapped_file_t *mapped_file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libscca_mapped_file_close(
+     libscca_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_MAPPED_FILE_H ) */
+
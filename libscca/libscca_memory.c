@@ -0,0 +1,236 @@
+/*
+ * Memory allocation functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#define LIBSCCA_MEMORY_DEFAULT_FUNCTIONS
+
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+#include "libscca_unused.h"
+
+/* The allocation functions, where NULL represents the memory.h allocation functions
+ * The functions are not locked, hence they should only be changed before
+ * any libscca value is created or after all of them have been freed
+ */
+void *(*libscca_memory_allocate_function)(
+        size_t size,
+        void *user_data ) = NULL;
+
+void *(*libscca_memory_reallocate_function)(
+        void *buffer,
+        size_t size,
+        void *user_data ) = NULL;
+
+void (*libscca_memory_free_function)(
+       void *buffer,
+       void *user_data ) = NULL;
+
+void *libscca_memory_user_data = NULL;
+
+/* The memory pressure function, which is called when an allocation fails
+ * The function is not locked, see the allocation functions
+ */
+int (*libscca_memory_pressure_function)(
+       size_t size,
+       void *user_data ) = NULL;
+
+void *libscca_memory_pressure_user_data = NULL;
+
+/* Sets the allocation functions
+ * Either all functions must be set or none, where none restores the memory.h allocation functions
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_memory_set_functions(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *buffer,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+             void *buffer,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_memory_set_functions";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		libscca_memory_allocate_function   = NULL;
+		libscca_memory_reallocate_function = NULL;
+		libscca_memory_free_function       = NULL;
+		libscca_memory_user_data           = NULL;
+
+		return( 1 );
+	}
+	if( ( allocate_function == NULL )
+	 || ( reallocate_function == NULL )
+	 || ( free_function == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation functions - either all or none must be set.",
+		 function );
+
+		return( -1 );
+	}
+	libscca_memory_allocate_function   = allocate_function;
+	libscca_memory_reallocate_function = reallocate_function;
+	libscca_memory_free_function       = free_function;
+	libscca_memory_user_data           = user_data;
+
+	return( 1 );
+}
+
+/* Sets the memory pressure function
+ * The function is called with the size of the allocation when an allocation fails
+ * and returns 1 if memory was released, after which the allocation is retried once,
+ * or 0 if not. A function of NULL removes the memory pressure function
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_memory_set_pressure_function(
+     int (*pressure_function)(
+            size_t size,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	LIBSCCA_UNREFERENCED_PARAMETER( error )
+
+	libscca_memory_pressure_function  = pressure_function;
+	libscca_memory_pressure_user_data = user_data;
+
+	return( 1 );
+}
+
+/* Allocates a buffer
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *libscca_memory_allocate(
+       size_t size )
+{
+	void *buffer  = NULL;
+	int iteration = 0;
+
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		if( libscca_memory_allocate_function != NULL )
+		{
+			buffer = libscca_memory_allocate_function(
+			          size,
+			          libscca_memory_user_data );
+		}
+		else
+		{
+			buffer = memory_allocate(
+			          size );
+		}
+		if( ( buffer != NULL )
+		 || ( size == 0 )
+		 || ( libscca_memory_pressure_function == NULL ) )
+		{
+			break;
+		}
+		if( ( iteration > 0 )
+		 || ( libscca_memory_pressure_function(
+		       size,
+		       libscca_memory_pressure_user_data ) != 1 ) )
+		{
+			break;
+		}
+	}
+	return( buffer );
+}
+
+/* Reallocates a buffer
+ * The buffer is not changed if the reallocation fails hence it can be retried
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *libscca_memory_reallocate(
+       void *buffer,
+       size_t size )
+{
+	void *reallocated_buffer = NULL;
+	int iteration            = 0;
+
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		if( libscca_memory_reallocate_function != NULL )
+		{
+			reallocated_buffer = libscca_memory_reallocate_function(
+			                      buffer,
+			                      size,
+			                      libscca_memory_user_data );
+		}
+		else
+		{
+			reallocated_buffer = memory_reallocate(
+			                      buffer,
+			                      size );
+		}
+		if( ( reallocated_buffer != NULL )
+		 || ( size == 0 )
+		 || ( libscca_memory_pressure_function == NULL ) )
+		{
+			break;
+		}
+		if( ( iteration > 0 )
+		 || ( libscca_memory_pressure_function(
+		       size,
+		       libscca_memory_pressure_user_data ) != 1 ) )
+		{
+			break;
+		}
+	}
+	return( reallocated_buffer );
+}
+
+/* Frees a buffer
+ */
+void libscca_memory_free(
+      void *buffer )
+{
+	if( libscca_memory_free_function != NULL )
+	{
+		libscca_memory_free_function(
+		 buffer,
+		 libscca_memory_user_data );
+	}
+	else
+	{
+		memory_free(
+		 buffer );
+	}
+}
+
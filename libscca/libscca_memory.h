@@ -0,0 +1,112 @@
+/*
+ * Memory allocation functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_MEMORY_H )
+#define _LIBSCCA_MEMORY_H
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern void *(*libscca_memory_allocate_function)(
+               size_t size,
+               void *user_data );
+
+extern void *(*libscca_memory_reallocate_function)(
+               void *buffer,
+               size_t size,
+               void *user_data );
+
+extern void (*libscca_memory_free_function)(
+              void *buffer,
+              void *user_data );
+
+extern void *libscca_memory_user_data;
+
+extern int (*libscca_memory_pressure_function)(
+              size_t size,
+              void *user_data );
+
+extern void *libscca_memory_pressure_user_data;
+
+int libscca_memory_set_functions(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *buffer,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+             void *buffer,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+int libscca_memory_set_pressure_function(
+     int (*pressure_function)(
+            size_t size,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+void *libscca_memory_allocate(
+       size_t size );
+
+void *libscca_memory_reallocate(
+       void *buffer,
+       size_t size );
+
+void libscca_memory_free(
+      void *buffer );
+
+/* Redirect the memory.h allocation macros to the allocation functions set
+ * by libscca_set_allocator. libscca_memory.c uses the memory.h allocation
+ * macros as the default allocation functions hence it is excluded
+ */
+#if !defined( LIBSCCA_MEMORY_DEFAULT_FUNCTIONS )
+
+#undef memory_allocate
+#define memory_allocate( size ) \
+	libscca_memory_allocate( size )
+
+#undef memory_reallocate
+#define memory_reallocate( buffer, size ) \
+	libscca_memory_reallocate( (void *) buffer, size )
+
+#undef memory_free
+#define memory_free( buffer ) \
+	libscca_memory_free( (void *) buffer )
+
+#endif /* !defined( LIBSCCA_MEMORY_DEFAULT_FUNCTIONS ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_MEMORY_H ) */
+
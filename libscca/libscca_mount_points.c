@@ -0,0 +1,711 @@
+/*
+ * Mount points functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_libuna.h"
+#include "libscca_memory.h"
+#include "libscca_mount_points.h"
+#include "libscca_upcase.h"
+
+/* Creates mount points
+ * Make sure the value mount_points is referencing, is set to NULL
+ *
+ * The device paths and mount point paths are UTF-8 encoded strings, where
+ * the device path at a specific index is mapped to the mount point path at
+ * the same index, for example "\VOLUME{01d08f4a24cc8b06-3a2b12a8}" to "C:"
+ * Trailing path separators of the device paths and mount point paths are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mount_points_initialize(
+     libscca_mount_points_t **mount_points,
+     const char * const device_paths[],
+     const char * const mount_point_paths[],
+     int number_of_mount_points,
+     libcerror_error_t **error )
+{
+	static char *function     = "libscca_mount_points_initialize";
+	size_t character_index    = 0;
+	size_t device_path_length = 0;
+	size_t device_path_offset = 0;
+	size_t device_paths_size  = 0;
+	size_t mount_point_length = 0;
+	size_t mount_point_offset = 0;
+	size_t mount_points_size  = 0;
+	size_t utf16_string_size  = 0;
+	int mount_point_index     = 0;
+
+	if( mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount points.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mount_points != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mount points value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_point_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount point paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_mount_points <= 0 )
+	 || ( number_of_mount_points > LIBSCCA_MAXIMUM_NUMBER_OF_MOUNT_POINTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of mount points value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( mount_point_index = 0;
+	     mount_point_index < number_of_mount_points;
+	     mount_point_index++ )
+	{
+		if( device_paths[ mount_point_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid device path: %d.",
+			 function,
+			 mount_point_index );
+
+			return( -1 );
+		}
+		if( mount_point_paths[ mount_point_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid mount point path: %d.",
+			 function,
+			 mount_point_index );
+
+			return( -1 );
+		}
+		device_path_length = narrow_string_length(
+		                      device_paths[ mount_point_index ] );
+
+		if( device_path_length == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+			 "%s: invalid device path: %d length value zero or less.",
+			 function,
+			 mount_point_index );
+
+			return( -1 );
+		}
+		if( libuna_utf16_string_size_from_utf8(
+		     (libuna_utf8_character_t *) device_paths[ mount_point_index ],
+		     device_path_length,
+		     &utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to determine UTF-16 string size of device path: %d.",
+			 function,
+			 mount_point_index );
+
+			return( -1 );
+		}
+		/* The device paths are allocated with room for the end of string character
+		 * of the last device path, which is required for the conversion
+		 */
+		device_paths_size += utf16_string_size;
+
+		mount_points_size += narrow_string_length(
+		                      mount_point_paths[ mount_point_index ] );
+	}
+	if( ( device_paths_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	 || ( mount_points_size >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid mount points size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	*mount_points = memory_allocate_structure(
+	                 libscca_mount_points_t );
+
+	if( *mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mount points.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mount_points,
+	     0,
+	     sizeof( libscca_mount_points_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mount points.",
+		 function );
+
+		memory_free(
+		 *mount_points );
+
+		*mount_points = NULL;
+
+		return( -1 );
+	}
+	( *mount_points )->device_paths = (uint16_t *) memory_allocate(
+	                                                sizeof( uint16_t ) * device_paths_size );
+
+	if( ( *mount_points )->device_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device paths.",
+		 function );
+
+		goto on_error;
+	}
+	( *mount_points )->device_path_offsets = (size_t *) memory_allocate(
+	                                                     sizeof( size_t ) * ( number_of_mount_points + 1 ) );
+
+	if( ( *mount_points )->device_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* Allocate at least 1 byte, since the mount point paths can all be empty
+	 */
+	( *mount_points )->mount_points = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * ( mount_points_size + 1 ) );
+
+	if( ( *mount_points )->mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mount points data.",
+		 function );
+
+		goto on_error;
+	}
+	( *mount_points )->mount_point_offsets = (size_t *) memory_allocate(
+	                                                     sizeof( size_t ) * ( number_of_mount_points + 1 ) );
+
+	if( ( *mount_points )->mount_point_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mount point offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( mount_point_index = 0;
+	     mount_point_index < number_of_mount_points;
+	     mount_point_index++ )
+	{
+		device_path_length = narrow_string_length(
+		                      device_paths[ mount_point_index ] );
+
+		if( libuna_utf16_string_size_from_utf8(
+		     (libuna_utf8_character_t *) device_paths[ mount_point_index ],
+		     device_path_length,
+		     &utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to determine UTF-16 string size of device path: %d.",
+			 function,
+			 mount_point_index );
+
+			goto on_error;
+		}
+		if( libuna_utf16_string_copy_from_utf8(
+		     (libuna_utf16_character_t *) &( ( ( *mount_points )->device_paths )[ device_path_offset ] ),
+		     utf16_string_size,
+		     (libuna_utf8_character_t *) device_paths[ mount_point_index ],
+		     device_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy device path: %d to UTF-16 string.",
+			 function,
+			 mount_point_index );
+
+			goto on_error;
+		}
+		/* Ignore the end of string character and trailing path separators
+		 */
+		device_path_length = utf16_string_size - 1;
+
+		while( ( device_path_length > 0 )
+		    && ( ( *mount_points )->device_paths[ device_path_offset + device_path_length - 1 ] == (uint16_t) '\\' ) )
+		{
+			device_path_length--;
+		}
+		if( device_path_length == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported device path: %d.",
+			 function,
+			 mount_point_index );
+
+			goto on_error;
+		}
+		for( character_index = 0;
+		     character_index < device_path_length;
+		     character_index++ )
+		{
+			( *mount_points )->device_paths[ device_path_offset + character_index ] = libscca_upcase_get_character(
+			                                                                            ( *mount_points )->device_paths[ device_path_offset + character_index ] );
+		}
+		( *mount_points )->device_path_offsets[ mount_point_index ] = device_path_offset;
+
+		device_path_offset += device_path_length;
+
+		mount_point_length = narrow_string_length(
+		                      mount_point_paths[ mount_point_index ] );
+
+		while( ( mount_point_length > 0 )
+		    && ( ( mount_point_paths[ mount_point_index ][ mount_point_length - 1 ] == '\\' )
+		     ||  ( mount_point_paths[ mount_point_index ][ mount_point_length - 1 ] == '/' ) ) )
+		{
+			mount_point_length--;
+		}
+		if( mount_point_length > 0 )
+		{
+			if( memory_copy(
+			     &( ( ( *mount_points )->mount_points )[ mount_point_offset ] ),
+			     mount_point_paths[ mount_point_index ],
+			     mount_point_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy mount point path: %d.",
+				 function,
+				 mount_point_index );
+
+				goto on_error;
+			}
+		}
+		( *mount_points )->mount_point_offsets[ mount_point_index ] = mount_point_offset;
+
+		mount_point_offset += mount_point_length;
+	}
+	( *mount_points )->device_path_offsets[ number_of_mount_points ] = device_path_offset;
+	( *mount_points )->mount_point_offsets[ number_of_mount_points ] = mount_point_offset;
+
+	( *mount_points )->number_of_mount_points = number_of_mount_points;
+
+	return( 1 );
+
+on_error:
+	if( *mount_points != NULL )
+	{
+		if( ( *mount_points )->mount_point_offsets != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->mount_point_offsets );
+		}
+		if( ( *mount_points )->mount_points != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->mount_points );
+		}
+		if( ( *mount_points )->device_path_offsets != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->device_path_offsets );
+		}
+		if( ( *mount_points )->device_paths != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->device_paths );
+		}
+		memory_free(
+		 *mount_points );
+
+		*mount_points = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees mount points
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mount_points_free(
+     libscca_mount_points_t **mount_points,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mount_points_free";
+
+	if( mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount points.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mount_points != NULL )
+	{
+		if( ( *mount_points )->mount_point_offsets != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->mount_point_offsets );
+		}
+		if( ( *mount_points )->mount_points != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->mount_points );
+		}
+		if( ( *mount_points )->device_path_offsets != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->device_path_offsets );
+		}
+		if( ( *mount_points )->device_paths != NULL )
+		{
+			memory_free(
+			 ( *mount_points )->device_paths );
+		}
+		memory_free(
+		 *mount_points );
+
+		*mount_points = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the index of the mount point of which the device path is a prefix of an UTF-16 little-endian stream
+ * The device path is compared case insensitive and must be followed by a path separator
+ * or the end of the string, if multiple device paths match the longest one is used
+ * Returns 1 if successful, 0 if no such mount point or -1 on error
+ */
+int libscca_mount_points_get_index_by_utf16_stream(
+     libscca_mount_points_t *mount_points,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int *mount_point_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_mount_points_get_index_by_utf16_stream";
+	size_t character_index     = 0;
+	size_t device_path_length  = 0;
+	size_t device_path_offset  = 0;
+	size_t match_length        = 0;
+	uint16_t utf16_character   = 0;
+	int safe_mount_point_index = 0;
+	int result                 = 0;
+
+	if( mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount points.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_point_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount point index.",
+		 function );
+
+		return( -1 );
+	}
+	*mount_point_index = -1;
+
+	for( safe_mount_point_index = 0;
+	     safe_mount_point_index < mount_points->number_of_mount_points;
+	     safe_mount_point_index++ )
+	{
+		device_path_offset = mount_points->device_path_offsets[ safe_mount_point_index ];
+		device_path_length = mount_points->device_path_offsets[ safe_mount_point_index + 1 ] - device_path_offset;
+
+		if( ( device_path_length <= match_length )
+		 || ( device_path_length > ( utf16_stream_size / 2 ) ) )
+		{
+			continue;
+		}
+		for( character_index = 0;
+		     character_index < device_path_length;
+		     character_index++ )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ character_index * 2 ] ),
+			 utf16_character );
+
+			if( libscca_upcase_get_character(
+			     utf16_character ) != mount_points->device_paths[ device_path_offset + character_index ] )
+			{
+				break;
+			}
+		}
+		if( character_index < device_path_length )
+		{
+			continue;
+		}
+		if( ( ( device_path_length * 2 ) + 1 ) < utf16_stream_size )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( utf16_stream[ device_path_length * 2 ] ),
+			 utf16_character );
+
+			if( ( utf16_character != 0 )
+			 && ( utf16_character != (uint16_t) '\\' ) )
+			{
+				continue;
+			}
+		}
+		match_length       = device_path_length;
+		*mount_point_index = safe_mount_point_index;
+
+		result = 1;
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 little-endian stream of the device path of a specific mount point
+ * The returned size does not include an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mount_points_get_device_path_size(
+     libscca_mount_points_t *mount_points,
+     int mount_point_index,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mount_points_get_device_path_size";
+
+	if( mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount points.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mount_point_index < 0 )
+	 || ( mount_point_index >= mount_points->number_of_mount_points ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount point index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf16_stream_size = 2 * ( mount_points->device_path_offsets[ mount_point_index + 1 ]
+	                         - mount_points->device_path_offsets[ mount_point_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific mount point
+ * The path is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_mount_points_get_mount_point(
+     libscca_mount_points_t *mount_points,
+     int mount_point_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_mount_points_get_mount_point";
+
+	if( mount_points == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount points.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mount_point_index < 0 )
+	 || ( mount_point_index >= mount_points->number_of_mount_points ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mount point index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string        = &( ( mount_points->mount_points )[ mount_points->mount_point_offsets[ mount_point_index ] ] );
+	*utf8_string_length = mount_points->mount_point_offsets[ mount_point_index + 1 ]
+	                    - mount_points->mount_point_offsets[ mount_point_index ];
+
+	return( 1 );
+}
+
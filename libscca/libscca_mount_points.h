@@ -0,0 +1,103 @@
+/*
+ * Mount points functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_MOUNT_POINTS_H )
+#define _LIBSCCA_MOUNT_POINTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of mount points
+ */
+#define LIBSCCA_MAXIMUM_NUMBER_OF_MOUNT_POINTS		1024
+
+typedef struct libscca_mount_points libscca_mount_points_t;
+
+struct libscca_mount_points
+{
+	/* The device paths, which contain the upper case UTF-16 device paths
+	 * without end of string characters and trailing path separators
+	 */
+	uint16_t *device_paths;
+
+	/* The device path offsets in characters, the number of device path offsets is
+	 * the number of mount points + 1 so that the last one marks the end of the device paths
+	 */
+	size_t *device_path_offsets;
+
+	/* The mount points, which contain the UTF-8 mount points
+	 * without end of string characters
+	 */
+	uint8_t *mount_points;
+
+	/* The mount point offsets in bytes, the number of mount point offsets is
+	 * the number of mount points + 1 so that the last one marks the end of the mount points
+	 */
+	size_t *mount_point_offsets;
+
+	/* The number of mount points
+	 */
+	int number_of_mount_points;
+};
+
+int libscca_mount_points_initialize(
+     libscca_mount_points_t **mount_points,
+     const char * const device_paths[],
+     const char * const mount_point_paths[],
+     int number_of_mount_points,
+     libcerror_error_t **error );
+
+int libscca_mount_points_free(
+     libscca_mount_points_t **mount_points,
+     libcerror_error_t **error );
+
+int libscca_mount_points_get_index_by_utf16_stream(
+     libscca_mount_points_t *mount_points,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int *mount_point_index,
+     libcerror_error_t **error );
+
+int libscca_mount_points_get_device_path_size(
+     libscca_mount_points_t *mount_points,
+     int mount_point_index,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+int libscca_mount_points_get_mount_point(
+     libscca_mount_points_t *mount_points,
+     int mount_point_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_MOUNT_POINTS_H ) */
+
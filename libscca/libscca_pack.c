@@ -0,0 +1,3791 @@
+/*
+ * Pack functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_hash.h"
+#include "libscca_index.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_mapped_file.h"
+#include "libscca_memory.h"
+#include "libscca_pack.h"
+
+#include "scca_pack_trailer.h"
+
+/* Determines the size of the data aligned to 8 bytes
+ */
+#define libscca_pack_align_size( size ) \
+	( ( ( size ) + 7 ) & ~( (uint64_t) 7 ) )
+
+/* Creates a pack
+ * Make sure the value pack is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_initialize(
+     libscca_pack_t **pack,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_initialize";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pack != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = memory_allocate_structure(
+	                 libscca_internal_pack_t );
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_pack,
+	     0,
+	     sizeof( libscca_internal_pack_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pack.",
+		 function );
+
+		memory_free(
+		 internal_pack );
+
+		return( -1 );
+	}
+	*pack = (libscca_pack_t *) internal_pack;
+
+	return( 1 );
+}
+
+/* Frees a pack
+ * The data the pack was opened from is not freed
+ * Files opened from the pack must be closed before the pack is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_free(
+     libscca_pack_t **pack,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_free";
+	int result                             = 1;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pack != NULL )
+	{
+		internal_pack = (libscca_internal_pack_t *) *pack;
+		*pack         = NULL;
+
+		if( internal_pack->strings != NULL )
+		{
+			memory_free(
+			 internal_pack->strings );
+		}
+		if( internal_pack->string_hash_table != NULL )
+		{
+			memory_free(
+			 internal_pack->string_hash_table );
+		}
+		if( internal_pack->string_data != NULL )
+		{
+			memory_free(
+			 internal_pack->string_data );
+		}
+		if( internal_pack->files != NULL )
+		{
+			memory_free(
+			 internal_pack->files );
+		}
+		if( internal_pack->hash_table != NULL )
+		{
+			memory_free(
+			 internal_pack->hash_table );
+		}
+		if( internal_pack->file_data != NULL )
+		{
+			memory_free(
+			 internal_pack->file_data );
+		}
+		if( internal_pack->mapped_file != NULL )
+		{
+			if( libscca_mapped_file_free(
+			     &( internal_pack->mapped_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_pack );
+	}
+	return( result );
+}
+
+/* Calculates the hash of the key of a file
+ * The key consists of the host and the path, the hash of the host is
+ * used as the seed of the hash of the path
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_calculate_key_hash(
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint64_t *key_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_pack_calculate_key_hash";
+	uint64_t host_hash    = 0;
+
+	if( key_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     utf8_host,
+	     utf8_host_length,
+	     0,
+	     &host_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate host hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     utf8_path,
+	     utf8_path_length,
+	     host_hash,
+	     key_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate path hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Resizes the string hash table of the pack that is being built
+ * The strings are re-inserted using linear probing
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_resize_string_hash_table(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t hash_table_size,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table  = NULL;
+	static char *function = "libscca_internal_pack_resize_string_hash_table";
+	uint32_t bucket_index = 0;
+	uint32_t string_index = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table size must be a power of 2 and larger than the number of strings
+	 */
+	if( ( hash_table_size == 0 )
+	 || ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 )
+	 || ( hash_table_size <= internal_pack->number_of_strings )
+	 || ( (size_t) hash_table_size > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table = (uint32_t *) memory_allocate(
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 hash_table );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < internal_pack->number_of_strings;
+	     string_index++ )
+	{
+		bucket_index = (uint32_t) ( internal_pack->strings[ string_index ].hash & ( hash_table_size - 1 ) );
+
+		while( hash_table[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & ( hash_table_size - 1 );
+		}
+		hash_table[ bucket_index ] = string_index + 1;
+	}
+	if( internal_pack->string_hash_table != NULL )
+	{
+		memory_free(
+		 internal_pack->string_hash_table );
+	}
+	internal_pack->string_hash_table      = hash_table;
+	internal_pack->string_hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Appends a string to the string dictionary of the pack that is being built
+ * A string that is already in the dictionary is not appended again, hence
+ * the hosts and paths that are shared by files are stored only once
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_append_string(
+     libscca_internal_pack_t *internal_pack,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *string_index,
+     libcerror_error_t **error )
+{
+	libscca_pack_string_t *string = NULL;
+	static char *function         = "libscca_internal_pack_append_string";
+	uint64_t hash                 = 0;
+	uint32_t bucket_index         = 0;
+	uint32_t entry_value          = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     utf8_string,
+	     utf8_string_length,
+	     0,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate string hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->string_hash_table == NULL )
+	{
+		if( libscca_internal_pack_resize_string_hash_table(
+		     internal_pack,
+		     LIBSCCA_PACK_MINIMUM_HASH_TABLE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to create string hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (uint32_t) ( hash & ( internal_pack->string_hash_table_size - 1 ) );
+
+	while( internal_pack->string_hash_table[ bucket_index ] != 0 )
+	{
+		entry_value = internal_pack->string_hash_table[ bucket_index ];
+		string      = &( internal_pack->strings[ entry_value - 1 ] );
+
+		if( ( string->hash == hash )
+		 && ( (size_t) string->string_size == utf8_string_length ) )
+		{
+			if( ( utf8_string_length == 0 )
+			 || ( memory_compare(
+			       &( internal_pack->string_data[ string->string_offset ] ),
+			       utf8_string,
+			       utf8_string_length ) == 0 ) )
+			{
+				*string_index = entry_value - 1;
+
+				return( 1 );
+			}
+		}
+		bucket_index = ( bucket_index + 1 ) & ( internal_pack->string_hash_table_size - 1 );
+	}
+	if( internal_pack->number_of_strings >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid pack - number of strings value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > ( (size_t) UINT32_MAX - internal_pack->string_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid pack - string data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the load of the hash table at most 50%
+	 */
+	if( ( internal_pack->number_of_strings + 1 ) > ( internal_pack->string_hash_table_size / 2 ) )
+	{
+		if( libscca_internal_pack_resize_string_hash_table(
+		     internal_pack,
+		     internal_pack->string_hash_table_size * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize string hash table.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_index = (uint32_t) ( hash & ( internal_pack->string_hash_table_size - 1 ) );
+
+		while( internal_pack->string_hash_table[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & ( internal_pack->string_hash_table_size - 1 );
+		}
+	}
+	if( libscca_internal_index_reserve(
+	     (void **) &( internal_pack->strings ),
+	     &( internal_pack->strings_allocated_size ),
+	     sizeof( libscca_pack_string_t ) * ( (size_t) internal_pack->number_of_strings + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		if( libscca_internal_index_reserve(
+		     (void **) &( internal_pack->string_data ),
+		     &( internal_pack->string_data_allocated_size ),
+		     internal_pack->string_data_size + utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize string data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( internal_pack->string_data[ internal_pack->string_data_size ] ),
+		     utf8_string,
+		     utf8_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string = &( internal_pack->strings[ internal_pack->number_of_strings ] );
+
+	string->string_offset = (uint32_t) internal_pack->string_data_size;
+	string->string_size   = (uint32_t) utf8_string_length;
+	string->hash          = hash;
+
+	internal_pack->string_data_size += utf8_string_length;
+
+	*string_index = internal_pack->number_of_strings;
+
+	internal_pack->string_hash_table[ bucket_index ] = internal_pack->number_of_strings + 1;
+
+	internal_pack->number_of_strings += 1;
+
+	return( 1 );
+}
+
+/* Resizes the hash table of the keys of the pack that is being built
+ * The files are re-inserted using linear probing
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_resize_hash_table(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t hash_table_size,
+     libcerror_error_t **error )
+{
+	uint32_t *hash_table  = NULL;
+	static char *function = "libscca_internal_pack_resize_hash_table";
+	uint32_t bucket_index = 0;
+	uint32_t file_index   = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table size must be a power of 2 and larger than the number of files
+	 */
+	if( ( hash_table_size == 0 )
+	 || ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 )
+	 || ( hash_table_size <= internal_pack->number_of_files )
+	 || ( (size_t) hash_table_size > ( (size_t) SSIZE_MAX / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table = (uint32_t *) memory_allocate(
+	                           sizeof( uint32_t ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint32_t ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 hash_table );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < internal_pack->number_of_files;
+	     file_index++ )
+	{
+		bucket_index = (uint32_t) ( internal_pack->files[ file_index ].key_hash & ( hash_table_size - 1 ) );
+
+		while( hash_table[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & ( hash_table_size - 1 );
+		}
+		hash_table[ bucket_index ] = file_index + 1;
+	}
+	if( internal_pack->hash_table != NULL )
+	{
+		memory_free(
+		 internal_pack->hash_table );
+	}
+	internal_pack->hash_table      = hash_table;
+	internal_pack->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Appends a file entry to the pack that is being built
+ * The snapshot data of the file, of data size bytes, directly follows
+ * the file data of the previously appended file
+ * Returns 1 if successful, 0 if a file with the same key was already appended or -1 on error
+ */
+int libscca_internal_pack_append_file_entry(
+     libscca_internal_pack_t *internal_pack,
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint32_t prefetch_hash,
+     uint32_t format_version,
+     uint64_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t *file_entry = NULL;
+	libscca_pack_string_t *string   = NULL;
+	static char *function           = "libscca_internal_pack_append_file_entry";
+	uint64_t key_hash               = 0;
+	uint32_t bucket_index           = 0;
+	uint32_t entry_value            = 0;
+	uint32_t host_string_index      = 0;
+	uint32_t path_string_index      = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_host == NULL )
+	 && ( utf8_host_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 host.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_path == NULL )
+	 && ( utf8_path_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( ( data_size % 8 ) != 0 )
+	 || ( data_size > ( (uint64_t) SSIZE_MAX - internal_pack->file_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->number_of_files >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid pack - number of files value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_pack_calculate_key_hash(
+	     utf8_host,
+	     utf8_host_length,
+	     utf8_path,
+	     utf8_path_length,
+	     &key_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate key hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->hash_table == NULL )
+	{
+		if( libscca_internal_pack_resize_hash_table(
+		     internal_pack,
+		     LIBSCCA_PACK_MINIMUM_HASH_TABLE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to create hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (uint32_t) ( key_hash & ( internal_pack->hash_table_size - 1 ) );
+
+	while( internal_pack->hash_table[ bucket_index ] != 0 )
+	{
+		entry_value = internal_pack->hash_table[ bucket_index ];
+		file_entry  = &( internal_pack->files[ entry_value - 1 ] );
+
+		if( file_entry->key_hash == key_hash )
+		{
+			string = &( internal_pack->strings[ file_entry->host_string_index ] );
+
+			if( ( (size_t) string->string_size == utf8_host_length )
+			 && ( ( utf8_host_length == 0 )
+			  ||  ( memory_compare(
+			         &( internal_pack->string_data[ string->string_offset ] ),
+			         utf8_host,
+			         utf8_host_length ) == 0 ) ) )
+			{
+				string = &( internal_pack->strings[ file_entry->path_string_index ] );
+
+				if( ( (size_t) string->string_size == utf8_path_length )
+				 && ( ( utf8_path_length == 0 )
+				  ||  ( memory_compare(
+				         &( internal_pack->string_data[ string->string_offset ] ),
+				         utf8_path,
+				         utf8_path_length ) == 0 ) ) )
+				{
+					return( 0 );
+				}
+			}
+		}
+		bucket_index = ( bucket_index + 1 ) & ( internal_pack->hash_table_size - 1 );
+	}
+	/* Keep the load of the hash table at most 50%
+	 */
+	if( ( internal_pack->number_of_files + 1 ) > ( internal_pack->hash_table_size / 2 ) )
+	{
+		if( libscca_internal_pack_resize_hash_table(
+		     internal_pack,
+		     internal_pack->hash_table_size * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+		bucket_index = (uint32_t) ( key_hash & ( internal_pack->hash_table_size - 1 ) );
+
+		while( internal_pack->hash_table[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & ( internal_pack->hash_table_size - 1 );
+		}
+	}
+	if( libscca_internal_index_reserve(
+	     (void **) &( internal_pack->files ),
+	     &( internal_pack->files_allocated_size ),
+	     sizeof( libscca_pack_file_t ) * ( (size_t) internal_pack->number_of_files + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize files.",
+		 function );
+
+		return( -1 );
+	}
+	/* Strings that are appended before a failure remain in the dictionary
+	 */
+	if( libscca_internal_pack_append_string(
+	     internal_pack,
+	     utf8_host,
+	     utf8_host_length,
+	     &host_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append host string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_append_string(
+	     internal_pack,
+	     utf8_path,
+	     utf8_path_length,
+	     &path_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path string.",
+		 function );
+
+		return( -1 );
+	}
+	file_entry = &( internal_pack->files[ internal_pack->number_of_files ] );
+
+	file_entry->data_offset       = internal_pack->file_data_size;
+	file_entry->data_size         = data_size;
+	file_entry->key_hash          = key_hash;
+	file_entry->host_string_index = host_string_index;
+	file_entry->path_string_index = path_string_index;
+	file_entry->prefetch_hash     = prefetch_hash;
+	file_entry->format_version    = format_version;
+
+	internal_pack->hash_table[ bucket_index ] = internal_pack->number_of_files + 1;
+
+	internal_pack->file_data_size  += data_size;
+	internal_pack->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the file data of a file that is appended to the pack
+ * The file data consists of the snapshot data of the file padded to a multiple of 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_file_data_size(
+     libscca_pack_t *pack,
+     libscca_file_t *file,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_pack_get_file_data_size";
+	size_t snapshot_size  = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_snapshot_size(
+	     file,
+	     &snapshot_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot size.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot_size > ( (size_t) SSIZE_MAX - 7 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid snapshot size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) libscca_pack_align_size( (uint64_t) snapshot_size );
+
+	return( 1 );
+}
+
+/* Appends a file to the pack that is being built
+ * The file data, which is the snapshot data of the file, is written to data
+ * and must be stored in the pack directly after the file data of the previously
+ * appended file, or at the start of the pack for the first file, so that the
+ * pack can be written sequentially without keeping the file data in memory
+ * The data size must be at least the size retrieved by libscca_pack_get_file_data_size
+ * The host and path form the key of the file, the host is optional
+ * The file can be closed once it has been appended
+ * Returns 1 if successful, 0 if a file with the same key was already appended or -1 on error
+ */
+int libscca_pack_append_file(
+     libscca_pack_t *pack,
+     libscca_file_t *file,
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_append_file";
+	size_t file_data_size                  = 0;
+	size_t snapshot_size                   = 0;
+	uint32_t format_version                = 0;
+	uint32_t prefetch_hash                 = 0;
+	int result                             = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_format_version(
+	     file,
+	     &format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_snapshot_size(
+	     file,
+	     &snapshot_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_pack_get_file_data_size(
+	     pack,
+	     file,
+	     &file_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < file_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_write_snapshot(
+	     file,
+	     data,
+	     snapshot_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write snapshot data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Clear the padding so that the file data is deterministic
+	 */
+	if( file_data_size > snapshot_size )
+	{
+		if( memory_set(
+		     &( data[ snapshot_size ] ),
+		     0,
+		     file_data_size - snapshot_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libscca_internal_pack_append_file_entry(
+	          internal_pack,
+	          utf8_host,
+	          utf8_host_length,
+	          utf8_path,
+	          utf8_path_length,
+	          prefetch_hash,
+	          format_version,
+	          (uint64_t) file_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines the layout of the index data of the pack that is being built
+ * The index data is stored after the file data in the order: file entries,
+ * hash table, prefetch hash entries, string entries, string data and trailer
+ * The offsets are relative to the start of the pack and the sections are
+ * 8-byte aligned when the pack data is
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_get_layout(
+     libscca_internal_pack_t *internal_pack,
+     size_t *files_offset,
+     size_t *hash_table_offset,
+     size_t *prefetch_hashes_offset,
+     size_t *strings_offset,
+     size_t *string_data_offset,
+     size_t *trailer_offset,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_pack_get_layout";
+	uint64_t offset       = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( files_offset == NULL )
+	 || ( hash_table_offset == NULL )
+	 || ( prefetch_hashes_offset == NULL )
+	 || ( strings_offset == NULL )
+	 || ( string_data_offset == NULL )
+	 || ( trailer_offset == NULL )
+	 || ( data_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file data size is bounded by SSIZE_MAX and the counts are limited
+	 * to 32-bit which keeps the offsets below from overflowing
+	 */
+	offset = internal_pack->file_data_size;
+
+	*files_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_pack->number_of_files * sizeof( scca_pack_file_entry_t );
+
+	*hash_table_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_pack->hash_table_size * sizeof( uint32_t );
+
+	*prefetch_hashes_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_pack->number_of_files * sizeof( scca_pack_prefetch_hash_entry_t );
+
+	*strings_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_pack->number_of_strings * sizeof( scca_pack_string_entry_t );
+
+	*string_data_offset = (size_t) offset;
+
+	offset += (uint64_t) internal_pack->string_data_size;
+	offset  = libscca_pack_align_size( offset );
+
+	*trailer_offset = (size_t) offset;
+
+	offset += sizeof( scca_pack_trailer_t );
+
+	if( offset > (uint64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = (size_t) offset;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the index data of the pack that is being built
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_index_data_size(
+     libscca_pack_t *pack,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_get_index_data_size";
+	size_t files_offset                    = 0;
+	size_t hash_table_offset               = 0;
+	size_t pack_data_size                  = 0;
+	size_t prefetch_hashes_offset          = 0;
+	size_t string_data_offset              = 0;
+	size_t strings_offset                  = 0;
+	size_t trailer_offset                  = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_layout(
+	     internal_pack,
+	     &files_offset,
+	     &hash_table_offset,
+	     &prefetch_hashes_offset,
+	     &strings_offset,
+	     &string_data_offset,
+	     &trailer_offset,
+	     &pack_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine layout.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = pack_data_size - files_offset;
+
+	return( 1 );
+}
+
+/* Sorts the file indexes by prefetch hash
+ * The file indexes are sorted by a stable least significant byte first radix sort,
+ * hence files with the same prefetch hash remain ordered by file index
+ * The file indexes and scratch file indexes must contain number of files values
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_sort_by_prefetch_hash(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t *file_indexes,
+     uint32_t *scratch_file_indexes,
+     libcerror_error_t **error )
+{
+	uint32_t byte_counts[ 256 ];
+
+	uint32_t *destination_indexes = NULL;
+	uint32_t *source_indexes      = NULL;
+	uint32_t *swap_indexes        = NULL;
+	static char *function         = "libscca_internal_pack_sort_by_prefetch_hash";
+	uint32_t byte_offset          = 0;
+	uint32_t byte_value           = 0;
+	uint32_t file_index           = 0;
+	uint32_t number_of_values     = 0;
+	uint8_t bit_shift             = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( scratch_file_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scratch file indexes.",
+		 function );
+
+		return( -1 );
+	}
+	for( file_index = 0;
+	     file_index < internal_pack->number_of_files;
+	     file_index++ )
+	{
+		file_indexes[ file_index ] = file_index;
+	}
+	if( internal_pack->number_of_files < 2 )
+	{
+		return( 1 );
+	}
+	source_indexes      = file_indexes;
+	destination_indexes = scratch_file_indexes;
+
+	for( bit_shift = 0;
+	     bit_shift < 32;
+	     bit_shift += 8 )
+	{
+		if( memory_set(
+		     byte_counts,
+		     0,
+		     sizeof( uint32_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear byte counts.",
+			 function );
+
+			return( -1 );
+		}
+		for( file_index = 0;
+		     file_index < internal_pack->number_of_files;
+		     file_index++ )
+		{
+			byte_value = ( internal_pack->files[ file_index ].prefetch_hash >> bit_shift ) & 0x000000ffUL;
+
+			byte_counts[ byte_value ] += 1;
+		}
+		/* A pass in which all prefetch hashes have the same byte value does not change the order
+		 */
+		byte_value = ( internal_pack->files[ 0 ].prefetch_hash >> bit_shift ) & 0x000000ffUL;
+
+		if( byte_counts[ byte_value ] == internal_pack->number_of_files )
+		{
+			continue;
+		}
+		byte_offset = 0;
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			number_of_values          = byte_counts[ byte_value ];
+			byte_counts[ byte_value ] = byte_offset;
+			byte_offset              += number_of_values;
+		}
+		for( file_index = 0;
+		     file_index < internal_pack->number_of_files;
+		     file_index++ )
+		{
+			byte_value = ( internal_pack->files[ source_indexes[ file_index ] ].prefetch_hash >> bit_shift ) & 0x000000ffUL;
+
+			destination_indexes[ byte_counts[ byte_value ] ] = source_indexes[ file_index ];
+
+			byte_counts[ byte_value ] += 1;
+		}
+		swap_indexes        = source_indexes;
+		source_indexes      = destination_indexes;
+		destination_indexes = swap_indexes;
+	}
+	if( source_indexes != file_indexes )
+	{
+		if( memory_copy(
+		     file_indexes,
+		     source_indexes,
+		     sizeof( uint32_t ) * internal_pack->number_of_files ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy file indexes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the index data of the pack that is being built
+ * The index data must be stored in the pack directly after the file data
+ * of the last appended file, which completes the pack
+ * The pack can be opened by libscca_pack_open_data or, once stored in a file,
+ * by libscca_pack_open
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_write_index_data(
+     libscca_pack_t *pack,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t *file_entry        = NULL;
+	libscca_internal_pack_t *internal_pack = NULL;
+	scca_pack_trailer_t *pack_trailer      = NULL;
+	uint8_t *entry_data                    = NULL;
+	uint32_t *file_indexes                 = NULL;
+	uint32_t *scratch_file_indexes         = NULL;
+	static char *function                  = "libscca_pack_write_index_data";
+	size_t files_offset                    = 0;
+	size_t hash_table_offset               = 0;
+	size_t pack_data_size                  = 0;
+	size_t prefetch_hashes_offset          = 0;
+	size_t string_data_offset              = 0;
+	size_t strings_offset                  = 0;
+	size_t trailer_offset                  = 0;
+	uint32_t bucket_index                  = 0;
+	uint32_t file_index                    = 0;
+	uint32_t string_index                  = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_layout(
+	     internal_pack,
+	     &files_offset,
+	     &hash_table_offset,
+	     &prefetch_hashes_offset,
+	     &strings_offset,
+	     &string_data_offset,
+	     &trailer_offset,
+	     &pack_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ( pack_data_size - files_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->number_of_files > 0 )
+	{
+		file_indexes = (uint32_t *) memory_allocate(
+		                             sizeof( uint32_t ) * internal_pack->number_of_files );
+
+		if( file_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file indexes.",
+			 function );
+
+			goto on_error;
+		}
+		scratch_file_indexes = (uint32_t *) memory_allocate(
+		                                     sizeof( uint32_t ) * internal_pack->number_of_files );
+
+		if( scratch_file_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scratch file indexes.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_internal_pack_sort_by_prefetch_hash(
+		     internal_pack,
+		     file_indexes,
+		     scratch_file_indexes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort files by prefetch hash.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Clear the data so that the alignment padding is deterministic
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     pack_data_size - files_offset ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	entry_data = data;
+
+	for( file_index = 0;
+	     file_index < internal_pack->number_of_files;
+	     file_index++ )
+	{
+		file_entry = &( internal_pack->files[ file_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->data_offset,
+		 file_entry->data_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->data_size,
+		 file_entry->data_size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->key_hash,
+		 file_entry->key_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->host_string_index,
+		 file_entry->host_string_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->path_string_index,
+		 file_entry->path_string_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->prefetch_hash,
+		 file_entry->prefetch_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_file_entry_t *) entry_data )->format_version,
+		 file_entry->format_version );
+
+		entry_data += sizeof( scca_pack_file_entry_t );
+	}
+	entry_data = &( data[ hash_table_offset - files_offset ] );
+
+	for( bucket_index = 0;
+	     bucket_index < internal_pack->hash_table_size;
+	     bucket_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 entry_data,
+		 internal_pack->hash_table[ bucket_index ] );
+
+		entry_data += sizeof( uint32_t );
+	}
+	entry_data = &( data[ prefetch_hashes_offset - files_offset ] );
+
+	for( file_index = 0;
+	     file_index < internal_pack->number_of_files;
+	     file_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_prefetch_hash_entry_t *) entry_data )->prefetch_hash,
+		 internal_pack->files[ file_indexes[ file_index ] ].prefetch_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_prefetch_hash_entry_t *) entry_data )->file_index,
+		 file_indexes[ file_index ] );
+
+		entry_data += sizeof( scca_pack_prefetch_hash_entry_t );
+	}
+	entry_data = &( data[ strings_offset - files_offset ] );
+
+	for( string_index = 0;
+	     string_index < internal_pack->number_of_strings;
+	     string_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_string_entry_t *) entry_data )->string_offset,
+		 internal_pack->strings[ string_index ].string_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (scca_pack_string_entry_t *) entry_data )->string_size,
+		 internal_pack->strings[ string_index ].string_size );
+
+		entry_data += sizeof( scca_pack_string_entry_t );
+	}
+	if( internal_pack->string_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( data[ string_data_offset - files_offset ] ),
+		     internal_pack->string_data,
+		     internal_pack->string_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	pack_trailer = (scca_pack_trailer_t *) &( data[ trailer_offset - files_offset ] );
+
+	if( memory_copy(
+	     pack_trailer->signature,
+	     "SCCAPACK",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 pack_trailer->format_version,
+	 LIBSCCA_PACK_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 pack_trailer->number_of_files,
+	 internal_pack->number_of_files );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 pack_trailer->number_of_strings,
+	 internal_pack->number_of_strings );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 pack_trailer->hash_table_size,
+	 internal_pack->hash_table_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 pack_trailer->files_offset,
+	 (uint64_t) files_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 pack_trailer->hash_table_offset,
+	 (uint64_t) hash_table_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 pack_trailer->prefetch_hashes_offset,
+	 (uint64_t) prefetch_hashes_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 pack_trailer->strings_offset,
+	 (uint64_t) strings_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 pack_trailer->string_data_offset,
+	 (uint64_t) string_data_offset );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 pack_trailer->string_data_size,
+	 (uint64_t) internal_pack->string_data_size );
+
+	if( scratch_file_indexes != NULL )
+	{
+		memory_free(
+		 scratch_file_indexes );
+	}
+	if( file_indexes != NULL )
+	{
+		memory_free(
+		 file_indexes );
+	}
+	return( 1 );
+
+on_error:
+	if( scratch_file_indexes != NULL )
+	{
+		memory_free(
+		 scratch_file_indexes );
+	}
+	if( file_indexes != NULL )
+	{
+		memory_free(
+		 file_indexes );
+	}
+	return( -1 );
+}
+
+/* Opens a pack from data
+ * The data consists of the file data written by libscca_pack_append_file
+ * followed by the index data written by libscca_pack_write_index_data
+ * The data is referenced by the pack and must remain available until
+ * the pack is freed, which allows the data to be memory mapped
+ * Only the trailer is validated, the entries are validated when they are accessed
+ * so that opening does not depend on the number of files in the pack
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_open_data(
+     libscca_pack_t *pack,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	scca_pack_trailer_t *pack_trailer      = NULL;
+	static char *function                  = "libscca_pack_open_data";
+	uint64_t files_offset                  = 0;
+	uint64_t hash_table_offset             = 0;
+	uint64_t prefetch_hashes_offset        = 0;
+	uint64_t string_data_offset            = 0;
+	uint64_t string_data_size              = 0;
+	uint64_t strings_offset                = 0;
+	uint64_t trailer_offset                = 0;
+	uint32_t format_version                = 0;
+	uint32_t hash_table_size               = 0;
+	uint32_t number_of_files               = 0;
+	uint32_t number_of_strings             = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_pack->number_of_files != 0 )
+	 || ( internal_pack->number_of_strings != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - pack is being built.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( scca_pack_trailer_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	trailer_offset = (uint64_t) data_size - sizeof( scca_pack_trailer_t );
+
+	pack_trailer = (scca_pack_trailer_t *) &( data[ trailer_offset ] );
+
+	if( memory_compare(
+	     pack_trailer->signature,
+	     "SCCAPACK",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pack signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 pack_trailer->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 pack_trailer->number_of_files,
+	 number_of_files );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 pack_trailer->number_of_strings,
+	 number_of_strings );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 pack_trailer->hash_table_size,
+	 hash_table_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 pack_trailer->files_offset,
+	 files_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 pack_trailer->hash_table_offset,
+	 hash_table_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 pack_trailer->prefetch_hashes_offset,
+	 prefetch_hashes_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 pack_trailer->strings_offset,
+	 strings_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 pack_trailer->string_data_offset,
+	 string_data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 pack_trailer->string_data_size,
+	 string_data_size );
+
+	if( format_version != LIBSCCA_PACK_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pack format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( ( number_of_files > (uint32_t) INT_MAX )
+	 || ( number_of_strings > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files or strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table size must be a power of 2 and larger than the number of files
+	 */
+	if( ( ( hash_table_size & ( hash_table_size - 1 ) ) != 0 )
+	 || ( ( number_of_files > 0 )
+	  &&  ( hash_table_size <= number_of_files ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sections precede the trailer, the section sizes are calculated
+	 * with 64-bit values and the counts are limited to 32-bit
+	 */
+	if( ( files_offset > trailer_offset )
+	 || ( ( (uint64_t) number_of_files * sizeof( scca_pack_file_entry_t ) ) > ( trailer_offset - files_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid files offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_table_offset > trailer_offset )
+	 || ( ( (uint64_t) hash_table_size * sizeof( uint32_t ) ) > ( trailer_offset - hash_table_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefetch_hashes_offset > trailer_offset )
+	 || ( ( (uint64_t) number_of_files * sizeof( scca_pack_prefetch_hash_entry_t ) ) > ( trailer_offset - prefetch_hashes_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid prefetch hashes offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( strings_offset > trailer_offset )
+	 || ( ( (uint64_t) number_of_strings * sizeof( scca_pack_string_entry_t ) ) > ( trailer_offset - strings_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid strings offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_data_offset > trailer_offset )
+	 || ( string_data_size > ( trailer_offset - string_data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack->data                   = data;
+	internal_pack->data_size              = data_size;
+	internal_pack->number_of_files        = number_of_files;
+	internal_pack->number_of_strings      = number_of_strings;
+	internal_pack->hash_table_size        = hash_table_size;
+	internal_pack->string_data_size       = (size_t) string_data_size;
+	internal_pack->files_offset           = (size_t) files_offset;
+	internal_pack->hash_table_offset      = (size_t) hash_table_offset;
+	internal_pack->prefetch_hashes_offset = (size_t) prefetch_hashes_offset;
+	internal_pack->strings_offset         = (size_t) strings_offset;
+	internal_pack->string_data_offset     = (size_t) string_data_offset;
+
+	return( 1 );
+}
+
+/* Opens a pack from a file
+ * The file is memory mapped when supported, otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_open(
+     libscca_pack_t *pack,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_open";
+	int result                             = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->mapped_file == NULL )
+	{
+		if( libscca_mapped_file_initialize(
+		     &( internal_pack->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libscca_mapped_file_open(
+	          internal_pack->mapped_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libscca_pack_open_data(
+		     pack,
+		     internal_pack->mapped_file->data,
+		     internal_pack->mapped_file->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open pack: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     narrow_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_pack_read_file_io_handle(
+	     internal_pack,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open pack: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( internal_pack->mapped_file != NULL )
+	 && ( internal_pack->data == NULL ) )
+	{
+		libscca_mapped_file_close(
+		 internal_pack->mapped_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a pack from a file
+ * The file is memory mapped when supported, otherwise it is read into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_open_wide(
+     libscca_pack_t *pack,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_open_wide";
+	int result                             = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->mapped_file == NULL )
+	{
+		if( libscca_mapped_file_initialize(
+		     &( internal_pack->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libscca_mapped_file_open_wide(
+	          internal_pack->mapped_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libscca_pack_open_data(
+		     pack,
+		     internal_pack->mapped_file->data,
+		     internal_pack->mapped_file->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open pack: %ls.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_pack_read_file_io_handle(
+	     internal_pack,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open pack: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( internal_pack->mapped_file != NULL )
+	 && ( internal_pack->data == NULL ) )
+	{
+		libscca_mapped_file_close(
+		 internal_pack->mapped_file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the data of a pack from a file IO handle into memory and opens the pack from it
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_read_file_io_handle(
+     libscca_internal_pack_t *internal_pack,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_internal_pack_read_file_io_handle";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->file_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack - file data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 1;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( scca_pack_trailer_t ) )
+	 || ( file_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The pack contains many files, hence it is not limited to MEMORY_MAXIMUM_ALLOCATION_SIZE
+	 */
+	internal_pack->file_data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * (size_t) file_size );
+
+	if( internal_pack->file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              internal_pack->file_data,
+	              (size_t) file_size,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle_is_open = 0;
+
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_pack_open_data(
+	     (libscca_pack_t *) internal_pack,
+	     internal_pack->file_data,
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open pack from file data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( internal_pack->file_data != NULL )
+	{
+		memory_free(
+		 internal_pack->file_data );
+
+		internal_pack->file_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_number_of_files(
+     libscca_pack_t *pack,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_get_number_of_files";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = (int) internal_pack->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves a specific file entry of the pack that was opened
+ * The file entry is validated against the bounds of the pack data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_get_file_entry(
+     libscca_internal_pack_t *internal_pack,
+     int file_index,
+     libscca_pack_file_t *file_entry,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data = NULL;
+	static char *function     = "libscca_internal_pack_get_file_entry";
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pack - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( (uint32_t) file_index >= internal_pack->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_pack->data[ internal_pack->files_offset + ( (size_t) file_index * sizeof( scca_pack_file_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->data_offset,
+	 file_entry->data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->data_size,
+	 file_entry->data_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->key_hash,
+	 file_entry->key_hash );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->host_string_index,
+	 file_entry->host_string_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->path_string_index,
+	 file_entry->path_string_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->prefetch_hash,
+	 file_entry->prefetch_hash );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_file_entry_t *) entry_data )->format_version,
+	 file_entry->format_version );
+
+	/* The file data precedes the file entries
+	 */
+	if( ( file_entry->data_offset > (uint64_t) internal_pack->files_offset )
+	 || ( file_entry->data_size > ( (uint64_t) internal_pack->files_offset - file_entry->data_offset ) )
+	 || ( ( file_entry->data_offset % 8 ) != 0 )
+	 || ( file_entry->host_string_index >= internal_pack->number_of_strings )
+	 || ( file_entry->path_string_index >= internal_pack->number_of_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file: %d entry value out of bounds.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific string of the pack that was opened
+ * The string references the pack data and is not terminated by an end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_get_string(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data = NULL;
+	static char *function     = "libscca_internal_pack_get_string";
+	uint32_t string_offset    = 0;
+	uint32_t string_size      = 0;
+
+	if( internal_pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pack - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index >= internal_pack->number_of_strings )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( internal_pack->data[ internal_pack->strings_offset + ( (size_t) string_index * sizeof( scca_pack_string_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_string_entry_t *) entry_data )->string_offset,
+	 string_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_string_entry_t *) entry_data )->string_size,
+	 string_size );
+
+	if( ( (size_t) string_offset > internal_pack->string_data_size )
+	 || ( (size_t) string_size > ( internal_pack->string_data_size - string_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string: %" PRIu32 " value out of bounds.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	*utf8_string        = &( internal_pack->data[ internal_pack->string_data_offset + string_offset ] );
+	*utf8_string_length = (size_t) string_size;
+
+	return( 1 );
+}
+
+/* Copies a specific string of the pack that was opened
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_pack_copy_string(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *string_data = NULL;
+	static char *function      = "libscca_internal_pack_copy_string";
+	size_t string_length       = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_string(
+	     internal_pack,
+	     string_index,
+	     &string_data,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %" PRIu32 ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( utf8_string_size <= string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     string_data,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	utf8_string[ string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded host of a specific file
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_utf8_file_host_size(
+     libscca_pack_t *pack,
+     int file_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	libscca_internal_pack_t *internal_pack = NULL;
+	const uint8_t *string_data             = NULL;
+	static char *function                  = "libscca_pack_get_utf8_file_host_size";
+	size_t string_length                   = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_file_entry(
+	     internal_pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_string(
+	     internal_pack,
+	     file_entry.host_string_index,
+	     &string_data,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d host.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	*utf8_string_size = string_length + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded host of a specific file
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_utf8_file_host(
+     libscca_pack_t *pack,
+     int file_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_get_utf8_file_host";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( libscca_internal_pack_get_file_entry(
+	     internal_pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_copy_string(
+	     internal_pack,
+	     file_entry.host_string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy file: %d host.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a specific file
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_utf8_file_path_size(
+     libscca_pack_t *pack,
+     int file_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	libscca_internal_pack_t *internal_pack = NULL;
+	const uint8_t *string_data             = NULL;
+	static char *function                  = "libscca_pack_get_utf8_file_path_size";
+	size_t string_length                   = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_file_entry(
+	     internal_pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_string(
+	     internal_pack,
+	     file_entry.path_string_index,
+	     &string_data,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d path.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	*utf8_string_size = string_length + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific file
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_utf8_file_path(
+     libscca_pack_t *pack,
+     int file_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_get_utf8_file_path";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( libscca_internal_pack_get_file_entry(
+	     internal_pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_copy_string(
+	     internal_pack,
+	     file_entry.path_string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy file: %d path.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the prefetch hash of a specific file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_file_prefetch_hash(
+     libscca_pack_t *pack,
+     int file_index,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	static char *function = "libscca_pack_get_file_prefetch_hash";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_file_entry(
+	     (libscca_internal_pack_t *) pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	*prefetch_hash = file_entry.prefetch_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the format version of a specific file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_get_file_format_version(
+     libscca_pack_t *pack,
+     int file_index,
+     uint32_t *format_version,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	static char *function = "libscca_pack_get_file_format_version";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_pack_get_file_entry(
+	     (libscca_internal_pack_t *) pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	*format_version = file_entry.format_version;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the file with a specific key
+ * The key consists of the UTF-8 encoded host and path, which are compared case-sensitive
+ * Only the hash table entries that are probed, the file entries they refer to
+ * and their strings are read
+ * Returns 1 if successful, 0 if no such file or -1 on error
+ */
+int libscca_pack_get_file_index_by_utf8_key(
+     libscca_pack_t *pack,
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     int *file_index,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	libscca_internal_pack_t *internal_pack = NULL;
+	const uint8_t *string_data             = NULL;
+	static char *function                  = "libscca_pack_get_file_index_by_utf8_key";
+	size_t string_length                   = 0;
+	uint64_t key_hash                      = 0;
+	uint32_t bucket_index                  = 0;
+	uint32_t entry_value                   = 0;
+	uint32_t number_of_probes              = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pack - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_host == NULL )
+	 && ( utf8_host_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 host.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_path == NULL )
+	 && ( utf8_path_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 path.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pack->hash_table_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libscca_pack_calculate_key_hash(
+	     utf8_host,
+	     utf8_host_length,
+	     utf8_path,
+	     utf8_path_length,
+	     &key_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate key hash.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (uint32_t) ( key_hash & ( internal_pack->hash_table_size - 1 ) );
+
+	/* The number of probes is limited so that corrupted data without empty
+	 * hash table entries cannot result in an endless loop
+	 */
+	for( number_of_probes = 0;
+	     number_of_probes < internal_pack->hash_table_size;
+	     number_of_probes++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_pack->data[ internal_pack->hash_table_offset + ( (size_t) bucket_index * sizeof( uint32_t ) ) ] ),
+		 entry_value );
+
+		if( entry_value == 0 )
+		{
+			break;
+		}
+		if( entry_value > internal_pack->number_of_files )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hash table entry: %" PRIu32 " value out of bounds.",
+			 function,
+			 bucket_index );
+
+			return( -1 );
+		}
+		if( libscca_internal_pack_get_file_entry(
+		     internal_pack,
+		     (int) ( entry_value - 1 ),
+		     &file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %" PRIu32 " entry.",
+			 function,
+			 entry_value - 1 );
+
+			return( -1 );
+		}
+		if( file_entry.key_hash == key_hash )
+		{
+			if( libscca_internal_pack_get_string(
+			     internal_pack,
+			     file_entry.host_string_index,
+			     &string_data,
+			     &string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve host string.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( string_length == utf8_host_length )
+			 && ( ( utf8_host_length == 0 )
+			  ||  ( memory_compare(
+			         string_data,
+			         utf8_host,
+			         utf8_host_length ) == 0 ) ) )
+			{
+				if( libscca_internal_pack_get_string(
+				     internal_pack,
+				     file_entry.path_string_index,
+				     &string_data,
+				     &string_length,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve path string.",
+					 function );
+
+					return( -1 );
+				}
+				if( ( string_length == utf8_path_length )
+				 && ( ( utf8_path_length == 0 )
+				  ||  ( memory_compare(
+				         string_data,
+				         utf8_path,
+				         utf8_path_length ) == 0 ) ) )
+				{
+					*file_index = (int) ( entry_value - 1 );
+
+					return( 1 );
+				}
+			}
+		}
+		bucket_index = ( bucket_index + 1 ) & ( internal_pack->hash_table_size - 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the next file with a specific prefetch hash
+ * The search starts at the first file index, which allows to retrieve all files
+ * with the prefetch hash, in order of file index, by passing the previous file index + 1
+ * The prefetch hash entries are sorted, hence the search is a binary search
+ * Returns 1 if successful, 0 if no such file or -1 on error
+ */
+int libscca_pack_get_next_file_index_by_prefetch_hash(
+     libscca_pack_t *pack,
+     int first_file_index,
+     uint32_t prefetch_hash,
+     int *file_index,
+     libcerror_error_t **error )
+{
+	libscca_internal_pack_t *internal_pack = NULL;
+	const uint8_t *entry_data              = NULL;
+	static char *function                  = "libscca_pack_get_next_file_index_by_prefetch_hash";
+	uint32_t entry_file_index              = 0;
+	uint32_t entry_prefetch_hash           = 0;
+	uint32_t lower_bound                   = 0;
+	uint32_t middle_index                  = 0;
+	uint32_t upper_bound                   = 0;
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( internal_pack->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pack - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_file_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first file index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the first entry that is not less than the prefetch hash and first file index
+	 */
+	upper_bound = internal_pack->number_of_files;
+
+	while( lower_bound < upper_bound )
+	{
+		middle_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+
+		entry_data = &( internal_pack->data[ internal_pack->prefetch_hashes_offset + ( (size_t) middle_index * sizeof( scca_pack_prefetch_hash_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_pack_prefetch_hash_entry_t *) entry_data )->prefetch_hash,
+		 entry_prefetch_hash );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_pack_prefetch_hash_entry_t *) entry_data )->file_index,
+		 entry_file_index );
+
+		if( ( entry_prefetch_hash < prefetch_hash )
+		 || ( ( entry_prefetch_hash == prefetch_hash )
+		  &&  ( entry_file_index < (uint32_t) first_file_index ) ) )
+		{
+			lower_bound = middle_index + 1;
+		}
+		else
+		{
+			upper_bound = middle_index;
+		}
+	}
+	if( lower_bound >= internal_pack->number_of_files )
+	{
+		return( 0 );
+	}
+	entry_data = &( internal_pack->data[ internal_pack->prefetch_hashes_offset + ( (size_t) lower_bound * sizeof( scca_pack_prefetch_hash_entry_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_prefetch_hash_entry_t *) entry_data )->prefetch_hash,
+	 entry_prefetch_hash );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_pack_prefetch_hash_entry_t *) entry_data )->file_index,
+	 entry_file_index );
+
+	if( entry_prefetch_hash != prefetch_hash )
+	{
+		return( 0 );
+	}
+	if( entry_file_index >= internal_pack->number_of_files )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid prefetch hash entry: %" PRIu32 " file index value out of bounds.",
+		 function,
+		 lower_bound );
+
+		return( -1 );
+	}
+	*file_index = (int) entry_file_index;
+
+	return( 1 );
+}
+
+/* Opens a specific file of the pack
+ * The file is opened from its snapshot data in the pack data, hence only
+ * the pages of the pack data of the file are read when the pack is memory mapped
+ * The pack must remain available until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_pack_open_file(
+     libscca_pack_t *pack,
+     int file_index,
+     libscca_file_t *file,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libscca_pack_file_t file_entry;
+
+	libscca_internal_pack_t *internal_pack = NULL;
+	static char *function                  = "libscca_pack_open_file";
+
+	if( pack == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pack = (libscca_internal_pack_t *) pack;
+
+	if( libscca_internal_pack_get_file_entry(
+	     internal_pack,
+	     file_index,
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file: %d entry.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	if( libscca_file_open_snapshot(
+	     file,
+	     &( internal_pack->data[ (size_t) file_entry.data_offset ] ),
+	     (size_t) file_entry.data_size,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %d from snapshot data.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
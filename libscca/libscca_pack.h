@@ -0,0 +1,416 @@
+/*
+ * Pack functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_PACK_H )
+#define _LIBSCCA_PACK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_mapped_file.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of hash table entries
+ */
+#define LIBSCCA_PACK_MINIMUM_HASH_TABLE_SIZE		1024
+
+typedef struct libscca_pack_string libscca_pack_string_t;
+
+struct libscca_pack_string
+{
+	/* The offset of the string in the string data
+	 */
+	uint32_t string_offset;
+
+	/* The size of the UTF-8 string without the end of string character
+	 */
+	uint32_t string_size;
+
+	/* The XXH64 hash of the string
+	 */
+	uint64_t hash;
+};
+
+typedef struct libscca_pack_file libscca_pack_file_t;
+
+struct libscca_pack_file
+{
+	/* The offset of the snapshot data
+	 */
+	uint64_t data_offset;
+
+	/* The size of the snapshot data
+	 */
+	uint64_t data_size;
+
+	/* The hash of the key
+	 */
+	uint64_t key_hash;
+
+	/* The index of the host string
+	 */
+	uint32_t host_string_index;
+
+	/* The index of the path string
+	 */
+	uint32_t path_string_index;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The format version
+	 */
+	uint32_t format_version;
+};
+
+typedef struct libscca_internal_pack libscca_internal_pack_t;
+
+struct libscca_internal_pack
+{
+	/* The strings of the pack that is being built
+	 */
+	libscca_pack_string_t *strings;
+
+	/* The allocated size of the strings
+	 */
+	size_t strings_allocated_size;
+
+	/* The hash table of the strings of the pack that is being built
+	 * Contains the string index + 1 or 0 if the entry is not used
+	 */
+	uint32_t *string_hash_table;
+
+	/* The number of string hash table entries
+	 */
+	uint32_t string_hash_table_size;
+
+	/* The string data of the pack that is being built
+	 */
+	uint8_t *string_data;
+
+	/* The allocated size of the string data
+	 */
+	size_t string_data_allocated_size;
+
+	/* The files of the pack that is being built
+	 */
+	libscca_pack_file_t *files;
+
+	/* The allocated size of the files
+	 */
+	size_t files_allocated_size;
+
+	/* The hash table of the keys of the pack that is being built
+	 * Contains the file index + 1 or 0 if the entry is not used
+	 */
+	uint32_t *hash_table;
+
+	/* The size of the file data of the pack that is being built
+	 */
+	uint64_t file_data_size;
+
+	/* The mapped file of the pack that was opened
+	 */
+	libscca_mapped_file_t *mapped_file;
+
+	/* The data of the pack that was opened and read into memory
+	 */
+	uint8_t *file_data;
+
+	/* The data of the pack that was opened
+	 * The data is referenced and not copied
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of files
+	 */
+	uint32_t number_of_files;
+
+	/* The number of strings
+	 */
+	uint32_t number_of_strings;
+
+	/* The number of hash table entries
+	 */
+	uint32_t hash_table_size;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+
+	/* The offset of the file entries in the data
+	 */
+	size_t files_offset;
+
+	/* The offset of the hash table in the data
+	 */
+	size_t hash_table_offset;
+
+	/* The offset of the prefetch hash entries in the data
+	 */
+	size_t prefetch_hashes_offset;
+
+	/* The offset of the string entries in the data
+	 */
+	size_t strings_offset;
+
+	/* The offset of the string data in the data
+	 */
+	size_t string_data_offset;
+};
+
+LIBSCCA_EXTERN \
+int libscca_pack_initialize(
+     libscca_pack_t **pack,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_free(
+     libscca_pack_t **pack,
+     libcerror_error_t **error );
+
+int libscca_pack_calculate_key_hash(
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint64_t *key_hash,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_resize_string_hash_table(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t hash_table_size,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_append_string(
+     libscca_internal_pack_t *internal_pack,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *string_index,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_resize_hash_table(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t hash_table_size,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_append_file_entry(
+     libscca_internal_pack_t *internal_pack,
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint32_t prefetch_hash,
+     uint32_t format_version,
+     uint64_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_file_data_size(
+     libscca_pack_t *pack,
+     libscca_file_t *file,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_append_file(
+     libscca_pack_t *pack,
+     libscca_file_t *file,
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_get_layout(
+     libscca_internal_pack_t *internal_pack,
+     size_t *files_offset,
+     size_t *hash_table_offset,
+     size_t *prefetch_hashes_offset,
+     size_t *strings_offset,
+     size_t *string_data_offset,
+     size_t *trailer_offset,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_index_data_size(
+     libscca_pack_t *pack,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_sort_by_prefetch_hash(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t *file_indexes,
+     uint32_t *scratch_file_indexes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_write_index_data(
+     libscca_pack_t *pack,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_open_data(
+     libscca_pack_t *pack,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_open(
+     libscca_pack_t *pack,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSCCA_EXTERN \
+int libscca_pack_open_wide(
+     libscca_pack_t *pack,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libscca_internal_pack_read_file_io_handle(
+     libscca_internal_pack_t *internal_pack,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_number_of_files(
+     libscca_pack_t *pack,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_get_file_entry(
+     libscca_internal_pack_t *internal_pack,
+     int file_index,
+     libscca_pack_file_t *file_entry,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_get_string(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int libscca_internal_pack_copy_string(
+     libscca_internal_pack_t *internal_pack,
+     uint32_t string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_utf8_file_host_size(
+     libscca_pack_t *pack,
+     int file_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_utf8_file_host(
+     libscca_pack_t *pack,
+     int file_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_utf8_file_path_size(
+     libscca_pack_t *pack,
+     int file_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_utf8_file_path(
+     libscca_pack_t *pack,
+     int file_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_file_prefetch_hash(
+     libscca_pack_t *pack,
+     int file_index,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_file_format_version(
+     libscca_pack_t *pack,
+     int file_index,
+     uint32_t *format_version,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_file_index_by_utf8_key(
+     libscca_pack_t *pack,
+     const uint8_t *utf8_host,
+     size_t utf8_host_length,
+     const uint8_t *utf8_path,
+     size_t utf8_path_length,
+     int *file_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_get_next_file_index_by_prefetch_hash(
+     libscca_pack_t *pack,
+     int first_file_index,
+     uint32_t prefetch_hash,
+     int *file_index,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_pack_open_file(
+     libscca_pack_t *pack,
+     int file_index,
+     libscca_file_t *file,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_PACK_H ) */
+
@@ -0,0 +1,1152 @@
+/*
+ * Shared parse cache functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+#include "libscca_parse_cache.h"
+
+/* Determines the bucket index of an entry
+ */
+#define libscca_parse_cache_get_bucket_index( identifier ) \
+	(int) ( ( identifier ) & ( LIBSCCA_PARSE_CACHE_NUMBER_OF_BUCKETS - 1 ) )
+
+/* Creates a parse cache
+ * Make sure the value parse_cache is referencing, is set to NULL
+ * The parse cache keeps the files opened from identical data, see libscca_parse_cache_open_memory,
+ * of at most maximum_size bytes of data and memory used by the files
+ * The least recently used files are removed when the maximum size is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_initialize(
+     libscca_parse_cache_t **parse_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libscca_parse_cache_initialize";
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parse cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = memory_allocate_structure(
+	                        libscca_internal_parse_cache_t );
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parse cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_parse_cache,
+	     0,
+	     sizeof( libscca_internal_parse_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parse cache.",
+		 function );
+
+		memory_free(
+		 internal_parse_cache );
+
+		return( -1 );
+	}
+	internal_parse_cache->maximum_size = maximum_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_parse_cache->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*parse_cache = (libscca_parse_cache_t *) internal_parse_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_parse_cache != NULL )
+	{
+		memory_free(
+		 internal_parse_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a parse cache
+ * The parse cache must not be freed while files opened from it have not been released
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_free(
+     libscca_parse_cache_t **parse_cache,
+     libcerror_error_t **error )
+{
+	libscca_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libscca_parse_cache_free";
+	int result                                           = 1;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parse_cache != NULL )
+	{
+		internal_parse_cache = (libscca_internal_parse_cache_t *) *parse_cache;
+		*parse_cache         = NULL;
+
+		while( internal_parse_cache->first_entry != NULL )
+		{
+			if( libscca_internal_parse_cache_remove_entry(
+			     internal_parse_cache,
+			     internal_parse_cache->first_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_parse_cache->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_parse_cache );
+	}
+	return( result );
+}
+
+/* Retrieves the statistics of a parse cache
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_get_statistics(
+     libscca_parse_cache_t *parse_cache,
+     size64_t *size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libscca_internal_parse_cache_t *internal_parse_cache = NULL;
+	static char *function                                = "libscca_parse_cache_get_statistics";
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libscca_internal_parse_cache_t *) parse_cache;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size             = internal_parse_cache->size;
+	*number_of_hits   = internal_parse_cache->number_of_hits;
+	*number_of_misses = internal_parse_cache->number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a file from data using the parse cache
+ * The file is shared with the other opens of identical data, which is identified
+ * by the XXH64 hash and a comparison of the data, hence it is only parsed once
+ * The file is read-only and must be released with libscca_parse_cache_release_file
+ * instead of closed or freed
+ * The data is copied and can be freed after the file was opened
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_open_memory(
+     libscca_parse_cache_t *parse_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libscca_file_t **file,
+     libcerror_error_t **error )
+{
+	libscca_internal_parse_cache_t *internal_parse_cache = NULL;
+	libscca_parse_cache_entry_t *entry                   = NULL;
+	libscca_parse_cache_entry_t *new_entry               = NULL;
+	static char *function                                = "libscca_parse_cache_open_memory";
+	uint64_t identifier                                  = 0;
+	int bucket_index                                     = 0;
+	int result                                           = 1;
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libscca_internal_parse_cache_t *) parse_cache;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     data,
+	     data_size,
+	     0,
+	     &identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = libscca_internal_parse_cache_find_entry(
+	         internal_parse_cache,
+	         identifier,
+	         data,
+	         data_size );
+
+	if( entry != NULL )
+	{
+		entry->number_of_references += 1;
+
+		internal_parse_cache->number_of_hits += 1;
+	}
+	else
+	{
+		internal_parse_cache->number_of_misses += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( entry != NULL )
+	{
+		*file = entry->file;
+
+		return( 1 );
+	}
+	/* The file is parsed without the mutex grabbed, hence opens of different data
+	 * are not serialized
+	 */
+	if( libscca_parse_cache_entry_initialize(
+	     &new_entry,
+	     parse_cache,
+	     identifier,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		libscca_parse_cache_entry_free(
+		 &new_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	/* The data can have been opened by another thread while it was parsed
+	 */
+	entry = libscca_internal_parse_cache_find_entry(
+	         internal_parse_cache,
+	         identifier,
+	         data,
+	         data_size );
+
+	if( entry != NULL )
+	{
+		if( libscca_parse_cache_entry_free(
+		     &new_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			entry->number_of_references += 1;
+		}
+	}
+	else if( new_entry->entry_size > internal_parse_cache->maximum_size )
+	{
+		/* A file that exceeds the maximum size is not cached and freed on its release
+		 */
+		entry     = new_entry;
+		new_entry = NULL;
+	}
+	else
+	{
+		while( ( internal_parse_cache->last_entry != NULL )
+		    && ( ( internal_parse_cache->maximum_size - internal_parse_cache->size ) < new_entry->entry_size ) )
+		{
+			if( libscca_internal_parse_cache_remove_entry(
+			     internal_parse_cache,
+			     internal_parse_cache->last_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove least recently used entry.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			entry     = new_entry;
+			new_entry = NULL;
+
+			bucket_index = libscca_parse_cache_get_bucket_index(
+			                identifier );
+
+			entry->next_bucket_entry                      = internal_parse_cache->buckets[ bucket_index ];
+			internal_parse_cache->buckets[ bucket_index ] = entry;
+
+			entry->next_entry = internal_parse_cache->first_entry;
+
+			if( internal_parse_cache->first_entry != NULL )
+			{
+				internal_parse_cache->first_entry->previous_entry = entry;
+			}
+			else
+			{
+				internal_parse_cache->last_entry = entry;
+			}
+			internal_parse_cache->first_entry = entry;
+
+			internal_parse_cache->size              += entry->entry_size;
+			internal_parse_cache->number_of_entries += 1;
+
+			entry->is_cached = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( new_entry != NULL )
+	{
+		libscca_parse_cache_entry_free(
+		 &new_entry,
+		 NULL );
+	}
+	/* The reference to the entry is not released when the mutex could not
+	 * be released since the state of the parse cache is unknown
+	 */
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	*file = entry->file;
+
+	return( 1 );
+}
+
+/* Releases a file opened using the parse cache
+ * The file is freed when it is no longer used and not cached
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_release_file(
+     libscca_parse_cache_t *parse_cache,
+     libscca_file_t **file,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file               = NULL;
+	libscca_internal_parse_cache_t *internal_parse_cache = NULL;
+	libscca_parse_cache_entry_t *entry                   = NULL;
+	libscca_parse_cache_entry_t *free_entry              = NULL;
+	static char *function                                = "libscca_parse_cache_release_file";
+
+	if( parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parse_cache = (libscca_internal_parse_cache_t *) parse_cache;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file == NULL )
+	{
+		return( 1 );
+	}
+	internal_file = (libscca_internal_file_t *) *file;
+
+	entry = (libscca_parse_cache_entry_t *) internal_file->parse_cache_entry;
+
+	if( ( entry == NULL )
+	 || ( entry->parse_cache != parse_cache ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file - not opened using parse cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry->number_of_references -= 1;
+
+	if( ( entry->number_of_references == 0 )
+	 && ( entry->is_cached == 0 ) )
+	{
+		free_entry = entry;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_parse_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file = NULL;
+
+	if( free_entry != NULL )
+	{
+		if( libscca_parse_cache_entry_free(
+		     &free_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a parse cache entry
+ * Make sure the value entry is referencing, is set to NULL
+ * The data is copied and opened as a file with a single reference
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_entry_initialize(
+     libscca_parse_cache_entry_t **entry,
+     libscca_parse_cache_t *parse_cache,
+     uint64_t identifier,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libscca_parse_cache_entry_initialize";
+	uint64_t allocated_size         = 0;
+	uint64_t maximum_allocated_size = 0;
+	uint64_t number_of_allocations  = 0;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = memory_allocate_structure(
+	          libscca_parse_cache_entry_t );
+
+	if( *entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entry,
+	     0,
+	     sizeof( libscca_parse_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+
+		return( -1 );
+	}
+	( *entry )->data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * data_size );
+
+	if( ( *entry )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *entry )->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	( *entry )->data_size = data_size;
+
+	if( libscca_file_initialize(
+	     &( ( *entry )->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_memory(
+	     ( *entry )->file,
+	     ( *entry )->data,
+	     ( *entry )->data_size,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_memory_usage(
+	     ( *entry )->file,
+	     &number_of_allocations,
+	     &allocated_size,
+	     &maximum_allocated_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage of file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file cannot be closed or freed while it is shared
+	 */
+	( (libscca_internal_file_t *) ( *entry )->file )->parse_cache_entry = (intptr_t *) *entry;
+
+	( *entry )->parse_cache          = parse_cache;
+	( *entry )->identifier           = identifier;
+	( *entry )->entry_size           = (size64_t) sizeof( libscca_parse_cache_entry_t ) + data_size + allocated_size;
+	( *entry )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *entry != NULL )
+	{
+		if( ( *entry )->file != NULL )
+		{
+			libscca_file_free(
+			 &( ( *entry )->file ),
+			 NULL );
+		}
+		if( ( *entry )->data != NULL )
+		{
+			memory_free(
+			 ( *entry )->data );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a parse cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parse_cache_entry_free(
+     libscca_parse_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_parse_cache_entry_free";
+	int result            = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		/* The file is freed before the data since it references the data
+		 */
+		if( ( *entry )->file != NULL )
+		{
+			( (libscca_internal_file_t *) ( *entry )->file )->parse_cache_entry = NULL;
+
+			if( libscca_file_free(
+			     &( ( *entry )->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *entry )->data != NULL )
+		{
+			memory_free(
+			 ( *entry )->data );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( result );
+}
+
+/* Removes an entry from the parse cache
+ * The entry is freed if its file is not in use, otherwise on its last release
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_parse_cache_remove_entry(
+     libscca_internal_parse_cache_t *internal_parse_cache,
+     libscca_parse_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libscca_parse_cache_entry_t **bucket_entry = NULL;
+	static char *function                      = "libscca_internal_parse_cache_remove_entry";
+	int bucket_index                           = 0;
+
+	if( internal_parse_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libscca_parse_cache_get_bucket_index(
+	                entry->identifier );
+
+	bucket_entry = &( internal_parse_cache->buckets[ bucket_index ] );
+
+	while( ( *bucket_entry != NULL )
+	    && ( *bucket_entry != entry ) )
+	{
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	if( *bucket_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entry - missing in bucket: %d.",
+		 function,
+		 bucket_index );
+
+		return( -1 );
+	}
+	*bucket_entry = entry->next_bucket_entry;
+
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+	}
+	else
+	{
+		internal_parse_cache->first_entry = entry->next_entry;
+	}
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		internal_parse_cache->last_entry = entry->previous_entry;
+	}
+	internal_parse_cache->size              -= entry->entry_size;
+	internal_parse_cache->number_of_entries -= 1;
+
+	entry->previous_entry    = NULL;
+	entry->next_entry        = NULL;
+	entry->next_bucket_entry = NULL;
+	entry->is_cached         = 0;
+
+	if( entry->number_of_references == 0 )
+	{
+		if( libscca_parse_cache_entry_free(
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Finds an entry in the parse cache and marks it as the most recently used
+ * The data is compared since different data can have the same hash
+ * The mutex must be grabbed by the caller
+ * Returns the entry or NULL if not available
+ */
+libscca_parse_cache_entry_t *libscca_internal_parse_cache_find_entry(
+                              libscca_internal_parse_cache_t *internal_parse_cache,
+                              uint64_t identifier,
+                              const uint8_t *data,
+                              size_t data_size )
+{
+	libscca_parse_cache_entry_t *entry = NULL;
+
+	if( internal_parse_cache == NULL )
+	{
+		return( NULL );
+	}
+	entry = internal_parse_cache->buckets[ libscca_parse_cache_get_bucket_index( identifier ) ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->identifier == identifier )
+		 && ( entry->data_size == data_size )
+		 && ( memory_compare(
+		       entry->data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			break;
+		}
+		entry = entry->next_bucket_entry;
+	}
+	if( ( entry != NULL )
+	 && ( entry != internal_parse_cache->first_entry ) )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+
+		if( entry->next_entry != NULL )
+		{
+			entry->next_entry->previous_entry = entry->previous_entry;
+		}
+		else
+		{
+			internal_parse_cache->last_entry = entry->previous_entry;
+		}
+		entry->previous_entry = NULL;
+		entry->next_entry     = internal_parse_cache->first_entry;
+
+		internal_parse_cache->first_entry->previous_entry = entry;
+		internal_parse_cache->first_entry                 = entry;
+	}
+	return( entry );
+}
+
@@ -0,0 +1,195 @@
+/*
+ * Shared parse cache functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_PARSE_CACHE_H )
+#define _LIBSCCA_PARSE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBSCCA_PARSE_CACHE_NUMBER_OF_BUCKETS		1024
+
+typedef struct libscca_parse_cache_entry libscca_parse_cache_entry_t;
+
+struct libscca_parse_cache_entry
+{
+	/* The parse cache
+	 */
+	libscca_parse_cache_t *parse_cache;
+
+	/* The identifier, which is the XXH64 hash of the data
+	 */
+	uint64_t identifier;
+
+	/* The data the file was opened from
+	 * The data is a copy that is referenced by the file
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The file
+	 */
+	libscca_file_t *file;
+
+	/* The size of the data and the memory used by the file
+	 */
+	size64_t entry_size;
+
+	/* The number of references to the file
+	 */
+	int number_of_references;
+
+	/* Value to indicate the entry is in the parse cache
+	 * An entry that was removed while the file is in use is freed on its last release
+	 */
+	uint8_t is_cached;
+
+	/* The previous entry, which was used more recently
+	 */
+	libscca_parse_cache_entry_t *previous_entry;
+
+	/* The next entry, which was used less recently
+	 */
+	libscca_parse_cache_entry_t *next_entry;
+
+	/* The next entry in the same bucket
+	 */
+	libscca_parse_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct libscca_internal_parse_cache libscca_internal_parse_cache_t;
+
+struct libscca_internal_parse_cache
+{
+	/* The maximum size of the cached entries
+	 */
+	size64_t maximum_size;
+
+	/* The size of the cached entries
+	 */
+	size64_t size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The buckets of entries by identifier
+	 */
+	libscca_parse_cache_entry_t *buckets[ LIBSCCA_PARSE_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used entry
+	 */
+	libscca_parse_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libscca_parse_cache_entry_t *last_entry;
+
+	/* The number of opens that found an entry
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of opens that did not find an entry
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The parse cache is shared between threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_parse_cache_initialize(
+     libscca_parse_cache_t **parse_cache,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parse_cache_free(
+     libscca_parse_cache_t **parse_cache,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parse_cache_get_statistics(
+     libscca_parse_cache_t *parse_cache,
+     size64_t *size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parse_cache_open_memory(
+     libscca_parse_cache_t *parse_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libscca_file_t **file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parse_cache_release_file(
+     libscca_parse_cache_t *parse_cache,
+     libscca_file_t **file,
+     libcerror_error_t **error );
+
+int libscca_parse_cache_entry_initialize(
+     libscca_parse_cache_entry_t **entry,
+     libscca_parse_cache_t *parse_cache,
+     uint64_t identifier,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libscca_parse_cache_entry_free(
+     libscca_parse_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libscca_internal_parse_cache_remove_entry(
+     libscca_internal_parse_cache_t *internal_parse_cache,
+     libscca_parse_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+libscca_parse_cache_entry_t *libscca_internal_parse_cache_find_entry(
+                              libscca_internal_parse_cache_t *internal_parse_cache,
+                              uint64_t identifier,
+                              const uint8_t *data,
+                              size_t data_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_PARSE_CACHE_H ) */
+
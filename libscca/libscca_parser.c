@@ -0,0 +1,800 @@
+/*
+ * Incremental parser functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_budget.h"
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_io_handle.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+#include "libscca_parser.h"
+
+#include "scca_file_header.h"
+
+/* Creates a parser
+ * Make sure the value parser is referencing, is set to NULL
+ * The parser opens the file, which must not be open, from the data that is fed
+ * The file must remain available until the parser is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parser_initialize(
+     libscca_parser_t **parser,
+     libscca_file_t *file,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libscca_internal_parser_t *internal_parser = NULL;
+	static char *function                      = "libscca_parser_initialize";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parser value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libscca_internal_file_t *) file )->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libscca_internal_file_t *) file )->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = memory_allocate_structure(
+	                   libscca_internal_parser_t );
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_parser,
+	     0,
+	     sizeof( libscca_internal_parser_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parser.",
+		 function );
+
+		memory_free(
+		 internal_parser );
+
+		return( -1 );
+	}
+	internal_parser->file         = file;
+	internal_parser->access_flags = access_flags;
+	internal_parser->state        = LIBSCCA_PARSER_STATE_NEED_DATA;
+
+	*parser = (libscca_parser_t *) internal_parser;
+
+	return( 1 );
+}
+
+/* Frees a parser
+ * The file opened by the parser is not closed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parser_free(
+     libscca_parser_t **parser,
+     libcerror_error_t **error )
+{
+	libscca_internal_parser_t *internal_parser = NULL;
+	static char *function                      = "libscca_parser_free";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parser != NULL )
+	{
+		internal_parser = (libscca_internal_parser_t *) *parser;
+		*parser         = NULL;
+
+		/* The data is owned by the IO handle of the file
+		 */
+		memory_free(
+		 internal_parser );
+	}
+	return( 1 );
+}
+
+/* Sets the size of all the data
+ * The size allows the parser to open the file without waiting for the end of the data
+ * to be signalled, which is otherwise needed for compressed files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parser_set_data_size(
+     libscca_parser_t *parser,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_parser_t *internal_parser = NULL;
+	static char *function                      = "libscca_parser_set_data_size";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libscca_internal_parser_t *) parser;
+
+	if( internal_parser->state != LIBSCCA_PARSER_STATE_NEED_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid parser - unsupported state: %d.",
+		 function,
+		 internal_parser->state );
+
+		return( -1 );
+	}
+	if( internal_parser->total_data_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parser - total data size value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < (size64_t) sizeof( scca_file_header_t ) )
+	 || ( data_size < (size64_t) internal_parser->data_size )
+	 || ( data_size > (size64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser->total_data_size = data_size;
+
+	if( internal_parser->data_size == (size_t) data_size )
+	{
+		if( libscca_internal_parser_open_file(
+		     internal_parser,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Feeds data to the parser
+ * The data is the next part of the data, which is consumed up to the size that is required
+ * Feeding 0 bytes signals the end of the data
+ * The file is opened when all the data has been fed
+ * Returns the number of bytes consumed or -1 on error
+ */
+ssize_t libscca_parser_feed(
+         libscca_parser_t *parser,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file     = NULL;
+	libscca_internal_parser_t *internal_parser = NULL;
+	static char *function                      = "libscca_parser_feed";
+	size_t buffer_size                         = 0;
+	size_t copy_size                           = 0;
+	size_t data_offset                         = 0;
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libscca_internal_parser_t *) parser;
+
+	if( internal_parser->state != LIBSCCA_PARSER_STATE_NEED_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid parser - unsupported state: %d.",
+		 function,
+		 internal_parser->state );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) internal_parser->file;
+
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		/* Only the size of the data of a compressed file is not known after the file header
+		 */
+		if( ( internal_parser->data_size < sizeof( scca_file_header_t ) )
+		 || ( internal_parser->total_data_size != 0 ) )
+		{
+			internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data at offset: %" PRIzd ".",
+			 function,
+			 internal_parser->data_size );
+
+			return( -1 );
+		}
+		if( libscca_internal_parser_open_file(
+		     internal_parser,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	while( ( data_offset < data_size )
+	    && ( internal_parser->state == LIBSCCA_PARSER_STATE_NEED_DATA ) )
+	{
+		copy_size = data_size - data_offset;
+
+		if( internal_parser->data_size < sizeof( scca_file_header_t ) )
+		{
+			if( copy_size > ( sizeof( scca_file_header_t ) - internal_parser->data_size ) )
+			{
+				copy_size = sizeof( scca_file_header_t ) - internal_parser->data_size;
+			}
+		}
+		else if( internal_parser->total_data_size != 0 )
+		{
+			if( copy_size > ( (size_t) internal_parser->total_data_size - internal_parser->data_size ) )
+			{
+				copy_size = (size_t) internal_parser->total_data_size - internal_parser->data_size;
+			}
+		}
+		if( copy_size > ( (size_t) UINT32_MAX - internal_parser->data_size ) )
+		{
+			internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( internal_parser->data_size + copy_size ) > internal_parser->buffer_size )
+		{
+			if( internal_parser->total_data_size != 0 )
+			{
+				buffer_size = (size_t) internal_parser->total_data_size;
+			}
+			else
+			{
+				buffer_size = internal_parser->buffer_size;
+
+				if( buffer_size < LIBSCCA_STREAM_READ_SIZE )
+				{
+					buffer_size = LIBSCCA_STREAM_READ_SIZE;
+				}
+				while( buffer_size < ( internal_parser->data_size + copy_size ) )
+				{
+					if( buffer_size > ( (size_t) UINT32_MAX / 2 ) )
+					{
+						buffer_size = (size_t) UINT32_MAX;
+
+						break;
+					}
+					buffer_size *= 2;
+				}
+			}
+			if( libscca_io_handle_get_compressed_data_buffer(
+			     internal_file->io_handle,
+			     buffer_size,
+			     &( internal_parser->data ),
+			     error ) != 1 )
+			{
+				internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data buffer.",
+				 function );
+
+				return( -1 );
+			}
+			internal_parser->buffer_size = buffer_size;
+		}
+		if( memory_copy(
+		     &( internal_parser->data[ internal_parser->data_size ] ),
+		     &( data[ data_offset ] ),
+		     copy_size ) == NULL )
+		{
+			internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_parser->data_size += copy_size;
+		data_offset                += copy_size;
+
+		if( internal_parser->data_size == sizeof( scca_file_header_t ) )
+		{
+			if( libscca_internal_parser_read_file_header(
+			     internal_parser,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file header.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( internal_parser->total_data_size != 0 )
+		 && ( internal_parser->data_size == (size_t) internal_parser->total_data_size ) )
+		{
+			if( libscca_internal_parser_open_file(
+			     internal_parser,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( (ssize_t) data_offset );
+}
+
+/* Retrieves the state
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_parser_get_state(
+     libscca_parser_t *parser,
+     int *state,
+     libcerror_error_t **error )
+{
+	libscca_internal_parser_t *internal_parser = NULL;
+	static char *function                      = "libscca_parser_get_state";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libscca_internal_parser_t *) parser;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	*state = internal_parser->state;
+
+	return( 1 );
+}
+
+/* Retrieves the offset and size of the data that is required next
+ * When the size of the data of a compressed file is not known, the size is
+ * the preferred size to feed and the end of the data is signalled by feeding 0 bytes
+ * Returns 1 if successful, 0 if no data is required or -1 on error
+ */
+int libscca_parser_get_required_data(
+     libscca_parser_t *parser,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libscca_internal_parser_t *internal_parser = NULL;
+	static char *function                      = "libscca_parser_get_required_data";
+
+	if( parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser = (libscca_internal_parser_t *) parser;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_parser->state != LIBSCCA_PARSER_STATE_NEED_DATA )
+	{
+		return( 0 );
+	}
+	*offset = (off64_t) internal_parser->data_size;
+
+	if( internal_parser->data_size < sizeof( scca_file_header_t ) )
+	{
+		*size = (size64_t) ( sizeof( scca_file_header_t ) - internal_parser->data_size );
+	}
+	else if( internal_parser->total_data_size != 0 )
+	{
+		*size = internal_parser->total_data_size - (size64_t) internal_parser->data_size;
+	}
+	else
+	{
+		*size = (size64_t) LIBSCCA_STREAM_READ_SIZE;
+	}
+	return( 1 );
+}
+
+/* Reads the file header from the data that has been fed
+ * The file header determines the size of the data of an uncompressed file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_parser_read_file_header(
+     libscca_internal_parser_t *internal_parser,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_internal_parser_read_file_header";
+	uint32_t file_size                     = 0;
+	uint32_t uncompressed_data_size        = 0;
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_parser->data == NULL )
+	 || ( internal_parser->data_size < sizeof( scca_file_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parser - missing file header data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) internal_parser->file;
+
+	if( memory_compare(
+	     &( internal_parser->data[ 4 ] ),
+	     scca_file_signature,
+	     4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_header_t *) internal_parser->data )->file_size,
+		 file_size );
+
+		if( ( file_size < (uint32_t) sizeof( scca_file_header_t ) )
+		 || ( ( internal_parser->total_data_size != 0 )
+		  &&  ( (size64_t) file_size > internal_parser->total_data_size ) ) )
+		{
+			internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Data that follows the uncompressed file is not required
+		 */
+		internal_parser->total_data_size = (size64_t) file_size;
+	}
+	else if( memory_compare(
+	          internal_parser->data,
+	          scca_mam_file_signature_win10,
+	          4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_parser->data[ 4 ] ),
+		 uncompressed_data_size );
+
+		/* Check the uncompressed data size before the compressed data is fed
+		 */
+		if( libscca_budget_check_uncompressed_data_size(
+		     &( internal_file->io_handle->budget ),
+		     (uint64_t) uncompressed_data_size,
+		     &( internal_file->io_handle->abort ),
+		     error ) != 1 )
+		{
+			internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the file from the data that has been fed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_parser_open_file(
+     libscca_internal_parser_t *internal_parser,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_parser_open_file";
+
+	if( internal_parser == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parser.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sections are read by the same functions as when the file is opened from memory
+	 */
+	if( libscca_file_open_memory(
+	     internal_parser->file,
+	     internal_parser->data,
+	     internal_parser->data_size,
+	     internal_parser->access_flags,
+	     error ) != 1 )
+	{
+		internal_parser->state = LIBSCCA_PARSER_STATE_FAILED;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parser->state = LIBSCCA_PARSER_STATE_COMPLETE;
+
+	return( 1 );
+}
+
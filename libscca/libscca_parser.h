@@ -0,0 +1,122 @@
+/*
+ * Incremental parser functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_PARSER_H )
+#define _LIBSCCA_PARSER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_internal_parser libscca_internal_parser_t;
+
+struct libscca_internal_parser
+{
+	/* The file that is opened when all data has been fed
+	 */
+	libscca_file_t *file;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The state
+	 */
+	int state;
+
+	/* The data
+	 * The data is buffered in the compressed data scratch buffer of the IO handle of the file
+	 */
+	uint8_t *data;
+
+	/* The size of the data that has been fed
+	 */
+	size_t data_size;
+
+	/* The size of the data buffer
+	 */
+	size_t buffer_size;
+
+	/* The size of all the data, where 0 represents not known
+	 * The size of the data of a compressed file is not known unless set
+	 */
+	size64_t total_data_size;
+};
+
+LIBSCCA_EXTERN \
+int libscca_parser_initialize(
+     libscca_parser_t **parser,
+     libscca_file_t *file,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parser_free(
+     libscca_parser_t **parser,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parser_set_data_size(
+     libscca_parser_t *parser,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+ssize_t libscca_parser_feed(
+         libscca_parser_t *parser,
+         const uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parser_get_state(
+     libscca_parser_t *parser,
+     int *state,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_parser_get_required_data(
+     libscca_parser_t *parser,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libscca_internal_parser_read_file_header(
+     libscca_internal_parser_t *internal_parser,
+     libcerror_error_t **error );
+
+int libscca_internal_parser_open_file(
+     libscca_internal_parser_t *internal_parser,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_PARSER_H ) */
+
@@ -0,0 +1,647 @@
+/*
+ * Prefetch hash functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_libcerror.h"
+#include "libscca_libuna.h"
+#include "libscca_prefetch_hash.h"
+
+/* The powers of 37 modulo 2^32, used to hash 8 bytes at once
+ */
+#define LIBSCCA_PREFETCH_HASH_POWER2		0x00000559UL
+#define LIBSCCA_PREFETCH_HASH_POWER3		0x0000c5ddUL
+#define LIBSCCA_PREFETCH_HASH_POWER4		0x001c98f1UL
+#define LIBSCCA_PREFETCH_HASH_POWER5		0x04221ad5UL
+#define LIBSCCA_PREFETCH_HASH_POWER6		0x98ede0c9UL
+#define LIBSCCA_PREFETCH_HASH_POWER7		0x1a617d0dUL
+#define LIBSCCA_PREFETCH_HASH_POWER8		0xd01712e1UL
+
+/* Updates a prefetch hash value with UTF-16 little-endian data
+ * Every byte is hashed as: hash value = ( hash value * 37 ) + byte value
+ * Returns the updated hash value
+ */
+uint32_t libscca_prefetch_hash_update(
+          uint32_t hash_value,
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset   = 0;
+	uint32_t block_value = 0;
+
+	if( data == NULL )
+	{
+		return( hash_value );
+	}
+	/* The hash of 8 bytes is: ( hash value * 37^8 ) + the sum of ( byte value * 37^(7 - byte index) )
+	 * hence the multiplications of the bytes do not depend on the hash value
+	 * or on each other, unlike when the bytes are hashed one by one
+	 */
+	while( ( data_size - data_offset ) >= 8 )
+	{
+		block_value = (uint32_t) ( ( data[ data_offset ] * LIBSCCA_PREFETCH_HASH_POWER7 )
+		                         + ( data[ data_offset + 1 ] * LIBSCCA_PREFETCH_HASH_POWER6 )
+		                         + ( data[ data_offset + 2 ] * LIBSCCA_PREFETCH_HASH_POWER5 )
+		                         + ( data[ data_offset + 3 ] * LIBSCCA_PREFETCH_HASH_POWER4 )
+		                         + ( data[ data_offset + 4 ] * LIBSCCA_PREFETCH_HASH_POWER3 )
+		                         + ( data[ data_offset + 5 ] * LIBSCCA_PREFETCH_HASH_POWER2 )
+		                         + ( data[ data_offset + 6 ] * 37UL )
+		                         + data[ data_offset + 7 ] );
+
+		hash_value = (uint32_t) ( ( hash_value * LIBSCCA_PREFETCH_HASH_POWER8 ) + block_value );
+
+		data_offset += 8;
+	}
+	while( data_offset < data_size )
+	{
+		hash_value = (uint32_t) ( ( hash_value * 37UL ) + data[ data_offset ] );
+
+		data_offset++;
+	}
+	return( hash_value );
+}
+
+/* Finalizes a prefetch hash value
+ * Returns the prefetch hash
+ */
+uint32_t libscca_prefetch_hash_finalize(
+          uint32_t hash_value,
+          int hash_type )
+{
+	if( hash_type == LIBSCCA_PREFETCH_HASH_TYPE_XP )
+	{
+		hash_value = (uint32_t) ( hash_value * 314159269UL );
+
+		/* The hash value is treated as a signed 32-bit value
+		 */
+		if( hash_value > 0x80000000UL )
+		{
+			hash_value = (uint32_t) ( 0 - hash_value );
+		}
+		hash_value %= 1000000007UL;
+	}
+	return( hash_value );
+}
+
+/* Retrieves the upper case of an UTF-16 character
+ * Only the ASCII and Latin-1 lower case characters are converted
+ * Returns the upper case character
+ */
+uint16_t libscca_prefetch_hash_get_upper_case_character(
+          uint16_t character )
+{
+	if( ( character >= (uint16_t) 'a' )
+	 && ( character <= (uint16_t) 'z' ) )
+	{
+		return( character - 0x0020 );
+	}
+	if( character < 0x00e0 )
+	{
+		return( character );
+	}
+	if( ( character <= 0x00fe )
+	 && ( character != 0x00f7 ) )
+	{
+		return( character - 0x0020 );
+	}
+	if( character == 0x00ff )
+	{
+		return( 0x0178 );
+	}
+	return( character );
+}
+
+/* Retrieves the initial hash value of a specific hash type
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_prefetch_hash_get_initial_value(
+     int hash_type,
+     uint32_t *hash_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_prefetch_hash_get_initial_value";
+
+	if( hash_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_type )
+	{
+		case LIBSCCA_PREFETCH_HASH_TYPE_XP:
+			*hash_value = LIBSCCA_PREFETCH_HASH_XP_INITIAL_VALUE;
+			break;
+
+		case LIBSCCA_PREFETCH_HASH_TYPE_VISTA:
+		case LIBSCCA_PREFETCH_HASH_TYPE_2008:
+			*hash_value = LIBSCCA_PREFETCH_HASH_VISTA_INITIAL_VALUE;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash type: %d.",
+			 function,
+			 hash_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the hash type used by a specific format version
+ * Format version 17 (Windows XP and 2003) uses the XP hash and
+ * the later format versions use the Vista hash
+ * Returns 1 if successful, 0 if the format version is not supported or -1 on error
+ */
+int libscca_prefetch_hash_get_type_by_format_version(
+     uint32_t format_version,
+     int *hash_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_prefetch_hash_get_type_by_format_version";
+
+	if( hash_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash type.",
+		 function );
+
+		return( -1 );
+	}
+	switch( format_version )
+	{
+		case 17:
+			*hash_type = LIBSCCA_PREFETCH_HASH_TYPE_XP;
+			break;
+
+		case 23:
+		case 26:
+		case 30:
+			*hash_type = LIBSCCA_PREFETCH_HASH_TYPE_VISTA;
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Calculates the prefetch hash of UTF-16 little-endian stream data
+ * The stream should not contain an end of string character and
+ * is hashed as-is, hence should already be in upper case
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_prefetch_hash_calculate_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_prefetch_hash_calculate_utf16_stream";
+	uint32_t hash_value   = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_prefetch_hash_get_initial_value(
+	     hash_type,
+	     &hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve initial hash value.",
+		 function );
+
+		return( -1 );
+	}
+	hash_value = libscca_prefetch_hash_update(
+	              hash_value,
+	              utf16_stream,
+	              utf16_stream_size );
+
+	*prefetch_hash = libscca_prefetch_hash_finalize(
+	                  hash_value,
+	                  hash_type );
+
+	return( 1 );
+}
+
+/* Computes the prefetch hash of an UTF-8 encoded executable path
+ * The path should be the device path of the executable, such as:
+ * \DEVICE\HARDDISKVOLUME1\WINDOWS\SYSTEM32\CMD.EXE
+ * The path is converted to upper case UTF-16 little-endian in chunks
+ * of LIBSCCA_PREFETCH_HASH_BUFFER_SIZE bytes that are hashed directly,
+ * hence the path is not copied as a whole
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_compute_prefetch_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	uint8_t utf16_stream[ LIBSCCA_PREFETCH_HASH_BUFFER_SIZE ];
+
+	static char *function                        = "libscca_compute_prefetch_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_stream_offset                   = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t hash_value                          = 0;
+	uint16_t utf16_character                     = 0;
+	uint8_t byte_value                           = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_prefetch_hash_get_initial_value(
+	     hash_type,
+	     &hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve initial hash value.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		/* A character requires at most 4 bytes as a surrogate pair
+		 */
+		if( ( utf16_stream_offset + 4 ) > LIBSCCA_PREFETCH_HASH_BUFFER_SIZE )
+		{
+			hash_value = libscca_prefetch_hash_update(
+			              hash_value,
+			              utf16_stream,
+			              utf16_stream_offset );
+
+			utf16_stream_offset = 0;
+		}
+		byte_value = utf8_string[ utf8_string_index ];
+
+		/* ASCII characters, the bulk of the paths, are converted without libuna
+		 */
+		if( byte_value < 0x80 )
+		{
+			if( ( byte_value >= (uint8_t) 'a' )
+			 && ( byte_value <= (uint8_t) 'z' ) )
+			{
+				byte_value -= 0x20;
+			}
+			utf16_stream[ utf16_stream_offset++ ] = byte_value;
+			utf16_stream[ utf16_stream_offset++ ] = 0;
+
+			utf8_string_index++;
+
+			continue;
+		}
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character > 0x0000ffffUL )
+		{
+			unicode_character -= 0x00010000UL;
+
+			utf16_character = (uint16_t) ( 0xd800 + ( unicode_character >> 10 ) );
+
+			utf16_stream[ utf16_stream_offset++ ] = (uint8_t) ( utf16_character & 0xff );
+			utf16_stream[ utf16_stream_offset++ ] = (uint8_t) ( utf16_character >> 8 );
+
+			utf16_character = (uint16_t) ( 0xdc00 + ( unicode_character & 0x000003ffUL ) );
+		}
+		else
+		{
+			utf16_character = libscca_prefetch_hash_get_upper_case_character(
+			                   (uint16_t) unicode_character );
+		}
+		utf16_stream[ utf16_stream_offset++ ] = (uint8_t) ( utf16_character & 0xff );
+		utf16_stream[ utf16_stream_offset++ ] = (uint8_t) ( utf16_character >> 8 );
+	}
+	hash_value = libscca_prefetch_hash_update(
+	              hash_value,
+	              utf16_stream,
+	              utf16_stream_offset );
+
+	*prefetch_hash = libscca_prefetch_hash_finalize(
+	                  hash_value,
+	                  hash_type );
+
+	return( 1 );
+}
+
+/* Computes the prefetch hash of an UTF-16 encoded executable path
+ * The path should be the device path of the executable, such as:
+ * \DEVICE\HARDDISKVOLUME1\WINDOWS\SYSTEM32\CMD.EXE
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_compute_prefetch_hash_utf16(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error )
+{
+	uint8_t utf16_stream[ LIBSCCA_PREFETCH_HASH_BUFFER_SIZE ];
+
+	static char *function      = "libscca_compute_prefetch_hash_utf16";
+	size_t utf16_stream_offset = 0;
+	size_t utf16_string_index  = 0;
+	uint32_t hash_value        = 0;
+	uint16_t utf16_character   = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_prefetch_hash_get_initial_value(
+	     hash_type,
+	     &hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve initial hash value.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( utf16_stream_offset >= LIBSCCA_PREFETCH_HASH_BUFFER_SIZE )
+		{
+			hash_value = libscca_prefetch_hash_update(
+			              hash_value,
+			              utf16_stream,
+			              utf16_stream_offset );
+
+			utf16_stream_offset = 0;
+		}
+		/* Surrogates are not in the ranges that are converted to upper case
+		 */
+		utf16_character = libscca_prefetch_hash_get_upper_case_character(
+		                   utf16_string[ utf16_string_index++ ] );
+
+		utf16_stream[ utf16_stream_offset++ ] = (uint8_t) ( utf16_character & 0xff );
+		utf16_stream[ utf16_stream_offset++ ] = (uint8_t) ( utf16_character >> 8 );
+	}
+	hash_value = libscca_prefetch_hash_update(
+	              hash_value,
+	              utf16_stream,
+	              utf16_stream_offset );
+
+	*prefetch_hash = libscca_prefetch_hash_finalize(
+	                  hash_value,
+	                  hash_type );
+
+	return( 1 );
+}
+
+/* Computes the prefetch hashes of multiple UTF-8 encoded executable paths
+ * The paths must be terminated by an end of string character
+ * The number of prefetch hashes must be equal to or greater than the number of strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_compute_prefetch_hashes(
+     const char * const utf8_strings[],
+     int number_of_strings,
+     int hash_type,
+     uint32_t *prefetch_hashes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_compute_prefetch_hashes";
+	uint32_t hash_value   = 0;
+	int string_index      = 0;
+
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of strings value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hashes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check the hash type before any prefetch hash is computed
+	 */
+	if( libscca_prefetch_hash_get_initial_value(
+	     hash_type,
+	     &hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve initial hash value.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < number_of_strings;
+	     string_index++ )
+	{
+		if( utf8_strings[ string_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( libscca_compute_prefetch_hash(
+		     (const uint8_t *) utf8_strings[ string_index ],
+		     narrow_string_length(
+		      utf8_strings[ string_index ] ),
+		     hash_type,
+		     &( prefetch_hashes[ string_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compute prefetch hash of UTF-8 string: %d.",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Prefetch hash functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_PREFETCH_HASH_H )
+#define _LIBSCCA_PREFETCH_HASH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial hash value of the XP hash
+ */
+#define LIBSCCA_PREFETCH_HASH_XP_INITIAL_VALUE		0
+
+/* The initial hash value of the Vista and 2008 hash
+ */
+#define LIBSCCA_PREFETCH_HASH_VISTA_INITIAL_VALUE	314159
+
+/* The size of the buffer of upper case UTF-16 little-endian data
+ * that is hashed at once
+ */
+#define LIBSCCA_PREFETCH_HASH_BUFFER_SIZE		512
+
+uint32_t libscca_prefetch_hash_update(
+          uint32_t hash_value,
+          const uint8_t *data,
+          size_t data_size );
+
+uint32_t libscca_prefetch_hash_finalize(
+          uint32_t hash_value,
+          int hash_type );
+
+uint16_t libscca_prefetch_hash_get_upper_case_character(
+          uint16_t character );
+
+int libscca_prefetch_hash_get_initial_value(
+     int hash_type,
+     uint32_t *hash_value,
+     libcerror_error_t **error );
+
+int libscca_prefetch_hash_get_type_by_format_version(
+     uint32_t format_version,
+     int *hash_type,
+     libcerror_error_t **error );
+
+int libscca_prefetch_hash_calculate_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_compute_prefetch_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_compute_prefetch_hash_utf16(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     int hash_type,
+     uint32_t *prefetch_hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_compute_prefetch_hashes(
+     const char * const utf8_strings[],
+     int number_of_strings,
+     int hash_type,
+     uint32_t *prefetch_hashes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_PREFETCH_HASH_H ) */
+
@@ -0,0 +1,394 @@
+/*
+ * Prefetch hash table functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_libcerror.h"
+#include "libscca_prefetch_hash_table.h"
+
+/* Retrieves a specific entry of the prefetch hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_prefetch_hash_table_get_entry_by_index(
+     int entry_index,
+     const libscca_prefetch_hash_table_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_prefetch_hash_table_get_entry_by_index";
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= libscca_prefetch_hash_table_number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( (int) libscca_prefetch_hash_table_entries[ entry_index ].path_index >= libscca_prefetch_hash_table_number_of_paths )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %d - path index value out of bounds.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	*entry = &( libscca_prefetch_hash_table_entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries of the prefetch hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_prefetch_hash_table_get_number_of_entries(
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_prefetch_hash_table_get_number_of_entries";
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = libscca_prefetch_hash_table_number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the entries of the prefetch hash table that match a specific prefetch hash
+ * The hash type is defined in LIBSCCA_PREFETCH_HASH_TYPES, where the Vista
+ * and 2008 hash types are equivalent
+ * The matching entries are stored consecutively, starting at the first entry index
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libscca_prefetch_hash_table_get_entries_by_hash(
+     uint32_t prefetch_hash,
+     int hash_type,
+     int *first_entry_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	const libscca_prefetch_hash_table_entry_t *entry = NULL;
+	static char *function                            = "libscca_prefetch_hash_table_get_entries_by_hash";
+	int entry_index                                  = 0;
+	int lower_bound                                  = 0;
+	int middle_index                                 = 0;
+	int upper_bound                                  = 0;
+
+	if( first_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_type )
+	{
+		case LIBSCCA_PREFETCH_HASH_TYPE_XP:
+		case LIBSCCA_PREFETCH_HASH_TYPE_VISTA:
+			break;
+
+		case LIBSCCA_PREFETCH_HASH_TYPE_2008:
+			hash_type = LIBSCCA_PREFETCH_HASH_TYPE_VISTA;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash type: %d.",
+			 function,
+			 hash_type );
+
+			return( -1 );
+	}
+	/* The entries are sorted by prefetch hash and hash type, hence the
+	 * first matching entry is the lower bound of the prefetch hash and hash type
+	 */
+	upper_bound = libscca_prefetch_hash_table_number_of_entries;
+
+	while( lower_bound < upper_bound )
+	{
+		middle_index = lower_bound + ( ( upper_bound - lower_bound ) / 2 );
+		entry        = &( libscca_prefetch_hash_table_entries[ middle_index ] );
+
+		if( ( entry->prefetch_hash < prefetch_hash )
+		 || ( ( entry->prefetch_hash == prefetch_hash )
+		  &&  ( (int) entry->hash_type < hash_type ) ) )
+		{
+			lower_bound = middle_index + 1;
+		}
+		else
+		{
+			upper_bound = middle_index;
+		}
+	}
+	for( entry_index = lower_bound;
+	     entry_index < libscca_prefetch_hash_table_number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( libscca_prefetch_hash_table_entries[ entry_index ] );
+
+		if( ( entry->prefetch_hash != prefetch_hash )
+		 || ( (int) entry->hash_type != hash_type ) )
+		{
+			break;
+		}
+	}
+	if( entry_index == lower_bound )
+	{
+		return( 0 );
+	}
+	*first_entry_index = lower_bound;
+	*number_of_entries = entry_index - lower_bound;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a specific entry of the prefetch hash table
+ * The path is the device path of the executable, such as:
+ * \DEVICE\HARDDISKVOLUME1\WINDOWS\SYSTEM32\CMD.EXE
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_prefetch_hash_table_get_utf8_path_size(
+     int entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	const libscca_prefetch_hash_table_entry_t *entry = NULL;
+	static char *function                            = "libscca_prefetch_hash_table_get_utf8_path_size";
+	size_t volume_number_size                        = 1;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_prefetch_hash_table_get_entry_by_index(
+	     entry_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( entry->volume_number >= 100 )
+	{
+		volume_number_size = 3;
+	}
+	else if( entry->volume_number >= 10 )
+	{
+		volume_number_size = 2;
+	}
+	*utf8_string_size = LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE
+	                  + volume_number_size
+	                  + narrow_string_length(
+	                     libscca_prefetch_hash_table_paths[ entry->path_index ] )
+	                  + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific entry of the prefetch hash table
+ * The path is the device path of the executable, such as:
+ * \DEVICE\HARDDISKVOLUME1\WINDOWS\SYSTEM32\CMD.EXE
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_prefetch_hash_table_get_utf8_path(
+     int entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	const libscca_prefetch_hash_table_entry_t *entry = NULL;
+	static char *function                            = "libscca_prefetch_hash_table_get_utf8_path";
+	size_t path_length                               = 0;
+	size_t required_utf8_string_size                 = 0;
+	size_t string_index                              = 0;
+	size_t volume_number_size                        = 0;
+	uint8_t volume_number                            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_prefetch_hash_table_get_utf8_path_size(
+	     entry_index,
+	     &required_utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path size of entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( utf8_string_size < required_utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	entry       = &( libscca_prefetch_hash_table_entries[ entry_index ] );
+	path_length = narrow_string_length(
+	               libscca_prefetch_hash_table_paths[ entry->path_index ] );
+
+	volume_number_size = required_utf8_string_size
+	                   - LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE
+	                   - path_length
+	                   - 1;
+
+	if( memory_copy(
+	     utf8_string,
+	     LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX,
+	     LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy device prefix.",
+		 function );
+
+		return( -1 );
+	}
+	/* The volume number is written from the last digit to the first
+	 */
+	volume_number = entry->volume_number;
+	string_index  = LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE + volume_number_size;
+
+	while( string_index > LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE )
+	{
+		string_index--;
+
+		utf8_string[ string_index ] = (uint8_t) '0' + ( volume_number % 10 );
+
+		volume_number /= 10;
+	}
+	string_index = LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE + volume_number_size;
+
+	if( memory_copy(
+	     &( utf8_string[ string_index ] ),
+	     libscca_prefetch_hash_table_paths[ entry->path_index ],
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ string_index + path_length ] = 0;
+
+	return( 1 );
+}
+
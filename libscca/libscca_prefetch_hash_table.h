@@ -0,0 +1,111 @@
+/*
+ * Prefetch hash table functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_PREFETCH_HASH_TABLE_H )
+#define _LIBSCCA_PREFETCH_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The device prefix of the paths in the prefetch hash table
+ */
+#define LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX		"\\DEVICE\\HARDDISKVOLUME"
+
+/* The size of the device prefix, without the end of string character
+ */
+#define LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE		22
+
+typedef struct libscca_prefetch_hash_table_entry libscca_prefetch_hash_table_entry_t;
+
+struct libscca_prefetch_hash_table_entry
+{
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The index of the path in the paths table
+	 */
+	uint16_t path_index;
+
+	/* The hash type
+	 */
+	uint8_t hash_type;
+
+	/* The volume number
+	 */
+	uint8_t volume_number;
+};
+
+/* The prefetch hash table is generated by scca_generate_prefetch_hash_table
+ * and stored in libscca_prefetch_hash_table_data.c
+ */
+extern const char *libscca_prefetch_hash_table_paths[];
+
+extern const int libscca_prefetch_hash_table_number_of_paths;
+
+extern const libscca_prefetch_hash_table_entry_t libscca_prefetch_hash_table_entries[];
+
+extern const int libscca_prefetch_hash_table_number_of_entries;
+
+int libscca_prefetch_hash_table_get_entry_by_index(
+     int entry_index,
+     const libscca_prefetch_hash_table_entry_t **entry,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_prefetch_hash_table_get_number_of_entries(
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_prefetch_hash_table_get_entries_by_hash(
+     uint32_t prefetch_hash,
+     int hash_type,
+     int *first_entry_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_prefetch_hash_table_get_utf8_path_size(
+     int entry_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_prefetch_hash_table_get_utf8_path(
+     int entry_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_PREFETCH_HASH_TABLE_H ) */
+
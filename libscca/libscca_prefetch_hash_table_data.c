@@ -0,0 +1,1849 @@
+/*
+ * Prefetch hash table data
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_prefetch_hash_table.h"
+
+/* This file is generated by bench/scca_generate_prefetch_hash_table from
+ * bench/prefetch_hash_paths.txt, do not edit it by hand.
+ * The paths are hashed for \DEVICE\HARDDISKVOLUME1 up to and including
+ * \DEVICE\HARDDISKVOLUME8 with the XP and Vista hash types,
+ * where the 2008 hash type is equivalent to the Vista hash type.
+ */
+
+/* The paths, relative to the root of the volume
+ */
+const char *libscca_prefetch_hash_table_paths[ 106 ] = {
+	"\\PROGRAM FILES\\INTERNET EXPLORER\\IEXPLORE.EXE",
+	"\\PROGRAM FILES\\WINDOWS DEFENDER\\MPCMDRUN.EXE",
+	"\\PROGRAM FILES\\WINDOWS DEFENDER\\MSASCUI.EXE",
+	"\\PROGRAM FILES\\WINDOWS MEDIA PLAYER\\WMPLAYER.EXE",
+	"\\PROGRAM FILES\\WINDOWS NT\\ACCESSORIES\\WORDPAD.EXE",
+	"\\PROGRAM FILES (X86)\\INTERNET EXPLORER\\IEXPLORE.EXE",
+	"\\PROGRAM FILES (X86)\\WINDOWS MEDIA PLAYER\\WMPLAYER.EXE",
+	"\\WINDOWS\\EXPLORER.EXE",
+	"\\WINDOWS\\HH.EXE",
+	"\\WINDOWS\\NOTEPAD.EXE",
+	"\\WINDOWS\\REGEDIT.EXE",
+	"\\WINDOWS\\SYSTEM32\\ARP.EXE",
+	"\\WINDOWS\\SYSTEM32\\AT.EXE",
+	"\\WINDOWS\\SYSTEM32\\ATTRIB.EXE",
+	"\\WINDOWS\\SYSTEM32\\AUDIODG.EXE",
+	"\\WINDOWS\\SYSTEM32\\BCDEDIT.EXE",
+	"\\WINDOWS\\SYSTEM32\\BITSADMIN.EXE",
+	"\\WINDOWS\\SYSTEM32\\CALC.EXE",
+	"\\WINDOWS\\SYSTEM32\\CERTUTIL.EXE",
+	"\\WINDOWS\\SYSTEM32\\CHKDSK.EXE",
+	"\\WINDOWS\\SYSTEM32\\CMD.EXE",
+	"\\WINDOWS\\SYSTEM32\\COMPMGMTLAUNCHER.EXE",
+	"\\WINDOWS\\SYSTEM32\\CONHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\CONSENT.EXE",
+	"\\WINDOWS\\SYSTEM32\\CONTROL.EXE",
+	"\\WINDOWS\\SYSTEM32\\CSCRIPT.EXE",
+	"\\WINDOWS\\SYSTEM32\\CSRSS.EXE",
+	"\\WINDOWS\\SYSTEM32\\CTFMON.EXE",
+	"\\WINDOWS\\SYSTEM32\\DEFRAG.EXE",
+	"\\WINDOWS\\SYSTEM32\\DLLHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\DRVINST.EXE",
+	"\\WINDOWS\\SYSTEM32\\DWM.EXE",
+	"\\WINDOWS\\SYSTEM32\\DXDIAG.EXE",
+	"\\WINDOWS\\SYSTEM32\\EVENTVWR.EXE",
+	"\\WINDOWS\\SYSTEM32\\FINDSTR.EXE",
+	"\\WINDOWS\\SYSTEM32\\FONTDRVHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\FTP.EXE",
+	"\\WINDOWS\\SYSTEM32\\GPUPDATE.EXE",
+	"\\WINDOWS\\SYSTEM32\\ICACLS.EXE",
+	"\\WINDOWS\\SYSTEM32\\IPCONFIG.EXE",
+	"\\WINDOWS\\SYSTEM32\\LOGONUI.EXE",
+	"\\WINDOWS\\SYSTEM32\\LSASS.EXE",
+	"\\WINDOWS\\SYSTEM32\\MMC.EXE",
+	"\\WINDOWS\\SYSTEM32\\MOBSYNC.EXE",
+	"\\WINDOWS\\SYSTEM32\\MSHTA.EXE",
+	"\\WINDOWS\\SYSTEM32\\MSIEXEC.EXE",
+	"\\WINDOWS\\SYSTEM32\\MSTSC.EXE",
+	"\\WINDOWS\\SYSTEM32\\NET.EXE",
+	"\\WINDOWS\\SYSTEM32\\NET1.EXE",
+	"\\WINDOWS\\SYSTEM32\\NETSH.EXE",
+	"\\WINDOWS\\SYSTEM32\\NETSTAT.EXE",
+	"\\WINDOWS\\SYSTEM32\\NOTEPAD.EXE",
+	"\\WINDOWS\\SYSTEM32\\NSLOOKUP.EXE",
+	"\\WINDOWS\\SYSTEM32\\PING.EXE",
+	"\\WINDOWS\\SYSTEM32\\PRINTFILTERPIPELINESVC.EXE",
+	"\\WINDOWS\\SYSTEM32\\REG.EXE",
+	"\\WINDOWS\\SYSTEM32\\REGSVR32.EXE",
+	"\\WINDOWS\\SYSTEM32\\ROUTE.EXE",
+	"\\WINDOWS\\SYSTEM32\\RUNDLL32.EXE",
+	"\\WINDOWS\\SYSTEM32\\RUNONCE.EXE",
+	"\\WINDOWS\\SYSTEM32\\RUNTIMEBROKER.EXE",
+	"\\WINDOWS\\SYSTEM32\\SC.EXE",
+	"\\WINDOWS\\SYSTEM32\\SCHTASKS.EXE",
+	"\\WINDOWS\\SYSTEM32\\SEARCHFILTERHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\SEARCHINDEXER.EXE",
+	"\\WINDOWS\\SYSTEM32\\SEARCHPROTOCOLHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\SERVICES.EXE",
+	"\\WINDOWS\\SYSTEM32\\SETHC.EXE",
+	"\\WINDOWS\\SYSTEM32\\SIHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\SMARTSCREEN.EXE",
+	"\\WINDOWS\\SYSTEM32\\SMSS.EXE",
+	"\\WINDOWS\\SYSTEM32\\SNIPPINGTOOL.EXE",
+	"\\WINDOWS\\SYSTEM32\\SPOOLSV.EXE",
+	"\\WINDOWS\\SYSTEM32\\SVCHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\SYSTEMINFO.EXE",
+	"\\WINDOWS\\SYSTEM32\\TASKENG.EXE",
+	"\\WINDOWS\\SYSTEM32\\TASKHOST.EXE",
+	"\\WINDOWS\\SYSTEM32\\TASKHOSTW.EXE",
+	"\\WINDOWS\\SYSTEM32\\TASKKILL.EXE",
+	"\\WINDOWS\\SYSTEM32\\TASKLIST.EXE",
+	"\\WINDOWS\\SYSTEM32\\TASKMGR.EXE",
+	"\\WINDOWS\\SYSTEM32\\TRUSTEDINSTALLER.EXE",
+	"\\WINDOWS\\SYSTEM32\\USERINIT.EXE",
+	"\\WINDOWS\\SYSTEM32\\VSSADMIN.EXE",
+	"\\WINDOWS\\SYSTEM32\\VSSVC.EXE",
+	"\\WINDOWS\\SYSTEM32\\WBEM\\WMIC.EXE",
+	"\\WINDOWS\\SYSTEM32\\WBEM\\WMIPRVSE.EXE",
+	"\\WINDOWS\\SYSTEM32\\WERFAULT.EXE",
+	"\\WINDOWS\\SYSTEM32\\WEVTUTIL.EXE",
+	"\\WINDOWS\\SYSTEM32\\WHOAMI.EXE",
+	"\\WINDOWS\\SYSTEM32\\WINDOWSPOWERSHELL\\V1.0\\POWERSHELL.EXE",
+	"\\WINDOWS\\SYSTEM32\\WININIT.EXE",
+	"\\WINDOWS\\SYSTEM32\\WINLOGON.EXE",
+	"\\WINDOWS\\SYSTEM32\\WSCRIPT.EXE",
+	"\\WINDOWS\\SYSTEM32\\WUAUCLT.EXE",
+	"\\WINDOWS\\SYSTEM32\\XCOPY.EXE",
+	"\\WINDOWS\\SYSWOW64\\CMD.EXE",
+	"\\WINDOWS\\SYSWOW64\\CSCRIPT.EXE",
+	"\\WINDOWS\\SYSWOW64\\DLLHOST.EXE",
+	"\\WINDOWS\\SYSWOW64\\MSHTA.EXE",
+	"\\WINDOWS\\SYSWOW64\\MSIEXEC.EXE",
+	"\\WINDOWS\\SYSWOW64\\NOTEPAD.EXE",
+	"\\WINDOWS\\SYSWOW64\\REGSVR32.EXE",
+	"\\WINDOWS\\SYSWOW64\\RUNDLL32.EXE",
+	"\\WINDOWS\\SYSWOW64\\WINDOWSPOWERSHELL\\V1.0\\POWERSHELL.EXE",
+	"\\WINDOWS\\SYSWOW64\\WSCRIPT.EXE" };
+
+const int libscca_prefetch_hash_table_number_of_paths = 106;
+
+/* The entries, sorted by prefetch hash, hash type, volume number and path index
+ * Every entry contains: prefetch hash, path index, hash type and volume number
+ */
+const libscca_prefetch_hash_table_entry_t libscca_prefetch_hash_table_entries[ 1696 ] = {
+	{ 0x001617a4UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x001e7ba8UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x001ff73bUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x00399e12UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x009a363dUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x00db35dbUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x00ec5489UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x00f03c68UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x011be6aeUL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x012262afUL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0123d306UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x012b3374UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0134c970UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0136dc55UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x013dbfb5UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x014b173eUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x014d4dccUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0167ad98UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x01697eabUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x017d42f6UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x01845037UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x018c861fUL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x018d7909UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x01907ecfUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x019759eaUL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x01a53c2fUL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x01aa426cUL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x01b6a94cUL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x01b7e57bUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x01c2ea33UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x01ca3a2fUL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x01df8804UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x01e00421UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x01e97532UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x01eb1db8UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x01f2abeaUL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x01f9f0d0UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x02072a8dUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x020d9826UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x02121b1aUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0225afc6UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x022a1004UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x022ecd16UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x02359716UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x023e55c9UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x02539965UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x02566f9fUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x025d8420UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0278e70eUL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x027e1228UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x027f1b4eUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x02866b4aUL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x028e30ceUL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x029776edUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x029b9db4UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x029c353cUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x02a43bfaUL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x02a5b4b1UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x02a5fa0bUL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x02b621ebUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x02ba32a8UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x02c3403dUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x02cd573aUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x02e1e0e1UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x02e202b0UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x02eae2c6UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x02f1c831UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0303f242UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0312854fUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x032347e9UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x032bb3d8UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x032d6eccUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x033a27d8UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x03429c65UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x034b0549UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0350073aUL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0361ca61UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x036540c8UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x036ac55cUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x036ed6a4UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0372b86dUL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x03896ceaUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x038e3c98UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x0395b3c1UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0397f034UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x03b10f73UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x03c0235dUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x03c49d11UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x03c95111UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x03d3fb87UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x03ddcbb1UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x03e9c534UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x041a4963UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x042948baUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x0452c1f1UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x045e9464UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x047b6518UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0490e031UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x04a2adebUL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x04aabdefUL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x04b2f332UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x04b7f31eUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x04bd873fUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x04d079ccUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x04f18bc0UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x04f2ff7cUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x04ffeabcUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x050b09e2UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x051563c9UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0525f982UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x05416907UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x05420a9bUL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x054243a6UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x05507f9bUL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0556be5aUL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x05581af8UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x055d5956UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x058d156aUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x058e589eUL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x058eb2bfUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x058fe8f5UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x05925345UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x05a2c451UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x05adbcdbUL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x05ae0362UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x05c3562dUL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x05d7908cUL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x05dbc145UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x05df0eebUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x05e57a5eUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x05f7d9c6UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x05f80e3fUL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x05fe74c1UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x06144c13UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x061aef29UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x063e2a2bUL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0643b702UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x064a89b9UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0659bf6aUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x065ef56cUL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0663ecfdUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0666f204UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0669edf6UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x06873f50UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x06887102UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0689f312UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x068be5d6UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x06a7a4aeUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x06aa50a1UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x06ac3173UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x06b6c6feUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x06b94de4UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x06baa5dcUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x06c55cf9UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x06cbcd8bUL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x06dcaa13UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x06dd6119UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x07121ecaUL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x07135043UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x071838b4UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x071b2687UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x071b5870UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x072604b0UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0728cc35UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x072d4f20UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x073f040cUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x073fd692UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0743fda9UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x074816f1UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x074f7851UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x07660500UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x07690a2cUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x078f45a4UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x07b2bfdeUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x07b94e3eUL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x07bc86fcUL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x07be3f82UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x07c5f282UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x07e0123fUL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x07e235cbUL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x07eab824UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x07edba5eUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x07fa5b3fUL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x07fb0bc2UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0804480cUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x08164e8fUL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x082f38a9UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x084db373UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0854487aUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x085cffdeUL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x086a31f9UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x087b4001UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x087fc7a4UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x088f4babUL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x089e66e6UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x08a1d41cUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x08a4157cUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x08aa7745UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x08abd9c6UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x08bec8d8UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x08c8e76cUL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x08d45ebdUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x08e7e2dcUL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x08ec2d6cUL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x08f3a979UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x090f28c0UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x09140401UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x09248efeUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0944e328UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x09576f41UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0957f9b2UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x097477edUL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0982fca9UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x09afda94UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x09bd8042UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x09bfc1e4UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x09c6a444UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x09d1ebf5UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x09d2e8a3UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x09dbe722UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x09f77eb9UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0a0b4850UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0a13a05cUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0a1e00edUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0a3b449aUL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0a439ddaUL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x0a6eb8d3UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0a6f4c39UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0a7e87a4UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0a8306e3UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0a8a2269UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0a8e1d10UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0a9c6d4aUL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0abc818fUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0ad79ec1UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0aef7da5UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0af113ceUL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x0af22957UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0b1a3395UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0b312081UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0b465384UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0b73985eUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0b7b145aUL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0b8ea640UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0ba8c87fUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0bad836bUL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0bb395b3UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x0bc2f422UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0bd30981UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x0be74a7eUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0be9f630UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0bf597b1UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0bf80059UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x0bfe0b62UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x0c084730UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x0c10ecc8UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x0c260992UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0c27b4e8UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x0c5c5251UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0c6456fbUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x0c689e66UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0c6dcb55UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0c844e3fUL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0c91172bUL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x0c925821UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0ca37b99UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0ca3c58cUL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0ca5f5e7UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0ca6274bUL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0cb8cadeUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x0cbd3644UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0cbf6a11UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0ccc6e74UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0d08a15dUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0d0b0367UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0d18836cUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0d19b1f1UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0d2066e6UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0d25d6faUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0d2a95f7UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0d34f4d7UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0d3d31a0UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0d449b4fUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0d54b5f9UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x0d5ea097UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0d5ed430UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0d645605UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0d687be1UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0d6ce1bcUL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0d771032UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0d889f8fUL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0d960a64UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0d9ab72bUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x0d9b7444UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x0d9d5a60UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0dc6859dUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0de06bb2UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0de84375UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0df6140bUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0df6c5e8UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0e17969bUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0e2284deUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0e311467UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0e3eaa5eUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0e48f8fdUL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x0e49f32aUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x0e598b7bUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0e69cb0bUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0e77449bUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x0e9c27abUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0ea6529fUL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0eb2e81fUL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0eb3137dUL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0eb6531aUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0eb79707UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x0ecab75dUL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0ecd430dUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x0ef17683UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x0efadb79UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x0f00f8cfUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x0f0ff6fbUL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0f1c0e39UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x0f2d86f3UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0f3fa717UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x0f48c2b5UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0f5e6193UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x0f6144b2UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x0f74375aUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x0fb3f22cUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x0fe8f3a9UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x0ff0c4d6UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x0ffc3f7eUL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x0fffb5a3UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x10006695UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1004f3d0UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1029bfd8UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x104606b2UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x10460f00UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1061e80bUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x10940bb4UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1098a44dUL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1099d1b7UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x10c6e428UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x10d94b23UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x10d9c910UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x10e19a0fUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x10e4267cUL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x10fc5aabUL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x1100df64UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x111861f5UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x111bb5beUL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x111c523aUL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x11254dfeUL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1125d269UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x112f46dbUL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x115602d2UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x115b507fUL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x11637673UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x117a32c6UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x11a4eb42UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x11de9fa2UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x11ee2502UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x11efbd8cUL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x11f1f159UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x12139bc7UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x121c5018UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x121cb143UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1221d0a5UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x122ad95eUL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1237fcb7UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x124484f0UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x127250abUL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x12801654UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x129207f8UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x12a2840aUL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x12b63473UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x12c634a4UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x12d8e25eUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x12f834c7UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x131e9c65UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x134183a1UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x135849b9UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1360d60aUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x13683e46UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x137a0d53UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x13881721UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1394f408UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x13a1b56cUL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x13aa8966UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x13d788dcUL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x13e6a166UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x13f62d31UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x13faf215UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x141d0725UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x141fd8d9UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x14255dc1UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1426f445UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x14455c2eUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1460f5ccUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x148579fbUL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x14b4f22aUL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x14b77a76UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x14d3407bUL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x14d8974cUL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x14db9bc4UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x14e298cfUL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x14e3b596UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x14f79f5cUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x151fd66dUL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1530f985UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x15581e59UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x155c56cfUL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x1565f6a1UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x156ab9edUL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1595fabbUL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x159fe6b1UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x159ffeddUL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x15acdffeUL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x15c2fa31UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x15e394ecUL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x15f2e5a5UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1605fa5bUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x160b1221UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x1618ebbaUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1628051cUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x1632b85aUL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x1634c498UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x163d4e64UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x167fe968UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x16827ad7UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x1696b2caUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x16bc47c8UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x16cd8070UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x16ea4372UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x16f0f5b3UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x17000e4aUL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x172045ecUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x173edcefUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x17529f69UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x17603462UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x177b923eUL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x177dbf1aUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x177dc60bUL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x17980d08UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x179c2663UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x17a28b63UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x17a382f4UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x17e02cedUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x17e2786fUL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x17fb0e0aUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1810c555UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1817338aUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x181e4453UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1842f280UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x18483599UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x184ebf40UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x186b709bUL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x187460f9UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x18900c8cUL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x18943874UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x189484e1UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x189578daUL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x189c5e08UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x18a3ae04UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x18aa480bUL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x18af2ab6UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x18b118d9UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x18b42a5aUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x18d364a5UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x18d5c82bUL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x18d79711UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x18d977e3UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x18ddef9cUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x18ff239bUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1905ee9dUL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x19200677UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x192134fcUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x19395325UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x196d49f4UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x19714419UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x197c61c6UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x197cbec1UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x198891f7UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1997c934UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1998941aUL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x19c1512aUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x19dd6617UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x19e7b52eUL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x19f709b5UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x19fd14beUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x19fe44e1UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1a014120UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1a0a2f9cUL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1a1f1bc8UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1a404b83UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1a4cc1c3UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x1a4fc238UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1a501125UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1a526deaUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1a7f9371UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1a8d0661UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1a9394c1UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1abe29f2UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1ac20fcdUL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x1accf804UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1ad15becUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1ad3307fUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x1af364e4UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1b1973dcUL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1b480f47UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1b606482UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x1b894afbUL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x1b91eab2UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1bab9b58UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1baf95ffUL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1bc2295fUL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x1bcaff95UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1bcc3db7UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x1bee4a84UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x1c1a7e2aUL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1c1bb77bUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1c26180cUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x1c2cd8ddUL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1c67cc73UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1c79f684UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1c7c3826UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1c82da21UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1c88a7baUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x1c89ddd4UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1c92f05bUL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1c93156cUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1cd7e896UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1ce24927UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1cf42bc6UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x1cfbda64UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1d04e531UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1d17cdb3UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1d386941UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1d3bdf63UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1d3f6282UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1d460eefUL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1d477a05UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1d49649dUL, 2, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1d5a7f7bUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1d6559abUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1d6605baUL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1d83f429UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x1dc04744UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1dcd0eb1UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x1deeb777UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1df3a2f6UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x1dff7885UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1e0d0da0UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x1e154f39UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x1e218ac6UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1e22dfbcUL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1e450e07UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1e454bc2UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1e57829dUL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1e6795a7UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1e8013b9UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1e8ddc36UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x1ead3275UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x1eaf2222UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x1eb2fd81UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1ec803ecUL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1ece9fbfUL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x1ecf1ed8UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1eea7cb4UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1ef1a177UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1f033002UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1f13b3b8UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1f1a4bf5UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x1f3e9d7eUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x1f623b47UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x1f7622beUL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x1f86e626UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1f919c75UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1f9d1ca1UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x1fa9fefbUL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x1fadd292UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x1fbf1decUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x1fcd1d4eUL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x1fdac2fcUL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x1fec9dd2UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2014822eUL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x201589e5UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x20256c55UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x202dd204UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x203b43a7UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2041dea2UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2042bf9bUL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x204f65e7UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x205cc8c7UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x205e5ad7UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x206e55b3UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x208bfb8dUL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2096f417UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x20ab5fcaUL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x20db6d1bUL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x20e19d70UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x20e3d1b2UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x20f774c2UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x210c5920UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x211c2449UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2121cb9dUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x21407085UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x21482ca8UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x216790e5UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2173221dUL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x21966a8fUL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x21cbbd06UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x21de11b8UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x21fb8555UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x21fc761aUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2205b441UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x220e128dUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2218bbb9UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x222d56caUL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x222dad05UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x22452d1bUL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2254f953UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2257a3e7UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x225c57f7UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2260497fUL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x226f9d3aUL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x227c9bdcUL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x228e38afUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x22a1c834UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x22a43e65UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x22ad8a37UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x22c07530UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x22cbe0eeUL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x22ccc5b8UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x22dbbb5fUL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x22e74261UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x22f38377UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2316a65bUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x23177086UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x23205583UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x2329d0b0UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2335c626UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2338fb6aUL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x233c2e8eUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x2347f037UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2385b0f4UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2395f30bUL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x23a5e249UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x23aed181UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x23b34d1eUL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x23c48b66UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x23d6a12eUL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x23db6e8dUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x24042152UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x241408a2UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x243fc798UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2448bc7dUL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x24533991UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x24581fceUL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2459b447UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2463eeeaUL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x246ac210UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x246f7e39UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2472f716UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2476ce35UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x24945eb0UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x24a076fcUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x24c86b85UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x24d039bdUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x24ef560fUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x24f9b295UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x24fbf8b3UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x250b9cadUL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2515e562UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2538d32fUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2544bce6UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x256225e0UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x25626414UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x257ee146UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x25a167b5UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x25eefe2fUL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x26437cfbUL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x26976709UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x26a15a53UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x26b783e8UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x26b98d27UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x26c72a86UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x26d073b4UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x26ffa444UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x270086ebUL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x27122324UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x273101fdUL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x273c7ca5UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x273f131eUL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x275d8b6eUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2770d74bUL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2770dd18UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2773458cUL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x27ad3cfbUL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x27b31e63UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x27b429d5UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x27c11a51UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x27cd454dUL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x27d448dbUL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x27f4a490UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x27fa38b1UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2803f297UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2807214fUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x281c4160UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x28237d89UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x282f76a7UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2840e07cUL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x28425023UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2858c7e2UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x286f4f7eUL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x287a3b30UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x288355c4UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x288c777fUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x28ba6fedUL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x28e040deUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x28f1e0c1UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x28f291e0UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x28f2b663UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x28f301a9UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x29157781UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2928c489UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x292ffab3UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x29322e80UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x294d8c5cUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x29857a14UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x298d7ad2UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x29ba0a57UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x29c49968UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x29d1a89cUL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x29f81416UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2a1efc27UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2a28d622UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2a3a49dfUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2a435e54UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2a67037cUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2a7bb57eUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2a83b7d7UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x2a8c3e53UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2a98b70bUL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2ab4eb0bUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2ab56e06UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2aca7493UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2ad5312fUL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2ad5a245UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2ad707efUL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2ae3423eUL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2b016d9bUL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2b04dd81UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2b17c603UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2b2641c3UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2b2b4428UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2b53c1a9UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2b756113UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2b8ccfb2UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2b91d360UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2ba9e372UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2bc38967UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x2bcaad4fUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2bdcbf7dUL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x2be017c8UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2bf5b9bbUL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2c122a0cUL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2c21e903UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2c298f00UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x2c31922eUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2c497348UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2c4c53baUL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x2c9109f9UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x2cb9550cUL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2cc4c59dUL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2ccd22c2UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x2d033758UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2d0342f2UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2d0e386dUL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2d1a70b3UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2d1a9206UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x2d2ca8f1UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x2d4b4f48UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2d5fbd18UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2d674ce4UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x2d6ddb44UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x2d711b34UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2d89c873UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2d97ebe6UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2dae2de6UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2dba2bffUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x2dbbc209UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x2dca6988UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2dcb7df3UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2de769bfUL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x2df69121UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2dfd8f58UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2e017071UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2e1850c4UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2e5d4b75UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x2e760f63UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2e82e760UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2e92b8a7UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x2e944fe7UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x2e9c6fe2UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x2e9fec73UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2ea023ccUL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2eb3e6e2UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x2eb4094eUL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2ebe0332UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2ed481dfUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2ed4f68eUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2f0c66b8UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2f2d61e1UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2f3b1239UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2f3d4931UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2f433351UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2f451423UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2f4f36dfUL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2f6cf467UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x2f7c9065UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x2f8872c0UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2f8a8caeUL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x2f9127a9UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2fb13a99UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x2fbf4c60UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x2fd4759bUL, 79, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x2fda1aedUL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x2fedadcaUL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2feddc05UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x2ff97a4cUL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x30063fa0UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x30079ad3UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3007a9b6UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x300bfb67UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x30140217UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x30199638UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3019b50aUL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x30313dfaUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x30339df0UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x30413dacUL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x305b4079UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x306a65c3UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x306d04f2UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x306fb0a4UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3082e302UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x3090ff29UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x30a605b6UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x30aa858bUL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x30ad5a29UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x30b18140UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x30bcfbe8UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x30c3dad1UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x30d22814UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x30e4dd7fUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x30f9ca9dUL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x30fc6548UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3108e1dbUL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x31216d26UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3129360dUL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x312be1bfUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x3131cae1UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x314e93c5UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x3164d1cbUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x31677d7dUL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x316822b9UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x316b0f74UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x31737e12UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x3180c5e2UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x319fc3ceUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x31a1675dUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x31b7b5a4UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x31ccd8b9UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x31e45f6dUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x31f6b5ceUL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x31fbfdd4UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x32119913UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3218e401UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x322102e6UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x3223ae98UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x324b5a75UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x32506941UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x3259b103UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x325d055aUL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x326fbe5cUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x327aef0bUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x327b3c3fUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x327cac57UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3290e8fcUL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x3295c471UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x32960ab9UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3297393eUL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x329b1305UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x32c57d49UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x32ed1fabUL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x32fbb8abUL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x32fc3d5dUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x32ff8be1UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3304903cUL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x33051130UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x330626dcUL, 45, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x331df029UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3339207fUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x33496ab9UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x33536a59UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x336351a9UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3378cbe7UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x3389049aUL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x33b3e545UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x33bbbcfcUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x33bc31abUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x33d712c8UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x33f93f56UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x340a8749UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x34452258UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x347862c6UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x3487b72cUL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x34a60389UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x34a92b3bUL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x34c64a02UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x34e0253aUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3518478fUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x35207a21UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3527f102UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x353033adUL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x3530605dUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x3530f672UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x353ef707UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x35827b1dUL, 14, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x35938d29UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x35ab1a25UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x35bf0ec5UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x35c29c7dUL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x35d275a3UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x35f1d1d6UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x35fa9c06UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x360ed31dUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x360f4909UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x36167511UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x3619e6e8UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x362ab9dbUL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x362ceda8UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x3655be1eUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x365f215cUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x366c904cUL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x367b1d98UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x368d659aUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x3693ec39UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x36a2786eUL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x36af754cUL, 60, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x36bae580UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x36c212d5UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x36c3795dUL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x36f43b29UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x36fee02aUL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x37110749UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x371b5277UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x371d32deUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x37491bc0UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3755c70cUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x377b952dUL, 36, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x37889f80UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x378df119UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x379a3890UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x37a2b208UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x37bb1145UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x37f0c8b1UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x37fbb49dUL, 68, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3809ab42UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x3809da2eUL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x38206bb6UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x382be65eUL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x38335f9eUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x3838f3bfUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x383a656bUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3855ad07UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x385669abUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x387335aeUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x387d0a52UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x38bf0aeeUL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x38c8136fUL, 42, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x38dbcb3eUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x38e4d290UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x391472bcUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x392eb492UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x39432440UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x394902ffUL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x39532d00UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x395e486dUL, 37, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3969c315UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x396dea2cUL, 56, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x397b3c09UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x399a8e72UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x39aaba37UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x39aae987UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x39ae0143UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x39b7cecaUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x39c86407UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x39cfd017UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x39d256fcUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x39d965f3UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x39d9eac7UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x39eafb02UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3a018f4bUL, 66, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3a0b4f30UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x3a21640cUL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x3a3467bfUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3a393af1UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x3a39e32dUL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x3a3f7511UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3a50b4d9UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_XP, 8 },
+	{ 0x3a528c4eUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_XP, 3 },
+	{ 0x3a613ce3UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x3a8af342UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3a93995aUL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x3aa8cdeaUL, 0, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3aba708cUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x3ac22479UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x3ac534a5UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x3acdda3dUL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x3add9527UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3ae7b65dUL, 58, LIBSCCA_PREFETCH_HASH_TYPE_XP, 2 },
+	{ 0x3afe123cUL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x3b0d3d3aUL, 31, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3b1bc85aUL, 67, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3b1d6dfeUL, 72, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3b33281cUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3b413ec4UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3b4b7876UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_XP, 7 },
+	{ 0x3b5d4123UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_XP, 4 },
+	{ 0x3b5f74f0UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3b6ebeaaUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x3b70e6bbUL, 89, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3b759931UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_XP, 6 },
+	{ 0x3b772cc6UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_XP, 1 },
+	{ 0x3b985cf5UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_XP, 5 },
+	{ 0x3c0c319aUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x3c57a4a0UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x3cf78e07UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x3d05e672UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x3d06e09fUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x3d2afdb4UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x3d9e8d72UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x3dccbe9aUL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x3dd790c5UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x3e0b74c8UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x3e7086c1UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x3eaaf1c2UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x3f30092dUL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x3f5591c2UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x3fbef7fdUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x3fe41f7eUL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x3ff4d889UL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x40419367UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x404821c7UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x412471d7UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x4124ba42UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x412790f1UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x4176b665UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x419f2d06UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x41e6513fUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x4229185eUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x423ce67bUL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x42d24568UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x437c05a8UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x437d7abaUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x43972d0fUL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x43f37294UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x44162447UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x44194444UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x441c2f50UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x443d0e78UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x4491fc27UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x44efa5cfUL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x452aafc4UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4551a062UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x45f71a31UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x462193beUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4654fa7dUL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x4655edbcUL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x466ce965UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x473d56f5UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x4748fe01UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x475c5152UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x47804a0cUL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x4818f361UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x48d4e289UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x48f0bb94UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x4983bbe2UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x49bb6b91UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x49c2c2baUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x4a4ed827UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4a6353b9UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x4a7cf88bUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x4a81b364UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x4a8a6853UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x4b427224UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x4b6c9213UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x4b83b48cUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x4bf07096UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x4c22f32fUL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4c5eac0eUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x4c64814dUL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4c8500baUL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x4cb4314aUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x4cd23caeUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x4cdf8917UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x4d290780UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x4d2f1289UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4da31305UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x4db99e1bUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x4df504e6UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x4ea073e6UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x4ed47fd9UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x4fc70bd8UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x4ffd5dfaUL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x505fe0ceUL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x509326a5UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x5114915cUL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x511d36f4UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x51d741b1UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x52cf1f0cUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x5305a9f2UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x531bd9eaUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x5322684aUL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x53554329UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x54c4813dUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x54cc9079UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x5574715dUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x55a4ee79UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x56bc5d62UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x576c42aaUL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x57aece36UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x5804f647UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x588f90adUL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x58bdc1d5UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x596994e4UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x59756cacUL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x59fc8f3dUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x5a5a908fUL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x5ae67c75UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x5b81fb65UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x5baf290cUL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x5bcb0217UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x5be99666UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x5ca45734UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x5d3d08edUL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x5d4ffd8eUL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x5d573f0eUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x5d842d26UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x5e3d06cbUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x5e6e7df5UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x5efe2b21UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x5f46ec00UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x5f5f473dUL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x5f7aea8bUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x5f8e77cdUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x5fb9cf9aUL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x603a5034UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x606b6550UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x609e34deUL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x60d1a056UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x60d911a4UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x60e81d6cUL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x614dd671UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x61856b04UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x61d40ed1UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x61e7a54dUL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x6225d8a3UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x62724fe6UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x6402adc8UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x644ff4e7UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x6465db72UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x6474bf1dUL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6499d5ecUL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x6520183eUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x65a9658fUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x65f6206dUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x65fcaecdUL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x6723a885UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x672cfdc1UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x67378bfaUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x67558488UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x679ec7c0UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x686aeeb8UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x68731931UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x68c04c3fUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x6917be37UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x698ac7b2UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x69c456c3UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6a2dc453UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x6a46892dUL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x6a72334aUL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x6a8b6960UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x6adf3ccaUL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x6ae27b03UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x6b149215UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x6bc2d3e7UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x6bc3ce14UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6c4d4413UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6c8f0c66UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6d34d712UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x6d6290c5UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6e127f37UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x6e20ae15UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x6ea5489aUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x6f7c6068UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x6f9ba2e1UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x6fab8a60UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x6fb78bbeUL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x6fd0c1d4UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x6ffd3da8UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x70318591UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x71339457UL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x7135d92cUL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x71e40230UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x72213283UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x7238f31dUL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x72398dc0UL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x724865deUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x726206f8UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x7294161dUL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x72a7e939UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x72c0c855UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x72d631b9UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x738093e8UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x73abe6d9UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x73ac9344UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x73aec510UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x73b35827UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x73c976e8UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x74818b88UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x7511e7f2UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x75134893UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x7542961cUL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x75a07da5UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x767fb1aeUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x76a46e8aUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x771fd74cUL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x77482212UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x774e2d1bUL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x77d27bacUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x77f126a1UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x77fdf17fUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x78c5e78aUL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x78dae4d4UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x78edd975UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x790bc59cUL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x7922090dUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x795f8130UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x79dae2b2UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x79fdef08UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x7a3328daUL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x7a606ca7UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x7a790e43UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x7a9337f2UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x7adfe0a4UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x7b8f2a23UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x7ba637eaUL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x7bd920a7UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x7d20cfb0UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x7d743893UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x7d8942dcUL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x7db9834dUL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x7e94e73eUL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x7eba4b6fUL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x7f65c258UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x7fd17ed1UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x7fd63ad4UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x7fda2469UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x80611054UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x80692af9UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x80e1bdaaUL, 16, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x80e6fa72UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x80eb905eUL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x8152304aUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x8163eeccUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x817f8f1dUL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x81ad91f0UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x81c29767UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x8212309eUL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x824687c3UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x8256a6ebUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x8285d0e3UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x830bcc14UL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x8461dbeeUL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x849da590UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x84be48b3UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x84f383e5UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x84fb7906UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x851b9348UL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x854f6b45UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x856e5ca0UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x85cba03aUL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x866bbbabUL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x8684132bUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x86862d5cUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x868d9eaaUL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x86e0e9b9UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x882ce84dUL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x887410ddUL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x89305d47UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x89a369eaUL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x89a7b40aUL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x89f4f80cUL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x8aa64058UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x8aa683dbUL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x8b35a961UL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x8b6144a9UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x8c04d631UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x8cd8358bUL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x8d5354c6UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x8d561148UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x8dbb1896UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x8dbfe3b9UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x8dda8d43UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x8e0707f2UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x8e75b5bbUL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x8e9fc84bUL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x8ecb884fUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x8f5b2253UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x8f950096UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x8ffb1633UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x900ac3e6UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x908c99f8UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x9093c9d0UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x90feea06UL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x912f3d5bUL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x920bba2aUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x92424a71UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x92f2b09eUL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x942eaa71UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x9450846bUL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x9459d5a0UL, 24, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x945d79aeUL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x94a6b3edUL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x9530ed6eUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x95601766UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x9578be99UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x95c8ed73UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x96ca23e2UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x97988f36UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x97d5bf89UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x97f65cefUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x9811f41eUL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x98223a30UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x9848a323UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x98653bceUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x996073dfUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x9967e52dUL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x99d17f8aUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0x9a56c593UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x9a7fc15cUL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x9a80bb89UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0x9b5e4173UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0x9ccf6cacUL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x9d378afeUL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0x9daf2683UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x9de758aeUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0x9e8a2847UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0x9e964b1aUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x9fb27c0eUL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0x9fdeb399UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0x9ff2c6a1UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xa02d9b49UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xa02ff048UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xa033f7a0UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xa0964f30UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xa0ed472cUL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xa0f5e092UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xa1697c21UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xa1931f2eUL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xa26980b9UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xa2d55cb6UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xa36e1053UL, 105, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xa3fc380cUL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xa40a754dUL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xa4e85349UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xa59404c3UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xa596235fUL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xa5974393UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xa59a0fccUL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xa5dba7a4UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xa65a209dUL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xa7a2b218UL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xa7c8b311UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xa7d06383UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xa7d3f5d3UL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xa80b33f1UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xa80e4f97UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xa83a5de9UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xa93a1343UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xa95dbfa0UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xa970b441UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xa990cb86UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xa99cce19UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xa9a4e3d9UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xaa4c1798UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xaa5790cbUL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xaa5dbd7eUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xaa72d5b9UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xaa7a1fddUL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xaa802ae6UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xaab0060cUL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xaad0a372UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xab22e9a6UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xab5a490cUL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xac08706aUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xac113aa8UL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xac3aba62UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xac422bb0UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xad703524UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xad7738e4UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xadb899cdUL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xade02658UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xae20f66cUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xae6635a1UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xae6aeb92UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xae7f6bb7UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xae8e6c46UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xae8edc9bUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xae9711deUL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xaeabe78bUL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xaf4187a6UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xaf99fb31UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xafad3ef9UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb020dc41UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xb07f84dcUL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xb0ad61f0UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xb0cf1e13UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xb156931cUL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xb170919dUL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xb1839644UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xb1bb271dUL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xb23f9db3UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xb28cc291UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xb29f6629UL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb2b8fa1cUL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xb307e1ccUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xb31ec963UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xb3563f09UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xb3930e1fUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xb3ab8e15UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xb3f13fffUL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xb473a9e4UL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xb528a920UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xb5afa339UL, 45, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb5b810dbUL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xb631028eUL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xb64e7b06UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb6e97d4bUL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xb77e8cd6UL, 85, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb7c299ccUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xb7d69a1aUL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xb7e27be5UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb8288e39UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xb860575fUL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xb8a8247bUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xb8afc319UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xb8b8dd70UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xba1e321eUL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xba54e1cdUL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xbad6bd53UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xbae57a74UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xbb02e639UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xbb14a46cUL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xbb313805UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xbb475507UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xbb49b536UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xbb72ed6fUL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xbc6daf49UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xbc78060bUL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xbc8b2313UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xbd042889UL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xbd4d1c3cUL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xbd7ec8d0UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xbd8a4c8fUL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xbdaae9f5UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xbdfd3029UL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xbe180fc8UL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xbec7b15bUL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xbf0973beUL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xbf132170UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xbf1500e5UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xbf1c7233UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xbf9a3a41UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xbfec2ad0UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xc04a7ba7UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xc08846ceUL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xc09b744fUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xc0fb3cefUL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xc133ff46UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xc215dbe0UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xc2c5253dUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xc3408dffUL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xc3ca3d2bUL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xc44ad820UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xc479d0c4UL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xc481cec1UL, 13, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xc4fb9b87UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xc50e9028UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xc542bfc0UL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xc5670914UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xc593409fUL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xc5e2284fUL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xc5fb9965UL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xc6cee193UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xc6cfe2a8UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xc6dab33cUL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xc88e6cffUL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xc8c24d88UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xc90f959fUL, 42, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xc93da8feUL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xca1ae517UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xca9ce04fUL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xcaa1a497UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xcb7805d7UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xcc0c6da7UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xccac2a58UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xcd245f9eUL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xcdbfc0f7UL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xcdeeeaefUL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xce474244UL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xceafb416UL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xcfb2ce07UL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xd02762bfUL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xd0500ca3UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd0590f53UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd0649312UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd0853078UL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xd096d5beUL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xd0c00127UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xd0d776acUL, 14, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xd1266e2eUL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd17021f8UL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xd1da8086UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd1ec56edUL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xd1ef4768UL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd1f6b8b6UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd269b812UL, 20, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xd2c762c2UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd3199174UL, 89, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xd324c22aUL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xd3d58372UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xd44d9f00UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xd5170e12UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd53efe56UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd5e97654UL, 7, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xd63e34c8UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xd7251ea3UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xd7b73b77UL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xd7c621f8UL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xd7fd7414UL, 4, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd8414f97UL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd86d8722UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xd8bc6ed2UL, 43, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xd8c6028eUL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xd8cc0d97UL, 21, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd909050dUL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xd91584e7UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xd99d24e9UL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xdab4d60bUL, 10, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xdb794a09UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xdb968a38UL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xdbde74beUL, 17, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xdc342659UL, 37, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xdcbd5b0dUL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xdcd6e85cUL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xdd4b59bbUL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xdd53ff53UL, 66, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xdd7726d2UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xddb228b1UL, 63, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xddbfaef6UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xddf28657UL, 65, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xde630124UL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xdeddc9b6UL, 92, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xdf3c7251UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xdf44f913UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xdf4844adUL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xdf8c0b88UL, 58, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xdff67cd6UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe09a077aUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe0ac6c0fUL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe0c93172UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe12c5bbbUL, 8, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xe199754cUL, 57, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xe1b177faUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe1dbb6d8UL, 56, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xe1fe32d8UL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe204c138UL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe266bbb8UL, 90, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe2756a7dUL, 53, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xe2768e90UL, 35, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xe301a942UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe3131bd4UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xe33355d6UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xe33ed995UL, 59, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xe35f76fbUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xe3e59695UL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xe48a5187UL, 47, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xe4c98debUL, 25, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xe4d0ff39UL, 72, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xe58e152fUL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xe5ff08adUL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xe69e0788UL, 104, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xe69f695aUL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe6afc9f5UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xe6c50beaUL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xe6cb16f3UL, 81, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe775cae5UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe79d2d93UL, 38, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe7e8bd26UL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe87e28cfUL, 48, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xe8b8dd29UL, 86, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xe8db1f93UL, 62, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xe938457fUL, 32, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xe93ce97dUL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xe9c28fc6UL, 70, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xe9ff6526UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xea73507cUL, 60, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xea9181faUL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xeabfe48bUL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xeacc1250UL, 69, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xeb1b961aUL, 51, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xeb34f380UL, 103, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xeb47cda5UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xebba463bUL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xeccb83c1UL, 28, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xecd4fd3dUL, 78, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xed0dfddfUL, 99, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xed14df84UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xed2e159aUL, 55, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xed849ed0UL, 102, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xed8a32d4UL, 67, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xee41a02bUL, 80, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xee70d0bbUL, 30, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xeea91845UL, 39, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xef5861c4UL, 88, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xef8503d3UL, 64, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xef9686efUL, 0, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xefa4a629UL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xefeb7ae7UL, 84, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xeffdafdeUL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xf0053cffUL, 96, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xf0516d55UL, 101, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xf1b6da12UL, 49, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xf24eb6a6UL, 2, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xf25a37f8UL, 11, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf29fe9e2UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xf2aa7109UL, 27, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xf2b1da32UL, 12, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf3518dd4UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf360eb78UL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf3744dfdUL, 100, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf39ab672UL, 82, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf3a377f5UL, 29, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf3c368cbUL, 26, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xf401fbb4UL, 1, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xf41ca342UL, 61, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xf48bbe7dUL, 93, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf4b5869dUL, 3, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xf4d8795bUL, 23, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf4df07bbUL, 91, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf4fb5d2dUL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xf57e7653UL, 41, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xf58bcf08UL, 79, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xf5916af4UL, 44, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf5c59a8cUL, 95, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xf5dbefc5UL, 73, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf60d9c59UL, 34, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xf639bd7eUL, 40, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xf66a4d44UL, 68, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xf6a52c86UL, 5, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 1 },
+	{ 0xf76e85d2UL, 9, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf7a22fb5UL, 54, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xf7e54256UL, 31, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xf7fa9673UL, 52, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xf8b0b231UL, 19, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xf8d94f30UL, 98, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xf9056732UL, 71, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xf98a1078UL, 22, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xfa00dd0bUL, 46, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xfa34f34cUL, 18, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 2 },
+	{ 0xfae4017bUL, 74, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xfc173000UL, 50, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xfcd9aba9UL, 97, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xfd6bc87dUL, 75, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xfd6ca18bUL, 83, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xfe221428UL, 15, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 3 },
+	{ 0xfe48e424UL, 36, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 4 },
+	{ 0xfe6fbb7cUL, 76, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 5 },
+	{ 0xff0cfa18UL, 87, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xff13de7fUL, 94, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 },
+	{ 0xff52cf7cUL, 77, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 6 },
+	{ 0xff86b50fUL, 6, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 7 },
+	{ 0xffe35ba3UL, 33, LIBSCCA_PREFETCH_HASH_TYPE_VISTA, 8 } };
+
+const int libscca_prefetch_hash_table_number_of_entries = 1696;
+
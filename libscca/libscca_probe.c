@@ -0,0 +1,244 @@
+/*
+ * Probe functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_format_layout.h"
+#include "libscca_libcerror.h"
+#include "libscca_lzxpress.h"
+#include "libscca_probe.h"
+#include "libscca_support.h"
+
+#include "scca_file_header.h"
+#include "scca_file_information.h"
+
+/* Probes uncompressed data for the key metadata
+ * The data should contain the file header and the file information
+ * No errors are set, data that cannot be probed is left to libscca_file_open
+ * Returns 1 if successful or 0 if not
+ */
+int libscca_probe_uncompressed_data(
+     const uint8_t *data,
+     size_t data_size,
+     libscca_probe_result_t *probe_result )
+{
+	const libscca_format_layout_t *format_layout = NULL;
+	const uint8_t *file_information_data         = NULL;
+	const uint8_t *last_run_time_data            = NULL;
+	size_t executable_filename_size              = 0;
+	uint32_t metrics_array_offset                = 0;
+	int last_run_time_index                      = 0;
+
+	if( ( data == NULL )
+	 || ( probe_result == NULL ) )
+	{
+		return( 0 );
+	}
+	if( data_size < ( sizeof( scca_file_header_t ) + sizeof( uint32_t ) ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->format_version,
+	 probe_result->format_version );
+
+	if( libscca_format_layout_get_by_format_version(
+	     probe_result->format_version,
+	     &format_layout,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	file_information_data = &( data[ sizeof( scca_file_header_t ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->metrics_array_offset,
+	 metrics_array_offset );
+
+	if( libscca_format_layout_get_by_metrics_array_offset(
+	     format_layout,
+	     metrics_array_offset,
+	     &format_layout,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( data_size - sizeof( scca_file_header_t ) ) < format_layout->file_information_data_size )
+	{
+		return( 0 );
+	}
+	for( executable_filename_size = 0;
+	     ( executable_filename_size + 1 ) < 60;
+	     executable_filename_size += 2 )
+	{
+		if( ( ( (scca_file_header_t *) data )->executable_filename[ executable_filename_size ] == 0 )
+		 && ( ( (scca_file_header_t *) data )->executable_filename[ executable_filename_size + 1 ] == 0 ) )
+		{
+			break;
+		}
+	}
+	probe_result->executable_filename        = ( (scca_file_header_t *) data )->executable_filename;
+	probe_result->executable_filename_length = executable_filename_size / 2;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->prefetch_hash,
+	 probe_result->prefetch_hash );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_information_data[ format_layout->run_count_offset ] ),
+	 probe_result->run_count );
+
+	last_run_time_data = &( file_information_data[ format_layout->last_run_times_offset ] );
+
+	for( last_run_time_index = 0;
+	     last_run_time_index < format_layout->number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 last_run_time_data,
+		 probe_result->last_run_times[ last_run_time_index ] );
+
+		last_run_time_data += 8;
+	}
+	probe_result->number_of_last_run_times = format_layout->number_of_last_run_times;
+
+	return( 1 );
+}
+
+/* Probes data for the key metadata without opening a file
+ * The data should contain the start of the file
+ * No memory is allocated, the uncompressed data is read in place and of compressed data
+ * only the first chunk, which contains the file header and the file information,
+ * is decompressed into the block data of the probe result
+ * Returns 1 if successful, 0 if the data cannot be probed or -1 on error
+ */
+int libscca_probe(
+     const uint8_t *data,
+     size_t data_size,
+     libscca_probe_result_t *probe_result,
+     libcerror_error_t **error )
+{
+	static char *function           = "libscca_probe";
+	size_t compressed_data_offset   = 0;
+	size_t uncompressed_data_offset = 0;
+	uint32_t file_size              = 0;
+	int end_of_stream               = 0;
+	int file_type                   = 0;
+	int result                      = 0;
+
+	if( probe_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid probe result.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     probe_result,
+	     0,
+	     sizeof( libscca_probe_result_t ) - LIBSCCA_PROBE_RESULT_BLOCK_DATA_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear probe result.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_check_signature_buffer(
+	          data,
+	          data_size,
+	          &file_type,
+	          &file_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check signature.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		result = libscca_probe_uncompressed_data(
+		          data,
+		          data_size,
+		          probe_result );
+	}
+	else
+	{
+		if( file_size > LIBSCCA_PROBE_RESULT_BLOCK_DATA_SIZE )
+		{
+			file_size = LIBSCCA_PROBE_RESULT_BLOCK_DATA_SIZE;
+		}
+		/* Data that the fast path cannot decode, such as a match that extends beyond
+		 * the first chunk, is left to libscca_file_open
+		 */
+		result = libscca_lzxpress_huffman_decode_chunk(
+		          &( data[ sizeof( scca_mam_file_header_t ) ] ),
+		          data_size - sizeof( scca_mam_file_header_t ),
+		          &compressed_data_offset,
+		          probe_result->block_data,
+		          (size_t) file_size,
+		          &uncompressed_data_offset,
+		          NULL,
+		          &end_of_stream,
+		          NULL,
+		          NULL );
+
+		if( result == 1 )
+		{
+			result = libscca_probe_uncompressed_data(
+			          probe_result->block_data,
+			          uncompressed_data_offset,
+			          probe_result );
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		probe_result->file_type = file_type;
+	}
+	return( result );
+}
+
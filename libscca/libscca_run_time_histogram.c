@@ -0,0 +1,1055 @@
+/*
+ * Run time histogram functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+#include "libscca_run_time_histogram.h"
+
+/* Creates a run time histogram
+ * Make sure the value run_time_histogram is referencing, is set to NULL
+ * The bucket width is in number of 100th nano seconds, the resolution of a FILETIME
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_initialize(
+     libscca_run_time_histogram_t **run_time_histogram,
+     uint64_t bucket_width,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	static char *function                                              = "libscca_run_time_histogram_initialize";
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( *run_time_histogram != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid run time histogram value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_width == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bucket width value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = memory_allocate_structure(
+	                               libscca_internal_run_time_histogram_t );
+
+	if( internal_run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create run time histogram.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_run_time_histogram,
+	     0,
+	     sizeof( libscca_internal_run_time_histogram_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear run time histogram.",
+		 function );
+
+		memory_free(
+		 internal_run_time_histogram );
+
+		return( -1 );
+	}
+	internal_run_time_histogram->bucket_width = bucket_width;
+
+	if( libscca_internal_run_time_histogram_resize_buckets(
+	     internal_run_time_histogram,
+	     LIBSCCA_RUN_TIME_HISTOGRAM_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	*run_time_histogram = (libscca_run_time_histogram_t *) internal_run_time_histogram;
+
+	return( 1 );
+
+on_error:
+	if( internal_run_time_histogram != NULL )
+	{
+		memory_free(
+		 internal_run_time_histogram );
+	}
+	return( -1 );
+}
+
+/* Frees a run time histogram
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_free(
+     libscca_run_time_histogram_t **run_time_histogram,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	static char *function                                              = "libscca_run_time_histogram_free";
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( *run_time_histogram != NULL )
+	{
+		internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) *run_time_histogram;
+		*run_time_histogram         = NULL;
+
+		if( internal_run_time_histogram->buckets != NULL )
+		{
+			memory_free(
+			 internal_run_time_histogram->buckets );
+		}
+		if( internal_run_time_histogram->entries != NULL )
+		{
+			memory_free(
+			 internal_run_time_histogram->entries );
+		}
+		memory_free(
+		 internal_run_time_histogram );
+	}
+	return( 1 );
+}
+
+/* Resizes the buckets of the entries hash table and rehashes the entries
+ * The number of buckets must be a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_run_time_histogram_resize_buckets(
+     libscca_internal_run_time_histogram_t *internal_run_time_histogram,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	libscca_run_time_histogram_entry_t *entry = NULL;
+	static char *function                     = "libscca_internal_run_time_histogram_resize_buckets";
+	int *buckets                              = NULL;
+	int bucket_index                          = 0;
+	int entry_index                           = 0;
+
+	if( internal_run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (int *) memory_allocate(
+	                   sizeof( int ) * (size_t) number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < number_of_buckets;
+	     bucket_index++ )
+	{
+		buckets[ bucket_index ] = -1;
+	}
+	/* The stored hashes are reused hence the keys are not hashed again
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_run_time_histogram->number_of_entries;
+	     entry_index++ )
+	{
+		entry        = &( internal_run_time_histogram->entries[ entry_index ] );
+		bucket_index = (int) ( entry->hash & (uint64_t) ( number_of_buckets - 1 ) );
+
+		entry->next_entry_index = buckets[ bucket_index ];
+		buckets[ bucket_index ] = entry_index;
+	}
+	if( internal_run_time_histogram->buckets != NULL )
+	{
+		memory_free(
+		 internal_run_time_histogram->buckets );
+	}
+	internal_run_time_histogram->buckets           = buckets;
+	internal_run_time_histogram->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Adds a number of runs to the entry of an executable filename, prefetch hash and time bucket
+ * The entry is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_run_time_histogram_append_runs(
+     libscca_internal_run_time_histogram_t *internal_run_time_histogram,
+     const uint8_t *utf8_executable_filename,
+     size_t utf8_executable_filename_size,
+     uint32_t prefetch_hash,
+     uint64_t bucket_start_time,
+     uint64_t number_of_runs,
+     libcerror_error_t **error )
+{
+	libscca_run_time_histogram_entry_t *entries = NULL;
+	libscca_run_time_histogram_entry_t *entry   = NULL;
+	static char *function                       = "libscca_internal_run_time_histogram_append_runs";
+	size_t entries_size                         = 0;
+	uint64_t hash                               = 0;
+	int bucket_index                            = 0;
+	int entry_index                             = 0;
+	int number_of_entries                       = 0;
+
+	if( internal_run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_run_time_histogram->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid run time histogram - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_executable_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_executable_filename_size == 0 )
+	 || ( utf8_executable_filename_size > LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 executable filename size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     utf8_executable_filename,
+	     utf8_executable_filename_size,
+	     bucket_start_time ^ ( (uint64_t) prefetch_hash << 32 ),
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( hash & (uint64_t) ( internal_run_time_histogram->number_of_buckets - 1 ) );
+	entry_index  = internal_run_time_histogram->buckets[ bucket_index ];
+
+	while( entry_index != -1 )
+	{
+		entry = &( internal_run_time_histogram->entries[ entry_index ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->bucket_start_time == bucket_start_time )
+		 && ( entry->prefetch_hash == prefetch_hash )
+		 && ( entry->utf8_executable_filename_size == utf8_executable_filename_size )
+		 && ( memory_compare(
+		       entry->utf8_executable_filename,
+		       utf8_executable_filename,
+		       utf8_executable_filename_size ) == 0 ) )
+		{
+			entry->number_of_runs += number_of_runs;
+
+			return( 1 );
+		}
+		entry_index = entry->next_entry_index;
+	}
+	if( internal_run_time_histogram->number_of_entries >= internal_run_time_histogram->number_of_allocated_entries )
+	{
+		number_of_entries = internal_run_time_histogram->number_of_allocated_entries;
+
+		if( number_of_entries == 0 )
+		{
+			number_of_entries = 64;
+		}
+		else if( number_of_entries > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_entries *= 2;
+		}
+		entries_size = sizeof( libscca_run_time_histogram_entry_t ) * (size_t) number_of_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entries size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libscca_run_time_histogram_entry_t *) memory_reallocate(
+		                                                  internal_run_time_histogram->entries,
+		                                                  entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_run_time_histogram->entries                     = entries;
+		internal_run_time_histogram->number_of_allocated_entries = number_of_entries;
+	}
+	entry_index = internal_run_time_histogram->number_of_entries;
+	entry       = &( internal_run_time_histogram->entries[ entry_index ] );
+
+	if( memory_copy(
+	     entry->utf8_executable_filename,
+	     utf8_executable_filename,
+	     utf8_executable_filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	entry->utf8_executable_filename_size = utf8_executable_filename_size;
+	entry->prefetch_hash                 = prefetch_hash;
+	entry->bucket_start_time             = bucket_start_time;
+	entry->number_of_runs                = number_of_runs;
+	entry->hash                          = hash;
+	entry->next_entry_index              = internal_run_time_histogram->buckets[ bucket_index ];
+
+	internal_run_time_histogram->buckets[ bucket_index ] = entry_index;
+
+	internal_run_time_histogram->number_of_entries += 1;
+
+	/* The number of buckets is doubled when the load factor exceeds 1
+	 */
+	if( ( internal_run_time_histogram->number_of_entries > internal_run_time_histogram->number_of_buckets )
+	 && ( internal_run_time_histogram->number_of_buckets <= ( INT_MAX / 2 ) ) )
+	{
+		if( libscca_internal_run_time_histogram_resize_buckets(
+		     internal_run_time_histogram,
+		     internal_run_time_histogram->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the run times of a file
+ * Every filetime that is set is counted as a run in the time bucket that contains it,
+ * filetimes with a value of 0 are skipped. Every call counts as a single file
+ * The UTF-8 executable filename size includes the end-of-string character and
+ * cannot exceed LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_append_run_times(
+     libscca_run_time_histogram_t *run_time_histogram,
+     const uint8_t *utf8_executable_filename,
+     size_t utf8_executable_filename_size,
+     uint32_t prefetch_hash,
+     const uint64_t *filetimes,
+     int number_of_filetimes,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	static char *function                                              = "libscca_run_time_histogram_append_run_times";
+	uint64_t bucket_start_time                                         = 0;
+	int filetime_index                                                 = 0;
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) run_time_histogram;
+
+	if( internal_run_time_histogram->number_of_files == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run time histogram - number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filetimes < 0 )
+	 || ( number_of_filetimes > LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filetimes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		if( filetimes[ filetime_index ] == 0 )
+		{
+			continue;
+		}
+		bucket_start_time = filetimes[ filetime_index ]
+		                  - ( filetimes[ filetime_index ] % internal_run_time_histogram->bucket_width );
+
+		if( libscca_internal_run_time_histogram_append_runs(
+		     internal_run_time_histogram,
+		     utf8_executable_filename,
+		     utf8_executable_filename_size,
+		     prefetch_hash,
+		     bucket_start_time,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run time: %d.",
+			 function,
+			 filetime_index );
+
+			return( -1 );
+		}
+	}
+	internal_run_time_histogram->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Appends the last run times of a file
+ * The runs are keyed by the executable filename and prefetch hash of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_append_file(
+     libscca_run_time_histogram_t *run_time_histogram,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_executable_filename[ LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE ];
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	static char *function                = "libscca_run_time_histogram_append_file";
+	size_t utf8_executable_filename_size = 0;
+	uint32_t prefetch_hash               = 0;
+	int number_of_filetimes              = 0;
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_last_run_times(
+	     file,
+	     filetimes,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_utf8_executable_filename_size(
+	     file,
+	     &utf8_executable_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The executable filename in the file header is at most 30 UTF-16 characters
+	 * hence its UTF-8 representation always fits in the entry
+	 */
+	if( utf8_executable_filename_size > LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 executable filename size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_executable_filename_size <= 1 )
+	{
+		utf8_executable_filename[ 0 ] = 0;
+
+		utf8_executable_filename_size = 1;
+	}
+	else if( libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_executable_filename,
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_run_time_histogram_append_run_times(
+	     run_time_histogram,
+	     utf8_executable_filename,
+	     utf8_executable_filename_size,
+	     prefetch_hash,
+	     filetimes,
+	     number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append run times.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Merges the entries and number of files of a source run time histogram
+ * into the run time histogram
+ * Both run time histograms must have the same bucket width
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_merge(
+     libscca_run_time_histogram_t *run_time_histogram,
+     libscca_run_time_histogram_t *source_run_time_histogram,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram        = NULL;
+	libscca_internal_run_time_histogram_t *internal_source_run_time_histogram = NULL;
+	libscca_run_time_histogram_entry_t *entry                                 = NULL;
+	static char *function                                                     = "libscca_run_time_histogram_merge";
+	int entry_index                                                           = 0;
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) run_time_histogram;
+
+	if( source_run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_run_time_histogram = (libscca_internal_run_time_histogram_t *) source_run_time_histogram;
+
+	if( internal_source_run_time_histogram == internal_run_time_histogram )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source run time histogram value same as run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_source_run_time_histogram->bucket_width != internal_run_time_histogram->bucket_width )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported source run time histogram - bucket width mismatch.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_source_run_time_histogram->number_of_files > ( INT_MAX - internal_run_time_histogram->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_source_run_time_histogram->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_source_run_time_histogram->entries[ entry_index ] );
+
+		if( libscca_internal_run_time_histogram_append_runs(
+		     internal_run_time_histogram,
+		     entry->utf8_executable_filename,
+		     entry->utf8_executable_filename_size,
+		     entry->prefetch_hash,
+		     entry->bucket_start_time,
+		     entry->number_of_runs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	internal_run_time_histogram->number_of_files += internal_source_run_time_histogram->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the bucket width
+ * The bucket width is in number of 100th nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_get_bucket_width(
+     libscca_run_time_histogram_t *run_time_histogram,
+     uint64_t *bucket_width,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	static char *function                                              = "libscca_run_time_histogram_get_bucket_width";
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) run_time_histogram;
+
+	if( bucket_width == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket width.",
+		 function );
+
+		return( -1 );
+	}
+	*bucket_width = internal_run_time_histogram->bucket_width;
+
+	return( 1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_get_number_of_files(
+     libscca_run_time_histogram_t *run_time_histogram,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	static char *function                                              = "libscca_run_time_histogram_get_number_of_files";
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) run_time_histogram;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = internal_run_time_histogram->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_get_number_of_entries(
+     libscca_run_time_histogram_t *run_time_histogram,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	static char *function                                              = "libscca_run_time_histogram_get_number_of_entries";
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) run_time_histogram;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_run_time_histogram->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * The entries are stored in the order they were first added, which is not
+ * sorted by bucket start time
+ * The UTF-8 executable filename size should be at least the size of the stored
+ * executable filename, LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE is always sufficient
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_run_time_histogram_get_entry(
+     libscca_run_time_histogram_t *run_time_histogram,
+     int entry_index,
+     uint8_t *utf8_executable_filename,
+     size_t utf8_executable_filename_size,
+     uint32_t *prefetch_hash,
+     uint64_t *bucket_start_time,
+     uint64_t *number_of_runs,
+     libcerror_error_t **error )
+{
+	libscca_internal_run_time_histogram_t *internal_run_time_histogram = NULL;
+	libscca_run_time_histogram_entry_t *entry                          = NULL;
+	static char *function                                              = "libscca_run_time_histogram_get_entry";
+
+	if( run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	internal_run_time_histogram = (libscca_internal_run_time_histogram_t *) run_time_histogram;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_run_time_histogram->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_executable_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( prefetch_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_start_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket start time.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of runs.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_run_time_histogram->entries[ entry_index ] );
+
+	if( utf8_executable_filename_size < entry->utf8_executable_filename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 executable filename size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_executable_filename,
+	     entry->utf8_executable_filename,
+	     entry->utf8_executable_filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 executable filename.",
+		 function );
+
+		return( -1 );
+	}
+	*prefetch_hash     = entry->prefetch_hash;
+	*bucket_start_time = entry->bucket_start_time;
+	*number_of_runs    = entry->number_of_runs;
+
+	return( 1 );
+}
+
@@ -0,0 +1,187 @@
+/*
+ * Run time histogram functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_RUN_TIME_HISTOGRAM_H )
+#define _LIBSCCA_RUN_TIME_HISTOGRAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of buckets of the entries hash table, must be a power of 2
+ */
+#define LIBSCCA_RUN_TIME_HISTOGRAM_INITIAL_NUMBER_OF_BUCKETS	256
+
+typedef struct libscca_run_time_histogram_entry libscca_run_time_histogram_entry_t;
+
+struct libscca_run_time_histogram_entry
+{
+	/* The UTF-8 executable filename, which is terminated by an end-of-string character
+	 */
+	uint8_t utf8_executable_filename[ LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE ];
+
+	/* The UTF-8 executable filename size, which includes the end-of-string character
+	 */
+	size_t utf8_executable_filename_size;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The start of the time bucket, which contains a FILETIME value
+	 */
+	uint64_t bucket_start_time;
+
+	/* The number of runs in the time bucket
+	 */
+	uint64_t number_of_runs;
+
+	/* The hash of the key
+	 */
+	uint64_t hash;
+
+	/* The index of the next entry in the same bucket or -1 if not set
+	 */
+	int next_entry_index;
+};
+
+typedef struct libscca_internal_run_time_histogram libscca_internal_run_time_histogram_t;
+
+struct libscca_internal_run_time_histogram
+{
+	/* The bucket width, in number of 100th nano seconds
+	 */
+	uint64_t bucket_width;
+
+	/* The entries
+	 */
+	libscca_run_time_histogram_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The index of the first entry of every bucket or -1 if not set
+	 */
+	int *buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of files
+	 */
+	int number_of_files;
+};
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_initialize(
+     libscca_run_time_histogram_t **run_time_histogram,
+     uint64_t bucket_width,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_free(
+     libscca_run_time_histogram_t **run_time_histogram,
+     libcerror_error_t **error );
+
+int libscca_internal_run_time_histogram_resize_buckets(
+     libscca_internal_run_time_histogram_t *internal_run_time_histogram,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int libscca_internal_run_time_histogram_append_runs(
+     libscca_internal_run_time_histogram_t *internal_run_time_histogram,
+     const uint8_t *utf8_executable_filename,
+     size_t utf8_executable_filename_size,
+     uint32_t prefetch_hash,
+     uint64_t bucket_start_time,
+     uint64_t number_of_runs,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_append_run_times(
+     libscca_run_time_histogram_t *run_time_histogram,
+     const uint8_t *utf8_executable_filename,
+     size_t utf8_executable_filename_size,
+     uint32_t prefetch_hash,
+     const uint64_t *filetimes,
+     int number_of_filetimes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_append_file(
+     libscca_run_time_histogram_t *run_time_histogram,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_merge(
+     libscca_run_time_histogram_t *run_time_histogram,
+     libscca_run_time_histogram_t *source_run_time_histogram,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_get_bucket_width(
+     libscca_run_time_histogram_t *run_time_histogram,
+     uint64_t *bucket_width,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_get_number_of_files(
+     libscca_run_time_histogram_t *run_time_histogram,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_get_number_of_entries(
+     libscca_run_time_histogram_t *run_time_histogram,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_run_time_histogram_get_entry(
+     libscca_run_time_histogram_t *run_time_histogram,
+     int entry_index,
+     uint8_t *utf8_executable_filename,
+     size_t utf8_executable_filename_size,
+     uint32_t *prefetch_hash,
+     uint64_t *bucket_start_time,
+     uint64_t *number_of_runs,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_RUN_TIME_HISTOGRAM_H ) */
+
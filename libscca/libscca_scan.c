@@ -0,0 +1,771 @@
+/*
+ * Scan functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_io_handle.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcnotify.h"
+#include "libscca_libcthreads.h"
+#include "libscca_scan.h"
+#include "libscca_support.h"
+
+#include "scca_file_header.h"
+
+/* Scans a buffer for embedded prefetch files
+ * The buffer typically contains (part of) a disk or memory image. Candidates are
+ * the uncompressed "SCCA" and compressed "MAM\x04" signatures at offsets that are
+ * a multiple of alignment, which are checked against the same file header
+ * constraints used when opening a file. Since the buffer can be part of a larger
+ * image the sizes in the file headers are not checked against the buffer size
+ * The buffer is scanned in chunks of LIBSCCA_SCAN_CHUNK_SIZE bytes that are
+ * distributed over a pool of number_of_threads worker threads, if multi-threading
+ * support is not available the chunks are scanned sequentially
+ * The callback function is called once for every file header found with its offset
+ * relative to the start of the buffer, its file type and the file size in the
+ * file header or, for a compressed file, the uncompressed data size. The calls
+ * are not concurrent but when multiple threads are used they are not in order
+ * of offset
+ * The callback function should return 1 if successful or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_scan_buffer(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t alignment,
+     int number_of_threads,
+     int (*callback_function)(
+            size_t offset,
+            int file_type,
+            uint32_t data_size,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_scan_context_t scan_context;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	int maximum_number_of_queued_chunks    = 0;
+	int number_of_chunks                   = 0;
+#endif
+
+	static char *function                  = "libscca_scan_buffer";
+	size_t chunk_offset                    = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid alignment value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid alignment value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &scan_context,
+	     0,
+	     sizeof( libscca_scan_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan context.",
+		 function );
+
+		return( -1 );
+	}
+	scan_context.buffer             = buffer;
+	scan_context.buffer_size        = buffer_size;
+	scan_context.alignment          = alignment;
+	scan_context.callback_function  = callback_function;
+	scan_context.callback_arguments = callback_arguments;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( buffer_size > LIBSCCA_SCAN_CHUNK_SIZE )
+	{
+		number_of_chunks = (int) ( ( buffer_size + LIBSCCA_SCAN_CHUNK_SIZE - 1 ) / LIBSCCA_SCAN_CHUNK_SIZE );
+	}
+	if( ( number_of_threads > 1 )
+	 && ( number_of_chunks > 1 ) )
+	{
+		if( number_of_threads > number_of_chunks )
+		{
+			number_of_threads = number_of_chunks;
+		}
+		maximum_number_of_queued_chunks = number_of_chunks;
+
+		if( maximum_number_of_queued_chunks > LIBSCCA_MAXIMUM_NUMBER_OF_QUEUED_SCAN_CHUNKS )
+		{
+			maximum_number_of_queued_chunks = LIBSCCA_MAXIMUM_NUMBER_OF_QUEUED_SCAN_CHUNKS;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( scan_context.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     maximum_number_of_queued_chunks,
+		     (int (*)(intptr_t *, void *)) &libscca_scan_thread_pool_callback,
+		     (void *) &scan_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		/* The queued value is the address of the start of the chunk so that
+		 * the worker can determine the chunk offset relative to the start of buffer
+		 */
+		for( chunk_offset = 0;
+		     chunk_offset < buffer_size;
+		     chunk_offset += LIBSCCA_SCAN_CHUNK_SIZE )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( buffer[ chunk_offset ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push chunk at offset: %" PRIzd " onto queue.",
+				 function,
+				 chunk_offset );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_free(
+		     &( scan_context.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( chunk_offset = 0;
+		     chunk_offset < buffer_size;
+		     chunk_offset += LIBSCCA_SCAN_CHUNK_SIZE )
+		{
+			if( libscca_scan_chunk(
+			     &scan_context,
+			     chunk_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to scan chunk at offset: %" PRIzd ".",
+				 function,
+				 chunk_offset );
+
+				return( -1 );
+			}
+		}
+	}
+	if( scan_context.number_of_callback_errors > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for: %d file headers.",
+		 function,
+		 scan_context.number_of_callback_errors );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( scan_context.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( scan_context.mutex ),
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
+/* Scans a chunk of the buffer for embedded prefetch files
+ * The chunk contains the candidate offsets from chunk_offset up to chunk_offset
+ * + LIBSCCA_SCAN_CHUNK_SIZE, the signature of a candidate can extend into the next chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_scan_chunk(
+     libscca_scan_context_t *scan_context,
+     size_t chunk_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_scan_chunk";
+	size_t byte_end_offset     = 0;
+	size_t chunk_end_offset    = 0;
+	size_t scan_offset         = 0;
+	size_t search_end_offset   = 0;
+	uint64_t compressed_mask   = 0;
+	uint64_t uncompressed_mask = 0;
+	uint64_t value_64bit       = 0;
+	int file_type              = 0;
+
+	if( scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan context.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_context->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan context - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_context->alignment == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid scan context - alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offset >= scan_context->buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_end_offset = scan_context->buffer_size - chunk_offset;
+
+	if( chunk_end_offset > LIBSCCA_SCAN_CHUNK_SIZE )
+	{
+		chunk_end_offset = LIBSCCA_SCAN_CHUNK_SIZE;
+	}
+	chunk_end_offset += chunk_offset;
+
+	if( scan_context->alignment > 1 )
+	{
+		scan_offset = chunk_offset % scan_context->alignment;
+
+		if( scan_offset != 0 )
+		{
+			scan_offset = scan_context->alignment - scan_offset;
+		}
+		for( scan_offset += chunk_offset;
+		     scan_offset < chunk_end_offset;
+		     scan_offset += scan_context->alignment )
+		{
+			if( scan_context->buffer[ scan_offset ] == (uint8_t) 'M' )
+			{
+				file_type = LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10;
+			}
+			else if( ( ( scan_offset + 4 ) < scan_context->buffer_size )
+			      && ( scan_context->buffer[ scan_offset + 4 ] == (uint8_t) 'S' ) )
+			{
+				file_type = LIBSCCA_FILE_TYPE_UNCOMPRESSED;
+			}
+			else
+			{
+				continue;
+			}
+			if( libscca_scan_check_candidate(
+			     scan_context,
+			     scan_offset,
+			     file_type,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to check candidate at offset: %" PRIzd ".",
+				 function,
+				 scan_offset );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	/* The "SCCA" signature is stored 4 bytes after the start of the file header
+	 * hence the search extends 4 bytes beyond the end of the chunk
+	 */
+	search_end_offset = scan_context->buffer_size - chunk_end_offset;
+
+	if( search_end_offset > 4 )
+	{
+		search_end_offset = 4;
+	}
+	search_end_offset += chunk_end_offset;
+
+	/* The first byte of both signatures is searched for 8 bytes at a time,
+	 * only 8 bytes that contain either 'M' or 'S' are checked one by one
+	 */
+	scan_offset = chunk_offset;
+
+	while( scan_offset < search_end_offset )
+	{
+		if( ( scan_offset + 8 ) <= search_end_offset )
+		{
+			if( memory_copy(
+			     &value_64bit,
+			     &( scan_context->buffer[ scan_offset ] ),
+			     8 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy value.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_mask   = value_64bit ^ 0x4d4d4d4d4d4d4d4dULL;
+			uncompressed_mask = value_64bit ^ 0x5353535353535353ULL;
+
+			/* A byte of the mask is 0 if the corresponding byte of the value matches
+			 */
+			compressed_mask   = ( compressed_mask - 0x0101010101010101ULL ) & ~compressed_mask;
+			uncompressed_mask = ( uncompressed_mask - 0x0101010101010101ULL ) & ~uncompressed_mask;
+
+			if( ( ( compressed_mask | uncompressed_mask ) & 0x8080808080808080ULL ) == 0 )
+			{
+				scan_offset += 8;
+
+				continue;
+			}
+			byte_end_offset = scan_offset + 8;
+		}
+		else
+		{
+			byte_end_offset = search_end_offset;
+		}
+		while( scan_offset < byte_end_offset )
+		{
+			if( ( scan_context->buffer[ scan_offset ] == (uint8_t) 'M' )
+			 && ( scan_offset < chunk_end_offset ) )
+			{
+				if( libscca_scan_check_candidate(
+				     scan_context,
+				     scan_offset,
+				     LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check candidate at offset: %" PRIzd ".",
+					 function,
+					 scan_offset );
+
+					return( -1 );
+				}
+			}
+			else if( ( scan_context->buffer[ scan_offset ] == (uint8_t) 'S' )
+			      && ( scan_offset >= ( chunk_offset + 4 ) ) )
+			{
+				if( libscca_scan_check_candidate(
+				     scan_context,
+				     scan_offset - 4,
+				     LIBSCCA_FILE_TYPE_UNCOMPRESSED,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to check candidate at offset: %" PRIzd ".",
+					 function,
+					 scan_offset - 4 );
+
+					return( -1 );
+				}
+			}
+			scan_offset++;
+		}
+	}
+	return( 1 );
+}
+
+/* Checks a candidate file header of a specific file type
+ * The callback function is called if the candidate is a file header
+ * Returns 1 if the candidate is a file header, 0 if not or -1 on error
+ */
+int libscca_scan_check_candidate(
+     libscca_scan_context_t *scan_context,
+     size_t offset,
+     int file_type,
+     libcerror_error_t **error )
+{
+	const uint8_t *data   = NULL;
+	static char *function = "libscca_scan_check_candidate";
+	size_t data_size      = 0;
+	uint32_t value_32bit  = 0;
+	int result            = 0;
+
+	if( scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan context.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_context->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan context - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_context->callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scan context - missing callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset >= scan_context->buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	data      = &( scan_context->buffer[ offset ] );
+	data_size = scan_context->buffer_size - offset;
+
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	/* The signature of the file type is checked first since the file header
+	 * checks would otherwise match a compressed file as uncompressed candidate
+	 */
+	if( file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	{
+		if( memory_compare(
+		     data,
+		     scca_mam_file_signature_win10,
+		     4 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	else if( file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		if( ( memory_compare(
+		       &( data[ 4 ] ),
+		       scca_file_signature,
+		       4 ) != 0 )
+		 || ( memory_compare(
+		       data,
+		       scca_mam_file_signature_win10,
+		       4 ) == 0 ) )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_check_file_header_data(
+	          data,
+	          data_size,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check file header.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 value_32bit );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_file_header_t *) data )->file_size,
+		 value_32bit );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_context->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_context->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( scan_context->callback_function(
+	     offset,
+	     file_type,
+	     value_32bit,
+	     scan_context->callback_arguments ) != 1 )
+	{
+		scan_context->number_of_callback_errors += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan_context->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     scan_context->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Scans a chunk queued on the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_scan_thread_pool_callback(
+     intptr_t *value,
+     libscca_scan_context_t *scan_context )
+{
+	libcerror_error_t *error = NULL;
+	size_t chunk_offset      = 0;
+
+	if( ( value == NULL )
+	 || ( scan_context == NULL ) )
+	{
+		return( -1 );
+	}
+	chunk_offset = (size_t) ( (const uint8_t *) value - scan_context->buffer );
+
+	if( libscca_scan_chunk(
+	     scan_context,
+	     chunk_offset,
+	     &error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		if( libcthreads_mutex_grab(
+		     scan_context->mutex,
+		     NULL ) == 1 )
+		{
+			scan_context->number_of_callback_errors += 1;
+
+			libcthreads_mutex_release(
+			 scan_context->mutex,
+			 NULL );
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
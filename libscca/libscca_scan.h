@@ -0,0 +1,113 @@
+/*
+ * Scan functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_SCAN_H )
+#define _LIBSCCA_SCAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_scan_context libscca_scan_context_t;
+
+struct libscca_scan_context
+{
+	/* The buffer
+	 */
+	const uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The alignment
+	 */
+	size_t alignment;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       size_t offset,
+	       int file_type,
+	       uint32_t data_size,
+	       void *callback_arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_arguments;
+
+	/* The number of callback function errors
+	 */
+	int number_of_callback_errors;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_scan_buffer(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     size_t alignment,
+     int number_of_threads,
+     int (*callback_function)(
+            size_t offset,
+            int file_type,
+            uint32_t data_size,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+int libscca_scan_chunk(
+     libscca_scan_context_t *scan_context,
+     size_t chunk_offset,
+     libcerror_error_t **error );
+
+int libscca_scan_check_candidate(
+     libscca_scan_context_t *scan_context,
+     size_t offset,
+     int file_type,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libscca_scan_thread_pool_callback(
+     intptr_t *value,
+     libscca_scan_context_t *scan_context );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_SCAN_H ) */
+
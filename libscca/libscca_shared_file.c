@@ -0,0 +1,470 @@
+/*
+ * Shared file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+#include "libscca_shared_file.h"
+
+/* Creates a shared file
+ * Make sure the value shared_file is referencing, is set to NULL
+ * The parsed state of the source file is copied as snapshot data and opened
+ * as a read-only file with a single reference, that no longer depends on the source file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_shared_file_initialize(
+     libscca_shared_file_t **shared_file,
+     libscca_file_t *source_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_shared_file_initialize";
+
+	if( shared_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file.",
+		 function );
+
+		return( -1 );
+	}
+	*shared_file = memory_allocate_structure(
+	                libscca_shared_file_t );
+
+	if( *shared_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *shared_file,
+	     0,
+	     sizeof( libscca_shared_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared file.",
+		 function );
+
+		memory_free(
+		 *shared_file );
+
+		*shared_file = NULL;
+
+		return( -1 );
+	}
+	if( libscca_file_get_snapshot_size(
+	     source_file,
+	     &( ( *shared_file )->snapshot_data_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot size of source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( *shared_file )->snapshot_data_size == 0 )
+	 || ( ( *shared_file )->snapshot_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The allocation is 8-byte aligned, hence the snapshot is parsed in place
+	 */
+	( *shared_file )->snapshot_data = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * ( *shared_file )->snapshot_data_size );
+
+	if( ( *shared_file )->snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_write_snapshot(
+	     source_file,
+	     ( *shared_file )->snapshot_data,
+	     ( *shared_file )->snapshot_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write snapshot data of source file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_initialize(
+	     &( ( *shared_file )->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_snapshot(
+	     ( *shared_file )->file,
+	     ( *shared_file )->snapshot_data,
+	     ( *shared_file )->snapshot_data_size,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file from snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *shared_file )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The file cannot be closed or freed while it is shared
+	 */
+	( (libscca_internal_file_t *) ( *shared_file )->file )->shared_file = (intptr_t *) *shared_file;
+
+	( *shared_file )->number_of_references = 1;
+
+	return( 1 );
+
+on_error:
+	if( *shared_file != NULL )
+	{
+		if( ( *shared_file )->file != NULL )
+		{
+			libscca_file_free(
+			 &( ( *shared_file )->file ),
+			 NULL );
+		}
+		if( ( *shared_file )->snapshot_data != NULL )
+		{
+			memory_free(
+			 ( *shared_file )->snapshot_data );
+		}
+		memory_free(
+		 *shared_file );
+
+		*shared_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a shared file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_shared_file_free(
+     libscca_shared_file_t **shared_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_shared_file_free";
+	int result            = 1;
+
+	if( shared_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *shared_file != NULL )
+	{
+		/* The file is freed before the snapshot data since it references the snapshot data
+		 */
+		if( ( *shared_file )->file != NULL )
+		{
+			( (libscca_internal_file_t *) ( *shared_file )->file )->shared_file = NULL;
+
+			if( libscca_file_free(
+			     &( ( *shared_file )->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_file )->snapshot_data != NULL )
+		{
+			memory_free(
+			 ( *shared_file )->snapshot_data );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *shared_file )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *shared_file )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *shared_file );
+
+		*shared_file = NULL;
+	}
+	return( result );
+}
+
+/* Adds a reference to the shared file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_shared_file_add_reference(
+     libscca_shared_file_t *shared_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_shared_file_add_reference";
+	int result            = 1;
+
+	if( shared_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( shared_file->number_of_references <= 0 )
+	 || ( shared_file->number_of_references >= INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared file - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		shared_file->number_of_references += 1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Removes a reference from the shared file
+ * The remaining number of references is returned, when it is 0 the caller must free the shared file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_shared_file_remove_reference(
+     libscca_shared_file_t *shared_file,
+     int *number_of_references,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_shared_file_remove_reference";
+	int result            = 1;
+
+	if( shared_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared file.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shared_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( shared_file->number_of_references <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shared file - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		shared_file->number_of_references -= 1;
+
+		*number_of_references = shared_file->number_of_references;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shared_file->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,89 @@
+/*
+ * Shared file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_SHARED_FILE_H )
+#define _LIBSCCA_SHARED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_shared_file libscca_shared_file_t;
+
+struct libscca_shared_file
+{
+	/* The snapshot data the file was opened from
+	 * The snapshot data is referenced by the file
+	 */
+	uint8_t *snapshot_data;
+
+	/* The snapshot data size
+	 */
+	size_t snapshot_data_size;
+
+	/* The file
+	 */
+	libscca_file_t *file;
+
+	/* The number of references to the file
+	 */
+	int number_of_references;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The references are added and removed by different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libscca_shared_file_initialize(
+     libscca_shared_file_t **shared_file,
+     libscca_file_t *source_file,
+     libcerror_error_t **error );
+
+int libscca_shared_file_free(
+     libscca_shared_file_t **shared_file,
+     libcerror_error_t **error );
+
+int libscca_shared_file_add_reference(
+     libscca_shared_file_t *shared_file,
+     libcerror_error_t **error );
+
+int libscca_shared_file_remove_reference(
+     libscca_shared_file_t *shared_file,
+     int *number_of_references,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_SHARED_FILE_H ) */
+
@@ -0,0 +1,368 @@
+/*
+ * Parse statistics functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_CLOCK_GETTIME )
+#include <time.h>
+#endif
+
+#include "libscca_definitions.h"
+#include "libscca_libcerror.h"
+#include "libscca_statistics.h"
+
+/* Retrieves a monotonic timestamp in nano seconds
+ * Returns 1 if successful or 0 if no monotonic clock is available
+ */
+int libscca_statistics_get_timestamp(
+     uint64_t *timestamp )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter   = { 0 };
+	LARGE_INTEGER frequency = { 0 };
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	if( timestamp == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	*timestamp = ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	           + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart;
+
+	return( 1 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	*timestamp = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+	return( 1 );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Starts measuring the read time of a section
+ * The timestamp is cleared if no monotonic clock is available or if the read times
+ * should not be measured, which makes the subsequent section read time updates no-ops
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_statistics_start_timer(
+     libscca_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_statistics_start_timer";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics->measure_read_times == 0 )
+	{
+		statistics->timestamp = 0;
+	}
+	else if( libscca_statistics_get_timestamp(
+	          &( statistics->timestamp ) ) != 1 )
+	{
+		statistics->timestamp = 0;
+	}
+	return( 1 );
+}
+
+/* Adds the time elapsed since the timer was started to the read time of a section
+ * The timer is restarted so that consecutive sections can be measured
+ * Nothing is added if no monotonic clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_statistics_add_section_read_time(
+     libscca_statistics_t *statistics,
+     int section_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_statistics_add_section_read_time";
+	uint64_t current_timestamp = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( section_index < 0 )
+	 || ( section_index >= LIBSCCA_STATISTICS_NUMBER_OF_SECTIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid section index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( statistics->timestamp == 0 )
+	{
+		return( 1 );
+	}
+	if( libscca_statistics_get_timestamp(
+	     &current_timestamp ) != 1 )
+	{
+		return( 1 );
+	}
+	if( current_timestamp > statistics->timestamp )
+	{
+		statistics->section_read_times[ section_index ] += current_timestamp - statistics->timestamp;
+	}
+	statistics->timestamp              = current_timestamp;
+	statistics->has_section_read_times = 1;
+
+	return( 1 );
+}
+
+/* Adds a heap allocation
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_statistics_add_allocation(
+     libscca_statistics_t *statistics,
+     size_t allocation_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_statistics_add_allocation";
+
+	if( libscca_statistics_add_allocated_size(
+	     statistics,
+	     allocation_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	statistics->number_of_allocations += 1;
+
+	return( 1 );
+}
+
+/* Adds bytes to the allocated size without counting an allocation
+ * The maximum allocated size is updated accordingly
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_statistics_add_allocated_size(
+     libscca_statistics_t *statistics,
+     size_t allocation_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_statistics_add_allocated_size";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	statistics->allocated_size += (uint64_t) allocation_size;
+
+	if( statistics->allocated_size > statistics->maximum_allocated_size )
+	{
+		statistics->maximum_allocated_size = statistics->allocated_size;
+	}
+	return( 1 );
+}
+
+/* Removes bytes from the allocated size
+ * The allocated size does not drop below 0, since the statistics can be
+ * reset while memory that was accounted for is still allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_statistics_remove_allocated_size(
+     libscca_statistics_t *statistics,
+     size_t allocation_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_statistics_remove_allocated_size";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( (uint64_t) allocation_size < statistics->allocated_size )
+	{
+		statistics->allocated_size -= (uint64_t) allocation_size;
+	}
+	else
+	{
+		statistics->allocated_size = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific statistic value
+ * Returns 1 if successful, 0 if the value is not available or -1 on error
+ */
+int libscca_statistics_get_value(
+     libscca_statistics_t *statistics,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_statistics_get_value";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( statistic_type )
+	{
+		case LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ:
+			*value = statistics->number_of_bytes_read;
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_NUMBER_OF_DECOMPRESSED_BLOCKS:
+			*value = statistics->number_of_decompressed_blocks;
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_HITS:
+			if( statistics->number_of_block_lookups > statistics->number_of_block_reads )
+			{
+				*value = statistics->number_of_block_lookups - statistics->number_of_block_reads;
+			}
+			else
+			{
+				*value = 0;
+			}
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_MISSES:
+			*value = statistics->number_of_block_reads;
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_NUMBER_OF_ALLOCATIONS:
+			*value = statistics->number_of_allocations;
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_ALLOCATED_SIZE:
+			*value = statistics->allocated_size;
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_MAXIMUM_ALLOCATED_SIZE:
+			*value = statistics->maximum_allocated_size;
+			break;
+
+		case LIBSCCA_STATISTIC_TYPE_FILE_HEADER_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_FILE_INFORMATION_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_FILE_METRICS_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_FILENAMES_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_VOLUMES_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_COMPRESSED_HEADER_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_COMPRESSED_BLOCKS_READ_TIME:
+		case LIBSCCA_STATISTIC_TYPE_TRACE_CHAIN_READ_TIME:
+			if( statistics->has_section_read_times == 0 )
+			{
+				return( 0 );
+			}
+			*value = statistics->section_read_times[ statistic_type - LIBSCCA_STATISTIC_TYPE_FILE_HEADER_READ_TIME ];
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported statistic type: %d.",
+			 function,
+			 statistic_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,138 @@
+/*
+ * Parse statistics functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_STATISTICS_H )
+#define _LIBSCCA_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The statistics section definitions
+ * The sections are in the same order as the read time statistic types
+ */
+enum LIBSCCA_STATISTICS_SECTIONS
+{
+	LIBSCCA_STATISTICS_SECTION_FILE_HEADER		= 0,
+	LIBSCCA_STATISTICS_SECTION_FILE_INFORMATION	= 1,
+	LIBSCCA_STATISTICS_SECTION_FILE_METRICS		= 2,
+	LIBSCCA_STATISTICS_SECTION_FILENAMES		= 3,
+	LIBSCCA_STATISTICS_SECTION_VOLUMES		= 4,
+	LIBSCCA_STATISTICS_SECTION_COMPRESSED_HEADER	= 5,
+	LIBSCCA_STATISTICS_SECTION_COMPRESSED_BLOCKS	= 6,
+	LIBSCCA_STATISTICS_SECTION_TRACE_CHAIN		= 7
+};
+
+#define LIBSCCA_STATISTICS_NUMBER_OF_SECTIONS		8
+
+typedef struct libscca_statistics libscca_statistics_t;
+
+struct libscca_statistics
+{
+	/* The number of bytes read from the file IO handle
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of decompressed blocks
+	 */
+	uint64_t number_of_decompressed_blocks;
+
+	/* The number of compressed block lookups
+	 */
+	uint64_t number_of_block_lookups;
+
+	/* The number of compressed block reads, which are the lookups that missed the cache
+	 */
+	uint64_t number_of_block_reads;
+
+	/* The number of heap allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of bytes currently allocated
+	 */
+	uint64_t allocated_size;
+
+	/* The maximum number of bytes allocated at the same time
+	 */
+	uint64_t maximum_allocated_size;
+
+	/* The section read times in nano seconds
+	 */
+	uint64_t section_read_times[ LIBSCCA_STATISTICS_NUMBER_OF_SECTIONS ];
+
+	/* The timestamp the current section read time is measured from
+	 */
+	uint64_t timestamp;
+
+	/* Value to indicate the section read times were measured
+	 */
+	uint8_t has_section_read_times;
+
+	/* Value to indicate the section read times should be measured
+	 */
+	uint8_t measure_read_times;
+};
+
+int libscca_statistics_get_timestamp(
+     uint64_t *timestamp );
+
+int libscca_statistics_start_timer(
+     libscca_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int libscca_statistics_add_section_read_time(
+     libscca_statistics_t *statistics,
+     int section_index,
+     libcerror_error_t **error );
+
+int libscca_statistics_add_allocation(
+     libscca_statistics_t *statistics,
+     size_t allocation_size,
+     libcerror_error_t **error );
+
+int libscca_statistics_add_allocated_size(
+     libscca_statistics_t *statistics,
+     size_t allocation_size,
+     libcerror_error_t **error );
+
+int libscca_statistics_remove_allocated_size(
+     libscca_statistics_t *statistics,
+     size_t allocation_size,
+     libcerror_error_t **error );
+
+int libscca_statistics_get_value(
+     libscca_statistics_t *statistics,
+     int statistic_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_STATISTICS_H ) */
+
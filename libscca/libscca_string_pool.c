@@ -0,0 +1,871 @@
+/*
+ * Shared string pool functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_arena.h"
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+#include "libscca_string_pool.h"
+
+/* Creates a string pool
+ * Make sure the value string_pool is referencing, is set to NULL
+ * The string pool can be shared between files, see libscca_file_set_string_pool,
+ * and keeps every distinct filename and device path string once
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_string_pool_initialize(
+     libscca_string_pool_t **string_pool,
+     libcerror_error_t **error )
+{
+	libscca_internal_string_pool_t *internal_string_pool = NULL;
+	static char *function                                = "libscca_string_pool_initialize";
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_string_pool = memory_allocate_structure(
+	                        libscca_internal_string_pool_t );
+
+	if( internal_string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_string_pool,
+	     0,
+	     sizeof( libscca_internal_string_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string pool.",
+		 function );
+
+		memory_free(
+		 internal_string_pool );
+
+		return( -1 );
+	}
+	if( libscca_arena_initialize(
+	     &( internal_string_pool->arena ),
+	     LIBSCCA_ARENA_DEFAULT_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_string_pool_resize_buckets(
+	     internal_string_pool,
+	     LIBSCCA_STRING_POOL_MINIMUM_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_string_pool->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*string_pool = (libscca_string_pool_t *) internal_string_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_string_pool != NULL )
+	{
+		if( internal_string_pool->buckets != NULL )
+		{
+			memory_free(
+			 internal_string_pool->buckets );
+		}
+		if( internal_string_pool->arena != NULL )
+		{
+			libscca_arena_free(
+			 &( internal_string_pool->arena ),
+			 NULL );
+		}
+		memory_free(
+		 internal_string_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a string pool
+ * The string pool must not be freed while it is set for a file
+ * or while the files that were opened with it are open
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_string_pool_free(
+     libscca_string_pool_t **string_pool,
+     libcerror_error_t **error )
+{
+	libscca_internal_string_pool_t *internal_string_pool = NULL;
+	static char *function                                = "libscca_string_pool_free";
+	int result                                           = 1;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_pool != NULL )
+	{
+		internal_string_pool = (libscca_internal_string_pool_t *) *string_pool;
+		*string_pool         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_string_pool->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_string_pool->buckets != NULL )
+		{
+			memory_free(
+			 internal_string_pool->buckets );
+		}
+		if( internal_string_pool->entries != NULL )
+		{
+			memory_free(
+			 internal_string_pool->entries );
+		}
+		if( libscca_arena_free(
+		     &( internal_string_pool->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_string_pool );
+	}
+	return( result );
+}
+
+/* Retrieves the statistics of a string pool
+ * The number of hits is the number of strings that were shared instead of stored again
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_string_pool_get_statistics(
+     libscca_string_pool_t *string_pool,
+     int *number_of_strings,
+     size64_t *size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libscca_internal_string_pool_t *internal_string_pool = NULL;
+	static char *function                                = "libscca_string_pool_get_statistics";
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_string_pool = (libscca_internal_string_pool_t *) string_pool;
+
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_string_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_strings = (int) internal_string_pool->number_of_entries;
+	*size              = internal_string_pool->size;
+	*number_of_hits    = internal_string_pool->number_of_hits;
+	*number_of_misses  = internal_string_pool->number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_string_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Resizes the buckets of the string pool
+ * The entries are linked into the new buckets using their stored hash
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_string_pool_resize_buckets(
+     libscca_internal_string_pool_t *internal_string_pool,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	uint32_t *buckets     = NULL;
+	static char *function = "libscca_internal_string_pool_resize_buckets";
+	uint32_t bucket_index = 0;
+	uint32_t entry_index  = 0;
+
+	if( internal_string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets == 0 )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (uint32_t *) memory_allocate(
+	                        sizeof( uint32_t ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( uint32_t ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_string_pool->number_of_entries;
+	     entry_index++ )
+	{
+		bucket_index = (uint32_t) ( internal_string_pool->entries[ entry_index ].hash & ( number_of_buckets - 1 ) );
+
+		internal_string_pool->entries[ entry_index ].next_entry_index = buckets[ bucket_index ];
+
+		buckets[ bucket_index ] = entry_index + 1;
+	}
+	if( internal_string_pool->buckets != NULL )
+	{
+		memory_free(
+		 internal_string_pool->buckets );
+	}
+	internal_string_pool->buckets           = buckets;
+	internal_string_pool->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Finds an entry in the string pool
+ * The mutex must be grabbed by the caller
+ * Returns 1 if found or 0 if not
+ */
+int libscca_internal_string_pool_find_entry(
+     libscca_internal_string_pool_t *internal_string_pool,
+     uint64_t hash,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *string_identifier )
+{
+	libscca_string_pool_entry_t *entry = NULL;
+	uint32_t entry_index               = 0;
+
+	entry_index = internal_string_pool->buckets[ hash & ( internal_string_pool->number_of_buckets - 1 ) ];
+
+	while( entry_index != 0 )
+	{
+		entry = &( internal_string_pool->entries[ entry_index - 1 ] );
+
+		if( ( entry->hash == hash )
+		 && ( (size_t) entry->data_size == data_size )
+		 && ( memory_compare(
+		       entry->data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			*string_identifier = entry_index - 1;
+
+			return( 1 );
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Appends an entry to the string pool
+ * The string data is copied into the arena
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_string_pool_append_entry(
+     libscca_internal_string_pool_t *internal_string_pool,
+     uint64_t hash,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	libscca_string_pool_entry_t *entries = NULL;
+	libscca_string_pool_entry_t *entry   = NULL;
+	uint8_t *entry_data                  = NULL;
+	static char *function                = "libscca_internal_string_pool_append_entry";
+	uint32_t bucket_index                = 0;
+	uint32_t number_of_allocated_entries = 0;
+
+	if( internal_string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_string_pool->number_of_entries >= internal_string_pool->number_of_allocated_entries )
+	{
+		if( internal_string_pool->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBSCCA_STRING_POOL_MINIMUM_NUMBER_OF_BUCKETS;
+		}
+		else
+		{
+			number_of_allocated_entries = internal_string_pool->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_allocated_entries <= internal_string_pool->number_of_allocated_entries )
+		 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libscca_string_pool_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libscca_string_pool_entry_t *) memory_reallocate(
+		                                           internal_string_pool->entries,
+		                                           sizeof( libscca_string_pool_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_string_pool->entries                     = entries;
+		internal_string_pool->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	/* Keep the average bucket chain shorter than 1 entry
+	 */
+	if( internal_string_pool->number_of_entries >= internal_string_pool->number_of_buckets )
+	{
+		if( libscca_internal_string_pool_resize_buckets(
+		     internal_string_pool,
+		     internal_string_pool->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data_size > 0 )
+	{
+		if( libscca_arena_allocate(
+		     internal_string_pool->arena,
+		     data_size,
+		     &entry_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate entry data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     entry_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (uint32_t) ( hash & ( internal_string_pool->number_of_buckets - 1 ) );
+
+	entry = &( internal_string_pool->entries[ internal_string_pool->number_of_entries ] );
+
+	entry->hash             = hash;
+	entry->data             = entry_data;
+	entry->data_size        = (uint32_t) data_size;
+	entry->next_entry_index = internal_string_pool->buckets[ bucket_index ];
+
+	*string_identifier = internal_string_pool->number_of_entries;
+
+	internal_string_pool->number_of_entries += 1;
+
+	internal_string_pool->buckets[ bucket_index ] = internal_string_pool->number_of_entries;
+
+	internal_string_pool->size += data_size;
+
+	return( 1 );
+}
+
+/* Interns a string in the string pool
+ * The string data is compared byte for byte, a string that is already
+ * in the pool is not stored again and retains its identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_string_pool_intern_string(
+     libscca_string_pool_t *string_pool,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error )
+{
+	libscca_internal_string_pool_t *internal_string_pool = NULL;
+	static char *function                                = "libscca_string_pool_intern_string";
+	uint64_t hash                                        = 0;
+	int result                                           = 0;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_string_pool = (libscca_internal_string_pool_t *) string_pool;
+
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string identifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash is calculated before the mutex is grabbed
+	 */
+	if( data_size > 0 )
+	{
+		if( libscca_hash_calculate_xxh64(
+		     data,
+		     data_size,
+		     0,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_string_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_internal_string_pool_find_entry(
+	          internal_string_pool,
+	          hash,
+	          data,
+	          data_size,
+	          string_identifier );
+
+	if( result != 0 )
+	{
+		internal_string_pool->number_of_hits += 1;
+	}
+	else
+	{
+		result = libscca_internal_string_pool_append_entry(
+		          internal_string_pool,
+		          hash,
+		          data,
+		          data_size,
+		          string_identifier,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry.",
+			 function );
+		}
+		else
+		{
+			internal_string_pool->number_of_misses += 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_string_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data of a specific string in the string pool
+ * The data is referenced and not copied, it remains valid until the string pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_string_pool_get_string(
+     libscca_string_pool_t *string_pool,
+     uint32_t string_identifier,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_string_pool_t *internal_string_pool = NULL;
+	static char *function                                = "libscca_string_pool_get_string";
+	int result                                           = 1;
+
+	if( string_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_string_pool = (libscca_internal_string_pool_t *) string_pool;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The entries can be reallocated while another file interns a string
+	 */
+	if( libcthreads_mutex_grab(
+	     internal_string_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( string_identifier >= internal_string_pool->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string identifier value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*data      = internal_string_pool->entries[ string_identifier ].data;
+		*data_size = (size_t) internal_string_pool->entries[ string_identifier ].data_size;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_string_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,170 @@
+/*
+ * Shared string pool functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_STRING_POOL_H )
+#define _LIBSCCA_STRING_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_arena.h"
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of buckets of the string pool, which must be a power of 2
+ */
+#define LIBSCCA_STRING_POOL_MINIMUM_NUMBER_OF_BUCKETS	1024
+
+typedef struct libscca_string_pool_entry libscca_string_pool_entry_t;
+
+struct libscca_string_pool_entry
+{
+	/* The XXH64 hash of the string data
+	 */
+	uint64_t hash;
+
+	/* The string data, which is stored in the arena
+	 */
+	const uint8_t *data;
+
+	/* The string data size
+	 */
+	uint32_t data_size;
+
+	/* The index of the next entry in the same bucket + 1 or 0 if not set
+	 */
+	uint32_t next_entry_index;
+};
+
+typedef struct libscca_internal_string_pool libscca_internal_string_pool_t;
+
+struct libscca_internal_string_pool
+{
+	/* The arena that contains the string data
+	 * The string data is never moved hence it can be referenced until the string pool is freed
+	 */
+	libscca_arena_t *arena;
+
+	/* The entries, where the string identifier is the index of the entry
+	 */
+	libscca_string_pool_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	uint32_t number_of_allocated_entries;
+
+	/* The buckets, which contain the index of the first entry + 1 or 0 if not set
+	 */
+	uint32_t *buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The size of the string data
+	 */
+	size64_t size;
+
+	/* The number of strings that were already in the pool
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of strings that were added to the pool
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The string pool is shared between files, which can be read on different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_string_pool_initialize(
+     libscca_string_pool_t **string_pool,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_string_pool_free(
+     libscca_string_pool_t **string_pool,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_string_pool_get_statistics(
+     libscca_string_pool_t *string_pool,
+     int *number_of_strings,
+     size64_t *size,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int libscca_internal_string_pool_resize_buckets(
+     libscca_internal_string_pool_t *internal_string_pool,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error );
+
+int libscca_internal_string_pool_find_entry(
+     libscca_internal_string_pool_t *internal_string_pool,
+     uint64_t hash,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *string_identifier );
+
+int libscca_internal_string_pool_append_entry(
+     libscca_internal_string_pool_t *internal_string_pool,
+     uint64_t hash,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
+int libscca_string_pool_intern_string(
+     libscca_string_pool_t *string_pool,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *string_identifier,
+     libcerror_error_t **error );
+
+int libscca_string_pool_get_string(
+     libscca_string_pool_t *string_pool,
+     uint32_t string_identifier,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_STRING_POOL_H ) */
+
@@ -20,19 +20,26 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
+#include "libscca_bloom_filter.h"
 #include "libscca_codepage.h"
 #include "libscca_definitions.h"
+#include "libscca_hash.h"
 #include "libscca_io_handle.h"
 #include "libscca_libbfio.h"
 #include "libscca_libcerror.h"
 #include "libscca_libclocale.h"
+#include "libscca_memory.h"
 #include "libscca_support.h"
 
+#include "scca_file_header.h"
+#include "scca_snapshot_header.h"
+
 #if !defined( HAVE_LOCAL_LIBSCCA )
 
 /* Returns the library version
@@ -105,6 +112,79 @@ int libscca_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBSCCA ) */
 
+/* Sets the allocation functions that are used for all libscca allocations
+ * The user data is passed to every allocation function
+ * Either all functions must be set or none, where none restores the default allocation functions
+ * The allocation functions are not locked, hence they should only be set before any libscca value
+ * is created or after all of them have been freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_set_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *buffer,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+             void *buffer,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_set_allocator";
+
+	if( libscca_memory_set_functions(
+	     allocate_function,
+	     reallocate_function,
+	     free_function,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set allocation functions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the memory pressure function
+ * The function is called with the size of the allocation when an allocation fails
+ * and returns 1 if memory was released, after which the allocation is retried once
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_set_memory_pressure_function(
+     int (*pressure_function)(
+            size_t size,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_set_memory_pressure_function";
+
+	if( libscca_memory_set_pressure_function(
+	     pressure_function,
+	     user_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory pressure function.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Determines if a file contains a SCCA file signature
  * Returns 1 if true, 0 if not or -1 on error
  */
@@ -330,7 +410,10 @@ int libscca_check_file_signature_file_io_handle(
 
 	static char *function      = "libscca_check_file_signature_file_io_handle";
 	ssize_t read_count         = 0;
+	uint32_t file_size         = 0;
 	int file_io_handle_is_open = -1;
+	int file_type              = 0;
+	int result                 = 0;
 
 	if( file_io_handle == NULL )
 	{
@@ -423,21 +506,25 @@ int libscca_check_file_signature_file_io_handle(
 			goto on_error;
 		}
 	}
-	if( memory_compare(
-	     scca_file_signature,
-	     &( signature[ 4 ] ),
-	     4 ) == 0 )
-	{
-		return( 1 );
-	}
-	else if( memory_compare(
-	          scca_mam_file_signature_win10,
+	result = libscca_check_signature_buffer(
 	          signature,
-	          4 ) == 0 )
+	          8,
+	          &file_type,
+	          &file_size,
+	          error );
+
+	if( result == -1 )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check signature.",
+		 function );
+
+		return( -1 );
 	}
-	return( 0 );
+	return( result );
 
 on_error:
 	if( file_io_handle_is_open == 0 )
@@ -449,3 +536,967 @@ on_error:
 	return( -1 );
 }
 
+/* Determines if a file contains a SCCA file header
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libscca_check_file_header(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libscca_check_file_header";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_check_file_header_file_io_handle(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check file header using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines if a file contains a SCCA file header
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libscca_check_file_header_wide(
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libscca_check_file_header_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_check_file_header_file_io_handle(
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check file header using a file handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determines if a file contains a SCCA file header using a Basic File IO (bfio) handle
+ * The file header is read with a single read
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libscca_check_file_header_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( scca_file_header_t ) ];
+
+	static char *function      = "libscca_check_file_header_file_io_handle";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = -1;
+	int result                 = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* A file that is too small to contain a file header is not read
+	 */
+	if( file_size >= 8 )
+	{
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     0,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: 0.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              file_header_data,
+		              sizeof( scca_file_header_t ),
+		              error );
+
+		if( read_count < 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file header data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( read_count > 0 )
+	{
+		result = libscca_check_file_header_data(
+		          file_header_data,
+		          (size_t) read_count,
+		          file_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check file header data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if data contains a SCCA file header
+ * The data should contain the start of the file, at least 16 bytes for an uncompressed
+ * and 8 bytes for a compressed file, the file size is 0 if not known
+ * The header values are checked against the same constraints used when opening a file
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libscca_check_file_header_data(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libscca_check_file_header_data";
+	uint32_t format_version         = 0;
+	uint32_t header_file_size       = 0;
+	uint32_t uncompressed_data_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     data,
+	     scca_mam_file_signature_win10,
+	     4 ) == 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 uncompressed_data_size );
+
+		if( ( uncompressed_data_size < sizeof( scca_file_header_t ) )
+		 || ( uncompressed_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			return( 0 );
+		}
+		/* A compressed file without compressed data is truncated
+		 */
+		if( ( file_size != 0 )
+		 && ( file_size <= 8 ) )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( data_size < 16 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (scca_file_header_t *) data )->signature,
+	     scca_file_signature,
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_header_t *) data )->file_size,
+	 header_file_size );
+
+	if( ( format_version != 17 )
+	 && ( format_version != 23 )
+	 && ( format_version != 26 )
+	 && ( format_version != 30 ) )
+	{
+		return( 0 );
+	}
+	if( header_file_size < sizeof( scca_file_header_t ) )
+	{
+		return( 0 );
+	}
+	/* A file that is smaller than the file size in the file header is truncated
+	 */
+	if( ( file_size != 0 )
+	 && ( file_size < (size64_t) header_file_size ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if a buffer contains a SCCA file signature
+ * The buffer should contain the start of the file, no memory is allocated
+ * The file type is set to LIBSCCA_FILE_TYPE_UNCOMPRESSED or LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10
+ * and the file size is set to the file size in the file header or, for a compressed file,
+ * to the uncompressed data size. The file size is 0 if the buffer is too small to contain it
+ * Returns 1 if true, 0 if not or -1 on error
+ */
+int libscca_check_signature_buffer(
+     const uint8_t *data,
+     size_t data_size,
+     int *file_type,
+     uint32_t *file_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_check_signature_buffer";
+	uint32_t signature    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file type.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	*file_type = 0;
+	*file_size = 0;
+
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	/* The signatures are compared as 32-bit values instead of byte by byte,
+	 * the compressed signature is checked first since the uncompressed data size
+	 * of a compressed file is stored where the uncompressed signature would be
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 signature );
+
+	if( signature == LIBSCCA_SIGNATURE_COMPRESSED_WINDOWS10 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 4 ] ),
+		 *file_size );
+
+		*file_type = LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10;
+
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 signature );
+
+	if( signature == LIBSCCA_SIGNATURE_UNCOMPRESSED )
+	{
+		if( data_size >= 16 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (scca_file_header_t *) data )->file_size,
+			 *file_size );
+		}
+		*file_type = LIBSCCA_FILE_TYPE_UNCOMPRESSED;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Determines if multiple buffers contain a SCCA file signature
+ * The file type of a buffer without a signature is set to 0,
+ * see libscca_check_signature_buffer for the file types and file sizes
+ * The number of file types and file sizes must be equal to or greater than the number of buffers
+ * Returns the number of buffers that contain a signature or -1 on error
+ */
+int libscca_check_signature_buffers(
+     const uint8_t * const buffers[],
+     const size_t buffer_sizes[],
+     int number_of_buffers,
+     int *file_types,
+     uint32_t *file_sizes,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_check_signature_buffers";
+	int buffer_index           = 0;
+	int number_of_signatures   = 0;
+	int result                 = 0;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_buffers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of buffers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file types.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		result = libscca_check_signature_buffer(
+		          buffers[ buffer_index ],
+		          buffer_sizes[ buffer_index ],
+		          &( file_types[ buffer_index ] ),
+		          &( file_sizes[ buffer_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check signature of buffer: %d.",
+			 function,
+			 buffer_index );
+
+			return( -1 );
+		}
+		number_of_signatures += result;
+	}
+	return( number_of_signatures );
+}
+
+/* Retrieves the filename Bloom filter of snapshot data
+ * The snapshot header and the bounds and checksum of the Bloom filter are validated
+ * Returns 1 if successful, 0 if the snapshot data has no Bloom filter or -1 on error
+ */
+int libscca_snapshot_get_bloom_filter(
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     const uint8_t **bloom_filter,
+     size_t *bloom_filter_size,
+     uint32_t *number_of_hashes,
+     libcerror_error_t **error )
+{
+	scca_snapshot_header_t *snapshot_header = NULL;
+	static char *function                   = "libscca_snapshot_get_bloom_filter";
+	uint64_t calculated_checksum            = 0;
+	uint64_t data_size                      = 0;
+	uint64_t stored_checksum                = 0;
+	uint32_t data_offset                    = 0;
+	uint32_t snapshot_format_version        = 0;
+	uint32_t stored_bloom_filter_offset     = 0;
+	uint32_t stored_bloom_filter_size       = 0;
+	uint32_t stored_number_of_hashes        = 0;
+
+	if( snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( snapshot_data_size < sizeof( scca_snapshot_header_t ) )
+	 || ( snapshot_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( bloom_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( bloom_filter_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Bloom filter size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hashes.",
+		 function );
+
+		return( -1 );
+	}
+	snapshot_header = (scca_snapshot_header_t *) snapshot_data;
+
+	if( memory_compare(
+	     snapshot_header->signature,
+	     "SCCASNAP",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported snapshot signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->snapshot_format_version,
+	 snapshot_format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->data_offset,
+	 data_offset );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 snapshot_header->data_size,
+	 data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->bloom_filter_offset,
+	 stored_bloom_filter_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->bloom_filter_size,
+	 stored_bloom_filter_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 snapshot_header->bloom_filter_checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 snapshot_header->bloom_filter_number_of_hashes,
+	 stored_number_of_hashes );
+
+	if( snapshot_format_version != LIBSCCA_SNAPSHOT_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported snapshot format version: %" PRIu32 ".",
+		 function,
+		 snapshot_format_version );
+
+		return( -1 );
+	}
+	/* Snapshot data without a Bloom filter has the Bloom filter values set to 0
+	 */
+	if( stored_bloom_filter_offset == 0 )
+	{
+		*bloom_filter      = NULL;
+		*bloom_filter_size = 0;
+		*number_of_hashes  = 0;
+
+		return( 0 );
+	}
+	if( ( (uint64_t) stored_bloom_filter_offset < ( (uint64_t) data_offset + data_size ) )
+	 || ( (size_t) stored_bloom_filter_offset > snapshot_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot Bloom filter offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stored_bloom_filter_size == 0 )
+	 || ( (size_t) stored_bloom_filter_size > ( snapshot_data_size - stored_bloom_filter_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot Bloom filter size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stored_number_of_hashes == 0 )
+	 || ( stored_number_of_hashes > LIBSCCA_BLOOM_FILTER_MAXIMUM_NUMBER_OF_HASHES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot Bloom filter number of hashes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     &( snapshot_data[ stored_bloom_filter_offset ] ),
+	     (size_t) stored_bloom_filter_size,
+	     0,
+	     &calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate snapshot Bloom filter checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( calculated_checksum != stored_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in snapshot Bloom filter checksum ( 0x%08" PRIx64 " != 0x%08" PRIx64 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	*bloom_filter      = &( snapshot_data[ stored_bloom_filter_offset ] );
+	*bloom_filter_size = (size_t) stored_bloom_filter_size;
+	*number_of_hashes  = stored_number_of_hashes;
+
+	return( 1 );
+}
+
+/* Determines if the file in snapshot data possibly contains a filename with a specific case folded hash
+ * The case folded hash can be calculated using libscca_compute_case_folded_hash
+ * Only the filename Bloom filter of the snapshot data is used, the file is not opened,
+ * hence 1 is returned for snapshot data without a Bloom filter
+ * Returns 1 if a filename is possibly contained, 0 if not or -1 on error
+ */
+int libscca_snapshot_may_contain_filename_hash(
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     uint64_t case_folded_hash,
+     libcerror_error_t **error )
+{
+	const uint8_t *bloom_filter = NULL;
+	static char *function       = "libscca_snapshot_may_contain_filename_hash";
+	size_t bloom_filter_size    = 0;
+	uint32_t number_of_hashes   = 0;
+	int result                  = 0;
+
+	result = libscca_snapshot_get_bloom_filter(
+	          snapshot_data,
+	          snapshot_data_size,
+	          &bloom_filter,
+	          &bloom_filter_size,
+	          &number_of_hashes,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot Bloom filter.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	result = libscca_bloom_filter_contains_hash(
+	          bloom_filter,
+	          bloom_filter_size,
+	          number_of_hashes,
+	          case_folded_hash,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if Bloom filter contains hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -33,6 +33,13 @@
 extern "C" {
 #endif
 
+/* The file signatures as 32-bit little-endian values
+ * The uncompressed signature "SCCA" is stored at offset 4 and
+ * the compressed signature "MAM\x04" at offset 0
+ */
+#define LIBSCCA_SIGNATURE_UNCOMPRESSED			0x41434353UL
+#define LIBSCCA_SIGNATURE_COMPRESSED_WINDOWS10		0x044d414dUL
+
 #if !defined( HAVE_LOCAL_LIBSCCA )
 
 LIBSCCA_EXTERN \
@@ -55,6 +62,29 @@ int libscca_set_codepage(
 
 #endif /* !defined( HAVE_LOCAL_LIBSCCA ) */
 
+LIBSCCA_EXTERN \
+int libscca_set_allocator(
+     void *(*allocate_function)(
+              size_t size,
+              void *user_data ),
+     void *(*reallocate_function)(
+              void *buffer,
+              size_t size,
+              void *user_data ),
+     void (*free_function)(
+             void *buffer,
+             void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_set_memory_pressure_function(
+     int (*pressure_function)(
+            size_t size,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_check_file_signature(
      const char *filename,
@@ -74,6 +104,64 @@ int libscca_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_check_file_header(
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSCCA_EXTERN \
+int libscca_check_file_header_wide(
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSCCA_EXTERN \
+int libscca_check_file_header_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_check_file_header_data(
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_check_signature_buffer(
+     const uint8_t *data,
+     size_t data_size,
+     int *file_type,
+     uint32_t *file_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_check_signature_buffers(
+     const uint8_t * const buffers[],
+     const size_t buffer_sizes[],
+     int number_of_buffers,
+     int *file_types,
+     uint32_t *file_sizes,
+     libcerror_error_t **error );
+
+int libscca_snapshot_get_bloom_filter(
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     const uint8_t **bloom_filter,
+     size_t *bloom_filter_size,
+     uint32_t *number_of_hashes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_snapshot_may_contain_filename_hash(
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     uint64_t case_folded_hash,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
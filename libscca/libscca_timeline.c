@@ -0,0 +1,745 @@
+/*
+ * Timeline functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_file.h"
+#include "libscca_libcerror.h"
+#include "libscca_memory.h"
+#include "libscca_timeline.h"
+
+/* Creates a timeline
+ * Make sure the value timeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_timeline_initialize(
+     libscca_timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libscca_timeline_initialize";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = memory_allocate_structure(
+	                     libscca_internal_timeline_t );
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_timeline,
+	     0,
+	     sizeof( libscca_internal_timeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timeline.",
+		 function );
+
+		memory_free(
+		 internal_timeline );
+
+		return( -1 );
+	}
+	*timeline = (libscca_timeline_t *) internal_timeline;
+
+	return( 1 );
+}
+
+/* Frees a timeline
+ * The files of the timeline are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_timeline_free(
+     libscca_timeline_t **timeline,
+     libcerror_error_t **error )
+{
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libscca_timeline_free";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timeline != NULL )
+	{
+		internal_timeline = (libscca_internal_timeline_t *) *timeline;
+		*timeline         = NULL;
+
+		if( internal_timeline->inputs != NULL )
+		{
+			memory_free(
+			 internal_timeline->inputs );
+		}
+		if( internal_timeline->heap != NULL )
+		{
+			memory_free(
+			 internal_timeline->heap );
+		}
+		memory_free(
+		 internal_timeline );
+	}
+	return( 1 );
+}
+
+/* Appends an input
+ * The last run times are indexed by run slot, where a value of 0 means the last run time is not set
+ * The input is added to the heap if it contains a last run time that is set
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_timeline_append_input(
+     libscca_internal_timeline_t *internal_timeline,
+     libscca_file_t *file,
+     const uint64_t *last_run_times,
+     int number_of_last_run_times,
+     libcerror_error_t **error )
+{
+	libscca_timeline_input_t *input  = NULL;
+	libscca_timeline_input_t *inputs = NULL;
+	static char *function            = "libscca_internal_timeline_append_input";
+	size_t heap_size                 = 0;
+	size_t inputs_size               = 0;
+	uint64_t filetime                = 0;
+	int *heap                        = NULL;
+	int filetime_index               = 0;
+	int number_of_inputs             = 0;
+	int run_slot                     = 0;
+
+	if( internal_timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_run_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last run times.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_last_run_times < 0 )
+	 || ( number_of_last_run_times > LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of last run times value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline->number_of_inputs >= internal_timeline->number_of_allocated_inputs )
+	{
+		number_of_inputs = internal_timeline->number_of_allocated_inputs;
+
+		if( number_of_inputs == 0 )
+		{
+			number_of_inputs = 16;
+		}
+		else if( number_of_inputs > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of inputs value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_inputs *= 2;
+		}
+		inputs_size = sizeof( libscca_timeline_input_t ) * (size_t) number_of_inputs;
+
+		if( inputs_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid inputs size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		heap_size = sizeof( int ) * (size_t) number_of_inputs;
+
+		inputs = (libscca_timeline_input_t *) memory_reallocate(
+		                                       internal_timeline->inputs,
+		                                       inputs_size );
+
+		if( inputs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inputs.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timeline->inputs = inputs;
+
+		heap = (int *) memory_reallocate(
+		                internal_timeline->heap,
+		                heap_size );
+
+		if( heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize heap.",
+			 function );
+
+			return( -1 );
+		}
+		internal_timeline->heap                       = heap;
+		internal_timeline->number_of_allocated_inputs = number_of_inputs;
+	}
+	input = &( ( internal_timeline->inputs )[ internal_timeline->number_of_inputs ] );
+
+	input->file                = file;
+	input->number_of_filetimes = 0;
+	input->filetime_index      = 0;
+
+	/* The last run times are sorted by an insertion sort on filetime and run slot
+	 * since a file contains at most 8 of them
+	 */
+	for( run_slot = 0;
+	     run_slot < number_of_last_run_times;
+	     run_slot++ )
+	{
+		filetime = last_run_times[ run_slot ];
+
+		if( filetime == 0 )
+		{
+			continue;
+		}
+		filetime_index = (int) input->number_of_filetimes;
+
+		while( ( filetime_index > 0 )
+		    && ( input->filetimes[ filetime_index - 1 ] > filetime ) )
+		{
+			input->filetimes[ filetime_index ] = input->filetimes[ filetime_index - 1 ];
+			input->run_slots[ filetime_index ] = input->run_slots[ filetime_index - 1 ];
+
+			filetime_index--;
+		}
+		input->filetimes[ filetime_index ] = filetime;
+		input->run_slots[ filetime_index ] = (uint8_t) run_slot;
+
+		input->number_of_filetimes += 1;
+	}
+	if( input->number_of_filetimes > 0 )
+	{
+		internal_timeline->heap[ internal_timeline->heap_size ] = internal_timeline->number_of_inputs;
+
+		internal_timeline->heap_size += 1;
+
+		libscca_internal_timeline_heap_sift_up(
+		 internal_timeline,
+		 internal_timeline->heap_size - 1 );
+	}
+	internal_timeline->number_of_inputs += 1;
+
+	return( 1 );
+}
+
+/* Compares the current filetimes of two inputs
+ * Inputs with the same filetime are ordered by input index
+ * Returns a negative value if the first input sorts before the second, a positive value otherwise
+ */
+int libscca_internal_timeline_compare_inputs(
+     libscca_internal_timeline_t *internal_timeline,
+     int first_input_index,
+     int second_input_index )
+{
+	libscca_timeline_input_t *first_input  = NULL;
+	libscca_timeline_input_t *second_input = NULL;
+	uint64_t first_filetime                = 0;
+	uint64_t second_filetime               = 0;
+
+	first_input  = &( ( internal_timeline->inputs )[ first_input_index ] );
+	second_input = &( ( internal_timeline->inputs )[ second_input_index ] );
+
+	first_filetime  = first_input->filetimes[ first_input->filetime_index ];
+	second_filetime = second_input->filetimes[ second_input->filetime_index ];
+
+	if( first_filetime < second_filetime )
+	{
+		return( -1 );
+	}
+	else if( first_filetime > second_filetime )
+	{
+		return( 1 );
+	}
+	return( first_input_index - second_input_index );
+}
+
+/* Moves the input index at the heap index up until the heap is ordered
+ */
+void libscca_internal_timeline_heap_sift_up(
+      libscca_internal_timeline_t *internal_timeline,
+      int heap_index )
+{
+	int parent_index = 0;
+	int swap_value   = 0;
+
+	while( heap_index > 0 )
+	{
+		parent_index = ( heap_index - 1 ) / 2;
+
+		if( libscca_internal_timeline_compare_inputs(
+		     internal_timeline,
+		     internal_timeline->heap[ heap_index ],
+		     internal_timeline->heap[ parent_index ] ) >= 0 )
+		{
+			break;
+		}
+		swap_value                              = internal_timeline->heap[ heap_index ];
+		internal_timeline->heap[ heap_index ]   = internal_timeline->heap[ parent_index ];
+		internal_timeline->heap[ parent_index ] = swap_value;
+
+		heap_index = parent_index;
+	}
+}
+
+/* Moves the input index at the heap index down until the heap is ordered
+ */
+void libscca_internal_timeline_heap_sift_down(
+      libscca_internal_timeline_t *internal_timeline,
+      int heap_index )
+{
+	int child_index    = 0;
+	int smallest_index = 0;
+	int swap_value     = 0;
+
+	while( heap_index < internal_timeline->heap_size )
+	{
+		smallest_index = heap_index;
+		child_index    = ( heap_index * 2 ) + 1;
+
+		if( ( child_index < internal_timeline->heap_size )
+		 && ( libscca_internal_timeline_compare_inputs(
+		       internal_timeline,
+		       internal_timeline->heap[ child_index ],
+		       internal_timeline->heap[ smallest_index ] ) < 0 ) )
+		{
+			smallest_index = child_index;
+		}
+		child_index += 1;
+
+		if( ( child_index < internal_timeline->heap_size )
+		 && ( libscca_internal_timeline_compare_inputs(
+		       internal_timeline,
+		       internal_timeline->heap[ child_index ],
+		       internal_timeline->heap[ smallest_index ] ) < 0 ) )
+		{
+			smallest_index = child_index;
+		}
+		if( smallest_index == heap_index )
+		{
+			break;
+		}
+		swap_value                                = internal_timeline->heap[ heap_index ];
+		internal_timeline->heap[ heap_index ]     = internal_timeline->heap[ smallest_index ];
+		internal_timeline->heap[ smallest_index ] = swap_value;
+
+		heap_index = smallest_index;
+	}
+}
+
+/* Appends a file
+ * The file can also be opened from a snapshot, see libscca_file_open_snapshot
+ * The file is referenced and not managed by the timeline, and must remain
+ * open as long as the timeline is used
+ * Files should be appended before the first event is retrieved, events of a file
+ * that is appended later that are older than the last retrieved event are out of order
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_timeline_append_file(
+     libscca_timeline_t *timeline,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	libscca_internal_file_t *internal_file = NULL;
+	static char *function                  = "libscca_timeline_append_file";
+	int number_of_last_run_times           = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libscca_internal_file_t *) file;
+
+	if( ( internal_file == NULL )
+	 || ( internal_file->io_handle == NULL )
+	 || ( internal_file->file_information == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Format versions before 26 only store a single last run time
+	 */
+	if( internal_file->io_handle->format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES;
+	}
+	if( libscca_internal_timeline_append_input(
+	     (libscca_internal_timeline_t *) timeline,
+	     file,
+	     internal_file->file_information->last_run_time,
+	     number_of_last_run_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append input.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_timeline_get_number_of_files(
+     libscca_timeline_t *timeline,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libscca_timeline_get_number_of_files";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libscca_internal_timeline_t *) timeline;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = internal_timeline->number_of_inputs;
+
+	return( 1 );
+}
+
+/* Retrieves a specific file
+ * The file is referenced by the timeline and should not be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_timeline_get_file(
+     libscca_timeline_t *timeline,
+     int file_index,
+     libscca_file_t **file,
+     libcerror_error_t **error )
+{
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libscca_timeline_get_file";
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libscca_internal_timeline_t *) timeline;
+
+	if( ( file_index < 0 )
+	 || ( file_index >= internal_timeline->number_of_inputs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	*file = ( internal_timeline->inputs )[ file_index ].file;
+
+	return( 1 );
+}
+
+/* Resets the timeline so that the events are retrieved again from the oldest event
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_timeline_reset(
+     libscca_timeline_t *timeline,
+     libcerror_error_t **error )
+{
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	static char *function                          = "libscca_timeline_reset";
+	int heap_index                                 = 0;
+	int input_index                                = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libscca_internal_timeline_t *) timeline;
+
+	internal_timeline->heap_size = 0;
+
+	for( input_index = 0;
+	     input_index < internal_timeline->number_of_inputs;
+	     input_index++ )
+	{
+		( internal_timeline->inputs )[ input_index ].filetime_index = 0;
+
+		if( ( internal_timeline->inputs )[ input_index ].number_of_filetimes > 0 )
+		{
+			internal_timeline->heap[ internal_timeline->heap_size ] = input_index;
+
+			internal_timeline->heap_size += 1;
+		}
+	}
+	for( heap_index = ( internal_timeline->heap_size / 2 ) - 1;
+	     heap_index >= 0;
+	     heap_index-- )
+	{
+		libscca_internal_timeline_heap_sift_down(
+		 internal_timeline,
+		 heap_index );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next event
+ * The events of all files are retrieved in order of their last run time, from oldest
+ * to most recent, where events with the same last run time are ordered by file index
+ * and run slot. The run slot is the last run time index of the event in the file,
+ * see libscca_file_get_last_run_time
+ * Returns 1 if successful, 0 if no more events are available or -1 on error
+ */
+int libscca_timeline_get_next_event(
+     libscca_timeline_t *timeline,
+     uint64_t *filetime,
+     int *file_index,
+     int *run_slot,
+     libcerror_error_t **error )
+{
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	libscca_timeline_input_t *input                = NULL;
+	static char *function                          = "libscca_timeline_get_next_event";
+	int input_index                                = 0;
+
+	if( timeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timeline.",
+		 function );
+
+		return( -1 );
+	}
+	internal_timeline = (libscca_internal_timeline_t *) timeline;
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_timeline->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	input_index = internal_timeline->heap[ 0 ];
+	input       = &( ( internal_timeline->inputs )[ input_index ] );
+
+	*filetime   = input->filetimes[ input->filetime_index ];
+	*file_index = input_index;
+	*run_slot   = (int) input->run_slots[ input->filetime_index ];
+
+	input->filetime_index += 1;
+
+	if( input->filetime_index >= input->number_of_filetimes )
+	{
+		internal_timeline->heap_size -= 1;
+
+		internal_timeline->heap[ 0 ] = internal_timeline->heap[ internal_timeline->heap_size ];
+	}
+	libscca_internal_timeline_heap_sift_down(
+	 internal_timeline,
+	 0 );
+
+	return( 1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Timeline functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_TIMELINE_H )
+#define _LIBSCCA_TIMELINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_timeline_input libscca_timeline_input_t;
+
+struct libscca_timeline_input
+{
+	/* The file
+	 * The file is referenced and not managed by the timeline
+	 */
+	libscca_file_t *file;
+
+	/* The last run times that are set, sorted from oldest to most recent
+	 */
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	/* The run slots, which are the last run time indexes of the filetimes
+	 */
+	uint8_t run_slots[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	/* The number of filetimes
+	 */
+	uint8_t number_of_filetimes;
+
+	/* The index of the current filetime
+	 */
+	uint8_t filetime_index;
+};
+
+typedef struct libscca_internal_timeline libscca_internal_timeline_t;
+
+struct libscca_internal_timeline
+{
+	/* The inputs
+	 */
+	libscca_timeline_input_t *inputs;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+
+	/* The number of allocated inputs
+	 */
+	int number_of_allocated_inputs;
+
+	/* The input indexes ordered as a binary min heap on the current filetime
+	 */
+	int *heap;
+
+	/* The number of input indexes in the heap
+	 */
+	int heap_size;
+};
+
+LIBSCCA_EXTERN \
+int libscca_timeline_initialize(
+     libscca_timeline_t **timeline,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_timeline_free(
+     libscca_timeline_t **timeline,
+     libcerror_error_t **error );
+
+int libscca_internal_timeline_append_input(
+     libscca_internal_timeline_t *internal_timeline,
+     libscca_file_t *file,
+     const uint64_t *last_run_times,
+     int number_of_last_run_times,
+     libcerror_error_t **error );
+
+int libscca_internal_timeline_compare_inputs(
+     libscca_internal_timeline_t *internal_timeline,
+     int first_input_index,
+     int second_input_index );
+
+void libscca_internal_timeline_heap_sift_up(
+      libscca_internal_timeline_t *internal_timeline,
+      int heap_index );
+
+void libscca_internal_timeline_heap_sift_down(
+      libscca_internal_timeline_t *internal_timeline,
+      int heap_index );
+
+LIBSCCA_EXTERN \
+int libscca_timeline_append_file(
+     libscca_timeline_t *timeline,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_timeline_get_number_of_files(
+     libscca_timeline_t *timeline,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_timeline_get_file(
+     libscca_timeline_t *timeline,
+     int file_index,
+     libscca_file_t **file,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_timeline_reset(
+     libscca_timeline_t *timeline,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_timeline_get_next_event(
+     libscca_timeline_t *timeline,
+     uint64_t *filetime,
+     int *file_index,
+     int *run_slot,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_TIMELINE_H ) */
+
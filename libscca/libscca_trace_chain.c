@@ -0,0 +1,1253 @@
+/*
+ * Trace chain functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_budget.h"
+#include "libscca_cpu.h"
+#include "libscca_format_layout.h"
+#include "libscca_io_handle.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcnotify.h"
+#include "libscca_libfdata.h"
+#include "libscca_memory.h"
+#include "libscca_statistics.h"
+#include "libscca_trace_chain.h"
+
+#include "scca_trace_chain_array.h"
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+#include <immintrin.h>
+
+#elif defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+#include <arm_neon.h>
+
+#endif
+
+/* Creates a trace chain
+ * Make sure the value trace_chain is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_initialize(
+     libscca_trace_chain_t **trace_chain,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_trace_chain_initialize";
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace_chain != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace chain value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*trace_chain = memory_allocate_structure(
+	                libscca_trace_chain_t );
+
+	if( *trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create trace chain.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *trace_chain,
+	     0,
+	     sizeof( libscca_trace_chain_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear trace chain.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *trace_chain != NULL )
+	{
+		memory_free(
+		 *trace_chain );
+
+		*trace_chain = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a trace chain
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_free(
+     libscca_trace_chain_t **trace_chain,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_trace_chain_free";
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( *trace_chain != NULL )
+	{
+		if( ( *trace_chain )->next_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *trace_chain )->next_entry_indexes );
+		}
+		if( ( *trace_chain )->load_counts != NULL )
+		{
+			memory_free(
+			 ( *trace_chain )->load_counts );
+		}
+		memory_free(
+		 *trace_chain );
+
+		*trace_chain = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears the trace chain
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_clear(
+     libscca_trace_chain_t *trace_chain,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_trace_chain_clear";
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_chain->next_entry_indexes != NULL )
+	{
+		memory_free(
+		 trace_chain->next_entry_indexes );
+
+		trace_chain->next_entry_indexes = NULL;
+	}
+	if( trace_chain->load_counts != NULL )
+	{
+		memory_free(
+		 trace_chain->load_counts );
+
+		trace_chain->load_counts = NULL;
+	}
+	trace_chain->number_of_entries = 0;
+	trace_chain->is_read           = 0;
+
+	return( 1 );
+}
+
+/* Reads the format version 17, 23 and 26 trace chain array entries
+ * The data is expected to contain the number of 12 byte entries and
+ * the load counts and next entry indexes are expected to be allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_read_v17_entries_data(
+     libscca_trace_chain_t *trace_chain,
+     const uint8_t *data,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	const scca_trace_chain_array_entry_v17_t *entry_data = NULL;
+	static char *function                                = "libscca_trace_chain_read_v17_entries_data";
+	uint32_t entry_index                                 = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                                 = 0;
+	uint16_t value_16bit                                 = 0;
+#endif
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( trace_chain->load_counts == NULL )
+	 || ( trace_chain->next_entry_indexes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid trace chain - missing load counts or next entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = (const scca_trace_chain_array_entry_v17_t *) data;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_data->next_array_entry_index,
+		 trace_chain->next_entry_indexes[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_data->total_block_load_count,
+		 trace_chain->load_counts[ entry_index ] );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: trace chain array entry: %" PRIu32 " data:\n",
+			 function,
+			 entry_index );
+			libcnotify_print_data(
+			 (uint8_t *) entry_data,
+			 sizeof( scca_trace_chain_array_entry_v17_t ),
+			 0 );
+
+			value_32bit = trace_chain->next_entry_indexes[ entry_index ];
+
+			if( value_32bit == 0xffffffffUL )
+			{
+				libcnotify_printf(
+				 "%s: next table index\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 value_32bit );
+			}
+			else
+			{
+				libcnotify_printf(
+				 "%s: next table index\t\t: %" PRIu32 "\n",
+				 function,
+				 value_32bit );
+			}
+			libcnotify_printf(
+			 "%s: total block load count\t: %" PRIu32 " blocks (%" PRIu64 " bytes)\n",
+			 function,
+			 trace_chain->load_counts[ entry_index ],
+			 (uint64_t) trace_chain->load_counts[ entry_index ] * 512 * 1024 );
+
+			libcnotify_printf(
+			 "%s: unknown1\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 entry_data->unknown1 );
+
+			libcnotify_printf(
+			 "%s: unknown2\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 entry_data->unknown2 );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 entry_data->unknown3,
+			 value_16bit );
+			libcnotify_printf(
+			 "%s: unknown3\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 value_16bit );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		entry_data++;
+	}
+	return( 1 );
+}
+
+/* Decodes the total block load counts of format version 30 trace chain array entries
+ * one entry at a time
+ * Returns the index of the first entry that was not decoded
+ */
+uint32_t libscca_trace_chain_decode_v30_load_counts_word(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts )
+{
+	while( entry_index < number_of_entries )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ (size_t) entry_index * 8 ] ),
+		 load_counts[ entry_index ] );
+
+		entry_index++;
+	}
+	return( entry_index );
+}
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+
+/* Decodes the total block load counts of format version 30 trace chain array entries
+ * 4 entries at a time using SSE2
+ * The even 32-bit values of 2 blocks of 2 entries are combined into a single block
+ * Returns the index of the first entry that was not decoded
+ */
+LIBSCCA_CPU_TARGET_SSE2
+uint32_t libscca_trace_chain_decode_v30_load_counts_sse2(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts )
+{
+	__m128 first_block;
+	__m128 second_block;
+
+	while( ( entry_index + 4 ) <= number_of_entries )
+	{
+		first_block = _mm_castsi128_ps(
+		               _mm_loadu_si128(
+		                (const __m128i *) &( data[ (size_t) entry_index * 8 ] ) ) );
+
+		second_block = _mm_castsi128_ps(
+		                _mm_loadu_si128(
+		                 (const __m128i *) &( data[ ( (size_t) entry_index * 8 ) + 16 ] ) ) );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( load_counts[ entry_index ] ),
+		 _mm_castps_si128(
+		  _mm_shuffle_ps(
+		   first_block,
+		   second_block,
+		   _MM_SHUFFLE( 2, 0, 2, 0 ) ) ) );
+
+		entry_index += 4;
+	}
+	return( entry_index );
+}
+
+/* Decodes the total block load counts of format version 30 trace chain array entries
+ * 8 entries at a time using AVX2
+ * The even 32-bit values are combined per 128-bit lane after which the 64-bit
+ * halves of the lanes are put in order
+ * Returns the index of the first entry that was not decoded
+ */
+LIBSCCA_CPU_TARGET_AVX2
+uint32_t libscca_trace_chain_decode_v30_load_counts_avx2(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts )
+{
+	__m256 first_block;
+	__m256 second_block;
+
+	while( ( entry_index + 8 ) <= number_of_entries )
+	{
+		first_block = _mm256_castsi256_ps(
+		               _mm256_loadu_si256(
+		                (const __m256i *) &( data[ (size_t) entry_index * 8 ] ) ) );
+
+		second_block = _mm256_castsi256_ps(
+		                _mm256_loadu_si256(
+		                 (const __m256i *) &( data[ ( (size_t) entry_index * 8 ) + 32 ] ) ) );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( load_counts[ entry_index ] ),
+		 _mm256_permute4x64_epi64(
+		  _mm256_castps_si256(
+		   _mm256_shuffle_ps(
+		    first_block,
+		    second_block,
+		    _MM_SHUFFLE( 2, 0, 2, 0 ) ) ),
+		  _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+
+		entry_index += 8;
+	}
+	return( entry_index );
+}
+
+/* Decodes the total block load counts of format version 30 trace chain array entries
+ * 8 entries at a time using AVX-512
+ * Every entry is truncated from 64-bit to its lower 32-bit value
+ * Returns the index of the first entry that was not decoded
+ */
+LIBSCCA_CPU_TARGET_AVX512BW
+uint32_t libscca_trace_chain_decode_v30_load_counts_avx512bw(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts )
+{
+	__m512i block;
+
+	while( ( entry_index + 8 ) <= number_of_entries )
+	{
+		block = _mm512_loadu_si512(
+		         (const void *) &( data[ (size_t) entry_index * 8 ] ) );
+
+		_mm256_storeu_si256(
+		 (__m256i *) &( load_counts[ entry_index ] ),
+		 _mm512_cvtepi64_epi32(
+		  block ) );
+
+		entry_index += 8;
+	}
+	return( entry_index );
+}
+
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+#if defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+
+/* Decodes the total block load counts of format version 30 trace chain array entries
+ * 4 entries at a time using NEON
+ * The 32-bit values are de-interleaved on load, of which the even values are stored
+ * Returns the index of the first entry that was not decoded
+ */
+uint32_t libscca_trace_chain_decode_v30_load_counts_neon(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts )
+{
+	uint32x4x2_t blocks;
+
+	while( ( entry_index + 4 ) <= number_of_entries )
+	{
+		blocks = vld2q_u32(
+		          (const uint32_t *) &( data[ (size_t) entry_index * 8 ] ) );
+
+		vst1q_u32(
+		 &( load_counts[ entry_index ] ),
+		 blocks.val[ 0 ] );
+
+		entry_index += 4;
+	}
+	return( entry_index );
+}
+
+#endif /* defined( LIBSCCA_CPU_HAVE_NEON_KERNELS ) */
+
+/* Decodes the total block load counts of format version 30 trace chain array entries
+ * The data is expected to contain the number of 8 byte entries and the load counts
+ * are expected to be allocated
+ * The widest kernel the processor supports is selected at runtime
+ */
+void libscca_trace_chain_decode_v30_load_counts(
+      const uint8_t *data,
+      uint32_t number_of_entries,
+      uint32_t *load_counts )
+{
+	uint32_t entry_index = 0;
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) || defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	uint32_t cpu_features = libscca_cpu_get_features();
+#endif
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+	if( ( cpu_features & LIBSCCA_CPU_FEATURE_AVX512BW ) != 0 )
+	{
+		entry_index = libscca_trace_chain_decode_v30_load_counts_avx512bw(
+		               data,
+		               number_of_entries,
+		               entry_index,
+		               load_counts );
+	}
+	else if( ( cpu_features & LIBSCCA_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		entry_index = libscca_trace_chain_decode_v30_load_counts_avx2(
+		               data,
+		               number_of_entries,
+		               entry_index,
+		               load_counts );
+	}
+	else if( ( cpu_features & LIBSCCA_CPU_FEATURE_SSE2 ) != 0 )
+	{
+		entry_index = libscca_trace_chain_decode_v30_load_counts_sse2(
+		               data,
+		               number_of_entries,
+		               entry_index,
+		               load_counts );
+	}
+#elif defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	if( ( cpu_features & LIBSCCA_CPU_FEATURE_NEON ) != 0 )
+	{
+		entry_index = libscca_trace_chain_decode_v30_load_counts_neon(
+		               data,
+		               number_of_entries,
+		               entry_index,
+		               load_counts );
+	}
+#endif
+	/* The portable kernel decodes the remainder smaller than a vector block
+	 */
+	libscca_trace_chain_decode_v30_load_counts_word(
+	 data,
+	 number_of_entries,
+	 entry_index,
+	 load_counts );
+}
+
+/* Reads the format version 30 trace chain array entries
+ * The data is expected to contain the number of 8 byte entries and
+ * the load counts are expected to be allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_read_v30_entries_data(
+     libscca_trace_chain_t *trace_chain,
+     const uint8_t *data,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function                                = "libscca_trace_chain_read_v30_entries_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	const scca_trace_chain_array_entry_v30_t *entry_data = NULL;
+	uint32_t entry_index                                 = 0;
+	uint16_t value_16bit                                 = 0;
+#endif
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_chain->load_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid trace chain - missing load counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		entry_data = (const scca_trace_chain_array_entry_v30_t *) data;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 entry_data->total_block_load_count,
+			 trace_chain->load_counts[ entry_index ] );
+
+			libcnotify_printf(
+			 "%s: trace chain array entry: %" PRIu32 " data:\n",
+			 function,
+			 entry_index );
+			libcnotify_print_data(
+			 (uint8_t *) entry_data,
+			 sizeof( scca_trace_chain_array_entry_v30_t ),
+			 0 );
+
+			libcnotify_printf(
+			 "%s: total block load count\t: %" PRIu32 " blocks (%" PRIu64 " bytes)\n",
+			 function,
+			 trace_chain->load_counts[ entry_index ],
+			 (uint64_t) trace_chain->load_counts[ entry_index ] * 512 * 1024 );
+
+			libcnotify_printf(
+			 "%s: unknown1\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 entry_data->unknown1 );
+
+			libcnotify_printf(
+			 "%s: unknown2\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 entry_data->unknown2 );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 entry_data->unknown3,
+			 value_16bit );
+			libcnotify_printf(
+			 "%s: unknown3\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 value_16bit );
+
+			libcnotify_printf(
+			 "\n" );
+
+			entry_data++;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* The load counts are decoded in bulk as a packed column
+	 */
+	libscca_trace_chain_decode_v30_load_counts(
+	 data,
+	 number_of_entries,
+	 trace_chain->load_counts );
+
+	return( 1 );
+}
+
+/* Reads the trace chain array data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_read_data(
+     libscca_trace_chain_t *trace_chain,
+     libscca_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function  = "libscca_trace_chain_read_data";
+	size_t allocated_size  = 0;
+	size_t entry_data_size = 0;
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_chain->load_counts != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid trace chain - load counts value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO handle - missing format layout.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data_size = io_handle->format_layout->trace_chain_entry_data_size;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == 0 )
+	 || ( (size_t) number_of_entries > ( data_size / entry_data_size ) )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libscca_budget_check_number_of_entries(
+	       &( io_handle->budget ),
+	       number_of_entries,
+	       &( io_handle->abort ),
+	       error ) != 1 )
+	 || ( libscca_budget_add_steps(
+	       &( io_handle->budget ),
+	       (uint64_t) number_of_entries,
+	       &( io_handle->abort ),
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: trace chain entries exceed budget.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: trace chain array data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 (size_t) number_of_entries * entry_data_size,
+		 0 );
+	}
+#endif
+	trace_chain->load_counts = (uint32_t *) memory_allocate(
+	                                         sizeof( uint32_t ) * number_of_entries );
+
+	if( trace_chain->load_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create load counts.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_data_size == sizeof( scca_trace_chain_array_entry_v17_t ) )
+	{
+		trace_chain->next_entry_indexes = (uint32_t *) memory_allocate(
+		                                                sizeof( uint32_t ) * number_of_entries );
+
+		if( trace_chain->next_entry_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create next entry indexes.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_trace_chain_read_v17_entries_data(
+		     trace_chain,
+		     data,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read trace chain array entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libscca_trace_chain_read_v30_entries_data(
+		     trace_chain,
+		     data,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read trace chain array entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The load counts and next entry indexes remain allocated until the file is closed
+	 */
+	allocated_size = sizeof( uint32_t ) * number_of_entries;
+
+	if( trace_chain->next_entry_indexes != NULL )
+	{
+		allocated_size *= 2;
+	}
+	if( libscca_statistics_add_allocated_size(
+	     &( io_handle->statistics ),
+	     allocated_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add trace chain allocated size.",
+		 function );
+
+		goto on_error;
+	}
+	trace_chain->number_of_entries = (int) number_of_entries;
+	trace_chain->is_read           = 1;
+
+	return( 1 );
+
+on_error:
+	if( trace_chain->next_entry_indexes != NULL )
+	{
+		memory_free(
+		 trace_chain->next_entry_indexes );
+
+		trace_chain->next_entry_indexes = NULL;
+	}
+	if( trace_chain->load_counts != NULL )
+	{
+		memory_free(
+		 trace_chain->load_counts );
+
+		trace_chain->load_counts = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_get_number_of_entries(
+     libscca_trace_chain_t *trace_chain,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_trace_chain_get_number_of_entries";
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = trace_chain->number_of_entries;
+
+	return( 1 );
+}
+
+/* Copies the total block load counts of all entries
+ * The number of load counts must be equal to or greater than the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_copy_load_counts(
+     libscca_trace_chain_t *trace_chain,
+     uint32_t *load_counts,
+     int number_of_load_counts,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_trace_chain_copy_load_counts";
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( load_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_load_counts < trace_chain->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of load counts value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_chain->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     load_counts,
+	     trace_chain->load_counts,
+	     sizeof( uint32_t ) * trace_chain->number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy load counts.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the next entry indexes of all entries
+ * The number of next entry indexes must be equal to or greater than the number of entries
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libscca_trace_chain_copy_next_entry_indexes(
+     libscca_trace_chain_t *trace_chain,
+     uint32_t *next_entry_indexes,
+     int number_of_next_entry_indexes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_trace_chain_copy_next_entry_indexes";
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_next_entry_indexes < trace_chain->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of next entry indexes value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_chain->next_entry_indexes == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     next_entry_indexes,
+	     trace_chain->next_entry_indexes,
+	     sizeof( uint32_t ) * trace_chain->number_of_entries ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy next entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sums the load counts of ranges of entries
+ * A range is defined by its first entry index and number of entries, ranges that
+ * extend beyond the last entry are truncated
+ * The load counts are summed in a single pass over the entries and each range is
+ * then resolved in constant time
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_trace_chain_get_range_load_counts(
+     libscca_trace_chain_t *trace_chain,
+     const uint32_t *first_entry_indexes,
+     const uint32_t *numbers_of_entries,
+     uint32_t number_of_ranges,
+     uint64_t *load_counts,
+     libcerror_error_t **error )
+{
+	uint64_t *cumulative_load_counts = NULL;
+	static char *function            = "libscca_trace_chain_get_range_load_counts";
+	uint32_t first_entry_index       = 0;
+	uint32_t last_entry_index        = 0;
+	uint32_t number_of_entries       = 0;
+	uint32_t range_index             = 0;
+	int entry_index                  = 0;
+
+	if( trace_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trace chain.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	if( first_entry_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first entry indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( numbers_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid numbers of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( load_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid load counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_ranges > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( trace_chain->number_of_entries < 0 )
+	 || ( (size_t) trace_chain->number_of_entries >= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid trace chain - number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     load_counts,
+	     0,
+	     sizeof( uint64_t ) * number_of_ranges ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear load counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( trace_chain->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( trace_chain->load_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid trace chain - missing load counts.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = (uint32_t) trace_chain->number_of_entries;
+
+	/* The cumulative load count of entry N is the sum of the load counts of the entries before N
+	 */
+	cumulative_load_counts = (uint64_t *) memory_allocate(
+	                                       sizeof( uint64_t ) * ( number_of_entries + 1 ) );
+
+	if( cumulative_load_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cumulative load counts.",
+		 function );
+
+		return( -1 );
+	}
+	cumulative_load_counts[ 0 ] = 0;
+
+	for( entry_index = 0;
+	     entry_index < trace_chain->number_of_entries;
+	     entry_index++ )
+	{
+		cumulative_load_counts[ entry_index + 1 ] = cumulative_load_counts[ entry_index ]
+		                                          + trace_chain->load_counts[ entry_index ];
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		first_entry_index = first_entry_indexes[ range_index ];
+
+		if( first_entry_index >= number_of_entries )
+		{
+			continue;
+		}
+		last_entry_index = number_of_entries;
+
+		if( numbers_of_entries[ range_index ] < ( number_of_entries - first_entry_index ) )
+		{
+			last_entry_index = first_entry_index + numbers_of_entries[ range_index ];
+		}
+		load_counts[ range_index ] = cumulative_load_counts[ last_entry_index ]
+		                           - cumulative_load_counts[ first_entry_index ];
+	}
+	memory_free(
+	 cumulative_load_counts );
+
+	return( 1 );
+}
+
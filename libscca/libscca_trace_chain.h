@@ -0,0 +1,165 @@
+/*
+ * Trace chain functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_TRACE_CHAIN_H )
+#define _LIBSCCA_TRACE_CHAIN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_cpu.h"
+#include "libscca_io_handle.h"
+#include "libscca_libbfio.h"
+#include "libscca_libcerror.h"
+#include "libscca_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_trace_chain libscca_trace_chain_t;
+
+struct libscca_trace_chain
+{
+	/* The total block load counts
+	 */
+	uint32_t *load_counts;
+
+	/* The next entry indexes
+	 * Contains NULL if the format version does not store next entry indexes
+	 */
+	uint32_t *next_entry_indexes;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* Value to indicate the trace chain was read
+	 */
+	uint8_t is_read;
+};
+
+int libscca_trace_chain_initialize(
+     libscca_trace_chain_t **trace_chain,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_free(
+     libscca_trace_chain_t **trace_chain,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_clear(
+     libscca_trace_chain_t *trace_chain,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_read_v17_entries_data(
+     libscca_trace_chain_t *trace_chain,
+     const uint8_t *data,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+uint32_t libscca_trace_chain_decode_v30_load_counts_word(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts );
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+
+uint32_t libscca_trace_chain_decode_v30_load_counts_sse2(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts );
+
+uint32_t libscca_trace_chain_decode_v30_load_counts_avx2(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts );
+
+uint32_t libscca_trace_chain_decode_v30_load_counts_avx512bw(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts );
+
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+#if defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+
+uint32_t libscca_trace_chain_decode_v30_load_counts_neon(
+          const uint8_t *data,
+          uint32_t number_of_entries,
+          uint32_t entry_index,
+          uint32_t *load_counts );
+
+#endif /* defined( LIBSCCA_CPU_HAVE_NEON_KERNELS ) */
+
+void libscca_trace_chain_decode_v30_load_counts(
+      const uint8_t *data,
+      uint32_t number_of_entries,
+      uint32_t *load_counts );
+
+int libscca_trace_chain_read_v30_entries_data(
+     libscca_trace_chain_t *trace_chain,
+     const uint8_t *data,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_read_data(
+     libscca_trace_chain_t *trace_chain,
+     libscca_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_get_number_of_entries(
+     libscca_trace_chain_t *trace_chain,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_copy_load_counts(
+     libscca_trace_chain_t *trace_chain,
+     uint32_t *load_counts,
+     int number_of_load_counts,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_copy_next_entry_indexes(
+     libscca_trace_chain_t *trace_chain,
+     uint32_t *next_entry_indexes,
+     int number_of_next_entry_indexes,
+     libcerror_error_t **error );
+
+int libscca_trace_chain_get_range_load_counts(
+     libscca_trace_chain_t *trace_chain,
+     const uint32_t *first_entry_indexes,
+     const uint32_t *numbers_of_entries,
+     uint32_t number_of_ranges,
+     uint64_t *load_counts,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_TRACE_CHAIN_H ) */
+
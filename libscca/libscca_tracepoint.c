@@ -0,0 +1,77 @@
+/*
+ * Static tracepoint functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_tracepoint.h"
+
+#if defined( LIBSCCA_TRACEPOINT_HAVE_ETW )
+
+/* The libscca TraceLogging provider
+ * The GUID is derived from the provider name, hence a session can enable the provider by name
+ * {6fb3acc8-4af2-529c-4510-c4cd149f7c8e}
+ */
+TRACELOGGING_DEFINE_PROVIDER(
+ libscca_tracepoint_provider,
+ "libscca",
+ ( 0x6fb3acc8, 0x4af2, 0x529c, 0x45, 0x10, 0xc4, 0xcd, 0x14, 0x9f, 0x7c, 0x8e ) );
+
+/* Value to indicate the provider is registered
+ */
+static LONG libscca_tracepoint_provider_is_registered = 0;
+
+/* Registers the TraceLogging provider
+ * The provider is registered once, events that are written before the registration
+ * has completed are ignored
+ */
+void libscca_tracepoint_register_provider(
+      void )
+{
+	if( InterlockedCompareExchange(
+	     &libscca_tracepoint_provider_is_registered,
+	     1,
+	     0 ) == 0 )
+	{
+		TraceLoggingRegister(
+		 libscca_tracepoint_provider );
+	}
+}
+
+/* Unregisters the TraceLogging provider
+ * The provider must be unregistered before the library is unloaded
+ */
+void libscca_tracepoint_unregister_provider(
+      void )
+{
+	if( InterlockedCompareExchange(
+	     &libscca_tracepoint_provider_is_registered,
+	     0,
+	     1 ) == 1 )
+	{
+		TraceLoggingUnregister(
+		 libscca_tracepoint_provider );
+	}
+}
+
+#endif /* defined( LIBSCCA_TRACEPOINT_HAVE_ETW ) */
+
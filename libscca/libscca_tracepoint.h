@@ -0,0 +1,167 @@
+/*
+ * Static tracepoint functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBSCCA_TRACEPOINT_H )
+#define _LIBSCCA_TRACEPOINT_H
+
+#include <common.h>
+#include <types.h>
+
+/* The static tracepoints are USDT probes of the libscca provider on Linux,
+ * which can be attached to with bpftrace or SystemTap, and TraceLogging events
+ * of the libscca ETW provider on Windows. A USDT probe is a single nop and
+ * a TraceLogging event a test of the provider enabled state until a tracer
+ * attaches, hence the tracepoints can be enabled in release builds
+ */
+#if defined( HAVE_STATIC_TRACEPOINTS ) && defined( WINAPI ) && ( defined( _MSC_VER ) || defined( HAVE_TRACELOGGINGPROVIDER_H ) )
+#define LIBSCCA_TRACEPOINT_HAVE_ETW			1
+
+#include <windows.h>
+#include <TraceLoggingProvider.h>
+
+#elif defined( HAVE_STATIC_TRACEPOINTS ) && defined( HAVE_SYS_SDT_H )
+#define LIBSCCA_TRACEPOINT_HAVE_USDT			1
+
+#include <sys/sdt.h>
+
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( LIBSCCA_TRACEPOINT_HAVE_ETW )
+
+TRACELOGGING_DECLARE_PROVIDER(
+ libscca_tracepoint_provider );
+
+void libscca_tracepoint_register_provider(
+      void );
+
+void libscca_tracepoint_unregister_provider(
+      void );
+
+#endif /* defined( LIBSCCA_TRACEPOINT_HAVE_ETW ) */
+
+/* The tracepoints:
+ * open-begin         the file size provided by the caller, where 0 represents unknown
+ * open-end           the result, file size, format version, number of file metrics entries,
+ *                    number of trace chain entries and number of volumes
+ * span-begin         the tracing span, see LIBSCCA_TRACING_SPANS
+ * span-end           the tracing span
+ * block-decode-begin the compressed data size and the maximum uncompressed data size of a block
+ * block-decode-end   the result, compressed data size and uncompressed data size of a block
+ */
+#if defined( LIBSCCA_TRACEPOINT_HAVE_USDT )
+
+#define LIBSCCA_TRACEPOINT_OPEN_BEGIN( file_size ) \
+	DTRACE_PROBE1( libscca, open__begin, (uint64_t) ( file_size ) );
+
+#define LIBSCCA_TRACEPOINT_OPEN_END( result, file_size, format_version, number_of_file_metrics_entries, number_of_trace_chain_entries, number_of_volumes ) \
+	DTRACE_PROBE6( libscca, open__end, (int) ( result ), (uint64_t) ( file_size ), (uint32_t) ( format_version ), (uint32_t) ( number_of_file_metrics_entries ), (uint32_t) ( number_of_trace_chain_entries ), (uint32_t) ( number_of_volumes ) );
+
+#define LIBSCCA_TRACEPOINT_SPAN_BEGIN( span ) \
+	DTRACE_PROBE1( libscca, span__begin, (int) ( span ) );
+
+#define LIBSCCA_TRACEPOINT_SPAN_END( span ) \
+	DTRACE_PROBE1( libscca, span__end, (int) ( span ) );
+
+#define LIBSCCA_TRACEPOINT_BLOCK_DECODE_BEGIN( compressed_data_size, uncompressed_data_size ) \
+	DTRACE_PROBE2( libscca, block__decode__begin, (uint64_t) ( compressed_data_size ), (uint64_t) ( uncompressed_data_size ) );
+
+#define LIBSCCA_TRACEPOINT_BLOCK_DECODE_END( result, compressed_data_size, uncompressed_data_size ) \
+	DTRACE_PROBE3( libscca, block__decode__end, (int) ( result ), (uint64_t) ( compressed_data_size ), (uint64_t) ( uncompressed_data_size ) );
+
+#elif defined( LIBSCCA_TRACEPOINT_HAVE_ETW )
+
+#define LIBSCCA_TRACEPOINT_OPEN_BEGIN( file_size ) \
+	TraceLoggingWrite( \
+	 libscca_tracepoint_provider, \
+	 "OpenBegin", \
+	 TraceLoggingUInt64( (UINT64) ( file_size ), "FileSize" ) );
+
+#define LIBSCCA_TRACEPOINT_OPEN_END( result, file_size, format_version, number_of_file_metrics_entries, number_of_trace_chain_entries, number_of_volumes ) \
+	TraceLoggingWrite( \
+	 libscca_tracepoint_provider, \
+	 "OpenEnd", \
+	 TraceLoggingInt32( (INT32) ( result ), "Result" ), \
+	 TraceLoggingUInt64( (UINT64) ( file_size ), "FileSize" ), \
+	 TraceLoggingUInt32( (UINT32) ( format_version ), "FormatVersion" ), \
+	 TraceLoggingUInt32( (UINT32) ( number_of_file_metrics_entries ), "NumberOfFileMetricsEntries" ), \
+	 TraceLoggingUInt32( (UINT32) ( number_of_trace_chain_entries ), "NumberOfTraceChainEntries" ), \
+	 TraceLoggingUInt32( (UINT32) ( number_of_volumes ), "NumberOfVolumes" ) );
+
+#define LIBSCCA_TRACEPOINT_SPAN_BEGIN( span ) \
+	TraceLoggingWrite( \
+	 libscca_tracepoint_provider, \
+	 "SpanBegin", \
+	 TraceLoggingInt32( (INT32) ( span ), "Span" ) );
+
+#define LIBSCCA_TRACEPOINT_SPAN_END( span ) \
+	TraceLoggingWrite( \
+	 libscca_tracepoint_provider, \
+	 "SpanEnd", \
+	 TraceLoggingInt32( (INT32) ( span ), "Span" ) );
+
+#define LIBSCCA_TRACEPOINT_BLOCK_DECODE_BEGIN( compressed_data_size, uncompressed_data_size ) \
+	TraceLoggingWrite( \
+	 libscca_tracepoint_provider, \
+	 "BlockDecodeBegin", \
+	 TraceLoggingUInt64( (UINT64) ( compressed_data_size ), "CompressedDataSize" ), \
+	 TraceLoggingUInt64( (UINT64) ( uncompressed_data_size ), "UncompressedDataSize" ) );
+
+#define LIBSCCA_TRACEPOINT_BLOCK_DECODE_END( result, compressed_data_size, uncompressed_data_size ) \
+	TraceLoggingWrite( \
+	 libscca_tracepoint_provider, \
+	 "BlockDecodeEnd", \
+	 TraceLoggingInt32( (INT32) ( result ), "Result" ), \
+	 TraceLoggingUInt64( (UINT64) ( compressed_data_size ), "CompressedDataSize" ), \
+	 TraceLoggingUInt64( (UINT64) ( uncompressed_data_size ), "UncompressedDataSize" ) );
+
+#else
+
+#define LIBSCCA_TRACEPOINT_OPEN_BEGIN( file_size ) \
+	/* no tracepoint */
+
+#define LIBSCCA_TRACEPOINT_OPEN_END( result, file_size, format_version, number_of_file_metrics_entries, number_of_trace_chain_entries, number_of_volumes ) \
+	/* no tracepoint */
+
+#define LIBSCCA_TRACEPOINT_SPAN_BEGIN( span ) \
+	/* no tracepoint */
+
+#define LIBSCCA_TRACEPOINT_SPAN_END( span ) \
+	/* no tracepoint */
+
+#define LIBSCCA_TRACEPOINT_BLOCK_DECODE_BEGIN( compressed_data_size, uncompressed_data_size ) \
+	/* no tracepoint */
+
+#define LIBSCCA_TRACEPOINT_BLOCK_DECODE_END( result, compressed_data_size, uncompressed_data_size ) \
+	/* no tracepoint */
+
+#endif /* defined( LIBSCCA_TRACEPOINT_HAVE_USDT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_TRACEPOINT_H ) */
+
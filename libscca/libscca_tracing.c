@@ -0,0 +1,203 @@
+/*
+ * Tracing functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#elif defined( HAVE_PTHREAD_H )
+#include <pthread.h>
+#endif
+
+#include "libscca_definitions.h"
+#include "libscca_libcerror.h"
+#include "libscca_statistics.h"
+#include "libscca_tracing.h"
+#include "libscca_unused.h"
+
+#if defined( HAVE_TRACING )
+
+/* The names of the spans, which are prefixed so that they are recognizable
+ * amongst the spans of the consumer
+ */
+const char *libscca_tracing_span_names[ LIBSCCA_TRACING_NUMBER_OF_SPANS ] = {
+	"libscca_open",
+	"libscca_compressed_header",
+	"libscca_compressed_blocks",
+	"libscca_file_header",
+	"libscca_file_information",
+	"libscca_file_metrics",
+	"libscca_trace_chain",
+	"libscca_filenames",
+	"libscca_volumes" };
+
+/* The tracing sink
+ * The sink is process-wide and is expected to be set before files are opened
+ */
+static void (*libscca_tracing_callback)(
+             int event_type,
+             const char *span_name,
+             uint64_t timestamp,
+             void *user_data ) = NULL;
+
+static void *libscca_tracing_user_data = NULL;
+
+static FILE *libscca_tracing_chrome_stream = NULL;
+
+/* Emits the begin or end event of a span to the tracing sink
+ */
+void libscca_tracing_emit(
+      int event_type,
+      int span )
+{
+	uint64_t thread_identifier = 0;
+	uint64_t timestamp         = 0;
+
+	if( ( libscca_tracing_callback == NULL )
+	 && ( libscca_tracing_chrome_stream == NULL ) )
+	{
+		return;
+	}
+	if( ( span < 0 )
+	 || ( span >= LIBSCCA_TRACING_NUMBER_OF_SPANS ) )
+	{
+		return;
+	}
+	if( libscca_statistics_get_timestamp(
+	     &timestamp ) != 1 )
+	{
+		return;
+	}
+	if( libscca_tracing_callback != NULL )
+	{
+		libscca_tracing_callback(
+		 event_type,
+		 libscca_tracing_span_names[ span ],
+		 timestamp,
+		 libscca_tracing_user_data );
+	}
+	if( libscca_tracing_chrome_stream != NULL )
+	{
+#if defined( WINAPI )
+		thread_identifier = (uint64_t) GetCurrentThreadId();
+
+#elif defined( HAVE_PTHREAD_H )
+		thread_identifier = (uint64_t) (uintptr_t) pthread_self();
+#endif
+		/* The Chrome trace event format allows the array to be left unterminated
+		 * so that the trace remains usable if the process does not exit cleanly
+		 */
+		fprintf(
+		 libscca_tracing_chrome_stream,
+		 "{\"name\": \"%s\", \"cat\": \"libscca\", \"ph\": \"%s\", \"ts\": %" PRIu64 ".%03" PRIu64 ", \"pid\": 1, \"tid\": %" PRIu64 "},\n",
+		 libscca_tracing_span_names[ span ],
+		 ( event_type == LIBSCCA_TRACING_EVENT_TYPE_BEGIN ) ? "B" : "E",
+		 timestamp / 1000,
+		 timestamp % 1000,
+		 thread_identifier );
+	}
+}
+
+#endif /* defined( HAVE_TRACING ) */
+
+#if !defined( HAVE_LOCAL_LIBSCCA )
+
+/* Sets the tracing callback
+ * The callback is called with the event type, span name, monotonic timestamp in nano seconds
+ * and user data at the begin and end of every read stage, a NULL callback removes it
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_tracing_set_callback(
+     void (*callback)(
+            int event_type,
+            const char *span_name,
+            uint64_t timestamp,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_TRACING )
+	LIBSCCA_UNREFERENCED_PARAMETER( error )
+
+	libscca_tracing_callback  = callback;
+	libscca_tracing_user_data = user_data;
+
+	return( 1 );
+#else
+	static char *function = "libscca_tracing_set_callback";
+
+	LIBSCCA_UNREFERENCED_PARAMETER( callback )
+	LIBSCCA_UNREFERENCED_PARAMETER( user_data )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: tracing support not enabled.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Sets the tracing stream to which the spans are written in the Chrome trace event format
+ * The stream is written as a JSON array that can be loaded into chrome://tracing or Perfetto,
+ * a NULL stream removes it
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_tracing_set_chrome_stream(
+     FILE *stream,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_TRACING )
+	LIBSCCA_UNREFERENCED_PARAMETER( error )
+
+	if( ( stream != NULL )
+	 && ( stream != libscca_tracing_chrome_stream ) )
+	{
+		fprintf(
+		 stream,
+		 "[\n" );
+	}
+	libscca_tracing_chrome_stream = stream;
+
+	return( 1 );
+#else
+	static char *function = "libscca_tracing_set_chrome_stream";
+
+	LIBSCCA_UNREFERENCED_PARAMETER( stream )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: tracing support not enabled.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBSCCA ) */
+
@@ -0,0 +1,106 @@
+/*
+ * Tracing functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_TRACING_H )
+#define _LIBSCCA_TRACING_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_tracepoint.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The tracing span definitions
+ */
+enum LIBSCCA_TRACING_SPANS
+{
+	LIBSCCA_TRACING_SPAN_OPEN			= 0,
+	LIBSCCA_TRACING_SPAN_COMPRESSED_HEADER		= 1,
+	LIBSCCA_TRACING_SPAN_COMPRESSED_BLOCKS		= 2,
+	LIBSCCA_TRACING_SPAN_FILE_HEADER		= 3,
+	LIBSCCA_TRACING_SPAN_FILE_INFORMATION		= 4,
+	LIBSCCA_TRACING_SPAN_FILE_METRICS		= 5,
+	LIBSCCA_TRACING_SPAN_TRACE_CHAIN		= 6,
+	LIBSCCA_TRACING_SPAN_FILENAMES			= 7,
+	LIBSCCA_TRACING_SPAN_VOLUMES			= 8
+};
+
+#define LIBSCCA_TRACING_NUMBER_OF_SPANS			9
+
+/* The tracing hooks compile to the static tracepoints of the spans unless tracing is enabled
+ */
+#if defined( HAVE_TRACING )
+#define LIBSCCA_TRACING_BEGIN( span ) \
+	LIBSCCA_TRACEPOINT_SPAN_BEGIN( span ) \
+	libscca_tracing_emit( LIBSCCA_TRACING_EVENT_TYPE_BEGIN, span );
+
+#define LIBSCCA_TRACING_END( span ) \
+	LIBSCCA_TRACEPOINT_SPAN_END( span ) \
+	libscca_tracing_emit( LIBSCCA_TRACING_EVENT_TYPE_END, span );
+
+#else
+#define LIBSCCA_TRACING_BEGIN( span ) \
+	LIBSCCA_TRACEPOINT_SPAN_BEGIN( span )
+
+#define LIBSCCA_TRACING_END( span ) \
+	LIBSCCA_TRACEPOINT_SPAN_END( span )
+
+#endif /* defined( HAVE_TRACING ) */
+
+#if defined( HAVE_TRACING )
+
+void libscca_tracing_emit(
+      int event_type,
+      int span );
+
+#endif /* defined( HAVE_TRACING ) */
+
+#if !defined( HAVE_LOCAL_LIBSCCA )
+
+LIBSCCA_EXTERN \
+int libscca_tracing_set_callback(
+     void (*callback)(
+            int event_type,
+            const char *span_name,
+            uint64_t timestamp,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_tracing_set_chrome_stream(
+     FILE *stream,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBSCCA ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_TRACING_H ) */
+
@@ -34,14 +34,42 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libscca_block_cache {}		libscca_block_cache_t;
+typedef struct libscca_context {}		libscca_context_t;
+typedef struct libscca_diff {}			libscca_diff_t;
+typedef struct libscca_directory {}		libscca_directory_t;
 typedef struct libscca_file {}			libscca_file_t;
 typedef struct libscca_file_metrics {}		libscca_file_metrics_t;
+typedef struct libscca_file_metrics_iterator {}	libscca_file_metrics_iterator_t;
+typedef struct libscca_index {}			libscca_index_t;
+typedef struct libscca_pack {}			libscca_pack_t;
+typedef struct libscca_parse_cache {}		libscca_parse_cache_t;
+typedef struct libscca_parser {}		libscca_parser_t;
+typedef struct libscca_run_time_histogram {}	libscca_run_time_histogram_t;
+typedef struct libscca_string_pool {}		libscca_string_pool_t;
+typedef struct libscca_timeline {}		libscca_timeline_t;
+typedef struct libscca_volume_dictionary {}	libscca_volume_dictionary_t;
 typedef struct libscca_volume_information {}	libscca_volume_information_t;
+typedef struct libscca_watcher {}		libscca_watcher_t;
 
 #else
+typedef intptr_t libscca_block_cache_t;
+typedef intptr_t libscca_context_t;
+typedef intptr_t libscca_diff_t;
+typedef intptr_t libscca_directory_t;
 typedef intptr_t libscca_file_t;
 typedef intptr_t libscca_file_metrics_t;
+typedef intptr_t libscca_file_metrics_iterator_t;
+typedef intptr_t libscca_index_t;
+typedef intptr_t libscca_pack_t;
+typedef intptr_t libscca_parse_cache_t;
+typedef intptr_t libscca_parser_t;
+typedef intptr_t libscca_run_time_histogram_t;
+typedef intptr_t libscca_string_pool_t;
+typedef intptr_t libscca_timeline_t;
+typedef intptr_t libscca_volume_dictionary_t;
 typedef intptr_t libscca_volume_information_t;
+typedef intptr_t libscca_watcher_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -0,0 +1,76 @@
+/*
+ * UTF-16 upper case functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_UPCASE_H )
+#define _LIBSCCA_UPCASE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of pages of upper case characters
+ */
+#define LIBSCCA_UPCASE_NUMBER_OF_PAGES		20
+
+/* The size of the buffer of upper case UTF-16 little-endian data
+ * that is hashed at once
+ */
+#define LIBSCCA_UPCASE_HASH_BUFFER_SIZE		512
+
+extern const uint8_t libscca_upcase_page_indexes[ 256 ];
+
+extern const uint16_t libscca_upcase_pages[ LIBSCCA_UPCASE_NUMBER_OF_PAGES ][ 256 ];
+
+uint16_t libscca_upcase_get_character(
+          uint16_t character );
+
+int libscca_upcase_calculate_hash_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_compute_case_folded_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_compute_case_folded_hash_utf16(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_UPCASE_H ) */
+
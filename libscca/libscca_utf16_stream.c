@@ -0,0 +1,863 @@
+/*
+ * UTF-16 stream functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libscca_cpu.h"
+#include "libscca_libcerror.h"
+#include "libscca_libuna.h"
+#include "libscca_utf16_stream.h"
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+#include <immintrin.h>
+
+#elif defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+#include <arm_neon.h>
+
+#endif
+
+/* Scans a little-endian UTF-16 stream for a word that contains a character
+ * outside the ASCII range or an end of string character
+ * The stream is scanned 4 characters at a time, where a character outside
+ * the ASCII range is detected by its bits 7 to 15 being set and an end of string
+ * character by the classic "has zero" test on every 16-bit lane
+ * Returns the stream index of the word or of the remainder smaller than a word
+ */
+size_t libscca_utf16_stream_scan_ascii_word(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	uint64_t value_64bit = 0;
+
+	while( ( stream_index + 8 ) <= utf16_stream_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_64bit );
+
+		if( ( value_64bit & 0xff80ff80ff80ff80ULL ) != 0 )
+		{
+			break;
+		}
+		if( ( ( value_64bit - 0x0001000100010001ULL ) & ~value_64bit & 0x8000800080008000ULL ) != 0 )
+		{
+			break;
+		}
+		stream_index += 8;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream for a word that contains an end of string character
+ * Returns the stream index of the word or of the remainder smaller than a word
+ */
+size_t libscca_utf16_stream_scan_end_of_string_word(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	uint64_t value_64bit = 0;
+
+	while( ( stream_index + 8 ) <= utf16_stream_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_64bit );
+
+		if( ( ( value_64bit - 0x0001000100010001ULL ) & ~value_64bit & 0x8000800080008000ULL ) != 0 )
+		{
+			break;
+		}
+		stream_index += 8;
+	}
+	return( stream_index );
+}
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+
+/* Scans a little-endian UTF-16 stream 8 characters at a time using SSE2
+ * for a block that contains a character outside the ASCII range or an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+LIBSCCA_CPU_TARGET_SSE2
+size_t libscca_utf16_stream_scan_ascii_sse2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	__m128i ascii_mask = _mm_set1_epi16( (short) 0xff80 );
+	__m128i zero_value = _mm_setzero_si128();
+	__m128i value_128bit;
+
+	while( ( stream_index + 16 ) <= utf16_stream_size )
+	{
+		value_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ stream_index ] ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi16(
+		      _mm_and_si128(
+		       value_128bit,
+		       ascii_mask ),
+		      zero_value ) ) != 0xffff )
+		{
+			break;
+		}
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi16(
+		      value_128bit,
+		      zero_value ) ) != 0 )
+		{
+			break;
+		}
+		stream_index += 16;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream 8 characters at a time using SSE2
+ * for a block that contains an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+LIBSCCA_CPU_TARGET_SSE2
+size_t libscca_utf16_stream_scan_end_of_string_sse2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	__m128i zero_value = _mm_setzero_si128();
+	__m128i value_128bit;
+
+	while( ( stream_index + 16 ) <= utf16_stream_size )
+	{
+		value_128bit = _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ stream_index ] ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi16(
+		      value_128bit,
+		      zero_value ) ) != 0 )
+		{
+			break;
+		}
+		stream_index += 16;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream 16 characters at a time using AVX2
+ * for a block that contains a character outside the ASCII range or an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+LIBSCCA_CPU_TARGET_AVX2
+size_t libscca_utf16_stream_scan_ascii_avx2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	__m256i ascii_mask = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i zero_value = _mm256_setzero_si256();
+	__m256i value_256bit;
+
+	while( ( stream_index + 32 ) <= utf16_stream_size )
+	{
+		value_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf16_stream[ stream_index ] ) );
+
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi16(
+		      _mm256_and_si256(
+		       value_256bit,
+		       ascii_mask ),
+		      zero_value ) ) != -1 )
+		{
+			break;
+		}
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi16(
+		      value_256bit,
+		      zero_value ) ) != 0 )
+		{
+			break;
+		}
+		stream_index += 32;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream 16 characters at a time using AVX2
+ * for a block that contains an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+LIBSCCA_CPU_TARGET_AVX2
+size_t libscca_utf16_stream_scan_end_of_string_avx2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	__m256i zero_value = _mm256_setzero_si256();
+	__m256i value_256bit;
+
+	while( ( stream_index + 32 ) <= utf16_stream_size )
+	{
+		value_256bit = _mm256_loadu_si256(
+		                (const __m256i *) &( utf16_stream[ stream_index ] ) );
+
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi16(
+		      value_256bit,
+		      zero_value ) ) != 0 )
+		{
+			break;
+		}
+		stream_index += 32;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream 32 characters at a time using AVX-512
+ * for a block that contains a character outside the ASCII range or an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+LIBSCCA_CPU_TARGET_AVX512BW
+size_t libscca_utf16_stream_scan_ascii_avx512bw(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	__m512i ascii_mask = _mm512_set1_epi16( (short) 0xff80 );
+	__m512i value_512bit;
+
+	while( ( stream_index + 64 ) <= utf16_stream_size )
+	{
+		value_512bit = _mm512_loadu_si512(
+		                (const void *) &( utf16_stream[ stream_index ] ) );
+
+		if( _mm512_test_epi16_mask(
+		     value_512bit,
+		     ascii_mask ) != 0 )
+		{
+			break;
+		}
+		if( _mm512_testn_epi16_mask(
+		     value_512bit,
+		     value_512bit ) != 0 )
+		{
+			break;
+		}
+		stream_index += 64;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream 32 characters at a time using AVX-512
+ * for a block that contains an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+LIBSCCA_CPU_TARGET_AVX512BW
+size_t libscca_utf16_stream_scan_end_of_string_avx512bw(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	__m512i value_512bit;
+
+	while( ( stream_index + 64 ) <= utf16_stream_size )
+	{
+		value_512bit = _mm512_loadu_si512(
+		                (const void *) &( utf16_stream[ stream_index ] ) );
+
+		if( _mm512_testn_epi16_mask(
+		     value_512bit,
+		     value_512bit ) != 0 )
+		{
+			break;
+		}
+		stream_index += 64;
+	}
+	return( stream_index );
+}
+
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+#if defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+
+/* Scans a little-endian UTF-16 stream 8 characters at a time using NEON
+ * for a block that contains a character outside the ASCII range or an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+size_t libscca_utf16_stream_scan_ascii_neon(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	uint16x8_t ascii_mask = vdupq_n_u16( 0xff80 );
+	uint16x8_t value_128bit;
+
+	while( ( stream_index + 16 ) <= utf16_stream_size )
+	{
+		value_128bit = vreinterpretq_u16_u8(
+		                vld1q_u8(
+		                 &( utf16_stream[ stream_index ] ) ) );
+
+		if( ( vmaxvq_u16(
+		       vandq_u16(
+		        value_128bit,
+		        ascii_mask ) ) != 0 )
+		 || ( vminvq_u16(
+		       value_128bit ) == 0 ) )
+		{
+			break;
+		}
+		stream_index += 16;
+	}
+	return( stream_index );
+}
+
+/* Scans a little-endian UTF-16 stream 8 characters at a time using NEON
+ * for a block that contains an end of string character
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+size_t libscca_utf16_stream_scan_end_of_string_neon(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+	uint16x8_t value_128bit;
+
+	while( ( stream_index + 16 ) <= utf16_stream_size )
+	{
+		value_128bit = vreinterpretq_u16_u8(
+		                vld1q_u8(
+		                 &( utf16_stream[ stream_index ] ) ) );
+
+		if( vminvq_u16(
+		     value_128bit ) == 0 )
+		{
+			break;
+		}
+		stream_index += 16;
+	}
+	return( stream_index );
+}
+
+#endif /* defined( LIBSCCA_CPU_HAVE_NEON_KERNELS ) */
+
+/* Scans a little-endian UTF-16 stream for a block that contains a character
+ * outside the ASCII range or an end of string character
+ * The widest kernel the processor supports is selected at runtime
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+size_t libscca_utf16_stream_scan_ascii(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) || defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	uint32_t cpu_features = libscca_cpu_get_features();
+#endif
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+	if( ( cpu_features & LIBSCCA_CPU_FEATURE_AVX512BW ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_ascii_avx512bw(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+	else if( ( cpu_features & LIBSCCA_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_ascii_avx2(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+	else if( ( cpu_features & LIBSCCA_CPU_FEATURE_SSE2 ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_ascii_sse2(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+#elif defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	if( ( cpu_features & LIBSCCA_CPU_FEATURE_NEON ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_ascii_neon(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+#endif
+	/* The portable kernel scans the remainder smaller than a vector block
+	 */
+	return( libscca_utf16_stream_scan_ascii_word(
+	         utf16_stream,
+	         utf16_stream_size,
+	         stream_index ) );
+}
+
+/* Scans a little-endian UTF-16 stream for a block that contains an end of string character
+ * The widest kernel the processor supports is selected at runtime
+ * Returns the stream index of the block or of the remainder smaller than a block
+ */
+size_t libscca_utf16_stream_scan_end_of_string(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index )
+{
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) || defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	uint32_t cpu_features = libscca_cpu_get_features();
+#endif
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+	if( ( cpu_features & LIBSCCA_CPU_FEATURE_AVX512BW ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_end_of_string_avx512bw(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+	else if( ( cpu_features & LIBSCCA_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_end_of_string_avx2(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+	else if( ( cpu_features & LIBSCCA_CPU_FEATURE_SSE2 ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_end_of_string_sse2(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+#elif defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	if( ( cpu_features & LIBSCCA_CPU_FEATURE_NEON ) != 0 )
+	{
+		stream_index = libscca_utf16_stream_scan_end_of_string_neon(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+	}
+#endif
+	/* The portable kernel scans the remainder smaller than a vector block
+	 */
+	return( libscca_utf16_stream_scan_end_of_string_word(
+	         utf16_stream,
+	         utf16_stream_size,
+	         stream_index ) );
+}
+
+/* Determines if a little-endian UTF-16 stream only contains ASCII characters
+ * The stream is scanned a block at a time and only the block that contains
+ * a character outside the ASCII range or an end of string character is
+ * inspected per character
+ * The length does not include the end of string character
+ * Returns 1 if the stream only contains ASCII characters, 0 if not or -1 on error
+ */
+int libscca_utf16_stream_get_ascii_length(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *ascii_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_utf16_stream_get_ascii_length";
+	size_t stream_index   = 0;
+	uint16_t value_16bit  = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	/* Leave streams with an odd size to libuna so that they are handled consistently
+	 */
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		return( 0 );
+	}
+	stream_index = libscca_utf16_stream_scan_ascii(
+	                utf16_stream,
+	                utf16_stream_size,
+	                0 );
+
+	while( ( stream_index + 1 ) < utf16_stream_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ stream_index ] ),
+		 value_16bit );
+
+		if( value_16bit == 0 )
+		{
+			break;
+		}
+		if( value_16bit > 0x007f )
+		{
+			return( 0 );
+		}
+		stream_index += 2;
+	}
+	*ascii_length = stream_index / 2;
+
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from a little-endian UTF-16 stream
+ * Streams that only contain ASCII characters are handled without libuna
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_utf16_stream_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_utf16_stream_get_utf8_string_size";
+	size_t ascii_length   = 0;
+	int result            = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_utf16_stream_get_ascii_length(
+	          utf16_stream,
+	          utf16_stream_size,
+	          &ascii_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*utf8_string_size = ascii_length + 1;
+
+		return( 1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from a little-endian UTF-16 stream
+ * Streams that only contain ASCII characters are narrowed without libuna
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_utf16_stream_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_utf16_stream_copy_to_utf8_string";
+	size_t ascii_length   = 0;
+	size_t string_index   = 0;
+	int result            = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_utf16_stream_get_ascii_length(
+	          utf16_stream,
+	          utf16_stream_size,
+	          &ascii_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ascii_length >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		for( string_index = 0;
+		     string_index < ascii_length;
+		     string_index++ )
+		{
+			utf8_string[ string_index ] = utf16_stream[ string_index * 2 ];
+		}
+		utf8_string[ string_index ] = 0;
+
+		return( 1 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the offsets of the strings in a little-endian UTF-16 stream
+ * that contains multiple end of string character terminated strings
+ * The stream is scanned a block at a time and only blocks that contain
+ * an end of string character are inspected per character
+ * A remainder without an end of string character is considered a string as well
+ * If string_offsets is NULL only the number of strings is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_utf16_stream_get_string_offsets(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *string_offsets,
+     int number_of_string_offsets,
+     int *number_of_strings,
+     libcerror_error_t **error )
+{
+	static char *function      = "libscca_utf16_stream_get_string_offsets";
+	size_t stream_index        = 0;
+	size_t string_index        = 0;
+	size_t string_start_offset = 0;
+	uint8_t is_end_of_string   = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_string_offsets < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of string offsets value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of strings.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( stream_index + 1 ) < utf16_stream_size )
+	{
+		stream_index = libscca_utf16_stream_scan_end_of_string(
+		                utf16_stream,
+		                utf16_stream_size,
+		                stream_index );
+
+		/* Inspect the characters of a block that contains an end of string character
+		 * or the remaining characters of the stream one at a time
+		 */
+		is_end_of_string = 0;
+
+		while( ( is_end_of_string == 0 )
+		    && ( ( stream_index + 1 ) < utf16_stream_size ) )
+		{
+			if( ( utf16_stream[ stream_index ] == 0 )
+			 && ( utf16_stream[ stream_index + 1 ] == 0 ) )
+			{
+				is_end_of_string = 1;
+
+				if( string_offsets != NULL )
+				{
+					if( string_index >= (size_t) number_of_string_offsets )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: invalid number of string offsets value too small.",
+						 function );
+
+						return( -1 );
+					}
+					string_offsets[ string_index ] = (uint32_t) string_start_offset;
+				}
+				string_index++;
+
+				string_start_offset = stream_index + 2;
+			}
+			stream_index += 2;
+		}
+	}
+	if( string_start_offset < utf16_stream_size )
+	{
+		if( string_offsets != NULL )
+		{
+			if( string_index >= (size_t) number_of_string_offsets )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid number of string offsets value too small.",
+				 function );
+
+				return( -1 );
+			}
+			string_offsets[ string_index ] = (uint32_t) string_start_offset;
+		}
+		string_index++;
+	}
+	if( string_index > (size_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of strings value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_strings = (int) string_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,135 @@
+/*
+ * UTF-16 stream functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_UTF16_STREAM_H )
+#define _LIBSCCA_UTF16_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_cpu.h"
+#include "libscca_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+size_t libscca_utf16_stream_scan_ascii_word(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_end_of_string_word(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+#if defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+
+size_t libscca_utf16_stream_scan_ascii_sse2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_end_of_string_sse2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_ascii_avx2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_end_of_string_avx2(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_ascii_avx512bw(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_end_of_string_avx512bw(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+#endif /* defined( LIBSCCA_CPU_HAVE_X86_KERNELS ) */
+
+#if defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+
+size_t libscca_utf16_stream_scan_ascii_neon(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_end_of_string_neon(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+#endif /* defined( LIBSCCA_CPU_HAVE_NEON_KERNELS ) */
+
+size_t libscca_utf16_stream_scan_ascii(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+size_t libscca_utf16_stream_scan_end_of_string(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size,
+        size_t stream_index );
+
+int libscca_utf16_stream_get_ascii_length(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *ascii_length,
+     libcerror_error_t **error );
+
+int libscca_utf16_stream_get_utf8_string_size(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libscca_utf16_stream_copy_to_utf8_string(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libscca_utf16_stream_get_string_offsets(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint32_t *string_offsets,
+     int number_of_string_offsets,
+     int *number_of_strings,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_UTF16_STREAM_H ) */
+
@@ -0,0 +1,1134 @@
+/*
+ * Shared volume dictionary functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_arena.h"
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_libuna.h"
+#include "libscca_memory.h"
+#include "libscca_utf16_stream.h"
+#include "libscca_volume_dictionary.h"
+
+/* Creates a volume dictionary
+ * Make sure the value volume_dictionary is referencing, is set to NULL
+ * The volume dictionary can be shared between files, see libscca_file_set_volume_dictionary,
+ * and assigns every distinct volume a stable identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_initialize(
+     libscca_volume_dictionary_t **volume_dictionary,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_dictionary_t *internal_volume_dictionary = NULL;
+	static char *function                                            = "libscca_volume_dictionary_initialize";
+
+	if( volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_dictionary != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume dictionary value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_dictionary = memory_allocate_structure(
+	                        libscca_internal_volume_dictionary_t );
+
+	if( internal_volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create volume dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_volume_dictionary,
+	     0,
+	     sizeof( libscca_internal_volume_dictionary_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume dictionary.",
+		 function );
+
+		memory_free(
+		 internal_volume_dictionary );
+
+		return( -1 );
+	}
+	if( libscca_arena_initialize(
+	     &( internal_volume_dictionary->arena ),
+	     LIBSCCA_ARENA_DEFAULT_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_internal_volume_dictionary_resize_buckets(
+	     internal_volume_dictionary,
+	     LIBSCCA_VOLUME_DICTIONARY_MINIMUM_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_volume_dictionary->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*volume_dictionary = (libscca_volume_dictionary_t *) internal_volume_dictionary;
+
+	return( 1 );
+
+on_error:
+	if( internal_volume_dictionary != NULL )
+	{
+		if( internal_volume_dictionary->buckets != NULL )
+		{
+			memory_free(
+			 internal_volume_dictionary->buckets );
+		}
+		if( internal_volume_dictionary->arena != NULL )
+		{
+			libscca_arena_free(
+			 &( internal_volume_dictionary->arena ),
+			 NULL );
+		}
+		memory_free(
+		 internal_volume_dictionary );
+	}
+	return( -1 );
+}
+
+/* Frees a volume dictionary
+ * The volume dictionary must not be freed while it is set for a file,
+ * the volume identifiers of the files that were opened with it remain valid
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_free(
+     libscca_volume_dictionary_t **volume_dictionary,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_dictionary_t *internal_volume_dictionary = NULL;
+	static char *function                                            = "libscca_volume_dictionary_free";
+	int result                                                       = 1;
+
+	if( volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_dictionary != NULL )
+	{
+		internal_volume_dictionary = (libscca_internal_volume_dictionary_t *) *volume_dictionary;
+		*volume_dictionary         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_volume_dictionary->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_volume_dictionary->buckets != NULL )
+		{
+			memory_free(
+			 internal_volume_dictionary->buckets );
+		}
+		if( internal_volume_dictionary->entries != NULL )
+		{
+			memory_free(
+			 internal_volume_dictionary->entries );
+		}
+		if( libscca_arena_free(
+		     &( internal_volume_dictionary->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_volume_dictionary );
+	}
+	return( result );
+}
+
+/* Resizes the buckets of the volume dictionary
+ * The entries are linked into the new buckets using their stored hash
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_volume_dictionary_resize_buckets(
+     libscca_internal_volume_dictionary_t *internal_volume_dictionary,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	uint32_t *buckets     = NULL;
+	static char *function = "libscca_internal_volume_dictionary_resize_buckets";
+	uint32_t bucket_index = 0;
+	uint32_t entry_index  = 0;
+
+	if( internal_volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets == 0 )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (uint32_t *) memory_allocate(
+	                        sizeof( uint32_t ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( uint32_t ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_volume_dictionary->number_of_entries;
+	     entry_index++ )
+	{
+		bucket_index = (uint32_t) ( internal_volume_dictionary->entries[ entry_index ].hash & ( number_of_buckets - 1 ) );
+
+		internal_volume_dictionary->entries[ entry_index ].next_entry_index = buckets[ bucket_index ];
+
+		buckets[ bucket_index ] = entry_index + 1;
+	}
+	if( internal_volume_dictionary->buckets != NULL )
+	{
+		memory_free(
+		 internal_volume_dictionary->buckets );
+	}
+	internal_volume_dictionary->buckets           = buckets;
+	internal_volume_dictionary->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Finds an entry in the volume dictionary
+ * The mutex must be grabbed by the caller
+ * Returns 1 if found or 0 if not
+ */
+int libscca_internal_volume_dictionary_find_entry(
+     libscca_internal_volume_dictionary_t *internal_volume_dictionary,
+     uint64_t hash,
+     const uint8_t *device_path,
+     size_t device_path_size,
+     uint32_t serial_number,
+     uint64_t creation_time,
+     uint32_t *volume_identifier )
+{
+	libscca_volume_dictionary_entry_t *entry = NULL;
+	uint32_t entry_index                     = 0;
+
+	entry_index = internal_volume_dictionary->buckets[ hash & ( internal_volume_dictionary->number_of_buckets - 1 ) ];
+
+	while( entry_index != 0 )
+	{
+		entry = &( internal_volume_dictionary->entries[ entry_index - 1 ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->serial_number == serial_number )
+		 && ( entry->creation_time == creation_time )
+		 && ( (size_t) entry->device_path_size == device_path_size ) )
+		{
+			if( ( device_path_size == 0 )
+			 || ( memory_compare(
+			       entry->device_path,
+			       device_path,
+			       device_path_size ) == 0 ) )
+			{
+				*volume_identifier = entry_index - 1;
+
+				return( 1 );
+			}
+		}
+		entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Appends an entry to the volume dictionary
+ * The device path is copied into the arena
+ * The mutex must be grabbed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_volume_dictionary_append_entry(
+     libscca_internal_volume_dictionary_t *internal_volume_dictionary,
+     uint64_t hash,
+     const uint8_t *device_path,
+     size_t device_path_size,
+     uint32_t serial_number,
+     uint64_t creation_time,
+     uint32_t *volume_identifier,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t *entries = NULL;
+	libscca_volume_dictionary_entry_t *entry   = NULL;
+	uint8_t *entry_device_path                 = NULL;
+	static char *function                      = "libscca_internal_volume_dictionary_append_entry";
+	uint32_t bucket_index                      = 0;
+	uint32_t number_of_allocated_entries       = 0;
+
+	if( internal_volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid device path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The volume identifiers are returned as int
+	 */
+	if( internal_volume_dictionary->number_of_entries >= (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_dictionary->number_of_entries >= internal_volume_dictionary->number_of_allocated_entries )
+	{
+		if( internal_volume_dictionary->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = LIBSCCA_VOLUME_DICTIONARY_MINIMUM_NUMBER_OF_BUCKETS;
+		}
+		else
+		{
+			number_of_allocated_entries = internal_volume_dictionary->number_of_allocated_entries * 2;
+		}
+		if( ( number_of_allocated_entries <= internal_volume_dictionary->number_of_allocated_entries )
+		 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libscca_volume_dictionary_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libscca_volume_dictionary_entry_t *) memory_reallocate(
+		                                                 internal_volume_dictionary->entries,
+		                                                 sizeof( libscca_volume_dictionary_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_volume_dictionary->entries                     = entries;
+		internal_volume_dictionary->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	/* Keep the average bucket chain shorter than 1 entry
+	 */
+	if( internal_volume_dictionary->number_of_entries >= internal_volume_dictionary->number_of_buckets )
+	{
+		if( libscca_internal_volume_dictionary_resize_buckets(
+		     internal_volume_dictionary,
+		     internal_volume_dictionary->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( device_path_size > 0 )
+	{
+		if( libscca_arena_allocate(
+		     internal_volume_dictionary->arena,
+		     device_path_size,
+		     &entry_device_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to allocate entry device path.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     entry_device_path,
+		     device_path,
+		     device_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry device path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_index = (uint32_t) ( hash & ( internal_volume_dictionary->number_of_buckets - 1 ) );
+
+	entry = &( internal_volume_dictionary->entries[ internal_volume_dictionary->number_of_entries ] );
+
+	entry->hash             = hash;
+	entry->device_path      = entry_device_path;
+	entry->device_path_size = (uint32_t) device_path_size;
+	entry->serial_number    = serial_number;
+	entry->creation_time    = creation_time;
+	entry->next_entry_index = internal_volume_dictionary->buckets[ bucket_index ];
+
+	*volume_identifier = internal_volume_dictionary->number_of_entries;
+
+	internal_volume_dictionary->number_of_entries += 1;
+
+	internal_volume_dictionary->buckets[ bucket_index ] = internal_volume_dictionary->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the identifier of a volume in the volume dictionary
+ * A volume is identified by its device path, serial number and creation time,
+ * a volume that is not in the dictionary is added and retains its identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_volume_identifier(
+     libscca_volume_dictionary_t *volume_dictionary,
+     const uint8_t *device_path,
+     size_t device_path_size,
+     uint32_t serial_number,
+     uint64_t creation_time,
+     uint32_t *volume_identifier,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_dictionary_t *internal_volume_dictionary = NULL;
+	static char *function                                            = "libscca_volume_dictionary_get_volume_identifier";
+	uint64_t hash                                                    = 0;
+	uint64_t seed                                                    = 0;
+	int result                                                       = 0;
+
+	if( volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_dictionary = (libscca_internal_volume_dictionary_t *) volume_dictionary;
+
+	if( ( device_path == NULL )
+	 && ( device_path_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume identifier.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash is calculated before the mutex is grabbed
+	 */
+	seed = creation_time ^ ( (uint64_t) serial_number << 32 );
+	hash = seed;
+
+	if( device_path_size > 0 )
+	{
+		if( libscca_hash_calculate_xxh64(
+		     device_path,
+		     device_path_size,
+		     seed,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_volume_dictionary->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libscca_internal_volume_dictionary_find_entry(
+	          internal_volume_dictionary,
+	          hash,
+	          device_path,
+	          device_path_size,
+	          serial_number,
+	          creation_time,
+	          volume_identifier );
+
+	if( result == 0 )
+	{
+		result = libscca_internal_volume_dictionary_append_entry(
+		          internal_volume_dictionary,
+		          hash,
+		          device_path,
+		          device_path_size,
+		          serial_number,
+		          creation_time,
+		          volume_identifier,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_volume_dictionary->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a copy of a specific entry in the volume dictionary
+ * The device path is referenced and not copied, it remains valid until the volume dictionary is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_entry(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     libscca_volume_dictionary_entry_t *entry,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_dictionary_t *internal_volume_dictionary = NULL;
+	static char *function                                            = "libscca_volume_dictionary_get_entry";
+	int result                                                       = 1;
+
+	if( volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_dictionary = (libscca_internal_volume_dictionary_t *) volume_dictionary;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The entries can be reallocated while another file adds a volume
+	 */
+	if( libcthreads_mutex_grab(
+	     internal_volume_dictionary->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( volume_identifier < 0 )
+	 || ( (uint32_t) volume_identifier >= internal_volume_dictionary->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume identifier value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*entry = internal_volume_dictionary->entries[ volume_identifier ];
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_volume_dictionary->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of volumes in the volume dictionary
+ * The volume identifiers range from 0 to the number of volumes - 1
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_number_of_volumes(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_dictionary_t *internal_volume_dictionary = NULL;
+	static char *function                                            = "libscca_volume_dictionary_get_number_of_volumes";
+
+	if( volume_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_dictionary = (libscca_internal_volume_dictionary_t *) volume_dictionary;
+
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_volume_dictionary->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_volumes = (int) internal_volume_dictionary->number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_volume_dictionary->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the serial number of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_serial_number(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint32_t *serial_number,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t entry;
+
+	static char *function = "libscca_volume_dictionary_get_serial_number";
+
+	if( serial_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_volume_dictionary_get_entry(
+	     volume_dictionary,
+	     volume_identifier,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_identifier );
+
+		return( -1 );
+	}
+	*serial_number = entry.serial_number;
+
+	return( 1 );
+}
+
+/* Retrieves the 64-bit FILETIME value containing the creation date and time of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_creation_time(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t entry;
+
+	static char *function = "libscca_volume_dictionary_get_creation_time";
+
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_volume_dictionary_get_entry(
+	     volume_dictionary,
+	     volume_identifier,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_identifier );
+
+		return( -1 );
+	}
+	*filetime = entry.creation_time;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded device path of a specific volume
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_utf8_device_path_size(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t entry;
+
+	static char *function = "libscca_volume_dictionary_get_utf8_device_path_size";
+
+	if( libscca_volume_dictionary_get_entry(
+	     volume_dictionary,
+	     volume_identifier,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_identifier );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     entry.device_path,
+	     (size_t) entry.device_path_size,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded device path of a specific volume
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_utf8_device_path(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t entry;
+
+	static char *function = "libscca_volume_dictionary_get_utf8_device_path";
+
+	if( libscca_volume_dictionary_get_entry(
+	     volume_dictionary,
+	     volume_identifier,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_identifier );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_copy_to_utf8_string(
+	     entry.device_path,
+	     (size_t) entry.device_path_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy device path to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded device path of a specific volume
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_utf16_device_path_size(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t entry;
+
+	static char *function = "libscca_volume_dictionary_get_utf16_device_path_size";
+
+	if( libscca_volume_dictionary_get_entry(
+	     volume_dictionary,
+	     volume_identifier,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_identifier );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     entry.device_path,
+	     (size_t) entry.device_path_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded device path of a specific volume
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_dictionary_get_utf16_device_path(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_volume_dictionary_entry_t entry;
+
+	static char *function = "libscca_volume_dictionary_get_utf16_device_path";
+
+	if( libscca_volume_dictionary_get_entry(
+	     volume_dictionary,
+	     volume_identifier,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume: %d.",
+		 function,
+		 volume_identifier );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     entry.device_path,
+	     (size_t) entry.device_path_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy device path to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
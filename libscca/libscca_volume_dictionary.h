@@ -0,0 +1,212 @@
+/*
+ * Shared volume dictionary functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_VOLUME_DICTIONARY_H )
+#define _LIBSCCA_VOLUME_DICTIONARY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_arena.h"
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of buckets of the volume dictionary, which must be a power of 2
+ */
+#define LIBSCCA_VOLUME_DICTIONARY_MINIMUM_NUMBER_OF_BUCKETS	64
+
+typedef struct libscca_volume_dictionary_entry libscca_volume_dictionary_entry_t;
+
+struct libscca_volume_dictionary_entry
+{
+	/* The XXH64 hash of the device path, seeded with the serial number and creation time
+	 */
+	uint64_t hash;
+
+	/* The UTF-16 little-endian device path, which is stored in the arena
+	 */
+	const uint8_t *device_path;
+
+	/* The device path size
+	 */
+	uint32_t device_path_size;
+
+	/* The serial number
+	 */
+	uint32_t serial_number;
+
+	/* The creation time
+	 */
+	uint64_t creation_time;
+
+	/* The index of the next entry in the same bucket + 1 or 0 if not set
+	 */
+	uint32_t next_entry_index;
+};
+
+typedef struct libscca_internal_volume_dictionary libscca_internal_volume_dictionary_t;
+
+struct libscca_internal_volume_dictionary
+{
+	/* The arena that contains the device paths
+	 * The device paths are never moved hence they can be referenced until the volume dictionary is freed
+	 */
+	libscca_arena_t *arena;
+
+	/* The entries, where the volume identifier is the index of the entry
+	 */
+	libscca_volume_dictionary_entry_t *entries;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	uint32_t number_of_allocated_entries;
+
+	/* The buckets, which contain the index of the first entry + 1 or 0 if not set
+	 */
+	uint32_t *buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The volume dictionary is shared between files, which can be read on different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_initialize(
+     libscca_volume_dictionary_t **volume_dictionary,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_free(
+     libscca_volume_dictionary_t **volume_dictionary,
+     libcerror_error_t **error );
+
+int libscca_internal_volume_dictionary_resize_buckets(
+     libscca_internal_volume_dictionary_t *internal_volume_dictionary,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error );
+
+int libscca_internal_volume_dictionary_find_entry(
+     libscca_internal_volume_dictionary_t *internal_volume_dictionary,
+     uint64_t hash,
+     const uint8_t *device_path,
+     size_t device_path_size,
+     uint32_t serial_number,
+     uint64_t creation_time,
+     uint32_t *volume_identifier );
+
+int libscca_internal_volume_dictionary_append_entry(
+     libscca_internal_volume_dictionary_t *internal_volume_dictionary,
+     uint64_t hash,
+     const uint8_t *device_path,
+     size_t device_path_size,
+     uint32_t serial_number,
+     uint64_t creation_time,
+     uint32_t *volume_identifier,
+     libcerror_error_t **error );
+
+int libscca_volume_dictionary_get_volume_identifier(
+     libscca_volume_dictionary_t *volume_dictionary,
+     const uint8_t *device_path,
+     size_t device_path_size,
+     uint32_t serial_number,
+     uint64_t creation_time,
+     uint32_t *volume_identifier,
+     libcerror_error_t **error );
+
+int libscca_volume_dictionary_get_entry(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     libscca_volume_dictionary_entry_t *entry,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_number_of_volumes(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int *number_of_volumes,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_serial_number(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint32_t *serial_number,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_creation_time(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_utf8_device_path_size(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_utf8_device_path(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_utf16_device_path_size(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_dictionary_get_utf16_device_path(
+     libscca_volume_dictionary_t *volume_dictionary,
+     int volume_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_VOLUME_DICTIONARY_H ) */
+
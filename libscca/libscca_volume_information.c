@@ -20,13 +20,18 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libscca_byte_stream.h"
 #include "libscca_definitions.h"
 #include "libscca_libcerror.h"
-#include "libscca_libfvalue.h"
+#include "libscca_libcthreads.h"
 #include "libscca_libuna.h"
+#include "libscca_memory.h"
+#include "libscca_string_pool.h"
+#include "libscca_utf16_stream.h"
 #include "libscca_volume_information.h"
 
 /* Creates volume information
@@ -138,7 +143,6 @@ int libscca_internal_volume_information_free(
      libcerror_error_t **error )
 {
 	static char *function = "libscca_internal_volume_information_free";
-	int result            = 1;
 
 	if( internal_volume_information == NULL )
 	{
@@ -153,33 +157,87 @@ int libscca_internal_volume_information_free(
 	}
 	if( *internal_volume_information != NULL )
 	{
-		if( ( *internal_volume_information )->device_path != NULL )
-		{
-			memory_free(
-			 ( *internal_volume_information )->device_path );
-		}
-		if( ( *internal_volume_information )->directory_strings != NULL )
-		{
-			if( libfvalue_value_free(
-			     &( ( *internal_volume_information )->directory_strings ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory strings.",
-				 function );
-
-				result = -1;
-			}
-		}
+		/* The device path, file references and directory strings are not owned
+		 * by the volume information
+		 */
 		memory_free(
 		 ( *internal_volume_information ) );
 
 		*internal_volume_information = NULL;
 	}
-	return( result );
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian device path data
+ * The data is referenced and not copied, an interned device path is retrieved from the string pool
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_volume_information_get_device_path_data(
+     libscca_internal_volume_information_t *internal_volume_information,
+     const uint8_t **device_path,
+     size_t *device_path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_internal_volume_information_get_device_path_data";
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->string_pool != NULL )
+	{
+		if( libscca_string_pool_get_string(
+		     internal_volume_information->string_pool,
+		     internal_volume_information->device_path_string_identifier,
+		     device_path,
+		     device_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve device path from string pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*device_path      = internal_volume_information->device_path;
+		*device_path_size = (size_t) internal_volume_information->device_path_size;
+	}
+	return( 1 );
 }
 
 /* Retrieves the 64-bit FILETIME value containing the volume creation date and time
@@ -272,7 +330,9 @@ int libscca_volume_information_get_utf8_device_path_size(
      libcerror_error_t **error )
 {
 	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *device_path                                         = NULL;
 	static char *function                                              = "libscca_volume_information_get_utf8_device_path_size";
+	size_t device_path_size                                            = 0;
 
 	if( volume_information == NULL )
 	{
@@ -287,10 +347,24 @@ int libscca_volume_information_get_utf8_device_path_size(
 	}
 	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
 
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_volume_information->device_path,
-	     internal_volume_information->device_path_size,
-	     LIBUNA_ENDIAN_LITTLE,
+	if( libscca_internal_volume_information_get_device_path_data(
+	     internal_volume_information,
+	     &device_path,
+	     &device_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     device_path,
+	     device_path_size,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -317,7 +391,9 @@ int libscca_volume_information_get_utf8_device_path(
      libcerror_error_t **error )
 {
 	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *device_path                                         = NULL;
 	static char *function                                              = "libscca_volume_information_get_utf8_device_path";
+	size_t device_path_size                                            = 0;
 
 	if( volume_information == NULL )
 	{
@@ -332,12 +408,26 @@ int libscca_volume_information_get_utf8_device_path(
 	}
 	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
 
-	if( libuna_utf8_string_copy_from_utf16_stream(
+	if( libscca_internal_volume_information_get_device_path_data(
+	     internal_volume_information,
+	     &device_path,
+	     &device_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_copy_to_utf8_string(
+	     device_path,
+	     device_path_size,
 	     utf8_string,
 	     utf8_string_size,
-	     internal_volume_information->device_path,
-	     internal_volume_information->device_path_size,
-	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -362,7 +452,9 @@ int libscca_volume_information_get_utf16_device_path_size(
      libcerror_error_t **error )
 {
 	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *device_path                                         = NULL;
 	static char *function                                              = "libscca_volume_information_get_utf16_device_path_size";
+	size_t device_path_size                                            = 0;
 
 	if( volume_information == NULL )
 	{
@@ -377,9 +469,24 @@ int libscca_volume_information_get_utf16_device_path_size(
 	}
 	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
 
+	if( libscca_internal_volume_information_get_device_path_data(
+	     internal_volume_information,
+	     &device_path,
+	     &device_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path data.",
+		 function );
+
+		return( -1 );
+	}
 	if( libuna_utf16_string_size_from_utf16_stream(
-	     internal_volume_information->device_path,
-	     internal_volume_information->device_path_size,
+	     device_path,
+	     device_path_size,
 	     LIBUNA_ENDIAN_LITTLE,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -407,7 +514,9 @@ int libscca_volume_information_get_utf16_device_path(
      libcerror_error_t **error )
 {
 	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *device_path                                         = NULL;
 	static char *function                                              = "libscca_volume_information_get_utf16_device_path";
+	size_t device_path_size                                            = 0;
 
 	if( volume_information == NULL )
 	{
@@ -422,11 +531,26 @@ int libscca_volume_information_get_utf16_device_path(
 	}
 	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
 
+	if( libscca_internal_volume_information_get_device_path_data(
+	     internal_volume_information,
+	     &device_path,
+	     &device_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path data.",
+		 function );
+
+		return( -1 );
+	}
 	if( libuna_utf16_string_copy_from_utf16_stream(
 	     utf16_string,
 	     utf16_string_size,
-	     internal_volume_information->device_path,
-	     internal_volume_information->device_path_size,
+	     device_path,
+	     device_path_size,
 	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
@@ -442,3 +566,736 @@ int libscca_volume_information_get_utf16_device_path(
 	return( 1 );
 }
 
+/* Retrieves the UTF-16 little-endian stream of the device path
+ * The stream references the device path as stored in the volume information, without
+ * an end-of-string character, no memory is allocated and it remains valid until the file
+ * is closed or updated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_utf16_device_path_stream(
+     libscca_volume_information_t *volume_information,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libscca_volume_information_get_utf16_device_path_stream";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( libscca_internal_volume_information_get_device_path_data(
+	     internal_volume_information,
+	     utf16_stream,
+	     utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device path data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Retrieves the number of file references
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_number_of_file_references(
+     libscca_volume_information_t *volume_information,
+     int *number_of_file_references,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libscca_volume_information_get_number_of_file_references";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( number_of_file_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file references.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_file_references = internal_volume_information->number_of_file_references;
+
+	return( 1 );
+}
+
+/* Copies the 64-bit NTFS file references
+ * The number of file references must be equal to or greater than the number of file references of the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_copy_file_references(
+     libscca_volume_information_t *volume_information,
+     uint64_t *file_references,
+     int number_of_file_references,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libscca_volume_information_copy_file_references";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( file_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file references.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_references < internal_volume_information->number_of_file_references )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid number of file references value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_information->number_of_file_references == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     file_references,
+	     internal_volume_information->file_references,
+	     sizeof( uint64_t ) * internal_volume_information->number_of_file_references ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file references.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the directory string offsets
+ * The directory strings array was validated when the volumes information was read,
+ * hence the offsets are only determined on first access of a directory string
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_volume_information_read_directory_string_offsets(
+     libscca_internal_volume_information_t *internal_volume_information,
+     libcerror_error_t **error )
+{
+	static char *function          = "libscca_internal_volume_information_read_directory_string_offsets";
+	size_t directory_string_offset = 0;
+	uint16_t number_of_characters  = 0;
+	int directory_string_index     = 0;
+	int result                     = 1;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_volume_information->directory_strings_data == NULL )
+	 || ( internal_volume_information->directory_string_offsets == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume information - missing directory strings data or offsets.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_volume_information->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_volume_information->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( internal_volume_information->directory_string_offsets_are_set == 0 )
+	{
+		for( directory_string_index = 0;
+		     directory_string_index < internal_volume_information->number_of_directory_strings;
+		     directory_string_index++ )
+		{
+			if( ( directory_string_offset + 2 ) > internal_volume_information->directory_strings_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid directory string: %d offset value out of bounds.",
+				 function,
+				 directory_string_index );
+
+				result = -1;
+
+				break;
+			}
+			libscca_byte_stream_copy_to_uint16_little_endian(
+			 &( internal_volume_information->directory_strings_data[ directory_string_offset ] ),
+			 number_of_characters );
+
+			internal_volume_information->directory_string_offsets[ directory_string_index ] = (uint32_t) directory_string_offset;
+
+			directory_string_offset += 2 + ( (size_t) number_of_characters * 2 ) + 2;
+		}
+		if( result == 1 )
+		{
+			internal_volume_information->directory_string_offsets_are_set = 1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_volume_information->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     internal_volume_information->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data of a specific directory string
+ * The data is UTF-16 little-endian and includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_volume_information_get_directory_string_data(
+     libscca_internal_volume_information_t *internal_volume_information,
+     int directory_string_index,
+     const uint8_t **directory_string_data,
+     size_t *directory_string_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libscca_internal_volume_information_get_directory_string_data";
+	size_t string_data_offset     = 0;
+	size_t string_data_size       = 0;
+	uint16_t number_of_characters = 0;
+
+	if( internal_volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_string_index < 0 )
+	 || ( directory_string_index >= internal_volume_information->number_of_directory_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_string_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory string data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_volume_information_read_directory_string_offsets(
+	     internal_volume_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	string_data_offset = (size_t) internal_volume_information->directory_string_offsets[ directory_string_index ];
+
+	if( ( internal_volume_information->directory_strings_data_size < 2 )
+	 || ( string_data_offset > ( internal_volume_information->directory_strings_data_size - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory string: %d offset value out of bounds.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	libscca_byte_stream_copy_to_uint16_little_endian(
+	 &( internal_volume_information->directory_strings_data[ string_data_offset ] ),
+	 number_of_characters );
+
+	string_data_offset += 2;
+
+	/* The number of characters does not include the end-of-string character
+	 */
+	string_data_size = ( (size_t) number_of_characters * 2 ) + 2;
+
+	if( string_data_size > ( internal_volume_information->directory_strings_data_size - string_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory string: %d size value out of bounds.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	*directory_string_data      = &( internal_volume_information->directory_strings_data[ string_data_offset ] );
+	*directory_string_data_size = string_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of directory strings
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_number_of_directory_strings(
+     libscca_volume_information_t *volume_information,
+     int *number_of_directory_strings,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libscca_volume_information_get_number_of_directory_strings";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( number_of_directory_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directory strings.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directory_strings = internal_volume_information->number_of_directory_strings;
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded directory string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_utf8_directory_string_size(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *directory_string_data                               = NULL;
+	static char *function                                              = "libscca_volume_information_get_utf8_directory_string_size";
+	size_t directory_string_data_size                                  = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( libscca_internal_volume_information_get_directory_string_data(
+	     internal_volume_information,
+	     directory_string_index,
+	     &directory_string_data,
+	     &directory_string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d data.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_get_utf8_string_size(
+	     directory_string_data,
+	     directory_string_data_size,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d UTF-8 string size.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded directory string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_utf8_directory_string(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *directory_string_data                               = NULL;
+	static char *function                                              = "libscca_volume_information_get_utf8_directory_string";
+	size_t directory_string_data_size                                  = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( libscca_internal_volume_information_get_directory_string_data(
+	     internal_volume_information,
+	     directory_string_index,
+	     &directory_string_data,
+	     &directory_string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d data.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	if( libscca_utf16_stream_copy_to_utf8_string(
+	     directory_string_data,
+	     directory_string_data_size,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory string: %d to UTF-8 string.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-16 encoded directory string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_utf16_directory_string_size(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *directory_string_data                               = NULL;
+	static char *function                                              = "libscca_volume_information_get_utf16_directory_string_size";
+	size_t directory_string_data_size                                  = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( libscca_internal_volume_information_get_directory_string_data(
+	     internal_volume_information,
+	     directory_string_index,
+	     &directory_string_data,
+	     &directory_string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d data.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     directory_string_data,
+	     directory_string_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d UTF-16 string size.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-16 encoded directory string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_utf16_directory_string(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	const uint8_t *directory_string_data                               = NULL;
+	static char *function                                              = "libscca_volume_information_get_utf16_directory_string";
+	size_t directory_string_data_size                                  = 0;
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( libscca_internal_volume_information_get_directory_string_data(
+	     internal_volume_information,
+	     directory_string_index,
+	     &directory_string_data,
+	     &directory_string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d data.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     directory_string_data,
+	     directory_string_data_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory string: %d to UTF-16 string.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian stream of a specific directory string
+ * The stream references the directory string as stored in the volume information, including
+ * the end-of-string character, no memory is allocated and it remains valid until the file
+ * is closed or updated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volume_information_get_utf16_directory_string_stream(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libscca_internal_volume_information_t *internal_volume_information = NULL;
+	static char *function                                              = "libscca_volume_information_get_utf16_directory_string_stream";
+
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_information = (libscca_internal_volume_information_t *) volume_information;
+
+	if( libscca_internal_volume_information_get_directory_string_data(
+	     internal_volume_information,
+	     directory_string_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory string: %d data.",
+		 function,
+		 directory_string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
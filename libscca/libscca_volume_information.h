@@ -27,7 +27,8 @@
 
 #include "libscca_extern.h"
 #include "libscca_libcerror.h"
-#include "libscca_libfvalue.h"
+#include "libscca_libcthreads.h"
+#include "libscca_string_pool.h"
 #include "libscca_types.h"
 
 #if defined( __cplusplus )
@@ -36,16 +37,33 @@ extern "C" {
 
 typedef struct libscca_internal_volume_information libscca_internal_volume_information_t;
 
+/* The volume information is a fixed-size record, the device path, file references
+ * and directory strings reference the packed volumes data of the file
+ */
 struct libscca_internal_volume_information
 {
 	/* The volume device path
 	 */
-	uint8_t *device_path;
+	const uint8_t *device_path;
 
 	/* The volume device path size
 	 */
 	uint32_t device_path_size;
 
+	/* The string pool that contains the device path
+	 * Contains NULL if the device path is stored in the volume information
+	 */
+	libscca_string_pool_t *string_pool;
+
+	/* The identifier of the device path in the string pool
+	 */
+	uint32_t device_path_string_identifier;
+
+	/* The identifier of the volume in the volume dictionary
+	 * Only set if the file was opened with a volume dictionary
+	 */
+	uint32_t volume_identifier;
+
 	/* The volume creation time
 	 */
 	uint64_t creation_time;
@@ -54,9 +72,43 @@ struct libscca_internal_volume_information
 	 */
 	uint32_t serial_number;
 
-	/* The directory strings
+	/* The file references
+	 */
+	const uint64_t *file_references;
+
+	/* The number of file references
 	 */
-	libfvalue_value_t *directory_strings;
+	int number_of_file_references;
+
+	/* The directory strings data, contains the directory strings array as stored
+	 * in the file, where every UTF-16 little-endian directory string, including its
+	 * end-of-string character, is preceded by its 16-bit number of characters
+	 */
+	const uint8_t *directory_strings_data;
+
+	/* The directory strings data size
+	 */
+	size_t directory_strings_data_size;
+
+	/* The offsets of the number of characters of the directory strings, relative
+	 * to the start of the directory strings data, these are determined on first access
+	 */
+	uint32_t *directory_string_offsets;
+
+	/* The number of directory strings
+	 */
+	int number_of_directory_strings;
+
+	/* Value to indicate the directory string offsets were determined
+	 */
+	uint8_t directory_string_offsets_are_set;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex of the volumes, which guards determining the directory string offsets
+	 * Contains NULL if the volume information is not part of volumes
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int libscca_volume_information_initialize(
@@ -72,6 +124,12 @@ int libscca_internal_volume_information_free(
      libscca_internal_volume_information_t **internal_volume_information,
      libcerror_error_t **error );
 
+int libscca_internal_volume_information_get_device_path_data(
+     libscca_internal_volume_information_t *internal_volume_information,
+     const uint8_t **device_path,
+     size_t *device_path_size,
+     libcerror_error_t **error );
+
 LIBSCCA_EXTERN \
 int libscca_volume_information_get_creation_time(
      libscca_volume_information_t *volume_information,
@@ -110,6 +168,81 @@ int libscca_volume_information_get_utf16_device_path(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_utf16_device_path_stream(
+     libscca_volume_information_t *volume_information,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_number_of_file_references(
+     libscca_volume_information_t *volume_information,
+     int *number_of_file_references,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_copy_file_references(
+     libscca_volume_information_t *volume_information,
+     uint64_t *file_references,
+     int number_of_file_references,
+     libcerror_error_t **error );
+
+int libscca_internal_volume_information_read_directory_string_offsets(
+     libscca_internal_volume_information_t *internal_volume_information,
+     libcerror_error_t **error );
+
+int libscca_internal_volume_information_get_directory_string_data(
+     libscca_internal_volume_information_t *internal_volume_information,
+     int directory_string_index,
+     const uint8_t **directory_string_data,
+     size_t *directory_string_data_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_number_of_directory_strings(
+     libscca_volume_information_t *volume_information,
+     int *number_of_directory_strings,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_utf8_directory_string_size(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_utf8_directory_string(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_utf16_directory_string_size(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_utf16_directory_string(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_volume_information_get_utf16_directory_string_stream(
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
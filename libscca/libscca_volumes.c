@@ -0,0 +1,344 @@
+/*
+ * Volumes functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_memory.h"
+#include "libscca_volume_information.h"
+#include "libscca_volumes.h"
+
+/* Creates volumes
+ * Make sure the value volumes is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volumes_initialize(
+     libscca_volumes_t **volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_volumes_initialize";
+
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volumes != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volumes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*volumes = memory_allocate_structure(
+	            libscca_volumes_t );
+
+	if( *volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *volumes,
+	     0,
+	     sizeof( libscca_volumes_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volumes.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *volumes )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *volumes != NULL )
+	{
+		memory_free(
+		 *volumes );
+
+		*volumes = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volumes_free(
+     libscca_volumes_t **volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_volumes_free";
+	int result            = 1;
+
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volumes != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *volumes )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *volumes )->volumes_data != NULL )
+		{
+			memory_free(
+			 ( *volumes )->volumes_data );
+		}
+		memory_free(
+		 *volumes );
+
+		*volumes = NULL;
+	}
+	return( result );
+}
+
+/* Resizes the volumes data to contain at least volumes data size bytes
+ * The existing volumes data is preserved, note that the data can be moved
+ * hence references into the volumes data must be set after the final resize
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volumes_resize(
+     libscca_volumes_t *volumes,
+     size_t volumes_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *volumes_data = NULL;
+	static char *function = "libscca_volumes_resize";
+
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volumes_data_size == 0 )
+	 || ( volumes_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volumes data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volumes_data_size > volumes->volumes_data_size )
+	{
+		volumes_data = (uint8_t *) memory_reallocate(
+		                            volumes->volumes_data,
+		                            volumes_data_size );
+
+		if( volumes_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize volumes data.",
+			 function );
+
+			return( -1 );
+		}
+		volumes->volumes_data       = volumes_data;
+		volumes->volumes_data_size  = volumes_data_size;
+		volumes->volume_information = (libscca_internal_volume_information_t *) volumes_data;
+	}
+	return( 1 );
+}
+
+/* Clears the volumes
+ * The volumes data remains allocated so it can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volumes_clear(
+     libscca_volumes_t *volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_volumes_clear";
+
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	volumes->number_of_volumes = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volumes_get_number_of_volumes(
+     libscca_volumes_t *volumes,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_volumes_get_number_of_volumes";
+
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_volumes = volumes->number_of_volumes;
+
+	return( 1 );
+}
+
+/* Retrieves a specific volume information record
+ * The volume information is a reference into the volumes data
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_volumes_get_volume_information_by_index(
+     libscca_volumes_t *volumes,
+     int volume_index,
+     libscca_internal_volume_information_t **volume_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_volumes_get_volume_information_by_index";
+
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index < 0 )
+	 || ( volume_index >= volumes->number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_information = &( volumes->volume_information[ volume_index ] );
+
+	return( 1 );
+}
+
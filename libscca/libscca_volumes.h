@@ -0,0 +1,102 @@
+/*
+ * Volumes functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_VOLUMES_H )
+#define _LIBSCCA_VOLUMES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_libcerror.h"
+#include "libscca_libcthreads.h"
+#include "libscca_volume_information.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_volumes libscca_volumes_t;
+
+/* The volumes of a file stored in a single packed block
+ */
+struct libscca_volumes
+{
+	/* The number of volumes
+	 */
+	int number_of_volumes;
+
+	/* The volumes data, which contains the fixed-size volume information records
+	 * followed by the file references, the directory string offsets and
+	 * the strings area that contains the device paths and directory strings
+	 */
+	uint8_t *volumes_data;
+
+	/* The volumes data size
+	 */
+	size_t volumes_data_size;
+
+	/* The volume information records
+	 */
+	libscca_internal_volume_information_t *volume_information;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The directory string offsets of the volumes are determined on first access,
+	 * which can be on different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libscca_volumes_initialize(
+     libscca_volumes_t **volumes,
+     libcerror_error_t **error );
+
+int libscca_volumes_free(
+     libscca_volumes_t **volumes,
+     libcerror_error_t **error );
+
+int libscca_volumes_resize(
+     libscca_volumes_t *volumes,
+     size_t volumes_data_size,
+     libcerror_error_t **error );
+
+int libscca_volumes_clear(
+     libscca_volumes_t *volumes,
+     libcerror_error_t **error );
+
+int libscca_volumes_get_number_of_volumes(
+     libscca_volumes_t *volumes,
+     int *number_of_volumes,
+     libcerror_error_t **error );
+
+int libscca_volumes_get_volume_information_by_index(
+     libscca_volumes_t *volumes,
+     int volume_index,
+     libscca_internal_volume_information_t **volume_information,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_VOLUMES_H ) */
+
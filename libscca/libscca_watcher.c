@@ -0,0 +1,1830 @@
+/*
+ * Directory watcher functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#include <errno.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_POLL_H )
+#include <poll.h>
+#endif
+
+#if defined( HAVE_SYS_INOTIFY_H )
+#include <sys/inotify.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "libscca_definitions.h"
+#include "libscca_diff.h"
+#include "libscca_file.h"
+#include "libscca_hash.h"
+#include "libscca_libcerror.h"
+#include "libscca_libcnotify.h"
+#include "libscca_memory.h"
+#include "libscca_statistics.h"
+#include "libscca_watcher.h"
+
+#if defined( WINAPI )
+#define LIBSCCA_WATCHER_PATH_SEPARATOR	'\\'
+#else
+#define LIBSCCA_WATCHER_PATH_SEPARATOR	'/'
+#endif
+
+#if defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+#define LIBSCCA_WATCHER_INOTIFY_MASK \
+	( IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVED_FROM | IN_MOVED_TO )
+#endif
+
+/* Creates a watcher
+ * Make sure the value watcher is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_watcher_initialize(
+     libscca_watcher_t **watcher,
+     const char *directory_path,
+     int access_flags,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI ) || defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+	libscca_internal_watcher_t *internal_watcher = NULL;
+#endif
+	static char *function                        = "libscca_watcher_initialize";
+	size_t directory_path_length                 = 0;
+
+	if( watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *watcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid watcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	directory_path_length = narrow_string_length(
+	                         directory_path );
+
+	if( ( directory_path_length == 0 )
+	 || ( directory_path_length >= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI ) && !defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: directory change notifications not supported.",
+	 function );
+
+	return( -1 );
+#else
+	internal_watcher = memory_allocate_structure(
+	                    libscca_internal_watcher_t );
+
+	if( internal_watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create watcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_watcher,
+	     0,
+	     sizeof( libscca_internal_watcher_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear watcher.",
+		 function );
+
+		memory_free(
+		 internal_watcher );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	internal_watcher->directory_handle   = INVALID_HANDLE_VALUE;
+#else
+	internal_watcher->inotify_descriptor = -1;
+	internal_watcher->watch_descriptor   = -1;
+#endif
+	internal_watcher->directory_path_size = directory_path_length + 1;
+
+	internal_watcher->directory_path = narrow_string_allocate(
+	                                    internal_watcher->directory_path_size );
+
+	if( internal_watcher->directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     internal_watcher->directory_path,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	internal_watcher->directory_path[ directory_path_length ] = 0;
+
+	internal_watcher->notify_buffer = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * LIBSCCA_WATCHER_NOTIFY_BUFFER_SIZE );
+
+	if( internal_watcher->notify_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create notify buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_diff_initialize(
+	     &( internal_watcher->diff ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create diff.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	internal_watcher->directory_handle = CreateFileA(
+	                                      (LPCSTR) internal_watcher->directory_path,
+	                                      FILE_LIST_DIRECTORY,
+	                                      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+	                                      NULL,
+	                                      OPEN_EXISTING,
+	                                      FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+	                                      NULL );
+
+	if( internal_watcher->directory_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) GetLastError(),
+		 "%s: unable to open directory: %s.",
+		 function,
+		 internal_watcher->directory_path );
+
+		goto on_error;
+	}
+	internal_watcher->overlapped.hEvent = CreateEvent(
+	                                       NULL,
+	                                       TRUE,
+	                                       FALSE,
+	                                       NULL );
+
+	if( internal_watcher->overlapped.hEvent == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 (uint32_t) GetLastError(),
+		 "%s: unable to create event.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	internal_watcher->inotify_descriptor = inotify_init1(
+	                                        IN_NONBLOCK | IN_CLOEXEC );
+
+	if( internal_watcher->inotify_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 errno,
+		 "%s: unable to initialize inotify.",
+		 function );
+
+		goto on_error;
+	}
+	internal_watcher->watch_descriptor = inotify_add_watch(
+	                                      internal_watcher->inotify_descriptor,
+	                                      internal_watcher->directory_path,
+	                                      LIBSCCA_WATCHER_INOTIFY_MASK );
+
+	if( internal_watcher->watch_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to watch directory: %s.",
+		 function,
+		 internal_watcher->directory_path );
+
+		goto on_error;
+	}
+#endif /* defined( WINAPI ) */
+
+	internal_watcher->access_flags  = access_flags;
+	internal_watcher->debounce_time = LIBSCCA_WATCHER_DEFAULT_DEBOUNCE_TIME;
+
+	*watcher = (libscca_watcher_t *) internal_watcher;
+
+	return( 1 );
+
+on_error:
+	if( internal_watcher != NULL )
+	{
+#if defined( WINAPI )
+		if( internal_watcher->overlapped.hEvent != NULL )
+		{
+			CloseHandle(
+			 internal_watcher->overlapped.hEvent );
+		}
+		if( internal_watcher->directory_handle != INVALID_HANDLE_VALUE )
+		{
+			CloseHandle(
+			 internal_watcher->directory_handle );
+		}
+#else
+		if( internal_watcher->inotify_descriptor != -1 )
+		{
+			close(
+			 internal_watcher->inotify_descriptor );
+		}
+#endif
+		if( internal_watcher->diff != NULL )
+		{
+			libscca_diff_free(
+			 &( internal_watcher->diff ),
+			 NULL );
+		}
+		if( internal_watcher->notify_buffer != NULL )
+		{
+			memory_free(
+			 internal_watcher->notify_buffer );
+		}
+		if( internal_watcher->directory_path != NULL )
+		{
+			memory_free(
+			 internal_watcher->directory_path );
+		}
+		memory_free(
+		 internal_watcher );
+	}
+	return( -1 );
+
+#endif /* !defined( WINAPI ) && !defined( LIBSCCA_WATCHER_HAVE_INOTIFY ) */
+}
+
+/* Frees a watcher
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_watcher_free(
+     libscca_watcher_t **watcher,
+     libcerror_error_t **error )
+{
+	libscca_internal_watcher_t *internal_watcher = NULL;
+	static char *function                        = "libscca_watcher_free";
+	int entry_index                              = 0;
+	int result                                   = 1;
+
+	if( watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( *watcher != NULL )
+	{
+		internal_watcher = (libscca_internal_watcher_t *) *watcher;
+		*watcher         = NULL;
+
+#if defined( WINAPI )
+		if( internal_watcher->read_is_pending != 0 )
+		{
+			/* Wait for the cancelled read to complete before the notify buffer is freed
+			 */
+			if( CancelIo(
+			     internal_watcher->directory_handle ) != 0 )
+			{
+				WaitForSingleObject(
+				 internal_watcher->overlapped.hEvent,
+				 INFINITE );
+			}
+		}
+		if( CloseHandle(
+		     internal_watcher->overlapped.hEvent ) == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 (uint32_t) GetLastError(),
+			 "%s: unable to close event.",
+			 function );
+
+			result = -1;
+		}
+		if( CloseHandle(
+		     internal_watcher->directory_handle ) == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 (uint32_t) GetLastError(),
+			 "%s: unable to close directory.",
+			 function );
+
+			result = -1;
+		}
+#elif defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+		/* Closing the inotify file descriptor also removes the watch
+		 */
+		if( close(
+		     internal_watcher->inotify_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close inotify.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( entry_index = 0;
+		     entry_index < internal_watcher->number_of_entries;
+		     entry_index++ )
+		{
+			memory_free(
+			 internal_watcher->entries[ entry_index ].filename );
+
+			if( internal_watcher->entries[ entry_index ].snapshot_data != NULL )
+			{
+				memory_free(
+				 internal_watcher->entries[ entry_index ].snapshot_data );
+			}
+		}
+		if( internal_watcher->entries != NULL )
+		{
+			memory_free(
+			 internal_watcher->entries );
+		}
+		if( libscca_diff_free(
+		     &( internal_watcher->diff ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free diff.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_watcher->notify_buffer );
+		memory_free(
+		 internal_watcher->directory_path );
+		memory_free(
+		 internal_watcher );
+	}
+	return( result );
+}
+
+/* Sets the debounce time
+ * A changed file is only opened when it has not changed for debounce time milliseconds,
+ * so that a file that is rewritten in rapid succession is only opened once
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_watcher_set_debounce_time(
+     libscca_watcher_t *watcher,
+     uint32_t debounce_time,
+     libcerror_error_t **error )
+{
+	libscca_internal_watcher_t *internal_watcher = NULL;
+	static char *function                        = "libscca_watcher_set_debounce_time";
+
+	if( watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_watcher = (libscca_internal_watcher_t *) watcher;
+
+	internal_watcher->debounce_time = debounce_time;
+
+	return( 1 );
+}
+
+/* Determines if a filename has the prefetch file (.pf) extension
+ * The extension is compared case-insensitive
+ * Returns 1 if the filename has the prefetch file extension or 0 if not
+ */
+int libscca_internal_watcher_is_prefetch_filename(
+     const char *filename,
+     size_t filename_length )
+{
+	if( ( filename == NULL )
+	 || ( filename_length < 4 ) )
+	{
+		return( 0 );
+	}
+	if( ( filename[ filename_length - 3 ] == '.' )
+	 && ( ( filename[ filename_length - 2 ] == 'p' )
+	  ||  ( filename[ filename_length - 2 ] == 'P' ) )
+	 && ( ( filename[ filename_length - 1 ] == 'f' )
+	  ||  ( filename[ filename_length - 1 ] == 'F' ) ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the entry of a specific filename
+ * The filename hash is set also when no entry was found
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libscca_internal_watcher_get_entry_by_filename(
+     libscca_internal_watcher_t *internal_watcher,
+     const char *filename,
+     size_t filename_length,
+     uint64_t *filename_hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libscca_watcher_entry_t *entry = NULL;
+	static char *function          = "libscca_internal_watcher_get_entry_by_filename";
+	int safe_entry_index           = 0;
+
+	if( internal_watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_hash_calculate_xxh64(
+	     (uint8_t *) filename,
+	     filename_length,
+	     0,
+	     filename_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate filename hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* A directory contains at most a few thousand prefetch files
+	 * hence the entries are searched sequentially by hash
+	 */
+	for( safe_entry_index = 0;
+	     safe_entry_index < internal_watcher->number_of_entries;
+	     safe_entry_index++ )
+	{
+		entry = &( internal_watcher->entries[ safe_entry_index ] );
+
+		if( ( entry->filename_hash == *filename_hash )
+		 && ( entry->filename_size == ( filename_length + 1 ) )
+		 && ( memory_compare(
+		       entry->filename,
+		       filename,
+		       filename_length ) == 0 ) )
+		{
+			*entry_index = safe_entry_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Marks a filename as changed
+ * Filenames without the prefetch file extension are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_watcher_change_filename(
+     libscca_internal_watcher_t *internal_watcher,
+     const char *filename,
+     size_t filename_length,
+     uint64_t change_timestamp,
+     libcerror_error_t **error )
+{
+	libscca_watcher_entry_t *entries = NULL;
+	libscca_watcher_entry_t *entry   = NULL;
+	static char *function            = "libscca_internal_watcher_change_filename";
+	uint64_t filename_hash           = 0;
+	int entry_index                  = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
+
+	if( internal_watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_watcher_is_prefetch_filename(
+	     filename,
+	     filename_length ) == 0 )
+	{
+		return( 1 );
+	}
+	result = libscca_internal_watcher_get_entry_by_filename(
+	          internal_watcher,
+	          filename,
+	          filename_length,
+	          &filename_hash,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( internal_watcher->number_of_entries >= internal_watcher->number_of_allocated_entries )
+		{
+			number_of_entries = internal_watcher->number_of_allocated_entries;
+
+			if( number_of_entries == 0 )
+			{
+				number_of_entries = 64;
+			}
+			else if( number_of_entries > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of entries value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			else
+			{
+				number_of_entries *= 2;
+			}
+			if( ( sizeof( libscca_watcher_entry_t ) * (size_t) number_of_entries ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid entries size value exceeds maximum allocation size.",
+				 function );
+
+				return( -1 );
+			}
+			entries = (libscca_watcher_entry_t *) memory_reallocate(
+			                                       internal_watcher->entries,
+			                                       sizeof( libscca_watcher_entry_t ) * (size_t) number_of_entries );
+
+			if( entries == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entries.",
+				 function );
+
+				return( -1 );
+			}
+			internal_watcher->entries                     = entries;
+			internal_watcher->number_of_allocated_entries = number_of_entries;
+		}
+		entry_index = internal_watcher->number_of_entries;
+
+		entry = &( internal_watcher->entries[ entry_index ] );
+
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( libscca_watcher_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			return( -1 );
+		}
+		entry->filename = narrow_string_allocate(
+		                   filename_length + 1 );
+
+		if( entry->filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     entry->filename,
+		     filename,
+		     filename_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy filename.",
+			 function );
+
+			memory_free(
+			 entry->filename );
+
+			entry->filename = NULL;
+
+			return( -1 );
+		}
+		entry->filename[ filename_length ] = 0;
+
+		entry->filename_size = filename_length + 1;
+		entry->filename_hash = filename_hash;
+
+		internal_watcher->number_of_entries += 1;
+	}
+	entry = &( internal_watcher->entries[ entry_index ] );
+
+	if( entry->is_changed == 0 )
+	{
+		entry->is_changed = 1;
+
+		internal_watcher->number_of_changed_entries += 1;
+	}
+	/* Every change postpones the debounce time
+	 */
+	entry->change_timestamp = change_timestamp;
+
+	return( 1 );
+}
+
+/* Removes a filename, which discards the previous version of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_internal_watcher_remove_filename(
+     libscca_internal_watcher_t *internal_watcher,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libscca_watcher_entry_t *entry = NULL;
+	static char *function          = "libscca_internal_watcher_remove_filename";
+	uint64_t filename_hash         = 0;
+	int entry_index                = 0;
+	int result                     = 0;
+
+	if( internal_watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_internal_watcher_is_prefetch_filename(
+	     filename,
+	     filename_length ) == 0 )
+	{
+		return( 1 );
+	}
+	result = libscca_internal_watcher_get_entry_by_filename(
+	          internal_watcher,
+	          filename,
+	          filename_length,
+	          &filename_hash,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	entry = &( internal_watcher->entries[ entry_index ] );
+
+	if( entry->is_changed != 0 )
+	{
+		internal_watcher->number_of_changed_entries -= 1;
+	}
+	memory_free(
+	 entry->filename );
+
+	if( entry->snapshot_data != NULL )
+	{
+		memory_free(
+		 entry->snapshot_data );
+	}
+	/* The order of the entries is not maintained
+	 */
+	internal_watcher->number_of_entries -= 1;
+
+	if( entry_index < internal_watcher->number_of_entries )
+	{
+		if( memory_copy(
+		     entry,
+		     &( internal_watcher->entries[ internal_watcher->number_of_entries ] ),
+		     sizeof( libscca_watcher_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Marks all the known filenames as changed
+ * Used when change notifications were lost
+ */
+void libscca_internal_watcher_change_all(
+      libscca_internal_watcher_t *internal_watcher,
+      uint64_t change_timestamp )
+{
+	int entry_index = 0;
+
+	if( internal_watcher == NULL )
+	{
+		return;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_watcher->number_of_entries;
+	     entry_index++ )
+	{
+		internal_watcher->entries[ entry_index ].is_changed       = 1;
+		internal_watcher->entries[ entry_index ].change_timestamp = change_timestamp;
+	}
+	internal_watcher->number_of_changed_entries = internal_watcher->number_of_entries;
+}
+
+/* Waits for and reads the change notifications of the directory
+ * A timeout of -1 waits indefinitely
+ * Returns 1 if change notifications were read, 0 on timeout or -1 on error
+ */
+int libscca_internal_watcher_read_changes(
+     libscca_internal_watcher_t *internal_watcher,
+     int timeout,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	char filename[ 1024 ];
+
+	FILE_NOTIFY_INFORMATION *notify_information = NULL;
+	DWORD read_count                            = 0;
+	DWORD wait_result                           = 0;
+	size_t notify_offset                        = 0;
+	uint64_t change_timestamp                   = 0;
+	int filename_length                         = 0;
+	int result                                  = 0;
+
+#elif defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+	struct pollfd poll_descriptor;
+
+	struct inotify_event *notify_event          = NULL;
+	ssize_t read_count                          = 0;
+	size_t notify_offset                        = 0;
+	uint64_t change_timestamp                   = 0;
+	int poll_result                             = 0;
+	int result                                  = 0;
+#endif
+	static char *function                       = "libscca_internal_watcher_read_changes";
+
+	if( internal_watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( internal_watcher->read_is_pending == 0 )
+	{
+		if( ResetEvent(
+		     internal_watcher->overlapped.hEvent ) == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 (uint32_t) GetLastError(),
+			 "%s: unable to reset event.",
+			 function );
+
+			return( -1 );
+		}
+		if( ReadDirectoryChangesW(
+		     internal_watcher->directory_handle,
+		     (LPVOID) internal_watcher->notify_buffer,
+		     (DWORD) LIBSCCA_WATCHER_NOTIFY_BUFFER_SIZE,
+		     FALSE,
+		     FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE,
+		     NULL,
+		     &( internal_watcher->overlapped ),
+		     NULL ) == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 (uint32_t) GetLastError(),
+			 "%s: unable to read directory changes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_watcher->read_is_pending = 1;
+	}
+	wait_result = WaitForSingleObject(
+	               internal_watcher->overlapped.hEvent,
+	               ( timeout < 0 ) ? INFINITE : (DWORD) timeout );
+
+	if( wait_result == WAIT_TIMEOUT )
+	{
+		return( 0 );
+	}
+	else if( wait_result != WAIT_OBJECT_0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 (uint32_t) GetLastError(),
+		 "%s: unable to wait for directory changes.",
+		 function );
+
+		return( -1 );
+	}
+	internal_watcher->read_is_pending = 0;
+
+	if( GetOverlappedResult(
+	     internal_watcher->directory_handle,
+	     &( internal_watcher->overlapped ),
+	     &read_count,
+	     FALSE ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 (uint32_t) GetLastError(),
+		 "%s: unable to read directory changes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_statistics_get_timestamp(
+	     &change_timestamp ) != 1 )
+	{
+		change_timestamp = 0;
+	}
+	/* A read count of 0 indicates the changes did not fit in the buffer
+	 */
+	if( read_count == 0 )
+	{
+		libscca_internal_watcher_change_all(
+		 internal_watcher,
+		 change_timestamp );
+
+		return( 1 );
+	}
+	while( notify_offset < (size_t) read_count )
+	{
+		notify_information = (FILE_NOTIFY_INFORMATION *) &( internal_watcher->notify_buffer[ notify_offset ] );
+
+		filename_length = WideCharToMultiByte(
+		                   CP_ACP,
+		                   0,
+		                   notify_information->FileName,
+		                   (int) ( notify_information->FileNameLength / sizeof( WCHAR ) ),
+		                   filename,
+		                   (int) sizeof( filename ),
+		                   NULL,
+		                   NULL );
+
+		if( filename_length > 0 )
+		{
+			if( ( notify_information->Action == FILE_ACTION_REMOVED )
+			 || ( notify_information->Action == FILE_ACTION_RENAMED_OLD_NAME ) )
+			{
+				result = libscca_internal_watcher_remove_filename(
+				          internal_watcher,
+				          filename,
+				          (size_t) filename_length,
+				          error );
+			}
+			else
+			{
+				result = libscca_internal_watcher_change_filename(
+				          internal_watcher,
+				          filename,
+				          (size_t) filename_length,
+				          change_timestamp,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update filename.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( notify_information->NextEntryOffset == 0 )
+		{
+			break;
+		}
+		notify_offset += (size_t) notify_information->NextEntryOffset;
+	}
+	return( 1 );
+
+#elif defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+	poll_descriptor.fd      = internal_watcher->inotify_descriptor;
+	poll_descriptor.events  = POLLIN;
+	poll_descriptor.revents = 0;
+
+	poll_result = poll(
+	               &poll_descriptor,
+	               1,
+	               timeout );
+
+	if( poll_result == -1 )
+	{
+		/* An interrupted wait, for example by a signal, is handled as a timeout
+		 */
+		if( errno == EINTR )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to wait for directory changes.",
+		 function );
+
+		return( -1 );
+	}
+	else if( poll_result == 0 )
+	{
+		return( 0 );
+	}
+	if( libscca_statistics_get_timestamp(
+	     &change_timestamp ) != 1 )
+	{
+		change_timestamp = 0;
+	}
+	/* The inotify file descriptor is non-blocking hence read until no events remain
+	 */
+	while( 1 )
+	{
+		read_count = read(
+		              internal_watcher->inotify_descriptor,
+		              internal_watcher->notify_buffer,
+		              LIBSCCA_WATCHER_NOTIFY_BUFFER_SIZE );
+
+		if( read_count == -1 )
+		{
+			if( ( errno == EAGAIN )
+			 || ( errno == EWOULDBLOCK ) )
+			{
+				break;
+			}
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read directory changes.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		notify_offset = 0;
+
+		while( ( notify_offset + sizeof( struct inotify_event ) ) <= (size_t) read_count )
+		{
+			notify_event = (struct inotify_event *) &( internal_watcher->notify_buffer[ notify_offset ] );
+
+			if( ( notify_event->mask & IN_Q_OVERFLOW ) != 0 )
+			{
+				libscca_internal_watcher_change_all(
+				 internal_watcher,
+				 change_timestamp );
+			}
+			else if( ( notify_event->len > 0 )
+			      && ( ( notify_event->mask & IN_ISDIR ) == 0 ) )
+			{
+				if( ( notify_event->mask & ( IN_DELETE | IN_MOVED_FROM ) ) != 0 )
+				{
+					result = libscca_internal_watcher_remove_filename(
+					          internal_watcher,
+					          notify_event->name,
+					          narrow_string_length(
+					           notify_event->name ),
+					          error );
+				}
+				else
+				{
+					result = libscca_internal_watcher_change_filename(
+					          internal_watcher,
+					          notify_event->name,
+					          narrow_string_length(
+					           notify_event->name ),
+					          change_timestamp,
+					          error );
+				}
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update filename.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			notify_offset += sizeof( struct inotify_event ) + notify_event->len;
+		}
+	}
+	return( 1 );
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: directory change notifications not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Processes the entry of a changed file
+ * The file is opened and compared with the previous version of the file, if known,
+ * after which the snapshot of the file replaces that of the previous version
+ * Returns 1 if successful, 0 if the file could not be opened or -1 on error
+ */
+int libscca_internal_watcher_process_entry(
+     libscca_internal_watcher_t *internal_watcher,
+     int entry_index,
+     int (*callback_function)(
+            const char *filename,
+            libscca_file_t *previous_file,
+            libscca_file_t *file,
+            libscca_diff_t *diff,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *open_error  = NULL;
+	libscca_file_t *file           = NULL;
+	libscca_file_t *previous_file  = NULL;
+	libscca_watcher_entry_t *entry = NULL;
+	char *path                     = NULL;
+	uint8_t *snapshot_data         = NULL;
+	static char *function          = "libscca_internal_watcher_process_entry";
+	size_t directory_path_length   = 0;
+	size_t path_size               = 0;
+	size_t snapshot_data_size      = 0;
+	int result                     = 0;
+
+	if( internal_watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_watcher->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_watcher->entries[ entry_index ] );
+
+	if( entry->is_changed != 0 )
+	{
+		entry->is_changed = 0;
+
+		internal_watcher->number_of_changed_entries -= 1;
+	}
+	directory_path_length = internal_watcher->directory_path_size - 1;
+
+	if( internal_watcher->directory_path[ directory_path_length - 1 ] == LIBSCCA_WATCHER_PATH_SEPARATOR )
+	{
+		directory_path_length -= 1;
+	}
+	path_size = directory_path_length + 1 + entry->filename_size;
+
+	path = narrow_string_allocate(
+	        path_size );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     path,
+	     internal_watcher->directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	path[ directory_path_length ] = LIBSCCA_WATCHER_PATH_SEPARATOR;
+
+	if( memory_copy(
+	     &( path[ directory_path_length + 1 ] ),
+	     entry->filename,
+	     entry->filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file can have been removed or replaced by an incomplete version
+	 * after the change, in which case it is skipped until it changes again
+	 */
+	if( libscca_file_open(
+	     file,
+	     path,
+	     internal_watcher->access_flags,
+	     &open_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open file: %s.\n",
+			 function,
+			 path );
+
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
+#endif
+		libcerror_error_free(
+		 &open_error );
+
+		libscca_file_free(
+		 &file,
+		 NULL );
+
+		memory_free(
+		 path );
+
+		return( 0 );
+	}
+	if( entry->snapshot_data != NULL )
+	{
+		if( libscca_file_initialize(
+		     &previous_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create previous file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_open_snapshot(
+		     previous_file,
+		     entry->snapshot_data,
+		     entry->snapshot_data_size,
+		     LIBSCCA_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open previous file from snapshot.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_diff_compare(
+		     internal_watcher->diff,
+		     previous_file,
+		     file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare file with previous file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = callback_function(
+	          path,
+	          previous_file,
+	          file,
+	          ( previous_file != NULL ) ? internal_watcher->diff : NULL,
+	          callback_arguments );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	/* Keep a snapshot of the file instead of the file itself, so that no file
+	 * handle remains open and the next version can be compared without decompression
+	 */
+	if( libscca_file_get_snapshot_size(
+	     file,
+	     &snapshot_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( snapshot_data_size == 0 )
+	 || ( snapshot_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	snapshot_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * snapshot_data_size );
+
+	if( snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_write_snapshot(
+	     file,
+	     snapshot_data,
+	     snapshot_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write snapshot.",
+		 function );
+
+		goto on_error;
+	}
+	/* The previous file references the previous snapshot data
+	 */
+	if( previous_file != NULL )
+	{
+		if( libscca_file_free(
+		     &previous_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( entry->snapshot_data != NULL )
+	{
+		memory_free(
+		 entry->snapshot_data );
+	}
+	entry->snapshot_data      = snapshot_data;
+	entry->snapshot_data_size = snapshot_data_size;
+
+	snapshot_data = NULL;
+
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	if( previous_file != NULL )
+	{
+		libscca_file_free(
+		 &previous_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Waits for changes of the prefetch files in the directory and processes the changed files
+ * A changed file is processed once it has not changed for the debounce time,
+ * see libscca_watcher_set_debounce_time, hence the function can return before
+ * the timeout without having processed a file
+ * A timeout of -1 waits indefinitely
+ * The callback function is called once for every processed file with the file and,
+ * if the file was processed before, its previous version and the diff between them,
+ * otherwise previous_file and diff are NULL. The files and the diff are only
+ * valid during the call
+ * A file that cannot be opened, for example because it is incomplete, is skipped
+ * until it changes again
+ * The callback function should return 1 if successful or -1 on error
+ * Returns the number of processed files or -1 on error
+ */
+int libscca_watcher_wait(
+     libscca_watcher_t *watcher,
+     int timeout,
+     int (*callback_function)(
+            const char *filename,
+            libscca_file_t *previous_file,
+            libscca_file_t *file,
+            libscca_diff_t *diff,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libscca_internal_watcher_t *internal_watcher = NULL;
+	libscca_watcher_entry_t *entry               = NULL;
+	static char *function                        = "libscca_watcher_wait";
+	uint64_t current_timestamp                   = 0;
+	uint64_t debounce_time                       = 0;
+	uint64_t elapsed_time                        = 0;
+	uint64_t remaining_time                      = 0;
+	int entry_index                              = 0;
+	int has_timestamp                            = 0;
+	int number_of_processed_files                = 0;
+	int result                                   = 0;
+	int wait_timeout                             = 0;
+
+	if( watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watcher.",
+		 function );
+
+		return( -1 );
+	}
+	internal_watcher = (libscca_internal_watcher_t *) watcher;
+
+	if( timeout < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid timeout value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	debounce_time = (uint64_t) internal_watcher->debounce_time * 1000000UL;
+	wait_timeout  = timeout;
+
+	/* Do not wait beyond the end of the debounce time of the pending changes
+	 */
+	if( internal_watcher->number_of_changed_entries > 0 )
+	{
+		has_timestamp = libscca_statistics_get_timestamp(
+		                 &current_timestamp );
+
+		remaining_time = debounce_time;
+
+		for( entry_index = 0;
+		     entry_index < internal_watcher->number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( internal_watcher->entries[ entry_index ] );
+
+			if( entry->is_changed == 0 )
+			{
+				continue;
+			}
+			elapsed_time = 0;
+
+			if( ( has_timestamp != 0 )
+			 && ( current_timestamp > entry->change_timestamp ) )
+			{
+				elapsed_time = current_timestamp - entry->change_timestamp;
+			}
+			if( ( has_timestamp == 0 )
+			 || ( elapsed_time >= debounce_time ) )
+			{
+				remaining_time = 0;
+
+				break;
+			}
+			if( ( debounce_time - elapsed_time ) < remaining_time )
+			{
+				remaining_time = debounce_time - elapsed_time;
+			}
+		}
+		/* Round up to milliseconds
+		 */
+		remaining_time = ( remaining_time + 999999UL ) / 1000000UL;
+
+		if( ( wait_timeout == -1 )
+		 || ( remaining_time < (uint64_t) wait_timeout ) )
+		{
+			wait_timeout = (int) remaining_time;
+		}
+	}
+	if( libscca_internal_watcher_read_changes(
+	     internal_watcher,
+	     wait_timeout,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read changes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_watcher->number_of_changed_entries == 0 )
+	{
+		return( 0 );
+	}
+	/* Without a monotonic clock the changed files are processed without debounce
+	 */
+	has_timestamp = libscca_statistics_get_timestamp(
+	                 &current_timestamp );
+
+	for( entry_index = 0;
+	     entry_index < internal_watcher->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_watcher->entries[ entry_index ] );
+
+		if( entry->is_changed == 0 )
+		{
+			continue;
+		}
+		if( ( has_timestamp != 0 )
+		 && ( ( current_timestamp < entry->change_timestamp )
+		  ||  ( ( current_timestamp - entry->change_timestamp ) < debounce_time ) ) )
+		{
+			continue;
+		}
+		result = libscca_internal_watcher_process_entry(
+		          internal_watcher,
+		          entry_index,
+		          callback_function,
+		          callback_arguments,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process file: %s.",
+			 function,
+			 entry->filename );
+
+			return( -1 );
+		}
+		number_of_processed_files += result;
+	}
+	return( number_of_processed_files );
+}
+
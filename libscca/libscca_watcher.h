@@ -0,0 +1,236 @@
+/*
+ * Directory watcher functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_WATCHER_H )
+#define _LIBSCCA_WATCHER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#include "libscca_extern.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( WINAPI ) && defined( HAVE_SYS_INOTIFY_H ) && defined( HAVE_INOTIFY_INIT1 ) && defined( HAVE_POLL_H ) && defined( HAVE_POLL )
+#define LIBSCCA_WATCHER_HAVE_INOTIFY
+#endif
+
+/* The default debounce time in milliseconds
+ */
+#define LIBSCCA_WATCHER_DEFAULT_DEBOUNCE_TIME		500
+
+/* The size of the change notifications buffer
+ */
+#define LIBSCCA_WATCHER_NOTIFY_BUFFER_SIZE		65536
+
+typedef struct libscca_watcher_entry libscca_watcher_entry_t;
+
+struct libscca_watcher_entry
+{
+	/* The filename relative to the directory
+	 */
+	char *filename;
+
+	/* The filename size including the end-of-string character
+	 */
+	size_t filename_size;
+
+	/* The XXH64 hash of the filename
+	 */
+	uint64_t filename_hash;
+
+	/* The monotonic timestamp of the last change in nano seconds
+	 */
+	uint64_t change_timestamp;
+
+	/* Value to indicate the file changed and has not been processed
+	 */
+	uint8_t is_changed;
+
+	/* The snapshot data of the previous version of the file
+	 * Contains NULL if the previous version is not known
+	 */
+	uint8_t *snapshot_data;
+
+	/* The snapshot data size
+	 */
+	size_t snapshot_data_size;
+};
+
+typedef struct libscca_internal_watcher libscca_internal_watcher_t;
+
+struct libscca_internal_watcher
+{
+	/* The directory path
+	 */
+	char *directory_path;
+
+	/* The directory path size including the end-of-string character
+	 */
+	size_t directory_path_size;
+
+	/* The access flags used to open the changed files
+	 */
+	int access_flags;
+
+	/* The debounce time in milliseconds
+	 */
+	uint32_t debounce_time;
+
+	/* The entries
+	 */
+	libscca_watcher_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of changed entries
+	 */
+	int number_of_changed_entries;
+
+	/* The diff between the previous and the current version of a file
+	 */
+	libscca_diff_t *diff;
+
+	/* The change notifications buffer
+	 */
+	uint8_t *notify_buffer;
+
+#if defined( WINAPI )
+	/* The directory handle
+	 */
+	HANDLE directory_handle;
+
+	/* The overlapped structure of the pending directory read
+	 */
+	OVERLAPPED overlapped;
+
+	/* Value to indicate a directory read is pending
+	 */
+	uint8_t read_is_pending;
+
+#elif defined( LIBSCCA_WATCHER_HAVE_INOTIFY )
+	/* The inotify file descriptor
+	 */
+	int inotify_descriptor;
+
+	/* The watch descriptor of the directory
+	 */
+	int watch_descriptor;
+#endif
+};
+
+LIBSCCA_EXTERN \
+int libscca_watcher_initialize(
+     libscca_watcher_t **watcher,
+     const char *directory_path,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_watcher_free(
+     libscca_watcher_t **watcher,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_watcher_set_debounce_time(
+     libscca_watcher_t *watcher,
+     uint32_t debounce_time,
+     libcerror_error_t **error );
+
+int libscca_internal_watcher_is_prefetch_filename(
+     const char *filename,
+     size_t filename_length );
+
+int libscca_internal_watcher_get_entry_by_filename(
+     libscca_internal_watcher_t *internal_watcher,
+     const char *filename,
+     size_t filename_length,
+     uint64_t *filename_hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libscca_internal_watcher_change_filename(
+     libscca_internal_watcher_t *internal_watcher,
+     const char *filename,
+     size_t filename_length,
+     uint64_t change_timestamp,
+     libcerror_error_t **error );
+
+int libscca_internal_watcher_remove_filename(
+     libscca_internal_watcher_t *internal_watcher,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+void libscca_internal_watcher_change_all(
+      libscca_internal_watcher_t *internal_watcher,
+      uint64_t change_timestamp );
+
+int libscca_internal_watcher_read_changes(
+     libscca_internal_watcher_t *internal_watcher,
+     int timeout,
+     libcerror_error_t **error );
+
+int libscca_internal_watcher_process_entry(
+     libscca_internal_watcher_t *internal_watcher,
+     int entry_index,
+     int (*callback_function)(
+            const char *filename,
+            libscca_file_t *previous_file,
+            libscca_file_t *file,
+            libscca_diff_t *diff,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_watcher_wait(
+     libscca_watcher_t *watcher,
+     int timeout,
+     int (*callback_function)(
+            const char *filename,
+            libscca_file_t *previous_file,
+            libscca_file_t *file,
+            libscca_diff_t *diff,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_WATCHER_H ) */
+
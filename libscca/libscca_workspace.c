@@ -0,0 +1,1459 @@
+/*
+ * Workspace functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libscca_definitions.h"
+#include "libscca_format_layout.h"
+#include "libscca_libcerror.h"
+#include "libscca_lzxpress.h"
+#include "libscca_support.h"
+#include "libscca_utf16_stream.h"
+#include "libscca_workspace.h"
+
+#include "scca_file_header.h"
+#include "scca_file_information.h"
+#include "scca_file_metrics_array.h"
+#include "scca_volume_information.h"
+
+/* Rounds a size up to the workspace alignment
+ */
+#define libscca_workspace_align_size( size ) \
+	( ( ( size ) + ( LIBSCCA_WORKSPACE_ALIGNMENT - 1 ) ) & ~( (size_t) LIBSCCA_WORKSPACE_ALIGNMENT - 1 ) )
+
+/* Determines the regions of a workspace
+ * The workspace contains the view, the uncompressed data, the string offsets
+ * shared by the filenames and the directory strings and the volumes.
+ * Every string takes at least 2 bytes and every volume at least the size of
+ * the format version 17 volume information, hence the number of string offsets
+ * and volumes are bounded by the uncompressed data size
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_workspace_get_layout(
+     size_t uncompressed_data_size,
+     libscca_workspace_layout_t *workspace_layout,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libscca_workspace_get_layout";
+	size_t maximum_number_of_string_offsets = 0;
+	size_t maximum_number_of_volumes        = 0;
+	size_t workspace_offset                 = 0;
+
+	if( ( uncompressed_data_size < sizeof( scca_file_header_t ) )
+	 || ( uncompressed_data_size > (size_t) INT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( workspace_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid workspace layout.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_string_offsets = ( uncompressed_data_size / 2 ) + 1;
+	maximum_number_of_volumes        = uncompressed_data_size / sizeof( scca_volume_information_v17_t );
+
+	workspace_offset = libscca_workspace_align_size( sizeof( libscca_workspace_view_t ) );
+
+	workspace_layout->data_offset = workspace_offset;
+
+	workspace_offset += libscca_workspace_align_size( uncompressed_data_size );
+
+	workspace_layout->string_offsets_offset            = workspace_offset;
+	workspace_layout->maximum_number_of_string_offsets = (int) maximum_number_of_string_offsets;
+
+	workspace_offset += libscca_workspace_align_size( sizeof( uint32_t ) * maximum_number_of_string_offsets );
+
+	workspace_layout->volumes_offset            = workspace_offset;
+	workspace_layout->maximum_number_of_volumes = (int) maximum_number_of_volumes;
+
+	workspace_offset += sizeof( libscca_workspace_volume_t ) * maximum_number_of_volumes;
+
+	/* Allow for a workspace that is not aligned
+	 */
+	workspace_layout->workspace_size = workspace_offset + ( LIBSCCA_WORKSPACE_ALIGNMENT - 1 );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the workspace needed by libscca_workspace_parse
+ * to parse a file with a specific uncompressed data size
+ * For an uncompressed file the uncompressed data size is the file size
+ * and for a compressed file the size stored in the MAM file header
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_get_workspace_size(
+     size_t uncompressed_data_size,
+     size_t *workspace_size,
+     libcerror_error_t **error )
+{
+	libscca_workspace_layout_t workspace_layout;
+
+	static char *function = "libscca_get_workspace_size";
+
+	if( workspace_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid workspace size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_workspace_get_layout(
+	     uncompressed_data_size,
+	     &workspace_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine workspace layout.",
+		 function );
+
+		return( -1 );
+	}
+	*workspace_size = workspace_layout.workspace_size;
+
+	return( 1 );
+}
+
+/* Reads the volumes from the volumes information data of the view
+ * The volumes are validated the same way as libscca_io_handle_read_volumes_information_data
+ * but reference the volumes information data instead of copies of it
+ * The offsets of the directory strings are stored in the string offsets
+ * after the number of string offsets already in use, which is updated
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_workspace_read_volumes(
+     libscca_workspace_view_t *view,
+     const libscca_format_layout_t *format_layout,
+     uint32_t number_of_volumes,
+     libscca_workspace_volume_t *volumes,
+     int maximum_number_of_volumes,
+     uint32_t *string_offsets,
+     int maximum_number_of_string_offsets,
+     int *number_of_string_offsets,
+     libcerror_error_t **error )
+{
+	libscca_workspace_volume_t *volume      = NULL;
+	const uint8_t *data                     = NULL;
+	const uint8_t *volume_information_data  = NULL;
+	static char *function                   = "libscca_workspace_read_volumes";
+	size_t volume_information_size          = 0;
+	uint32_t device_path_offset             = 0;
+	uint32_t device_path_size               = 0;
+	uint32_t directory_string_index         = 0;
+	uint32_t directory_string_offset        = 0;
+	uint32_t directory_strings_array_offset = 0;
+	uint32_t file_references_data_size      = 0;
+	uint32_t file_references_offset         = 0;
+	uint32_t file_references_size           = 0;
+	uint32_t number_of_directory_strings    = 0;
+	uint32_t number_of_file_references      = 0;
+	uint32_t volume_index                   = 0;
+	uint32_t volume_information_offset      = 0;
+	uint32_t volumes_information_size       = 0;
+	uint16_t number_of_characters           = 0;
+	int string_offset_index                 = 0;
+
+	if( view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( view->volumes_information_data == NULL )
+	 || ( view->volumes_information_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid view - volumes information value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	data                     = view->volumes_information_data;
+	volumes_information_size = (uint32_t) view->volumes_information_size;
+	volume_information_size  = format_layout->volume_information_data_size;
+
+	if( ( volume_information_size == 0 )
+	 || ( volume_information_size > volumes_information_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volumes information size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) number_of_volumes > ( (size_t) volumes_information_size / volume_information_size ) )
+	 || ( number_of_volumes > (uint32_t) maximum_number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	string_offset_index = *number_of_string_offsets;
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		volume                  = &( volumes[ volume_index ] );
+		volume_information_data = &( data[ volume_information_offset ] );
+
+		if( memory_set(
+		     volume,
+		     0,
+		     sizeof( libscca_workspace_volume_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear volume: %" PRIu32 ".",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_offset,
+		 device_path_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->device_path_number_of_characters,
+		 device_path_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->creation_time,
+		 volume->creation_time );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->serial_number,
+		 volume->serial_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_offset,
+		 file_references_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->file_references_size,
+		 file_references_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->directory_strings_array_offset,
+		 directory_strings_array_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (scca_volume_information_v17_t *) volume_information_data )->number_of_directory_strings,
+		 number_of_directory_strings );
+
+		volume_information_offset += (uint32_t) volume_information_size;
+
+		if( ( device_path_offset != 0 )
+		 && ( device_path_size > 0 ) )
+		{
+			if( ( device_path_offset < volume_information_offset )
+			 || ( device_path_offset >= volumes_information_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " device path offset value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			if( device_path_size > ( volumes_information_size / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " device path size value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			device_path_size *= 2;
+
+			if( device_path_offset >= ( volumes_information_size - device_path_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " device path size value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			volume->device_path      = &( data[ device_path_offset ] );
+			volume->device_path_size = (size_t) device_path_size;
+		}
+		if( file_references_offset != 0 )
+		{
+			if( ( file_references_offset < volume_information_offset )
+			 || ( file_references_offset >= volumes_information_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " file references offset value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			if( ( file_references_size < 8 )
+			 || ( file_references_size > volumes_information_size )
+			 || ( file_references_offset >= ( volumes_information_size - file_references_size ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " file references size value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			/* Skip the version
+			 */
+			file_references_offset += 4;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ file_references_offset ] ),
+			 number_of_file_references );
+
+			file_references_offset += 4;
+
+			file_references_data_size = file_references_size - 8;
+
+			if( format_layout->file_references_header_size > 8 )
+			{
+				if( file_references_data_size < 8 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volume: %" PRIu32 " file references size value out of bounds.",
+					 function,
+					 volume_index );
+
+					return( -1 );
+				}
+				file_references_offset    += 8;
+				file_references_data_size -= 8;
+			}
+			if( number_of_file_references > ( file_references_data_size / 8 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " number of file references value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			volume->file_references_data      = &( data[ file_references_offset ] );
+			volume->number_of_file_references = (int) number_of_file_references;
+		}
+		if( directory_strings_array_offset != 0 )
+		{
+			if( ( directory_strings_array_offset < volume_information_offset )
+			 || ( directory_strings_array_offset >= volumes_information_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " directory strings array offset value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			if( number_of_directory_strings > ( ( volumes_information_size - directory_strings_array_offset ) / 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume: %" PRIu32 " number of directory strings value out of bounds.",
+				 function,
+				 volume_index );
+
+				return( -1 );
+			}
+			volume->directory_string_offsets = &( string_offsets[ string_offset_index ] );
+
+			directory_string_index  = 0;
+			directory_string_offset = directory_strings_array_offset;
+
+			while( directory_string_offset < ( volumes_information_size - 4 ) )
+			{
+				if( directory_string_index >= number_of_directory_strings )
+				{
+					break;
+				}
+				if( string_offset_index >= maximum_number_of_string_offsets )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volume: %" PRIu32 " number of directory strings exceeds workspace.",
+					 function,
+					 volume_index );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( data[ directory_string_offset ] ),
+				 number_of_characters );
+
+				string_offsets[ string_offset_index++ ] = directory_string_offset;
+
+				directory_string_offset += 2;
+
+				if( number_of_characters > ( ( volumes_information_size - 2 - directory_string_offset ) / 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid volume: %" PRIu32 " directory string: %" PRIu32 " number of characters value out of bounds.",
+					 function,
+					 volume_index,
+					 directory_string_index );
+
+					return( -1 );
+				}
+				/* The number of characters does not include the end-of-string character
+				 */
+				directory_string_offset += ( (uint32_t) number_of_characters * 2 ) + 2;
+
+				directory_string_index++;
+			}
+			volume->number_of_directory_strings = (int) directory_string_index;
+		}
+	}
+	view->volumes           = volumes;
+	view->number_of_volumes = (int) number_of_volumes;
+
+	*number_of_string_offsets = string_offset_index;
+
+	return( 1 );
+}
+
+/* Parses a file into a caller provided workspace without allocating memory
+ * The data should contain the whole file. Uncompressed data is referenced in place,
+ * compressed data is decompressed into the workspace. The sections are validated
+ * the same way as libscca_file_open and the view and the tables it references,
+ * such as the string offsets and the volumes, are stored in the workspace
+ * The size of the workspace is determined by libscca_get_workspace_size
+ * Since libcerror allocates memory for an error, error should be NULL
+ * to parse without allocating memory at all
+ * Returns 1 if successful, 0 if the data cannot be parsed without allocating memory or -1 on error
+ */
+int libscca_workspace_parse(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *workspace,
+     size_t workspace_size,
+     libscca_workspace_view_t **view,
+     libcerror_error_t **error )
+{
+	libscca_workspace_layout_t workspace_layout;
+
+	const libscca_format_layout_t *format_layout = NULL;
+	libscca_workspace_view_t *workspace_view     = NULL;
+	const uint8_t *file_information_data         = NULL;
+	const uint8_t *uncompressed_data             = NULL;
+	uint32_t *string_offsets                     = NULL;
+	uint8_t *aligned_workspace                   = NULL;
+	static char *function                        = "libscca_workspace_parse";
+	size_t executable_filename_size              = 0;
+	size_t file_offset                           = 0;
+	size_t next_offset                           = 0;
+	size_t section_size                          = 0;
+	size_t uncompressed_data_size                = 0;
+	uint32_t file_size                           = 0;
+	uint32_t filename_strings_offset             = 0;
+	uint32_t filename_strings_size               = 0;
+	uint32_t metrics_array_offset                = 0;
+	uint32_t number_of_file_metrics_entries      = 0;
+	uint32_t number_of_trace_chain_entries       = 0;
+	uint32_t number_of_volumes                   = 0;
+	uint32_t trace_chain_array_offset            = 0;
+	uint32_t volumes_information_offset          = 0;
+	uint32_t volumes_information_size            = 0;
+	int file_type                                = 0;
+	int last_run_time_index                      = 0;
+	int number_of_string_offsets                 = 0;
+	int result                                   = 0;
+
+	if( workspace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid workspace.",
+		 function );
+
+		return( -1 );
+	}
+	if( view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid view.",
+		 function );
+
+		return( -1 );
+	}
+	result = libscca_check_signature_buffer(
+	          data,
+	          data_size,
+	          &file_type,
+	          &file_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check signature.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		uncompressed_data_size = data_size;
+	}
+	else
+	{
+		uncompressed_data_size = (size_t) file_size;
+	}
+	if( libscca_workspace_get_layout(
+	     uncompressed_data_size,
+	     &workspace_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine workspace layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( workspace_size < workspace_layout.workspace_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid workspace size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_workspace = &( workspace[ ( LIBSCCA_WORKSPACE_ALIGNMENT - ( (uintptr_t) workspace % LIBSCCA_WORKSPACE_ALIGNMENT ) ) % LIBSCCA_WORKSPACE_ALIGNMENT ] );
+	workspace_view    = (libscca_workspace_view_t *) aligned_workspace;
+	string_offsets    = (uint32_t *) &( aligned_workspace[ workspace_layout.string_offsets_offset ] );
+
+	if( memory_set(
+	     workspace_view,
+	     0,
+	     sizeof( libscca_workspace_view_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear view.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_type == LIBSCCA_FILE_TYPE_UNCOMPRESSED )
+	{
+		uncompressed_data = data;
+	}
+	else
+	{
+		/* The fast path decodes the chunks with a decoder on the stack, data that
+		 * only libfwnt can decompress would require allocating memory
+		 */
+		result = libscca_lzxpress_huffman_decompress_fast(
+		          &( data[ sizeof( scca_mam_file_header_t ) ] ),
+		          data_size - sizeof( scca_mam_file_header_t ),
+		          &( aligned_workspace[ workspace_layout.data_offset ] ),
+		          &uncompressed_data_size,
+		          NULL,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		uncompressed_data = &( aligned_workspace[ workspace_layout.data_offset ] );
+	}
+	if( uncompressed_data_size < ( sizeof( scca_file_header_t ) + sizeof( uint32_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_header_t *) uncompressed_data )->format_version,
+	 workspace_view->format_version );
+
+	file_information_data = &( uncompressed_data[ sizeof( scca_file_header_t ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->metrics_array_offset,
+	 metrics_array_offset );
+
+	if( libscca_format_layout_get_by_format_version(
+	     workspace_view->format_version,
+	     &format_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 workspace_view->format_version );
+
+		return( -1 );
+	}
+	if( libscca_format_layout_get_by_metrics_array_offset(
+	     format_layout,
+	     metrics_array_offset,
+	     &format_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported metrics array offset: 0x%08" PRIx32 ".",
+		 function,
+		 metrics_array_offset );
+
+		return( -1 );
+	}
+	file_offset = sizeof( scca_file_header_t ) + format_layout->file_information_data_size;
+
+	if( uncompressed_data_size < file_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	workspace_view->file_type = file_type;
+	workspace_view->data      = uncompressed_data;
+	workspace_view->data_size = uncompressed_data_size;
+
+	for( executable_filename_size = 0;
+	     ( executable_filename_size + 1 ) < 60;
+	     executable_filename_size += 2 )
+	{
+		if( ( ( (scca_file_header_t *) uncompressed_data )->executable_filename[ executable_filename_size ] == 0 )
+		 && ( ( (scca_file_header_t *) uncompressed_data )->executable_filename[ executable_filename_size + 1 ] == 0 ) )
+		{
+			break;
+		}
+	}
+	workspace_view->executable_filename        = ( (scca_file_header_t *) uncompressed_data )->executable_filename;
+	workspace_view->executable_filename_length = executable_filename_size / 2;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_header_t *) uncompressed_data )->prefetch_hash,
+	 workspace_view->prefetch_hash );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( file_information_data[ format_layout->run_count_offset ] ),
+	 workspace_view->run_count );
+
+	for( last_run_time_index = 0;
+	     last_run_time_index < format_layout->number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( file_information_data[ format_layout->last_run_times_offset + ( last_run_time_index * 8 ) ] ),
+		 workspace_view->last_run_times[ last_run_time_index ] );
+	}
+	workspace_view->number_of_last_run_times = format_layout->number_of_last_run_times;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->number_of_file_metrics_entries,
+	 number_of_file_metrics_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->trace_chain_array_offset,
+	 trace_chain_array_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->number_of_trace_chain_array_entries,
+	 number_of_trace_chain_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->filename_strings_offset,
+	 filename_strings_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->filename_strings_size,
+	 filename_strings_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->volumes_information_offset,
+	 volumes_information_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->number_of_volumes,
+	 number_of_volumes );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (scca_file_information_v17_t *) file_information_data )->volumes_information_size,
+	 volumes_information_size );
+
+	/* The sections are validated in the same order as libscca_file_validate_sections
+	 */
+	if( metrics_array_offset != 0 )
+	{
+		next_offset = (size_t) trace_chain_array_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = (size_t) filename_strings_offset;
+		}
+		if( next_offset == 0 )
+		{
+			next_offset = (size_t) volumes_information_offset;
+		}
+		if( ( next_offset == 0 )
+		 || ( next_offset > uncompressed_data_size ) )
+		{
+			next_offset = uncompressed_data_size;
+		}
+		section_size = (size_t) number_of_file_metrics_entries * format_layout->file_metrics_entry_data_size;
+
+		/* Allow for a margin of 8 + 4 bytes for version 30 variant 2
+		 */
+		if( ( (size_t) metrics_array_offset < ( file_offset - 12 ) )
+		 || ( (size_t) metrics_array_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid metrics array offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( number_of_file_metrics_entries > (uint32_t) INT_MAX )
+		 || ( section_size > ( uncompressed_data_size - metrics_array_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of file metrics entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		workspace_view->file_metrics_data              = &( uncompressed_data[ metrics_array_offset ] );
+		workspace_view->file_metrics_entry_size        = format_layout->file_metrics_entry_data_size;
+		workspace_view->number_of_file_metrics_entries = (int) number_of_file_metrics_entries;
+
+		file_offset = (size_t) metrics_array_offset + section_size;
+	}
+	if( trace_chain_array_offset != 0 )
+	{
+		next_offset = (size_t) filename_strings_offset;
+
+		if( next_offset == 0 )
+		{
+			next_offset = (size_t) volumes_information_offset;
+		}
+		if( ( next_offset == 0 )
+		 || ( next_offset > uncompressed_data_size ) )
+		{
+			next_offset = uncompressed_data_size;
+		}
+		section_size = (size_t) number_of_trace_chain_entries * format_layout->trace_chain_entry_data_size;
+
+		if( ( (size_t) trace_chain_array_offset < file_offset )
+		 || ( (size_t) trace_chain_array_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid trace chain array offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( number_of_trace_chain_entries > (uint32_t) INT_MAX )
+		 || ( section_size > ( uncompressed_data_size - trace_chain_array_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of trace chain entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		workspace_view->trace_chain_data              = &( uncompressed_data[ trace_chain_array_offset ] );
+		workspace_view->trace_chain_entry_size        = format_layout->trace_chain_entry_data_size;
+		workspace_view->number_of_trace_chain_entries = (int) number_of_trace_chain_entries;
+	}
+	if( filename_strings_offset != 0 )
+	{
+		next_offset = (size_t) volumes_information_offset;
+
+		if( ( next_offset == 0 )
+		 || ( next_offset > uncompressed_data_size ) )
+		{
+			next_offset = uncompressed_data_size;
+		}
+		if( ( (size_t) filename_strings_offset < file_offset )
+		 || ( (size_t) filename_strings_offset >= next_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename strings offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) filename_strings_size > ( next_offset - filename_strings_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename strings size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		workspace_view->filename_strings_data = &( uncompressed_data[ filename_strings_offset ] );
+		workspace_view->filename_strings_size = (size_t) filename_strings_size;
+
+		if( libscca_utf16_stream_get_string_offsets(
+		     workspace_view->filename_strings_data,
+		     workspace_view->filename_strings_size,
+		     string_offsets,
+		     workspace_layout.maximum_number_of_string_offsets,
+		     &number_of_string_offsets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename offsets.",
+			 function );
+
+			return( -1 );
+		}
+		workspace_view->filename_offsets    = string_offsets;
+		workspace_view->number_of_filenames = number_of_string_offsets;
+
+		file_offset = (size_t) filename_strings_offset + filename_strings_size;
+	}
+	if( ( volumes_information_offset != 0 )
+	 && ( number_of_volumes != 0 ) )
+	{
+		if( ( (size_t) volumes_information_offset < file_offset )
+		 || ( (size_t) volumes_information_offset > uncompressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) volumes_information_size > ( uncompressed_data_size - volumes_information_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid volumes information size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		workspace_view->volumes_information_data = &( uncompressed_data[ volumes_information_offset ] );
+		workspace_view->volumes_information_size = (size_t) volumes_information_size;
+
+		if( libscca_workspace_read_volumes(
+		     workspace_view,
+		     format_layout,
+		     number_of_volumes,
+		     (libscca_workspace_volume_t *) &( aligned_workspace[ workspace_layout.volumes_offset ] ),
+		     workspace_layout.maximum_number_of_volumes,
+		     string_offsets,
+		     workspace_layout.maximum_number_of_string_offsets,
+		     &number_of_string_offsets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volumes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*view = workspace_view;
+
+	return( 1 );
+}
+
+/* Retrieves a specific filename of the filename strings
+ * The UTF-16 little-endian stream references the parsed data and includes
+ * the end-of-string character, except for a last string without one
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_workspace_view_get_filename(
+     const libscca_workspace_view_t *view,
+     int filename_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libscca_workspace_view_get_filename";
+	size_t string_offset  = 0;
+	size_t string_size    = 0;
+
+	if( view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_index < 0 )
+	 || ( filename_index >= view->number_of_filenames ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	string_offset = (size_t) view->filename_offsets[ filename_index ];
+
+	if( ( filename_index + 1 ) < view->number_of_filenames )
+	{
+		string_size = (size_t) view->filename_offsets[ filename_index + 1 ] - string_offset;
+	}
+	else
+	{
+		string_size = view->filename_strings_size - string_offset;
+	}
+	*utf16_stream      = &( view->filename_strings_data[ string_offset ] );
+	*utf16_stream_size = string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the values of a specific file metrics entry
+ * The UTF-16 little-endian filename stream references the filename strings and
+ * is not terminated by an end-of-string character
+ * The file reference is 0 for format version 17, which does not store file references
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_workspace_view_get_file_metrics_entry(
+     const libscca_workspace_view_t *view,
+     int entry_index,
+     const uint8_t **filename_utf16_stream,
+     size_t *filename_utf16_stream_size,
+     uint32_t *flags,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	const libscca_format_layout_t *format_layout = NULL;
+	const uint8_t *entry_data                    = NULL;
+	static char *function                        = "libscca_workspace_view_get_file_metrics_entry";
+	uint32_t filename_string_offset              = 0;
+	uint32_t number_of_characters                = 0;
+
+	if( view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= view->number_of_file_metrics_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_format_layout_get_by_format_version(
+	     view->format_version,
+	     &format_layout,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 view->format_version );
+
+		return( -1 );
+	}
+	entry_data = &( view->file_metrics_data[ (size_t) entry_index * view->file_metrics_entry_size ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ format_layout->filename_string_offset_offset ] ),
+	 filename_string_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ format_layout->filename_string_offset_offset + 4 ] ),
+	 number_of_characters );
+
+	if( ( (size_t) filename_string_offset >= view->filename_strings_size )
+	 || ( (size_t) number_of_characters > ( ( view->filename_strings_size - filename_string_offset ) / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %d filename string value out of bounds.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( entry_data[ format_layout->file_metrics_flags_offset ] ),
+	 *flags );
+
+	if( format_layout->file_metrics_has_file_reference != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (scca_file_metrics_array_entry_v23_t *) entry_data )->file_reference,
+		 *file_reference );
+	}
+	else
+	{
+		*file_reference = 0;
+	}
+	*filename_utf16_stream      = &( view->filename_strings_data[ filename_string_offset ] );
+	*filename_utf16_stream_size = (size_t) number_of_characters * 2;
+
+	return( 1 );
+}
+
+/* Retrieves a specific file reference of a volume
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_workspace_view_get_file_reference(
+     const libscca_workspace_view_t *view,
+     int volume_index,
+     int file_reference_index,
+     uint64_t *file_reference,
+     libcerror_error_t **error )
+{
+	const libscca_workspace_volume_t *volume = NULL;
+	static char *function                    = "libscca_workspace_view_get_file_reference";
+
+	if( view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index < 0 )
+	 || ( volume_index >= view->number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	volume = &( view->volumes[ volume_index ] );
+
+	if( ( file_reference_index < 0 )
+	 || ( file_reference_index >= volume->number_of_file_references ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( volume->file_references_data[ (size_t) file_reference_index * 8 ] ),
+	 *file_reference );
+
+	return( 1 );
+}
+
+/* Retrieves a specific directory string of a volume
+ * The UTF-16 little-endian stream references the volumes information
+ * and includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libscca_workspace_view_get_directory_string(
+     const libscca_workspace_view_t *view,
+     int volume_index,
+     int directory_string_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	const libscca_workspace_volume_t *volume = NULL;
+	static char *function                    = "libscca_workspace_view_get_directory_string";
+	uint32_t directory_string_offset         = 0;
+	uint16_t number_of_characters            = 0;
+
+	if( view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index < 0 )
+	 || ( volume_index >= view->number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	volume = &( view->volumes[ volume_index ] );
+
+	if( ( directory_string_index < 0 )
+	 || ( directory_string_index >= volume->number_of_directory_strings ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	directory_string_offset = volume->directory_string_offsets[ directory_string_index ];
+
+	/* The number of characters was validated by libscca_workspace_read_volumes
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 &( view->volumes_information_data[ directory_string_offset ] ),
+	 number_of_characters );
+
+	*utf16_stream      = &( view->volumes_information_data[ directory_string_offset + 2 ] );
+	*utf16_stream_size = ( (size_t) number_of_characters * 2 ) + 2;
+
+	return( 1 );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Workspace functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSCCA_WORKSPACE_H )
+#define _LIBSCCA_WORKSPACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libscca_extern.h"
+#include "libscca_format_layout.h"
+#include "libscca_libcerror.h"
+#include "libscca_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libscca_workspace_layout libscca_workspace_layout_t;
+
+/* The regions of a workspace
+ * The offsets are relative to the aligned start of the workspace
+ */
+struct libscca_workspace_layout
+{
+	/* The offset of the uncompressed data
+	 */
+	size_t data_offset;
+
+	/* The offset of the string offsets
+	 */
+	size_t string_offsets_offset;
+
+	/* The maximum number of string offsets
+	 */
+	int maximum_number_of_string_offsets;
+
+	/* The offset of the volumes
+	 */
+	size_t volumes_offset;
+
+	/* The maximum number of volumes
+	 */
+	int maximum_number_of_volumes;
+
+	/* The workspace size, which includes the alignment padding
+	 */
+	size_t workspace_size;
+};
+
+int libscca_workspace_get_layout(
+     size_t uncompressed_data_size,
+     libscca_workspace_layout_t *workspace_layout,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_get_workspace_size(
+     size_t uncompressed_data_size,
+     size_t *workspace_size,
+     libcerror_error_t **error );
+
+int libscca_workspace_read_volumes(
+     libscca_workspace_view_t *view,
+     const libscca_format_layout_t *format_layout,
+     uint32_t number_of_volumes,
+     libscca_workspace_volume_t *volumes,
+     int maximum_number_of_volumes,
+     uint32_t *string_offsets,
+     int maximum_number_of_string_offsets,
+     int *number_of_string_offsets,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_workspace_parse(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *workspace,
+     size_t workspace_size,
+     libscca_workspace_view_t **view,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_workspace_view_get_filename(
+     const libscca_workspace_view_t *view,
+     int filename_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_workspace_view_get_file_metrics_entry(
+     const libscca_workspace_view_t *view,
+     int entry_index,
+     const uint8_t **filename_utf16_stream,
+     size_t *filename_utf16_stream_size,
+     uint32_t *flags,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_workspace_view_get_file_reference(
+     const libscca_workspace_view_t *view,
+     int volume_index,
+     int file_reference_index,
+     uint64_t *file_reference,
+     libcerror_error_t **error );
+
+LIBSCCA_EXTERN \
+int libscca_workspace_view_get_directory_string(
+     const libscca_workspace_view_t *view,
+     int volume_index,
+     int directory_string_index,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSCCA_WORKSPACE_H ) */
+
@@ -0,0 +1,163 @@
+/*
+ * The filename index format definitions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCCA_INDEX_HEADER_H )
+#define _SCCA_INDEX_HEADER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scca_index_header scca_index_header_t;
+
+struct scca_index_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "SCCAINDX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The index format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of files
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_files[ 4 ];
+
+	/* The number of strings
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_strings[ 4 ];
+
+	/* The number of hash table entries, which is a power of 2
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash_table_size[ 4 ];
+
+	/* The number of postings
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_postings[ 8 ];
+
+	/* The offset of the string entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t strings_offset[ 8 ];
+
+	/* The offset of the hash table
+	 * Consists of 8 bytes
+	 */
+	uint8_t hash_table_offset[ 8 ];
+
+	/* The offset of the postings
+	 * Consists of 8 bytes
+	 */
+	uint8_t postings_offset[ 8 ];
+
+	/* The offset of the file entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t files_offset[ 8 ];
+
+	/* The offset of the string data
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_data_offset[ 8 ];
+
+	/* The size of the string data
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_data_size[ 8 ];
+
+	/* The offset of the label data
+	 * Consists of 8 bytes
+	 */
+	uint8_t label_data_offset[ 8 ];
+
+	/* The size of the label data
+	 * Consists of 8 bytes
+	 */
+	uint8_t label_data_size[ 8 ];
+};
+
+typedef struct scca_index_string_entry scca_index_string_entry_t;
+
+struct scca_index_string_entry
+{
+	/* The offset of the string relative to the start of the string data
+	 * Consists of 4 bytes
+	 */
+	uint8_t string_offset[ 4 ];
+
+	/* The size of the UTF-8 string without the end of string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t string_size[ 4 ];
+
+	/* The index of the first posting of the string
+	 * Consists of 8 bytes
+	 */
+	uint8_t first_posting_index[ 8 ];
+};
+
+typedef struct scca_index_posting scca_index_posting_t;
+
+struct scca_index_posting
+{
+	/* The index of the file
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_index[ 4 ];
+
+	/* The index of the file metrics entry
+	 * Consists of 4 bytes
+	 */
+	uint8_t metrics_entry_index[ 4 ];
+};
+
+typedef struct scca_index_file_entry scca_index_file_entry_t;
+
+struct scca_index_file_entry
+{
+	/* The offset of the label relative to the start of the label data
+	 * Consists of 4 bytes
+	 */
+	uint8_t label_offset[ 4 ];
+
+	/* The size of the UTF-8 label without the end of string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t label_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCCA_INDEX_HEADER_H ) */
+
@@ -0,0 +1,171 @@
+/*
+ * The pack format definitions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCCA_PACK_TRAILER_H )
+#define _SCCA_PACK_TRAILER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scca_pack_trailer scca_pack_trailer_t;
+
+/* The trailer is stored at the end of the pack data so that the pack
+ * can be written sequentially
+ */
+struct scca_pack_trailer
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "SCCAPACK"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The pack format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of files
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_files[ 4 ];
+
+	/* The number of strings
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_strings[ 4 ];
+
+	/* The number of hash table entries, which is a power of 2
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash_table_size[ 4 ];
+
+	/* The offset of the file entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t files_offset[ 8 ];
+
+	/* The offset of the hash table
+	 * Consists of 8 bytes
+	 */
+	uint8_t hash_table_offset[ 8 ];
+
+	/* The offset of the prefetch hash entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t prefetch_hashes_offset[ 8 ];
+
+	/* The offset of the string entries
+	 * Consists of 8 bytes
+	 */
+	uint8_t strings_offset[ 8 ];
+
+	/* The offset of the string data
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_data_offset[ 8 ];
+
+	/* The size of the string data
+	 * Consists of 8 bytes
+	 */
+	uint8_t string_data_size[ 8 ];
+};
+
+typedef struct scca_pack_file_entry scca_pack_file_entry_t;
+
+struct scca_pack_file_entry
+{
+	/* The offset of the snapshot data of the file
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_offset[ 8 ];
+
+	/* The size of the snapshot data of the file
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The XXH64 based hash of the key of the file
+	 * Consists of 8 bytes
+	 */
+	uint8_t key_hash[ 8 ];
+
+	/* The index of the host string
+	 * Consists of 4 bytes
+	 */
+	uint8_t host_string_index[ 4 ];
+
+	/* The index of the path string
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_string_index[ 4 ];
+
+	/* The prefetch hash of the file
+	 * Consists of 4 bytes
+	 */
+	uint8_t prefetch_hash[ 4 ];
+
+	/* The format version of the file
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+};
+
+typedef struct scca_pack_prefetch_hash_entry scca_pack_prefetch_hash_entry_t;
+
+struct scca_pack_prefetch_hash_entry
+{
+	/* The prefetch hash
+	 * Consists of 4 bytes
+	 */
+	uint8_t prefetch_hash[ 4 ];
+
+	/* The index of the file
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_index[ 4 ];
+};
+
+typedef struct scca_pack_string_entry scca_pack_string_entry_t;
+
+struct scca_pack_string_entry
+{
+	/* The offset of the string relative to the start of the string data
+	 * Consists of 4 bytes
+	 */
+	uint8_t string_offset[ 4 ];
+
+	/* The size of the UTF-8 string without the end of string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t string_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCCA_PACK_TRAILER_H ) */
+
@@ -0,0 +1,104 @@
+/*
+ * The snapshot header definition of parsed Windows Prefetch File (PF) data
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCCA_SNAPSHOT_HEADER_H )
+#define _SCCA_SNAPSHOT_HEADER_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct scca_snapshot_header scca_snapshot_header_t;
+
+struct scca_snapshot_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "SCCASNAP"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The snapshot format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t snapshot_format_version[ 4 ];
+
+	/* The data offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_offset[ 4 ];
+
+	/* The data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+
+	/* The XXH64 checksum of the data
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_checksum[ 8 ];
+
+	/* The format version of the prefetch data
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The size of the file the snapshot was created from
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_size[ 4 ];
+
+	/* The filename Bloom filter offset
+	 * Consists of 4 bytes
+	 * Contains 0 if the snapshot has no filename Bloom filter
+	 */
+	uint8_t bloom_filter_offset[ 4 ];
+
+	/* The filename Bloom filter size
+	 * Consists of 4 bytes
+	 */
+	uint8_t bloom_filter_size[ 4 ];
+
+	/* The XXH64 checksum of the filename Bloom filter
+	 * Consists of 8 bytes
+	 */
+	uint8_t bloom_filter_checksum[ 8 ];
+
+	/* The number of hashes of the filename Bloom filter
+	 * Consists of 4 bytes
+	 */
+	uint8_t bloom_filter_number_of_hashes[ 4 ];
+
+	/* Reserved
+	 * Consists of 4 bytes
+	 */
+	uint8_t reserved[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCCA_SNAPSHOT_HEADER_H ) */
+
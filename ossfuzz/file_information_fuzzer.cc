@@ -0,0 +1,87 @@
+/*
+ * OSS-Fuzz target for libscca file information section
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libscca.h"
+#include "ossfuzz_section.h"
+
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+
+#include "../libscca/libscca_file_information.h"
+#include "../libscca/libscca_io_handle.h"
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+	libscca_file_information_t *file_information = NULL;
+	libscca_io_handle_t *io_handle               = NULL;
+
+	if( size < 1 )
+	{
+		return( 0 );
+	}
+	if( libscca_io_handle_initialize(
+	     &io_handle,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	io_handle->format_version = ossfuzz_section_format_versions[ data[ 0 ] % OSSFUZZ_SECTION_NUMBER_OF_FORMAT_VERSIONS ];
+
+	if( libscca_file_information_initialize(
+	     &file_information,
+	     NULL ) != 1 )
+	{
+		goto on_error_io_handle;
+	}
+	libscca_file_information_read_data(
+	 file_information,
+	 io_handle,
+	 &( data[ 1 ] ),
+	 size - 1,
+	 NULL );
+
+	libscca_file_information_free(
+	 &file_information,
+	 NULL );
+
+on_error_io_handle:
+	libscca_io_handle_free(
+	 &io_handle,
+	 NULL );
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
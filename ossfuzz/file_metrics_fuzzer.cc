@@ -0,0 +1,172 @@
+/*
+ * OSS-Fuzz target for libscca file metrics array section
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libscca.h"
+#include "ossfuzz_section.h"
+
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+
+#include "../libscca/libscca_arena.h"
+#include "../libscca/libscca_file_metrics.h"
+#include "../libscca/libscca_filename_strings.h"
+#include "../libscca/libscca_io_handle.h"
+#include "../libscca/libscca_libcdata.h"
+
+#include "../libscca/scca_file_metrics_array.h"
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+	libcdata_array_t *file_metrics_array            = NULL;
+	libscca_arena_t *arena                          = NULL;
+	libscca_filename_strings_t *filename_strings    = NULL;
+	libscca_internal_file_metrics_t *file_metrics   = NULL;
+	libscca_io_handle_t *io_handle                  = NULL;
+	size_t entry_data_size                          = 0;
+	size_t file_metrics_array_size                  = 0;
+	uint32_t number_of_entries                      = 0;
+	int entry_index                                 = 0;
+
+	if( size < 2 )
+	{
+		return( 0 );
+	}
+	if( libscca_io_handle_initialize(
+	     &io_handle,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	io_handle->format_version = ossfuzz_section_format_versions[ data[ 0 ] % OSSFUZZ_SECTION_NUMBER_OF_FORMAT_VERSIONS ];
+
+	if( io_handle->format_version == 17 )
+	{
+		entry_data_size = sizeof( scca_file_metrics_array_entry_v17_t );
+	}
+	else
+	{
+		entry_data_size = sizeof( scca_file_metrics_array_entry_v23_t );
+	}
+	/* The second byte contains the number of entries, the entries are followed
+	 * by the filename strings the entries refer to
+	 */
+	number_of_entries       = (uint32_t) data[ 1 ] + 1;
+	file_metrics_array_size = (size_t) number_of_entries * entry_data_size;
+
+	if( file_metrics_array_size > ( size - 2 ) )
+	{
+		goto on_error_io_handle;
+	}
+	if( libscca_arena_initialize(
+	     &arena,
+	     LIBSCCA_ARENA_DEFAULT_BLOCK_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error_io_handle;
+	}
+	if( libscca_filename_strings_initialize(
+	     &filename_strings,
+	     NULL ) != 1 )
+	{
+		goto on_error_arena;
+	}
+	if( libcdata_array_initialize(
+	     &file_metrics_array,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error_filename_strings;
+	}
+	if( ( size - 2 ) > file_metrics_array_size )
+	{
+		libscca_filename_strings_read_data(
+		 filename_strings,
+		 &( data[ 2 + file_metrics_array_size ] ),
+		 size - 2 - file_metrics_array_size,
+		 NULL );
+	}
+	if( libscca_io_handle_read_file_metrics_array_data(
+	     io_handle,
+	     &( data[ 2 ] ),
+	     file_metrics_array_size,
+	     number_of_entries,
+	     filename_strings,
+	     arena,
+	     file_metrics_array,
+	     NULL ) == 1 )
+	{
+		for( entry_index = 0;
+		     entry_index < (int) number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     file_metrics_array,
+			     entry_index,
+			     (intptr_t **) &file_metrics,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+			libscca_internal_file_metrics_resolve_filename_index(
+			 file_metrics,
+			 NULL );
+		}
+	}
+	/* The file metrics are allocated from the arena and released when the arena is freed
+	 */
+	libcdata_array_free(
+	 &file_metrics_array,
+	 NULL,
+	 NULL );
+
+on_error_filename_strings:
+	libscca_filename_strings_free(
+	 &filename_strings,
+	 NULL );
+
+on_error_arena:
+	libscca_arena_free(
+	 &arena,
+	 NULL );
+
+on_error_io_handle:
+	libscca_io_handle_free(
+	 &io_handle,
+	 NULL );
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
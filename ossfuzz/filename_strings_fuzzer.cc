@@ -0,0 +1,84 @@
+/*
+ * OSS-Fuzz target for libscca filename strings section
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libscca.h"
+#include "ossfuzz_section.h"
+
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+
+#include "../libscca/libscca_filename_strings.h"
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+	libscca_filename_strings_t *filename_strings = NULL;
+	int filename_index                           = 0;
+
+	if( size < 1 )
+	{
+		return( 0 );
+	}
+	if( libscca_filename_strings_initialize(
+	     &filename_strings,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	/* The first byte selects if the filenames are converted to UTF-8 when read
+	 */
+	filename_strings->use_utf8_cache = data[ 0 ] & 0x01;
+
+	if( libscca_filename_strings_read_data(
+	     filename_strings,
+	     &( data[ 1 ] ),
+	     size - 1,
+	     NULL ) == 1 )
+	{
+		/* Look up an offset that is derived from the input to reach the lookup of the filenames
+		 */
+		libscca_filename_strings_get_index_by_offset(
+		 filename_strings,
+		 (uint32_t) ( data[ 0 ] >> 1 ) * 2,
+		 &filename_index,
+		 NULL );
+	}
+	libscca_filename_strings_free(
+	 &filename_strings,
+	 NULL );
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,46 @@
+/*
+ * Shared definitions of the OSS-Fuzz section targets for libscca
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OSSFUZZ_SECTION_H )
+#define _OSSFUZZ_SECTION_H
+
+#include <common.h>
+#include <types.h>
+
+/* The section functions are not exported and are only accessible
+ * when libscca is not used as a DLL
+ */
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+#define OSSFUZZ_SECTION_HAVE_INTERNALS	1
+#endif
+
+/* The number of format versions a section target selects from
+ */
+#define OSSFUZZ_SECTION_NUMBER_OF_FORMAT_VERSIONS	4
+
+/* The format versions, where the first byte of the input selects the format version
+ * so that a single corpus covers the section variants of all the format versions
+ */
+static const uint32_t ossfuzz_section_format_versions[ OSSFUZZ_SECTION_NUMBER_OF_FORMAT_VERSIONS ] = {
+	17, 23, 26, 30 };
+
+#endif /* !defined( _OSSFUZZ_SECTION_H ) */
+
@@ -0,0 +1,96 @@
+/*
+ * OSS-Fuzz target for libscca volumes information section
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libscca.h"
+#include "ossfuzz_section.h"
+
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+
+#include "../libscca/libscca_io_handle.h"
+#include "../libscca/libscca_libcdata.h"
+#include "../libscca/libscca_volume_information.h"
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+#if defined( OSSFUZZ_SECTION_HAVE_INTERNALS )
+	libcdata_array_t *volumes_array = NULL;
+	libscca_io_handle_t *io_handle  = NULL;
+	uint32_t number_of_volumes      = 0;
+
+	if( size < 2 )
+	{
+		return( 0 );
+	}
+	if( libscca_io_handle_initialize(
+	     &io_handle,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	io_handle->format_version = ossfuzz_section_format_versions[ data[ 0 ] % OSSFUZZ_SECTION_NUMBER_OF_FORMAT_VERSIONS ];
+
+	/* The second byte contains the number of volumes
+	 */
+	number_of_volumes = (uint32_t) ( data[ 1 ] & 0x0f ) + 1;
+
+	if( libcdata_array_initialize(
+	     &volumes_array,
+	     0,
+	     NULL ) != 1 )
+	{
+		goto on_error_io_handle;
+	}
+	libscca_io_handle_read_volumes_information_data(
+	 io_handle,
+	 &( data[ 2 ] ),
+	 size - 2,
+	 number_of_volumes,
+	 volumes_array,
+	 NULL );
+
+	libcdata_array_free(
+	 &volumes_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libscca_internal_volume_information_free,
+	 NULL );
+
+on_error_io_handle:
+	libscca_io_handle_free(
+	 &io_handle,
+	 NULL );
+
+#endif /* defined( OSSFUZZ_SECTION_HAVE_INTERNALS ) */
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
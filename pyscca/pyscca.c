@@ -28,16 +28,21 @@
 #endif
 
 #include "pyscca.h"
+#include "pyscca_async.h"
+#include "pyscca_batch.h"
 #include "pyscca_error.h"
 #include "pyscca_file.h"
 #include "pyscca_file_metrics.h"
 #include "pyscca_file_metrics_entries.h"
 #include "pyscca_file_object_io_handle.h"
 #include "pyscca_filenames.h"
+#include "pyscca_iterator.h"
 #include "pyscca_libbfio.h"
 #include "pyscca_libcerror.h"
 #include "pyscca_libscca.h"
+#include "pyscca_parse_cache.h"
 #include "pyscca_python.h"
+#include "pyscca_records.h"
 #include "pyscca_unused.h"
 #include "pyscca_volume_information.h"
 #include "pyscca_volumes.h"
@@ -78,21 +83,117 @@ PyMethodDef pyscca_module_methods[] = {
 	{ "open",
 	  (PyCFunction) pyscca_open_new_file,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open(filename, mode='r') -> Object\n"
+	  "open(filename, mode='r', flags=OPEN_READ, sections=None) -> Object\n"
 	  "\n"
-	  "Opens a file." },
+	  "Opens a file.\n"
+	  "The flags, such as OPEN_HEADER_ONLY, or sections, a sequence of \"header\", \"file_information\",\n"
+	  "\"file_metrics\", \"filenames\" and \"volumes\", select the sections read on open,\n"
+	  "the skipped sections are read on first access." },
 
 	{ "open_file_object",
 	  (PyCFunction) pyscca_open_new_file_with_file_object,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open_file_object(file_object, mode='r') -> Object\n"
+	  "open_file_object(file_object, mode='r', read_ahead_size=16777216, flags=OPEN_READ, sections=None) -> Object\n"
 	  "\n"
-	  "Opens a file using a file-like object." },
+	  "Opens a file using a file-like object.\n"
+	  "The file-like object is read into memory with a single read if its size does not exceed read_ahead_size, 0 disables this.\n"
+	  "The flags, such as OPEN_HEADER_ONLY, or sections, a sequence of \"header\", \"file_information\",\n"
+	  "\"file_metrics\", \"filenames\" and \"volumes\", select the sections read on open,\n"
+	  "the skipped sections are read on first access." },
+
+	{ "open_bytes",
+	  (PyCFunction) pyscca_open_new_file_with_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(buffer, mode='r', flags=OPEN_READ, sections=None) -> Object\n"
+	  "\n"
+	  "Opens a file from an object that supports the buffer protocol, such as bytes, memoryview or mmap." },
+
+	{ "open_snapshot",
+	  (PyCFunction) pyscca_open_new_file_with_snapshot,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_snapshot(buffer, flags=OPEN_READ, sections=None) -> Object\n"
+	  "\n"
+	  "Opens a file from snapshot data, as created by file.get_snapshot, which is parsed in place.\n"
+	  "The buffer can be bytes or the buf of a multiprocessing.shared_memory.SharedMemory.\n"
+	  "Files are pickled as their snapshot data and unpickled using this function." },
+
+	{ "open_async",
+	  (PyCFunction) pyscca_open_async,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_async(source, flags=OPEN_READ, sections=None) -> Future\n"
+	  "\n"
+	  "Opens a file from a path or an object that supports the buffer protocol, such as bytes.\n"
+	  "The file is opened by a pool of native worker threads without holding the GIL and the\n"
+	  "returned future of the running event loop is completed with the file object." },
+
+	{ "parse_many",
+	  (PyCFunction) pyscca_parse_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "parse_many(paths, workers=4) -> List of dictionaries\n"
+	  "\n"
+	  "Parses multiple files using worker threads without holding the GIL.\n"
+	  "A dictionary with path, executable_filename, prefetch_hash, run_count, last_run_times, filenames and error is returned per path in the order of paths." },
+
+	{ "parse_directory",
+	  (PyCFunction) pyscca_parse_directory,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "parse_directory(path, workers=4) -> List of dictionaries\n"
+	  "\n"
+	  "Parses the prefetch (.pf) files in a directory, sorted by name, using worker threads." },
+
+#if defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS )
+	{ "__getattr__",
+	  (PyCFunction) pyscca_module_getattr,
+	  METH_O,
+	  "__getattr__(name) -> Object\n"
+	  "\n"
+	  "Retrieves a type object of the module, the type objects are added on first use." },
+
+	{ "__dir__",
+	  (PyCFunction) pyscca_module_dir,
+	  METH_NOARGS,
+	  "__dir__() -> List of strings\n"
+	  "\n"
+	  "Retrieves the names of the attributes of the module including the type objects." },
+
+#endif /* defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS ) */
 
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
 
+/* The type objects of the module
+ */
+PyTypeObject *pyscca_type_objects[ PYSCCA_NUMBER_OF_TYPE_OBJECTS ] = {
+	&pyscca_file_type_object,
+	&pyscca_file_metrics_type_object,
+	&pyscca_file_metrics_entries_type_object,
+	&pyscca_file_metrics_record_type_object,
+	&pyscca_filenames_type_object,
+	&pyscca_iterator_type_object,
+	&pyscca_parse_cache_type_object,
+	&pyscca_volume_information_type_object,
+	&pyscca_volume_record_type_object,
+	&pyscca_volumes_type_object };
+
+/* The names of the type objects of the module
+ */
+const char *pyscca_type_object_names[ PYSCCA_NUMBER_OF_TYPE_OBJECTS ] = {
+	"file",
+	"file_metrics",
+	"file_metrics_entries",
+	"file_metrics_record",
+	"filenames",
+	"iterator",
+	"parse_cache",
+	"volume_information",
+	"volume_record",
+	"volumes" };
+
+/* Value to indicate the type objects have been readied
+ */
+int pyscca_type_objects_are_ready = 0;
+
 /* Retrieves the pyscca/libscca version
  * Returns a Python object if successful or NULL on error
  */
@@ -351,6 +452,7 @@ PyObject *pyscca_check_file_signature_file_object(
 	if( pyscca_file_object_initialize(
 	     &file_io_handle,
 	     file_object,
+	     0,
 	     &error ) != 1 )
 	{
 		pyscca_error_raise(
@@ -435,6 +537,10 @@ PyObject *pyscca_open_new_file(
 
 	PYSCCA_UNREFERENCED_PARAMETER( self )
 
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		return( NULL );
+	}
 	/* PyObject_New does not invoke tp_init
 	 */
 	pyscca_file = PyObject_New(
@@ -486,6 +592,10 @@ PyObject *pyscca_open_new_file_with_file_object(
 
 	PYSCCA_UNREFERENCED_PARAMETER( self )
 
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		return( NULL );
+	}
 	/* PyObject_New does not invoke tp_init
 	 */
 	pyscca_file = PyObject_New(
@@ -524,6 +634,288 @@ on_error:
 	return( NULL );
 }
 
+/* Creates a new file object and opens it from an object that supports the buffer protocol
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_open_new_file_with_bytes(
+           PyObject *self PYSCCA_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyscca_file_t *pyscca_file = NULL;
+	static char *function      = "pyscca_open_new_file_with_bytes";
+
+	PYSCCA_UNREFERENCED_PARAMETER( self )
+
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyscca_file = PyObject_New(
+	               struct pyscca_file,
+	               &pyscca_file_type_object );
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyscca_file_init(
+	     pyscca_file ) != 0 )
+	{
+		goto on_error;
+	}
+	if( pyscca_file_open_bytes(
+	     pyscca_file,
+	     arguments,
+	     keywords ) == NULL )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pyscca_file );
+
+on_error:
+	if( pyscca_file != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyscca_file );
+	}
+	return( NULL );
+}
+
+/* Creates a new file object and opens it from snapshot data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_open_new_file_with_snapshot(
+           PyObject *self PYSCCA_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pyscca_file_t *pyscca_file = NULL;
+	static char *function      = "pyscca_open_new_file_with_snapshot";
+
+	PYSCCA_UNREFERENCED_PARAMETER( self )
+
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyscca_file = PyObject_New(
+	               struct pyscca_file,
+	               &pyscca_file_type_object );
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyscca_file_init(
+	     pyscca_file ) != 0 )
+	{
+		goto on_error;
+	}
+	if( pyscca_file_open_snapshot(
+	     pyscca_file,
+	     arguments,
+	     keywords ) == NULL )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pyscca_file );
+
+on_error:
+	if( pyscca_file != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyscca_file );
+	}
+	return( NULL );
+}
+
+/* Readies the type objects
+ * The type objects are readied on first use, such as opening a file,
+ * instead of on import to reduce the time needed to import the module
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_type_objects_ready(
+     void )
+{
+	int type_object_index = 0;
+
+	if( pyscca_type_objects_are_ready != 0 )
+	{
+		return( 1 );
+	}
+	/* The record type objects are readied as struct sequences
+	 */
+	if( pyscca_records_ready() != 1 )
+	{
+		return( -1 );
+	}
+	for( type_object_index = 0;
+	     type_object_index < PYSCCA_NUMBER_OF_TYPE_OBJECTS;
+	     type_object_index++ )
+	{
+		if( ( pyscca_type_objects[ type_object_index ]->tp_flags & Py_TPFLAGS_READY ) != 0 )
+		{
+			continue;
+		}
+		pyscca_type_objects[ type_object_index ]->tp_new = PyType_GenericNew;
+
+		if( PyType_Ready(
+		     pyscca_type_objects[ type_object_index ] ) < 0 )
+		{
+			return( -1 );
+		}
+	}
+	pyscca_type_objects_are_ready = 1;
+
+	return( 1 );
+}
+
+/* Readies the type objects and adds them to the module
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_module_add_type_objects(
+     PyObject *module )
+{
+	static char *function = "pyscca_module_add_type_objects";
+	int type_object_index = 0;
+
+	if( module == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		return( -1 );
+	}
+	for( type_object_index = 0;
+	     type_object_index < PYSCCA_NUMBER_OF_TYPE_OBJECTS;
+	     type_object_index++ )
+	{
+		Py_IncRef(
+		 (PyObject *) pyscca_type_objects[ type_object_index ] );
+
+		/* PyModule_AddObject only steals the reference on success
+		 */
+		if( PyModule_AddObject(
+		     module,
+		     pyscca_type_object_names[ type_object_index ],
+		     (PyObject *) pyscca_type_objects[ type_object_index ] ) != 0 )
+		{
+			Py_DecRef(
+			 (PyObject *) pyscca_type_objects[ type_object_index ] );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS )
+
+/* Retrieves a type object of the module
+ * The module __getattr__ is only called for attributes that are not set,
+ * after the type objects were added to the module it is no longer called for them
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_module_getattr(
+           PyObject *self,
+           PyObject *name_object )
+{
+	const char *name      = NULL;
+	size_t name_length    = 0;
+	int type_object_index = 0;
+
+	name = PyUnicode_AsUTF8(
+	        name_object );
+
+	if( name == NULL )
+	{
+		return( NULL );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	for( type_object_index = 0;
+	     type_object_index < PYSCCA_NUMBER_OF_TYPE_OBJECTS;
+	     type_object_index++ )
+	{
+		if( name_length != narrow_string_length( pyscca_type_object_names[ type_object_index ] ) )
+		{
+			continue;
+		}
+		if( narrow_string_compare(
+		     name,
+		     pyscca_type_object_names[ type_object_index ],
+		     name_length ) == 0 )
+		{
+			if( pyscca_module_add_type_objects(
+			     self ) != 1 )
+			{
+				return( NULL );
+			}
+			Py_IncRef(
+			 (PyObject *) pyscca_type_objects[ type_object_index ] );
+
+			return( (PyObject *) pyscca_type_objects[ type_object_index ] );
+		}
+	}
+	PyErr_Format(
+	 PyExc_AttributeError,
+	 "module 'pyscca' has no attribute '%s'",
+	 name );
+
+	return( NULL );
+}
+
+/* Retrieves the names of the attributes of the module
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_module_dir(
+           PyObject *self,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *dictionary_object = NULL;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_module_add_type_objects(
+	     self ) != 1 )
+	{
+		return( NULL );
+	}
+	dictionary_object = PyModule_GetDict(
+	                     self );
+
+	if( dictionary_object == NULL )
+	{
+		return( NULL );
+	}
+	return( PyDict_Keys(
+	         dictionary_object ) );
+}
+
+#endif /* defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS ) */
+
 #if PY_MAJOR_VERSION >= 3
 
 /* The pyscca module definition
@@ -593,112 +985,74 @@ PyMODINIT_FUNC initpyscca(
 		return;
 #endif
 	}
+#if defined( Py_GIL_DISABLED )
+	/* The module does not rely on the GIL, the state of a file object
+	 * is protected by its mutex and libscca uses its own locks
+	 */
+	PyUnstable_Module_SetGIL(
+	 module,
+	 Py_MOD_GIL_NOT_USED );
+#endif
 	PyEval_InitThreads();
 
 	gil_state = PyGILState_Ensure();
 
-	/* Setup the file type object
+	/* Setup the open flags
 	 */
-	pyscca_file_type_object.tp_new = PyType_GenericNew;
-
-	if( PyType_Ready(
-	     &pyscca_file_type_object ) < 0 )
-	{
-		goto on_error;
-	}
-	Py_IncRef(
-	 (PyObject *) &pyscca_file_type_object );
-
-	PyModule_AddObject(
+	PyModule_AddIntConstant(
 	 module,
-	 "file",
-	 (PyObject *) &pyscca_file_type_object );
-
-	/* Setup the file_metrics type object
-	 */
-	pyscca_file_metrics_type_object.tp_new = PyType_GenericNew;
+	 "OPEN_READ",
+	 LIBSCCA_OPEN_READ );
 
-	if( PyType_Ready(
-	     &pyscca_file_metrics_type_object ) < 0 )
-	{
-		goto on_error;
-	}
-	Py_IncRef(
-	 (PyObject *) &pyscca_file_metrics_type_object );
-
-	PyModule_AddObject(
+	PyModule_AddIntConstant(
 	 module,
-	 "file_metrics",
-	 (PyObject *) &pyscca_file_metrics_type_object );
-
-	/* Setup the file_metrics_entries type object
-	 */
-	pyscca_file_metrics_entries_type_object.tp_new = PyType_GenericNew;
+	 "OPEN_HEADER_ONLY",
+	 LIBSCCA_OPEN_READ_HEADER_ONLY );
 
-	if( PyType_Ready(
-	     &pyscca_file_metrics_entries_type_object ) < 0 )
-	{
-		goto on_error;
-	}
-	Py_IncRef(
-	 (PyObject *) &pyscca_file_metrics_entries_type_object );
+	PyModule_AddIntConstant(
+	 module,
+	 "ACCESS_FLAG_SKIP_FILE_METRICS",
+	 LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS );
 
-	PyModule_AddObject(
+	PyModule_AddIntConstant(
 	 module,
-	 "file_metrics_entries",
-	 (PyObject *) &pyscca_file_metrics_entries_type_object );
+	 "ACCESS_FLAG_SKIP_FILENAMES",
+	 LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES );
 
-	/* Setup the filenames type object
-	 */
-	pyscca_filenames_type_object.tp_new = PyType_GenericNew;
+	PyModule_AddIntConstant(
+	 module,
+	 "ACCESS_FLAG_SKIP_VOLUMES",
+	 LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES );
 
-	if( PyType_Ready(
-	     &pyscca_filenames_type_object ) < 0 )
-	{
-		goto on_error;
-	}
-	Py_IncRef(
-	 (PyObject *) &pyscca_filenames_type_object );
+	PyModule_AddIntConstant(
+	 module,
+	 "ACCESS_FLAG_MEASURE_READ_TIMES",
+	 LIBSCCA_ACCESS_FLAG_MEASURE_READ_TIMES );
 
-	PyModule_AddObject(
+	PyModule_AddIntConstant(
 	 module,
-	 "filenames",
-	 (PyObject *) &pyscca_filenames_type_object );
+	 "ACCESS_FLAG_PARALLEL_DECOMPRESSION",
+	 LIBSCCA_ACCESS_FLAG_PARALLEL_DECOMPRESSION );
 
-	/* Setup the volume_information type object
+#if !defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS )
+	/* Setup the type objects
+	 * Without module __getattr__ support the type objects are added on import
 	 */
-	pyscca_volume_information_type_object.tp_new = PyType_GenericNew;
-
-	if( PyType_Ready(
-	     &pyscca_volume_information_type_object ) < 0 )
+	if( pyscca_module_add_type_objects(
+	     module ) != 1 )
 	{
 		goto on_error;
 	}
-	Py_IncRef(
-	 (PyObject *) &pyscca_volume_information_type_object );
-
-	PyModule_AddObject(
-	 module,
-	 "volume_information",
-	 (PyObject *) &pyscca_volume_information_type_object );
-
-	/* Setup the volumes type object
+#endif
+#if defined( Py_GIL_DISABLED )
+	/* Setup the asynchronous open thread pool
+	 * Without the GIL the thread pool cannot be created safely on first use
 	 */
-	pyscca_volumes_type_object.tp_new = PyType_GenericNew;
-
-	if( PyType_Ready(
-	     &pyscca_volumes_type_object ) < 0 )
+	if( pyscca_async_initialize() != 1 )
 	{
 		goto on_error;
 	}
-	Py_IncRef(
-	 (PyObject *) &pyscca_volumes_type_object );
-
-	PyModule_AddObject(
-	 module,
-	 "volumes",
-	 (PyObject *) &pyscca_volumes_type_object );
-
+#endif
 	PyGILState_Release(
 	 gil_state );
 
@@ -708,6 +1062,7 @@ PyMODINIT_FUNC initpyscca(
 	return;
 #endif
 
+#if !defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS )
 on_error:
 	PyGILState_Release(
 	 gil_state );
@@ -717,5 +1072,6 @@ on_error:
 #else
 	return;
 #endif
+#endif /* !defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS ) */
 }
 
@@ -31,6 +31,15 @@
 extern "C" {
 #endif
 
+/* The type objects are added to the module on first use when
+ * module __getattr__ (PEP 562) is supported and the GIL is enabled
+ */
+#if ( PY_VERSION_HEX >= 0x03070000 ) && !defined( Py_GIL_DISABLED )
+#define PYSCCA_HAVE_LAZY_TYPE_OBJECTS
+#endif
+
+#define PYSCCA_NUMBER_OF_TYPE_OBJECTS	10
+
 PyObject *pyscca_get_version(
            PyObject *self,
            PyObject *arguments );
@@ -55,6 +64,34 @@ PyObject *pyscca_open_new_file_with_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyscca_open_new_file_with_bytes(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_open_new_file_with_snapshot(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyscca_type_objects_ready(
+     void );
+
+int pyscca_module_add_type_objects(
+     PyObject *module );
+
+#if defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS )
+
+PyObject *pyscca_module_getattr(
+           PyObject *self,
+           PyObject *name_object );
+
+PyObject *pyscca_module_dir(
+           PyObject *self,
+           PyObject *arguments );
+
+#endif /* defined( PYSCCA_HAVE_LAZY_TYPE_OBJECTS ) */
+
 #if PY_MAJOR_VERSION >= 3
 PyMODINIT_FUNC PyInit_pyscca(
                 void );
@@ -0,0 +1,201 @@
+/*
+ * Array functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_array.h"
+#include "pyscca_python.h"
+
+/* The NumPy data types and buffer protocol formats indexed by value type
+ */
+static const char *pyscca_array_numpy_types[ 4 ] = {
+	NULL, "intc", "uint32", "uint64" };
+
+static const char *pyscca_array_value_formats[ 4 ] = {
+	NULL, "i", "I", "Q" };
+
+/* Creates a new buffer object to store the values of an array
+ * The values data is set to the writable storage of the buffer object
+ * which remains valid as long as the buffer object is not resized
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_array_buffer_new(
+           int value_type,
+           Py_ssize_t number_of_values,
+           uint8_t **values_data )
+{
+	PyObject *buffer_object = NULL;
+	static char *function   = "pyscca_array_buffer_new";
+	size_t value_size       = 0;
+
+	switch( value_type )
+	{
+		case PYSCCA_ARRAY_VALUE_TYPE_INT:
+			value_size = sizeof( int );
+			break;
+
+		case PYSCCA_ARRAY_VALUE_TYPE_UINT32:
+			value_size = sizeof( uint32_t );
+			break;
+
+		case PYSCCA_ARRAY_VALUE_TYPE_UINT64:
+			value_size = sizeof( uint64_t );
+			break;
+
+		default:
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: unsupported value type.",
+			 function );
+
+			return( NULL );
+	}
+	if( ( number_of_values < 0 )
+	 || ( (size_t) number_of_values > ( (size_t) PY_SSIZE_T_MAX / value_size ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( values_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid values data.",
+		 function );
+
+		return( NULL );
+	}
+	/* A bytearray is used so that the NumPy array that references it is writable
+	 */
+	buffer_object = PyByteArray_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) ( number_of_values * value_size ) );
+
+	if( buffer_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create buffer object.",
+		 function );
+
+		return( NULL );
+	}
+	*values_data = (uint8_t *) PyByteArray_AsString(
+	                            buffer_object );
+
+	return( buffer_object );
+}
+
+/* Creates a new array object that references the values in a buffer object
+ * The array object is a NumPy array if the numpy module is available,
+ * otherwise a memoryview of the values
+ * No Python object is created per value, the values are shared with the buffer object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_array_new_from_buffer(
+           PyObject *buffer_object,
+           int value_type )
+{
+	PyObject *array_object      = NULL;
+	PyObject *numpy_module      = NULL;
+	static char *function       = "pyscca_array_new_from_buffer";
+
+#if PY_MAJOR_VERSION >= 3
+	PyObject *memoryview_object = NULL;
+#endif
+
+	if( buffer_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid buffer object.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( value_type < PYSCCA_ARRAY_VALUE_TYPE_INT )
+	 || ( value_type > PYSCCA_ARRAY_VALUE_TYPE_UINT64 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( NULL );
+	}
+	numpy_module = PyImport_ImportModule(
+	                "numpy" );
+
+	if( numpy_module != NULL )
+	{
+		array_object = PyObject_CallMethod(
+		                numpy_module,
+		                "frombuffer",
+		                "Os",
+		                buffer_object,
+		                pyscca_array_numpy_types[ value_type ] );
+
+		Py_DecRef(
+		 numpy_module );
+
+		return( array_object );
+	}
+	/* NumPy is optional, fall back to the buffer protocol if it is not installed
+	 */
+	if( PyErr_ExceptionMatches(
+	     PyExc_ImportError ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+#if PY_MAJOR_VERSION >= 3
+	memoryview_object = PyMemoryView_FromObject(
+	                     buffer_object );
+
+	if( memoryview_object == NULL )
+	{
+		return( NULL );
+	}
+	array_object = PyObject_CallMethod(
+	                memoryview_object,
+	                "cast",
+	                "s",
+	                pyscca_array_value_formats[ value_type ] );
+
+	Py_DecRef(
+	 memoryview_object );
+#else
+	/* Python 2 memoryview objects cannot be cast, return the buffer object instead
+	 */
+	Py_IncRef(
+	 buffer_object );
+
+	array_object = buffer_object;
+#endif
+	return( array_object );
+}
+
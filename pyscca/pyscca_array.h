@@ -0,0 +1,55 @@
+/*
+ * Array functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_ARRAY_H )
+#define _PYSCCA_ARRAY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum PYSCCA_ARRAY_VALUE_TYPES
+{
+	PYSCCA_ARRAY_VALUE_TYPE_INT		= 1,
+	PYSCCA_ARRAY_VALUE_TYPE_UINT32		= 2,
+	PYSCCA_ARRAY_VALUE_TYPE_UINT64		= 3
+};
+
+PyObject *pyscca_array_buffer_new(
+           int value_type,
+           Py_ssize_t number_of_values,
+           uint8_t **values_data );
+
+PyObject *pyscca_array_new_from_buffer(
+           PyObject *buffer_object,
+           int value_type );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_ARRAY_H ) */
+
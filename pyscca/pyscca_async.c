@@ -0,0 +1,857 @@
+/*
+ * Asynchronous open functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyscca.h"
+#include "pyscca_async.h"
+#include "pyscca_error.h"
+#include "pyscca_file.h"
+#include "pyscca_libcerror.h"
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+#include "pyscca_unused.h"
+
+/* The asynchronous open thread pool
+ * Contains NULL if the pool has not been initialized
+ */
+pyscca_async_pool_t *pyscca_async_pool = NULL;
+
+/* The definition of the function that completes a future on the event loop
+ */
+PyMethodDef pyscca_async_complete_future_method_definition = {
+	"_complete_future",
+	(PyCFunction) pyscca_async_complete_future,
+	METH_VARARGS,
+	"_complete_future(future, value, is_exception) -> None\n"
+	"\n"
+	"Sets the result or exception of the future if it is not done." };
+
+/* Opens a file asynchronously
+ * The file is opened by the asynchronous open thread pool without holding the GIL
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_open_async(
+           PyObject *self PYSCCA_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *asyncio_module    = NULL;
+	PyObject *future_object     = NULL;
+	PyObject *loop_object       = NULL;
+	PyObject *sections_object   = NULL;
+	PyObject *source_object     = NULL;
+	pyscca_async_job_t *job     = NULL;
+	static char *keyword_list[] = { "source", "flags", "sections", NULL };
+	int access_flags            = 0;
+	int flags                   = LIBSCCA_OPEN_READ;
+
+	PYSCCA_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|iO",
+	     keyword_list,
+	     &source_object,
+	     &flags,
+	     &sections_object ) == 0 )
+	{
+		return( NULL );
+	}
+	/* The thread pool is created on first use to reduce the time needed to import the module
+	 */
+	if( pyscca_async_initialize() != 1 )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_get_access_flags(
+	     flags,
+	     sections_object,
+	     &access_flags ) != 1 )
+	{
+		return( NULL );
+	}
+	asyncio_module = PyImport_ImportModule(
+	                  "asyncio" );
+
+	if( asyncio_module == NULL )
+	{
+		goto on_error;
+	}
+	/* get_running_loop raises RuntimeError if there is no running event loop
+	 */
+	if( PyObject_HasAttrString(
+	     asyncio_module,
+	     "get_running_loop" ) != 0 )
+	{
+		loop_object = PyObject_CallMethod(
+		               asyncio_module,
+		               "get_running_loop",
+		               NULL );
+	}
+	else
+	{
+		loop_object = PyObject_CallMethod(
+		               asyncio_module,
+		               "get_event_loop",
+		               NULL );
+	}
+	if( loop_object == NULL )
+	{
+		goto on_error;
+	}
+	future_object = PyObject_CallMethod(
+	                 loop_object,
+	                 "create_future",
+	                 NULL );
+
+	if( future_object == NULL )
+	{
+		goto on_error;
+	}
+	job = pyscca_async_job_new(
+	       source_object,
+	       access_flags );
+
+	if( job == NULL )
+	{
+		goto on_error;
+	}
+	job->loop_object = loop_object;
+	loop_object      = NULL;
+
+	Py_IncRef(
+	 future_object );
+
+	job->future_object = future_object;
+
+	if( pyscca_async_push_job(
+	     job ) != 1 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 asyncio_module );
+
+	return( future_object );
+
+on_error:
+	if( job != NULL )
+	{
+		pyscca_async_job_free(
+		 job );
+	}
+	if( future_object != NULL )
+	{
+		Py_DecRef(
+		 future_object );
+	}
+	if( loop_object != NULL )
+	{
+		Py_DecRef(
+		 loop_object );
+	}
+	if( asyncio_module != NULL )
+	{
+		Py_DecRef(
+		 asyncio_module );
+	}
+	return( NULL );
+}
+
+/* Initializes the asynchronous open thread pool
+ * No worker threads are started until the first job is pushed
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_async_initialize(
+     void )
+{
+	pyscca_async_pool_t *pool = NULL;
+	static char *function     = "pyscca_async_initialize";
+
+	if( pyscca_async_pool != NULL )
+	{
+		return( 1 );
+	}
+	pool = (pyscca_async_pool_t *) PyMem_Malloc(
+	                                sizeof( pyscca_async_pool_t ) );
+
+	if( pool == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create asynchronous open thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 pool,
+	 0,
+	 sizeof( pyscca_async_pool_t ) );
+
+	pool->queue_lock = PyThread_allocate_lock();
+
+	if( pool->queue_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create queue lock.",
+		 function );
+
+		goto on_error;
+	}
+	pool->jobs_available_lock = PyThread_allocate_lock();
+
+	if( pool->jobs_available_lock == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create jobs available lock.",
+		 function );
+
+		goto on_error;
+	}
+	/* The queue is empty hence the jobs available lock is held
+	 */
+	PyThread_acquire_lock(
+	 pool->jobs_available_lock,
+	 WAIT_LOCK );
+
+	pool->complete_function = PyCFunction_New(
+	                           &pyscca_async_complete_future_method_definition,
+	                           NULL );
+
+	if( pool->complete_function == NULL )
+	{
+		goto on_error;
+	}
+	pyscca_async_pool = pool;
+
+	return( 1 );
+
+on_error:
+	if( pool != NULL )
+	{
+		if( pool->jobs_available_lock != NULL )
+		{
+			PyThread_free_lock(
+			 pool->jobs_available_lock );
+		}
+		if( pool->queue_lock != NULL )
+		{
+			PyThread_free_lock(
+			 pool->queue_lock );
+		}
+		PyMem_Free(
+		 pool );
+	}
+	return( -1 );
+}
+
+/* Creates a new job that opens a file
+ * The source is a path or an object that supports the buffer protocol
+ * Returns a job if successful or NULL on error
+ */
+pyscca_async_job_t *pyscca_async_job_new(
+                     PyObject *source_object,
+                     int access_flags )
+{
+	PyObject *path_object      = NULL;
+	pyscca_async_job_t *job    = NULL;
+	pyscca_file_t *pyscca_file = NULL;
+	static char *function      = "pyscca_async_job_new";
+
+	/* The job is used by a worker thread without holding the GIL,
+	 * hence it is allocated using memory_allocate
+	 */
+	job = (pyscca_async_job_t *) memory_allocate(
+	                              sizeof( pyscca_async_job_t ) );
+
+	if( job == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create job.",
+		 function );
+
+		return( NULL );
+	}
+	memory_set(
+	 job,
+	 0,
+	 sizeof( pyscca_async_job_t ) );
+
+	job->access_flags = access_flags;
+
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		goto on_error;
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyscca_file = PyObject_New(
+	               struct pyscca_file,
+	               &pyscca_file_type_object );
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	job->file_object = (PyObject *) pyscca_file;
+
+	if( pyscca_file_init(
+	     pyscca_file ) != 0 )
+	{
+		goto on_error;
+	}
+	/* The file is opened by a worker thread hence the libscca file is created here
+	 */
+	if( pyscca_file_initialize_file(
+	     pyscca_file ) != 1 )
+	{
+		goto on_error;
+	}
+#if PY_VERSION_HEX >= 0x03060000
+	/* Support path-like objects such as pathlib.Path, which can be a narrow path
+	 */
+	if( ( PyUnicode_Check(
+	       source_object ) == 0 )
+	 && ( PyObject_CheckBuffer(
+	       source_object ) == 0 )
+	 && ( PyObject_HasAttrString(
+	       source_object,
+	       "__fspath__" ) != 0 ) )
+	{
+		path_object = PyOS_FSPath(
+		               source_object );
+
+		if( path_object == NULL )
+		{
+			goto on_error;
+		}
+		source_object = path_object;
+	}
+#endif
+	if( PyUnicode_Check(
+	     source_object ) )
+	{
+		/* The filename object is kept by the file so it can be reopened to read skipped sections
+		 */
+		Py_IncRef(
+		 source_object );
+
+		pyscca_file->filename_object = source_object;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		job->path_wide = (wchar_t *) PyUnicode_AsUnicode(
+		                              source_object );
+
+		if( job->path_wide == NULL )
+		{
+			goto on_error;
+		}
+#else
+		job->path_object = PyUnicode_AsUTF8String(
+		                    source_object );
+
+		if( job->path_object == NULL )
+		{
+			pyscca_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to convert Unicode string to UTF-8.",
+			 function );
+
+			goto on_error;
+		}
+		job->path = PyBytes_AsString(
+		             job->path_object );
+#endif
+	}
+	else if( ( path_object != NULL )
+	      && ( PyBytes_Check(
+	            path_object ) ) )
+	{
+		Py_IncRef(
+		 path_object );
+
+		pyscca_file->filename_object = path_object;
+
+		Py_IncRef(
+		 path_object );
+
+		job->path_object = path_object;
+
+		job->path = PyBytes_AsString(
+		             job->path_object );
+	}
+	else if( PyObject_CheckBuffer(
+	          source_object ) )
+	{
+		/* The buffer is kept until the file is closed since libscca references its data
+		 */
+		if( PyObject_GetBuffer(
+		     source_object,
+		     &( pyscca_file->buffer ),
+		     PyBUF_SIMPLE ) != 0 )
+		{
+			goto on_error;
+		}
+		pyscca_file->buffer_is_set = 1;
+	}
+	else
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported source object type.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_object != NULL )
+	{
+		Py_DecRef(
+		 path_object );
+	}
+	return( job );
+
+on_error:
+	if( path_object != NULL )
+	{
+		Py_DecRef(
+		 path_object );
+	}
+	pyscca_async_job_free(
+	 job );
+
+	return( NULL );
+}
+
+/* Frees a job
+ * The GIL must be held
+ */
+void pyscca_async_job_free(
+      pyscca_async_job_t *job )
+{
+	if( job == NULL )
+	{
+		return;
+	}
+	if( job->error != NULL )
+	{
+		libcerror_error_free(
+		 &( job->error ) );
+	}
+	if( job->path_object != NULL )
+	{
+		Py_DecRef(
+		 job->path_object );
+	}
+	if( job->future_object != NULL )
+	{
+		Py_DecRef(
+		 job->future_object );
+	}
+	if( job->loop_object != NULL )
+	{
+		Py_DecRef(
+		 job->loop_object );
+	}
+	if( job->file_object != NULL )
+	{
+		Py_DecRef(
+		 job->file_object );
+	}
+	memory_free(
+	 job );
+}
+
+/* Pushes a job onto the queue of the asynchronous open thread pool
+ * A worker thread is started if the maximum number of workers has not been reached
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_async_push_job(
+     pyscca_async_job_t *job )
+{
+	static char *function = "pyscca_async_push_job";
+	int result            = 1;
+
+	if( pyscca_async_pool == NULL )
+	{
+		PyErr_Format(
+		 PyExc_RuntimeError,
+		 "%s: missing asynchronous open thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	PyThread_acquire_lock(
+	 pyscca_async_pool->queue_lock,
+	 WAIT_LOCK );
+
+	Py_END_ALLOW_THREADS
+
+	if( pyscca_async_pool->number_of_workers < PYSCCA_ASYNC_MAXIMUM_NUMBER_OF_WORKERS )
+	{
+#if defined( PYTHREAD_INVALID_THREAD_ID )
+		if( PyThread_start_new_thread(
+		     pyscca_async_worker,
+		     NULL ) == PYTHREAD_INVALID_THREAD_ID )
+#else
+		if( PyThread_start_new_thread(
+		     pyscca_async_worker,
+		     NULL ) == -1 )
+#endif
+		{
+			/* The job can still be opened by the existing workers
+			 */
+			if( pyscca_async_pool->number_of_workers == 0 )
+			{
+				PyErr_Format(
+				 PyExc_RuntimeError,
+				 "%s: unable to start worker thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else
+		{
+			pyscca_async_pool->number_of_workers += 1;
+		}
+	}
+	if( result == 1 )
+	{
+		job->next_job = NULL;
+
+		if( pyscca_async_pool->last_job == NULL )
+		{
+			pyscca_async_pool->first_job = job;
+		}
+		else
+		{
+			pyscca_async_pool->last_job->next_job = job;
+		}
+		pyscca_async_pool->last_job = job;
+
+		/* The queue was empty, hence signal that a job is available
+		 */
+		if( pyscca_async_pool->first_job == job )
+		{
+			PyThread_release_lock(
+			 pyscca_async_pool->jobs_available_lock );
+		}
+	}
+	PyThread_release_lock(
+	 pyscca_async_pool->queue_lock );
+
+	return( result );
+}
+
+/* Pops a job from the queue of the asynchronous open thread pool
+ * This function blocks until a job is available and is called without holding the GIL
+ * Returns a job
+ */
+pyscca_async_job_t *pyscca_async_pop_job(
+                     void )
+{
+	pyscca_async_job_t *job = NULL;
+
+	PyThread_acquire_lock(
+	 pyscca_async_pool->jobs_available_lock,
+	 WAIT_LOCK );
+
+	PyThread_acquire_lock(
+	 pyscca_async_pool->queue_lock,
+	 WAIT_LOCK );
+
+	job = pyscca_async_pool->first_job;
+
+	pyscca_async_pool->first_job = job->next_job;
+
+	if( pyscca_async_pool->first_job == NULL )
+	{
+		pyscca_async_pool->last_job = NULL;
+	}
+	/* The jobs available lock is passed on to the next worker if more jobs
+	 * are queued, otherwise it stays held until the next job is pushed
+	 */
+	else
+	{
+		PyThread_release_lock(
+		 pyscca_async_pool->jobs_available_lock );
+	}
+	PyThread_release_lock(
+	 pyscca_async_pool->queue_lock );
+
+	job->next_job = NULL;
+
+	return( job );
+}
+
+/* The worker thread of the asynchronous open thread pool
+ * The worker runs until the process exits
+ */
+void pyscca_async_worker(
+      void *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	pyscca_async_job_t *job = NULL;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	for( ;; )
+	{
+		job = pyscca_async_pop_job();
+
+		pyscca_async_job_open(
+		 job );
+
+		/* The job cannot be completed after the interpreter has been finalized
+		 */
+		if( Py_IsInitialized() == 0 )
+		{
+			break;
+		}
+		pyscca_async_job_complete(
+		 job );
+	}
+}
+
+/* Opens the file of a job
+ * This function is called without holding the GIL and therefore must not call any Python function
+ */
+void pyscca_async_job_open(
+      pyscca_async_job_t *job )
+{
+	pyscca_file_t *pyscca_file = NULL;
+
+	pyscca_file = (pyscca_file_t *) job->file_object;
+
+	if( pyscca_file->buffer_is_set != 0 )
+	{
+		job->result = libscca_file_open_memory(
+		               pyscca_file->file,
+		               (const uint8_t *) pyscca_file->buffer.buf,
+		               (size_t) pyscca_file->buffer.len,
+		               job->access_flags,
+		               &( job->error ) );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	else if( job->path_wide != NULL )
+	{
+		job->result = libscca_file_open_wide(
+		               pyscca_file->file,
+		               job->path_wide,
+		               job->access_flags,
+		               &( job->error ) );
+	}
+#endif
+	else
+	{
+		job->result = libscca_file_open(
+		               pyscca_file->file,
+		               job->path,
+		               job->access_flags,
+		               &( job->error ) );
+	}
+}
+
+/* Completes the future of a job on its event loop and frees the job
+ * This function is called from a worker thread and acquires the GIL
+ */
+void pyscca_async_job_complete(
+      pyscca_async_job_t *job )
+{
+	PyObject *exception_traceback = NULL;
+	PyObject *exception_type      = NULL;
+	PyObject *exception_value     = NULL;
+	PyObject *result_object       = NULL;
+	PyObject *value_object        = NULL;
+	PyGILState_STATE gil_state    = 0;
+	static char *function         = "pyscca_async_job_complete";
+	int is_exception              = 0;
+
+	gil_state = PyGILState_Ensure();
+
+	if( job->result == 1 )
+	{
+		( (pyscca_file_t *) job->file_object )->access_flags = job->access_flags;
+
+		Py_IncRef(
+		 job->file_object );
+
+		value_object = job->file_object;
+	}
+	else
+	{
+		pyscca_error_raise(
+		 job->error,
+		 PyExc_IOError,
+		 "%s: unable to open file.",
+		 function );
+
+		PyErr_Fetch(
+		 &exception_type,
+		 &exception_value,
+		 &exception_traceback );
+
+		PyErr_NormalizeException(
+		 &exception_type,
+		 &exception_value,
+		 &exception_traceback );
+
+		value_object = exception_value;
+		is_exception = 1;
+
+		if( exception_type != NULL )
+		{
+			Py_DecRef(
+			 exception_type );
+		}
+		if( exception_traceback != NULL )
+		{
+			Py_DecRef(
+			 exception_traceback );
+		}
+	}
+	if( value_object != NULL )
+	{
+		/* The future can only be completed by the thread that runs the event loop
+		 */
+		result_object = PyObject_CallMethod(
+		                 job->loop_object,
+		                 "call_soon_threadsafe",
+		                 "OOOi",
+		                 pyscca_async_pool->complete_function,
+		                 job->future_object,
+		                 value_object,
+		                 is_exception );
+
+		Py_DecRef(
+		 value_object );
+	}
+	/* If the event loop was closed the future can no longer be completed
+	 */
+	if( result_object == NULL )
+	{
+		PyErr_Clear();
+	}
+	else
+	{
+		Py_DecRef(
+		 result_object );
+	}
+	pyscca_async_job_free(
+	 job );
+
+	PyGILState_Release(
+	 gil_state );
+}
+
+/* Sets the result or exception of a future if it is not done
+ * This function is called on the event loop, a future that was cancelled is left as-is
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_async_complete_future(
+           PyObject *self PYSCCA_ATTRIBUTE_UNUSED,
+           PyObject *arguments )
+{
+	PyObject *done_object   = NULL;
+	PyObject *future_object = NULL;
+	PyObject *result_object = NULL;
+	PyObject *value_object  = NULL;
+	int is_done             = 0;
+	int is_exception        = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTuple(
+	     arguments,
+	     "OOi",
+	     &future_object,
+	     &value_object,
+	     &is_exception ) == 0 )
+	{
+		return( NULL );
+	}
+	done_object = PyObject_CallMethod(
+	               future_object,
+	               "done",
+	               NULL );
+
+	if( done_object == NULL )
+	{
+		return( NULL );
+	}
+	is_done = PyObject_IsTrue(
+	           done_object );
+
+	Py_DecRef(
+	 done_object );
+
+	if( is_done == -1 )
+	{
+		return( NULL );
+	}
+	else if( is_done == 0 )
+	{
+		result_object = PyObject_CallMethod(
+		                 future_object,
+		                 ( is_exception != 0 ) ? "set_exception" : "set_result",
+		                 "O",
+		                 value_object );
+
+		if( result_object == NULL )
+		{
+			return( NULL );
+		}
+		Py_DecRef(
+		 result_object );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
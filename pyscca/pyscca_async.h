@@ -0,0 +1,165 @@
+/*
+ * Asynchronous open functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_ASYNC_H )
+#define _PYSCCA_ASYNC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_libcerror.h"
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of worker threads of the asynchronous open thread pool
+ */
+#define PYSCCA_ASYNC_MAXIMUM_NUMBER_OF_WORKERS	4
+
+typedef struct pyscca_async_job pyscca_async_job_t;
+
+/* An asynchronous open of a file
+ * The job is opened by a worker thread without the GIL,
+ * the Python objects are only used by the thread that holds the GIL
+ */
+struct pyscca_async_job
+{
+	/* The next job in the queue
+	 */
+	pyscca_async_job_t *next_job;
+
+	/* The file object that is opened
+	 */
+	PyObject *file_object;
+
+	/* The event loop the future belongs to
+	 */
+	PyObject *loop_object;
+
+	/* The future that is completed when the file is opened
+	 */
+	PyObject *future_object;
+
+	/* The narrow path object
+	 * Contains NULL if the file is opened from a buffer
+	 */
+	PyObject *path_object;
+
+	/* The narrow path
+	 */
+	const char *path;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The wide path
+	 * Contains NULL if the file is opened from a buffer or a narrow path
+	 */
+	const wchar_t *path_wide;
+#endif
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The result of the open
+	 */
+	int result;
+
+	/* The error of the open
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct pyscca_async_pool pyscca_async_pool_t;
+
+/* The thread pool that opens the files
+ * The worker threads are started on demand and run until the process exits
+ */
+struct pyscca_async_pool
+{
+	/* The lock that protects the queue and the number of workers
+	 */
+	PyThread_type_lock queue_lock;
+
+	/* The lock that is held while the queue is empty
+	 * A worker acquires it to wait for a job
+	 */
+	PyThread_type_lock jobs_available_lock;
+
+	/* The first job in the queue
+	 */
+	pyscca_async_job_t *first_job;
+
+	/* The last job in the queue
+	 */
+	pyscca_async_job_t *last_job;
+
+	/* The number of worker threads
+	 */
+	int number_of_workers;
+
+	/* The function that completes a future on the event loop
+	 */
+	PyObject *complete_function;
+};
+
+PyObject *pyscca_open_async(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyscca_async_initialize(
+     void );
+
+pyscca_async_job_t *pyscca_async_job_new(
+                     PyObject *source_object,
+                     int access_flags );
+
+void pyscca_async_job_free(
+      pyscca_async_job_t *job );
+
+int pyscca_async_push_job(
+     pyscca_async_job_t *job );
+
+pyscca_async_job_t *pyscca_async_pop_job(
+                     void );
+
+void pyscca_async_worker(
+      void *arguments );
+
+void pyscca_async_job_open(
+      pyscca_async_job_t *job );
+
+void pyscca_async_job_complete(
+      pyscca_async_job_t *job );
+
+PyObject *pyscca_async_complete_future(
+           PyObject *self,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_ASYNC_H ) */
+
@@ -0,0 +1,1114 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyscca_batch.h"
+#include "pyscca_error.h"
+#include "pyscca_integer.h"
+#include "pyscca_libcerror.h"
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+#include "pyscca_unused.h"
+
+/* Parses multiple files using worker threads
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_parse_many(
+           PyObject *self PYSCCA_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *sequence_object   = NULL;
+	static char *function       = "pyscca_parse_many";
+	static char *keyword_list[] = { "paths", "workers", NULL };
+	int number_of_workers       = PYSCCA_BATCH_DEFAULT_NUMBER_OF_WORKERS;
+
+	PYSCCA_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &sequence_object,
+	     &number_of_workers ) == 0 )
+	{
+		return( NULL );
+	}
+	if( number_of_workers < 1 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of workers value less than 1.",
+		 function );
+
+		return( NULL );
+	}
+	return( pyscca_batch_parse_paths(
+	         sequence_object,
+	         number_of_workers ) );
+}
+
+/* Parses the prefetch (.pf) files in a directory using worker threads
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_parse_directory(
+           PyObject *self PYSCCA_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *directory_object   = NULL;
+	PyObject *entries_object     = NULL;
+	PyObject *entry_object       = NULL;
+	PyObject *lower_object       = NULL;
+	PyObject *os_module          = NULL;
+	PyObject *path_module        = NULL;
+	PyObject *path_object        = NULL;
+	PyObject *paths_object       = NULL;
+	PyObject *result_object      = NULL;
+	PyObject *suffix_object      = NULL;
+	static char *function        = "pyscca_parse_directory";
+	static char *keyword_list[]  = { "path", "workers", NULL };
+	Py_ssize_t entry_index       = 0;
+	Py_ssize_t number_of_entries = 0;
+	int number_of_workers        = PYSCCA_BATCH_DEFAULT_NUMBER_OF_WORKERS;
+	int result                   = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &directory_object,
+	     &number_of_workers ) == 0 )
+	{
+		return( NULL );
+	}
+	if( number_of_workers < 1 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of workers value less than 1.",
+		 function );
+
+		return( NULL );
+	}
+	os_module = PyImport_ImportModule(
+	             "os" );
+
+	if( os_module == NULL )
+	{
+		goto on_error;
+	}
+	path_module = PyObject_GetAttrString(
+	               os_module,
+	               "path" );
+
+	if( path_module == NULL )
+	{
+		goto on_error;
+	}
+	entries_object = PyObject_CallMethod(
+	                  os_module,
+	                  "listdir",
+	                  "O",
+	                  directory_object );
+
+	if( entries_object == NULL )
+	{
+		goto on_error;
+	}
+	/* Sort the entries so that the results are returned in a deterministic order
+	 */
+	if( PyList_Sort(
+	     entries_object ) != 0 )
+	{
+		goto on_error;
+	}
+	paths_object = PyList_New(
+	                0 );
+
+	if( paths_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create paths list object.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_entries = PyList_Size(
+	                     entries_object );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		/* PyList_GetItem returns a borrowed reference
+		 */
+		entry_object = PyList_GetItem(
+		                entries_object,
+		                entry_index );
+
+		lower_object = PyObject_CallMethod(
+		                entry_object,
+		                "lower",
+		                NULL );
+
+		if( lower_object == NULL )
+		{
+			goto on_error;
+		}
+		/* The suffix must be of the same string type as the entry
+		 */
+		if( PyBytes_Check(
+		     lower_object ) )
+		{
+			suffix_object = PyBytes_FromString(
+			                 ".pf" );
+		}
+		else
+		{
+			suffix_object = PyUnicode_FromString(
+			                 ".pf" );
+		}
+		if( suffix_object == NULL )
+		{
+			goto on_error;
+		}
+		path_object = PyObject_CallMethod(
+		               lower_object,
+		               "endswith",
+		               "O",
+		               suffix_object );
+
+		Py_DecRef(
+		 suffix_object );
+
+		suffix_object = NULL;
+
+		if( path_object == NULL )
+		{
+			goto on_error;
+		}
+		result = PyObject_IsTrue(
+		          path_object );
+
+		Py_DecRef(
+		 path_object );
+
+		path_object = NULL;
+
+		Py_DecRef(
+		 lower_object );
+
+		lower_object = NULL;
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		path_object = PyObject_CallMethod(
+		               path_module,
+		               "join",
+		               "OO",
+		               directory_object,
+		               entry_object );
+
+		if( path_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyList_Append(
+		     paths_object,
+		     path_object ) != 0 )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 path_object );
+
+		path_object = NULL;
+	}
+	result_object = pyscca_batch_parse_paths(
+	                 paths_object,
+	                 number_of_workers );
+
+on_error:
+	if( suffix_object != NULL )
+	{
+		Py_DecRef(
+		 suffix_object );
+	}
+	if( path_object != NULL )
+	{
+		Py_DecRef(
+		 path_object );
+	}
+	if( lower_object != NULL )
+	{
+		Py_DecRef(
+		 lower_object );
+	}
+	if( paths_object != NULL )
+	{
+		Py_DecRef(
+		 paths_object );
+	}
+	if( entries_object != NULL )
+	{
+		Py_DecRef(
+		 entries_object );
+	}
+	if( path_module != NULL )
+	{
+		Py_DecRef(
+		 path_module );
+	}
+	if( os_module != NULL )
+	{
+		Py_DecRef(
+		 os_module );
+	}
+	return( result_object );
+}
+
+/* Parses the files in a sequence of paths using worker threads
+ * The files are opened and read without holding the GIL
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_batch_parse_paths(
+           PyObject *sequence_object,
+           int number_of_workers )
+{
+	PyObject *fast_sequence_object = NULL;
+	PyObject *list_object          = NULL;
+	PyObject *path_object          = NULL;
+	PyObject *record_object        = NULL;
+	PyObject **narrow_objects      = NULL;
+	pyscca_batch_record_t *records = NULL;
+	libcerror_error_t *error       = NULL;
+	char **paths                   = NULL;
+	static char *function          = "pyscca_batch_parse_paths";
+	Py_ssize_t number_of_paths     = 0;
+	Py_ssize_t path_index          = 0;
+	int result                     = 0;
+
+	fast_sequence_object = PySequence_Fast(
+	                        sequence_object,
+	                        "paths must be a sequence" );
+
+	if( fast_sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_paths = PySequence_Fast_GET_SIZE(
+	                   fast_sequence_object );
+
+	if( number_of_paths > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of paths value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               number_of_paths );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_paths == 0 )
+	{
+		Py_DecRef(
+		 fast_sequence_object );
+
+		return( list_object );
+	}
+	narrow_objects = (PyObject **) PyMem_Malloc(
+	                                sizeof( PyObject * ) * number_of_paths );
+
+	paths = (char **) PyMem_Malloc(
+	                   sizeof( char * ) * number_of_paths );
+
+	/* The records are filled by the worker threads without holding the GIL
+	 * hence they are allocated using memory_allocate
+	 */
+	records = (pyscca_batch_record_t *) memory_allocate(
+	                                     sizeof( pyscca_batch_record_t ) * number_of_paths );
+
+	if( ( narrow_objects == NULL )
+	 || ( paths == NULL )
+	 || ( records == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create paths.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 narrow_objects,
+	 0,
+	 sizeof( PyObject * ) * number_of_paths );
+
+	memory_set(
+	 records,
+	 0,
+	 sizeof( pyscca_batch_record_t ) * number_of_paths );
+
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		/* PySequence_Fast_GET_ITEM returns a borrowed reference
+		 */
+		path_object = PySequence_Fast_GET_ITEM(
+		               fast_sequence_object,
+		               path_index );
+
+		if( PyUnicode_Check(
+		     path_object ) )
+		{
+			narrow_objects[ path_index ] = PyUnicode_AsUTF8String(
+			                                path_object );
+
+			if( narrow_objects[ path_index ] == NULL )
+			{
+				pyscca_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert Unicode string to UTF-8.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( PyBytes_Check(
+		          path_object ) )
+		{
+			Py_IncRef(
+			 path_object );
+
+			narrow_objects[ path_index ] = path_object;
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: unsupported path: %d object type.",
+			 function,
+			 (int) path_index );
+
+			goto on_error;
+		}
+		paths[ path_index ] = PyBytes_AsString(
+		                       narrow_objects[ path_index ] );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_batch_open_paths(
+	          paths,
+	          (int) number_of_paths,
+	          number_of_workers,
+	          LIBSCCA_ACCESS_FLAG_READ | LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES,
+	          &pyscca_batch_callback,
+	          (void *) records,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to parse files.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		record_object = pyscca_batch_record_new_object(
+		                 &( records[ path_index ] ),
+		                 PySequence_Fast_GET_ITEM(
+		                  fast_sequence_object,
+		                  path_index ) );
+
+		if( record_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference to the record object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 path_index,
+		 record_object );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		pyscca_batch_record_clear(
+		 &( records[ path_index ] ) );
+
+		Py_DecRef(
+		 narrow_objects[ path_index ] );
+	}
+	memory_free(
+	 records );
+
+	PyMem_Free(
+	 paths );
+
+	PyMem_Free(
+	 narrow_objects );
+
+	Py_DecRef(
+	 fast_sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( records != NULL )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			pyscca_batch_record_clear(
+			 &( records[ path_index ] ) );
+		}
+		memory_free(
+		 records );
+	}
+	if( paths != NULL )
+	{
+		PyMem_Free(
+		 paths );
+	}
+	if( narrow_objects != NULL )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			if( narrow_objects[ path_index ] != NULL )
+			{
+				Py_DecRef(
+				 narrow_objects[ path_index ] );
+			}
+		}
+		PyMem_Free(
+		 narrow_objects );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 fast_sequence_object );
+
+	return( NULL );
+}
+
+/* Callback function that is invoked by the batch open for every path
+ * This function is called from the worker threads without holding the GIL
+ * and therefore must not call any Python function
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_batch_callback(
+     int path_index,
+     libscca_file_t *file,
+     libcerror_error_t *error,
+     void *callback_arguments )
+{
+	pyscca_batch_record_t *record  = NULL;
+	pyscca_batch_record_t *records = NULL;
+	libcerror_error_t *read_error  = NULL;
+
+	if( callback_arguments == NULL )
+	{
+		return( -1 );
+	}
+	if( path_index < 0 )
+	{
+		return( -1 );
+	}
+	records = (pyscca_batch_record_t *) callback_arguments;
+	record  = &( records[ path_index ] );
+
+	if( file == NULL )
+	{
+		record->has_error = 1;
+
+		if( error != NULL )
+		{
+			libcerror_error_backtrace_sprint(
+			 error,
+			 record->error_string,
+			 PYSCCA_BATCH_RECORD_ERROR_STRING_SIZE );
+		}
+		else
+		{
+			narrow_string_copy(
+			 record->error_string,
+			 "unable to open file.",
+			 21 );
+		}
+		return( 1 );
+	}
+	if( pyscca_batch_record_read_file(
+	     record,
+	     file,
+	     &read_error ) != 1 )
+	{
+		pyscca_batch_record_clear(
+		 record );
+
+		record->has_error = 1;
+
+		libcerror_error_backtrace_sprint(
+		 read_error,
+		 record->error_string,
+		 PYSCCA_BATCH_RECORD_ERROR_STRING_SIZE );
+
+		libcerror_error_free(
+		 &read_error );
+	}
+	/* A file that cannot be read is reported in its record
+	 * and does not abort the other files
+	 */
+	return( 1 );
+}
+
+/* Reads the values of a file into a record
+ * This function does not call any Python function
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_batch_record_read_file(
+     pyscca_batch_record_t *record,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "pyscca_batch_record_read_file";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_utf8_executable_filename_size(
+	     file,
+	     &( record->executable_filename_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( record->executable_filename_size > 0 )
+	{
+		record->executable_filename = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * record->executable_filename_size );
+
+		if( record->executable_filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create executable filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_executable_filename(
+		     file,
+		     record->executable_filename,
+		     record->executable_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &( record->prefetch_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_run_count(
+	     file,
+	     &( record->run_count ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_last_run_times(
+	     file,
+	     record->last_run_times,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &( record->number_of_last_run_times ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_filenames(
+	     file,
+	     &( record->number_of_filenames ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( record->number_of_filenames > 0 )
+	{
+		if( libscca_file_get_utf8_filenames_table_size(
+		     file,
+		     &( record->filenames_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( record->filenames_size > 0 )
+	{
+		record->filenames = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * record->filenames_size );
+
+		record->filename_offsets = (size_t *) memory_allocate(
+		                                       sizeof( size_t ) * record->number_of_filenames );
+
+		if( ( record->filenames == NULL )
+		 || ( record->filename_offsets == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table(
+		     file,
+		     record->filenames,
+		     record->filenames_size,
+		     record->filename_offsets,
+		     record->number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	pyscca_batch_record_clear(
+	 record );
+
+	return( -1 );
+}
+
+/* Frees the values of a record and resets them
+ */
+void pyscca_batch_record_clear(
+      pyscca_batch_record_t *record )
+{
+	if( record == NULL )
+	{
+		return;
+	}
+	if( record->filename_offsets != NULL )
+	{
+		memory_free(
+		 record->filename_offsets );
+	}
+	if( record->filenames != NULL )
+	{
+		memory_free(
+		 record->filenames );
+	}
+	if( record->executable_filename != NULL )
+	{
+		memory_free(
+		 record->executable_filename );
+	}
+	memory_set(
+	 record,
+	 0,
+	 sizeof( pyscca_batch_record_t ) );
+}
+
+/* Creates a new dictionary object from a record
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_batch_record_new_object(
+           pyscca_batch_record_t *record,
+           PyObject *path_object )
+{
+	PyObject *dictionary_object = NULL;
+	PyObject *list_object       = NULL;
+	PyObject *value_object      = NULL;
+	const char *errors          = NULL;
+	static char *function       = "pyscca_batch_record_new_object";
+	size_t utf8_string_size     = 0;
+	int filename_index          = 0;
+	int last_run_time_index     = 0;
+
+	if( record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid record.",
+		 function );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "path",
+	     path_object ) != 0 )
+	{
+		goto on_error;
+	}
+	if( record->has_error != 0 )
+	{
+		value_object = PyUnicode_DecodeUTF8(
+		                record->error_string,
+		                (Py_ssize_t) narrow_string_length(
+		                              record->error_string ),
+		                "replace" );
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	/* PyDict_SetItemString does not steal the reference to the value object
+	 */
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "error",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = NULL;
+
+	if( record->has_error != 0 )
+	{
+		return( dictionary_object );
+	}
+	if( record->executable_filename_size > 1 )
+	{
+		/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+		 * the end of string character is part of the string
+		 */
+		value_object = PyUnicode_DecodeUTF8(
+		                (char *) record->executable_filename,
+		                (Py_ssize_t) record->executable_filename_size - 1,
+		                errors );
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "executable_filename",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = pyscca_integer_unsigned_new_from_64bit(
+	                (uint64_t) record->prefetch_hash );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "prefetch_hash",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = pyscca_integer_unsigned_new_from_64bit(
+	                (uint64_t) record->run_count );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "run_count",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = NULL;
+
+	list_object = PyList_New(
+	               (Py_ssize_t) record->number_of_last_run_times );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < record->number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		value_object = pyscca_integer_unsigned_new_from_64bit(
+		                record->last_run_times[ last_run_time_index ] );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference to the value object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) last_run_time_index,
+		 value_object );
+
+		value_object = NULL;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "last_run_times",
+	     list_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 list_object );
+
+	list_object = PyList_New(
+	               (Py_ssize_t) record->number_of_filenames );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < record->number_of_filenames;
+	     filename_index++ )
+	{
+		if( record->filenames == NULL )
+		{
+			utf8_string_size = 0;
+		}
+		else if( ( filename_index + 1 ) < record->number_of_filenames )
+		{
+			utf8_string_size = record->filename_offsets[ filename_index + 1 ] - record->filename_offsets[ filename_index ];
+		}
+		else
+		{
+			utf8_string_size = record->filenames_size - record->filename_offsets[ filename_index ];
+		}
+		if( utf8_string_size <= 1 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		else
+		{
+			value_object = PyUnicode_DecodeUTF8(
+			                (char *) &( record->filenames[ record->filename_offsets[ filename_index ] ] ),
+			                (Py_ssize_t) utf8_string_size - 1,
+			                errors );
+
+			if( value_object == NULL )
+			{
+				goto on_error;
+			}
+		}
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) filename_index,
+		 value_object );
+
+		value_object = NULL;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "filenames",
+	     list_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 list_object );
+
+	return( dictionary_object );
+
+on_error:
+	if( value_object != NULL )
+	{
+		Py_DecRef(
+		 value_object );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 dictionary_object );
+
+	return( NULL );
+}
+
@@ -0,0 +1,138 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_BATCH_H )
+#define _PYSCCA_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_libcerror.h"
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of worker threads
+ */
+#define PYSCCA_BATCH_DEFAULT_NUMBER_OF_WORKERS	4
+
+/* The maximum size of the error string of a record
+ */
+#define PYSCCA_BATCH_RECORD_ERROR_STRING_SIZE	512
+
+typedef struct pyscca_batch_record pyscca_batch_record_t;
+
+/* The values of a parsed file
+ * The record is filled by the worker threads without the GIL,
+ * hence it contains no Python objects
+ */
+struct pyscca_batch_record
+{
+	/* The UTF-8 encoded executable filename
+	 */
+	uint8_t *executable_filename;
+
+	/* The executable filename size
+	 */
+	size_t executable_filename_size;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The run count
+	 */
+	uint32_t run_count;
+
+	/* The last run times
+	 */
+	uint64_t last_run_times[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	/* The number of last run times
+	 */
+	int number_of_last_run_times;
+
+	/* The UTF-8 encoded filenames
+	 */
+	uint8_t *filenames;
+
+	/* The filenames size
+	 */
+	size_t filenames_size;
+
+	/* The filename offsets
+	 */
+	size_t *filename_offsets;
+
+	/* The number of filenames
+	 */
+	int number_of_filenames;
+
+	/* Value to indicate the file could not be parsed
+	 */
+	uint8_t has_error;
+
+	/* The error string
+	 */
+	char error_string[ PYSCCA_BATCH_RECORD_ERROR_STRING_SIZE ];
+};
+
+PyObject *pyscca_parse_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_parse_directory(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_batch_parse_paths(
+           PyObject *sequence_object,
+           int number_of_workers );
+
+int pyscca_batch_callback(
+     int path_index,
+     libscca_file_t *file,
+     libcerror_error_t *error,
+     void *callback_arguments );
+
+int pyscca_batch_record_read_file(
+     pyscca_batch_record_t *record,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+void pyscca_batch_record_clear(
+      pyscca_batch_record_t *record );
+
+PyObject *pyscca_batch_record_new_object(
+           pyscca_batch_record_t *record,
+           PyObject *path_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_BATCH_H ) */
+
@@ -24,10 +24,30 @@
 #include <types.h>
 
 #include "pyscca_datetime.h"
+#include "pyscca_integer.h"
 #include "pyscca_python.h"
 
 #include <datetime.h>
 
+/* Imports the datetime C API
+ * The C API is imported once since importing it requires a module lookup
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_datetime_initialize(
+     void )
+{
+	if( PyDateTimeAPI == NULL )
+	{
+		PyDateTime_IMPORT;
+
+		if( PyDateTimeAPI == NULL )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Creates a new datetime object from a FAT date time
  * Returns a Python object if successful or NULL on error
  */
@@ -131,7 +151,10 @@ PyObject *pyscca_datetime_new_from_fat_date_time(
 
 		return( NULL );
 	}
-	PyDateTime_IMPORT;
+	if( pyscca_datetime_initialize() != 1 )
+	{
+		return( NULL );
+	}
 
 	datetime_object = (PyObject *) PyDateTime_FromDateAndTime(
 	                                (int) year,
@@ -306,7 +329,10 @@ PyObject *pyscca_datetime_new_from_filetime(
 	 */
 	day_of_month = (uint8_t) filetime;
 
-	PyDateTime_IMPORT;
+	if( pyscca_datetime_initialize() != 1 )
+	{
+		return( NULL );
+	}
 
 	datetime_object = (PyObject *) PyDateTime_FromDateAndTime(
 	                                (int) year,
@@ -486,7 +512,10 @@ PyObject *pyscca_datetime_new_from_floatingtime(
 	micro_seconds             = (uint8_t) timestamp.floating_point;
 	timestamp.floating_point -= micro_seconds;
 
-	PyDateTime_IMPORT;
+	if( pyscca_datetime_initialize() != 1 )
+	{
+		return( NULL );
+	}
 
 	datetime_object = (PyObject *) PyDateTime_FromDateAndTime(
 	                                (int) year,
@@ -636,7 +665,10 @@ PyObject *pyscca_datetime_new_from_posix_time(
 	 */
 	day_of_month = (uint8_t) posix_time;
 
-	PyDateTime_IMPORT;
+	if( pyscca_datetime_initialize() != 1 )
+	{
+		return( NULL );
+	}
 
 	datetime_object = (PyObject *) PyDateTime_FromDateAndTime(
 	                                (int) year,
@@ -792,7 +824,10 @@ PyObject *pyscca_datetime_new_from_posix_time_in_micro_seconds(
 	 */
 	day_of_month = (uint8_t) posix_time;
 
-	PyDateTime_IMPORT;
+	if( pyscca_datetime_initialize() != 1 )
+	{
+		return( NULL );
+	}
 
 	datetime_object = (PyObject *) PyDateTime_FromDateAndTime(
 	                                (int) year,
@@ -806,3 +841,100 @@ PyObject *pyscca_datetime_new_from_posix_time_in_micro_seconds(
 	return( datetime_object );
 }
 
+/* Creates a new list object from FILETIME values
+ * The timestamp format determines the type of the values in the list
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_datetime_new_list_from_filetimes(
+           const uint64_t *filetimes,
+           int number_of_filetimes,
+           int timestamp_format )
+{
+	PyObject *list_object  = NULL;
+	PyObject *value_object = NULL;
+	static char *function  = "pyscca_datetime_new_list_from_filetimes";
+	int filetime_index     = 0;
+
+	if( ( filetimes == NULL )
+	 && ( number_of_filetimes > 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid filetimes.",
+		 function );
+
+		return( NULL );
+	}
+	if( number_of_filetimes < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of filetimes value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( timestamp_format != PYSCCA_TIMESTAMP_FORMAT_DATETIME )
+	 && ( timestamp_format != PYSCCA_TIMESTAMP_FORMAT_FILETIME )
+	 && ( timestamp_format != PYSCCA_TIMESTAMP_FORMAT_POSIX_TIME_IN_MICRO_SECONDS ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported timestamp format: %d.",
+		 function,
+		 timestamp_format );
+
+		return( NULL );
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_filetimes );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		return( NULL );
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		switch( timestamp_format )
+		{
+			case PYSCCA_TIMESTAMP_FORMAT_FILETIME:
+				value_object = pyscca_integer_unsigned_new_from_64bit(
+				                filetimes[ filetime_index ] );
+				break;
+
+			case PYSCCA_TIMESTAMP_FORMAT_POSIX_TIME_IN_MICRO_SECONDS:
+				/* The FILETIME epoch is 11644473600 seconds before the POSIX epoch
+				 */
+				value_object = pyscca_integer_signed_new_from_64bit(
+				                ( (int64_t) ( filetimes[ filetime_index ] / 10 ) ) - (int64_t) 11644473600000000LL );
+				break;
+
+			default:
+				value_object = pyscca_datetime_new_from_filetime(
+				                filetimes[ filetime_index ] );
+				break;
+		}
+		if( value_object == NULL )
+		{
+			Py_DecRef(
+			 list_object );
+
+			return( NULL );
+		}
+		/* PyList_SetItem steals the reference to the value object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) filetime_index,
+		 value_object );
+	}
+	return( list_object );
+}
+
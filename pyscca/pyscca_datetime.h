@@ -31,6 +31,18 @@
 extern "C" {
 #endif
 
+/* The timestamp formats
+ */
+enum PYSCCA_TIMESTAMP_FORMATS
+{
+	PYSCCA_TIMESTAMP_FORMAT_DATETIME			= 0,
+	PYSCCA_TIMESTAMP_FORMAT_FILETIME			= 1,
+	PYSCCA_TIMESTAMP_FORMAT_POSIX_TIME_IN_MICRO_SECONDS	= 2
+};
+
+int pyscca_datetime_initialize(
+     void );
+
 PyObject *pyscca_datetime_new_from_fat_date_time(
            uint32_t fat_date_time );
 
@@ -46,6 +58,11 @@ PyObject *pyscca_datetime_new_from_posix_time(
 PyObject *pyscca_datetime_new_from_posix_time_in_micro_seconds(
            int64_t posix_time );
 
+PyObject *pyscca_datetime_new_list_from_filetimes(
+           const uint64_t *filetimes,
+           int number_of_filetimes,
+           int timestamp_format );
+
 #if defined( __cplusplus )
 }
 #endif
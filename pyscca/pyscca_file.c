@@ -20,12 +20,16 @@
  */
 
 #include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "pyscca.h"
+#include "pyscca_array.h"
 #include "pyscca_datetime.h"
 #include "pyscca_error.h"
 #include "pyscca_file.h"
@@ -34,10 +38,13 @@
 #include "pyscca_file_object_io_handle.h"
 #include "pyscca_filenames.h"
 #include "pyscca_integer.h"
+#include "pyscca_iterator.h"
 #include "pyscca_libbfio.h"
 #include "pyscca_libcerror.h"
 #include "pyscca_libscca.h"
+#include "pyscca_parse_cache.h"
 #include "pyscca_python.h"
+#include "pyscca_records.h"
 #include "pyscca_unused.h"
 #include "pyscca_volume_information.h"
 #include "pyscca_volumes.h"
@@ -62,19 +69,57 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Signals the file to abort the current activity." },
 
+	{ "set_parse_budget",
+	  (PyCFunction) pyscca_file_set_parse_budget,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_parse_budget(maximum_number_of_entries=0, maximum_uncompressed_data_size=0, maximum_number_of_steps=0) -> None\n"
+	  "\n"
+	  "Sets the parse budget, where 0 represents no maximum. Parsing is aborted with an IOError when the budget is exceeded." },
+
+	{ "set_deadline",
+	  (PyCFunction) pyscca_file_set_deadline,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_deadline(deadline) -> None\n"
+	  "\n"
+	  "Sets the parse deadline as a monotonic timestamp in nano seconds, such as time.monotonic_ns() on Linux, where 0 represents no deadline.\n"
+	  "The sections that were not read before the deadline are flagged as corrupted." },
+
 	{ "open",
 	  (PyCFunction) pyscca_file_open,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open(filename, mode='r') -> None\n"
+	  "open(filename, mode='r', flags=OPEN_READ, sections=None) -> None\n"
 	  "\n"
-	  "Opens a file." },
+	  "Opens a file.\n"
+	  "The flags, such as OPEN_HEADER_ONLY, or sections, a sequence of \"header\", \"file_information\",\n"
+	  "\"file_metrics\", \"filenames\" and \"volumes\", select the sections read on open,\n"
+	  "the skipped sections are read on first access." },
 
 	{ "open_file_object",
 	  (PyCFunction) pyscca_file_open_file_object,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "open_file_object(file_object, mode='r') -> None\n"
+	  "open_file_object(file_object, mode='r', read_ahead_size=16777216, flags=OPEN_READ, sections=None) -> None\n"
+	  "\n"
+	  "Opens a file using a file-like object.\n"
+	  "The file-like object is read into memory with a single read if its size does not exceed read_ahead_size, 0 disables this.\n"
+	  "The flags, such as OPEN_HEADER_ONLY, or sections, a sequence of \"header\", \"file_information\",\n"
+	  "\"file_metrics\", \"filenames\" and \"volumes\", select the sections read on open,\n"
+	  "the skipped sections are read on first access." },
+
+	{ "open_bytes",
+	  (PyCFunction) pyscca_file_open_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(buffer, mode='r', flags=OPEN_READ, sections=None) -> None\n"
 	  "\n"
-	  "Opens a file using a file-like object." },
+	  "Opens a file from an object that supports the buffer protocol, such as bytes, memoryview or mmap.\n"
+	  "The data is not copied and the buffer is held until the file is closed." },
+
+	{ "open_snapshot",
+	  (PyCFunction) pyscca_file_open_snapshot,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_snapshot(buffer, flags=OPEN_READ, sections=None) -> None\n"
+	  "\n"
+	  "Opens a file from snapshot data, as created by get_snapshot, write_snapshot or to_shared_memory.\n"
+	  "The snapshot data is parsed in place, it is not copied and the buffer is held until the file is closed." },
 
 	{ "close",
 	  (PyCFunction) pyscca_file_close,
@@ -104,10 +149,18 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the prefetch hash." },
 
+	{ "set_timestamps_as_integers",
+	  (PyCFunction) pyscca_file_set_timestamps_as_integers,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_timestamps_as_integers(timestamps_as_integers) -> None\n"
+	  "\n"
+	  "Sets if timestamps are returned as integers containing a FILETIME value instead of datetime objects.\n"
+	  "This applies to the last run times and the volume creation times and avoids creating datetime objects." },
+
 	{ "get_last_run_time",
 	  (PyCFunction) pyscca_file_get_last_run_time,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "get_last_run_time(last_run_time_index) -> Datetime or None\n"
+	  "get_last_run_time(last_run_time_index) -> Datetime, Integer or None\n"
 	  "\n"
 	  "Retrieves the last run time specified by the index." },
 
@@ -118,6 +171,25 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the last run time specified by the index as a 64-bit integer containing a FILETIME value." },
 
+	{ "get_last_run_times",
+	  (PyCFunction) pyscca_file_get_last_run_times,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_last_run_times(as_integers=None, as_posix_time=False) -> List of Datetime or Integer\n"
+	  "\n"
+	  "Retrieves all last run times that are set in a single call.\n"
+	  "If as_integers is True the last run times are returned as 64-bit integers containing a FILETIME value,\n"
+	  "if None timestamps_as_integers of the file determines the type.\n"
+	  "If as_posix_time is True the last run times are returned as signed integers containing\n"
+	  "the number of micro seconds since January 1, 1970 (POSIX epoch)." },
+
+	{ "get_last_run_times_array",
+	  (PyCFunction) pyscca_file_get_last_run_times_array,
+	  METH_NOARGS,
+	  "get_last_run_times_array() -> Array of 64-bit integers\n"
+	  "\n"
+	  "Retrieves all last run times that are set as an array of 64-bit integers containing a FILETIME value.\n"
+	  "The array is a NumPy uint64 array if numpy is installed, otherwise a memoryview." },
+
 	{ "get_run_count",
 	  (PyCFunction) pyscca_file_get_run_count,
 	  METH_NOARGS,
@@ -139,6 +211,47 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the file metrics entry specified by the index." },
 
+	{ "get_file_metrics_table",
+	  (PyCFunction) pyscca_file_get_file_metrics_table,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_file_metrics_table(columnar=False, raw_names=False) -> List of tuples or Dictionary of lists\n"
+	  "\n"
+	  "Retrieves the values of all file metrics entries as a list of (start time, duration,\n"
+	  "flags, file reference, filename) tuples, where the file reference is 0 if not set\n"
+	  "and the filename is None if not available.\n"
+	  "If columnar is True the values are returned as a dictionary of parallel lists with\n"
+	  "the keys: start_time, duration, flags, file_reference and filename.\n"
+	  "If raw_names is True the filenames are bytes with the UTF-16 little-endian data\n"
+	  "as stored in the file, which avoids converting them into Unicode strings." },
+
+	{ "get_file_metrics_arrays",
+	  (PyCFunction) pyscca_file_get_file_metrics_arrays,
+	  METH_NOARGS,
+	  "get_file_metrics_arrays() -> Dictionary of arrays\n"
+	  "\n"
+	  "Retrieves the values of all file metrics entries as a dictionary of parallel arrays with\n"
+	  "the keys: start_time, duration, flags, file_reference and filename_index, where the file\n"
+	  "reference is 0 if not set and the filename index is -1 if not available.\n"
+	  "The arrays are NumPy arrays if numpy is installed, otherwise memoryviews. The values are\n"
+	  "copied directly into the arrays without creating a Python integer per value." },
+
+	{ "get_file_metrics_records",
+	  (PyCFunction) pyscca_file_get_file_metrics_records,
+	  METH_NOARGS,
+	  "get_file_metrics_records() -> List of file metrics records\n"
+	  "\n"
+	  "Retrieves the values of all file metrics entries as a list of pyscca.file_metrics_record,\n"
+	  "with the fields: start_time, duration, flags, file_reference and filename.\n"
+	  "The values are retrieved in a single pass, reading a field is a tuple index." },
+
+	{ "get_trace_chain_load_counts_array",
+	  (PyCFunction) pyscca_file_get_trace_chain_load_counts_array,
+	  METH_NOARGS,
+	  "get_trace_chain_load_counts_array() -> Array of 32-bit integers\n"
+	  "\n"
+	  "Retrieves the total block load counts of all trace chain entries as an array.\n"
+	  "The array is a NumPy uint32 array if numpy is installed, otherwise a memoryview." },
+
 	{ "get_number_of_filenames",
 	  (PyCFunction) pyscca_file_get_number_of_filenames,
 	  METH_NOARGS,
@@ -153,6 +266,75 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the filename specified by the index." },
 
+	{ "get_filenames_tuple",
+	  (PyCFunction) pyscca_file_get_filenames_tuple,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_filenames_tuple(raw=False) -> Tuple of Unicode strings or bytes\n"
+	  "\n"
+	  "Retrieves all filenames as a tuple of interned strings, converted in a single pass\n"
+	  "on first access and cached until the file is closed.\n"
+	  "If raw is True the filenames are bytes with the UTF-16 little-endian data as stored\n"
+	  "in the file, without the end-of-string character, and no conversion is done." },
+
+	{ "get_snapshot_size",
+	  (PyCFunction) pyscca_file_get_snapshot_size,
+	  METH_NOARGS,
+	  "get_snapshot_size() -> Integer\n"
+	  "\n"
+	  "Retrieves the size of the snapshot data of the file." },
+
+	{ "write_snapshot",
+	  (PyCFunction) pyscca_file_write_snapshot,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "write_snapshot(buffer) -> Integer\n"
+	  "\n"
+	  "Writes the snapshot data of the file into a writable object that supports the buffer protocol,\n"
+	  "such as bytearray or the buf of a multiprocessing.shared_memory.SharedMemory, and returns its size." },
+
+	{ "get_snapshot",
+	  (PyCFunction) pyscca_file_get_snapshot,
+	  METH_NOARGS,
+	  "get_snapshot() -> Bytes\n"
+	  "\n"
+	  "Retrieves the snapshot data of the file. The snapshot contains the uncompressed data\n"
+	  "and can be opened without decompression using pyscca.open_snapshot." },
+
+	{ "to_shared_memory",
+	  (PyCFunction) pyscca_file_to_shared_memory,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "to_shared_memory(name=None) -> Object\n"
+	  "\n"
+	  "Writes the snapshot data of the file into a new multiprocessing.shared_memory.SharedMemory,\n"
+	  "which is returned. Another process can open the file using pyscca.open_snapshot on the buf\n"
+	  "of the shared memory attached by name. The caller is responsible for unlinking the shared memory." },
+
+	{ "__reduce__",
+	  (PyCFunction) pyscca_file_reduce,
+	  METH_NOARGS,
+	  "__reduce__() -> Tuple\n"
+	  "\n"
+	  "Pickles the file as its snapshot data, which is opened using pyscca.open_snapshot on unpickling." },
+
+	{ "iter_filenames",
+	  (PyCFunction) pyscca_file_iter_filenames,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_filenames(pattern=None, case_sensitive=False) -> Iterator of Unicode strings\n"
+	  "\n"
+	  "Iterates the filenames, converting a filename only when it is requested.\n"
+	  "If a pattern is specified only the filenames that match the pattern are returned,\n"
+	  "where a * at the start or end of the pattern matches any leading or trailing\n"
+	  "characters. The matching is done on the stored strings and is case insensitive\n"
+	  "unless case_sensitive is True." },
+
+	{ "iter_file_metrics",
+	  (PyCFunction) pyscca_file_iter_file_metrics,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_file_metrics(pattern=None, case_sensitive=False) -> Iterator of file metrics objects\n"
+	  "\n"
+	  "Iterates the file metrics entries, creating an object only when it is requested.\n"
+	  "If a pattern is specified only the entries with a filename that matches the pattern\n"
+	  "are returned, see iter_filenames for the pattern syntax." },
+
 	{ "get_number_of_volumes",
 	  (PyCFunction) pyscca_file_get_number_of_volumes,
 	  METH_NOARGS,
@@ -167,12 +349,36 @@ PyMethodDef pyscca_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the volume information specified by the index." },
 
+	{ "get_volume_records",
+	  (PyCFunction) pyscca_file_get_volume_records,
+	  METH_NOARGS,
+	  "get_volume_records() -> List of volume records\n"
+	  "\n"
+	  "Retrieves the values of all volumes as a list of pyscca.volume_record, with the fields:\n"
+	  "device_path, creation_time, serial_number, file_references and directory_strings.\n"
+	  "The values are retrieved in a single pass, reading a field is a tuple index." },
+
+	{ "get_stats",
+	  (PyCFunction) pyscca_file_get_stats,
+	  METH_NOARGS,
+	  "get_stats() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the parse statistics of the open file: the number of bytes read, decompressed blocks,\n"
+	  "compressed block cache hits and misses, allocations and uncompressed data size, and the read time\n"
+	  "of the sections in nano seconds or None if no monotonic clock is available." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
 
 PyGetSetDef pyscca_file_object_get_set_definitions[] = {
 
+	{ "timestamps_as_integers",
+	  (getter) pyscca_file_get_timestamps_as_integers,
+	  (setter) pyscca_file_set_timestamps_as_integers_setter,
+	  "Value to indicate timestamps are returned as integers containing a FILETIME value instead of datetime objects.",
+	  NULL },
+
 	{ "format_version",
 	  (getter) pyscca_file_get_format_version,
 	  (setter) 0,
@@ -233,6 +439,12 @@ PyGetSetDef pyscca_file_object_get_set_definitions[] = {
 	  "The volumes.",
 	  NULL },
 
+	{ "stats",
+	  (getter) pyscca_file_get_stats,
+	  (setter) 0,
+	  "The parse statistics.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -338,8 +550,7 @@ PyTypeObject pyscca_file_type_object = {
 int pyscca_file_init(
      pyscca_file_t *pyscca_file )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_init";
+	static char *function = "pyscca_file_init";
 
 	if( pyscca_file == NULL )
 	{
@@ -352,9 +563,50 @@ int pyscca_file_init(
 	}
 	/* Make sure libscca file is set to NULL
 	 */
-	pyscca_file->file           = NULL;
-	pyscca_file->file_io_handle = NULL;
+	pyscca_file->file                   = NULL;
+	pyscca_file->file_io_handle         = NULL;
+	pyscca_file->buffer_is_set          = 0;
+	pyscca_file->buffer_is_snapshot     = 0;
+	pyscca_file->filenames_object       = NULL;
+	pyscca_file->timestamps_as_integers = 0;
+	pyscca_file->access_flags           = 0;
+	pyscca_file->filename_object        = NULL;
+	pyscca_file->header_file            = NULL;
+	pyscca_file->parse_cache_object     = NULL;
+
+#if defined( Py_GIL_DISABLED )
+	memory_set(
+	 &( pyscca_file->mutex ),
+	 0,
+	 sizeof( PyMutex ) );
+#endif
+	/* The libscca file is created on open, see pyscca_file_initialize_file
+	 */
+	return( 0 );
+}
+
+/* Creates the libscca file of a file object if not set
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_initialize_file(
+     pyscca_file_t *pyscca_file )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_initialize_file";
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
 
+		return( -1 );
+	}
+	if( pyscca_file->file != NULL )
+	{
+		return( 1 );
+	}
 	if( libscca_file_initialize(
 	     &( pyscca_file->file ),
 	     &error ) != 1 )
@@ -370,7 +622,7 @@ int pyscca_file_init(
 
 		return( -1 );
 	}
-	return( 0 );
+	return( 1 );
 }
 
 /* Frees a file object
@@ -413,6 +665,19 @@ void pyscca_file_free(
 
 		return;
 	}
+	/* A file opened using a parse cache is shared, hence it is released instead of freed
+	 */
+	if( pyscca_file->parse_cache_object != NULL )
+	{
+		pyscca_parse_cache_release_file(
+		 (pyscca_parse_cache_t *) pyscca_file->parse_cache_object,
+		 &( pyscca_file->file ) );
+
+		Py_DecRef(
+		 pyscca_file->parse_cache_object );
+
+		pyscca_file->parse_cache_object = NULL;
+	}
 	if( pyscca_file->file != NULL )
 	{
 		Py_BEGIN_ALLOW_THREADS
@@ -435,10 +700,82 @@ void pyscca_file_free(
 			 &error );
 		}
 	}
+	if( pyscca_file->header_file != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_free(
+		          &( pyscca_file->header_file ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libscca header file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyscca_file->filename_object != NULL )
+	{
+		Py_DecRef(
+		 pyscca_file->filename_object );
+
+		pyscca_file->filename_object = NULL;
+	}
+	if( pyscca_file->filenames_object != NULL )
+	{
+		Py_DecRef(
+		 pyscca_file->filenames_object );
+
+		pyscca_file->filenames_object = NULL;
+	}
+	if( pyscca_file->buffer_is_set != 0 )
+	{
+		PyBuffer_Release(
+		 &( pyscca_file->buffer ) );
+
+		pyscca_file->buffer_is_set = 0;
+	}
 	ob_type->tp_free(
 	 (PyObject*) pyscca_file );
 }
 
+/* Locks the file object
+ * Only free-threaded builds use a per-object mutex, otherwise this function does nothing
+ */
+void pyscca_file_lock(
+      pyscca_file_t *pyscca_file )
+{
+#if defined( Py_GIL_DISABLED )
+	/* PyMutex_Lock detaches the thread state while waiting
+	 */
+	PyMutex_Lock(
+	 &( pyscca_file->mutex ) );
+#else
+	PYSCCA_UNREFERENCED_PARAMETER( pyscca_file )
+#endif
+}
+
+/* Unlocks the file object
+ */
+void pyscca_file_unlock(
+      pyscca_file_t *pyscca_file )
+{
+#if defined( Py_GIL_DISABLED )
+	PyMutex_Unlock(
+	 &( pyscca_file->mutex ) );
+#else
+	PYSCCA_UNREFERENCED_PARAMETER( pyscca_file )
+#endif
+}
+
 /* Signals the file to abort the current activity
  * Returns a Python object if successful or NULL on error
  */
@@ -488,6 +825,132 @@ PyObject *pyscca_file_signal_abort(
 	return( Py_None );
 }
 
+/* Sets the parse budget
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_set_parse_budget(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error                     = NULL;
+	static char *function                        = "pyscca_file_set_parse_budget";
+	static char *keyword_list[]                  = { "maximum_number_of_entries", "maximum_uncompressed_data_size", "maximum_number_of_steps", NULL };
+	unsigned long long maximum_number_of_steps   = 0;
+	unsigned long long maximum_uncompressed_size = 0;
+	unsigned int maximum_number_of_entries       = 0;
+	int result                                   = 0;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|IKK",
+	     keyword_list,
+	     &maximum_number_of_entries,
+	     &maximum_uncompressed_size,
+	     &maximum_number_of_steps ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_set_parse_budget(
+	          pyscca_file->file,
+	          (uint32_t) maximum_number_of_entries,
+	          (uint64_t) maximum_uncompressed_size,
+	          (uint64_t) maximum_number_of_steps,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set parse budget.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets the parse deadline
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_set_deadline(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyscca_file_set_deadline";
+	static char *keyword_list[] = { "deadline", NULL };
+	unsigned long long deadline = 0;
+	int result                  = 0;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &deadline ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_set_deadline(
+	          pyscca_file->file,
+	          (uint64_t) deadline,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set deadline.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Opens a file
  * Returns a Python object if successful or NULL on error
  */
@@ -496,19 +959,13 @@ PyObject *pyscca_file_open(
            PyObject *arguments,
            PyObject *keywords )
 {
-	PyObject *string_object      = NULL;
-	libcerror_error_t *error     = NULL;
-	const char *filename_narrow  = NULL;
-	static char *function        = "pyscca_file_open";
-	static char *keyword_list[]  = { "filename", "mode", NULL };
-	char *mode                   = NULL;
-	int result                   = 0;
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	const wchar_t *filename_wide = NULL;
-#else
-	PyObject *utf8_string_object = NULL;
-#endif
+	PyObject *sections_object   = NULL;
+	PyObject *string_object     = NULL;
+	static char *function       = "pyscca_file_open";
+	static char *keyword_list[] = { "filename", "mode", "flags", "sections", NULL };
+	char *mode                  = NULL;
+	int access_flags            = 0;
+	int flags                   = LIBSCCA_OPEN_READ;
 
 	if( pyscca_file == NULL )
 	{
@@ -527,10 +984,12 @@ PyObject *pyscca_file_open(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "O|s",
+	     "O|siO",
 	     keyword_list,
 	     &string_object,
-	     &mode ) == 0 )
+	     &mode,
+	     &flags,
+	     &sections_object ) == 0 )
 	{
 		return( NULL );
 	}
@@ -545,153 +1004,550 @@ PyObject *pyscca_file_open(
 
 		return( NULL );
 	}
-	PyErr_Clear();
-
-	result = PyObject_IsInstance(
-	          string_object,
-	          (PyObject *) &PyUnicode_Type );
+	if( pyscca_file_get_access_flags(
+	     flags,
+	     sections_object,
+	     &access_flags ) != 1 )
+	{
+		return( NULL );
+	}
+	pyscca_file_lock(
+	 pyscca_file );
 
-	if( result == -1 )
+	if( pyscca_file->filename_object != NULL )
 	{
-		pyscca_error_fetch_and_raise(
-		 PyExc_RuntimeError,
-		 "%s: unable to determine if string object is of type Unicode.",
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid file - filename already set.",
 		 function );
 
-		return( NULL );
+		goto on_error;
 	}
-	else if( result != 0 )
+	Py_IncRef(
+	 string_object );
+
+	pyscca_file->filename_object = string_object;
+
+	if( ( pyscca_file_initialize_file(
+	       pyscca_file ) != 1 )
+	 || ( pyscca_file_open_source(
+	       pyscca_file,
+	       pyscca_file->file,
+	       access_flags ) != 1 ) )
 	{
-		PyErr_Clear();
+		Py_DecRef(
+		 pyscca_file->filename_object );
+
+		pyscca_file->filename_object = NULL;
+
+		goto on_error;
+	}
+	pyscca_file->access_flags = access_flags;
+
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( NULL );
+}
+
+/* Determines the libscca access flags from the open flags and sections
+ * The sections are a sequence of names of the sections that are read on open,
+ * the file header and file information are always read
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_get_access_flags(
+     int flags,
+     PyObject *sections_object,
+     int *access_flags )
+{
+	PyObject *fast_sequence_object = NULL;
+	PyObject *section_object       = NULL;
+	PyObject *utf8_string_object   = NULL;
+	const char *section_name       = NULL;
+	static char *function          = "pyscca_file_get_access_flags";
+	Py_ssize_t number_of_sections  = 0;
+	Py_ssize_t section_index       = 0;
+	size_t section_name_length     = 0;
+	int safe_access_flags          = 0;
+
+	if( access_flags == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( flags & LIBSCCA_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( flags & ~( PYSCCA_FILE_SUPPORTED_ACCESS_FLAGS ) ) != 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported flags: 0x%04x.",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	safe_access_flags = flags;
+
+	if( ( sections_object != NULL )
+	 && ( sections_object != Py_None ) )
+	{
+		safe_access_flags |= LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS
+		                   | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES
+		                   | LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES;
+
+		fast_sequence_object = PySequence_Fast(
+		                        sections_object,
+		                        "sections must be a sequence" );
+
+		if( fast_sequence_object == NULL )
+		{
+			return( -1 );
+		}
+		number_of_sections = PySequence_Fast_GET_SIZE(
+		                      fast_sequence_object );
+
+		for( section_index = 0;
+		     section_index < number_of_sections;
+		     section_index++ )
+		{
+			/* PySequence_Fast_GET_ITEM returns a borrowed reference
+			 */
+			section_object = PySequence_Fast_GET_ITEM(
+			                  fast_sequence_object,
+			                  section_index );
+
+			if( PyUnicode_Check(
+			     section_object ) )
+			{
+				utf8_string_object = PyUnicode_AsUTF8String(
+				                      section_object );
+
+				if( utf8_string_object == NULL )
+				{
+					goto on_error;
+				}
+			}
+			else if( PyBytes_Check(
+			          section_object ) )
+			{
+				Py_IncRef(
+				 section_object );
+
+				utf8_string_object = section_object;
+			}
+			else
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported section: %d object type.",
+				 function,
+				 (int) section_index );
+
+				goto on_error;
+			}
+			section_name = PyBytes_AsString(
+			                utf8_string_object );
+
+			section_name_length = narrow_string_length(
+			                       section_name );
+
+			if( ( ( section_name_length == 6 )
+			  &&  ( narrow_string_compare(
+			         section_name,
+			         "header",
+			         6 ) == 0 ) )
+			 || ( ( section_name_length == 16 )
+			  &&  ( narrow_string_compare(
+			         section_name,
+			         "file_information",
+			         16 ) == 0 ) )
+			 || ( ( section_name_length == 8 )
+			  &&  ( narrow_string_compare(
+			         section_name,
+			         "run_info",
+			         8 ) == 0 ) ) )
+			{
+				/* The file header and file information are always read
+				 */
+			}
+			else if( ( section_name_length == 12 )
+			      && ( narrow_string_compare(
+			            section_name,
+			            "file_metrics",
+			            12 ) == 0 ) )
+			{
+				safe_access_flags &= ~( LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS );
+			}
+			else if( ( section_name_length == 9 )
+			      && ( narrow_string_compare(
+			            section_name,
+			            "filenames",
+			            9 ) == 0 ) )
+			{
+				safe_access_flags &= ~( LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES );
+			}
+			else if( ( section_name_length == 7 )
+			      && ( narrow_string_compare(
+			            section_name,
+			            "volumes",
+			            7 ) == 0 ) )
+			{
+				safe_access_flags &= ~( LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES );
+			}
+			else
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: unsupported section: %s.",
+				 function,
+				 section_name );
+
+				goto on_error;
+			}
+			Py_DecRef(
+			 utf8_string_object );
+
+			utf8_string_object = NULL;
+		}
+		Py_DecRef(
+		 fast_sequence_object );
+	}
+	*access_flags = safe_access_flags;
+
+	return( 1 );
+
+on_error:
+	if( utf8_string_object != NULL )
+	{
+		Py_DecRef(
+		 utf8_string_object );
+	}
+	Py_DecRef(
+	 fast_sequence_object );
+
+	return( -1 );
+}
+
+/* Opens a libscca file from the source of the file object
+ * The source is the buffer, the file IO handle or the filename, whichever is set
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_open_source(
+     pyscca_file_t *pyscca_file,
+     libscca_file_t *file,
+     int access_flags )
+{
+	libcerror_error_t *error     = NULL;
+	const char *filename_narrow  = NULL;
+	static char *function        = "pyscca_file_open_source";
+	int result                   = 0;
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		filename_wide = (wchar_t *) PyUnicode_AsUnicode(
-		                             string_object );
+	const wchar_t *filename_wide = NULL;
+#else
+	PyObject *utf8_string_object = NULL;
+#endif
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pyscca_file->buffer_is_set != 0 )
+	 && ( pyscca_file->buffer_is_snapshot != 0 ) )
+	{
 		Py_BEGIN_ALLOW_THREADS
 
-		result = libscca_file_open_wide(
-		          pyscca_file->file,
-		          filename_wide,
-		          LIBSCCA_OPEN_READ,
+		result = libscca_file_open_snapshot(
+		          file,
+		          (const uint8_t *) pyscca_file->buffer.buf,
+		          (size_t) pyscca_file->buffer.len,
+		          access_flags,
 		          &error );
 
 		Py_END_ALLOW_THREADS
-#else
-		utf8_string_object = PyUnicode_AsUTF8String(
-		                      string_object );
+	}
+	else if( pyscca_file->buffer_is_set != 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_open_memory(
+		          file,
+		          (const uint8_t *) pyscca_file->buffer.buf,
+		          (size_t) pyscca_file->buffer.len,
+		          access_flags,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	else if( pyscca_file->file_io_handle != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_open_file_io_handle(
+		          file,
+		          pyscca_file->file_io_handle,
+		          access_flags,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+	}
+	else if( pyscca_file->filename_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file - missing source.",
+		 function );
+
+		return( -1 );
+	}
+	else
+	{
+		PyErr_Clear();
+
+		result = PyObject_IsInstance(
+		          pyscca_file->filename_object,
+		          (PyObject *) &PyUnicode_Type );
 
-		if( utf8_string_object == NULL )
+		if( result == -1 )
 		{
 			pyscca_error_fetch_and_raise(
 			 PyExc_RuntimeError,
-			 "%s: unable to convert Unicode string to UTF-8.",
+			 "%s: unable to determine if string object is of type Unicode.",
 			 function );
 
-			return( NULL );
+			return( -1 );
 		}
+		else if( result != 0 )
+		{
+			PyErr_Clear();
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			filename_wide = (wchar_t *) PyUnicode_AsUnicode(
+			                             pyscca_file->filename_object );
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libscca_file_open_wide(
+			          file,
+			          filename_wide,
+			          access_flags,
+			          &error );
+
+			Py_END_ALLOW_THREADS
+#else
+			utf8_string_object = PyUnicode_AsUTF8String(
+			                      pyscca_file->filename_object );
+
+			if( utf8_string_object == NULL )
+			{
+				pyscca_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert Unicode string to UTF-8.",
+				 function );
+
+				return( -1 );
+			}
 #if PY_MAJOR_VERSION >= 3
-		filename_narrow = PyBytes_AsString(
-		                   utf8_string_object );
+			filename_narrow = PyBytes_AsString(
+			                   utf8_string_object );
 #else
-		filename_narrow = PyString_AsString(
-		                   utf8_string_object );
+			filename_narrow = PyString_AsString(
+			                   utf8_string_object );
 #endif
-		Py_BEGIN_ALLOW_THREADS
+			Py_BEGIN_ALLOW_THREADS
 
-		result = libscca_file_open(
-		          pyscca_file->file,
-		          filename_narrow,
-		          LIBSCCA_OPEN_READ,
-		          &error );
+			result = libscca_file_open(
+			          file,
+			          filename_narrow,
+			          access_flags,
+			          &error );
 
-		Py_END_ALLOW_THREADS
+			Py_END_ALLOW_THREADS
 
-		Py_DecRef(
-		 utf8_string_object );
+			Py_DecRef(
+			 utf8_string_object );
 #endif
-		if( result != 1 )
+		}
+		else
 		{
-			pyscca_error_raise(
-			 error,
-			 PyExc_IOError,
-			 "%s: unable to open file.",
-			 function );
+			PyErr_Clear();
 
-			libcerror_error_free(
-			 &error );
+#if PY_MAJOR_VERSION >= 3
+			result = PyObject_IsInstance(
+			          pyscca_file->filename_object,
+			          (PyObject *) &PyBytes_Type );
+#else
+			result = PyObject_IsInstance(
+			          pyscca_file->filename_object,
+			          (PyObject *) &PyString_Type );
+#endif
+			if( result == -1 )
+			{
+				pyscca_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to determine if string object is of type string.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported string object type.",
+				 function );
+
+				return( -1 );
+			}
+			PyErr_Clear();
 
-			return( NULL );
+#if PY_MAJOR_VERSION >= 3
+			filename_narrow = PyBytes_AsString(
+			                   pyscca_file->filename_object );
+#else
+			filename_narrow = PyString_AsString(
+			                   pyscca_file->filename_object );
+#endif
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libscca_file_open(
+			          file,
+			          filename_narrow,
+			          access_flags,
+			          &error );
+
+			Py_END_ALLOW_THREADS
 		}
-		Py_IncRef(
-		 Py_None );
+	}
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open file.",
+		 function );
 
-		return( Py_None );
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
 	}
-	PyErr_Clear();
+	return( 1 );
+}
 
-#if PY_MAJOR_VERSION >= 3
-	result = PyObject_IsInstance(
-	          string_object,
-	          (PyObject *) &PyBytes_Type );
-#else
-	result = PyObject_IsInstance(
-	          string_object,
-	          (PyObject *) &PyString_Type );
-#endif
-	if( result == -1 )
+/* Reads the sections that were skipped on open
+ * The file is opened a second time without skipping sections, the file that
+ * was opened first is kept until the file is closed since objects that were
+ * retrieved from it reference its data
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_file_read_skipped_sections(
+     pyscca_file_t *pyscca_file,
+     int section_flags )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	static char *function    = "pyscca_file_read_skipped_sections";
+	int access_flags         = 0;
+
+	if( pyscca_file == NULL )
 	{
-		pyscca_error_fetch_and_raise(
-		 PyExc_RuntimeError,
-		 "%s: unable to determine if string object is of type string.",
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
 		 function );
 
-		return( NULL );
+		return( -1 );
 	}
-	else if( result != 0 )
+	pyscca_file_lock(
+	 pyscca_file );
+
+	if( ( pyscca_file->access_flags & section_flags ) == 0 )
 	{
-		PyErr_Clear();
+		pyscca_file_unlock(
+		 pyscca_file );
 
-#if PY_MAJOR_VERSION >= 3
-		filename_narrow = PyBytes_AsString(
-		                   string_object );
-#else
-		filename_narrow = PyString_AsString(
-		                   string_object );
-#endif
-		Py_BEGIN_ALLOW_THREADS
+		return( 1 );
+	}
+	if( pyscca_file->header_file != NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid file - header file already set.",
+		 function );
 
-		result = libscca_file_open(
-		          pyscca_file->file,
-		          filename_narrow,
-		          LIBSCCA_OPEN_READ,
-		          &error );
+		goto on_error;
+	}
+	/* All skipped sections are read at once so that the file is opened a second time at most
+	 */
+	access_flags = pyscca_file->access_flags & ~( LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES | LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES );
 
-		Py_END_ALLOW_THREADS
+	if( libscca_file_initialize(
+	     &file,
+	     &error ) != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to initialize file.",
+		 function );
 
-		if( result != 1 )
-		{
-			pyscca_error_raise(
-			 error,
-			 PyExc_IOError,
-			 "%s: unable to open file.",
-			 function );
+		libcerror_error_free(
+		 &error );
 
-			libcerror_error_free(
-			 &error );
+		goto on_error;
+	}
+	if( pyscca_file_open_source(
+	     pyscca_file,
+	     file,
+	     access_flags ) != 1 )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
 
-			return( NULL );
-		}
-		Py_IncRef(
-		 Py_None );
+		goto on_error;
+	}
+	/* The filenames are converted again from the file that contains them
+	 */
+	if( pyscca_file->filenames_object != NULL )
+	{
+		Py_DecRef(
+		 pyscca_file->filenames_object );
 
-		return( Py_None );
+		pyscca_file->filenames_object = NULL;
 	}
-	PyErr_Format(
-	 PyExc_TypeError,
-	 "%s: unsupported string object type.",
-	 function );
+	pyscca_file->header_file  = pyscca_file->file;
+	pyscca_file->file         = file;
+	pyscca_file->access_flags = access_flags;
 
-	return( NULL );
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( 1 );
+
+on_error:
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( -1 );
 }
 
 /* Opens a file using a file-like object
@@ -703,10 +1559,14 @@ PyObject *pyscca_file_open_file_object(
            PyObject *keywords )
 {
 	PyObject *file_object       = NULL;
+	PyObject *sections_object   = NULL;
 	libcerror_error_t *error    = NULL;
 	static char *function       = "pyscca_file_open_file_object";
-	static char *keyword_list[] = { "file_object", "mode", NULL };
+	static char *keyword_list[] = { "file_object", "mode", "read_ahead_size", "flags", "sections", NULL };
 	char *mode                  = NULL;
+	Py_ssize_t read_ahead_size  = PYSCCA_FILE_OBJECT_DEFAULT_READ_AHEAD_SIZE;
+	int access_flags            = 0;
+	int flags                   = LIBSCCA_OPEN_READ;
 	int result                  = 0;
 
 	if( pyscca_file == NULL )
@@ -721,10 +1581,13 @@ PyObject *pyscca_file_open_file_object(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "O|s",
+	     "O|sniO",
 	     keyword_list,
 	     &file_object,
-	     &mode ) == 0 )
+	     &mode,
+	     &read_ahead_size,
+	     &flags,
+	     &sections_object ) == 0 )
 	{
 		return( NULL );
 	}
@@ -739,6 +1602,22 @@ PyObject *pyscca_file_open_file_object(
 
 		return( NULL );
 	}
+	if( read_ahead_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid read ahead size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_get_access_flags(
+	     flags,
+	     sections_object,
+	     &access_flags ) != 1 )
+	{
+		return( NULL );
+	}
 	PyErr_Clear();
 
 	result = PyObject_HasAttrString(
@@ -769,19 +1648,25 @@ PyObject *pyscca_file_open_file_object(
 
 		return( NULL );
 	}
+	pyscca_file_lock(
+	 pyscca_file );
+
 	if( pyscca_file->file_io_handle != NULL )
 	{
-		pyscca_error_raise(
-		 error,
+		PyErr_Format(
 		 PyExc_IOError,
 		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		goto on_error;
+		pyscca_file_unlock(
+		 pyscca_file );
+
+		return( NULL );
 	}
 	if( pyscca_file_object_initialize(
 	     &( pyscca_file->file_io_handle ),
 	     file_object,
+	     (size_t) read_ahead_size,
 	     &error ) != 1 )
 	{
 		pyscca_error_raise(
@@ -795,56 +1680,2756 @@ PyObject *pyscca_file_open_file_object(
 
 		goto on_error;
 	}
-	Py_BEGIN_ALLOW_THREADS
+	if( ( pyscca_file_initialize_file(
+	       pyscca_file ) != 1 )
+	 || ( pyscca_file_open_source(
+	       pyscca_file,
+	       pyscca_file->file,
+	       access_flags ) != 1 ) )
+	{
+		goto on_error;
+	}
+	pyscca_file->access_flags = access_flags;
 
-	result = libscca_file_open_file_io_handle(
-	          pyscca_file->file,
-	          pyscca_file->file_io_handle,
-	          LIBSCCA_OPEN_READ,
-	          &error );
+	pyscca_file_unlock(
+	 pyscca_file );
 
-	Py_END_ALLOW_THREADS
+	Py_IncRef(
+	 Py_None );
 
-	if( result != 1 )
-	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to open file.",
-		 function );
+	return( Py_None );
 
-		libcerror_error_free(
-		 &error );
+on_error:
+	if( pyscca_file->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( pyscca_file->file_io_handle ),
+		 NULL );
+	}
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( NULL );
+}
+
+/* Opens a file from an object that supports the buffer protocol
+ * The data is not copied, the buffer is held until the file is closed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_open_bytes(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *buffer_object     = NULL;
+	PyObject *sections_object   = NULL;
+	static char *function       = "pyscca_file_open_bytes";
+	static char *keyword_list[] = { "buffer", "mode", "flags", "sections", NULL };
+	char *mode                  = NULL;
+	int access_flags            = 0;
+	int flags                   = LIBSCCA_OPEN_READ;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|siO",
+	     keyword_list,
+	     &buffer_object,
+	     &mode,
+	     &flags,
+	     &sections_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( mode != NULL )
+	 && ( mode[ 0 ] != 'r' ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported mode: %s.",
+		 function,
+		 mode );
+
+		return( NULL );
+	}
+	if( pyscca_file_get_access_flags(
+	     flags,
+	     sections_object,
+	     &access_flags ) != 1 )
+	{
+		return( NULL );
+	}
+	pyscca_file_lock(
+	 pyscca_file );
+
+	if( pyscca_file->buffer_is_set != 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid file - buffer already set.",
+		 function );
+
+		goto on_error;
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &( pyscca_file->buffer ),
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		goto on_error;
+	}
+	pyscca_file->buffer_is_set = 1;
+
+	if( ( pyscca_file_initialize_file(
+	       pyscca_file ) != 1 )
+	 || ( pyscca_file_open_source(
+	       pyscca_file,
+	       pyscca_file->file,
+	       access_flags ) != 1 ) )
+	{
+		PyBuffer_Release(
+		 &( pyscca_file->buffer ) );
+
+		pyscca_file->buffer_is_set = 0;
+
+		goto on_error;
+	}
+	pyscca_file->access_flags = access_flags;
+
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( NULL );
+}
+
+/* Opens a file from snapshot data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_open_snapshot(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *buffer_object     = NULL;
+	PyObject *sections_object   = NULL;
+	static char *function       = "pyscca_file_open_snapshot";
+	static char *keyword_list[] = { "buffer", "flags", "sections", NULL };
+	int access_flags            = 0;
+	int flags                   = LIBSCCA_OPEN_READ;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|iO",
+	     keyword_list,
+	     &buffer_object,
+	     &flags,
+	     &sections_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_get_access_flags(
+	     flags,
+	     sections_object,
+	     &access_flags ) != 1 )
+	{
+		return( NULL );
+	}
+	pyscca_file_lock(
+	 pyscca_file );
+
+	if( pyscca_file->buffer_is_set != 0 )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid file - buffer already set.",
+		 function );
+
+		goto on_error;
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &( pyscca_file->buffer ),
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		goto on_error;
+	}
+	pyscca_file->buffer_is_set      = 1;
+	pyscca_file->buffer_is_snapshot = 1;
+
+	if( ( pyscca_file_initialize_file(
+	       pyscca_file ) != 1 )
+	 || ( pyscca_file_open_source(
+	       pyscca_file,
+	       pyscca_file->file,
+	       access_flags ) != 1 ) )
+	{
+		PyBuffer_Release(
+		 &( pyscca_file->buffer ) );
+
+		pyscca_file->buffer_is_set      = 0;
+		pyscca_file->buffer_is_snapshot = 0;
 
 		goto on_error;
 	}
+	pyscca_file->access_flags = access_flags;
+
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( NULL );
+}
+
+/* Closes a file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_close(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_close";
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	pyscca_file_lock(
+	 pyscca_file );
+
+	/* A file opened using a parse cache is shared, hence it is released instead of closed,
+	 * a new libscca file is created when the file object is opened again
+	 */
+	if( pyscca_file->parse_cache_object != NULL )
+	{
+		if( pyscca_parse_cache_release_file(
+		     (pyscca_parse_cache_t *) pyscca_file->parse_cache_object,
+		     &( pyscca_file->file ) ) != 1 )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 pyscca_file->parse_cache_object );
+
+		pyscca_file->parse_cache_object = NULL;
+	}
+	else
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_close(
+		          pyscca_file->file,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 0 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to close file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	/* The header file is freed before the file IO handle since it can reference it
+	 */
+	if( pyscca_file->header_file != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_free(
+		          &( pyscca_file->header_file ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libscca header file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	if( pyscca_file->file_io_handle != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libbfio_handle_free(
+		          &( pyscca_file->file_io_handle ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to free libbfio file IO handle.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	if( pyscca_file->filenames_object != NULL )
+	{
+		Py_DecRef(
+		 pyscca_file->filenames_object );
+
+		pyscca_file->filenames_object = NULL;
+	}
+	if( pyscca_file->filename_object != NULL )
+	{
+		Py_DecRef(
+		 pyscca_file->filename_object );
+
+		pyscca_file->filename_object = NULL;
+	}
+	if( pyscca_file->buffer_is_set != 0 )
+	{
+		PyBuffer_Release(
+		 &( pyscca_file->buffer ) );
+
+		pyscca_file->buffer_is_set      = 0;
+		pyscca_file->buffer_is_snapshot = 0;
+	}
+	pyscca_file->access_flags = 0;
+
+	pyscca_file_unlock(
+	 pyscca_file );
+
 	Py_IncRef(
 	 Py_None );
 
-	return( Py_None );
+	return( Py_None );
+
+on_error:
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( NULL );
+}
+
+/* Retrieves the value to indicate timestamps are returned as integers
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_timestamps_as_integers(
+           pyscca_file_t *pyscca_file,
+           void *closure PYSCCA_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyscca_file_get_timestamps_as_integers";
+
+	PYSCCA_UNREFERENCED_PARAMETER( closure )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file->timestamps_as_integers != 0 )
+	{
+		Py_IncRef(
+		 Py_True );
+
+		return( Py_True );
+	}
+	Py_IncRef(
+	 Py_False );
+
+	return( Py_False );
+}
+
+/* Sets the value to indicate timestamps are returned as integers
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_set_timestamps_as_integers(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *value_object      = NULL;
+	static char *keyword_list[] = { "timestamps_as_integers", NULL };
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &value_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_set_timestamps_as_integers_setter(
+	     pyscca_file,
+	     value_object,
+	     NULL ) != 0 )
+	{
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets the value to indicate timestamps are returned as integers from a property
+ * Returns 0 if successful or -1 on error
+ */
+int pyscca_file_set_timestamps_as_integers_setter(
+     pyscca_file_t *pyscca_file,
+     PyObject *value_object,
+     void *closure PYSCCA_ATTRIBUTE_UNUSED )
+{
+	static char *function = "pyscca_file_set_timestamps_as_integers_setter";
+	int result            = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( closure )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unable to delete timestamps as integers.",
+		 function );
+
+		return( -1 );
+	}
+	result = PyObject_IsTrue(
+	          value_object );
+
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	pyscca_file->timestamps_as_integers = (uint8_t) result;
+
+	return( 0 );
+}
+
+/* Retrieves the format version
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_format_version(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_get_format_version";
+	uint32_t format_version  = 0;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_format_version(
+	          pyscca_file->file,
+	          &format_version,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = PyLong_FromUnsignedLong(
+	                  (unsigned long) format_version );
+
+	return( integer_object );
+}
+
+/* Retrieves the executable filename
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_executable_filename(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	const char *errors       = NULL;
+	static char *function    = "pyscca_file_get_executable_filename";
+	char *utf8_string        = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_utf8_executable_filename_size(
+	          pyscca_file->file,
+	          &utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine size of executable filename as UTF-8 string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	utf8_string = (char *) PyMem_Malloc(
+	                        sizeof( char ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_utf8_executable_filename(
+	          pyscca_file->file,
+	          (uint8_t *) utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve executable filename as UTF-8 string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 errors );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	return( string_object );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( NULL );
+}
+
+/* Retrieves the prefetch hash
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_prefetch_hash(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_get_prefetch_hash";
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_prefetch_hash(
+	          pyscca_file->file,
+	          &value_32bit,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	integer_object = PyLong_FromUnsignedLong(
+	                  (unsigned long) value_32bit );
+
+	return( integer_object );
+}
+
+/* Retrieves the last run date and time
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_last_run_time(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *date_time_object  = NULL;
+	static char *function       = "pyscca_file_get_last_run_time";
+	static char *keyword_list[] = { "last_run_time_index", NULL };
+	uint64_t filetime           = 0;
+	int last_run_time_index     = 0;
+	int result                  = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &last_run_time_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_last_run_time(
+	          pyscca_file->file,
+	          last_run_time_index,
+	          &filetime,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve last run time: %d.",
+		 function,
+		 last_run_time_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( pyscca_file->timestamps_as_integers != 0 )
+	{
+		date_time_object = pyscca_integer_unsigned_new_from_64bit(
+		                    filetime );
+	}
+	else
+	{
+		date_time_object = pyscca_datetime_new_from_filetime(
+		                    filetime );
+	}
+	return( date_time_object );
+}
+
+/* Retrieves the last run date and time as an integer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_last_run_time_as_integer(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	PyObject *integer_object    = NULL;
+	static char *function       = "pyscca_file_get_last_run_time_as_integer";
+	static char *keyword_list[] = { "last_run_time_index", NULL };
+	uint64_t filetime           = 0;
+	int last_run_time_index     = 0;
+	int result                  = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &last_run_time_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_last_run_time(
+	          pyscca_file->file,
+	          last_run_time_index,
+	          &filetime,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve last run time: %d.",
+		 function,
+		 last_run_time_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	integer_object = pyscca_integer_unsigned_new_from_64bit(
+	                  (uint64_t) filetime );
+
+	return( integer_object );
+}
+
+/* Retrieves all last run times that are set
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_last_run_times(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	PyObject *as_integers_object   = NULL;
+	PyObject *as_posix_time_object = NULL;
+	libcerror_error_t *error       = NULL;
+	static char *function          = "pyscca_file_get_last_run_times";
+	static char *keyword_list[]    = { "as_integers", "as_posix_time", NULL };
+	int as_integers                = 0;
+	int as_posix_time              = 0;
+	int number_of_filetimes        = 0;
+	int result                     = 0;
+	int timestamp_format           = PYSCCA_TIMESTAMP_FORMAT_DATETIME;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|OO",
+	     keyword_list,
+	     &as_integers_object,
+	     &as_posix_time_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( as_integers_object == NULL )
+	 || ( as_integers_object == Py_None ) )
+	{
+		as_integers = (int) pyscca_file->timestamps_as_integers;
+	}
+	else
+	{
+		as_integers = PyObject_IsTrue(
+		               as_integers_object );
+
+		if( as_integers == -1 )
+		{
+			return( NULL );
+		}
+	}
+	if( as_posix_time_object != NULL )
+	{
+		as_posix_time = PyObject_IsTrue(
+		                 as_posix_time_object );
+
+		if( as_posix_time == -1 )
+		{
+			return( NULL );
+		}
+	}
+	if( as_posix_time != 0 )
+	{
+		timestamp_format = PYSCCA_TIMESTAMP_FORMAT_POSIX_TIME_IN_MICRO_SECONDS;
+	}
+	else if( as_integers != 0 )
+	{
+		timestamp_format = PYSCCA_TIMESTAMP_FORMAT_FILETIME;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_last_run_times(
+	          pyscca_file->file,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pyscca_datetime_new_list_from_filetimes(
+	         filetimes,
+	         number_of_filetimes,
+	         timestamp_format ) );
+}
+
+/* Retrieves all last run times that are set as an array of 64-bit FILETIME values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_last_run_times_array(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	PyObject *array_object   = NULL;
+	PyObject *buffer_object  = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_get_last_run_times_array";
+	uint8_t *values_data     = NULL;
+	int number_of_filetimes  = 0;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_last_run_times(
+	          pyscca_file->file,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	buffer_object = pyscca_array_buffer_new(
+	                 PYSCCA_ARRAY_VALUE_TYPE_UINT64,
+	                 (Py_ssize_t) number_of_filetimes,
+	                 &values_data );
+
+	if( buffer_object == NULL )
+	{
+		return( NULL );
+	}
+	if( number_of_filetimes > 0 )
+	{
+		memory_copy(
+		 values_data,
+		 filetimes,
+		 sizeof( uint64_t ) * number_of_filetimes );
+	}
+	array_object = pyscca_array_new_from_buffer(
+	                buffer_object,
+	                PYSCCA_ARRAY_VALUE_TYPE_UINT64 );
+
+	Py_DecRef(
+	 buffer_object );
+
+	return( array_object );
+}
+
+/* Retrieves the run count
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_run_count(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_get_run_count";
+	uint32_t value_32bit     = 0;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_run_count(
+	          pyscca_file->file,
+	          &value_32bit,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	integer_object = PyLong_FromUnsignedLong(
+	                  (unsigned long) value_32bit );
+
+	return( integer_object );
+}
+
+/* Retrieves the number of file metrics entries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_number_of_file_metrics_entries(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object           = NULL;
+	libcerror_error_t *error           = NULL;
+	static char *function              = "pyscca_file_get_number_of_file_metrics_entries";
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          pyscca_file->file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_file_metrics_entries );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_file_metrics_entries );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific file metrics entry by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_entry_by_index(
+           PyObject *pyscca_file,
+           int entry_index )
+{
+	PyObject *file_metrics_entry_object        = NULL;
+	libcerror_error_t *error                   = NULL;
+	libscca_file_metrics_t *file_metrics_entry = NULL;
+	static char *function                      = "pyscca_file_get_file_metrics_entry_by_index";
+	int result                                 = 0;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     (pyscca_file_t *) pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_file_metrics_entry(
+	          ( (pyscca_file_t *) pyscca_file )->file,
+	          entry_index,
+	          &file_metrics_entry,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file metrics entry: %d.",
+		 function,
+		 entry_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	file_metrics_entry_object = pyscca_file_metrics_new(
+	                             file_metrics_entry,
+	                             (PyObject *) pyscca_file );
+
+	if( file_metrics_entry_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file metrics object.",
+		 function );
+
+		goto on_error;
+	}
+	return( file_metrics_entry_object );
+
+on_error:
+	if( file_metrics_entry != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics_entry,
+		 NULL );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific file metrics entry
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_entry(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *file_metrics_entry_object = NULL;
+	static char *keyword_list[]         = { "entry_index", NULL };
+	int entry_index        = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &entry_index ) == 0 )
+	{
+		return( NULL );
+	}
+	file_metrics_entry_object = pyscca_file_get_file_metrics_entry_by_index(
+	                             (PyObject *) pyscca_file,
+	                             entry_index );
+
+	return( file_metrics_entry_object );
+}
+
+/* Retrieves a sequence and iterator object for the file metrics entries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_entries(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object          = NULL;
+	libcerror_error_t *error           = NULL;
+	static char *function              = "pyscca_file_get_file_metrics_entries";
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          pyscca_file->file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyscca_file_metrics_entries_new(
+	                   (PyObject *) pyscca_file,
+	                   &pyscca_file_get_file_metrics_entry_by_index,
+	                   number_of_file_metrics_entries );
+
+	if( sequence_object == NULL )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
+
+/* Retrieves the values of all file metrics entries
+ * The values are read in bulk and the filename strings are shared between
+ * the entries, hence no file metrics object is created per entry
+ * The values are returned as a list of tuples, a list of records or
+ * a dictionary of parallel lists, depending on the values format
+ * If raw names is set the filenames are bytes objects with the UTF-16 little-endian streams
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_values(
+           pyscca_file_t *pyscca_file,
+           int values_format,
+           int raw_names )
+{
+	PyObject *column_objects[ 5 ]      = { NULL, NULL, NULL, NULL, NULL };
+	PyObject *filename_object          = NULL;
+	PyObject *filenames_object         = NULL;
+	PyObject *list_object              = NULL;
+	PyObject *table_object             = NULL;
+	PyObject *tuple_object             = NULL;
+	libcerror_error_t *error           = NULL;
+	static char *column_names[ 5 ]     = { "start_time", "duration", "flags", "file_reference", "filename" };
+	static char *function              = "pyscca_file_get_file_metrics_values";
+	uint64_t *file_references          = NULL;
+	uint32_t *durations                = NULL;
+	uint32_t *flags                    = NULL;
+	uint32_t *start_times              = NULL;
+	int *filename_indexes              = NULL;
+	int column_index                   = 0;
+	int columnar                       = 0;
+	int entry_index                    = 0;
+	int filename_index                 = 0;
+	int number_of_file_metrics_entries = 0;
+	int number_of_filenames            = 0;
+	int result                         = 0;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( values_format != PYSCCA_FILE_METRICS_VALUES_FORMAT_TUPLES )
+	 && ( values_format != PYSCCA_FILE_METRICS_VALUES_FORMAT_RECORDS )
+	 && ( values_format != PYSCCA_FILE_METRICS_VALUES_FORMAT_COLUMNS ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported values format.",
+		 function );
+
+		return( NULL );
+	}
+	if( values_format == PYSCCA_FILE_METRICS_VALUES_FORMAT_COLUMNS )
+	{
+		columnar = 1;
+	}
+	else if( values_format == PYSCCA_FILE_METRICS_VALUES_FORMAT_RECORDS )
+	{
+		if( pyscca_type_objects_ready() != 1 )
+		{
+			return( NULL );
+		}
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          pyscca_file->file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libscca_file_get_number_of_filenames(
+		          pyscca_file->file,
+		          &number_of_filenames,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file metrics entries or filenames.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( number_of_file_metrics_entries == 0 )
+	{
+		number_of_filenames = 0;
+	}
+	else
+	{
+		start_times = (uint32_t *) PyMem_Malloc(
+		                            sizeof( uint32_t ) * number_of_file_metrics_entries );
+
+		durations = (uint32_t *) PyMem_Malloc(
+		                          sizeof( uint32_t ) * number_of_file_metrics_entries );
+
+		flags = (uint32_t *) PyMem_Malloc(
+		                      sizeof( uint32_t ) * number_of_file_metrics_entries );
+
+		file_references = (uint64_t *) PyMem_Malloc(
+		                                sizeof( uint64_t ) * number_of_file_metrics_entries );
+
+		filename_indexes = (int *) PyMem_Malloc(
+		                            sizeof( int ) * number_of_file_metrics_entries );
+
+		if( ( start_times == NULL )
+		 || ( durations == NULL )
+		 || ( flags == NULL )
+		 || ( file_references == NULL )
+		 || ( filename_indexes == NULL ) )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create file metrics columns.",
+			 function );
+
+			goto on_error;
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_get_file_metrics_table(
+		          pyscca_file->file,
+		          start_times,
+		          durations,
+		          flags,
+		          file_references,
+		          filename_indexes,
+		          number_of_file_metrics_entries,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve file metrics table.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	if( ( number_of_filenames > 0 )
+	 && ( raw_names != 0 ) )
+	{
+		filenames_object = pyscca_file_get_raw_filenames(
+		                    pyscca_file );
+
+		if( filenames_object == NULL )
+		{
+			goto on_error;
+		}
+		number_of_filenames = (int) PyTuple_Size(
+		                             filenames_object );
+	}
+	else if( number_of_filenames > 0 )
+	{
+		filenames_object = pyscca_file_get_cached_filenames(
+		                    pyscca_file );
+
+		if( filenames_object == NULL )
+		{
+			goto on_error;
+		}
+		number_of_filenames = (int) PyTuple_Size(
+		                             filenames_object );
+	}
+	if( columnar != 0 )
+	{
+		/* In columnar mode every column is a list with one value per entry
+		 */
+		for( column_index = 0;
+		     column_index < 5;
+		     column_index++ )
+		{
+			column_objects[ column_index ] = PyList_New(
+			                                  (Py_ssize_t) number_of_file_metrics_entries );
+
+			if( column_objects[ column_index ] == NULL )
+			{
+				PyErr_Format(
+				 PyExc_MemoryError,
+				 "%s: unable to create column: %s list object.",
+				 function,
+				 column_names[ column_index ] );
+
+				goto on_error;
+			}
+		}
+	}
+	else
+	{
+		list_object = PyList_New(
+		               (Py_ssize_t) number_of_file_metrics_entries );
+
+		if( list_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create list object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_file_metrics_entries;
+	     entry_index++ )
+	{
+		filename_index = filename_indexes[ entry_index ];
+
+		if( ( filename_index >= 0 )
+		 && ( filename_index < number_of_filenames ) )
+		{
+			filename_object = PyTuple_GetItem(
+			                   filenames_object,
+			                   (Py_ssize_t) filename_index );
+		}
+		else
+		{
+			filename_object = Py_None;
+		}
+		Py_IncRef(
+		 filename_object );
+
+		if( columnar != 0 )
+		{
+			/* PyList_SetItem steals the references to the item objects
+			 */
+			PyList_SetItem(
+			 column_objects[ 0 ],
+			 (Py_ssize_t) entry_index,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  (uint64_t) start_times[ entry_index ] ) );
+
+			PyList_SetItem(
+			 column_objects[ 1 ],
+			 (Py_ssize_t) entry_index,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  (uint64_t) durations[ entry_index ] ) );
+
+			PyList_SetItem(
+			 column_objects[ 2 ],
+			 (Py_ssize_t) entry_index,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  (uint64_t) flags[ entry_index ] ) );
+
+			PyList_SetItem(
+			 column_objects[ 3 ],
+			 (Py_ssize_t) entry_index,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  file_references[ entry_index ] ) );
+
+			PyList_SetItem(
+			 column_objects[ 4 ],
+			 (Py_ssize_t) entry_index,
+			 filename_object );
+		}
+		else
+		{
+			/* A record is a tuple subclass, hence it is filled in the same way as a tuple
+			 */
+			if( values_format == PYSCCA_FILE_METRICS_VALUES_FORMAT_RECORDS )
+			{
+				tuple_object = PyStructSequence_New(
+				                &pyscca_file_metrics_record_type_object );
+			}
+			else
+			{
+				tuple_object = PyTuple_New(
+				                5 );
+			}
+			if( tuple_object == NULL )
+			{
+				PyErr_Format(
+				 PyExc_MemoryError,
+				 "%s: unable to create tuple object.",
+				 function );
+
+				Py_DecRef(
+				 filename_object );
+
+				goto on_error;
+			}
+			/* PyList_SetItem steals the reference to the tuple object
+			 */
+			PyList_SetItem(
+			 list_object,
+			 (Py_ssize_t) entry_index,
+			 tuple_object );
+
+			/* PyTuple_SetItem steals the references to the item objects
+			 */
+			PyTuple_SetItem(
+			 tuple_object,
+			 0,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  (uint64_t) start_times[ entry_index ] ) );
+
+			PyTuple_SetItem(
+			 tuple_object,
+			 1,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  (uint64_t) durations[ entry_index ] ) );
+
+			PyTuple_SetItem(
+			 tuple_object,
+			 2,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  (uint64_t) flags[ entry_index ] ) );
+
+			PyTuple_SetItem(
+			 tuple_object,
+			 3,
+			 pyscca_integer_unsigned_new_from_64bit(
+			  file_references[ entry_index ] ) );
+
+			PyTuple_SetItem(
+			 tuple_object,
+			 4,
+			 filename_object );
+		}
+		if( PyErr_Occurred() != NULL )
+		{
+			goto on_error;
+		}
+	}
+	if( columnar != 0 )
+	{
+		list_object = PyDict_New();
+
+		if( list_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create dictionary object.",
+			 function );
+
+			goto on_error;
+		}
+		for( column_index = 0;
+		     column_index < 5;
+		     column_index++ )
+		{
+			/* PyDict_SetItemString does not steal the reference to the column object
+			 */
+			if( PyDict_SetItemString(
+			     list_object,
+			     column_names[ column_index ],
+			     column_objects[ column_index ] ) != 0 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	table_object = list_object;
+	list_object  = NULL;
+
+	/* The column and filename buffers are released on success as well
+	 */
+on_error:
+	if( filenames_object != NULL )
+	{
+		Py_DecRef(
+		 filenames_object );
+	}
+	for( column_index = 0;
+	     column_index < 5;
+	     column_index++ )
+	{
+		if( column_objects[ column_index ] != NULL )
+		{
+			Py_DecRef(
+			 column_objects[ column_index ] );
+		}
+	}
+	if( filename_indexes != NULL )
+	{
+		PyMem_Free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		PyMem_Free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		PyMem_Free(
+		 flags );
+	}
+	if( durations != NULL )
+	{
+		PyMem_Free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		PyMem_Free(
+		 start_times );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	return( table_object );
+}
+
+/* Retrieves the values of all file metrics entries
+ * In columnar mode the values are returned as a dictionary of parallel lists
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_table(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *columnar_object   = NULL;
+	PyObject *raw_names_object  = NULL;
+	static char *keyword_list[] = { "columnar", "raw_names", NULL };
+	int columnar                = 0;
+	int raw_names               = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|OO",
+	     keyword_list,
+	     &columnar_object,
+	     &raw_names_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( columnar_object != NULL )
+	{
+		columnar = PyObject_IsTrue(
+		            columnar_object );
+
+		if( columnar == -1 )
+		{
+			return( NULL );
+		}
+	}
+	if( raw_names_object != NULL )
+	{
+		raw_names = PyObject_IsTrue(
+		             raw_names_object );
+
+		if( raw_names == -1 )
+		{
+			return( NULL );
+		}
+	}
+	if( columnar != 0 )
+	{
+		return( pyscca_file_get_file_metrics_values(
+		         pyscca_file,
+		         PYSCCA_FILE_METRICS_VALUES_FORMAT_COLUMNS,
+		         raw_names ) );
+	}
+	return( pyscca_file_get_file_metrics_values(
+	         pyscca_file,
+	         PYSCCA_FILE_METRICS_VALUES_FORMAT_TUPLES,
+	         raw_names ) );
+}
+
+/* Retrieves the values of all file metrics entries as records
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_records(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	return( pyscca_file_get_file_metrics_values(
+	         pyscca_file,
+	         PYSCCA_FILE_METRICS_VALUES_FORMAT_RECORDS,
+	         0 ) );
+}
+
+/* Retrieves the values of all file metrics entries as arrays
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_file_metrics_arrays(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *buffer_objects[ 5 ]      = { NULL, NULL, NULL, NULL, NULL };
+	uint8_t *values_data[ 5 ]          = { NULL, NULL, NULL, NULL, NULL };
+	PyObject *array_object             = NULL;
+	PyObject *dictionary_object        = NULL;
+	libcerror_error_t *error           = NULL;
+	static char *column_names[ 5 ]     = { "start_time", "duration", "flags", "file_reference", "filename_index" };
+	static char *function              = "pyscca_file_get_file_metrics_arrays";
+	static int value_types[ 5 ]        = {
+		PYSCCA_ARRAY_VALUE_TYPE_UINT32,
+		PYSCCA_ARRAY_VALUE_TYPE_UINT32,
+		PYSCCA_ARRAY_VALUE_TYPE_UINT32,
+		PYSCCA_ARRAY_VALUE_TYPE_UINT64,
+		PYSCCA_ARRAY_VALUE_TYPE_INT };
+	int column_index                   = 0;
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          pyscca_file->file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* The values are copied directly into the storage of the arrays
+	 */
+	for( column_index = 0;
+	     column_index < 5;
+	     column_index++ )
+	{
+		buffer_objects[ column_index ] = pyscca_array_buffer_new(
+		                                  value_types[ column_index ],
+		                                  (Py_ssize_t) number_of_file_metrics_entries,
+		                                  &( values_data[ column_index ] ) );
+
+		if( buffer_objects[ column_index ] == NULL )
+		{
+			goto on_error;
+		}
+	}
+	if( number_of_file_metrics_entries > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_get_file_metrics_table(
+		          pyscca_file->file,
+		          (uint32_t *) values_data[ 0 ],
+		          (uint32_t *) values_data[ 1 ],
+		          (uint32_t *) values_data[ 2 ],
+		          (uint64_t *) values_data[ 3 ],
+		          (int *) values_data[ 4 ],
+		          number_of_file_metrics_entries,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve file metrics table.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < 5;
+	     column_index++ )
+	{
+		array_object = pyscca_array_new_from_buffer(
+		                buffer_objects[ column_index ],
+		                value_types[ column_index ] );
+
+		if( array_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyDict_SetItemString does not steal the reference to the item object
+		 */
+		result = PyDict_SetItemString(
+		          dictionary_object,
+		          column_names[ column_index ],
+		          array_object );
+
+		Py_DecRef(
+		 array_object );
+
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 buffer_objects[ column_index ] );
+
+		buffer_objects[ column_index ] = NULL;
+	}
+	return( dictionary_object );
+
+on_error:
+	if( dictionary_object != NULL )
+	{
+		Py_DecRef(
+		 dictionary_object );
+	}
+	for( column_index = 0;
+	     column_index < 5;
+	     column_index++ )
+	{
+		if( buffer_objects[ column_index ] != NULL )
+		{
+			Py_DecRef(
+			 buffer_objects[ column_index ] );
+		}
+	}
+	return( NULL );
+}
+
+/* Retrieves the total block load counts of all trace chain entries as an array
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_trace_chain_load_counts_array(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *array_object            = NULL;
+	PyObject *buffer_object           = NULL;
+	libcerror_error_t *error          = NULL;
+	static char *function             = "pyscca_file_get_trace_chain_load_counts_array";
+	uint8_t *values_data              = NULL;
+	int number_of_trace_chain_entries = 0;
+	int result                        = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_trace_chain_entries(
+	          pyscca_file->file,
+	          &number_of_trace_chain_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of trace chain entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	buffer_object = pyscca_array_buffer_new(
+	                 PYSCCA_ARRAY_VALUE_TYPE_UINT32,
+	                 (Py_ssize_t) number_of_trace_chain_entries,
+	                 &values_data );
+
+	if( buffer_object == NULL )
+	{
+		return( NULL );
+	}
+	if( number_of_trace_chain_entries > 0 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_copy_trace_chain_load_counts(
+		          pyscca_file->file,
+		          (uint32_t *) values_data,
+		          number_of_trace_chain_entries,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve trace chain load counts.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			Py_DecRef(
+			 buffer_object );
+
+			return( NULL );
+		}
+	}
+	array_object = pyscca_array_new_from_buffer(
+	                buffer_object,
+	                PYSCCA_ARRAY_VALUE_TYPE_UINT32 );
+
+	Py_DecRef(
+	 buffer_object );
+
+	return( array_object );
+}
+
+
+/* Retrieves the number of filenames
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_number_of_filenames(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_file_get_number_of_filenames";
+	int number_of_filenames  = 0;
+	int result               = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_filenames(
+	          pyscca_file->file,
+	          &number_of_filenames,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_filenames );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_filenames );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves the filenames as a tuple of strings
+ * The filenames are converted in a single pass on first access and the tuple
+ * is cached by the file until it is closed
+ * Returns a new reference to the tuple if successful or NULL on error
+ */
+PyObject *pyscca_file_get_cached_filenames(
+           pyscca_file_t *pyscca_file )
+{
+	PyObject *string_object     = NULL;
+	PyObject *tuple_object      = NULL;
+	libcerror_error_t *error    = NULL;
+	const char *errors          = NULL;
+	static char *function       = "pyscca_file_get_cached_filenames";
+	size_t *utf8_string_offsets = NULL;
+	size_t utf8_string_size     = 0;
+	size_t utf8_strings_size    = 0;
+	uint8_t *utf8_strings       = NULL;
+	int filename_index          = 0;
+	int number_of_filenames     = 0;
+	int result                  = 0;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	pyscca_file_lock(
+	 pyscca_file );
+
+	tuple_object = pyscca_file->filenames_object;
+
+	if( tuple_object != NULL )
+	{
+		Py_IncRef(
+		 tuple_object );
+	}
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	if( tuple_object != NULL )
+	{
+		return( tuple_object );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_filenames(
+	          pyscca_file->file,
+	          &number_of_filenames,
+	          &error );
+
+	if( ( result == 1 )
+	 && ( number_of_filenames > 0 ) )
+	{
+		result = libscca_file_get_utf8_filenames_table_size(
+		          pyscca_file->file,
+		          &utf8_strings_size,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of filenames or filenames table size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                (Py_ssize_t) number_of_filenames );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_filenames > 0 )
+	 && ( utf8_strings_size > 0 ) )
+	{
+		utf8_strings = (uint8_t *) PyMem_Malloc(
+		                            sizeof( uint8_t ) * utf8_strings_size );
+
+		utf8_string_offsets = (size_t *) PyMem_Malloc(
+		                                  sizeof( size_t ) * number_of_filenames );
+
+		if( ( utf8_strings == NULL )
+		 || ( utf8_string_offsets == NULL ) )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_file_get_utf8_filenames_table(
+		          pyscca_file->file,
+		          utf8_strings,
+		          utf8_strings_size,
+		          utf8_string_offsets,
+		          number_of_filenames,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve filenames table.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( utf8_strings == NULL )
+		{
+			utf8_string_size = 0;
+		}
+		else if( ( filename_index + 1 ) < number_of_filenames )
+		{
+			utf8_string_size = utf8_string_offsets[ filename_index + 1 ] - utf8_string_offsets[ filename_index ];
+		}
+		else
+		{
+			utf8_string_size = utf8_strings_size - utf8_string_offsets[ filename_index ];
+		}
+		if( utf8_string_size == 0 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			string_object = Py_None;
+		}
+		else
+		{
+			/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+			 * the end of string character is part of the string
+			 */
+			string_object = PyUnicode_DecodeUTF8(
+			                 (char *) &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+			                 (Py_ssize_t) utf8_string_size - 1,
+			                 errors );
+
+			if( string_object == NULL )
+			{
+				PyErr_Format(
+				 PyExc_IOError,
+				 "%s: unable to convert UTF-8 string into Unicode object.",
+				 function );
+
+				goto on_error;
+			}
+#if PY_MAJOR_VERSION >= 3
+			/* The same filenames recur across prefetch files, hence the strings are interned
+			 */
+			PyUnicode_InternInPlace(
+			 &string_object );
+#endif
+		}
+		/* PyTuple_SetItem steals the reference to the string object
+		 */
+		PyTuple_SetItem(
+		 tuple_object,
+		 (Py_ssize_t) filename_index,
+		 string_object );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		PyMem_Free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		PyMem_Free(
+		 utf8_strings );
+	}
+	/* Another thread can have converted the filenames in the meantime,
+	 * in which case its tuple is returned so that all callers share the same tuple
+	 */
+	pyscca_file_lock(
+	 pyscca_file );
+
+	if( pyscca_file->filenames_object == NULL )
+	{
+		Py_IncRef(
+		 tuple_object );
+
+		pyscca_file->filenames_object = tuple_object;
+	}
+	else
+	{
+		Py_DecRef(
+		 tuple_object );
+
+		tuple_object = pyscca_file->filenames_object;
+
+		Py_IncRef(
+		 tuple_object );
+	}
+	pyscca_file_unlock(
+	 pyscca_file );
+
+	return( tuple_object );
+
+on_error:
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 tuple_object );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		PyMem_Free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		PyMem_Free(
+		 utf8_strings );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific filename by index
+ * The filename is retrieved from the filenames cached by the file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_filename_by_index(
+           PyObject *pyscca_file,
+           int filename_index )
+{
+	PyObject *string_object    = NULL;
+	PyObject *filenames_object = NULL;
+	static char *function      = "pyscca_file_get_filename_by_index";
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     (pyscca_file_t *) pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	filenames_object = pyscca_file_get_cached_filenames(
+	                    (pyscca_file_t *) pyscca_file );
+
+	if( filenames_object == NULL )
+	{
+		return( NULL );
+	}
+	if( ( filename_index < 0 )
+	 || ( (Py_ssize_t) filename_index >= PyTuple_Size( filenames_object ) ) )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to retrieve filename: %d.",
+		 function,
+		 filename_index );
+
+		Py_DecRef(
+		 filenames_object );
+
+		return( NULL );
+	}
+	string_object = PyTuple_GetItem(
+	                 filenames_object,
+	                 (Py_ssize_t) filename_index );
+
+	Py_IncRef(
+	 string_object );
+
+	Py_DecRef(
+	 filenames_object );
+
+	return( string_object );
+}
+
+/* Retrieves a specific filename
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_filename(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object     = NULL;
+	static char *keyword_list[] = { "filename_index", NULL };
+	int filename_index          = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &filename_index ) == 0 )
+	{
+		return( NULL );
+	}
+	string_object = pyscca_file_get_filename_by_index(
+	                 (PyObject *) pyscca_file,
+	                 filename_index );
+
+	return( string_object );
+}
+
+/* Retrieves a sequence and iterator object for the filenames
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_filenames(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyscca_file_get_filenames";
+	int number_of_filenames   = 0;
+	int result                = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_filenames(
+	          pyscca_file->file,
+	          &number_of_filenames,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyscca_filenames_new(
+	                   (PyObject *) pyscca_file,
+	                   &pyscca_file_get_filename_by_index,
+	                   number_of_filenames );
+
+	if( sequence_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
+
+/* Retrieves the filenames as a tuple of bytes objects
+ * The bytes objects contain the UTF-16 little-endian streams as stored in the file,
+ * without the end-of-string character, hence no UTF-8 conversion is done
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_raw_filenames(
+           pyscca_file_t *pyscca_file )
+{
+	PyObject *bytes_object      = NULL;
+	PyObject *tuple_object      = NULL;
+	libcerror_error_t *error    = NULL;
+	const uint8_t *utf16_stream = NULL;
+	static char *function       = "pyscca_file_get_raw_filenames";
+	size_t utf16_stream_size    = 0;
+	int filename_index          = 0;
+	int number_of_filenames     = 0;
+	int result                  = 0;
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES ) != 1 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_filenames(
+	          pyscca_file->file,
+	          &number_of_filenames,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	tuple_object = PyTuple_New(
+	                (Py_ssize_t) number_of_filenames );
+
+	if( tuple_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create tuple object.",
+		 function );
+
+		return( NULL );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		/* The stream references the filename strings of the file, hence no memory is allocated
+		 */
+		if( libscca_file_get_utf16_filename_stream(
+		     pyscca_file->file,
+		     filename_index,
+		     &utf16_stream,
+		     &utf16_stream_size,
+		     &error ) != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve filename: %d UTF-16 stream.",
+			 function,
+			 filename_index );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		if( ( utf16_stream_size >= 2 )
+		 && ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+		 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+		{
+			utf16_stream_size -= 2;
+		}
+		if( utf16_stream_size == 0 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			bytes_object = Py_None;
+		}
+		else
+		{
+#if PY_MAJOR_VERSION >= 3
+			bytes_object = PyBytes_FromStringAndSize(
+			                (char *) utf16_stream,
+			                (Py_ssize_t) utf16_stream_size );
+#else
+			bytes_object = PyString_FromStringAndSize(
+			                (char *) utf16_stream,
+			                (Py_ssize_t) utf16_stream_size );
+#endif
+			if( bytes_object == NULL )
+			{
+				PyErr_Format(
+				 PyExc_MemoryError,
+				 "%s: unable to create bytes object.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* PyTuple_SetItem steals the reference to the bytes object
+		 */
+		PyTuple_SetItem(
+		 tuple_object,
+		 (Py_ssize_t) filename_index,
+		 bytes_object );
+	}
+	return( tuple_object );
 
 on_error:
-	if( pyscca_file->file_io_handle != NULL )
+	if( tuple_object != NULL )
 	{
-		libbfio_handle_free(
-		 &( pyscca_file->file_io_handle ),
-		 NULL );
+		Py_DecRef(
+		 tuple_object );
 	}
 	return( NULL );
 }
 
-/* Closes a file
+/* Retrieves the filenames as a tuple
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_close(
+PyObject *pyscca_file_get_filenames_tuple(
            pyscca_file_t *pyscca_file,
-           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+           PyObject *arguments,
+           PyObject *keywords )
 {
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_close";
-	int result               = 0;
-
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+	PyObject *raw_object        = NULL;
+	PyObject *tuple_object      = NULL;
+	static char *function       = "pyscca_file_get_filenames_tuple";
+	static char *keyword_list[] = { "raw", NULL };
+	int raw                     = 0;
 
 	if( pyscca_file == NULL )
 	{
@@ -855,72 +4440,49 @@ PyObject *pyscca_file_close(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_close(
-	          pyscca_file->file,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result != 0 )
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &raw_object ) == 0 )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to close file.",
-		 function );
-
-		libcerror_error_free(
-		 &error );
-
 		return( NULL );
 	}
-	if( pyscca_file->file_io_handle != NULL )
+	if( raw_object != NULL )
 	{
-		Py_BEGIN_ALLOW_THREADS
-
-		result = libbfio_handle_free(
-		          &( pyscca_file->file_io_handle ),
-		          &error );
-
-		Py_END_ALLOW_THREADS
+		raw = PyObject_IsTrue(
+		       raw_object );
 
-		if( result != 1 )
+		if( raw == -1 )
 		{
-			pyscca_error_raise(
-			 error,
-			 PyExc_IOError,
-			 "%s: unable to free libbfio file IO handle.",
-			 function );
-
-			libcerror_error_free(
-			 &error );
-
 			return( NULL );
 		}
 	}
-	Py_IncRef(
-	 Py_None );
-
-	return( Py_None );
+	if( raw != 0 )
+	{
+		tuple_object = pyscca_file_get_raw_filenames(
+		                pyscca_file );
+	}
+	else
+	{
+		tuple_object = pyscca_file_get_cached_filenames(
+		                pyscca_file );
+	}
+	return( tuple_object );
 }
 
-/* Retrieves the format version
- * Returns a Python object if successful or NULL on error
+/* Determines the size of the snapshot data of the file
+ * Returns 1 if successful or -1 on error
  */
-PyObject *pyscca_file_get_format_version(
-           pyscca_file_t *pyscca_file,
-           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+int pyscca_file_get_snapshot_data_size(
+     pyscca_file_t *pyscca_file,
+     size_t *snapshot_size )
 {
-	PyObject *integer_object = NULL;
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_get_format_version";
-	uint32_t format_version  = 0;
+	static char *function    = "pyscca_file_get_snapshot_data_size";
 	int result               = 0;
 
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
-
 	if( pyscca_file == NULL )
 	{
 		PyErr_Format(
@@ -928,13 +4490,13 @@ PyObject *pyscca_file_get_format_version(
 		 "%s: invalid file.",
 		 function );
 
-		return( NULL );
+		return( -1 );
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libscca_file_get_format_version(
+	result = libscca_file_get_snapshot_size(
 	          pyscca_file->file,
-	          &format_version,
+	          snapshot_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -944,37 +4506,29 @@ PyObject *pyscca_file_get_format_version(
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve format version.",
+		 "%s: unable to retrieve snapshot size.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		return( NULL );
+		return( -1 );
 	}
-	integer_object = PyLong_FromUnsignedLong(
-	                  (unsigned long) format_version );
-
-	return( integer_object );
+	return( 1 );
 }
 
-/* Retrieves the executable filename
- * Returns a Python object if successful or NULL on error
+/* Writes the snapshot data of the file
+ * Returns 1 if successful or -1 on error
  */
-PyObject *pyscca_file_get_executable_filename(
-           pyscca_file_t *pyscca_file,
-           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+int pyscca_file_write_snapshot_data(
+     pyscca_file_t *pyscca_file,
+     uint8_t *snapshot_data,
+     size_t snapshot_data_size )
 {
-	PyObject *string_object  = NULL;
 	libcerror_error_t *error = NULL;
-	const char *errors       = NULL;
-	static char *function    = "pyscca_file_get_executable_filename";
-	char *utf8_string        = NULL;
-	size_t utf8_string_size  = 0;
+	static char *function    = "pyscca_file_write_snapshot_data";
 	int result               = 0;
 
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
-
 	if( pyscca_file == NULL )
 	{
 		PyErr_Format(
@@ -982,180 +4536,487 @@ PyObject *pyscca_file_get_executable_filename(
 		 "%s: invalid file.",
 		 function );
 
-		return( NULL );
+		return( -1 );
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_write_snapshot(
 	          pyscca_file->file,
-	          &utf8_string_size,
+	          snapshot_data,
+	          snapshot_data_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
 
-	if( result == -1 )
+	if( result != 1 )
 	{
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to determine size of executable filename as UTF-8 string.",
+		 "%s: unable to write snapshot.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( ( result == 0 )
-	      || ( utf8_string_size == 0 ) )
+	return( 1 );
+}
+
+/* Retrieves the size of the snapshot data of the file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_snapshot_size(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	size_t snapshot_size = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file_get_snapshot_data_size(
+	     pyscca_file,
+	     &snapshot_size ) != 1 )
 	{
-		Py_IncRef(
-		 Py_None );
+		return( NULL );
+	}
+	return( PyLong_FromSize_t(
+	         snapshot_size ) );
+}
 
-		return( Py_None );
+/* Writes the snapshot data of the file into a writable buffer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_write_snapshot(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	PyObject *buffer_object     = NULL;
+	static char *function       = "pyscca_file_write_snapshot";
+	static char *keyword_list[] = { "buffer", NULL };
+	size_t snapshot_size        = 0;
+	int result                  = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &buffer_object ) == 0 )
+	{
+		return( NULL );
 	}
-	utf8_string = (char *) PyMem_Malloc(
-	                        sizeof( char ) * utf8_string_size );
+	if( pyscca_file_get_snapshot_data_size(
+	     pyscca_file,
+	     &snapshot_size ) != 1 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		return( NULL );
+	}
+	if( (size_t) buffer.len < snapshot_size )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: buffer too small to contain snapshot of size: %zd.",
+		 function,
+		 (Py_ssize_t) snapshot_size );
 
-	if( utf8_string == NULL )
+		PyBuffer_Release(
+		 &buffer );
+
+		return( NULL );
+	}
+	result = pyscca_file_write_snapshot_data(
+	          pyscca_file,
+	          (uint8_t *) buffer.buf,
+	          snapshot_size );
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( result != 1 )
+	{
+		return( NULL );
+	}
+	return( PyLong_FromSize_t(
+	         snapshot_size ) );
+}
+
+/* Retrieves the snapshot data of the file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_get_snapshot(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *bytes_object = NULL;
+	static char *function  = "pyscca_file_get_snapshot";
+	size_t snapshot_size   = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_file_get_snapshot_data_size(
+	     pyscca_file,
+	     &snapshot_size ) != 1 )
+	{
+		return( NULL );
+	}
+	if( snapshot_size > (size_t) SSIZE_MAX )
 	{
 		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create UTF-8 string.",
+		 PyExc_ValueError,
+		 "%s: invalid snapshot size value exceeds maximum.",
 		 function );
 
+		return( NULL );
+	}
+	/* The snapshot is written directly into the bytes object
+	 */
+	bytes_object = PyBytes_FromStringAndSize(
+	                NULL,
+	                (Py_ssize_t) snapshot_size );
+
+	if( bytes_object == NULL )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_write_snapshot_data(
+	     pyscca_file,
+	     (uint8_t *) PyBytes_AsString(
+	                  bytes_object ),
+	     snapshot_size ) != 1 )
+	{
+		Py_DecRef(
+		 bytes_object );
+
+		return( NULL );
+	}
+	return( bytes_object );
+}
+
+/* Writes the snapshot data of the file into a new shared memory
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_file_to_shared_memory(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	PyObject *arguments_object       = NULL;
+	PyObject *buffer_object          = NULL;
+	PyObject *exception_traceback    = NULL;
+	PyObject *exception_type         = NULL;
+	PyObject *exception_value        = NULL;
+	PyObject *keywords_object        = NULL;
+	PyObject *name_object            = NULL;
+	PyObject *result_object          = NULL;
+	PyObject *shared_memory_module   = NULL;
+	PyObject *shared_memory_object   = NULL;
+	PyObject *shared_memory_type     = NULL;
+	PyObject *size_object            = NULL;
+	static char *function            = "pyscca_file_to_shared_memory";
+	static char *keyword_list[]      = { "name", NULL };
+	size_t snapshot_size             = 0;
+	int result                       = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &name_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_get_snapshot_data_size(
+	     pyscca_file,
+	     &snapshot_size ) != 1 )
+	{
+		return( NULL );
+	}
+	shared_memory_module = PyImport_ImportModule(
+	                        "multiprocessing.shared_memory" );
+
+	if( shared_memory_module == NULL )
+	{
 		goto on_error;
 	}
-	Py_BEGIN_ALLOW_THREADS
+	shared_memory_type = PyObject_GetAttrString(
+	                      shared_memory_module,
+	                      "SharedMemory" );
 
-	result = libscca_file_get_utf8_executable_filename(
-	          pyscca_file->file,
-	          (uint8_t *) utf8_string,
-	          utf8_string_size,
-	          &error );
+	if( shared_memory_type == NULL )
+	{
+		goto on_error;
+	}
+	arguments_object = PyTuple_New(
+	                    0 );
 
-	Py_END_ALLOW_THREADS
+	keywords_object = PyDict_New();
 
-	if( result != 1 )
+	size_object = PyLong_FromSize_t(
+	               snapshot_size );
+
+	if( ( arguments_object == NULL )
+	 || ( keywords_object == NULL )
+	 || ( size_object == NULL ) )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve executable filename as UTF-8 string.",
-		 function );
+		goto on_error;
+	}
+	if( ( PyDict_SetItemString(
+	       keywords_object,
+	       "create",
+	       Py_True ) != 0 )
+	 || ( PyDict_SetItemString(
+	       keywords_object,
+	       "size",
+	       size_object ) != 0 ) )
+	{
+		goto on_error;
+	}
+	if( ( name_object != NULL )
+	 && ( name_object != Py_None ) )
+	{
+		if( PyDict_SetItemString(
+		     keywords_object,
+		     "name",
+		     name_object ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	shared_memory_object = PyObject_Call(
+	                        shared_memory_type,
+	                        arguments_object,
+	                        keywords_object );
 
-		libcerror_error_free(
-		 &error );
+	if( shared_memory_object == NULL )
+	{
+		goto on_error;
+	}
+	buffer_object = PyObject_GetAttrString(
+	                 shared_memory_object,
+	                 "buf" );
 
+	if( buffer_object == NULL )
+	{
 		goto on_error;
 	}
-	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
-	 * the end of string character is part of the string
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		goto on_error;
+	}
+	/* The shared memory can be larger than requested since it is allocated in pages
 	 */
-	string_object = PyUnicode_DecodeUTF8(
-	                 utf8_string,
-	                 (Py_ssize_t) utf8_string_size - 1,
-	                 errors );
+	result = -1;
 
-	if( string_object == NULL )
+	if( (size_t) buffer.len >= snapshot_size )
+	{
+		result = pyscca_file_write_snapshot_data(
+		          pyscca_file,
+		          (uint8_t *) buffer.buf,
+		          snapshot_size );
+	}
+	else
 	{
 		PyErr_Format(
-		 PyExc_IOError,
-		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 PyExc_ValueError,
+		 "%s: shared memory too small to contain snapshot.",
 		 function );
+	}
+	PyBuffer_Release(
+	 &buffer );
 
+	if( result != 1 )
+	{
 		goto on_error;
 	}
-	PyMem_Free(
-	 utf8_string );
-
-	return( string_object );
+	Py_DecRef(
+	 buffer_object );
+	Py_DecRef(
+	 size_object );
+	Py_DecRef(
+	 keywords_object );
+	Py_DecRef(
+	 arguments_object );
+	Py_DecRef(
+	 shared_memory_type );
+	Py_DecRef(
+	 shared_memory_module );
+
+	return( shared_memory_object );
 
 on_error:
-	if( utf8_string != NULL )
+	if( buffer_object != NULL )
 	{
-		PyMem_Free(
-		 utf8_string );
+		Py_DecRef(
+		 buffer_object );
+	}
+	/* The shared memory is removed if the snapshot could not be written into it
+	 */
+	if( shared_memory_object != NULL )
+	{
+		PyErr_Fetch(
+		 &exception_type,
+		 &exception_value,
+		 &exception_traceback );
+
+		result_object = PyObject_CallMethod(
+		                 shared_memory_object,
+		                 "close",
+		                 NULL );
+
+		if( result_object != NULL )
+		{
+			Py_DecRef(
+			 result_object );
+		}
+		result_object = PyObject_CallMethod(
+		                 shared_memory_object,
+		                 "unlink",
+		                 NULL );
+
+		if( result_object != NULL )
+		{
+			Py_DecRef(
+			 result_object );
+		}
+		PyErr_Restore(
+		 exception_type,
+		 exception_value,
+		 exception_traceback );
+
+		Py_DecRef(
+		 shared_memory_object );
+	}
+	if( size_object != NULL )
+	{
+		Py_DecRef(
+		 size_object );
+	}
+	if( keywords_object != NULL )
+	{
+		Py_DecRef(
+		 keywords_object );
+	}
+	if( arguments_object != NULL )
+	{
+		Py_DecRef(
+		 arguments_object );
+	}
+	if( shared_memory_type != NULL )
+	{
+		Py_DecRef(
+		 shared_memory_type );
+	}
+	if( shared_memory_module != NULL )
+	{
+		Py_DecRef(
+		 shared_memory_module );
 	}
 	return( NULL );
 }
 
-/* Retrieves the prefetch hash
+/* Pickles the file as its snapshot data
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_prefetch_hash(
+PyObject *pyscca_file_reduce(
            pyscca_file_t *pyscca_file,
            PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
 {
-	PyObject *integer_object = NULL;
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_get_prefetch_hash";
-	uint32_t value_32bit     = 0;
-	int result               = 0;
+	PyObject *function_object = NULL;
+	PyObject *module_object   = NULL;
+	PyObject *snapshot_object = NULL;
+	PyObject *tuple_object    = NULL;
 
 	PYSCCA_UNREFERENCED_PARAMETER( arguments )
 
-	if( pyscca_file == NULL )
-	{
-		PyErr_Format(
-		 PyExc_ValueError,
-		 "%s: invalid file.",
-		 function );
+	snapshot_object = pyscca_file_get_snapshot(
+	                   pyscca_file,
+	                   NULL );
 
+	if( snapshot_object == NULL )
+	{
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_prefetch_hash(
-	          pyscca_file->file,
-	          &value_32bit,
-	          &error );
+	module_object = PyImport_ImportModule(
+	                 "pyscca" );
 
-	Py_END_ALLOW_THREADS
+	if( module_object == NULL )
+	{
+		goto on_error;
+	}
+	function_object = PyObject_GetAttrString(
+	                   module_object,
+	                   "open_snapshot" );
 
-	if( result == -1 )
+	if( function_object == NULL )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve prefetch hash.",
-		 function );
+		goto on_error;
+	}
+	/* Py_BuildValue N steals the reference to the snapshot object
+	 */
+	tuple_object = Py_BuildValue(
+	                "(O(N))",
+	                function_object,
+	                snapshot_object );
 
-		libcerror_error_free(
-		 &error );
+	snapshot_object = NULL;
 
-		return( NULL );
+	Py_DecRef(
+	 function_object );
+	Py_DecRef(
+	 module_object );
+
+	return( tuple_object );
+
+on_error:
+	if( function_object != NULL )
+	{
+		Py_DecRef(
+		 function_object );
 	}
-	else if( result == 0 )
+	if( module_object != NULL )
 	{
-		Py_IncRef(
-		 Py_None );
-
-		return( Py_None );
+		Py_DecRef(
+		 module_object );
 	}
-	integer_object = PyLong_FromUnsignedLong(
-	                  (unsigned long) value_32bit );
-
-	return( integer_object );
+	if( snapshot_object != NULL )
+	{
+		Py_DecRef(
+		 snapshot_object );
+	}
+	return( NULL );
 }
 
-/* Retrieves the last run date and time
+/* Creates an iterator of the filenames
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_last_run_time(
+PyObject *pyscca_file_iter_filenames(
            pyscca_file_t *pyscca_file,
            PyObject *arguments,
            PyObject *keywords )
 {
-	libcerror_error_t *error    = NULL;
-	PyObject *date_time_object  = NULL;
-	static char *function       = "pyscca_file_get_last_run_time";
-	static char *keyword_list[] = { "last_run_time_index", NULL };
-	uint64_t filetime           = 0;
-	int last_run_time_index     = 0;
-	int result                  = 0;
-
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+	PyObject *case_sensitive_object = NULL;
+	PyObject *pattern_object        = NULL;
+	static char *function           = "pyscca_file_iter_filenames";
+	static char *keyword_list[]     = { "pattern", "case_sensitive", NULL };
+	int case_sensitive              = 0;
 
 	if( pyscca_file == NULL )
 	{
@@ -1169,59 +5030,43 @@ PyObject *pyscca_file_get_last_run_time(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "i",
+	     "|OO",
 	     keyword_list,
-	     &last_run_time_index ) == 0 )
+	     &pattern_object,
+	     &case_sensitive_object ) == 0 )
 	{
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_last_run_time(
-	          pyscca_file->file,
-	          last_run_time_index,
-	          &filetime,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result != 1 )
+	if( case_sensitive_object != NULL )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve last run time: %d.",
-		 function,
-		 last_run_time_index );
-
-		libcerror_error_free(
-		 &error );
+		case_sensitive = PyObject_IsTrue(
+		                  case_sensitive_object );
 
-		return( NULL );
+		if( case_sensitive == -1 )
+		{
+			return( NULL );
+		}
 	}
-	date_time_object = pyscca_datetime_new_from_filetime(
-	                    filetime );
-
-	return( date_time_object );
+	return( pyscca_iterator_new(
+	         (PyObject *) pyscca_file,
+	         PYSCCA_ITERATOR_TYPE_FILENAMES,
+	         pattern_object,
+	         case_sensitive ) );
 }
 
-/* Retrieves the last run date and time as an integer
+/* Creates an iterator of the file metrics entries
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_last_run_time_as_integer(
+PyObject *pyscca_file_iter_file_metrics(
            pyscca_file_t *pyscca_file,
            PyObject *arguments,
            PyObject *keywords )
 {
-	libcerror_error_t *error    = NULL;
-	PyObject *integer_object    = NULL;
-	static char *function       = "pyscca_file_get_last_run_time_as_integer";
-	static char *keyword_list[] = { "last_run_time_index", NULL };
-	uint64_t filetime           = 0;
-	int last_run_time_index     = 0;
-	int result                  = 0;
-
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+	PyObject *case_sensitive_object = NULL;
+	PyObject *pattern_object        = NULL;
+	static char *function           = "pyscca_file_iter_file_metrics";
+	static char *keyword_list[]     = { "pattern", "case_sensitive", NULL };
+	int case_sensitive              = 0;
 
 	if( pyscca_file == NULL )
 	{
@@ -1235,53 +5080,41 @@ PyObject *pyscca_file_get_last_run_time_as_integer(
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "i",
+	     "|OO",
 	     keyword_list,
-	     &last_run_time_index ) == 0 )
+	     &pattern_object,
+	     &case_sensitive_object ) == 0 )
 	{
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_last_run_time(
-	          pyscca_file->file,
-	          last_run_time_index,
-	          &filetime,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result != 1 )
+	if( case_sensitive_object != NULL )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve last run time: %d.",
-		 function,
-		 last_run_time_index );
+		case_sensitive = PyObject_IsTrue(
+		                  case_sensitive_object );
 
-		libcerror_error_free(
-		 &error );
-
-		return( NULL );
+		if( case_sensitive == -1 )
+		{
+			return( NULL );
+		}
 	}
-	integer_object = pyscca_integer_unsigned_new_from_64bit(
-	                  (uint64_t) filetime );
-
-	return( integer_object );
+	return( pyscca_iterator_new(
+	         (PyObject *) pyscca_file,
+	         PYSCCA_ITERATOR_TYPE_FILE_METRICS,
+	         pattern_object,
+	         case_sensitive ) );
 }
 
-/* Retrieves the run count
+/* Retrieves the number of volumes
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_run_count(
+PyObject *pyscca_file_get_number_of_volumes(
            pyscca_file_t *pyscca_file,
            PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
 {
 	PyObject *integer_object = NULL;
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_get_run_count";
-	uint32_t value_32bit     = 0;
+	static char *function    = "pyscca_file_get_number_of_volumes";
+	int number_of_volumes    = 0;
 	int result               = 0;
 
 	PYSCCA_UNREFERENCED_PARAMETER( arguments )
@@ -1295,70 +5128,17 @@ PyObject *pyscca_file_get_run_count(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_run_count(
-	          pyscca_file->file,
-	          &value_32bit,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result == -1 )
-	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve run count.",
-		 function );
-
-		libcerror_error_free(
-		 &error );
-
-		return( NULL );
-	}
-	else if( result == 0 )
-	{
-		Py_IncRef(
-		 Py_None );
-
-		return( Py_None );
-	}
-	integer_object = PyLong_FromUnsignedLong(
-	                  (unsigned long) value_32bit );
-
-	return( integer_object );
-}
-
-/* Retrieves the number of file metrics entries
- * Returns a Python object if successful or NULL on error
- */
-PyObject *pyscca_file_get_number_of_file_metrics_entries(
-           pyscca_file_t *pyscca_file,
-           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
-{
-	PyObject *integer_object           = NULL;
-	libcerror_error_t *error           = NULL;
-	static char *function              = "pyscca_file_get_number_of_file_metrics_entries";
-	int number_of_file_metrics_entries = 0;
-	int result                         = 0;
-
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
-
-	if( pyscca_file == NULL )
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES ) != 1 )
 	{
-		PyErr_Format(
-		 PyExc_ValueError,
-		 "%s: invalid file.",
-		 function );
-
 		return( NULL );
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_number_of_volumes(
 	          pyscca_file->file,
-	          &number_of_file_metrics_entries,
+	          &number_of_volumes,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -1368,7 +5148,7 @@ PyObject *pyscca_file_get_number_of_file_metrics_entries(
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of file metrics entries.",
+		 "%s: unable to retrieve number of volumes.",
 		 function );
 
 		libcerror_error_free(
@@ -1378,26 +5158,26 @@ PyObject *pyscca_file_get_number_of_file_metrics_entries(
 	}
 #if PY_MAJOR_VERSION >= 3
 	integer_object = PyLong_FromLong(
-	                  (long) number_of_file_metrics_entries );
+	                  (long) number_of_volumes );
 #else
 	integer_object = PyInt_FromLong(
-	                  (long) number_of_file_metrics_entries );
+	                  (long) number_of_volumes );
 #endif
 	return( integer_object );
 }
 
-/* Retrieves a specific file metrics entry by index
+/* Retrieves a specific volume information by index
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_file_metrics_entry_by_index(
+PyObject *pyscca_file_get_volume_information_by_index(
            PyObject *pyscca_file,
-           int entry_index )
+           int volume_index )
 {
-	PyObject *file_metrics_entry_object        = NULL;
-	libcerror_error_t *error                   = NULL;
-	libscca_file_metrics_t *file_metrics_entry = NULL;
-	static char *function                      = "pyscca_file_get_file_metrics_entry_by_index";
-	int result                                 = 0;
+	PyObject *volume_information_object              = NULL;
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	static char *function                            = "pyscca_file_get_volume_information_by_index";
+	int result                                       = 0;
 
 	if( pyscca_file == NULL )
 	{
@@ -1408,12 +5188,18 @@ PyObject *pyscca_file_get_file_metrics_entry_by_index(
 
 		return( NULL );
 	}
+	if( pyscca_file_read_skipped_sections(
+	     (pyscca_file_t *) pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES ) != 1 )
+	{
+		return( NULL );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_volume_information(
 	          ( (pyscca_file_t *) pyscca_file )->file,
-	          entry_index,
-	          &file_metrics_entry,
+	          volume_index,
+	          &volume_information,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -1423,80 +5209,80 @@ PyObject *pyscca_file_get_file_metrics_entry_by_index(
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve file metrics entry: %d.",
+		 "%s: unable to retrieve volume information: %d.",
 		 function,
-		 entry_index );
+		 volume_index );
 
 		libcerror_error_free(
 		 &error );
 
 		goto on_error;
 	}
-	file_metrics_entry_object = pyscca_file_metrics_new(
-	                             file_metrics_entry,
+	volume_information_object = pyscca_volume_information_new(
+	                             volume_information,
 	                             (PyObject *) pyscca_file );
 
-	if( file_metrics_entry_object == NULL )
+	if( volume_information_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_MemoryError,
-		 "%s: unable to create file metrics object.",
+		 "%s: unable to create volume information object.",
 		 function );
 
 		goto on_error;
 	}
-	return( file_metrics_entry_object );
+	return( volume_information_object );
 
 on_error:
-	if( file_metrics_entry != NULL )
+	if( volume_information != NULL )
 	{
-		libscca_file_metrics_free(
-		 &file_metrics_entry,
+		libscca_volume_information_free(
+		 &volume_information,
 		 NULL );
 	}
 	return( NULL );
 }
 
-/* Retrieves a specific file metrics entry
+/* Retrieves a specific volume information
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_file_metrics_entry(
+PyObject *pyscca_file_get_volume_information(
            pyscca_file_t *pyscca_file,
            PyObject *arguments,
            PyObject *keywords )
 {
-	PyObject *file_metrics_entry_object = NULL;
-	static char *keyword_list[]         = { "entry_index", NULL };
-	int entry_index        = 0;
+	PyObject *volume_information_object = NULL;
+	static char *keyword_list[]         = { "volume_index", NULL };
+	int volume_index                    = 0;
 
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
 	     "i",
 	     keyword_list,
-	     &entry_index ) == 0 )
+	     &volume_index ) == 0 )
 	{
 		return( NULL );
 	}
-	file_metrics_entry_object = pyscca_file_get_file_metrics_entry_by_index(
+	volume_information_object = pyscca_file_get_volume_information_by_index(
 	                             (PyObject *) pyscca_file,
-	                             entry_index );
+	                             volume_index );
 
-	return( file_metrics_entry_object );
+	return( volume_information_object );
 }
 
-/* Retrieves a sequence and iterator object for the file metrics entries
+/* Retrieves a sequence and iterator object for the volumes
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_file_metrics_entries(
+PyObject *pyscca_file_get_volumes(
            pyscca_file_t *pyscca_file,
            PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
 {
-	PyObject *sequence_object          = NULL;
-	libcerror_error_t *error           = NULL;
-	static char *function              = "pyscca_file_get_file_metrics_entries";
-	int number_of_file_metrics_entries = 0;
-	int result                         = 0;
+	PyObject *sequence_object = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyscca_file_get_volumes";
+	int number_of_volumes     = 0;
+	int result                = 0;
 
 	PYSCCA_UNREFERENCED_PARAMETER( arguments )
 
@@ -1509,11 +5295,17 @@ PyObject *pyscca_file_get_file_metrics_entries(
 
 		return( NULL );
 	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES ) != 1 )
+	{
+		return( NULL );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_number_of_volumes(
 	          pyscca_file->file,
-	          &number_of_file_metrics_entries,
+	          &number_of_volumes,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -1523,7 +5315,7 @@ PyObject *pyscca_file_get_file_metrics_entries(
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of file metrics entries.",
+		 "%s: unable to retrieve number of volumes.",
 		 function );
 
 		libcerror_error_free(
@@ -1531,10 +5323,10 @@ PyObject *pyscca_file_get_file_metrics_entries(
 
 		return( NULL );
 	}
-	sequence_object = pyscca_file_metrics_entries_new(
+	sequence_object = pyscca_volumes_new(
 	                   (PyObject *) pyscca_file,
-	                   &pyscca_file_get_file_metrics_entry_by_index,
-	                   number_of_file_metrics_entries );
+	                   &pyscca_file_get_volume_information_by_index,
+	                   number_of_volumes );
 
 	if( sequence_object == NULL )
 	{
@@ -1549,20 +5341,32 @@ PyObject *pyscca_file_get_file_metrics_entries(
 	return( sequence_object );
 }
 
-/* Retrieves the number of filenames
+/* Retrieves the values of a specific volume as a record
+ * The values are retrieved in a single pass without creating a volume information object,
+ * the strings are decoded directly from the UTF-16 streams in the file
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_number_of_filenames(
+PyObject *pyscca_file_get_volume_record_by_index(
            pyscca_file_t *pyscca_file,
-           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+           int volume_index )
 {
-	PyObject *integer_object = NULL;
-	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_get_number_of_filenames";
-	int number_of_filenames  = 0;
-	int result               = 0;
-
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+	PyObject *record_object                          = NULL;
+	PyObject *string_object                          = NULL;
+	PyObject *tuple_object                           = NULL;
+	PyObject *value_object                           = NULL;
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	const uint8_t *utf16_stream                      = NULL;
+	static char *function                            = "pyscca_file_get_volume_record_by_index";
+	size_t utf16_stream_size                         = 0;
+	uint64_t *file_references                        = NULL;
+	uint64_t creation_time                           = 0;
+	uint32_t serial_number                           = 0;
+	int directory_string_index                       = 0;
+	int file_reference_index                         = 0;
+	int number_of_directory_strings                  = 0;
+	int number_of_file_references                    = 0;
+	int result                                       = 0;
 
 	if( pyscca_file == NULL )
 	{
@@ -1575,263 +5379,301 @@ PyObject *pyscca_file_get_number_of_filenames(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libscca_file_get_number_of_filenames(
+	result = libscca_file_get_volume_information(
 	          pyscca_file->file,
-	          &number_of_filenames,
+	          volume_index,
+	          &volume_information,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
-	if( result != 1 )
+	if( result == 1 )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve number of filenames.",
-		 function );
-
-		libcerror_error_free(
-		 &error );
-
-		return( NULL );
+		result = libscca_volume_information_get_utf16_device_path_stream(
+		          volume_information,
+		          &utf16_stream,
+		          &utf16_stream_size,
+		          &error );
 	}
-#if PY_MAJOR_VERSION >= 3
-	integer_object = PyLong_FromLong(
-	                  (long) number_of_filenames );
-#else
-	integer_object = PyInt_FromLong(
-	                  (long) number_of_filenames );
-#endif
-	return( integer_object );
-}
-
-/* Retrieves a specific filename by index
- * Returns a Python object if successful or NULL on error
- */
-PyObject *pyscca_file_get_filename_by_index(
-           PyObject *pyscca_file,
-           int filename_index )
-{
-	PyObject *string_object  = NULL;
-	libcerror_error_t *error = NULL;
-	uint8_t *utf8_string     = NULL;
-	const char *errors       = NULL;
-	static char *function    = "pyscca_file_get_filename_by_index";
-	size_t utf8_string_size  = 0;
-	int result               = 0;
-
-	if( pyscca_file == NULL )
+	if( result == 1 )
 	{
-		PyErr_Format(
-		 PyExc_ValueError,
-		 "%s: invalid file.",
-		 function );
-
-		return( NULL );
+		result = libscca_volume_information_get_creation_time(
+		          volume_information,
+		          &creation_time,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libscca_volume_information_get_serial_number(
+		          volume_information,
+		          &serial_number,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libscca_volume_information_get_number_of_file_references(
+		          volume_information,
+		          &number_of_file_references,
+		          &error );
+	}
+	if( result == 1 )
+	{
+		result = libscca_volume_information_get_number_of_directory_strings(
+		          volume_information,
+		          &number_of_directory_strings,
+		          &error );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_utf8_filename_size(
-	          ( (pyscca_file_t *) pyscca_file )->file,
-	          filename_index,
-	          &utf8_string_size,
-	          &error );
-
 	Py_END_ALLOW_THREADS
 
-	if( result == -1 )
+	if( result != 1 )
 	{
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to determine size of filename: %d as UTF-8 string.",
+		 "%s: unable to retrieve values of volume: %d.",
 		 function,
-		 filename_index );
+		 volume_index );
 
 		libcerror_error_free(
 		 &error );
 
 		goto on_error;
 	}
-	else if( ( result == 0 )
-	      || ( utf8_string_size == 0 ) )
-	{
-		Py_IncRef(
-		 Py_None );
-
-		return( Py_None );
-	}
-	utf8_string = (uint8_t *) PyMem_Malloc(
-	                           sizeof( uint8_t ) * utf8_string_size );
+	record_object = PyStructSequence_New(
+	                 &pyscca_volume_record_type_object );
 
-	if( utf8_string == NULL )
+	if( record_object == NULL )
 	{
 		PyErr_Format(
 		 PyExc_MemoryError,
-		 "%s: unable to create UTF-8 string.",
+		 "%s: unable to create record object.",
 		 function );
 
 		goto on_error;
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_utf8_filename(
-	          ( (pyscca_file_t *) pyscca_file )->file,
-	          filename_index,
-	          utf8_string,
-	          utf8_string_size,
-	          &error );
+	/* PyStructSequence_SET_ITEM steals the references to the item objects
+	 */
+	value_object = pyscca_records_new_string_from_utf16_stream(
+	                utf16_stream,
+	                utf16_stream_size );
 
-	Py_END_ALLOW_THREADS
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 0,
+	 value_object );
 
-	if( result != 1 )
+	if( pyscca_file->timestamps_as_integers != 0 )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve filename: %d as UTF-8 string.",
-		 function,
-		 filename_index );
+		value_object = pyscca_integer_unsigned_new_from_64bit(
+		                creation_time );
+	}
+	else
+	{
+		value_object = pyscca_datetime_new_from_filetime(
+		                creation_time );
+	}
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 1,
+	 value_object );
 
-		libcerror_error_free(
-		 &error );
+	value_object = PyLong_FromUnsignedLong(
+	                (unsigned long) serial_number );
 
+	if( value_object == NULL )
+	{
 		goto on_error;
 	}
-	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
-	 * the end of string character is part of the string
-	 */
-	string_object = PyUnicode_DecodeUTF8(
-	                 (char *) utf8_string,
-	                 (Py_ssize_t) utf8_string_size - 1,
-	                 errors );
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 2,
+	 value_object );
 
-	if( string_object == NULL )
+	tuple_object = PyTuple_New(
+	                (Py_ssize_t) number_of_file_references );
+
+	if( tuple_object == NULL )
 	{
 		PyErr_Format(
-		 PyExc_IOError,
-		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 PyExc_MemoryError,
+		 "%s: unable to create file references tuple object.",
 		 function );
 
 		goto on_error;
 	}
-	PyMem_Free(
-	 utf8_string );
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 3,
+	 tuple_object );
 
-	return( string_object );
-
-on_error:
-	if( utf8_string != NULL )
+	if( number_of_file_references > 0 )
 	{
-		PyMem_Free(
-		 utf8_string );
-	}
-	return( NULL );
-}
-
-/* Retrieves a specific filename
- * Returns a Python object if successful or NULL on error
- */
-PyObject *pyscca_file_get_filename(
-           pyscca_file_t *pyscca_file,
-           PyObject *arguments,
-           PyObject *keywords )
-{
-	PyObject *string_object     = NULL;
-	static char *keyword_list[] = { "filename_index", NULL };
-	int filename_index          = 0;
+		file_references = (uint64_t *) PyMem_Malloc(
+		                                sizeof( uint64_t ) * number_of_file_references );
 
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &filename_index ) == 0 )
-	{
-		return( NULL );
-	}
-	string_object = pyscca_file_get_filename_by_index(
-	                 (PyObject *) pyscca_file,
-	                 filename_index );
+		if( file_references == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create file references.",
+			 function );
 
-	return( string_object );
-}
+			goto on_error;
+		}
+		if( libscca_volume_information_copy_file_references(
+		     volume_information,
+		     file_references,
+		     number_of_file_references,
+		     &error ) != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve file references of volume: %d.",
+			 function,
+			 volume_index );
 
-/* Retrieves a sequence and iterator object for the filenames
- * Returns a Python object if successful or NULL on error
- */
-PyObject *pyscca_file_get_filenames(
-           pyscca_file_t *pyscca_file,
-           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
-{
-	PyObject *sequence_object = NULL;
-	libcerror_error_t *error  = NULL;
-	static char *function     = "pyscca_file_get_filenames";
-	int number_of_filenames   = 0;
-	int result                = 0;
+			libcerror_error_free(
+			 &error );
 
-	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+			goto on_error;
+		}
+		for( file_reference_index = 0;
+		     file_reference_index < number_of_file_references;
+		     file_reference_index++ )
+		{
+			value_object = pyscca_integer_unsigned_new_from_64bit(
+			                file_references[ file_reference_index ] );
+
+			if( value_object == NULL )
+			{
+				goto on_error;
+			}
+			/* PyTuple_SetItem steals the reference to the integer object
+			 */
+			PyTuple_SetItem(
+			 tuple_object,
+			 (Py_ssize_t) file_reference_index,
+			 value_object );
+		}
+		PyMem_Free(
+		 file_references );
 
-	if( pyscca_file == NULL )
+		file_references = NULL;
+	}
+	tuple_object = PyTuple_New(
+	                (Py_ssize_t) number_of_directory_strings );
+
+	if( tuple_object == NULL )
 	{
 		PyErr_Format(
-		 PyExc_ValueError,
-		 "%s: invalid file.",
+		 PyExc_MemoryError,
+		 "%s: unable to create directory strings tuple object.",
 		 function );
 
-		return( NULL );
+		goto on_error;
 	}
-	Py_BEGIN_ALLOW_THREADS
+	PyStructSequence_SET_ITEM(
+	 record_object,
+	 4,
+	 tuple_object );
+
+	for( directory_string_index = 0;
+	     directory_string_index < number_of_directory_strings;
+	     directory_string_index++ )
+	{
+		if( libscca_volume_information_get_utf16_directory_string_stream(
+		     volume_information,
+		     directory_string_index,
+		     &utf16_stream,
+		     &utf16_stream_size,
+		     &error ) != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve directory string: %d of volume: %d.",
+			 function,
+			 directory_string_index,
+			 volume_index );
 
-	result = libscca_file_get_number_of_filenames(
-	          pyscca_file->file,
-	          &number_of_filenames,
-	          &error );
+			libcerror_error_free(
+			 &error );
 
-	Py_END_ALLOW_THREADS
+			goto on_error;
+		}
+		string_object = pyscca_records_new_string_from_utf16_stream(
+		                 utf16_stream,
+		                 utf16_stream_size );
 
-	if( result != 1 )
+		if( string_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyTuple_SetItem steals the reference to the string object
+		 */
+		PyTuple_SetItem(
+		 tuple_object,
+		 (Py_ssize_t) directory_string_index,
+		 string_object );
+	}
+	if( libscca_volume_information_free(
+	     &volume_information,
+	     &error ) != 1 )
 	{
 		pyscca_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of filenames.",
+		 "%s: unable to free volume information.",
 		 function );
 
 		libcerror_error_free(
 		 &error );
 
-		return( NULL );
+		goto on_error;
 	}
-	sequence_object = pyscca_filenames_new(
-	                   (PyObject *) pyscca_file,
-	                   &pyscca_file_get_filename_by_index,
-	                   number_of_filenames );
+	return( record_object );
 
-	if( sequence_object == NULL )
+on_error:
+	if( file_references != NULL )
 	{
-		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create sequence object.",
-		 function );
-
-		return( NULL );
+		PyMem_Free(
+		 file_references );
 	}
-	return( sequence_object );
+	if( record_object != NULL )
+	{
+		Py_DecRef(
+		 record_object );
+	}
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( NULL );
 }
 
-/* Retrieves the number of volumes
+/* Retrieves the values of all volumes as records
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_number_of_volumes(
+PyObject *pyscca_file_get_volume_records(
            pyscca_file_t *pyscca_file,
            PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
 {
-	PyObject *integer_object = NULL;
+	PyObject *list_object    = NULL;
+	PyObject *record_object  = NULL;
 	libcerror_error_t *error = NULL;
-	static char *function    = "pyscca_file_get_number_of_volumes";
+	static char *function    = "pyscca_file_get_volume_records";
 	int number_of_volumes    = 0;
 	int result               = 0;
+	int volume_index         = 0;
 
 	PYSCCA_UNREFERENCED_PARAMETER( arguments )
 
@@ -1844,6 +5686,16 @@ PyObject *pyscca_file_get_number_of_volumes(
 
 		return( NULL );
 	}
+	if( pyscca_type_objects_ready() != 1 )
+	{
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     pyscca_file,
+	     LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES ) != 1 )
+	{
+		return( NULL );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libscca_file_get_number_of_volumes(
@@ -1866,127 +5718,87 @@ PyObject *pyscca_file_get_number_of_volumes(
 
 		return( NULL );
 	}
-#if PY_MAJOR_VERSION >= 3
-	integer_object = PyLong_FromLong(
-	                  (long) number_of_volumes );
-#else
-	integer_object = PyInt_FromLong(
-	                  (long) number_of_volumes );
-#endif
-	return( integer_object );
-}
-
-/* Retrieves a specific volume information by index
- * Returns a Python object if successful or NULL on error
- */
-PyObject *pyscca_file_get_volume_information_by_index(
-           PyObject *pyscca_file,
-           int volume_index )
-{
-	PyObject *volume_information_object              = NULL;
-	libcerror_error_t *error                         = NULL;
-	libscca_volume_information_t *volume_information = NULL;
-	static char *function                            = "pyscca_file_get_volume_information_by_index";
-	int result                                       = 0;
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_volumes );
 
-	if( pyscca_file == NULL )
+	if( list_object == NULL )
 	{
 		PyErr_Format(
-		 PyExc_ValueError,
-		 "%s: invalid file.",
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
 		 function );
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_volume_information(
-	          ( (pyscca_file_t *) pyscca_file )->file,
-	          volume_index,
-	          &volume_information,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result != 1 )
-	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve volume information: %d.",
-		 function,
-		 volume_index );
-
-		libcerror_error_free(
-		 &error );
-
-		goto on_error;
-	}
-	volume_information_object = pyscca_volume_information_new(
-	                             volume_information,
-	                             (PyObject *) pyscca_file );
-
-	if( volume_information_object == NULL )
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
 	{
-		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create volume information object.",
-		 function );
+		record_object = pyscca_file_get_volume_record_by_index(
+		                 pyscca_file,
+		                 volume_index );
 
-		goto on_error;
-	}
-	return( volume_information_object );
+		if( record_object == NULL )
+		{
+			Py_DecRef(
+			 list_object );
 
-on_error:
-	if( volume_information != NULL )
-	{
-		libscca_volume_information_free(
-		 &volume_information,
-		 NULL );
+			return( NULL );
+		}
+		/* PyList_SetItem steals the reference to the record object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) volume_index,
+		 record_object );
 	}
-	return( NULL );
+	return( list_object );
 }
 
-/* Retrieves a specific volume information
- * Returns a Python object if successful or NULL on error
+/* The parse statistics and their dictionary keys
  */
-PyObject *pyscca_file_get_volume_information(
-           pyscca_file_t *pyscca_file,
-           PyObject *arguments,
-           PyObject *keywords )
+static struct pyscca_file_statistic
 {
-	PyObject *volume_information_object = NULL;
-	static char *keyword_list[]         = { "volume_index", NULL };
-	int volume_index                    = 0;
-
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
-	     keyword_list,
-	     &volume_index ) == 0 )
-	{
-		return( NULL );
-	}
-	volume_information_object = pyscca_file_get_volume_information_by_index(
-	                             (PyObject *) pyscca_file,
-	                             volume_index );
+	int statistic_type;
+	const char *key;
+
+} pyscca_file_statistics[] = {
+
+	{ LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ, "bytes_read" },
+	{ LIBSCCA_STATISTIC_TYPE_NUMBER_OF_DECOMPRESSED_BLOCKS, "decompressed_blocks" },
+	{ LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_HITS, "cache_hits" },
+	{ LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_MISSES, "cache_misses" },
+	{ LIBSCCA_STATISTIC_TYPE_NUMBER_OF_ALLOCATIONS, "allocations" },
+	{ LIBSCCA_STATISTIC_TYPE_FILE_HEADER_READ_TIME, "file_header_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_FILE_INFORMATION_READ_TIME, "file_information_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_FILE_METRICS_READ_TIME, "file_metrics_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_FILENAMES_READ_TIME, "filenames_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_VOLUMES_READ_TIME, "volumes_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_COMPRESSED_HEADER_READ_TIME, "compressed_header_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_COMPRESSED_BLOCKS_READ_TIME, "compressed_blocks_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_TRACE_CHAIN_READ_TIME, "trace_chain_read_time" },
+	{ LIBSCCA_STATISTIC_TYPE_ALLOCATED_SIZE, "allocated_size" },
+	{ LIBSCCA_STATISTIC_TYPE_MAXIMUM_ALLOCATED_SIZE, "maximum_allocated_size" },
+	{ LIBSCCA_STATISTIC_TYPE_UNCOMPRESSED_DATA_SIZE, "uncompressed_data_size" },
 
-	return( volume_information_object );
-}
+	/* Sentinel */
+	{ 0, NULL }
+};
 
-/* Retrieves a sequence and iterator object for the volumes
+/* Retrieves the parse statistics
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pyscca_file_get_volumes(
+PyObject *pyscca_file_get_stats(
            pyscca_file_t *pyscca_file,
            PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
 {
-	PyObject *sequence_object = NULL;
-	libcerror_error_t *error  = NULL;
-	static char *function     = "pyscca_file_get_volumes";
-	int number_of_volumes     = 0;
-	int result                = 0;
+	PyObject *dictionary_object = NULL;
+	PyObject *value_object      = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyscca_file_get_stats";
+	uint64_t value              = 0;
+	int result                  = 0;
+	int statistic_index         = 0;
 
 	PYSCCA_UNREFERENCED_PARAMETER( arguments )
 
@@ -1999,43 +5811,85 @@ PyObject *pyscca_file_get_volumes(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libscca_file_get_number_of_volumes(
-	          pyscca_file->file,
-	          &number_of_volumes,
-	          &error );
-
-	Py_END_ALLOW_THREADS
+	dictionary_object = PyDict_New();
 
-	if( result != 1 )
+	if( dictionary_object == NULL )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve number of volumes.",
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
 		 function );
 
-		libcerror_error_free(
-		 &error );
-
 		return( NULL );
 	}
-	sequence_object = pyscca_volumes_new(
-	                   (PyObject *) pyscca_file,
-	                   &pyscca_file_get_volume_information_by_index,
-	                   number_of_volumes );
-
-	if( sequence_object == NULL )
+	for( statistic_index = 0;
+	     pyscca_file_statistics[ statistic_index ].key != NULL;
+	     statistic_index++ )
 	{
-		pyscca_error_raise(
-		 error,
-		 PyExc_MemoryError,
-		 "%s: unable to create sequence object.",
-		 function );
+		/* The statistics are plain counters, retrieving them does not release the GIL
+		 */
+		result = libscca_file_get_statistic(
+		          pyscca_file->file,
+		          pyscca_file_statistics[ statistic_index ].statistic_type,
+		          &value,
+		          &error );
 
-		return( NULL );
+		if( result == -1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to retrieve statistic: %s.",
+			 function,
+			 pyscca_file_statistics[ statistic_index ].key );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		else
+		{
+			value_object = pyscca_integer_unsigned_new_from_64bit(
+			                value );
+
+			if( value_object == NULL )
+			{
+				goto on_error;
+			}
+		}
+		/* PyDict_SetItemString does not steal the reference to the value object
+		 */
+		if( PyDict_SetItemString(
+		     dictionary_object,
+		     pyscca_file_statistics[ statistic_index ].key,
+		     value_object ) != 0 )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 value_object );
+
+		value_object = NULL;
 	}
-	return( sequence_object );
+	return( dictionary_object );
+
+on_error:
+	if( value_object != NULL )
+	{
+		Py_DecRef(
+		 value_object );
+	}
+	Py_DecRef(
+	 dictionary_object );
+
+	return( NULL );
 }
 
@@ -33,6 +33,27 @@
 extern "C" {
 #endif
 
+/* The access flags that are supported by the open functions
+ */
+#define PYSCCA_FILE_SUPPORTED_ACCESS_FLAGS \
+	( LIBSCCA_ACCESS_FLAG_READ \
+	| LIBSCCA_ACCESS_FLAG_CONTIGUOUS_DATA \
+	| LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS \
+	| LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES \
+	| LIBSCCA_ACCESS_FLAG_SKIP_VOLUMES \
+	| LIBSCCA_ACCESS_FLAG_CACHE_UTF8_FILENAMES \
+	| LIBSCCA_ACCESS_FLAG_MEASURE_READ_TIMES \
+	| LIBSCCA_ACCESS_FLAG_PARALLEL_DECOMPRESSION )
+
+/* The formats of the file metrics values
+ */
+enum PYSCCA_FILE_METRICS_VALUES_FORMATS
+{
+	PYSCCA_FILE_METRICS_VALUES_FORMAT_TUPLES	= 0,
+	PYSCCA_FILE_METRICS_VALUES_FORMAT_RECORDS	= 1,
+	PYSCCA_FILE_METRICS_VALUES_FORMAT_COLUMNS	= 2
+};
+
 typedef struct pyscca_file pyscca_file_t;
 
 struct pyscca_file
@@ -45,9 +66,57 @@ struct pyscca_file
 	 */
 	libscca_file_t *file;
 
+	/* The libscca file that was opened with sections skipped
+	 * Contains NULL if the skipped sections have not been read
+	 */
+	libscca_file_t *header_file;
+
+	/* The access flags the file was opened with
+	 */
+	int access_flags;
+
+	/* The filename object the file was opened with
+	 */
+	PyObject *filename_object;
+
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
+
+	/* The buffer the file was opened from
+	 * The buffer is kept until the file is closed since libscca references its data
+	 */
+	Py_buffer buffer;
+
+	/* Value to indicate the buffer is set
+	 */
+	uint8_t buffer_is_set;
+
+	/* Value to indicate the buffer contains snapshot data
+	 */
+	uint8_t buffer_is_snapshot;
+
+	/* The filenames tuple
+	 * Contains NULL if the filenames have not been converted yet
+	 */
+	PyObject *filenames_object;
+
+	/* Value to indicate timestamps are returned as integers
+	 * containing a FILETIME value instead of datetime objects
+	 */
+	uint8_t timestamps_as_integers;
+
+	/* The parse cache object the file was opened with
+	 * Contains NULL if the file was not opened using a parse cache
+	 */
+	PyObject *parse_cache_object;
+
+#if defined( Py_GIL_DISABLED )
+	/* The mutex that protects the open, close and lazily converted state
+	 * Without the GIL threads can use the same file object concurrently
+	 */
+	PyMutex mutex;
+#endif
 };
 
 extern PyMethodDef pyscca_file_object_methods[];
@@ -56,27 +125,84 @@ extern PyTypeObject pyscca_file_type_object;
 int pyscca_file_init(
      pyscca_file_t *pyscca_file );
 
+int pyscca_file_initialize_file(
+     pyscca_file_t *pyscca_file );
+
 void pyscca_file_free(
       pyscca_file_t *pyscca_file );
 
+void pyscca_file_lock(
+      pyscca_file_t *pyscca_file );
+
+void pyscca_file_unlock(
+      pyscca_file_t *pyscca_file );
+
 PyObject *pyscca_file_signal_abort(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+PyObject *pyscca_file_set_parse_budget(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_set_deadline(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyscca_file_open(
            pyscca_file_t *pyscca_file,
            PyObject *arguments,
            PyObject *keywords );
 
+int pyscca_file_get_access_flags(
+     int flags,
+     PyObject *sections_object,
+     int *access_flags );
+
+int pyscca_file_open_source(
+     pyscca_file_t *pyscca_file,
+     libscca_file_t *file,
+     int access_flags );
+
+int pyscca_file_read_skipped_sections(
+     pyscca_file_t *pyscca_file,
+     int section_flags );
+
 PyObject *pyscca_file_open_file_object(
            pyscca_file_t *pyscca_file,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyscca_file_open_bytes(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_open_snapshot(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyscca_file_close(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+PyObject *pyscca_file_get_timestamps_as_integers(
+           pyscca_file_t *pyscca_file,
+           void *closure );
+
+PyObject *pyscca_file_set_timestamps_as_integers(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyscca_file_set_timestamps_as_integers_setter(
+     pyscca_file_t *pyscca_file,
+     PyObject *value_object,
+     void *closure );
+
 PyObject *pyscca_file_get_format_version(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
@@ -99,6 +225,15 @@ PyObject *pyscca_file_get_last_run_time_as_integer(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyscca_file_get_last_run_times(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_get_last_run_times_array(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
 PyObject *pyscca_file_get_run_count(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
@@ -120,10 +255,35 @@ PyObject *pyscca_file_get_file_metrics_entries(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+PyObject *pyscca_file_get_file_metrics_values(
+           pyscca_file_t *pyscca_file,
+           int values_format,
+           int raw_names );
+
+PyObject *pyscca_file_get_file_metrics_table(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_get_file_metrics_records(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_get_file_metrics_arrays(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_get_trace_chain_load_counts_array(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
 PyObject *pyscca_file_get_number_of_filenames(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+PyObject *pyscca_file_get_cached_filenames(
+           pyscca_file_t *pyscca_file );
+
 PyObject *pyscca_file_get_filename_by_index(
            PyObject *pyscca_file,
            int filename_index );
@@ -137,6 +297,55 @@ PyObject *pyscca_file_get_filenames(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+PyObject *pyscca_file_get_raw_filenames(
+           pyscca_file_t *pyscca_file );
+
+PyObject *pyscca_file_get_filenames_tuple(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyscca_file_get_snapshot_data_size(
+     pyscca_file_t *pyscca_file,
+     size_t *snapshot_size );
+
+int pyscca_file_write_snapshot_data(
+     pyscca_file_t *pyscca_file,
+     uint8_t *snapshot_data,
+     size_t snapshot_data_size );
+
+PyObject *pyscca_file_get_snapshot_size(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_write_snapshot(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_get_snapshot(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_to_shared_memory(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_reduce(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_iter_filenames(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_file_iter_file_metrics(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyscca_file_get_number_of_volumes(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
@@ -154,6 +363,18 @@ PyObject *pyscca_file_get_volumes(
            pyscca_file_t *pyscca_file,
            PyObject *arguments );
 
+PyObject *pyscca_file_get_volume_record_by_index(
+           pyscca_file_t *pyscca_file,
+           int volume_index );
+
+PyObject *pyscca_file_get_volume_records(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
+PyObject *pyscca_file_get_stats(
+           pyscca_file_t *pyscca_file,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -32,11 +32,14 @@
 
 /* Creates a file object IO handle
  * Make sure the value file_object_io_handle is referencing, is set to NULL
+ * The file object is read into memory on open if its size does not exceed
+ * the read ahead size, where 0 disables reading the file object into memory
  * Returns 1 if successful or -1 on error
  */
 int pyscca_file_object_io_handle_initialize(
      pyscca_file_object_io_handle_t **file_object_io_handle,
      PyObject *file_object,
+     size_t read_ahead_size,
      libcerror_error_t **error )
 {
 	static char *function = "pyscca_file_object_io_handle_initialize";
@@ -102,7 +105,8 @@ int pyscca_file_object_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *file_object_io_handle )->file_object = file_object;
+	( *file_object_io_handle )->file_object     = file_object;
+	( *file_object_io_handle )->read_ahead_size = read_ahead_size;
 
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
@@ -126,6 +130,7 @@ on_error:
 int pyscca_file_object_initialize(
      libbfio_handle_t **handle,
      PyObject *file_object,
+     size_t read_ahead_size,
      libcerror_error_t **error )
 {
 	pyscca_file_object_io_handle_t *file_object_io_handle = NULL;
@@ -156,6 +161,7 @@ int pyscca_file_object_initialize(
 	if( pyscca_file_object_io_handle_initialize(
 	     &file_object_io_handle,
 	     file_object,
+	     read_ahead_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -229,6 +235,11 @@ int pyscca_file_object_io_handle_free(
 	{
 		gil_state = PyGILState_Ensure();
 
+		if( ( *file_object_io_handle )->data != NULL )
+		{
+			PyMem_Free(
+			 ( *file_object_io_handle )->data );
+		}
 		Py_DecRef(
 		 ( *file_object_io_handle )->file_object );
 
@@ -284,6 +295,7 @@ int pyscca_file_object_io_handle_clone(
 	if( pyscca_file_object_io_handle_initialize(
 	     destination_file_object_io_handle,
 	     source_file_object_io_handle->file_object,
+	     source_file_object_io_handle->read_ahead_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -364,8 +376,25 @@ int pyscca_file_object_io_handle_open(
 
 		return( -1 );
 	}
-	/* No need to do anything here, because the file object is already open
+	/* No need to open the file object here, because the file object is already open
 	 */
+	if( ( file_object_io_handle->read_ahead_size > 0 )
+	 && ( file_object_io_handle->data == NULL ) )
+	{
+		if( pyscca_file_object_io_handle_read_data(
+		     file_object_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file object data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	file_object_io_handle->access_flags = access_flags;
 
 	return( 1 );
@@ -404,11 +433,174 @@ int pyscca_file_object_io_handle_close(
 	}
 	/* Do not close the file object, have Python deal with it
 	 */
+	pyscca_file_object_io_handle_free_data(
+	 file_object_io_handle );
+
 	file_object_io_handle->access_flags = 0;
 
 	return( 0 );
 }
 
+/* Reads the data of the file object into memory
+ * This replaces the individual reads from the file object by a single read
+ * Returns 1 if successful, 0 if the file object is empty or exceeds the read ahead size or -1 on error
+ */
+int pyscca_file_object_io_handle_read_data(
+     pyscca_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data              = NULL;
+	static char *function      = "pyscca_file_object_io_handle_read_data";
+	PyGILState_STATE gil_state = 0;
+	size64_t size              = 0;
+	size_t data_offset         = 0;
+	ssize_t read_count         = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file object IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_object_io_handle->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file object IO handle - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyscca_file_object_io_handle_get_size(
+	     file_object_io_handle,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file object.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) file_object_io_handle->read_ahead_size ) )
+	{
+		return( 0 );
+	}
+	gil_state = PyGILState_Ensure();
+
+	data = (uint8_t *) PyMem_Malloc(
+	                    (size_t) size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyscca_file_object_seek_offset(
+	     file_object_io_handle->file_object,
+	     0,
+	     SEEK_SET,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of file object.",
+		 function );
+
+		goto on_error;
+	}
+	while( data_offset < (size_t) size )
+	{
+		read_count = pyscca_file_object_read_buffer(
+		              file_object_io_handle->file_object,
+		              &( data[ data_offset ] ),
+		              (size_t) size - data_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		data_offset += (size_t) read_count;
+	}
+	PyGILState_Release(
+	 gil_state );
+
+	file_object_io_handle->data           = data;
+	file_object_io_handle->data_size      = data_offset;
+	file_object_io_handle->current_offset = 0;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		PyMem_Free(
+		 data );
+	}
+	PyGILState_Release(
+	 gil_state );
+
+	return( -1 );
+}
+
+/* Frees the data of the file object read into memory
+ */
+void pyscca_file_object_io_handle_free_data(
+      pyscca_file_object_io_handle_t *file_object_io_handle )
+{
+	PyGILState_STATE gil_state = 0;
+
+	if( file_object_io_handle == NULL )
+	{
+		return;
+	}
+	if( file_object_io_handle->data != NULL )
+	{
+		gil_state = PyGILState_Ensure();
+
+		PyMem_Free(
+		 file_object_io_handle->data );
+
+		PyGILState_Release(
+		 gil_state );
+
+		file_object_io_handle->data           = NULL;
+		file_object_io_handle->data_size      = 0;
+		file_object_io_handle->current_offset = 0;
+	}
+}
+
 /* Reads a buffer from the file object
  * Make sure to hold the GIL state before calling this function
  * Returns the number of bytes read if successful, or -1 on error
@@ -624,6 +816,7 @@ ssize_t pyscca_file_object_io_handle_read(
 {
 	static char *function      = "pyscca_file_object_io_handle_read";
 	PyGILState_STATE gil_state = 0;
+	size_t read_size           = 0;
 	ssize_t read_count         = 0;
 
 	if( file_object_io_handle == NULL )
@@ -637,6 +830,60 @@ ssize_t pyscca_file_object_io_handle_read(
 
 		return( -1 );
 	}
+	/* The data read into memory is accessed without the GIL
+	 */
+	if( file_object_io_handle->data != NULL )
+	{
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( file_object_io_handle->current_offset >= (off64_t) file_object_io_handle->data_size )
+		{
+			return( 0 );
+		}
+		read_size = file_object_io_handle->data_size - (size_t) file_object_io_handle->current_offset;
+
+		if( read_size > size )
+		{
+			read_size = size;
+		}
+		if( memory_copy(
+		     buffer,
+		     &( file_object_io_handle->data[ file_object_io_handle->current_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset += (off64_t) read_size;
+
+		return( (ssize_t) read_size );
+	}
 	gil_state = PyGILState_Ensure();
 
 	read_count = pyscca_file_object_read_buffer(
@@ -1152,6 +1399,42 @@ off64_t pyscca_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
+	if( file_object_io_handle->data != NULL )
+	{
+		if( whence == SEEK_CUR )
+		{
+			offset += file_object_io_handle->current_offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			offset += (off64_t) file_object_io_handle->data_size;
+		}
+		else if( whence != SEEK_SET )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported whence.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		file_object_io_handle->current_offset = offset;
+
+		return( offset );
+	}
 	gil_state = PyGILState_Ensure();
 
 	if( pyscca_file_object_seek_offset(
@@ -1401,6 +1684,23 @@ int pyscca_file_object_io_handle_get_size(
 
 		return( -1 );
 	}
+	if( file_object_io_handle->data != NULL )
+	{
+		if( size == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid size.",
+			 function );
+
+			return( -1 );
+		}
+		*size = (size64_t) file_object_io_handle->data_size;
+
+		return( 1 );
+	}
 	gil_state = PyGILState_Ensure();
 
 #if PY_MAJOR_VERSION >= 3
@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+/* The default maximum size of a file object that is read into memory on open
+ */
+#define PYSCCA_FILE_OBJECT_DEFAULT_READ_AHEAD_SIZE	( 16 * 1024 * 1024 )
+
 typedef struct pyscca_file_object_io_handle pyscca_file_object_io_handle_t;
 
 struct pyscca_file_object_io_handle
@@ -44,16 +48,36 @@ struct pyscca_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The maximum size of the file object that is read into memory on open
+	 * Contains 0 if the file object is not read into memory
+	 */
+	size_t read_ahead_size;
+
+	/* The data of the file object
+	 * Contains NULL if the file object was not read into memory
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The current offset in the data
+	 */
+	off64_t current_offset;
 };
 
 int pyscca_file_object_io_handle_initialize(
      pyscca_file_object_io_handle_t **file_object_io_handle,
      PyObject *file_object,
+     size_t read_ahead_size,
      libcerror_error_t **error );
 
 int pyscca_file_object_initialize(
      libbfio_handle_t **handle,
      PyObject *file_object,
+     size_t read_ahead_size,
      libcerror_error_t **error );
 
 int pyscca_file_object_io_handle_free(
@@ -74,6 +98,13 @@ int pyscca_file_object_io_handle_close(
      pyscca_file_object_io_handle_t *file_object_io_handle,
      libcerror_error_t **error );
 
+int pyscca_file_object_io_handle_read_data(
+     pyscca_file_object_io_handle_t *file_object_io_handle,
+     libcerror_error_t **error );
+
+void pyscca_file_object_io_handle_free_data(
+      pyscca_file_object_io_handle_t *file_object_io_handle );
+
 ssize_t pyscca_file_object_read_buffer(
          PyObject *file_object,
          uint8_t *buffer,
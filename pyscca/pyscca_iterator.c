@@ -0,0 +1,986 @@
+/*
+ * Python object definition of the filtered iterator of filenames and file metrics entries
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyscca_error.h"
+#include "pyscca_file.h"
+#include "pyscca_iterator.h"
+#include "pyscca_libcerror.h"
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+
+PyTypeObject pyscca_iterator_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyscca._iterator",
+	/* tp_basicsize */
+	sizeof( pyscca_iterator_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyscca_iterator_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyscca internal iterator object of filenames or file metrics entries",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyscca_iterator_iter,
+	/* tp_iternext */
+	(iternextfunc) pyscca_iterator_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyscca_iterator_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new iterator object
+ * The items are read on demand, if a pattern is set only the filenames or the file metrics
+ * entries with a filename that matches the pattern are returned
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_iterator_new(
+           PyObject *parent_object,
+           int iterator_type,
+           PyObject *pattern_object,
+           int case_sensitive )
+{
+	pyscca_iterator_t *iterator_object = NULL;
+	libcerror_error_t *error           = NULL;
+	libscca_file_t *file               = NULL;
+	static char *function              = "pyscca_iterator_new";
+	int number_of_items                = 0;
+	int result                         = 0;
+	int section_flags                  = 0;
+
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( iterator_type == PYSCCA_ITERATOR_TYPE_FILENAMES )
+	{
+		section_flags = LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES;
+	}
+	else if( iterator_type == PYSCCA_ITERATOR_TYPE_FILE_METRICS )
+	{
+		section_flags = LIBSCCA_ACCESS_FLAG_SKIP_FILE_METRICS | LIBSCCA_ACCESS_FLAG_SKIP_FILENAMES;
+	}
+	else
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported iterator type.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyscca_file_read_skipped_sections(
+	     (pyscca_file_t *) parent_object,
+	     section_flags ) != 1 )
+	{
+		return( NULL );
+	}
+	file = ( (pyscca_file_t *) parent_object )->file;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	if( iterator_type == PYSCCA_ITERATOR_TYPE_FILENAMES )
+	{
+		result = libscca_file_get_number_of_filenames(
+		          file,
+		          &number_of_items,
+		          &error );
+	}
+	else
+	{
+		result = libscca_file_get_number_of_file_metrics_entries(
+		          file,
+		          &number_of_items,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* Make sure the iterator values are initialized
+	 */
+	iterator_object = PyObject_New(
+	                   struct pyscca_iterator,
+	                   &pyscca_iterator_type_object );
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create iterator object.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyscca_iterator_init(
+	     iterator_object ) != 0 )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize iterator object.",
+		 function );
+
+		goto on_error;
+	}
+	iterator_object->parent_object   = parent_object;
+	iterator_object->iterator_type   = iterator_type;
+	iterator_object->number_of_items = number_of_items;
+
+	Py_IncRef(
+	 (PyObject *) iterator_object->parent_object );
+
+	if( ( pattern_object != NULL )
+	 && ( pattern_object != Py_None ) )
+	{
+		if( pyscca_iterator_set_pattern(
+		     iterator_object,
+		     pattern_object,
+		     case_sensitive ) != 1 )
+		{
+			goto on_error;
+		}
+		/* File metrics entries are filtered on the filename they reference
+		 */
+		if( iterator_type == PYSCCA_ITERATOR_TYPE_FILE_METRICS )
+		{
+			if( pyscca_iterator_read_filename_matches(
+			     iterator_object,
+			     file ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	return( (PyObject *) iterator_object );
+
+on_error:
+	if( iterator_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) iterator_object );
+	}
+	return( NULL );
+}
+
+/* Initializes an iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyscca_iterator_init(
+     pyscca_iterator_t *iterator_object )
+{
+	static char *function = "pyscca_iterator_init";
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the iterator values are initialized
+	 */
+	iterator_object->parent_object        = NULL;
+	iterator_object->iterator_type        = 0;
+	iterator_object->utf16_pattern        = NULL;
+	iterator_object->utf16_pattern_length = 0;
+	iterator_object->match_type           = 0;
+	iterator_object->match_flags          = 0;
+	iterator_object->filename_indexes     = NULL;
+	iterator_object->filename_matches     = NULL;
+	iterator_object->number_of_filenames  = 0;
+	iterator_object->current_index        = 0;
+	iterator_object->number_of_items      = 0;
+	iterator_object->utf8_string          = NULL;
+	iterator_object->utf8_string_size     = 0;
+
+	return( 0 );
+}
+
+/* Frees an iterator object
+ */
+void pyscca_iterator_free(
+      pyscca_iterator_t *iterator_object )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyscca_iterator_free";
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           iterator_object );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( iterator_object->utf8_string != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->utf8_string );
+	}
+	if( iterator_object->filename_matches != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->filename_matches );
+	}
+	if( iterator_object->filename_indexes != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->filename_indexes );
+	}
+	if( iterator_object->utf16_pattern != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->utf16_pattern );
+	}
+	if( iterator_object->parent_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) iterator_object->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) iterator_object );
+}
+
+/* Sets the pattern the filenames are matched against
+ * The pattern is a filename with an optional * at the start and end, to match
+ * filenames that end with, start with or contain the remainder of the pattern
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_iterator_set_pattern(
+     pyscca_iterator_t *iterator_object,
+     PyObject *pattern_object,
+     int case_sensitive )
+{
+	PyObject *utf16_string_object = NULL;
+	const uint8_t *utf16_stream   = NULL;
+	static char *function         = "pyscca_iterator_set_pattern";
+	Py_ssize_t utf16_stream_size  = 0;
+	size_t character_index        = 0;
+	size_t first_character_index  = 0;
+	size_t number_of_characters   = 0;
+	uint16_t utf16_character      = 0;
+	int has_leading_wildcard      = 0;
+	int has_trailing_wildcard     = 0;
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( -1 );
+	}
+	if( iterator_object->utf16_pattern != NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - UTF-16 pattern value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( PyUnicode_Check(
+	     pattern_object ) == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported pattern object type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The UTF-16 little-endian stream is converted to host byte order below
+	 */
+	utf16_string_object = PyUnicode_AsEncodedString(
+	                       pattern_object,
+	                       "utf-16-le",
+	                       NULL );
+
+	if( utf16_string_object == NULL )
+	{
+		return( -1 );
+	}
+	utf16_stream = (const uint8_t *) PyBytes_AsString(
+	                                  utf16_string_object );
+
+	utf16_stream_size = PyBytes_Size(
+	                     utf16_string_object );
+
+	if( ( utf16_stream == NULL )
+	 || ( utf16_stream_size < 0 ) )
+	{
+		goto on_error;
+	}
+	number_of_characters = (size_t) utf16_stream_size / 2;
+
+	if( ( number_of_characters > 0 )
+	 && ( utf16_stream[ 0 ] == (uint8_t) '*' )
+	 && ( utf16_stream[ 1 ] == 0 ) )
+	{
+		has_leading_wildcard  = 1;
+		first_character_index = 1;
+	}
+	if( ( number_of_characters > first_character_index )
+	 && ( utf16_stream[ ( number_of_characters - 1 ) * 2 ] == (uint8_t) '*' )
+	 && ( utf16_stream[ ( ( number_of_characters - 1 ) * 2 ) + 1 ] == 0 ) )
+	{
+		has_trailing_wildcard = 1;
+		number_of_characters -= 1;
+	}
+	number_of_characters -= first_character_index;
+
+	/* Allocate at least 1 character so that an empty pattern is valid
+	 */
+	iterator_object->utf16_pattern = (uint16_t *) PyMem_Malloc(
+	                                               sizeof( uint16_t ) * ( number_of_characters + 1 ) );
+
+	if( iterator_object->utf16_pattern == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-16 pattern.",
+		 function );
+
+		goto on_error;
+	}
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ ( first_character_index + character_index ) * 2 ] ),
+		 utf16_character );
+
+		if( utf16_character == (uint16_t) '*' )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: unsupported pattern - * is only supported at the start or end.",
+			 function );
+
+			goto on_error;
+		}
+		iterator_object->utf16_pattern[ character_index ] = utf16_character;
+	}
+	iterator_object->utf16_pattern[ number_of_characters ] = 0;
+
+	iterator_object->utf16_pattern_length = number_of_characters;
+
+	if( ( has_leading_wildcard != 0 )
+	 && ( has_trailing_wildcard != 0 ) )
+	{
+		iterator_object->match_type = LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING;
+	}
+	else if( has_leading_wildcard != 0 )
+	{
+		iterator_object->match_type = LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX;
+	}
+	else if( has_trailing_wildcard != 0 )
+	{
+		iterator_object->match_type = LIBSCCA_FILENAME_MATCH_TYPE_PREFIX;
+	}
+	else
+	{
+		iterator_object->match_type = LIBSCCA_FILENAME_MATCH_TYPE_EXACT;
+	}
+	if( case_sensitive == 0 )
+	{
+		iterator_object->match_flags = LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE;
+	}
+	Py_DecRef(
+	 utf16_string_object );
+
+	return( 1 );
+
+on_error:
+	if( iterator_object->utf16_pattern != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->utf16_pattern );
+
+		iterator_object->utf16_pattern = NULL;
+	}
+	Py_DecRef(
+	 utf16_string_object );
+
+	return( -1 );
+}
+
+/* Determines which filenames match the pattern and the filename index of every file metrics entry
+ * The filenames are matched against the strings as stored in the file, no Python objects are created
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_iterator_read_filename_matches(
+     pyscca_iterator_t *iterator_object,
+     libscca_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pyscca_iterator_read_filename_matches";
+	int filename_index        = 0;
+	int first_filename_index  = 0;
+	int number_of_filenames   = 0;
+	int result                = 0;
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( -1 );
+	}
+	if( iterator_object->utf16_pattern == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - missing UTF-16 pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( iterator_object->filename_indexes != NULL )
+	 || ( iterator_object->filename_matches != NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - filename matches value already set.",
+		 function );
+
+		return( -1 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          &number_of_filenames,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	/* Allocate at least 1 value so that files without filenames or entries are valid
+	 */
+	iterator_object->filename_matches = (uint8_t *) PyMem_Malloc(
+	                                                 sizeof( uint8_t ) * ( number_of_filenames + 1 ) );
+
+	iterator_object->filename_indexes = (int *) PyMem_Malloc(
+	                                             sizeof( int ) * ( iterator_object->number_of_items + 1 ) );
+
+	if( ( iterator_object->filename_matches == NULL )
+	 || ( iterator_object->filename_indexes == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create filename matches.",
+		 function );
+
+		goto on_error;
+	}
+	memory_set(
+	 iterator_object->filename_matches,
+	 0,
+	 sizeof( uint8_t ) * ( number_of_filenames + 1 ) );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = 1;
+
+	if( iterator_object->number_of_items > 0 )
+	{
+		result = libscca_file_get_file_metrics_table(
+		          file,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          iterator_object->filename_indexes,
+		          iterator_object->number_of_items,
+		          &error );
+	}
+	/* Every call continues after the filename that matched previously
+	 */
+	while( ( result == 1 )
+	    && ( first_filename_index < number_of_filenames ) )
+	{
+		result = libscca_file_get_next_filename_index_by_utf16_pattern(
+		          file,
+		          first_filename_index,
+		          iterator_object->utf16_pattern,
+		          iterator_object->utf16_pattern_length,
+		          iterator_object->match_type,
+		          iterator_object->match_flags,
+		          &filename_index,
+		          &error );
+
+		if( result == 1 )
+		{
+			iterator_object->filename_matches[ filename_index ] = 1;
+
+			first_filename_index = filename_index + 1;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to match filenames.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	iterator_object->number_of_filenames = number_of_filenames;
+
+	return( 1 );
+
+on_error:
+	if( iterator_object->filename_indexes != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->filename_indexes );
+
+		iterator_object->filename_indexes = NULL;
+	}
+	if( iterator_object->filename_matches != NULL )
+	{
+		PyMem_Free(
+		 iterator_object->filename_matches );
+
+		iterator_object->filename_matches = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific filename
+ * The filename is converted using the UTF-8 string of the iterator, which is reused for every filename
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_iterator_get_filename(
+           pyscca_iterator_t *iterator_object,
+           libscca_file_t *file,
+           int filename_index )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	const char *errors       = NULL;
+	static char *function    = "pyscca_iterator_get_filename";
+	uint8_t *utf8_string     = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_utf8_filename_size(
+	          file,
+	          filename_index,
+	          &utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve filename: %d size.",
+		 function,
+		 filename_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( utf8_string_size == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	if( utf8_string_size > iterator_object->utf8_string_size )
+	{
+		utf8_string = (uint8_t *) PyMem_Realloc(
+		                           iterator_object->utf8_string,
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to resize UTF-8 string.",
+			 function );
+
+			return( NULL );
+		}
+		iterator_object->utf8_string      = utf8_string;
+		iterator_object->utf8_string_size = utf8_string_size;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          filename_index,
+	          iterator_object->utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve filename: %d.",
+		 function,
+		 filename_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) iterator_object->utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 errors );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* The iterator iter() function
+ */
+PyObject *pyscca_iterator_iter(
+           pyscca_iterator_t *iterator_object )
+{
+	static char *function = "pyscca_iterator_iter";
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) iterator_object );
+
+	return( (PyObject *) iterator_object );
+}
+
+/* The iterator iternext() function
+ */
+PyObject *pyscca_iterator_iternext(
+           pyscca_iterator_t *iterator_object )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	static char *function    = "pyscca_iterator_iternext";
+	int entry_index          = 0;
+	int filename_index       = 0;
+	int result               = 0;
+
+	if( iterator_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object.",
+		 function );
+
+		return( NULL );
+	}
+	if( iterator_object->parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - missing parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( iterator_object->current_index < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid iterator object - invalid current index.",
+		 function );
+
+		return( NULL );
+	}
+	file = ( (pyscca_file_t *) iterator_object->parent_object )->file;
+
+	if( iterator_object->iterator_type == PYSCCA_ITERATOR_TYPE_FILENAMES )
+	{
+		if( iterator_object->current_index >= iterator_object->number_of_items )
+		{
+			PyErr_SetNone(
+			 PyExc_StopIteration );
+
+			return( NULL );
+		}
+		filename_index = iterator_object->current_index;
+
+		if( iterator_object->utf16_pattern != NULL )
+		{
+			Py_BEGIN_ALLOW_THREADS
+
+			result = libscca_file_get_next_filename_index_by_utf16_pattern(
+			          file,
+			          iterator_object->current_index,
+			          iterator_object->utf16_pattern,
+			          iterator_object->utf16_pattern_length,
+			          iterator_object->match_type,
+			          iterator_object->match_flags,
+			          &filename_index,
+			          &error );
+
+			Py_END_ALLOW_THREADS
+
+			if( result == -1 )
+			{
+				pyscca_error_raise(
+				 error,
+				 PyExc_IOError,
+				 "%s: unable to retrieve next matching filename index.",
+				 function );
+
+				libcerror_error_free(
+				 &error );
+
+				return( NULL );
+			}
+			else if( result == 0 )
+			{
+				iterator_object->current_index = iterator_object->number_of_items;
+
+				PyErr_SetNone(
+				 PyExc_StopIteration );
+
+				return( NULL );
+			}
+		}
+		iterator_object->current_index = filename_index + 1;
+
+		return( pyscca_iterator_get_filename(
+		         iterator_object,
+		         file,
+		         filename_index ) );
+	}
+	/* File metrics entries that do not match are skipped without creating an object
+	 */
+	while( iterator_object->current_index < iterator_object->number_of_items )
+	{
+		entry_index = iterator_object->current_index;
+
+		iterator_object->current_index += 1;
+
+		if( iterator_object->filename_indexes != NULL )
+		{
+			filename_index = iterator_object->filename_indexes[ entry_index ];
+
+			if( ( filename_index < 0 )
+			 || ( filename_index >= iterator_object->number_of_filenames )
+			 || ( iterator_object->filename_matches[ filename_index ] == 0 ) )
+			{
+				continue;
+			}
+		}
+		return( pyscca_file_get_file_metrics_entry_by_index(
+		         iterator_object->parent_object,
+		         entry_index ) );
+	}
+	PyErr_SetNone(
+	 PyExc_StopIteration );
+
+	return( NULL );
+}
+
@@ -0,0 +1,143 @@
+/*
+ * Python object definition of the filtered iterator of filenames and file metrics entries
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_ITERATOR_H )
+#define _PYSCCA_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum PYSCCA_ITERATOR_TYPES
+{
+	PYSCCA_ITERATOR_TYPE_FILENAMES		= 1,
+	PYSCCA_ITERATOR_TYPE_FILE_METRICS	= 2
+};
+
+typedef struct pyscca_iterator pyscca_iterator_t;
+
+struct pyscca_iterator
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent file object
+	 */
+	PyObject *parent_object;
+
+	/* The iterator type
+	 */
+	int iterator_type;
+
+	/* The UTF-16 pattern
+	 * Contains NULL if the items are not filtered
+	 */
+	uint16_t *utf16_pattern;
+
+	/* The UTF-16 pattern length
+	 */
+	size_t utf16_pattern_length;
+
+	/* The filename match type
+	 */
+	int match_type;
+
+	/* The filename match flags
+	 */
+	uint8_t match_flags;
+
+	/* The filename index of every file metrics entry
+	 * Contains NULL if the file metrics entries are not filtered
+	 */
+	int *filename_indexes;
+
+	/* Value per filename to indicate it matches the pattern
+	 */
+	uint8_t *filename_matches;
+
+	/* The number of filenames
+	 */
+	int number_of_filenames;
+
+	/* The current index
+	 */
+	int current_index;
+
+	/* The number of items
+	 */
+	int number_of_items;
+
+	/* The UTF-8 string that is reused for every filename
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+};
+
+extern PyTypeObject pyscca_iterator_type_object;
+
+PyObject *pyscca_iterator_new(
+           PyObject *parent_object,
+           int iterator_type,
+           PyObject *pattern_object,
+           int case_sensitive );
+
+int pyscca_iterator_init(
+     pyscca_iterator_t *iterator_object );
+
+void pyscca_iterator_free(
+      pyscca_iterator_t *iterator_object );
+
+int pyscca_iterator_set_pattern(
+     pyscca_iterator_t *iterator_object,
+     PyObject *pattern_object,
+     int case_sensitive );
+
+int pyscca_iterator_read_filename_matches(
+     pyscca_iterator_t *iterator_object,
+     libscca_file_t *file );
+
+PyObject *pyscca_iterator_get_filename(
+           pyscca_iterator_t *iterator_object,
+           libscca_file_t *file,
+           int filename_index );
+
+PyObject *pyscca_iterator_iter(
+           pyscca_iterator_t *iterator_object );
+
+PyObject *pyscca_iterator_iternext(
+           pyscca_iterator_t *iterator_object );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_ITERATOR_H ) */
+
@@ -0,0 +1,572 @@
+/*
+ * Python object wrapper of libscca_parse_cache_t
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyscca_error.h"
+#include "pyscca_file.h"
+#include "pyscca_integer.h"
+#include "pyscca_libcerror.h"
+#include "pyscca_libscca.h"
+#include "pyscca_parse_cache.h"
+#include "pyscca_python.h"
+#include "pyscca_unused.h"
+
+PyMethodDef pyscca_parse_cache_object_methods[] = {
+
+	{ "open_bytes",
+	  (PyCFunction) pyscca_parse_cache_open_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(buffer) -> Object\n"
+	  "\n"
+	  "Opens a file from an object that supports the buffer protocol using the parse cache.\n"
+	  "A file opened from identical data is shared, hence the data is only parsed once." },
+
+	{ "get_stats",
+	  (PyCFunction) pyscca_parse_cache_get_stats,
+	  METH_NOARGS,
+	  "get_stats() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the size of the cached files in bytes and the number of hits and misses." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyTypeObject pyscca_parse_cache_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyscca.parse_cache",
+	/* tp_basicsize */
+	sizeof( pyscca_parse_cache_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyscca_parse_cache_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyscca parse cache object (wraps libscca_parse_cache_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyscca_parse_cache_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyscca_parse_cache_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Initializes a parse cache object
+ * Returns 0 if successful or -1 on error
+ */
+int pyscca_parse_cache_init(
+     pyscca_parse_cache_t *pyscca_parse_cache,
+     PyObject *arguments,
+     PyObject *keywords )
+{
+	libcerror_error_t *error        = NULL;
+	static char *function           = "pyscca_parse_cache_init";
+	static char *keyword_list[]     = { "maximum_size", NULL };
+	unsigned long long maximum_size = PYSCCA_PARSE_CACHE_DEFAULT_MAXIMUM_SIZE;
+
+	if( pyscca_parse_cache == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libscca parse cache is set to NULL
+	 */
+	pyscca_parse_cache->parse_cache = NULL;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|K",
+	     keyword_list,
+	     &maximum_size ) == 0 )
+	{
+		return( -1 );
+	}
+	if( libscca_parse_cache_initialize(
+	     &( pyscca_parse_cache->parse_cache ),
+	     (size64_t) maximum_size,
+	     &error ) != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to initialize parse cache.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Frees a parse cache object
+ * The file objects opened from the parse cache keep a reference to it,
+ * hence they have been released at this point
+ */
+void pyscca_parse_cache_free(
+      pyscca_parse_cache_t *pyscca_parse_cache )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyscca_parse_cache_free";
+	int result                  = 0;
+
+	if( pyscca_parse_cache == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyscca_parse_cache );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyscca_parse_cache->parse_cache != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libscca_parse_cache_free(
+		          &( pyscca_parse_cache->parse_cache ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyscca_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libscca parse cache.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyscca_parse_cache );
+}
+
+/* Opens a file from an object that supports the buffer protocol using the parse cache
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_parse_cache_open_bytes(
+           pyscca_parse_cache_t *pyscca_parse_cache,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer buffer;
+
+	PyObject *buffer_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	libscca_file_t *file        = NULL;
+	pyscca_file_t *pyscca_file  = NULL;
+	static char *function       = "pyscca_parse_cache_open_bytes";
+	static char *keyword_list[] = { "buffer", NULL };
+	int result                  = 0;
+
+	if( pyscca_parse_cache == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &buffer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	/* The parse cache copies the data, hence the buffer is released after the open
+	 */
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_parse_cache_open_memory(
+	          pyscca_parse_cache->parse_cache,
+	          (const uint8_t *) buffer.buf,
+	          (size_t) buffer.len,
+	          &file,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(
+	 &buffer );
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyscca_file = PyObject_New(
+	               struct pyscca_file,
+	               &pyscca_file_type_object );
+
+	if( pyscca_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( pyscca_file_init(
+	     pyscca_file ) != 0 )
+	{
+		goto on_error;
+	}
+	/* The file object uses the shared file, pyscca_file_init does not create a libscca file
+	 */
+	pyscca_file->file         = file;
+	pyscca_file->access_flags = LIBSCCA_OPEN_READ;
+
+	/* The file object keeps a reference to the parse cache object
+	 * so that the parse cache is freed after the file was released
+	 */
+	Py_IncRef(
+	 (PyObject *) pyscca_parse_cache );
+
+	pyscca_file->parse_cache_object = (PyObject *) pyscca_parse_cache;
+
+	return( (PyObject *) pyscca_file );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_parse_cache_release_file(
+		 pyscca_parse_cache->parse_cache,
+		 &file,
+		 NULL );
+	}
+	if( pyscca_file != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyscca_file );
+	}
+	return( NULL );
+}
+
+/* Releases a file opened using the parse cache
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_parse_cache_release_file(
+     pyscca_parse_cache_t *pyscca_parse_cache,
+     libscca_file_t **file )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyscca_parse_cache_release_file";
+	int result               = 0;
+
+	if( pyscca_parse_cache == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( -1 );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_parse_cache_release_file(
+	          pyscca_parse_cache->parse_cache,
+	          file,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to release file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the parse cache statistics
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_parse_cache_get_stats(
+           pyscca_parse_cache_t *pyscca_parse_cache,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *dictionary_object = NULL;
+	PyObject *value_object      = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyscca_parse_cache_get_stats";
+	size64_t size               = 0;
+	uint64_t number_of_hits     = 0;
+	uint64_t number_of_misses   = 0;
+	int result                  = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_parse_cache == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parse cache.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_parse_cache_get_statistics(
+	          pyscca_parse_cache->parse_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	dictionary_object = PyDict_New();
+
+	if( dictionary_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary object.",
+		 function );
+
+		return( NULL );
+	}
+	value_object = pyscca_integer_unsigned_new_from_64bit(
+	                (uint64_t) size );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	/* PyDict_SetItemString does not steal the reference to the value object
+	 */
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "size",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = pyscca_integer_unsigned_new_from_64bit(
+	                number_of_hits );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "hits",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	value_object = pyscca_integer_unsigned_new_from_64bit(
+	                number_of_misses );
+
+	if( value_object == NULL )
+	{
+		goto on_error;
+	}
+	if( PyDict_SetItemString(
+	     dictionary_object,
+	     "misses",
+	     value_object ) != 0 )
+	{
+		goto on_error;
+	}
+	Py_DecRef(
+	 value_object );
+
+	return( dictionary_object );
+
+on_error:
+	if( value_object != NULL )
+	{
+		Py_DecRef(
+		 value_object );
+	}
+	Py_DecRef(
+	 dictionary_object );
+
+	return( NULL );
+}
+
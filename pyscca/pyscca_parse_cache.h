@@ -0,0 +1,81 @@
+/*
+ * Python object wrapper of libscca_parse_cache_t
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_PARSE_CACHE_H )
+#define _PYSCCA_PARSE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_libscca.h"
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum size of the parse cache
+ */
+#define PYSCCA_PARSE_CACHE_DEFAULT_MAXIMUM_SIZE	( 64 * 1024 * 1024 )
+
+typedef struct pyscca_parse_cache pyscca_parse_cache_t;
+
+struct pyscca_parse_cache
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libscca parse cache
+	 */
+	libscca_parse_cache_t *parse_cache;
+};
+
+extern PyMethodDef pyscca_parse_cache_object_methods[];
+extern PyTypeObject pyscca_parse_cache_type_object;
+
+int pyscca_parse_cache_init(
+     pyscca_parse_cache_t *pyscca_parse_cache,
+     PyObject *arguments,
+     PyObject *keywords );
+
+void pyscca_parse_cache_free(
+      pyscca_parse_cache_t *pyscca_parse_cache );
+
+PyObject *pyscca_parse_cache_open_bytes(
+           pyscca_parse_cache_t *pyscca_parse_cache,
+           PyObject *arguments,
+           PyObject *keywords );
+
+int pyscca_parse_cache_release_file(
+     pyscca_parse_cache_t *pyscca_parse_cache,
+     libscca_file_t **file );
+
+PyObject *pyscca_parse_cache_get_stats(
+           pyscca_parse_cache_t *pyscca_parse_cache,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_PARSE_CACHE_H ) */
+
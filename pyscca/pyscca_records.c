@@ -0,0 +1,138 @@
+/*
+ * Record types of bulk values
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_python.h"
+#include "pyscca_records.h"
+
+/* The fields of a file metrics record
+ */
+PyStructSequence_Field pyscca_file_metrics_record_fields[ PYSCCA_FILE_METRICS_RECORD_NUMBER_OF_FIELDS + 1 ] = {
+	{ "start_time", "The start time in milliseconds" },
+	{ "duration", "The duration in milliseconds" },
+	{ "flags", "The flags" },
+	{ "file_reference", "The file reference or 0 if not set" },
+	{ "filename", "The filename or None if not available" },
+	{ NULL, NULL } };
+
+PyStructSequence_Desc pyscca_file_metrics_record_description = {
+	"pyscca.file_metrics_record",
+	"pyscca file metrics record\n"
+	"\n"
+	"The values of a file metrics entry, which are retrieved in a single pass.",
+	pyscca_file_metrics_record_fields,
+	PYSCCA_FILE_METRICS_RECORD_NUMBER_OF_FIELDS };
+
+/* The fields of a volume record
+ */
+PyStructSequence_Field pyscca_volume_record_fields[ PYSCCA_VOLUME_RECORD_NUMBER_OF_FIELDS + 1 ] = {
+	{ "device_path", "The device path or None if not available" },
+	{ "creation_time", "The creation date and time" },
+	{ "serial_number", "The serial number" },
+	{ "file_references", "The file references as a tuple of integers" },
+	{ "directory_strings", "The directory strings as a tuple of Unicode strings" },
+	{ NULL, NULL } };
+
+PyStructSequence_Desc pyscca_volume_record_description = {
+	"pyscca.volume_record",
+	"pyscca volume record\n"
+	"\n"
+	"The values of a volume information, which are retrieved in a single pass.",
+	pyscca_volume_record_fields,
+	PYSCCA_VOLUME_RECORD_NUMBER_OF_FIELDS };
+
+/* The record type objects are initialized by pyscca_records_ready
+ */
+PyTypeObject pyscca_file_metrics_record_type_object;
+PyTypeObject pyscca_volume_record_type_object;
+
+/* Readies the record type objects
+ * A record is a tuple subclass, hence reading a field is a tuple index
+ * and does not call into libscca
+ * Returns 1 if successful or -1 on error
+ */
+int pyscca_records_ready(
+     void )
+{
+#if PY_MAJOR_VERSION >= 3
+	if( PyStructSequence_InitType2(
+	     &pyscca_file_metrics_record_type_object,
+	     &pyscca_file_metrics_record_description ) != 0 )
+	{
+		return( -1 );
+	}
+	if( PyStructSequence_InitType2(
+	     &pyscca_volume_record_type_object,
+	     &pyscca_volume_record_description ) != 0 )
+	{
+		return( -1 );
+	}
+#else
+	PyStructSequence_InitType(
+	 &pyscca_file_metrics_record_type_object,
+	 &pyscca_file_metrics_record_description );
+
+	PyStructSequence_InitType(
+	 &pyscca_volume_record_type_object,
+	 &pyscca_volume_record_description );
+
+	if( PyErr_Occurred() != NULL )
+	{
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Creates a new string object from an UTF-16 little-endian stream
+ * A trailing end-of-string character is not part of the string
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_records_new_string_from_utf16_stream(
+           const uint8_t *utf16_stream,
+           size_t utf16_stream_size )
+{
+	int byte_order = -1;
+
+	if( ( utf16_stream == NULL )
+	 || ( utf16_stream_size < 2 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	utf16_stream_size &= ~( (size_t) 1 );
+
+	if( ( utf16_stream[ utf16_stream_size - 2 ] == 0 )
+	 && ( utf16_stream[ utf16_stream_size - 1 ] == 0 ) )
+	{
+		utf16_stream_size -= 2;
+	}
+	return( PyUnicode_DecodeUTF16(
+	         (const char *) utf16_stream,
+	         (Py_ssize_t) utf16_stream_size,
+	         NULL,
+	         &byte_order ) );
+}
+
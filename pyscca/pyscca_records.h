@@ -0,0 +1,57 @@
+/*
+ * Record types of bulk values
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYSCCA_RECORDS_H )
+#define _PYSCCA_RECORDS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyscca_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of fields of a file metrics record
+ */
+#define PYSCCA_FILE_METRICS_RECORD_NUMBER_OF_FIELDS	5
+
+/* The number of fields of a volume record
+ */
+#define PYSCCA_VOLUME_RECORD_NUMBER_OF_FIELDS		5
+
+extern PyTypeObject pyscca_file_metrics_record_type_object;
+extern PyTypeObject pyscca_volume_record_type_object;
+
+int pyscca_records_ready(
+     void );
+
+PyObject *pyscca_records_new_string_from_utf16_stream(
+           const uint8_t *utf16_stream,
+           size_t utf16_stream_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYSCCA_RECORDS_H ) */
+
@@ -28,6 +28,8 @@
 
 #include "pyscca_datetime.h"
 #include "pyscca_error.h"
+#include "pyscca_file.h"
+#include "pyscca_filenames.h"
 #include "pyscca_integer.h"
 #include "pyscca_libcerror.h"
 #include "pyscca_libscca.h"
@@ -40,7 +42,7 @@ PyMethodDef pyscca_volume_information_object_methods[] = {
 	{ "get_creation_time",
 	  (PyCFunction) pyscca_volume_information_get_creation_time,
 	  METH_NOARGS,
-	  "get_creation_time() -> Datetime\n"
+	  "get_creation_time() -> Datetime or Integer\n"
 	  "\n"
 	  "Retrieves the volume creation date and time." },
 
@@ -65,6 +67,34 @@ PyMethodDef pyscca_volume_information_object_methods[] = {
 	  "\n"
 	  "Retrieves the device path." },
 
+	{ "get_number_of_file_references",
+	  (PyCFunction) pyscca_volume_information_get_number_of_file_references,
+	  METH_NOARGS,
+	  "get_number_of_file_references() -> Integer or None\n"
+	  "\n"
+	  "Retrieves the number of file references." },
+
+	{ "get_file_references",
+	  (PyCFunction) pyscca_volume_information_get_file_references,
+	  METH_NOARGS,
+	  "get_file_references() -> List of integers\n"
+	  "\n"
+	  "Retrieves the 64-bit NTFS file references." },
+
+	{ "get_number_of_directory_strings",
+	  (PyCFunction) pyscca_volume_information_get_number_of_directory_strings,
+	  METH_NOARGS,
+	  "get_number_of_directory_strings() -> Integer or None\n"
+	  "\n"
+	  "Retrieves the number of directory strings." },
+
+	{ "get_directory_string",
+	  (PyCFunction) pyscca_volume_information_get_directory_string,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_directory_string(directory_string_index) -> Unicode string or None\n"
+	  "\n"
+	  "Retrieves the directory string specified by the index." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -89,6 +119,30 @@ PyGetSetDef pyscca_volume_information_object_get_set_definitions[] = {
 	  "The device path.",
 	  NULL },
 
+	{ "number_of_file_references",
+	  (getter) pyscca_volume_information_get_number_of_file_references,
+	  (setter) 0,
+	  "The number of file references.",
+	  NULL },
+
+	{ "file_references",
+	  (getter) pyscca_volume_information_get_file_references,
+	  (setter) 0,
+	  "The 64-bit NTFS file references.",
+	  NULL },
+
+	{ "number_of_directory_strings",
+	  (getter) pyscca_volume_information_get_number_of_directory_strings,
+	  (setter) 0,
+	  "The number of directory strings.",
+	  NULL },
+
+	{ "directory_strings",
+	  (getter) pyscca_volume_information_get_directory_strings,
+	  (setter) 0,
+	  "The directory strings.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -394,9 +448,22 @@ PyObject *pyscca_volume_information_get_creation_time(
 
 		return( Py_None );
 	}
-	datetime_object = pyscca_datetime_new_from_filetime(
-	                   filetime );
-
+	/* The timestamps as integers mode of the file is honoured at the time of the call
+	 */
+	if( ( pyscca_volume_information->parent_object != NULL )
+	 && ( PyObject_TypeCheck(
+	       pyscca_volume_information->parent_object,
+	       &pyscca_file_type_object ) )
+	 && ( ( (pyscca_file_t *) pyscca_volume_information->parent_object )->timestamps_as_integers != 0 ) )
+	{
+		datetime_object = pyscca_integer_unsigned_new_from_64bit(
+		                   filetime );
+	}
+	else
+	{
+		datetime_object = pyscca_datetime_new_from_filetime(
+		                   filetime );
+	}
 	return( datetime_object );
 }
 
@@ -633,3 +700,466 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the number of file references
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_volume_information_get_number_of_file_references(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object      = NULL;
+	libcerror_error_t *error      = NULL;
+	static char *function         = "pyscca_volume_information_get_number_of_file_references";
+	int number_of_file_references = 0;
+	int result                    = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_volume_information == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_get_number_of_file_references(
+	          pyscca_volume_information->volume_information,
+	          &number_of_file_references,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file references.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_file_references );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_file_references );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves the file references
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_volume_information_get_file_references(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object      = NULL;
+	PyObject *list_object         = NULL;
+	libcerror_error_t *error      = NULL;
+	uint64_t *file_references     = NULL;
+	static char *function         = "pyscca_volume_information_get_file_references";
+	int file_reference_index      = 0;
+	int number_of_file_references = 0;
+	int result                    = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_volume_information == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_get_number_of_file_references(
+	          pyscca_volume_information->volume_information,
+	          &number_of_file_references,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of file references.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_file_references );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_file_references == 0 )
+	{
+		return( list_object );
+	}
+	file_references = (uint64_t *) PyMem_Malloc(
+	                                sizeof( uint64_t ) * number_of_file_references );
+
+	if( file_references == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file references.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_copy_file_references(
+	          pyscca_volume_information->volume_information,
+	          file_references,
+	          number_of_file_references,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file references.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( file_reference_index = 0;
+	     file_reference_index < number_of_file_references;
+	     file_reference_index++ )
+	{
+		integer_object = pyscca_integer_unsigned_new_from_64bit(
+		                  file_references[ file_reference_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SetItem steals the reference to the integer object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) file_reference_index,
+		 integer_object );
+	}
+	PyMem_Free(
+	 file_references );
+
+	return( list_object );
+
+on_error:
+	if( file_references != NULL )
+	{
+		PyMem_Free(
+		 file_references );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves the number of directory strings
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_volume_information_get_number_of_directory_strings(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object        = NULL;
+	libcerror_error_t *error        = NULL;
+	static char *function           = "pyscca_volume_information_get_number_of_directory_strings";
+	int number_of_directory_strings = 0;
+	int result                      = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_volume_information == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_get_number_of_directory_strings(
+	          pyscca_volume_information->volume_information,
+	          &number_of_directory_strings,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of directory strings.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_directory_strings );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_directory_strings );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific directory string by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_volume_information_get_directory_string_by_index(
+           PyObject *pyscca_volume_information,
+           int directory_string_index )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	uint8_t *utf8_string     = NULL;
+	const char *errors       = NULL;
+	static char *function    = "pyscca_volume_information_get_directory_string_by_index";
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	if( pyscca_volume_information == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_get_utf8_directory_string_size(
+	          ( (pyscca_volume_information_t *) pyscca_volume_information )->volume_information,
+	          directory_string_index,
+	          &utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine size of directory string: %d as UTF-8 string.",
+		 function,
+		 directory_string_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( utf8_string_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	utf8_string = (uint8_t *) PyMem_Malloc(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_get_utf8_directory_string(
+	          ( (pyscca_volume_information_t *) pyscca_volume_information )->volume_information,
+	          directory_string_index,
+	          utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve directory string: %d as UTF-8 string.",
+		 function,
+		 directory_string_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 errors );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	return( string_object );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( NULL );
+}
+
+/* Retrieves a specific directory string
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_volume_information_get_directory_string(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object     = NULL;
+	static char *keyword_list[] = { "directory_string_index", NULL };
+	int directory_string_index  = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &directory_string_index ) == 0 )
+	{
+		return( NULL );
+	}
+	string_object = pyscca_volume_information_get_directory_string_by_index(
+	                 (PyObject *) pyscca_volume_information,
+	                 directory_string_index );
+
+	return( string_object );
+}
+
+/* Retrieves a sequence and iterator object for the directory strings
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyscca_volume_information_get_directory_strings(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments PYSCCA_ATTRIBUTE_UNUSED )
+{
+	PyObject *sequence_object       = NULL;
+	libcerror_error_t *error        = NULL;
+	static char *function           = "pyscca_volume_information_get_directory_strings";
+	int number_of_directory_strings = 0;
+	int result                      = 0;
+
+	PYSCCA_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyscca_volume_information == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume information.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libscca_volume_information_get_number_of_directory_strings(
+	          pyscca_volume_information->volume_information,
+	          &number_of_directory_strings,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyscca_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of directory strings.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	sequence_object = pyscca_filenames_new(
+	                   (PyObject *) pyscca_volume_information,
+	                   &pyscca_volume_information_get_directory_string_by_index,
+	                   number_of_directory_strings );
+
+	if( sequence_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sequence object.",
+		 function );
+
+		return( NULL );
+	}
+	return( sequence_object );
+}
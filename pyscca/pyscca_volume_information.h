@@ -78,6 +78,31 @@ PyObject *pyscca_volume_information_get_device_path(
            pyscca_volume_information_t *pyscca_volume_information,
            PyObject *arguments );
 
+PyObject *pyscca_volume_information_get_number_of_file_references(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments );
+
+PyObject *pyscca_volume_information_get_file_references(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments );
+
+PyObject *pyscca_volume_information_get_number_of_directory_strings(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments );
+
+PyObject *pyscca_volume_information_get_directory_string_by_index(
+           PyObject *pyscca_volume_information,
+           int directory_string_index );
+
+PyObject *pyscca_volume_information_get_directory_string(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyscca_volume_information_get_directory_strings(
+           pyscca_volume_information_t *pyscca_volume_information,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -1,7 +1,10 @@
 #!/bin/bash
 # Script that runs the tests
 #
-# Version: 20190103
+# Version: 20201014
+#
+# When run with --performance only the performance regression test is run,
+# refer to tests/test_performance.sh for its settings.
 
 EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
@@ -172,6 +175,38 @@ run_configure_make_check_python()
 	return ${EXIT_SUCCESS};
 }
 
+run_configure_make_check_performance()
+{
+	run_configure_make $@;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		return ${RESULT};
+	fi
+
+	(cd bench && make scca_bench scca_generate > /dev/null);
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Running: 'make scca_bench scca_generate' in bench failed";
+
+		return ${RESULT};
+	fi
+
+	(cd tests && CHECK_WITH_PERFORMANCE=1 ./test_performance.sh);
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS} && test ${RESULT} -ne 77;
+	then
+		echo "Running: 'test_performance.sh' failed";
+
+		return ${RESULT};
+	fi
+	return ${EXIT_SUCCESS};
+}
+
 run_setup_py_tests()
 {
 	# Skip this test when running Cygwin on AppVeyor.
@@ -236,6 +271,20 @@ then
 	PYTHON_CONFIG=`/usr/bin/whereis python-config | sed 's/^.*:[ ]*//' 2> /dev/null`;
 fi
 
+if test "$1" = "--performance";
+then
+	# Test the performance against the stored baseline.
+
+	run_configure_make_check_performance;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		exit ${EXIT_FAILURE};
+	fi
+	exit ${EXIT_SUCCESS};
+fi
+
 # Test "./configure && make && make check" without options.
 
 run_configure_make_check;
@@ -0,0 +1,2836 @@
+/*
+ * Archive handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "archive_handle.h"
+#include "deflate_stream.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+
+/* Creates an archive handle
+ * Make sure the value archive_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_initialize(
+     archive_handle_t **archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_initialize";
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *archive_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid archive handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*archive_handle = memory_allocate_structure(
+	                   archive_handle_t );
+
+	if( *archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create archive handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *archive_handle,
+	     0,
+	     sizeof( archive_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear archive handle.",
+		 function );
+
+		memory_free(
+		 *archive_handle );
+
+		*archive_handle = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &( ( *archive_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( deflate_stream_initialize(
+	     &( ( *archive_handle )->deflate_stream ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	( *archive_handle )->read_buffer = (uint8_t *) memory_allocate(
+	                                                sizeof( uint8_t ) * ARCHIVE_HANDLE_READ_BUFFER_SIZE );
+
+	if( ( *archive_handle )->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *archive_handle != NULL )
+	{
+		if( ( *archive_handle )->deflate_stream != NULL )
+		{
+			deflate_stream_free(
+			 &( ( *archive_handle )->deflate_stream ),
+			 NULL );
+		}
+		if( ( *archive_handle )->input_file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *archive_handle )->input_file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *archive_handle );
+
+		*archive_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an archive handle
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_free(
+     archive_handle_t **archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_free";
+	int result            = 1;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *archive_handle != NULL )
+	{
+		if( ( *archive_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *archive_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *archive_handle )->deflate_stream != NULL )
+		{
+			if( deflate_stream_free(
+			     &( ( *archive_handle )->deflate_stream ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free deflate stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *archive_handle )->read_buffer != NULL )
+		{
+			memory_free(
+			 ( *archive_handle )->read_buffer );
+		}
+		if( ( *archive_handle )->member_data != NULL )
+		{
+			memory_free(
+			 ( *archive_handle )->member_data );
+		}
+		memory_free(
+		 *archive_handle );
+
+		*archive_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the archive handle to abort
+ * Reading stops after the current member
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_signal_abort(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_signal_abort";
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_open_input(
+     archive_handle_t *archive_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "archive_handle_open_input";
+	size_t filename_length = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     archive_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     archive_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     archive_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     archive_handle->input_file_io_handle,
+	     &( archive_handle->input_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve input size.",
+		 function );
+
+		goto on_error;
+	}
+	if( archive_handle_determine_archive_type(
+	     archive_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported archive type.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libbfio_handle_close(
+	 archive_handle->input_file_io_handle,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int archive_handle_close_input(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_close_input";
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     archive_handle->input_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->input_size   = 0;
+	archive_handle->archive_type = ARCHIVE_HANDLE_ARCHIVE_TYPE_UNKNOWN;
+
+	return( 0 );
+}
+
+/* Determines the archive type from the start of the input
+ * Returns 1 if successful, 0 if the archive type is not supported or -1 on error
+ */
+int archive_handle_determine_archive_type(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_determine_archive_type";
+	size_t read_size      = ARCHIVE_HANDLE_TAR_BLOCK_SIZE;
+	ssize_t read_count    = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->archive_type = ARCHIVE_HANDLE_ARCHIVE_TYPE_UNKNOWN;
+
+	if( archive_handle->input_size < (size64_t) read_size )
+	{
+		read_size = (size_t) archive_handle->input_size;
+	}
+	if( read_size < 4 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_seek_offset(
+	     archive_handle->input_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of input.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              archive_handle->input_file_io_handle,
+	              archive_handle->read_buffer,
+	              read_size,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read start of input.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( archive_handle->read_buffer[ 0 ] == 0x1f )
+	 && ( archive_handle->read_buffer[ 1 ] == 0x8b ) )
+	{
+		archive_handle->archive_type = ARCHIVE_HANDLE_ARCHIVE_TYPE_TAR_GZIP;
+	}
+	else if( ( memory_compare(
+	            archive_handle->read_buffer,
+	            "PK\x03\x04",
+	            4 ) == 0 )
+	      || ( memory_compare(
+	            archive_handle->read_buffer,
+	            "PK\x05\x06",
+	            4 ) == 0 ) )
+	{
+		archive_handle->archive_type = ARCHIVE_HANDLE_ARCHIVE_TYPE_ZIP;
+	}
+	else if( ( read_size == ARCHIVE_HANDLE_TAR_BLOCK_SIZE )
+	      && ( archive_handle_tar_header_is_valid(
+	            archive_handle->read_buffer ) != 0 ) )
+	{
+		archive_handle->archive_type = ARCHIVE_HANDLE_ARCHIVE_TYPE_TAR;
+	}
+	if( archive_handle->archive_type == ARCHIVE_HANDLE_ARCHIVE_TYPE_UNKNOWN )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the prefetch members of the archive
+ * The member callback function is called for every member with a .pf extension
+ * with the uncompressed member data, which is only valid during the call
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_read_members(
+     archive_handle_t *archive_handle,
+     int (*member_callback_function)(
+            const char *member_name,
+            const uint8_t *member_data,
+            size_t member_data_size,
+            void *callback_arguments,
+            libcerror_error_t **error ),
+     void *member_callback_arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_read_members";
+	int result            = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member callback function.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->member_callback_function  = member_callback_function;
+	archive_handle->member_callback_arguments = member_callback_arguments;
+	archive_handle->number_of_members         = 0;
+	archive_handle->number_of_failed_members  = 0;
+
+	switch( archive_handle->archive_type )
+	{
+		case ARCHIVE_HANDLE_ARCHIVE_TYPE_TAR:
+			result = archive_handle_read_tar(
+			          archive_handle,
+			          error );
+			break;
+
+		case ARCHIVE_HANDLE_ARCHIVE_TYPE_TAR_GZIP:
+			result = archive_handle_read_tar_gzip(
+			          archive_handle,
+			          error );
+			break;
+
+		case ARCHIVE_HANDLE_ARCHIVE_TYPE_ZIP:
+			result = archive_handle_read_zip(
+			          archive_handle,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported archive type.",
+			 function );
+
+			result = -1;
+			break;
+	}
+	archive_handle->member_callback_function  = NULL;
+	archive_handle->member_callback_arguments = NULL;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read archive members.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a member name has a prefetch file extension
+ * The name size includes the end-of-string character
+ * Returns 1 if the name ends with .pf, 0 if not
+ */
+int archive_handle_name_has_prefetch_extension(
+     const char *name,
+     size_t name_size )
+{
+	size_t name_length = 0;
+
+	if( ( name == NULL )
+	 || ( name_size < 1 ) )
+	{
+		return( 0 );
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	if( name_length > ( name_size - 1 ) )
+	{
+		name_length = name_size - 1;
+	}
+	if( name_length < 4 )
+	{
+		return( 0 );
+	}
+	if( ( name[ name_length - 3 ] != '.' )
+	 || ( ( name[ name_length - 2 ] != 'p' )
+	  &&  ( name[ name_length - 2 ] != 'P' ) )
+	 || ( ( name[ name_length - 1 ] != 'f' )
+	  &&  ( name[ name_length - 1 ] != 'F' ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Sets the member name from a name and an optional prefix
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_set_member_name(
+     archive_handle_t *archive_handle,
+     const char *name,
+     size_t name_length,
+     const char *prefix,
+     size_t prefix_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "archive_handle_set_member_name";
+	size_t member_name_size = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( prefix == NULL )
+	 && ( prefix_length != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix.",
+		 function );
+
+		return( -1 );
+	}
+	member_name_size = name_length + 1;
+
+	if( prefix_length > 0 )
+	{
+		member_name_size += prefix_length + 1;
+	}
+	if( ( name_length >= ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE )
+	 || ( prefix_length >= ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE )
+	 || ( member_name_size > ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid member name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	member_name_size = 0;
+
+	if( prefix_length > 0 )
+	{
+		if( memory_copy(
+		     archive_handle->member_name,
+		     prefix,
+		     prefix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix.",
+			 function );
+
+			return( -1 );
+		}
+		member_name_size = prefix_length;
+
+		archive_handle->member_name[ member_name_size++ ] = '/';
+	}
+	if( memory_copy(
+	     &( archive_handle->member_name[ member_name_size ] ),
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	member_name_size += name_length;
+
+	archive_handle->member_name[ member_name_size++ ] = 0;
+
+	archive_handle->member_name_size = member_name_size;
+
+	return( 1 );
+}
+
+/* Resizes the member data to contain the data of a member
+ * The member data is retained and only grows, the member data size is reset
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_resize_member_data(
+     archive_handle_t *archive_handle,
+     size_t member_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_resize_member_data";
+	uint8_t *member_data  = NULL;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_data_size > (size_t) ARCHIVE_HANDLE_MAXIMUM_MEMBER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid member data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_data_size > archive_handle->allocated_member_data_size )
+	{
+		member_data = (uint8_t *) memory_reallocate(
+		                           archive_handle->member_data,
+		                           sizeof( uint8_t ) * member_data_size );
+
+		if( member_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize member data.",
+			 function );
+
+			return( -1 );
+		}
+		archive_handle->member_data                = member_data;
+		archive_handle->allocated_member_data_size = member_data_size;
+	}
+	archive_handle->member_data_size = 0;
+
+	return( 1 );
+}
+
+/* Appends data to the member data
+ * This function is also used as the output callback function of the deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_append_member_data(
+     const uint8_t *data,
+     size_t data_size,
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_append_member_data";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( archive_handle->allocated_member_data_size - archive_handle->member_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: member data exceeds member size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     &( archive_handle->member_data[ archive_handle->member_data_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy member data.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->member_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Determines if a tar header has a valid checksum
+ * Returns 1 if valid, 0 if not
+ */
+int archive_handle_tar_header_is_valid(
+     const uint8_t *tar_header )
+{
+	uint32_t calculated_checksum = 0;
+	uint32_t stored_checksum     = 0;
+	size_t header_offset         = 0;
+
+	if( tar_header == NULL )
+	{
+		return( 0 );
+	}
+	for( header_offset = 0;
+	     header_offset < ARCHIVE_HANDLE_TAR_BLOCK_SIZE;
+	     header_offset++ )
+	{
+		/* The checksum is calculated with the checksum field filled with spaces
+		 */
+		if( ( header_offset >= 148 )
+		 && ( header_offset < 156 ) )
+		{
+			calculated_checksum += (uint32_t) ' ';
+		}
+		else
+		{
+			calculated_checksum += (uint32_t) tar_header[ header_offset ];
+		}
+	}
+	header_offset = 148;
+
+	while( ( header_offset < 156 )
+	    && ( tar_header[ header_offset ] == (uint8_t) ' ' ) )
+	{
+		header_offset++;
+	}
+	if( ( header_offset >= 156 )
+	 || ( tar_header[ header_offset ] < (uint8_t) '0' )
+	 || ( tar_header[ header_offset ] > (uint8_t) '7' ) )
+	{
+		return( 0 );
+	}
+	while( header_offset < 156 )
+	{
+		if( ( tar_header[ header_offset ] < (uint8_t) '0' )
+		 || ( tar_header[ header_offset ] > (uint8_t) '7' ) )
+		{
+			break;
+		}
+		stored_checksum <<= 3;
+		stored_checksum  |= (uint32_t) ( tar_header[ header_offset ] - (uint8_t) '0' );
+
+		header_offset++;
+	}
+	if( ( header_offset < 156 )
+	 && ( tar_header[ header_offset ] != 0 )
+	 && ( tar_header[ header_offset ] != (uint8_t) ' ' ) )
+	{
+		return( 0 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a tar numeric field
+ * The field contains either an octal string or a base-256 number,
+ * which is indicated by the most significant bit of the first byte
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_tar_read_number(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_tar_read_number";
+	size_t data_offset    = 0;
+	uint64_t safe_value   = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data[ 0 ] & 0x80 ) != 0 )
+	{
+		safe_value = (uint64_t) ( data[ 0 ] & 0x7f );
+
+		for( data_offset = 1;
+		     data_offset < data_size;
+		     data_offset++ )
+		{
+			if( ( safe_value >> 56 ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			safe_value <<= 8;
+			safe_value  |= (uint64_t) data[ data_offset ];
+		}
+	}
+	else
+	{
+		while( ( data_offset < data_size )
+		    && ( data[ data_offset ] == (uint8_t) ' ' ) )
+		{
+			data_offset++;
+		}
+		while( data_offset < data_size )
+		{
+			if( ( data[ data_offset ] == 0 )
+			 || ( data[ data_offset ] == (uint8_t) ' ' ) )
+			{
+				break;
+			}
+			if( ( data[ data_offset ] < (uint8_t) '0' )
+			 || ( data[ data_offset ] > (uint8_t) '7' ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character in octal value.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( safe_value >> 61 ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			safe_value <<= 3;
+			safe_value  |= (uint64_t) ( data[ data_offset ] - (uint8_t) '0' );
+
+			data_offset++;
+		}
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
+/* Reads the tar header of the next member
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_tar_read_header(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_tar_read_header";
+	size_t header_offset  = 0;
+	size_t name_length    = 0;
+	size_t prefix_length  = 0;
+	uint64_t member_size  = 0;
+	uint8_t type_flag     = 0;
+	int result            = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( header_offset = 0;
+	     header_offset < ARCHIVE_HANDLE_TAR_BLOCK_SIZE;
+	     header_offset++ )
+	{
+		if( archive_handle->tar_header[ header_offset ] != 0 )
+		{
+			break;
+		}
+	}
+	/* The end of the archive is marked by a block filled with 0-byte values
+	 */
+	if( header_offset >= ARCHIVE_HANDLE_TAR_BLOCK_SIZE )
+	{
+		archive_handle->tar_end_of_archive = 1;
+
+		return( 1 );
+	}
+	if( archive_handle_tar_header_is_valid(
+	     archive_handle->tar_header ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in tar header checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle_tar_read_number(
+	     &( archive_handle->tar_header[ 124 ] ),
+	     12,
+	     &member_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve member size.",
+		 function );
+
+		return( -1 );
+	}
+	type_flag = archive_handle->tar_header[ 156 ];
+
+	archive_handle->tar_member_type            = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED;
+	archive_handle->tar_remaining_data_size    = member_size;
+	archive_handle->tar_remaining_padding_size = ( ARCHIVE_HANDLE_TAR_BLOCK_SIZE - ( member_size % ARCHIVE_HANDLE_TAR_BLOCK_SIZE ) ) % ARCHIVE_HANDLE_TAR_BLOCK_SIZE;
+
+	if( ( type_flag == (uint8_t) 'L' )
+	 || ( type_flag == (uint8_t) 'x' ) )
+	{
+		/* The GNU long name and pax extended header apply to the next member
+		 */
+		if( member_size < ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE )
+		{
+			archive_handle->tar_member_type = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_LONG_NAME;
+		}
+		if( ( type_flag == (uint8_t) 'x' )
+		 && ( member_size <= (uint64_t) ARCHIVE_HANDLE_MAXIMUM_MEMBER_SIZE ) )
+		{
+			archive_handle->tar_member_type = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_PAX_HEADER;
+		}
+	}
+	else if( ( type_flag == (uint8_t) '0' )
+	      || ( type_flag == 0 )
+	      || ( type_flag == (uint8_t) '7' ) )
+	{
+		if( archive_handle->next_member_name_size > 0 )
+		{
+			result = archive_handle_set_member_name(
+			          archive_handle,
+			          archive_handle->next_member_name,
+			          archive_handle->next_member_name_size - 1,
+			          NULL,
+			          0,
+			          error );
+		}
+		else
+		{
+			for( name_length = 0;
+			     name_length < 100;
+			     name_length++ )
+			{
+				if( archive_handle->tar_header[ name_length ] == 0 )
+				{
+					break;
+				}
+			}
+			if( memory_compare(
+			     &( archive_handle->tar_header[ 257 ] ),
+			     "ustar",
+			     5 ) == 0 )
+			{
+				for( prefix_length = 0;
+				     prefix_length < 155;
+				     prefix_length++ )
+				{
+					if( archive_handle->tar_header[ 345 + prefix_length ] == 0 )
+					{
+						break;
+					}
+				}
+			}
+			result = archive_handle_set_member_name(
+			          archive_handle,
+			          (char *) archive_handle->tar_header,
+			          name_length,
+			          (char *) &( archive_handle->tar_header[ 345 ] ),
+			          prefix_length,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set member name.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( member_size <= (uint64_t) ARCHIVE_HANDLE_MAXIMUM_MEMBER_SIZE )
+		 && ( archive_handle_name_has_prefetch_extension(
+		       archive_handle->member_name,
+		       archive_handle->member_name_size ) != 0 ) )
+		{
+			archive_handle->tar_member_type = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_PREFETCH;
+		}
+		archive_handle->next_member_name_size = 0;
+	}
+	else
+	{
+		archive_handle->next_member_name_size = 0;
+	}
+	if( archive_handle->tar_member_type != ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED )
+	{
+		if( archive_handle_resize_member_data(
+		     archive_handle,
+		     (size_t) member_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize member data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( member_size == 0 )
+	{
+		if( archive_handle_tar_complete_member(
+		     archive_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to complete member.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the path of a pax extended header in the member data
+ * The records of the header are formatted as: "<size> <key>=<value>\n"
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_tar_read_pax_header(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_tar_read_pax_header";
+	size_t key_offset     = 0;
+	size_t record_offset  = 0;
+	size_t record_size    = 0;
+	size_t value_offset   = 0;
+	size_t value_size     = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( record_offset < archive_handle->member_data_size )
+	{
+		record_size = 0;
+		key_offset  = record_offset;
+
+		while( ( key_offset < archive_handle->member_data_size )
+		    && ( archive_handle->member_data[ key_offset ] >= (uint8_t) '0' )
+		    && ( archive_handle->member_data[ key_offset ] <= (uint8_t) '9' )
+		    && ( record_size < (size_t) ARCHIVE_HANDLE_MAXIMUM_MEMBER_SIZE ) )
+		{
+			record_size *= 10;
+			record_size += (size_t) ( archive_handle->member_data[ key_offset ] - (uint8_t) '0' );
+
+			key_offset++;
+		}
+		if( ( key_offset >= archive_handle->member_data_size )
+		 || ( archive_handle->member_data[ key_offset ] != (uint8_t) ' ' )
+		 || ( record_size <= ( key_offset - record_offset ) )
+		 || ( record_size > ( archive_handle->member_data_size - record_offset ) )
+		 || ( archive_handle->member_data[ record_offset + record_size - 1 ] != (uint8_t) '\n' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_INVALID_DATA,
+			 "%s: invalid pax extended header record at offset: %" PRIzd ".",
+			 function,
+			 record_offset );
+
+			return( -1 );
+		}
+		key_offset++;
+
+		value_offset = key_offset;
+
+		while( ( value_offset < ( record_offset + record_size - 1 ) )
+		    && ( archive_handle->member_data[ value_offset ] != (uint8_t) '=' ) )
+		{
+			value_offset++;
+		}
+		if( ( ( value_offset - key_offset ) == 4 )
+		 && ( value_offset < ( record_offset + record_size - 1 ) )
+		 && ( memory_compare(
+		       &( archive_handle->member_data[ key_offset ] ),
+		       "path",
+		       4 ) == 0 ) )
+		{
+			value_offset++;
+
+			value_size = record_offset + record_size - 1 - value_offset;
+
+			if( value_size < ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE )
+			{
+				if( memory_copy(
+				     archive_handle->next_member_name,
+				     &( archive_handle->member_data[ value_offset ] ),
+				     value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy path.",
+					 function );
+
+					return( -1 );
+				}
+				archive_handle->next_member_name[ value_size ] = 0;
+
+				archive_handle->next_member_name_size = value_size + 1;
+			}
+		}
+		record_offset += record_size;
+	}
+	return( 1 );
+}
+
+/* Completes the current tar member after all its data was read
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_tar_complete_member(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_tar_complete_member";
+	size_t name_length    = 0;
+	int result            = 1;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	switch( archive_handle->tar_member_type )
+	{
+		case ARCHIVE_HANDLE_TAR_MEMBER_TYPE_PREFETCH:
+			if( archive_handle->member_callback_function != NULL )
+			{
+				result = archive_handle->member_callback_function(
+				          archive_handle->member_name,
+				          archive_handle->member_data,
+				          archive_handle->member_data_size,
+				          archive_handle->member_callback_arguments,
+				          error );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: member callback function failed for: %s.",
+					 function,
+					 archive_handle->member_name );
+				}
+			}
+			archive_handle->number_of_members += 1;
+
+			break;
+
+		case ARCHIVE_HANDLE_TAR_MEMBER_TYPE_LONG_NAME:
+			while( name_length < archive_handle->member_data_size )
+			{
+				if( archive_handle->member_data[ name_length ] == 0 )
+				{
+					break;
+				}
+				name_length++;
+			}
+			if( memory_copy(
+			     archive_handle->next_member_name,
+			     archive_handle->member_data,
+			     name_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy long name.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				archive_handle->next_member_name[ name_length ] = 0;
+
+				archive_handle->next_member_name_size = name_length + 1;
+			}
+			break;
+
+		case ARCHIVE_HANDLE_TAR_MEMBER_TYPE_PAX_HEADER:
+			result = archive_handle_tar_read_pax_header(
+			          archive_handle,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read pax extended header.",
+				 function );
+			}
+			break;
+
+		default:
+			break;
+	}
+	archive_handle->tar_member_type = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED;
+
+	return( result );
+}
+
+/* Appends data of a tar archive
+ * The data can be split at any offset, this function is also used as
+ * the output callback function of the deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_tar_append_data(
+     const uint8_t *data,
+     size_t data_size,
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_tar_append_data";
+	size_t copy_size      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_size > 0 )
+	{
+		if( ( archive_handle->tar_end_of_archive != 0 )
+		 || ( archive_handle->abort != 0 ) )
+		{
+			break;
+		}
+		if( archive_handle->tar_remaining_data_size > 0 )
+		{
+			copy_size = data_size;
+
+			if( (uint64_t) copy_size > archive_handle->tar_remaining_data_size )
+			{
+				copy_size = (size_t) archive_handle->tar_remaining_data_size;
+			}
+			if( archive_handle->tar_member_type != ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED )
+			{
+				if( archive_handle_append_member_data(
+				     data,
+				     copy_size,
+				     archive_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append member data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			archive_handle->tar_remaining_data_size -= copy_size;
+
+			if( archive_handle->tar_remaining_data_size == 0 )
+			{
+				if( archive_handle_tar_complete_member(
+				     archive_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to complete member.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		else if( archive_handle->tar_remaining_padding_size > 0 )
+		{
+			copy_size = data_size;
+
+			if( (uint64_t) copy_size > archive_handle->tar_remaining_padding_size )
+			{
+				copy_size = (size_t) archive_handle->tar_remaining_padding_size;
+			}
+			archive_handle->tar_remaining_padding_size -= copy_size;
+		}
+		else
+		{
+			copy_size = ARCHIVE_HANDLE_TAR_BLOCK_SIZE - archive_handle->tar_header_offset;
+
+			if( copy_size > data_size )
+			{
+				copy_size = data_size;
+			}
+			if( memory_copy(
+			     &( archive_handle->tar_header[ archive_handle->tar_header_offset ] ),
+			     data,
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy tar header.",
+				 function );
+
+				return( -1 );
+			}
+			archive_handle->tar_header_offset += copy_size;
+
+			if( archive_handle->tar_header_offset == ARCHIVE_HANDLE_TAR_BLOCK_SIZE )
+			{
+				archive_handle->tar_header_offset = 0;
+
+				if( archive_handle_tar_read_header(
+				     archive_handle,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read tar header.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		data      += copy_size;
+		data_size -= copy_size;
+	}
+	return( 1 );
+}
+
+/* Reads a tar archive
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_read_tar(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_read_tar";
+	size64_t input_offset = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->tar_header_offset          = 0;
+	archive_handle->tar_member_type            = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED;
+	archive_handle->tar_remaining_data_size    = 0;
+	archive_handle->tar_remaining_padding_size = 0;
+	archive_handle->tar_end_of_archive         = 0;
+	archive_handle->next_member_name_size      = 0;
+
+	if( libbfio_handle_seek_offset(
+	     archive_handle->input_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of input.",
+		 function );
+
+		return( -1 );
+	}
+	while( input_offset < archive_handle->input_size )
+	{
+		if( ( archive_handle->tar_end_of_archive != 0 )
+		 || ( archive_handle->abort != 0 ) )
+		{
+			break;
+		}
+		read_size = ARCHIVE_HANDLE_READ_BUFFER_SIZE;
+
+		if( (size64_t) read_size > ( archive_handle->input_size - input_offset ) )
+		{
+			read_size = (size_t) ( archive_handle->input_size - input_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              archive_handle->input_file_io_handle,
+		              archive_handle->read_buffer,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read input at offset: %" PRIu64 ".",
+			 function,
+			 input_offset );
+
+			return( -1 );
+		}
+		if( archive_handle_tar_append_data(
+		     archive_handle->read_buffer,
+		     read_size,
+		     archive_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append tar data.",
+			 function );
+
+			return( -1 );
+		}
+		input_offset += read_size;
+	}
+	if( ( archive_handle->abort == 0 )
+	 && ( archive_handle->tar_end_of_archive == 0 )
+	 && ( ( archive_handle->tar_header_offset != 0 )
+	  ||  ( archive_handle->tar_remaining_data_size != 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: tar archive is truncated.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a gzip compressed tar archive
+ * The tar archive is decompressed as a stream and is not stored
+ * Only a single gzip member is supported
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_read_tar_gzip(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "archive_handle_read_tar_gzip";
+	uint32_t stored_crc32   = 0;
+	uint32_t stored_size    = 0;
+	uint32_t value_32bit    = 0;
+	uint32_t value_index    = 0;
+	uint8_t header_flags    = 0;
+	uint8_t header_values[ 10 ];
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	archive_handle->tar_header_offset          = 0;
+	archive_handle->tar_member_type            = ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED;
+	archive_handle->tar_remaining_data_size    = 0;
+	archive_handle->tar_remaining_padding_size = 0;
+	archive_handle->tar_end_of_archive         = 0;
+	archive_handle->next_member_name_size      = 0;
+
+	if( libbfio_handle_seek_offset(
+	     archive_handle->input_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of input.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream_set_input(
+	     archive_handle->deflate_stream,
+	     archive_handle->input_file_io_handle,
+	     archive_handle->input_size,
+	     (int (*)(const uint8_t *, size_t, void *, libcerror_error_t **)) &archive_handle_tar_append_data,
+	     (void *) archive_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set deflate stream input.",
+		 function );
+
+		return( -1 );
+	}
+	/* The gzip header: signature, compression method, flags,
+	 * modification time, extra flags and operating system
+	 */
+	for( value_index = 0;
+	     value_index < 10;
+	     value_index++ )
+	{
+		if( deflate_stream_read_bits(
+		     archive_handle->deflate_stream,
+		     8,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_read_error;
+		}
+		header_values[ value_index ] = (uint8_t) value_32bit;
+	}
+	if( ( header_values[ 0 ] != 0x1f )
+	 || ( header_values[ 1 ] != 0x8b )
+	 || ( header_values[ 2 ] != 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported gzip signature or compression method.",
+		 function );
+
+		return( -1 );
+	}
+	header_flags = header_values[ 3 ];
+
+	if( ( header_flags & 0xe0 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported gzip flags: 0x%02" PRIx8 ".",
+		 function,
+		 header_flags );
+
+		return( -1 );
+	}
+	/* FEXTRA: a 16-bit size followed by the extra field
+	 */
+	if( ( header_flags & 0x04 ) != 0 )
+	{
+		if( deflate_stream_read_bits(
+		     archive_handle->deflate_stream,
+		     16,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_read_error;
+		}
+		for( value_index = value_32bit;
+		     value_index > 0;
+		     value_index-- )
+		{
+			if( deflate_stream_read_bits(
+			     archive_handle->deflate_stream,
+			     8,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				goto on_read_error;
+			}
+		}
+	}
+	/* FNAME and FCOMMENT: strings terminated by a 0-byte value
+	 */
+	for( value_index = 0x08;
+	     value_index <= 0x10;
+	     value_index <<= 1 )
+	{
+		if( ( header_flags & value_index ) == 0 )
+		{
+			continue;
+		}
+		do
+		{
+			if( deflate_stream_read_bits(
+			     archive_handle->deflate_stream,
+			     8,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				goto on_read_error;
+			}
+		}
+		while( value_32bit != 0 );
+	}
+	/* FHCRC: a 16-bit CRC of the header
+	 */
+	if( ( header_flags & 0x02 ) != 0 )
+	{
+		if( deflate_stream_read_bits(
+		     archive_handle->deflate_stream,
+		     16,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_read_error;
+		}
+	}
+	if( deflate_stream_decompress(
+	     archive_handle->deflate_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress gzip data.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	/* The gzip footer: the CRC-32 and the 32-bit size of the uncompressed data
+	 */
+	if( deflate_stream_align_to_byte(
+	     archive_handle->deflate_stream,
+	     error ) != 1 )
+	{
+		goto on_read_error;
+	}
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		if( deflate_stream_read_bits(
+		     archive_handle->deflate_stream,
+		     16,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_read_error;
+		}
+		stored_crc32 |= value_32bit << ( value_index * 16 );
+	}
+	for( value_index = 0;
+	     value_index < 2;
+	     value_index++ )
+	{
+		if( deflate_stream_read_bits(
+		     archive_handle->deflate_stream,
+		     16,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			goto on_read_error;
+		}
+		stored_size |= value_32bit << ( value_index * 16 );
+	}
+	if( ( stored_crc32 != archive_handle->deflate_stream->crc32 )
+	 || ( stored_size != (uint32_t) ( archive_handle->deflate_stream->output_size & 0xffffffffUL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in gzip CRC-32 or size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( archive_handle->tar_end_of_archive == 0 )
+	 && ( ( archive_handle->tar_header_offset != 0 )
+	  ||  ( archive_handle->tar_remaining_data_size != 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: tar archive is truncated.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_read_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_READ_FAILED,
+	 "%s: unable to read gzip header or footer.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads data from the input at a specific offset
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_read_at_offset(
+     archive_handle_t *archive_handle,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "archive_handle_read_at_offset";
+	ssize_t read_count    = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > archive_handle->input_size )
+	 || ( (size64_t) data_size > ( archive_handle->input_size - (size64_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIi64 " or size: %" PRIzd " value out of bounds.",
+		 function,
+		 offset,
+		 data_size );
+
+		return( -1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     archive_handle->input_file_io_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              archive_handle->input_file_io_handle,
+	              data,
+	              data_size,
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the data of a member of a zip archive into the member data
+ * Returns 1 if successful, 0 if the member is not supported or -1 on error
+ */
+int archive_handle_zip_read_member(
+     archive_handle_t *archive_handle,
+     off64_t local_header_offset,
+     uint16_t compression_method,
+     uint64_t compressed_size,
+     uint64_t uncompressed_size,
+     uint32_t crc32,
+     libcerror_error_t **error )
+{
+	uint8_t local_header[ ARCHIVE_HANDLE_ZIP_LOCAL_FILE_HEADER_SIZE ];
+
+	static char *function = "archive_handle_zip_read_member";
+	off64_t data_offset   = 0;
+	uint16_t extra_size   = 0;
+	uint16_t name_size    = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( compression_method != 0 )
+	  &&  ( compression_method != 8 ) )
+	 || ( uncompressed_size > (uint64_t) ARCHIVE_HANDLE_MAXIMUM_MEMBER_SIZE ) )
+	{
+		return( 0 );
+	}
+	if( archive_handle_read_at_offset(
+	     archive_handle,
+	     local_header_offset,
+	     local_header,
+	     ARCHIVE_HANDLE_ZIP_LOCAL_FILE_HEADER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read local file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     local_header,
+	     "PK\x03\x04",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: invalid local file header signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( local_header[ 26 ] ),
+	 name_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( local_header[ 28 ] ),
+	 extra_size );
+
+	data_offset = local_header_offset + ARCHIVE_HANDLE_ZIP_LOCAL_FILE_HEADER_SIZE + name_size + extra_size;
+
+	if( ( (size64_t) data_offset > archive_handle->input_size )
+	 || ( compressed_size > ( archive_handle->input_size - (size64_t) data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid member data offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle_resize_member_data(
+	     archive_handle,
+	     (size_t) uncompressed_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize member data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_method == 0 )
+	{
+		if( compressed_size != uncompressed_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in stored member size.",
+			 function );
+
+			return( -1 );
+		}
+		if( uncompressed_size > 0 )
+		{
+			if( archive_handle_read_at_offset(
+			     archive_handle,
+			     data_offset,
+			     archive_handle->member_data,
+			     (size_t) uncompressed_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stored member data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		archive_handle->member_data_size = (size_t) uncompressed_size;
+	}
+	else
+	{
+		if( libbfio_handle_seek_offset(
+		     archive_handle->input_file_io_handle,
+		     data_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek member data offset: %" PRIi64 ".",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		if( deflate_stream_set_input(
+		     archive_handle->deflate_stream,
+		     archive_handle->input_file_io_handle,
+		     (size64_t) compressed_size,
+		     (int (*)(const uint8_t *, size_t, void *, libcerror_error_t **)) &archive_handle_append_member_data,
+		     (void *) archive_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set deflate stream input.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_stream_decompress(
+		     archive_handle->deflate_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress member data.",
+			 function );
+
+			return( -1 );
+		}
+		if( (uint64_t) archive_handle->member_data_size != uncompressed_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in uncompressed member size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( deflate_calculate_crc32(
+	     0,
+	     archive_handle->member_data,
+	     archive_handle->member_data_size ) != crc32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in member CRC-32.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the end of central directory of a zip archive
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_zip_read_end_of_central_directory(
+     archive_handle_t *archive_handle,
+     uint64_t *number_of_entries,
+     off64_t *central_directory_offset,
+     size64_t *central_directory_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "archive_handle_zip_read_end_of_central_directory";
+	uint8_t *record_data            = NULL;
+	off64_t tail_offset             = 0;
+	size_t record_offset            = 0;
+	size_t tail_size                = ARCHIVE_HANDLE_READ_BUFFER_SIZE;
+	uint64_t zip64_record_offset    = 0;
+	uint32_t value_32bit            = 0;
+	uint16_t comment_size           = 0;
+	uint16_t value_16bit            = 0;
+	int found                       = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries == NULL )
+	 || ( central_directory_offset == NULL )
+	 || ( central_directory_size == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid central directory values.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle->input_size < ARCHIVE_HANDLE_ZIP_END_OF_CENTRAL_DIRECTORY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: input too small to contain end of central directory.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end of central directory is followed by a comment of at most 65535 bytes
+	 */
+	if( (size64_t) tail_size > archive_handle->input_size )
+	{
+		tail_size = (size_t) archive_handle->input_size;
+	}
+	tail_offset = (off64_t) ( archive_handle->input_size - tail_size );
+
+	if( archive_handle_read_at_offset(
+	     archive_handle,
+	     tail_offset,
+	     archive_handle->read_buffer,
+	     tail_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read end of input.",
+		 function );
+
+		return( -1 );
+	}
+	record_offset = tail_size - ARCHIVE_HANDLE_ZIP_END_OF_CENTRAL_DIRECTORY_SIZE;
+
+	do
+	{
+		record_data = &( archive_handle->read_buffer[ record_offset ] );
+
+		if( memory_compare(
+		     record_data,
+		     "PK\x05\x06",
+		     4 ) == 0 )
+		{
+			byte_stream_copy_to_uint16_little_endian(
+			 &( record_data[ 20 ] ),
+			 comment_size );
+
+			if( ( record_offset + ARCHIVE_HANDLE_ZIP_END_OF_CENTRAL_DIRECTORY_SIZE + comment_size ) <= tail_size )
+			{
+				found = 1;
+
+				break;
+			}
+		}
+	}
+	while( record_offset-- > 0 );
+
+	if( found == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unable to find end of central directory.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( record_data[ 10 ] ),
+	 value_16bit );
+
+	*number_of_entries = (uint64_t) value_16bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( record_data[ 12 ] ),
+	 value_32bit );
+
+	*central_directory_size = (size64_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( record_data[ 16 ] ),
+	 value_32bit );
+
+	*central_directory_offset = (off64_t) value_32bit;
+
+	if( ( *number_of_entries == 0xffffUL )
+	 || ( *central_directory_size == 0xffffffffUL )
+	 || ( *central_directory_offset == (off64_t) 0xffffffffUL ) )
+	{
+		/* The values are stored in the zip64 end of central directory,
+		 * which is referenced by the locator that precedes the end of central directory
+		 */
+		if( record_offset < ARCHIVE_HANDLE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: missing zip64 end of central directory locator.",
+			 function );
+
+			return( -1 );
+		}
+		record_data = &( archive_handle->read_buffer[ record_offset - ARCHIVE_HANDLE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE ] );
+
+		if( memory_compare(
+		     record_data,
+		     "PK\x06\x07",
+		     4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: invalid zip64 end of central directory locator signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 8 ] ),
+		 zip64_record_offset );
+
+		if( zip64_record_offset > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid zip64 end of central directory offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( archive_handle_read_at_offset(
+		     archive_handle,
+		     (off64_t) zip64_record_offset,
+		     archive_handle->read_buffer,
+		     ARCHIVE_HANDLE_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read zip64 end of central directory.",
+			 function );
+
+			return( -1 );
+		}
+		record_data = archive_handle->read_buffer;
+
+		if( memory_compare(
+		     record_data,
+		     "PK\x06\x06",
+		     4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: invalid zip64 end of central directory signature.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 32 ] ),
+		 *number_of_entries );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 40 ] ),
+		 *central_directory_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( record_data[ 48 ] ),
+		 zip64_record_offset );
+
+		if( zip64_record_offset > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid central directory offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*central_directory_offset = (off64_t) zip64_record_offset;
+	}
+	if( ( (size64_t) *central_directory_offset > archive_handle->input_size )
+	 || ( *central_directory_size > ( archive_handle->input_size - (size64_t) *central_directory_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid central directory offset or size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a zip archive
+ * The central directory is used to locate the members, members that cannot be
+ * read are counted as failed and do not stop the reading of the other members
+ * Returns 1 if successful or -1 on error
+ */
+int archive_handle_read_zip(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error )
+{
+	uint8_t entry_data[ ARCHIVE_HANDLE_ZIP_CENTRAL_DIRECTORY_ENTRY_SIZE ];
+
+	libcerror_error_t *member_error  = NULL;
+	static char *function            = "archive_handle_read_zip";
+	off64_t central_directory_offset = 0;
+	off64_t entry_offset             = 0;
+	off64_t local_header_offset      = 0;
+	size64_t central_directory_size  = 0;
+	size_t extra_offset              = 0;
+	uint64_t compressed_size         = 0;
+	uint64_t entry_index             = 0;
+	uint64_t number_of_entries       = 0;
+	uint64_t uncompressed_size       = 0;
+	uint32_t crc32                   = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t comment_size            = 0;
+	uint16_t compression_method      = 0;
+	uint16_t extra_size              = 0;
+	uint16_t field_size              = 0;
+	uint16_t field_type              = 0;
+	uint16_t flags                   = 0;
+	uint16_t name_size               = 0;
+	int result                       = 0;
+
+	if( archive_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid archive handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( archive_handle_zip_read_end_of_central_directory(
+	     archive_handle,
+	     &number_of_entries,
+	     &central_directory_offset,
+	     &central_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read end of central directory.",
+		 function );
+
+		return( -1 );
+	}
+	entry_offset = central_directory_offset;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( archive_handle->abort != 0 )
+		{
+			break;
+		}
+		if( archive_handle_read_at_offset(
+		     archive_handle,
+		     entry_offset,
+		     entry_data,
+		     ARCHIVE_HANDLE_ZIP_CENTRAL_DIRECTORY_ENTRY_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read central directory entry: %" PRIu64 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     entry_data,
+		     "PK\x01\x02",
+		     4 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+			 "%s: invalid central directory entry: %" PRIu64 " signature.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 8 ] ),
+		 flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 10 ] ),
+		 compression_method );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 16 ] ),
+		 crc32 );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 20 ] ),
+		 value_32bit );
+
+		compressed_size = (uint64_t) value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 24 ] ),
+		 value_32bit );
+
+		uncompressed_size = (uint64_t) value_32bit;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 28 ] ),
+		 name_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 30 ] ),
+		 extra_size );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 32 ] ),
+		 comment_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 42 ] ),
+		 value_32bit );
+
+		local_header_offset = (off64_t) value_32bit;
+
+		/* The name and the extra field directly follow the fixed part of the entry
+		 */
+		result = 0;
+
+		if( name_size < ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE )
+		{
+			if( archive_handle_read_at_offset(
+			     archive_handle,
+			     entry_offset + ARCHIVE_HANDLE_ZIP_CENTRAL_DIRECTORY_ENTRY_SIZE,
+			     archive_handle->read_buffer,
+			     (size_t) name_size + (size_t) extra_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read central directory entry: %" PRIu64 " name and extra field.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( archive_handle_set_member_name(
+			     archive_handle,
+			     (char *) archive_handle->read_buffer,
+			     (size_t) name_size,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set member name.",
+				 function );
+
+				return( -1 );
+			}
+			result = archive_handle_name_has_prefetch_extension(
+			          archive_handle->member_name,
+			          archive_handle->member_name_size );
+		}
+		/* Encrypted members are skipped
+		 */
+		if( ( result != 0 )
+		 && ( ( flags & 0x0001 ) == 0 ) )
+		{
+			/* The zip64 extended information extra field contains the values
+			 * that are set to 0xffffffff in the entry, in this order
+			 */
+			extra_offset = (size_t) name_size;
+
+			while( ( extra_offset + 4 ) <= ( (size_t) name_size + (size_t) extra_size ) )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( archive_handle->read_buffer[ extra_offset ] ),
+				 field_type );
+
+				byte_stream_copy_to_uint16_little_endian(
+				 &( archive_handle->read_buffer[ extra_offset + 2 ] ),
+				 field_size );
+
+				extra_offset += 4;
+
+				if( ( extra_offset + field_size ) > ( (size_t) name_size + (size_t) extra_size ) )
+				{
+					break;
+				}
+				if( field_type == 0x0001 )
+				{
+					if( ( uncompressed_size == 0xffffffffUL )
+					 && ( field_size >= 8 ) )
+					{
+						byte_stream_copy_to_uint64_little_endian(
+						 &( archive_handle->read_buffer[ extra_offset ] ),
+						 uncompressed_size );
+
+						extra_offset += 8;
+						field_size   -= 8;
+					}
+					if( ( compressed_size == 0xffffffffUL )
+					 && ( field_size >= 8 ) )
+					{
+						byte_stream_copy_to_uint64_little_endian(
+						 &( archive_handle->read_buffer[ extra_offset ] ),
+						 compressed_size );
+
+						extra_offset += 8;
+						field_size   -= 8;
+					}
+					if( ( local_header_offset == (off64_t) 0xffffffffUL )
+					 && ( field_size >= 8 ) )
+					{
+						byte_stream_copy_to_uint64_little_endian(
+						 &( archive_handle->read_buffer[ extra_offset ] ),
+						 local_header_offset );
+
+						extra_offset += 8;
+						field_size   -= 8;
+					}
+				}
+				extra_offset += field_size;
+			}
+			result = archive_handle_zip_read_member(
+			          archive_handle,
+			          local_header_offset,
+			          compression_method,
+			          compressed_size,
+			          uncompressed_size,
+			          crc32,
+			          &member_error );
+
+			if( result == -1 )
+			{
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: unable to read member: %s.\n",
+					 function,
+					 archive_handle->member_name );
+
+					libcnotify_print_error_backtrace(
+					 member_error );
+				}
+				libcerror_error_free(
+				 &member_error );
+
+				archive_handle->number_of_failed_members += 1;
+			}
+			else if( result == 1 )
+			{
+				if( archive_handle->member_callback_function(
+				     archive_handle->member_name,
+				     archive_handle->member_data,
+				     archive_handle->member_data_size,
+				     archive_handle->member_callback_arguments,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: member callback function failed for: %s.",
+					 function,
+					 archive_handle->member_name );
+
+					return( -1 );
+				}
+				archive_handle->number_of_members += 1;
+			}
+		}
+		entry_offset += ARCHIVE_HANDLE_ZIP_CENTRAL_DIRECTORY_ENTRY_SIZE + name_size + extra_size + comment_size;
+	}
+	return( 1 );
+}
+
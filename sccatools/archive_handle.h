@@ -0,0 +1,308 @@
+/*
+ * Archive handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARCHIVE_HANDLE_H )
+#define _ARCHIVE_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "deflate_stream.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum ARCHIVE_HANDLE_ARCHIVE_TYPES
+{
+	ARCHIVE_HANDLE_ARCHIVE_TYPE_UNKNOWN	= 0,
+	ARCHIVE_HANDLE_ARCHIVE_TYPE_TAR		= 1,
+	ARCHIVE_HANDLE_ARCHIVE_TYPE_TAR_GZIP	= 2,
+	ARCHIVE_HANDLE_ARCHIVE_TYPE_ZIP		= 3
+};
+
+enum ARCHIVE_HANDLE_TAR_MEMBER_TYPES
+{
+	ARCHIVE_HANDLE_TAR_MEMBER_TYPE_SKIPPED	= 0,
+	ARCHIVE_HANDLE_TAR_MEMBER_TYPE_PREFETCH	= 1,
+	ARCHIVE_HANDLE_TAR_MEMBER_TYPE_LONG_NAME	= 2,
+	ARCHIVE_HANDLE_TAR_MEMBER_TYPE_PAX_HEADER	= 3
+};
+
+/* The size of a tar header and of the blocks of the member data
+ */
+#define ARCHIVE_HANDLE_TAR_BLOCK_SIZE		512
+
+/* The size of the part of an uncompressed archive that is read at once
+ * This is large enough to contain the end of central directory record
+ * of a zip archive including its maximum comment
+ */
+#define ARCHIVE_HANDLE_READ_BUFFER_SIZE		131072
+
+/* The size of the fixed parts of the zip records
+ */
+#define ARCHIVE_HANDLE_ZIP_LOCAL_FILE_HEADER_SIZE		30
+#define ARCHIVE_HANDLE_ZIP_CENTRAL_DIRECTORY_ENTRY_SIZE		46
+#define ARCHIVE_HANDLE_ZIP_END_OF_CENTRAL_DIRECTORY_SIZE	22
+#define ARCHIVE_HANDLE_ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIZE	20
+#define ARCHIVE_HANDLE_ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE	56
+
+/* The maximum size of a member name, including the end-of-string character
+ */
+#define ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE	4096
+
+/* The maximum size of a member that is read into memory, prefetch files
+ * are much smaller, hence larger members are skipped
+ */
+#define ARCHIVE_HANDLE_MAXIMUM_MEMBER_SIZE	( 64 * 1024 * 1024 )
+
+typedef struct archive_handle archive_handle_t;
+
+struct archive_handle
+{
+	/* The input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The size of the input
+	 */
+	size64_t input_size;
+
+	/* The archive type
+	 */
+	int archive_type;
+
+	/* The deflate stream
+	 */
+	deflate_stream_t *deflate_stream;
+
+	/* The read buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The member name
+	 */
+	char member_name[ ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE ];
+
+	/* The member name size, including the end-of-string character
+	 */
+	size_t member_name_size;
+
+	/* The name of the next tar member, from a GNU long name or pax extended header
+	 */
+	char next_member_name[ ARCHIVE_HANDLE_MAXIMUM_NAME_SIZE ];
+
+	/* The size of the name of the next tar member, including the end-of-string
+	 * character or 0 if not set
+	 */
+	size_t next_member_name_size;
+
+	/* The member data
+	 */
+	uint8_t *member_data;
+
+	/* The member data size
+	 */
+	size_t member_data_size;
+
+	/* The allocated member data size, which is retained for the next member
+	 */
+	size_t allocated_member_data_size;
+
+	/* The tar header
+	 */
+	uint8_t tar_header[ ARCHIVE_HANDLE_TAR_BLOCK_SIZE ];
+
+	/* The number of bytes of the tar header that were read
+	 */
+	size_t tar_header_offset;
+
+	/* The type of the current tar member
+	 */
+	int tar_member_type;
+
+	/* The size of the data of the current tar member that remains to be read
+	 */
+	uint64_t tar_remaining_data_size;
+
+	/* The size of the padding of the current tar member that remains to be read
+	 */
+	uint64_t tar_remaining_padding_size;
+
+	/* Value to indicate the end of the tar archive was found
+	 */
+	uint8_t tar_end_of_archive;
+
+	/* The member callback function
+	 */
+	int (*member_callback_function)(
+	       const char *member_name,
+	       const uint8_t *member_data,
+	       size_t member_data_size,
+	       void *callback_arguments,
+	       libcerror_error_t **error );
+
+	/* The member callback arguments
+	 */
+	void *member_callback_arguments;
+
+	/* The number of prefetch members passed to the member callback function
+	 */
+	int number_of_members;
+
+	/* The number of prefetch members that could not be read
+	 */
+	int number_of_failed_members;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int archive_handle_initialize(
+     archive_handle_t **archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_free(
+     archive_handle_t **archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_signal_abort(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_open_input(
+     archive_handle_t *archive_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int archive_handle_close_input(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_determine_archive_type(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_read_members(
+     archive_handle_t *archive_handle,
+     int (*member_callback_function)(
+            const char *member_name,
+            const uint8_t *member_data,
+            size_t member_data_size,
+            void *callback_arguments,
+            libcerror_error_t **error ),
+     void *member_callback_arguments,
+     libcerror_error_t **error );
+
+int archive_handle_name_has_prefetch_extension(
+     const char *name,
+     size_t name_size );
+
+int archive_handle_set_member_name(
+     archive_handle_t *archive_handle,
+     const char *name,
+     size_t name_length,
+     const char *prefix,
+     size_t prefix_length,
+     libcerror_error_t **error );
+
+int archive_handle_resize_member_data(
+     archive_handle_t *archive_handle,
+     size_t member_data_size,
+     libcerror_error_t **error );
+
+int archive_handle_append_member_data(
+     const uint8_t *data,
+     size_t data_size,
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_tar_header_is_valid(
+     const uint8_t *tar_header );
+
+int archive_handle_tar_read_number(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int archive_handle_tar_read_header(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_tar_read_pax_header(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_tar_complete_member(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_tar_append_data(
+     const uint8_t *data,
+     size_t data_size,
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_read_tar(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_read_tar_gzip(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+int archive_handle_read_at_offset(
+     archive_handle_t *archive_handle,
+     off64_t offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int archive_handle_zip_read_member(
+     archive_handle_t *archive_handle,
+     off64_t local_header_offset,
+     uint16_t compression_method,
+     uint64_t compressed_size,
+     uint64_t uncompressed_size,
+     uint32_t crc32,
+     libcerror_error_t **error );
+
+int archive_handle_zip_read_end_of_central_directory(
+     archive_handle_t *archive_handle,
+     uint64_t *number_of_entries,
+     off64_t *central_directory_offset,
+     size64_t *central_directory_size,
+     libcerror_error_t **error );
+
+int archive_handle_read_zip(
+     archive_handle_t *archive_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ARCHIVE_HANDLE_H ) */
+
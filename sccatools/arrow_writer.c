@@ -0,0 +1,3236 @@
+/*
+ * Apache Arrow IPC stream writer
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "arrow_writer.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+/* Creates an Arrow writer
+ * Make sure the value arrow_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_initialize(
+     arrow_writer_t **arrow_writer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_initialize";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	*arrow_writer = memory_allocate_structure(
+	                 arrow_writer_t );
+
+	if( *arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arrow_writer,
+	     0,
+	     sizeof( arrow_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Arrow writer.",
+		 function );
+
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+
+		return( -1 );
+	}
+	if( output_buffer_initialize(
+	     &( ( *arrow_writer )->metadata ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_initialize(
+	     &( ( *arrow_writer )->body ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create body buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *arrow_writer )->stream = stream;
+
+	return( 1 );
+
+on_error:
+	if( *arrow_writer != NULL )
+	{
+		if( ( *arrow_writer )->metadata != NULL )
+		{
+			output_buffer_free(
+			 &( ( *arrow_writer )->metadata ),
+			 NULL );
+		}
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an Arrow writer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_free(
+     arrow_writer_t **arrow_writer,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_free";
+	int column_index              = 0;
+	int result                    = 1;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arrow_writer != NULL )
+	{
+		for( column_index = 0;
+		     column_index < ( *arrow_writer )->number_of_columns;
+		     column_index++ )
+		{
+			column = &( ( *arrow_writer )->columns[ column_index ] );
+
+			if( column->values != NULL )
+			{
+				if( output_buffer_free(
+				     &( column->values ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free column: %d values.",
+					 function,
+					 column_index );
+
+					result = -1;
+				}
+			}
+			if( column->dictionary_offsets != NULL )
+			{
+				if( output_buffer_free(
+				     &( column->dictionary_offsets ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free column: %d dictionary offsets.",
+					 function,
+					 column_index );
+
+					result = -1;
+				}
+			}
+			if( column->dictionary_data != NULL )
+			{
+				if( output_buffer_free(
+				     &( column->dictionary_data ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free column: %d dictionary data.",
+					 function,
+					 column_index );
+
+					result = -1;
+				}
+			}
+			if( column->hash_table != NULL )
+			{
+				memory_free(
+				 column->hash_table );
+			}
+		}
+		if( output_buffer_free(
+		     &( ( *arrow_writer )->metadata ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( output_buffer_free(
+		     &( ( *arrow_writer )->body ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free body buffer.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *arrow_writer );
+
+		*arrow_writer = NULL;
+	}
+	return( result );
+}
+
+/* Appends a column
+ * The name is not copied and must remain valid while the Arrow writer is used
+ * Columns must be appended before the first value is appended
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_column(
+     arrow_writer_t *arrow_writer,
+     const char *name,
+     int column_type,
+     libcerror_error_t **error )
+{
+	uint8_t offset_data[ 4 ];
+
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_column";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( arrow_writer->schema_written != 0 )
+	 || ( arrow_writer->number_of_rows != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Arrow writer - schema already written.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->number_of_columns >= ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMNS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid Arrow writer - maximum number of columns reached.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type != ARROW_WRITER_COLUMN_TYPE_UINT32 )
+	 && ( column_type != ARROW_WRITER_COLUMN_TYPE_UINT64 )
+	 && ( column_type != ARROW_WRITER_COLUMN_TYPE_STRING ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type.",
+		 function );
+
+		return( -1 );
+	}
+	column = &( arrow_writer->columns[ arrow_writer->number_of_columns ] );
+
+	if( output_buffer_initialize(
+	     &( column->values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( column_type == ARROW_WRITER_COLUMN_TYPE_STRING )
+	{
+		if( output_buffer_initialize(
+		     &( column->dictionary_offsets ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create dictionary offsets buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_initialize(
+		     &( column->dictionary_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create dictionary data buffer.",
+			 function );
+
+			goto on_error;
+		}
+		/* The offsets start with the start offset of the first entry
+		 */
+		byte_stream_copy_from_uint32_little_endian(
+		 offset_data,
+		 0 );
+
+		if( output_buffer_append_string(
+		     column->dictionary_offsets,
+		     (char *) offset_data,
+		     4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append dictionary offset.",
+			 function );
+
+			goto on_error;
+		}
+		column->hash_table = (int *) memory_allocate(
+		                              sizeof( int ) * ARROW_WRITER_INITIAL_HASH_TABLE_SIZE );
+
+		if( column->hash_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create dictionary hash table.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     column->hash_table,
+		     0,
+		     sizeof( int ) * ARROW_WRITER_INITIAL_HASH_TABLE_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear dictionary hash table.",
+			 function );
+
+			goto on_error;
+		}
+		column->hash_table_size = ARROW_WRITER_INITIAL_HASH_TABLE_SIZE;
+	}
+	column->name = name;
+	column->type = column_type;
+
+	arrow_writer->number_of_columns += 1;
+
+	return( 1 );
+
+on_error:
+	if( column->hash_table != NULL )
+	{
+		memory_free(
+		 column->hash_table );
+
+		column->hash_table = NULL;
+	}
+	if( column->dictionary_data != NULL )
+	{
+		output_buffer_free(
+		 &( column->dictionary_data ),
+		 NULL );
+	}
+	if( column->dictionary_offsets != NULL )
+	{
+		output_buffer_free(
+		 &( column->dictionary_offsets ),
+		 NULL );
+	}
+	if( column->values != NULL )
+	{
+		output_buffer_free(
+		 &( column->values ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a column of a specific type
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_get_column(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     int column_type,
+     arrow_writer_column_t **column,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_get_column";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_index < 0 )
+	 || ( column_index >= arrow_writer->number_of_columns ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid column index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->columns[ column_index ].type != column_type )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column: %d type.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	*column = &( arrow_writer->columns[ column_index ] );
+
+	return( 1 );
+}
+
+/* Appends a 32-bit value to a column
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_uint32_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_uint32_value";
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_UINT32,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( arrow_writer_encode_uint32(
+	     column->values,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit value to a column
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_uint64_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_uint64_value";
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_UINT64,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( arrow_writer_encode_uint64(
+	     column->values,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the FNV-1a hash of an UTF-8 string
+ * Returns the hash value
+ */
+uint32_t arrow_writer_calculate_string_hash(
+          const uint8_t *utf8_string,
+          size_t utf8_string_length )
+{
+	size_t string_index = 0;
+	uint32_t hash_value = 0x811c9dc5UL;
+
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		hash_value ^= utf8_string[ string_index ];
+		hash_value *= 0x01000193UL;
+	}
+	return( hash_value );
+}
+
+/* Resizes the dictionary hash table of a column to twice its size
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_column_resize_hash_table(
+     arrow_writer_column_t *column,
+     libcerror_error_t **error )
+{
+	int *hash_table       = NULL;
+	static char *function = "arrow_writer_column_resize_hash_table";
+	uint32_t end_offset   = 0;
+	uint32_t hash_value   = 0;
+	uint32_t start_offset = 0;
+	int entry_index       = 0;
+	int hash_table_index  = 0;
+	int hash_table_size   = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( column->hash_table_size > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid column - hash table size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	hash_table_size = column->hash_table_size * 2;
+
+	hash_table = (int *) memory_allocate(
+	                      sizeof( int ) * hash_table_size );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( int ) * hash_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 hash_table );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < column->number_of_dictionary_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( column->dictionary_offsets->data[ entry_index * 4 ] ),
+		 start_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( column->dictionary_offsets->data[ ( entry_index + 1 ) * 4 ] ),
+		 end_offset );
+
+		hash_value = arrow_writer_calculate_string_hash(
+		              &( column->dictionary_data->data[ start_offset ] ),
+		              (size_t) ( end_offset - start_offset ) );
+
+		hash_table_index = (int) ( hash_value & (uint32_t) ( hash_table_size - 1 ) );
+
+		while( hash_table[ hash_table_index ] != 0 )
+		{
+			hash_table_index = ( hash_table_index + 1 ) & ( hash_table_size - 1 );
+		}
+		hash_table[ hash_table_index ] = entry_index + 1;
+	}
+	memory_free(
+	 column->hash_table );
+
+	column->hash_table      = hash_table;
+	column->hash_table_size = hash_table_size;
+
+	return( 1 );
+}
+
+/* Retrieves the dictionary index of an UTF-8 string, the string is added to the dictionary if not present
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_column_get_dictionary_index(
+     arrow_writer_column_t *column,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *dictionary_index,
+     libcerror_error_t **error )
+{
+	uint8_t offset_data[ 4 ];
+
+	static char *function = "arrow_writer_column_get_dictionary_index";
+	uint32_t end_offset   = 0;
+	uint32_t hash_value   = 0;
+	uint32_t start_offset = 0;
+	int entry_index       = 0;
+	int hash_table_index  = 0;
+
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	if( column->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid column - missing hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dictionary index.",
+		 function );
+
+		return( -1 );
+	}
+	hash_value = arrow_writer_calculate_string_hash(
+	              utf8_string,
+	              utf8_string_length );
+
+	hash_table_index = (int) ( hash_value & (uint32_t) ( column->hash_table_size - 1 ) );
+
+	while( column->hash_table[ hash_table_index ] != 0 )
+	{
+		entry_index = column->hash_table[ hash_table_index ] - 1;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( column->dictionary_offsets->data[ entry_index * 4 ] ),
+		 start_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( column->dictionary_offsets->data[ ( entry_index + 1 ) * 4 ] ),
+		 end_offset );
+
+		if( ( (size_t) ( end_offset - start_offset ) == utf8_string_length )
+		 && ( ( utf8_string_length == 0 )
+		  || ( memory_compare(
+		        &( column->dictionary_data->data[ start_offset ] ),
+		        utf8_string,
+		        utf8_string_length ) == 0 ) ) )
+		{
+			*dictionary_index = entry_index;
+
+			return( 1 );
+		}
+		hash_table_index = ( hash_table_index + 1 ) & ( column->hash_table_size - 1 );
+	}
+	/* The dictionary offsets are signed 32-bit values
+	 */
+	if( utf8_string_length > (size_t) ( INT32_MAX - column->dictionary_data->data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid dictionary data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		if( output_buffer_append_string(
+		     column->dictionary_data,
+		     (char *) utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append dictionary data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 offset_data,
+	 (uint32_t) column->dictionary_data->data_offset );
+
+	if( output_buffer_append_string(
+	     column->dictionary_offsets,
+	     (char *) offset_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append dictionary offset.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = column->number_of_dictionary_entries;
+
+	column->hash_table[ hash_table_index ] = entry_index + 1;
+
+	column->number_of_dictionary_entries += 1;
+
+	/* Keep the hash table at most half full
+	 */
+	if( column->number_of_dictionary_entries >= ( column->hash_table_size / 2 ) )
+	{
+		if( arrow_writer_column_resize_hash_table(
+		     column,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*dictionary_index = entry_index;
+
+	return( 1 );
+}
+
+/* Appends an UTF-8 string value to a column
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_string_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_append_string_value";
+	int dictionary_index          = 0;
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_STRING,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( arrow_writer_column_get_dictionary_index(
+	     column,
+	     utf8_string,
+	     utf8_string_length,
+	     &dictionary_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve dictionary index of column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	if( arrow_writer_encode_uint32(
+	     column->values,
+	     (uint32_t) dictionary_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value to column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finishes a row, every column should contain a value for the row
+ * A record batch is written when the maximum number of rows is reached
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_finish_row(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_finish_row";
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->number_of_rows += 1;
+
+	if( arrow_writer->number_of_rows >= ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS )
+	{
+		if( arrow_writer_flush(
+		     arrow_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record batch.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Encodes a 32-bit value as little-endian in an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_encode_uint32(
+     output_buffer_t *output_buffer,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 4 ];
+
+	static char *function = "arrow_writer_encode_uint32";
+
+	byte_stream_copy_from_uint32_little_endian(
+	 value_data,
+	 value );
+
+	if( output_buffer_append_string(
+	     output_buffer,
+	     (char *) value_data,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Encodes a 64-bit value as little-endian in an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_encode_uint64(
+     output_buffer_t *output_buffer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 8 ];
+
+	static char *function = "arrow_writer_encode_uint64";
+
+	byte_stream_copy_from_uint64_little_endian(
+	 value_data,
+	 value );
+
+	if( output_buffer_append_string(
+	     output_buffer,
+	     (char *) value_data,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Encodes an UTF-8 string, as a 32-bit little-endian length followed by the string, in an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_encode_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_encode_string";
+
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_encode_uint32(
+	     output_buffer,
+	     (uint32_t) utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > 0 )
+	{
+		if( output_buffer_append_string(
+		     output_buffer,
+		     (char *) utf8_string,
+		     utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends rows that were encoded with the arrow_writer_encode functions
+ * Every row consists of one encoded value per column in the order of the columns
+ * This allows rows to be built concurrently and appended in order
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_append_encoded_rows(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_append_encoded_rows";
+	size_t data_offset    = 0;
+	uint64_t value_64bit  = 0;
+	uint32_t value_32bit  = 0;
+	int column_index      = 0;
+	int result            = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->number_of_columns == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Arrow writer - missing columns.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		for( column_index = 0;
+		     column_index < arrow_writer->number_of_columns;
+		     column_index++ )
+		{
+			if( arrow_writer->columns[ column_index ].type == ARROW_WRITER_COLUMN_TYPE_UINT64 )
+			{
+				if( ( data_size - data_offset ) < 8 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 &( data[ data_offset ] ),
+				 value_64bit );
+
+				data_offset += 8;
+
+				result = arrow_writer_append_uint64_value(
+				          arrow_writer,
+				          column_index,
+				          value_64bit,
+				          error );
+			}
+			else
+			{
+				if( ( data_size - data_offset ) < 4 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 &( data[ data_offset ] ),
+				 value_32bit );
+
+				data_offset += 4;
+
+				if( arrow_writer->columns[ column_index ].type == ARROW_WRITER_COLUMN_TYPE_UINT32 )
+				{
+					result = arrow_writer_append_uint32_value(
+					          arrow_writer,
+					          column_index,
+					          value_32bit,
+					          error );
+				}
+				else
+				{
+					if( (size_t) value_32bit > ( data_size - data_offset ) )
+					{
+						break;
+					}
+					result = arrow_writer_append_string_value(
+					          arrow_writer,
+					          column_index,
+					          &( data[ data_offset ] ),
+					          (size_t) value_32bit,
+					          error );
+
+					data_offset += (size_t) value_32bit;
+				}
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value of column: %d.",
+				 function,
+				 column_index );
+
+				return( -1 );
+			}
+		}
+		if( column_index < arrow_writer->number_of_columns )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data - truncated row.",
+			 function );
+
+			return( -1 );
+		}
+		if( arrow_writer_finish_row(
+		     arrow_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to finish row.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a number of 0-byte values to the metadata buffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_append_zeros(
+     output_buffer_t *metadata,
+     size_t size,
+     size_t *offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_append_zeros";
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_resize(
+	     metadata,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > 0 )
+	{
+		if( memory_set(
+		     &( metadata->data[ metadata->data_offset ] ),
+		     0,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear metadata.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*offset = metadata->data_offset;
+
+	metadata->data_offset += size;
+
+	return( 1 );
+}
+
+/* Aligns the metadata buffer so that the offset modulo the alignment equals the remainder
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_align(
+     output_buffer_t *metadata,
+     size_t alignment,
+     size_t remainder,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_align";
+	size_t padding_offset = 0;
+	size_t padding_size   = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment == 0 )
+	 || ( remainder >= alignment ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	padding_size = ( alignment + remainder - ( metadata->data_offset % alignment ) ) % alignment;
+
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     padding_size,
+	     &padding_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append padding.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a 32-bit unsigned offset in the metadata buffer that references a target
+ * The target must be stored after the offset
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_set_offset(
+     output_buffer_t *metadata,
+     size_t value_offset,
+     size_t target_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_set_offset";
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( target_offset <= value_offset )
+	 || ( ( value_offset + 4 ) > metadata->data_offset )
+	 || ( target_offset >= metadata->data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( metadata->data[ value_offset ] ),
+	 (uint32_t) ( target_offset - value_offset ) );
+
+	return( 1 );
+}
+
+/* Appends a FlatBuffers table to the metadata buffer
+ * The vtable is stored directly before the table and the values are stored
+ * ordered by size to keep them aligned, offset values are set to 0 and
+ * must be set with arrow_writer_metadata_set_offset once the target is appended
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_append_table(
+     output_buffer_t *metadata,
+     arrow_writer_table_field_t *fields,
+     int number_of_fields,
+     size_t *table_offset,
+     libcerror_error_t **error )
+{
+	uint16_t field_offsets[ ARROW_WRITER_MAXIMUM_NUMBER_OF_TABLE_FIELDS ];
+
+	static char *function = "arrow_writer_metadata_append_table";
+	size_t safe_offset    = 0;
+	size_t vtable_offset  = 0;
+	uint16_t table_size   = 4;
+	uint8_t value_size    = 0;
+	int field_index       = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fields == NULL )
+	 && ( number_of_fields > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fields.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_fields < 0 )
+	 || ( number_of_fields > ARROW_WRITER_MAXIMUM_NUMBER_OF_TABLE_FIELDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of fields value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The table starts with the 32-bit vtable offset, 64-bit values
+	 * are stored from offset 8 so that they are aligned
+	 */
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		field_offsets[ field_index ] = 0;
+
+		if( fields[ field_index ].value_size == 8 )
+		{
+			table_size = 8;
+		}
+	}
+	for( value_size = 8;
+	     value_size > 0;
+	     value_size /= 2 )
+	{
+		for( field_index = 0;
+		     field_index < number_of_fields;
+		     field_index++ )
+		{
+			if( fields[ field_index ].value_size == value_size )
+			{
+				field_offsets[ field_index ] = table_size;
+
+				table_size += value_size;
+			}
+		}
+	}
+	if( arrow_writer_metadata_align(
+	     metadata,
+	     2,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to align vtable.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     4 + ( 2 * (size_t) number_of_fields ),
+	     &vtable_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append vtable.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( metadata->data[ vtable_offset ] ),
+	 (uint16_t) ( 4 + ( 2 * number_of_fields ) ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( metadata->data[ vtable_offset + 2 ] ),
+	 table_size );
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( metadata->data[ vtable_offset + 4 + ( 2 * field_index ) ] ),
+		 field_offsets[ field_index ] );
+	}
+	if( arrow_writer_metadata_align(
+	     metadata,
+	     8,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to align table.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     (size_t) table_size,
+	     &safe_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The vtable is stored before the table hence the signed offset is positive
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( metadata->data[ safe_offset ] ),
+	 (uint32_t) ( safe_offset - vtable_offset ) );
+
+	for( field_index = 0;
+	     field_index < number_of_fields;
+	     field_index++ )
+	{
+		fields[ field_index ].value_offset = safe_offset + field_offsets[ field_index ];
+
+		switch( fields[ field_index ].value_size )
+		{
+			case 1:
+				metadata->data[ fields[ field_index ].value_offset ] = (uint8_t) fields[ field_index ].value;
+				break;
+
+			case 2:
+				byte_stream_copy_from_uint16_little_endian(
+				 &( metadata->data[ fields[ field_index ].value_offset ] ),
+				 (uint16_t) fields[ field_index ].value );
+				break;
+
+			case 4:
+				byte_stream_copy_from_uint32_little_endian(
+				 &( metadata->data[ fields[ field_index ].value_offset ] ),
+				 (uint32_t) fields[ field_index ].value );
+				break;
+
+			case 8:
+				byte_stream_copy_from_uint64_little_endian(
+				 &( metadata->data[ fields[ field_index ].value_offset ] ),
+				 fields[ field_index ].value );
+				break;
+
+			default:
+				fields[ field_index ].value_offset = 0;
+				break;
+		}
+	}
+	*table_offset = safe_offset;
+
+	return( 1 );
+}
+
+/* Appends a FlatBuffers vector to the metadata buffer
+ * The elements are set to 0 and are aligned to the element alignment
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_append_vector(
+     output_buffer_t *metadata,
+     int number_of_elements,
+     size_t element_size,
+     size_t element_alignment,
+     size_t *vector_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "arrow_writer_metadata_append_vector";
+	size_t elements_offset = 0;
+	size_t safe_offset     = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of elements value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_alignment != 4 )
+	 && ( element_alignment != 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported element alignment.",
+		 function );
+
+		return( -1 );
+	}
+	if( vector_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid vector offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* The elements directly follow the 32-bit number of elements
+	 */
+	if( arrow_writer_metadata_align(
+	     metadata,
+	     element_alignment,
+	     element_alignment - 4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to align vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     4,
+	     &safe_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append vector.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( metadata->data[ safe_offset ] ),
+	 (uint32_t) number_of_elements );
+
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     element_size * (size_t) number_of_elements,
+	     &elements_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append vector elements.",
+		 function );
+
+		return( -1 );
+	}
+	*vector_offset = safe_offset;
+
+	return( 1 );
+}
+
+/* Appends a FlatBuffers string to the metadata buffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_append_string(
+     output_buffer_t *metadata,
+     const char *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_metadata_append_string";
+	size_t safe_offset    = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( UINT32_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_align(
+	     metadata,
+	     4,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to align string.",
+		 function );
+
+		return( -1 );
+	}
+	/* The string is stored with a 32-bit length and an end of string character
+	 */
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     4 + string_length + 1,
+	     &safe_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( metadata->data[ safe_offset ] ),
+	 (uint32_t) string_length );
+
+	if( string_length > 0 )
+	{
+		if( memory_copy(
+		     &( metadata->data[ safe_offset + 4 ] ),
+		     string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*string_offset = safe_offset;
+
+	return( 1 );
+}
+
+/* Appends an Int type table to the metadata buffer
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_append_int_type(
+     output_buffer_t *metadata,
+     uint32_t bit_width,
+     uint8_t is_signed,
+     size_t *table_offset,
+     libcerror_error_t **error )
+{
+	arrow_writer_table_field_t fields[ 2 ];
+
+	static char *function = "arrow_writer_metadata_append_int_type";
+
+	/* Int: bitWidth, is_signed
+	 */
+	fields[ 0 ].value_size = 4;
+	fields[ 0 ].value      = bit_width;
+	fields[ 1 ].value_size = 1;
+	fields[ 1 ].value      = is_signed;
+
+	if( arrow_writer_metadata_append_table(
+	     metadata,
+	     fields,
+	     2,
+	     table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append Int table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Starts a message in the metadata buffer
+ * The offset of the header value is set to reference the header table once it is appended
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_start_message(
+     output_buffer_t *metadata,
+     uint8_t header_type,
+     uint64_t body_length,
+     size_t *header_value_offset,
+     libcerror_error_t **error )
+{
+	arrow_writer_table_field_t fields[ 4 ];
+
+	static char *function = "arrow_writer_metadata_start_message";
+	size_t root_offset    = 0;
+	size_t table_offset   = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( header_value_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid header value offset.",
+		 function );
+
+		return( -1 );
+	}
+	metadata->data_offset = 0;
+
+	if( arrow_writer_metadata_append_zeros(
+	     metadata,
+	     4,
+	     &root_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Message: version, header_type, header, bodyLength
+	 */
+	fields[ 0 ].value_size = 2;
+	fields[ 0 ].value      = ARROW_WRITER_METADATA_VERSION;
+	fields[ 1 ].value_size = 1;
+	fields[ 1 ].value      = header_type;
+	fields[ 2 ].value_size = 4;
+	fields[ 2 ].value      = 0;
+	fields[ 3 ].value_size = 8;
+	fields[ 3 ].value      = body_length;
+
+	if( arrow_writer_metadata_append_table(
+	     metadata,
+	     fields,
+	     4,
+	     &table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append Message table.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_set_offset(
+	     metadata,
+	     root_offset,
+	     table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set root offset.",
+		 function );
+
+		return( -1 );
+	}
+	*header_value_offset = fields[ 2 ].value_offset;
+
+	return( 1 );
+}
+
+/* Appends a RecordBatch table to the metadata buffer
+ * Every node contains the number of rows and no null values
+ * The buffers are stored consecutively in the body, padded to a multiple of 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_metadata_append_record_batch(
+     output_buffer_t *metadata,
+     uint64_t number_of_rows,
+     int number_of_nodes,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     size_t *table_offset,
+     libcerror_error_t **error )
+{
+	arrow_writer_table_field_t fields[ 3 ];
+
+	static char *function = "arrow_writer_metadata_append_record_batch";
+	size_t buffer_offset  = 0;
+	size_t buffers_offset = 0;
+	size_t element_offset = 0;
+	size_t nodes_offset   = 0;
+	int buffer_index      = 0;
+	int node_index        = 0;
+
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* RecordBatch: length, nodes, buffers
+	 */
+	fields[ 0 ].value_size = 8;
+	fields[ 0 ].value      = number_of_rows;
+	fields[ 1 ].value_size = 4;
+	fields[ 1 ].value      = 0;
+	fields[ 2 ].value_size = 4;
+	fields[ 2 ].value      = 0;
+
+	if( arrow_writer_metadata_append_table(
+	     metadata,
+	     fields,
+	     3,
+	     table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append RecordBatch table.",
+		 function );
+
+		return( -1 );
+	}
+	/* FieldNode: length, null_count
+	 */
+	if( arrow_writer_metadata_append_vector(
+	     metadata,
+	     number_of_nodes,
+	     16,
+	     8,
+	     &nodes_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append nodes vector.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_index = 0;
+	     node_index < number_of_nodes;
+	     node_index++ )
+	{
+		element_offset = nodes_offset + 4 + ( 16 * (size_t) node_index );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( metadata->data[ element_offset ] ),
+		 number_of_rows );
+	}
+	/* Buffer: offset, length
+	 */
+	if( arrow_writer_metadata_append_vector(
+	     metadata,
+	     number_of_buffers,
+	     16,
+	     8,
+	     &buffers_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append buffers vector.",
+		 function );
+
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
+	{
+		element_offset = buffers_offset + 4 + ( 16 * (size_t) buffer_index );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( metadata->data[ element_offset ] ),
+		 (uint64_t) buffer_offset );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( metadata->data[ element_offset + 8 ] ),
+		 (uint64_t) buffer_sizes[ buffer_index ] );
+
+		buffer_offset += ARROW_WRITER_ALIGN_SIZE( buffer_sizes[ buffer_index ] );
+	}
+	if( ( arrow_writer_metadata_set_offset(
+	       metadata,
+	       fields[ 1 ].value_offset,
+	       nodes_offset,
+	       error ) != 1 )
+	 || ( arrow_writer_metadata_set_offset(
+	       metadata,
+	       fields[ 2 ].value_offset,
+	       buffers_offset,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set vector offsets.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data to the stream followed by 0-byte values to pad it to a multiple of 8 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_padded_data(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t padding[ 8 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0 };
+
+	static char *function = "arrow_writer_write_padded_data";
+	size_t padding_size   = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( fwrite(
+		     data,
+		     1,
+		     data_size,
+		     arrow_writer->stream ) != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	padding_size = ARROW_WRITER_ALIGN_SIZE( data_size ) - data_size;
+
+	if( padding_size > 0 )
+	{
+		if( fwrite(
+		     padding,
+		     1,
+		     padding_size,
+		     arrow_writer->stream ) != padding_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes the message in the metadata buffer as an encapsulated message
+ * The body must be written directly after the message
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_message(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	uint8_t message_prefix[ 8 ];
+
+	static char *function = "arrow_writer_write_message";
+	size_t metadata_size  = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	metadata_size = ARROW_WRITER_ALIGN_SIZE( arrow_writer->metadata->data_offset );
+
+	if( metadata_size > (size_t) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid metadata size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The message starts with a continuation marker and the size of the padded metadata
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 message_prefix,
+	 0xffffffffUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( message_prefix[ 4 ] ),
+	 (uint32_t) metadata_size );
+
+	if( fwrite(
+	     message_prefix,
+	     1,
+	     8,
+	     arrow_writer->stream ) != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_write_padded_data(
+	     arrow_writer,
+	     arrow_writer->metadata->data,
+	     arrow_writer->metadata->data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write message metadata.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the schema message
+ * The 32-bit and 64-bit columns are stored as unsigned integers and the string columns
+ * as dictionary encoded UTF-8 strings with signed 32-bit indexes and the column index
+ * as dictionary identifier
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_schema(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	arrow_writer_table_field_t fields[ 6 ];
+
+	arrow_writer_column_t *column  = NULL;
+	output_buffer_t *metadata      = NULL;
+	static char *function          = "arrow_writer_write_schema";
+	size_t children_value_offset   = 0;
+	size_t dictionary_value_offset = 0;
+	size_t fields_offset           = 0;
+	size_t header_value_offset     = 0;
+	size_t index_type_value_offset = 0;
+	size_t name_value_offset       = 0;
+	size_t table_offset            = 0;
+	size_t type_value_offset       = 0;
+	int column_index               = 0;
+	int result                     = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	metadata = arrow_writer->metadata;
+
+	if( arrow_writer_metadata_start_message(
+	     metadata,
+	     ARROW_WRITER_MESSAGE_HEADER_SCHEMA,
+	     0,
+	     &header_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to start message.",
+		 function );
+
+		return( -1 );
+	}
+	/* Schema: endianness, fields
+	 * The endianness is not set since the default is little-endian
+	 */
+	fields[ 0 ].value_size = 0;
+	fields[ 0 ].value      = 0;
+	fields[ 1 ].value_size = 4;
+	fields[ 1 ].value      = 0;
+
+	if( arrow_writer_metadata_append_table(
+	     metadata,
+	     fields,
+	     2,
+	     &table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append Schema table.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_set_offset(
+	     metadata,
+	     header_value_offset,
+	     table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set header offset.",
+		 function );
+
+		return( -1 );
+	}
+	table_offset = fields[ 1 ].value_offset;
+
+	if( arrow_writer_metadata_append_vector(
+	     metadata,
+	     arrow_writer->number_of_columns,
+	     4,
+	     4,
+	     &fields_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fields vector.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_metadata_set_offset(
+	     metadata,
+	     table_offset,
+	     fields_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set fields offset.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		column = &( arrow_writer->columns[ column_index ] );
+
+		/* Field: name, nullable, type_type, type, dictionary, children
+		 * The values are never null, hence nullable is not set
+		 */
+		fields[ 0 ].value_size = 4;
+		fields[ 0 ].value      = 0;
+		fields[ 1 ].value_size = 0;
+		fields[ 1 ].value      = 0;
+		fields[ 2 ].value_size = 1;
+		fields[ 3 ].value_size = 4;
+		fields[ 3 ].value      = 0;
+		fields[ 4 ].value_size = 0;
+		fields[ 4 ].value      = 0;
+		fields[ 5 ].value_size = 4;
+		fields[ 5 ].value      = 0;
+
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+		{
+			fields[ 2 ].value      = ARROW_WRITER_TYPE_UTF8;
+			fields[ 4 ].value_size = 4;
+		}
+		else
+		{
+			fields[ 2 ].value = ARROW_WRITER_TYPE_INT;
+		}
+		if( arrow_writer_metadata_append_table(
+		     metadata,
+		     fields,
+		     6,
+		     &table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append Field table: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		name_value_offset       = fields[ 0 ].value_offset;
+		type_value_offset       = fields[ 3 ].value_offset;
+		dictionary_value_offset = fields[ 4 ].value_offset;
+		children_value_offset   = fields[ 5 ].value_offset;
+
+		if( arrow_writer_metadata_set_offset(
+		     metadata,
+		     fields_offset + 4 + ( 4 * (size_t) column_index ),
+		     table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set field: %d offset.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( arrow_writer_metadata_append_string(
+		     metadata,
+		     column->name,
+		     narrow_string_length(
+		      column->name ),
+		     &table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field: %d name.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( arrow_writer_metadata_set_offset(
+		     metadata,
+		     name_value_offset,
+		     table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set field: %d name offset.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		/* The Utf8 type table has no values
+		 */
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+		{
+			result = arrow_writer_metadata_append_table(
+			          metadata,
+			          NULL,
+			          0,
+			          &table_offset,
+			          error );
+		}
+		else if( column->type == ARROW_WRITER_COLUMN_TYPE_UINT32 )
+		{
+			result = arrow_writer_metadata_append_int_type(
+			          metadata,
+			          32,
+			          0,
+			          &table_offset,
+			          error );
+		}
+		else
+		{
+			result = arrow_writer_metadata_append_int_type(
+			          metadata,
+			          64,
+			          0,
+			          &table_offset,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = arrow_writer_metadata_set_offset(
+			          metadata,
+			          type_value_offset,
+			          table_offset,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field: %d type.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( column->type == ARROW_WRITER_COLUMN_TYPE_STRING )
+		{
+			/* DictionaryEncoding: id, indexType
+			 */
+			fields[ 0 ].value_size = 8;
+			fields[ 0 ].value      = (uint64_t) column_index;
+			fields[ 1 ].value_size = 4;
+			fields[ 1 ].value      = 0;
+
+			result = arrow_writer_metadata_append_table(
+			          metadata,
+			          fields,
+			          2,
+			          &table_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				index_type_value_offset = fields[ 1 ].value_offset;
+
+				result = arrow_writer_metadata_set_offset(
+				          metadata,
+				          dictionary_value_offset,
+				          table_offset,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = arrow_writer_metadata_append_int_type(
+				          metadata,
+				          32,
+				          1,
+				          &table_offset,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = arrow_writer_metadata_set_offset(
+				          metadata,
+				          index_type_value_offset,
+				          table_offset,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append field: %d dictionary encoding.",
+				 function,
+				 column_index );
+
+				return( -1 );
+			}
+		}
+		if( arrow_writer_metadata_append_vector(
+		     metadata,
+		     0,
+		     4,
+		     4,
+		     &table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field: %d children.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		if( arrow_writer_metadata_set_offset(
+		     metadata,
+		     children_value_offset,
+		     table_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set field: %d children offset.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	if( arrow_writer_write_message(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write schema message.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->schema_written = 1;
+
+	return( 1 );
+}
+
+/* Writes the dictionary entries of a column that were not written before
+ * The first dictionary batch of a column contains all entries, the following
+ * dictionary batches are deltas that only contain the new entries
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_dictionary_batch(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     libcerror_error_t **error )
+{
+	arrow_writer_table_field_t fields[ 3 ];
+	size_t buffer_sizes[ 3 ];
+
+	arrow_writer_column_t *column = NULL;
+	static char *function         = "arrow_writer_write_dictionary_batch";
+	size_t data_value_offset      = 0;
+	size_t header_value_offset    = 0;
+	size_t table_offset           = 0;
+	uint32_t base_offset          = 0;
+	uint32_t end_offset           = 0;
+	uint32_t entry_offset         = 0;
+	int entry_index               = 0;
+	int number_of_entries         = 0;
+	int result                    = 0;
+
+	if( arrow_writer_get_column(
+	     arrow_writer,
+	     column_index,
+	     ARROW_WRITER_COLUMN_TYPE_STRING,
+	     &column,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_index );
+
+		return( -1 );
+	}
+	number_of_entries = column->number_of_dictionary_entries - column->number_of_written_dictionary_entries;
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( column->dictionary_offsets->data[ column->number_of_written_dictionary_entries * 4 ] ),
+	 base_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( column->dictionary_offsets->data[ column->number_of_dictionary_entries * 4 ] ),
+	 end_offset );
+
+	/* The offsets of the entries in the batch are relative to the first entry
+	 */
+	arrow_writer->body->data_offset = 0;
+
+	for( entry_index = column->number_of_written_dictionary_entries;
+	     entry_index <= column->number_of_dictionary_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( column->dictionary_offsets->data[ entry_index * 4 ] ),
+		 entry_offset );
+
+		if( arrow_writer_encode_uint32(
+		     arrow_writer->body,
+		     entry_offset - base_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append dictionary offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Utf8 array: validity, offsets, data
+	 */
+	buffer_sizes[ 0 ] = 0;
+	buffer_sizes[ 1 ] = arrow_writer->body->data_offset;
+	buffer_sizes[ 2 ] = (size_t) ( end_offset - base_offset );
+
+	result = arrow_writer_metadata_start_message(
+	          arrow_writer->metadata,
+	          ARROW_WRITER_MESSAGE_HEADER_DICTIONARY_BATCH,
+	          (uint64_t) ( ARROW_WRITER_ALIGN_SIZE( buffer_sizes[ 1 ] ) + ARROW_WRITER_ALIGN_SIZE( buffer_sizes[ 2 ] ) ),
+	          &header_value_offset,
+	          error );
+
+	if( result == 1 )
+	{
+		/* DictionaryBatch: id, data, isDelta
+		 */
+		fields[ 0 ].value_size = 8;
+		fields[ 0 ].value      = (uint64_t) column_index;
+		fields[ 1 ].value_size = 4;
+		fields[ 1 ].value      = 0;
+		fields[ 2 ].value_size = 1;
+		fields[ 2 ].value      = ( column->number_of_written_dictionary_entries > 0 ) ? 1 : 0;
+
+		result = arrow_writer_metadata_append_table(
+		          arrow_writer->metadata,
+		          fields,
+		          3,
+		          &table_offset,
+		          error );
+	}
+	if( result == 1 )
+	{
+		data_value_offset = fields[ 1 ].value_offset;
+
+		result = arrow_writer_metadata_set_offset(
+		          arrow_writer->metadata,
+		          header_value_offset,
+		          table_offset,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = arrow_writer_metadata_append_record_batch(
+		          arrow_writer->metadata,
+		          (uint64_t) number_of_entries,
+		          1,
+		          buffer_sizes,
+		          3,
+		          &table_offset,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = arrow_writer_metadata_set_offset(
+		          arrow_writer->metadata,
+		          data_value_offset,
+		          table_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to build dictionary batch message.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( arrow_writer_write_message(
+	       arrow_writer,
+	       error ) != 1 )
+	 || ( arrow_writer_write_padded_data(
+	       arrow_writer,
+	       arrow_writer->body->data,
+	       buffer_sizes[ 1 ],
+	       error ) != 1 )
+	 || ( arrow_writer_write_padded_data(
+	       arrow_writer,
+	       &( column->dictionary_data->data[ base_offset ] ),
+	       buffer_sizes[ 2 ],
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write dictionary batch.",
+		 function );
+
+		return( -1 );
+	}
+	arrow_writer->body->data_offset = 0;
+
+	column->number_of_written_dictionary_entries = column->number_of_dictionary_entries;
+
+	return( 1 );
+}
+
+/* Writes the values of the current rows as a record batch
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_write_record_batch(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	size_t buffer_sizes[ 2 * ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMNS ];
+
+	static char *function      = "arrow_writer_write_record_batch";
+	size_t header_value_offset = 0;
+	size_t table_offset        = 0;
+	uint64_t body_length       = 0;
+	int column_index           = 0;
+	int result                 = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every column has an empty validity buffer and a values buffer
+	 */
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		buffer_sizes[ 2 * column_index ]         = 0;
+		buffer_sizes[ ( 2 * column_index ) + 1 ] = arrow_writer->columns[ column_index ].values->data_offset;
+
+		body_length += ARROW_WRITER_ALIGN_SIZE( buffer_sizes[ ( 2 * column_index ) + 1 ] );
+	}
+	result = arrow_writer_metadata_start_message(
+	          arrow_writer->metadata,
+	          ARROW_WRITER_MESSAGE_HEADER_RECORD_BATCH,
+	          body_length,
+	          &header_value_offset,
+	          error );
+
+	if( result == 1 )
+	{
+		result = arrow_writer_metadata_append_record_batch(
+		          arrow_writer->metadata,
+		          (uint64_t) arrow_writer->number_of_rows,
+		          arrow_writer->number_of_columns,
+		          buffer_sizes,
+		          2 * arrow_writer->number_of_columns,
+		          &table_offset,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = arrow_writer_metadata_set_offset(
+		          arrow_writer->metadata,
+		          header_value_offset,
+		          table_offset,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to build record batch message.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_write_message(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record batch message.",
+		 function );
+
+		return( -1 );
+	}
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		if( arrow_writer_write_padded_data(
+		     arrow_writer,
+		     arrow_writer->columns[ column_index ].values->data,
+		     arrow_writer->columns[ column_index ].values->data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write column: %d values.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+		arrow_writer->columns[ column_index ].values->data_offset = 0;
+	}
+	arrow_writer->number_of_rows = 0;
+
+	return( 1 );
+}
+
+/* Writes the current rows as a record batch, preceded by the schema if not written before
+ * and the dictionary entries that were added since the previous record batch
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_flush(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "arrow_writer_flush";
+	int column_index      = 0;
+
+	if( arrow_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer->schema_written == 0 )
+	{
+		if( arrow_writer_write_schema(
+		     arrow_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write schema.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( arrow_writer->number_of_rows == 0 )
+	{
+		return( 1 );
+	}
+	for( column_index = 0;
+	     column_index < arrow_writer->number_of_columns;
+	     column_index++ )
+	{
+		if( arrow_writer->columns[ column_index ].type != ARROW_WRITER_COLUMN_TYPE_STRING )
+		{
+			continue;
+		}
+		if( arrow_writer_write_dictionary_batch(
+		     arrow_writer,
+		     column_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write dictionary batch of column: %d.",
+			 function,
+			 column_index );
+
+			return( -1 );
+		}
+	}
+	if( arrow_writer_write_record_batch(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record batch.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the remaining rows and the end of stream marker
+ * Returns 1 if successful or -1 on error
+ */
+int arrow_writer_close(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error )
+{
+	uint8_t end_of_stream[ 8 ];
+
+	static char *function = "arrow_writer_close";
+
+	if( arrow_writer_flush(
+	     arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush Arrow writer.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 end_of_stream,
+	 0xffffffffUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_stream[ 4 ] ),
+	 0 );
+
+	if( fwrite(
+	     end_of_stream,
+	     1,
+	     8,
+	     arrow_writer->stream ) != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end of stream marker.",
+		 function );
+
+		return( -1 );
+	}
+	if( fflush(
+	     arrow_writer->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
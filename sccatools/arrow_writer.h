@@ -0,0 +1,355 @@
+/*
+ * Apache Arrow IPC stream writer
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ARROW_WRITER_H )
+#define _ARROW_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of columns
+ */
+#define ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMNS		16
+
+/* The number of rows after which a record batch is written
+ */
+#define ARROW_WRITER_MAXIMUM_NUMBER_OF_ROWS		65536
+
+/* The initial number of entries of the dictionary hash table
+ */
+#define ARROW_WRITER_INITIAL_HASH_TABLE_SIZE		1024
+
+/* The maximum number of fields of a metadata table
+ */
+#define ARROW_WRITER_MAXIMUM_NUMBER_OF_TABLE_FIELDS	8
+
+/* The metadata version, 4 represents V5
+ */
+#define ARROW_WRITER_METADATA_VERSION			4
+
+/* Rounds a size up to a multiple of 8
+ */
+#define ARROW_WRITER_ALIGN_SIZE( size ) \
+	( ( ( size ) + 7 ) & ~( (size_t) 7 ) )
+
+enum ARROW_WRITER_MESSAGE_HEADER_TYPES
+{
+	ARROW_WRITER_MESSAGE_HEADER_SCHEMA		= 1,
+	ARROW_WRITER_MESSAGE_HEADER_DICTIONARY_BATCH	= 2,
+	ARROW_WRITER_MESSAGE_HEADER_RECORD_BATCH	= 3
+};
+
+enum ARROW_WRITER_TYPES
+{
+	ARROW_WRITER_TYPE_INT				= 2,
+	ARROW_WRITER_TYPE_UTF8				= 5
+};
+
+enum ARROW_WRITER_COLUMN_TYPES
+{
+	ARROW_WRITER_COLUMN_TYPE_UINT32		= 1,
+	ARROW_WRITER_COLUMN_TYPE_UINT64		= 2,
+	ARROW_WRITER_COLUMN_TYPE_STRING		= 3
+};
+
+typedef struct arrow_writer_table_field arrow_writer_table_field_t;
+
+struct arrow_writer_table_field
+{
+	/* The value size, 0 represents an absent value
+	 */
+	uint8_t value_size;
+
+	/* The value, offset values are stored as 0
+	 */
+	uint64_t value;
+
+	/* The offset of the value in the metadata
+	 */
+	size_t value_offset;
+};
+
+typedef struct arrow_writer_column arrow_writer_column_t;
+
+struct arrow_writer_column
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The column type
+	 */
+	int type;
+
+	/* The little-endian values of the current record batch
+	 * For a string column these are the 32-bit dictionary indexes
+	 */
+	output_buffer_t *values;
+
+	/* The little-endian 32-bit offsets of the dictionary entries
+	 * The offsets contain the start offset of every entry and the end offset of the last entry
+	 */
+	output_buffer_t *dictionary_offsets;
+
+	/* The UTF-8 data of the dictionary entries
+	 */
+	output_buffer_t *dictionary_data;
+
+	/* The dictionary hash table, contains the entry index + 1 or 0 if not set
+	 */
+	int *hash_table;
+
+	/* The number of entries of the dictionary hash table
+	 */
+	int hash_table_size;
+
+	/* The number of dictionary entries
+	 */
+	int number_of_dictionary_entries;
+
+	/* The number of dictionary entries written to the stream
+	 */
+	int number_of_written_dictionary_entries;
+};
+
+typedef struct arrow_writer arrow_writer_t;
+
+struct arrow_writer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The columns
+	 */
+	arrow_writer_column_t columns[ ARROW_WRITER_MAXIMUM_NUMBER_OF_COLUMNS ];
+
+	/* The number of columns
+	 */
+	int number_of_columns;
+
+	/* The number of rows of the current record batch
+	 */
+	int number_of_rows;
+
+	/* The buffer used to build the message metadata
+	 */
+	output_buffer_t *metadata;
+
+	/* The buffer used to build message body data
+	 */
+	output_buffer_t *body;
+
+	/* Value to indicate the schema was written
+	 */
+	uint8_t schema_written;
+};
+
+int arrow_writer_initialize(
+     arrow_writer_t **arrow_writer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int arrow_writer_free(
+     arrow_writer_t **arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_append_column(
+     arrow_writer_t *arrow_writer,
+     const char *name,
+     int column_type,
+     libcerror_error_t **error );
+
+int arrow_writer_get_column(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     int column_type,
+     arrow_writer_column_t **column,
+     libcerror_error_t **error );
+
+int arrow_writer_append_uint32_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint32_t value,
+     libcerror_error_t **error );
+
+int arrow_writer_append_uint64_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     uint64_t value,
+     libcerror_error_t **error );
+
+uint32_t arrow_writer_calculate_string_hash(
+          const uint8_t *utf8_string,
+          size_t utf8_string_length );
+
+int arrow_writer_column_resize_hash_table(
+     arrow_writer_column_t *column,
+     libcerror_error_t **error );
+
+int arrow_writer_column_get_dictionary_index(
+     arrow_writer_column_t *column,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *dictionary_index,
+     libcerror_error_t **error );
+
+int arrow_writer_append_string_value(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int arrow_writer_finish_row(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_encode_uint32(
+     output_buffer_t *output_buffer,
+     uint32_t value,
+     libcerror_error_t **error );
+
+int arrow_writer_encode_uint64(
+     output_buffer_t *output_buffer,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int arrow_writer_encode_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int arrow_writer_append_encoded_rows(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_append_zeros(
+     output_buffer_t *metadata,
+     size_t size,
+     size_t *offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_align(
+     output_buffer_t *metadata,
+     size_t alignment,
+     size_t remainder,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_set_offset(
+     output_buffer_t *metadata,
+     size_t value_offset,
+     size_t target_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_append_table(
+     output_buffer_t *metadata,
+     arrow_writer_table_field_t *fields,
+     int number_of_fields,
+     size_t *table_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_append_vector(
+     output_buffer_t *metadata,
+     int number_of_elements,
+     size_t element_size,
+     size_t element_alignment,
+     size_t *vector_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_append_string(
+     output_buffer_t *metadata,
+     const char *string,
+     size_t string_length,
+     size_t *string_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_append_int_type(
+     output_buffer_t *metadata,
+     uint32_t bit_width,
+     uint8_t is_signed,
+     size_t *table_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_start_message(
+     output_buffer_t *metadata,
+     uint8_t header_type,
+     uint64_t body_length,
+     size_t *header_value_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_metadata_append_record_batch(
+     output_buffer_t *metadata,
+     uint64_t number_of_rows,
+     int number_of_nodes,
+     const size_t *buffer_sizes,
+     int number_of_buffers,
+     size_t *table_offset,
+     libcerror_error_t **error );
+
+int arrow_writer_write_padded_data(
+     arrow_writer_t *arrow_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int arrow_writer_write_message(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_schema(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_write_dictionary_batch(
+     arrow_writer_t *arrow_writer,
+     int column_index,
+     libcerror_error_t **error );
+
+int arrow_writer_write_record_batch(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_flush(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+int arrow_writer_close(
+     arrow_writer_t *arrow_writer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ARROW_WRITER_H ) */
+
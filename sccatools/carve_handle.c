@@ -0,0 +1,652 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "carve_handle.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#define CARVE_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a carve handle
+ * Make sure the value carve_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_initialize";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*carve_handle = memory_allocate_structure(
+	                 carve_handle_t );
+
+	if( *carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *carve_handle,
+	     0,
+	     sizeof( carve_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &( ( *carve_handle )->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *carve_handle )->alignment         = 1;
+	( *carve_handle )->number_of_threads = 1;
+	( *carve_handle )->notify_stream     = CARVE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *carve_handle != NULL )
+	{
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a carve handle
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_free";
+	int result            = 1;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		if( ( *carve_handle )->input_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( ( *carve_handle )->input_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *carve_handle )->window_buffer != NULL )
+		{
+			memory_free(
+			 ( *carve_handle )->window_buffer );
+		}
+		if( ( *carve_handle )->results != NULL )
+		{
+			memory_free(
+			 ( *carve_handle )->results );
+		}
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the carve handle to abort
+ * The scan stops after the current window
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_signal_abort";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "carve_handle_open_input";
+	size_t filename_length = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     carve_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     carve_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     carve_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_close_input";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     carve_handle->input_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Scans the input for embedded prefetch files
+ * The input is read in windows of CARVE_HANDLE_WINDOW_SIZE bytes, the results
+ * of a window are printed in order of offset after the window has been scanned
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_scan_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_scan_input";
+	size64_t input_size   = 0;
+	size64_t remaining    = 0;
+	size_t buffer_size    = 0;
+	size_t overlap_size   = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     carve_handle->input_file_io_handle,
+	     &input_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve input size.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->window_buffer == NULL )
+	{
+		carve_handle->window_buffer = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * ( CARVE_HANDLE_WINDOW_SIZE + CARVE_HANDLE_OVERLAP_SIZE ) );
+
+		if( carve_handle->window_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create window buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	carve_handle->window_offset         = 0;
+	carve_handle->number_of_files_found = 0;
+
+	while( (size64_t) carve_handle->window_offset < input_size )
+	{
+		if( carve_handle->abort != 0 )
+		{
+			break;
+		}
+		remaining   = input_size - (size64_t) carve_handle->window_offset;
+		buffer_size = CARVE_HANDLE_WINDOW_SIZE + CARVE_HANDLE_OVERLAP_SIZE;
+
+		if( remaining < (size64_t) buffer_size )
+		{
+			buffer_size = (size_t) remaining;
+		}
+		read_size = buffer_size - overlap_size;
+
+		read_count = libbfio_handle_read_buffer(
+		              carve_handle->input_file_io_handle,
+		              &( carve_handle->window_buffer[ overlap_size ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read window at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 carve_handle->window_offset,
+			 carve_handle->window_offset );
+
+			return( -1 );
+		}
+		carve_handle->window_data_size = buffer_size;
+
+		if( carve_handle->window_data_size > CARVE_HANDLE_WINDOW_SIZE )
+		{
+			carve_handle->window_data_size = CARVE_HANDLE_WINDOW_SIZE;
+		}
+		carve_handle->number_of_results = 0;
+
+		if( libscca_scan_buffer(
+		     carve_handle->window_buffer,
+		     buffer_size,
+		     carve_handle->alignment,
+		     carve_handle->number_of_threads,
+		     &carve_handle_scan_callback,
+		     (void *) carve_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan window at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 carve_handle->window_offset,
+			 carve_handle->window_offset );
+
+			return( -1 );
+		}
+		if( carve_handle_results_fprint(
+		     carve_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print results.",
+			 function );
+
+			return( -1 );
+		}
+		if( buffer_size <= CARVE_HANDLE_WINDOW_SIZE )
+		{
+			break;
+		}
+		/* The overlap is the start of the next window
+		 */
+		overlap_size = buffer_size - CARVE_HANDLE_WINDOW_SIZE;
+
+		if( memory_copy(
+		     carve_handle->window_buffer,
+		     &( carve_handle->window_buffer[ CARVE_HANDLE_WINDOW_SIZE ] ),
+		     overlap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy overlap.",
+			 function );
+
+			return( -1 );
+		}
+		carve_handle->window_offset += CARVE_HANDLE_WINDOW_SIZE;
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Number of prefetch files found: %d\n",
+	 carve_handle->number_of_files_found );
+
+	return( 1 );
+}
+
+/* Records a file header found in the current window
+ * Callback function for libscca_scan_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_scan_callback(
+     size_t offset,
+     int file_type,
+     uint32_t data_size,
+     void *callback_arguments )
+{
+	carve_handle_result_t *result   = NULL;
+	carve_handle_result_t *results  = NULL;
+	carve_handle_t *carve_handle    = NULL;
+	size_t results_size             = 0;
+	int number_of_allocated_results = 0;
+
+	if( callback_arguments == NULL )
+	{
+		return( -1 );
+	}
+	carve_handle = (carve_handle_t *) callback_arguments;
+
+	/* A file header in the overlap is reported as part of the next window
+	 */
+	if( offset >= carve_handle->window_data_size )
+	{
+		return( 1 );
+	}
+	if( carve_handle->number_of_results >= carve_handle->number_of_allocated_results )
+	{
+		if( carve_handle->number_of_allocated_results == 0 )
+		{
+			number_of_allocated_results = 64;
+		}
+		else
+		{
+			number_of_allocated_results = carve_handle->number_of_allocated_results * 2;
+		}
+		results_size = sizeof( carve_handle_result_t ) * number_of_allocated_results;
+
+		if( results_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			return( -1 );
+		}
+		results = (carve_handle_result_t *) memory_reallocate(
+		                                     carve_handle->results,
+		                                     results_size );
+
+		if( results == NULL )
+		{
+			return( -1 );
+		}
+		carve_handle->results                     = results;
+		carve_handle->number_of_allocated_results = number_of_allocated_results;
+	}
+	result = &( carve_handle->results[ carve_handle->number_of_results ] );
+
+	result->offset    = carve_handle->window_offset + (off64_t) offset;
+	result->file_type = file_type;
+	result->data_size = data_size;
+
+	carve_handle->number_of_results += 1;
+
+	return( 1 );
+}
+
+/* Compares two results by offset
+ * Returns -1 if the first result precedes the second, 1 if it follows or 0 if equal
+ */
+int carve_handle_compare_results(
+     const carve_handle_result_t *first_result,
+     const carve_handle_result_t *second_result )
+{
+	if( first_result->offset < second_result->offset )
+	{
+		return( -1 );
+	}
+	else if( first_result->offset > second_result->offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Prints the results of the current window in order of offset
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_results_fprint(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	carve_handle_result_t *result = NULL;
+	static char *function         = "carve_handle_results_fprint";
+	int result_index              = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->number_of_results == 0 )
+	{
+		return( 1 );
+	}
+	if( carve_handle->results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carve handle - missing results.",
+		 function );
+
+		return( -1 );
+	}
+	/* The results are not in order of offset when the window is scanned by multiple threads
+	 */
+	qsort(
+	 carve_handle->results,
+	 (size_t) carve_handle->number_of_results,
+	 sizeof( carve_handle_result_t ),
+	 (int (*)(const void *, const void *)) &carve_handle_compare_results );
+
+	for( result_index = 0;
+	     result_index < carve_handle->number_of_results;
+	     result_index++ )
+	{
+		result = &( carve_handle->results[ result_index ] );
+
+		if( result->file_type == LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 )
+		{
+			fprintf(
+			 carve_handle->notify_stream,
+			 "Compressed prefetch file at offset: %" PRIi64 " (0x%08" PRIx64 ") with uncompressed data size: %" PRIu32 "\n",
+			 result->offset,
+			 result->offset,
+			 result->data_size );
+		}
+		else
+		{
+			fprintf(
+			 carve_handle->notify_stream,
+			 "Prefetch file at offset: %" PRIi64 " (0x%08" PRIx64 ") with file size: %" PRIu32 "\n",
+			 result->offset,
+			 result->offset,
+			 result->data_size );
+		}
+	}
+	carve_handle->number_of_files_found += carve_handle->number_of_results;
+	carve_handle->number_of_results      = 0;
+
+	return( 1 );
+}
+
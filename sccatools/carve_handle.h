@@ -0,0 +1,160 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CARVE_HANDLE_H )
+#define _CARVE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the part of the input that is read and scanned at once
+ */
+#define CARVE_HANDLE_WINDOW_SIZE	( 64 * 1024 * 1024 )
+
+/* The number of bytes of the next window that are read along with a window
+ * so that a file header at the end of the window can be checked
+ */
+#define CARVE_HANDLE_OVERLAP_SIZE	15
+
+typedef struct carve_handle_result carve_handle_result_t;
+
+struct carve_handle_result
+{
+	/* The offset relative to the start of the input
+	 */
+	off64_t offset;
+
+	/* The file type
+	 */
+	int file_type;
+
+	/* The file size or, for a compressed file, the uncompressed data size
+	 */
+	uint32_t data_size;
+};
+
+typedef struct carve_handle carve_handle_t;
+
+struct carve_handle
+{
+	/* The input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The alignment of the file headers in the input
+	 */
+	size_t alignment;
+
+	/* The number of threads used to scan a window
+	 */
+	int number_of_threads;
+
+	/* The window buffer
+	 */
+	uint8_t *window_buffer;
+
+	/* The offset of the current window relative to the start of the input
+	 */
+	off64_t window_offset;
+
+	/* The size of the data of the current window, excluding the overlap
+	 */
+	size_t window_data_size;
+
+	/* The results of the current window
+	 */
+	carve_handle_result_t *results;
+
+	/* The number of results of the current window
+	 */
+	int number_of_results;
+
+	/* The number of allocated results
+	 */
+	int number_of_allocated_results;
+
+	/* The number of prefetch files found
+	 */
+	int number_of_files_found;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_scan_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_scan_callback(
+     size_t offset,
+     int file_type,
+     uint32_t data_size,
+     void *callback_arguments );
+
+int carve_handle_compare_results(
+     const carve_handle_result_t *first_result,
+     const carve_handle_result_t *second_result );
+
+int carve_handle_results_fprint(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CARVE_HANDLE_H ) */
+
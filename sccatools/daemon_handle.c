@@ -0,0 +1,3054 @@
+/*
+ * Daemon handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "daemon_handle.h"
+
+#if defined( HAVE_DAEMON_SUPPORT )
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( HAVE_DAEMON_SUPPORT ) */
+
+#include "info_handle.h"
+#include "metrics_handle.h"
+#include "output_buffer.h"
+#include "progress_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+/* Creates a connection
+ * The connection takes over the socket descriptor, which is closed when the connection is freed.
+ * A socket descriptor of -1 represents a connection without a socket
+ * Make sure the value connection is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_connection_initialize(
+     daemon_connection_t **connection,
+     int socket_descriptor,
+     int output_format,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_connection_initialize";
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *connection != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid connection value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_descriptor < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid socket descriptor value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*connection = memory_allocate_structure(
+	               daemon_connection_t );
+
+	if( *connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *connection,
+	     0,
+	     sizeof( daemon_connection_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear connection.",
+		 function );
+
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+
+		return( -1 );
+	}
+	( *connection )->socket_descriptor = socket_descriptor;
+	( *connection )->output_format     = output_format;
+
+	return( 1 );
+}
+
+/* Frees a connection and closes its socket
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_connection_free(
+     daemon_connection_t **connection,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_connection_free";
+	int result            = 1;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( *connection != NULL )
+	{
+#if defined( HAVE_DAEMON_SUPPORT )
+		if( ( *connection )->socket_descriptor != -1 )
+		{
+			if( close(
+			     ( *connection )->socket_descriptor ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close socket.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *connection );
+
+		*connection = NULL;
+	}
+	return( result );
+}
+
+/* Creates a worker
+ * Make sure the value worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_worker_initialize(
+     daemon_worker_t **worker,
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_worker_initialize";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	*worker = memory_allocate_structure(
+	           daemon_worker_t );
+
+	if( *worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *worker,
+	     0,
+	     sizeof( daemon_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker.",
+		 function );
+
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+
+		return( -1 );
+	}
+	if( libscca_file_initialize(
+	     &( ( *worker )->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_initialize(
+	     &( ( *worker )->output_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *worker )->daemon_handle = daemon_handle;
+
+	return( 1 );
+
+on_error:
+	if( *worker != NULL )
+	{
+		if( ( *worker )->file != NULL )
+		{
+			libscca_file_free(
+			 &( ( *worker )->file ),
+			 NULL );
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a worker
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_worker_free(
+     daemon_worker_t **worker,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_worker_free";
+	int result            = 1;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		if( libscca_file_free(
+		     &( ( *worker )->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+		if( output_buffer_free(
+		     &( ( *worker )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *worker )->data != NULL )
+		{
+			memory_free(
+			 ( *worker )->data );
+		}
+		if( ( *worker )->snapshot_data != NULL )
+		{
+			memory_free(
+			 ( *worker )->snapshot_data );
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( result );
+}
+
+/* Creates a daemon handle
+ * The info handle is used as the template of the records of every request
+ * and must remain available while the daemon handle is used
+ * Make sure the value daemon_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_initialize(
+     daemon_handle_t **daemon_handle,
+     info_handle_t *info_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_initialize";
+	int worker_index      = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *daemon_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid daemon handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > DAEMON_HANDLE_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*daemon_handle = memory_allocate_structure(
+	                  daemon_handle_t );
+
+	if( *daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create daemon handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *daemon_handle,
+	     0,
+	     sizeof( daemon_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear daemon handle.",
+		 function );
+
+		memory_free(
+		 *daemon_handle );
+
+		*daemon_handle = NULL;
+
+		return( -1 );
+	}
+	( *daemon_handle )->workers = (daemon_worker_t **) memory_allocate(
+	                                                    sizeof( daemon_worker_t * ) * number_of_workers );
+
+	if( ( *daemon_handle )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *daemon_handle )->workers,
+	     0,
+	     sizeof( daemon_worker_t * ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *daemon_handle )->number_of_workers = number_of_workers;
+
+	if( metrics_handle_initialize(
+	     &( ( *daemon_handle )->metrics_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize metrics handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( daemon_worker_initialize(
+		     &( ( *daemon_handle )->workers[ worker_index ] ),
+		     *daemon_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue also contains the end of connections of every worker when the daemon stops
+	 */
+	if( libcthreads_queue_initialize(
+	     &( ( *daemon_handle )->connections_queue ),
+	     number_of_workers * ( DAEMON_HANDLE_CONNECTIONS_PER_WORKER + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize connections queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( daemon_connection_initialize(
+	     &( ( *daemon_handle )->end_of_connections ),
+	     -1,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize end of connections.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *daemon_handle )->info_handle              = info_handle;
+	( *daemon_handle )->output_format            = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+	( *daemon_handle )->listen_socket_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *daemon_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *daemon_handle )->connections_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *daemon_handle )->connections_queue ),
+			 NULL,
+			 NULL );
+		}
+#endif
+		if( ( *daemon_handle )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *daemon_handle )->number_of_workers;
+			     worker_index++ )
+			{
+				if( ( *daemon_handle )->workers[ worker_index ] != NULL )
+				{
+					daemon_worker_free(
+					 &( ( *daemon_handle )->workers[ worker_index ] ),
+					 NULL );
+				}
+			}
+			memory_free(
+			 ( *daemon_handle )->workers );
+		}
+		if( ( *daemon_handle )->metrics_handle != NULL )
+		{
+			metrics_handle_free(
+			 &( ( *daemon_handle )->metrics_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *daemon_handle );
+
+		*daemon_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a daemon handle
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_free(
+     daemon_handle_t **daemon_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *daemon_handle != NULL )
+	{
+#if defined( HAVE_DAEMON_SUPPORT )
+		if( ( *daemon_handle )->listen_socket_descriptor != -1 )
+		{
+			if( daemon_handle_close(
+			     *daemon_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close daemon handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_queue_free(
+		     &( ( *daemon_handle )->connections_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free connections queue.",
+			 function );
+
+			result = -1;
+		}
+		if( daemon_connection_free(
+		     &( ( *daemon_handle )->end_of_connections ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free end of connections.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( worker_index = 0;
+		     worker_index < ( *daemon_handle )->number_of_workers;
+		     worker_index++ )
+		{
+			if( daemon_worker_free(
+			     &( ( *daemon_handle )->workers[ worker_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *daemon_handle )->workers );
+
+		if( metrics_handle_free(
+		     &( ( *daemon_handle )->metrics_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metrics handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *daemon_handle );
+
+		*daemon_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the daemon handle to abort
+ * Blocked accepts and receives notice the abort within DAEMON_HANDLE_ABORT_CHECK_INTERVAL
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_signal_abort(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_signal_abort";
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the path of the metrics file
+ * The metrics are written to the file periodically while the daemon runs and when it stops
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_set_metrics_path(
+     daemon_handle_t *daemon_handle,
+     const char *metrics_path,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_set_metrics_path";
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( metrics_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics path.",
+		 function );
+
+		return( -1 );
+	}
+	daemon_handle->metrics_path = metrics_path;
+
+	return( 1 );
+}
+
+/* Writes the metrics file if a metrics path was set
+ * Returns 1 if written, 0 if not or -1 on error
+ */
+int daemon_handle_write_metrics(
+     daemon_handle_t *daemon_handle,
+     uint64_t interval,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_write_metrics";
+	int result            = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle->metrics_path == NULL )
+	{
+		return( 0 );
+	}
+	result = metrics_handle_write_file(
+	          daemon_handle->metrics_handle,
+	          daemon_handle->metrics_path,
+	          interval,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metrics file: %s.",
+		 function,
+		 daemon_handle->metrics_path );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines the output format from a string
+ * The output formats are the info handle output formats, except for arrow
+ * which is a stream that cannot be split into records, and snapshot
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int daemon_handle_parse_output_format(
+     const char *string,
+     size_t string_length,
+     int *output_format )
+{
+	int result = 0;
+
+	if( ( string == NULL )
+	 || ( output_format == NULL ) )
+	{
+		return( -1 );
+	}
+	if( string_length == 3 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "csv",
+		     3 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_CSV;
+			result         = 1;
+		}
+		else if( narrow_string_compare(
+		          string,
+		          "sql",
+		          3 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_SQL;
+			result         = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "text",
+		     4 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+			result         = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "jsonl",
+		     5 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+			result         = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( narrow_string_compare(
+		     string,
+		     "bodyfile",
+		     8 ) == 0 )
+		{
+			*output_format = INFO_HANDLE_OUTPUT_FORMAT_BODYFILE;
+			result         = 1;
+		}
+		else if( narrow_string_compare(
+		          string,
+		          "snapshot",
+		          8 ) == 0 )
+		{
+			*output_format = DAEMON_HANDLE_OUTPUT_FORMAT_SNAPSHOT;
+			result         = 1;
+		}
+	}
+	return( result );
+}
+
+/* Parses a request line, without the end-of-line character
+ * A request consists of a request keyword and an argument separated by a single space
+ * The argument is not copied and points into the line
+ * The metrics request has no argument, for which the argument is set to NULL
+ * Returns 1 if successful, 0 if not a valid request or -1 on error
+ */
+int daemon_handle_parse_request(
+     const char *line,
+     size_t line_length,
+     int *request_type,
+     const char **argument,
+     size_t *argument_length )
+{
+	size_t keyword_length = 0;
+
+	if( ( line == NULL )
+	 || ( request_type == NULL )
+	 || ( argument == NULL )
+	 || ( argument_length == NULL ) )
+	{
+		return( -1 );
+	}
+	while( ( keyword_length < line_length )
+	    && ( line[ keyword_length ] != ' ' ) )
+	{
+		keyword_length++;
+	}
+	if( ( line_length == 7 )
+	 && ( narrow_string_compare(
+	       line,
+	       "metrics",
+	       7 ) == 0 ) )
+	{
+		*request_type    = DAEMON_HANDLE_REQUEST_TYPE_METRICS;
+		*argument        = NULL;
+		*argument_length = 0;
+
+		return( 1 );
+	}
+	/* The argument cannot be empty
+	 */
+	if( ( keyword_length + 1 ) >= line_length )
+	{
+		return( 0 );
+	}
+	if( keyword_length == 4 )
+	{
+		if( narrow_string_compare(
+		     line,
+		     "data",
+		     4 ) == 0 )
+		{
+			*request_type = DAEMON_HANDLE_REQUEST_TYPE_DATA;
+		}
+		else if( narrow_string_compare(
+		          line,
+		          "path",
+		          4 ) == 0 )
+		{
+			*request_type = DAEMON_HANDLE_REQUEST_TYPE_PATH;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	else if( keyword_length == 6 )
+	{
+		if( narrow_string_compare(
+		     line,
+		     "format",
+		     6 ) == 0 )
+		{
+			*request_type = DAEMON_HANDLE_REQUEST_TYPE_FORMAT;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		return( 0 );
+	}
+	*argument        = &( line[ keyword_length + 1 ] );
+	*argument_length = line_length - ( keyword_length + 1 );
+
+	return( 1 );
+}
+
+/* Parses the decimal data size of a data request
+ * Returns 1 if successful, 0 if not a valid data size or -1 on error
+ */
+int daemon_handle_parse_data_size(
+     const char *string,
+     size_t string_length,
+     size_t *data_size )
+{
+	size_t string_index = 0;
+	size_t value        = 0;
+
+	if( ( string == NULL )
+	 || ( data_size == NULL ) )
+	{
+		return( -1 );
+	}
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < '0' )
+		 || ( string[ string_index ] > '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (size_t) ( string[ string_index ] - '0' );
+
+		if( value > (size_t) DAEMON_HANDLE_MAXIMUM_DATA_SIZE )
+		{
+			return( 0 );
+		}
+	}
+	*data_size = value;
+
+	return( 1 );
+}
+
+/* Resizes a buffer of a worker
+ * The buffer is only reallocated if it is smaller than the requested size,
+ * hence the buffers of a worker grow to the largest request and are then reused
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_worker_resize_buffer(
+     uint8_t **buffer,
+     size_t *allocated_buffer_size,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_worker_resize_buffer";
+	uint8_t *resized_data = NULL;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > *allocated_buffer_size )
+	{
+		resized_data = (uint8_t *) memory_reallocate(
+		                            *buffer,
+		                            sizeof( uint8_t ) * buffer_size );
+
+		if( resized_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		*buffer                = resized_data;
+		*allocated_buffer_size = buffer_size;
+	}
+	return( 1 );
+}
+
+/* Formats the file that is opened by the worker
+ * The response data is either the snapshot data of the file or the record of the file
+ * in the output format, both are stored in the buffers of the worker and remain
+ * available until the next request of the worker
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_worker_process_file(
+     daemon_worker_t *worker,
+     int output_format,
+     const system_character_t *source_path,
+     const uint8_t **response_data,
+     size_t *response_data_size,
+     libcerror_error_t **error )
+{
+	info_handle_t request_info_handle;
+
+	static char *function     = "daemon_worker_process_file";
+	size_t snapshot_data_size = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( response_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid response data.",
+		 function );
+
+		return( -1 );
+	}
+	if( response_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid response data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_format == DAEMON_HANDLE_OUTPUT_FORMAT_SNAPSHOT )
+	{
+		if( libscca_file_get_snapshot_size(
+		     worker->file,
+		     &snapshot_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve snapshot size.",
+			 function );
+
+			return( -1 );
+		}
+		if( daemon_worker_resize_buffer(
+		     &( worker->snapshot_data ),
+		     &( worker->allocated_snapshot_data_size ),
+		     snapshot_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize snapshot data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libscca_file_write_snapshot(
+		     worker->file,
+		     worker->snapshot_data,
+		     snapshot_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write snapshot.",
+			 function );
+
+			return( -1 );
+		}
+		*response_data      = worker->snapshot_data;
+		*response_data_size = snapshot_data_size;
+
+		return( 1 );
+	}
+	/* The info handle of the daemon is shared by the workers, hence every request
+	 * formats its record with a copy that has the output format of the connection
+	 */
+	if( memory_copy(
+	     &request_info_handle,
+	     worker->daemon_handle->info_handle,
+	     sizeof( info_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy info handle.",
+		 function );
+
+		return( -1 );
+	}
+	request_info_handle.output_format = output_format;
+
+	worker->output_buffer->data_offset = 0;
+
+	if( info_handle_file_append_with_file(
+	     &request_info_handle,
+	     worker->file,
+	     source_path,
+	     worker->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file information.",
+		 function );
+
+		return( -1 );
+	}
+	*response_data      = worker->output_buffer->data;
+	*response_data_size = worker->output_buffer->data_offset;
+
+	return( 1 );
+}
+
+#if defined( HAVE_DAEMON_SUPPORT )
+
+/* Opens the daemon handle
+ * Creates a Unix domain socket at the socket path that is only accessible by the user.
+ * A socket that remains at the socket path, for example of a daemon that was killed,
+ * is replaced, any other type of file is not
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_open(
+     daemon_handle_t *daemon_handle,
+     const char *socket_path,
+     libcerror_error_t **error )
+{
+	struct sockaddr_un socket_address;
+	struct stat file_stat;
+
+	static char *function    = "daemon_handle_open";
+	size_t socket_path_size  = 0;
+	mode_t previous_umask    = 0;
+	int result               = 0;
+	int socket_descriptor    = -1;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle->listen_socket_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid daemon handle - listen socket already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( socket_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid socket path.",
+		 function );
+
+		return( -1 );
+	}
+	socket_path_size = narrow_string_length(
+	                    socket_path ) + 1;
+
+	if( ( socket_path_size == 1 )
+	 || ( socket_path_size > sizeof( socket_address.sun_path ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid socket path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &socket_address,
+	     0,
+	     sizeof( struct sockaddr_un ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear socket address.",
+		 function );
+
+		goto on_error;
+	}
+	socket_address.sun_family = AF_UNIX;
+
+	if( memory_copy(
+	     socket_address.sun_path,
+	     socket_path,
+	     socket_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy socket path.",
+		 function );
+
+		goto on_error;
+	}
+	if( lstat(
+	     socket_path,
+	     &file_stat ) == 0 )
+	{
+		if( !S_ISSOCK( file_stat.st_mode ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: socket path exists and is not a socket.",
+			 function );
+
+			goto on_error;
+		}
+		if( unlink(
+		     socket_path ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove existing socket.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	socket_descriptor = socket(
+	                     AF_UNIX,
+	                     SOCK_STREAM,
+	                     0 );
+
+	if( socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create socket.",
+		 function );
+
+		goto on_error;
+	}
+	/* The socket is created without permissions for the group and others
+	 * since any client can make the daemon read the files it has access to
+	 */
+	previous_umask = umask(
+	                  S_IXUSR | S_IRWXG | S_IRWXO );
+
+	result = bind(
+	          socket_descriptor,
+	          (struct sockaddr *) &socket_address,
+	          sizeof( struct sockaddr_un ) );
+
+	umask(
+	 previous_umask );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to bind socket to: %s.",
+		 function,
+		 socket_path );
+
+		goto on_error;
+	}
+	if( listen(
+	     socket_descriptor,
+	     DAEMON_HANDLE_LISTEN_BACKLOG ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to listen on socket.",
+		 function );
+
+		unlink(
+		 socket_path );
+
+		goto on_error;
+	}
+	daemon_handle->socket_path = narrow_string_allocate(
+	                              socket_path_size );
+
+	if( daemon_handle->socket_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create socket path.",
+		 function );
+
+		unlink(
+		 socket_path );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     daemon_handle->socket_path,
+	     socket_path,
+	     socket_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy socket path.",
+		 function );
+
+		unlink(
+		 socket_path );
+
+		goto on_error;
+	}
+	daemon_handle->listen_socket_descriptor = socket_descriptor;
+
+	return( 1 );
+
+on_error:
+	if( daemon_handle->socket_path != NULL )
+	{
+		memory_free(
+		 daemon_handle->socket_path );
+
+		daemon_handle->socket_path = NULL;
+	}
+	if( socket_descriptor != -1 )
+	{
+		close(
+		 socket_descriptor );
+	}
+	return( -1 );
+}
+
+/* Closes the daemon handle
+ * Closes the listen socket and removes the socket path
+ * Returns the 0 if succesful or -1 on error
+ */
+int daemon_handle_close(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_close";
+	int result            = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle->listen_socket_descriptor != -1 )
+	{
+		if( close(
+		     daemon_handle->listen_socket_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close listen socket.",
+			 function );
+
+			result = -1;
+		}
+		daemon_handle->listen_socket_descriptor = -1;
+	}
+	if( daemon_handle->socket_path != NULL )
+	{
+		if( unlink(
+		     daemon_handle->socket_path ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+			 "%s: unable to remove socket: %s.",
+			 function,
+			 daemon_handle->socket_path );
+
+			result = -1;
+		}
+		memory_free(
+		 daemon_handle->socket_path );
+
+		daemon_handle->socket_path = NULL;
+	}
+	return( result );
+}
+
+/* Receives data from a connection
+ * The socket is polled so that the receive stops when abort is signalled
+ * Returns the number of bytes received, 0 at the end of the connection or if aborted or -1 on error
+ */
+ssize_t daemon_handle_receive(
+         daemon_handle_t *daemon_handle,
+         daemon_connection_t *connection,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	struct pollfd poll_descriptor;
+
+	static char *function = "daemon_handle_receive";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	poll_descriptor.fd     = connection->socket_descriptor;
+	poll_descriptor.events = POLLIN;
+
+	while( daemon_handle->abort == 0 )
+	{
+		poll_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          DAEMON_HANDLE_ABORT_CHECK_INTERVAL );
+
+		if( result == 0 )
+		{
+			continue;
+		}
+		else if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to poll socket.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = recv(
+		              connection->socket_descriptor,
+		              (void *) buffer,
+		              buffer_size,
+		              0 );
+
+		if( read_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			/* A connection that was reset by the client is treated as ended
+			 */
+			if( errno == ECONNRESET )
+			{
+				return( 0 );
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to receive from socket.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	return( 0 );
+}
+
+/* Sends data to a connection
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_send(
+     daemon_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_send";
+	size_t data_offset    = 0;
+	ssize_t write_count   = 0;
+	int flags             = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* A client that closed its connection must not terminate the daemon with SIGPIPE
+	 */
+#if defined( MSG_NOSIGNAL )
+	flags = MSG_NOSIGNAL;
+#endif
+
+	while( data_offset < data_size )
+	{
+		write_count = send(
+		               connection->socket_descriptor,
+		               (const void *) &( data[ data_offset ] ),
+		               data_size - data_offset,
+		               flags );
+
+		if( write_count == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to send to socket.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( 1 );
+}
+
+/* Reads a request line from a connection
+ * The line is stored without the end-of-line characters and is terminated
+ * by an end-of-string character
+ * Returns 1 if successful, 0 at the end of the connection or if aborted or -1 on error
+ */
+int daemon_handle_read_line(
+     daemon_handle_t *daemon_handle,
+     daemon_connection_t *connection,
+     char *line,
+     size_t line_size,
+     size_t *line_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "daemon_handle_read_line";
+	size_t buffer_index      = 0;
+	size_t remaining_size    = 0;
+	size_t search_offset     = 0;
+	ssize_t read_count       = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( line_size == 0 )
+	 || ( line_size > (size_t) DAEMON_HANDLE_RECEIVE_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid line size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line length.",
+		 function );
+
+		return( -1 );
+	}
+	search_offset = connection->receive_buffer_offset;
+
+	while( 1 )
+	{
+		for( buffer_index = search_offset;
+		     buffer_index < connection->receive_buffer_size;
+		     buffer_index++ )
+		{
+			if( connection->receive_buffer[ buffer_index ] == (uint8_t) '\n' )
+			{
+				break;
+			}
+		}
+		remaining_size = buffer_index - connection->receive_buffer_offset;
+
+		if( remaining_size >= line_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid line size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( buffer_index < connection->receive_buffer_size )
+		{
+			break;
+		}
+		search_offset = buffer_index;
+
+		/* Move the start of the line to the start of the receive buffer
+		 * if the remainder of the receive buffer cannot contain the rest of the line
+		 */
+		if( ( connection->receive_buffer_offset > 0 )
+		 && ( ( DAEMON_HANDLE_RECEIVE_BUFFER_SIZE - connection->receive_buffer_offset ) < line_size ) )
+		{
+			for( buffer_index = 0;
+			     buffer_index < remaining_size;
+			     buffer_index++ )
+			{
+				connection->receive_buffer[ buffer_index ] = connection->receive_buffer[ connection->receive_buffer_offset + buffer_index ];
+			}
+			connection->receive_buffer_offset = 0;
+			connection->receive_buffer_size   = remaining_size;
+			search_offset                     = remaining_size;
+		}
+		read_count = daemon_handle_receive(
+		              daemon_handle,
+		              connection,
+		              &( connection->receive_buffer[ connection->receive_buffer_size ] ),
+		              DAEMON_HANDLE_RECEIVE_BUFFER_SIZE - connection->receive_buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to receive line.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			return( 0 );
+		}
+		connection->receive_buffer_size += (size_t) read_count;
+	}
+	/* Remove a carriage return before the end-of-line character
+	 */
+	if( ( remaining_size > 0 )
+	 && ( connection->receive_buffer[ buffer_index - 1 ] == (uint8_t) '\r' ) )
+	{
+		remaining_size -= 1;
+	}
+	if( memory_copy(
+	     line,
+	     &( connection->receive_buffer[ connection->receive_buffer_offset ] ),
+	     remaining_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy line.",
+		 function );
+
+		return( -1 );
+	}
+	line[ remaining_size ] = 0;
+
+	*line_length = remaining_size;
+
+	connection->receive_buffer_offset = buffer_index + 1;
+
+	if( connection->receive_buffer_offset == connection->receive_buffer_size )
+	{
+		connection->receive_buffer_offset = 0;
+		connection->receive_buffer_size   = 0;
+	}
+	return( 1 );
+}
+
+/* Reads the data of a data request from a connection
+ * The data that was already received with the request line is copied from the receive buffer,
+ * the rest of the data is received directly into the data
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_read_data(
+     daemon_handle_t *daemon_handle,
+     daemon_connection_t *connection,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_read_data";
+	size_t data_offset    = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	read_size = connection->receive_buffer_size - connection->receive_buffer_offset;
+
+	if( read_size > data_size )
+	{
+		read_size = data_size;
+	}
+	if( read_size > 0 )
+	{
+		if( memory_copy(
+		     data,
+		     &( connection->receive_buffer[ connection->receive_buffer_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		connection->receive_buffer_offset += read_size;
+
+		if( connection->receive_buffer_offset == connection->receive_buffer_size )
+		{
+			connection->receive_buffer_offset = 0;
+			connection->receive_buffer_size   = 0;
+		}
+		data_offset = read_size;
+	}
+	while( data_offset < data_size )
+	{
+		read_count = daemon_handle_receive(
+		              daemon_handle,
+		              connection,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( read_count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to receive data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	return( 1 );
+}
+
+/* Sends a successful response, which consists of a line with the size of the data followed by the data
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_send_response(
+     daemon_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	char header[ 32 ];
+
+	static char *function = "daemon_handle_send_response";
+	int print_count       = 0;
+
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               header,
+	               32,
+	               "ok %" PRIzd "\n",
+	               data_size );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set response header.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle_send(
+	     connection,
+	     (uint8_t *) header,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send response header.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( daemon_handle_send(
+		     connection,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to send response data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sends an error response, which consists of a single line with the error message
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_send_error(
+     daemon_connection_t *connection,
+     const char *message,
+     libcerror_error_t **error )
+{
+	char response[ 256 ];
+
+	static char *function = "daemon_handle_send_error";
+	int print_count       = 0;
+
+	if( message == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               response,
+	               256,
+	               "error %s\n",
+	               message );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 256 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set error response.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle_send(
+	     connection,
+	     (uint8_t *) response,
+	     (size_t) print_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to send error response.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Serves the requests of a connection until the client closes it or abort is signalled
+ * A file that cannot be opened or formatted results in an error response,
+ * a request that is not valid results in an error response after which the connection is closed
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_worker_serve_connection(
+     daemon_worker_t *worker,
+     daemon_connection_t *connection,
+     libcerror_error_t **error )
+{
+	char line[ DAEMON_HANDLE_MAXIMUM_LINE_SIZE ];
+
+	libcerror_error_t *request_error = NULL;
+	const uint8_t *response_data     = NULL;
+	const char *argument             = NULL;
+	const char *error_message        = NULL;
+	static char *function            = "daemon_worker_serve_connection";
+	size_t argument_length           = 0;
+	size_t data_size                 = 0;
+	size_t line_length               = 0;
+	size_t response_data_size        = 0;
+	uint64_t start_timestamp         = 0;
+	int output_format                = 0;
+	int request_type                 = 0;
+	int result                       = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( connection == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid connection.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		result = daemon_handle_read_line(
+		          worker->daemon_handle,
+		          connection,
+		          line,
+		          DAEMON_HANDLE_MAXIMUM_LINE_SIZE,
+		          &line_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read request.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( daemon_handle_parse_request(
+		     line,
+		     line_length,
+		     &request_type,
+		     &argument,
+		     &argument_length ) != 1 )
+		{
+			if( daemon_handle_send_error(
+			     connection,
+			     "invalid request",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to send error response.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		if( request_type == DAEMON_HANDLE_REQUEST_TYPE_FORMAT )
+		{
+			if( daemon_handle_parse_output_format(
+			     argument,
+			     argument_length,
+			     &output_format ) != 1 )
+			{
+				result = daemon_handle_send_error(
+				          connection,
+				          "unsupported format",
+				          error );
+			}
+			else
+			{
+				connection->output_format = output_format;
+
+				result = daemon_handle_send_response(
+				          connection,
+				          NULL,
+				          0,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to send format response.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( request_type == DAEMON_HANDLE_REQUEST_TYPE_METRICS )
+		{
+			worker->output_buffer->data_offset = 0;
+
+			if( metrics_handle_append_text(
+			     worker->daemon_handle->metrics_handle,
+			     worker->output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append metrics.",
+				 function );
+
+				return( -1 );
+			}
+			if( daemon_handle_send_response(
+			     connection,
+			     worker->output_buffer->data,
+			     worker->output_buffer->data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to send metrics response.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		error_message = NULL;
+
+		if( request_type == DAEMON_HANDLE_REQUEST_TYPE_DATA )
+		{
+			if( daemon_handle_parse_data_size(
+			     argument,
+			     argument_length,
+			     &data_size ) != 1 )
+			{
+				if( daemon_handle_send_error(
+				     connection,
+				     "invalid data size",
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to send error response.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+			}
+			if( data_size == 0 )
+			{
+				error_message = "unable to open data";
+			}
+			else
+			{
+				if( daemon_worker_resize_buffer(
+				     &( worker->data ),
+				     &( worker->allocated_data_size ),
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize data.",
+					 function );
+
+					return( -1 );
+				}
+				if( progress_handle_get_timestamp(
+				     &start_timestamp ) != 1 )
+				{
+					start_timestamp = 0;
+				}
+				if( daemon_handle_read_data(
+				     worker->daemon_handle,
+				     connection,
+				     worker->data,
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data.",
+					 function );
+
+					return( -1 );
+				}
+				if( metrics_handle_add_stage_latency_since(
+				     worker->daemon_handle->metrics_handle,
+				     METRICS_HANDLE_STAGE_READ,
+				     start_timestamp,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to add read latency.",
+					 function );
+
+					return( -1 );
+				}
+				if( progress_handle_get_timestamp(
+				     &start_timestamp ) != 1 )
+				{
+					start_timestamp = 0;
+				}
+				if( libscca_file_open_memory(
+				     worker->file,
+				     worker->data,
+				     data_size,
+				     LIBSCCA_OPEN_READ,
+				     &request_error ) != 1 )
+				{
+					error_message = "unable to open data";
+				}
+			}
+			argument = NULL;
+		}
+		else
+		{
+			if( progress_handle_get_timestamp(
+			     &start_timestamp ) != 1 )
+			{
+				start_timestamp = 0;
+			}
+			if( libscca_file_open(
+			     worker->file,
+			     argument,
+			     LIBSCCA_OPEN_READ,
+			     &request_error ) != 1 )
+			{
+				error_message = "unable to open file";
+			}
+		}
+		if( error_message == NULL )
+		{
+			if( metrics_handle_add_stage_latency_since(
+			     worker->daemon_handle->metrics_handle,
+			     METRICS_HANDLE_STAGE_PARSE,
+			     start_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add parse latency.",
+				 function );
+
+				libscca_file_close(
+				 worker->file,
+				 NULL );
+
+				return( -1 );
+			}
+			if( progress_handle_get_timestamp(
+			     &start_timestamp ) != 1 )
+			{
+				start_timestamp = 0;
+			}
+			if( daemon_worker_process_file(
+			     worker,
+			     connection->output_format,
+			     argument,
+			     &response_data,
+			     &response_data_size,
+			     &request_error ) != 1 )
+			{
+				error_message = "unable to format file";
+			}
+			else if( metrics_handle_add_file(
+			          worker->daemon_handle->metrics_handle,
+			          worker->file,
+			          &request_error ) != 1 )
+			{
+				error_message = "unable to add file metrics";
+			}
+			if( libscca_file_close(
+			     worker->file,
+			     &request_error ) != 0 )
+			{
+				error_message = "unable to close file";
+			}
+		}
+		worker->number_of_requests += 1;
+
+		if( error_message != NULL )
+		{
+			if( metrics_handle_add_failed_file(
+			     worker->daemon_handle->metrics_handle,
+			     request_error,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to add failed file metrics.",
+				 function );
+
+				libcerror_error_free(
+				 &request_error );
+
+				return( -1 );
+			}
+			if( request_error != NULL )
+			{
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 request_error );
+				}
+				libcerror_error_free(
+				 &request_error );
+			}
+			worker->number_of_failed_requests += 1;
+
+			result = daemon_handle_send_error(
+			          connection,
+			          error_message,
+			          error );
+		}
+		else
+		{
+			result = daemon_handle_send_response(
+			          connection,
+			          response_data,
+			          response_data_size,
+			          error );
+
+			/* The output stage includes sending the response
+			 */
+			if( result == 1 )
+			{
+				result = metrics_handle_add_stage_latency_since(
+				          worker->daemon_handle->metrics_handle,
+				          METRICS_HANDLE_STAGE_OUTPUT,
+				          start_timestamp,
+				          error );
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to send response.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Serves the connections of the connections queue until the end of connections
+ * This function is the start function of the worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_worker_thread_callback(
+     daemon_worker_t *worker )
+{
+	daemon_connection_t *connection = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+	if( ( worker == NULL )
+	 || ( worker->daemon_handle == NULL ) )
+	{
+		return( -1 );
+	}
+	while( 1 )
+	{
+		result = libcthreads_queue_pop(
+		          worker->daemon_handle->connections_queue,
+		          (intptr_t **) &connection,
+		          &error );
+
+		if( ( result != 1 )
+		 || ( connection == worker->daemon_handle->end_of_connections ) )
+		{
+			break;
+		}
+		if( metrics_handle_add_queue_depth(
+		     worker->daemon_handle->metrics_handle,
+		     METRICS_HANDLE_QUEUE_CONNECTIONS,
+		     -1,
+		     &error ) != 1 )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+			libcerror_error_free(
+			 &error );
+		}
+		/* An error of a connection only ends that connection
+		 */
+		if( daemon_worker_serve_connection(
+		     worker,
+		     connection,
+		     &error ) != 1 )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+			libcerror_error_free(
+			 &error );
+		}
+		if( daemon_connection_free(
+		     &connection,
+		     &error ) != 1 )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( result == -1 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Starts the worker threads
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_start_workers(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_start_workers";
+	int worker_index      = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < daemon_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( daemon_handle->workers[ worker_index ]->thread ),
+		     NULL,
+		     (int (*)(void *)) &daemon_worker_thread_callback,
+		     (void *) daemon_handle->workers[ worker_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Stops the worker threads that were started
+ * Every worker receives an end of connections after the connections that are queued
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_stop_workers(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "daemon_handle_stop_workers";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < daemon_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( daemon_handle->workers[ worker_index ]->thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_queue_push(
+		     daemon_handle->connections_queue,
+		     (intptr_t *) daemon_handle->end_of_connections,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push end of connections onto queue.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < daemon_handle->number_of_workers;
+	     worker_index++ )
+	{
+		if( daemon_handle->workers[ worker_index ]->thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( daemon_handle->workers[ worker_index ]->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join worker thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Accepts connections on the listen socket until abort is signalled
+ * The connections are served by the worker threads, since every worker serves
+ * one connection at a time the number of workers caps the number of files
+ * that are parsed concurrently. Connections that are accepted while all workers
+ * are busy are queued and the accept blocks when the queue is full.
+ * If multi-threading support is not available the connections are served
+ * one after the other by the first worker
+ * Returns 1 if successful or -1 on error
+ */
+int daemon_handle_run(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error )
+{
+	struct pollfd poll_descriptor;
+
+	daemon_connection_t *connection  = NULL;
+	libcerror_error_t *metrics_error = NULL;
+	static char *function            = "daemon_handle_run";
+	int result                       = 0;
+	int socket_descriptor            = -1;
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *serve_error   = NULL;
+#endif
+
+	if( daemon_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid daemon handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( daemon_handle->listen_socket_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid daemon handle - missing listen socket.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( daemon_handle_start_workers(
+	     daemon_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to start workers.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	poll_descriptor.fd     = daemon_handle->listen_socket_descriptor;
+	poll_descriptor.events = POLLIN;
+
+	while( daemon_handle->abort == 0 )
+	{
+		/* A metrics file that cannot be written does not stop the daemon
+		 */
+		if( daemon_handle_write_metrics(
+		     daemon_handle,
+		     DAEMON_HANDLE_METRICS_WRITE_INTERVAL,
+		     &metrics_error ) == -1 )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 metrics_error );
+			}
+			libcerror_error_free(
+			 &metrics_error );
+		}
+		poll_descriptor.revents = 0;
+
+		result = poll(
+		          &poll_descriptor,
+		          1,
+		          DAEMON_HANDLE_ABORT_CHECK_INTERVAL );
+
+		if( result == 0 )
+		{
+			continue;
+		}
+		else if( result == -1 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to poll listen socket.",
+			 function );
+
+			goto on_error;
+		}
+		socket_descriptor = accept(
+		                     daemon_handle->listen_socket_descriptor,
+		                     NULL,
+		                     NULL );
+
+		if( socket_descriptor == -1 )
+		{
+			if( ( errno == EINTR )
+			 || ( errno == ECONNABORTED ) )
+			{
+				continue;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to accept connection.",
+			 function );
+
+			goto on_error;
+		}
+		if( daemon_connection_initialize(
+		     &connection,
+		     socket_descriptor,
+		     daemon_handle->output_format,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create connection.",
+			 function );
+
+			close(
+			 socket_descriptor );
+
+			goto on_error;
+		}
+		daemon_handle->number_of_connections += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		/* The depth is added before the push since a worker can pop the connection immediately
+		 */
+		if( metrics_handle_add_queue_depth(
+		     daemon_handle->metrics_handle,
+		     METRICS_HANDLE_QUEUE_CONNECTIONS,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to add connections queue depth.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     daemon_handle->connections_queue,
+		     (intptr_t *) connection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push connection onto queue.",
+			 function );
+
+			goto on_error;
+		}
+		connection = NULL;
+#else
+		/* An error of a connection only ends that connection
+		 */
+		if( daemon_worker_serve_connection(
+		     daemon_handle->workers[ 0 ],
+		     connection,
+		     &serve_error ) != 1 )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 serve_error );
+			}
+			libcerror_error_free(
+			 &serve_error );
+		}
+		if( daemon_connection_free(
+		     &connection,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free connection.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( daemon_handle_stop_workers(
+	     daemon_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop workers.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( daemon_handle_write_metrics(
+	     daemon_handle,
+	     0,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metrics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( connection != NULL )
+	{
+		daemon_connection_free(
+		 &connection,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The workers end the connections they serve when abort is signalled
+	 */
+	daemon_handle->abort = 1;
+
+	daemon_handle_stop_workers(
+	 daemon_handle,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+#endif /* defined( HAVE_DAEMON_SUPPORT ) */
+
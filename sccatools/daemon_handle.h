@@ -0,0 +1,373 @@
+/*
+ * Daemon handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DAEMON_HANDLE_H )
+#define _DAEMON_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "metrics_handle.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The daemon listens on a Unix domain socket, which requires narrow system strings
+ */
+#if defined( HAVE_SYS_SOCKET_H ) && defined( HAVE_SYS_UN_H ) && defined( HAVE_POLL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define HAVE_DAEMON_SUPPORT	1
+#endif
+
+enum DAEMON_HANDLE_REQUEST_TYPES
+{
+	DAEMON_HANDLE_REQUEST_TYPE_FORMAT	= 1,
+	DAEMON_HANDLE_REQUEST_TYPE_PATH		= 2,
+	DAEMON_HANDLE_REQUEST_TYPE_DATA		= 3,
+	DAEMON_HANDLE_REQUEST_TYPE_METRICS	= 4
+};
+
+/* The output format of a connection that returns the snapshot data of the files,
+ * the other output formats are the info handle output formats
+ */
+#define DAEMON_HANDLE_OUTPUT_FORMAT_SNAPSHOT	-1
+
+/* The time in milliseconds after which a blocked accept or receive checks if abort was signalled
+ */
+#define DAEMON_HANDLE_ABORT_CHECK_INTERVAL	1000
+
+/* The interval in nano seconds at which the metrics file is written
+ */
+#define DAEMON_HANDLE_METRICS_WRITE_INTERVAL	( (uint64_t) 10 * 1000000000UL )
+
+/* The number of pending connections of the listen socket
+ */
+#define DAEMON_HANDLE_LISTEN_BACKLOG		64
+
+/* The number of accepted connections per worker that wait for a worker
+ */
+#define DAEMON_HANDLE_CONNECTIONS_PER_WORKER	4
+
+/* The maximum number of workers
+ */
+#define DAEMON_HANDLE_MAXIMUM_NUMBER_OF_WORKERS	256
+
+/* The maximum size of a request line, including the end-of-line character
+ */
+#define DAEMON_HANDLE_MAXIMUM_LINE_SIZE		4096
+
+/* The maximum size of the data of a data request, prefetch files are much smaller
+ */
+#define DAEMON_HANDLE_MAXIMUM_DATA_SIZE		( 64 * 1024 * 1024 )
+
+/* The size of the receive buffer of a connection
+ */
+#define DAEMON_HANDLE_RECEIVE_BUFFER_SIZE	65536
+
+typedef struct daemon_connection daemon_connection_t;
+
+struct daemon_connection
+{
+	/* The socket descriptor
+	 */
+	int socket_descriptor;
+
+	/* The output format
+	 */
+	int output_format;
+
+	/* The receive buffer
+	 */
+	uint8_t receive_buffer[ DAEMON_HANDLE_RECEIVE_BUFFER_SIZE ];
+
+	/* The offset of the first byte in the receive buffer that was not yet consumed
+	 */
+	size_t receive_buffer_offset;
+
+	/* The size of the data in the receive buffer
+	 */
+	size_t receive_buffer_size;
+};
+
+typedef struct daemon_handle daemon_handle_t;
+
+typedef struct daemon_worker daemon_worker_t;
+
+struct daemon_worker
+{
+	/* The daemon handle
+	 */
+	daemon_handle_t *daemon_handle;
+
+	/* The libscca file, which is reused for every request so that
+	 * its data buffers and arena are only allocated once
+	 */
+	libscca_file_t *file;
+
+	/* The output buffer
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The data of a data request
+	 */
+	uint8_t *data;
+
+	/* The allocated data size, which is retained for the next request
+	 */
+	size_t allocated_data_size;
+
+	/* The snapshot data
+	 */
+	uint8_t *snapshot_data;
+
+	/* The allocated snapshot data size, which is retained for the next request
+	 */
+	size_t allocated_snapshot_data_size;
+
+	/* The number of requests
+	 */
+	uint64_t number_of_requests;
+
+	/* The number of requests that failed
+	 */
+	uint64_t number_of_failed_requests;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The worker thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct daemon_handle
+{
+	/* The info handle, used to format the records
+	 */
+	info_handle_t *info_handle;
+
+	/* The output format of new connections
+	 */
+	int output_format;
+
+	/* The workers
+	 */
+	daemon_worker_t **workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The listen socket descriptor
+	 */
+	int listen_socket_descriptor;
+
+	/* The socket path
+	 */
+	char *socket_path;
+
+	/* The number of accepted connections
+	 */
+	uint64_t number_of_connections;
+
+	/* The metrics handle
+	 */
+	metrics_handle_t *metrics_handle;
+
+	/* The path of the metrics file, which is not copied
+	 */
+	const char *metrics_path;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue of accepted connections
+	 */
+	libcthreads_queue_t *connections_queue;
+
+	/* The connection that indicates to a worker that no more connections follow
+	 */
+	daemon_connection_t *end_of_connections;
+#endif
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int daemon_connection_initialize(
+     daemon_connection_t **connection,
+     int socket_descriptor,
+     int output_format,
+     libcerror_error_t **error );
+
+int daemon_connection_free(
+     daemon_connection_t **connection,
+     libcerror_error_t **error );
+
+int daemon_worker_initialize(
+     daemon_worker_t **worker,
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error );
+
+int daemon_worker_free(
+     daemon_worker_t **worker,
+     libcerror_error_t **error );
+
+int daemon_handle_initialize(
+     daemon_handle_t **daemon_handle,
+     info_handle_t *info_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int daemon_handle_free(
+     daemon_handle_t **daemon_handle,
+     libcerror_error_t **error );
+
+int daemon_handle_signal_abort(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error );
+
+int daemon_handle_set_metrics_path(
+     daemon_handle_t *daemon_handle,
+     const char *metrics_path,
+     libcerror_error_t **error );
+
+int daemon_handle_write_metrics(
+     daemon_handle_t *daemon_handle,
+     uint64_t interval,
+     libcerror_error_t **error );
+
+int daemon_handle_parse_output_format(
+     const char *string,
+     size_t string_length,
+     int *output_format );
+
+int daemon_handle_parse_request(
+     const char *line,
+     size_t line_length,
+     int *request_type,
+     const char **argument,
+     size_t *argument_length );
+
+int daemon_handle_parse_data_size(
+     const char *string,
+     size_t string_length,
+     size_t *data_size );
+
+int daemon_worker_resize_buffer(
+     uint8_t **buffer,
+     size_t *allocated_buffer_size,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int daemon_worker_process_file(
+     daemon_worker_t *worker,
+     int output_format,
+     const system_character_t *source_path,
+     const uint8_t **response_data,
+     size_t *response_data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_DAEMON_SUPPORT )
+
+int daemon_handle_open(
+     daemon_handle_t *daemon_handle,
+     const char *socket_path,
+     libcerror_error_t **error );
+
+int daemon_handle_close(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error );
+
+ssize_t daemon_handle_receive(
+         daemon_handle_t *daemon_handle,
+         daemon_connection_t *connection,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int daemon_handle_send(
+     daemon_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int daemon_handle_read_line(
+     daemon_handle_t *daemon_handle,
+     daemon_connection_t *connection,
+     char *line,
+     size_t line_size,
+     size_t *line_length,
+     libcerror_error_t **error );
+
+int daemon_handle_read_data(
+     daemon_handle_t *daemon_handle,
+     daemon_connection_t *connection,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int daemon_handle_send_response(
+     daemon_connection_t *connection,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int daemon_handle_send_error(
+     daemon_connection_t *connection,
+     const char *message,
+     libcerror_error_t **error );
+
+int daemon_worker_serve_connection(
+     daemon_worker_t *worker,
+     daemon_connection_t *connection,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int daemon_worker_thread_callback(
+     daemon_worker_t *worker );
+
+int daemon_handle_start_workers(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error );
+
+int daemon_handle_stop_workers(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int daemon_handle_run(
+     daemon_handle_t *daemon_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_DAEMON_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DAEMON_HANDLE_H ) */
+
@@ -0,0 +1,1537 @@
+/*
+ * Deflate stream functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "deflate_stream.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+
+/* The order in which the sizes of the code size codes are stored
+ */
+const uint8_t deflate_stream_code_size_code_order[ 19 ] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/* The base lengths and number of extra bits of the length symbols 257 - 285
+ */
+const uint16_t deflate_stream_length_bases[ 29 ] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+const uint8_t deflate_stream_length_extra_bits[ 29 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+/* The base distances and number of extra bits of the distance symbols 0 - 29
+ */
+const uint16_t deflate_stream_distance_bases[ 30 ] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+const uint8_t deflate_stream_distance_extra_bits[ 30 ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* The CRC-32 (polynomial 0xedb88320) of the values 0 - 15, used to calculate
+ * the CRC-32 a nibble at a time
+ */
+const uint32_t deflate_crc32_nibble_table[ 16 ] = {
+	0x00000000UL, 0x1db71064UL, 0x3b6e20c8UL, 0x26d930acUL,
+	0x76dc4190UL, 0x6b6b51f4UL, 0x4db26158UL, 0x5005713cUL,
+	0xedb88320UL, 0xf00f9344UL, 0xd6d6a3e8UL, 0xcb61b38cUL,
+	0x9b64c2b0UL, 0x86d3d2d4UL, 0xa00ae278UL, 0xbdbdf21cUL };
+
+/* Creates a deflate stream
+ * Make sure the value deflate_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_initialize(
+     deflate_stream_t **deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_initialize";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid deflate stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*deflate_stream = memory_allocate_structure(
+	                   deflate_stream_t );
+
+	if( *deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *deflate_stream,
+	     0,
+	     sizeof( deflate_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear deflate stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *deflate_stream != NULL )
+	{
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a deflate stream
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_free(
+     deflate_stream_t **deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_free";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *deflate_stream != NULL )
+	{
+		/* The file IO handle is managed by the caller
+		 */
+		memory_free(
+		 *deflate_stream );
+
+		*deflate_stream = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the input of a deflate stream
+ * The compressed input is read from the current offset of the file IO handle
+ * and is at most input_size bytes. The output is passed to the output callback
+ * function in parts of at most DEFLATE_STREAM_WINDOW_SIZE bytes, the output
+ * callback function can be NULL to only determine the size and CRC-32 of the output
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_set_input(
+     deflate_stream_t *deflate_stream,
+     libbfio_handle_t *file_io_handle,
+     size64_t input_size,
+     int (*output_callback_function)(
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_arguments,
+            libcerror_error_t **error ),
+     void *output_callback_arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_set_input";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream->file_io_handle            = file_io_handle;
+	deflate_stream->remaining_input_size      = input_size;
+	deflate_stream->input_buffer_size         = 0;
+	deflate_stream->input_buffer_offset       = 0;
+	deflate_stream->bit_buffer                = 0;
+	deflate_stream->number_of_bits            = 0;
+	deflate_stream->window_offset             = 0;
+	deflate_stream->flushed_offset            = 0;
+	deflate_stream->crc32                     = 0;
+	deflate_stream->output_size               = 0;
+	deflate_stream->output_callback_function  = output_callback_function;
+	deflate_stream->output_callback_arguments = output_callback_arguments;
+
+	return( 1 );
+}
+
+/* Reads bits from the compressed input
+ * The bits are read from the least significant bit of every byte onwards
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_read_bits(
+     deflate_stream_t *deflate_stream,
+     uint8_t number_of_bits,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_read_bits";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 24 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	while( deflate_stream->number_of_bits < number_of_bits )
+	{
+		if( deflate_stream->input_buffer_offset >= deflate_stream->input_buffer_size )
+		{
+			if( deflate_stream->remaining_input_size == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: compressed data is truncated.",
+				 function );
+
+				return( -1 );
+			}
+			read_size = DEFLATE_STREAM_INPUT_BUFFER_SIZE;
+
+			if( (size64_t) read_size > deflate_stream->remaining_input_size )
+			{
+				read_size = (size_t) deflate_stream->remaining_input_size;
+			}
+			read_count = libbfio_handle_read_buffer(
+			              deflate_stream->file_io_handle,
+			              deflate_stream->input_buffer,
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read compressed data.",
+				 function );
+
+				return( -1 );
+			}
+			deflate_stream->remaining_input_size -= read_size;
+			deflate_stream->input_buffer_size     = read_size;
+			deflate_stream->input_buffer_offset   = 0;
+		}
+		deflate_stream->bit_buffer |= (uint32_t) deflate_stream->input_buffer[ deflate_stream->input_buffer_offset ] << deflate_stream->number_of_bits;
+
+		deflate_stream->input_buffer_offset += 1;
+		deflate_stream->number_of_bits      += 8;
+	}
+	*value = deflate_stream->bit_buffer & ( ( (uint32_t) 1 << number_of_bits ) - 1 );
+
+	deflate_stream->bit_buffer    >>= number_of_bits;
+	deflate_stream->number_of_bits -= number_of_bits;
+
+	return( 1 );
+}
+
+/* Discards the remaining bits of the current byte of the compressed input
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_align_to_byte(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function  = "deflate_stream_align_to_byte";
+	uint8_t number_of_bits = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bits = deflate_stream->number_of_bits % 8;
+
+	deflate_stream->bit_buffer    >>= number_of_bits;
+	deflate_stream->number_of_bits -= number_of_bits;
+
+	return( 1 );
+}
+
+/* Writes a byte to the output
+ * Once the window is full its second half is passed to the output callback function
+ * and moved to the first half, where it remains available to back references
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_write_byte(
+     deflate_stream_t *deflate_stream,
+     uint8_t byte_value,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_write_byte";
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	deflate_stream->window[ deflate_stream->window_offset ] = byte_value;
+
+	deflate_stream->window_offset += 1;
+
+	if( deflate_stream->window_offset >= ( 2 * DEFLATE_STREAM_WINDOW_SIZE ) )
+	{
+		if( deflate_stream_flush(
+		     deflate_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to flush output.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     deflate_stream->window,
+		     &( deflate_stream->window[ DEFLATE_STREAM_WINDOW_SIZE ] ),
+		     DEFLATE_STREAM_WINDOW_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to move window.",
+			 function );
+
+			return( -1 );
+		}
+		deflate_stream->window_offset  = DEFLATE_STREAM_WINDOW_SIZE;
+		deflate_stream->flushed_offset = DEFLATE_STREAM_WINDOW_SIZE;
+	}
+	return( 1 );
+}
+
+/* Writes a copy of previous output to the output
+ * The copy is made a byte at a time since it can overlap with itself
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_write_copy(
+     deflate_stream_t *deflate_stream,
+     uint16_t distance,
+     uint16_t length,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_write_copy";
+	uint16_t copy_index   = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( distance == 0 )
+	 || ( (size_t) distance > deflate_stream->window_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid distance value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( copy_index = 0;
+	     copy_index < length;
+	     copy_index++ )
+	{
+		if( deflate_stream_write_byte(
+		     deflate_stream,
+		     deflate_stream->window[ deflate_stream->window_offset - distance ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write byte.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Passes the output that was not yet passed to the output callback function
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_flush(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_flush";
+	size_t data_size      = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream->window_offset <= deflate_stream->flushed_offset )
+	{
+		return( 1 );
+	}
+	data_size = deflate_stream->window_offset - deflate_stream->flushed_offset;
+
+	deflate_stream->crc32 = deflate_calculate_crc32(
+	                         deflate_stream->crc32,
+	                         &( deflate_stream->window[ deflate_stream->flushed_offset ] ),
+	                         data_size );
+
+	deflate_stream->output_size += data_size;
+
+	if( deflate_stream->output_callback_function != NULL )
+	{
+		if( deflate_stream->output_callback_function(
+		     &( deflate_stream->window[ deflate_stream->flushed_offset ] ),
+		     data_size,
+		     deflate_stream->output_callback_arguments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: output callback function failed.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	deflate_stream->flushed_offset = deflate_stream->window_offset;
+
+	return( 1 );
+}
+
+/* Builds a canonical Huffman table from the code sizes of the symbols
+ * A code size of 0 indicates the symbol is not used. An incomplete set
+ * of codes is allowed, since a block can use a single distance code
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_huffman_table_build(
+     deflate_huffman_table_t *huffman_table,
+     const uint8_t *code_sizes,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error )
+{
+	uint16_t symbol_offsets[ DEFLATE_STREAM_MAXIMUM_CODE_SIZE + 1 ];
+
+	static char *function   = "deflate_huffman_table_build";
+	int32_t remaining_codes = 1;
+	uint16_t symbol         = 0;
+	uint8_t code_size       = 0;
+
+	if( huffman_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols > DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     huffman_table->code_size_counts,
+	     0,
+	     sizeof( uint16_t ) * ( DEFLATE_STREAM_MAXIMUM_CODE_SIZE + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		if( code_sizes[ symbol ] > DEFLATE_STREAM_MAXIMUM_CODE_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size of symbol: %" PRIu16 " value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		huffman_table->code_size_counts[ code_sizes[ symbol ] ] += 1;
+	}
+	huffman_table->code_size_counts[ 0 ] = 0;
+
+	for( code_size = 1;
+	     code_size <= DEFLATE_STREAM_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		remaining_codes <<= 1;
+		remaining_codes  -= huffman_table->code_size_counts[ code_size ];
+
+		if( remaining_codes < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code sizes - too many codes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	symbol_offsets[ 0 ] = 0;
+	symbol_offsets[ 1 ] = 0;
+
+	for( code_size = 1;
+	     code_size < DEFLATE_STREAM_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		symbol_offsets[ code_size + 1 ] = symbol_offsets[ code_size ] + huffman_table->code_size_counts[ code_size ];
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		if( code_size != 0 )
+		{
+			huffman_table->symbols[ symbol_offsets[ code_size ] ] = symbol;
+
+			symbol_offsets[ code_size ] += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Decodes a symbol using a Huffman table
+ * The bits of a code are stored from the most significant bit onwards
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_decode_symbol(
+     deflate_stream_t *deflate_stream,
+     const deflate_huffman_table_t *huffman_table,
+     uint16_t *symbol,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_decode_symbol";
+	uint32_t bit_value    = 0;
+	int32_t code          = 0;
+	int32_t first_code    = 0;
+	int32_t symbol_index  = 0;
+	uint8_t code_size     = 0;
+	uint16_t count        = 0;
+
+	if( huffman_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman table.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size = 1;
+	     code_size <= DEFLATE_STREAM_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		if( deflate_stream_read_bits(
+		     deflate_stream,
+		     1,
+		     &bit_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bit.",
+			 function );
+
+			return( -1 );
+		}
+		code |= (int32_t) bit_value;
+		count = huffman_table->code_size_counts[ code_size ];
+
+		if( ( code - first_code ) < (int32_t) count )
+		{
+			*symbol = huffman_table->symbols[ symbol_index + ( code - first_code ) ];
+
+			return( 1 );
+		}
+		symbol_index += count;
+		first_code   += count;
+		first_code  <<= 1;
+		code        <<= 1;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid code.",
+	 function );
+
+	return( -1 );
+}
+
+/* Reads the Huffman tables of a block with dynamic Huffman codes
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_read_dynamic_huffman_tables(
+     deflate_stream_t *deflate_stream,
+     deflate_huffman_table_t *literals_table,
+     deflate_huffman_table_t *distances_table,
+     libcerror_error_t **error )
+{
+	deflate_huffman_table_t code_sizes_table;
+
+	uint8_t code_sizes[ DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS + DEFLATE_STREAM_NUMBER_OF_DISTANCE_SYMBOLS ];
+
+	static char *function              = "deflate_stream_read_dynamic_huffman_tables";
+	uint32_t number_of_code_size_codes = 0;
+	uint32_t number_of_distance_codes  = 0;
+	uint32_t number_of_literal_codes   = 0;
+	uint32_t repeat_count              = 0;
+	uint32_t value_32bit               = 0;
+	uint16_t code_index                = 0;
+	uint16_t number_of_codes           = 0;
+	uint16_t symbol                    = 0;
+	uint8_t code_size                  = 0;
+
+	if( deflate_stream_read_bits(
+	     deflate_stream,
+	     5,
+	     &number_of_literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of literal codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream_read_bits(
+	     deflate_stream,
+	     5,
+	     &number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of distance codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_stream_read_bits(
+	     deflate_stream,
+	     4,
+	     &number_of_code_size_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of code size codes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_literal_codes   += 257;
+	number_of_distance_codes  += 1;
+	number_of_code_size_codes += 4;
+
+	if( ( number_of_literal_codes > 286 )
+	 || ( number_of_distance_codes > 30 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of codes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_sizes,
+	     0,
+	     sizeof( uint8_t ) * ( DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS + DEFLATE_STREAM_NUMBER_OF_DISTANCE_SYMBOLS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_index = 0;
+	     code_index < (uint16_t) number_of_code_size_codes;
+	     code_index++ )
+	{
+		if( deflate_stream_read_bits(
+		     deflate_stream,
+		     3,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read code size code: %" PRIu16 ".",
+			 function,
+			 code_index );
+
+			return( -1 );
+		}
+		code_sizes[ deflate_stream_code_size_code_order[ code_index ] ] = (uint8_t) value_32bit;
+	}
+	if( deflate_huffman_table_build(
+	     &code_sizes_table,
+	     code_sizes,
+	     19,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build code sizes table.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_codes = (uint16_t) ( number_of_literal_codes + number_of_distance_codes );
+
+	code_index = 0;
+
+	while( code_index < number_of_codes )
+	{
+		if( deflate_stream_decode_symbol(
+		     deflate_stream,
+		     &code_sizes_table,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode code size symbol.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol < 16 )
+		{
+			code_sizes[ code_index++ ] = (uint8_t) symbol;
+
+			continue;
+		}
+		code_size = 0;
+
+		if( symbol == 16 )
+		{
+			if( code_index == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing previous code size.",
+				 function );
+
+				return( -1 );
+			}
+			code_size = code_sizes[ code_index - 1 ];
+
+			if( deflate_stream_read_bits(
+			     deflate_stream,
+			     2,
+			     &repeat_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read repeat count.",
+				 function );
+
+				return( -1 );
+			}
+			repeat_count += 3;
+		}
+		else if( symbol == 17 )
+		{
+			if( deflate_stream_read_bits(
+			     deflate_stream,
+			     3,
+			     &repeat_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read repeat count.",
+				 function );
+
+				return( -1 );
+			}
+			repeat_count += 3;
+		}
+		else
+		{
+			if( deflate_stream_read_bits(
+			     deflate_stream,
+			     7,
+			     &repeat_count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read repeat count.",
+				 function );
+
+				return( -1 );
+			}
+			repeat_count += 11;
+		}
+		if( repeat_count > (uint32_t) ( number_of_codes - code_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid repeat count value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		while( repeat_count > 0 )
+		{
+			code_sizes[ code_index++ ] = code_size;
+
+			repeat_count--;
+		}
+	}
+	/* The end of block symbol must have a code
+	 */
+	if( code_sizes[ 256 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing end of block code.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_huffman_table_build(
+	     literals_table,
+	     code_sizes,
+	     (uint16_t) number_of_literal_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals table.",
+		 function );
+
+		return( -1 );
+	}
+	if( deflate_huffman_table_build(
+	     distances_table,
+	     &( code_sizes[ number_of_literal_codes ] ),
+	     (uint16_t) number_of_distance_codes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Builds the Huffman tables of a block with fixed Huffman codes
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_build_fixed_huffman_tables(
+     deflate_huffman_table_t *literals_table,
+     deflate_huffman_table_t *distances_table,
+     libcerror_error_t **error )
+{
+	uint8_t code_sizes[ DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS ];
+
+	static char *function = "deflate_stream_build_fixed_huffman_tables";
+	uint16_t symbol       = 0;
+
+	for( symbol = 0;
+	     symbol < DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS;
+	     symbol++ )
+	{
+		if( symbol < 144 )
+		{
+			code_sizes[ symbol ] = 8;
+		}
+		else if( symbol < 256 )
+		{
+			code_sizes[ symbol ] = 9;
+		}
+		else if( symbol < 280 )
+		{
+			code_sizes[ symbol ] = 7;
+		}
+		else
+		{
+			code_sizes[ symbol ] = 8;
+		}
+	}
+	if( deflate_huffman_table_build(
+	     literals_table,
+	     code_sizes,
+	     DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build literals table.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < DEFLATE_STREAM_NUMBER_OF_DISTANCE_SYMBOLS;
+	     symbol++ )
+	{
+		code_sizes[ symbol ] = 5;
+	}
+	if( deflate_huffman_table_build(
+	     distances_table,
+	     code_sizes,
+	     DEFLATE_STREAM_NUMBER_OF_DISTANCE_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build distances table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the literals and back references of a block with Huffman codes
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_decode_huffman_block(
+     deflate_stream_t *deflate_stream,
+     const deflate_huffman_table_t *literals_table,
+     const deflate_huffman_table_t *distances_table,
+     libcerror_error_t **error )
+{
+	static char *function = "deflate_stream_decode_huffman_block";
+	uint32_t extra_bits   = 0;
+	uint16_t distance     = 0;
+	uint16_t length       = 0;
+	uint16_t symbol       = 0;
+
+	while( 1 )
+	{
+		if( deflate_stream_decode_symbol(
+		     deflate_stream,
+		     literals_table,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode literal symbol.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol < 256 )
+		{
+			if( deflate_stream_write_byte(
+			     deflate_stream,
+			     (uint8_t) symbol,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to write literal.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( symbol == 256 )
+		{
+			break;
+		}
+		symbol -= 257;
+
+		if( symbol >= 29 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid length symbol value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_stream_read_bits(
+		     deflate_stream,
+		     deflate_stream_length_extra_bits[ symbol ],
+		     &extra_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read length extra bits.",
+			 function );
+
+			return( -1 );
+		}
+		length = deflate_stream_length_bases[ symbol ] + (uint16_t) extra_bits;
+
+		if( deflate_stream_decode_symbol(
+		     deflate_stream,
+		     distances_table,
+		     &symbol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode distance symbol.",
+			 function );
+
+			return( -1 );
+		}
+		if( symbol >= 30 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid distance symbol value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_stream_read_bits(
+		     deflate_stream,
+		     deflate_stream_distance_extra_bits[ symbol ],
+		     &extra_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read distance extra bits.",
+			 function );
+
+			return( -1 );
+		}
+		distance = deflate_stream_distance_bases[ symbol ] + (uint16_t) extra_bits;
+
+		if( deflate_stream_write_copy(
+		     deflate_stream,
+		     distance,
+		     length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to write back reference.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decompresses the blocks of a deflate stream (RFC 1951) up to and including the last block
+ * Returns 1 if successful or -1 on error
+ */
+int deflate_stream_decompress(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error )
+{
+	deflate_huffman_table_t distances_table;
+	deflate_huffman_table_t literals_table;
+
+	static char *function  = "deflate_stream_decompress";
+	uint32_t block_size    = 0;
+	uint32_t block_type    = 0;
+	uint32_t is_last_block = 0;
+	uint32_t value_32bit   = 0;
+
+	if( deflate_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deflate stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( is_last_block == 0 )
+	{
+		if( deflate_stream_read_bits(
+		     deflate_stream,
+		     1,
+		     &is_last_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read last block flag.",
+			 function );
+
+			return( -1 );
+		}
+		if( deflate_stream_read_bits(
+		     deflate_stream,
+		     2,
+		     &block_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block type.",
+			 function );
+
+			return( -1 );
+		}
+		switch( block_type )
+		{
+			case 0:
+				if( deflate_stream_align_to_byte(
+				     deflate_stream,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to align to byte.",
+					 function );
+
+					return( -1 );
+				}
+				if( deflate_stream_read_bits(
+				     deflate_stream,
+				     16,
+				     &block_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block size.",
+					 function );
+
+					return( -1 );
+				}
+				if( deflate_stream_read_bits(
+				     deflate_stream,
+				     16,
+				     &value_32bit,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read block size complement.",
+					 function );
+
+					return( -1 );
+				}
+				if( block_size != ( ~value_32bit & 0x0000ffffUL ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_INPUT,
+					 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+					 "%s: mismatch in block size and its complement.",
+					 function );
+
+					return( -1 );
+				}
+				while( block_size > 0 )
+				{
+					if( deflate_stream_read_bits(
+					     deflate_stream,
+					     8,
+					     &value_32bit,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					if( deflate_stream_write_byte(
+					     deflate_stream,
+					     (uint8_t) value_32bit,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GENERIC,
+						 "%s: unable to write uncompressed data.",
+						 function );
+
+						return( -1 );
+					}
+					block_size--;
+				}
+				break;
+
+			case 1:
+				if( deflate_stream_build_fixed_huffman_tables(
+				     &literals_table,
+				     &distances_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to build fixed Huffman tables.",
+					 function );
+
+					return( -1 );
+				}
+				if( deflate_stream_decode_huffman_block(
+				     deflate_stream,
+				     &literals_table,
+				     &distances_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to decode block with fixed Huffman codes.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+
+			case 2:
+				if( deflate_stream_read_dynamic_huffman_tables(
+				     deflate_stream,
+				     &literals_table,
+				     &distances_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to read dynamic Huffman tables.",
+					 function );
+
+					return( -1 );
+				}
+				if( deflate_stream_decode_huffman_block(
+				     deflate_stream,
+				     &literals_table,
+				     &distances_table,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to decode block with dynamic Huffman codes.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported block type: %" PRIu32 ".",
+				 function,
+				 block_type );
+
+				return( -1 );
+		}
+	}
+	if( deflate_stream_flush(
+	     deflate_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to flush output.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of data, as used by gzip and zip
+ * The calculation continues from a previous CRC-32, which is 0 for the first data
+ * Returns the CRC-32
+ */
+uint32_t deflate_calculate_crc32(
+          uint32_t crc32,
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset = 0;
+
+	if( data == NULL )
+	{
+		return( crc32 );
+	}
+	crc32 = ~crc32;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32 ^= data[ data_offset ];
+		crc32  = ( crc32 >> 4 ) ^ deflate_crc32_nibble_table[ crc32 & 0x0f ];
+		crc32  = ( crc32 >> 4 ) ^ deflate_crc32_nibble_table[ crc32 & 0x0f ];
+	}
+	return( ~crc32 );
+}
+
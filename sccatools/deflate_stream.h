@@ -0,0 +1,222 @@
+/*
+ * Deflate stream functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _DEFLATE_STREAM_H )
+#define _DEFLATE_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the window of previous output that back references can refer to
+ */
+#define DEFLATE_STREAM_WINDOW_SIZE		32768
+
+/* The size of the part of the compressed input that is read at once
+ */
+#define DEFLATE_STREAM_INPUT_BUFFER_SIZE	65536
+
+/* The maximum size of a Huffman code in bits
+ */
+#define DEFLATE_STREAM_MAXIMUM_CODE_SIZE	15
+
+/* The number of literal and length symbols and of distance symbols
+ */
+#define DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS	288
+#define DEFLATE_STREAM_NUMBER_OF_DISTANCE_SYMBOLS	32
+
+typedef struct deflate_huffman_table deflate_huffman_table_t;
+
+/* A canonical Huffman table
+ */
+struct deflate_huffman_table
+{
+	/* The number of codes per code size
+	 */
+	uint16_t code_size_counts[ DEFLATE_STREAM_MAXIMUM_CODE_SIZE + 1 ];
+
+	/* The symbols ordered by code
+	 */
+	uint16_t symbols[ DEFLATE_STREAM_NUMBER_OF_LITERAL_SYMBOLS ];
+};
+
+typedef struct deflate_stream deflate_stream_t;
+
+struct deflate_stream
+{
+	/* The input file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The size of the compressed input that remains to be read from the file IO handle
+	 */
+	size64_t remaining_input_size;
+
+	/* The input buffer
+	 */
+	uint8_t input_buffer[ DEFLATE_STREAM_INPUT_BUFFER_SIZE ];
+
+	/* The size of the data in the input buffer
+	 */
+	size_t input_buffer_size;
+
+	/* The offset of the next byte in the input buffer
+	 */
+	size_t input_buffer_offset;
+
+	/* The bits that were read but not consumed
+	 */
+	uint32_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t number_of_bits;
+
+	/* The window, which contains the previous output followed by the output
+	 * that was not yet passed to the output callback function
+	 */
+	uint8_t window[ 2 * DEFLATE_STREAM_WINDOW_SIZE ];
+
+	/* The offset of the next byte in the window
+	 */
+	size_t window_offset;
+
+	/* The offset of the first byte in the window that was not yet passed
+	 * to the output callback function
+	 */
+	size_t flushed_offset;
+
+	/* The CRC-32 of the output
+	 */
+	uint32_t crc32;
+
+	/* The size of the output
+	 */
+	size64_t output_size;
+
+	/* The output callback function
+	 */
+	int (*output_callback_function)(
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_arguments,
+	       libcerror_error_t **error );
+
+	/* The output callback arguments
+	 */
+	void *output_callback_arguments;
+};
+
+int deflate_stream_initialize(
+     deflate_stream_t **deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_free(
+     deflate_stream_t **deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_set_input(
+     deflate_stream_t *deflate_stream,
+     libbfio_handle_t *file_io_handle,
+     size64_t input_size,
+     int (*output_callback_function)(
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_arguments,
+            libcerror_error_t **error ),
+     void *output_callback_arguments,
+     libcerror_error_t **error );
+
+int deflate_stream_read_bits(
+     deflate_stream_t *deflate_stream,
+     uint8_t number_of_bits,
+     uint32_t *value,
+     libcerror_error_t **error );
+
+int deflate_stream_align_to_byte(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_stream_write_byte(
+     deflate_stream_t *deflate_stream,
+     uint8_t byte_value,
+     libcerror_error_t **error );
+
+int deflate_stream_write_copy(
+     deflate_stream_t *deflate_stream,
+     uint16_t distance,
+     uint16_t length,
+     libcerror_error_t **error );
+
+int deflate_stream_flush(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+int deflate_huffman_table_build(
+     deflate_huffman_table_t *huffman_table,
+     const uint8_t *code_sizes,
+     uint16_t number_of_symbols,
+     libcerror_error_t **error );
+
+int deflate_stream_decode_symbol(
+     deflate_stream_t *deflate_stream,
+     const deflate_huffman_table_t *huffman_table,
+     uint16_t *symbol,
+     libcerror_error_t **error );
+
+int deflate_stream_read_dynamic_huffman_tables(
+     deflate_stream_t *deflate_stream,
+     deflate_huffman_table_t *literals_table,
+     deflate_huffman_table_t *distances_table,
+     libcerror_error_t **error );
+
+int deflate_stream_build_fixed_huffman_tables(
+     deflate_huffman_table_t *literals_table,
+     deflate_huffman_table_t *distances_table,
+     libcerror_error_t **error );
+
+int deflate_stream_decode_huffman_block(
+     deflate_stream_t *deflate_stream,
+     const deflate_huffman_table_t *literals_table,
+     const deflate_huffman_table_t *distances_table,
+     libcerror_error_t **error );
+
+int deflate_stream_decompress(
+     deflate_stream_t *deflate_stream,
+     libcerror_error_t **error );
+
+uint32_t deflate_calculate_crc32(
+          uint32_t crc32,
+          const uint8_t *data,
+          size_t data_size );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _DEFLATE_STREAM_H ) */
+
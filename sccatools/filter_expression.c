@@ -0,0 +1,2180 @@
+/*
+ * Filter expression
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "filter_expression.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+#include "sccatools_libuna.h"
+
+/* The names of the fields, indexed by field
+ */
+static const char *filter_expression_field_names[ 10 ] = {
+	NULL,
+	"run_count",
+	"last_run_time",
+	"format_version",
+	"prefetch_hash",
+	"number_of_filenames",
+	"number_of_volumes",
+	"number_of_file_metrics",
+	"executable_filename",
+	"filename" };
+
+/* Creates a filter expression
+ * Make sure the value filter_expression is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_initialize(
+     filter_expression_t **filter_expression,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_initialize";
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter_expression != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter expression value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*filter_expression = memory_allocate_structure(
+	                      filter_expression_t );
+
+	if( *filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter expression.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *filter_expression,
+	     0,
+	     sizeof( filter_expression_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter expression.",
+		 function );
+
+		goto on_error;
+	}
+	( *filter_expression )->root_node_index = -1;
+
+	return( 1 );
+
+on_error:
+	if( *filter_expression != NULL )
+	{
+		memory_free(
+		 *filter_expression );
+
+		*filter_expression = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a filter expression
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_free(
+     filter_expression_t **filter_expression,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_free";
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter_expression != NULL )
+	{
+		if( ( *filter_expression )->nodes != NULL )
+		{
+			memory_free(
+			 ( *filter_expression )->nodes );
+		}
+		if( ( *filter_expression )->string != NULL )
+		{
+			memory_free(
+			 ( *filter_expression )->string );
+		}
+		memory_free(
+		 *filter_expression );
+
+		*filter_expression = NULL;
+	}
+	return( 1 );
+}
+
+/* Parses a date in the format YYYY-MM-DD, YYYY-MM-DDThh:mm or YYYY-MM-DDThh:mm:ss
+ * The date is in UTC and is converted into a 64-bit FILETIME date and time value
+ * Returns 1 if successful or 0 if the string is not a supported date
+ */
+int filter_expression_parse_date(
+     const uint8_t *string,
+     size_t string_length,
+     uint64_t *filetime )
+{
+	static const uint8_t value_sizes[ 6 ] = { 4, 2, 2, 2, 2, 2 };
+	static const char separators[ 6 ]     = { 0, '-', '-', 'T', ':', ':' };
+	uint8_t days_per_month[ 12 ]          = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	uint32_t values[ 6 ]                  = { 0, 0, 0, 0, 0, 0 };
+	uint64_t number_of_days               = 0;
+	size_t string_offset                  = 0;
+	uint32_t day_of_year                  = 0;
+	uint32_t era                          = 0;
+	uint32_t year                         = 0;
+	uint32_t year_of_era                  = 0;
+	uint8_t digit_index                   = 0;
+	int number_of_values                  = 0;
+	int value_index                       = 0;
+
+	if( ( string == NULL )
+	 || ( filetime == NULL ) )
+	{
+		return( 0 );
+	}
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		if( string_offset >= string_length )
+		{
+			break;
+		}
+		if( value_index > 0 )
+		{
+			if( string[ string_offset ] != (uint8_t) separators[ value_index ] )
+			{
+				return( 0 );
+			}
+			string_offset++;
+		}
+		for( digit_index = 0;
+		     digit_index < value_sizes[ value_index ];
+		     digit_index++ )
+		{
+			if( ( string_offset >= string_length )
+			 || ( string[ string_offset ] < (uint8_t) '0' )
+			 || ( string[ string_offset ] > (uint8_t) '9' ) )
+			{
+				return( 0 );
+			}
+			values[ value_index ] *= 10;
+			values[ value_index ] += string[ string_offset ] - (uint8_t) '0';
+
+			string_offset++;
+		}
+		number_of_values++;
+	}
+	if( ( string_offset != string_length )
+	 || ( number_of_values < 3 )
+	 || ( number_of_values == 4 ) )
+	{
+		return( 0 );
+	}
+	year = values[ 0 ];
+
+	if( ( ( ( year % 4 ) == 0 )
+	  &&  ( ( year % 100 ) != 0 ) )
+	 || ( ( year % 400 ) == 0 ) )
+	{
+		days_per_month[ 1 ] = 29;
+	}
+	if( ( year < 1601 )
+	 || ( values[ 1 ] < 1 )
+	 || ( values[ 1 ] > 12 )
+	 || ( values[ 2 ] < 1 )
+	 || ( values[ 2 ] > days_per_month[ values[ 1 ] - 1 ] )
+	 || ( values[ 3 ] > 23 )
+	 || ( values[ 4 ] > 59 )
+	 || ( values[ 5 ] > 59 ) )
+	{
+		return( 0 );
+	}
+	/* The number of days is determined relative to 1 March, so that the leap day
+	 * is the last day of the year
+	 */
+	if( values[ 1 ] <= 2 )
+	{
+		year -= 1;
+		day_of_year = ( ( 153 * ( values[ 1 ] + 9 ) ) + 2 ) / 5;
+	}
+	else
+	{
+		day_of_year = ( ( 153 * ( values[ 1 ] - 3 ) ) + 2 ) / 5;
+	}
+	day_of_year += values[ 2 ] - 1;
+
+	era         = year / 400;
+	year_of_era = year % 400;
+
+	number_of_days = ( (uint64_t) era * 146097 )
+	               + ( year_of_era * 365 )
+	               + ( year_of_era / 4 )
+	               - ( year_of_era / 100 )
+	               + day_of_year;
+
+	/* 1 January 1601 is 584694 days after 1 March of year 0
+	 */
+	number_of_days -= 584694;
+
+	*filetime = ( ( number_of_days * 86400 )
+	            + ( values[ 3 ] * 3600 )
+	            + ( values[ 4 ] * 60 )
+	            + values[ 5 ] ) * 10000000UL;
+
+	return( 1 );
+}
+
+/* Reads the next token of the expression
+ * String tokens are unescaped in place, the token offset and length then refer
+ * to the unescaped string without the quotes
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_read_token(
+     filter_expression_t *filter_expression,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_read_token";
+	size_t string_length  = 0;
+	size_t string_offset  = 0;
+	size_t write_offset   = 0;
+	uint64_t value        = 0;
+	uint8_t character     = 0;
+	uint8_t digit         = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filter expression - missing string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = filter_expression->string_size - 1;
+	string_offset = filter_expression->string_offset;
+
+	while( string_offset < string_length )
+	{
+		character = filter_expression->string[ string_offset ];
+
+		if( ( character != (uint8_t) ' ' )
+		 && ( character != (uint8_t) '\t' )
+		 && ( character != (uint8_t) '\n' )
+		 && ( character != (uint8_t) '\r' ) )
+		{
+			break;
+		}
+		string_offset++;
+	}
+	filter_expression->token_offset = string_offset;
+	filter_expression->token_length = 0;
+	filter_expression->token_value  = 0;
+
+	if( string_offset >= string_length )
+	{
+		filter_expression->token_type    = FILTER_EXPRESSION_TOKEN_TYPE_END;
+		filter_expression->string_offset = string_offset;
+
+		return( 1 );
+	}
+	character = filter_expression->string[ string_offset ];
+
+	if( character == (uint8_t) '(' )
+	{
+		filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_OPEN_PARENTHESIS;
+
+		string_offset++;
+	}
+	else if( character == (uint8_t) ')' )
+	{
+		filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_CLOSE_PARENTHESIS;
+
+		string_offset++;
+	}
+	else if( ( ( character >= (uint8_t) 'a' )
+	       &&  ( character <= (uint8_t) 'z' ) )
+	      || ( ( character >= (uint8_t) 'A' )
+	       &&  ( character <= (uint8_t) 'Z' ) )
+	      || ( character == (uint8_t) '_' ) )
+	{
+		filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_IDENTIFIER;
+
+		while( string_offset < string_length )
+		{
+			character = filter_expression->string[ string_offset ];
+
+			if( ( ( character < (uint8_t) 'a' )
+			  ||  ( character > (uint8_t) 'z' ) )
+			 && ( ( character < (uint8_t) 'A' )
+			  ||  ( character > (uint8_t) 'Z' ) )
+			 && ( ( character < (uint8_t) '0' )
+			  ||  ( character > (uint8_t) '9' ) )
+			 && ( character != (uint8_t) '_' ) )
+			{
+				break;
+			}
+			string_offset++;
+		}
+	}
+	else if( ( character >= (uint8_t) '0' )
+	      && ( character <= (uint8_t) '9' ) )
+	{
+		filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_INTEGER;
+
+		if( ( character == (uint8_t) '0' )
+		 && ( ( string_offset + 1 ) < string_length )
+		 && ( ( filter_expression->string[ string_offset + 1 ] == (uint8_t) 'x' )
+		  ||  ( filter_expression->string[ string_offset + 1 ] == (uint8_t) 'X' ) ) )
+		{
+			string_offset += 2;
+
+			while( string_offset < string_length )
+			{
+				character = filter_expression->string[ string_offset ];
+
+				if( ( character >= (uint8_t) '0' )
+				 && ( character <= (uint8_t) '9' ) )
+				{
+					digit = character - (uint8_t) '0';
+				}
+				else if( ( character >= (uint8_t) 'a' )
+				      && ( character <= (uint8_t) 'f' ) )
+				{
+					digit = character - (uint8_t) 'a' + 10;
+				}
+				else if( ( character >= (uint8_t) 'A' )
+				      && ( character <= (uint8_t) 'F' ) )
+				{
+					digit = character - (uint8_t) 'A' + 10;
+				}
+				else
+				{
+					break;
+				}
+				if( value > ( (uint64_t) UINT64_MAX >> 4 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid expression - integer value out of bounds at offset: %" PRIzd ".",
+					 function,
+					 (ssize_t) filter_expression->token_offset );
+
+					return( -1 );
+				}
+				value = ( value << 4 ) | digit;
+
+				string_offset++;
+			}
+			if( string_offset == ( filter_expression->token_offset + 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid expression - missing hexadecimal digits at offset: %" PRIzd ".",
+				 function,
+				 (ssize_t) filter_expression->token_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			while( string_offset < string_length )
+			{
+				character = filter_expression->string[ string_offset ];
+
+				if( ( character < (uint8_t) '0' )
+				 || ( character > (uint8_t) '9' ) )
+				{
+					break;
+				}
+				digit = character - (uint8_t) '0';
+
+				if( value > ( ( (uint64_t) UINT64_MAX - digit ) / 10 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid expression - integer value out of bounds at offset: %" PRIzd ".",
+					 function,
+					 (ssize_t) filter_expression->token_offset );
+
+					return( -1 );
+				}
+				value = ( value * 10 ) + digit;
+
+				string_offset++;
+			}
+			/* A year followed by a dash starts a date
+			 */
+			if( ( string_offset == ( filter_expression->token_offset + 4 ) )
+			 && ( string_offset < string_length )
+			 && ( filter_expression->string[ string_offset ] == (uint8_t) '-' ) )
+			{
+				filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_DATE;
+
+				while( string_offset < string_length )
+				{
+					character = filter_expression->string[ string_offset ];
+
+					if( ( ( character < (uint8_t) '0' )
+					  ||  ( character > (uint8_t) '9' ) )
+					 && ( character != (uint8_t) '-' )
+					 && ( character != (uint8_t) ':' )
+					 && ( character != (uint8_t) 'T' ) )
+					{
+						break;
+					}
+					string_offset++;
+				}
+				if( filter_expression_parse_date(
+				     &( filter_expression->string[ filter_expression->token_offset ] ),
+				     string_offset - filter_expression->token_offset,
+				     &value ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid expression - unsupported date at offset: %" PRIzd ".",
+					 function,
+					 (ssize_t) filter_expression->token_offset );
+
+					return( -1 );
+				}
+			}
+		}
+		filter_expression->token_value = value;
+	}
+	else if( character == (uint8_t) '"' )
+	{
+		filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_STRING;
+
+		string_offset++;
+
+		write_offset = string_offset;
+
+		filter_expression->token_offset = write_offset;
+
+		while( string_offset < string_length )
+		{
+			character = filter_expression->string[ string_offset ];
+
+			if( character == (uint8_t) '"' )
+			{
+				break;
+			}
+			if( character == (uint8_t) '\\' )
+			{
+				string_offset++;
+
+				if( ( string_offset >= string_length )
+				 || ( ( filter_expression->string[ string_offset ] != (uint8_t) '\\' )
+				  &&  ( filter_expression->string[ string_offset ] != (uint8_t) '"' ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid expression - unsupported escape sequence at offset: %" PRIzd ".",
+					 function,
+					 (ssize_t) ( string_offset - 1 ) );
+
+					return( -1 );
+				}
+				character = filter_expression->string[ string_offset ];
+			}
+			filter_expression->string[ write_offset++ ] = character;
+
+			string_offset++;
+		}
+		if( string_offset >= string_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unterminated string at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) ( filter_expression->token_offset - 1 ) );
+
+			return( -1 );
+		}
+		/* Skip the closing quote
+		 */
+		string_offset++;
+
+		filter_expression->token_length = write_offset - filter_expression->token_offset;
+		filter_expression->string_offset = string_offset;
+
+		return( 1 );
+	}
+	else
+	{
+		filter_expression->token_type = FILTER_EXPRESSION_TOKEN_TYPE_OPERATOR;
+
+		if( ( string_offset + 1 ) < string_length )
+		{
+			digit = filter_expression->string[ string_offset + 1 ];
+		}
+		else
+		{
+			digit = 0;
+		}
+		if( ( character == (uint8_t) '=' )
+		 && ( digit == (uint8_t) '=' ) )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_EQUAL;
+			string_offset += 2;
+		}
+		else if( character == (uint8_t) '=' )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_EQUAL;
+			string_offset += 1;
+		}
+		else if( ( character == (uint8_t) '!' )
+		      && ( digit == (uint8_t) '=' ) )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_NOT_EQUAL;
+			string_offset += 2;
+		}
+		else if( ( character == (uint8_t) '<' )
+		      && ( digit == (uint8_t) '=' ) )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_LESS_OR_EQUAL;
+			string_offset += 2;
+		}
+		else if( character == (uint8_t) '<' )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_LESS;
+			string_offset += 1;
+		}
+		else if( ( character == (uint8_t) '>' )
+		      && ( digit == (uint8_t) '=' ) )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_GREATER_OR_EQUAL;
+			string_offset += 2;
+		}
+		else if( character == (uint8_t) '>' )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_GREATER;
+			string_offset += 1;
+		}
+		else if( character == (uint8_t) '~' )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_CONTAINS;
+			string_offset += 1;
+		}
+		else if( ( character == (uint8_t) '^' )
+		      && ( digit == (uint8_t) '=' ) )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_STARTS_WITH;
+			string_offset += 2;
+		}
+		else if( ( character == (uint8_t) '$' )
+		      && ( digit == (uint8_t) '=' ) )
+		{
+			value          = FILTER_EXPRESSION_OPERATOR_ENDS_WITH;
+			string_offset += 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported character at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) string_offset );
+
+			return( -1 );
+		}
+		filter_expression->token_value = value;
+	}
+	filter_expression->token_length  = string_offset - filter_expression->token_offset;
+	filter_expression->string_offset = string_offset;
+
+	return( 1 );
+}
+
+/* Determines if the current token is a specific keyword
+ * Returns 1 if the token is the keyword or 0 if not
+ */
+int filter_expression_token_is_keyword(
+     filter_expression_t *filter_expression,
+     const char *keyword )
+{
+	size_t keyword_length = 0;
+
+	if( ( filter_expression == NULL )
+	 || ( keyword == NULL ) )
+	{
+		return( 0 );
+	}
+	if( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_IDENTIFIER )
+	{
+		return( 0 );
+	}
+	keyword_length = narrow_string_length(
+	                  keyword );
+
+	if( filter_expression->token_length != keyword_length )
+	{
+		return( 0 );
+	}
+	if( narrow_string_compare(
+	     (char *) &( filter_expression->string[ filter_expression->token_offset ] ),
+	     keyword,
+	     keyword_length ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the field with a specific name
+ * Returns the field or 0 if the name is not a supported field
+ */
+int filter_expression_get_field(
+     const uint8_t *string,
+     size_t string_length )
+{
+	int field = 0;
+
+	if( string == NULL )
+	{
+		return( 0 );
+	}
+	for( field = FILTER_EXPRESSION_FIELD_RUN_COUNT;
+	     field <= FILTER_EXPRESSION_FIELD_FILENAME;
+	     field++ )
+	{
+		if( ( narrow_string_length( filter_expression_field_names[ field ] ) == string_length )
+		 && ( narrow_string_compare(
+		       (char *) string,
+		       filter_expression_field_names[ field ],
+		       string_length ) == 0 ) )
+		{
+			return( field );
+		}
+	}
+	return( 0 );
+}
+
+/* Appends a node
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_append_node(
+     filter_expression_t *filter_expression,
+     int node_type,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	filter_expression_node_t *node         = NULL;
+	filter_expression_node_t *reallocation = NULL;
+	static char *function                  = "filter_expression_append_node";
+	int number_of_allocated_nodes          = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->number_of_nodes >= FILTER_EXPRESSION_MAXIMUM_NUMBER_OF_NODES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid expression - too many terms.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->number_of_nodes >= filter_expression->number_of_allocated_nodes )
+	{
+		number_of_allocated_nodes = filter_expression->number_of_allocated_nodes * 2;
+
+		if( number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = 16;
+		}
+		reallocation = (filter_expression_node_t *) memory_reallocate(
+		                                             filter_expression->nodes,
+		                                             sizeof( filter_expression_node_t ) * number_of_allocated_nodes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		filter_expression->nodes                     = reallocation;
+		filter_expression->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	node = &( filter_expression->nodes[ filter_expression->number_of_nodes ] );
+
+	if( memory_set(
+	     node,
+	     0,
+	     sizeof( filter_expression_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		return( -1 );
+	}
+	node->type              = node_type;
+	node->first_node_index  = -1;
+	node->second_node_index = -1;
+
+	*node_index = filter_expression->number_of_nodes;
+
+	filter_expression->number_of_nodes += 1;
+
+	return( 1 );
+}
+
+/* Determines the relative cost of evaluating a node
+ * Comparisons of integer fields are the cheapest, the executable filename
+ * is converted to UTF-8 and the filenames are scanned one by one
+ * Returns the cost
+ */
+int filter_expression_get_node_cost(
+     filter_expression_t *filter_expression,
+     int node_index )
+{
+	filter_expression_node_t *node = NULL;
+	int first_cost                 = 0;
+	int second_cost                = 0;
+
+	if( ( filter_expression == NULL )
+	 || ( node_index < 0 )
+	 || ( node_index >= filter_expression->number_of_nodes ) )
+	{
+		return( 0 );
+	}
+	node = &( filter_expression->nodes[ node_index ] );
+
+	switch( node->type )
+	{
+		case FILTER_EXPRESSION_NODE_TYPE_COMPARE_INTEGER:
+			return( 1 );
+
+		case FILTER_EXPRESSION_NODE_TYPE_COMPARE_STRING:
+			return( 2 );
+
+		case FILTER_EXPRESSION_NODE_TYPE_ANY_FILENAME:
+			return( 3 );
+
+		default:
+			break;
+	}
+	first_cost = filter_expression_get_node_cost(
+	              filter_expression,
+	              node->first_node_index );
+
+	second_cost = filter_expression_get_node_cost(
+	               filter_expression,
+	               node->second_node_index );
+
+	if( first_cost > second_cost )
+	{
+		return( first_cost );
+	}
+	return( second_cost );
+}
+
+/* Parses terms separated by or
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_parse_or(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_parse_or";
+	int first_node_index  = -1;
+	int or_node_index     = -1;
+	int second_node_index = -1;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression_parse_and(
+	     filter_expression,
+	     depth,
+	     &first_node_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	while( filter_expression_token_is_keyword(
+	        filter_expression,
+	        "or" ) != 0 )
+	{
+		if( filter_expression_read_token(
+		     filter_expression,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( filter_expression_parse_and(
+		     filter_expression,
+		     depth,
+		     &second_node_index,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( filter_expression_append_node(
+		     filter_expression,
+		     FILTER_EXPRESSION_NODE_TYPE_OR,
+		     &or_node_index,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		/* The cheaper operand is evaluated first, since it can decide the result
+		 */
+		if( filter_expression_get_node_cost(
+		     filter_expression,
+		     first_node_index ) > filter_expression_get_node_cost(
+		                           filter_expression,
+		                           second_node_index ) )
+		{
+			filter_expression->nodes[ or_node_index ].first_node_index  = second_node_index;
+			filter_expression->nodes[ or_node_index ].second_node_index = first_node_index;
+		}
+		else
+		{
+			filter_expression->nodes[ or_node_index ].first_node_index  = first_node_index;
+			filter_expression->nodes[ or_node_index ].second_node_index = second_node_index;
+		}
+		first_node_index = or_node_index;
+	}
+	*node_index = first_node_index;
+
+	return( 1 );
+}
+
+/* Parses terms separated by and
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_parse_and(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_parse_and";
+	int and_node_index    = -1;
+	int first_node_index  = -1;
+	int second_node_index = -1;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression_parse_not(
+	     filter_expression,
+	     depth,
+	     &first_node_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	while( filter_expression_token_is_keyword(
+	        filter_expression,
+	        "and" ) != 0 )
+	{
+		if( filter_expression_read_token(
+		     filter_expression,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( filter_expression_parse_not(
+		     filter_expression,
+		     depth,
+		     &second_node_index,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( filter_expression_append_node(
+		     filter_expression,
+		     FILTER_EXPRESSION_NODE_TYPE_AND,
+		     &and_node_index,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		/* The cheaper operand is evaluated first, since it can decide the result
+		 */
+		if( filter_expression_get_node_cost(
+		     filter_expression,
+		     first_node_index ) > filter_expression_get_node_cost(
+		                           filter_expression,
+		                           second_node_index ) )
+		{
+			filter_expression->nodes[ and_node_index ].first_node_index  = second_node_index;
+			filter_expression->nodes[ and_node_index ].second_node_index = first_node_index;
+		}
+		else
+		{
+			filter_expression->nodes[ and_node_index ].first_node_index  = first_node_index;
+			filter_expression->nodes[ and_node_index ].second_node_index = second_node_index;
+		}
+		first_node_index = and_node_index;
+	}
+	*node_index = first_node_index;
+
+	return( 1 );
+}
+
+/* Parses a term that is optionally negated by not
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_parse_not(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_parse_not";
+	int not_node_index    = -1;
+	int operand_index     = -1;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( depth >= FILTER_EXPRESSION_MAXIMUM_DEPTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid expression - nested too deeply at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) filter_expression->token_offset );
+
+		return( -1 );
+	}
+	if( filter_expression_token_is_keyword(
+	     filter_expression,
+	     "not" ) == 0 )
+	{
+		return( filter_expression_parse_primary(
+		         filter_expression,
+		         depth,
+		         node_index,
+		         error ) );
+	}
+	if( filter_expression_read_token(
+	     filter_expression,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( filter_expression_parse_not(
+	     filter_expression,
+	     depth + 1,
+	     &operand_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( filter_expression_append_node(
+	     filter_expression,
+	     FILTER_EXPRESSION_NODE_TYPE_NOT,
+	     &not_node_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	filter_expression->nodes[ not_node_index ].first_node_index = operand_index;
+
+	*node_index = not_node_index;
+
+	return( 1 );
+}
+
+/* Parses the operator and value of a comparison of a field
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_parse_comparison(
+     filter_expression_t *filter_expression,
+     int field,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "filter_expression_parse_comparison";
+	int comparison_operator = 0;
+	int node_type           = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_OPERATOR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing operator at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) filter_expression->token_offset );
+
+		return( -1 );
+	}
+	comparison_operator = (int) filter_expression->token_value;
+
+	if( ( field == FILTER_EXPRESSION_FIELD_EXECUTABLE_FILENAME )
+	 || ( field == FILTER_EXPRESSION_FIELD_FILENAME ) )
+	{
+		if( ( comparison_operator != FILTER_EXPRESSION_OPERATOR_EQUAL )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_CONTAINS )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_STARTS_WITH )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_ENDS_WITH )
+		 && ( ( field == FILTER_EXPRESSION_FIELD_FILENAME )
+		  ||  ( comparison_operator != FILTER_EXPRESSION_OPERATOR_NOT_EQUAL ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported string operator at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) filter_expression->token_offset );
+
+			return( -1 );
+		}
+		if( field == FILTER_EXPRESSION_FIELD_FILENAME )
+		{
+			node_type = FILTER_EXPRESSION_NODE_TYPE_ANY_FILENAME;
+		}
+		else
+		{
+			node_type = FILTER_EXPRESSION_NODE_TYPE_COMPARE_STRING;
+		}
+	}
+	else
+	{
+		if( ( comparison_operator != FILTER_EXPRESSION_OPERATOR_EQUAL )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_NOT_EQUAL )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_LESS )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_LESS_OR_EQUAL )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_GREATER )
+		 && ( comparison_operator != FILTER_EXPRESSION_OPERATOR_GREATER_OR_EQUAL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported integer operator at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) filter_expression->token_offset );
+
+			return( -1 );
+		}
+		node_type = FILTER_EXPRESSION_NODE_TYPE_COMPARE_INTEGER;
+	}
+	if( filter_expression_read_token(
+	     filter_expression,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( node_type == FILTER_EXPRESSION_NODE_TYPE_COMPARE_INTEGER )
+	{
+		if( ( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_INTEGER )
+		 && ( ( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_DATE )
+		  ||  ( field != FILTER_EXPRESSION_FIELD_LAST_RUN_TIME ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - missing integer value at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) filter_expression->token_offset );
+
+			return( -1 );
+		}
+	}
+	else if( ( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_STRING )
+	      || ( filter_expression->token_length == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing string value at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) filter_expression->token_offset );
+
+		return( -1 );
+	}
+	if( filter_expression_append_node(
+	     filter_expression,
+	     node_type,
+	     node_index,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	filter_expression->nodes[ *node_index ].field               = field;
+	filter_expression->nodes[ *node_index ].comparison_operator = comparison_operator;
+	filter_expression->nodes[ *node_index ].value               = filter_expression->token_value;
+	filter_expression->nodes[ *node_index ].string_offset       = filter_expression->token_offset;
+	filter_expression->nodes[ *node_index ].string_length       = filter_expression->token_length;
+
+	if( node_type == FILTER_EXPRESSION_NODE_TYPE_ANY_FILENAME )
+	{
+		switch( comparison_operator )
+		{
+			case FILTER_EXPRESSION_OPERATOR_EQUAL:
+				filter_expression->nodes[ *node_index ].value = LIBSCCA_FILENAME_MATCH_TYPE_EXACT;
+				break;
+
+			case FILTER_EXPRESSION_OPERATOR_STARTS_WITH:
+				filter_expression->nodes[ *node_index ].value = LIBSCCA_FILENAME_MATCH_TYPE_PREFIX;
+				break;
+
+			case FILTER_EXPRESSION_OPERATOR_ENDS_WITH:
+				filter_expression->nodes[ *node_index ].value = LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX;
+				break;
+
+			default:
+				filter_expression->nodes[ *node_index ].value = LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING;
+				break;
+		}
+	}
+	return( filter_expression_read_token(
+	         filter_expression,
+	         error ) );
+}
+
+/* Parses a parenthesized expression, an any( filename ... ) term or a comparison
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_parse_primary(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_parse_primary";
+	int field             = 0;
+	int is_any            = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->token_type == FILTER_EXPRESSION_TOKEN_TYPE_OPEN_PARENTHESIS )
+	{
+		if( filter_expression_read_token(
+		     filter_expression,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( filter_expression_parse_or(
+		     filter_expression,
+		     depth + 1,
+		     node_index,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else
+	{
+		is_any = filter_expression_token_is_keyword(
+		          filter_expression,
+		          "any" );
+
+		if( is_any != 0 )
+		{
+			if( filter_expression_read_token(
+			     filter_expression,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			if( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_OPEN_PARENTHESIS )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid expression - missing ( after any at offset: %" PRIzd ".",
+				 function,
+				 (ssize_t) filter_expression->token_offset );
+
+				return( -1 );
+			}
+			if( filter_expression_read_token(
+			     filter_expression,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+		}
+		if( filter_expression->token_type == FILTER_EXPRESSION_TOKEN_TYPE_IDENTIFIER )
+		{
+			field = filter_expression_get_field(
+			         &( filter_expression->string[ filter_expression->token_offset ] ),
+			         filter_expression->token_length );
+		}
+		if( ( field == 0 )
+		 || ( ( is_any != 0 )
+		  &&  ( field != FILTER_EXPRESSION_FIELD_FILENAME ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - unsupported field at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) filter_expression->token_offset );
+
+			return( -1 );
+		}
+		if( ( is_any == 0 )
+		 && ( field == FILTER_EXPRESSION_FIELD_FILENAME ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid expression - filename must be used as any( filename ... ) at offset: %" PRIzd ".",
+			 function,
+			 (ssize_t) filter_expression->token_offset );
+
+			return( -1 );
+		}
+		if( filter_expression_read_token(
+		     filter_expression,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( filter_expression_parse_comparison(
+		     filter_expression,
+		     field,
+		     node_index,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( is_any == 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_CLOSE_PARENTHESIS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - missing ) at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) filter_expression->token_offset );
+
+		return( -1 );
+	}
+	return( filter_expression_read_token(
+	         filter_expression,
+	         error ) );
+}
+
+/* Compiles the expression
+ * The expression is parsed once into nodes that are evaluated for every file
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_compile(
+     filter_expression_t *filter_expression,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_compile";
+	size_t string_length  = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter expression - string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     &( filter_expression->string_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	filter_expression->string_size = string_length + 1;
+#endif
+	if( ( filter_expression->string_size == 0 )
+	 || ( filter_expression->string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filter expression - string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	filter_expression->string = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * filter_expression->string_size );
+
+	if( filter_expression->string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_copy_from_utf16(
+	     (libuna_utf8_character_t *) filter_expression->string,
+	     filter_expression->string_size,
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( memory_copy(
+	     filter_expression->string,
+	     string,
+	     filter_expression->string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	filter_expression->string_offset = 0;
+
+	if( filter_expression_read_token(
+	     filter_expression,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( filter_expression_parse_or(
+	     filter_expression,
+	     0,
+	     &( filter_expression->root_node_index ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( filter_expression->token_type != FILTER_EXPRESSION_TOKEN_TYPE_END )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid expression - unexpected token at offset: %" PRIzd ".",
+		 function,
+		 (ssize_t) filter_expression->token_offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filter_expression->nodes != NULL )
+	{
+		memory_free(
+		 filter_expression->nodes );
+
+		filter_expression->nodes = NULL;
+	}
+	if( filter_expression->string != NULL )
+	{
+		memory_free(
+		 filter_expression->string );
+
+		filter_expression->string = NULL;
+	}
+	filter_expression->string_size               = 0;
+	filter_expression->number_of_nodes           = 0;
+	filter_expression->number_of_allocated_nodes = 0;
+	filter_expression->root_node_index           = -1;
+
+	return( -1 );
+}
+
+/* Compares a string with a pattern
+ * ASCII characters are compared case insensitive
+ * Returns 1 if the string matches or 0 if not
+ */
+int filter_expression_compare_strings(
+     const uint8_t *string,
+     size_t string_length,
+     const uint8_t *pattern,
+     size_t pattern_length,
+     int comparison_operator )
+{
+	size_t last_offset        = 0;
+	size_t pattern_offset     = 0;
+	size_t string_offset      = 0;
+	uint8_t character         = 0;
+	uint8_t pattern_character = 0;
+
+	if( ( string == NULL )
+	 || ( pattern == NULL ) )
+	{
+		return( 0 );
+	}
+	if( comparison_operator == FILTER_EXPRESSION_OPERATOR_NOT_EQUAL )
+	{
+		if( filter_expression_compare_strings(
+		     string,
+		     string_length,
+		     pattern,
+		     pattern_length,
+		     FILTER_EXPRESSION_OPERATOR_EQUAL ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( pattern_length > string_length )
+	{
+		return( 0 );
+	}
+	switch( comparison_operator )
+	{
+		case FILTER_EXPRESSION_OPERATOR_EQUAL:
+			if( pattern_length != string_length )
+			{
+				return( 0 );
+			}
+			last_offset = 0;
+			break;
+
+		case FILTER_EXPRESSION_OPERATOR_STARTS_WITH:
+			last_offset = 0;
+			break;
+
+		case FILTER_EXPRESSION_OPERATOR_ENDS_WITH:
+			string_offset = string_length - pattern_length;
+			last_offset   = string_offset;
+			break;
+
+		case FILTER_EXPRESSION_OPERATOR_CONTAINS:
+			last_offset = string_length - pattern_length;
+			break;
+
+		default:
+			return( 0 );
+	}
+	while( string_offset <= last_offset )
+	{
+		for( pattern_offset = 0;
+		     pattern_offset < pattern_length;
+		     pattern_offset++ )
+		{
+			character         = string[ string_offset + pattern_offset ];
+			pattern_character = pattern[ pattern_offset ];
+
+			if( ( character >= (uint8_t) 'A' )
+			 && ( character <= (uint8_t) 'Z' ) )
+			{
+				character += (uint8_t) ( 'a' - 'A' );
+			}
+			if( ( pattern_character >= (uint8_t) 'A' )
+			 && ( pattern_character <= (uint8_t) 'Z' ) )
+			{
+				pattern_character += (uint8_t) ( 'a' - 'A' );
+			}
+			if( character != pattern_character )
+			{
+				break;
+			}
+		}
+		if( pattern_offset == pattern_length )
+		{
+			return( 1 );
+		}
+		string_offset++;
+	}
+	return( 0 );
+}
+
+/* Retrieves the value of an integer field
+ * The last run time is the most recent of the last run times that are set
+ * Returns 1 if successful or -1 on error
+ */
+int filter_expression_get_integer_value(
+     filter_expression_t *filter_expression,
+     libscca_file_t *file,
+     int field,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	static char *function   = "filter_expression_get_integer_value";
+	uint32_t value_32bit    = 0;
+	int filetime_index      = 0;
+	int number_of_filetimes = 0;
+	int number_of_values    = 0;
+	int result              = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	switch( field )
+	{
+		case FILTER_EXPRESSION_FIELD_RUN_COUNT:
+			result = libscca_file_get_run_count(
+			          file,
+			          &value_32bit,
+			          error );
+
+			*value = value_32bit;
+			break;
+
+		case FILTER_EXPRESSION_FIELD_LAST_RUN_TIME:
+			result = libscca_file_get_last_run_times(
+			          file,
+			          filetimes,
+			          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+			          &number_of_filetimes,
+			          error );
+
+			*value = 0;
+
+			for( filetime_index = 0;
+			     filetime_index < number_of_filetimes;
+			     filetime_index++ )
+			{
+				if( filetimes[ filetime_index ] > *value )
+				{
+					*value = filetimes[ filetime_index ];
+				}
+			}
+			break;
+
+		case FILTER_EXPRESSION_FIELD_FORMAT_VERSION:
+			result = libscca_file_get_format_version(
+			          file,
+			          &value_32bit,
+			          error );
+
+			*value = value_32bit;
+			break;
+
+		case FILTER_EXPRESSION_FIELD_PREFETCH_HASH:
+			result = libscca_file_get_prefetch_hash(
+			          file,
+			          &value_32bit,
+			          error );
+
+			*value = value_32bit;
+			break;
+
+		case FILTER_EXPRESSION_FIELD_NUMBER_OF_FILENAMES:
+			result = libscca_file_get_number_of_filenames(
+			          file,
+			          &number_of_values,
+			          error );
+
+			*value = (uint64_t) number_of_values;
+			break;
+
+		case FILTER_EXPRESSION_FIELD_NUMBER_OF_VOLUMES:
+			result = libscca_file_get_number_of_volumes(
+			          file,
+			          &number_of_values,
+			          error );
+
+			*value = (uint64_t) number_of_values;
+			break;
+
+		case FILTER_EXPRESSION_FIELD_NUMBER_OF_FILE_METRICS:
+			result = libscca_file_get_number_of_file_metrics_entries(
+			          file,
+			          &number_of_values,
+			          error );
+
+			*value = (uint64_t) number_of_values;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported field.",
+			 function );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve %s.",
+		 function,
+		 filter_expression_field_names[ field ] );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Evaluates a node for a file
+ * Returns 1 if the file matches, 0 if not or -1 on error
+ */
+int filter_expression_evaluate_node(
+     filter_expression_t *filter_expression,
+     libscca_file_t *file,
+     int node_index,
+     libcerror_error_t **error )
+{
+	filter_expression_node_t *node = NULL;
+	static char *function          = "filter_expression_evaluate_node";
+	size_t utf8_string_size        = 0;
+	uint64_t value                 = 0;
+	int filename_index             = 0;
+	int result                     = 0;
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= filter_expression->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	node = &( filter_expression->nodes[ node_index ] );
+
+	switch( node->type )
+	{
+		case FILTER_EXPRESSION_NODE_TYPE_AND:
+			result = filter_expression_evaluate_node(
+			          filter_expression,
+			          file,
+			          node->first_node_index,
+			          error );
+
+			if( result == 1 )
+			{
+				result = filter_expression_evaluate_node(
+				          filter_expression,
+				          file,
+				          node->second_node_index,
+				          error );
+			}
+			break;
+
+		case FILTER_EXPRESSION_NODE_TYPE_OR:
+			result = filter_expression_evaluate_node(
+			          filter_expression,
+			          file,
+			          node->first_node_index,
+			          error );
+
+			if( result == 0 )
+			{
+				result = filter_expression_evaluate_node(
+				          filter_expression,
+				          file,
+				          node->second_node_index,
+				          error );
+			}
+			break;
+
+		case FILTER_EXPRESSION_NODE_TYPE_NOT:
+			result = filter_expression_evaluate_node(
+			          filter_expression,
+			          file,
+			          node->first_node_index,
+			          error );
+
+			if( result != -1 )
+			{
+				result = ( result == 0 ) ? 1 : 0;
+			}
+			break;
+
+		case FILTER_EXPRESSION_NODE_TYPE_COMPARE_INTEGER:
+			if( filter_expression_get_integer_value(
+			     filter_expression,
+			     file,
+			     node->field,
+			     &value,
+			     error ) != 1 )
+			{
+				result = -1;
+
+				break;
+			}
+			switch( node->comparison_operator )
+			{
+				case FILTER_EXPRESSION_OPERATOR_EQUAL:
+					result = ( value == node->value ) ? 1 : 0;
+					break;
+
+				case FILTER_EXPRESSION_OPERATOR_NOT_EQUAL:
+					result = ( value != node->value ) ? 1 : 0;
+					break;
+
+				case FILTER_EXPRESSION_OPERATOR_LESS:
+					result = ( value < node->value ) ? 1 : 0;
+					break;
+
+				case FILTER_EXPRESSION_OPERATOR_LESS_OR_EQUAL:
+					result = ( value <= node->value ) ? 1 : 0;
+					break;
+
+				case FILTER_EXPRESSION_OPERATOR_GREATER:
+					result = ( value > node->value ) ? 1 : 0;
+					break;
+
+				case FILTER_EXPRESSION_OPERATOR_GREATER_OR_EQUAL:
+					result = ( value >= node->value ) ? 1 : 0;
+					break;
+
+				default:
+					result = 0;
+					break;
+			}
+			break;
+
+		case FILTER_EXPRESSION_NODE_TYPE_COMPARE_STRING:
+			if( filter_expression->executable_filename_is_set == 0 )
+			{
+				if( libscca_file_get_utf8_executable_filename_size(
+				     file,
+				     &utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve executable filename size.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+				if( utf8_string_size > FILTER_EXPRESSION_EXECUTABLE_FILENAME_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid executable filename size value out of bounds.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+				filter_expression->executable_filename_length = 0;
+
+				if( utf8_string_size > 1 )
+				{
+					if( libscca_file_get_utf8_executable_filename(
+					     file,
+					     filter_expression->executable_filename,
+					     utf8_string_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve executable filename.",
+						 function );
+
+						result = -1;
+
+						break;
+					}
+					filter_expression->executable_filename_length = utf8_string_size - 1;
+				}
+				filter_expression->executable_filename_is_set = 1;
+			}
+			result = filter_expression_compare_strings(
+			          filter_expression->executable_filename,
+			          filter_expression->executable_filename_length,
+			          &( filter_expression->string[ node->string_offset ] ),
+			          node->string_length,
+			          node->comparison_operator );
+			break;
+
+		case FILTER_EXPRESSION_NODE_TYPE_ANY_FILENAME:
+			/* The filenames are compared as stored in the file, without converting them to UTF-8
+			 */
+			result = libscca_file_get_filename_index_by_utf8_pattern(
+			          file,
+			          &( filter_expression->string[ node->string_offset ] ),
+			          node->string_length,
+			          (int) node->value,
+			          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+			          &filename_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to match filenames.",
+				 function );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported node type: %d.",
+			 function,
+			 node->type );
+
+			result = -1;
+
+			break;
+	}
+	return( result );
+}
+
+/* Determines if a file matches the expression
+ * Returns 1 if the file matches, 0 if not or -1 on error
+ */
+int filter_expression_matches(
+     filter_expression_t *filter_expression,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "filter_expression_matches";
+
+	if( filter_expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( filter_expression->root_node_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid filter expression - not compiled.",
+		 function );
+
+		return( -1 );
+	}
+	filter_expression->executable_filename_is_set = 0;
+
+	return( filter_expression_evaluate_node(
+	         filter_expression,
+	         file,
+	         filter_expression->root_node_index,
+	         error ) );
+}
+
@@ -0,0 +1,293 @@
+/*
+ * Filter expression
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FILTER_EXPRESSION_H )
+#define _FILTER_EXPRESSION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of nodes of an expression
+ */
+#define FILTER_EXPRESSION_MAXIMUM_NUMBER_OF_NODES	1024
+
+/* The maximum nesting depth of an expression
+ */
+#define FILTER_EXPRESSION_MAXIMUM_DEPTH			64
+
+/* The size of the executable filename buffer
+ */
+#define FILTER_EXPRESSION_EXECUTABLE_FILENAME_SIZE	256
+
+enum FILTER_EXPRESSION_NODE_TYPES
+{
+	FILTER_EXPRESSION_NODE_TYPE_AND			= 1,
+	FILTER_EXPRESSION_NODE_TYPE_OR			= 2,
+	FILTER_EXPRESSION_NODE_TYPE_NOT			= 3,
+	FILTER_EXPRESSION_NODE_TYPE_COMPARE_INTEGER	= 4,
+	FILTER_EXPRESSION_NODE_TYPE_COMPARE_STRING	= 5,
+	FILTER_EXPRESSION_NODE_TYPE_ANY_FILENAME	= 6
+};
+
+enum FILTER_EXPRESSION_FIELDS
+{
+	FILTER_EXPRESSION_FIELD_RUN_COUNT		= 1,
+	FILTER_EXPRESSION_FIELD_LAST_RUN_TIME		= 2,
+	FILTER_EXPRESSION_FIELD_FORMAT_VERSION		= 3,
+	FILTER_EXPRESSION_FIELD_PREFETCH_HASH		= 4,
+	FILTER_EXPRESSION_FIELD_NUMBER_OF_FILENAMES	= 5,
+	FILTER_EXPRESSION_FIELD_NUMBER_OF_VOLUMES	= 6,
+	FILTER_EXPRESSION_FIELD_NUMBER_OF_FILE_METRICS	= 7,
+	FILTER_EXPRESSION_FIELD_EXECUTABLE_FILENAME	= 8,
+	FILTER_EXPRESSION_FIELD_FILENAME		= 9
+};
+
+enum FILTER_EXPRESSION_OPERATORS
+{
+	FILTER_EXPRESSION_OPERATOR_EQUAL		= 1,
+	FILTER_EXPRESSION_OPERATOR_NOT_EQUAL		= 2,
+	FILTER_EXPRESSION_OPERATOR_LESS			= 3,
+	FILTER_EXPRESSION_OPERATOR_LESS_OR_EQUAL	= 4,
+	FILTER_EXPRESSION_OPERATOR_GREATER		= 5,
+	FILTER_EXPRESSION_OPERATOR_GREATER_OR_EQUAL	= 6,
+	FILTER_EXPRESSION_OPERATOR_CONTAINS		= 7,
+	FILTER_EXPRESSION_OPERATOR_STARTS_WITH		= 8,
+	FILTER_EXPRESSION_OPERATOR_ENDS_WITH		= 9
+};
+
+enum FILTER_EXPRESSION_TOKEN_TYPES
+{
+	FILTER_EXPRESSION_TOKEN_TYPE_END		= 0,
+	FILTER_EXPRESSION_TOKEN_TYPE_IDENTIFIER		= 1,
+	FILTER_EXPRESSION_TOKEN_TYPE_INTEGER		= 2,
+	FILTER_EXPRESSION_TOKEN_TYPE_DATE		= 3,
+	FILTER_EXPRESSION_TOKEN_TYPE_STRING		= 4,
+	FILTER_EXPRESSION_TOKEN_TYPE_OPERATOR		= 5,
+	FILTER_EXPRESSION_TOKEN_TYPE_OPEN_PARENTHESIS	= 6,
+	FILTER_EXPRESSION_TOKEN_TYPE_CLOSE_PARENTHESIS	= 7
+};
+
+typedef struct filter_expression_node filter_expression_node_t;
+
+struct filter_expression_node
+{
+	/* The node type
+	 */
+	int type;
+
+	/* The field that is compared
+	 */
+	int field;
+
+	/* The comparison operator
+	 */
+	int comparison_operator;
+
+	/* The integer value that is compared with
+	 */
+	uint64_t value;
+
+	/* The offset of the UTF-8 string that is compared with
+	 */
+	size_t string_offset;
+
+	/* The length of the UTF-8 string that is compared with
+	 */
+	size_t string_length;
+
+	/* The index of the first operand node
+	 */
+	int first_node_index;
+
+	/* The index of the second operand node
+	 */
+	int second_node_index;
+};
+
+typedef struct filter_expression filter_expression_t;
+
+struct filter_expression
+{
+	/* The UTF-8 expression string, where the string values are unescaped in place
+	 */
+	uint8_t *string;
+
+	/* The size of the UTF-8 expression string
+	 */
+	size_t string_size;
+
+	/* The current offset in the expression string
+	 */
+	size_t string_offset;
+
+	/* The type of the current token
+	 */
+	int token_type;
+
+	/* The offset of the current token
+	 */
+	size_t token_offset;
+
+	/* The length of the current token
+	 */
+	size_t token_length;
+
+	/* The value of the current integer, date or operator token
+	 */
+	uint64_t token_value;
+
+	/* The nodes
+	 */
+	filter_expression_node_t *nodes;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	int number_of_allocated_nodes;
+
+	/* The index of the root node
+	 */
+	int root_node_index;
+
+	/* The executable filename of the file that is evaluated
+	 */
+	uint8_t executable_filename[ FILTER_EXPRESSION_EXECUTABLE_FILENAME_SIZE ];
+
+	/* The length of the executable filename, which is retrieved on first use
+	 */
+	size_t executable_filename_length;
+
+	/* Value to indicate the executable filename was retrieved
+	 */
+	uint8_t executable_filename_is_set;
+};
+
+int filter_expression_initialize(
+     filter_expression_t **filter_expression,
+     libcerror_error_t **error );
+
+int filter_expression_free(
+     filter_expression_t **filter_expression,
+     libcerror_error_t **error );
+
+int filter_expression_parse_date(
+     const uint8_t *string,
+     size_t string_length,
+     uint64_t *filetime );
+
+int filter_expression_read_token(
+     filter_expression_t *filter_expression,
+     libcerror_error_t **error );
+
+int filter_expression_token_is_keyword(
+     filter_expression_t *filter_expression,
+     const char *keyword );
+
+int filter_expression_get_field(
+     const uint8_t *string,
+     size_t string_length );
+
+int filter_expression_append_node(
+     filter_expression_t *filter_expression,
+     int node_type,
+     int *node_index,
+     libcerror_error_t **error );
+
+int filter_expression_get_node_cost(
+     filter_expression_t *filter_expression,
+     int node_index );
+
+int filter_expression_parse_or(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error );
+
+int filter_expression_parse_and(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error );
+
+int filter_expression_parse_not(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error );
+
+int filter_expression_parse_comparison(
+     filter_expression_t *filter_expression,
+     int field,
+     int *node_index,
+     libcerror_error_t **error );
+
+int filter_expression_parse_primary(
+     filter_expression_t *filter_expression,
+     int depth,
+     int *node_index,
+     libcerror_error_t **error );
+
+int filter_expression_compile(
+     filter_expression_t *filter_expression,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int filter_expression_compare_strings(
+     const uint8_t *string,
+     size_t string_length,
+     const uint8_t *pattern,
+     size_t pattern_length,
+     int comparison_operator );
+
+int filter_expression_get_integer_value(
+     filter_expression_t *filter_expression,
+     libscca_file_t *file,
+     int field,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int filter_expression_evaluate_node(
+     filter_expression_t *filter_expression,
+     libscca_file_t *file,
+     int node_index,
+     libcerror_error_t **error );
+
+int filter_expression_matches(
+     filter_expression_t *filter_expression,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FILTER_EXPRESSION_H ) */
+
@@ -0,0 +1,1606 @@
+/*
+ * Streaming frequency sketch
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "frequency_sketch.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+/* Calculates the 64-bit hash of a key
+ * The FNV-1a hash is followed by a finalizer so that all bits of the hash
+ * can be used independently by the count-min sketch and HyperLogLog
+ * Returns the hash
+ */
+uint64_t frequency_sketch_calculate_hash(
+          const uint8_t *key,
+          size_t key_size )
+{
+	size_t key_offset = 0;
+	uint64_t hash     = 0xcbf29ce484222325ULL;
+
+	for( key_offset = 0;
+	     key_offset < key_size;
+	     key_offset++ )
+	{
+		hash ^= key[ key_offset ];
+		hash *= 0x00000100000001b3ULL;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	hash ^= hash >> 33;
+
+	return( hash );
+}
+
+/* Calculates the natural logarithm of a positive value
+ * The value is scaled into the range [1.0, 2.0] after which the series
+ * ln( x ) = 2 * atanh( ( x - 1 ) / ( x + 1 ) ) is used, so that the math library is not needed
+ * Returns the natural logarithm
+ */
+double frequency_sketch_natural_logarithm(
+        double value )
+{
+	double fraction = 0.0;
+	double result   = 0.0;
+	double square   = 0.0;
+	double term     = 0.0;
+	int term_index  = 0;
+
+	if( value <= 0.0 )
+	{
+		return( 0.0 );
+	}
+	while( value > 2.0 )
+	{
+		value  /= 2.0;
+		result += 0.69314718055994530942;
+	}
+	while( value < 1.0 )
+	{
+		value  *= 2.0;
+		result -= 0.69314718055994530942;
+	}
+	fraction = ( value - 1.0 ) / ( value + 1.0 );
+	square   = fraction * fraction;
+	term     = fraction;
+
+	for( term_index = 1;
+	     term_index < 64;
+	     term_index += 2 )
+	{
+		result += 2.0 * term / (double) term_index;
+		term   *= square;
+	}
+	return( result );
+}
+
+/* Creates a frequency sketch table
+ * Make sure the value table is referencing, is set to NULL
+ * The heap is only created if use_heap is set
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_table_initialize(
+     frequency_sketch_table_t **table,
+     int maximum_number_of_entries,
+     int use_heap,
+     libcerror_error_t **error )
+{
+	static char *function = "frequency_sketch_table_initialize";
+	size_t entries_size   = 0;
+	int number_of_buckets = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > ( FREQUENCY_SKETCH_MAXIMUM_NUMBER_OF_ENTRIES * FREQUENCY_SKETCH_RARE_CANDIDATES_FACTOR ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The number of buckets is at least twice the maximum number of entries
+	 */
+	while( number_of_buckets < ( maximum_number_of_entries * 2 ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	*table = memory_allocate_structure(
+	          frequency_sketch_table_t );
+
+	if( *table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *table,
+	     0,
+	     sizeof( frequency_sketch_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table.",
+		 function );
+
+		memory_free(
+		 *table );
+
+		*table = NULL;
+
+		return( -1 );
+	}
+	entries_size = sizeof( frequency_sketch_entry_t ) * (size_t) maximum_number_of_entries;
+
+	( *table )->entries = (frequency_sketch_entry_t *) memory_allocate(
+	                                                    entries_size );
+
+	if( ( *table )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *table )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *table )->buckets = (int *) memory_allocate(
+	                               sizeof( int ) * (size_t) number_of_buckets );
+
+	if( ( *table )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *table )->buckets,
+	     0,
+	     sizeof( int ) * (size_t) number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( use_heap != 0 )
+	{
+		( *table )->heap = (int *) memory_allocate(
+		                            sizeof( int ) * (size_t) maximum_number_of_entries );
+
+		if( ( *table )->heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create heap.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *table )->maximum_number_of_entries = maximum_number_of_entries;
+	( *table )->number_of_buckets         = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *table != NULL )
+	{
+		if( ( *table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *table )->buckets );
+		}
+		if( ( *table )->entries != NULL )
+		{
+			memory_free(
+			 ( *table )->entries );
+		}
+		memory_free(
+		 *table );
+
+		*table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a frequency sketch table
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_table_free(
+     frequency_sketch_table_t **table,
+     libcerror_error_t **error )
+{
+	static char *function = "frequency_sketch_table_free";
+	int entry_index       = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table != NULL )
+	{
+		/* Entries beyond the number of entries can still contain a key buffer
+		 * that is reused when the entry is set again
+		 */
+		for( entry_index = 0;
+		     entry_index < ( *table )->maximum_number_of_entries;
+		     entry_index++ )
+		{
+			if( ( *table )->entries[ entry_index ].key != NULL )
+			{
+				memory_free(
+				 ( *table )->entries[ entry_index ].key );
+			}
+		}
+		if( ( *table )->heap != NULL )
+		{
+			memory_free(
+			 ( *table )->heap );
+		}
+		memory_free(
+		 ( *table )->buckets );
+
+		memory_free(
+		 ( *table )->entries );
+
+		memory_free(
+		 *table );
+
+		*table = NULL;
+	}
+	return( 1 );
+}
+
+/* Finds the entry of a specific key
+ * Returns 1 if found or 0 if not
+ */
+int frequency_sketch_table_find_entry(
+     frequency_sketch_table_t *table,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     int *entry_index )
+{
+	frequency_sketch_entry_t *entry = NULL;
+	int next_entry_index            = 0;
+
+	next_entry_index = table->buckets[ hash & (uint64_t) ( table->number_of_buckets - 1 ) ];
+
+	while( next_entry_index != 0 )
+	{
+		entry = &( table->entries[ next_entry_index - 1 ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->key_size == key_size )
+		 && ( memory_compare(
+		       entry->key,
+		       key,
+		       key_size ) == 0 ) )
+		{
+			*entry_index = next_entry_index - 1;
+
+			return( 1 );
+		}
+		next_entry_index = entry->next_entry_index;
+	}
+	return( 0 );
+}
+
+/* Removes an entry from the chain of its bucket
+ */
+void frequency_sketch_table_unlink_entry(
+      frequency_sketch_table_t *table,
+      int entry_index )
+{
+	int *next_entry_index = NULL;
+
+	next_entry_index = &( table->buckets[ table->entries[ entry_index ].hash & (uint64_t) ( table->number_of_buckets - 1 ) ] );
+
+	while( *next_entry_index != 0 )
+	{
+		if( *next_entry_index == ( entry_index + 1 ) )
+		{
+			*next_entry_index = table->entries[ entry_index ].next_entry_index;
+
+			break;
+		}
+		next_entry_index = &( table->entries[ *next_entry_index - 1 ].next_entry_index );
+	}
+	table->entries[ entry_index ].next_entry_index = 0;
+}
+
+/* Sets the key of an entry and adds the entry to the chain of its bucket
+ * The entry must not be part of a chain
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_table_set_entry(
+     frequency_sketch_table_t *table,
+     int entry_index,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	frequency_sketch_entry_t *entry = NULL;
+	void *reallocation              = NULL;
+	static char *function           = "frequency_sketch_table_set_entry";
+	int bucket_index                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= table->maximum_number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( table->entries[ entry_index ] );
+
+	if( key_size > entry->allocated_key_size )
+	{
+		reallocation = memory_reallocate(
+		                entry->key,
+		                sizeof( uint8_t ) * key_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize key.",
+			 function );
+
+			return( -1 );
+		}
+		entry->key                = (uint8_t *) reallocation;
+		entry->allocated_key_size = key_size;
+	}
+	if( memory_copy(
+	     entry->key,
+	     key,
+	     key_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( hash & (uint64_t) ( table->number_of_buckets - 1 ) );
+
+	entry->hash                    = hash;
+	entry->key_size                = key_size;
+	entry->next_entry_index        = table->buckets[ bucket_index ];
+	table->buckets[ bucket_index ] = entry_index + 1;
+
+	return( 1 );
+}
+
+/* Rebuilds the chains of the buckets after the entries were reordered
+ */
+void frequency_sketch_table_rebuild_buckets(
+      frequency_sketch_table_t *table )
+{
+	int bucket_index = 0;
+	int entry_index  = 0;
+
+	for( bucket_index = 0;
+	     bucket_index < table->number_of_buckets;
+	     bucket_index++ )
+	{
+		table->buckets[ bucket_index ] = 0;
+	}
+	for( entry_index = 0;
+	     entry_index < table->number_of_entries;
+	     entry_index++ )
+	{
+		bucket_index = (int) ( table->entries[ entry_index ].hash & (uint64_t) ( table->number_of_buckets - 1 ) );
+
+		table->entries[ entry_index ].next_entry_index = table->buckets[ bucket_index ];
+		table->buckets[ bucket_index ]                 = entry_index + 1;
+	}
+}
+
+/* Moves an entry towards the root of the heap while its count is smaller than that of its parent
+ */
+void frequency_sketch_table_heap_sift_up(
+      frequency_sketch_table_t *table,
+      int heap_index )
+{
+	int entry_index  = 0;
+	int parent_index = 0;
+
+	entry_index = table->heap[ heap_index ];
+
+	while( heap_index > 0 )
+	{
+		parent_index = ( heap_index - 1 ) / 2;
+
+		if( table->entries[ table->heap[ parent_index ] ].count <= table->entries[ entry_index ].count )
+		{
+			break;
+		}
+		table->heap[ heap_index ]                               = table->heap[ parent_index ];
+		table->entries[ table->heap[ heap_index ] ].heap_index = heap_index;
+
+		heap_index = parent_index;
+	}
+	table->heap[ heap_index ]                 = entry_index;
+	table->entries[ entry_index ].heap_index = heap_index;
+}
+
+/* Moves an entry away from the root of the heap while its count is larger than that of its children
+ */
+void frequency_sketch_table_heap_sift_down(
+      frequency_sketch_table_t *table,
+      int heap_index )
+{
+	int child_index = 0;
+	int entry_index = 0;
+
+	entry_index = table->heap[ heap_index ];
+
+	for( ;; )
+	{
+		child_index = ( heap_index * 2 ) + 1;
+
+		if( child_index >= table->number_of_entries )
+		{
+			break;
+		}
+		if( ( ( child_index + 1 ) < table->number_of_entries )
+		 && ( table->entries[ table->heap[ child_index + 1 ] ].count < table->entries[ table->heap[ child_index ] ].count ) )
+		{
+			child_index += 1;
+		}
+		if( table->entries[ entry_index ].count <= table->entries[ table->heap[ child_index ] ].count )
+		{
+			break;
+		}
+		table->heap[ heap_index ]                               = table->heap[ child_index ];
+		table->entries[ table->heap[ heap_index ] ].heap_index = heap_index;
+
+		heap_index = child_index;
+	}
+	table->heap[ heap_index ]                 = entry_index;
+	table->entries[ entry_index ].heap_index = heap_index;
+}
+
+/* Compares the key of two entries
+ * Returns -1 if the first key sorts before the second, 1 if after or 0 if equal
+ */
+int frequency_sketch_compare_entry_keys(
+     const frequency_sketch_entry_t *first_entry,
+     const frequency_sketch_entry_t *second_entry )
+{
+	size_t key_size = 0;
+	int result      = 0;
+
+	key_size = first_entry->key_size;
+
+	if( key_size > second_entry->key_size )
+	{
+		key_size = second_entry->key_size;
+	}
+	result = memory_compare(
+	          first_entry->key,
+	          second_entry->key,
+	          key_size );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first_entry->key_size < second_entry->key_size )
+	{
+		return( -1 );
+	}
+	else if( first_entry->key_size > second_entry->key_size )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two entries by ascending count and key
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+int frequency_sketch_compare_entries_by_ascending_count(
+     const frequency_sketch_entry_t *first_entry,
+     const frequency_sketch_entry_t *second_entry )
+{
+	if( first_entry->count < second_entry->count )
+	{
+		return( -1 );
+	}
+	else if( first_entry->count > second_entry->count )
+	{
+		return( 1 );
+	}
+	return( frequency_sketch_compare_entry_keys(
+	         first_entry,
+	         second_entry ) );
+}
+
+/* Compares two entries by descending count and ascending key
+ * Returns -1 if the first entry sorts before the second, 1 if after or 0 if equal
+ */
+int frequency_sketch_compare_entries_by_descending_count(
+     const frequency_sketch_entry_t *first_entry,
+     const frequency_sketch_entry_t *second_entry )
+{
+	if( first_entry->count > second_entry->count )
+	{
+		return( -1 );
+	}
+	else if( first_entry->count < second_entry->count )
+	{
+		return( 1 );
+	}
+	return( frequency_sketch_compare_entry_keys(
+	         first_entry,
+	         second_entry ) );
+}
+
+/* Creates a frequency sketch
+ * Make sure the value frequency_sketch is referencing, is set to NULL
+ * The number of entries is the number of most common and rarest keys that are reported
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_initialize(
+     frequency_sketch_t **frequency_sketch,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "frequency_sketch_initialize";
+	size_t counters_size  = 0;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *frequency_sketch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid frequency sketch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > FREQUENCY_SKETCH_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*frequency_sketch = memory_allocate_structure(
+	                     frequency_sketch_t );
+
+	if( *frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create frequency sketch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *frequency_sketch,
+	     0,
+	     sizeof( frequency_sketch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequency sketch.",
+		 function );
+
+		memory_free(
+		 *frequency_sketch );
+
+		*frequency_sketch = NULL;
+
+		return( -1 );
+	}
+	counters_size = sizeof( uint32_t ) * FREQUENCY_SKETCH_COUNT_MIN_DEPTH * FREQUENCY_SKETCH_COUNT_MIN_WIDTH;
+
+	( *frequency_sketch )->count_min_counters = (uint32_t *) memory_allocate(
+	                                                          counters_size );
+
+	if( ( *frequency_sketch )->count_min_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create count-min counters.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *frequency_sketch )->count_min_counters,
+	     0,
+	     counters_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear count-min counters.",
+		 function );
+
+		goto on_error;
+	}
+	( *frequency_sketch )->hyperloglog_registers = (uint8_t *) memory_allocate(
+	                                                            sizeof( uint8_t ) * FREQUENCY_SKETCH_HYPERLOGLOG_NUMBER_OF_REGISTERS );
+
+	if( ( *frequency_sketch )->hyperloglog_registers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create HyperLogLog registers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *frequency_sketch )->hyperloglog_registers,
+	     0,
+	     sizeof( uint8_t ) * FREQUENCY_SKETCH_HYPERLOGLOG_NUMBER_OF_REGISTERS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear HyperLogLog registers.",
+		 function );
+
+		goto on_error;
+	}
+	if( frequency_sketch_table_initialize(
+	     &( ( *frequency_sketch )->heavy_hitters ),
+	     number_of_entries,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create heavy hitters.",
+		 function );
+
+		goto on_error;
+	}
+	if( frequency_sketch_table_initialize(
+	     &( ( *frequency_sketch )->rare_candidates ),
+	     number_of_entries * FREQUENCY_SKETCH_RARE_CANDIDATES_FACTOR,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create rare candidates.",
+		 function );
+
+		goto on_error;
+	}
+	( *frequency_sketch )->rare_candidates_threshold = (uint64_t) UINT32_MAX;
+	( *frequency_sketch )->number_of_entries         = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *frequency_sketch != NULL )
+	{
+		frequency_sketch_free(
+		 frequency_sketch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a frequency sketch
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_free(
+     frequency_sketch_t **frequency_sketch,
+     libcerror_error_t **error )
+{
+	static char *function = "frequency_sketch_free";
+	int result            = 1;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *frequency_sketch != NULL )
+	{
+		if( ( *frequency_sketch )->rare_candidates != NULL )
+		{
+			if( frequency_sketch_table_free(
+			     &( ( *frequency_sketch )->rare_candidates ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free rare candidates.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *frequency_sketch )->heavy_hitters != NULL )
+		{
+			if( frequency_sketch_table_free(
+			     &( ( *frequency_sketch )->heavy_hitters ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free heavy hitters.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *frequency_sketch )->hyperloglog_registers != NULL )
+		{
+			memory_free(
+			 ( *frequency_sketch )->hyperloglog_registers );
+		}
+		if( ( *frequency_sketch )->count_min_counters != NULL )
+		{
+			memory_free(
+			 ( *frequency_sketch )->count_min_counters );
+		}
+		memory_free(
+		 *frequency_sketch );
+
+		*frequency_sketch = NULL;
+	}
+	return( result );
+}
+
+/* Counts a hash in the count-min sketch
+ * A conservative update is used, where only the counters that equal the current
+ * minimum are incremented, which reduces the overestimation of rare keys
+ * Returns the estimated count after the update
+ */
+uint64_t frequency_sketch_count_min_update(
+          frequency_sketch_t *frequency_sketch,
+          uint64_t hash )
+{
+	uint32_t *counters     = NULL;
+	uint32_t counter_index = 0;
+	uint32_t first_hash    = 0;
+	uint32_t minimum       = UINT32_MAX;
+	uint32_t second_hash   = 0;
+	int row_index          = 0;
+
+	first_hash  = (uint32_t) hash;
+	second_hash = (uint32_t) ( hash >> 32 ) | 1;
+
+	for( row_index = 0;
+	     row_index < FREQUENCY_SKETCH_COUNT_MIN_DEPTH;
+	     row_index++ )
+	{
+		counters      = &( frequency_sketch->count_min_counters[ row_index * FREQUENCY_SKETCH_COUNT_MIN_WIDTH ] );
+		counter_index = ( first_hash + ( (uint32_t) row_index * second_hash ) ) & ( FREQUENCY_SKETCH_COUNT_MIN_WIDTH - 1 );
+
+		if( counters[ counter_index ] < minimum )
+		{
+			minimum = counters[ counter_index ];
+		}
+	}
+	/* The counters saturate instead of overflowing
+	 */
+	if( minimum == UINT32_MAX )
+	{
+		return( (uint64_t) minimum );
+	}
+	for( row_index = 0;
+	     row_index < FREQUENCY_SKETCH_COUNT_MIN_DEPTH;
+	     row_index++ )
+	{
+		counters      = &( frequency_sketch->count_min_counters[ row_index * FREQUENCY_SKETCH_COUNT_MIN_WIDTH ] );
+		counter_index = ( first_hash + ( (uint32_t) row_index * second_hash ) ) & ( FREQUENCY_SKETCH_COUNT_MIN_WIDTH - 1 );
+
+		if( counters[ counter_index ] == minimum )
+		{
+			counters[ counter_index ] += 1;
+		}
+	}
+	return( (uint64_t) minimum + 1 );
+}
+
+/* Retrieves the count-min estimate of a hash
+ * Returns the estimated count, which is never less than the actual count
+ */
+uint64_t frequency_sketch_count_min_get_estimate(
+          frequency_sketch_t *frequency_sketch,
+          uint64_t hash )
+{
+	uint32_t counter_index = 0;
+	uint32_t first_hash    = 0;
+	uint32_t minimum       = UINT32_MAX;
+	uint32_t second_hash   = 0;
+	uint32_t value         = 0;
+	int row_index          = 0;
+
+	first_hash  = (uint32_t) hash;
+	second_hash = (uint32_t) ( hash >> 32 ) | 1;
+
+	for( row_index = 0;
+	     row_index < FREQUENCY_SKETCH_COUNT_MIN_DEPTH;
+	     row_index++ )
+	{
+		counter_index = ( first_hash + ( (uint32_t) row_index * second_hash ) ) & ( FREQUENCY_SKETCH_COUNT_MIN_WIDTH - 1 );
+		value         = frequency_sketch->count_min_counters[ ( row_index * FREQUENCY_SKETCH_COUNT_MIN_WIDTH ) + counter_index ];
+
+		if( value < minimum )
+		{
+			minimum = value;
+		}
+	}
+	return( (uint64_t) minimum );
+}
+
+/* Adds a hash to the HyperLogLog registers
+ * The upper bits of the hash select the register, which stores the maximum
+ * position of the first set bit in the remaining bits
+ */
+void frequency_sketch_hyperloglog_update(
+      frequency_sketch_t *frequency_sketch,
+      uint64_t hash )
+{
+	uint64_t remaining_bits = 0;
+	uint32_t register_index = 0;
+	uint8_t rank            = 1;
+
+	register_index = (uint32_t) ( hash >> ( 64 - FREQUENCY_SKETCH_HYPERLOGLOG_PRECISION ) );
+	remaining_bits = hash << FREQUENCY_SKETCH_HYPERLOGLOG_PRECISION;
+
+	while( ( rank <= ( 64 - FREQUENCY_SKETCH_HYPERLOGLOG_PRECISION ) )
+	    && ( ( remaining_bits & 0x8000000000000000ULL ) == 0 ) )
+	{
+		remaining_bits <<= 1;
+		rank            += 1;
+	}
+	if( rank > frequency_sketch->hyperloglog_registers[ register_index ] )
+	{
+		frequency_sketch->hyperloglog_registers[ register_index ] = rank;
+	}
+}
+
+/* Retrieves the HyperLogLog estimate of the number of distinct hashes
+ * Linear counting is used for small cardinalities where HyperLogLog is biased
+ * Returns the estimated number of distinct hashes
+ */
+uint64_t frequency_sketch_hyperloglog_get_estimate(
+          frequency_sketch_t *frequency_sketch )
+{
+	double alpha               = 0.0;
+	double estimate            = 0.0;
+	double number_of_registers = (double) FREQUENCY_SKETCH_HYPERLOGLOG_NUMBER_OF_REGISTERS;
+	double sum                 = 0.0;
+	int number_of_zeros        = 0;
+	int register_index         = 0;
+
+	for( register_index = 0;
+	     register_index < FREQUENCY_SKETCH_HYPERLOGLOG_NUMBER_OF_REGISTERS;
+	     register_index++ )
+	{
+		sum += 1.0 / (double) ( (uint64_t) 1 << frequency_sketch->hyperloglog_registers[ register_index ] );
+
+		if( frequency_sketch->hyperloglog_registers[ register_index ] == 0 )
+		{
+			number_of_zeros++;
+		}
+	}
+	alpha    = 0.7213 / ( 1.0 + ( 1.079 / number_of_registers ) );
+	estimate = alpha * number_of_registers * number_of_registers / sum;
+
+	if( ( estimate <= ( 2.5 * number_of_registers ) )
+	 && ( number_of_zeros > 0 ) )
+	{
+		estimate = number_of_registers * frequency_sketch_natural_logarithm(
+		                                  number_of_registers / (double) number_of_zeros );
+	}
+	return( (uint64_t) ( estimate + 0.5 ) );
+}
+
+/* Counts a key in the heavy hitters using the space-saving algorithm
+ * If the key is not tracked and the table is full the entry with the smallest
+ * count is replaced, and the new entry inherits that count as its error
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_heavy_hitters_update(
+     frequency_sketch_t *frequency_sketch,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	frequency_sketch_table_t *table = NULL;
+	static char *function           = "frequency_sketch_heavy_hitters_update";
+	uint64_t minimum                = 0;
+	int entry_index                 = 0;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	table = frequency_sketch->heavy_hitters;
+
+	if( frequency_sketch_table_find_entry(
+	     table,
+	     hash,
+	     key,
+	     key_size,
+	     &entry_index ) == 1 )
+	{
+		table->entries[ entry_index ].count += 1;
+
+		frequency_sketch_table_heap_sift_down(
+		 table,
+		 table->entries[ entry_index ].heap_index );
+
+		return( 1 );
+	}
+	if( table->number_of_entries < table->maximum_number_of_entries )
+	{
+		entry_index = table->number_of_entries;
+
+		if( frequency_sketch_table_set_entry(
+		     table,
+		     entry_index,
+		     hash,
+		     key,
+		     key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		table->entries[ entry_index ].count = 1;
+		table->entries[ entry_index ].error = 0;
+		table->heap[ entry_index ]          = entry_index;
+
+		table->number_of_entries += 1;
+
+		frequency_sketch_table_heap_sift_up(
+		 table,
+		 entry_index );
+
+		return( 1 );
+	}
+	entry_index = table->heap[ 0 ];
+	minimum     = table->entries[ entry_index ].count;
+
+	frequency_sketch_table_unlink_entry(
+	 table,
+	 entry_index );
+
+	if( frequency_sketch_table_set_entry(
+	     table,
+	     entry_index,
+	     hash,
+	     key,
+	     key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	table->entries[ entry_index ].count = minimum + 1;
+	table->entries[ entry_index ].error = minimum;
+
+	frequency_sketch_table_heap_sift_down(
+	 table,
+	 0 );
+
+	return( 1 );
+}
+
+/* Updates the counts of the rare candidates with their current count-min estimates
+ */
+void frequency_sketch_rare_candidates_refresh(
+      frequency_sketch_t *frequency_sketch )
+{
+	frequency_sketch_table_t *table = NULL;
+	int entry_index                 = 0;
+
+	table = frequency_sketch->rare_candidates;
+
+	for( entry_index = 0;
+	     entry_index < table->number_of_entries;
+	     entry_index++ )
+	{
+		table->entries[ entry_index ].count = frequency_sketch_count_min_get_estimate(
+		                                       frequency_sketch,
+		                                       table->entries[ entry_index ].hash );
+	}
+}
+
+/* Adds a key to the rare candidates if its estimate does not exceed the threshold
+ * When the table is full the candidates are refreshed and only the rarest half
+ * is kept, after which the threshold is lowered to the largest kept estimate.
+ * Since count-min estimates never underestimate, a reported estimate is an upper bound
+ * of the actual count
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_rare_candidates_update(
+     frequency_sketch_t *frequency_sketch,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     uint64_t estimate,
+     libcerror_error_t **error )
+{
+	frequency_sketch_table_t *table = NULL;
+	static char *function           = "frequency_sketch_rare_candidates_update";
+	int entry_index                 = 0;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( estimate > frequency_sketch->rare_candidates_threshold )
+	{
+		return( 1 );
+	}
+	table = frequency_sketch->rare_candidates;
+
+	if( frequency_sketch_table_find_entry(
+	     table,
+	     hash,
+	     key,
+	     key_size,
+	     &entry_index ) == 1 )
+	{
+		return( 1 );
+	}
+	if( table->number_of_entries >= table->maximum_number_of_entries )
+	{
+		frequency_sketch_rare_candidates_refresh(
+		 frequency_sketch );
+
+		qsort(
+		 table->entries,
+		 (size_t) table->number_of_entries,
+		 sizeof( frequency_sketch_entry_t ),
+		 (int (*)(const void *, const void *)) &frequency_sketch_compare_entries_by_ascending_count );
+
+		table->number_of_entries /= 2;
+
+		frequency_sketch->rare_candidates_threshold = table->entries[ table->number_of_entries - 1 ].count;
+
+		frequency_sketch_table_rebuild_buckets(
+		 table );
+
+		if( estimate > frequency_sketch->rare_candidates_threshold )
+		{
+			return( 1 );
+		}
+	}
+	entry_index = table->number_of_entries;
+
+	if( frequency_sketch_table_set_entry(
+	     table,
+	     entry_index,
+	     hash,
+	     key,
+	     key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	table->entries[ entry_index ].count = estimate;
+	table->entries[ entry_index ].error = 0;
+
+	table->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Counts a key in the count-min sketch, HyperLogLog, heavy hitters and rare candidates
+ * The memory used is bounded by the sketch dimensions and the number of entries
+ * regardless of the number of keys
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_append(
+     frequency_sketch_t *frequency_sketch,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "frequency_sketch_append";
+	uint64_t estimate     = 0;
+	uint64_t hash         = 0;
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash = frequency_sketch_calculate_hash(
+	        key,
+	        key_size );
+
+	estimate = frequency_sketch_count_min_update(
+	            frequency_sketch,
+	            hash );
+
+	frequency_sketch_hyperloglog_update(
+	 frequency_sketch,
+	 hash );
+
+	if( frequency_sketch_heavy_hitters_update(
+	     frequency_sketch,
+	     hash,
+	     key,
+	     key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to update heavy hitters.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequency_sketch_rare_candidates_update(
+	     frequency_sketch,
+	     hash,
+	     key,
+	     key_size,
+	     estimate,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to update rare candidates.",
+		 function );
+
+		return( -1 );
+	}
+	frequency_sketch->number_of_observations += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the estimated number of distinct keys
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_get_number_of_distinct_keys(
+     frequency_sketch_t *frequency_sketch,
+     uint64_t *number_of_distinct_keys,
+     libcerror_error_t **error )
+{
+	static char *function = "frequency_sketch_get_number_of_distinct_keys";
+
+	if( frequency_sketch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequency sketch.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_distinct_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of distinct keys.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_distinct_keys = frequency_sketch_hyperloglog_get_estimate(
+	                            frequency_sketch );
+
+	return( 1 );
+}
+
+/* Prints the entries of a frequency sketch table sorted by count and key
+ * The heavy hitters are sorted by descending count, the rare candidates by ascending count
+ * The entries are sorted in a copy so that the table itself is not changed
+ * Returns 1 if successful or -1 on error
+ */
+int frequency_sketch_table_fprint(
+     frequency_sketch_table_t *table,
+     const char *description,
+     int number_of_entries,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	frequency_sketch_entry_t *sorted_entries = NULL;
+	static char *function                    = "frequency_sketch_table_fprint";
+	size_t entries_size                      = 0;
+	int entry_index                          = 0;
+	int result                               = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table->number_of_entries > 0 )
+	{
+		entries_size = sizeof( frequency_sketch_entry_t ) * (size_t) table->number_of_entries;
+
+		sorted_entries = (frequency_sketch_entry_t *) memory_allocate(
+		                                               entries_size );
+
+		if( sorted_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted entries.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     sorted_entries,
+		     table->entries,
+		     entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sorted entries.",
+			 function );
+
+			memory_free(
+			 sorted_entries );
+
+			return( -1 );
+		}
+		if( table->heap != NULL )
+		{
+			qsort(
+			 sorted_entries,
+			 (size_t) table->number_of_entries,
+			 sizeof( frequency_sketch_entry_t ),
+			 (int (*)(const void *, const void *)) &frequency_sketch_compare_entries_by_descending_count );
+		}
+		else
+		{
+			qsort(
+			 sorted_entries,
+			 (size_t) table->number_of_entries,
+			 sizeof( frequency_sketch_entry_t ),
+			 (int (*)(const void *, const void *)) &frequency_sketch_compare_entries_by_ascending_count );
+		}
+	}
+	if( number_of_entries > table->number_of_entries )
+	{
+		number_of_entries = table->number_of_entries;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       description,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       ":\n",
+	       error ) != 1 ) )
+	{
+		result = -1;
+	}
+	for( entry_index = 0;
+	     ( result == 1 ) && ( entry_index < number_of_entries );
+	     entry_index++ )
+	{
+		if( ( output_buffer_append_character(
+		       output_buffer,
+		       '\t',
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       sorted_entries[ entry_index ].count,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\t',
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       output_buffer,
+		       (char *) sorted_entries[ entry_index ].key,
+		       sorted_entries[ entry_index ].key_size,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+		if( ( result == 1 )
+		 && ( output_buffer->data_offset >= OUTPUT_BUFFER_INITIAL_DATA_SIZE ) )
+		{
+			result = output_buffer_write(
+			          output_buffer,
+			          stream,
+			          error );
+		}
+	}
+	if( result == 1 )
+	{
+		result = output_buffer_append_character(
+		          output_buffer,
+		          '\n',
+		          error );
+	}
+	if( sorted_entries != NULL )
+	{
+		memory_free(
+		 sorted_entries );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print %s.",
+		 function,
+		 description );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,288 @@
+/*
+ * Streaming frequency sketch
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FREQUENCY_SKETCH_H )
+#define _FREQUENCY_SKETCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of rows of the count-min sketch
+ */
+#define FREQUENCY_SKETCH_COUNT_MIN_DEPTH			4
+
+/* The number of counters per row of the count-min sketch, must be a power of 2
+ */
+#define FREQUENCY_SKETCH_COUNT_MIN_WIDTH			( 1 << 20 )
+
+/* The number of hash bits used to select a HyperLogLog register
+ */
+#define FREQUENCY_SKETCH_HYPERLOGLOG_PRECISION			14
+
+/* The number of HyperLogLog registers
+ */
+#define FREQUENCY_SKETCH_HYPERLOGLOG_NUMBER_OF_REGISTERS	( 1 << FREQUENCY_SKETCH_HYPERLOGLOG_PRECISION )
+
+/* The number of rare candidates that are tracked per reported entry
+ */
+#define FREQUENCY_SKETCH_RARE_CANDIDATES_FACTOR			8
+
+/* The default number of reported entries
+ */
+#define FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES		20
+
+/* The maximum number of reported entries
+ */
+#define FREQUENCY_SKETCH_MAXIMUM_NUMBER_OF_ENTRIES		65536
+
+typedef struct frequency_sketch_entry frequency_sketch_entry_t;
+
+struct frequency_sketch_entry
+{
+	/* The hash of the key
+	 */
+	uint64_t hash;
+
+	/* The key
+	 */
+	uint8_t *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The allocated key size
+	 */
+	size_t allocated_key_size;
+
+	/* The estimated count, which is never less than the actual count
+	 */
+	uint64_t count;
+
+	/* The maximum overestimation of the count
+	 */
+	uint64_t error;
+
+	/* The index of the next entry in the same bucket + 1 or 0 if not set
+	 */
+	int next_entry_index;
+
+	/* The index of the entry in the heap
+	 */
+	int heap_index;
+};
+
+typedef struct frequency_sketch_table frequency_sketch_table_t;
+
+struct frequency_sketch_table
+{
+	/* The entries
+	 */
+	frequency_sketch_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The buckets, which contain the index of the first entry + 1 or 0 if not set
+	 */
+	int *buckets;
+
+	/* The number of buckets, which is a power of 2
+	 */
+	int number_of_buckets;
+
+	/* The entry indexes ordered as a binary min-heap on the count
+	 */
+	int *heap;
+};
+
+typedef struct frequency_sketch frequency_sketch_t;
+
+struct frequency_sketch
+{
+	/* The count-min sketch counters, stored row after row
+	 */
+	uint32_t *count_min_counters;
+
+	/* The HyperLogLog registers
+	 */
+	uint8_t *hyperloglog_registers;
+
+	/* The heavy hitters, maintained with the space-saving algorithm
+	 */
+	frequency_sketch_table_t *heavy_hitters;
+
+	/* The rare candidates
+	 */
+	frequency_sketch_table_t *rare_candidates;
+
+	/* The largest count-min estimate for which a key is added to the rare candidates
+	 */
+	uint64_t rare_candidates_threshold;
+
+	/* The number of reported entries
+	 */
+	int number_of_entries;
+
+	/* The number of observations
+	 */
+	uint64_t number_of_observations;
+};
+
+uint64_t frequency_sketch_calculate_hash(
+          const uint8_t *key,
+          size_t key_size );
+
+double frequency_sketch_natural_logarithm(
+        double value );
+
+int frequency_sketch_table_initialize(
+     frequency_sketch_table_t **table,
+     int maximum_number_of_entries,
+     int use_heap,
+     libcerror_error_t **error );
+
+int frequency_sketch_table_free(
+     frequency_sketch_table_t **table,
+     libcerror_error_t **error );
+
+int frequency_sketch_table_find_entry(
+     frequency_sketch_table_t *table,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     int *entry_index );
+
+void frequency_sketch_table_unlink_entry(
+      frequency_sketch_table_t *table,
+      int entry_index );
+
+int frequency_sketch_table_set_entry(
+     frequency_sketch_table_t *table,
+     int entry_index,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+void frequency_sketch_table_rebuild_buckets(
+      frequency_sketch_table_t *table );
+
+void frequency_sketch_table_heap_sift_up(
+      frequency_sketch_table_t *table,
+      int heap_index );
+
+void frequency_sketch_table_heap_sift_down(
+      frequency_sketch_table_t *table,
+      int heap_index );
+
+int frequency_sketch_compare_entry_keys(
+     const frequency_sketch_entry_t *first_entry,
+     const frequency_sketch_entry_t *second_entry );
+
+int frequency_sketch_compare_entries_by_ascending_count(
+     const frequency_sketch_entry_t *first_entry,
+     const frequency_sketch_entry_t *second_entry );
+
+int frequency_sketch_compare_entries_by_descending_count(
+     const frequency_sketch_entry_t *first_entry,
+     const frequency_sketch_entry_t *second_entry );
+
+int frequency_sketch_initialize(
+     frequency_sketch_t **frequency_sketch,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int frequency_sketch_free(
+     frequency_sketch_t **frequency_sketch,
+     libcerror_error_t **error );
+
+uint64_t frequency_sketch_count_min_update(
+          frequency_sketch_t *frequency_sketch,
+          uint64_t hash );
+
+uint64_t frequency_sketch_count_min_get_estimate(
+          frequency_sketch_t *frequency_sketch,
+          uint64_t hash );
+
+void frequency_sketch_hyperloglog_update(
+      frequency_sketch_t *frequency_sketch,
+      uint64_t hash );
+
+uint64_t frequency_sketch_hyperloglog_get_estimate(
+          frequency_sketch_t *frequency_sketch );
+
+int frequency_sketch_heavy_hitters_update(
+     frequency_sketch_t *frequency_sketch,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+void frequency_sketch_rare_candidates_refresh(
+      frequency_sketch_t *frequency_sketch );
+
+int frequency_sketch_rare_candidates_update(
+     frequency_sketch_t *frequency_sketch,
+     uint64_t hash,
+     const uint8_t *key,
+     size_t key_size,
+     uint64_t estimate,
+     libcerror_error_t **error );
+
+int frequency_sketch_append(
+     frequency_sketch_t *frequency_sketch,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+int frequency_sketch_get_number_of_distinct_keys(
+     frequency_sketch_t *frequency_sketch,
+     uint64_t *number_of_distinct_keys,
+     libcerror_error_t **error );
+
+int frequency_sketch_table_fprint(
+     frequency_sketch_table_t *table,
+     const char *description,
+     int number_of_entries,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FREQUENCY_SKETCH_H ) */
+
@@ -0,0 +1,2433 @@
+/*
+ * Gzip writer functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "gzip_writer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+
+/* The order in which the sizes of the code size codes are stored
+ */
+const uint8_t gzip_writer_code_size_code_order[ 19 ] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+/* The base lengths and number of extra bits of the length symbols 257 - 285
+ */
+const uint16_t gzip_writer_length_bases[ 29 ] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+
+const uint8_t gzip_writer_length_extra_bits[ 29 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+/* The base distances and number of extra bits of the distance symbols 0 - 29
+ */
+const uint16_t gzip_writer_distance_bases[ 30 ] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+
+const uint8_t gzip_writer_distance_extra_bits[ 30 ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/* The CRC-32 (polynomial 0xedb88320) of the values 0 - 15, used to calculate
+ * the CRC-32 a nibble at a time
+ */
+const uint32_t gzip_writer_crc32_nibble_table[ 16 ] = {
+	0x00000000UL, 0x1db71064UL, 0x3b6e20c8UL, 0x26d930acUL,
+	0x76dc4190UL, 0x6b6b51f4UL, 0x4db26158UL, 0x5005713cUL,
+	0xedb88320UL, 0xf00f9344UL, 0xd6d6a3e8UL, 0xcb61b38cUL,
+	0x9b64c2b0UL, 0x86d3d2d4UL, 0xa00ae278UL, 0xbdbdf21cUL };
+
+/* The maximum number of match candidates that are compared per compression level
+ */
+const uint16_t gzip_writer_maximum_chain_lengths[ 10 ] = {
+	0, 4, 8, 16, 32, 64, 128, 256, 1024, 4096 };
+
+/* The match length per compression level at which no further match candidates are compared
+ */
+const uint16_t gzip_writer_nice_match_lengths[ 10 ] = {
+	0, 8, 16, 32, 32, 64, 128, 128, 258, 258 };
+
+/* Creates a chunk
+ * Make sure the value chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_initialize(
+     gzip_writer_chunk_t **chunk,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_chunk_initialize";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compression level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk = memory_allocate_structure(
+	          gzip_writer_chunk_t );
+
+	if( *chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk,
+	     0,
+	     sizeof( gzip_writer_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk.",
+		 function );
+
+		memory_free(
+		 *chunk );
+
+		*chunk = NULL;
+
+		return( -1 );
+	}
+	( *chunk )->uncompressed_data = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * GZIP_WRITER_CHUNK_SIZE );
+
+	if( ( *chunk )->uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	/* A block is only compressed if the result is smaller than storing it
+	 * hence every block adds at most its header and the stored block size values
+	 */
+	( *chunk )->allocated_compressed_data_size = GZIP_WRITER_CHUNK_SIZE
+	                                           + ( ( GZIP_WRITER_CHUNK_SIZE / GZIP_WRITER_BLOCK_SIZE ) + 1 ) * 8
+	                                           + 32;
+
+	( *chunk )->compressed_data = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * ( *chunk )->allocated_compressed_data_size );
+
+	if( ( *chunk )->compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->hash_heads = (int32_t *) memory_allocate(
+	                                      sizeof( int32_t ) * GZIP_WRITER_HASH_TABLE_SIZE );
+
+	if( ( *chunk )->hash_heads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash heads.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->hash_chains = (int32_t *) memory_allocate(
+	                                       sizeof( int32_t ) * GZIP_WRITER_WINDOW_SIZE );
+
+	if( ( *chunk )->hash_chains == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chains.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->match_lengths = (uint16_t *) memory_allocate(
+	                                          sizeof( uint16_t ) * GZIP_WRITER_BLOCK_SIZE );
+
+	if( ( *chunk )->match_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create match lengths.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->match_distances = (uint16_t *) memory_allocate(
+	                                            sizeof( uint16_t ) * GZIP_WRITER_BLOCK_SIZE );
+
+	if( ( *chunk )->match_distances == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create match distances.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk )->compression_level = compression_level;
+
+	return( 1 );
+
+on_error:
+	if( *chunk != NULL )
+	{
+		gzip_writer_chunk_free(
+		 chunk,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a chunk
+ * The chunk must not be pending
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_free(
+     gzip_writer_chunk_t **chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_chunk_free";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk != NULL )
+	{
+		if( ( *chunk )->match_distances != NULL )
+		{
+			memory_free(
+			 ( *chunk )->match_distances );
+		}
+		if( ( *chunk )->match_lengths != NULL )
+		{
+			memory_free(
+			 ( *chunk )->match_lengths );
+		}
+		if( ( *chunk )->hash_chains != NULL )
+		{
+			memory_free(
+			 ( *chunk )->hash_chains );
+		}
+		if( ( *chunk )->hash_heads != NULL )
+		{
+			memory_free(
+			 ( *chunk )->hash_heads );
+		}
+		if( ( *chunk )->compressed_data != NULL )
+		{
+			memory_free(
+			 ( *chunk )->compressed_data );
+		}
+		if( ( *chunk )->uncompressed_data != NULL )
+		{
+			memory_free(
+			 ( *chunk )->uncompressed_data );
+		}
+		if( ( *chunk )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *chunk )->error ) );
+		}
+		memory_free(
+		 *chunk );
+
+		*chunk = NULL;
+	}
+	return( 1 );
+}
+
+/* Writes bits to the compressed data
+ * The bits are written from the least significant bit of every byte onwards
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_write_bits(
+     gzip_writer_chunk_t *chunk,
+     uint32_t value,
+     uint8_t number_of_bits,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_chunk_write_bits";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bits > 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of bits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->bit_buffer     |= ( value & ( ( (uint32_t) 1 << number_of_bits ) - 1 ) ) << chunk->number_of_bits;
+	chunk->number_of_bits += number_of_bits;
+
+	while( chunk->number_of_bits >= 8 )
+	{
+		if( chunk->compressed_data_size >= chunk->allocated_compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->compressed_data[ chunk->compressed_data_size++ ] = (uint8_t) ( chunk->bit_buffer & 0xff );
+
+		chunk->bit_buffer    >>= 8;
+		chunk->number_of_bits -= 8;
+	}
+	return( 1 );
+}
+
+/* Pads the compressed data with 0-bits up to the next byte boundary
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_align_to_byte(
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_chunk_align_to_byte";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->number_of_bits > 0 )
+	{
+		if( gzip_writer_chunk_write_bits(
+		     chunk,
+		     0,
+		     8 - chunk->number_of_bits,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write padding bits.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Builds the sizes of the Huffman codes of symbols from their frequencies
+ * The code sizes are limited to the maximum code size by repeatedly halving the
+ * frequencies. At least 2 symbols are assigned a code so that the code is complete
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_build_code_sizes(
+     const uint32_t *frequencies,
+     uint16_t number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error )
+{
+	uint32_t node_frequencies[ 2 * GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint32_t scaled_frequencies[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint16_t node_depths[ 2 * GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint16_t node_parents[ 2 * GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint16_t leaf_symbols[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+
+	static char *function        = "gzip_writer_build_code_sizes";
+	uint32_t node_frequency      = 0;
+	uint16_t internal_node_index = 0;
+	uint16_t leaf_index          = 0;
+	uint16_t maximum_depth       = 0;
+	uint16_t node_index          = 0;
+	uint16_t number_of_leaves    = 0;
+	uint16_t number_of_nodes     = 0;
+	uint16_t smallest_node_index = 0;
+	uint16_t symbol              = 0;
+	int node_iterator            = 0;
+
+	if( frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbols < 2 )
+	 || ( number_of_symbols > GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_code_size < 1 )
+	 || ( maximum_code_size > GZIP_WRITER_MAXIMUM_CODE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_sizes[ symbol ]         = 0;
+		scaled_frequencies[ symbol ] = frequencies[ symbol ];
+	}
+	do
+	{
+		/* The leaves are sorted by frequency
+		 */
+		number_of_leaves = 0;
+
+		for( symbol = 0;
+		     symbol < number_of_symbols;
+		     symbol++ )
+		{
+			if( scaled_frequencies[ symbol ] == 0 )
+			{
+				continue;
+			}
+			leaf_index = number_of_leaves;
+
+			while( ( leaf_index > 0 )
+			    && ( node_frequencies[ leaf_index - 1 ] > scaled_frequencies[ symbol ] ) )
+			{
+				node_frequencies[ leaf_index ] = node_frequencies[ leaf_index - 1 ];
+				leaf_symbols[ leaf_index ]     = leaf_symbols[ leaf_index - 1 ];
+
+				leaf_index--;
+			}
+			node_frequencies[ leaf_index ] = scaled_frequencies[ symbol ];
+			leaf_symbols[ leaf_index ]     = symbol;
+
+			number_of_leaves++;
+		}
+		if( number_of_leaves < 2 )
+		{
+			if( number_of_leaves == 0 )
+			{
+				code_sizes[ 0 ] = 1;
+				code_sizes[ 1 ] = 1;
+			}
+			else
+			{
+				symbol = leaf_symbols[ 0 ];
+
+				code_sizes[ symbol ] = 1;
+
+				if( symbol == 0 )
+				{
+					code_sizes[ 1 ] = 1;
+				}
+				else
+				{
+					code_sizes[ 0 ] = 1;
+				}
+			}
+			return( 1 );
+		}
+		/* The internal nodes are created in order of frequency hence the 2 nodes
+		 * with the smallest frequency are at the start of either the leaves or
+		 * the internal nodes that were not yet combined
+		 */
+		leaf_index          = 0;
+		internal_node_index = number_of_leaves;
+		number_of_nodes     = number_of_leaves;
+
+		while( number_of_nodes < ( ( 2 * number_of_leaves ) - 1 ) )
+		{
+			node_frequency = 0;
+
+			for( node_iterator = 0;
+			     node_iterator < 2;
+			     node_iterator++ )
+			{
+				if( ( leaf_index < number_of_leaves )
+				 && ( ( internal_node_index >= number_of_nodes )
+				  || ( node_frequencies[ leaf_index ] <= node_frequencies[ internal_node_index ] ) ) )
+				{
+					smallest_node_index = leaf_index++;
+				}
+				else
+				{
+					smallest_node_index = internal_node_index++;
+				}
+				node_frequency                     += node_frequencies[ smallest_node_index ];
+				node_parents[ smallest_node_index ] = number_of_nodes;
+			}
+			node_frequencies[ number_of_nodes++ ] = node_frequency;
+		}
+		/* The parent of a node is always created after the node
+		 */
+		node_index = number_of_nodes - 1;
+
+		node_depths[ node_index ] = 0;
+		maximum_depth             = 0;
+
+		while( node_index > 0 )
+		{
+			node_index--;
+
+			node_depths[ node_index ] = node_depths[ node_parents[ node_index ] ] + 1;
+
+			if( node_depths[ node_index ] > maximum_depth )
+			{
+				maximum_depth = node_depths[ node_index ];
+			}
+		}
+		if( maximum_depth <= maximum_code_size )
+		{
+			break;
+		}
+		for( symbol = 0;
+		     symbol < number_of_symbols;
+		     symbol++ )
+		{
+			if( scaled_frequencies[ symbol ] != 0 )
+			{
+				scaled_frequencies[ symbol ] = ( scaled_frequencies[ symbol ] >> 1 ) | 1;
+			}
+		}
+	}
+	while( maximum_depth > maximum_code_size );
+
+	for( leaf_index = 0;
+	     leaf_index < number_of_leaves;
+	     leaf_index++ )
+	{
+		code_sizes[ leaf_symbols[ leaf_index ] ] = (uint8_t) node_depths[ leaf_index ];
+	}
+	return( 1 );
+}
+
+/* Builds the canonical Huffman codes of symbols from their code sizes
+ * The bits of the codes are reversed so that they can be written least significant bit first
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_build_codes(
+     const uint8_t *code_sizes,
+     uint16_t number_of_symbols,
+     uint16_t *codes,
+     libcerror_error_t **error )
+{
+	uint16_t code_size_counts[ GZIP_WRITER_MAXIMUM_CODE_SIZE + 1 ];
+	uint16_t next_codes[ GZIP_WRITER_MAXIMUM_CODE_SIZE + 1 ];
+
+	static char *function = "gzip_writer_build_codes";
+	uint16_t code         = 0;
+	uint16_t reversed     = 0;
+	uint16_t symbol       = 0;
+	uint8_t bit_index     = 0;
+	uint8_t code_size     = 0;
+
+	if( code_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( codes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( uint16_t ) * ( GZIP_WRITER_MAXIMUM_CODE_SIZE + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		if( code_sizes[ symbol ] > GZIP_WRITER_MAXIMUM_CODE_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid code size: %" PRIu16 " value out of bounds.",
+			 function,
+			 symbol );
+
+			return( -1 );
+		}
+		code_size_counts[ code_sizes[ symbol ] ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+
+	for( code_size = 1;
+	     code_size <= GZIP_WRITER_MAXIMUM_CODE_SIZE;
+	     code_size++ )
+	{
+		code = ( code + code_size_counts[ code_size - 1 ] ) << 1;
+
+		next_codes[ code_size ] = code;
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		code_size = code_sizes[ symbol ];
+
+		codes[ symbol ] = 0;
+
+		if( code_size == 0 )
+		{
+			continue;
+		}
+		code     = next_codes[ code_size ]++;
+		reversed = 0;
+
+		for( bit_index = 0;
+		     bit_index < code_size;
+		     bit_index++ )
+		{
+			reversed = ( reversed << 1 ) | ( code & 1 );
+			code   >>= 1;
+		}
+		codes[ symbol ] = reversed;
+	}
+	return( 1 );
+}
+
+/* Calculates the CRC-32 of data, as used by gzip
+ * The calculation continues from a previous CRC-32, which is 0 for the first data
+ * Returns the CRC-32
+ */
+uint32_t gzip_writer_calculate_crc32(
+          uint32_t crc32,
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset = 0;
+
+	if( data == NULL )
+	{
+		return( crc32 );
+	}
+	crc32 = ~crc32;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		crc32 ^= data[ data_offset ];
+		crc32  = ( crc32 >> 4 ) ^ gzip_writer_crc32_nibble_table[ crc32 & 0x0f ];
+		crc32  = ( crc32 >> 4 ) ^ gzip_writer_crc32_nibble_table[ crc32 & 0x0f ];
+	}
+	return( ~crc32 );
+}
+
+/* Determines the code of a match length, the length symbol is the code + 257
+ * Returns the code
+ */
+uint8_t gzip_writer_get_length_code(
+         uint16_t match_length )
+{
+	uint8_t length_code = 28;
+
+	while( ( length_code > 0 )
+	    && ( match_length < gzip_writer_length_bases[ length_code ] ) )
+	{
+		length_code--;
+	}
+	return( length_code );
+}
+
+/* Determines the code of a match distance, which is also the distance symbol
+ * Returns the code
+ */
+uint8_t gzip_writer_get_distance_code(
+         uint16_t match_distance )
+{
+	uint8_t distance_code = 29;
+
+	while( ( distance_code > 0 )
+	    && ( match_distance < gzip_writer_distance_bases[ distance_code ] ) )
+	{
+		distance_code--;
+	}
+	return( distance_code );
+}
+
+/* Finds the matches of a block of the uncompressed data
+ * Every symbol is stored as a match length and distance, where a match length
+ * of 0 represents a literal that is stored as the distance. Matches can refer to
+ * the data of previous blocks in the chunk but do not extend beyond the block
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_find_matches(
+     gzip_writer_chunk_t *chunk,
+     size_t block_offset,
+     size_t block_size,
+     size_t *number_of_symbols,
+     libcerror_error_t **error )
+{
+	static char *function         = "gzip_writer_chunk_find_matches";
+	size_t block_end_offset       = 0;
+	size_t data_offset            = 0;
+	size_t insert_offset          = 0;
+	size_t maximum_match_length   = 0;
+	size_t match_length           = 0;
+	size_t symbol_index           = 0;
+	uint32_t hash                 = 0;
+	uint16_t chain_length         = 0;
+	uint16_t match_distance       = 0;
+	uint16_t nice_match_length    = 0;
+	int32_t candidate_offset      = 0;
+	int32_t next_candidate_offset = 0;
+	size_t candidate_length       = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size > GZIP_WRITER_BLOCK_SIZE )
+	 || ( block_offset > chunk->uncompressed_data_size )
+	 || ( block_size > ( chunk->uncompressed_data_size - block_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_symbols == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of symbols.",
+		 function );
+
+		return( -1 );
+	}
+	block_end_offset  = block_offset + block_size;
+	nice_match_length = gzip_writer_nice_match_lengths[ chunk->compression_level ];
+	data_offset       = block_offset;
+
+	while( data_offset < block_end_offset )
+	{
+		match_length   = 0;
+		match_distance = 0;
+
+		if( ( block_end_offset - data_offset ) >= GZIP_WRITER_MINIMUM_MATCH_LENGTH )
+		{
+			maximum_match_length = block_end_offset - data_offset;
+
+			if( maximum_match_length > GZIP_WRITER_MAXIMUM_MATCH_LENGTH )
+			{
+				maximum_match_length = GZIP_WRITER_MAXIMUM_MATCH_LENGTH;
+			}
+			hash             = GZIP_WRITER_HASH( &( chunk->uncompressed_data[ data_offset ] ) );
+			candidate_offset = chunk->hash_heads[ hash ];
+			chain_length     = gzip_writer_maximum_chain_lengths[ chunk->compression_level ];
+
+			while( ( candidate_offset >= 0 )
+			    && ( chain_length > 0 )
+			    && ( ( data_offset - (size_t) candidate_offset ) <= GZIP_WRITER_WINDOW_SIZE ) )
+			{
+				/* Only candidates that can be longer than the current match are compared
+				 */
+				if( chunk->uncompressed_data[ (size_t) candidate_offset + match_length ] == chunk->uncompressed_data[ data_offset + match_length ] )
+				{
+					candidate_length = 0;
+
+					while( ( candidate_length < maximum_match_length )
+					    && ( chunk->uncompressed_data[ (size_t) candidate_offset + candidate_length ] == chunk->uncompressed_data[ data_offset + candidate_length ] ) )
+					{
+						candidate_length++;
+					}
+					if( candidate_length > match_length )
+					{
+						match_length   = candidate_length;
+						match_distance = (uint16_t) ( data_offset - (size_t) candidate_offset );
+
+						if( ( match_length >= nice_match_length )
+						 || ( match_length >= maximum_match_length ) )
+						{
+							break;
+						}
+					}
+				}
+				/* A chain entry that is not before the candidate was overwritten by a more recent position
+				 */
+				next_candidate_offset = chunk->hash_chains[ candidate_offset & ( GZIP_WRITER_WINDOW_SIZE - 1 ) ];
+
+				if( next_candidate_offset >= candidate_offset )
+				{
+					break;
+				}
+				candidate_offset = next_candidate_offset;
+
+				chain_length--;
+			}
+			chunk->hash_chains[ data_offset & ( GZIP_WRITER_WINDOW_SIZE - 1 ) ] = chunk->hash_heads[ hash ];
+			chunk->hash_heads[ hash ]                                          = (int32_t) data_offset;
+		}
+		if( match_length >= GZIP_WRITER_MINIMUM_MATCH_LENGTH )
+		{
+			chunk->match_lengths[ symbol_index ]   = (uint16_t) match_length;
+			chunk->match_distances[ symbol_index ] = match_distance;
+
+			for( insert_offset = data_offset + 1;
+			     insert_offset < ( data_offset + match_length );
+			     insert_offset++ )
+			{
+				if( ( chunk->uncompressed_data_size - insert_offset ) < GZIP_WRITER_MINIMUM_MATCH_LENGTH )
+				{
+					break;
+				}
+				hash = GZIP_WRITER_HASH( &( chunk->uncompressed_data[ insert_offset ] ) );
+
+				chunk->hash_chains[ insert_offset & ( GZIP_WRITER_WINDOW_SIZE - 1 ) ] = chunk->hash_heads[ hash ];
+				chunk->hash_heads[ hash ]                                            = (int32_t) insert_offset;
+			}
+			data_offset += match_length;
+		}
+		else
+		{
+			chunk->match_lengths[ symbol_index ]   = 0;
+			chunk->match_distances[ symbol_index ] = chunk->uncompressed_data[ data_offset ];
+
+			data_offset += 1;
+		}
+		symbol_index++;
+	}
+	*number_of_symbols = symbol_index;
+
+	return( 1 );
+}
+
+/* Writes a block of the uncompressed data as a stored block
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_write_stored_block(
+     gzip_writer_chunk_t *chunk,
+     size_t block_offset,
+     size_t block_size,
+     uint8_t is_last_block,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_chunk_write_stored_block";
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size > GZIP_WRITER_BLOCK_SIZE )
+	 || ( block_offset > chunk->uncompressed_data_size )
+	 || ( block_size > ( chunk->uncompressed_data_size - block_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) is_last_block,
+	       1,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       0,
+	       2,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_align_to_byte(
+	       chunk,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) block_size,
+	       16,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) ~block_size,
+	       16,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write stored block header.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size > ( chunk->allocated_compressed_data_size - chunk->compressed_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( chunk->compressed_data[ chunk->compressed_data_size ] ),
+	     &( chunk->uncompressed_data[ block_offset ] ),
+	     block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy stored block data.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->compressed_data_size += block_size;
+
+	return( 1 );
+}
+
+/* Writes a block of the uncompressed data as a block with dynamic Huffman codes
+ * The block is stored instead if that is smaller
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_write_block(
+     gzip_writer_chunk_t *chunk,
+     size_t block_offset,
+     size_t block_size,
+     uint8_t is_last_block,
+     libcerror_error_t **error )
+{
+	uint32_t code_size_frequencies[ GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS ];
+	uint32_t distance_frequencies[ GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ];
+	uint32_t literal_frequencies[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint16_t code_size_codes[ GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS ];
+	uint16_t distance_codes[ GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ];
+	uint16_t literal_codes[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint8_t code_size_code_sizes[ GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS ];
+	uint8_t code_size_symbols[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS + GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ];
+	uint8_t code_size_values[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS + GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ];
+	uint8_t code_sizes[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS + GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ];
+	uint8_t distance_code_sizes[ GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ];
+	uint8_t literal_code_sizes[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+
+	static char *function                 = "gzip_writer_chunk_write_block";
+	size_t number_of_symbols              = 0;
+	size_t symbol_index                   = 0;
+	uint64_t number_of_bits               = 0;
+	uint64_t number_of_stored_bits        = 0;
+	uint16_t code_size_index              = 0;
+	uint16_t match_length                 = 0;
+	uint16_t match_distance               = 0;
+	uint16_t number_of_code_size_codes    = 0;
+	uint16_t number_of_code_size_symbols  = 0;
+	uint16_t number_of_code_sizes         = 0;
+	uint16_t number_of_distance_codes     = 0;
+	uint16_t number_of_literal_codes      = 0;
+	uint16_t run_length                   = 0;
+	uint16_t repeat_length                = 0;
+	uint8_t code_size                     = 0;
+	uint8_t code_size_symbol              = 0;
+	uint8_t distance_code                 = 0;
+	uint8_t length_code                   = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->compression_level == 0 )
+	{
+		return( gzip_writer_chunk_write_stored_block(
+		         chunk,
+		         block_offset,
+		         block_size,
+		         is_last_block,
+		         error ) );
+	}
+	if( gzip_writer_chunk_find_matches(
+	     chunk,
+	     block_offset,
+	     block_size,
+	     &number_of_symbols,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to find matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_set(
+	       literal_frequencies,
+	       0,
+	       sizeof( uint32_t ) * GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ) == NULL )
+	 || ( memory_set(
+	       distance_frequencies,
+	       0,
+	       sizeof( uint32_t ) * GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS ) == NULL )
+	 || ( memory_set(
+	       code_size_frequencies,
+	       0,
+	       sizeof( uint32_t ) * GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		match_length   = chunk->match_lengths[ symbol_index ];
+		match_distance = chunk->match_distances[ symbol_index ];
+
+		if( match_length == 0 )
+		{
+			literal_frequencies[ match_distance ] += 1;
+		}
+		else
+		{
+			literal_frequencies[ 257 + gzip_writer_get_length_code( match_length ) ] += 1;
+			distance_frequencies[ gzip_writer_get_distance_code( match_distance ) ]  += 1;
+		}
+	}
+	/* The end-of-block symbol
+	 */
+	literal_frequencies[ 256 ] = 1;
+
+	if( ( gzip_writer_build_code_sizes(
+	       literal_frequencies,
+	       GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS,
+	       GZIP_WRITER_MAXIMUM_CODE_SIZE,
+	       literal_code_sizes,
+	       error ) != 1 )
+	 || ( gzip_writer_build_code_sizes(
+	       distance_frequencies,
+	       GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS,
+	       GZIP_WRITER_MAXIMUM_CODE_SIZE,
+	       distance_code_sizes,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_literal_codes = GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS;
+
+	while( ( number_of_literal_codes > 257 )
+	    && ( literal_code_sizes[ number_of_literal_codes - 1 ] == 0 ) )
+	{
+		number_of_literal_codes--;
+	}
+	number_of_distance_codes = GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS;
+
+	while( ( number_of_distance_codes > 1 )
+	    && ( distance_code_sizes[ number_of_distance_codes - 1 ] == 0 ) )
+	{
+		number_of_distance_codes--;
+	}
+	/* The literal and distance code sizes are stored as a single sequence
+	 * where runs of code sizes are stored as repeat symbols 16, 17 and 18
+	 */
+	if( ( memory_copy(
+	       code_sizes,
+	       literal_code_sizes,
+	       number_of_literal_codes ) == NULL )
+	 || ( memory_copy(
+	       &( code_sizes[ number_of_literal_codes ] ),
+	       distance_code_sizes,
+	       number_of_distance_codes ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_code_sizes = number_of_literal_codes + number_of_distance_codes;
+	code_size_index      = 0;
+
+	while( code_size_index < number_of_code_sizes )
+	{
+		code_size  = code_sizes[ code_size_index ];
+		run_length = 1;
+
+		while( ( ( code_size_index + run_length ) < number_of_code_sizes )
+		    && ( code_sizes[ code_size_index + run_length ] == code_size ) )
+		{
+			run_length++;
+		}
+		code_size_index += run_length;
+
+		if( code_size != 0 )
+		{
+			code_size_symbols[ number_of_code_size_symbols ] = code_size;
+			code_size_values[ number_of_code_size_symbols ]  = 0;
+
+			number_of_code_size_symbols++;
+
+			run_length--;
+
+			while( run_length >= 3 )
+			{
+				repeat_length = ( run_length < 6 ) ? run_length : 6;
+
+				code_size_symbols[ number_of_code_size_symbols ] = 16;
+				code_size_values[ number_of_code_size_symbols ]  = (uint8_t) ( repeat_length - 3 );
+
+				number_of_code_size_symbols++;
+
+				run_length -= repeat_length;
+			}
+		}
+		else
+		{
+			while( run_length >= 11 )
+			{
+				repeat_length = ( run_length < 138 ) ? run_length : 138;
+
+				code_size_symbols[ number_of_code_size_symbols ] = 18;
+				code_size_values[ number_of_code_size_symbols ]  = (uint8_t) ( repeat_length - 11 );
+
+				number_of_code_size_symbols++;
+
+				run_length -= repeat_length;
+			}
+			if( run_length >= 3 )
+			{
+				code_size_symbols[ number_of_code_size_symbols ] = 17;
+				code_size_values[ number_of_code_size_symbols ]  = (uint8_t) ( run_length - 3 );
+
+				number_of_code_size_symbols++;
+
+				run_length = 0;
+			}
+		}
+		while( run_length > 0 )
+		{
+			code_size_symbols[ number_of_code_size_symbols ] = code_size;
+			code_size_values[ number_of_code_size_symbols ]  = 0;
+
+			number_of_code_size_symbols++;
+
+			run_length--;
+		}
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_size_symbols;
+	     code_size_index++ )
+	{
+		code_size_frequencies[ code_size_symbols[ code_size_index ] ] += 1;
+	}
+	if( gzip_writer_build_code_sizes(
+	     code_size_frequencies,
+	     GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS,
+	     7,
+	     code_size_code_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build code size code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_code_size_codes = GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS;
+
+	while( ( number_of_code_size_codes > 4 )
+	    && ( code_size_code_sizes[ gzip_writer_code_size_code_order[ number_of_code_size_codes - 1 ] ] == 0 ) )
+	{
+		number_of_code_size_codes--;
+	}
+	/* Determine the size of the block to compare it with the size of a stored block
+	 */
+	number_of_bits = 3 + 5 + 5 + 4 + ( 3 * (uint64_t) number_of_code_size_codes );
+
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_size_symbols;
+	     code_size_index++ )
+	{
+		code_size_symbol = code_size_symbols[ code_size_index ];
+
+		number_of_bits += code_size_code_sizes[ code_size_symbol ];
+
+		if( code_size_symbol == 16 )
+		{
+			number_of_bits += 2;
+		}
+		else if( code_size_symbol == 17 )
+		{
+			number_of_bits += 3;
+		}
+		else if( code_size_symbol == 18 )
+		{
+			number_of_bits += 7;
+		}
+	}
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		match_length   = chunk->match_lengths[ symbol_index ];
+		match_distance = chunk->match_distances[ symbol_index ];
+
+		if( match_length == 0 )
+		{
+			number_of_bits += literal_code_sizes[ match_distance ];
+		}
+		else
+		{
+			length_code   = gzip_writer_get_length_code( match_length );
+			distance_code = gzip_writer_get_distance_code( match_distance );
+
+			number_of_bits += literal_code_sizes[ 257 + length_code ]
+			                + gzip_writer_length_extra_bits[ length_code ]
+			                + distance_code_sizes[ distance_code ]
+			                + gzip_writer_distance_extra_bits[ distance_code ];
+		}
+	}
+	number_of_bits += literal_code_sizes[ 256 ];
+
+	/* The stored block size includes the maximum number of padding bits
+	 */
+	number_of_stored_bits = 3 + 7 + 32 + ( 8 * (uint64_t) block_size );
+
+	if( number_of_bits >= number_of_stored_bits )
+	{
+		return( gzip_writer_chunk_write_stored_block(
+		         chunk,
+		         block_offset,
+		         block_size,
+		         is_last_block,
+		         error ) );
+	}
+	if( ( gzip_writer_build_codes(
+	       literal_code_sizes,
+	       GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS,
+	       literal_codes,
+	       error ) != 1 )
+	 || ( gzip_writer_build_codes(
+	       distance_code_sizes,
+	       GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS,
+	       distance_codes,
+	       error ) != 1 )
+	 || ( gzip_writer_build_codes(
+	       code_size_code_sizes,
+	       GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS,
+	       code_size_codes,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build codes.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) is_last_block,
+	       1,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       2,
+	       2,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) ( number_of_literal_codes - 257 ),
+	       5,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) ( number_of_distance_codes - 1 ),
+	       5,
+	       error ) != 1 )
+	 || ( gzip_writer_chunk_write_bits(
+	       chunk,
+	       (uint32_t) ( number_of_code_size_codes - 4 ),
+	       4,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block header.",
+		 function );
+
+		return( -1 );
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_size_codes;
+	     code_size_index++ )
+	{
+		if( gzip_writer_chunk_write_bits(
+		     chunk,
+		     code_size_code_sizes[ gzip_writer_code_size_code_order[ code_size_index ] ],
+		     3,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write code size code size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_size_symbols;
+	     code_size_index++ )
+	{
+		code_size_symbol = code_size_symbols[ code_size_index ];
+
+		if( gzip_writer_chunk_write_bits(
+		     chunk,
+		     code_size_codes[ code_size_symbol ],
+		     code_size_code_sizes[ code_size_symbol ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write code size.",
+			 function );
+
+			return( -1 );
+		}
+		if( code_size_symbol >= 16 )
+		{
+			if( code_size_symbol == 16 )
+			{
+				code_size = 2;
+			}
+			else if( code_size_symbol == 17 )
+			{
+				code_size = 3;
+			}
+			else
+			{
+				code_size = 7;
+			}
+			if( gzip_writer_chunk_write_bits(
+			     chunk,
+			     code_size_values[ code_size_index ],
+			     code_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write code size repeat length.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	for( symbol_index = 0;
+	     symbol_index < number_of_symbols;
+	     symbol_index++ )
+	{
+		match_length   = chunk->match_lengths[ symbol_index ];
+		match_distance = chunk->match_distances[ symbol_index ];
+
+		if( match_length == 0 )
+		{
+			if( gzip_writer_chunk_write_bits(
+			     chunk,
+			     literal_codes[ match_distance ],
+			     literal_code_sizes[ match_distance ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write literal.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		length_code   = gzip_writer_get_length_code( match_length );
+		distance_code = gzip_writer_get_distance_code( match_distance );
+
+		if( ( gzip_writer_chunk_write_bits(
+		       chunk,
+		       literal_codes[ 257 + length_code ],
+		       literal_code_sizes[ 257 + length_code ],
+		       error ) != 1 )
+		 || ( gzip_writer_chunk_write_bits(
+		       chunk,
+		       (uint32_t) ( match_length - gzip_writer_length_bases[ length_code ] ),
+		       gzip_writer_length_extra_bits[ length_code ],
+		       error ) != 1 )
+		 || ( gzip_writer_chunk_write_bits(
+		       chunk,
+		       distance_codes[ distance_code ],
+		       distance_code_sizes[ distance_code ],
+		       error ) != 1 )
+		 || ( gzip_writer_chunk_write_bits(
+		       chunk,
+		       (uint32_t) ( match_distance - gzip_writer_distance_bases[ distance_code ] ),
+		       gzip_writer_distance_extra_bits[ distance_code ],
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write match.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( gzip_writer_chunk_write_bits(
+	     chunk,
+	     literal_codes[ 256 ],
+	     literal_code_sizes[ 256 ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write end-of-block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses the uncompressed data of a chunk into a gzip member (RFC 1952)
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_compress(
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_chunk_compress";
+	size_t block_offset   = 0;
+	size_t block_size     = 0;
+	uint32_t crc32        = 0;
+	uint8_t is_last_block = 0;
+
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_set(
+	       chunk->hash_heads,
+	       0xff,
+	       sizeof( int32_t ) * GZIP_WRITER_HASH_TABLE_SIZE ) == NULL )
+	 || ( memory_set(
+	       chunk->hash_chains,
+	       0xff,
+	       sizeof( int32_t ) * GZIP_WRITER_WINDOW_SIZE ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The member header contains no optional fields and no modification time
+	 * the operating system is set to unknown
+	 */
+	chunk->compressed_data[ 0 ] = 0x1f;
+	chunk->compressed_data[ 1 ] = 0x8b;
+	chunk->compressed_data[ 2 ] = 0x08;
+	chunk->compressed_data[ 3 ] = 0x00;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->compressed_data[ 4 ] ),
+	 0 );
+
+	if( chunk->compression_level == 9 )
+	{
+		chunk->compressed_data[ 8 ] = 0x02;
+	}
+	else if( chunk->compression_level == 1 )
+	{
+		chunk->compressed_data[ 8 ] = 0x04;
+	}
+	else
+	{
+		chunk->compressed_data[ 8 ] = 0x00;
+	}
+	chunk->compressed_data[ 9 ] = 0xff;
+
+	chunk->compressed_data_size = 10;
+	chunk->bit_buffer           = 0;
+	chunk->number_of_bits       = 0;
+
+	do
+	{
+		block_size = chunk->uncompressed_data_size - block_offset;
+
+		if( block_size > GZIP_WRITER_BLOCK_SIZE )
+		{
+			block_size = GZIP_WRITER_BLOCK_SIZE;
+		}
+		if( ( block_offset + block_size ) >= chunk->uncompressed_data_size )
+		{
+			is_last_block = 1;
+		}
+		if( gzip_writer_chunk_write_block(
+		     chunk,
+		     block_offset,
+		     block_size,
+		     is_last_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write block at offset: %" PRIzd ".",
+			 function,
+			 block_offset );
+
+			return( -1 );
+		}
+		block_offset += block_size;
+	}
+	while( is_last_block == 0 );
+
+	if( gzip_writer_chunk_align_to_byte(
+	     chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to align compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk->allocated_compressed_data_size - chunk->compressed_data_size ) < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	crc32 = gzip_writer_calculate_crc32(
+	         0,
+	         chunk->uncompressed_data,
+	         chunk->uncompressed_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->compressed_data[ chunk->compressed_data_size ] ),
+	 crc32 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk->compressed_data[ chunk->compressed_data_size + 4 ] ),
+	 (uint32_t) chunk->uncompressed_data_size );
+
+	chunk->compressed_data_size += 8;
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of a compression thread
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_chunk_thread_callback(
+     gzip_writer_chunk_t *chunk )
+{
+	if( chunk == NULL )
+	{
+		return( -1 );
+	}
+	chunk->result = gzip_writer_chunk_compress(
+	                 chunk,
+	                 &( chunk->error ) );
+
+	return( chunk->result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Creates a gzip writer
+ * Make sure the value gzip_writer is referencing, is set to NULL
+ * The data is written to the stream as consecutive gzip members of at most GZIP_WRITER_CHUNK_SIZE
+ * bytes of uncompressed data each, which are compressed by the compression threads
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_initialize(
+     gzip_writer_t **gzip_writer,
+     FILE *stream,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_initialize";
+	int chunk_index       = 0;
+
+	if( gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *gzip_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid gzip writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < 0 )
+	 || ( compression_level > 9 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compression level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > GZIP_WRITER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*gzip_writer = memory_allocate_structure(
+	                gzip_writer_t );
+
+	if( *gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create gzip writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *gzip_writer,
+	     0,
+	     sizeof( gzip_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear gzip writer.",
+		 function );
+
+		memory_free(
+		 *gzip_writer );
+
+		*gzip_writer = NULL;
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_threads = 0;
+#endif
+	/* One chunk is filled while the other chunks are compressed
+	 */
+	( *gzip_writer )->number_of_chunks = number_of_threads + 1;
+
+	( *gzip_writer )->chunks = (gzip_writer_chunk_t **) memory_allocate(
+	                                                     sizeof( gzip_writer_chunk_t * ) * ( *gzip_writer )->number_of_chunks );
+
+	if( ( *gzip_writer )->chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *gzip_writer )->chunks,
+	     0,
+	     sizeof( gzip_writer_chunk_t * ) * ( *gzip_writer )->number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunks.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < ( *gzip_writer )->number_of_chunks;
+	     chunk_index++ )
+	{
+		if( gzip_writer_chunk_initialize(
+		     &( ( *gzip_writer )->chunks[ chunk_index ] ),
+		     compression_level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	( *gzip_writer )->stream            = stream;
+	( *gzip_writer )->compression_level = compression_level;
+	( *gzip_writer )->number_of_threads = number_of_threads;
+
+	return( 1 );
+
+on_error:
+	if( *gzip_writer != NULL )
+	{
+		gzip_writer_free(
+		 gzip_writer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a gzip writer
+ * Data that was not written by gzip_writer_close is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_free(
+     gzip_writer_t **gzip_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_free";
+	int chunk_index       = 0;
+	int result            = 1;
+
+	if( gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *gzip_writer != NULL )
+	{
+		if( ( *gzip_writer )->chunks != NULL )
+		{
+			for( chunk_index = 0;
+			     chunk_index < ( *gzip_writer )->number_of_chunks;
+			     chunk_index++ )
+			{
+				if( ( *gzip_writer )->chunks[ chunk_index ] == NULL )
+				{
+					continue;
+				}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+				/* Wait for a pending compression thread before its chunk is freed
+				 */
+				if( ( *gzip_writer )->chunks[ chunk_index ]->thread != NULL )
+				{
+					if( libcthreads_thread_join(
+					     &( ( *gzip_writer )->chunks[ chunk_index ]->thread ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to join compression thread: %d.",
+						 function,
+						 chunk_index );
+
+						result = -1;
+
+						continue;
+					}
+				}
+#endif
+				if( gzip_writer_chunk_free(
+				     &( ( *gzip_writer )->chunks[ chunk_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free chunk: %d.",
+					 function,
+					 chunk_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *gzip_writer )->chunks );
+		}
+		memory_free(
+		 *gzip_writer );
+
+		*gzip_writer = NULL;
+	}
+	return( result );
+}
+
+/* Starts compressing a chunk
+ * Without compression threads the chunk is compressed in the calling thread
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_start_chunk(
+     gzip_writer_t *gzip_writer,
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_start_chunk";
+
+	if( gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->is_pending != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk - already pending.",
+		 function );
+
+		return( -1 );
+	}
+	chunk->is_pending = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( gzip_writer->number_of_threads > 0 )
+	{
+		if( libcthreads_thread_create(
+		     &( chunk->thread ),
+		     NULL,
+		     (int (*)(void *)) &gzip_writer_chunk_thread_callback,
+		     (void *) chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create compression thread.",
+			 function );
+
+			chunk->is_pending = 0;
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	chunk->result = gzip_writer_chunk_compress(
+	                 chunk,
+	                 &( chunk->error ) );
+
+	return( 1 );
+}
+
+/* Waits for a pending chunk to be compressed and writes its gzip member to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_finish_chunk(
+     gzip_writer_t *gzip_writer,
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "gzip_writer_finish_chunk";
+	size_t write_count    = 0;
+
+	if( gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk->is_pending == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( chunk->thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( chunk->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join compression thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	chunk->is_pending             = 0;
+	chunk->uncompressed_data_size = 0;
+
+	if( chunk->result != 1 )
+	{
+		/* Hand over the error of the compression to the caller
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = chunk->error;
+
+			chunk->error = NULL;
+		}
+		else if( chunk->error != NULL )
+		{
+			libcerror_error_free(
+			 &( chunk->error ) );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compress chunk.",
+		 function );
+
+		chunk->result = 1;
+
+		return( -1 );
+	}
+	write_count = fwrite(
+	               chunk->compressed_data,
+	               1,
+	               chunk->compressed_data_size,
+	               gzip_writer->stream );
+
+	if( write_count != chunk->compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data
+ * Full chunks are compressed by the compression threads and written in order
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_write(
+     gzip_writer_t *gzip_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	gzip_writer_chunk_t *chunk = NULL;
+	static char *function      = "gzip_writer_write";
+	size_t data_offset         = 0;
+	size_t copy_size           = 0;
+
+	if( gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		chunk = gzip_writer->chunks[ gzip_writer->chunk_index ];
+
+		/* The chunk that is filled next is the least recently started chunk
+		 * hence the gzip members are written in order
+		 */
+		if( gzip_writer_finish_chunk(
+		     gzip_writer,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to finish chunk: %d.",
+			 function,
+			 gzip_writer->chunk_index );
+
+			return( -1 );
+		}
+		copy_size = GZIP_WRITER_CHUNK_SIZE - chunk->uncompressed_data_size;
+
+		if( copy_size > ( data_size - data_offset ) )
+		{
+			copy_size = data_size - data_offset;
+		}
+		if( memory_copy(
+		     &( chunk->uncompressed_data[ chunk->uncompressed_data_size ] ),
+		     &( data[ data_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		chunk->uncompressed_data_size  += copy_size;
+		gzip_writer->uncompressed_size += copy_size;
+		data_offset                    += copy_size;
+
+		if( chunk->uncompressed_data_size == GZIP_WRITER_CHUNK_SIZE )
+		{
+			if( gzip_writer_start_chunk(
+			     gzip_writer,
+			     chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to start chunk: %d.",
+				 function,
+				 gzip_writer->chunk_index );
+
+				return( -1 );
+			}
+			gzip_writer->chunk_index = ( gzip_writer->chunk_index + 1 ) % gzip_writer->number_of_chunks;
+		}
+	}
+	return( 1 );
+}
+
+/* Closes the gzip writer
+ * Compresses the remaining data and writes all pending gzip members to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int gzip_writer_close(
+     gzip_writer_t *gzip_writer,
+     libcerror_error_t **error )
+{
+	gzip_writer_chunk_t *chunk = NULL;
+	static char *function      = "gzip_writer_close";
+	int chunk_index            = 0;
+	int chunk_iterator         = 0;
+	int result                 = 1;
+
+	if( gzip_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	chunk = gzip_writer->chunks[ gzip_writer->chunk_index ];
+
+	/* Without data a single empty gzip member is written so that the output is a valid gzip file
+	 */
+	if( ( chunk->is_pending == 0 )
+	 && ( ( chunk->uncompressed_data_size > 0 )
+	  || ( gzip_writer->uncompressed_size == 0 ) ) )
+	{
+		if( gzip_writer_start_chunk(
+		     gzip_writer,
+		     chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to start chunk: %d.",
+			 function,
+			 gzip_writer->chunk_index );
+
+			return( -1 );
+		}
+	}
+	/* The least recently started chunk follows the chunk that is filled
+	 */
+	for( chunk_iterator = 1;
+	     chunk_iterator <= gzip_writer->number_of_chunks;
+	     chunk_iterator++ )
+	{
+		chunk_index = ( gzip_writer->chunk_index + chunk_iterator ) % gzip_writer->number_of_chunks;
+
+		if( gzip_writer_finish_chunk(
+		     gzip_writer,
+		     gzip_writer->chunks[ chunk_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to finish chunk: %d.",
+			 function,
+			 chunk_index );
+
+			result = -1;
+		}
+	}
+	gzip_writer->chunk_index = 0;
+
+	if( fflush(
+	     gzip_writer->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush stream.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
@@ -0,0 +1,296 @@
+/*
+ * Gzip writer functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GZIP_WRITER_H )
+#define _GZIP_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the uncompressed data of a chunk, every chunk is written as a separate gzip member
+ */
+#define GZIP_WRITER_CHUNK_SIZE			( 1024 * 1024 )
+
+/* The maximum size of the uncompressed data of a deflate block, which is also the maximum size of a stored block
+ */
+#define GZIP_WRITER_BLOCK_SIZE			65535
+
+/* The size of the window that back references can refer to
+ */
+#define GZIP_WRITER_WINDOW_SIZE			32768
+
+/* The number of entries of the match hash table, must be a power of 2
+ */
+#define GZIP_WRITER_HASH_TABLE_SIZE		32768
+
+/* Determines the hash value of the 3 bytes at the start of data
+ */
+#define GZIP_WRITER_HASH( data ) \
+	( ( ( (uint32_t) ( data )[ 0 ] << 10 ) ^ ( (uint32_t) ( data )[ 1 ] << 5 ) ^ (uint32_t) ( data )[ 2 ] ) \
+	  & ( GZIP_WRITER_HASH_TABLE_SIZE - 1 ) )
+
+/* The maximum size of a Huffman code in bits
+ */
+#define GZIP_WRITER_MAXIMUM_CODE_SIZE		15
+
+/* The minimum and maximum length of a match
+ */
+#define GZIP_WRITER_MINIMUM_MATCH_LENGTH	3
+#define GZIP_WRITER_MAXIMUM_MATCH_LENGTH	258
+
+/* The default compression level
+ */
+#define GZIP_WRITER_DEFAULT_COMPRESSION_LEVEL	6
+
+/* The maximum number of compression threads
+ */
+#define GZIP_WRITER_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The number of literal and length symbols, distance symbols and code size symbols that are used
+ */
+#define GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS	286
+#define GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS	30
+#define GZIP_WRITER_NUMBER_OF_CODE_SIZE_SYMBOLS	19
+
+typedef struct gzip_writer_chunk gzip_writer_chunk_t;
+
+struct gzip_writer_chunk
+{
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The compressed data, which contains a complete gzip member
+	 */
+	uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The allocated compressed data size
+	 */
+	size_t allocated_compressed_data_size;
+
+	/* The bits that were written but not yet stored in the compressed data
+	 */
+	uint32_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t number_of_bits;
+
+	/* The most recent position of every hash value or -1 if not set
+	 */
+	int32_t *hash_heads;
+
+	/* The previous position with the same hash value of every position in the window or -1 if not set
+	 */
+	int32_t *hash_chains;
+
+	/* The match lengths of the symbols of the current block, 0 represents a literal
+	 */
+	uint16_t *match_lengths;
+
+	/* The match distances or literals of the symbols of the current block
+	 */
+	uint16_t *match_distances;
+
+	/* Value to indicate the chunk is being compressed
+	 */
+	int is_pending;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The compression thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result of the compression
+	 */
+	int result;
+
+	/* The error of the compression
+	 */
+	libcerror_error_t *error;
+};
+
+typedef struct gzip_writer gzip_writer_t;
+
+struct gzip_writer
+{
+	/* The stream
+	 */
+	FILE *stream;
+
+	/* The compression level
+	 */
+	int compression_level;
+
+	/* The number of compression threads, 0 represents compressing in the calling thread
+	 */
+	int number_of_threads;
+
+	/* The chunks
+	 */
+	gzip_writer_chunk_t **chunks;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The index of the chunk that is being filled
+	 */
+	int chunk_index;
+
+	/* The size of the uncompressed data that was written
+	 */
+	size64_t uncompressed_size;
+};
+
+int gzip_writer_chunk_initialize(
+     gzip_writer_chunk_t **chunk,
+     int compression_level,
+     libcerror_error_t **error );
+
+int gzip_writer_chunk_free(
+     gzip_writer_chunk_t **chunk,
+     libcerror_error_t **error );
+
+int gzip_writer_chunk_write_bits(
+     gzip_writer_chunk_t *chunk,
+     uint32_t value,
+     uint8_t number_of_bits,
+     libcerror_error_t **error );
+
+int gzip_writer_chunk_align_to_byte(
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int gzip_writer_build_code_sizes(
+     const uint32_t *frequencies,
+     uint16_t number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes,
+     libcerror_error_t **error );
+
+int gzip_writer_build_codes(
+     const uint8_t *code_sizes,
+     uint16_t number_of_symbols,
+     uint16_t *codes,
+     libcerror_error_t **error );
+
+uint32_t gzip_writer_calculate_crc32(
+          uint32_t crc32,
+          const uint8_t *data,
+          size_t data_size );
+
+uint8_t gzip_writer_get_length_code(
+         uint16_t match_length );
+
+uint8_t gzip_writer_get_distance_code(
+         uint16_t match_distance );
+
+int gzip_writer_chunk_find_matches(
+     gzip_writer_chunk_t *chunk,
+     size_t block_offset,
+     size_t block_size,
+     size_t *number_of_symbols,
+     libcerror_error_t **error );
+
+int gzip_writer_chunk_write_stored_block(
+     gzip_writer_chunk_t *chunk,
+     size_t block_offset,
+     size_t block_size,
+     uint8_t is_last_block,
+     libcerror_error_t **error );
+
+int gzip_writer_chunk_write_block(
+     gzip_writer_chunk_t *chunk,
+     size_t block_offset,
+     size_t block_size,
+     uint8_t is_last_block,
+     libcerror_error_t **error );
+
+int gzip_writer_chunk_compress(
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int gzip_writer_chunk_thread_callback(
+     gzip_writer_chunk_t *chunk );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int gzip_writer_initialize(
+     gzip_writer_t **gzip_writer,
+     FILE *stream,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int gzip_writer_free(
+     gzip_writer_t **gzip_writer,
+     libcerror_error_t **error );
+
+int gzip_writer_start_chunk(
+     gzip_writer_t *gzip_writer,
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int gzip_writer_finish_chunk(
+     gzip_writer_t *gzip_writer,
+     gzip_writer_chunk_t *chunk,
+     libcerror_error_t **error );
+
+int gzip_writer_write(
+     gzip_writer_t *gzip_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int gzip_writer_close(
+     gzip_writer_t *gzip_writer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _GZIP_WRITER_H ) */
+
@@ -0,0 +1,1112 @@
+/*
+ * Storage media image handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "image_handle.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+
+/* Creates an image handle
+ * Make sure the value image_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int image_handle_initialize(
+     image_handle_t **image_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_handle_initialize";
+	int block_index       = 0;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*image_handle = memory_allocate_structure(
+	                 image_handle_t );
+
+	if( *image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *image_handle,
+	     0,
+	     sizeof( image_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image handle.",
+		 function );
+
+		memory_free(
+		 *image_handle );
+
+		*image_handle = NULL;
+
+		return( -1 );
+	}
+	( *image_handle )->blocks_data = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * IMAGE_HANDLE_NUMBER_OF_BLOCKS * IMAGE_HANDLE_BLOCK_SIZE );
+
+	if( ( *image_handle )->blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create blocks data.",
+		 function );
+
+		goto on_error;
+	}
+	( *image_handle )->read_buffer = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * IMAGE_HANDLE_MAXIMUM_READ_SIZE );
+
+	if( ( *image_handle )->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_index = 0;
+	     block_index < IMAGE_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		( *image_handle )->blocks[ block_index ].data = &( ( ( *image_handle )->blocks_data )[ block_index * IMAGE_HANDLE_BLOCK_SIZE ] );
+	}
+	image_handle_clear_blocks(
+	 *image_handle );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *image_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *image_handle != NULL )
+	{
+		if( ( *image_handle )->read_buffer != NULL )
+		{
+			memory_free(
+			 ( *image_handle )->read_buffer );
+		}
+		if( ( *image_handle )->blocks_data != NULL )
+		{
+			memory_free(
+			 ( *image_handle )->blocks_data );
+		}
+		memory_free(
+		 *image_handle );
+
+		*image_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an image handle
+ * Returns 1 if successful or -1 on error
+ */
+int image_handle_free(
+     image_handle_t **image_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_handle_free";
+	int result            = 1;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_handle != NULL )
+	{
+		if( ( *image_handle )->file_io_handle != NULL )
+		{
+			if( image_handle_close(
+			     *image_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close image handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *image_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *image_handle )->read_buffer );
+
+		memory_free(
+		 ( *image_handle )->blocks_data );
+
+		memory_free(
+		 *image_handle );
+
+		*image_handle = NULL;
+	}
+	return( result );
+}
+
+/* Opens the image
+ * Returns 1 if successful or -1 on error
+ */
+int image_handle_open(
+     image_handle_t *image_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "image_handle_open";
+	size_t filename_length           = 0;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle name.",
+		 function );
+
+		goto on_error;
+	}
+	if( image_handle_open_file_io_handle(
+	     image_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open image: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	image_handle->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the image using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int image_handle_open_file_io_handle(
+     image_handle_t *image_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function                = "image_handle_open_file_io_handle";
+	int file_io_handle_is_open           = 0;
+	int file_io_handle_opened_in_library = 0;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_handle->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image handle - file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( image_handle->image_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve image size.",
+		 function );
+
+		goto on_error;
+	}
+	image_handle->file_io_handle                   = file_io_handle;
+	image_handle->file_io_handle_opened_in_library = (uint8_t) file_io_handle_opened_in_library;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	image_handle->image_size = 0;
+
+	return( -1 );
+}
+
+/* Closes the image
+ * The cached blocks and statistics are cleared
+ * Returns the 0 if succesful or -1 on error
+ */
+int image_handle_close(
+     image_handle_t *image_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_handle_close";
+	int result            = 0;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_handle->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     image_handle->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		image_handle->file_io_handle_opened_in_library = 0;
+	}
+	if( image_handle->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( image_handle->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		image_handle->file_io_handle_created_in_library = 0;
+	}
+	image_handle->file_io_handle       = NULL;
+	image_handle->image_size           = 0;
+	image_handle->number_of_reads      = 0;
+	image_handle->number_of_bytes_read = 0;
+	image_handle->number_of_hits       = 0;
+	image_handle->number_of_misses     = 0;
+
+	image_handle_clear_blocks(
+	 image_handle );
+
+	return( result );
+}
+
+/* Clears the cached blocks
+ */
+void image_handle_clear_blocks(
+      image_handle_t *image_handle )
+{
+	int block_index  = 0;
+	int bucket_index = 0;
+
+	if( image_handle == NULL )
+	{
+		return;
+	}
+	for( block_index = 0;
+	     block_index < IMAGE_HANDLE_NUMBER_OF_BLOCKS;
+	     block_index++ )
+	{
+		image_handle->blocks[ block_index ].offset           = -1;
+		image_handle->blocks[ block_index ].data_size        = 0;
+		image_handle->blocks[ block_index ].last_used        = 0;
+		image_handle->blocks[ block_index ].next_block_index = -1;
+	}
+	for( bucket_index = 0;
+	     bucket_index < IMAGE_HANDLE_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		image_handle->buckets[ bucket_index ] = -1;
+	}
+	image_handle->number_of_used_blocks = 0;
+	image_handle->usage_counter         = 0;
+}
+
+/* Finds the cached block at a specific offset
+ * Returns the index of the block or -1 if not cached
+ */
+int image_handle_find_block(
+     image_handle_t *image_handle,
+     off64_t block_offset )
+{
+	int block_index  = 0;
+	int bucket_index = 0;
+
+	if( image_handle == NULL )
+	{
+		return( -1 );
+	}
+	bucket_index = (int) ( ( block_offset / IMAGE_HANDLE_BLOCK_SIZE ) & ( IMAGE_HANDLE_NUMBER_OF_BUCKETS - 1 ) );
+
+	block_index = image_handle->buckets[ bucket_index ];
+
+	while( block_index != -1 )
+	{
+		if( image_handle->blocks[ block_index ].offset == block_offset )
+		{
+			break;
+		}
+		block_index = image_handle->blocks[ block_index ].next_block_index;
+	}
+	return( block_index );
+}
+
+/* Retrieves a block that can be used to cache data
+ * If all the blocks are used the least recently used block is removed from its bucket
+ * Returns the index of the block or -1 on error
+ */
+int image_handle_get_free_block(
+     image_handle_t *image_handle )
+{
+	int block_index          = 0;
+	int bucket_index         = 0;
+	int previous_block_index = 0;
+	int search_block_index   = 0;
+
+	if( image_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( image_handle->number_of_used_blocks < IMAGE_HANDLE_NUMBER_OF_BLOCKS )
+	{
+		block_index = image_handle->number_of_used_blocks;
+
+		image_handle->number_of_used_blocks += 1;
+
+		return( block_index );
+	}
+	for( search_block_index = 1;
+	     search_block_index < IMAGE_HANDLE_NUMBER_OF_BLOCKS;
+	     search_block_index++ )
+	{
+		if( image_handle->blocks[ search_block_index ].last_used < image_handle->blocks[ block_index ].last_used )
+		{
+			block_index = search_block_index;
+		}
+	}
+	bucket_index = (int) ( ( image_handle->blocks[ block_index ].offset / IMAGE_HANDLE_BLOCK_SIZE ) & ( IMAGE_HANDLE_NUMBER_OF_BUCKETS - 1 ) );
+
+	if( image_handle->buckets[ bucket_index ] == block_index )
+	{
+		image_handle->buckets[ bucket_index ] = image_handle->blocks[ block_index ].next_block_index;
+	}
+	else
+	{
+		previous_block_index = image_handle->buckets[ bucket_index ];
+
+		while( previous_block_index != -1 )
+		{
+			if( image_handle->blocks[ previous_block_index ].next_block_index == block_index )
+			{
+				image_handle->blocks[ previous_block_index ].next_block_index = image_handle->blocks[ block_index ].next_block_index;
+
+				break;
+			}
+			previous_block_index = image_handle->blocks[ previous_block_index ].next_block_index;
+		}
+	}
+	image_handle->blocks[ block_index ].offset           = -1;
+	image_handle->blocks[ block_index ].data_size        = 0;
+	image_handle->blocks[ block_index ].next_block_index = -1;
+
+	return( block_index );
+}
+
+/* Reads a contiguous range of blocks from the image with a single read and caches them
+ * The block offset must be aligned to the block size
+ * Returns 1 if successful or -1 on error
+ */
+int image_handle_read_blocks(
+     image_handle_t *image_handle,
+     off64_t block_offset,
+     size_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "image_handle_read_blocks";
+	size_t buffer_offset  = 0;
+	size_t data_size      = 0;
+	ssize_t read_count    = 0;
+	int block_index       = 0;
+	int bucket_index      = 0;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_offset < 0 )
+	 || ( ( block_offset % IMAGE_HANDLE_BLOCK_SIZE ) != 0 )
+	 || ( (size64_t) block_offset >= image_handle->image_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_size == 0 )
+	 || ( read_size > (size_t) IMAGE_HANDLE_MAXIMUM_READ_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size > (size_t) ( image_handle->image_size - block_offset ) )
+	{
+		read_size = (size_t) ( image_handle->image_size - block_offset );
+	}
+	if( libbfio_handle_seek_offset(
+	     image_handle->file_io_handle,
+	     block_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek image offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              image_handle->file_io_handle,
+	              image_handle->read_buffer,
+	              read_size,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read image data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		return( -1 );
+	}
+	image_handle->number_of_reads      += 1;
+	image_handle->number_of_bytes_read += read_size;
+
+	while( buffer_offset < read_size )
+	{
+		data_size = read_size - buffer_offset;
+
+		if( data_size > IMAGE_HANDLE_BLOCK_SIZE )
+		{
+			data_size = IMAGE_HANDLE_BLOCK_SIZE;
+		}
+		block_index = image_handle_find_block(
+		               image_handle,
+		               block_offset );
+
+		if( block_index == -1 )
+		{
+			block_index = image_handle_get_free_block(
+			               image_handle );
+
+			if( block_index == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve free block.",
+				 function );
+
+				return( -1 );
+			}
+			bucket_index = (int) ( ( block_offset / IMAGE_HANDLE_BLOCK_SIZE ) & ( IMAGE_HANDLE_NUMBER_OF_BUCKETS - 1 ) );
+
+			image_handle->blocks[ block_index ].offset           = block_offset;
+			image_handle->blocks[ block_index ].next_block_index = image_handle->buckets[ bucket_index ];
+			image_handle->buckets[ bucket_index ]                = block_index;
+		}
+		if( memory_copy(
+		     image_handle->blocks[ block_index ].data,
+		     &( ( image_handle->read_buffer )[ buffer_offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			return( -1 );
+		}
+		image_handle->usage_counter += 1;
+
+		image_handle->blocks[ block_index ].data_size = data_size;
+		image_handle->blocks[ block_index ].last_used = image_handle->usage_counter;
+
+		block_offset  += data_size;
+		buffer_offset += data_size;
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset of the image
+ * The data is read from the cached blocks, the blocks that are not cached are read
+ * from the image with a single read per contiguous range of missing blocks. The range
+ * is extended by up to read_ahead_size bytes after the data, for example to the end of
+ * the extent of a file, so that the subsequent reads of the file are served from the cache
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t image_handle_read_buffer_at_offset(
+         image_handle_t *image_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         size64_t read_ahead_size,
+         libcerror_error_t **error )
+{
+	static char *function      = "image_handle_read_buffer_at_offset";
+	off64_t block_offset       = 0;
+	off64_t end_offset         = 0;
+	off64_t next_block_offset  = 0;
+	off64_t read_ahead_offset  = 0;
+	size_t buffer_offset       = 0;
+	size_t block_data_offset   = 0;
+	size_t block_data_size     = 0;
+	size_t read_size           = 0;
+	ssize_t read_count         = -1;
+	int block_index            = 0;
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_handle->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image handle - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     image_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( (size64_t) offset >= image_handle->image_size )
+	{
+		size = 0;
+	}
+	else if( (size64_t) size > ( image_handle->image_size - offset ) )
+	{
+		size = (size_t) ( image_handle->image_size - offset );
+	}
+	end_offset = offset + size;
+
+	if( (size64_t) end_offset >= image_handle->image_size )
+	{
+		read_ahead_size = 0;
+	}
+	else if( read_ahead_size > ( image_handle->image_size - end_offset ) )
+	{
+		read_ahead_size = image_handle->image_size - end_offset;
+	}
+	read_ahead_offset = end_offset + read_ahead_size;
+
+	block_offset = offset - ( offset % IMAGE_HANDLE_BLOCK_SIZE );
+
+	while( buffer_offset < size )
+	{
+		block_index = image_handle_find_block(
+		               image_handle,
+		               block_offset );
+
+		if( block_index == -1 )
+		{
+			image_handle->number_of_misses += 1;
+
+			/* Extend the read with the subsequent blocks that are not cached
+			 */
+			read_size         = IMAGE_HANDLE_BLOCK_SIZE;
+			next_block_offset = block_offset + IMAGE_HANDLE_BLOCK_SIZE;
+
+			while( ( next_block_offset < read_ahead_offset )
+			    && ( read_size < IMAGE_HANDLE_MAXIMUM_READ_SIZE ) )
+			{
+				if( image_handle_find_block(
+				     image_handle,
+				     next_block_offset ) != -1 )
+				{
+					break;
+				}
+				read_size         += IMAGE_HANDLE_BLOCK_SIZE;
+				next_block_offset += IMAGE_HANDLE_BLOCK_SIZE;
+			}
+			if( image_handle_read_blocks(
+			     image_handle,
+			     block_offset,
+			     read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read blocks at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+			block_index = image_handle_find_block(
+			               image_handle,
+			               block_offset );
+
+			if( block_index == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			image_handle->number_of_hits += 1;
+			image_handle->usage_counter  += 1;
+
+			image_handle->blocks[ block_index ].last_used = image_handle->usage_counter;
+		}
+		block_data_offset = 0;
+
+		if( block_offset < offset )
+		{
+			block_data_offset = (size_t) ( offset - block_offset );
+		}
+		block_data_size = image_handle->blocks[ block_index ].data_size - block_data_offset;
+
+		if( block_data_size > ( size - buffer_offset ) )
+		{
+			block_data_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( ( image_handle->blocks[ block_index ].data )[ block_data_offset ] ),
+		     block_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy block data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset += block_data_size;
+		block_offset  += IMAGE_HANDLE_BLOCK_SIZE;
+	}
+	read_count = (ssize_t) buffer_offset;
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     image_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Retrieves the statistics of the reads of the image
+ * Returns 1 if successful or -1 on error
+ */
+int image_handle_get_statistics(
+     image_handle_t *image_handle,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "image_handle_get_statistics";
+
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_bytes_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of bytes read.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_reads      = image_handle->number_of_reads;
+	*number_of_bytes_read = image_handle->number_of_bytes_read;
+	*number_of_hits       = image_handle->number_of_hits;
+	*number_of_misses     = image_handle->number_of_misses;
+
+	return( 1 );
+}
+
@@ -0,0 +1,206 @@
+/*
+ * Storage media image handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _IMAGE_HANDLE_H )
+#define _IMAGE_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the blocks of the image that are cached
+ */
+#define IMAGE_HANDLE_BLOCK_SIZE			65536
+
+/* The number of cached blocks, which are shared by all the files read from the image
+ */
+#define IMAGE_HANDLE_NUMBER_OF_BLOCKS		256
+
+/* The number of buckets of the cached blocks, which must be a power of 2
+ */
+#define IMAGE_HANDLE_NUMBER_OF_BUCKETS		512
+
+/* The maximum size of a single read of the image, the missing blocks
+ * of a contiguous range of the image are read at once up to this size
+ */
+#define IMAGE_HANDLE_MAXIMUM_READ_SIZE		( 16 * IMAGE_HANDLE_BLOCK_SIZE )
+
+typedef struct image_block image_block_t;
+
+struct image_block
+{
+	/* The offset of the block in the image or -1 if not set
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size, which is smaller than the block size for the last block of the image
+	 */
+	size_t data_size;
+
+	/* The value of the usage counter when the block was last used
+	 */
+	uint64_t last_used;
+
+	/* The index of the next block in the same bucket or -1 if not set
+	 */
+	int next_block_index;
+};
+
+typedef struct image_handle image_handle_t;
+
+struct image_handle
+{
+	/* The image file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was created inside the image handle
+	 */
+	uint8_t file_io_handle_created_in_library;
+
+	/* Value to indicate if the file IO handle was opened inside the image handle
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The size of the image
+	 */
+	size64_t image_size;
+
+	/* The cached blocks
+	 */
+	image_block_t blocks[ IMAGE_HANDLE_NUMBER_OF_BLOCKS ];
+
+	/* The data of the cached blocks
+	 */
+	uint8_t *blocks_data;
+
+	/* The number of blocks that are used
+	 */
+	int number_of_used_blocks;
+
+	/* The index of the first block of every bucket or -1 if not set
+	 */
+	int buckets[ IMAGE_HANDLE_NUMBER_OF_BUCKETS ];
+
+	/* The usage counter
+	 */
+	uint64_t usage_counter;
+
+	/* The read buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The number of reads of the image
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of bytes read from the image
+	 */
+	uint64_t number_of_bytes_read;
+
+	/* The number of block lookups that found a cached block
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of block lookups that did not find a cached block
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 * The image handle is shared by the file IO handles of all the files
+	 * read from the image, which can be read on different threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int image_handle_initialize(
+     image_handle_t **image_handle,
+     libcerror_error_t **error );
+
+int image_handle_free(
+     image_handle_t **image_handle,
+     libcerror_error_t **error );
+
+int image_handle_open(
+     image_handle_t *image_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int image_handle_open_file_io_handle(
+     image_handle_t *image_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int image_handle_close(
+     image_handle_t *image_handle,
+     libcerror_error_t **error );
+
+void image_handle_clear_blocks(
+      image_handle_t *image_handle );
+
+int image_handle_find_block(
+     image_handle_t *image_handle,
+     off64_t block_offset );
+
+int image_handle_get_free_block(
+     image_handle_t *image_handle );
+
+int image_handle_read_blocks(
+     image_handle_t *image_handle,
+     off64_t block_offset,
+     size_t read_size,
+     libcerror_error_t **error );
+
+ssize_t image_handle_read_buffer_at_offset(
+         image_handle_t *image_handle,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t size,
+         size64_t read_ahead_size,
+         libcerror_error_t **error );
+
+int image_handle_get_statistics(
+     image_handle_t *image_handle,
+     uint64_t *number_of_reads,
+     uint64_t *number_of_bytes_read,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _IMAGE_HANDLE_H ) */
+
@@ -0,0 +1,1335 @@
+/*
+ * Storage media image extents IO handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "image_handle.h"
+#include "image_io_handle.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_unused.h"
+
+/* Creates an image IO handle
+ * Make sure the value image_io_handle is referencing, is set to NULL
+ * The image handle is not managed by the image IO handle and must remain
+ * available until the image IO handle is freed
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_initialize(
+     image_io_handle_t **image_io_handle,
+     image_handle_t *image_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_initialize";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image handle.",
+		 function );
+
+		return( -1 );
+	}
+	*image_io_handle = memory_allocate_structure(
+	                    image_io_handle_t );
+
+	if( *image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *image_io_handle,
+	     0,
+	     sizeof( image_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear image IO handle.",
+		 function );
+
+		memory_free(
+		 *image_io_handle );
+
+		*image_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *image_io_handle )->image_handle = image_handle;
+
+	return( 1 );
+}
+
+/* Frees an image IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_free(
+     image_io_handle_t **image_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_free";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_io_handle != NULL )
+	{
+		if( ( *image_io_handle )->extents != NULL )
+		{
+			memory_free(
+			 ( *image_io_handle )->extents );
+		}
+		memory_free(
+		 *image_io_handle );
+
+		*image_io_handle = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones (duplicates) the image IO handle and its extents
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_clone(
+     image_io_handle_t **destination_image_io_handle,
+     image_io_handle_t *source_image_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_clone";
+
+	if( destination_image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_image_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination image IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_image_io_handle == NULL )
+	{
+		*destination_image_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( image_io_handle_initialize(
+	     destination_image_io_handle,
+	     source_image_io_handle->image_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create image IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_image_io_handle->number_of_extents > 0 )
+	{
+		( *destination_image_io_handle )->extents = (image_extent_t *) memory_allocate(
+		                                                                sizeof( image_extent_t ) * source_image_io_handle->number_of_extents );
+
+		if( ( *destination_image_io_handle )->extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extents.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_image_io_handle )->extents,
+		     source_image_io_handle->extents,
+		     sizeof( image_extent_t ) * source_image_io_handle->number_of_extents ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy extents.",
+			 function );
+
+			goto on_error;
+		}
+		( *destination_image_io_handle )->number_of_extents           = source_image_io_handle->number_of_extents;
+		( *destination_image_io_handle )->number_of_allocated_extents = source_image_io_handle->number_of_extents;
+	}
+	( *destination_image_io_handle )->extents_size = source_image_io_handle->extents_size;
+	( *destination_image_io_handle )->data_size    = source_image_io_handle->data_size;
+
+	return( 1 );
+
+on_error:
+	if( *destination_image_io_handle != NULL )
+	{
+		image_io_handle_free(
+		 destination_image_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends an extent
+ * An extent that directly follows the previous extent in the image is merged
+ * with the previous extent, hence adjacent cluster runs are read as one range
+ * The data size is set to the size of the extents
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_append_extent(
+     image_io_handle_t *image_io_handle,
+     off64_t image_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	image_extent_t *extent           = NULL;
+	image_extent_t *reallocation     = NULL;
+	static char *function            = "image_io_handle_append_extent";
+	int number_of_allocated_extents  = 0;
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( image_offset < 0 )
+	 || ( size == 0 )
+	 || ( size > (size64_t) INT64_MAX )
+	 || ( (size64_t) image_offset > ( (size64_t) INT64_MAX - size ) )
+	 || ( image_io_handle->extents_size > ( (size64_t) INT64_MAX - size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle->number_of_extents > 0 )
+	{
+		extent = &( image_io_handle->extents[ image_io_handle->number_of_extents - 1 ] );
+
+		if( ( extent->image_offset + (off64_t) extent->size ) == image_offset )
+		{
+			extent->size += size;
+
+			image_io_handle->extents_size += size;
+			image_io_handle->data_size     = image_io_handle->extents_size;
+
+			return( 1 );
+		}
+	}
+	if( image_io_handle->number_of_extents >= IMAGE_IO_HANDLE_MAXIMUM_NUMBER_OF_EXTENTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of extents value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle->number_of_extents >= image_io_handle->number_of_allocated_extents )
+	{
+		number_of_allocated_extents = image_io_handle->number_of_allocated_extents * 2;
+
+		if( number_of_allocated_extents == 0 )
+		{
+			number_of_allocated_extents = 8;
+		}
+		reallocation = (image_extent_t *) memory_reallocate(
+		                                   image_io_handle->extents,
+		                                   sizeof( image_extent_t ) * number_of_allocated_extents );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		image_io_handle->extents                     = reallocation;
+		image_io_handle->number_of_allocated_extents = number_of_allocated_extents;
+	}
+	extent = &( image_io_handle->extents[ image_io_handle->number_of_extents ] );
+
+	extent->image_offset = image_offset;
+	extent->size         = size;
+
+	image_io_handle->number_of_extents += 1;
+	image_io_handle->extents_size      += size;
+	image_io_handle->data_size          = image_io_handle->extents_size;
+
+	return( 1 );
+}
+
+/* Sets the data size
+ * The data size cannot exceed the size of the extents
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_set_data_size(
+     image_io_handle_t *image_io_handle,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_set_data_size";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > image_io_handle->extents_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds size of extents.",
+		 function );
+
+		return( -1 );
+	}
+	image_io_handle->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Parses a decimal or hexadecimal integer with a 0x prefix
+ * The string index is advanced to the first character after the integer
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_parse_integer(
+     const char *string,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function   = "image_io_handle_parse_integer";
+	size_t safe_string_index = 0;
+	size_t start_index       = 0;
+	uint64_t digit           = 0;
+	uint64_t safe_value      = 0;
+	uint8_t base             = 10;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string_index = *string_index;
+
+	if( ( ( safe_string_index + 2 ) < string_length )
+	 && ( string[ safe_string_index ] == '0' )
+	 && ( ( string[ safe_string_index + 1 ] == 'x' )
+	  ||  ( string[ safe_string_index + 1 ] == 'X' ) ) )
+	{
+		base               = 16;
+		safe_string_index += 2;
+	}
+	start_index = safe_string_index;
+
+	while( safe_string_index < string_length )
+	{
+		if( ( string[ safe_string_index ] >= '0' )
+		 && ( string[ safe_string_index ] <= '9' ) )
+		{
+			digit = (uint64_t) ( string[ safe_string_index ] - '0' );
+		}
+		else if( ( base == 16 )
+		      && ( string[ safe_string_index ] >= 'a' )
+		      && ( string[ safe_string_index ] <= 'f' ) )
+		{
+			digit = (uint64_t) ( string[ safe_string_index ] - 'a' + 10 );
+		}
+		else if( ( base == 16 )
+		      && ( string[ safe_string_index ] >= 'A' )
+		      && ( string[ safe_string_index ] <= 'F' ) )
+		{
+			digit = (uint64_t) ( string[ safe_string_index ] - 'A' + 10 );
+		}
+		else
+		{
+			break;
+		}
+		if( safe_value > ( ( (uint64_t) INT64_MAX - digit ) / base ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value = ( safe_value * base ) + digit;
+
+		safe_string_index++;
+	}
+	if( safe_string_index == start_index )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing digits at index: %" PRIzd ".",
+		 function,
+		 safe_string_index );
+
+		return( -1 );
+	}
+	*string_index = safe_string_index;
+	*value        = safe_value;
+
+	return( 1 );
+}
+
+/* Parses a line of an extents file and appends the extents
+ * The line is formatted as: <data size> <image offset>+<size>[,<image offset>+<size>...] <name>
+ * where the integers are decimal or hexadecimal with a 0x prefix and the offsets
+ * and sizes are in bytes, for example as determined by walking the MFT of an NTFS volume
+ * The name index is set to the index of the name in the line
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_parse_extents_line(
+     image_io_handle_t *image_io_handle,
+     const char *line,
+     size_t line_length,
+     size_t *name_index,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_parse_extents_line";
+	size_t line_index     = 0;
+	uint64_t data_size    = 0;
+	uint64_t image_offset = 0;
+	uint64_t size         = 0;
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle_parse_integer(
+	     line,
+	     line_length,
+	     &line_index,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse data size.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		line_index++;
+
+		if( image_io_handle_parse_integer(
+		     line,
+		     line_length,
+		     &line_index,
+		     &image_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse extent: %d image offset.",
+			 function,
+			 image_io_handle->number_of_extents );
+
+			return( -1 );
+		}
+		if( ( line_index >= line_length )
+		 || ( line[ line_index ] != '+' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: missing extent: %d size.",
+			 function,
+			 image_io_handle->number_of_extents );
+
+			return( -1 );
+		}
+		line_index++;
+
+		if( image_io_handle_parse_integer(
+		     line,
+		     line_length,
+		     &line_index,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse extent: %d size.",
+			 function,
+			 image_io_handle->number_of_extents );
+
+			return( -1 );
+		}
+		if( image_io_handle_append_extent(
+		     image_io_handle,
+		     (off64_t) image_offset,
+		     (size64_t) size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent: %d.",
+			 function,
+			 image_io_handle->number_of_extents );
+
+			return( -1 );
+		}
+	}
+	while( ( line_index < line_length )
+	    && ( line[ line_index ] == ',' ) );
+
+	if( ( line_index >= line_length )
+	 || ( ( line[ line_index ] != ' ' )
+	  &&  ( line[ line_index ] != '\t' ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing name.",
+		 function );
+
+		return( -1 );
+	}
+	line_index++;
+
+	if( line_index >= line_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle_set_data_size(
+	     image_io_handle,
+	     (size64_t) data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data size.",
+		 function );
+
+		return( -1 );
+	}
+	*name_index = line_index;
+
+	return( 1 );
+}
+
+/* Reads a line of an extents file
+ * The line buffer is resized as needed and the end of line characters are removed
+ * Returns 1 if successful, 0 if no more lines are available or -1 on error
+ */
+int image_io_handle_read_extents_line(
+     FILE *stream,
+     char **line,
+     size_t *line_size,
+     size_t *line_length,
+     libcerror_error_t **error )
+{
+	char *reallocation    = NULL;
+	static char *function = "image_io_handle_read_extents_line";
+	size_t read_size      = 0;
+	size_t safe_length    = 0;
+	size_t safe_size      = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line size.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line length.",
+		 function );
+
+		return( -1 );
+	}
+	safe_size = *line_size;
+
+	while( ( safe_length == 0 )
+	    || ( ( *line )[ safe_length - 1 ] != '\n' ) )
+	{
+		if( ( safe_size - safe_length ) < 2 )
+		{
+			if( safe_size == 0 )
+			{
+				safe_size = IMAGE_IO_HANDLE_INITIAL_LINE_SIZE;
+			}
+			else if( safe_size <= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				safe_size *= 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid line size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = (char *) memory_reallocate(
+			                         *line,
+			                         safe_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize line.",
+				 function );
+
+				return( -1 );
+			}
+			*line      = reallocation;
+			*line_size = safe_size;
+		}
+		read_size = safe_size - safe_length;
+
+		if( read_size > (size_t) INT_MAX )
+		{
+			read_size = (size_t) INT_MAX;
+		}
+		if( file_stream_get_string(
+		     stream,
+		     &( ( *line )[ safe_length ] ),
+		     (int) read_size ) == NULL )
+		{
+			if( ferror(
+			     stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read line.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		safe_length += narrow_string_length(
+		                &( ( *line )[ safe_length ] ) );
+	}
+	if( safe_length == 0 )
+	{
+		*line_length = 0;
+
+		return( 0 );
+	}
+	while( ( safe_length > 0 )
+	    && ( ( ( *line )[ safe_length - 1 ] == '\n' )
+	     ||  ( ( *line )[ safe_length - 1 ] == '\r' ) ) )
+	{
+		safe_length -= 1;
+	}
+	( *line )[ safe_length ] = 0;
+
+	*line_length = safe_length;
+
+	return( 1 );
+}
+
+/* Creates a file IO handle of an image IO handle
+ * The file IO handle takes over management of the image IO handle
+ * and image_io_handle is set to NULL on success
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     image_io_handle_t **image_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_initialize_file_io_handle";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) *image_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) image_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) image_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) image_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) image_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) image_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) image_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) image_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) image_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) image_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) image_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*image_io_handle = NULL;
+
+	return( 1 );
+}
+
+/* Opens the image IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_open(
+     image_io_handle_t *image_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_open";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid image IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	image_io_handle->access_flags   = access_flags;
+	image_io_handle->current_offset = 0;
+	image_io_handle->is_open        = 1;
+
+	return( 1 );
+}
+
+/* Closes the image IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int image_io_handle_close(
+     image_io_handle_t *image_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_close";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	image_io_handle->access_flags   = 0;
+	image_io_handle->current_offset = 0;
+	image_io_handle->is_open        = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the image IO handle
+ * The data of the extents is read from the image handle, which reads ahead
+ * up to the end of the extent so that the file is read with few large reads
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t image_io_handle_read(
+         image_io_handle_t *image_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	image_extent_t *extent   = NULL;
+	static char *function    = "image_io_handle_read";
+	off64_t extent_offset    = 0;
+	off64_t extent_start     = 0;
+	size64_t read_ahead_size = 0;
+	size_t buffer_offset     = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	int extent_index         = 0;
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid image IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) image_io_handle->current_offset >= image_io_handle->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( image_io_handle->data_size - image_io_handle->current_offset ) )
+	{
+		size = (size_t) ( image_io_handle->data_size - image_io_handle->current_offset );
+	}
+	while( ( buffer_offset < size )
+	    && ( extent_index < image_io_handle->number_of_extents ) )
+	{
+		extent = &( image_io_handle->extents[ extent_index ] );
+
+		if( (size64_t) image_io_handle->current_offset >= ( extent_start + extent->size ) )
+		{
+			extent_start += (off64_t) extent->size;
+
+			extent_index++;
+
+			continue;
+		}
+		extent_offset = image_io_handle->current_offset - extent_start;
+
+		read_size = size - buffer_offset;
+
+		if( (size64_t) read_size > ( extent->size - extent_offset ) )
+		{
+			read_size = (size_t) ( extent->size - extent_offset );
+		}
+		/* Read ahead up to the end of the extent that contains data of the file
+		 */
+		read_ahead_size = extent->size - extent_offset - read_size;
+
+		if( read_ahead_size > ( image_io_handle->data_size - image_io_handle->current_offset - read_size ) )
+		{
+			read_ahead_size = image_io_handle->data_size - image_io_handle->current_offset - read_size;
+		}
+		read_count = image_handle_read_buffer_at_offset(
+		              image_io_handle->image_handle,
+		              extent->image_offset + extent_offset,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              read_ahead_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extent: %d data from image.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		image_io_handle->current_offset += (off64_t) read_size;
+		buffer_offset                   += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the image IO handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t image_io_handle_write(
+         image_io_handle_t *image_io_handle,
+         const uint8_t *buffer SCCATOOLS_ATTRIBUTE_UNUSED,
+         size_t size SCCATOOLS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_write";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( buffer )
+	SCCATOOLS_UNREFERENCED_PARAMETER( size )
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the image IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t image_io_handle_seek_offset(
+         image_io_handle_t *image_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_seek_offset";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += image_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) image_io_handle->data_size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	image_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int image_io_handle_exists(
+     image_io_handle_t *image_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_exists";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle->image_handle->file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Check if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int image_io_handle_is_open(
+     image_io_handle_t *image_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_is_open";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( (int) image_io_handle->is_open );
+}
+
+/* Retrieves the data size
+ * Returns 1 if successful or -1 on error
+ */
+int image_io_handle_get_size(
+     image_io_handle_t *image_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "image_io_handle_get_size";
+
+	if( image_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = image_io_handle->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,196 @@
+/*
+ * Storage media image extents IO handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _IMAGE_IO_HANDLE_H )
+#define _IMAGE_IO_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "image_handle.h"
+#include "sccatools_libbfio.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of extents of a file
+ */
+#define IMAGE_IO_HANDLE_MAXIMUM_NUMBER_OF_EXTENTS	65536
+
+/* The initial size of the line buffer of an extents file
+ */
+#define IMAGE_IO_HANDLE_INITIAL_LINE_SIZE		4096
+
+typedef struct image_extent image_extent_t;
+
+struct image_extent
+{
+	/* The offset of the extent in the image
+	 */
+	off64_t image_offset;
+
+	/* The size of the extent
+	 */
+	size64_t size;
+};
+
+typedef struct image_io_handle image_io_handle_t;
+
+struct image_io_handle
+{
+	/* The image handle, which is shared with other image IO handles
+	 */
+	image_handle_t *image_handle;
+
+	/* The extents
+	 */
+	image_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+
+	/* The size of the extents
+	 */
+	size64_t extents_size;
+
+	/* The size of the data, which can be smaller than the size of the extents
+	 * since the last extent is a multiple of the cluster size
+	 */
+	size64_t data_size;
+
+	/* The current offset in the data
+	 */
+	off64_t current_offset;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* Value to indicate the IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int image_io_handle_initialize(
+     image_io_handle_t **image_io_handle,
+     image_handle_t *image_handle,
+     libcerror_error_t **error );
+
+int image_io_handle_free(
+     image_io_handle_t **image_io_handle,
+     libcerror_error_t **error );
+
+int image_io_handle_clone(
+     image_io_handle_t **destination_image_io_handle,
+     image_io_handle_t *source_image_io_handle,
+     libcerror_error_t **error );
+
+int image_io_handle_append_extent(
+     image_io_handle_t *image_io_handle,
+     off64_t image_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int image_io_handle_set_data_size(
+     image_io_handle_t *image_io_handle,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int image_io_handle_parse_integer(
+     const char *string,
+     size_t string_length,
+     size_t *string_index,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int image_io_handle_parse_extents_line(
+     image_io_handle_t *image_io_handle,
+     const char *line,
+     size_t line_length,
+     size_t *name_index,
+     libcerror_error_t **error );
+
+int image_io_handle_read_extents_line(
+     FILE *stream,
+     char **line,
+     size_t *line_size,
+     size_t *line_length,
+     libcerror_error_t **error );
+
+int image_io_handle_initialize_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     image_io_handle_t **image_io_handle,
+     libcerror_error_t **error );
+
+int image_io_handle_open(
+     image_io_handle_t *image_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int image_io_handle_close(
+     image_io_handle_t *image_io_handle,
+     libcerror_error_t **error );
+
+ssize_t image_io_handle_read(
+         image_io_handle_t *image_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t image_io_handle_write(
+         image_io_handle_t *image_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t image_io_handle_seek_offset(
+         image_io_handle_t *image_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int image_io_handle_exists(
+     image_io_handle_t *image_io_handle,
+     libcerror_error_t **error );
+
+int image_io_handle_is_open(
+     image_io_handle_t *image_io_handle,
+     libcerror_error_t **error );
+
+int image_io_handle_get_size(
+     image_io_handle_t *image_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _IMAGE_IO_HANDLE_H ) */
+
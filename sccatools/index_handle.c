@@ -0,0 +1,1060 @@
+/*
+ * Index handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "index_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+#include "sccatools_libuna.h"
+
+#define INDEX_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates an index handle
+ * Make sure the value index_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_initialize(
+     index_handle_t **index_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_initialize";
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_handle = memory_allocate_structure(
+	                 index_handle_t );
+
+	if( *index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_handle,
+	     0,
+	     sizeof( index_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_index_initialize(
+	     &( ( *index_handle )->index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize index.",
+		 function );
+
+		goto on_error;
+	}
+	( *index_handle )->notify_stream = INDEX_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *index_handle != NULL )
+	{
+		memory_free(
+		 *index_handle );
+
+		*index_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index handle
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_free(
+     index_handle_t **index_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_free";
+	int result            = 1;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_handle != NULL )
+	{
+		if( ( *index_handle )->index != NULL )
+		{
+			if( libscca_index_free(
+			     &( ( *index_handle )->index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *index_handle )->utf8_string != NULL )
+		{
+			memory_free(
+			 ( *index_handle )->utf8_string );
+		}
+		memory_free(
+		 *index_handle );
+
+		*index_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the index handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_signal_abort(
+     index_handle_t *index_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_signal_abort";
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	index_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded version of a system string
+ * A narrow system string is used as-is, a wide system string is converted
+ * into the UTF-8 string buffer of the index handle
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_get_utf8_string(
+     index_handle_t *index_handle,
+     const system_character_t *string,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *reallocation   = NULL;
+	size_t utf8_string_size = 0;
+#endif
+	static char *function   = "index_handle_get_utf8_string";
+	size_t string_length    = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > index_handle->utf8_string_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            index_handle->utf8_string,
+		                            sizeof( uint8_t ) * utf8_string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		index_handle->utf8_string      = reallocation;
+		index_handle->utf8_string_size = utf8_string_size;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     (libuna_utf8_character_t *) index_handle->utf8_string,
+	     utf8_string_size,
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string        = index_handle->utf8_string;
+	*utf8_string_length = utf8_string_size - 1;
+#else
+	*utf8_string        = (const uint8_t *) string;
+	*utf8_string_length = string_length;
+#endif
+	return( 1 );
+}
+
+/* Appends a source file to the index
+ * The path of the source file is used as the label of the file in the index
+ * Returns 1 if successful, 0 if the source file could not be opened or -1 on error
+ */
+int index_handle_append_source(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libscca_file_t *file      = NULL;
+	const uint8_t *utf8_label = NULL;
+	static char *function     = "index_handle_append_source";
+	size_t utf8_label_length  = 0;
+	int result                = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	/* A source file that cannot be opened is skipped
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          filename,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	          NULL );
+#else
+	result = libscca_file_open(
+	          file,
+	          filename,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	          NULL );
+#endif
+	if( result == 1 )
+	{
+		if( index_handle_get_utf8_string(
+		     index_handle,
+		     filename,
+		     &utf8_label,
+		     &utf8_label_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 label.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_index_append_file(
+		     index_handle->index,
+		     file,
+		     utf8_label,
+		     utf8_label_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file to index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+		index_handle->number_of_files_appended += 1;
+	}
+	else
+	{
+		index_handle->number_of_files_skipped += 1;
+
+		result = 0;
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the files of an index file to the index
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_append_index_file(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libscca_index_t *source_index = NULL;
+	static char *function         = "index_handle_append_index_file";
+	int number_of_files           = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_index_initialize(
+	     &source_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize source index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_index_open_wide(
+	     source_index,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libscca_index_open(
+	     source_index,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open source index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_index_get_number_of_files(
+	     source_index,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files of source index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_index_append_index(
+	     index_handle->index,
+	     source_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_index_free(
+	     &source_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free source index.",
+		 function );
+
+		goto on_error;
+	}
+	index_handle->number_of_files_appended += number_of_files;
+
+	return( 1 );
+
+on_error:
+	if( source_index != NULL )
+	{
+		libscca_index_free(
+		 &source_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the index to a file
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_write_index(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "index_handle_write_index";
+	size_t data_size      = 0;
+	size_t write_count    = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_index_get_data_size(
+	     index_handle->index,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index data size.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index covers many files, hence it is not limited to MEMORY_MAXIMUM_ALLOCATION_SIZE
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_index_write_data(
+	     index_handle->index,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Opens an index file
+ * The index that is being built, if any, is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int index_handle_open_index(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_open_index";
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle->index != NULL )
+	{
+		if( libscca_index_free(
+		     &( index_handle->index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libscca_index_initialize(
+	     &( index_handle->index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_index_open_wide(
+	     index_handle->index,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libscca_index_open(
+	     index_handle->index,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the files that loaded a specific filename
+ * Returns 1 if successful, 0 if no file loaded the filename or -1 on error
+ */
+int index_handle_query_fprint(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "index_handle_query_fprint";
+	int result            = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = index_handle_query_index_fprint(
+	          index_handle,
+	          index_handle->index,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to query index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Prints the files of a specific index that loaded a specific filename
+ * The index is an index that was opened, for example a segment of a segmented index
+ * Returns 1 if successful, 0 if no file loaded the filename or -1 on error
+ */
+int index_handle_query_index_fprint(
+     index_handle_t *index_handle,
+     libscca_index_t *index,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_label         = NULL;
+	const uint8_t *utf8_string  = NULL;
+	static char *function       = "index_handle_query_index_fprint";
+	size_t utf8_label_size      = 0;
+	size_t utf8_string_length   = 0;
+	uint64_t number_of_postings = 0;
+	uint64_t posting_index      = 0;
+	int file_index              = 0;
+	int metrics_entry_index     = 0;
+	int result                  = 0;
+	int string_index            = 0;
+
+	if( index_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_handle_get_utf8_string(
+	     index_handle,
+	     filename,
+	     &utf8_string,
+	     &utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 filename.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_index_get_string_index_by_utf8_filename(
+	          index,
+	          utf8_string,
+	          utf8_string_length,
+	          &string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libscca_index_get_number_of_postings(
+	     index,
+	     string_index,
+	     &number_of_postings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of postings.",
+		 function );
+
+		goto on_error;
+	}
+	for( posting_index = 0;
+	     posting_index < number_of_postings;
+	     posting_index++ )
+	{
+		if( index_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libscca_index_get_posting(
+		     index,
+		     string_index,
+		     posting_index,
+		     &file_index,
+		     &metrics_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve posting: %" PRIu64 ".",
+			 function,
+			 posting_index );
+
+			goto on_error;
+		}
+		if( libscca_index_get_utf8_file_label_size(
+		     index,
+		     file_index,
+		     &utf8_label_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d label size.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( ( utf8_label_size == 0 )
+		 || ( utf8_label_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file: %d label size value out of bounds.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		utf8_label = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * utf8_label_size );
+
+		if( utf8_label == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create label.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_index_get_utf8_file_label(
+		     index,
+		     file_index,
+		     utf8_label,
+		     utf8_label_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d label.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 index_handle->notify_stream,
+		 "%s\tfile metrics entry: %d\n",
+		 (char *) utf8_label,
+		 metrics_entry_index + 1 );
+
+		memory_free(
+		 utf8_label );
+
+		utf8_label = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_label != NULL )
+	{
+		memory_free(
+		 utf8_label );
+	}
+	return( -1 );
+}
+
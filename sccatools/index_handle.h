@@ -0,0 +1,124 @@
+/*
+ * Index handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INDEX_HANDLE_H )
+#define _INDEX_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct index_handle index_handle_t;
+
+struct index_handle
+{
+	/* The index
+	 */
+	libscca_index_t *index;
+
+	/* The UTF-8 string buffer used to convert labels and filenames
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string buffer size
+	 */
+	size_t utf8_string_size;
+
+	/* The number of files appended to the index
+	 */
+	int number_of_files_appended;
+
+	/* The number of files that could not be appended to the index
+	 */
+	int number_of_files_skipped;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int index_handle_initialize(
+     index_handle_t **index_handle,
+     libcerror_error_t **error );
+
+int index_handle_free(
+     index_handle_t **index_handle,
+     libcerror_error_t **error );
+
+int index_handle_signal_abort(
+     index_handle_t *index_handle,
+     libcerror_error_t **error );
+
+int index_handle_get_utf8_string(
+     index_handle_t *index_handle,
+     const system_character_t *string,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int index_handle_append_source(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int index_handle_append_index_file(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int index_handle_write_index(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int index_handle_open_index(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int index_handle_query_fprint(
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int index_handle_query_index_fprint(
+     index_handle_t *index_handle,
+     libscca_index_t *index,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INDEX_HANDLE_H ) */
+
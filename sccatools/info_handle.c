@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
@@ -27,11 +28,14 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "arrow_writer.h"
+#include "gzip_writer.h"
 #include "info_handle.h"
+#include "output_buffer.h"
 #include "sccainput.h"
 #include "sccatools_libcerror.h"
-#include "sccatools_libfdatetime.h"
 #include "sccatools_libscca.h"
+#include "sccatools_libuna.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
@@ -108,13 +112,34 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
+	if( output_buffer_initialize(
+	     &( ( *info_handle )->output_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	( *info_handle )->notify_stream = INFO_HANDLE_NOTIFY_STREAM;
+	( *info_handle )->match_type    = LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING;
+	( *info_handle )->match_flags   = LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE;
 
 	return( 1 );
 
 on_error:
 	if( *info_handle != NULL )
 	{
+		if( ( *info_handle )->input_file != NULL )
+		{
+			libscca_file_free(
+			 &( ( *info_handle )->input_file ),
+			 NULL );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -162,6 +187,70 @@ int info_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *info_handle )->output_buffer != NULL )
+		{
+			if( output_buffer_free(
+			     &( ( *info_handle )->output_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->filter_expression != NULL )
+		{
+			if( filter_expression_free(
+			     &( ( *info_handle )->filter_expression ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filter expression.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->arrow_writer != NULL )
+		{
+			if( arrow_writer_free(
+			     &( ( *info_handle )->arrow_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free Arrow writer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *info_handle )->gzip_writer != NULL )
+		{
+			if( gzip_writer_free(
+			     &( ( *info_handle )->gzip_writer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free gzip writer.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *info_handle );
 
@@ -252,15 +341,17 @@ int info_handle_set_ascii_codepage(
 	return( result );
 }
 
-/* Opens the input
- * Returns 1 if successful or -1 on error
+/* Sets the output format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int info_handle_open_input(
+int info_handle_set_output_format(
      info_handle_t *info_handle,
-     const system_character_t *filename,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "info_handle_open_input";
+	static char *function = "info_handle_set_output_format";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( info_handle == NULL )
 	{
@@ -273,40 +364,93 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libscca_file_open_wide(
-	     info_handle->input_file,
-	     filename,
-	     LIBSCCA_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libscca_file_open(
-	     info_handle->input_file,
-	     filename,
-	     LIBSCCA_OPEN_READ,
-	     error ) != 1 )
-#endif
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 3 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "csv" ),
+		     3 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_CSV;
+			result                     = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "sql" ),
+		          3 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_SQL;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "arrow" ),
+		     5 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_ARROW;
+			result                     = 1;
+		}
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "jsonl" ),
+		          5 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+			result                     = 1;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "bodyfile" ),
+		     8 ) == 0 )
+		{
+			info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_BODYFILE;
+			result                     = 1;
+		}
+	}
+	return( result );
 }
 
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
+/* Sets the match string
+ * The string is not copied and must remain available while the info handle is used
+ * Returns 1 if successful or -1 on error
  */
-int info_handle_close_input(
+int info_handle_set_match_string(
      info_handle_t *info_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "info_handle_close_input";
+	static char *function = "info_handle_set_match_string";
 
 	if( info_handle == NULL )
 	{
@@ -319,36 +463,35 @@ int info_handle_close_input(
 
 		return( -1 );
 	}
-	if( libscca_file_close(
-	     info_handle->input_file,
-	     error ) != 0 )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	return( 0 );
+	info_handle->match_string        = string;
+	info_handle->match_string_length = system_string_length(
+	                                    string );
+
+	return( 1 );
 }
 
-/* Prints a FILETIME value
- * Returns 1 if successful or -1 on error
+/* Sets the match type
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int info_handle_filetime_value_fprint(
+int info_handle_set_match_type(
      info_handle_t *info_handle,
-     const char *value_name,
-     uint64_t value_64bit,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	system_character_t date_time_string[ 48 ];
-
-	libfdatetime_filetime_t *filetime = NULL;
-	static char *function             = "info_handle_filetime_value_fprint";
-	int result                        = 0;
+	static char *function = "info_handle_set_match_type";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( info_handle == NULL )
 	{
@@ -361,124 +504,74 @@ int info_handle_filetime_value_fprint(
 
 		return( -1 );
 	}
-	if( value_64bit == 0 )
+	if( string == NULL )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%s: Not set (0)\n",
-		 value_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
 	}
-	else
-	{
-		if( libfdatetime_filetime_initialize(
-		     &filetime,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create FILETIME.",
-			 function );
+	string_length = system_string_length(
+	                 string );
 
-			goto on_error;
-		}
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
-		     value_64bit,
-		     error ) != 1 )
+	if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "exact" ),
+		     5 ) == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy 64-bit value to FILETIME.",
-			 function );
-
-			goto on_error;
+			info_handle->match_type = LIBSCCA_FILENAME_MATCH_TYPE_EXACT;
+			result                  = 1;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
-			  filetime,
-			  (uint16_t *) date_time_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#else
-		result = libfdatetime_filetime_copy_to_utf8_string(
-			  filetime,
-			  (uint8_t *) date_time_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#endif
-		if( result != 1 )
+	}
+	else if( string_length == 6 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "prefix" ),
+		     6 ) == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy FILETIME to string.",
-			 function );
-
-			goto on_error;
+			info_handle->match_type = LIBSCCA_FILENAME_MATCH_TYPE_PREFIX;
+			result                  = 1;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "%s: %" PRIs_SYSTEM " UTC\n",
-		 value_name,
-		 date_time_string );
-
-		if( libfdatetime_filetime_free(
-		     &filetime,
-		     error ) != 1 )
+		else if( system_string_compare(
+		          string,
+		          _SYSTEM_STRING( "suffix" ),
+		          6 ) == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free FILETIME.",
-			 function );
-
-			goto on_error;
+			info_handle->match_type = LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX;
+			result                  = 1;
 		}
 	}
-	return( 1 );
-
-on_error:
-	if( filetime != NULL )
+	else if( string_length == 9 )
 	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "substring" ),
+		     9 ) == 0 )
+		{
+			info_handle->match_type = LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING;
+			result                  = 1;
+		}
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Prints the file information
+/* Sets the filter expression
+ * The expression is compiled once and evaluated for every file
  * Returns 1 if successful or -1 on error
  */
-int info_handle_file_fprint(
+int info_handle_set_filter_expression(
      info_handle_t *info_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	char value_name[ 32 ];
-
-	libscca_volume_information_t *volume_information = NULL;
-	system_character_t *value_string                 = NULL;
-	static char *function                            = "info_handle_file_fprint";
-	size_t value_string_size                         = 0;
-	uint64_t value_64bit                             = 0;
-	uint32_t format_version                          = 0;
-	uint32_t value_32bit                             = 0;
-	int filename_index                               = 0;
-	int last_run_time_index                          = 0;
-	int number_of_filenames                          = 0;
-	int number_of_last_run_times                     = 0;
-	int number_of_volumes                            = 0;
-	int print_count                                  = 0;
-	int result                                       = 0;
-	int volume_index                                 = 0;
+	static char *function = "info_handle_set_filter_expression";
 
 	if( info_handle == NULL )
 	{
@@ -491,516 +584,6307 @@ int info_handle_file_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Windows Prefetch File (PF) information:\n" );
+	if( info_handle->filter_expression != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - filter expression value already set.",
+		 function );
 
-	if( libscca_file_get_format_version(
-	     info_handle->input_file,
-	     &format_version,
+		return( -1 );
+	}
+	if( filter_expression_initialize(
+	     &( info_handle->filter_expression ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve format version.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filter expression.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tFormat version\t\t\t: %" PRIu32 "\n",
-	 format_version );
-
-	if( libscca_file_get_prefetch_hash(
-	     info_handle->input_file,
-	     &value_32bit,
+	if( filter_expression_compile(
+	     info_handle->filter_expression,
+	     string,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve prefetch hash.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile filter expression.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tPrefetch hash\t\t\t: 0x%08" PRIx32 "\n",
-	 value_32bit );
+	return( 1 );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libscca_file_get_utf16_executable_filename_size(
-		  info_handle->input_file,
-		  &value_string_size,
-		  error );
-#else
-	result = libscca_file_get_utf8_executable_filename_size(
-		  info_handle->input_file,
-		  &value_string_size,
-		  error );
-#endif
-	if( result != 1 )
+on_error:
+	if( info_handle->filter_expression != NULL )
+	{
+		filter_expression_free(
+		 &( info_handle->filter_expression ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a file matches the filter expression and contains a filename
+ * that matches the match string
+ * The filenames are compared as stored in the file, without converting them to UTF-8
+ * Returns 1 if the file matches or no filter was set, 0 if not or -1 on error
+ */
+int info_handle_file_matches(
+     info_handle_t *info_handle,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_file_matches";
+	int filename_index    = 0;
+	int result            = 0;
+
+	if( info_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve executable filename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( value_string_size > 0 )
+	if( info_handle->filter_expression != NULL )
 	{
-		value_string = system_string_allocate(
-				value_string_size );
+		result = filter_expression_matches(
+		          info_handle->filter_expression,
+		          file,
+		          error );
 
-		if( value_string == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to evaluate filter expression.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( info_handle->match_string == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_get_filename_index_by_utf16_pattern(
+	          file,
+	          (uint16_t *) info_handle->match_string,
+	          info_handle->match_string_length,
+	          info_handle->match_type,
+	          info_handle->match_flags,
+	          &filename_index,
+	          error );
+#else
+	result = libscca_file_get_filename_index_by_utf8_pattern(
+	          file,
+	          (uint8_t *) info_handle->match_string,
+	          info_handle->match_string_length,
+	          info_handle->match_type,
+	          info_handle->match_flags,
+	          &filename_index,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to match filenames.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_open_input(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_open_input";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_file_open_wide(
+	     info_handle->input_file,
+	     filename,
+	     LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	     error ) != 1 )
+#else
+	if( libscca_file_open(
+	     info_handle->input_file,
+	     filename,
+	     LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->source_path = filename;
+
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int info_handle_close_input(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_close_input";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->source_path = NULL;
+
+	if( libscca_file_close(
+	     info_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Appends a FILETIME value to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_filetime_value_append(
+     info_handle_t *info_handle,
+     const char *value_name,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_filetime_value_append";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = output_buffer_append_narrow_string(
+	          info_handle->output_buffer,
+	          value_name,
+	          error );
+
+	if( result == 1 )
+	{
+		if( value_64bit == 0 )
+		{
+			result = output_buffer_append_narrow_string(
+			          info_handle->output_buffer,
+			          ": Not set (0)\n",
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          ": ",
+			          2,
+			          error );
+
+			if( result == 1 )
+			{
+				result = output_buffer_append_filetime(
+				          info_handle->output_buffer,
+				          value_64bit,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_string(
+				          info_handle->output_buffer,
+				          " UTC\n",
+				          5,
+				          error );
+			}
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append FILETIME value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the file information
+ * The information is built in the output buffer and written with a single write
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_file_fprint";
+	int result            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = info_handle_file_append(
+	          info_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file information.",
+		 function );
+	}
+	/* The text output of a partially read file is still written
+	 */
+	if( ( result == 1 )
+	 || ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT ) )
+	{
+		if( info_handle_output_buffer_write(
+		     info_handle,
+		     info_handle->output_buffer,
+		     info_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write file information.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* Discard a partial record
+	 */
+	info_handle->output_buffer->data_offset = 0;
+
+	return( result );
+}
+
+/* Appends the file information to the output buffer in the output format
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_file_append";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->verify_prefetch_hash != 0 )
+	{
+		return( info_handle_prefetch_hash_verification_append(
+		         info_handle,
+		         error ) );
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		return( info_handle_file_csv_append(
+		         info_handle,
+		         error ) );
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSONL )
+	{
+		return( info_handle_file_jsonl_append(
+		         info_handle,
+		         error ) );
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_BODYFILE )
+	{
+		return( info_handle_file_bodyfile_append(
+		         info_handle,
+		         error ) );
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_ARROW )
+	{
+		return( info_handle_file_arrow_append(
+		         info_handle,
+		         error ) );
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_SQL )
+	{
+		return( info_handle_file_sql_append(
+		         info_handle,
+		         error ) );
+	}
+	return( info_handle_file_text_append(
+	         info_handle,
+	         error ) );
+}
+
+/* Appends the file information as text to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_text_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	char value_name[ 32 ];
+
+	libscca_volume_information_t *volume_information = NULL;
+	output_buffer_t *output_buffer                   = NULL;
+	size_t *utf8_string_offsets                      = NULL;
+	uint64_t *file_references                        = NULL;
+	uint8_t *utf8_strings                            = NULL;
+	static char *function                            = "info_handle_file_text_append";
+	size_t utf8_strings_size                         = 0;
+	uint64_t value_64bit                             = 0;
+	uint32_t format_version                          = 0;
+	uint32_t value_32bit                             = 0;
+	int directory_string_index                       = 0;
+	int file_reference_index                         = 0;
+	int filename_index                               = 0;
+	int last_run_time_index                          = 0;
+	int number_of_directory_strings                  = 0;
+	int number_of_file_references                    = 0;
+	int number_of_filenames                          = 0;
+	int number_of_last_run_times                     = 0;
+	int number_of_volumes                            = 0;
+	int print_count                                  = 0;
+	int result                                       = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer = info_handle->output_buffer;
+
+	if( libscca_file_get_format_version(
+	     info_handle->input_file,
+	     &format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "Windows Prefetch File (PF) information:\n"
+	       "\tFormat version\t\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) format_version,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append format version.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_prefetch_hash(
+	     info_handle->input_file,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\tPrefetch hash\t\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_hexadecimal_32bit(
+	       output_buffer,
+	       value_32bit,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\tExecutable filename\t\t: ",
+	       error ) != 1 )
+	 || ( info_handle_executable_filename_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_NONE,
+	       0,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_run_count(
+	     info_handle->input_file,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\tRun count\t\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) value_32bit,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( format_version < 26 )
+	{
+		number_of_last_run_times = 1;
+	}
+	else
+	{
+		number_of_last_run_times = 8;
+	}
+	for( last_run_time_index = 0;
+	     last_run_time_index < number_of_last_run_times;
+	     last_run_time_index++ )
+	{
+		if( libscca_file_get_last_run_time(
+		     info_handle->input_file,
+		     last_run_time_index,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last run time: %d.",
+			 function,
+			 last_run_time_index );
+
+			goto on_error;
+		}
+		if( number_of_last_run_times == 1 )
+		{
+			print_count = narrow_string_snprintf(
+			               value_name,
+			               32,
+			               "\tLast run time:\t\t\t" );
+		}
+		else
+		{
+			print_count = narrow_string_snprintf(
+			               value_name,
+			               32,
+			               "\tLast run time: %d\t\t",
+			               last_run_time_index + 1 );
+		}
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to format last run time: %d value name.",
+			 function,
+			 last_run_time_index );
+
+			goto on_error;
+		}
+		if( info_handle_filetime_value_append(
+		     info_handle,
+		     value_name,
+		     value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append FILETIME value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_number_of_filenames(
+	     info_handle->input_file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n"
+	       "Filenames:\n"
+	       "\tNumber of filenames\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) number_of_filenames,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_filenames > 0 )
+	{
+		if( (size_t) number_of_filenames > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of filenames value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		/* The filenames are retrieved as a single table to prevent an allocation per filename
+		 */
+		if( libscca_file_get_utf8_filenames_table_size(
+		     info_handle->input_file,
+		     &utf8_strings_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_strings_size == 0 )
+		 || ( utf8_strings_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filenames table size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_strings = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * utf8_strings_size );
+
+		if( utf8_strings == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string_offsets = (size_t *) memory_allocate(
+		                                  sizeof( size_t ) * number_of_filenames );
+
+		if( utf8_string_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename offsets.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table(
+		     info_handle->input_file,
+		     utf8_strings,
+		     utf8_strings_size,
+		     utf8_string_offsets,
+		     number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			if( ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       "\tFilename: ",
+			       error ) != 1 )
+			 || ( output_buffer_append_decimal(
+			       output_buffer,
+			       (uint64_t) filename_index + 1,
+			       error ) != 1 )
+			 || ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       "\t\t\t: ",
+			       error ) != 1 )
+			 || ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       (char *) &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       output_buffer,
+			       '\n',
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append filename: %d.",
+				 function,
+				 filename_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 utf8_string_offsets );
+
+		utf8_string_offsets = NULL;
+
+		memory_free(
+		 utf8_strings );
+
+		utf8_strings = NULL;
+	}
+	if( libscca_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n"
+	       "Volumes:\n"
+	       "\tNumber of volumes\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) number_of_volumes,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       "\n\n",
+	       2,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     info_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume information.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "Volume: ",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       (uint64_t) volume_index + 1,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       " information:\n"
+		       "\tDevice path\t\t\t: ",
+		       error ) != 1 )
+		 || ( info_handle_volume_string_append(
+		       info_handle,
+		       volume_information,
+		       -1,
+		       OUTPUT_BUFFER_ESCAPE_MODE_NONE,
+		       0,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append device path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_creation_time(
+		     volume_information,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_filetime_value_append(
+		     info_handle,
+		     "\tCreation time\t\t\t",
+		     value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append FILETIME value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_serial_number(
+		     volume_information,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serial number.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_number_of_file_references(
+		     volume_information,
+		     &number_of_file_references,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file references.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "\tSerial number\t\t\t: ",
+		       error ) != 1 )
+		 || ( output_buffer_append_hexadecimal_32bit(
+		       output_buffer,
+		       value_32bit,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "\n"
+		       "\tNumber of file references\t: ",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       (uint64_t) number_of_file_references,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append serial number.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_file_references > 0 )
+		{
+			file_references = (uint64_t *) memory_allocate(
+			                                sizeof( uint64_t ) * number_of_file_references );
+
+			if( file_references == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create file references.",
+				 function );
+
+				goto on_error;
+			}
+			if( libscca_volume_information_copy_file_references(
+			     volume_information,
+			     file_references,
+			     number_of_file_references,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file references.",
+				 function );
+
+				goto on_error;
+			}
+			for( file_reference_index = 0;
+			     file_reference_index < number_of_file_references;
+			     file_reference_index++ )
+			{
+				value_64bit = file_references[ file_reference_index ];
+
+				result = output_buffer_append_narrow_string(
+				          output_buffer,
+				          "\tFile reference: ",
+				          error );
+
+				if( result == 1 )
+				{
+					result = output_buffer_append_decimal(
+					          output_buffer,
+					          (uint64_t) file_reference_index + 1,
+					          error );
+				}
+				if( result == 1 )
+				{
+					if( value_64bit == 0 )
+					{
+						result = output_buffer_append_narrow_string(
+						          output_buffer,
+						          "\t\t: 0\n",
+						          error );
+					}
+					else
+					{
+						if( ( output_buffer_append_narrow_string(
+						       output_buffer,
+						       "\t\t: MFT entry: ",
+						       error ) != 1 )
+						 || ( output_buffer_append_decimal(
+						       output_buffer,
+						       value_64bit & 0xffffffffffffUL,
+						       error ) != 1 )
+						 || ( output_buffer_append_narrow_string(
+						       output_buffer,
+						       ", sequence: ",
+						       error ) != 1 )
+						 || ( output_buffer_append_decimal(
+						       output_buffer,
+						       value_64bit >> 48,
+						       error ) != 1 )
+						 || ( output_buffer_append_character(
+						       output_buffer,
+						       '\n',
+						       error ) != 1 ) )
+						{
+							result = -1;
+						}
+					}
+				}
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append file reference: %d.",
+					 function,
+					 file_reference_index );
+
+					goto on_error;
+				}
+			}
+			memory_free(
+			 file_references );
+
+			file_references = NULL;
+		}
+		if( libscca_volume_information_get_number_of_directory_strings(
+		     volume_information,
+		     &number_of_directory_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory strings.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "\tNumber of directory strings\t: ",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       (uint64_t) number_of_directory_strings,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append number of directory strings.",
+			 function );
+
+			goto on_error;
+		}
+		for( directory_string_index = 0;
+		     directory_string_index < number_of_directory_strings;
+		     directory_string_index++ )
+		{
+			if( ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       "\tDirectory string: ",
+			       error ) != 1 )
+			 || ( output_buffer_append_decimal(
+			       output_buffer,
+			       (uint64_t) directory_string_index + 1,
+			       error ) != 1 )
+			 || ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       "\t\t: ",
+			       error ) != 1 )
+			 || ( info_handle_volume_string_append(
+			       info_handle,
+			       volume_information,
+			       directory_string_index,
+			       OUTPUT_BUFFER_ESCAPE_MODE_NONE,
+			       0,
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       output_buffer,
+			       '\n',
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory string: %d.",
+				 function,
+				 directory_string_index );
+
+				goto on_error;
+			}
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume information.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_character(
+		     output_buffer,
+		     '\n',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume end.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( -1 );
+}
+
+/* Appends the result of the prefetch hash verification as a single record to the output buffer
+ * The record contains the source, the prefetch hash, if the prefetch hash was verified
+ * and the path of the executable of which the prefetch hash was computed
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_prefetch_hash_verification_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "info_handle_prefetch_hash_verification_append";
+	size_t utf8_string_size = 0;
+	uint32_t prefetch_hash  = 0;
+	int escape_mode         = 0;
+	int filename_index      = 0;
+	int result              = 0;
+	int verified            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_prefetch_hash(
+	     info_handle->input_file,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	verified = libscca_file_verify_prefetch_hash(
+	            info_handle->input_file,
+	            &filename_index,
+	            error );
+
+	if( verified == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( verified != 0 )
+	{
+		if( libscca_file_get_utf8_filename_size(
+		     info_handle->input_file,
+		     filename_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d size.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename: %d size value out of bounds.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filename(
+		     info_handle->input_file,
+		     filename_index,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	{
+		escape_mode = OUTPUT_BUFFER_ESCAPE_MODE_CSV;
+
+		result = info_handle_source_path_append(
+		          info_handle,
+		          escape_mode,
+		          1,
+		          error );
+
+		if( result == 1 )
+		{
+			result = output_buffer_append_character(
+			          info_handle->output_buffer,
+			          ',',
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_hexadecimal_32bit(
+			          info_handle->output_buffer,
+			          prefetch_hash,
+			          error );
+		}
+		if( result == 1 )
+		{
+			if( verified != 0 )
+			{
+				result = output_buffer_append_string(
+				          info_handle->output_buffer,
+				          ",true,",
+				          6,
+				          error );
+			}
+			else
+			{
+				result = output_buffer_append_string(
+				          info_handle->output_buffer,
+				          ",false,",
+				          7,
+				          error );
+			}
+		}
+	}
+	else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_JSONL )
+	{
+		escape_mode = OUTPUT_BUFFER_ESCAPE_MODE_JSON;
+
+		result = output_buffer_append_string(
+		          info_handle->output_buffer,
+		          "{\"source\":",
+		          10,
+		          error );
+
+		if( result == 1 )
+		{
+			result = info_handle_source_path_append(
+			          info_handle,
+			          escape_mode,
+			          1,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          ",\"prefetch_hash\":\"",
+			          18,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_hexadecimal_32bit(
+			          info_handle->output_buffer,
+			          prefetch_hash,
+			          error );
+		}
+		if( result == 1 )
+		{
+			if( verified != 0 )
+			{
+				result = output_buffer_append_string(
+				          info_handle->output_buffer,
+				          "\",\"verified\":true,\"executable_path\":",
+				          36,
+				          error );
+			}
+			else
+			{
+				result = output_buffer_append_string(
+				          info_handle->output_buffer,
+				          "\",\"verified\":false,\"executable_path\":null",
+				          41,
+				          error );
+			}
+		}
+	}
+	else
+	{
+		escape_mode = OUTPUT_BUFFER_ESCAPE_MODE_NONE;
+
+		if( verified != 0 )
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          "verified\t",
+			          9,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          "mismatch\t",
+			          9,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_hexadecimal_32bit(
+			          info_handle->output_buffer,
+			          prefetch_hash,
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_character(
+			          info_handle->output_buffer,
+			          '\t',
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = info_handle_source_path_append(
+			          info_handle,
+			          escape_mode,
+			          0,
+			          error );
+		}
+		if( ( result == 1 )
+		 && ( verified != 0 ) )
+		{
+			result = output_buffer_append_character(
+			          info_handle->output_buffer,
+			          '\t',
+			          error );
+		}
+	}
+	if( ( result == 1 )
+	 && ( utf8_string != NULL ) )
+	{
+		if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_NONE )
+		{
+			result = output_buffer_append_escaped_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_quoted_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+	}
+	if( ( result == 1 )
+	 && ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) )
+	{
+		result = output_buffer_append_character(
+		          info_handle->output_buffer,
+		          '}',
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = output_buffer_append_character(
+		          info_handle->output_buffer,
+		          '\n',
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append prefetch hash verification.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends the source path to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_source_path_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     uint8_t quote_string,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *utf8_string    = NULL;
+	size_t utf8_string_size = 0;
+#endif
+	static char *function   = "info_handle_source_path_append";
+	size_t source_length    = 0;
+	int result              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->source_path == NULL )
+	{
+		if( ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+		 || ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_SQL ) )
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? "null" : "NULL",
+			          4,
+			          error );
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	else
+	{
+		source_length = system_string_length(
+		                 info_handle->source_path );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libuna_utf8_string_size_from_utf16(
+		     (libuna_utf16_character_t *) info_handle->source_path,
+		     source_length + 1,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 source path size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 source path size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 source path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libuna_utf8_string_copy_from_utf16(
+		     (libuna_utf8_character_t *) utf8_string,
+		     utf8_string_size,
+		     (libuna_utf16_character_t *) info_handle->source_path,
+		     source_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 source path.",
+			 function );
+
+			goto on_error;
+		}
+		if( quote_string != 0 )
+		{
+			result = output_buffer_append_quoted_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_escaped_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+
+		memory_free(
+		 utf8_string );
+
+		utf8_string = NULL;
+#else
+		if( quote_string != 0 )
+		{
+			result = output_buffer_append_quoted_string(
+			          info_handle->output_buffer,
+			          (uint8_t *) info_handle->source_path,
+			          source_length,
+			          escape_mode,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_escaped_string(
+			          info_handle->output_buffer,
+			          (uint8_t *) info_handle->source_path,
+			          source_length,
+			          escape_mode,
+			          error );
+		}
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source path.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+#endif
+	return( -1 );
+}
+
+/* Appends the executable filename to the output buffer
+ * An executable filename that is not set is appended as null in JSON escape mode, as NULL in SQL escape mode
+ * or as an empty field otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_executable_filename_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     uint8_t quote_string,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "info_handle_executable_filename_append";
+	size_t utf8_string_size = 0;
+	int result              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_utf8_executable_filename_size(
+	     info_handle->input_file,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_size <= 1 )
+	{
+		if( ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+		 || ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_SQL ) )
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? "null" : "NULL",
+			          4,
+			          error );
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	else
+	{
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create executable filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_executable_filename(
+		     info_handle->input_file,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( quote_string != 0 )
+		{
+			result = output_buffer_append_quoted_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_escaped_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+		memory_free(
+		 utf8_string );
+
+		utf8_string = NULL;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append executable filename.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends the last run times as FILETIME values to the output buffer
+ * In JSON escape mode the values are appended as an array otherwise the values are separated by |
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_last_run_times_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     libcerror_error_t **error )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	static char *function   = "info_handle_last_run_times_append";
+	int filetime_index      = 0;
+	int number_of_filetimes = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_last_run_times(
+	     info_handle->input_file,
+	     filetimes,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		return( -1 );
+	}
+	if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+	{
+		if( output_buffer_append_character(
+		     info_handle->output_buffer,
+		     '[',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append array start.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		if( filetime_index > 0 )
+		{
+			if( output_buffer_append_character(
+			     info_handle->output_buffer,
+			     ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? ',' : '|',
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append separator.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( output_buffer_append_decimal(
+		     info_handle->output_buffer,
+		     filetimes[ filetime_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append last run time: %d.",
+			 function,
+			 filetime_index );
+
+			return( -1 );
+		}
+	}
+	if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+	{
+		if( output_buffer_append_character(
+		     info_handle->output_buffer,
+		     ']',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append array end.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the filenames to the output buffer
+ * In JSON escape mode the filenames are appended as an array otherwise as a single quoted field
+ * with the filenames separated by |
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_filenames_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     libcerror_error_t **error )
+{
+	size_t *utf8_string_offsets = NULL;
+	uint8_t *utf8_strings       = NULL;
+	static char *function       = "info_handle_filenames_append";
+	size_t utf8_string_length   = 0;
+	size_t utf8_strings_size    = 0;
+	int filename_index          = 0;
+	int number_of_filenames     = 0;
+	int result                  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_filenames(
+	     info_handle->input_file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_filenames > 0 )
+	{
+		if( (size_t) number_of_filenames > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of filenames value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table_size(
+		     info_handle->input_file,
+		     &utf8_strings_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_strings_size == 0 )
+		 || ( utf8_strings_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filenames table size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_strings = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * utf8_strings_size );
+
+		if( utf8_strings == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string_offsets = (size_t *) memory_allocate(
+		                                  sizeof( size_t ) * number_of_filenames );
+
+		if( utf8_string_offsets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename offsets.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table(
+		     info_handle->input_file,
+		     utf8_strings,
+		     utf8_strings_size,
+		     utf8_string_offsets,
+		     number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_character(
+	     info_handle->output_buffer,
+	     ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? '[' : '"',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filenames start.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( filename_index > 0 )
+		{
+			if( output_buffer_append_character(
+			     info_handle->output_buffer,
+			     ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? ',' : '|',
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append separator.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		utf8_string_length = narrow_string_length(
+		                      (char *) &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ) );
+
+		if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+		{
+			result = output_buffer_append_quoted_string(
+			          info_handle->output_buffer,
+			          &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+			          utf8_string_length,
+			          escape_mode,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_escaped_string(
+			          info_handle->output_buffer,
+			          &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+			          utf8_string_length,
+			          escape_mode,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_character(
+	     info_handle->output_buffer,
+	     ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? ']' : '"',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filenames end.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( -1 );
+}
+
+/* Appends the file metrics entries as a JSON array to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_metrics_jsonl_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t *file_references = NULL;
+	uint32_t *durations       = NULL;
+	uint32_t *flags           = NULL;
+	uint32_t *start_times     = NULL;
+	int *filename_indexes     = NULL;
+	static char *function     = "info_handle_file_metrics_jsonl_append";
+	int entry_index           = 0;
+	int number_of_entries     = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     info_handle->input_file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		if( (size_t) number_of_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of file metrics entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		start_times = (uint32_t *) memory_allocate(
+		                            sizeof( uint32_t ) * number_of_entries );
+
+		durations = (uint32_t *) memory_allocate(
+		                          sizeof( uint32_t ) * number_of_entries );
+
+		flags = (uint32_t *) memory_allocate(
+		                      sizeof( uint32_t ) * number_of_entries );
+
+		file_references = (uint64_t *) memory_allocate(
+		                                sizeof( uint64_t ) * number_of_entries );
+
+		filename_indexes = (int *) memory_allocate(
+		                            sizeof( int ) * number_of_entries );
+
+		if( ( start_times == NULL )
+		 || ( durations == NULL )
+		 || ( flags == NULL )
+		 || ( file_references == NULL )
+		 || ( filename_indexes == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file metrics columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_file_metrics_table(
+		     info_handle->input_file,
+		     start_times,
+		     durations,
+		     flags,
+		     file_references,
+		     filename_indexes,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_character(
+	     info_handle->output_buffer,
+	     '[',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array start.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( entry_index > 0 )
+		{
+			if( output_buffer_append_character(
+			     info_handle->output_buffer,
+			     ',',
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append separator.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       "{\"start_time\":",
+		       14,
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       (uint64_t) start_times[ entry_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ",\"duration\":",
+		       12,
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       (uint64_t) durations[ entry_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ",\"flags\":",
+		       9,
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       (uint64_t) flags[ entry_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ",\"file_reference\":",
+		       18,
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       file_references[ entry_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ",\"filename_index\":",
+		       18,
+		       error ) != 1 )
+		 || ( output_buffer_append_signed_decimal(
+		       info_handle->output_buffer,
+		       (int64_t) filename_indexes[ entry_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       info_handle->output_buffer,
+		       '}',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_character(
+	     info_handle->output_buffer,
+	     ']',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array end.",
+		 function );
+
+		goto on_error;
+	}
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		memory_free(
+		 flags );
+	}
+	if( durations != NULL )
+	{
+		memory_free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
+	}
+	return( 1 );
+
+on_error:
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		memory_free(
+		 flags );
+	}
+	if( durations != NULL )
+	{
+		memory_free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
+	}
+	return( -1 );
+}
+
+/* Appends the device path or a directory string of a volume to the output buffer
+ * The device path is appended if the directory string index is -1
+ * An empty string is appended as null in JSON escape mode or as NULL in SQL escape mode
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_string_append(
+     info_handle_t *info_handle,
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     int escape_mode,
+     uint8_t quote_string,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string    = NULL;
+	static char *function   = "info_handle_volume_string_append";
+	size_t utf8_string_size = 0;
+	int result              = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_string_index == -1 )
+	{
+		result = libscca_volume_information_get_utf8_device_path_size(
+		          volume_information,
+		          &utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libscca_volume_information_get_utf8_directory_string_size(
+		          volume_information,
+		          directory_string_index,
+		          &utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_size <= 1 )
+	{
+		if( ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+		 || ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_SQL ) )
+		{
+			result = output_buffer_append_string(
+			          info_handle->output_buffer,
+			          ( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON ) ? "null" : "NULL",
+			          4,
+			          error );
+		}
+		else
+		{
+			result = 1;
+		}
+	}
+	else
+	{
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string.",
+			 function );
+
+			goto on_error;
+		}
+		if( directory_string_index == -1 )
+		{
+			result = libscca_volume_information_get_utf8_device_path(
+			          volume_information,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		else
+		{
+			result = libscca_volume_information_get_utf8_directory_string(
+			          volume_information,
+			          directory_string_index,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string.",
+			 function );
+
+			goto on_error;
+		}
+		if( quote_string != 0 )
+		{
+			result = output_buffer_append_quoted_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_escaped_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          escape_mode,
+			          error );
+		}
+		memory_free(
+		 utf8_string );
+
+		utf8_string = NULL;
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends the volumes as a JSON array to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volumes_jsonl_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	uint64_t *file_references                        = NULL;
+	static char *function                            = "info_handle_volumes_jsonl_append";
+	uint64_t value_64bit                             = 0;
+	uint32_t value_32bit                             = 0;
+	int directory_string_index                       = 0;
+	int file_reference_index                         = 0;
+	int number_of_directory_strings                  = 0;
+	int number_of_file_references                    = 0;
+	int number_of_volumes                            = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_character(
+	     info_handle->output_buffer,
+	     '[',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array start.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     info_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_creation_time(
+		     volume_information,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_serial_number(
+		     volume_information,
+		     &value_32bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve serial number.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( ( volume_index > 0 )
+		  &&  ( output_buffer_append_character(
+		         info_handle->output_buffer,
+		         ',',
+		         error ) != 1 ) )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       "{\"device_path\":",
+		       15,
+		       error ) != 1 )
+		 || ( info_handle_volume_string_append(
+		       info_handle,
+		       volume_information,
+		       -1,
+		       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+		       1,
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ",\"creation_time\":",
+		       17,
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       value_64bit,
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ",\"serial_number\":\"",
+		       18,
+		       error ) != 1 )
+		 || ( output_buffer_append_hexadecimal_32bit(
+		       info_handle->output_buffer,
+		       value_32bit,
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       "\",\"file_references\":[",
+		       21,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %d values.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_number_of_file_references(
+		     volume_information,
+		     &number_of_file_references,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file references.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_file_references > 0 )
+		{
+			if( (size_t) number_of_file_references > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid number of file references value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			file_references = (uint64_t *) memory_allocate(
+			                                sizeof( uint64_t ) * number_of_file_references );
+
+			if( file_references == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create file references.",
+				 function );
+
+				goto on_error;
+			}
+			if( libscca_volume_information_copy_file_references(
+			     volume_information,
+			     file_references,
+			     number_of_file_references,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy file references.",
+				 function );
+
+				goto on_error;
+			}
+			for( file_reference_index = 0;
+			     file_reference_index < number_of_file_references;
+			     file_reference_index++ )
+			{
+				if( ( ( file_reference_index > 0 )
+				  &&  ( output_buffer_append_character(
+				         info_handle->output_buffer,
+				         ',',
+				         error ) != 1 ) )
+				 || ( output_buffer_append_decimal(
+				       info_handle->output_buffer,
+				       file_references[ file_reference_index ],
+				       error ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append file reference: %d.",
+					 function,
+					 file_reference_index );
+
+					goto on_error;
+				}
+			}
+			memory_free(
+			 file_references );
+
+			file_references = NULL;
+		}
+		if( output_buffer_append_string(
+		     info_handle->output_buffer,
+		     "],\"directory_strings\":[",
+		     23,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory strings name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_number_of_directory_strings(
+		     volume_information,
+		     &number_of_directory_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of directory strings.",
+			 function );
+
+			goto on_error;
+		}
+		for( directory_string_index = 0;
+		     directory_string_index < number_of_directory_strings;
+		     directory_string_index++ )
+		{
+			if( ( ( directory_string_index > 0 )
+			  &&  ( output_buffer_append_character(
+			         info_handle->output_buffer,
+			         ',',
+			         error ) != 1 ) )
+			 || ( info_handle_volume_string_append(
+			       info_handle,
+			       volume_information,
+			       directory_string_index,
+			       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+			       1,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory string: %d.",
+				 function,
+				 directory_string_index );
+
+				goto on_error;
+			}
+		}
+		if( output_buffer_append_string(
+		     info_handle->output_buffer,
+		     "]}",
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume end.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_character(
+	     info_handle->output_buffer,
+	     ']',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array end.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the volumes as CSV fields to the output buffer
+ * The fields are the number of volumes, the device paths, the serial numbers and
+ * the creation times, where the values of the different volumes are separated by |
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volumes_csv_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	static char *function                            = "info_handle_volumes_csv_append";
+	uint64_t value_64bit                             = 0;
+	uint32_t value_32bit                             = 0;
+	int field_index                                  = 0;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_append_signed_decimal(
+	     info_handle->output_buffer,
+	     (int64_t) number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	/* Field 0 contains the device paths, field 1 the serial numbers and field 2 the creation times
+	 */
+	for( field_index = 0;
+	     field_index < 3;
+	     field_index++ )
+	{
+		if( output_buffer_append_string(
+		     info_handle->output_buffer,
+		     ( field_index == 0 ) ? ",\"" : ",",
+		     ( field_index == 0 ) ? 2 : 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append field start.",
+			 function );
+
+			goto on_error;
+		}
+		for( volume_index = 0;
+		     volume_index < number_of_volumes;
+		     volume_index++ )
+		{
+			if( libscca_file_get_volume_information(
+			     info_handle->input_file,
+			     volume_index,
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d information.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			if( volume_index > 0 )
+			{
+				if( output_buffer_append_character(
+				     info_handle->output_buffer,
+				     '|',
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append separator.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( field_index == 0 )
+			{
+				result = info_handle_volume_string_append(
+				          info_handle,
+				          volume_information,
+				          -1,
+				          OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+				          0,
+				          error );
+			}
+			else if( field_index == 1 )
+			{
+				result = libscca_volume_information_get_serial_number(
+				          volume_information,
+				          &value_32bit,
+				          error );
+
+				if( result == 1 )
+				{
+					result = output_buffer_append_hexadecimal_32bit(
+					          info_handle->output_buffer,
+					          value_32bit,
+					          error );
+				}
+			}
+			else
+			{
+				result = libscca_volume_information_get_creation_time(
+				          volume_information,
+				          &value_64bit,
+				          error );
+
+				if( result == 1 )
+				{
+					result = output_buffer_append_decimal(
+					          info_handle->output_buffer,
+					          value_64bit,
+					          error );
+				}
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append volume: %d value.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			if( libscca_volume_information_free(
+			     &volume_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume information.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( field_index == 0 )
+		{
+			if( output_buffer_append_character(
+			     info_handle->output_buffer,
+			     '"',
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append field end.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the CSV header
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_csv_header_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *header    = NULL;
+	static char *function = "info_handle_csv_header_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->verify_prefetch_hash != 0 )
+	{
+		header = "source,prefetch_hash,verified,executable_path\n";
+	}
+	else
+	{
+		header = "source,format_version,prefetch_hash,executable_filename,run_count,last_run_times,"
+		         "number_of_file_metrics_entries,number_of_filenames,filenames,number_of_volumes,"
+		         "volume_device_paths,volume_serial_numbers,volume_creation_times\n";
+	}
+	if( info_handle_output_string_write(
+	     info_handle,
+	     header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write CSV header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the file information as a single CSV record to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_csv_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "info_handle_file_csv_append";
+	uint32_t format_version = 0;
+	uint32_t prefetch_hash  = 0;
+	uint32_t run_count      = 0;
+	int number_of_entries   = 0;
+	int number_of_filenames = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_format_version(
+	     info_handle->input_file,
+	     &format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_prefetch_hash(
+	     info_handle->input_file,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_run_count(
+	     info_handle->input_file,
+	     &run_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     info_handle->input_file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_filenames(
+	     info_handle->input_file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle_source_path_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) format_version,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_hexadecimal_32bit(
+	       info_handle->output_buffer,
+	       prefetch_hash,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( info_handle_executable_filename_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) run_count,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( info_handle_last_run_times_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_signed_decimal(
+	       info_handle->output_buffer,
+	       (int64_t) number_of_entries,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_signed_decimal(
+	       info_handle->output_buffer,
+	       (int64_t) number_of_filenames,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( info_handle_filenames_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( info_handle_volumes_csv_append(
+	       info_handle,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the file information as a single JSON Lines record to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_jsonl_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "info_handle_file_jsonl_append";
+	uint32_t format_version = 0;
+	uint32_t prefetch_hash  = 0;
+	uint32_t run_count      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_format_version(
+	     info_handle->input_file,
+	     &format_version,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_prefetch_hash(
+	     info_handle->input_file,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_run_count(
+	     info_handle->input_file,
+	     &run_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       "{\"source\":",
+	       10,
+	       error ) != 1 )
+	 || ( info_handle_source_path_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"format_version\":",
+	       18,
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) format_version,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"prefetch_hash\":\"",
+	       18,
+	       error ) != 1 )
+	 || ( output_buffer_append_hexadecimal_32bit(
+	       info_handle->output_buffer,
+	       prefetch_hash,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       "\",\"executable_filename\":",
+	       24,
+	       error ) != 1 )
+	 || ( info_handle_executable_filename_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"run_count\":",
+	       13,
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) run_count,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"last_run_times\":",
+	       18,
+	       error ) != 1 )
+	 || ( info_handle_last_run_times_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"file_metrics\":",
+	       16,
+	       error ) != 1 )
+	 || ( info_handle_file_metrics_jsonl_append(
+	       info_handle,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"filenames\":",
+	       13,
+	       error ) != 1 )
+	 || ( info_handle_filenames_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ",\"volumes\":",
+	       11,
+	       error ) != 1 )
+	 || ( info_handle_volumes_jsonl_append(
+	       info_handle,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       "}\n",
+	       2,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a FILETIME value as a POSIX timestamp in seconds to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_filetime_bodyfile_append(
+     info_handle_t *info_handle,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_filetime_bodyfile_append";
+	int64_t timestamp     = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The FILETIME is the number of 100 nano seconds since January 1, 1601
+	 * and January 1, 1970 is 11644473600 seconds later
+	 */
+	timestamp = (int64_t) ( filetime / 10000000UL ) - (int64_t) 11644473600L;
+
+	if( output_buffer_append_signed_decimal(
+	     info_handle->output_buffer,
+	     timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the file information as bodyfile lines to the output buffer
+ * A line is appended for every last run time and volume creation time that is set
+ * The format of a line is: MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
+ * where the last run time is stored as atime and the volume creation time as crtime
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_bodyfile_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	libscca_volume_information_t *volume_information = NULL;
+	output_buffer_t *output_buffer                   = NULL;
+	static char *function                            = "info_handle_file_bodyfile_append";
+	uint64_t creation_time                           = 0;
+	int filetime_index                               = 0;
+	int number_of_filetimes                          = 0;
+	int number_of_volumes                            = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer = info_handle->output_buffer;
+
+	if( libscca_file_get_last_run_times(
+	     info_handle->input_file,
+	     filetimes,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		goto on_error;
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		if( filetimes[ filetime_index ] == 0 )
+		{
+			continue;
+		}
+		if( ( output_buffer_append_string(
+		       output_buffer,
+		       "0|",
+		       2,
+		       error ) != 1 )
+		 || ( info_handle_source_path_append(
+		       info_handle,
+		       OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE,
+		       0,
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       output_buffer,
+		       ": ",
+		       2,
+		       error ) != 1 )
+		 || ( info_handle_executable_filename_append(
+		       info_handle,
+		       OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE,
+		       0,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       " last run time: ",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       (uint64_t) filetime_index + 1,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "|0|0|0|0|0|",
+		       error ) != 1 )
+		 || ( info_handle_filetime_bodyfile_append(
+		       info_handle,
+		       filetimes[ filetime_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "|0|0|0\n",
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append last run time: %d line.",
+			 function,
+			 filetime_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     info_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_creation_time(
+		     volume_information,
+		     &creation_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d creation time.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( creation_time != 0 )
+		{
+			if( ( output_buffer_append_string(
+			       output_buffer,
+			       "0|",
+			       2,
+			       error ) != 1 )
+			 || ( info_handle_source_path_append(
+			       info_handle,
+			       OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE,
+			       0,
+			       error ) != 1 )
+			 || ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       ": volume: ",
+			       error ) != 1 )
+			 || ( output_buffer_append_decimal(
+			       output_buffer,
+			       (uint64_t) volume_index + 1,
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       output_buffer,
+			       ' ',
+			       error ) != 1 )
+			 || ( info_handle_volume_string_append(
+			       info_handle,
+			       volume_information,
+			       -1,
+			       OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE,
+			       0,
+			       error ) != 1 )
+			 || ( output_buffer_append_narrow_string(
+			       output_buffer,
+			       " creation time|0|0|0|0|0|0|0|0|",
+			       error ) != 1 )
+			 || ( info_handle_filetime_bodyfile_append(
+			       info_handle,
+			       creation_time,
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       output_buffer,
+			       '\n',
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append volume: %d creation time line.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the SQL statements that precede the records
+ * The statements configure SQLite for bulk loading, create the tables and start a transaction
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_sql_header_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_sql_header_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_string_write(
+	     info_handle,
+	     "PRAGMA journal_mode=WAL;\n"
+	     "PRAGMA synchronous=OFF;\n"
+	     "CREATE TABLE IF NOT EXISTS files(file_id INTEGER PRIMARY KEY,source TEXT,"
+	     "format_version INTEGER,prefetch_hash INTEGER,executable_filename TEXT,run_count INTEGER);\n"
+	     "CREATE TABLE IF NOT EXISTS runs(file_id INTEGER,run_index INTEGER,last_run_time INTEGER);\n"
+	     "CREATE TABLE IF NOT EXISTS filenames(filename_id INTEGER PRIMARY KEY,filename TEXT UNIQUE);\n"
+	     "CREATE TABLE IF NOT EXISTS metrics(file_id INTEGER,entry_index INTEGER,start_time INTEGER,"
+	     "duration INTEGER,flags INTEGER,file_reference INTEGER,filename_id INTEGER);\n"
+	     "CREATE TABLE IF NOT EXISTS volumes(file_id INTEGER,volume_index INTEGER,device_path TEXT,"
+	     "serial_number INTEGER,creation_time INTEGER);\n"
+	     "CREATE TABLE IF NOT EXISTS directories(file_id INTEGER,volume_index INTEGER,directory TEXT);\n"
+	     "BEGIN TRANSACTION;\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write SQL header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the SQL statements that follow the records
+ * The statements commit the transaction and create the indexes after the bulk load
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_sql_footer_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_sql_footer_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_output_string_write(
+	     info_handle,
+	     "COMMIT;\n"
+	     "CREATE INDEX IF NOT EXISTS runs_file_id ON runs(file_id);\n"
+	     "CREATE INDEX IF NOT EXISTS metrics_file_id ON metrics(file_id);\n"
+	     "CREATE INDEX IF NOT EXISTS metrics_filename_id ON metrics(filename_id);\n"
+	     "CREATE INDEX IF NOT EXISTS volumes_file_id ON volumes(file_id);\n"
+	     "CREATE INDEX IF NOT EXISTS directories_file_id ON directories(file_id);\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write SQL footer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the last run times as an SQL statement to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_runs_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	static char *function   = "info_handle_runs_sql_append";
+	int filetime_index      = 0;
+	int number_of_filetimes = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_last_run_times(
+	     info_handle->input_file,
+	     filetimes,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &number_of_filetimes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filetimes == 0 )
+	{
+		return( 1 );
+	}
+	if( output_buffer_append_narrow_string(
+	     info_handle->output_buffer,
+	     "INSERT INTO runs VALUES",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append statement.",
+		 function );
+
+		return( -1 );
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		if( ( output_buffer_append_narrow_string(
+		       info_handle->output_buffer,
+		       ( filetime_index == 0 ) ? "(" INFO_HANDLE_SQL_FILE_IDENTIFIER "," : ",(" INFO_HANDLE_SQL_FILE_IDENTIFIER ",",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       (uint64_t) filetime_index,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       info_handle->output_buffer,
+		       ',',
+		       error ) != 1 )
+		 || ( output_buffer_append_signed_decimal(
+		       info_handle->output_buffer,
+		       (int64_t) filetimes[ filetime_index ],
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       info_handle->output_buffer,
+		       ')',
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append last run time: %d.",
+			 function,
+			 filetime_index );
+
+			return( -1 );
+		}
+	}
+	if( output_buffer_append_string(
+	     info_handle->output_buffer,
+	     ";\n",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append statement end.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the filenames and file metrics entries as SQL statements to the output buffer
+ * The filenames are shared by all files, the file metrics entries reference the filename
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_metrics_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint64_t *file_references   = NULL;
+	uint32_t *durations         = NULL;
+	uint32_t *flags             = NULL;
+	uint32_t *start_times       = NULL;
+	uint8_t *utf8_strings       = NULL;
+	size_t *utf8_string_offsets = NULL;
+	int *filename_indexes       = NULL;
+	static char *function       = "info_handle_file_metrics_sql_append";
+	size_t utf8_string_length   = 0;
+	size_t utf8_strings_size    = 0;
+	int entry_index             = 0;
+	int filename_index          = 0;
+	int number_of_entries       = 0;
+	int number_of_filenames     = 0;
+	int result                  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_filenames(
+	     info_handle->input_file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_filenames > 0 )
+	{
+		if( (size_t) number_of_filenames > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of filenames value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table_size(
+		     info_handle->input_file,
+		     &utf8_strings_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_strings_size == 0 )
+		 || ( utf8_strings_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filenames table size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_strings = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * utf8_strings_size );
+
+		utf8_string_offsets = (size_t *) memory_allocate(
+		                                  sizeof( size_t ) * number_of_filenames );
+
+		if( ( utf8_strings == NULL )
+		 || ( utf8_string_offsets == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table(
+		     info_handle->input_file,
+		     utf8_strings,
+		     utf8_strings_size,
+		     utf8_string_offsets,
+		     number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_narrow_string(
+		     info_handle->output_buffer,
+		     "INSERT OR IGNORE INTO filenames(filename) VALUES",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filenames statement.",
+			 function );
+
+			goto on_error;
+		}
+		for( filename_index = 0;
+		     filename_index < number_of_filenames;
+		     filename_index++ )
+		{
+			utf8_string_length = narrow_string_length(
+			                      (char *) &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ) );
+
+			if( ( output_buffer_append_string(
+			       info_handle->output_buffer,
+			       ( filename_index == 0 ) ? "(" : ",(",
+			       ( filename_index == 0 ) ? 1 : 2,
+			       error ) != 1 )
+			 || ( output_buffer_append_quoted_string(
+			       info_handle->output_buffer,
+			       &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+			       utf8_string_length,
+			       OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       info_handle->output_buffer,
+			       ')',
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append filename: %d.",
+				 function,
+				 filename_index );
+
+				goto on_error;
+			}
+		}
+		if( output_buffer_append_string(
+		     info_handle->output_buffer,
+		     ";\n",
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append statement end.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     info_handle->input_file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		if( (size_t) number_of_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of file metrics entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		start_times = (uint32_t *) memory_allocate(
+		                            sizeof( uint32_t ) * number_of_entries );
+
+		durations = (uint32_t *) memory_allocate(
+		                          sizeof( uint32_t ) * number_of_entries );
+
+		flags = (uint32_t *) memory_allocate(
+		                      sizeof( uint32_t ) * number_of_entries );
+
+		file_references = (uint64_t *) memory_allocate(
+		                                sizeof( uint64_t ) * number_of_entries );
+
+		filename_indexes = (int *) memory_allocate(
+		                            sizeof( int ) * number_of_entries );
+
+		if( ( start_times == NULL )
+		 || ( durations == NULL )
+		 || ( flags == NULL )
+		 || ( file_references == NULL )
+		 || ( filename_indexes == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file metrics columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_file_metrics_table(
+		     info_handle->input_file,
+		     start_times,
+		     durations,
+		     flags,
+		     file_references,
+		     filename_indexes,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics table.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_append_narrow_string(
+		     info_handle->output_buffer,
+		     "INSERT INTO metrics VALUES",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file metrics statement.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			result = output_buffer_append_narrow_string(
+			          info_handle->output_buffer,
+			          ( entry_index == 0 ) ? "(" INFO_HANDLE_SQL_FILE_IDENTIFIER "," : ",(" INFO_HANDLE_SQL_FILE_IDENTIFIER ",",
+			          error );
+
+			if( result == 1 )
+			{
+				result = output_buffer_append_decimal(
+				          info_handle->output_buffer,
+				          (uint64_t) entry_index,
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_character(
+				          info_handle->output_buffer,
+				          ',',
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_decimal(
+				          info_handle->output_buffer,
+				          (uint64_t) start_times[ entry_index ],
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_character(
+				          info_handle->output_buffer,
+				          ',',
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_decimal(
+				          info_handle->output_buffer,
+				          (uint64_t) durations[ entry_index ],
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_character(
+				          info_handle->output_buffer,
+				          ',',
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_decimal(
+				          info_handle->output_buffer,
+				          (uint64_t) flags[ entry_index ],
+				          error );
+			}
+			if( result == 1 )
+			{
+				result = output_buffer_append_character(
+				          info_handle->output_buffer,
+				          ',',
+				          error );
+			}
+			/* SQLite integers are signed 64-bit values, hence the file reference
+			 * is stored as a signed value to prevent it from being converted into a real
+			 */
+			if( result == 1 )
+			{
+				result = output_buffer_append_signed_decimal(
+				          info_handle->output_buffer,
+				          (int64_t) file_references[ entry_index ],
+				          error );
+			}
+			if( result == 1 )
+			{
+				filename_index = filename_indexes[ entry_index ];
+
+				if( ( filename_index >= 0 )
+				 && ( filename_index < number_of_filenames ) )
+				{
+					utf8_string_length = narrow_string_length(
+					                      (char *) &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ) );
+
+					result = output_buffer_append_narrow_string(
+					          info_handle->output_buffer,
+					          ",(SELECT filename_id FROM filenames WHERE filename=",
+					          error );
+
+					if( result == 1 )
+					{
+						result = output_buffer_append_quoted_string(
+						          info_handle->output_buffer,
+						          &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+						          utf8_string_length,
+						          OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+						          error );
+					}
+					if( result == 1 )
+					{
+						result = output_buffer_append_string(
+						          info_handle->output_buffer,
+						          "))",
+						          2,
+						          error );
+					}
+				}
+				else
+				{
+					result = output_buffer_append_string(
+					          info_handle->output_buffer,
+					          ",NULL)",
+					          6,
+					          error );
+				}
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append file metrics entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( output_buffer_append_string(
+		     info_handle->output_buffer,
+		     ";\n",
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append statement end.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		memory_free(
+		 flags );
+	}
+	if( durations != NULL )
+	{
+		memory_free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( 1 );
+
+on_error:
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		memory_free(
+		 flags );
+	}
+	if( durations != NULL )
+	{
+		memory_free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( -1 );
+}
+
+/* Appends the volumes and their directory strings as SQL statements to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volumes_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	static char *function                            = "info_handle_volumes_sql_append";
+	uint64_t creation_time                           = 0;
+	uint32_t serial_number                           = 0;
+	int directory_string_index                       = 0;
+	int number_of_directory_strings                  = 0;
+	int number_of_volumes                            = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_volumes(
+	     info_handle->input_file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     info_handle->input_file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( ( libscca_volume_information_get_serial_number(
+		       volume_information,
+		       &serial_number,
+		       error ) != 1 )
+		 || ( libscca_volume_information_get_creation_time(
+		       volume_information,
+		       &creation_time,
+		       error ) != 1 )
+		 || ( libscca_volume_information_get_number_of_directory_strings(
+		       volume_information,
+		       &number_of_directory_strings,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d values.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( ( output_buffer_append_narrow_string(
+		       info_handle->output_buffer,
+		       "INSERT INTO volumes VALUES(" INFO_HANDLE_SQL_FILE_IDENTIFIER ",",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       (uint64_t) volume_index,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       info_handle->output_buffer,
+		       ',',
+		       error ) != 1 )
+		 || ( info_handle_volume_string_append(
+		       info_handle,
+		       volume_information,
+		       -1,
+		       OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+		       1,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       info_handle->output_buffer,
+		       ',',
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       info_handle->output_buffer,
+		       (uint64_t) serial_number,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       info_handle->output_buffer,
+		       ',',
+		       error ) != 1 )
+		 || ( output_buffer_append_signed_decimal(
+		       info_handle->output_buffer,
+		       (int64_t) creation_time,
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       info_handle->output_buffer,
+		       ");\n",
+		       3,
+		       error ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( number_of_directory_strings > 0 )
+		{
+			if( output_buffer_append_narrow_string(
+			     info_handle->output_buffer,
+			     "INSERT INTO directories VALUES",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directories statement.",
+				 function );
+
+				goto on_error;
+			}
+			for( directory_string_index = 0;
+			     directory_string_index < number_of_directory_strings;
+			     directory_string_index++ )
+			{
+				if( ( output_buffer_append_narrow_string(
+				       info_handle->output_buffer,
+				       ( directory_string_index == 0 ) ? "(" INFO_HANDLE_SQL_FILE_IDENTIFIER "," : ",(" INFO_HANDLE_SQL_FILE_IDENTIFIER ",",
+				       error ) != 1 )
+				 || ( output_buffer_append_decimal(
+				       info_handle->output_buffer,
+				       (uint64_t) volume_index,
+				       error ) != 1 )
+				 || ( output_buffer_append_character(
+				       info_handle->output_buffer,
+				       ',',
+				       error ) != 1 )
+				 || ( info_handle_volume_string_append(
+				       info_handle,
+				       volume_information,
+				       directory_string_index,
+				       OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+				       1,
+				       error ) != 1 )
+				 || ( output_buffer_append_character(
+				       info_handle->output_buffer,
+				       ')',
+				       error ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append directory string: %d.",
+					 function,
+					 directory_string_index );
+
+					goto on_error;
+				}
+			}
+			if( output_buffer_append_string(
+			     info_handle->output_buffer,
+			     ";\n",
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append statement end.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends the file information as SQL statements to the output buffer
+ * The file is inserted first so that the other statements can reference it as the file
+ * with the largest identifier, which requires the statements of a file to be consecutive
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "info_handle_file_sql_append";
+	uint32_t format_version = 0;
+	uint32_t prefetch_hash  = 0;
+	uint32_t run_count      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libscca_file_get_format_version(
+	       info_handle->input_file,
+	       &format_version,
+	       error ) != 1 )
+	 || ( libscca_file_get_prefetch_hash(
+	       info_handle->input_file,
+	       &prefetch_hash,
+	       error ) != 1 )
+	 || ( libscca_file_get_run_count(
+	       info_handle->input_file,
+	       &run_count,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer_append_narrow_string(
+	       info_handle->output_buffer,
+	       "INSERT INTO files VALUES(NULL,",
+	       error ) != 1 )
+	 || ( info_handle_source_path_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) format_version,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) prefetch_hash,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( info_handle_executable_filename_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       info_handle->output_buffer,
+	       ',',
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       info_handle->output_buffer,
+	       (uint64_t) run_count,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       info_handle->output_buffer,
+	       ");\n",
+	       3,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file statement.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle_runs_sql_append(
+	       info_handle,
+	       error ) != 1 )
+	 || ( info_handle_file_metrics_sql_append(
+	       info_handle,
+	       error ) != 1 )
+	 || ( info_handle_volumes_sql_append(
+	       info_handle,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file statements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the Arrow writer and its columns
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_arrow_writer_open(
+     info_handle_t *info_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	const char *column_names[ INFO_HANDLE_NUMBER_OF_ARROW_COLUMNS ] = {
+		"source", "format_version", "prefetch_hash", "executable_filename", "run_count",
+		"last_run_time", "start_time", "duration", "flags", "file_reference", "filename",
+		"volume_device_path", "volume_serial_number", "volume_creation_time" };
+
+	int column_types[ INFO_HANDLE_NUMBER_OF_ARROW_COLUMNS ] = {
+		ARROW_WRITER_COLUMN_TYPE_STRING, ARROW_WRITER_COLUMN_TYPE_UINT32,
+		ARROW_WRITER_COLUMN_TYPE_UINT32, ARROW_WRITER_COLUMN_TYPE_STRING,
+		ARROW_WRITER_COLUMN_TYPE_UINT32, ARROW_WRITER_COLUMN_TYPE_UINT64,
+		ARROW_WRITER_COLUMN_TYPE_UINT32, ARROW_WRITER_COLUMN_TYPE_UINT32,
+		ARROW_WRITER_COLUMN_TYPE_UINT32, ARROW_WRITER_COLUMN_TYPE_UINT64,
+		ARROW_WRITER_COLUMN_TYPE_STRING, ARROW_WRITER_COLUMN_TYPE_STRING,
+		ARROW_WRITER_COLUMN_TYPE_UINT32, ARROW_WRITER_COLUMN_TYPE_UINT64 };
+
+	static char *function = "info_handle_arrow_writer_open";
+	int column_index      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->arrow_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - Arrow writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arrow_writer_initialize(
+	     &( info_handle->arrow_writer ),
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize Arrow writer.",
+		 function );
+
+		goto on_error;
+	}
+	for( column_index = 0;
+	     column_index < INFO_HANDLE_NUMBER_OF_ARROW_COLUMNS;
+	     column_index++ )
+	{
+		if( arrow_writer_append_column(
+		     info_handle->arrow_writer,
+		     column_names[ column_index ],
+		     column_types[ column_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append column: %s.",
+			 function,
+			 column_names[ column_index ] );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &( info_handle->arrow_writer ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the remaining rows and frees the Arrow writer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_arrow_writer_close(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_arrow_writer_close";
+	int result            = 1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->arrow_writer == NULL )
+	{
+		return( 1 );
+	}
+	if( arrow_writer_close(
+	     info_handle->arrow_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close Arrow writer.",
+		 function );
+
+		result = -1;
+	}
+	if( arrow_writer_free(
+	     &( info_handle->arrow_writer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free Arrow writer.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Creates the gzip writer that compresses the output written to the stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_gzip_writer_open(
+     info_handle_t *info_handle,
+     FILE *stream,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_gzip_writer_open";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->gzip_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - gzip writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( gzip_writer_initialize(
+	     &( info_handle->gzip_writer ),
+	     stream,
+	     compression_level,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize gzip writer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the remaining compressed output and frees the gzip writer
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_gzip_writer_close(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_gzip_writer_close";
+	int result            = 1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->gzip_writer == NULL )
+	{
+		return( 1 );
+	}
+	if( gzip_writer_close(
+	     info_handle->gzip_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close gzip writer.",
+		 function );
+
+		result = -1;
+	}
+	if( gzip_writer_free(
+	     &( info_handle->gzip_writer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free gzip writer.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes a string to the notification stream or to the gzip writer if set
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_string_write(
+     info_handle_t *info_handle,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_string_write";
+	size_t string_length  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( info_handle->gzip_writer != NULL )
+	{
+		if( gzip_writer_write(
+		     info_handle->gzip_writer,
+		     (const uint8_t *) string,
+		     string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write string to gzip writer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( fwrite(
+	     string,
+	     1,
+	     string_length,
+	     info_handle->notify_stream ) != string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an output buffer, in Arrow output format the encoded rows in the output buffer
+ * are appended to the Arrow writer instead and if set the gzip writer compresses the output
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_output_buffer_write(
+     info_handle_t *info_handle,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_output_buffer_write";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_ARROW )
+	 && ( info_handle->verify_prefetch_hash == 0 ) )
+	{
+		if( arrow_writer_append_encoded_rows(
+		     info_handle->arrow_writer,
+		     output_buffer->data,
+		     output_buffer->data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append rows to Arrow writer.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_offset = 0;
+
+		return( 1 );
+	}
+	if( info_handle->gzip_writer != NULL )
+	{
+		if( gzip_writer_write(
+		     info_handle->gzip_writer,
+		     output_buffer->data,
+		     output_buffer->data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write output buffer to gzip writer.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_offset = 0;
+
+		return( 1 );
+	}
+	if( output_buffer_write(
+	     output_buffer,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the length of an encoded Arrow string value in the output buffer
+ * The string is appended after the 32-bit length at the length offset
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_arrow_string_length_set(
+     info_handle_t *info_handle,
+     size_t length_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_arrow_string_length_set";
+	size_t string_length  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( length_offset + 4 ) > info_handle->output_buffer->data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid length offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = info_handle->output_buffer->data_offset - ( length_offset + 4 );
+
+	if( string_length > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( info_handle->output_buffer->data[ length_offset ] ),
+	 (uint32_t) string_length );
+
+	return( 1 );
+}
+
+/* Appends the file information as encoded Arrow rows to the output buffer
+ * Every file metrics entry is stored as a row together with the file values,
+ * its filename and the volume that contains the filename
+ * A file without file metrics entries is stored as a single row
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_arrow_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	output_buffer_t *volume_device_paths             = NULL;
+	uint64_t *file_references                        = NULL;
+	uint64_t *volume_creation_times                  = NULL;
+	uint32_t *durations                              = NULL;
+	uint32_t *flags                                  = NULL;
+	uint32_t *start_times                            = NULL;
+	uint32_t *volume_serial_numbers                  = NULL;
+	uint8_t *utf8_string                             = NULL;
+	uint8_t *utf8_strings                            = NULL;
+	size_t *utf8_string_offsets                      = NULL;
+	size_t *volume_device_path_offsets               = NULL;
+	int *filename_indexes                            = NULL;
+	static char *function                            = "info_handle_file_arrow_append";
+	size_t length_offset                             = 0;
+	size_t row_offset                                = 0;
+	size_t row_values_size                           = 0;
+	size_t utf8_string_length                        = 0;
+	size_t utf8_string_size                          = 0;
+	size_t utf8_strings_size                         = 0;
+	size_t volume_device_path_length                 = 0;
+	uint64_t last_run_time                           = 0;
+	uint32_t format_version                          = 0;
+	uint32_t prefetch_hash                           = 0;
+	uint32_t run_count                               = 0;
+	int entry_index                                  = 0;
+	int filename_index                               = 0;
+	int number_of_entries                            = 0;
+	int number_of_filenames                          = 0;
+	int number_of_rows                               = 0;
+	int number_of_volumes                            = 0;
+	int result                                       = 0;
+	int volume_index                                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid info handle - missing output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libscca_file_get_format_version(
+	       info_handle->input_file,
+	       &format_version,
+	       error ) != 1 )
+	 || ( libscca_file_get_prefetch_hash(
+	       info_handle->input_file,
+	       &prefetch_hash,
+	       error ) != 1 )
+	 || ( libscca_file_get_run_count(
+	       info_handle->input_file,
+	       &run_count,
+	       error ) != 1 )
+	 || ( libscca_file_get_last_run_time(
+	       info_handle->input_file,
+	       0,
+	       &last_run_time,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file values.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     info_handle->input_file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		if( (size_t) number_of_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of file metrics entries value exceeds maximum.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libscca_file_get_utf16_executable_filename(
-			  info_handle->input_file,
-			  (uint16_t *) value_string,
-			  value_string_size,
-			  error );
-#else
-		result = libscca_file_get_utf8_executable_filename(
-			  info_handle->input_file,
-			  (uint8_t *) value_string,
-			  value_string_size,
-			  error );
-#endif
-		if( result != 1 )
+		start_times = (uint32_t *) memory_allocate(
+		                            sizeof( uint32_t ) * number_of_entries );
+
+		durations = (uint32_t *) memory_allocate(
+		                          sizeof( uint32_t ) * number_of_entries );
+
+		flags = (uint32_t *) memory_allocate(
+		                      sizeof( uint32_t ) * number_of_entries );
+
+		file_references = (uint64_t *) memory_allocate(
+		                                sizeof( uint64_t ) * number_of_entries );
+
+		filename_indexes = (int *) memory_allocate(
+		                            sizeof( int ) * number_of_entries );
+
+		if( ( start_times == NULL )
+		 || ( durations == NULL )
+		 || ( flags == NULL )
+		 || ( file_references == NULL )
+		 || ( filename_indexes == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create file metrics columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_file_metrics_table(
+		     info_handle->input_file,
+		     start_times,
+		     durations,
+		     flags,
+		     file_references,
+		     filename_indexes,
+		     number_of_entries,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve executable filename.",
+			 "%s: unable to retrieve file metrics table.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tExecutable filename\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
-
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
 	}
-	if( libscca_file_get_run_count(
+	if( libscca_file_get_number_of_filenames(
 	     info_handle->input_file,
-	     &value_32bit,
+	     &number_of_filenames,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve run count.",
+		 "%s: unable to retrieve number of filenames.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tRun count\t\t\t: %" PRIu32 "\n",
-	 value_32bit );
-
-	if( format_version < 26 )
-	{
-		number_of_last_run_times = 1;
-	}
-	else
-	{
-		number_of_last_run_times = 8;
-	}
-	for( last_run_time_index = 0;
-	     last_run_time_index < number_of_last_run_times;
-	     last_run_time_index++ )
+	if( number_of_filenames > 0 )
 	{
-		if( libscca_file_get_last_run_time(
+		if( (size_t) number_of_filenames > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of filenames value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filenames_table_size(
 		     info_handle->input_file,
-		     last_run_time_index,
-		     &value_64bit,
+		     &utf8_strings_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last run time: %d.",
-			 function,
-			 last_run_time_index );
+			 "%s: unable to retrieve filenames table size.",
+			 function );
 
 			goto on_error;
 		}
-		if( number_of_last_run_times == 1 )
-		{
-			print_count = narrow_string_snprintf(
-			               value_name,
-			               32,
-			               "\tLast run time:\t\t\t" );
-		}
-		else
+		if( ( utf8_strings_size == 0 )
+		 || ( utf8_strings_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 		{
-			print_count = narrow_string_snprintf(
-			               value_name,
-			               32,
-			               "\tLast run time: %d\t\t",
-			               last_run_time_index + 1 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filenames table size value out of bounds.",
+			 function );
+
+			goto on_error;
 		}
-		if( print_count < 0 )
+		utf8_strings = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * utf8_strings_size );
+
+		utf8_string_offsets = (size_t *) memory_allocate(
+		                                  sizeof( size_t ) * number_of_filenames );
+
+		if( ( utf8_strings == NULL )
+		 || ( utf8_string_offsets == NULL ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to format last run time: %d value name.",
-			 function,
-			 last_run_time_index );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filenames table.",
+			 function );
 
 			goto on_error;
 		}
-		if( info_handle_filetime_value_fprint(
-		     info_handle,
-		     value_name,
-		     value_64bit,
+		if( libscca_file_get_utf8_filenames_table(
+		     info_handle->input_file,
+		     utf8_strings,
+		     utf8_strings_size,
+		     utf8_string_offsets,
+		     number_of_filenames,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print FILETIME value.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "Filenames:\n" );
-
-	if( libscca_file_get_number_of_filenames(
+	if( libscca_file_get_number_of_volumes(
 	     info_handle->input_file,
-	     &number_of_filenames,
+	     &number_of_volumes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of filenames.",
+		 "%s: unable to retrieve number of volumes.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of filenames\t\t: %d\n",
-	 number_of_filenames );
-
-	for( filename_index = 0;
-	     filename_index < number_of_filenames;
-	     filename_index++ )
+	if( number_of_volumes > 0 )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libscca_file_get_utf16_filename_size(
-			  info_handle->input_file,
-			  filename_index,
-			  &value_string_size,
-			  error );
-#else
-		result = libscca_file_get_utf8_filename_size(
-			  info_handle->input_file,
-			  filename_index,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
+		if( (size_t) number_of_volumes >= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve filename: %d size.",
-			 function,
-			 filename_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of volumes value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		volume_device_path_offsets = (size_t *) memory_allocate(
+		                                         sizeof( size_t ) * ( number_of_volumes + 1 ) );
+
+		volume_serial_numbers = (uint32_t *) memory_allocate(
+		                                      sizeof( uint32_t ) * number_of_volumes );
+
+		volume_creation_times = (uint64_t *) memory_allocate(
+		                                      sizeof( uint64_t ) * number_of_volumes );
+
+		if( ( volume_device_path_offsets == NULL )
+		 || ( volume_serial_numbers == NULL )
+		 || ( volume_creation_times == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create volume columns.",
+			 function );
+
+			goto on_error;
+		}
+		if( output_buffer_initialize(
+		     &volume_device_paths,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume device paths buffer.",
+			 function );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
+		/* The volume device paths are stored consecutively without end of string character
+		 */
+		for( volume_index = 0;
+		     volume_index < number_of_volumes;
+		     volume_index++ )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
+			volume_device_path_offsets[ volume_index ] = volume_device_paths->data_offset;
 
-			if( value_string == NULL )
+			if( libscca_file_get_volume_information(
+			     info_handle->input_file,
+			     volume_index,
+			     &volume_information,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d information.",
+				 function,
+				 volume_index );
 
 				goto on_error;
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libscca_file_get_utf16_filename(
-				  info_handle->input_file,
-				  filename_index,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libscca_file_get_utf8_filename(
-				  info_handle->input_file,
-				  filename_index,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
+			if( ( libscca_volume_information_get_serial_number(
+			       volume_information,
+			       &( volume_serial_numbers[ volume_index ] ),
+			       error ) != 1 )
+			 || ( libscca_volume_information_get_creation_time(
+			       volume_information,
+			       &( volume_creation_times[ volume_index ] ),
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d values.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			result = libscca_volume_information_get_utf8_device_path_size(
+			          volume_information,
+			          &utf8_string_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume: %d device path size.",
+				 function,
+				 volume_index );
+
+				goto on_error;
+			}
+			else if( ( result != 0 )
+			      && ( utf8_string_size > 1 ) )
+			{
+				if( output_buffer_resize(
+				     volume_device_paths,
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize volume device paths buffer.",
+					 function );
+
+					goto on_error;
+				}
+				if( libscca_volume_information_get_utf8_device_path(
+				     volume_information,
+				     &( volume_device_paths->data[ volume_device_paths->data_offset ] ),
+				     utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve volume: %d device path.",
+					 function,
+					 volume_index );
+
+					goto on_error;
+				}
+				volume_device_paths->data_offset += narrow_string_length(
+				                                     (char *) &( volume_device_paths->data[ volume_device_paths->data_offset ] ) );
+			}
+			if( libscca_volume_information_free(
+			     &volume_information,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve filename: %d.",
-				 function,
-				 filename_index );
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume information.",
+				 function );
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tFilename: %d\t\t\t: %" PRIs_SYSTEM "\n",
-			 filename_index + 1,
-			 value_string );
-
-			memory_free(
-			 value_string );
-
-			value_string = NULL;
 		}
+		volume_device_path_offsets[ number_of_volumes ] = volume_device_paths->data_offset;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "Volumes:\n" );
+	/* The values that are the same for every row are encoded once and copied for the other rows
+	 */
+	row_offset = info_handle->output_buffer->data_offset;
 
-	if( libscca_file_get_number_of_volumes(
-	     info_handle->input_file,
-	     &number_of_volumes,
+	if( arrow_writer_encode_uint32(
+	     info_handle->output_buffer,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of volumes.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source length.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of volumes\t\t: %d\n",
-	 number_of_volumes );
+	if( ( info_handle_source_path_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_NONE,
+	       0,
+	       error ) != 1 )
+	 || ( info_handle_arrow_string_length_set(
+	       info_handle,
+	       row_offset,
+	       error ) != 1 )
+	 || ( arrow_writer_encode_uint32(
+	       info_handle->output_buffer,
+	       format_version,
+	       error ) != 1 )
+	 || ( arrow_writer_encode_uint32(
+	       info_handle->output_buffer,
+	       prefetch_hash,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source values.",
+		 function );
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+		goto on_error;
+	}
+	length_offset = info_handle->output_buffer->data_offset;
 
-	for( volume_index = 0;
-	     volume_index < number_of_volumes;
-	     volume_index++ )
+	if( ( arrow_writer_encode_uint32(
+	       info_handle->output_buffer,
+	       0,
+	       error ) != 1 )
+	 || ( info_handle_executable_filename_append(
+	       info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_NONE,
+	       0,
+	       error ) != 1 )
+	 || ( info_handle_arrow_string_length_set(
+	       info_handle,
+	       length_offset,
+	       error ) != 1 )
+	 || ( arrow_writer_encode_uint32(
+	       info_handle->output_buffer,
+	       run_count,
+	       error ) != 1 )
+	 || ( arrow_writer_encode_uint64(
+	       info_handle->output_buffer,
+	       last_run_time,
+	       error ) != 1 ) )
 	{
-		if( libscca_file_get_volume_information(
-		     info_handle->input_file,
-		     volume_index,
-		     &volume_information,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append executable values.",
+		 function );
 
-			return( -1 );
-		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "Volume: %d information:\n",
-		 volume_index + 1 );
+		goto on_error;
+	}
+	row_values_size = info_handle->output_buffer->data_offset - row_offset;
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libscca_volume_information_get_utf16_device_path_size(
-			  volume_information,
-			  &value_string_size,
-			  error );
-#else
-		result = libscca_volume_information_get_utf8_device_path_size(
-			  volume_information,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve device path size.",
-			 function );
+	number_of_rows = ( number_of_entries > 0 ) ? number_of_entries : 1;
 
-			goto on_error;
-		}
-		if( value_string_size > 0 )
+	for( entry_index = 0;
+	     entry_index < number_of_rows;
+	     entry_index++ )
+	{
+		if( entry_index > 0 )
 		{
-			value_string = system_string_allocate(
-					value_string_size );
-
-			if( value_string == NULL )
+			if( output_buffer_resize(
+			     info_handle->output_buffer,
+			     row_values_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize output buffer.",
 				 function );
 
 				goto on_error;
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libscca_volume_information_get_utf16_device_path(
-				  volume_information,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libscca_volume_information_get_utf8_device_path(
-				  volume_information,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
+			if( memory_copy(
+			     &( info_handle->output_buffer->data[ info_handle->output_buffer->data_offset ] ),
+			     &( info_handle->output_buffer->data[ row_offset ] ),
+			     row_values_size ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve device path.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy row values.",
 				 function );
 
 				goto on_error;
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\tDevice path\t\t\t: %" PRIs_SYSTEM "\n",
-			 value_string );
+			info_handle->output_buffer->data_offset += row_values_size;
+		}
+		utf8_string        = NULL;
+		utf8_string_length = 0;
+		volume_index       = number_of_volumes;
 
-			memory_free(
-			 value_string );
+		if( number_of_entries > 0 )
+		{
+			filename_index = filename_indexes[ entry_index ];
+
+			if( ( filename_index >= 0 )
+			 && ( filename_index < number_of_filenames ) )
+			{
+				utf8_string = &( utf8_strings[ utf8_string_offsets[ filename_index ] ] );
 
-			value_string = NULL;
+				utf8_string_length = narrow_string_length(
+				                      (char *) utf8_string );
+			}
+			/* The volume that contains the filename is the volume with a device path
+			 * that is followed by a path segment separator in the filename
+			 */
+			for( volume_index = 0;
+			     volume_index < number_of_volumes;
+			     volume_index++ )
+			{
+				volume_device_path_length = volume_device_path_offsets[ volume_index + 1 ]
+				                          - volume_device_path_offsets[ volume_index ];
+
+				if( ( volume_device_path_length > 0 )
+				 && ( volume_device_path_length < utf8_string_length )
+				 && ( utf8_string[ volume_device_path_length ] == (uint8_t) '\\' )
+				 && ( narrow_string_compare_no_case(
+				       (char *) utf8_string,
+				       (char *) &( volume_device_paths->data[ volume_device_path_offsets[ volume_index ] ] ),
+				       volume_device_path_length ) == 0 ) )
+				{
+					break;
+				}
+			}
 		}
-		if( libscca_volume_information_get_creation_time(
-		     volume_information,
-		     &value_64bit,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve creation time.",
-			 function );
+		result = 1;
 
-			goto on_error;
+		if( number_of_entries > 0 )
+		{
+			if( ( arrow_writer_encode_uint32(
+			       info_handle->output_buffer,
+			       start_times[ entry_index ],
+			       error ) != 1 )
+			 || ( arrow_writer_encode_uint32(
+			       info_handle->output_buffer,
+			       durations[ entry_index ],
+			       error ) != 1 )
+			 || ( arrow_writer_encode_uint32(
+			       info_handle->output_buffer,
+			       flags[ entry_index ],
+			       error ) != 1 )
+			 || ( arrow_writer_encode_uint64(
+			       info_handle->output_buffer,
+			       file_references[ entry_index ],
+			       error ) != 1 ) )
+			{
+				result = -1;
+			}
 		}
-		if( info_handle_filetime_value_fprint(
-		     info_handle,
-		     "\tCreation time\t\t\t",
-		     value_64bit,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print FILETIME value.",
-			 function );
-
-			goto on_error;
+			if( ( arrow_writer_encode_uint32(
+			       info_handle->output_buffer,
+			       0,
+			       error ) != 1 )
+			 || ( arrow_writer_encode_uint32(
+			       info_handle->output_buffer,
+			       0,
+			       error ) != 1 )
+			 || ( arrow_writer_encode_uint32(
+			       info_handle->output_buffer,
+			       0,
+			       error ) != 1 )
+			 || ( arrow_writer_encode_uint64(
+			       info_handle->output_buffer,
+			       0,
+			       error ) != 1 ) )
+			{
+				result = -1;
+			}
 		}
-		if( libscca_volume_information_get_serial_number(
-		     volume_information,
-		     &value_32bit,
-		     error ) != 1 )
+		if( result == 1 )
+		{
+			result = arrow_writer_encode_string(
+			          info_handle->output_buffer,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
+		}
+		if( result == 1 )
+		{
+			if( volume_index < number_of_volumes )
+			{
+				if( ( arrow_writer_encode_string(
+				       info_handle->output_buffer,
+				       &( volume_device_paths->data[ volume_device_path_offsets[ volume_index ] ] ),
+				       volume_device_path_offsets[ volume_index + 1 ] - volume_device_path_offsets[ volume_index ],
+				       error ) != 1 )
+				 || ( arrow_writer_encode_uint32(
+				       info_handle->output_buffer,
+				       volume_serial_numbers[ volume_index ],
+				       error ) != 1 )
+				 || ( arrow_writer_encode_uint64(
+				       info_handle->output_buffer,
+				       volume_creation_times[ volume_index ],
+				       error ) != 1 ) )
+				{
+					result = -1;
+				}
+			}
+			else
+			{
+				if( ( arrow_writer_encode_string(
+				       info_handle->output_buffer,
+				       NULL,
+				       0,
+				       error ) != 1 )
+				 || ( arrow_writer_encode_uint32(
+				       info_handle->output_buffer,
+				       0,
+				       error ) != 1 )
+				 || ( arrow_writer_encode_uint64(
+				       info_handle->output_buffer,
+				       0,
+				       error ) != 1 ) )
+				{
+					result = -1;
+				}
+			}
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve serial number.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append row: %d.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tSerial number\t\t\t: 0x%08" PRIx32 "\n",
-		 value_32bit );
-
-/* TODO device path */
-/* TODO file references */
-/* TODO directories */
-
-		if( libscca_volume_information_free(
-		     &volume_information,
+	}
+	if( volume_device_paths != NULL )
+	{
+		if( output_buffer_free(
+		     &volume_device_paths,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free volume information.",
+			 "%s: unable to free volume device paths buffer.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+	}
+	if( volume_creation_times != NULL )
+	{
+		memory_free(
+		 volume_creation_times );
+	}
+	if( volume_serial_numbers != NULL )
+	{
+		memory_free(
+		 volume_serial_numbers );
+	}
+	if( volume_device_path_offsets != NULL )
+	{
+		memory_free(
+		 volume_device_path_offsets );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		memory_free(
+		 flags );
+	}
+	if( durations != NULL )
+	{
+		memory_free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
 	}
 	return( 1 );
 
@@ -1011,11 +6895,143 @@ on_error:
 		 &volume_information,
 		 NULL );
 	}
-	if( value_string != NULL )
+	if( volume_device_paths != NULL )
+	{
+		output_buffer_free(
+		 &volume_device_paths,
+		 NULL );
+	}
+	if( volume_creation_times != NULL )
+	{
+		memory_free(
+		 volume_creation_times );
+	}
+	if( volume_serial_numbers != NULL )
+	{
+		memory_free(
+		 volume_serial_numbers );
+	}
+	if( volume_device_path_offsets != NULL )
+	{
+		memory_free(
+		 volume_device_path_offsets );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	if( filename_indexes != NULL )
+	{
+		memory_free(
+		 filename_indexes );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( flags != NULL )
+	{
+		memory_free(
+		 flags );
+	}
+	if( durations != NULL )
 	{
 		memory_free(
-		 value_string );
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
 	}
 	return( -1 );
 }
 
+/* Appends the file information of an already opened file to a specific output buffer
+ * The info handle itself is not modified so that multiple files can be appended concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_file_append_with_file(
+     info_handle_t *info_handle,
+     libscca_file_t *file,
+     const system_character_t *source_path,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	info_handle_t file_info_handle;
+
+	static char *function = "info_handle_file_append_with_file";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &file_info_handle,
+	     info_handle,
+	     sizeof( info_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy info handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_info_handle.input_file    = file;
+	file_info_handle.source_path   = source_path;
+	file_info_handle.output_buffer = output_buffer;
+
+	if( info_handle_file_append(
+	     &file_info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file information.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
@@ -26,6 +26,10 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "arrow_writer.h"
+#include "filter_expression.h"
+#include "gzip_writer.h"
+#include "output_buffer.h"
 #include "sccatools_libcerror.h"
 #include "sccatools_libscca.h"
 
@@ -33,6 +37,24 @@
 extern "C" {
 #endif
 
+enum INFO_HANDLE_OUTPUT_FORMATS
+{
+	INFO_HANDLE_OUTPUT_FORMAT_TEXT		= 0,
+	INFO_HANDLE_OUTPUT_FORMAT_CSV		= 1,
+	INFO_HANDLE_OUTPUT_FORMAT_JSONL		= 2,
+	INFO_HANDLE_OUTPUT_FORMAT_BODYFILE	= 3,
+	INFO_HANDLE_OUTPUT_FORMAT_ARROW		= 4,
+	INFO_HANDLE_OUTPUT_FORMAT_SQL		= 5
+};
+
+/* The number of columns of the Arrow output format
+ */
+#define INFO_HANDLE_NUMBER_OF_ARROW_COLUMNS	14
+
+/* The SQL expression that refers to the file that was inserted last
+ */
+#define INFO_HANDLE_SQL_FILE_IDENTIFIER		"(SELECT MAX(file_id) FROM files)"
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -49,6 +71,51 @@ struct info_handle
 	 */
 	FILE *notify_stream;
 
+	/* The output format
+	 */
+	int output_format;
+
+	/* The output buffer used to build the CSV and JSON Lines records
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The Arrow writer used in Arrow output format
+	 */
+	arrow_writer_t *arrow_writer;
+
+	/* The gzip writer used to compress the output
+	 */
+	gzip_writer_t *gzip_writer;
+
+	/* The path of the input file
+	 */
+	const system_character_t *source_path;
+
+	/* The match string, files without a matching filename are skipped
+	 */
+	const system_character_t *match_string;
+
+	/* The match string length
+	 */
+	size_t match_string_length;
+
+	/* The match type
+	 */
+	int match_type;
+
+	/* The match flags
+	 */
+	uint8_t match_flags;
+
+	/* The filter expression, files that do not match the expression are skipped
+	 */
+	filter_expression_t *filter_expression;
+
+	/* Value to indicate the prefetch hash should be verified
+	 * instead of printing the file information
+	 */
+	uint8_t verify_prefetch_hash;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -71,6 +138,31 @@ int info_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_output_format(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_match_string(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_match_type(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_set_filter_expression(
+     info_handle_t *info_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int info_handle_file_matches(
+     info_handle_t *info_handle,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
 int info_handle_open_input(
      info_handle_t *info_handle,
      const system_character_t *filename,
@@ -80,7 +172,7 @@ int info_handle_close_input(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
-int info_handle_filetime_value_fprint(
+int info_handle_filetime_value_append(
      info_handle_t *info_handle,
      const char *value_name,
      uint64_t value_64bit,
@@ -90,6 +182,152 @@ int info_handle_file_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_file_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_text_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_prefetch_hash_verification_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_source_path_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     uint8_t quote_string,
+     libcerror_error_t **error );
+
+int info_handle_executable_filename_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     uint8_t quote_string,
+     libcerror_error_t **error );
+
+int info_handle_last_run_times_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     libcerror_error_t **error );
+
+int info_handle_filenames_append(
+     info_handle_t *info_handle,
+     int escape_mode,
+     libcerror_error_t **error );
+
+int info_handle_file_metrics_jsonl_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_volume_string_append(
+     info_handle_t *info_handle,
+     libscca_volume_information_t *volume_information,
+     int directory_string_index,
+     int escape_mode,
+     uint8_t quote_string,
+     libcerror_error_t **error );
+
+int info_handle_volumes_jsonl_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_volumes_csv_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_csv_header_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_csv_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_jsonl_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_filetime_bodyfile_append(
+     info_handle_t *info_handle,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int info_handle_file_bodyfile_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_sql_header_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_sql_footer_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_runs_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_metrics_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_volumes_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_sql_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_arrow_writer_open(
+     info_handle_t *info_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int info_handle_arrow_writer_close(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_gzip_writer_open(
+     info_handle_t *info_handle,
+     FILE *stream,
+     int compression_level,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int info_handle_gzip_writer_close(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_output_string_write(
+     info_handle_t *info_handle,
+     const char *string,
+     libcerror_error_t **error );
+
+int info_handle_output_buffer_write(
+     info_handle_t *info_handle,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int info_handle_arrow_string_length_set(
+     info_handle_t *info_handle,
+     size_t length_offset,
+     libcerror_error_t **error );
+
+int info_handle_file_arrow_append(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_handle_file_append_with_file(
+     info_handle_t *info_handle,
+     libscca_file_t *file,
+     const system_character_t *source_path,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
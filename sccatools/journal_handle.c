@@ -0,0 +1,1312 @@
+/*
+ * Journal handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H ) || defined( WINAPI )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "journal_handle.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+/* Creates a journal handle
+ * Make sure the value journal_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int journal_handle_initialize(
+     journal_handle_t **journal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "journal_handle_initialize";
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *journal_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid journal handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*journal_handle = memory_allocate_structure(
+	                   journal_handle_t );
+
+	if( *journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create journal handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *journal_handle,
+	     0,
+	     sizeof( journal_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear journal handle.",
+		 function );
+
+		memory_free(
+		 *journal_handle );
+
+		*journal_handle = NULL;
+
+		return( -1 );
+	}
+	if( output_buffer_initialize(
+	     &( ( *journal_handle )->output_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *journal_handle != NULL )
+	{
+		memory_free(
+		 *journal_handle );
+
+		*journal_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a journal handle
+ * The records that were not flushed are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int journal_handle_free(
+     journal_handle_t **journal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "journal_handle_free";
+	int result            = 1;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *journal_handle != NULL )
+	{
+		if( ( *journal_handle )->stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *journal_handle )->stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close journal file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( output_buffer_free(
+		     &( ( *journal_handle )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *journal_handle )->hashes != NULL )
+		{
+			memory_free(
+			 ( *journal_handle )->hashes );
+		}
+		memory_free(
+		 *journal_handle );
+
+		*journal_handle = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the hash of a journaled file
+ * The hash is a 64-bit FNV-1a hash of the path, size and modification time
+ * so that a file that was changed after it was journaled is processed again
+ * Returns the hash, which is never 0
+ */
+uint64_t journal_handle_calculate_hash(
+          const char *path,
+          size_t path_length,
+          uint64_t size,
+          int64_t modification_time )
+{
+	size_t path_index = 0;
+	uint64_t hash     = (uint64_t) 0xcbf29ce484222325ULL;
+	uint64_t value    = 0;
+	int byte_index    = 0;
+
+	if( path != NULL )
+	{
+		for( path_index = 0;
+		     path_index < path_length;
+		     path_index++ )
+		{
+			hash ^= (uint8_t) path[ path_index ];
+			hash *= (uint64_t) 0x100000001b3ULL;
+		}
+	}
+	value = size;
+
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		hash  ^= value & 0xff;
+		hash  *= (uint64_t) 0x100000001b3ULL;
+		value >>= 8;
+	}
+	value = (uint64_t) modification_time;
+
+	for( byte_index = 0;
+	     byte_index < 8;
+	     byte_index++ )
+	{
+		hash  ^= value & 0xff;
+		hash  *= (uint64_t) 0x100000001b3ULL;
+		value >>= 8;
+	}
+	/* A hash of 0 marks an empty slot of the hash set
+	 */
+	if( hash == 0 )
+	{
+		hash = 1;
+	}
+	return( hash );
+}
+
+/* Inserts a hash into the hash set
+ * The hash set uses open addressing with linear probing and is doubled
+ * in size before it becomes more than half full
+ * Returns 1 if the hash was inserted, 0 if the hash set already contains the hash or -1 on error
+ */
+int journal_handle_insert_hash(
+     journal_handle_t *journal_handle,
+     uint64_t hash,
+     libcerror_error_t **error )
+{
+	uint64_t *hashes       = NULL;
+	static char *function  = "journal_handle_insert_hash";
+	size_t hashes_size     = 0;
+	size_t number_of_slots = 0;
+	size_t slot_index      = 0;
+	size_t slot_mask       = 0;
+	size_t source_index    = 0;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_handle_contains_hash(
+	     journal_handle,
+	     hash ) != 0 )
+	{
+		return( 0 );
+	}
+	if( ( ( journal_handle->number_of_hashes + 1 ) * 2 ) > journal_handle->number_of_slots )
+	{
+		number_of_slots = journal_handle->number_of_slots * 2;
+
+		if( number_of_slots == 0 )
+		{
+			number_of_slots = JOURNAL_HANDLE_INITIAL_NUMBER_OF_SLOTS;
+		}
+		if( number_of_slots > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of slots value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		hashes_size = sizeof( uint64_t ) * number_of_slots;
+
+		hashes = (uint64_t *) memory_allocate(
+		                       hashes_size );
+
+		if( hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hashes.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     hashes,
+		     0,
+		     hashes_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear hashes.",
+			 function );
+
+			memory_free(
+			 hashes );
+
+			return( -1 );
+		}
+		slot_mask = number_of_slots - 1;
+
+		for( source_index = 0;
+		     source_index < journal_handle->number_of_slots;
+		     source_index++ )
+		{
+			if( journal_handle->hashes[ source_index ] == 0 )
+			{
+				continue;
+			}
+			slot_index = (size_t) journal_handle->hashes[ source_index ] & slot_mask;
+
+			while( hashes[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & slot_mask;
+			}
+			hashes[ slot_index ] = journal_handle->hashes[ source_index ];
+		}
+		if( journal_handle->hashes != NULL )
+		{
+			memory_free(
+			 journal_handle->hashes );
+		}
+		journal_handle->hashes          = hashes;
+		journal_handle->number_of_slots = number_of_slots;
+	}
+	slot_mask  = journal_handle->number_of_slots - 1;
+	slot_index = (size_t) hash & slot_mask;
+
+	while( journal_handle->hashes[ slot_index ] != 0 )
+	{
+		slot_index = ( slot_index + 1 ) & slot_mask;
+	}
+	journal_handle->hashes[ slot_index ] = hash;
+
+	journal_handle->number_of_hashes += 1;
+
+	return( 1 );
+}
+
+/* Determines if the hash set contains a hash
+ * Returns 1 if the hash set contains the hash or 0 if not
+ */
+int journal_handle_contains_hash(
+     journal_handle_t *journal_handle,
+     uint64_t hash )
+{
+	size_t slot_index = 0;
+	size_t slot_mask  = 0;
+
+	if( ( journal_handle == NULL )
+	 || ( journal_handle->hashes == NULL )
+	 || ( hash == 0 ) )
+	{
+		return( 0 );
+	}
+	slot_mask  = journal_handle->number_of_slots - 1;
+	slot_index = (size_t) hash & slot_mask;
+
+	while( journal_handle->hashes[ slot_index ] != 0 )
+	{
+		if( journal_handle->hashes[ slot_index ] == hash )
+		{
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & slot_mask;
+	}
+	return( 0 );
+}
+
+/* Reads the records of a journal from the data
+ * A record is a line of the form: size modification_time output_offset path
+ * Only complete lines are read, malformed records are ignored
+ * The data offset is set to the offset of the first byte after the last complete line
+ * Returns 1 if successful or -1 on error
+ */
+int journal_handle_read_data(
+     journal_handle_t *journal_handle,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function       = "journal_handle_read_data";
+	size_t line_end_offset      = 0;
+	size_t line_offset          = 0;
+	size_t value_offset         = 0;
+	uint64_t hash               = 0;
+	uint64_t size               = 0;
+	uint64_t value              = 0;
+	int64_t modification_time   = 0;
+	int is_negative             = 0;
+	int number_of_digits        = 0;
+	int value_index             = 0;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	*data_offset = 0;
+
+	while( line_offset < data_size )
+	{
+		for( line_end_offset = line_offset;
+		     line_end_offset < data_size;
+		     line_end_offset++ )
+		{
+			if( data[ line_end_offset ] == (uint8_t) '\n' )
+			{
+				break;
+			}
+		}
+		if( line_end_offset >= data_size )
+		{
+			break;
+		}
+		/* The size, modification time and output offset are followed by a space
+		 */
+		value_offset = line_offset;
+
+		for( value_index = 0;
+		     value_index < 3;
+		     value_index++ )
+		{
+			is_negative      = 0;
+			number_of_digits = 0;
+			value            = 0;
+
+			if( ( value_index > 0 )
+			 && ( value_offset < line_end_offset )
+			 && ( data[ value_offset ] == (uint8_t) '-' ) )
+			{
+				is_negative = 1;
+
+				value_offset++;
+			}
+			while( ( value_offset < line_end_offset )
+			    && ( data[ value_offset ] >= (uint8_t) '0' )
+			    && ( data[ value_offset ] <= (uint8_t) '9' )
+			    && ( number_of_digits < 20 ) )
+			{
+				value *= 10;
+				value += data[ value_offset ] - (uint8_t) '0';
+
+				number_of_digits++;
+				value_offset++;
+			}
+			if( ( number_of_digits == 0 )
+			 || ( value_offset >= line_end_offset )
+			 || ( data[ value_offset ] != (uint8_t) ' ' ) )
+			{
+				break;
+			}
+			value_offset++;
+
+			if( value_index == 0 )
+			{
+				size = value;
+			}
+			else if( value_index == 1 )
+			{
+				if( is_negative != 0 )
+				{
+					modification_time = -( (int64_t) value );
+				}
+				else
+				{
+					modification_time = (int64_t) value;
+				}
+			}
+		}
+		if( ( value_index == 3 )
+		 && ( value_offset < line_end_offset ) )
+		{
+			hash = journal_handle_calculate_hash(
+			        (char *) &( data[ value_offset ] ),
+			        line_end_offset - value_offset,
+			        size,
+			        modification_time );
+
+			if( journal_handle_insert_hash(
+			     journal_handle,
+			     hash,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert hash.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		line_offset  = line_end_offset + 1;
+		*data_offset = line_offset;
+	}
+	return( 1 );
+}
+
+/* Reads the records of an existing journal file
+ * A partial record at the end of the file, such as written by an interrupted run, is ignored
+ * Returns 1 if successful, 0 if the file does not exist or -1 on error
+ */
+int journal_handle_read_file(
+     journal_handle_t *journal_handle,
+     const char *path,
+     uint8_t *has_partial_record,
+     libcerror_error_t **error )
+{
+	FILE *stream           = NULL;
+	uint8_t *buffer        = NULL;
+	uint8_t *new_buffer    = NULL;
+	static char *function  = "journal_handle_read_file";
+	size_t buffer_index    = 0;
+	size_t buffer_size     = 0;
+	size_t data_offset     = 0;
+	size_t data_size       = 0;
+	size_t read_count      = 0;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_partial_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has partial record.",
+		 function );
+
+		return( -1 );
+	}
+	*has_partial_record = 0;
+
+	stream = file_stream_open(
+	          path,
+	          FILE_STREAM_BINARY_OPEN_READ );
+
+	if( stream == NULL )
+	{
+		return( 0 );
+	}
+	buffer_size = JOURNAL_HANDLE_READ_BLOCK_SIZE;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		/* A record that does not fit in the buffer is read with a larger buffer
+		 */
+		if( data_size >= buffer_size )
+		{
+			if( buffer_size >= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid buffer size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			new_buffer = (uint8_t *) memory_reallocate(
+			                          buffer,
+			                          buffer_size * 2 );
+
+			if( new_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize buffer.",
+				 function );
+
+				goto on_error;
+			}
+			buffer       = new_buffer;
+			buffer_size *= 2;
+		}
+		read_count = file_stream_read(
+		              stream,
+		              &( buffer[ data_size ] ),
+		              buffer_size - data_size );
+
+		if( ( read_count == 0 )
+		 && ( ferror( stream ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal file: %s.",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+		data_size += read_count;
+
+		if( journal_handle_read_data(
+		     journal_handle,
+		     buffer,
+		     data_size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to read journal records.",
+			 function );
+
+			goto on_error;
+		}
+		/* The remainder of the data is moved to the start of the buffer
+		 */
+		for( buffer_index = data_offset;
+		     buffer_index < data_size;
+		     buffer_index++ )
+		{
+			buffer[ buffer_index - data_offset ] = buffer[ buffer_index ];
+		}
+		data_size -= data_offset;
+	}
+	while( read_count > 0 );
+
+	if( data_size > 0 )
+	{
+		*has_partial_record = 1;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close journal file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	file_stream_close(
+	 stream );
+
+	return( -1 );
+}
+
+/* Opens the journal file
+ * When resuming the records of an existing journal file are read and new records
+ * are appended, otherwise the journal file is truncated
+ * Returns 1 if successful or -1 on error
+ */
+int journal_handle_open(
+     journal_handle_t *journal_handle,
+     const char *path,
+     uint8_t resume,
+     libcerror_error_t **error )
+{
+	static char *function      = "journal_handle_open";
+	uint8_t has_partial_record = 0;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_handle->stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid journal handle - stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( resume != 0 )
+	{
+		if( journal_handle_read_file(
+		     journal_handle,
+		     path,
+		     &has_partial_record,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal file: %s.",
+			 function,
+			 path );
+
+			return( -1 );
+		}
+	}
+	journal_handle->stream = file_stream_open(
+	                          path,
+	                          ( resume != 0 ) ? FILE_STREAM_BINARY_OPEN_APPEND : FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( journal_handle->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open journal file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	journal_handle->output_buffer->data_offset = 0;
+
+	/* The partial record is terminated so that it is ignored as a malformed record
+	 */
+	if( has_partial_record != 0 )
+	{
+		if( output_buffer_append_character(
+		     journal_handle->output_buffer,
+		     '\n',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Closes the journal file
+ * The records that were not flushed are written before the journal file is closed
+ * Returns 0 if successful or -1 on error
+ */
+int journal_handle_close(
+     journal_handle_t *journal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "journal_handle_close";
+	int result            = 0;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_handle->stream == NULL )
+	{
+		return( 0 );
+	}
+	if( journal_handle_flush(
+	     journal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush journal.",
+		 function );
+
+		result = -1;
+	}
+	if( file_stream_close(
+	     journal_handle->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close journal file.",
+		 function );
+
+		result = -1;
+	}
+	journal_handle->stream = NULL;
+
+	return( result );
+}
+
+/* Retrieves the size and modification time of a file
+ * Returns 1 if successful or 0 if not available
+ */
+int journal_handle_get_file_values(
+     const char *path,
+     uint64_t *size,
+     int64_t *modification_time )
+{
+#if defined( WINAPI )
+	struct __stat64 file_stat;
+#elif defined( HAVE_STAT )
+	struct stat file_stat;
+#endif
+
+	if( ( path == NULL )
+	 || ( size == NULL )
+	 || ( modification_time == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( _stat64(
+	     path,
+	     &file_stat ) != 0 )
+	{
+		return( 0 );
+	}
+#elif defined( HAVE_STAT )
+	if( stat(
+	     path,
+	     &file_stat ) != 0 )
+	{
+		return( 0 );
+	}
+#endif
+#if defined( WINAPI ) || defined( HAVE_STAT )
+	*size              = (uint64_t) file_stat.st_size;
+	*modification_time = (int64_t) file_stat.st_mtime;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Determines if the journal contains a file with the current size and modification time
+ * Returns 1 if the journal contains the file or 0 if not
+ */
+int journal_handle_contains_file(
+     journal_handle_t *journal_handle,
+     const char *path )
+{
+	uint64_t hash              = 0;
+	uint64_t size              = 0;
+	int64_t modification_time  = 0;
+
+	if( ( journal_handle == NULL )
+	 || ( journal_handle->number_of_hashes == 0 )
+	 || ( path == NULL ) )
+	{
+		return( 0 );
+	}
+	if( journal_handle_get_file_values(
+	     path,
+	     &size,
+	     &modification_time ) != 1 )
+	{
+		return( 0 );
+	}
+	hash = journal_handle_calculate_hash(
+	        path,
+	        narrow_string_length(
+	         path ),
+	        size,
+	        modification_time );
+
+	return( journal_handle_contains_hash(
+	         journal_handle,
+	         hash ) );
+}
+
+/* Appends the record of a processed file to the journal
+ * The record is buffered until the journal is flushed
+ * The output offset is the offset of the end of the output of the file or -1 if not available
+ * Returns 1 if successful, 0 if the file cannot be journaled or -1 on error
+ */
+int journal_handle_append_file(
+     journal_handle_t *journal_handle,
+     const char *path,
+     int64_t output_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "journal_handle_append_file";
+	size_t path_length        = 0;
+	uint64_t hash             = 0;
+	uint64_t size             = 0;
+	int64_t modification_time = 0;
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	/* A path that contains an end of line character cannot be stored as a record
+	 */
+	if( ( path_length == 0 )
+	 || ( narrow_string_search_character(
+	       path,
+	       '\n',
+	       path_length ) != NULL ) )
+	{
+		return( 0 );
+	}
+	if( journal_handle_get_file_values(
+	     path,
+	     &size,
+	     &modification_time ) != 1 )
+	{
+		return( 0 );
+	}
+	hash = journal_handle_calculate_hash(
+	        path,
+	        path_length,
+	        size,
+	        modification_time );
+
+	if( journal_handle_insert_hash(
+	     journal_handle,
+	     hash,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_decimal(
+	     journal_handle->output_buffer,
+	     size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_character(
+	     journal_handle->output_buffer,
+	     ' ',
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_signed_decimal(
+	     journal_handle->output_buffer,
+	     modification_time,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_character(
+	     journal_handle->output_buffer,
+	     ' ',
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_signed_decimal(
+	     journal_handle->output_buffer,
+	     output_offset,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_character(
+	     journal_handle->output_buffer,
+	     ' ',
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_string(
+	     journal_handle->output_buffer,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( output_buffer_append_character(
+	     journal_handle->output_buffer,
+	     '\n',
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append record.",
+	 function );
+
+	return( -1 );
+}
+
+/* Writes the buffered records to the journal file and synchronizes the journal file
+ * with the storage so that the records persist when the process is interrupted
+ * Returns 1 if successful or -1 on error
+ */
+int journal_handle_flush(
+     journal_handle_t *journal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "journal_handle_flush";
+
+	if( journal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_handle->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid journal handle - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( journal_handle->output_buffer->data_offset == 0 )
+	{
+		return( 1 );
+	}
+	if( output_buffer_write(
+	     journal_handle->output_buffer,
+	     journal_handle->stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write records.",
+		 function );
+
+		return( -1 );
+	}
+	journal_handle->output_buffer->data_offset = 0;
+
+	if( fflush(
+	     journal_handle->stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush journal file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( _commit(
+	     _fileno(
+	      journal_handle->stream ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize journal file.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( HAVE_FSYNC )
+	if( fsync(
+	     fileno(
+	      journal_handle->stream ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize journal file.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the current offset of an output stream
+ * Returns the offset or -1 if the stream, such as a pipe, does not have an offset
+ */
+int64_t journal_handle_get_output_offset(
+         FILE *stream )
+{
+	int64_t offset = -1;
+
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	offset = (int64_t) _ftelli64(
+	                    stream );
+#elif defined( HAVE_FTELLO )
+	offset = (int64_t) ftello(
+	                    stream );
+#else
+	offset = (int64_t) ftell(
+	                    stream );
+#endif
+	if( offset < 0 )
+	{
+		return( -1 );
+	}
+	return( offset );
+}
+
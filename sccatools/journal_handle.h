@@ -0,0 +1,142 @@
+/*
+ * Journal handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _JOURNAL_HANDLE_H )
+#define _JOURNAL_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of slots of the hash set, which must be a power of 2
+ */
+#define JOURNAL_HANDLE_INITIAL_NUMBER_OF_SLOTS	1024
+
+/* The size of the blocks in which an existing journal is read
+ */
+#define JOURNAL_HANDLE_READ_BLOCK_SIZE		65536
+
+typedef struct journal_handle journal_handle_t;
+
+struct journal_handle
+{
+	/* The journal file stream
+	 */
+	FILE *stream;
+
+	/* The output buffer of the records that were not yet flushed
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The hash set of the journaled files, a hash of 0 marks an empty slot
+	 */
+	uint64_t *hashes;
+
+	/* The number of slots of the hash set
+	 */
+	size_t number_of_slots;
+
+	/* The number of hashes in the hash set
+	 */
+	size_t number_of_hashes;
+};
+
+int journal_handle_initialize(
+     journal_handle_t **journal_handle,
+     libcerror_error_t **error );
+
+int journal_handle_free(
+     journal_handle_t **journal_handle,
+     libcerror_error_t **error );
+
+uint64_t journal_handle_calculate_hash(
+          const char *path,
+          size_t path_length,
+          uint64_t size,
+          int64_t modification_time );
+
+int journal_handle_insert_hash(
+     journal_handle_t *journal_handle,
+     uint64_t hash,
+     libcerror_error_t **error );
+
+int journal_handle_contains_hash(
+     journal_handle_t *journal_handle,
+     uint64_t hash );
+
+int journal_handle_read_data(
+     journal_handle_t *journal_handle,
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int journal_handle_read_file(
+     journal_handle_t *journal_handle,
+     const char *path,
+     uint8_t *has_partial_record,
+     libcerror_error_t **error );
+
+int journal_handle_open(
+     journal_handle_t *journal_handle,
+     const char *path,
+     uint8_t resume,
+     libcerror_error_t **error );
+
+int journal_handle_close(
+     journal_handle_t *journal_handle,
+     libcerror_error_t **error );
+
+int journal_handle_get_file_values(
+     const char *path,
+     uint64_t *size,
+     int64_t *modification_time );
+
+int journal_handle_contains_file(
+     journal_handle_t *journal_handle,
+     const char *path );
+
+int journal_handle_append_file(
+     journal_handle_t *journal_handle,
+     const char *path,
+     int64_t output_offset,
+     libcerror_error_t **error );
+
+int journal_handle_flush(
+     journal_handle_t *journal_handle,
+     libcerror_error_t **error );
+
+int64_t journal_handle_get_output_offset(
+         FILE *stream );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _JOURNAL_HANDLE_H ) */
+
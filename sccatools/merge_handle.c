@@ -0,0 +1,1461 @@
+/*
+ * Merge handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "merge_handle.h"
+#include "sccatools_libcerror.h"
+
+/* Creates a merge handle
+ * Make sure the value merge_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_initialize(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "merge_handle_initialize";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merge_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid merge handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*merge_handle = memory_allocate_structure(
+	                 merge_handle_t );
+
+	if( *merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merge handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *merge_handle,
+	     0,
+	     sizeof( merge_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear merge handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *merge_handle != NULL )
+	{
+		memory_free(
+		 *merge_handle );
+
+		*merge_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a merge handle
+ * The input streams are closed
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_free(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	static char *function = "merge_handle_free";
+	int input_index       = 0;
+	int result            = 1;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merge_handle != NULL )
+	{
+		for( input_index = 0;
+		     input_index < ( *merge_handle )->number_of_inputs;
+		     input_index++ )
+		{
+			input = &( ( ( *merge_handle )->inputs )[ input_index ] );
+
+			if( input->stream != NULL )
+			{
+				if( file_stream_close(
+				     input->stream ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close input: %d.",
+					 function,
+					 input_index );
+
+					result = -1;
+				}
+			}
+			if( input->line != NULL )
+			{
+				memory_free(
+				 input->line );
+			}
+			if( input->key != NULL )
+			{
+				memory_free(
+				 input->key );
+			}
+			if( input->previous_key != NULL )
+			{
+				memory_free(
+				 input->previous_key );
+			}
+		}
+		if( ( *merge_handle )->inputs != NULL )
+		{
+			memory_free(
+			 ( *merge_handle )->inputs );
+		}
+		if( ( *merge_handle )->heap != NULL )
+		{
+			memory_free(
+			 ( *merge_handle )->heap );
+		}
+		memory_free(
+		 *merge_handle );
+
+		*merge_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the merge handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_signal_abort(
+     merge_handle_t *merge_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "merge_handle_signal_abort";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	merge_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens an input file
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_open_input(
+     merge_handle_t *merge_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "merge_handle_open_input";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input: %" PRIs_SYSTEM ".",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( merge_handle_append_input_stream(
+	     merge_handle,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append input stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( -1 );
+}
+
+/* Appends an input stream
+ * The merge handle takes over management of the stream
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_append_input_stream(
+     merge_handle_t *merge_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	merge_input_t *input        = NULL;
+	merge_input_t *reallocation = NULL;
+	int *heap_reallocation      = NULL;
+	static char *function       = "merge_handle_append_input_stream";
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( merge_handle->number_of_inputs >= MERGE_HANDLE_MAXIMUM_NUMBER_OF_INPUTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid merge handle - number of inputs value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = (merge_input_t *) memory_reallocate(
+	                                  merge_handle->inputs,
+	                                  sizeof( merge_input_t ) * ( merge_handle->number_of_inputs + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize inputs.",
+		 function );
+
+		return( -1 );
+	}
+	merge_handle->inputs = reallocation;
+
+	heap_reallocation = (int *) memory_reallocate(
+	                             merge_handle->heap,
+	                             sizeof( int ) * ( merge_handle->number_of_inputs + 1 ) );
+
+	if( heap_reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize heap.",
+		 function );
+
+		return( -1 );
+	}
+	merge_handle->heap = heap_reallocation;
+
+	input = &( ( merge_handle->inputs )[ merge_handle->number_of_inputs ] );
+
+	if( memory_set(
+	     input,
+	     0,
+	     sizeof( merge_input_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input.",
+		 function );
+
+		return( -1 );
+	}
+	input->stream = stream;
+
+	merge_handle->number_of_inputs += 1;
+
+	return( 1 );
+}
+
+/* Reads the next line of an input
+ * The end-of-line characters are not part of the line
+ * Returns 1 if successful, 0 if no more lines are available or -1 on error
+ */
+int merge_handle_read_line(
+     merge_input_t *input,
+     libcerror_error_t **error )
+{
+	char *reallocation    = NULL;
+	static char *function = "merge_handle_read_line";
+	size_t line_size      = 0;
+	size_t read_size      = 0;
+
+	if( input == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input.",
+		 function );
+
+		return( -1 );
+	}
+	if( input->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid input - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	input->line_length = 0;
+
+	while( ( input->line_length == 0 )
+	    || ( input->line[ input->line_length - 1 ] != '\n' ) )
+	{
+		if( ( input->line_size - input->line_length ) < 2 )
+		{
+			if( input->line_size == 0 )
+			{
+				line_size = MERGE_HANDLE_INITIAL_LINE_SIZE;
+			}
+			else if( input->line_size <= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				line_size = input->line_size * 2;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid line size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = (char *) memory_reallocate(
+			                         input->line,
+			                         line_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize line.",
+				 function );
+
+				return( -1 );
+			}
+			input->line      = reallocation;
+			input->line_size = line_size;
+		}
+		read_size = input->line_size - input->line_length;
+
+		if( read_size > (size_t) INT_MAX )
+		{
+			read_size = (size_t) INT_MAX;
+		}
+		if( file_stream_get_string(
+		     input->stream,
+		     &( ( input->line )[ input->line_length ] ),
+		     (int) read_size ) == NULL )
+		{
+			if( ferror(
+			     input->stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read line.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		input->line_length += narrow_string_length(
+		                       &( ( input->line )[ input->line_length ] ) );
+	}
+	if( input->line_length == 0 )
+	{
+		return( 0 );
+	}
+	while( ( input->line_length > 0 )
+	    && ( ( input->line[ input->line_length - 1 ] == '\n' )
+	     ||  ( input->line[ input->line_length - 1 ] == '\r' ) ) )
+	{
+		input->line_length -= 1;
+	}
+	input->line[ input->line_length ] = 0;
+
+	return( 1 );
+}
+
+/* Determines the input format from the first line of an input
+ * Returns the input format
+ */
+int merge_handle_determine_input_format(
+     const char *line,
+     size_t line_length )
+{
+	if( line == NULL )
+	{
+		return( MERGE_HANDLE_INPUT_FORMAT_UNKNOWN );
+	}
+	if( ( line_length >= 7 )
+	 && ( narrow_string_compare(
+	       line,
+	       "source,",
+	       7 ) == 0 ) )
+	{
+		return( MERGE_HANDLE_INPUT_FORMAT_CSV );
+	}
+	if( ( line_length >= 10 )
+	 && ( narrow_string_compare(
+	       line,
+	       "{\"source\":",
+	       10 ) == 0 ) )
+	{
+		return( MERGE_HANDLE_INPUT_FORMAT_JSONL );
+	}
+	return( MERGE_HANDLE_INPUT_FORMAT_UNKNOWN );
+}
+
+/* Retrieves the source of a record, without escaping or quoting
+ * The key must be at least the size of the line
+ * Returns 1 if successful, 0 if the record has no source or -1 on error
+ */
+int merge_handle_get_record_key(
+     int input_format,
+     const char *line,
+     size_t line_length,
+     char *key,
+     size_t key_size,
+     size_t *key_length,
+     libcerror_error_t **error )
+{
+	static char *function        = "merge_handle_get_record_key";
+	size_t line_index            = 0;
+	size_t safe_key_length       = 0;
+	uint32_t character_value     = 0;
+	uint32_t surrogate_value     = 0;
+	uint8_t digit_index          = 0;
+	uint8_t digit_value          = 0;
+	uint8_t number_of_surrogates = 0;
+
+	if( ( input_format != MERGE_HANDLE_INPUT_FORMAT_CSV )
+	 && ( input_format != MERGE_HANDLE_INPUT_FORMAT_JSONL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported input format.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size < ( line_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key length.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_format == MERGE_HANDLE_INPUT_FORMAT_CSV )
+	{
+		if( ( line_length > 0 )
+		 && ( line[ 0 ] == '"' ) )
+		{
+			/* A quoted value ends at a single quote, a double quote is an escaped quote
+			 */
+			for( line_index = 1;
+			     line_index < line_length;
+			     line_index++ )
+			{
+				if( line[ line_index ] == '"' )
+				{
+					if( ( ( line_index + 1 ) >= line_length )
+					 || ( line[ line_index + 1 ] != '"' ) )
+					{
+						break;
+					}
+					line_index++;
+				}
+				key[ safe_key_length++ ] = line[ line_index ];
+			}
+			if( line_index >= line_length )
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			for( line_index = 0;
+			     line_index < line_length;
+			     line_index++ )
+			{
+				if( line[ line_index ] == ',' )
+				{
+					break;
+				}
+				key[ safe_key_length++ ] = line[ line_index ];
+			}
+		}
+	}
+	else if( input_format == MERGE_HANDLE_INPUT_FORMAT_JSONL )
+	{
+		if( merge_handle_determine_input_format(
+		     line,
+		     line_length ) != MERGE_HANDLE_INPUT_FORMAT_JSONL )
+		{
+			return( 0 );
+		}
+		line_index = 10;
+
+		if( ( ( line_index + 4 ) <= line_length )
+		 && ( narrow_string_compare(
+		       &( line[ line_index ] ),
+		       "null",
+		       4 ) == 0 ) )
+		{
+			*key_length = 0;
+
+			key[ 0 ] = 0;
+
+			return( 1 );
+		}
+		if( ( line_index >= line_length )
+		 || ( line[ line_index ] != '"' ) )
+		{
+			return( 0 );
+		}
+		for( line_index += 1;
+		     line_index < line_length;
+		     line_index++ )
+		{
+			if( line[ line_index ] == '"' )
+			{
+				break;
+			}
+			if( line[ line_index ] != '\\' )
+			{
+				key[ safe_key_length++ ] = line[ line_index ];
+
+				continue;
+			}
+			line_index++;
+
+			if( line_index >= line_length )
+			{
+				return( 0 );
+			}
+			switch( line[ line_index ] )
+			{
+				case 'b':
+					key[ safe_key_length++ ] = '\b';
+					break;
+
+				case 'f':
+					key[ safe_key_length++ ] = '\f';
+					break;
+
+				case 'n':
+					key[ safe_key_length++ ] = '\n';
+					break;
+
+				case 'r':
+					key[ safe_key_length++ ] = '\r';
+					break;
+
+				case 't':
+					key[ safe_key_length++ ] = '\t';
+					break;
+
+				case 'u':
+					/* A UTF-16 surrogate pair is escaped as 2 consecutive \u escapes
+					 */
+					character_value      = 0;
+					number_of_surrogates = 0;
+
+					do
+					{
+						if( number_of_surrogates > 0 )
+						{
+							if( ( ( line_index + 2 ) >= line_length )
+							 || ( line[ line_index + 1 ] != '\\' )
+							 || ( line[ line_index + 2 ] != 'u' ) )
+							{
+								return( 0 );
+							}
+							line_index += 2;
+						}
+						if( ( line_index + 4 ) >= line_length )
+						{
+							return( 0 );
+						}
+						surrogate_value = 0;
+
+						for( digit_index = 1;
+						     digit_index <= 4;
+						     digit_index++ )
+						{
+							digit_value = (uint8_t) line[ line_index + digit_index ];
+
+							if( ( digit_value >= (uint8_t) '0' )
+							 && ( digit_value <= (uint8_t) '9' ) )
+							{
+								digit_value -= (uint8_t) '0';
+							}
+							else if( ( digit_value >= (uint8_t) 'a' )
+							      && ( digit_value <= (uint8_t) 'f' ) )
+							{
+								digit_value -= (uint8_t) 'a' - 10;
+							}
+							else if( ( digit_value >= (uint8_t) 'A' )
+							      && ( digit_value <= (uint8_t) 'F' ) )
+							{
+								digit_value -= (uint8_t) 'A' - 10;
+							}
+							else
+							{
+								return( 0 );
+							}
+							surrogate_value = ( surrogate_value << 4 ) | digit_value;
+						}
+						line_index += 4;
+
+						if( number_of_surrogates == 0 )
+						{
+							character_value = surrogate_value;
+						}
+						else if( ( surrogate_value >= 0xdc00UL )
+						      && ( surrogate_value <= 0xdfffUL ) )
+						{
+							character_value = 0x10000UL
+							                + ( ( character_value - 0xd800UL ) << 10 )
+							                + ( surrogate_value - 0xdc00UL );
+						}
+						else
+						{
+							return( 0 );
+						}
+						number_of_surrogates++;
+					}
+					while( ( number_of_surrogates == 1 )
+					    && ( character_value >= 0xd800UL )
+					    && ( character_value <= 0xdbffUL ) );
+
+					if( character_value < 0x80UL )
+					{
+						key[ safe_key_length++ ] = (char) character_value;
+					}
+					else if( character_value < 0x800UL )
+					{
+						key[ safe_key_length++ ] = (char) ( 0xc0 | ( character_value >> 6 ) );
+						key[ safe_key_length++ ] = (char) ( 0x80 | ( character_value & 0x3f ) );
+					}
+					else if( character_value < 0x10000UL )
+					{
+						key[ safe_key_length++ ] = (char) ( 0xe0 | ( character_value >> 12 ) );
+						key[ safe_key_length++ ] = (char) ( 0x80 | ( ( character_value >> 6 ) & 0x3f ) );
+						key[ safe_key_length++ ] = (char) ( 0x80 | ( character_value & 0x3f ) );
+					}
+					else
+					{
+						key[ safe_key_length++ ] = (char) ( 0xf0 | ( character_value >> 18 ) );
+						key[ safe_key_length++ ] = (char) ( 0x80 | ( ( character_value >> 12 ) & 0x3f ) );
+						key[ safe_key_length++ ] = (char) ( 0x80 | ( ( character_value >> 6 ) & 0x3f ) );
+						key[ safe_key_length++ ] = (char) ( 0x80 | ( character_value & 0x3f ) );
+					}
+					break;
+
+				default:
+					key[ safe_key_length++ ] = line[ line_index ];
+					break;
+			}
+		}
+		if( line_index >= line_length )
+		{
+			return( 0 );
+		}
+	}
+	key[ safe_key_length ] = 0;
+
+	*key_length = safe_key_length;
+
+	return( 1 );
+}
+
+/* Determines the source of the current line of an input
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_set_record_key(
+     merge_handle_t *merge_handle,
+     int input_index,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	char *reallocation    = NULL;
+	static char *function = "merge_handle_set_record_key";
+	int result            = 0;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_index < 0 )
+	 || ( input_index >= merge_handle->number_of_inputs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	input = &( ( merge_handle->inputs )[ input_index ] );
+
+	/* The unescaped source is never larger than the line
+	 */
+	if( input->key_size < input->line_size )
+	{
+		reallocation = (char *) memory_reallocate(
+		                         input->key,
+		                         input->line_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize key.",
+			 function );
+
+			return( -1 );
+		}
+		input->key = reallocation;
+
+		reallocation = (char *) memory_reallocate(
+		                         input->previous_key,
+		                         input->line_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize previous key.",
+			 function );
+
+			return( -1 );
+		}
+		input->previous_key = reallocation;
+		input->key_size     = input->line_size;
+	}
+	result = merge_handle_get_record_key(
+	          merge_handle->input_format,
+	          input->line,
+	          input->line_length,
+	          input->key,
+	          input->key_size,
+	          &( input->key_length ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source of record of input: %d.",
+		 function,
+		 input_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: unsupported record of input: %d, missing source.",
+		 function,
+		 input_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the next record of an input
+ * The source of the current record is retained as the previous source
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int merge_handle_read_record(
+     merge_handle_t *merge_handle,
+     int input_index,
+     libcerror_error_t **error )
+{
+	merge_input_t *input  = NULL;
+	char *swap_key        = NULL;
+	static char *function = "merge_handle_read_record";
+	int result            = 0;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( input_index < 0 )
+	 || ( input_index >= merge_handle->number_of_inputs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	input = &( ( merge_handle->inputs )[ input_index ] );
+
+	swap_key            = input->previous_key;
+	input->previous_key = input->key;
+	input->key          = swap_key;
+
+	input->previous_key_length = input->key_length;
+	input->key_length          = 0;
+
+	result = merge_handle_read_line(
+	          input,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read line of input: %d.",
+		 function,
+		 input_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( merge_handle_set_record_key(
+	     merge_handle,
+	     input_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source of record of input: %d.",
+		 function,
+		 input_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares the current sources of two inputs
+ * Records with the same source are ordered by input index, so that the merge is stable
+ * Returns a value less than, equal to or greater than 0 if the first input is
+ * less than, equal to or greater than the second input
+ */
+int merge_handle_compare_inputs(
+     merge_handle_t *merge_handle,
+     int first_input_index,
+     int second_input_index )
+{
+	merge_input_t *first_input  = NULL;
+	merge_input_t *second_input = NULL;
+	size_t compare_length       = 0;
+	int result                  = 0;
+
+	first_input  = &( ( merge_handle->inputs )[ first_input_index ] );
+	second_input = &( ( merge_handle->inputs )[ second_input_index ] );
+
+	compare_length = first_input->key_length;
+
+	if( compare_length > second_input->key_length )
+	{
+		compare_length = second_input->key_length;
+	}
+	if( compare_length > 0 )
+	{
+		result = memory_compare(
+		          first_input->key,
+		          second_input->key,
+		          compare_length );
+	}
+	if( result == 0 )
+	{
+		if( first_input->key_length < second_input->key_length )
+		{
+			result = -1;
+		}
+		else if( first_input->key_length > second_input->key_length )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = first_input_index - second_input_index;
+		}
+	}
+	return( result );
+}
+
+/* Moves the input index at the heap index up until the heap is ordered
+ */
+void merge_handle_heap_sift_up(
+      merge_handle_t *merge_handle,
+      int heap_index )
+{
+	int parent_index = 0;
+	int swap_value   = 0;
+
+	while( heap_index > 0 )
+	{
+		parent_index = ( heap_index - 1 ) / 2;
+
+		if( merge_handle_compare_inputs(
+		     merge_handle,
+		     merge_handle->heap[ heap_index ],
+		     merge_handle->heap[ parent_index ] ) >= 0 )
+		{
+			break;
+		}
+		swap_value                         = merge_handle->heap[ heap_index ];
+		merge_handle->heap[ heap_index ]   = merge_handle->heap[ parent_index ];
+		merge_handle->heap[ parent_index ] = swap_value;
+
+		heap_index = parent_index;
+	}
+}
+
+/* Moves the input index at the heap index down until the heap is ordered
+ */
+void merge_handle_heap_sift_down(
+      merge_handle_t *merge_handle,
+      int heap_index )
+{
+	int child_index    = 0;
+	int smallest_index = 0;
+	int swap_value     = 0;
+
+	while( heap_index < merge_handle->heap_size )
+	{
+		smallest_index = heap_index;
+		child_index    = ( heap_index * 2 ) + 1;
+
+		if( ( child_index < merge_handle->heap_size )
+		 && ( merge_handle_compare_inputs(
+		       merge_handle,
+		       merge_handle->heap[ child_index ],
+		       merge_handle->heap[ smallest_index ] ) < 0 ) )
+		{
+			smallest_index = child_index;
+		}
+		child_index += 1;
+
+		if( ( child_index < merge_handle->heap_size )
+		 && ( merge_handle_compare_inputs(
+		       merge_handle,
+		       merge_handle->heap[ child_index ],
+		       merge_handle->heap[ smallest_index ] ) < 0 ) )
+		{
+			smallest_index = child_index;
+		}
+		if( smallest_index == heap_index )
+		{
+			break;
+		}
+		swap_value                           = merge_handle->heap[ heap_index ];
+		merge_handle->heap[ heap_index ]     = merge_handle->heap[ smallest_index ];
+		merge_handle->heap[ smallest_index ] = swap_value;
+
+		heap_index = smallest_index;
+	}
+}
+
+/* Merges the records of the inputs, which are sorted by source, into the output stream
+ * The CSV header is only written once and must be the same for every input
+ * Returns 1 if successful or -1 on error
+ */
+int merge_handle_merge(
+     merge_handle_t *merge_handle,
+     FILE *output_stream,
+     libcerror_error_t **error )
+{
+	merge_input_t *first_input = NULL;
+	merge_input_t *input       = NULL;
+	static char *function      = "merge_handle_merge";
+	size_t compare_length      = 0;
+	int input_format           = 0;
+	int input_index            = 0;
+	int result                 = 0;
+
+	if( merge_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output stream.",
+		 function );
+
+		return( -1 );
+	}
+	merge_handle->heap_size         = 0;
+	merge_handle->input_format      = MERGE_HANDLE_INPUT_FORMAT_UNKNOWN;
+	merge_handle->number_of_records = 0;
+
+	/* Determine the input format from the first line of every input,
+	 * an input without lines is the output of an empty JSON Lines shard
+	 */
+	for( input_index = 0;
+	     input_index < merge_handle->number_of_inputs;
+	     input_index++ )
+	{
+		input = &( ( merge_handle->inputs )[ input_index ] );
+
+		result = merge_handle_read_line(
+		          input,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read first line of input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		input_format = merge_handle_determine_input_format(
+		                input->line,
+		                input->line_length );
+
+		if( input_format == MERGE_HANDLE_INPUT_FORMAT_UNKNOWN )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: unsupported format of input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		if( merge_handle->input_format == MERGE_HANDLE_INPUT_FORMAT_UNKNOWN )
+		{
+			merge_handle->input_format = input_format;
+		}
+		else if( merge_handle->input_format != input_format )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in format of input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		if( input_format == MERGE_HANDLE_INPUT_FORMAT_CSV )
+		{
+			if( first_input == NULL )
+			{
+				first_input = input;
+
+				if( ( file_stream_write(
+				       output_stream,
+				       input->line,
+				       input->line_length ) != input->line_length )
+				 || ( file_stream_write(
+				       output_stream,
+				       "\n",
+				       1 ) != 1 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write CSV header.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else if( ( input->line_length != first_input->line_length )
+			      || ( memory_compare(
+			            input->line,
+			            first_input->line,
+			            input->line_length ) != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: mismatch in CSV header of input: %d.",
+				 function,
+				 input_index );
+
+				return( -1 );
+			}
+		}
+	}
+	/* Fill the heap with the first record of every input
+	 */
+	for( input_index = 0;
+	     input_index < merge_handle->number_of_inputs;
+	     input_index++ )
+	{
+		input = &( ( merge_handle->inputs )[ input_index ] );
+
+		if( input->line_length == 0 )
+		{
+			continue;
+		}
+		/* The first line of a CSV input is the header, the first line
+		 * of a JSON Lines input is its first record
+		 */
+		if( merge_handle->input_format == MERGE_HANDLE_INPUT_FORMAT_CSV )
+		{
+			result = merge_handle_read_record(
+			          merge_handle,
+			          input_index,
+			          error );
+		}
+		else
+		{
+			result = merge_handle_set_record_key(
+			          merge_handle,
+			          input_index,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read first record of input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			merge_handle->heap[ merge_handle->heap_size ] = input_index;
+
+			merge_handle->heap_size += 1;
+
+			merge_handle_heap_sift_up(
+			 merge_handle,
+			 merge_handle->heap_size - 1 );
+		}
+	}
+	while( merge_handle->heap_size > 0 )
+	{
+		if( merge_handle->abort != 0 )
+		{
+			break;
+		}
+		input_index = merge_handle->heap[ 0 ];
+		input       = &( ( merge_handle->inputs )[ input_index ] );
+
+		if( ( file_stream_write(
+		       output_stream,
+		       input->line,
+		       input->line_length ) != input->line_length )
+		 || ( file_stream_write(
+		       output_stream,
+		       "\n",
+		       1 ) != 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write record.",
+			 function );
+
+			return( -1 );
+		}
+		merge_handle->number_of_records += 1;
+
+		result = merge_handle_read_record(
+		          merge_handle,
+		          input_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record of input: %d.",
+			 function,
+			 input_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			merge_handle->heap_size -= 1;
+
+			merge_handle->heap[ 0 ] = merge_handle->heap[ merge_handle->heap_size ];
+		}
+		else
+		{
+			/* An input that is not sorted would silently result in
+			 * unsorted output
+			 */
+			compare_length = input->key_length;
+
+			if( compare_length > input->previous_key_length )
+			{
+				compare_length = input->previous_key_length;
+			}
+			result = 0;
+
+			if( compare_length > 0 )
+			{
+				result = memory_compare(
+				          input->key,
+				          input->previous_key,
+				          compare_length );
+			}
+			if( ( result < 0 )
+			 || ( ( result == 0 )
+			  && ( input->key_length < input->previous_key_length ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+				 "%s: input: %d is not sorted by source.",
+				 function,
+				 input_index );
+
+				return( -1 );
+			}
+		}
+		merge_handle_heap_sift_down(
+		 merge_handle,
+		 0 );
+	}
+	return( 1 );
+}
+
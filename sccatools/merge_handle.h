@@ -0,0 +1,196 @@
+/*
+ * Merge handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MERGE_HANDLE_H )
+#define _MERGE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of inputs
+ */
+#define MERGE_HANDLE_MAXIMUM_NUMBER_OF_INPUTS	4096
+
+/* The initial size of the line buffer of an input
+ */
+#define MERGE_HANDLE_INITIAL_LINE_SIZE		4096
+
+enum MERGE_HANDLE_INPUT_FORMATS
+{
+	MERGE_HANDLE_INPUT_FORMAT_UNKNOWN	= 0,
+	MERGE_HANDLE_INPUT_FORMAT_CSV		= 1,
+	MERGE_HANDLE_INPUT_FORMAT_JSONL		= 2
+};
+
+typedef struct merge_input merge_input_t;
+
+struct merge_input
+{
+	/* The input stream
+	 */
+	FILE *stream;
+
+	/* The current line, without the end-of-line characters
+	 */
+	char *line;
+
+	/* The line buffer size
+	 */
+	size_t line_size;
+
+	/* The line length
+	 */
+	size_t line_length;
+
+	/* The source of the current line
+	 */
+	char *key;
+
+	/* The source of the previous line
+	 */
+	char *previous_key;
+
+	/* The key buffer size, the previous key buffer has the same size
+	 */
+	size_t key_size;
+
+	/* The key length
+	 */
+	size_t key_length;
+
+	/* The previous key length
+	 */
+	size_t previous_key_length;
+};
+
+typedef struct merge_handle merge_handle_t;
+
+struct merge_handle
+{
+	/* The inputs
+	 */
+	merge_input_t *inputs;
+
+	/* The number of inputs
+	 */
+	int number_of_inputs;
+
+	/* The input indexes ordered as a binary min heap on the source
+	 */
+	int *heap;
+
+	/* The number of input indexes in the heap
+	 */
+	int heap_size;
+
+	/* The input format
+	 */
+	int input_format;
+
+	/* The number of records written
+	 */
+	uint64_t number_of_records;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int merge_handle_initialize(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error );
+
+int merge_handle_free(
+     merge_handle_t **merge_handle,
+     libcerror_error_t **error );
+
+int merge_handle_signal_abort(
+     merge_handle_t *merge_handle,
+     libcerror_error_t **error );
+
+int merge_handle_open_input(
+     merge_handle_t *merge_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int merge_handle_append_input_stream(
+     merge_handle_t *merge_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int merge_handle_read_line(
+     merge_input_t *input,
+     libcerror_error_t **error );
+
+int merge_handle_determine_input_format(
+     const char *line,
+     size_t line_length );
+
+int merge_handle_get_record_key(
+     int input_format,
+     const char *line,
+     size_t line_length,
+     char *key,
+     size_t key_size,
+     size_t *key_length,
+     libcerror_error_t **error );
+
+int merge_handle_set_record_key(
+     merge_handle_t *merge_handle,
+     int input_index,
+     libcerror_error_t **error );
+
+int merge_handle_read_record(
+     merge_handle_t *merge_handle,
+     int input_index,
+     libcerror_error_t **error );
+
+int merge_handle_compare_inputs(
+     merge_handle_t *merge_handle,
+     int first_input_index,
+     int second_input_index );
+
+void merge_handle_heap_sift_up(
+      merge_handle_t *merge_handle,
+      int heap_index );
+
+void merge_handle_heap_sift_down(
+      merge_handle_t *merge_handle,
+      int heap_index );
+
+int merge_handle_merge(
+     merge_handle_t *merge_handle,
+     FILE *output_stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MERGE_HANDLE_H ) */
+
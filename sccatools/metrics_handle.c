@@ -0,0 +1,1566 @@
+/*
+ * Metrics handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "metrics_handle.h"
+#include "output_buffer.h"
+#include "progress_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+const char *metrics_handle_stage_names[ METRICS_HANDLE_NUMBER_OF_STAGES ] = {
+	"read",
+	"parse",
+	"output" };
+
+const char *metrics_handle_cache_names[ METRICS_HANDLE_NUMBER_OF_CACHES ] = {
+	"compressed_blocks",
+	"parse" };
+
+const char *metrics_handle_queue_names[ METRICS_HANDLE_NUMBER_OF_QUEUES ] = {
+	"connections" };
+
+const char *metrics_handle_error_domain_names[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS ] = {
+	"arguments",
+	"conversion",
+	"compression",
+	"io",
+	"input",
+	"memory",
+	"output",
+	"runtime",
+	"unknown" };
+
+/* The libcerror error domains in the order of metrics_handle_error_domain_names
+ */
+const int metrics_handle_error_domains[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS - 1 ] = {
+	LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+	LIBCERROR_ERROR_DOMAIN_CONVERSION,
+	LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+	LIBCERROR_ERROR_DOMAIN_IO,
+	LIBCERROR_ERROR_DOMAIN_INPUT,
+	LIBCERROR_ERROR_DOMAIN_MEMORY,
+	LIBCERROR_ERROR_DOMAIN_OUTPUT,
+	LIBCERROR_ERROR_DOMAIN_RUNTIME };
+
+/* Creates a metrics handle
+ * Make sure the value metrics_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_initialize(
+     metrics_handle_t **metrics_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_initialize";
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metrics_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metrics handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metrics_handle = memory_allocate_structure(
+	                   metrics_handle_t );
+
+	if( *metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metrics handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metrics_handle,
+	     0,
+	     sizeof( metrics_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metrics handle.",
+		 function );
+
+		memory_free(
+		 *metrics_handle );
+
+		*metrics_handle = NULL;
+
+		return( -1 );
+	}
+	if( output_buffer_initialize(
+	     &( ( *metrics_handle )->output_buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *metrics_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *metrics_handle != NULL )
+	{
+		if( ( *metrics_handle )->output_buffer != NULL )
+		{
+			output_buffer_free(
+			 &( ( *metrics_handle )->output_buffer ),
+			 NULL );
+		}
+		memory_free(
+		 *metrics_handle );
+
+		*metrics_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metrics handle
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_free(
+     metrics_handle_t **metrics_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_free";
+	int result            = 1;
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metrics_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *metrics_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( output_buffer_free(
+		     &( ( *metrics_handle )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *metrics_handle );
+
+		*metrics_handle = NULL;
+	}
+	return( result );
+}
+
+/* Determines the histogram bucket of a latency in nano seconds
+ * Returns the bucket index
+ */
+int metrics_handle_get_bucket_index(
+     uint64_t value )
+{
+	int exponent        = 0;
+	int sub_bucket_index = 0;
+
+	/* The upper bounds of the buckets are inclusive
+	 */
+	if( value > 0 )
+	{
+		value -= 1;
+	}
+	while( ( exponent < 63 )
+	    && ( ( value >> ( exponent + 1 ) ) != 0 ) )
+	{
+		exponent++;
+	}
+	if( exponent < METRICS_HANDLE_HISTOGRAM_MINIMUM_EXPONENT )
+	{
+		return( 0 );
+	}
+	if( exponent >= METRICS_HANDLE_HISTOGRAM_MAXIMUM_EXPONENT )
+	{
+		return( METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 1 );
+	}
+	sub_bucket_index = (int) ( value >> ( exponent - METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS ) )
+	                 & ( ( 1 << METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS ) - 1 );
+
+	return( ( ( exponent - METRICS_HANDLE_HISTOGRAM_MINIMUM_EXPONENT ) << METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS ) + sub_bucket_index );
+}
+
+/* Retrieves the inclusive upper bound of a histogram bucket in nano seconds
+ * Returns 1 if successful, 0 if the bucket has no upper bound or -1 on error
+ */
+int metrics_handle_get_bucket_upper_bound(
+     int bucket_index,
+     uint64_t *upper_bound )
+{
+	int exponent         = 0;
+	int sub_bucket_index = 0;
+
+	if( ( bucket_index < 0 )
+	 || ( bucket_index >= METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS )
+	 || ( upper_bound == NULL ) )
+	{
+		return( -1 );
+	}
+	if( bucket_index == ( METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 1 ) )
+	{
+		return( 0 );
+	}
+	exponent         = METRICS_HANDLE_HISTOGRAM_MINIMUM_EXPONENT + ( bucket_index >> METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS );
+	sub_bucket_index = bucket_index & ( ( 1 << METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS ) - 1 );
+
+	*upper_bound = ( (uint64_t) 1 << exponent )
+	             + ( (uint64_t) ( sub_bucket_index + 1 ) << ( exponent - METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS ) );
+
+	return( 1 );
+}
+
+/* Determines the error domain of an error
+ * libcerror does not expose the domain of an error, hence it is determined
+ * by matching the error codes of every domain
+ * Returns the index of the error domain in metrics_handle_error_domain_names
+ */
+int metrics_handle_get_error_domain_index(
+     libcerror_error_t *error )
+{
+	int domain_index = 0;
+	int error_code   = 0;
+
+	if( error != NULL )
+	{
+		for( domain_index = 0;
+		     domain_index < ( METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS - 1 );
+		     domain_index++ )
+		{
+			for( error_code = 0;
+			     error_code < METRICS_HANDLE_MAXIMUM_ERROR_CODE;
+			     error_code++ )
+			{
+				if( libcerror_error_matches(
+				     error,
+				     metrics_handle_error_domains[ domain_index ],
+				     error_code ) != 0 )
+				{
+					return( domain_index );
+				}
+			}
+		}
+	}
+	return( METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS - 1 );
+}
+
+/* Adds a file that was parsed
+ * The input and uncompressed data sizes and compressed block cache statistics
+ * are retrieved from the file, hence this function must be called before the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_add_file(
+     metrics_handle_t *metrics_handle,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	uint64_t number_of_bytes              = 0;
+	uint64_t number_of_cache_hits         = 0;
+	uint64_t number_of_cache_misses       = 0;
+	uint64_t number_of_uncompressed_bytes = 0;
+	static char *function                 = "metrics_handle_add_file";
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( libscca_file_get_statistic(
+	       file,
+	       LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	       &number_of_bytes,
+	       error ) == -1 )
+	 || ( libscca_file_get_statistic(
+	       file,
+	       LIBSCCA_STATISTIC_TYPE_UNCOMPRESSED_DATA_SIZE,
+	       &number_of_uncompressed_bytes,
+	       error ) == -1 )
+	 || ( libscca_file_get_statistic(
+	       file,
+	       LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_HITS,
+	       &number_of_cache_hits,
+	       error ) == -1 )
+	 || ( libscca_file_get_statistic(
+	       file,
+	       LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_MISSES,
+	       &number_of_cache_misses,
+	       error ) == -1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	metrics_handle->number_of_files              += 1;
+	metrics_handle->number_of_bytes              += number_of_bytes;
+	metrics_handle->number_of_uncompressed_bytes += number_of_uncompressed_bytes;
+
+	metrics_handle->number_of_cache_hits[ METRICS_HANDLE_CACHE_COMPRESSED_BLOCKS ]   += number_of_cache_hits;
+	metrics_handle->number_of_cache_misses[ METRICS_HANDLE_CACHE_COMPRESSED_BLOCKS ] += number_of_cache_misses;
+	metrics_handle->cache_is_used[ METRICS_HANDLE_CACHE_COMPRESSED_BLOCKS ]           = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds a file that could not be parsed
+ * The error is counted by its error domain, a failure without an error in the unknown domain
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_add_failed_file(
+     metrics_handle_t *metrics_handle,
+     libcerror_error_t *file_error,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_add_failed_file";
+	int domain_index      = 0;
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	domain_index = metrics_handle_get_error_domain_index(
+	                file_error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	metrics_handle->number_of_failed_files           += 1;
+	metrics_handle->number_of_errors[ domain_index ] += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds the latency of a stage in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_add_stage_latency(
+     metrics_handle_t *metrics_handle,
+     int stage,
+     uint64_t latency,
+     libcerror_error_t **error )
+{
+	metrics_histogram_t *histogram = NULL;
+	static char *function          = "metrics_handle_add_stage_latency";
+	int bucket_index               = 0;
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stage < 0 )
+	 || ( stage >= METRICS_HANDLE_NUMBER_OF_STAGES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stage.",
+		 function );
+
+		return( -1 );
+	}
+	histogram    = &( metrics_handle->stage_latencies[ stage ] );
+	bucket_index = metrics_handle_get_bucket_index(
+	                latency );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	histogram->bucket_counts[ bucket_index ] += 1;
+	histogram->sum                           += latency;
+	histogram->count                         += 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds the latency of a stage that started at a timestamp in nano seconds
+ * The latency is not added if the start timestamp is 0, which indicates no clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_add_stage_latency_since(
+     metrics_handle_t *metrics_handle,
+     int stage,
+     uint64_t start_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_add_stage_latency_since";
+	uint64_t timestamp    = 0;
+
+	if( start_timestamp == 0 )
+	{
+		return( 1 );
+	}
+	if( progress_handle_get_timestamp(
+	     &timestamp ) != 1 )
+	{
+		return( 1 );
+	}
+	if( timestamp < start_timestamp )
+	{
+		timestamp = start_timestamp;
+	}
+	if( metrics_handle_add_stage_latency(
+	     metrics_handle,
+	     stage,
+	     timestamp - start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add stage latency.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds the hits and misses of a cache
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_add_cache_statistics(
+     metrics_handle_t *metrics_handle,
+     int cache,
+     uint64_t number_of_hits,
+     uint64_t number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_add_cache_statistics";
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache < 0 )
+	 || ( cache >= METRICS_HANDLE_NUMBER_OF_CACHES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	metrics_handle->number_of_cache_hits[ cache ]   += number_of_hits;
+	metrics_handle->number_of_cache_misses[ cache ] += number_of_misses;
+	metrics_handle->cache_is_used[ cache ]           = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds a number of items to the depth of a queue, a negative number removes items
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_add_queue_depth(
+     metrics_handle_t *metrics_handle,
+     int queue,
+     int64_t depth,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_add_queue_depth";
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue < 0 )
+	 || ( queue >= METRICS_HANDLE_NUMBER_OF_QUEUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported queue.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	metrics_handle->queue_depths[ queue ] += depth;
+	metrics_handle->queue_is_used[ queue ] = 1;
+
+	if( metrics_handle->queue_depths[ queue ] > metrics_handle->maximum_queue_depths[ queue ] )
+	{
+		metrics_handle->maximum_queue_depths[ queue ] = metrics_handle->queue_depths[ queue ];
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Appends a number of nano seconds as a decimal number of seconds
+ * The fraction is printed without trailing zeros, so that the value is exact
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_append_seconds(
+     output_buffer_t *output_buffer,
+     uint64_t nano_seconds,
+     libcerror_error_t **error )
+{
+	char fraction_string[ 10 ];
+
+	static char *function  = "metrics_handle_append_seconds";
+	uint64_t fraction      = 0;
+	size_t fraction_length = 9;
+	int string_index       = 0;
+
+	if( output_buffer_append_decimal(
+	     output_buffer,
+	     nano_seconds / 1000000000UL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append seconds.",
+		 function );
+
+		return( -1 );
+	}
+	fraction = nano_seconds % 1000000000UL;
+
+	if( fraction == 0 )
+	{
+		return( 1 );
+	}
+	fraction_string[ 0 ] = '.';
+
+	for( string_index = 9;
+	     string_index > 0;
+	     string_index-- )
+	{
+		fraction_string[ string_index ] = (char) ( '0' + ( fraction % 10 ) );
+
+		fraction /= 10;
+	}
+	while( fraction_string[ fraction_length ] == '0' )
+	{
+		fraction_length--;
+	}
+	if( output_buffer_append_string(
+	     output_buffer,
+	     fraction_string,
+	     fraction_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fraction.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the help and type lines of a metric
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_append_metric_header(
+     output_buffer_t *output_buffer,
+     const char *name,
+     const char *type,
+     const char *help,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_append_metric_header";
+
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "# HELP ",
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       name,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       ' ',
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       help,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n# TYPE ",
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       name,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       ' ',
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       type,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append header of metric: %s.",
+		 function,
+		 name );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a sample of a metric with an optional label
+ * The label value contains NULL if the sample has no label
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_append_sample(
+     output_buffer_t *output_buffer,
+     const char *name,
+     const char *label_name,
+     const char *label_value,
+     int64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_append_sample";
+
+	if( output_buffer_append_narrow_string(
+	     output_buffer,
+	     name,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( label_value != NULL )
+	{
+		if( ( output_buffer_append_character(
+		       output_buffer,
+		       '{',
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       label_name,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "=\"",
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       label_value,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "\"}",
+		       error ) != 1 ) )
+		{
+			goto on_error;
+		}
+	}
+	if( ( output_buffer_append_character(
+	       output_buffer,
+	       ' ',
+	       error ) != 1 )
+	 || ( output_buffer_append_signed_decimal(
+	       output_buffer,
+	       value,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append sample of metric: %s.",
+	 function,
+	 name );
+
+	return( -1 );
+}
+
+/* Appends the latency histogram of a stage
+ * The bucket counts are cumulative as required by the text exposition format
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_append_histogram(
+     output_buffer_t *output_buffer,
+     const char *name,
+     const char *stage_name,
+     metrics_histogram_t *histogram,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_append_histogram";
+	uint64_t count        = 0;
+	uint64_t upper_bound  = 0;
+	int bucket_index      = 0;
+	int result            = 0;
+
+	for( bucket_index = 0;
+	     bucket_index < METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		count += histogram->bucket_counts[ bucket_index ];
+
+		result = metrics_handle_get_bucket_upper_bound(
+		          bucket_index,
+		          &upper_bound );
+
+		if( ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       name,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "_bucket{stage=\"",
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       stage_name,
+		       error ) != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "\",le=\"",
+		       error ) != 1 ) )
+		{
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			result = metrics_handle_append_seconds(
+			          output_buffer,
+			          upper_bound,
+			          error );
+		}
+		else
+		{
+			result = output_buffer_append_narrow_string(
+			          output_buffer,
+			          "+Inf",
+			          error );
+		}
+		if( ( result != 1 )
+		 || ( output_buffer_append_narrow_string(
+		       output_buffer,
+		       "\"} ",
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       count,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			goto on_error;
+		}
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       name,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "_sum{stage=\"",
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       stage_name,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\"} ",
+	       error ) != 1 )
+	 || ( metrics_handle_append_seconds(
+	       output_buffer,
+	       histogram->sum,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       name,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "_count{stage=\"",
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       stage_name,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\"} ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       histogram->count,
+	       error ) != 1 )
+	 || ( output_buffer_append_character(
+	       output_buffer,
+	       '\n',
+	       error ) != 1 ) )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append histogram of stage: %s.",
+	 function,
+	 stage_name );
+
+	return( -1 );
+}
+
+/* Appends the metrics in the Prometheus text exposition format
+ * The cache, queue and stage metrics are only appended once they were used
+ * Returns 1 if successful or -1 on error
+ */
+int metrics_handle_append_text(
+     metrics_handle_t *metrics_handle,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "metrics_handle_append_text";
+	int index             = 0;
+	int result            = 1;
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     metrics_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( metrics_handle_append_metric_header(
+	       output_buffer,
+	       "scca_files_parsed_total",
+	       "counter",
+	       "Number of prefetch files that were parsed.",
+	       error ) != 1 )
+	 || ( metrics_handle_append_sample(
+	       output_buffer,
+	       "scca_files_parsed_total",
+	       NULL,
+	       NULL,
+	       (int64_t) metrics_handle->number_of_files,
+	       error ) != 1 )
+	 || ( metrics_handle_append_metric_header(
+	       output_buffer,
+	       "scca_files_failed_total",
+	       "counter",
+	       "Number of prefetch files that could not be parsed.",
+	       error ) != 1 )
+	 || ( metrics_handle_append_sample(
+	       output_buffer,
+	       "scca_files_failed_total",
+	       NULL,
+	       NULL,
+	       (int64_t) metrics_handle->number_of_failed_files,
+	       error ) != 1 )
+	 || ( metrics_handle_append_metric_header(
+	       output_buffer,
+	       "scca_input_bytes_total",
+	       "counter",
+	       "Number of bytes read from the prefetch files that were parsed.",
+	       error ) != 1 )
+	 || ( metrics_handle_append_sample(
+	       output_buffer,
+	       "scca_input_bytes_total",
+	       NULL,
+	       NULL,
+	       (int64_t) metrics_handle->number_of_bytes,
+	       error ) != 1 )
+	 || ( metrics_handle_append_metric_header(
+	       output_buffer,
+	       "scca_uncompressed_bytes_total",
+	       "counter",
+	       "Number of bytes of uncompressed data of the prefetch files that were parsed.",
+	       error ) != 1 )
+	 || ( metrics_handle_append_sample(
+	       output_buffer,
+	       "scca_uncompressed_bytes_total",
+	       NULL,
+	       NULL,
+	       (int64_t) metrics_handle->number_of_uncompressed_bytes,
+	       error ) != 1 )
+	 || ( metrics_handle_append_metric_header(
+	       output_buffer,
+	       "scca_errors_total",
+	       "counter",
+	       "Number of prefetch files that could not be parsed by libcerror error domain.",
+	       error ) != 1 ) )
+	{
+		result = -1;
+	}
+	for( index = 0;
+	     ( result == 1 ) && ( index < METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS );
+	     index++ )
+	{
+		result = metrics_handle_append_sample(
+		          output_buffer,
+		          "scca_errors_total",
+		          "domain",
+		          metrics_handle_error_domain_names[ index ],
+		          (int64_t) metrics_handle->number_of_errors[ index ],
+		          error );
+	}
+	for( index = 0;
+	     ( result == 1 ) && ( index < METRICS_HANDLE_NUMBER_OF_CACHES );
+	     index++ )
+	{
+		if( metrics_handle->cache_is_used[ index ] == 0 )
+		{
+			continue;
+		}
+		if( ( metrics_handle_append_metric_header(
+		       output_buffer,
+		       "scca_cache_hits_total",
+		       "counter",
+		       "Number of cache lookups that were found in the cache.",
+		       error ) != 1 )
+		 || ( metrics_handle_append_sample(
+		       output_buffer,
+		       "scca_cache_hits_total",
+		       "cache",
+		       metrics_handle_cache_names[ index ],
+		       (int64_t) metrics_handle->number_of_cache_hits[ index ],
+		       error ) != 1 )
+		 || ( metrics_handle_append_metric_header(
+		       output_buffer,
+		       "scca_cache_misses_total",
+		       "counter",
+		       "Number of cache lookups that were not found in the cache.",
+		       error ) != 1 )
+		 || ( metrics_handle_append_sample(
+		       output_buffer,
+		       "scca_cache_misses_total",
+		       "cache",
+		       metrics_handle_cache_names[ index ],
+		       (int64_t) metrics_handle->number_of_cache_misses[ index ],
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+	}
+	for( index = 0;
+	     ( result == 1 ) && ( index < METRICS_HANDLE_NUMBER_OF_QUEUES );
+	     index++ )
+	{
+		if( metrics_handle->queue_is_used[ index ] == 0 )
+		{
+			continue;
+		}
+		if( ( metrics_handle_append_metric_header(
+		       output_buffer,
+		       "scca_queue_depth",
+		       "gauge",
+		       "Number of items that wait in the queue.",
+		       error ) != 1 )
+		 || ( metrics_handle_append_sample(
+		       output_buffer,
+		       "scca_queue_depth",
+		       "queue",
+		       metrics_handle_queue_names[ index ],
+		       metrics_handle->queue_depths[ index ],
+		       error ) != 1 )
+		 || ( metrics_handle_append_metric_header(
+		       output_buffer,
+		       "scca_queue_depth_maximum",
+		       "gauge",
+		       "Maximum number of items that waited in the queue at the same time.",
+		       error ) != 1 )
+		 || ( metrics_handle_append_sample(
+		       output_buffer,
+		       "scca_queue_depth_maximum",
+		       "queue",
+		       metrics_handle_queue_names[ index ],
+		       metrics_handle->maximum_queue_depths[ index ],
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+	}
+	for( index = 0;
+	     ( result == 1 ) && ( index < METRICS_HANDLE_NUMBER_OF_STAGES );
+	     index++ )
+	{
+		if( metrics_handle->stage_latencies[ index ].count == 0 )
+		{
+			continue;
+		}
+		if( ( metrics_handle_append_metric_header(
+		       output_buffer,
+		       "scca_stage_latency_seconds",
+		       "histogram",
+		       "Latency of the processing stages of a prefetch file.",
+		       error ) != 1 )
+		 || ( metrics_handle_append_histogram(
+		       output_buffer,
+		       "scca_stage_latency_seconds",
+		       metrics_handle_stage_names[ index ],
+		       &( metrics_handle->stage_latencies[ index ] ),
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     metrics_handle->mutex,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append metrics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the metrics in the Prometheus text exposition format to a file
+ * The metrics are only written if the interval in nano seconds has elapsed since
+ * the last write, an interval of 0 writes them unconditionally
+ * The metrics are written to a temporary file that replaces the file, hence
+ * a collector that reads the file never reads partially written metrics
+ * This function should not be called by multiple threads at the same time
+ * Returns 1 if written, 0 if the interval has not elapsed or -1 on error
+ */
+int metrics_handle_write_file(
+     metrics_handle_t *metrics_handle,
+     const char *path,
+     uint64_t interval,
+     libcerror_error_t **error )
+{
+	char *temporary_path         = NULL;
+	FILE *stream                 = NULL;
+	static char *function        = "metrics_handle_write_file";
+	size_t path_length           = 0;
+	uint64_t timestamp           = 0;
+
+	if( metrics_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metrics handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( progress_handle_get_timestamp(
+	     &timestamp ) != 1 )
+	{
+		timestamp = 0;
+	}
+	if( ( interval > 0 )
+	 && ( metrics_handle->write_timestamp != 0 )
+	 && ( timestamp >= metrics_handle->write_timestamp )
+	 && ( ( timestamp - metrics_handle->write_timestamp ) < interval ) )
+	{
+		return( 0 );
+	}
+	path_length = narrow_string_length(
+	               path );
+
+	temporary_path = narrow_string_allocate(
+	                  path_length + 5 );
+
+	if( temporary_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create temporary path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     temporary_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     &( temporary_path[ path_length ] ),
+	     ".tmp",
+	     5 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy temporary path suffix.",
+		 function );
+
+		goto on_error;
+	}
+	metrics_handle->output_buffer->data_offset = 0;
+
+	if( metrics_handle_append_text(
+	     metrics_handle,
+	     metrics_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append metrics.",
+		 function );
+
+		goto on_error;
+	}
+	stream = file_stream_open(
+	          temporary_path,
+	          "wb" );
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open temporary file: %s.",
+		 function,
+		 temporary_path );
+
+		goto on_error;
+	}
+	if( output_buffer_write(
+	     metrics_handle->output_buffer,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metrics.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close temporary file.",
+		 function );
+
+		goto on_error;
+	}
+	stream = NULL;
+
+#if defined( WINAPI )
+	/* rename does not replace an existing file on Windows
+	 */
+	remove(
+	 path );
+#endif
+	if( rename(
+	     temporary_path,
+	     path ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to replace file: %s.",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_path );
+
+	metrics_handle->write_timestamp = timestamp;
+
+	return( 1 );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( temporary_path != NULL )
+	{
+		remove(
+		 temporary_path );
+
+		memory_free(
+		 temporary_path );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,271 @@
+/*
+ * Metrics handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _METRICS_HANDLE_H )
+#define _METRICS_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The stages of which the latency is measured
+ * The stages are the same as those of the batch pipeline
+ */
+enum METRICS_HANDLE_STAGES
+{
+	METRICS_HANDLE_STAGE_READ		= 0,
+	METRICS_HANDLE_STAGE_PARSE		= 1,
+	METRICS_HANDLE_STAGE_OUTPUT		= 2
+};
+
+#define METRICS_HANDLE_NUMBER_OF_STAGES		3
+
+enum METRICS_HANDLE_CACHES
+{
+	METRICS_HANDLE_CACHE_COMPRESSED_BLOCKS	= 0,
+	METRICS_HANDLE_CACHE_PARSE		= 1
+};
+
+#define METRICS_HANDLE_NUMBER_OF_CACHES		2
+
+enum METRICS_HANDLE_QUEUES
+{
+	METRICS_HANDLE_QUEUE_CONNECTIONS	= 0
+};
+
+#define METRICS_HANDLE_NUMBER_OF_QUEUES		1
+
+/* The libcerror error domains and an unknown domain for failures without an error
+ */
+#define METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS	9
+
+/* The error codes that are checked to determine the domain of an error
+ */
+#define METRICS_HANDLE_MAXIMUM_ERROR_CODE	64
+
+/* The latency histograms have log-linear buckets in the manner of HDR histograms,
+ * every power of 2 of nano seconds is split into 2^METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS
+ * buckets of equal width. The first bucket contains the latencies up to 1.5 micro seconds
+ * and the last bucket the latencies of more than 2^METRICS_HANDLE_HISTOGRAM_MAXIMUM_EXPONENT
+ * nano seconds, which is about 68.7 seconds
+ */
+#define METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS	1
+#define METRICS_HANDLE_HISTOGRAM_MINIMUM_EXPONENT	10
+#define METRICS_HANDLE_HISTOGRAM_MAXIMUM_EXPONENT	36
+
+#define METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS \
+	( ( ( METRICS_HANDLE_HISTOGRAM_MAXIMUM_EXPONENT - METRICS_HANDLE_HISTOGRAM_MINIMUM_EXPONENT ) << METRICS_HANDLE_HISTOGRAM_SUB_BUCKET_BITS ) + 1 )
+
+extern const char *metrics_handle_stage_names[ METRICS_HANDLE_NUMBER_OF_STAGES ];
+extern const char *metrics_handle_cache_names[ METRICS_HANDLE_NUMBER_OF_CACHES ];
+extern const char *metrics_handle_queue_names[ METRICS_HANDLE_NUMBER_OF_QUEUES ];
+extern const char *metrics_handle_error_domain_names[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS ];
+extern const int metrics_handle_error_domains[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS - 1 ];
+
+typedef struct metrics_histogram metrics_histogram_t;
+
+struct metrics_histogram
+{
+	/* The number of values per bucket
+	 */
+	uint64_t bucket_counts[ METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS ];
+
+	/* The sum of the values in nano seconds
+	 */
+	uint64_t sum;
+
+	/* The number of values
+	 */
+	uint64_t count;
+};
+
+typedef struct metrics_handle metrics_handle_t;
+
+struct metrics_handle
+{
+	/* The number of files that were parsed
+	 */
+	uint64_t number_of_files;
+
+	/* The number of files that could not be parsed
+	 */
+	uint64_t number_of_failed_files;
+
+	/* The number of bytes of input data
+	 */
+	uint64_t number_of_bytes;
+
+	/* The number of bytes of uncompressed data
+	 */
+	uint64_t number_of_uncompressed_bytes;
+
+	/* The number of errors per error domain
+	 */
+	uint64_t number_of_errors[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS ];
+
+	/* The number of hits per cache
+	 */
+	uint64_t number_of_cache_hits[ METRICS_HANDLE_NUMBER_OF_CACHES ];
+
+	/* The number of misses per cache
+	 */
+	uint64_t number_of_cache_misses[ METRICS_HANDLE_NUMBER_OF_CACHES ];
+
+	/* Value to indicate which caches are used
+	 */
+	uint8_t cache_is_used[ METRICS_HANDLE_NUMBER_OF_CACHES ];
+
+	/* The depth per queue
+	 */
+	int64_t queue_depths[ METRICS_HANDLE_NUMBER_OF_QUEUES ];
+
+	/* The maximum depth per queue
+	 */
+	int64_t maximum_queue_depths[ METRICS_HANDLE_NUMBER_OF_QUEUES ];
+
+	/* Value to indicate which queues are used
+	 */
+	uint8_t queue_is_used[ METRICS_HANDLE_NUMBER_OF_QUEUES ];
+
+	/* The latency histogram per stage
+	 */
+	metrics_histogram_t stage_latencies[ METRICS_HANDLE_NUMBER_OF_STAGES ];
+
+	/* The output buffer used to write the metrics file
+	 */
+	output_buffer_t *output_buffer;
+
+	/* The timestamp the metrics file was last written, in nano seconds
+	 */
+	uint64_t write_timestamp;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the values
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int metrics_handle_initialize(
+     metrics_handle_t **metrics_handle,
+     libcerror_error_t **error );
+
+int metrics_handle_free(
+     metrics_handle_t **metrics_handle,
+     libcerror_error_t **error );
+
+int metrics_handle_get_bucket_index(
+     uint64_t value );
+
+int metrics_handle_get_bucket_upper_bound(
+     int bucket_index,
+     uint64_t *upper_bound );
+
+int metrics_handle_get_error_domain_index(
+     libcerror_error_t *error );
+
+int metrics_handle_add_file(
+     metrics_handle_t *metrics_handle,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+int metrics_handle_add_failed_file(
+     metrics_handle_t *metrics_handle,
+     libcerror_error_t *file_error,
+     libcerror_error_t **error );
+
+int metrics_handle_add_stage_latency(
+     metrics_handle_t *metrics_handle,
+     int stage,
+     uint64_t latency,
+     libcerror_error_t **error );
+
+int metrics_handle_add_stage_latency_since(
+     metrics_handle_t *metrics_handle,
+     int stage,
+     uint64_t start_timestamp,
+     libcerror_error_t **error );
+
+int metrics_handle_add_cache_statistics(
+     metrics_handle_t *metrics_handle,
+     int cache,
+     uint64_t number_of_hits,
+     uint64_t number_of_misses,
+     libcerror_error_t **error );
+
+int metrics_handle_add_queue_depth(
+     metrics_handle_t *metrics_handle,
+     int queue,
+     int64_t depth,
+     libcerror_error_t **error );
+
+int metrics_handle_append_seconds(
+     output_buffer_t *output_buffer,
+     uint64_t nano_seconds,
+     libcerror_error_t **error );
+
+int metrics_handle_append_metric_header(
+     output_buffer_t *output_buffer,
+     const char *name,
+     const char *type,
+     const char *help,
+     libcerror_error_t **error );
+
+int metrics_handle_append_sample(
+     output_buffer_t *output_buffer,
+     const char *name,
+     const char *label_name,
+     const char *label_value,
+     int64_t value,
+     libcerror_error_t **error );
+
+int metrics_handle_append_histogram(
+     output_buffer_t *output_buffer,
+     const char *name,
+     const char *stage_name,
+     metrics_histogram_t *histogram,
+     libcerror_error_t **error );
+
+int metrics_handle_append_text(
+     metrics_handle_t *metrics_handle,
+     output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int metrics_handle_write_file(
+     metrics_handle_t *metrics_handle,
+     const char *path,
+     uint64_t interval,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _METRICS_HANDLE_H ) */
+
@@ -0,0 +1,912 @@
+/*
+ * Output buffer functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+
+		return( -1 );
+	}
+	( *output_buffer )->data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * OUTPUT_BUFFER_INITIAL_DATA_SIZE );
+
+	if( ( *output_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->data_size = OUTPUT_BUFFER_INITIAL_DATA_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		if( ( *output_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->data );
+		}
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the output buffer so that at least additional data size bytes can be appended
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_resize(
+     output_buffer_t *output_buffer,
+     size_t additional_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "output_buffer_resize";
+	size_t data_size      = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( additional_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - output_buffer->data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid additional data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer->data_offset + additional_data_size ) <= output_buffer->data_size )
+	{
+		return( 1 );
+	}
+	data_size = output_buffer->data_size;
+
+	if( data_size == 0 )
+	{
+		data_size = OUTPUT_BUFFER_INITIAL_DATA_SIZE;
+	}
+	while( data_size < ( output_buffer->data_offset + additional_data_size ) )
+	{
+		if( data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+			break;
+		}
+		data_size *= 2;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            output_buffer->data,
+	                            sizeof( uint8_t ) * data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data      = reallocation;
+	output_buffer->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Appends a string
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_resize(
+	     output_buffer,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( output_buffer->data[ output_buffer->data_offset ] ),
+	     string,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_offset += string_length;
+
+	return( 1 );
+}
+
+/* Appends a character
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_character(
+     output_buffer_t *output_buffer,
+     char character,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_character";
+
+	if( output_buffer_resize(
+	     output_buffer,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) character;
+
+	return( 1 );
+}
+
+/* Appends an unsigned integer value in decimal notation
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_decimal(
+     output_buffer_t *output_buffer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	char digits[ 20 ];
+
+	static char *function = "output_buffer_append_decimal";
+	size_t digit_index    = 20;
+
+	do
+	{
+		digits[ --digit_index ] = (char) ( '0' + ( value % 10 ) );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( output_buffer_append_string(
+	     output_buffer,
+	     &( digits[ digit_index ] ),
+	     20 - digit_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append digits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a signed integer value in decimal notation
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_signed_decimal(
+     output_buffer_t *output_buffer,
+     int64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_signed_decimal";
+	uint64_t value_64bit  = 0;
+
+	if( value < 0 )
+	{
+		if( output_buffer_append_character(
+		     output_buffer,
+		     '-',
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sign.",
+			 function );
+
+			return( -1 );
+		}
+		/* Negate without overflowing on the smallest negative value
+		 */
+		value_64bit = (uint64_t) ( -( value + 1 ) ) + 1;
+	}
+	else
+	{
+		value_64bit = (uint64_t) value;
+	}
+	if( output_buffer_append_decimal(
+	     output_buffer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 32-bit value in hexadecimal notation formatted as 0x%08x
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_hexadecimal_32bit(
+     output_buffer_t *output_buffer,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	char digits[ 10 ];
+
+	static char *function = "output_buffer_append_hexadecimal_32bit";
+	uint8_t nibble        = 0;
+	size_t digit_index    = 0;
+
+	digits[ 0 ] = '0';
+	digits[ 1 ] = 'x';
+
+	for( digit_index = 9;
+	     digit_index > 1;
+	     digit_index-- )
+	{
+		nibble = (uint8_t) ( value & 0x0f );
+
+		if( nibble < 10 )
+		{
+			digits[ digit_index ] = (char) ( '0' + nibble );
+		}
+		else
+		{
+			digits[ digit_index ] = (char) ( 'a' + nibble - 10 );
+		}
+		value >>= 4;
+	}
+	if( output_buffer_append_string(
+	     output_buffer,
+	     digits,
+	     10,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append digits.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an end-of-string terminated narrow string to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_narrow_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_narrow_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_string(
+	     output_buffer,
+	     string,
+	     narrow_string_length(
+	      string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a FILETIME value as a date and time string
+ * The string is formatted as: Mon DD, YYYY hh:mm:ss.nnnnnnnnn which is the same
+ * as the libfdatetime ctime format with nano seconds
+ * The values are formatted directly to avoid the overhead of creating a FILETIME object per value
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_filetime(
+     output_buffer_t *output_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	char date_time_string[ 32 ];
+
+	static const char *month_names = "JanFebMarAprMayJunJulAugSepOctNovDec";
+	static char *function          = "output_buffer_append_filetime";
+	uint64_t number_of_days        = 0;
+	uint64_t remainder             = 0;
+	uint64_t year                  = 0;
+	uint64_t year_of_era           = 0;
+	size_t string_index            = 0;
+	uint32_t day                   = 0;
+	uint32_t day_of_era            = 0;
+	uint32_t day_of_year           = 0;
+	uint32_t era                   = 0;
+	uint32_t month                 = 0;
+	uint32_t nano_seconds          = 0;
+	uint32_t seconds               = 0;
+	int digit_index                = 0;
+
+	/* The FILETIME is the number of 100 nano seconds since January 1, 1601
+	 */
+	number_of_days = filetime / 864000000000UL;
+	remainder      = filetime % 864000000000UL;
+	seconds        = (uint32_t) ( remainder / 10000000UL );
+	nano_seconds   = (uint32_t) ( remainder % 10000000UL ) * 100;
+
+	/* Determine the civil date using days since March 1, 0000 to have the leap day as the last day of the year
+	 * where January 1, 1601 is day 584694
+	 */
+	number_of_days += 584694;
+
+	era         = (uint32_t) ( number_of_days / 146097 );
+	day_of_era  = (uint32_t) ( number_of_days % 146097 );
+	year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+	day_of_year = day_of_era - (uint32_t) ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+	month       = ( ( 5 * day_of_year ) + 2 ) / 153;
+	day         = day_of_year - ( ( ( 153 * month ) + 2 ) / 5 ) + 1;
+	year        = year_of_era + ( (uint64_t) era * 400 );
+
+	if( month < 10 )
+	{
+		month += 3;
+	}
+	else
+	{
+		month -= 9;
+		year  += 1;
+	}
+	date_time_string[ string_index++ ] = month_names[ ( ( month - 1 ) * 3 ) ];
+	date_time_string[ string_index++ ] = month_names[ ( ( month - 1 ) * 3 ) + 1 ];
+	date_time_string[ string_index++ ] = month_names[ ( ( month - 1 ) * 3 ) + 2 ];
+	date_time_string[ string_index++ ] = ' ';
+	date_time_string[ string_index++ ] = (char) ( '0' + ( day / 10 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( day % 10 ) );
+	date_time_string[ string_index++ ] = ',';
+	date_time_string[ string_index++ ] = ' ';
+	/* A FILETIME can represent years up to 30828
+	 */
+	if( year >= 10000 )
+	{
+		date_time_string[ string_index++ ] = (char) ( '0' + ( year / 10000 ) );
+	}
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( year / 1000 ) % 10 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( year / 100 ) % 10 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( year / 10 ) % 10 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( year % 10 ) );
+	date_time_string[ string_index++ ] = ' ';
+	date_time_string[ string_index++ ] = (char) ( '0' + ( seconds / 36000 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( seconds / 3600 ) % 10 ) );
+	date_time_string[ string_index++ ] = ':';
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( seconds % 3600 ) / 600 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( ( seconds % 3600 ) / 60 ) % 10 ) );
+	date_time_string[ string_index++ ] = ':';
+	date_time_string[ string_index++ ] = (char) ( '0' + ( ( seconds % 60 ) / 10 ) );
+	date_time_string[ string_index++ ] = (char) ( '0' + ( seconds % 10 ) );
+	date_time_string[ string_index++ ] = '.';
+
+	for( digit_index = 8;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		date_time_string[ string_index + digit_index ] = (char) ( '0' + ( nano_seconds % 10 ) );
+
+		nano_seconds /= 10;
+	}
+	string_index += 9;
+
+	if( output_buffer_append_string(
+	     output_buffer,
+	     date_time_string,
+	     string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append date and time string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an escaped UTF-8 string
+ * In CSV escape mode a double quote is escaped by another double quote
+ * In JSON escape mode double quotes, back slashes and control characters are escaped
+ * In bodyfile escape mode | and back slashes are escaped and control characters are replaced
+ * In SQL escape mode a single quote is escaped by another single quote
+ * The string is not enclosed in double quotes
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_escaped_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int escape_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_escaped_string";
+	size_t string_index   = 0;
+	uint8_t character     = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( escape_mode != OUTPUT_BUFFER_ESCAPE_MODE_NONE )
+	 && ( escape_mode != OUTPUT_BUFFER_ESCAPE_MODE_CSV )
+	 && ( escape_mode != OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+	 && ( escape_mode != OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE )
+	 && ( escape_mode != OUTPUT_BUFFER_ESCAPE_MODE_SQL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported escape mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reserve space for the worst case escaping so that the characters
+	 * can be stored without checking the size of the buffer
+	 */
+	if( output_buffer_resize(
+	     output_buffer,
+	     utf8_string_length * 6,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		character = utf8_string[ string_index ];
+
+		if( character == 0 )
+		{
+			break;
+		}
+		if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_CSV )
+		{
+			if( character == (uint8_t) '"' )
+			{
+				output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '"';
+			}
+		}
+		else if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_JSON )
+		{
+			if( ( character == (uint8_t) '"' )
+			 || ( character == (uint8_t) '\\' ) )
+			{
+				output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '\\';
+			}
+			else if( character < 0x20 )
+			{
+				output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '\\';
+
+				switch( character )
+				{
+					case (uint8_t) '\n':
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) 'n';
+						break;
+
+					case (uint8_t) '\r':
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) 'r';
+						break;
+
+					case (uint8_t) '\t':
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) 't';
+						break;
+
+					default:
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) 'u';
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '0';
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '0';
+						output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) ( '0' + ( character >> 4 ) );
+
+						if( ( character & 0x0f ) < 10 )
+						{
+							output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) ( '0' + ( character & 0x0f ) );
+						}
+						else
+						{
+							output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) ( 'a' + ( character & 0x0f ) - 10 );
+						}
+						break;
+				}
+				continue;
+			}
+		}
+		else if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE )
+		{
+			/* The bodyfile format has no quoting, the field separator is escaped
+			 * and control characters are replaced by ^ as fls does
+			 */
+			if( ( character == (uint8_t) '|' )
+			 || ( character == (uint8_t) '\\' ) )
+			{
+				output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '\\';
+			}
+			else if( character < 0x20 )
+			{
+				character = (uint8_t) '^';
+			}
+		}
+		else if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_SQL )
+		{
+			if( character == (uint8_t) '\'' )
+			{
+				output_buffer->data[ output_buffer->data_offset++ ] = (uint8_t) '\'';
+			}
+		}
+		output_buffer->data[ output_buffer->data_offset++ ] = character;
+	}
+	return( 1 );
+}
+
+/* Appends an escaped UTF-8 string enclosed in double quotes
+ * In SQL escape mode the string is enclosed in single quotes
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_append_quoted_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int escape_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_append_quoted_string";
+	char quote_character  = '"';
+
+	/* SQL string literals are enclosed in single quotes
+	 */
+	if( escape_mode == OUTPUT_BUFFER_ESCAPE_MODE_SQL )
+	{
+		quote_character = '\'';
+	}
+
+	if( output_buffer_append_character(
+	     output_buffer,
+	     quote_character,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append opening quote.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_escaped_string(
+	     output_buffer,
+	     utf8_string,
+	     utf8_string_length,
+	     escape_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer_append_character(
+	     output_buffer,
+	     quote_character,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append closing quote.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the data in the output buffer to a stream and empties the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int output_buffer_write(
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "output_buffer_write";
+	size_t write_count    = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->data_offset > 0 )
+	{
+		write_count = fwrite(
+		               output_buffer->data,
+		               1,
+		               output_buffer->data_offset,
+		               stream );
+
+		if( write_count != output_buffer->data_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_offset = 0;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,138 @@
+/*
+ * Output buffer functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OUTPUT_BUFFER_H )
+#define _OUTPUT_BUFFER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial size of the output buffer data
+ */
+#define OUTPUT_BUFFER_INITIAL_DATA_SIZE		65536
+
+enum OUTPUT_BUFFER_ESCAPE_MODES
+{
+	OUTPUT_BUFFER_ESCAPE_MODE_NONE		= 0,
+	OUTPUT_BUFFER_ESCAPE_MODE_CSV		= 1,
+	OUTPUT_BUFFER_ESCAPE_MODE_JSON		= 2,
+	OUTPUT_BUFFER_ESCAPE_MODE_BODYFILE	= 3,
+	OUTPUT_BUFFER_ESCAPE_MODE_SQL		= 4
+};
+
+typedef struct output_buffer output_buffer_t;
+
+struct output_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+};
+
+int output_buffer_initialize(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_free(
+     output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int output_buffer_resize(
+     output_buffer_t *output_buffer,
+     size_t additional_data_size,
+     libcerror_error_t **error );
+
+int output_buffer_append_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int output_buffer_append_character(
+     output_buffer_t *output_buffer,
+     char character,
+     libcerror_error_t **error );
+
+int output_buffer_append_decimal(
+     output_buffer_t *output_buffer,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int output_buffer_append_signed_decimal(
+     output_buffer_t *output_buffer,
+     int64_t value,
+     libcerror_error_t **error );
+
+int output_buffer_append_hexadecimal_32bit(
+     output_buffer_t *output_buffer,
+     uint32_t value,
+     libcerror_error_t **error );
+
+int output_buffer_append_narrow_string(
+     output_buffer_t *output_buffer,
+     const char *string,
+     libcerror_error_t **error );
+
+int output_buffer_append_filetime(
+     output_buffer_t *output_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int output_buffer_append_escaped_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int escape_mode,
+     libcerror_error_t **error );
+
+int output_buffer_append_quoted_string(
+     output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int escape_mode,
+     libcerror_error_t **error );
+
+int output_buffer_write(
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OUTPUT_BUFFER_H ) */
+
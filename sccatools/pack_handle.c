@@ -0,0 +1,1408 @@
+/*
+ * Pack handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "info_handle.h"
+#include "output_buffer.h"
+#include "pack_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+#include "sccatools_libuna.h"
+
+#define PACK_HANDLE_NOTIFY_STREAM	stdout
+
+/* Creates a pack handle
+ * Make sure the value pack_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_initialize(
+     pack_handle_t **pack_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "pack_handle_initialize";
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pack_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*pack_handle = memory_allocate_structure(
+	                pack_handle_t );
+
+	if( *pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pack handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *pack_handle,
+	     0,
+	     sizeof( pack_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pack handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_pack_initialize(
+	     &( ( *pack_handle )->pack ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize pack.",
+		 function );
+
+		goto on_error;
+	}
+	( *pack_handle )->notify_stream = PACK_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *pack_handle != NULL )
+	{
+		memory_free(
+		 *pack_handle );
+
+		*pack_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a pack handle
+ * A pack file that is still being written is closed without its index data
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_free(
+     pack_handle_t **pack_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "pack_handle_free";
+	int result            = 1;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pack_handle != NULL )
+	{
+		if( ( *pack_handle )->pack_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *pack_handle )->pack_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close pack file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *pack_handle )->pack != NULL )
+		{
+			if( libscca_pack_free(
+			     &( ( *pack_handle )->pack ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pack.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *pack_handle )->data != NULL )
+		{
+			memory_free(
+			 ( *pack_handle )->data );
+		}
+		if( ( *pack_handle )->utf8_host != NULL )
+		{
+			memory_free(
+			 ( *pack_handle )->utf8_host );
+		}
+		if( ( *pack_handle )->utf8_string != NULL )
+		{
+			memory_free(
+			 ( *pack_handle )->utf8_string );
+		}
+		memory_free(
+		 *pack_handle );
+
+		*pack_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the pack handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_signal_abort(
+     pack_handle_t *pack_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "pack_handle_signal_abort";
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	pack_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded version of a system string
+ * A narrow system string is used as-is, a wide system string is converted
+ * into the UTF-8 string buffer of the pack handle
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_get_utf8_string(
+     pack_handle_t *pack_handle,
+     const system_character_t *string,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *reallocation   = NULL;
+	size_t utf8_string_size = 0;
+#endif
+	static char *function   = "pack_handle_get_utf8_string";
+	size_t string_length    = 0;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > pack_handle->utf8_string_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            pack_handle->utf8_string,
+		                            sizeof( uint8_t ) * utf8_string_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		pack_handle->utf8_string      = reallocation;
+		pack_handle->utf8_string_size = utf8_string_size;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     (libuna_utf8_character_t *) pack_handle->utf8_string,
+	     utf8_string_size,
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string        = pack_handle->utf8_string;
+	*utf8_string_length = utf8_string_size - 1;
+#else
+	*utf8_string        = (const uint8_t *) string;
+	*utf8_string_length = string_length;
+#endif
+	return( 1 );
+}
+
+/* Sets the host of the files that are appended to the pack and of the file that is queried
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_set_host(
+     pack_handle_t *pack_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	const uint8_t *utf8_string = NULL;
+	static char *function      = "pack_handle_set_host";
+	size_t utf8_string_length  = 0;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle->utf8_host != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack handle - UTF-8 host value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle_get_utf8_string(
+	     pack_handle,
+	     string,
+	     &utf8_string,
+	     &utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 host.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 host length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	pack_handle->utf8_host = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * ( utf8_string_length + 1 ) );
+
+	if( pack_handle->utf8_host == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 host.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     pack_handle->utf8_host,
+	     utf8_string,
+	     utf8_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 host.",
+		 function );
+
+		memory_free(
+		 pack_handle->utf8_host );
+
+		pack_handle->utf8_host = NULL;
+
+		return( -1 );
+	}
+	pack_handle->utf8_host[ utf8_string_length ] = 0;
+	pack_handle->utf8_host_length                = utf8_string_length;
+
+	return( 1 );
+}
+
+/* Resizes the data buffer of the pack handle if it is smaller than the data size
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_resize_data(
+     pack_handle_t *pack_handle,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "pack_handle_resize_data";
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= pack_handle->data_size )
+	{
+		return( 1 );
+	}
+	/* The index data covers many files, hence it is not limited to MEMORY_MAXIMUM_ALLOCATION_SIZE
+	 */
+	reallocation = (uint8_t *) memory_reallocate(
+	                            pack_handle->data,
+	                            sizeof( uint8_t ) * data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	pack_handle->data      = reallocation;
+	pack_handle->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Opens the pack file that is written
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_open_output(
+     pack_handle_t *pack_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "pack_handle_open_output";
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle->pack_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pack handle - pack stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	pack_handle->pack_stream = file_stream_open_wide(
+	                            filename,
+	                            _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	pack_handle->pack_stream = file_stream_open(
+	                            filename,
+	                            FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( pack_handle->pack_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open pack file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a source file to the pack
+ * The path of the source file and the host of the pack handle form the key of the file
+ * The file data is written to the pack file directly, hence only the index
+ * of the pack is kept in memory
+ * Returns 1 if successful, 0 if the source file could not be opened or was already appended or -1 on error
+ */
+int pack_handle_append_source(
+     pack_handle_t *pack_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libscca_file_t *file     = NULL;
+	const uint8_t *utf8_path = NULL;
+	static char *function    = "pack_handle_append_source";
+	size_t data_size         = 0;
+	size_t utf8_path_length  = 0;
+	size_t write_count       = 0;
+	int result               = 0;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle->pack_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pack handle - missing pack stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	/* A source file that cannot be opened is skipped
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          filename,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	          NULL );
+#else
+	result = libscca_file_open(
+	          file,
+	          filename,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	          NULL );
+#endif
+	if( result == 1 )
+	{
+		if( libscca_pack_get_file_data_size(
+		     pack_handle->pack,
+		     file,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file data size.",
+			 function );
+
+			goto on_error;
+		}
+		if( pack_handle_resize_data(
+		     pack_handle,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize data.",
+			 function );
+
+			goto on_error;
+		}
+		if( pack_handle_get_utf8_string(
+		     pack_handle,
+		     filename,
+		     &utf8_path,
+		     &utf8_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 path.",
+			 function );
+
+			goto on_error;
+		}
+		result = libscca_pack_append_file(
+		          pack_handle->pack,
+		          file,
+		          pack_handle->utf8_host,
+		          pack_handle->utf8_host_length,
+		          utf8_path,
+		          utf8_path_length,
+		          pack_handle->data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file to pack.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			write_count = file_stream_write(
+			               pack_handle->pack_stream,
+			               pack_handle->data,
+			               data_size );
+
+			if( write_count != data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write file data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libscca_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 1 )
+	{
+		pack_handle->number_of_files_appended += 1;
+	}
+	else
+	{
+		pack_handle->number_of_files_skipped += 1;
+
+		result = 0;
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the index data of the pack and closes the pack file
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_close_output(
+     pack_handle_t *pack_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "pack_handle_close_output";
+	size_t data_size      = 0;
+	size_t write_count    = 0;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle->pack_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pack handle - missing pack stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_pack_get_index_data_size(
+	     pack_handle->pack,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle_resize_data(
+	     pack_handle,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_pack_write_index_data(
+	     pack_handle->pack,
+	     pack_handle->data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               pack_handle->pack_stream,
+	               pack_handle->data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_close(
+	     pack_handle->pack_stream ) != 0 )
+	{
+		pack_handle->pack_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close pack file.",
+		 function );
+
+		return( -1 );
+	}
+	pack_handle->pack_stream = NULL;
+
+	return( 1 );
+}
+
+/* Opens a pack file
+ * The pack that is being built, if any, is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_open_pack(
+     pack_handle_t *pack_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "pack_handle_open_pack";
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle->pack != NULL )
+	{
+		if( libscca_pack_free(
+		     &( pack_handle->pack ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pack.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libscca_pack_initialize(
+	     &( pack_handle->pack ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize pack.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libscca_pack_open_wide(
+	     pack_handle->pack,
+	     filename,
+	     error ) != 1 )
+#else
+	if( libscca_pack_open(
+	     pack_handle->pack,
+	     filename,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open pack.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the host, path and prefetch hash of the files in the pack
+ * Returns 1 if successful or -1 on error
+ */
+int pack_handle_list_fprint(
+     pack_handle_t *pack_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_host     = NULL;
+	uint8_t *utf8_path     = NULL;
+	static char *function  = "pack_handle_list_fprint";
+	size_t utf8_host_size  = 0;
+	size_t utf8_path_size  = 0;
+	uint32_t prefetch_hash = 0;
+	int file_index         = 0;
+	int number_of_files    = 0;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_pack_get_number_of_files(
+	     pack_handle->pack,
+	     &number_of_files,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		if( pack_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libscca_pack_get_utf8_file_host_size(
+		     pack_handle->pack,
+		     file_index,
+		     &utf8_host_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d host size.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libscca_pack_get_utf8_file_path_size(
+		     pack_handle->pack,
+		     file_index,
+		     &utf8_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d path size.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( ( utf8_host_size == 0 )
+		 || ( utf8_host_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		 || ( utf8_path_size == 0 )
+		 || ( utf8_path_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file: %d host or path size value out of bounds.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		utf8_host = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * utf8_host_size );
+
+		if( utf8_host == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create host.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_path = (uint8_t *) memory_allocate(
+		                         sizeof( uint8_t ) * utf8_path_size );
+
+		if( utf8_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create path.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_pack_get_utf8_file_host(
+		     pack_handle->pack,
+		     file_index,
+		     utf8_host,
+		     utf8_host_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d host.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libscca_pack_get_utf8_file_path(
+		     pack_handle->pack,
+		     file_index,
+		     utf8_path,
+		     utf8_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d path.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libscca_pack_get_file_prefetch_hash(
+		     pack_handle->pack,
+		     file_index,
+		     &prefetch_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file: %d prefetch hash.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 pack_handle->notify_stream,
+		 "%s\t%s\t0x%08" PRIx32 "\n",
+		 (char *) utf8_host,
+		 (char *) utf8_path,
+		 prefetch_hash );
+
+		memory_free(
+		 utf8_path );
+
+		utf8_path = NULL;
+
+		memory_free(
+		 utf8_host );
+
+		utf8_host = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_path != NULL )
+	{
+		memory_free(
+		 utf8_path );
+	}
+	if( utf8_host != NULL )
+	{
+		memory_free(
+		 utf8_host );
+	}
+	return( -1 );
+}
+
+/* Prints the file information of the file with a specific path
+ * The file is looked up by the host of the pack handle and the path,
+ * hence only the pages of the pack of that file are read
+ * Returns 1 if successful, 0 if no such file or -1 on error
+ */
+int pack_handle_query_fprint(
+     pack_handle_t *pack_handle,
+     info_handle_t *info_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	libscca_file_t *file           = NULL;
+	output_buffer_t *output_buffer = NULL;
+	const uint8_t *utf8_path       = NULL;
+	static char *function          = "pack_handle_query_fprint";
+	size_t utf8_path_length        = 0;
+	int file_index                 = 0;
+	int result                     = 0;
+
+	if( pack_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pack handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( pack_handle_get_utf8_string(
+	     pack_handle,
+	     path,
+	     &utf8_path,
+	     &utf8_path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path.",
+		 function );
+
+		goto on_error;
+	}
+	result = libscca_pack_get_file_index_by_utf8_key(
+	          pack_handle->pack,
+	          pack_handle->utf8_host,
+	          pack_handle->utf8_host_length,
+	          utf8_path,
+	          utf8_path_length,
+	          &file_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file index.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libscca_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_pack_open_file(
+	     pack_handle->pack,
+	     file_index,
+	     file,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %d.",
+		 function,
+		 file_index );
+
+		goto on_error;
+	}
+	if( output_buffer_initialize(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_file_append_with_file(
+	     info_handle,
+	     file,
+	     path,
+	     output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file: %d information.",
+		 function,
+		 file_index );
+
+		goto on_error;
+	}
+	if( output_buffer_write(
+	     output_buffer,
+	     pack_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_free(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
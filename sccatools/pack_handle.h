@@ -0,0 +1,154 @@
+/*
+ * Pack handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PACK_HANDLE_H )
+#define _PACK_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pack_handle pack_handle_t;
+
+struct pack_handle
+{
+	/* The pack
+	 */
+	libscca_pack_t *pack;
+
+	/* The pack file stream that is being written
+	 */
+	FILE *pack_stream;
+
+	/* The buffer used to write the file data and index data
+	 */
+	uint8_t *data;
+
+	/* The data buffer size
+	 */
+	size_t data_size;
+
+	/* The UTF-8 encoded host of the files that are appended
+	 */
+	uint8_t *utf8_host;
+
+	/* The UTF-8 host length
+	 */
+	size_t utf8_host_length;
+
+	/* The UTF-8 string buffer used to convert paths
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string buffer size
+	 */
+	size_t utf8_string_size;
+
+	/* The number of files appended to the pack
+	 */
+	int number_of_files_appended;
+
+	/* The number of files that could not be appended to the pack
+	 */
+	int number_of_files_skipped;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int pack_handle_initialize(
+     pack_handle_t **pack_handle,
+     libcerror_error_t **error );
+
+int pack_handle_free(
+     pack_handle_t **pack_handle,
+     libcerror_error_t **error );
+
+int pack_handle_signal_abort(
+     pack_handle_t *pack_handle,
+     libcerror_error_t **error );
+
+int pack_handle_get_utf8_string(
+     pack_handle_t *pack_handle,
+     const system_character_t *string,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+int pack_handle_set_host(
+     pack_handle_t *pack_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int pack_handle_resize_data(
+     pack_handle_t *pack_handle,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int pack_handle_open_output(
+     pack_handle_t *pack_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int pack_handle_append_source(
+     pack_handle_t *pack_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int pack_handle_close_output(
+     pack_handle_t *pack_handle,
+     libcerror_error_t **error );
+
+int pack_handle_open_pack(
+     pack_handle_t *pack_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int pack_handle_list_fprint(
+     pack_handle_t *pack_handle,
+     libcerror_error_t **error );
+
+int pack_handle_query_fprint(
+     pack_handle_t *pack_handle,
+     info_handle_t *info_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PACK_HANDLE_H ) */
+
@@ -0,0 +1,1140 @@
+/*
+ * Source path list functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "path_list.h"
+#include "sccatools_libcerror.h"
+
+#if defined( WINAPI )
+#define PATH_LIST_PATH_SEPARATOR	'\\'
+#else
+#define PATH_LIST_PATH_SEPARATOR	'/'
+#endif
+
+/* Creates a path list
+ * Make sure the value path_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_initialize(
+     path_list_t **path_list,
+     libcerror_error_t **error )
+{
+	static char *function = "path_list_initialize";
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*path_list = memory_allocate_structure(
+	              path_list_t );
+
+	if( *path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_list,
+	     0,
+	     sizeof( path_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *path_list != NULL )
+	{
+		memory_free(
+		 *path_list );
+
+		*path_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path list
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_free(
+     path_list_t **path_list,
+     libcerror_error_t **error )
+{
+	static char *function = "path_list_free";
+	int path_index        = 0;
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_list != NULL )
+	{
+		if( ( *path_list )->paths != NULL )
+		{
+			for( path_index = 0;
+			     path_index < ( *path_list )->number_of_paths;
+			     path_index++ )
+			{
+				memory_free(
+				 ( *path_list )->paths[ path_index ] );
+			}
+			memory_free(
+			 ( *path_list )->paths );
+		}
+		memory_free(
+		 *path_list );
+
+		*path_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a copy of a path to the path list
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_append_path(
+     path_list_t *path_list,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	system_character_t **reallocation = NULL;
+	system_character_t *path_copy     = NULL;
+	static char *function             = "path_list_append_path";
+	int number_of_allocated_paths     = 0;
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_list->number_of_paths >= path_list->number_of_allocated_paths )
+	{
+		if( path_list->number_of_allocated_paths == 0 )
+		{
+			number_of_allocated_paths = 64;
+		}
+		else if( path_list->number_of_allocated_paths < ( (int) INT32_MAX / 2 ) )
+		{
+			number_of_allocated_paths = path_list->number_of_allocated_paths * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path list - number of allocated paths value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_paths > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated paths value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (system_character_t **) memory_reallocate(
+		                                        path_list->paths,
+		                                        sizeof( system_character_t * ) * number_of_allocated_paths );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize paths.",
+			 function );
+
+			return( -1 );
+		}
+		path_list->paths                     = reallocation;
+		path_list->number_of_allocated_paths = number_of_allocated_paths;
+	}
+	path_copy = system_string_allocate(
+	             path_length + 1 );
+
+	if( path_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     path_copy,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		memory_free(
+		 path_copy );
+
+		return( -1 );
+	}
+	path_copy[ path_length ] = 0;
+
+	path_list->paths[ path_list->number_of_paths ] = path_copy;
+
+	path_list->number_of_paths += 1;
+
+	return( 1 );
+}
+
+/* Appends a directory entry path, which is the directory path joined with the entry name
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_append_directory_entry(
+     path_list_t *path_list,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     const system_character_t *entry_name,
+     libcerror_error_t **error )
+{
+	system_character_t *entry_path = NULL;
+	static char *function          = "path_list_append_directory_entry";
+	size_t entry_name_length       = 0;
+	size_t entry_path_length       = 0;
+
+	entry_name_length = system_string_length(
+	                     entry_name );
+
+	if( ( entry_name_length == 0 )
+	 || ( entry_name_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - directory_path_length - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_path = system_string_allocate(
+	              directory_path_length + entry_name_length + 2 );
+
+	if( entry_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     entry_path,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	entry_path_length = directory_path_length;
+
+	if( ( entry_path_length == 0 )
+	 || ( entry_path[ entry_path_length - 1 ] != (system_character_t) PATH_LIST_PATH_SEPARATOR ) )
+	{
+		entry_path[ entry_path_length++ ] = (system_character_t) PATH_LIST_PATH_SEPARATOR;
+	}
+	if( system_string_copy(
+	     &( entry_path[ entry_path_length ] ),
+	     entry_name,
+	     entry_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		goto on_error;
+	}
+	entry_path_length += entry_name_length;
+
+	if( path_list_append_path(
+	     path_list,
+	     entry_path,
+	     entry_path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry path.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 entry_path );
+
+	return( 1 );
+
+on_error:
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	return( -1 );
+}
+
+/* Reads the entries of a directory into a path list
+ * The . and .. entries are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_read_directory_entries(
+     path_list_t *path_list,
+     const system_character_t *directory_path,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+	system_character_t *search_pattern = NULL;
+	HANDLE find_handle                 = INVALID_HANDLE_VALUE;
+	const system_character_t *name     = NULL;
+
+#elif defined( HAVE_OPENDIR )
+	struct dirent *directory_entry = NULL;
+	DIR *directory                 = NULL;
+	const system_character_t *name = NULL;
+#endif
+
+	static char *function        = "path_list_read_directory_entries";
+	size_t directory_path_length = 0;
+
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	directory_path_length = system_string_length(
+	                         directory_path );
+
+#if defined( WINAPI )
+	if( directory_path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 3 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	search_pattern = system_string_allocate(
+	                  directory_path_length + 3 );
+
+	if( search_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create search pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     search_pattern,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	search_pattern[ directory_path_length ]     = (system_character_t) '\\';
+	search_pattern[ directory_path_length + 1 ] = (system_character_t) '*';
+	search_pattern[ directory_path_length + 2 ] = 0;
+
+	/* The basic information level does not retrieve the short names and
+	 * the large fetch reads more directory entries per call of the file system
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( WINVER >= 0x0601 )
+	find_handle = FindFirstFileExW(
+	               search_pattern,
+	               FindExInfoBasic,
+	               &find_data,
+	               FindExSearchNameMatch,
+	               NULL,
+	               FIND_FIRST_EX_LARGE_FETCH );
+#elif ( WINVER >= 0x0601 )
+	find_handle = FindFirstFileExA(
+	               search_pattern,
+	               FindExInfoBasic,
+	               &find_data,
+	               FindExSearchNameMatch,
+	               NULL,
+	               FIND_FIRST_EX_LARGE_FETCH );
+#elif defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               search_pattern,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               search_pattern,
+	               &find_data );
+#endif
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 directory_path );
+
+		goto on_error;
+	}
+	do
+	{
+		name = find_data.cFileName;
+
+		if( ( name[ 0 ] == (system_character_t) '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == (system_character_t) '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( path_list_append_directory_entry(
+		     path_list,
+		     directory_path,
+		     directory_path_length,
+		     name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( FindNextFileW(
+	        find_handle,
+	        &find_data ) != 0 );
+#else
+	while( FindNextFileA(
+	        find_handle,
+	        &find_data ) != 0 );
+#endif
+
+	FindClose(
+	 find_handle );
+
+	memory_free(
+	 search_pattern );
+
+	return( 1 );
+
+on_error:
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( search_pattern != NULL )
+	{
+		memory_free(
+		 search_pattern );
+	}
+	return( -1 );
+
+#elif defined( HAVE_OPENDIR ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	directory = opendir(
+	             directory_path );
+
+	if( directory == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 directory_path );
+
+		return( -1 );
+	}
+	while( ( directory_entry = readdir(
+	                            directory ) ) != NULL )
+	{
+		name = directory_entry->d_name;
+
+		if( ( name[ 0 ] == '.' )
+		 && ( ( name[ 1 ] == 0 )
+		  || ( ( name[ 1 ] == '.' )
+		   && ( name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( path_list_append_directory_entry(
+		     path_list,
+		     directory_path,
+		     directory_path_length,
+		     name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			closedir(
+			 directory );
+
+			return( -1 );
+		}
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close directory: %" PRIs_SYSTEM ".",
+		 function,
+		 directory_path );
+
+		return( -1 );
+	}
+	return( 1 );
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: reading directories is not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Appends the prefetch files of a directory and its sub directories to the path list
+ * The entries of every directory are sorted so that the order of the paths is deterministic
+ * All files are appended if all_files is set in the path list
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_append_directory(
+     path_list_t *path_list,
+     const system_character_t *directory_path,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	path_list_t *entries_list = NULL;
+	static char *function     = "path_list_append_directory";
+	size_t entry_path_length  = 0;
+	int entry_index           = 0;
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > PATH_LIST_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_list_initialize(
+	     &entries_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries list.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_list_read_directory_entries(
+	     entries_list,
+	     directory_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( entries_list->number_of_paths > 1 )
+	{
+		qsort(
+		 entries_list->paths,
+		 (size_t) entries_list->number_of_paths,
+		 sizeof( system_character_t * ),
+		 &path_list_compare_paths );
+	}
+	for( entry_index = 0;
+	     entry_index < entries_list->number_of_paths;
+	     entry_index++ )
+	{
+		if( path_list_is_directory(
+		     entries_list->paths[ entry_index ] ) == 1 )
+		{
+			if( recursion_depth >= PATH_LIST_MAXIMUM_RECURSION_DEPTH )
+			{
+				continue;
+			}
+			if( path_list_append_directory(
+			     path_list,
+			     entries_list->paths[ entry_index ],
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub directory: %" PRIs_SYSTEM ".",
+				 function,
+				 entries_list->paths[ entry_index ] );
+
+				goto on_error;
+			}
+			continue;
+		}
+		entry_path_length = system_string_length(
+		                     entries_list->paths[ entry_index ] );
+
+		if( ( path_list->all_files == 0 )
+		 && ( path_list_has_prefetch_extension(
+		       entries_list->paths[ entry_index ],
+		       entry_path_length ) == 0 ) )
+		{
+			continue;
+		}
+		if( path_list_append_path(
+		     path_list,
+		     entries_list->paths[ entry_index ],
+		     entry_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append path: %" PRIs_SYSTEM ".",
+			 function,
+			 entries_list->paths[ entry_index ] );
+
+			goto on_error;
+		}
+	}
+	if( path_list_free(
+	     &entries_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entries list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( entries_list != NULL )
+	{
+		path_list_free(
+		 &entries_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines if a path refers to a directory
+ * Returns 1 if the path is a directory or 0 if not or if it cannot be determined
+ */
+int path_list_is_directory(
+     const system_character_t *path )
+{
+#if defined( WINAPI )
+	DWORD file_attributes = 0;
+
+#elif defined( HAVE_STAT )
+	struct stat file_stat;
+#endif
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   path );
+#endif
+	if( ( file_attributes != INVALID_FILE_ATTRIBUTES )
+	 && ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 ) )
+	{
+		return( 1 );
+	}
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( stat(
+	       path,
+	       &file_stat ) == 0 )
+	 && ( S_ISDIR( file_stat.st_mode ) ) )
+	{
+		return( 1 );
+	}
+#endif
+	return( 0 );
+}
+
+/* Determines if a path has the .pf prefetch file extension
+ * The extension is compared case insensitive
+ * Returns 1 if the path has the extension or 0 if not
+ */
+int path_list_has_prefetch_extension(
+     const system_character_t *path,
+     size_t path_length )
+{
+	if( ( path == NULL )
+	 || ( path_length < 3 ) )
+	{
+		return( 0 );
+	}
+	if( ( path[ path_length - 3 ] == (system_character_t) '.' )
+	 && ( ( path[ path_length - 2 ] == (system_character_t) 'p' )
+	  || ( path[ path_length - 2 ] == (system_character_t) 'P' ) )
+	 && ( ( path[ path_length - 1 ] == (system_character_t) 'f' )
+	  || ( path[ path_length - 1 ] == (system_character_t) 'F' ) ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two paths
+ * Callback function for qsort
+ * Returns a value less than, equal to or greater than 0 if the first path is
+ * less than, equal to or greater than the second path
+ */
+int path_list_compare_paths(
+     const void *first_path,
+     const void *second_path )
+{
+	const system_character_t *first_string  = NULL;
+	const system_character_t *second_string = NULL;
+	size_t compare_length                   = 0;
+	size_t second_string_length             = 0;
+
+	first_string  = *( (const system_character_t * const *) first_path );
+	second_string = *( (const system_character_t * const *) second_path );
+
+	compare_length       = system_string_length( first_string );
+	second_string_length = system_string_length( second_string );
+
+	if( second_string_length < compare_length )
+	{
+		compare_length = second_string_length;
+	}
+	/* Compare including the end-of-string character of the shortest path
+	 * so that a path sorts before the paths it is a prefix of
+	 */
+	return( system_string_compare(
+	         first_string,
+	         second_string,
+	         compare_length + 1 ) );
+}
+
+/* Calculates the shard hash of a path
+ * The hash is a 32-bit FNV-1a of the character values so that the same
+ * path is assigned the same shard by every process, ASCII paths result
+ * in the same hash with narrow and wide system characters
+ * Returns the hash
+ */
+uint32_t path_list_calculate_shard_hash(
+          const system_character_t *path )
+{
+	uint32_t hash     = 0x811c9dc5UL;
+	size_t path_index = 0;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	for( path_index = 0;
+	     path[ path_index ] != 0;
+	     path_index++ )
+	{
+		hash ^= (uint32_t) path[ path_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Removes the paths that are not part of a shard from the path list
+ * A path is part of the shard if its shard hash modulo the number of shards
+ * equals the shard index. The remaining paths are sorted so that the output
+ * of every shard is ordered by source and can be merged
+ * Returns the number of removed paths or -1 on error
+ */
+int path_list_select_shard(
+     path_list_t *path_list,
+     int shard_index,
+     int number_of_shards,
+     libcerror_error_t **error )
+{
+	static char *function       = "path_list_select_shard";
+	int number_of_removed_paths = 0;
+	int path_index              = 0;
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_shards <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of shards value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		if( ( path_list_calculate_shard_hash(
+		       path_list->paths[ path_index ] ) % (uint32_t) number_of_shards ) != (uint32_t) shard_index )
+		{
+			memory_free(
+			 path_list->paths[ path_index ] );
+
+			path_list->paths[ path_index ] = NULL;
+
+			number_of_removed_paths++;
+		}
+		else if( number_of_removed_paths > 0 )
+		{
+			path_list->paths[ path_index - number_of_removed_paths ] = path_list->paths[ path_index ];
+			path_list->paths[ path_index ]                           = NULL;
+		}
+	}
+	path_list->number_of_paths -= number_of_removed_paths;
+
+	if( path_list->number_of_paths > 1 )
+	{
+		qsort(
+		 path_list->paths,
+		 (size_t) path_list->number_of_paths,
+		 sizeof( system_character_t * ),
+		 &path_list_compare_paths );
+	}
+	return( number_of_removed_paths );
+}
+
+/* Hints the operating system that the files of a range of paths will be read
+ * The operating system can then read the files ahead asynchronously, hence
+ * the reads of many files are in flight while the previous files are parsed
+ * A path that cannot be opened is skipped since the hint is only advisory
+ * If posix_fadvise is not available no hints are given
+ * Returns 1 if successful or -1 on error
+ */
+int path_list_advise_will_need(
+     path_list_t *path_list,
+     int path_index,
+     int number_of_paths,
+     libcerror_error_t **error )
+{
+	static char *function = "path_list_advise_will_need";
+
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int file_descriptor   = -1;
+	int last_path_index   = 0;
+#endif
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_index < 0 )
+	 || ( path_index > path_list->number_of_paths ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) && defined( HAVE_OPEN ) && defined( HAVE_CLOSE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( number_of_paths > ( path_list->number_of_paths - path_index ) )
+	{
+		number_of_paths = path_list->number_of_paths - path_index;
+	}
+	last_path_index = path_index + number_of_paths;
+
+	while( path_index < last_path_index )
+	{
+		file_descriptor = open(
+		                   path_list->paths[ path_index ],
+		                   O_RDONLY );
+
+		if( file_descriptor != -1 )
+		{
+			/* POSIX_FADV_WILLNEED starts the read-ahead of the whole file without
+			 * waiting for it, the pages remain in the page cache after the close
+			 */
+			posix_fadvise(
+			 file_descriptor,
+			 0,
+			 0,
+			 POSIX_FADV_WILLNEED );
+
+			close(
+			 file_descriptor );
+		}
+		path_index++;
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Source path list functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PATH_LIST_H )
+#define _PATH_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum depth of the directory recursion
+ */
+#define PATH_LIST_MAXIMUM_RECURSION_DEPTH	64
+
+typedef struct path_list path_list_t;
+
+struct path_list
+{
+	/* The paths
+	 */
+	system_character_t **paths;
+
+	/* The number of paths
+	 */
+	int number_of_paths;
+
+	/* The number of allocated paths
+	 */
+	int number_of_allocated_paths;
+
+	/* Value to indicate a directory scan should add all files
+	 * instead of only the files with the .pf extension
+	 */
+	uint8_t all_files;
+};
+
+int path_list_initialize(
+     path_list_t **path_list,
+     libcerror_error_t **error );
+
+int path_list_free(
+     path_list_t **path_list,
+     libcerror_error_t **error );
+
+int path_list_append_path(
+     path_list_t *path_list,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int path_list_append_directory_entry(
+     path_list_t *path_list,
+     const system_character_t *directory_path,
+     size_t directory_path_length,
+     const system_character_t *entry_name,
+     libcerror_error_t **error );
+
+int path_list_read_directory_entries(
+     path_list_t *path_list,
+     const system_character_t *directory_path,
+     libcerror_error_t **error );
+
+int path_list_append_directory(
+     path_list_t *path_list,
+     const system_character_t *directory_path,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int path_list_is_directory(
+     const system_character_t *path );
+
+int path_list_has_prefetch_extension(
+     const system_character_t *path,
+     size_t path_length );
+
+int path_list_compare_paths(
+     const void *first_path,
+     const void *second_path );
+
+uint32_t path_list_calculate_shard_hash(
+          const system_character_t *path );
+
+int path_list_select_shard(
+     path_list_t *path_list,
+     int shard_index,
+     int number_of_shards,
+     libcerror_error_t **error );
+
+int path_list_advise_will_need(
+     path_list_t *path_list,
+     int path_index,
+     int number_of_paths,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PATH_LIST_H ) */
+
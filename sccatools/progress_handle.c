@@ -0,0 +1,724 @@
+/*
+ * Progress handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+
+#else
+#if defined( HAVE_CLOCK_GETTIME ) || defined( HAVE_NANOSLEEP )
+#include <time.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "progress_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+
+/* Retrieves a monotonic timestamp in nano seconds
+ * Returns 1 if successful or 0 if no monotonic clock is available
+ */
+int progress_handle_get_timestamp(
+     uint64_t *timestamp )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter   = { 0 };
+	LARGE_INTEGER frequency = { 0 };
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	if( timestamp == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	*timestamp = ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	           + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart;
+
+	return( 1 );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	*timestamp = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+	return( 1 );
+
+#else
+	return( 0 );
+#endif
+}
+
+/* Creates a progress handle
+ * Make sure the value progress_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_initialize(
+     progress_handle_t **progress_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "progress_handle_initialize";
+
+	if( progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *progress_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid progress handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	*progress_handle = memory_allocate_structure(
+	                    progress_handle_t );
+
+	if( *progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create progress handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *progress_handle,
+	     0,
+	     sizeof( progress_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear progress handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *progress_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *progress_handle )->stream = stream;
+
+	return( 1 );
+
+on_error:
+	if( *progress_handle != NULL )
+	{
+		memory_free(
+		 *progress_handle );
+
+		*progress_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a progress handle
+ * The reporter thread is stopped if it is still running
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_free(
+     progress_handle_t **progress_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "progress_handle_free";
+	int result            = 1;
+
+	if( progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *progress_handle != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *progress_handle )->reporter_thread != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *progress_handle )->mutex,
+			     NULL ) == 1 )
+			{
+				( *progress_handle )->stop = 1;
+
+				libcthreads_mutex_release(
+				 ( *progress_handle )->mutex,
+				 NULL );
+			}
+			if( libcthreads_thread_join(
+			     &( ( *progress_handle )->reporter_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join reporter thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *progress_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *progress_handle );
+
+		*progress_handle = NULL;
+	}
+	return( result );
+}
+
+/* Starts reporting the progress
+ * If multi-thread support is available the progress is printed by a reporter thread,
+ * otherwise it is printed by progress_handle_update when the interval has elapsed
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_start(
+     progress_handle_t *progress_handle,
+     int total_number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function = "progress_handle_start";
+
+	if( progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( progress_handle->reporter_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid progress handle - reporter thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( total_number_of_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid total number of files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	progress_handle->total_number_of_files = total_number_of_files;
+	progress_handle->number_of_files       = 0;
+	progress_handle->number_of_bytes       = 0;
+	progress_handle->stop                  = 0;
+
+	if( progress_handle_get_timestamp(
+	     &( progress_handle->start_timestamp ) ) != 1 )
+	{
+		progress_handle->start_timestamp = 0;
+	}
+	progress_handle->print_timestamp = progress_handle->start_timestamp;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_create(
+	     &( progress_handle->reporter_thread ),
+	     NULL,
+	     (int (*)(void *)) &progress_handle_reporter_thread_callback,
+	     (void *) progress_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reporter thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds processed files and bytes to the counters
+ * This function is intended to be called once per file or per batch of files
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_update(
+     progress_handle_t *progress_handle,
+     int number_of_files,
+     uint64_t number_of_bytes,
+     libcerror_error_t **error )
+{
+	static char *function = "progress_handle_update";
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	uint64_t timestamp    = 0;
+#endif
+
+	if( progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_files < 0 )
+	 || ( number_of_files > ( INT_MAX - progress_handle->number_of_files ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     progress_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	progress_handle->number_of_files += number_of_files;
+	progress_handle->number_of_bytes += number_of_bytes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     progress_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	/* Without a reporter thread the progress is printed when the interval has elapsed
+	 */
+	if( progress_handle_get_timestamp(
+	     &timestamp ) == 1 )
+	{
+		if( ( timestamp - progress_handle->print_timestamp ) >= ( (uint64_t) PROGRESS_HANDLE_INTERVAL * 1000000UL ) )
+		{
+			progress_handle->print_timestamp = timestamp;
+
+			if( progress_handle_fprint(
+			     progress_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print progress.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Stops reporting the progress and prints the final progress
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_stop(
+     progress_handle_t *progress_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "progress_handle_stop";
+
+	if( progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( progress_handle->reporter_thread != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     progress_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		progress_handle->stop = 1;
+
+		if( libcthreads_mutex_release(
+		     progress_handle->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_thread_join(
+		     &( progress_handle->reporter_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join reporter thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( progress_handle_fprint(
+	     progress_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print progress.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the progress
+ * The counters are sampled once, the rates are determined over the time elapsed since start
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_fprint(
+     progress_handle_t *progress_handle,
+     libcerror_error_t **error )
+{
+	static char *function         = "progress_handle_fprint";
+	uint64_t elapsed_time         = 0;
+	uint64_t files_per_second     = 0;
+	uint64_t mebibytes_per_second = 0;
+	uint64_t number_of_bytes      = 0;
+	uint64_t timestamp            = 0;
+	int number_of_files           = 0;
+
+	if( progress_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     progress_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	number_of_files = progress_handle->number_of_files;
+	number_of_bytes = progress_handle->number_of_bytes;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     progress_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	fprintf(
+	 progress_handle->stream,
+	 "Status: processed %d of %d files",
+	 number_of_files,
+	 progress_handle->total_number_of_files );
+
+	/* The rates are only printed if a monotonic clock is available
+	 */
+	if( ( progress_handle->start_timestamp != 0 )
+	 && ( progress_handle_get_timestamp(
+	       &timestamp ) == 1 ) )
+	{
+		/* The elapsed time is in milli seconds
+		 */
+		elapsed_time = ( timestamp - progress_handle->start_timestamp ) / 1000000UL;
+
+		if( elapsed_time > 0 )
+		{
+			/* The rates are in tenths per second
+			 */
+			files_per_second     = ( (uint64_t) number_of_files * 10000UL ) / elapsed_time;
+			mebibytes_per_second = ( ( number_of_bytes * 10000UL ) / elapsed_time ) / ( 1024 * 1024 );
+		}
+		fprintf(
+		 progress_handle->stream,
+		 " in %" PRIu64 ".%03" PRIu64 " seconds, %" PRIu64 ".%" PRIu64 " files/s, %" PRIu64 ".%" PRIu64 " MiB/s",
+		 elapsed_time / 1000,
+		 elapsed_time % 1000,
+		 files_per_second / 10,
+		 files_per_second % 10,
+		 mebibytes_per_second / 10,
+		 mebibytes_per_second % 10 );
+	}
+	fprintf(
+	 progress_handle->stream,
+	 ".\n" );
+
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Prints the progress every interval until the reporter is stopped
+ * Callback function for the reporter thread
+ * The thread sleeps in short steps so that it can be stopped without waiting for a full interval
+ * Returns 1 if successful or -1 on error
+ */
+int progress_handle_reporter_thread_callback(
+     progress_handle_t *progress_handle )
+{
+#if !defined( WINAPI ) && defined( HAVE_NANOSLEEP )
+	struct timespec sleep_time;
+#endif
+
+	libcerror_error_t *error = NULL;
+	int elapsed_time         = 0;
+	int stop                 = 0;
+
+	if( progress_handle == NULL )
+	{
+		return( -1 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_NANOSLEEP )
+	sleep_time.tv_sec  = 0;
+	sleep_time.tv_nsec = PROGRESS_HANDLE_SLEEP_INTERVAL * 1000000L;
+#endif
+	while( stop == 0 )
+	{
+#if defined( WINAPI )
+		Sleep(
+		 PROGRESS_HANDLE_SLEEP_INTERVAL );
+
+		elapsed_time += PROGRESS_HANDLE_SLEEP_INTERVAL;
+
+#elif defined( HAVE_NANOSLEEP )
+		nanosleep(
+		 &sleep_time,
+		 NULL );
+
+		elapsed_time += PROGRESS_HANDLE_SLEEP_INTERVAL;
+
+#else
+		sleep(
+		 1 );
+
+		elapsed_time += 1000;
+#endif
+		if( libcthreads_mutex_grab(
+		     progress_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		stop = progress_handle->stop;
+
+		if( libcthreads_mutex_release(
+		     progress_handle->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+		if( ( stop == 0 )
+		 && ( elapsed_time >= PROGRESS_HANDLE_INTERVAL ) )
+		{
+			elapsed_time = 0;
+
+			if( progress_handle_fprint(
+			     progress_handle,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,130 @@
+/*
+ * Progress handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PROGRESS_HANDLE_H )
+#define _PROGRESS_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The interval in which the progress is printed in milli seconds
+ */
+#define PROGRESS_HANDLE_INTERVAL		1000
+
+/* The interval in which the reporter thread checks if it should stop in milli seconds
+ */
+#define PROGRESS_HANDLE_SLEEP_INTERVAL		100
+
+typedef struct progress_handle progress_handle_t;
+
+struct progress_handle
+{
+	/* The stream the progress is printed to
+	 */
+	FILE *stream;
+
+	/* The total number of files
+	 */
+	int total_number_of_files;
+
+	/* The number of processed files
+	 */
+	int number_of_files;
+
+	/* The number of processed bytes
+	 */
+	uint64_t number_of_bytes;
+
+	/* The timestamp the processing was started, in nano seconds
+	 */
+	uint64_t start_timestamp;
+
+	/* The timestamp the progress was last printed, in nano seconds
+	 */
+	uint64_t print_timestamp;
+
+	/* Value to indicate the reporter should stop
+	 */
+	int stop;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the counters
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The reporter thread
+	 */
+	libcthreads_thread_t *reporter_thread;
+#endif
+};
+
+int progress_handle_get_timestamp(
+     uint64_t *timestamp );
+
+int progress_handle_initialize(
+     progress_handle_t **progress_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int progress_handle_free(
+     progress_handle_t **progress_handle,
+     libcerror_error_t **error );
+
+int progress_handle_start(
+     progress_handle_t *progress_handle,
+     int total_number_of_files,
+     libcerror_error_t **error );
+
+int progress_handle_update(
+     progress_handle_t *progress_handle,
+     int number_of_files,
+     uint64_t number_of_bytes,
+     libcerror_error_t **error );
+
+int progress_handle_stop(
+     progress_handle_t *progress_handle,
+     libcerror_error_t **error );
+
+int progress_handle_fprint(
+     progress_handle_t *progress_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int progress_handle_reporter_thread_callback(
+     progress_handle_t *progress_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PROGRESS_HANDLE_H ) */
+
@@ -0,0 +1,491 @@
+/*
+ * Resident daemon that parses Windows Prefetch File (PF) requests
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "daemon_handle.h"
+#include "info_handle.h"
+#include "sccainput.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+
+daemon_handle_t *sccad_daemon_handle = NULL;
+int sccad_abort                      = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use sccad to parse Windows Prefetch Files (PF) on request\n"
+	                 "of clients that connect to a Unix domain socket.\n\n" );
+
+	fprintf( stream, "Usage: sccad [ -j threads ] [ -m file ] [ -o format ] [ -hvV ]\n"
+	                 "             socket\n\n" );
+
+	fprintf( stream, "\tsocket: the path of the Unix domain socket to create\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     the number of worker threads, which is the maximum\n"
+	                 "\t        number of requests that are parsed concurrently\n"
+	                 "\t        (default is 1)\n" );
+	fprintf( stream, "\t-m:     write metrics in the Prometheus text format to the file\n"
+	                 "\t        every 10 seconds and when the daemon stops\n" );
+	fprintf( stream, "\t-o:     the output format of new connections, options: text,\n"
+	                 "\t        csv, jsonl (default), bodyfile, sql, snapshot\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for sccad
+ */
+void sccad_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "sccad_signal_handler";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccad_abort = 1;
+
+	if( sccad_daemon_handle != NULL )
+	{
+		if( daemon_handle_signal_abort(
+		     sccad_daemon_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal daemon handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                     = NULL;
+	info_handle_t *info_handle                   = NULL;
+	char *program                                = "sccad";
+	system_integer_t option                      = 0;
+	int verbose                                  = 0;
+
+#if defined( HAVE_DAEMON_SUPPORT )
+	system_character_t *option_metrics_file      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_output_format     = NULL;
+	uint64_t number_of_failed_requests           = 0;
+	uint64_t number_of_requests                  = 0;
+	int number_of_threads                        = 1;
+	int result                                   = 0;
+	int worker_index                             = 0;
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hj:m:o:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+#if defined( HAVE_DAEMON_SUPPORT )
+				option_number_of_threads = optarg;
+#endif
+				break;
+
+			case (system_integer_t) 'm':
+#if defined( HAVE_DAEMON_SUPPORT )
+				option_metrics_file = optarg;
+#endif
+				break;
+
+			case (system_integer_t) 'o':
+#if defined( HAVE_DAEMON_SUPPORT )
+				option_output_format = optarg;
+#endif
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing socket path.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+#if !defined( HAVE_DAEMON_SUPPORT )
+	fprintf(
+	 stderr,
+	 "Daemon mode is not supported on this platform.\n" );
+
+	return( EXIT_FAILURE );
+#else
+	if( option_number_of_threads != NULL )
+	{
+		result = sccainput_determine_number_of_threads(
+		          option_number_of_threads,
+		          &number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+
+			number_of_threads = 1;
+		}
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multi-threading is not supported defaulting to: 1 thread.\n" );
+
+		number_of_threads = 1;
+	}
+#endif
+	if( info_handle_initialize(
+	     &info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize info handle.\n" );
+
+		goto on_error;
+	}
+	if( daemon_handle_initialize(
+	     &sccad_daemon_handle,
+	     info_handle,
+	     number_of_threads,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize daemon handle.\n" );
+
+		goto on_error;
+	}
+	if( option_output_format != NULL )
+	{
+		result = daemon_handle_parse_output_format(
+		          option_output_format,
+		          narrow_string_length(
+		           option_output_format ),
+		          &( sccad_daemon_handle->output_format ) );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: jsonl.\n" );
+
+			sccad_daemon_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+		}
+	}
+	if( option_metrics_file != NULL )
+	{
+		if( daemon_handle_set_metrics_path(
+		     sccad_daemon_handle,
+		     option_metrics_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set metrics file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( daemon_handle_open(
+	     sccad_daemon_handle,
+	     argv[ optind ],
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open socket: %s.\n",
+		 argv[ optind ] );
+
+		goto on_error;
+	}
+	if( sccatools_signal_attach(
+	     sccad_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Listening on: %s with %d worker(s).\n",
+		 argv[ optind ],
+		 number_of_threads );
+	}
+	if( daemon_handle_run(
+	     sccad_daemon_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run daemon.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_handle_close(
+	     sccad_daemon_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close socket.\n" );
+
+		goto on_error;
+	}
+	if( verbose != 0 )
+	{
+		for( worker_index = 0;
+		     worker_index < sccad_daemon_handle->number_of_workers;
+		     worker_index++ )
+		{
+			number_of_requests        += sccad_daemon_handle->workers[ worker_index ]->number_of_requests;
+			number_of_failed_requests += sccad_daemon_handle->workers[ worker_index ]->number_of_failed_requests;
+		}
+		fprintf(
+		 stderr,
+		 "Served %" PRIu64 " request(s), of which %" PRIu64 " failed, on %" PRIu64 " connection(s).\n",
+		 number_of_requests,
+		 number_of_failed_requests,
+		 sccad_daemon_handle->number_of_connections );
+	}
+	if( daemon_handle_free(
+	     &sccad_daemon_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free daemon handle.\n" );
+
+		goto on_error;
+	}
+	if( info_handle_free(
+	     &info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free info handle.\n" );
+
+		goto on_error;
+	}
+	if( sccad_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%s: stopped\n",
+		 program );
+	}
+	return( EXIT_SUCCESS );
+#endif /* !defined( HAVE_DAEMON_SUPPORT ) */
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	sccatools_signal_detach(
+	 NULL );
+
+	if( sccad_daemon_handle != NULL )
+	{
+		daemon_handle_free(
+		 &sccad_daemon_handle,
+		 NULL );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
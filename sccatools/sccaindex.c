@@ -0,0 +1,712 @@
+/*
+ * Builds and queries an index of the filenames loaded by Windows Prefetch Files (PF)
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "index_handle.h"
+#include "path_list.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+#include "segment_handle.h"
+
+index_handle_t *sccaindex_index_handle     = NULL;
+segment_handle_t *sccaindex_segment_handle = NULL;
+int sccaindex_abort                        = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use sccaindex to build an index of the filenames loaded by\n"
+	                 "Windows Prefetch Files (PF) and to query which files loaded\n"
+	                 "a filename.\n\n" );
+
+	fprintf( stream, "Usage: sccaindex [ -q filename ] [ -hmrvV ] index [ sources ]\n\n" );
+
+	fprintf( stream, "\tindex:   the index file, which is created from the sources\n"
+	                 "\t         when provided, or an existing index directory, to\n"
+	                 "\t         which the sources are appended as a new segment\n" );
+	fprintf( stream, "\tsources: one or more source files or, in combination\n"
+	                 "\t         with -r, directories\n\n" );
+
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-m:      merge the segments of the index directory\n" );
+	fprintf( stream, "\t-q:      query the index for the files that loaded the\n"
+	                 "\t         filename, as stored in the prefetch files, for\n"
+	                 "\t         example \\VOLUME{...}\\WINDOWS\\SYSTEM32\\NTDLL.DLL\n" );
+	fprintf( stream, "\t-r:      add the prefetch files in the source directories\n"
+	                 "\t         and their sub directories\n" );
+	fprintf( stream, "\t-v:      verbose output to stderr\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+/* Signal handler for sccaindex
+ */
+void sccaindex_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "sccaindex_signal_handler";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccaindex_abort = 1;
+
+	if( sccaindex_index_handle != NULL )
+	{
+		if( index_handle_signal_abort(
+		     sccaindex_index_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal index handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( sccaindex_segment_handle != NULL )
+	{
+		if( segment_handle_signal_abort(
+		     sccaindex_segment_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal segment handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error         = NULL;
+	path_list_t *path_list           = NULL;
+	system_character_t *index_path   = NULL;
+	system_character_t *option_query = NULL;
+	char *program                    = "sccaindex";
+	system_integer_t option          = 0;
+	size_t source_length             = 0;
+	uint32_t sequence_number         = 0;
+	int argument_index               = 0;
+	int is_segmented                 = 0;
+	int option_merge                 = 0;
+	int path_index                   = 0;
+	int recursive                    = 0;
+	int result                       = 0;
+	int verbose                      = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hmq:rvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				option_merge = 1;
+
+				break;
+
+			case (system_integer_t) 'q':
+				option_query = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				recursive = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing index file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	index_path = argv[ optind ];
+
+	if( ( option_query == NULL )
+	 && ( option_merge == 0 )
+	 && ( ( optind + 1 ) == argc ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing sources or query.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	/* An existing directory is a segmented index
+	 */
+	if( path_list_is_directory(
+	     index_path ) == 1 )
+	{
+		is_segmented = 1;
+	}
+	if( ( option_merge != 0 )
+	 && ( is_segmented == 0 ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Merge requires an index directory.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	sccatools_output_version_fprint(
+	 stdout,
+	 program );
+
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( index_handle_initialize(
+	     &sccaindex_index_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize index handle.\n" );
+
+		goto on_error;
+	}
+	if( is_segmented != 0 )
+	{
+		if( segment_handle_initialize(
+		     &sccaindex_segment_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize segment handle.\n" );
+
+			goto on_error;
+		}
+		if( segment_handle_set_directory_path(
+		     sccaindex_segment_handle,
+		     index_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set index directory.\n" );
+
+			goto on_error;
+		}
+		if( segment_handle_read_segments(
+		     sccaindex_segment_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read index directory: %" PRIs_SYSTEM ".\n",
+			 index_path );
+
+			goto on_error;
+		}
+	}
+	if( sccatools_signal_attach(
+	     sccaindex_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( optind + 1 ) < argc )
+	{
+		if( path_list_initialize(
+		     &path_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize path list.\n" );
+
+			goto on_error;
+		}
+		for( argument_index = optind + 1;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( ( recursive != 0 )
+			 && ( path_list_is_directory(
+			       argv[ argument_index ] ) == 1 ) )
+			{
+				result = path_list_append_directory(
+				          path_list,
+				          argv[ argument_index ],
+				          0,
+				          &error );
+			}
+			else
+			{
+				source_length = system_string_length(
+				                 argv[ argument_index ] );
+
+				result = path_list_append_path(
+				          path_list,
+				          argv[ argument_index ],
+				          source_length,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to add source: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		if( is_segmented != 0 )
+		{
+			if( sccaindex_segment_handle->last_sequence_number == (uint32_t) 0xffffffffUL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append to index: %" PRIs_SYSTEM " maximum number of segments reached.\n",
+				 index_path );
+
+				goto on_error;
+			}
+			/* The sequence number of the new segment is reserved before the merge
+			 * starts, the merge only operates on the segments read before
+			 */
+			sequence_number = sccaindex_segment_handle->last_sequence_number + 1;
+
+			if( segment_handle_start_merge(
+			     sccaindex_segment_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to start merge.\n" );
+
+				goto on_error;
+			}
+		}
+		for( path_index = 0;
+		     path_index < path_list->number_of_paths;
+		     path_index++ )
+		{
+			if( sccaindex_abort != 0 )
+			{
+				break;
+			}
+			result = index_handle_append_source(
+			          sccaindex_index_handle,
+			          path_list->paths[ path_index ],
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to index source: %" PRIs_SYSTEM ".\n",
+				 path_list->paths[ path_index ] );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open source: %" PRIs_SYSTEM ", skipping.\n",
+				 path_list->paths[ path_index ] );
+			}
+		}
+		if( path_list_free(
+		     &path_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free path list.\n" );
+
+			goto on_error;
+		}
+		if( sccaindex_abort == 0 )
+		{
+			if( is_segmented != 0 )
+			{
+				result = segment_handle_write_segment(
+				          sccaindex_segment_handle,
+				          sccaindex_index_handle,
+				          sequence_number,
+				          &error );
+			}
+			else
+			{
+				result = index_handle_write_index(
+				          sccaindex_index_handle,
+				          index_path,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write index: %" PRIs_SYSTEM ".\n",
+				 index_path );
+
+				goto on_error;
+			}
+			fprintf(
+			 stdout,
+			 "Indexed %d file(s), skipped %d file(s).\n",
+			 sccaindex_index_handle->number_of_files_appended,
+			 sccaindex_index_handle->number_of_files_skipped );
+		}
+		if( is_segmented != 0 )
+		{
+			if( segment_handle_stop_merge(
+			     sccaindex_segment_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to merge segments.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( ( option_merge != 0 )
+	      && ( sccaindex_abort == 0 ) )
+	{
+		if( segment_handle_merge(
+		     sccaindex_segment_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to merge segments.\n" );
+
+			goto on_error;
+		}
+	}
+	if( sccaindex_segment_handle != NULL )
+	{
+		if( sccaindex_segment_handle->number_of_merges > 0 )
+		{
+			fprintf(
+			 stdout,
+			 "Merged %d file(s) in %d merge(s).\n",
+			 sccaindex_segment_handle->number_of_files_merged,
+			 sccaindex_segment_handle->number_of_merges );
+		}
+	}
+	if( ( option_query != NULL )
+	 && ( sccaindex_abort == 0 ) )
+	{
+		if( is_segmented != 0 )
+		{
+			/* The segments are read again to include the segment just written
+			 */
+			if( segment_handle_read_segments(
+			     sccaindex_segment_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read index directory: %" PRIs_SYSTEM ".\n",
+				 index_path );
+
+				goto on_error;
+			}
+			result = segment_handle_query_fprint(
+			          sccaindex_segment_handle,
+			          sccaindex_index_handle,
+			          option_query,
+			          &error );
+		}
+		else
+		{
+			if( index_handle_open_index(
+			     sccaindex_index_handle,
+			     index_path,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open index: %" PRIs_SYSTEM ".\n",
+				 index_path );
+
+				goto on_error;
+			}
+			result = index_handle_query_fprint(
+			          sccaindex_index_handle,
+			          option_query,
+			          &error );
+		}
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to query index.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stdout,
+			 "No files loaded: %" PRIs_SYSTEM "\n",
+			 option_query );
+		}
+	}
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sccaindex_segment_handle != NULL )
+	{
+		if( segment_handle_free(
+		     &sccaindex_segment_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free segment handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( index_handle_free(
+	     &sccaindex_index_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free index handle.\n" );
+
+		goto on_error;
+	}
+	if( sccaindex_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	if( sccaindex_segment_handle != NULL )
+	{
+		/* Wait for a background merge to stop before freeing the segment handle
+		 */
+		segment_handle_signal_abort(
+		 sccaindex_segment_handle,
+		 NULL );
+		segment_handle_stop_merge(
+		 sccaindex_segment_handle,
+		 NULL );
+		segment_handle_free(
+		 &sccaindex_segment_handle,
+		 NULL );
+	}
+	if( sccaindex_index_handle != NULL )
+	{
+		index_handle_free(
+		 &sccaindex_index_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -33,18 +33,118 @@
 #include <stdlib.h>
 #endif
 
+#if defined( WINAPI )
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+#include "archive_handle.h"
+#include "frequency_sketch.h"
+#include "image_handle.h"
+#include "image_io_handle.h"
 #include "info_handle.h"
+#include "journal_handle.h"
+#include "metrics_handle.h"
+#include "path_list.h"
+#include "progress_handle.h"
+#include "sccainput.h"
 #include "sccatools_getopt.h"
+#include "sccatools_libbfio.h"
 #include "sccatools_libcerror.h"
 #include "sccatools_libclocale.h"
 #include "sccatools_libcnotify.h"
 #include "sccatools_libscca.h"
+#include "sccatools_live.h"
 #include "sccatools_output.h"
 #include "sccatools_signal.h"
 #include "sccatools_unused.h"
+#include "summary_handle.h"
+#include "watch_handle.h"
+
+/* The number of paths that are opened per batch in threaded mode
+ */
+#define SCCAINFO_BATCH_SIZE	64
+
+/* The number of read threads per parse thread in threaded mode, since
+ * a read thread mostly waits for storage more reads are kept in flight
+ */
+#define SCCAINFO_READ_THREADS_PER_THREAD	4
+
+/* The interval in nano seconds at which the metrics file is written in threaded mode
+ */
+#define SCCAINFO_METRICS_WRITE_INTERVAL		( (uint64_t) 10 * 1000000000UL )
+
+typedef struct sccainfo_batch sccainfo_batch_t;
+
+struct sccainfo_batch
+{
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
+
+	/* The paths of the batch
+	 */
+	system_character_t **paths;
+
+	/* The output buffers, one per path in the batch
+	 */
+	output_buffer_t *output_buffers[ SCCAINFO_BATCH_SIZE ];
+
+	/* The summary handle, contains NULL if not in summary mode
+	 */
+	summary_handle_t *summary_handle;
+
+	/* The metrics handle, contains NULL if no metrics are collected
+	 */
+	metrics_handle_t *metrics_handle;
+
+	/* The summary records, one per path in the batch
+	 */
+	summary_record_t *summary_records[ SCCAINFO_BATCH_SIZE ];
+
+	/* The number of bytes read, one per path in the batch
+	 */
+	uint64_t number_of_bytes[ SCCAINFO_BATCH_SIZE ];
+
+	/* Values to indicate the file contains no filename that matches
+	 * the match string, one per path in the batch
+	 */
+	uint8_t is_filtered[ SCCAINFO_BATCH_SIZE ];
+
+	/* The results, one per path in the batch
+	 */
+	int results[ SCCAINFO_BATCH_SIZE ];
+};
+
+typedef struct sccainfo_archive sccainfo_archive_t;
+
+struct sccainfo_archive
+{
+	/* The info handle
+	 */
+	info_handle_t *info_handle;
 
-info_handle_t *sccainfo_info_handle = NULL;
-int sccainfo_abort                  = 0;
+	/* The summary handle, contains NULL if not in summary mode
+	 */
+	summary_handle_t *summary_handle;
+
+	/* The path of the archive
+	 */
+	const system_character_t *archive_path;
+
+	/* Value to indicate the source should be printed
+	 */
+	int print_source;
+
+	/* The number of members that failed
+	 */
+	int number_of_failures;
+};
+
+archive_handle_t *sccainfo_archive_handle = NULL;
+info_handle_t *sccainfo_info_handle       = NULL;
+watch_handle_t *sccainfo_watch_handle     = NULL;
+int sccainfo_abort                        = 0;
 
 /* Prints the executable usage information
  */
@@ -58,13 +158,121 @@ void usage_fprint(
 	fprintf( stream, "Use sccainfo to determine information about a Windows\n"
 	                 "Prefetch File (PF).\n\n" );
 
-	fprintf( stream, "Usage: sccainfo [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: sccainfo [ -b width ] [ -I image ] [ -j threads ]\n"
+	                 "                [ -J file ] [ -k number ] [ -m string ]\n"
+	                 "                [ -M type ] [ -o format ] [ -P file ]\n"
+	                 "                [ -S shard ] [ -x expression ]\n"
+	                 "                [ -z compression ] [ -AhHLprRstvV ] [ sources ]\n"
+	                 "       sccainfo [ -m string ] [ -M type ] [ -x expression ]\n"
+	                 "                [ -v ] -w directory\n\n" );
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsources: one or more source files or, in combination\n"
+	                 "\t         with -r, directories\n\n" );
 
-	fprintf( stream, "\t-h:     shows this help\n" );
-	fprintf( stream, "\t-v:     verbose output to stderr\n" );
-	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\t-A:      archive mode, the sources are tar, gzip compressed\n"
+	                 "\t         tar or zip archives, the prefetch (.pf) files they\n"
+	                 "\t         contain are read from the archives without extracting\n"
+	                 "\t         them and printed with the source archive/member\n" );
+	fprintf( stream, "\t-b:      run time histogram summary mode, implies -s but\n"
+	                 "\t         also prints the number of runs per time bucket,\n"
+	                 "\t         executable and prefetch hash, the bucket width is\n"
+	                 "\t         in seconds or has an m, h or d suffix, for example\n"
+	                 "\t         1h\n" );
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-H:      verify the prefetch hash, prints one record per\n"
+	                 "\t         source with the prefetch hash, if it matches the\n"
+	                 "\t         hash computed of one of the filenames and the path\n"
+	                 "\t         of the executable that matches\n" );
+	fprintf( stream, "\t-I:      image mode, the prefetch files are read from the raw\n"
+	                 "\t         storage media image and the sources are extents\n"
+	                 "\t         files with one line per prefetch file, formatted\n"
+	                 "\t         as: size offset+size[,offset+size...] name, where\n"
+	                 "\t         the offsets and sizes of the extents in the image\n"
+	                 "\t         are in bytes, adjacent extents are read together\n"
+	                 "\t         and the image blocks are cached across files\n" );
+	fprintf( stream, "\t-j:      the number of threads used to parse the source\n"
+	                 "\t         files (default is 1), the output is printed in\n"
+	                 "\t         the order of the sources\n" );
+	fprintf( stream, "\t-J:      write a journal of the processed sources, with their\n"
+	                 "\t         size, modification time and output offset, to the\n"
+	                 "\t         file, the journal is synchronized after every batch\n"
+	                 "\t         of sources so that an interrupted run can be resumed\n"
+	                 "\t         with -R\n" );
+	fprintf( stream, "\t-k:      sketch summary mode, implies -s but counts the\n"
+	                 "\t         loaded filenames in bounded memory sketches and\n"
+	                 "\t         prints the estimated number of distinct filenames\n"
+	                 "\t         and the specified number of most common and rarest\n"
+	                 "\t         filenames with their estimated number of files\n" );
+	fprintf( stream, "\t-L:      live collector mode, reads the prefetch files of the\n"
+	                 "\t         running Windows system, from the Prefetch directory\n"
+	                 "\t         of the Windows directory if no sources are specified,\n"
+	                 "\t         implies -r, the backup privilege is enabled and the\n"
+	                 "\t         files are opened with backup semantics, sharing\n"
+	                 "\t         access with the prefetcher, and read whole by the\n"
+	                 "\t         batch engine\n" );
+	fprintf( stream, "\t-m:      only print the sources that contain a filename that\n"
+	                 "\t         matches the string, ASCII characters are compared\n"
+	                 "\t         case-insensitive\n" );
+	fprintf( stream, "\t-M:      match type, options: exact, prefix, suffix or\n"
+	                 "\t         substring (default)\n" );
+	fprintf( stream, "\t-o:      output format, options: text (default), csv,\n"
+	                 "\t         jsonl (JSON Lines), bodyfile, arrow or sql, csv\n"
+	                 "\t         and jsonl print one record per source file,\n"
+	                 "\t         bodyfile prints one line per last run time and\n"
+	                 "\t         volume creation time, arrow writes an Apache Arrow\n"
+	                 "\t         IPC stream with one row per file metrics entry,\n"
+	                 "\t         sql prints a script for the sqlite3 shell that\n"
+	                 "\t         loads the files, runs, filenames, metrics, volumes\n"
+	                 "\t         and directories tables\n" );
+	fprintf( stream, "\t-p:      print the progress, with the number of files and\n"
+	                 "\t         megabytes processed per second, to stderr every\n"
+	                 "\t         second\n" );
+	fprintf( stream, "\t-P:      write metrics of the parsed files, the errors and\n"
+	                 "\t         the stage latencies in the Prometheus text format\n"
+	                 "\t         to the file every 10 seconds and when done\n" );
+	fprintf( stream, "\t-r:      recursively scan the source directories for\n"
+	                 "\t         prefetch (.pf) files\n" );
+	fprintf( stream, "\t-R:      resume the run of the journal specified with -J,\n"
+	                 "\t         the sources that are in the journal with the same\n"
+	                 "\t         size and modification time are skipped and the\n"
+	                 "\t         processed sources are appended to the journal\n" );
+	fprintf( stream, "\t-s:      summary mode, prints the executables by run count,\n"
+	                 "\t         the loaded filenames with the number of files they\n"
+	                 "\t         appear in and the volumes by serial number over\n"
+	                 "\t         all sources instead of the per file information\n" );
+	fprintf( stream, "\t-S:      shard mode, only processes the sources that are part\n"
+	                 "\t         of the shard, formatted as index/number, for\n"
+	                 "\t         example 0/4, the sources are assigned by a hash\n"
+	                 "\t         of their path and printed sorted by path, so that\n"
+	                 "\t         the csv and jsonl output of the shards can be\n"
+	                 "\t         combined with sccamerge\n" );
+	fprintf( stream, "\t-t:      triage mode, only sources with a valid prefetch\n"
+	                 "\t         file signature and header sizes are parsed,\n"
+	                 "\t         in combination with -r all files are checked\n" );
+	fprintf( stream, "\t-v:      verbose output to stderr\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+	fprintf( stream, "\t-w:      watch mode, watches the directory for changed\n"
+	                 "\t         prefetch (.pf) files and prints a JSON Lines\n"
+	                 "\t         record with the new last run times and the\n"
+	                 "\t         added and removed filenames per changed file,\n"
+	                 "\t         until interrupted\n" );
+	fprintf( stream, "\t-x:      only print the sources that match the filter\n"
+	                 "\t         expression, for example:\n"
+	                 "\t         run_count > 10 and last_run_time > 2024-01-01\n"
+	                 "\t         and any(filename ~ \"\\\\TEMP\\\\\")\n"
+	                 "\t         comparisons of run_count, last_run_time,\n"
+	                 "\t         format_version, prefetch_hash, number_of_filenames,\n"
+	                 "\t         number_of_volumes and number_of_file_metrics\n"
+	                 "\t         support ==, !=, <, <=, > and >=, comparisons of\n"
+	                 "\t         executable_filename and any(filename ...) support\n"
+	                 "\t         == (exact), ~ (substring), ^= (prefix) and $=\n"
+	                 "\t         (suffix), strings are compared case-insensitive,\n"
+	                 "\t         terms can be combined with and, or, not and\n"
+	                 "\t         parentheses\n" );
+	fprintf( stream, "\t-z:      compress the csv, jsonl, bodyfile or sql output\n"
+	                 "\t         with gzip, formatted as gzip[:level[:threads]],\n"
+	                 "\t         where level is 0 to 9 (default is 6) and threads\n"
+	                 "\t         is the number of compression threads (default is 1)\n" );
 }
 
 /* Signal handler for sccainfo
@@ -95,6 +303,38 @@ void sccainfo_signal_handler(
 			 &error );
 		}
 	}
+	if( sccainfo_archive_handle != NULL )
+	{
+		if( archive_handle_signal_abort(
+		     sccainfo_archive_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal archive handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( sccainfo_watch_handle != NULL )
+	{
+		if( watch_handle_signal_abort(
+		     sccainfo_watch_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal watch handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -111,147 +351,3219 @@ void sccainfo_signal_handler(
 	}
 }
 
-/* The main program
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Prints the file information of a file opened by the batch
+ * Callback function for libscca_batch_open_paths_pipelined
+ * The parse latency of the metrics is the time spent reading the sections
+ * of the file and the output latency the time spent in this function
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain( int argc, wchar_t * const argv[] )
-#else
-int main( int argc, char * const argv[] )
-#endif
+int sccainfo_batch_callback(
+     int path_index,
+     libscca_file_t *file,
+     libcerror_error_t *open_error,
+     void *callback_arguments )
 {
-	libcerror_error_t *error   = NULL;
-	system_character_t *source = NULL;
-	char *program              = "sccainfo";
-	system_integer_t option    = 0;
-	int verbose                = 0;
+	libcerror_error_t *error  = NULL;
+	sccainfo_batch_t *batch   = NULL;
+	uint64_t parse_time       = 0;
+	uint64_t read_time        = 0;
+	uint64_t start_timestamp  = 0;
+	int result                = 0;
+	int statistic_type        = 0;
 
-	libcnotify_stream_set(
-	 stderr,
-	 NULL );
-	libcnotify_verbose_set(
-	 1 );
+	if( ( path_index < 0 )
+	 || ( path_index >= SCCAINFO_BATCH_SIZE )
+	 || ( callback_arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	batch = (sccainfo_batch_t *) callback_arguments;
 
-	if( libclocale_initialize(
-	     "sccatools",
-	     &error ) != 1 )
+	/* A file that cannot be opened is reported by the main thread
+	 * so that the batch continues with the remaining paths
+	 */
+	if( file == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to initialize locale values.\n" );
+		batch->results[ path_index ] = -1;
 
-		goto on_error;
+		if( batch->metrics_handle != NULL )
+		{
+			if( metrics_handle_add_failed_file(
+			     batch->metrics_handle,
+			     open_error,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
 	}
-	if( sccatools_output_initialize(
-	     _IONBF,
+	if( batch->metrics_handle != NULL )
+	{
+		if( progress_handle_get_timestamp(
+		     &start_timestamp ) != 1 )
+		{
+			start_timestamp = 0;
+		}
+		for( statistic_type = LIBSCCA_STATISTIC_TYPE_FILE_HEADER_READ_TIME;
+		     statistic_type <= LIBSCCA_STATISTIC_TYPE_TRACE_CHAIN_READ_TIME;
+		     statistic_type++ )
+		{
+			if( libscca_file_get_statistic(
+			     file,
+			     statistic_type,
+			     &read_time,
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+
+				read_time = 0;
+			}
+			parse_time += read_time;
+		}
+		if( metrics_handle_add_stage_latency(
+		     batch->metrics_handle,
+		     METRICS_HANDLE_STAGE_PARSE,
+		     parse_time,
+		     &error ) != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+	if( libscca_file_get_statistic(
+	     file,
+	     LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	     &( batch->number_of_bytes[ path_index ] ),
 	     &error ) != 1 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to initialize output settings.\n" );
+		libcerror_error_free(
+		 &error );
+
+		batch->number_of_bytes[ path_index ] = 0;
+	}
+	result = info_handle_file_matches(
+	          batch->info_handle,
+	          file,
+	          &error );
 
+	if( result == -1 )
+	{
 		goto on_error;
 	}
-	sccatools_output_version_fprint(
-	 stdout,
-	 program );
+	else if( result == 0 )
+	{
+		batch->is_filtered[ path_index ] = 1;
+	}
+	/* The values are aggregated by the main thread in the order of the paths
+	 */
+	else if( batch->summary_handle != NULL )
+	{
+		if( summary_record_read_file(
+		     batch->summary_records[ path_index ],
+		     file,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	else if( info_handle_file_append_with_file(
+	          batch->info_handle,
+	          file,
+	          batch->paths[ path_index ],
+	          batch->output_buffers[ path_index ],
+	          &error ) != 1 )
+	{
+		/* Similar to the sequential mode only the text output of a partially read file is kept
+		 */
+		if( batch->info_handle->output_format != INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+		{
+			batch->output_buffers[ path_index ]->data_offset = 0;
+		}
+		goto on_error;
+	}
+	batch->results[ path_index ] = 1;
 
-	while( ( option = sccatools_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+	if( batch->metrics_handle != NULL )
 	{
-		switch( option )
+		if( ( metrics_handle_add_stage_latency_since(
+		       batch->metrics_handle,
+		       METRICS_HANDLE_STAGE_OUTPUT,
+		       start_timestamp,
+		       &error ) != 1 )
+		 || ( metrics_handle_add_file(
+		       batch->metrics_handle,
+		       file,
+		       &error ) != 1 ) )
 		{
-			case (system_integer_t) '?':
-			default:
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	batch->results[ path_index ] = -1;
+
+	/* A file that cannot be printed is not an error of the batch
+	 */
+	result = 1;
+
+	if( batch->metrics_handle != NULL )
+	{
+		result = metrics_handle_add_failed_file(
+		          batch->metrics_handle,
+		          error,
+		          NULL );
+	}
+	libcerror_error_free(
+	 &error );
+
+	return( result );
+}
+
+/* Prints the file information of the paths using multiple threads
+ * The output of every path is collected in an output buffer and printed in the order of the paths
+ * with a single write per path, the output buffers are reused for every batch
+ * In summary mode the values of every path are collected in a summary record instead
+ * and aggregated in the order of the paths
+ * The progress handle is optional and is updated once per batch
+ * The metrics handle is optional, its metrics are written to the metrics file
+ * periodically after a batch and when all paths were processed
+ * The journal handle is optional, the paths that were processed are journaled
+ * and the journal is flushed after every batch
+ * The paths of files without a filename that matches the match string are skipped
+ * Returns the number of paths that failed or -1 on error
+ */
+int sccainfo_process_paths_threaded(
+     info_handle_t *info_handle,
+     summary_handle_t *summary_handle,
+     progress_handle_t *progress_handle,
+     metrics_handle_t *metrics_handle,
+     const char *metrics_path,
+     journal_handle_t *journal_handle,
+     path_list_t *path_list,
+     int number_of_threads,
+     int print_source,
+     libcerror_error_t **error )
+{
+	sccainfo_batch_t batch;
+
+	static char *function    = "sccainfo_process_paths_threaded";
+	uint64_t number_of_bytes = 0;
+	int64_t output_offset    = -1;
+	int access_flags         = LIBSCCA_OPEN_READ;
+	int batch_index          = 0;
+	int batch_size           = 0;
+	int batch_start          = 0;
+	int number_of_failures   = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &batch,
+	     0,
+	     sizeof( sccainfo_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		return( -1 );
+	}
+	batch.info_handle    = info_handle;
+	batch.summary_handle = summary_handle;
+	batch.metrics_handle = metrics_handle;
+
+	/* The parse latency of the metrics is determined from the section read times
+	 */
+	if( metrics_handle != NULL )
+	{
+		access_flags |= LIBSCCA_ACCESS_FLAG_MEASURE_READ_TIMES;
+	}
+
+	for( batch_start = 0;
+	     batch_start < path_list->number_of_paths;
+	     batch_start += SCCAINFO_BATCH_SIZE )
+	{
+		if( sccainfo_abort != 0 )
+		{
+			break;
+		}
+		batch_size = path_list->number_of_paths - batch_start;
+
+		if( batch_size > SCCAINFO_BATCH_SIZE )
+		{
+			batch_size = SCCAINFO_BATCH_SIZE;
+		}
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			batch.number_of_bytes[ batch_index ] = 0;
+			batch.is_filtered[ batch_index ]     = 0;
+			batch.results[ batch_index ]         = 0;
+
+			if( summary_handle != NULL )
+			{
+				if( batch.summary_records[ batch_index ] == NULL )
+				{
+					if( summary_record_initialize(
+					     &( batch.summary_records[ batch_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create summary record: %d.",
+						 function,
+						 batch_index );
+
+						goto on_error;
+					}
+				}
+				continue;
+			}
+			if( batch.output_buffers[ batch_index ] == NULL )
+			{
+				if( output_buffer_initialize(
+				     &( batch.output_buffers[ batch_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create output buffer: %d.",
+					 function,
+					 batch_index );
+
+					goto on_error;
+				}
+			}
+			batch.output_buffers[ batch_index ]->data_offset = 0;
+		}
+		batch.paths = &( path_list->paths[ batch_start ] );
+
+		/* Hint the paths of the next batch so that their files are read ahead
+		 * by the operating system while this batch is processed
+		 */
+		if( path_list_advise_will_need(
+		     path_list,
+		     batch_start + batch_size,
+		     SCCAINFO_BATCH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to advise paths of next batch.",
+			 function );
+
+			goto on_error;
+		}
+		/* The files are read into pooled buffers by separate read threads and
+		 * parsed from memory, hence the reads of multiple files are in flight
+		 * while other files are parsed and printed
+		 * The callback function records per path failures which are reported below
+		 */
+		result = libscca_batch_open_paths_pipelined(
+		          (char * const *) &( path_list->paths[ batch_start ] ),
+		          batch_size,
+		          number_of_threads * SCCAINFO_READ_THREADS_PER_THREAD,
+		          number_of_threads,
+		          number_of_threads,
+		          0,
+		          access_flags,
+		          0,
+		          &sccainfo_batch_callback,
+		          (void *) &batch,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process batch.",
+			 function );
+
+			goto on_error;
+		}
+		for( batch_index = 0;
+		     batch_index < batch_size;
+		     batch_index++ )
+		{
+			if( batch.is_filtered[ batch_index ] != 0 )
+			{
+				if( journal_handle != NULL )
+				{
+					if( journal_handle_append_file(
+					     journal_handle,
+					     path_list->paths[ batch_start + batch_index ],
+					     -1,
+					     error ) == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append path: %d to journal.",
+						 function,
+						 batch_index );
+
+						goto on_error;
+					}
+				}
+				continue;
+			}
+			if( summary_handle != NULL )
+			{
+				if( batch.results[ batch_index ] == 1 )
+				{
+					if( summary_handle_append_record(
+					     summary_handle,
+					     batch.summary_records[ batch_index ],
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append summary record: %d.",
+						 function,
+						 batch_index );
+
+						goto on_error;
+					}
+				}
+			}
+			else
+			{
+				if( print_source != 0 )
+				{
+					fprintf(
+					 stdout,
+					 "Source: %" PRIs_SYSTEM "\n\n",
+					 path_list->paths[ batch_start + batch_index ] );
+				}
+				if( info_handle_output_buffer_write(
+				     batch.info_handle,
+				     batch.output_buffers[ batch_index ],
+				     stdout,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write output buffer: %d.",
+					 function,
+					 batch_index );
+
+					goto on_error;
+				}
+			}
+			if( batch.results[ batch_index ] != 1 )
+			{
 				fprintf(
 				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM "\n",
-				 argv[ optind - 1 ] );
+				 "Unable to open: %" PRIs_SYSTEM ".\n",
+				 path_list->paths[ batch_start + batch_index ] );
 
-				usage_fprint(
-				 stdout );
+				number_of_failures++;
+			}
+			/* The paths that failed are not journaled so that they are retried when resumed
+			 * the output offset is only known for uncompressed text based output
+			 */
+			else if( journal_handle != NULL )
+			{
+				output_offset = -1;
 
-				return( EXIT_FAILURE );
+				if( ( summary_handle == NULL )
+				 && ( info_handle->arrow_writer == NULL )
+				 && ( info_handle->gzip_writer == NULL ) )
+				{
+					output_offset = journal_handle_get_output_offset(
+					                 stdout );
+				}
+				if( journal_handle_append_file(
+				     journal_handle,
+				     path_list->paths[ batch_start + batch_index ],
+				     output_offset,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append path: %d to journal.",
+					 function,
+					 batch_index );
 
-			case (system_integer_t) 'h':
-				usage_fprint(
-				 stdout );
+					goto on_error;
+				}
+			}
+		}
+		/* The journal is flushed after the output of the batch was written
+		 * so that a journaled path always has its output
+		 */
+		if( journal_handle != NULL )
+		{
+			if( journal_handle_flush(
+			     journal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush journal.",
+				 function );
 
-				return( EXIT_SUCCESS );
+				goto on_error;
+			}
+		}
+		if( progress_handle != NULL )
+		{
+			number_of_bytes = 0;
 
-			case (system_integer_t) 'v':
-				verbose = 1;
+			for( batch_index = 0;
+			     batch_index < batch_size;
+			     batch_index++ )
+			{
+				number_of_bytes += batch.number_of_bytes[ batch_index ];
+			}
+			if( progress_handle_update(
+			     progress_handle,
+			     batch_size,
+			     number_of_bytes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
 
-				break;
+				goto on_error;
+			}
+		}
+		if( ( metrics_handle != NULL )
+		 && ( metrics_path != NULL ) )
+		{
+			if( metrics_handle_write_file(
+			     metrics_handle,
+			     metrics_path,
+			     SCCAINFO_METRICS_WRITE_INTERVAL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write metrics file.",
+				 function );
 
-			case (system_integer_t) 'V':
-				sccatools_output_copyright_fprint(
-				 stdout );
+				goto on_error;
+			}
+		}
+	}
+	if( ( metrics_handle != NULL )
+	 && ( metrics_path != NULL ) )
+	{
+		if( metrics_handle_write_file(
+		     metrics_handle,
+		     metrics_path,
+		     0,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write metrics file.",
+			 function );
 
-				return( EXIT_SUCCESS );
+			goto on_error;
 		}
 	}
-	if( optind == argc )
+	for( batch_index = 0;
+	     batch_index < SCCAINFO_BATCH_SIZE;
+	     batch_index++ )
 	{
-		fprintf(
-		 stderr,
-		 "Missing source file.\n" );
+		if( batch.output_buffers[ batch_index ] != NULL )
+		{
+			if( output_buffer_free(
+			     &( batch.output_buffers[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output buffer: %d.",
+				 function,
+				 batch_index );
 
-		usage_fprint(
-		 stdout );
+				goto on_error;
+			}
+		}
+		if( batch.summary_records[ batch_index ] != NULL )
+		{
+			if( summary_record_free(
+			     &( batch.summary_records[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free summary record: %d.",
+				 function,
+				 batch_index );
 
-		return( EXIT_FAILURE );
+				goto on_error;
+			}
+		}
 	}
-	source = argv[ optind ];
+	return( number_of_failures );
 
-	libcnotify_verbose_set(
-	 verbose );
-	libscca_notify_set_stream(
-	 stderr,
-	 NULL );
-	libscca_notify_set_verbose(
-	 verbose );
+on_error:
+	for( batch_index = 0;
+	     batch_index < SCCAINFO_BATCH_SIZE;
+	     batch_index++ )
+	{
+		if( batch.output_buffers[ batch_index ] != NULL )
+		{
+			output_buffer_free(
+			 &( batch.output_buffers[ batch_index ] ),
+			 NULL );
+		}
+		if( batch.summary_records[ batch_index ] != NULL )
+		{
+			summary_record_free(
+			 &( batch.summary_records[ batch_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
 
-	if( info_handle_initialize(
-	     &sccainfo_info_handle,
-	     &error ) != 1 )
+/* Removes the paths that are in the journal from the path list
+ * Returns the number of removed paths or -1 on error
+ */
+int sccainfo_remove_journaled_paths(
+     journal_handle_t *journal_handle,
+     path_list_t *path_list,
+     libcerror_error_t **error )
+{
+	static char *function       = "sccainfo_remove_journaled_paths";
+	int number_of_removed_paths = 0;
+	int path_index              = 0;
+
+	if( journal_handle == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to initialize info handle.\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid journal handle.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( info_handle_open_input(
-	     sccainfo_info_handle,
-	     source,
-	     &error ) != 1 )
+	if( path_list == NULL )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open: %" PRIs_SYSTEM ".\n",
-		 source );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( info_handle_file_fprint(
-	     sccainfo_info_handle,
-	     &error ) != 1 )
+	if( journal_handle->number_of_hashes == 0 )
 	{
-		fprintf(
+		return( 0 );
+	}
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		if( journal_handle_contains_file(
+		     journal_handle,
+		     path_list->paths[ path_index ] ) != 0 )
+		{
+			memory_free(
+			 path_list->paths[ path_index ] );
+
+			path_list->paths[ path_index ] = NULL;
+
+			number_of_removed_paths++;
+		}
+		else if( number_of_removed_paths > 0 )
+		{
+			path_list->paths[ path_index - number_of_removed_paths ] = path_list->paths[ path_index ];
+			path_list->paths[ path_index ]                           = NULL;
+		}
+	}
+	path_list->number_of_paths -= number_of_removed_paths;
+
+	return( number_of_removed_paths );
+}
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Removes the paths that do not contain a prefetch file header from the path list
+ * Only the file header is read so that non-matching files, such as carved data,
+ * are not fully parsed
+ * Returns the number of removed paths or -1 on error
+ */
+int sccainfo_triage_paths(
+     path_list_t *path_list,
+     libcerror_error_t **error )
+{
+	static char *function       = "sccainfo_triage_paths";
+	int number_of_removed_paths = 0;
+	int path_index              = 0;
+	int result                  = 0;
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		if( sccainfo_abort != 0 )
+		{
+			break;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libscca_check_file_header_wide(
+		          path_list->paths[ path_index ],
+		          error );
+#else
+		result = libscca_check_file_header(
+		          path_list->paths[ path_index ],
+		          error );
+#endif
+		if( result == -1 )
+		{
+			/* A file that cannot be read is not a match
+			 */
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+		}
+		if( result != 1 )
+		{
+			memory_free(
+			 path_list->paths[ path_index ] );
+
+			path_list->paths[ path_index ] = NULL;
+
+			number_of_removed_paths++;
+		}
+		else if( number_of_removed_paths > 0 )
+		{
+			path_list->paths[ path_index - number_of_removed_paths ] = path_list->paths[ path_index ];
+			path_list->paths[ path_index ]                           = NULL;
+		}
+	}
+	/* The paths that were not checked due to an abort are kept
+	 */
+	while( ( number_of_removed_paths > 0 )
+	    && ( path_index < path_list->number_of_paths ) )
+	{
+		path_list->paths[ path_index - number_of_removed_paths ] = path_list->paths[ path_index ];
+		path_list->paths[ path_index ]                           = NULL;
+
+		path_index++;
+	}
+	path_list->number_of_paths -= number_of_removed_paths;
+
+	return( number_of_removed_paths );
+}
+
+/* Prints the file information of the paths one after the other
+ * In summary mode the values of every path are aggregated instead
+ * The progress handle is optional and is updated once per path
+ * The paths of files without a filename that matches the match string are skipped
+ * Returns the number of paths that failed or -1 on error
+ */
+int sccainfo_process_paths(
+     info_handle_t *info_handle,
+     summary_handle_t *summary_handle,
+     progress_handle_t *progress_handle,
+     path_list_t *path_list,
+     int print_source,
+     libcerror_error_t **error )
+{
+	static char *function    = "sccainfo_process_paths";
+	uint64_t number_of_bytes = 0;
+	int number_of_failures   = 0;
+	int path_index           = 0;
+	int result               = 0;
+
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		if( sccainfo_abort != 0 )
+		{
+			break;
+		}
+		/* With a match string or filter expression the source is printed once the file is known to match
+		 */
+		if( ( print_source != 0 )
+		 && ( info_handle->match_string == NULL )
+		 && ( info_handle->filter_expression == NULL ) )
+		{
+			fprintf(
+			 stdout,
+			 "Source: %" PRIs_SYSTEM "\n\n",
+			 path_list->paths[ path_index ] );
+		}
+		if( info_handle_open_input(
+		     info_handle,
+		     path_list->paths[ path_index ],
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open: %" PRIs_SYSTEM ".\n",
+			 path_list->paths[ path_index ] );
+
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+
+			number_of_failures++;
+
+			if( progress_handle != NULL )
+			{
+				if( progress_handle_update(
+				     progress_handle,
+				     1,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to update progress.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			continue;
+		}
+		result = info_handle_file_matches(
+		          info_handle,
+		          info_handle->input_file,
+		          error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to match filenames of: %" PRIs_SYSTEM ".\n",
+			 path_list->paths[ path_index ] );
+
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+
+			number_of_failures++;
+		}
+		else if( result != 0 )
+		{
+			if( ( print_source != 0 )
+			 && ( ( info_handle->match_string != NULL )
+			  ||  ( info_handle->filter_expression != NULL ) ) )
+			{
+				fprintf(
+				 stdout,
+				 "Source: %" PRIs_SYSTEM "\n\n",
+				 path_list->paths[ path_index ] );
+			}
+			if( summary_handle != NULL )
+			{
+				if( summary_handle_append_file(
+				     summary_handle,
+				     info_handle->input_file,
+				     error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read: %" PRIs_SYSTEM ".\n",
+					 path_list->paths[ path_index ] );
+
+					libcnotify_print_error_backtrace(
+					 *error );
+					libcerror_error_free(
+					 error );
+
+					number_of_failures++;
+				}
+			}
+			else if( info_handle_file_fprint(
+			          info_handle,
+			          error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print file information.\n" );
+
+				libcnotify_print_error_backtrace(
+				 *error );
+				libcerror_error_free(
+				 error );
+
+				number_of_failures++;
+			}
+		}
+		if( progress_handle != NULL )
+		{
+			if( libscca_file_get_statistic(
+			     info_handle->input_file,
+			     LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+			     &number_of_bytes,
+			     error ) != 1 )
+			{
+				libcerror_error_free(
+				 error );
+
+				number_of_bytes = 0;
+			}
+			if( progress_handle_update(
+			     progress_handle,
+			     1,
+			     number_of_bytes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( info_handle_close_input(
+		     info_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( number_of_failures );
+}
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Prints the file information of a prefetch member of an archive
+ * Callback function for archive_handle_read_members
+ * A member that cannot be parsed is reported and counted as failed so that
+ * the remaining members are read
+ * Returns 1 if successful or -1 on error
+ */
+int sccainfo_archive_member_callback(
+     const char *member_name,
+     const uint8_t *member_data,
+     size_t member_data_size,
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	sccainfo_archive_t *archive = NULL;
+	char *source_path           = NULL;
+	static char *function       = "sccainfo_archive_member_callback";
+	size_t archive_path_length  = 0;
+	size_t member_name_length   = 0;
+	int result                  = 0;
+
+	if( member_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member name.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback arguments.",
+		 function );
+
+		return( -1 );
+	}
+	archive = (sccainfo_archive_t *) callback_arguments;
+
+	/* The source of a member is the path of the archive followed by the name of the member
+	 */
+	archive_path_length = system_string_length(
+	                       archive->archive_path );
+
+	member_name_length = narrow_string_length(
+	                      member_name );
+
+	source_path = narrow_string_allocate(
+	               archive_path_length + member_name_length + 2 );
+
+	if( source_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_copy(
+	       source_path,
+	       archive->archive_path,
+	       archive_path_length ) == NULL )
+	 || ( memory_copy(
+	       &( source_path[ archive_path_length + 1 ] ),
+	       member_name,
+	       member_name_length ) == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source path.",
+		 function );
+
+		goto on_error;
+	}
+	source_path[ archive_path_length ] = '/';
+
+	source_path[ archive_path_length + member_name_length + 1 ] = 0;
+
+	if( ( archive->print_source != 0 )
+	 && ( archive->info_handle->match_string == NULL )
+	 && ( archive->info_handle->filter_expression == NULL ) )
+	{
+		fprintf(
+		 stdout,
+		 "Source: %s\n\n",
+		 source_path );
+	}
+	/* The member data remains valid until this function returns
+	 * hence the file is parsed from memory in place
+	 */
+	if( libscca_file_open_memory(
+	     archive->info_handle->input_file,
+	     member_data,
+	     member_data_size,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %s.\n",
+		 source_path );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+
+		archive->number_of_failures += 1;
+
+		memory_free(
+		 source_path );
+
+		return( 1 );
+	}
+	archive->info_handle->source_path = source_path;
+
+	result = info_handle_file_matches(
+	          archive->info_handle,
+	          archive->info_handle->input_file,
+	          error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to match filenames of: %s.\n",
+		 source_path );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+
+		archive->number_of_failures += 1;
+	}
+	else if( result != 0 )
+	{
+		if( ( archive->print_source != 0 )
+		 && ( ( archive->info_handle->match_string != NULL )
+		  ||  ( archive->info_handle->filter_expression != NULL ) ) )
+		{
+			fprintf(
+			 stdout,
+			 "Source: %s\n\n",
+			 source_path );
+		}
+		if( archive->summary_handle != NULL )
+		{
+			if( summary_handle_append_file(
+			     archive->summary_handle,
+			     archive->info_handle->input_file,
+			     error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read: %s.\n",
+				 source_path );
+
+				libcnotify_print_error_backtrace(
+				 *error );
+				libcerror_error_free(
+				 error );
+
+				archive->number_of_failures += 1;
+			}
+		}
+		else if( info_handle_file_fprint(
+		          archive->info_handle,
+		          error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print file information.\n" );
+
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+
+			archive->number_of_failures += 1;
+		}
+	}
+	if( info_handle_close_input(
+	     archive->info_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 source_path );
+
+	return( 1 );
+
+on_error:
+	if( source_path != NULL )
+	{
+		memory_free(
+		 source_path );
+	}
+	return( -1 );
+}
+
+/* Prints the file information of the prefetch members of the archives in the path list
+ * The members are decompressed into memory and parsed in place, hence the archives
+ * do not need to be extracted
+ * In summary mode the values of every member are aggregated instead
+ * The progress handle is optional and is updated once per archive
+ * Returns the number of archives and members that failed or -1 on error
+ */
+int sccainfo_process_archives(
+     info_handle_t *info_handle,
+     summary_handle_t *summary_handle,
+     progress_handle_t *progress_handle,
+     path_list_t *path_list,
+     int print_source,
+     libcerror_error_t **error )
+{
+	sccainfo_archive_t archive;
+
+	static char *function  = "sccainfo_process_archives";
+	uint64_t input_size    = 0;
+	int number_of_failures = 0;
+	int path_index         = 0;
+	int result             = 0;
+
+	if( memory_set(
+	     &archive,
+	     0,
+	     sizeof( sccainfo_archive_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear archive.",
+		 function );
+
+		return( -1 );
+	}
+	archive.info_handle    = info_handle;
+	archive.summary_handle = summary_handle;
+	archive.print_source   = print_source;
+
+	if( archive_handle_initialize(
+	     &sccainfo_archive_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize archive handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		if( sccainfo_abort != 0 )
+		{
+			break;
+		}
+		if( archive_handle_open_input(
+		     sccainfo_archive_handle,
+		     path_list->paths[ path_index ],
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open archive: %" PRIs_SYSTEM ".\n",
+			 path_list->paths[ path_index ] );
+
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+
+			number_of_failures++;
+
+			input_size = 0;
+		}
+		else
+		{
+			input_size = (uint64_t) sccainfo_archive_handle->input_size;
+
+			archive.archive_path       = path_list->paths[ path_index ];
+			archive.number_of_failures = 0;
+
+			result = archive_handle_read_members(
+			          sccainfo_archive_handle,
+			          &sccainfo_archive_member_callback,
+			          (void *) &archive,
+			          error );
+
+			/* The members read before an error in the archive are kept
+			 */
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read archive: %" PRIs_SYSTEM ".\n",
+				 path_list->paths[ path_index ] );
+
+				libcnotify_print_error_backtrace(
+				 *error );
+				libcerror_error_free(
+				 error );
+
+				number_of_failures++;
+			}
+			if( sccainfo_archive_handle->number_of_failed_members > 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read %d members of archive: %" PRIs_SYSTEM ".\n",
+				 sccainfo_archive_handle->number_of_failed_members,
+				 path_list->paths[ path_index ] );
+
+				number_of_failures += sccainfo_archive_handle->number_of_failed_members;
+			}
+			number_of_failures += archive.number_of_failures;
+
+			if( archive_handle_close_input(
+			     sccainfo_archive_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close archive.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( progress_handle != NULL )
+		{
+			if( progress_handle_update(
+			     progress_handle,
+			     1,
+			     input_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( archive_handle_free(
+	     &sccainfo_archive_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free archive handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( number_of_failures );
+
+on_error:
+	if( sccainfo_archive_handle != NULL )
+	{
+		archive_handle_free(
+		 &sccainfo_archive_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the file information of a prefetch file in an image
+ * The line of the extents file defines the extents of the file in the image
+ * A file that cannot be parsed is reported and counted as failed so that
+ * the remaining files are read
+ * Returns 1 if successful, 0 if the file failed or -1 on error
+ */
+int sccainfo_image_file_fprint(
+     info_handle_t *info_handle,
+     summary_handle_t *summary_handle,
+     image_handle_t *image_handle,
+     const char *line,
+     size_t line_length,
+     int print_source,
+     libcerror_error_t **error )
+{
+	image_io_handle_t *image_io_handle = NULL;
+	libbfio_handle_t *file_io_handle   = NULL;
+	const char *source_path            = NULL;
+	static char *function              = "sccainfo_image_file_fprint";
+	size_t name_index                  = 0;
+	int result                         = 1;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_io_handle_initialize(
+	     &image_io_handle,
+	     image_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize image IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( image_io_handle_parse_extents_line(
+	     image_io_handle,
+	     line,
+	     line_length,
+	     &name_index,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to parse extents: %s.\n",
+		 line );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+
+		image_io_handle_free(
+		 &image_io_handle,
+		 NULL );
+
+		return( 0 );
+	}
+	/* The source of a file is its name in the extents file
+	 */
+	source_path = &( line[ name_index ] );
+
+	if( image_io_handle_initialize_file_io_handle(
+	     &file_io_handle,
+	     &image_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( print_source != 0 )
+	 && ( info_handle->match_string == NULL )
+	 && ( info_handle->filter_expression == NULL ) )
+	{
+		fprintf(
+		 stdout,
+		 "Source: %s\n\n",
+		 source_path );
+	}
+	if( libscca_file_open_file_io_handle(
+	     info_handle->input_file,
+	     file_io_handle,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %s.\n",
+		 source_path );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+
+		return( 0 );
+	}
+	info_handle->source_path = source_path;
+
+	result = info_handle_file_matches(
+	          info_handle,
+	          info_handle->input_file,
+	          error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to match filenames of: %s.\n",
+		 source_path );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	else if( result != 0 )
+	{
+		if( ( print_source != 0 )
+		 && ( ( info_handle->match_string != NULL )
+		  ||  ( info_handle->filter_expression != NULL ) ) )
+		{
+			fprintf(
+			 stdout,
+			 "Source: %s\n\n",
+			 source_path );
+		}
+		result = 1;
+
+		if( summary_handle != NULL )
+		{
+			if( summary_handle_append_file(
+			     summary_handle,
+			     info_handle->input_file,
+			     error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read: %s.\n",
+				 source_path );
+
+				libcnotify_print_error_backtrace(
+				 *error );
+				libcerror_error_free(
+				 error );
+
+				result = 0;
+			}
+		}
+		else if( info_handle_file_fprint(
+		          info_handle,
+		          error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print file information.\n" );
+
+			libcnotify_print_error_backtrace(
+			 *error );
+			libcerror_error_free(
+			 error );
+
+			result = 0;
+		}
+	}
+	else
+	{
+		result = 1;
+	}
+	if( info_handle_close_input(
+	     info_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file is not managed by the input file, hence it is freed after the input file is closed
+	 */
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_io_handle != NULL )
+	{
+		image_io_handle_free(
+		 &image_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints the file information of the prefetch files in a storage media image
+ * The sources are extents files that contain one line per prefetch file with
+ * the extents of the file in the image, for example as determined by walking
+ * the MFT of an NTFS volume, hence the files do not need to be extracted
+ * Empty lines and lines that start with # are ignored
+ * The files share the block cache of the image handle, so that clusters that
+ * are adjacent in the image are read with a single read
+ * In summary mode the values of every file are aggregated instead
+ * The progress handle is optional and is updated once per extents file
+ * Returns the number of extents files and prefetch files that failed or -1 on error
+ */
+int sccainfo_process_image_extents(
+     info_handle_t *info_handle,
+     summary_handle_t *summary_handle,
+     progress_handle_t *progress_handle,
+     const system_character_t *image_path,
+     path_list_t *path_list,
+     int print_source,
+     libcerror_error_t **error )
+{
+	FILE *stream                 = NULL;
+	char *line                   = NULL;
+	image_handle_t *image_handle = NULL;
+	static char *function        = "sccainfo_process_image_extents";
+	uint64_t number_of_bytes     = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	uint64_t number_of_reads     = 0;
+	uint64_t previous_bytes      = 0;
+	size_t line_length           = 0;
+	size_t line_size             = 0;
+	int number_of_failures       = 0;
+	int path_index               = 0;
+	int result                   = 0;
+
+	if( path_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path list.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_handle_initialize(
+	     &image_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize image handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( image_handle_open(
+	     image_handle,
+	     image_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open image: %" PRIs_SYSTEM ".",
+		 function,
+		 image_path );
+
+		goto on_error;
+	}
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		if( sccainfo_abort != 0 )
+		{
+			break;
+		}
+		stream = file_stream_open(
+		          path_list->paths[ path_index ],
+		          "r" );
+
+		if( stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open extents file: %" PRIs_SYSTEM ".\n",
+			 path_list->paths[ path_index ] );
+
+			number_of_failures++;
+		}
+		else
+		{
+			while( sccainfo_abort == 0 )
+			{
+				result = image_io_handle_read_extents_line(
+				          stream,
+				          &line,
+				          &line_size,
+				          &line_length,
+				          error );
+
+				if( result == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to read extents file: %" PRIs_SYSTEM ".\n",
+					 path_list->paths[ path_index ] );
+
+					libcnotify_print_error_backtrace(
+					 *error );
+					libcerror_error_free(
+					 error );
+
+					number_of_failures++;
+
+					break;
+				}
+				else if( result == 0 )
+				{
+					break;
+				}
+				if( ( line_length == 0 )
+				 || ( line[ 0 ] == '#' ) )
+				{
+					continue;
+				}
+				result = sccainfo_image_file_fprint(
+				          info_handle,
+				          summary_handle,
+				          image_handle,
+				          line,
+				          line_length,
+				          print_source,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print file information.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					number_of_failures++;
+				}
+			}
+			if( file_stream_close(
+			     stream ) != 0 )
+			{
+				stream = NULL;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close extents file.",
+				 function );
+
+				goto on_error;
+			}
+			stream = NULL;
+		}
+		if( progress_handle != NULL )
+		{
+			if( image_handle_get_statistics(
+			     image_handle,
+			     &number_of_reads,
+			     &number_of_bytes,
+			     &number_of_hits,
+			     &number_of_misses,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve image statistics.",
+				 function );
+
+				goto on_error;
+			}
+			/* The progress is updated with the bytes read from the image since the previous update
+			 */
+			if( progress_handle_update(
+			     progress_handle,
+			     1,
+			     number_of_bytes - previous_bytes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update progress.",
+				 function );
+
+				goto on_error;
+			}
+			previous_bytes = number_of_bytes;
+		}
+	}
+	if( libcnotify_verbose != 0 )
+	{
+		if( image_handle_get_statistics(
+		     image_handle,
+		     &number_of_reads,
+		     &number_of_bytes,
+		     &number_of_hits,
+		     &number_of_misses,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve image statistics.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "Image: %" PRIu64 " reads of %" PRIu64 " bytes, %" PRIu64 " cached block hits and %" PRIu64 " misses.\n",
+		 number_of_reads,
+		 number_of_bytes,
+		 number_of_hits,
+		 number_of_misses );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+
+		line = NULL;
+	}
+	if( image_handle_close(
+	     image_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close image.",
+		 function );
+
+		goto on_error;
+	}
+	if( image_handle_free(
+	     &image_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free image handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( number_of_failures );
+
+on_error:
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	if( image_handle != NULL )
+	{
+		image_handle_close(
+		 image_handle,
+		 NULL );
+		image_handle_free(
+		 &image_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Watches a directory and prints the new runs of the changed prefetch files
+ * until abort is signalled
+ * Returns 1 if successful or -1 on error
+ */
+int sccainfo_watch_directory(
+     info_handle_t *info_handle,
+     const system_character_t *directory_path,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainfo_watch_directory";
+
+	if( watch_handle_initialize(
+	     &sccainfo_watch_handle,
+	     info_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( watch_handle_open(
+	     sccainfo_watch_handle,
+	     directory_path,
+	     WATCH_HANDLE_DEFAULT_DEBOUNCE_TIME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The watch mode runs until interrupted, hence the signal handler
+	 * is attached so that the watcher is freed on an interrupt
+	 */
+	if( sccatools_signal_attach(
+	     sccainfo_signal_handler,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+	}
+	/* An abort signalled before the watch handle was created
+	 */
+	if( sccainfo_abort != 0 )
+	{
+		sccainfo_watch_handle->abort = 1;
+	}
+	if( watch_handle_run(
+	     sccainfo_watch_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to run watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( sccatools_signal_detach(
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 *error );
+		libcerror_error_free(
+		 error );
+	}
+	if( watch_handle_free(
+	     &sccainfo_watch_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	sccatools_signal_detach(
+	 NULL );
+
+	if( sccainfo_watch_handle != NULL )
+	{
+		watch_handle_free(
+		 &sccainfo_watch_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	journal_handle_t *journal_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	metrics_handle_t *metrics_handle             = NULL;
+	path_list_t *path_list                       = NULL;
+	progress_handle_t *progress_handle           = NULL;
+	summary_handle_t *summary_handle             = NULL;
+	system_character_t *live_directory_path      = NULL;
+	system_character_t *option_bucket_width      = NULL;
+	system_character_t *option_compression       = NULL;
+	system_character_t *option_filter_expression = NULL;
+	system_character_t *option_image             = NULL;
+	system_character_t *option_journal_file      = NULL;
+	system_character_t *option_number_of_entries = NULL;
+	system_character_t *option_match_string      = NULL;
+	system_character_t *option_match_type        = NULL;
+	system_character_t *option_metrics_file      = NULL;
+	system_character_t *option_number_of_threads = NULL;
+	system_character_t *option_output_format     = NULL;
+	system_character_t *option_shard             = NULL;
+	system_character_t *option_watch_directory   = NULL;
+	char *program                                = "sccainfo";
+	size_t source_length                         = 0;
+	system_integer_t option                      = 0;
+	uint64_t bucket_width                        = 0;
+	int archive_mode                             = 0;
+	int argument_index                           = 0;
+	int compression_level                        = 0;
+	int live_mode                                = 0;
+	int number_of_entries                        = FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES;
+	int number_of_compression_threads            = 0;
+	int number_of_failures                       = 0;
+	int number_of_journaled_paths                = 0;
+	int number_of_shards                         = 1;
+	int number_of_sharded_paths                  = 0;
+	int number_of_threads                        = 1;
+	int number_of_triaged_paths                  = 0;
+	int print_source                             = 0;
+	int progress                                 = 0;
+	int recursive                                = 0;
+	int result                                   = 0;
+	int resume                                   = 0;
+	int shard_index                              = 0;
+	int summary                                  = 0;
+	int triage                                   = 0;
+	int verbose                                  = 0;
+	int verify_prefetch_hash                     = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "Ab:hHI:j:J:k:Lm:M:o:pP:rRsS:tvVw:x:z:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'A':
+				archive_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'b':
+				option_bucket_width = optarg;
+				summary             = 1;
+
+				break;
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'H':
+				verify_prefetch_hash = 1;
+
+				break;
+
+			case (system_integer_t) 'I':
+				option_image = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'J':
+				option_journal_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'k':
+				option_number_of_entries = optarg;
+				summary                  = 1;
+
+				break;
+
+			case (system_integer_t) 'L':
+				live_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'm':
+				option_match_string = optarg;
+
+				break;
+
+			case (system_integer_t) 'M':
+				option_match_type = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				progress = 1;
+
+				break;
+
+			case (system_integer_t) 'P':
+				option_metrics_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				recursive = 1;
+
+				break;
+
+			case (system_integer_t) 'R':
+				resume = 1;
+
+				break;
+
+			case (system_integer_t) 's':
+				summary = 1;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_shard = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				triage = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				option_watch_directory = optarg;
+
+				break;
+
+			case (system_integer_t) 'x':
+				option_filter_expression = optarg;
+
+				break;
+
+			case (system_integer_t) 'z':
+				option_compression = optarg;
+
+				break;
+		}
+	}
+	if( ( optind == argc )
+	 && ( option_watch_directory == NULL )
+	 && ( live_mode == 0 ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( option_number_of_threads != NULL )
+	{
+		result = sccainput_determine_number_of_threads(
+		          option_number_of_threads,
+		          &number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads defaulting to: 1.\n" );
+
+			number_of_threads = 1;
+		}
+	}
+	if( option_number_of_entries != NULL )
+	{
+		result = sccainput_determine_number_of_entries(
+		          option_number_of_entries,
+		          &number_of_entries,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine number of entries.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of entries defaulting to: %d.\n",
+			 FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES );
+
+			number_of_entries = FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES;
+		}
+	}
+	if( option_bucket_width != NULL )
+	{
+		result = sccainput_determine_bucket_width(
+		          option_bucket_width,
+		          &bucket_width,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine bucket width.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported bucket width.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_compression != NULL )
+	{
+		result = sccainput_determine_compression(
+		          option_compression,
+		          &compression_level,
+		          &number_of_compression_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine compression.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported compression.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_shard != NULL )
+	{
+		result = sccainput_determine_shard(
+		          option_shard,
+		          &shard_index,
+		          &number_of_shards,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine shard.\n" );
+
+			goto on_error;
+		}
+		/* Processing all sources in every shard would duplicate the records
+		 * hence an unsupported shard is not defaulted
+		 */
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported shard: %" PRIs_SYSTEM ", expected index/number of shards.\n",
+			 option_shard );
+
+			goto on_error;
+		}
+	}
+	/* In archive mode the sources are archives, hence they are not scanned
+	 * as directories or checked for a prefetch file header
+	 */
+	if( archive_mode != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Archive mode is not supported.\n" );
+
+		goto on_error;
+#else
+		recursive = 0;
+		triage    = 0;
+#endif
+	}
+	/* In image mode the sources are extents files, hence they are not scanned
+	 * as directories or checked for a prefetch file header
+	 */
+	if( option_image != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Image mode is not supported.\n" );
+
+		goto on_error;
+#else
+		if( archive_mode != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Image mode is not supported in archive mode.\n" );
+
+			goto on_error;
+		}
+		recursive = 0;
+		triage    = 0;
+#endif
+	}
+	/* In live collector mode the prefetch files of the running system are read
+	 * by the batch engine, which opens them with backup semantics
+	 */
+	if( live_mode != 0 )
+	{
+#if !defined( WINAPI ) || defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Live collector mode is not supported.\n" );
+
+		goto on_error;
+#else
+		if( ( archive_mode != 0 )
+		 || ( option_image != NULL )
+		 || ( option_watch_directory != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Live collector mode is not supported in archive, image or watch mode.\n" );
+
+			goto on_error;
+		}
+		result = sccatools_live_enable_backup_privilege(
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to enable backup privilege.\n" );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      && ( verbose != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Backup privilege is not held, only accessible prefetch files are read.\n" );
+		}
+		if( optind == argc )
+		{
+			if( sccatools_live_get_prefetch_directory_path(
+			     &live_directory_path,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to determine prefetch directory.\n" );
+
+				goto on_error;
+			}
+		}
+		recursive = 1;
+#endif
+	}
+	if( path_list_initialize(
+	     &path_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize path list.\n" );
+
+		goto on_error;
+	}
+	/* Carved files do not necessarily have the .pf extension
+	 */
+	if( triage != 0 )
+	{
+		path_list->all_files = 1;
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( ( recursive != 0 )
+		 && ( path_list_is_directory(
+		       argv[ argument_index ] ) == 1 ) )
+		{
+			result = path_list_append_directory(
+			          path_list,
+			          argv[ argument_index ],
+			          0,
+			          &error );
+		}
+		else
+		{
+			source_length = system_string_length(
+			                 argv[ argument_index ] );
+
+			result = path_list_append_path(
+			          path_list,
+			          argv[ argument_index ],
+			          source_length,
+			          &error );
+		}
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to add source: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+	}
+	if( live_directory_path != NULL )
+	{
+		if( path_list_append_directory(
+		     path_list,
+		     live_directory_path,
+		     0,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to add source: %" PRIs_SYSTEM ".\n",
+			 live_directory_path );
+
+			goto on_error;
+		}
+	}
+	/* A single source file is printed without a source header
+	 */
+	if( ( archive_mode != 0 )
+	 || ( option_image != NULL )
+	 || ( recursive != 0 )
+	 || ( path_list->number_of_paths > 1 ) )
+	{
+		print_source = 1;
+	}
+	/* The shard is selected before triage so that every process only reads
+	 * the headers of the sources of its own shard
+	 */
+	if( option_shard != NULL )
+	{
+		number_of_sharded_paths = path_list->number_of_paths;
+
+		if( path_list_select_shard(
+		     path_list,
+		     shard_index,
+		     number_of_shards,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to select shard.\n" );
+
+			goto on_error;
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Shard: %d of %d sources are part of shard %d/%d.\n",
+			 path_list->number_of_paths,
+			 number_of_sharded_paths,
+			 shard_index,
+			 number_of_shards );
+		}
+	}
+	/* The sources that were processed by the resumed run are removed before triage
+	 * so that their file headers are not read again
+	 */
+	if( option_journal_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Journal is not supported.\n" );
+
+		goto on_error;
+#else
+		if( ( archive_mode != 0 )
+		 || ( option_image != NULL )
+		 || ( option_watch_directory != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Journal is not supported in archive, image or watch mode.\n" );
+
+			goto on_error;
+		}
+		/* The summary of a resumed run would only contain the remaining sources
+		 */
+		if( ( summary != 0 )
+		 && ( verify_prefetch_hash == 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Journal is not supported in summary mode.\n" );
+
+			goto on_error;
+		}
+		if( journal_handle_initialize(
+		     &journal_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize journal handle.\n" );
+
+			goto on_error;
+		}
+		if( journal_handle_open(
+		     journal_handle,
+		     option_journal_file,
+		     (uint8_t) resume,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open journal: %" PRIs_SYSTEM ".\n",
+			 option_journal_file );
+
+			goto on_error;
+		}
+		number_of_journaled_paths = path_list->number_of_paths;
+
+		if( sccainfo_remove_journaled_paths(
+		     journal_handle,
+		     path_list,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to remove journaled sources.\n" );
+
+			goto on_error;
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Journal: %d of %d sources were already processed.\n",
+			 number_of_journaled_paths - path_list->number_of_paths,
+			 number_of_journaled_paths );
+		}
+#endif
+	}
+	else if( resume != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Resume requires a journal file.\n" );
+
+		goto on_error;
+	}
+	if( triage != 0 )
+	{
+		number_of_triaged_paths = path_list->number_of_paths;
+
+		if( sccainfo_triage_paths(
+		     path_list,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to triage sources.\n" );
+
+			goto on_error;
+		}
+		if( verbose != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Triage: %d of %d sources contain a prefetch file header.\n",
+			 path_list->number_of_paths,
+			 number_of_triaged_paths );
+		}
+	}
+	if( info_handle_initialize(
+	     &sccainfo_info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize info handle.\n" );
+
+		goto on_error;
+	}
+	if( option_output_format != NULL )
+	{
+		result = info_handle_set_output_format(
+		          sccainfo_info_handle,
+		          option_output_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set output format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported output format defaulting to: text.\n" );
+		}
+	}
+	if( option_match_string != NULL )
+	{
+		if( info_handle_set_match_string(
+		     sccainfo_info_handle,
+		     option_match_string,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set match string.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_filter_expression != NULL )
+	{
+		if( info_handle_set_filter_expression(
+		     sccainfo_info_handle,
+		     option_filter_expression,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set filter expression.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_match_type != NULL )
+	{
+		result = info_handle_set_match_type(
+		          sccainfo_info_handle,
+		          option_match_type,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set match type.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported match type defaulting to: substring.\n" );
+		}
+	}
+	/* In watch mode the sources are ignored and only JSON Lines records are printed
+	 */
+	if( option_watch_directory != NULL )
+	{
+		sccainfo_info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_JSONL;
+
+		print_source = 0;
+		progress     = 0;
+		summary      = 0;
+	}
+	/* In prefetch hash verification mode one record is printed per source
+	 * that contains the source, hence the source header is not printed
+	 */
+	if( ( verify_prefetch_hash != 0 )
+	 && ( option_watch_directory == NULL ) )
+	{
+		if( ( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_ARROW )
+		 || ( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_BODYFILE )
+		 || ( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_SQL ) )
+		{
+			sccainfo_info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+		}
+		sccainfo_info_handle->verify_prefetch_hash = 1;
+
+		print_source = 0;
+		summary      = 0;
+	}
+	/* In summary mode the output format is ignored and only the summary is printed
+	 */
+	if( summary != 0 )
+	{
+		if( summary_handle_initialize(
+		     &summary_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize summary handle.\n" );
+
+			goto on_error;
+		}
+		if( option_number_of_entries != NULL )
+		{
+			if( summary_handle_set_filenames_sketch(
+			     summary_handle,
+			     number_of_entries,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set filenames sketch.\n" );
+
+				goto on_error;
+			}
+		}
+		if( option_bucket_width != NULL )
+		{
+			if( summary_handle_set_run_time_bucket_width(
+			     summary_handle,
+			     bucket_width,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set run time bucket width.\n" );
+
+				goto on_error;
+			}
+		}
+		sccainfo_info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+
+		print_source = 0;
+	}
+	/* The version is not printed in the CSV and JSON Lines output formats
+	 * so that the output only consists of records
+	 */
+	if( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	else
+	{
+		print_source = 0;
+	}
+	/* The compressed output is written as gzip members to stdout
+	 * the watch mode writes its records directly and is not compressed
+	 */
+	if( option_compression != NULL )
+	{
+		if( ( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_TEXT )
+		 || ( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_ARROW )
+		 || ( option_watch_directory != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Compression requires the csv, jsonl, bodyfile or sql output format.\n" );
+
+			goto on_error;
+		}
+#if defined( WINAPI )
+		_setmode(
+		 _fileno(
+		  stdout ),
+		 _O_BINARY );
+#endif
+		if( info_handle_gzip_writer_open(
+		     sccainfo_info_handle,
+		     stdout,
+		     compression_level,
+		     number_of_compression_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open gzip writer.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The output of a resumed run is appended to the output of the previous run
+	 * which already contains the CSV header
+	 */
+	if( ( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+	 && ( ( journal_handle == NULL )
+	  ||  ( resume == 0 )
+	  ||  ( journal_handle->number_of_hashes == 0 ) ) )
+	{
+		if( info_handle_csv_header_fprint(
+		     sccainfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print CSV header.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The SQL output format is a script for the sqlite3 shell that loads
+	 * all records in a single transaction
+	 */
+	if( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_SQL )
+	{
+		if( info_handle_sql_header_fprint(
+		     sccainfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print SQL header.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The Arrow output format writes a binary stream of record batches to stdout
+	 */
+	if( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_ARROW )
+	{
+#if defined( WINAPI )
+		_setmode(
+		 _fileno(
+		  stdout ),
+		 _O_BINARY );
+#endif
+		if( info_handle_arrow_writer_open(
+		     sccainfo_info_handle,
+		     stdout,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open Arrow writer.\n" );
+
+			goto on_error;
+		}
+	}
+	/* The metrics are collected by the batch engine, which also processes
+	 * the sources of a single thread when metrics are requested
+	 */
+	if( option_metrics_file != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Metrics are not supported.\n" );
+
+		goto on_error;
+#else
+		if( ( archive_mode != 0 )
+		 || ( option_image != NULL )
+		 || ( option_watch_directory != NULL ) )
+		{
+			fprintf(
+			 stderr,
+			 "Metrics are not supported in archive, image or watch mode.\n" );
+
+			goto on_error;
+		}
+		if( metrics_handle_initialize(
+		     &metrics_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize metrics handle.\n" );
+
+			goto on_error;
+		}
+#endif
+	}
+	if( progress != 0 )
+	{
+		if( progress_handle_initialize(
+		     &progress_handle,
+		     stderr,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize progress handle.\n" );
+
+			goto on_error;
+		}
+		if( progress_handle_start(
+		     progress_handle,
+		     path_list->number_of_paths,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to start progress handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_watch_directory != NULL )
+	{
+		if( sccainfo_watch_directory(
+		     sccainfo_info_handle,
+		     option_watch_directory,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to watch directory: %" PRIs_SYSTEM ".\n",
+			 option_watch_directory );
+
+			goto on_error;
+		}
+	}
+	else
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( archive_mode != 0 )
+	{
+		number_of_failures = sccainfo_process_archives(
+		                      sccainfo_info_handle,
+		                      summary_handle,
+		                      progress_handle,
+		                      path_list,
+		                      print_source,
+		                      &error );
+	}
+	else if( option_image != NULL )
+	{
+		number_of_failures = sccainfo_process_image_extents(
+		                      sccainfo_info_handle,
+		                      summary_handle,
+		                      progress_handle,
+		                      option_image,
+		                      path_list,
+		                      print_source,
+		                      &error );
+	}
+	else if( ( ( number_of_threads > 1 )
+	        && ( path_list->number_of_paths > 1 ) )
+	      || ( metrics_handle != NULL )
+	      || ( journal_handle != NULL )
+	      || ( live_mode != 0 ) )
+	{
+		number_of_failures = sccainfo_process_paths_threaded(
+		                      sccainfo_info_handle,
+		                      summary_handle,
+		                      progress_handle,
+		                      metrics_handle,
+		                      option_metrics_file,
+		                      journal_handle,
+		                      path_list,
+		                      number_of_threads,
+		                      print_source,
+		                      &error );
+	}
+	else
+#endif
+	{
+		number_of_failures = sccainfo_process_paths(
+		                      sccainfo_info_handle,
+		                      summary_handle,
+		                      progress_handle,
+		                      path_list,
+		                      print_source,
+		                      &error );
+	}
+	if( number_of_failures == -1 )
+	{
+		fprintf(
 		 stderr,
 		 "Unable to print file information.\n" );
 
 		goto on_error;
 	}
-	if( info_handle_close_input(
+	if( progress_handle != NULL )
+	{
+		if( progress_handle_stop(
+		     progress_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to stop progress handle.\n" );
+
+			goto on_error;
+		}
+		if( progress_handle_free(
+		     &progress_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free progress handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( metrics_handle != NULL )
+	{
+		if( metrics_handle_free(
+		     &metrics_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free metrics handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( journal_handle != NULL )
+	{
+		if( journal_handle_close(
+		     journal_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close journal.\n" );
+
+			goto on_error;
+		}
+		if( journal_handle_free(
+		     &journal_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free journal handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( summary_handle != NULL )
+	{
+		if( sccainfo_abort == 0 )
+		{
+			if( summary_handle_fprint(
+			     summary_handle,
+			     stdout,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print summary.\n" );
+
+				goto on_error;
+			}
+		}
+		if( summary_handle_free(
+		     &summary_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free summary handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( sccainfo_info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_SQL )
+	{
+		if( info_handle_sql_footer_fprint(
+		     sccainfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print SQL footer.\n" );
+
+			goto on_error;
+		}
+	}
+	if( info_handle_arrow_writer_close(
+	     sccainfo_info_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close Arrow writer.\n" );
+
+		goto on_error;
+	}
+	if( info_handle_gzip_writer_close(
 	     sccainfo_info_handle,
-	     &error ) != 0 )
+	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close info handle.\n" );
+		 "Unable to close gzip writer.\n" );
 
 		goto on_error;
 	}
@@ -265,6 +3577,29 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( path_list_free(
+	     &path_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free path list.\n" );
+
+		goto on_error;
+	}
+	if( live_directory_path != NULL )
+	{
+		memory_free(
+		 live_directory_path );
+	}
+	/* The watch mode is stopped by an interrupt, hence it is not a failure
+	 */
+	if( ( number_of_failures > 0 )
+	 || ( ( sccainfo_abort != 0 )
+	  && ( option_watch_directory == NULL ) ) )
+	{
+		return( EXIT_FAILURE );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -275,12 +3610,47 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( progress_handle != NULL )
+	{
+		progress_handle_free(
+		 &progress_handle,
+		 NULL );
+	}
+	if( metrics_handle != NULL )
+	{
+		metrics_handle_free(
+		 &metrics_handle,
+		 NULL );
+	}
+	if( journal_handle != NULL )
+	{
+		journal_handle_free(
+		 &journal_handle,
+		 NULL );
+	}
+	if( summary_handle != NULL )
+	{
+		summary_handle_free(
+		 &summary_handle,
+		 NULL );
+	}
 	if( sccainfo_info_handle != NULL )
 	{
 		info_handle_free(
 		 &sccainfo_info_handle,
 		 NULL );
 	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	if( live_directory_path != NULL )
+	{
+		memory_free(
+		 live_directory_path );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -356,3 +356,531 @@ int sccainput_determine_ascii_codepage(
 	return( result );
 }
 
+
+/* Determines the number of threads from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int sccainput_determine_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainput_determine_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int value             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 3 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( value < 1 )
+	 || ( value > SCCAINPUT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( 0 );
+	}
+	*number_of_threads = value;
+
+	return( 1 );
+}
+
+/* Determines the alignment from a string
+ * The alignment must be a power of 2 between 1 and SCCAINPUT_MAXIMUM_ALIGNMENT
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int sccainput_determine_alignment(
+     const system_character_t *string,
+     size_t *alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainput_determine_alignment";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	size_t value          = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid alignment.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 5 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (size_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( value < 1 )
+	 || ( value > SCCAINPUT_MAXIMUM_ALIGNMENT )
+	 || ( ( value & ( value - 1 ) ) != 0 ) )
+	{
+		return( 0 );
+	}
+	*alignment = value;
+
+	return( 1 );
+}
+
+/* Determines the number of reported entries from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int sccainput_determine_number_of_entries(
+     const system_character_t *string,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainput_determine_number_of_entries";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int value             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 5 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( value < 1 )
+	 || ( value > SCCAINPUT_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		return( 0 );
+	}
+	*number_of_entries = value;
+
+	return( 1 );
+}
+
+/* Determines the bucket width in seconds from a string
+ * The string contains a number of seconds or a number followed by
+ * an s (seconds), m (minutes), h (hours) or d (days) suffix, for example 1h
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int sccainput_determine_bucket_width(
+     const system_character_t *string,
+     uint64_t *bucket_width,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainput_determine_bucket_width";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	uint64_t multiplier   = 1;
+	uint64_t value        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( bucket_width == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bucket width.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 10 ) )
+	{
+		return( 0 );
+	}
+	switch( string[ string_length - 1 ] )
+	{
+		case (system_character_t) 's':
+			multiplier = 1;
+			break;
+
+		case (system_character_t) 'm':
+			multiplier = 60;
+			break;
+
+		case (system_character_t) 'h':
+			multiplier = 60 * 60;
+			break;
+
+		case (system_character_t) 'd':
+			multiplier = 24 * 60 * 60;
+			break;
+
+		default:
+			multiplier = 0;
+			break;
+	}
+	if( multiplier != 0 )
+	{
+		string_length -= 1;
+	}
+	else
+	{
+		multiplier = 1;
+	}
+	if( string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		value *= 10;
+		value += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( ( value < 1 )
+	 || ( value > ( SCCAINPUT_MAXIMUM_BUCKET_WIDTH / multiplier ) ) )
+	{
+		return( 0 );
+	}
+	*bucket_width = value * multiplier;
+
+	return( 1 );
+}
+
+/* Determines the shard from a string
+ * The string is formatted as "index/number", for example 0/4 is the first
+ * of 4 shards
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int sccainput_determine_shard(
+     const system_character_t *string,
+     int *shard_index,
+     int *number_of_shards,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainput_determine_shard";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int index_value       = 0;
+	int number_of_digits  = 0;
+	int number_value      = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( shard_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of shards.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( string[ string_index ] == (system_character_t) '/' )
+		{
+			break;
+		}
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' )
+		 || ( number_of_digits >= 5 ) )
+		{
+			return( 0 );
+		}
+		index_value *= 10;
+		index_value += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		number_of_digits++;
+	}
+	if( ( number_of_digits == 0 )
+	 || ( string_index >= string_length ) )
+	{
+		return( 0 );
+	}
+	number_of_digits = 0;
+
+	for( string_index += 1;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' )
+		 || ( number_of_digits >= 5 ) )
+		{
+			return( 0 );
+		}
+		number_value *= 10;
+		number_value += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		number_of_digits++;
+	}
+	if( ( number_of_digits == 0 )
+	 || ( number_value < 1 )
+	 || ( number_value > SCCAINPUT_MAXIMUM_NUMBER_OF_SHARDS )
+	 || ( index_value >= number_value ) )
+	{
+		return( 0 );
+	}
+	*shard_index      = index_value;
+	*number_of_shards = number_value;
+
+	return( 1 );
+}
+
+/* Determines the compression from a string
+ * The string is formatted as "method[:level[:threads]]", for example gzip:9:4
+ * compresses with gzip at level 9 in 4 threads, where gzip is the only supported method
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int sccainput_determine_compression(
+     const system_character_t *string,
+     int *compression_level,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "sccainput_determine_compression";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int level_value       = SCCAINPUT_DEFAULT_COMPRESSION_LEVEL;
+	int number_of_digits  = 0;
+	int threads_value     = SCCAINPUT_DEFAULT_NUMBER_OF_COMPRESSION_THREADS;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compression level.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length < 4 )
+	{
+		return( 0 );
+	}
+	if( system_string_compare(
+	     string,
+	     _SYSTEM_STRING( "gzip" ),
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	string_index = 4;
+
+	if( string_index < string_length )
+	{
+		if( ( string[ string_index ] != (system_character_t) ':' )
+		 || ( ( string_index + 1 ) >= string_length ) )
+		{
+			return( 0 );
+		}
+		string_index += 1;
+
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		level_value = (int) ( string[ string_index ] - (system_character_t) '0' );
+
+		string_index += 1;
+	}
+	if( string_index < string_length )
+	{
+		if( ( string[ string_index ] != (system_character_t) ':' )
+		 || ( ( string_index + 1 ) >= string_length ) )
+		{
+			return( 0 );
+		}
+		threads_value = 0;
+
+		for( string_index += 1;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			if( ( string[ string_index ] < (system_character_t) '0' )
+			 || ( string[ string_index ] > (system_character_t) '9' )
+			 || ( number_of_digits >= 3 ) )
+			{
+				return( 0 );
+			}
+			threads_value *= 10;
+			threads_value += (int) ( string[ string_index ] - (system_character_t) '0' );
+
+			number_of_digits++;
+		}
+		if( threads_value > SCCAINPUT_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	*compression_level = level_value;
+	*number_of_threads = threads_value;
+
+	return( 1 );
+}
+
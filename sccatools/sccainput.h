@@ -31,11 +31,68 @@
 extern "C" {
 #endif
 
+/* The maximum number of worker threads
+ */
+#define SCCAINPUT_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum alignment
+ */
+#define SCCAINPUT_MAXIMUM_ALIGNMENT		65536
+
+/* The maximum number of reported entries
+ */
+#define SCCAINPUT_MAXIMUM_NUMBER_OF_ENTRIES	65536
+
+/* The maximum number of shards
+ */
+#define SCCAINPUT_MAXIMUM_NUMBER_OF_SHARDS	65536
+
+/* The maximum bucket width in seconds, which is 3650 days
+ */
+#define SCCAINPUT_MAXIMUM_BUCKET_WIDTH		315360000UL
+
+/* The default compression level and number of compression threads
+ */
+#define SCCAINPUT_DEFAULT_COMPRESSION_LEVEL	6
+#define SCCAINPUT_DEFAULT_NUMBER_OF_COMPRESSION_THREADS	1
+
 int sccainput_determine_ascii_codepage(
      const system_character_t *string,
      int *ascii_codepage,
      libcerror_error_t **error );
 
+int sccainput_determine_number_of_threads(
+     const system_character_t *string,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int sccainput_determine_alignment(
+     const system_character_t *string,
+     size_t *alignment,
+     libcerror_error_t **error );
+
+int sccainput_determine_number_of_entries(
+     const system_character_t *string,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int sccainput_determine_bucket_width(
+     const system_character_t *string,
+     uint64_t *bucket_width,
+     libcerror_error_t **error );
+
+int sccainput_determine_shard(
+     const system_character_t *string,
+     int *shard_index,
+     int *number_of_shards,
+     libcerror_error_t **error );
+
+int sccainput_determine_compression(
+     const system_character_t *string,
+     int *compression_level,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,344 @@
+/*
+ * Merges the sorted CSV or JSON Lines output of sharded sccainfo runs
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "merge_handle.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+
+merge_handle_t *sccamerge_merge_handle = NULL;
+int sccamerge_abort                    = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use sccamerge to merge the CSV or JSON Lines output of\n"
+	                 "sccainfo shards, which is sorted by source, into a single\n"
+	                 "output sorted by source.\n\n" );
+
+	fprintf( stream, "Usage: sccamerge [ -hvV ] inputs\n\n" );
+
+	fprintf( stream, "\tinputs:  one or more files with the csv or jsonl output of\n"
+	                 "\t         sccainfo -S\n\n" );
+
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-v:      verbose output to stderr\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+/* Signal handler for sccamerge
+ */
+void sccamerge_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "sccamerge_signal_handler";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccamerge_abort = 1;
+
+	if( sccamerge_merge_handle != NULL )
+	{
+		if( merge_handle_signal_abort(
+		     sccamerge_merge_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal merge handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	char *program            = "sccamerge";
+	system_integer_t option  = 0;
+	int argument_index       = 0;
+	int verbose              = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	/* The output only consists of records, hence it is fully buffered
+	 */
+	if( sccatools_output_initialize(
+	     _IOFBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing input file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( merge_handle_initialize(
+	     &sccamerge_merge_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize merge handle.\n" );
+
+		goto on_error;
+	}
+	for( argument_index = optind;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( merge_handle_open_input(
+		     sccamerge_merge_handle,
+		     argv[ argument_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open input: %" PRIs_SYSTEM ".\n",
+			 argv[ argument_index ] );
+
+			goto on_error;
+		}
+	}
+	if( sccatools_signal_attach(
+	     sccamerge_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle_merge(
+	     sccamerge_merge_handle,
+	     stdout,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to merge inputs.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( verbose != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Merged %" PRIu64 " record(s) of %d input(s).\n",
+		 sccamerge_merge_handle->number_of_records,
+		 sccamerge_merge_handle->number_of_inputs );
+	}
+	if( merge_handle_free(
+	     &sccamerge_merge_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free merge handle.\n" );
+
+		goto on_error;
+	}
+	if( fflush(
+	     stdout ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write output.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	if( sccamerge_abort != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	sccatools_signal_detach(
+	 NULL );
+
+	if( sccamerge_merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &sccamerge_merge_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,665 @@
+/*
+ * Builds and queries packs of many Windows Prefetch Files (PF)
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "info_handle.h"
+#include "pack_handle.h"
+#include "path_list.h"
+#include "sccatools_getopt.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libclocale.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "sccatools_output.h"
+#include "sccatools_signal.h"
+#include "sccatools_unused.h"
+
+pack_handle_t *sccapack_pack_handle = NULL;
+int sccapack_abort                  = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use sccapack to store many Windows Prefetch Files (PF) in\n"
+	                 "a single pack file and to query a file from the pack.\n\n" );
+
+	fprintf( stream, "Usage: sccapack [ -H host ] [ -l ] [ -o format ] [ -q path ]\n"
+	                 "                [ -hrvV ] pack [ sources ]\n\n" );
+
+	fprintf( stream, "\tpack:    the pack file, which is created from the sources\n"
+	                 "\t         when provided\n" );
+	fprintf( stream, "\tsources: one or more source files or, in combination\n"
+	                 "\t         with -r, directories\n\n" );
+
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-H:      the host of the sources, which together with the\n"
+	                 "\t         path of a source forms its key in the pack\n" );
+	fprintf( stream, "\t-l:      list the host, path and prefetch hash of the\n"
+	                 "\t         files in the pack\n" );
+	fprintf( stream, "\t-o:      output format of -q, options: text (default),\n"
+	                 "\t         csv, jsonl, bodyfile, sql\n" );
+	fprintf( stream, "\t-q:      query the pack for the file with the path, as\n"
+	                 "\t         provided when the pack was created, and print\n"
+	                 "\t         its information\n" );
+	fprintf( stream, "\t-r:      add the prefetch files in the source directories\n"
+	                 "\t         and their sub directories\n" );
+	fprintf( stream, "\t-v:      verbose output to stderr\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+/* Signal handler for sccapack
+ */
+void sccapack_signal_handler(
+      sccatools_signal_t signal SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "sccapack_signal_handler";
+
+	SCCATOOLS_UNREFERENCED_PARAMETER( signal )
+
+	sccapack_abort = 1;
+
+	if( sccapack_pack_handle != NULL )
+	{
+		if( pack_handle_signal_abort(
+		     sccapack_pack_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal pack handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                 = NULL;
+	info_handle_t *info_handle               = NULL;
+	path_list_t *path_list                   = NULL;
+	system_character_t *option_host          = NULL;
+	system_character_t *option_output_format = NULL;
+	system_character_t *option_query         = NULL;
+	system_character_t *pack_path            = NULL;
+	char *program                            = "sccapack";
+	system_integer_t option                  = 0;
+	size_t source_length                     = 0;
+	int argument_index                       = 0;
+	int list_files                           = 0;
+	int path_index                           = 0;
+	int recursive                            = 0;
+	int result                               = 0;
+	int verbose                              = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "sccatools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( sccatools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	while( ( option = sccatools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hH:lo:q:rvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'H':
+				option_host = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				list_files = 1;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_output_format = optarg;
+
+				break;
+
+			case (system_integer_t) 'q':
+				option_query = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				recursive = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				sccatools_output_version_fprint(
+				 stdout,
+				 program );
+
+				sccatools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing pack file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	pack_path = argv[ optind ];
+
+	if( ( option_query == NULL )
+	 && ( list_files == 0 )
+	 && ( ( optind + 1 ) == argc ) )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing sources, list or query.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	/* The output of a query is printed without the version so that it can be processed
+	 */
+	if( option_query == NULL )
+	{
+		sccatools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libscca_notify_set_stream(
+	 stderr,
+	 NULL );
+	libscca_notify_set_verbose(
+	 verbose );
+
+	if( pack_handle_initialize(
+	     &sccapack_pack_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize pack handle.\n" );
+
+		goto on_error;
+	}
+	if( option_host != NULL )
+	{
+		if( pack_handle_set_host(
+		     sccapack_pack_handle,
+		     option_host,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set host.\n" );
+
+			goto on_error;
+		}
+	}
+	if( sccatools_signal_attach(
+	     sccapack_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( optind + 1 ) < argc )
+	{
+		if( path_list_initialize(
+		     &path_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize path list.\n" );
+
+			goto on_error;
+		}
+		for( argument_index = optind + 1;
+		     argument_index < argc;
+		     argument_index++ )
+		{
+			if( ( recursive != 0 )
+			 && ( path_list_is_directory(
+			       argv[ argument_index ] ) == 1 ) )
+			{
+				result = path_list_append_directory(
+				          path_list,
+				          argv[ argument_index ],
+				          0,
+				          &error );
+			}
+			else
+			{
+				source_length = system_string_length(
+				                 argv[ argument_index ] );
+
+				result = path_list_append_path(
+				          path_list,
+				          argv[ argument_index ],
+				          source_length,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to add source: %" PRIs_SYSTEM ".\n",
+				 argv[ argument_index ] );
+
+				goto on_error;
+			}
+		}
+		if( pack_handle_open_output(
+		     sccapack_pack_handle,
+		     pack_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create pack: %" PRIs_SYSTEM ".\n",
+			 pack_path );
+
+			goto on_error;
+		}
+		for( path_index = 0;
+		     path_index < path_list->number_of_paths;
+		     path_index++ )
+		{
+			if( sccapack_abort != 0 )
+			{
+				break;
+			}
+			result = pack_handle_append_source(
+			          sccapack_pack_handle,
+			          path_list->paths[ path_index ],
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to pack source: %" PRIs_SYSTEM ".\n",
+				 path_list->paths[ path_index ] );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open source: %" PRIs_SYSTEM " or source already packed, skipping.\n",
+				 path_list->paths[ path_index ] );
+			}
+		}
+		if( path_list_free(
+		     &path_list,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free path list.\n" );
+
+			goto on_error;
+		}
+		if( sccapack_abort == 0 )
+		{
+			if( pack_handle_close_output(
+			     sccapack_pack_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write pack: %" PRIs_SYSTEM ".\n",
+				 pack_path );
+
+				goto on_error;
+			}
+			fprintf(
+			 stdout,
+			 "Packed %d file(s), skipped %d file(s).\n",
+			 sccapack_pack_handle->number_of_files_appended,
+			 sccapack_pack_handle->number_of_files_skipped );
+		}
+	}
+	if( ( ( list_files != 0 )
+	  ||  ( option_query != NULL ) )
+	 && ( sccapack_abort == 0 ) )
+	{
+		if( pack_handle_open_pack(
+		     sccapack_pack_handle,
+		     pack_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open pack: %" PRIs_SYSTEM ".\n",
+			 pack_path );
+
+			goto on_error;
+		}
+	}
+	if( ( list_files != 0 )
+	 && ( sccapack_abort == 0 ) )
+	{
+		if( pack_handle_list_fprint(
+		     sccapack_pack_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to list pack.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( option_query != NULL )
+	 && ( sccapack_abort == 0 ) )
+	{
+		if( info_handle_initialize(
+		     &info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize info handle.\n" );
+
+			goto on_error;
+		}
+		if( option_output_format != NULL )
+		{
+			result = info_handle_set_output_format(
+			          info_handle,
+			          option_output_format,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to set output format.\n" );
+
+				goto on_error;
+			}
+			/* The Arrow output format requires a stream of record batches
+			 */
+			else if( ( result == 0 )
+			      || ( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_ARROW ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported output format defaulting to: text.\n" );
+
+				info_handle->output_format = INFO_HANDLE_OUTPUT_FORMAT_TEXT;
+			}
+		}
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_CSV )
+		{
+			if( info_handle_csv_header_fprint(
+			     info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print CSV header.\n" );
+
+				goto on_error;
+			}
+		}
+		else if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_SQL )
+		{
+			if( info_handle_sql_header_fprint(
+			     info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print SQL header.\n" );
+
+				goto on_error;
+			}
+		}
+		result = pack_handle_query_fprint(
+		          sccapack_pack_handle,
+		          info_handle,
+		          option_query,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to query pack.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "No such file in pack: %" PRIs_SYSTEM "\n",
+			 option_query );
+		}
+		if( info_handle->output_format == INFO_HANDLE_OUTPUT_FORMAT_SQL )
+		{
+			if( info_handle_sql_footer_fprint(
+			     info_handle,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to print SQL footer.\n" );
+
+				goto on_error;
+			}
+		}
+		if( info_handle_free(
+		     &info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( sccatools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( pack_handle_free(
+	     &sccapack_pack_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free pack handle.\n" );
+
+		goto on_error;
+	}
+	if( sccapack_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	if( sccapack_pack_handle != NULL )
+	{
+		pack_handle_free(
+		 &sccapack_pack_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
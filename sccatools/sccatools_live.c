@@ -0,0 +1,268 @@
+/*
+ * Live system functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#include "sccatools_libcerror.h"
+#include "sccatools_live.h"
+#include "sccatools_unused.h"
+
+/* Enables the backup privilege of the process
+ * A process with the backup privilege can open files with backup semantics
+ * regardless of their access control, such as the prefetch files of a live system
+ * Returns 1 if successful, 0 if the privilege is not held or not supported or -1 on error
+ */
+int sccatools_live_enable_backup_privilege(
+     libcerror_error_t **error SCCATOOLS_ATTRIBUTE_UNUSED )
+{
+#if defined( WINAPI )
+	TOKEN_PRIVILEGES token_privileges;
+
+	HANDLE token_handle   = NULL;
+	static char *function = "sccatools_live_enable_backup_privilege";
+	DWORD error_code      = 0;
+
+	if( OpenProcessToken(
+	     GetCurrentProcess(),
+	     TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY,
+	     &token_handle ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_OPEN_FAILED,
+		 GetLastError(),
+		 "%s: unable to open process token.",
+		 function );
+
+		return( -1 );
+	}
+	token_privileges.PrivilegeCount             = 1;
+	token_privileges.Privileges[ 0 ].Attributes = SE_PRIVILEGE_ENABLED;
+
+	if( LookupPrivilegeValueA(
+	     NULL,
+	     "SeBackupPrivilege",
+	     &( token_privileges.Privileges[ 0 ].Luid ) ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 GetLastError(),
+		 "%s: unable to retrieve backup privilege value.",
+		 function );
+
+		goto on_error;
+	}
+	/* AdjustTokenPrivileges succeeds when the privilege is not held
+	 * hence the last error is checked
+	 */
+	if( AdjustTokenPrivileges(
+	     token_handle,
+	     FALSE,
+	     &token_privileges,
+	     0,
+	     NULL,
+	     NULL ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 GetLastError(),
+		 "%s: unable to enable backup privilege.",
+		 function );
+
+		goto on_error;
+	}
+	error_code = GetLastError();
+
+	if( CloseHandle(
+	     token_handle ) == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_CLOSE_FAILED,
+		 GetLastError(),
+		 "%s: unable to close process token.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == ERROR_NOT_ALL_ASSIGNED )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	CloseHandle(
+	 token_handle );
+
+	return( -1 );
+#else
+	SCCATOOLS_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+#endif
+}
+
+/* Retrieves the path of the prefetch directory of the live system
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int sccatools_live_get_prefetch_directory_path(
+     system_character_t **directory_path,
+     libcerror_error_t **error )
+{
+	static char *function = "sccatools_live_get_prefetch_directory_path";
+
+#if defined( WINAPI )
+	system_character_t *path = NULL;
+	UINT path_size           = 0;
+	UINT path_length         = 0;
+#endif
+
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory path value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	/* The size includes the end-of-string character
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	path_size = GetWindowsDirectoryW(
+	             NULL,
+	             0 );
+#else
+	path_size = GetWindowsDirectoryA(
+	             NULL,
+	             0 );
+#endif
+	if( path_size == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 GetLastError(),
+		 "%s: unable to retrieve Windows directory size.",
+		 function );
+
+		goto on_error;
+	}
+	path = system_string_allocate(
+	        path_size + 9 );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	path_length = GetWindowsDirectoryW(
+	               path,
+	               path_size );
+#else
+	path_length = GetWindowsDirectoryA(
+	               path,
+	               path_size );
+#endif
+	if( ( path_length == 0 )
+	 || ( path_length >= path_size ) )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 GetLastError(),
+		 "%s: unable to retrieve Windows directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] == (system_character_t) '\\' ) )
+	{
+		path_length--;
+	}
+	if( system_string_copy(
+	     &( path[ path_length ] ),
+	     _SYSTEM_STRING( "\\Prefetch" ),
+	     10 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy prefetch directory name.",
+		 function );
+
+		goto on_error;
+	}
+	*directory_path = path;
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
@@ -0,0 +1,1809 @@
+/*
+ * Segment handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "index_handle.h"
+#include "path_list.h"
+#include "segment_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#define SEGMENT_HANDLE_NOTIFY_STREAM	stdout
+
+#if defined( WINAPI )
+#define SEGMENT_HANDLE_PATH_SEPARATOR	'\\'
+#else
+#define SEGMENT_HANDLE_PATH_SEPARATOR	'/'
+#endif
+
+/* A segment file is named: segment-<first>-<last>.idx, where first and last
+ * are the sequence numbers of the appends it contains as 8 hexadecimal digits
+ */
+#define SEGMENT_HANDLE_NAME_LENGTH	29
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define segment_handle_remove_file( path ) \
+	_wremove( path )
+
+#define segment_handle_rename_file( source_path, destination_path ) \
+	_wrename( source_path, destination_path )
+
+#else
+#define segment_handle_remove_file( path ) \
+	remove( path )
+
+#define segment_handle_rename_file( source_path, destination_path ) \
+	rename( source_path, destination_path )
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Creates a segment handle
+ * Make sure the value segment_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_initialize(
+     segment_handle_t **segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_handle_initialize";
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*segment_handle = memory_allocate_structure(
+	                   segment_handle_t );
+
+	if( *segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segment handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *segment_handle,
+	     0,
+	     sizeof( segment_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear segment handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *segment_handle )->merge_result  = 1;
+	( *segment_handle )->notify_stream = SEGMENT_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *segment_handle != NULL )
+	{
+		memory_free(
+		 *segment_handle );
+
+		*segment_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a segment handle
+ * The background merge, if started, must be stopped before
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_free(
+     segment_handle_t **segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_handle_free";
+	int result            = 1;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *segment_handle != NULL )
+	{
+		if( segment_handle_clear_segments(
+		     *segment_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear segments.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *segment_handle )->segments != NULL )
+		{
+			memory_free(
+			 ( *segment_handle )->segments );
+		}
+		if( ( *segment_handle )->directory_path != NULL )
+		{
+			memory_free(
+			 ( *segment_handle )->directory_path );
+		}
+		if( ( *segment_handle )->merge_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *segment_handle )->merge_error ) );
+		}
+		memory_free(
+		 *segment_handle );
+
+		*segment_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the segment handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_signal_abort(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_handle_signal_abort";
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	segment_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Clears the segments
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_clear_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	segment_t *segment    = NULL;
+	static char *function = "segment_handle_clear_segments";
+	int result            = 1;
+	int segment_index     = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < segment_handle->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segment_handle->segments[ segment_index ] );
+
+		if( segment->index != NULL )
+		{
+			if( libscca_index_free(
+			     &( segment->index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free segment: %d index.",
+				 function,
+				 segment_index );
+
+				result = -1;
+			}
+		}
+		if( segment->path != NULL )
+		{
+			memory_free(
+			 segment->path );
+
+			segment->path = NULL;
+		}
+	}
+	segment_handle->number_of_segments   = 0;
+	segment_handle->last_sequence_number = 0;
+
+	return( result );
+}
+
+/* Parses the name of a segment file
+ * Returns 1 if successful or 0 if the name is not that of a segment file
+ */
+int segment_handle_parse_name(
+     const system_character_t *name,
+     size_t name_length,
+     uint32_t *first_sequence_number,
+     uint32_t *last_sequence_number )
+{
+	uint32_t sequence_number = 0;
+	size_t name_index        = 0;
+	size_t number_index      = 0;
+	uint8_t digit            = 0;
+
+	if( ( name == NULL )
+	 || ( name_length != SEGMENT_HANDLE_NAME_LENGTH )
+	 || ( first_sequence_number == NULL )
+	 || ( last_sequence_number == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( system_string_compare(
+	       name,
+	       _SYSTEM_STRING( "segment-" ),
+	       8 ) != 0 )
+	 || ( name[ 16 ] != (system_character_t) '-' )
+	 || ( system_string_compare(
+	       &( name[ 25 ] ),
+	       _SYSTEM_STRING( ".idx" ),
+	       4 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	for( number_index = 0;
+	     number_index < 2;
+	     number_index++ )
+	{
+		sequence_number = 0;
+
+		for( name_index = 8 + ( number_index * 9 );
+		     name_index < 16 + ( number_index * 9 );
+		     name_index++ )
+		{
+			if( ( name[ name_index ] >= (system_character_t) '0' )
+			 && ( name[ name_index ] <= (system_character_t) '9' ) )
+			{
+				digit = (uint8_t) ( name[ name_index ] - (system_character_t) '0' );
+			}
+			else if( ( name[ name_index ] >= (system_character_t) 'a' )
+			      && ( name[ name_index ] <= (system_character_t) 'f' ) )
+			{
+				digit = (uint8_t) ( name[ name_index ] - (system_character_t) 'a' ) + 10;
+			}
+			else
+			{
+				return( 0 );
+			}
+			sequence_number = ( sequence_number << 4 ) | digit;
+		}
+		if( number_index == 0 )
+		{
+			*first_sequence_number = sequence_number;
+		}
+		else
+		{
+			*last_sequence_number = sequence_number;
+		}
+	}
+	if( ( *first_sequence_number == 0 )
+	 || ( *first_sequence_number > *last_sequence_number ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the path of a segment file in the index directory
+ * A temporary segment file has the extension .tmp instead of .idx
+ * The path must be freed after use
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_get_segment_path(
+     segment_handle_t *segment_handle,
+     uint32_t first_sequence_number,
+     uint32_t last_sequence_number,
+     uint8_t is_temporary,
+     system_character_t **path,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_path = NULL;
+	static char *function         = "segment_handle_get_segment_path";
+	size_t path_index             = 0;
+	size_t path_size              = 0;
+	int print_count               = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle->directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment handle - missing directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_size = segment_handle->directory_path_length + SEGMENT_HANDLE_NAME_LENGTH + 2;
+
+	safe_path = system_string_allocate(
+	             path_size );
+
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     safe_path,
+	     segment_handle->directory_path,
+	     segment_handle->directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	path_index = segment_handle->directory_path_length;
+
+	if( ( path_index == 0 )
+	 || ( safe_path[ path_index - 1 ] != (system_character_t) SEGMENT_HANDLE_PATH_SEPARATOR ) )
+	{
+		safe_path[ path_index++ ] = (system_character_t) SEGMENT_HANDLE_PATH_SEPARATOR;
+	}
+	if( is_temporary == 0 )
+	{
+		print_count = system_string_sprintf(
+		               &( safe_path[ path_index ] ),
+		               path_size - path_index,
+		               _SYSTEM_STRING( "segment-%08x-%08x.idx" ),
+		               (unsigned int) first_sequence_number,
+		               (unsigned int) last_sequence_number );
+	}
+	else
+	{
+		print_count = system_string_sprintf(
+		               &( safe_path[ path_index ] ),
+		               path_size - path_index,
+		               _SYSTEM_STRING( "segment-%08x-%08x.tmp" ),
+		               (unsigned int) first_sequence_number,
+		               (unsigned int) last_sequence_number );
+	}
+	if( print_count != SEGMENT_HANDLE_NAME_LENGTH )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment name.",
+		 function );
+
+		goto on_error;
+	}
+	*path = safe_path;
+
+	return( 1 );
+
+on_error:
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
+
+/* Inserts a segment in order of first sequence number, where of segments with
+ * the same first sequence number the segment with the larger range goes first
+ * The segment handle takes over the path
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_insert_segment(
+     segment_handle_t *segment_handle,
+     uint32_t first_sequence_number,
+     uint32_t last_sequence_number,
+     system_character_t *path,
+     libcerror_error_t **error )
+{
+	segment_t *reallocation          = NULL;
+	static char *function            = "segment_handle_insert_segment";
+	int number_of_allocated_segments = 0;
+	int segment_index                = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle->number_of_segments >= segment_handle->number_of_allocated_segments )
+	{
+		if( segment_handle->number_of_allocated_segments >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated segments value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_segments = segment_handle->number_of_allocated_segments * 2;
+
+		if( number_of_allocated_segments < 16 )
+		{
+			number_of_allocated_segments = 16;
+		}
+		reallocation = (segment_t *) memory_reallocate(
+		                              segment_handle->segments,
+		                              sizeof( segment_t ) * number_of_allocated_segments );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segments.",
+			 function );
+
+			return( -1 );
+		}
+		segment_handle->segments                     = reallocation;
+		segment_handle->number_of_allocated_segments = number_of_allocated_segments;
+	}
+	segment_index = segment_handle->number_of_segments;
+
+	while( segment_index > 0 )
+	{
+		if( ( segment_handle->segments[ segment_index - 1 ].first_sequence_number < first_sequence_number )
+		 || ( ( segment_handle->segments[ segment_index - 1 ].first_sequence_number == first_sequence_number )
+		  &&  ( segment_handle->segments[ segment_index - 1 ].last_sequence_number >= last_sequence_number ) ) )
+		{
+			break;
+		}
+		segment_handle->segments[ segment_index ] = segment_handle->segments[ segment_index - 1 ];
+
+		segment_index--;
+	}
+	segment_handle->segments[ segment_index ].path                  = path;
+	segment_handle->segments[ segment_index ].first_sequence_number = first_sequence_number;
+	segment_handle->segments[ segment_index ].last_sequence_number  = last_sequence_number;
+	segment_handle->segments[ segment_index ].is_stale              = 0;
+	segment_handle->segments[ segment_index ].index                 = NULL;
+
+	segment_handle->number_of_segments += 1;
+
+	if( last_sequence_number > segment_handle->last_sequence_number )
+	{
+		segment_handle->last_sequence_number = last_sequence_number;
+	}
+	return( 1 );
+}
+
+/* Sets the path of the index directory
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_set_directory_path(
+     segment_handle_t *segment_handle,
+     const system_character_t *directory_path,
+     libcerror_error_t **error )
+{
+	static char *function        = "segment_handle_set_directory_path";
+	size_t directory_path_length = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle->directory_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment handle - directory path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	directory_path_length = system_string_length(
+	                         directory_path );
+
+	if( ( directory_path_length == 0 )
+	 || ( directory_path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - SEGMENT_HANDLE_NAME_LENGTH - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	segment_handle->directory_path = system_string_allocate(
+	                                  directory_path_length + 1 );
+
+	if( segment_handle->directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     segment_handle->directory_path,
+	     directory_path,
+	     directory_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		memory_free(
+		 segment_handle->directory_path );
+
+		segment_handle->directory_path = NULL;
+
+		return( -1 );
+	}
+	segment_handle->directory_path[ directory_path_length ] = 0;
+
+	segment_handle->directory_path_length = directory_path_length;
+
+	return( 1 );
+}
+
+/* Reads the segments in the index directory
+ * A segment that is contained in a segment with a larger range was left behind
+ * by a merge and is marked as stale, the other segments do not overlap
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_read_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	path_list_t *path_list           = NULL;
+	system_character_t *path         = NULL;
+	static char *function            = "segment_handle_read_segments";
+	size_t name_offset               = 0;
+	size_t path_length               = 0;
+	uint32_t first_sequence_number   = 0;
+	uint32_t last_sequence_number    = 0;
+	uint32_t maximum_sequence_number = 0;
+	int path_index                   = 0;
+	int segment_index                = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle->directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid segment handle - missing directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle_clear_segments(
+	     segment_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear segments.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_list_initialize(
+	     &path_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize path list.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_list_read_directory_entries(
+	     path_list,
+	     segment_handle->directory_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entry paths consist of the directory path, a separator, if the directory
+	 * path does not end with one, and the entry name
+	 */
+	name_offset = segment_handle->directory_path_length;
+
+	if( segment_handle->directory_path[ name_offset - 1 ] != (system_character_t) SEGMENT_HANDLE_PATH_SEPARATOR )
+	{
+		name_offset += 1;
+	}
+	for( path_index = 0;
+	     path_index < path_list->number_of_paths;
+	     path_index++ )
+	{
+		path_length = system_string_length(
+		               path_list->paths[ path_index ] );
+
+		if( path_length <= name_offset )
+		{
+			continue;
+		}
+		if( segment_handle_parse_name(
+		     &( path_list->paths[ path_index ][ name_offset ] ),
+		     path_length - name_offset,
+		     &first_sequence_number,
+		     &last_sequence_number ) != 1 )
+		{
+			continue;
+		}
+		if( segment_handle_get_segment_path(
+		     segment_handle,
+		     first_sequence_number,
+		     last_sequence_number,
+		     0,
+		     &path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment path.",
+			 function );
+
+			goto on_error;
+		}
+		if( segment_handle_insert_segment(
+		     segment_handle,
+		     first_sequence_number,
+		     last_sequence_number,
+		     path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert segment.",
+			 function );
+
+			goto on_error;
+		}
+		path = NULL;
+	}
+	if( path_list_free(
+	     &path_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free path list.",
+		 function );
+
+		goto on_error;
+	}
+	/* The segments that start before a segment come before it, hence a segment
+	 * is contained in a previous segment if that segment ends at or after it
+	 */
+	for( segment_index = 0;
+	     segment_index < segment_handle->number_of_segments;
+	     segment_index++ )
+	{
+		if( ( segment_index > 0 )
+		 && ( segment_handle->segments[ segment_index ].last_sequence_number <= maximum_sequence_number ) )
+		{
+			segment_handle->segments[ segment_index ].is_stale = 1;
+		}
+		else
+		{
+			maximum_sequence_number = segment_handle->segments[ segment_index ].last_sequence_number;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Removes the stale segments
+ * A stale segment file that cannot be removed, for example because it is
+ * still opened by a query, remains and is removed by a next merge
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_remove_stale_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	segment_t *segment    = NULL;
+	static char *function = "segment_handle_remove_stale_segments";
+	int move_index        = 0;
+	int segment_index     = 0;
+	int result            = 1;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( segment_index < segment_handle->number_of_segments )
+	{
+		segment = &( segment_handle->segments[ segment_index ] );
+
+		if( segment->is_stale == 0 )
+		{
+			segment_index++;
+
+			continue;
+		}
+		segment_handle_remove_file(
+		 segment->path );
+
+		if( segment->index != NULL )
+		{
+			if( libscca_index_free(
+			     &( segment->index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free segment: %d index.",
+				 function,
+				 segment_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 segment->path );
+
+		segment_handle->number_of_segments -= 1;
+
+		for( move_index = segment_index;
+		     move_index < segment_handle->number_of_segments;
+		     move_index++ )
+		{
+			segment_handle->segments[ move_index ] = segment_handle->segments[ move_index + 1 ];
+		}
+	}
+	return( result );
+}
+
+/* Writes the index of an index handle as a new segment
+ * The segment is written to a temporary file which is renamed once complete,
+ * hence a query never sees a partially written segment
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_write_segment(
+     segment_handle_t *segment_handle,
+     index_handle_t *index_handle,
+     uint32_t sequence_number,
+     libcerror_error_t **error )
+{
+	system_character_t *path           = NULL;
+	system_character_t *temporary_path = NULL;
+	static char *function              = "segment_handle_write_segment";
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( sequence_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sequence number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle_get_segment_path(
+	     segment_handle,
+	     sequence_number,
+	     sequence_number,
+	     1,
+	     &temporary_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve temporary segment path.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_handle_get_segment_path(
+	     segment_handle,
+	     sequence_number,
+	     sequence_number,
+	     0,
+	     &path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment path.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_handle_write_index(
+	     index_handle,
+	     temporary_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write temporary segment.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_handle_rename_file(
+	     temporary_path,
+	     path ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to rename temporary segment.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	memory_free(
+	 temporary_path );
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( temporary_path != NULL )
+	{
+		segment_handle_remove_file(
+		 temporary_path );
+
+		memory_free(
+		 temporary_path );
+	}
+	return( -1 );
+}
+
+/* Determines the tier of a segment
+ * The tier is the logarithm, in base of the merge factor, of the number of appends
+ * the segment contains, hence merging the segments of a tier results in a segment
+ * of the next tier and every append is merged a logarithmic number of times
+ * Returns the tier
+ */
+int segment_handle_get_tier(
+     uint32_t first_sequence_number,
+     uint32_t last_sequence_number )
+{
+	uint32_t number_of_appends = 0;
+	int tier                   = 0;
+
+	if( first_sequence_number > last_sequence_number )
+	{
+		return( 0 );
+	}
+	number_of_appends = last_sequence_number - first_sequence_number + 1;
+
+	while( number_of_appends >= SEGMENT_HANDLE_MERGE_FACTOR )
+	{
+		number_of_appends /= SEGMENT_HANDLE_MERGE_FACTOR;
+
+		tier++;
+	}
+	return( tier );
+}
+
+/* Selects the segments to merge
+ * The oldest run of merge factor adjacent segments of the same tier is selected
+ * Returns 1 if segments were selected or 0 if no segments need to be merged
+ */
+int segment_handle_select_merge(
+     segment_handle_t *segment_handle,
+     int *first_segment_index,
+     int *number_of_segments )
+{
+	segment_t *segment = NULL;
+	int run_length     = 0;
+	int run_tier       = -1;
+	int segment_index  = 0;
+	int tier           = 0;
+
+	if( ( segment_handle == NULL )
+	 || ( first_segment_index == NULL )
+	 || ( number_of_segments == NULL ) )
+	{
+		return( 0 );
+	}
+	for( segment_index = 0;
+	     segment_index < segment_handle->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segment_handle->segments[ segment_index ] );
+
+		if( segment->is_stale != 0 )
+		{
+			run_length = 0;
+			run_tier   = -1;
+
+			continue;
+		}
+		tier = segment_handle_get_tier(
+		        segment->first_sequence_number,
+		        segment->last_sequence_number );
+
+		if( tier == run_tier )
+		{
+			run_length++;
+		}
+		else
+		{
+			run_length = 1;
+			run_tier   = tier;
+		}
+		if( run_length == SEGMENT_HANDLE_MERGE_FACTOR )
+		{
+			*first_segment_index = segment_index - ( SEGMENT_HANDLE_MERGE_FACTOR - 1 );
+			*number_of_segments  = SEGMENT_HANDLE_MERGE_FACTOR;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Merges adjacent segments into one segment
+ * The merged segment is written to a temporary file which is renamed once complete,
+ * after which the merged segments are stale and removed
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int segment_handle_merge_segments(
+     segment_handle_t *segment_handle,
+     int first_segment_index,
+     int number_of_segments,
+     libcerror_error_t **error )
+{
+	index_handle_t *merge_index_handle = NULL;
+	system_character_t *path           = NULL;
+	system_character_t *temporary_path = NULL;
+	static char *function              = "segment_handle_merge_segments";
+	uint32_t first_sequence_number     = 0;
+	uint32_t last_sequence_number      = 0;
+	int segment_index                  = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_segment_index < 0 )
+	 || ( number_of_segments < 2 )
+	 || ( first_segment_index > ( segment_handle->number_of_segments - number_of_segments ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segments value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	first_sequence_number = segment_handle->segments[ first_segment_index ].first_sequence_number;
+	last_sequence_number  = segment_handle->segments[ first_segment_index + number_of_segments - 1 ].last_sequence_number;
+
+	if( index_handle_initialize(
+	     &merge_index_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize merge index handle.",
+		 function );
+
+		goto on_error;
+	}
+	for( segment_index = first_segment_index;
+	     segment_index < ( first_segment_index + number_of_segments );
+	     segment_index++ )
+	{
+		if( segment_handle->abort != 0 )
+		{
+			break;
+		}
+		if( index_handle_append_index_file(
+		     merge_index_handle,
+		     segment_handle->segments[ segment_index ].path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment: %" PRIs_SYSTEM ".",
+			 function,
+			 segment_handle->segments[ segment_index ].path );
+
+			goto on_error;
+		}
+	}
+	if( segment_handle->abort != 0 )
+	{
+		if( index_handle_free(
+		     &merge_index_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free merge index handle.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( segment_handle_get_segment_path(
+	     segment_handle,
+	     first_sequence_number,
+	     last_sequence_number,
+	     1,
+	     &temporary_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve temporary segment path.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_handle_get_segment_path(
+	     segment_handle,
+	     first_sequence_number,
+	     last_sequence_number,
+	     0,
+	     &path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment path.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_handle_write_index(
+	     merge_index_handle,
+	     temporary_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write temporary segment.",
+		 function );
+
+		goto on_error;
+	}
+	if( segment_handle_rename_file(
+	     temporary_path,
+	     path ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to rename temporary segment.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 temporary_path );
+
+	temporary_path = NULL;
+
+	segment_handle->number_of_merges       += 1;
+	segment_handle->number_of_files_merged += merge_index_handle->number_of_files_appended;
+
+	if( index_handle_free(
+	     &merge_index_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free merge index handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The merged segments are contained in the new segment and are now stale
+	 */
+	for( segment_index = first_segment_index;
+	     segment_index < ( first_segment_index + number_of_segments );
+	     segment_index++ )
+	{
+		segment_handle->segments[ segment_index ].is_stale = 1;
+	}
+	if( segment_handle_insert_segment(
+	     segment_handle,
+	     first_sequence_number,
+	     last_sequence_number,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert merged segment.",
+		 function );
+
+		goto on_error;
+	}
+	path = NULL;
+
+	if( segment_handle_remove_stale_segments(
+	     segment_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove stale segments.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	if( temporary_path != NULL )
+	{
+		segment_handle_remove_file(
+		 temporary_path );
+
+		memory_free(
+		 temporary_path );
+	}
+	if( merge_index_handle != NULL )
+	{
+		index_handle_free(
+		 &merge_index_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Merges the segments until no tier has merge factor adjacent segments
+ * Merging a tier can complete a run of the next tier, which is merged as well
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_merge(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "segment_handle_merge";
+	int first_segment_index = 0;
+	int number_of_segments  = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_handle_remove_stale_segments(
+	     segment_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove stale segments.",
+		 function );
+
+		return( -1 );
+	}
+	while( segment_handle->abort == 0 )
+	{
+		if( segment_handle_select_merge(
+		     segment_handle,
+		     &first_segment_index,
+		     &number_of_segments ) != 1 )
+		{
+			break;
+		}
+		if( segment_handle_merge_segments(
+		     segment_handle,
+		     first_segment_index,
+		     number_of_segments,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to merge segments.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function of the background merge thread
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_merge_thread_callback(
+     segment_handle_t *segment_handle )
+{
+	if( segment_handle == NULL )
+	{
+		return( -1 );
+	}
+	segment_handle->merge_result = segment_handle_merge(
+	                                segment_handle,
+	                                &( segment_handle->merge_error ) );
+
+	return( segment_handle->merge_result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Starts merging the segments in the background
+ * The segments must not be accessed until the merge is stopped, a new segment
+ * can be written, with a sequence number after the last sequence number
+ * Without multi-thread support the segments are merged when the merge is stopped
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_start_merge(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_handle_start_merge";
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( segment_handle->merge_thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid segment handle - merge thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_thread_create(
+	     &( segment_handle->merge_thread ),
+	     NULL,
+	     (int (*)(void *)) &segment_handle_merge_thread_callback,
+	     (void *) segment_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create merge thread.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+}
+
+/* Stops merging the segments in the background and waits for the merge to complete
+ * Returns 1 if successful or -1 on error
+ */
+int segment_handle_stop_merge(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "segment_handle_stop_merge";
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( segment_handle->merge_thread != NULL )
+	{
+		if( libcthreads_thread_join(
+		     &( segment_handle->merge_thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join merge thread.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#else
+	segment_handle->merge_result = segment_handle_merge(
+	                                segment_handle,
+	                                &( segment_handle->merge_error ) );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( segment_handle->merge_result != 1 )
+	{
+		/* Hand over the error of the merge to the caller
+		 */
+		if( ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = segment_handle->merge_error;
+
+			segment_handle->merge_error = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to merge segments in background.",
+		 function );
+
+		segment_handle->merge_result = 1;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the index of every segment that is not stale
+ * Returns 1 if successful, 0 if a segment could not be opened or -1 on error
+ */
+int segment_handle_open_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error )
+{
+	segment_t *segment    = NULL;
+	static char *function = "segment_handle_open_segments";
+	int result            = 0;
+	int segment_index     = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < segment_handle->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( segment_handle->segments[ segment_index ] );
+
+		if( ( segment->is_stale != 0 )
+		 || ( segment->index != NULL ) )
+		{
+			continue;
+		}
+		if( libscca_index_initialize(
+		     &( segment->index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize segment: %d index.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		/* The segment can have been merged and removed since the segments were read
+		 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libscca_index_open_wide(
+		          segment->index,
+		          segment->path,
+		          NULL );
+#else
+		result = libscca_index_open(
+		          segment->index,
+		          segment->path,
+		          NULL );
+#endif
+		if( result != 1 )
+		{
+			libscca_index_free(
+			 &( segment->index ),
+			 NULL );
+
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Prints the files that loaded a specific filename in every segment
+ * The segments are opened before the first is queried, when a segment was removed
+ * by a merge in the meantime the segments are read again
+ * Returns 1 if successful, 0 if no file loaded the filename or -1 on error
+ */
+int segment_handle_query_fprint(
+     segment_handle_t *segment_handle,
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	segment_t *segment    = NULL;
+	static char *function = "segment_handle_query_fprint";
+	int number_of_retries = 0;
+	int result            = 0;
+	int segment_index     = 0;
+	int query_result      = 0;
+
+	if( segment_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment handle.",
+		 function );
+
+		return( -1 );
+	}
+	for( number_of_retries = 0;
+	     number_of_retries < SEGMENT_HANDLE_MAXIMUM_NUMBER_OF_RETRIES;
+	     number_of_retries++ )
+	{
+		if( number_of_retries > 0 )
+		{
+			if( segment_handle_read_segments(
+			     segment_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read segments.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		result = segment_handle_open_segments(
+		          segment_handle,
+		          error );
+
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open segments.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < segment_handle->number_of_segments;
+	     segment_index++ )
+	{
+		if( segment_handle->abort != 0 )
+		{
+			break;
+		}
+		segment = &( segment_handle->segments[ segment_index ] );
+
+		if( segment->is_stale != 0 )
+		{
+			continue;
+		}
+		result = index_handle_query_index_fprint(
+		          index_handle,
+		          segment->index,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to query segment: %" PRIs_SYSTEM ".",
+			 function,
+			 segment->path );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			query_result = 1;
+		}
+	}
+	return( query_result );
+}
+
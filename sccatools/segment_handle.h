@@ -0,0 +1,237 @@
+/*
+ * Segment handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SEGMENT_HANDLE_H )
+#define _SEGMENT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "index_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcthreads.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of segments of the same tier that are merged into one segment
+ */
+#define SEGMENT_HANDLE_MERGE_FACTOR		4
+
+/* The maximum number of times the segments are read again when a segment
+ * was removed by a merge while the segments were being opened
+ */
+#define SEGMENT_HANDLE_MAXIMUM_NUMBER_OF_RETRIES	8
+
+typedef struct segment segment_t;
+
+struct segment
+{
+	/* The path of the segment file
+	 */
+	system_character_t *path;
+
+	/* The first sequence number of the appends the segment contains
+	 */
+	uint32_t first_sequence_number;
+
+	/* The last sequence number of the appends the segment contains
+	 */
+	uint32_t last_sequence_number;
+
+	/* Value to indicate the segment is contained in a larger segment
+	 * and was left behind by a merge
+	 */
+	uint8_t is_stale;
+
+	/* The index of the segment, when opened
+	 */
+	libscca_index_t *index;
+};
+
+typedef struct segment_handle segment_handle_t;
+
+struct segment_handle
+{
+	/* The path of the index directory
+	 */
+	system_character_t *directory_path;
+
+	/* The length of the path of the index directory
+	 */
+	size_t directory_path_length;
+
+	/* The segments sorted by first sequence number
+	 */
+	segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The number of allocated segments
+	 */
+	int number_of_allocated_segments;
+
+	/* The last sequence number of the segments
+	 */
+	uint32_t last_sequence_number;
+
+	/* The number of merges
+	 */
+	int number_of_merges;
+
+	/* The number of files in the merged segments
+	 */
+	int number_of_files_merged;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The background merge thread
+	 */
+	libcthreads_thread_t *merge_thread;
+#endif
+
+	/* The error of the background merge
+	 */
+	libcerror_error_t *merge_error;
+
+	/* The result of the background merge
+	 */
+	int merge_result;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int segment_handle_initialize(
+     segment_handle_t **segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_free(
+     segment_handle_t **segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_signal_abort(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_clear_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_parse_name(
+     const system_character_t *name,
+     size_t name_length,
+     uint32_t *first_sequence_number,
+     uint32_t *last_sequence_number );
+
+int segment_handle_get_segment_path(
+     segment_handle_t *segment_handle,
+     uint32_t first_sequence_number,
+     uint32_t last_sequence_number,
+     uint8_t is_temporary,
+     system_character_t **path,
+     libcerror_error_t **error );
+
+int segment_handle_insert_segment(
+     segment_handle_t *segment_handle,
+     uint32_t first_sequence_number,
+     uint32_t last_sequence_number,
+     system_character_t *path,
+     libcerror_error_t **error );
+
+int segment_handle_set_directory_path(
+     segment_handle_t *segment_handle,
+     const system_character_t *directory_path,
+     libcerror_error_t **error );
+
+int segment_handle_read_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_remove_stale_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_write_segment(
+     segment_handle_t *segment_handle,
+     index_handle_t *index_handle,
+     uint32_t sequence_number,
+     libcerror_error_t **error );
+
+int segment_handle_get_tier(
+     uint32_t first_sequence_number,
+     uint32_t last_sequence_number );
+
+int segment_handle_select_merge(
+     segment_handle_t *segment_handle,
+     int *first_segment_index,
+     int *number_of_segments );
+
+int segment_handle_merge_segments(
+     segment_handle_t *segment_handle,
+     int first_segment_index,
+     int number_of_segments,
+     libcerror_error_t **error );
+
+int segment_handle_merge(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int segment_handle_merge_thread_callback(
+     segment_handle_t *segment_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int segment_handle_start_merge(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_stop_merge(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_open_segments(
+     segment_handle_t *segment_handle,
+     libcerror_error_t **error );
+
+int segment_handle_query_fprint(
+     segment_handle_t *segment_handle,
+     index_handle_t *index_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SEGMENT_HANDLE_H ) */
+
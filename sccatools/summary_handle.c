@@ -0,0 +1,2532 @@
+/*
+ * Summary handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "frequency_sketch.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+#include "summary_handle.h"
+
+/* Calculates the 32-bit FNV-1a hash of a key
+ * Returns the hash
+ */
+uint32_t summary_table_calculate_hash(
+          const uint8_t *key,
+          size_t key_size )
+{
+	size_t key_offset = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	for( key_offset = 0;
+	     key_offset < key_size;
+	     key_offset++ )
+	{
+		hash ^= key[ key_offset ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Creates a summary table
+ * Make sure the value summary_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int summary_table_initialize(
+     summary_table_t **summary_table,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_table_initialize";
+	size_t buckets_size   = 0;
+
+	if( summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *summary_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid summary table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*summary_table = memory_allocate_structure(
+	                  summary_table_t );
+
+	if( *summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create summary table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *summary_table,
+	     0,
+	     sizeof( summary_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear summary table.",
+		 function );
+
+		memory_free(
+		 *summary_table );
+
+		*summary_table = NULL;
+
+		return( -1 );
+	}
+	buckets_size = sizeof( summary_entry_t * ) * SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS;
+
+	( *summary_table )->buckets = (summary_entry_t **) memory_allocate(
+	                                                    buckets_size );
+
+	if( ( *summary_table )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *summary_table )->buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *summary_table )->number_of_buckets = SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS;
+
+	return( 1 );
+
+on_error:
+	if( *summary_table != NULL )
+	{
+		if( ( *summary_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *summary_table )->buckets );
+		}
+		memory_free(
+		 *summary_table );
+
+		*summary_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a summary table
+ * Returns 1 if successful or -1 on error
+ */
+int summary_table_free(
+     summary_table_t **summary_table,
+     libcerror_error_t **error )
+{
+	summary_entry_t *next_entry = NULL;
+	summary_entry_t *entry      = NULL;
+	static char *function       = "summary_table_free";
+	uint32_t bucket_index       = 0;
+
+	if( summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *summary_table != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < ( *summary_table )->number_of_buckets;
+		     bucket_index++ )
+		{
+			entry = ( *summary_table )->buckets[ bucket_index ];
+
+			while( entry != NULL )
+			{
+				next_entry = entry->next_entry;
+
+				memory_free(
+				 entry );
+
+				entry = next_entry;
+			}
+		}
+		memory_free(
+		 ( *summary_table )->buckets );
+
+		memory_free(
+		 *summary_table );
+
+		*summary_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the buckets of a summary table and redistributes the entries
+ * The number of buckets must be a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int summary_table_resize(
+     summary_table_t *summary_table,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	summary_entry_t **buckets   = NULL;
+	summary_entry_t *next_entry = NULL;
+	summary_entry_t *entry      = NULL;
+	static char *function       = "summary_table_resize";
+	size_t buckets_size         = 0;
+	uint32_t bucket_index       = 0;
+	uint32_t new_bucket_index   = 0;
+
+	if( summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets == 0 )
+	 || ( number_of_buckets > SUMMARY_TABLE_MAXIMUM_NUMBER_OF_BUCKETS )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets_size = sizeof( summary_entry_t * ) * number_of_buckets;
+
+	buckets = (summary_entry_t **) memory_allocate(
+	                                buckets_size );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < summary_table->number_of_buckets;
+	     bucket_index++ )
+	{
+		entry = summary_table->buckets[ bucket_index ];
+
+		while( entry != NULL )
+		{
+			next_entry       = entry->next_entry;
+			new_bucket_index = entry->hash & ( number_of_buckets - 1 );
+
+			entry->next_entry           = buckets[ new_bucket_index ];
+			buckets[ new_bucket_index ] = entry;
+
+			entry = next_entry;
+		}
+	}
+	memory_free(
+	 summary_table->buckets );
+
+	summary_table->buckets           = buckets;
+	summary_table->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific key
+ * The entry is created if the key is not yet stored in the table
+ * Returns 1 if successful or -1 on error
+ */
+int summary_table_get_entry_by_key(
+     summary_table_t *summary_table,
+     const uint8_t *key,
+     size_t key_size,
+     summary_entry_t **summary_entry,
+     libcerror_error_t **error )
+{
+	summary_entry_t *entry = NULL;
+	static char *function  = "summary_table_get_entry_by_key";
+	uint32_t bucket_index  = 0;
+	uint32_t hash          = 0;
+
+	if( summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( summary_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary entry.",
+		 function );
+
+		return( -1 );
+	}
+	hash = summary_table_calculate_hash(
+	        key,
+	        key_size );
+
+	bucket_index = hash & ( summary_table->number_of_buckets - 1 );
+
+	for( entry = summary_table->buckets[ bucket_index ];
+	     entry != NULL;
+	     entry = entry->next_entry )
+	{
+		if( ( entry->hash == hash )
+		 && ( entry->key_size == key_size )
+		 && ( memory_compare(
+		       entry->key,
+		       key,
+		       key_size ) == 0 ) )
+		{
+			*summary_entry = entry;
+
+			return( 1 );
+		}
+	}
+	if( summary_table->number_of_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid summary table - number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key is stored in the same allocation directly after the entry
+	 */
+	entry = (summary_entry_t *) memory_allocate(
+	                             sizeof( summary_entry_t ) + key_size );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( summary_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	entry->key = (uint8_t *) &( entry[ 1 ] );
+
+	if( key_size > 0 )
+	{
+		if( memory_copy(
+		     entry->key,
+		     key,
+		     key_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			memory_free(
+			 entry );
+
+			return( -1 );
+		}
+	}
+	entry->hash            = hash;
+	entry->key_size        = key_size;
+	entry->last_file_index = -1;
+	entry->next_entry      = summary_table->buckets[ bucket_index ];
+
+	summary_table->buckets[ bucket_index ] = entry;
+
+	summary_table->number_of_entries += 1;
+
+	/* Keep the average bucket chain length at 1 or less
+	 */
+	if( ( (uint32_t) summary_table->number_of_entries > summary_table->number_of_buckets )
+	 && ( summary_table->number_of_buckets < SUMMARY_TABLE_MAXIMUM_NUMBER_OF_BUCKETS ) )
+	{
+		if( summary_table_resize(
+		     summary_table,
+		     summary_table->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize summary table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*summary_entry = entry;
+
+	return( 1 );
+}
+
+/* Compares two entries by value, number of files and key
+ * The entries with the largest value and number of files are sorted first
+ * Returns -1 if the first entry precedes the second, 1 if it follows or 0 if equal
+ */
+int summary_table_compare_entries(
+     const summary_entry_t **first_entry,
+     const summary_entry_t **second_entry )
+{
+	size_t key_size = 0;
+	int result      = 0;
+
+	if( ( *first_entry )->value > ( *second_entry )->value )
+	{
+		return( -1 );
+	}
+	else if( ( *first_entry )->value < ( *second_entry )->value )
+	{
+		return( 1 );
+	}
+	if( ( *first_entry )->number_of_files > ( *second_entry )->number_of_files )
+	{
+		return( -1 );
+	}
+	else if( ( *first_entry )->number_of_files < ( *second_entry )->number_of_files )
+	{
+		return( 1 );
+	}
+	key_size = ( *first_entry )->key_size;
+
+	if( key_size > ( *second_entry )->key_size )
+	{
+		key_size = ( *second_entry )->key_size;
+	}
+	result = memory_compare(
+	          ( *first_entry )->key,
+	          ( *second_entry )->key,
+	          key_size );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( ( *first_entry )->key_size < ( *second_entry )->key_size )
+	{
+		return( -1 );
+	}
+	else if( ( *first_entry )->key_size > ( *second_entry )->key_size )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the entries of a summary table sorted by value, number of files and key
+ * The sorted entries array is set to NULL if the table contains no entries
+ * otherwise it must be freed by the caller, the entries remain owned by the table
+ * Returns 1 if successful or -1 on error
+ */
+int summary_table_get_sorted_entries(
+     summary_table_t *summary_table,
+     summary_entry_t ***sorted_entries,
+     libcerror_error_t **error )
+{
+	summary_entry_t **entries = NULL;
+	summary_entry_t *entry    = NULL;
+	static char *function     = "summary_table_get_sorted_entries";
+	size_t entries_size       = 0;
+	uint32_t bucket_index     = 0;
+	int entry_index           = 0;
+
+	if( summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary table.",
+		 function );
+
+		return( -1 );
+	}
+	if( sorted_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted entries.",
+		 function );
+
+		return( -1 );
+	}
+	*sorted_entries = NULL;
+
+	if( summary_table->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( summary_entry_t * ) * (size_t) summary_table->number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entries size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries = (summary_entry_t **) memory_allocate(
+	                                entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < summary_table->number_of_buckets;
+	     bucket_index++ )
+	{
+		for( entry = summary_table->buckets[ bucket_index ];
+		     entry != NULL;
+		     entry = entry->next_entry )
+		{
+			entries[ entry_index++ ] = entry;
+		}
+	}
+	qsort(
+	 entries,
+	 (size_t) entry_index,
+	 sizeof( summary_entry_t * ),
+	 (int (*)(const void *, const void *)) &summary_table_compare_entries );
+
+	*sorted_entries = entries;
+
+	return( 1 );
+}
+
+/* Compares two run time buckets by start time, executable filename and prefetch hash
+ * Returns -1 if the first bucket precedes the second, 1 if it follows or 0 if equal
+ */
+int summary_run_time_bucket_compare(
+     const summary_run_time_bucket_t *first_bucket,
+     const summary_run_time_bucket_t *second_bucket )
+{
+	int result = 0;
+
+	if( first_bucket->start_time < second_bucket->start_time )
+	{
+		return( -1 );
+	}
+	else if( first_bucket->start_time > second_bucket->start_time )
+	{
+		return( 1 );
+	}
+	result = narrow_string_compare(
+	          (char *) first_bucket->executable_filename,
+	          (char *) second_bucket->executable_filename,
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE );
+
+	if( result < 0 )
+	{
+		return( -1 );
+	}
+	else if( result > 0 )
+	{
+		return( 1 );
+	}
+	if( first_bucket->prefetch_hash < second_bucket->prefetch_hash )
+	{
+		return( -1 );
+	}
+	else if( first_bucket->prefetch_hash > second_bucket->prefetch_hash )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Creates a summary record
+ * Make sure the value summary_record is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int summary_record_initialize(
+     summary_record_t **summary_record,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_record_initialize";
+
+	if( summary_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *summary_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid summary record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*summary_record = memory_allocate_structure(
+	                   summary_record_t );
+
+	if( *summary_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create summary record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *summary_record,
+	     0,
+	     sizeof( summary_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear summary record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *summary_record != NULL )
+	{
+		memory_free(
+		 *summary_record );
+
+		*summary_record = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a summary record
+ * Returns 1 if successful or -1 on error
+ */
+int summary_record_free(
+     summary_record_t **summary_record,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_record_free";
+
+	if( summary_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *summary_record != NULL )
+	{
+		if( ( *summary_record )->volume_serial_numbers != NULL )
+		{
+			memory_free(
+			 ( *summary_record )->volume_serial_numbers );
+		}
+		if( ( *summary_record )->filename_offsets != NULL )
+		{
+			memory_free(
+			 ( *summary_record )->filename_offsets );
+		}
+		if( ( *summary_record )->filenames != NULL )
+		{
+			memory_free(
+			 ( *summary_record )->filenames );
+		}
+		if( ( *summary_record )->executable_filename != NULL )
+		{
+			memory_free(
+			 ( *summary_record )->executable_filename );
+		}
+		memory_free(
+		 *summary_record );
+
+		*summary_record = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the values of a file that are aggregated in the summary
+ * The buffers of the record are reused and only grow when a file needs more space
+ * Returns 1 if successful or -1 on error
+ */
+int summary_record_read_file(
+     summary_record_t *summary_record,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	libscca_volume_information_t *volume_information = NULL;
+	void *reallocation                               = NULL;
+	static char *function                            = "summary_record_read_file";
+	size_t utf8_string_size                          = 0;
+	int number_of_filenames                          = 0;
+	int number_of_volumes                            = 0;
+	int volume_index                                 = 0;
+
+	if( summary_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary record.",
+		 function );
+
+		return( -1 );
+	}
+	summary_record->executable_filename_size = 0;
+	summary_record->run_count                = 0;
+	summary_record->prefetch_hash            = 0;
+	summary_record->number_of_last_run_times = 0;
+	summary_record->filenames_size           = 0;
+	summary_record->number_of_filenames      = 0;
+	summary_record->number_of_volumes        = 0;
+
+	if( libscca_file_get_utf8_executable_filename_size(
+	     file,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve executable filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_size > 1 )
+	{
+		if( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid executable filename size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( utf8_string_size > summary_record->allocated_executable_filename_size )
+		{
+			reallocation = memory_reallocate(
+			                summary_record->executable_filename,
+			                sizeof( uint8_t ) * utf8_string_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize executable filename.",
+				 function );
+
+				goto on_error;
+			}
+			summary_record->executable_filename                = (uint8_t *) reallocation;
+			summary_record->allocated_executable_filename_size = utf8_string_size;
+		}
+		if( libscca_file_get_utf8_executable_filename(
+		     file,
+		     summary_record->executable_filename,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve executable filename.",
+			 function );
+
+			goto on_error;
+		}
+		summary_record->executable_filename_size = utf8_string_size;
+	}
+	if( libscca_file_get_run_count(
+	     file,
+	     &( summary_record->run_count ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &( summary_record->prefetch_hash ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_last_run_times(
+	     file,
+	     summary_record->last_run_times,
+	     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	     &( summary_record->number_of_last_run_times ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last run times.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_get_number_of_filenames(
+	     file,
+	     &number_of_filenames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_filenames > 0 )
+	{
+		if( libscca_file_get_utf8_filenames_table_size(
+		     file,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		 || ( (size_t) number_of_filenames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filenames table size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( utf8_string_size > summary_record->allocated_filenames_size )
+		{
+			reallocation = memory_reallocate(
+			                summary_record->filenames,
+			                sizeof( uint8_t ) * utf8_string_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize filenames.",
+				 function );
+
+				goto on_error;
+			}
+			summary_record->filenames                = (uint8_t *) reallocation;
+			summary_record->allocated_filenames_size = utf8_string_size;
+		}
+		if( number_of_filenames > summary_record->number_of_allocated_filename_offsets )
+		{
+			reallocation = memory_reallocate(
+			                summary_record->filename_offsets,
+			                sizeof( size_t ) * number_of_filenames );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize filename offsets.",
+				 function );
+
+				goto on_error;
+			}
+			summary_record->filename_offsets                     = (size_t *) reallocation;
+			summary_record->number_of_allocated_filename_offsets = number_of_filenames;
+		}
+		if( libscca_file_get_utf8_filenames_table(
+		     file,
+		     summary_record->filenames,
+		     utf8_string_size,
+		     summary_record->filename_offsets,
+		     number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filenames table.",
+			 function );
+
+			goto on_error;
+		}
+		summary_record->filenames_size      = utf8_string_size;
+		summary_record->number_of_filenames = number_of_filenames;
+	}
+	if( libscca_file_get_number_of_volumes(
+	     file,
+	     &number_of_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_volumes > summary_record->number_of_allocated_volume_serial_numbers )
+	{
+		if( (size_t) number_of_volumes > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of volumes value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		reallocation = memory_reallocate(
+		                summary_record->volume_serial_numbers,
+		                sizeof( uint32_t ) * number_of_volumes );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize volume serial numbers.",
+			 function );
+
+			goto on_error;
+		}
+		summary_record->volume_serial_numbers                     = (uint32_t *) reallocation;
+		summary_record->number_of_allocated_volume_serial_numbers = number_of_volumes;
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     file,
+		     volume_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_serial_number(
+		     volume_information,
+		     &( summary_record->volume_serial_numbers[ volume_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d serial number.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	summary_record->number_of_volumes = number_of_volumes;
+
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	summary_record->executable_filename_size = 0;
+	summary_record->filenames_size           = 0;
+	summary_record->number_of_filenames      = 0;
+	summary_record->number_of_volumes        = 0;
+
+	return( -1 );
+}
+
+/* Creates a summary handle
+ * Make sure the value summary_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_initialize(
+     summary_handle_t **summary_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_handle_initialize";
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *summary_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid summary handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*summary_handle = memory_allocate_structure(
+	                   summary_handle_t );
+
+	if( *summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create summary handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *summary_handle,
+	     0,
+	     sizeof( summary_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear summary handle.",
+		 function );
+
+		memory_free(
+		 *summary_handle );
+
+		*summary_handle = NULL;
+
+		return( -1 );
+	}
+	if( summary_table_initialize(
+	     &( ( *summary_handle )->executables_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create executables table.",
+		 function );
+
+		goto on_error;
+	}
+	if( summary_table_initialize(
+	     &( ( *summary_handle )->filenames_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filenames table.",
+		 function );
+
+		goto on_error;
+	}
+	if( summary_table_initialize(
+	     &( ( *summary_handle )->volumes_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volumes table.",
+		 function );
+
+		goto on_error;
+	}
+	if( summary_record_initialize(
+	     &( ( *summary_handle )->record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *summary_handle != NULL )
+	{
+		summary_handle_free(
+		 summary_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a summary handle
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_free(
+     summary_handle_t **summary_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_handle_free";
+	int result            = 1;
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *summary_handle != NULL )
+	{
+		if( ( *summary_handle )->record != NULL )
+		{
+			if( summary_record_free(
+			     &( ( *summary_handle )->record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *summary_handle )->run_time_histogram != NULL )
+		{
+			if( libscca_run_time_histogram_free(
+			     &( ( *summary_handle )->run_time_histogram ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free run time histogram.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *summary_handle )->filenames_sketch != NULL )
+		{
+			if( frequency_sketch_free(
+			     &( ( *summary_handle )->filenames_sketch ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filenames sketch.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *summary_handle )->volumes_table != NULL )
+		{
+			if( summary_table_free(
+			     &( ( *summary_handle )->volumes_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volumes table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *summary_handle )->filenames_table != NULL )
+		{
+			if( summary_table_free(
+			     &( ( *summary_handle )->filenames_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filenames table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *summary_handle )->executables_table != NULL )
+		{
+			if( summary_table_free(
+			     &( ( *summary_handle )->executables_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free executables table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *summary_handle );
+
+		*summary_handle = NULL;
+	}
+	return( result );
+}
+
+/* Sets a frequency sketch for the loaded filenames
+ * The sketch bounds the memory used for the filenames regardless of their number,
+ * at the cost of only reporting estimates of the most common and rarest filenames
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_set_filenames_sketch(
+     summary_handle_t *summary_handle,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_handle_set_filenames_sketch";
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->filenames_sketch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid summary handle - filenames sketch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->number_of_files != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid summary handle - files already aggregated.",
+		 function );
+
+		return( -1 );
+	}
+	if( frequency_sketch_initialize(
+	     &( summary_handle->filenames_sketch ),
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create filenames sketch.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets a run time histogram that counts the runs of the executables in time buckets
+ * The bucket width is in seconds
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_set_run_time_bucket_width(
+     summary_handle_t *summary_handle,
+     uint64_t bucket_width,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_handle_set_run_time_bucket_width";
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->run_time_histogram != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid summary handle - run time histogram value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->number_of_files != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid summary handle - files already aggregated.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bucket_width == 0 )
+	 || ( bucket_width > ( (uint64_t) UINT64_MAX / 10000000UL ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bucket width value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The run time histogram stores the bucket width in FILETIME resolution
+	 */
+	if( libscca_run_time_histogram_initialize(
+	     &( summary_handle->run_time_histogram ),
+	     bucket_width * 10000000UL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a key of the current file to a summary table
+ * The value is added to the value of the entry and the number of files
+ * of the entry is only incremented once per file
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_table_append(
+     summary_handle_t *summary_handle,
+     summary_table_t *summary_table,
+     const uint8_t *key,
+     size_t key_size,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	summary_entry_t *summary_entry = NULL;
+	static char *function          = "summary_handle_table_append";
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_table_get_entry_by_key(
+	     summary_table,
+	     key,
+	     key_size,
+	     &summary_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	summary_entry->value += value;
+
+	if( summary_entry->last_file_index != summary_handle->number_of_files )
+	{
+		summary_entry->number_of_files += 1;
+		summary_entry->last_file_index  = summary_handle->number_of_files;
+	}
+	return( 1 );
+}
+
+/* Aggregates the values of a record in the summary
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_append_record(
+     summary_handle_t *summary_handle,
+     summary_record_t *summary_record,
+     libcerror_error_t **error )
+{
+	uint8_t serial_number_data[ 4 ];
+
+	static char *function = "summary_handle_append_record";
+	size_t filename_end   = 0;
+	size_t filename_start = 0;
+	int filename_index    = 0;
+	int result            = 0;
+	int volume_index      = 0;
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary record.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->number_of_files == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid summary handle - number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The executable filename size includes the end of string character
+	 */
+	if( summary_record->executable_filename_size > 1 )
+	{
+		if( summary_handle_table_append(
+		     summary_handle,
+		     summary_handle->executables_table,
+		     summary_record->executable_filename,
+		     summary_record->executable_filename_size - 1,
+		     (uint64_t) summary_record->run_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append executable filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The filenames are stored one after the other in the table
+	 * hence the end of a filename is determined by the start of the next
+	 */
+	for( filename_index = 0;
+	     filename_index < summary_record->number_of_filenames;
+	     filename_index++ )
+	{
+		filename_start = summary_record->filename_offsets[ filename_index ];
+
+		if( ( filename_index + 1 ) < summary_record->number_of_filenames )
+		{
+			filename_end = summary_record->filename_offsets[ filename_index + 1 ];
+		}
+		else
+		{
+			filename_end = summary_record->filenames_size;
+		}
+		if( ( filename_start >= filename_end )
+		 || ( filename_end > summary_record->filenames_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename: %d offset value out of bounds.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		/* A filename is unique within a file hence every observation
+		 * in the sketch corresponds to one file, empty filenames are not counted
+		 */
+		if( summary_handle->filenames_sketch != NULL )
+		{
+			result = 1;
+
+			if( ( filename_end - filename_start ) > 1 )
+			{
+				result = frequency_sketch_append(
+				          summary_handle->filenames_sketch,
+				          &( summary_record->filenames[ filename_start ] ),
+				          filename_end - filename_start - 1,
+				          error );
+			}
+		}
+		else
+		{
+			result = summary_handle_table_append(
+			          summary_handle,
+			          summary_handle->filenames_table,
+			          &( summary_record->filenames[ filename_start ] ),
+			          filename_end - filename_start - 1,
+			          0,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+	}
+	for( volume_index = 0;
+	     volume_index < summary_record->number_of_volumes;
+	     volume_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 serial_number_data,
+		 summary_record->volume_serial_numbers[ volume_index ] );
+
+		if( summary_handle_table_append(
+		     summary_handle,
+		     summary_handle->volumes_table,
+		     serial_number_data,
+		     4,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append volume: %d serial number.",
+			 function,
+			 volume_index );
+
+			return( -1 );
+		}
+	}
+	if( summary_handle->run_time_histogram != NULL )
+	{
+		if( summary_record->executable_filename_size > 1 )
+		{
+			result = libscca_run_time_histogram_append_run_times(
+			          summary_handle->run_time_histogram,
+			          summary_record->executable_filename,
+			          summary_record->executable_filename_size,
+			          summary_record->prefetch_hash,
+			          summary_record->last_run_times,
+			          summary_record->number_of_last_run_times,
+			          error );
+		}
+		else
+		{
+			result = libscca_run_time_histogram_append_run_times(
+			          summary_handle->run_time_histogram,
+			          (uint8_t *) "",
+			          1,
+			          summary_record->prefetch_hash,
+			          summary_record->last_run_times,
+			          summary_record->number_of_last_run_times,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append run times.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	summary_handle->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Reads the values of a file and aggregates them in the summary
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_append_file(
+     summary_handle_t *summary_handle,
+     libscca_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "summary_handle_append_file";
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_record_read_file(
+	     summary_handle->record,
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle_append_record(
+	     summary_handle,
+	     summary_handle->record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the entries of a summary table sorted by value, number of files and key
+ * The output buffer is written to the stream whenever it exceeds its initial size
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_table_fprint(
+     summary_table_t *summary_table,
+     const char *description,
+     int print_value,
+     int key_is_serial_number,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	summary_entry_t **sorted_entries = NULL;
+	summary_entry_t *entry           = NULL;
+	static char *function            = "summary_handle_table_fprint";
+	uint32_t serial_number           = 0;
+	int entry_index                  = 0;
+	int result                       = 1;
+
+	if( summary_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary table.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_table_get_sorted_entries(
+	     summary_table,
+	     &sorted_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sorted entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       description,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       ":\n",
+	       error ) != 1 ) )
+	{
+		result = -1;
+	}
+	for( entry_index = 0;
+	     ( result == 1 ) && ( entry_index < summary_table->number_of_entries );
+	     entry_index++ )
+	{
+		entry = sorted_entries[ entry_index ];
+
+		if( output_buffer_append_character(
+		     output_buffer,
+		     '\t',
+		     error ) != 1 )
+		{
+			result = -1;
+		}
+		else if( print_value != 0 )
+		{
+			if( ( output_buffer_append_decimal(
+			       output_buffer,
+			       entry->value,
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       output_buffer,
+			       '\t',
+			       error ) != 1 ) )
+			{
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			if( ( output_buffer_append_decimal(
+			       output_buffer,
+			       (uint64_t) entry->number_of_files,
+			       error ) != 1 )
+			 || ( output_buffer_append_character(
+			       output_buffer,
+			       '\t',
+			       error ) != 1 ) )
+			{
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			if( key_is_serial_number != 0 )
+			{
+				byte_stream_copy_to_uint32_big_endian(
+				 entry->key,
+				 serial_number );
+
+				result = output_buffer_append_hexadecimal_32bit(
+				          output_buffer,
+				          serial_number,
+				          error );
+			}
+			else
+			{
+				result = output_buffer_append_string(
+				          output_buffer,
+				          (char *) entry->key,
+				          entry->key_size,
+				          error );
+			}
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_character(
+			          output_buffer,
+			          '\n',
+			          error );
+		}
+		if( ( result == 1 )
+		 && ( output_buffer->data_offset >= OUTPUT_BUFFER_INITIAL_DATA_SIZE ) )
+		{
+			result = output_buffer_write(
+			          output_buffer,
+			          stream,
+			          error );
+		}
+	}
+	if( result == 1 )
+	{
+		result = output_buffer_append_character(
+		          output_buffer,
+		          '\n',
+		          error );
+	}
+	if( sorted_entries != NULL )
+	{
+		memory_free(
+		 sorted_entries );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print %s.",
+		 function,
+		 description );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints the buckets of the run time histogram sorted by start time, executable filename and prefetch hash
+ * The buckets are printed as: start time, number of runs, prefetch hash and executable filename
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_run_time_histogram_fprint(
+     summary_handle_t *summary_handle,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	summary_run_time_bucket_t *bucket  = NULL;
+	summary_run_time_bucket_t *buckets = NULL;
+	static char *function              = "summary_handle_run_time_histogram_fprint";
+	size_t string_length               = 0;
+	int bucket_index                   = 0;
+	int number_of_buckets              = 0;
+	int result                         = 1;
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->run_time_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid summary handle - missing run time histogram.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_run_time_histogram_get_number_of_entries(
+	     summary_handle->run_time_histogram,
+	     &number_of_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_buckets > 0 )
+	{
+		if( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( summary_run_time_bucket_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of buckets value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		buckets = (summary_run_time_bucket_t *) memory_allocate(
+		                                         sizeof( summary_run_time_bucket_t ) * (size_t) number_of_buckets );
+
+		if( buckets == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buckets.",
+			 function );
+
+			goto on_error;
+		}
+		for( bucket_index = 0;
+		     bucket_index < number_of_buckets;
+		     bucket_index++ )
+		{
+			bucket = &( buckets[ bucket_index ] );
+
+			if( libscca_run_time_histogram_get_entry(
+			     summary_handle->run_time_histogram,
+			     bucket_index,
+			     bucket->executable_filename,
+			     LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+			     &( bucket->prefetch_hash ),
+			     &( bucket->start_time ),
+			     &( bucket->number_of_runs ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve bucket: %d.",
+				 function,
+				 bucket_index );
+
+				goto on_error;
+			}
+		}
+		/* Only the aggregated buckets are sorted, not the individual runs
+		 */
+		qsort(
+		 buckets,
+		 (size_t) number_of_buckets,
+		 sizeof( summary_run_time_bucket_t ),
+		 (int (*)(const void *, const void *)) &summary_run_time_bucket_compare );
+	}
+	if( output_buffer_append_narrow_string(
+	     output_buffer,
+	     "Runs by time bucket:\n",
+	     error ) != 1 )
+	{
+		result = -1;
+	}
+	for( bucket_index = 0;
+	     ( result == 1 ) && ( bucket_index < number_of_buckets );
+	     bucket_index++ )
+	{
+		bucket = &( buckets[ bucket_index ] );
+
+		string_length = narrow_string_length(
+		                 (char *) bucket->executable_filename );
+
+		if( ( output_buffer_append_character(
+		       output_buffer,
+		       '\t',
+		       error ) != 1 )
+		 || ( output_buffer_append_filetime(
+		       output_buffer,
+		       bucket->start_time,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\t',
+		       error ) != 1 )
+		 || ( output_buffer_append_decimal(
+		       output_buffer,
+		       bucket->number_of_runs,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\t',
+		       error ) != 1 )
+		 || ( output_buffer_append_hexadecimal_32bit(
+		       output_buffer,
+		       bucket->prefetch_hash,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\t',
+		       error ) != 1 )
+		 || ( output_buffer_append_string(
+		       output_buffer,
+		       (char *) bucket->executable_filename,
+		       string_length,
+		       error ) != 1 )
+		 || ( output_buffer_append_character(
+		       output_buffer,
+		       '\n',
+		       error ) != 1 ) )
+		{
+			result = -1;
+		}
+		if( ( result == 1 )
+		 && ( output_buffer->data_offset >= OUTPUT_BUFFER_INITIAL_DATA_SIZE ) )
+		{
+			result = output_buffer_write(
+			          output_buffer,
+			          stream,
+			          error );
+		}
+	}
+	if( result == 1 )
+	{
+		result = output_buffer_append_character(
+		          output_buffer,
+		          '\n',
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print runs by time bucket.",
+		 function );
+
+		goto on_error;
+	}
+	if( buckets != NULL )
+	{
+		memory_free(
+		 buckets );
+	}
+	return( 1 );
+
+on_error:
+	if( buckets != NULL )
+	{
+		memory_free(
+		 buckets );
+	}
+	return( -1 );
+}
+
+/* Prints the summary
+ * Returns 1 if successful or -1 on error
+ */
+int summary_handle_fprint(
+     summary_handle_t *summary_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	output_buffer_t *output_buffer = NULL;
+	static char *function          = "summary_handle_fprint";
+	uint64_t number_of_filenames   = 0;
+
+	if( summary_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid summary handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( summary_handle->filenames_sketch != NULL )
+	{
+		if( frequency_sketch_get_number_of_distinct_keys(
+		     summary_handle->filenames_sketch,
+		     &number_of_filenames,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve estimated number of distinct filenames.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		number_of_filenames = (uint64_t) summary_handle->filenames_table->number_of_entries;
+	}
+	if( output_buffer_initialize(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "Summary:\n\tNumber of files\t\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) summary_handle->number_of_files,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n\tNumber of executables\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) summary_handle->executables_table->number_of_entries,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n\tNumber of distinct filenames\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       number_of_filenames,
+	       error ) != 1 )
+	 || ( ( summary_handle->filenames_sketch != NULL )
+	  &&  ( output_buffer_append_narrow_string(
+	         output_buffer,
+	         " (estimated)",
+	         error ) != 1 ) )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n\tNumber of volumes\t\t: ",
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) summary_handle->volumes_table->number_of_entries,
+	       error ) != 1 )
+	 || ( output_buffer_append_narrow_string(
+	       output_buffer,
+	       "\n\n",
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append summary information.",
+		 function );
+
+		goto on_error;
+	}
+	/* The executables are printed as: run count, number of files and executable filename
+	 */
+	if( summary_handle_table_fprint(
+	     summary_handle->executables_table,
+	     "Executables by run count",
+	     1,
+	     0,
+	     output_buffer,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print executables.",
+		 function );
+
+		goto on_error;
+	}
+	/* With a filenames sketch the most common and rarest filenames are printed as:
+	 * estimated number of files and filename
+	 */
+	if( summary_handle->filenames_sketch != NULL )
+	{
+		if( frequency_sketch_table_fprint(
+		     summary_handle->filenames_sketch->heavy_hitters,
+		     "Most common filenames by estimated number of files",
+		     summary_handle->filenames_sketch->number_of_entries,
+		     output_buffer,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print most common filenames.",
+			 function );
+
+			goto on_error;
+		}
+		frequency_sketch_rare_candidates_refresh(
+		 summary_handle->filenames_sketch );
+
+		if( frequency_sketch_table_fprint(
+		     summary_handle->filenames_sketch->rare_candidates,
+		     "Rarest filenames by estimated number of files",
+		     summary_handle->filenames_sketch->number_of_entries,
+		     output_buffer,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print rarest filenames.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( summary_handle_table_fprint(
+	          summary_handle->filenames_table,
+	          "Filenames by number of files",
+	          0,
+	          0,
+	          output_buffer,
+	          stream,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print filenames.",
+		 function );
+
+		goto on_error;
+	}
+	if( summary_handle_table_fprint(
+	     summary_handle->volumes_table,
+	     "Volumes by serial number",
+	     0,
+	     1,
+	     output_buffer,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( summary_handle->run_time_histogram != NULL )
+	{
+		if( summary_handle_run_time_histogram_fprint(
+		     summary_handle,
+		     output_buffer,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print run time histogram.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_write(
+	     output_buffer,
+	     stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_free(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
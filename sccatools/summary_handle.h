@@ -0,0 +1,331 @@
+/*
+ * Summary handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SUMMARY_HANDLE_H )
+#define _SUMMARY_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "frequency_sketch.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of buckets of a summary table, must be a power of 2
+ */
+#define SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS		1024
+
+/* The maximum number of buckets of a summary table
+ */
+#define SUMMARY_TABLE_MAXIMUM_NUMBER_OF_BUCKETS		( 1 << 24 )
+
+typedef struct summary_entry summary_entry_t;
+
+struct summary_entry
+{
+	/* The next entry in the same bucket
+	 */
+	summary_entry_t *next_entry;
+
+	/* The hash of the key
+	 */
+	uint32_t hash;
+
+	/* The key, stored directly after the entry
+	 */
+	uint8_t *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The aggregated value, such as the total run count
+	 */
+	uint64_t value;
+
+	/* The number of files the key appears in
+	 */
+	int number_of_files;
+
+	/* The index of the last file the key was counted for
+	 */
+	int last_file_index;
+};
+
+typedef struct summary_table summary_table_t;
+
+struct summary_table
+{
+	/* The buckets
+	 */
+	summary_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+typedef struct summary_record summary_record_t;
+
+struct summary_record
+{
+	/* The UTF-8 encoded executable filename
+	 */
+	uint8_t *executable_filename;
+
+	/* The executable filename size
+	 */
+	size_t executable_filename_size;
+
+	/* The allocated executable filename size
+	 */
+	size_t allocated_executable_filename_size;
+
+	/* The run count
+	 */
+	uint32_t run_count;
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The last run times that are set, which contain FILETIME values
+	 */
+	uint64_t last_run_times[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	/* The number of last run times
+	 */
+	int number_of_last_run_times;
+
+	/* The UTF-8 encoded filenames packed into a single buffer
+	 */
+	uint8_t *filenames;
+
+	/* The filenames size
+	 */
+	size_t filenames_size;
+
+	/* The allocated filenames size
+	 */
+	size_t allocated_filenames_size;
+
+	/* The offsets of the filenames
+	 */
+	size_t *filename_offsets;
+
+	/* The number of filenames
+	 */
+	int number_of_filenames;
+
+	/* The number of allocated filename offsets
+	 */
+	int number_of_allocated_filename_offsets;
+
+	/* The volume serial numbers
+	 */
+	uint32_t *volume_serial_numbers;
+
+	/* The number of volumes
+	 */
+	int number_of_volumes;
+
+	/* The number of allocated volume serial numbers
+	 */
+	int number_of_allocated_volume_serial_numbers;
+};
+
+typedef struct summary_run_time_bucket summary_run_time_bucket_t;
+
+struct summary_run_time_bucket
+{
+	/* The UTF-8 encoded executable filename
+	 */
+	uint8_t executable_filename[ LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE ];
+
+	/* The prefetch hash
+	 */
+	uint32_t prefetch_hash;
+
+	/* The start time of the bucket, which contains a FILETIME value
+	 */
+	uint64_t start_time;
+
+	/* The number of runs
+	 */
+	uint64_t number_of_runs;
+};
+
+typedef struct summary_handle summary_handle_t;
+
+struct summary_handle
+{
+	/* The executables by executable filename
+	 */
+	summary_table_t *executables_table;
+
+	/* The loaded filenames
+	 */
+	summary_table_t *filenames_table;
+
+	/* The frequency sketch of the loaded filenames, contains NULL if not set
+	 * If set the filenames are counted in the sketch instead of the filenames table
+	 */
+	frequency_sketch_t *filenames_sketch;
+
+	/* The volumes by serial number
+	 */
+	summary_table_t *volumes_table;
+
+	/* The run time histogram of the executables, contains NULL if not set
+	 */
+	libscca_run_time_histogram_t *run_time_histogram;
+
+	/* The record used to read a file in sequential mode
+	 */
+	summary_record_t *record;
+
+	/* The number of files aggregated
+	 */
+	int number_of_files;
+};
+
+uint32_t summary_table_calculate_hash(
+          const uint8_t *key,
+          size_t key_size );
+
+int summary_table_initialize(
+     summary_table_t **summary_table,
+     libcerror_error_t **error );
+
+int summary_table_free(
+     summary_table_t **summary_table,
+     libcerror_error_t **error );
+
+int summary_table_resize(
+     summary_table_t *summary_table,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error );
+
+int summary_table_get_entry_by_key(
+     summary_table_t *summary_table,
+     const uint8_t *key,
+     size_t key_size,
+     summary_entry_t **summary_entry,
+     libcerror_error_t **error );
+
+int summary_table_compare_entries(
+     const summary_entry_t **first_entry,
+     const summary_entry_t **second_entry );
+
+int summary_table_get_sorted_entries(
+     summary_table_t *summary_table,
+     summary_entry_t ***sorted_entries,
+     libcerror_error_t **error );
+
+int summary_run_time_bucket_compare(
+     const summary_run_time_bucket_t *first_bucket,
+     const summary_run_time_bucket_t *second_bucket );
+
+int summary_record_initialize(
+     summary_record_t **summary_record,
+     libcerror_error_t **error );
+
+int summary_record_free(
+     summary_record_t **summary_record,
+     libcerror_error_t **error );
+
+int summary_record_read_file(
+     summary_record_t *summary_record,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+int summary_handle_initialize(
+     summary_handle_t **summary_handle,
+     libcerror_error_t **error );
+
+int summary_handle_free(
+     summary_handle_t **summary_handle,
+     libcerror_error_t **error );
+
+int summary_handle_set_filenames_sketch(
+     summary_handle_t *summary_handle,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int summary_handle_set_run_time_bucket_width(
+     summary_handle_t *summary_handle,
+     uint64_t bucket_width,
+     libcerror_error_t **error );
+
+int summary_handle_append_record(
+     summary_handle_t *summary_handle,
+     summary_record_t *summary_record,
+     libcerror_error_t **error );
+
+int summary_handle_append_file(
+     summary_handle_t *summary_handle,
+     libscca_file_t *file,
+     libcerror_error_t **error );
+
+int summary_handle_table_append(
+     summary_handle_t *summary_handle,
+     summary_table_t *summary_table,
+     const uint8_t *key,
+     size_t key_size,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int summary_handle_table_fprint(
+     summary_table_t *summary_table,
+     const char *description,
+     int print_value,
+     int key_is_serial_number,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int summary_handle_run_time_histogram_fprint(
+     summary_handle_t *summary_handle,
+     output_buffer_t *output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int summary_handle_fprint(
+     summary_handle_t *summary_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SUMMARY_HANDLE_H ) */
+
@@ -0,0 +1,953 @@
+/*
+ * Watch handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "output_buffer.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libcnotify.h"
+#include "sccatools_libscca.h"
+#include "watch_handle.h"
+
+/* Creates a watch handle
+ * Make sure the value watch_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_initialize(
+     watch_handle_t **watch_handle,
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_initialize";
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *watch_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid watch handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	*watch_handle = memory_allocate_structure(
+	                 watch_handle_t );
+
+	if( *watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *watch_handle,
+	     0,
+	     sizeof( watch_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear watch handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *watch_handle )->info_handle = info_handle;
+
+	return( 1 );
+
+on_error:
+	if( *watch_handle != NULL )
+	{
+		memory_free(
+		 *watch_handle );
+
+		*watch_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a watch handle
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_free(
+     watch_handle_t **watch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_free";
+	int result            = 1;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *watch_handle != NULL )
+	{
+		if( ( *watch_handle )->watcher != NULL )
+		{
+			if( libscca_watcher_free(
+			     &( ( *watch_handle )->watcher ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free watcher.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *watch_handle );
+
+		*watch_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the watch handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_signal_abort(
+     watch_handle_t *watch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_signal_abort";
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	watch_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the directory to watch
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_open(
+     watch_handle_t *watch_handle,
+     const system_character_t *directory_path,
+     uint32_t debounce_time,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_open";
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( watch_handle->watcher != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid watch handle - watcher value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: watching a directory is not supported with wide system character paths.",
+	 function );
+
+	return( -1 );
+#else
+	/* The memory-mapped access is not used since every file is opened only once per change
+	 */
+	if( libscca_watcher_initialize(
+	     &( watch_handle->watcher ),
+	     directory_path,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create watcher.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_watcher_set_debounce_time(
+	     watch_handle->watcher,
+	     debounce_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set debounce time.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( watch_handle->watcher != NULL )
+	{
+		libscca_watcher_free(
+		 &( watch_handle->watcher ),
+		 NULL );
+	}
+	return( -1 );
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+}
+
+/* Appends the filenames of the entries of a specific diff entry type as an array to the output buffer
+ * The file is the file for added entries and the previous file for removed entries
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_filenames_append(
+     watch_handle_t *watch_handle,
+     libscca_file_t *file,
+     libscca_diff_t *diff,
+     int entry_type,
+     libcerror_error_t **error )
+{
+	output_buffer_t *output_buffer = NULL;
+	uint8_t *utf8_string           = NULL;
+	static char *function          = "watch_handle_filenames_append";
+	size_t utf8_string_size        = 0;
+	int entry_index                = 0;
+	int item_index                 = 0;
+	int number_of_entries          = 0;
+	int result                     = 0;
+	int volume_index               = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer = watch_handle->info_handle->output_buffer;
+
+	if( output_buffer_append_character(
+	     output_buffer,
+	     '[',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array start.",
+		 function );
+
+		goto on_error;
+	}
+	if( diff != NULL )
+	{
+		if( libscca_diff_get_number_of_entries(
+		     diff,
+		     entry_type,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of diff entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_diff_get_entry(
+		     diff,
+		     entry_type,
+		     entry_index,
+		     &volume_index,
+		     &item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve diff entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filename_size(
+		     file,
+		     item_index,
+		     &utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d size.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid filename: %d size value out of bounds.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( libscca_file_get_utf8_filename(
+		     file,
+		     item_index,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		result = 1;
+
+		if( entry_index > 0 )
+		{
+			result = output_buffer_append_character(
+			          output_buffer,
+			          ',',
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_quoted_string(
+			          output_buffer,
+			          utf8_string,
+			          utf8_string_size - 1,
+			          OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+			          error );
+		}
+		memory_free(
+		 utf8_string );
+
+		utf8_string = NULL;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+	}
+	if( output_buffer_append_character(
+	     output_buffer,
+	     ']',
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array end.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
+
+/* Appends a JSON Lines record of the new runs of a changed file to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_record_append(
+     watch_handle_t *watch_handle,
+     const char *filename,
+     libscca_file_t *file,
+     libscca_diff_t *diff,
+     libscca_file_t *previous_file,
+     const uint64_t *filetimes,
+     int number_of_filetimes,
+     libcerror_error_t **error )
+{
+	info_handle_t file_info_handle;
+
+	output_buffer_t *output_buffer = NULL;
+	static char *function          = "watch_handle_record_append";
+	uint32_t prefetch_hash         = 0;
+	uint32_t run_count             = 0;
+	int filetime_index             = 0;
+	int result                     = 0;
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( watch_handle->info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid watch handle - missing info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetimes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetimes.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer = watch_handle->info_handle->output_buffer;
+
+	if( libscca_file_get_prefetch_hash(
+	     file,
+	     &prefetch_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_run_count(
+	     file,
+	     &run_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve run count.",
+		 function );
+
+		return( -1 );
+	}
+	/* The executable filename is appended using a copy of the info handle
+	 */
+	if( memory_copy(
+	     &file_info_handle,
+	     watch_handle->info_handle,
+	     sizeof( info_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy info handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_info_handle.input_file = file;
+
+	if( ( output_buffer_append_string(
+	       output_buffer,
+	       "{\"source\":",
+	       10,
+	       error ) != 1 )
+	 || ( output_buffer_append_quoted_string(
+	       output_buffer,
+	       (uint8_t *) filename,
+	       narrow_string_length(
+	        filename ),
+	       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       ",\"prefetch_hash\":\"",
+	       18,
+	       error ) != 1 )
+	 || ( output_buffer_append_hexadecimal_32bit(
+	       output_buffer,
+	       prefetch_hash,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       "\",\"executable_filename\":",
+	       24,
+	       error ) != 1 )
+	 || ( info_handle_executable_filename_append(
+	       &file_info_handle,
+	       OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	       1,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       ",\"run_count\":",
+	       13,
+	       error ) != 1 )
+	 || ( output_buffer_append_decimal(
+	       output_buffer,
+	       (uint64_t) run_count,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       ",\"new_last_run_times\":[",
+	       23,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		return( -1 );
+	}
+	for( filetime_index = 0;
+	     filetime_index < number_of_filetimes;
+	     filetime_index++ )
+	{
+		result = 1;
+
+		if( filetime_index > 0 )
+		{
+			result = output_buffer_append_character(
+			          output_buffer,
+			          ',',
+			          error );
+		}
+		if( result == 1 )
+		{
+			result = output_buffer_append_decimal(
+			          output_buffer,
+			          filetimes[ filetime_index ],
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append new last run time: %d.",
+			 function,
+			 filetime_index );
+
+			return( -1 );
+		}
+	}
+	/* The filenames are only compared when the previous version of the file is known
+	 */
+	if( ( output_buffer_append_string(
+	       output_buffer,
+	       "],\"added_filenames\":",
+	       20,
+	       error ) != 1 )
+	 || ( watch_handle_filenames_append(
+	       watch_handle,
+	       file,
+	       diff,
+	       LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       ",\"removed_filenames\":",
+	       21,
+	       error ) != 1 )
+	 || ( watch_handle_filenames_append(
+	       watch_handle,
+	       previous_file,
+	       diff,
+	       LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_FILENAME,
+	       error ) != 1 )
+	 || ( output_buffer_append_string(
+	       output_buffer,
+	       "}\n",
+	       2,
+	       error ) != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints a record of the new runs of a changed file
+ * Callback function for libscca_watcher_wait
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_watcher_callback(
+     const char *filename,
+     libscca_file_t *previous_file,
+     libscca_file_t *file,
+     libscca_diff_t *diff,
+     void *callback_arguments )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	libcerror_error_t *error     = NULL;
+	watch_handle_t *watch_handle = NULL;
+	static char *function        = "watch_handle_watcher_callback";
+	int number_of_filetimes      = 0;
+	int result                   = 0;
+
+	if( callback_arguments == NULL )
+	{
+		return( -1 );
+	}
+	watch_handle = (watch_handle_t *) callback_arguments;
+
+	result = info_handle_file_matches(
+	          watch_handle->info_handle,
+	          file,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to match filenames.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	if( diff != NULL )
+	{
+		if( libscca_diff_get_new_last_run_times(
+		     diff,
+		     filetimes,
+		     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+		     &number_of_filetimes,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve new last run times.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* Without the previous version of the file only the most recent run,
+		 * which caused the file to be written, is known to be new
+		 */
+		if( libscca_file_get_last_run_times(
+		     file,
+		     filetimes,
+		     LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+		     &number_of_filetimes,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last run times.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( number_of_filetimes > 0 )
+		 && ( filetimes[ 0 ] != 0 ) )
+		{
+			number_of_filetimes = 1;
+		}
+		else
+		{
+			number_of_filetimes = 0;
+		}
+	}
+	/* A file that was rewritten without a new run is not printed
+	 */
+	if( number_of_filetimes == 0 )
+	{
+		return( 1 );
+	}
+	if( watch_handle_record_append(
+	     watch_handle,
+	     filename,
+	     file,
+	     diff,
+	     previous_file,
+	     filetimes,
+	     number_of_filetimes,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append record.",
+		 function );
+
+		goto on_error;
+	}
+	if( output_buffer_write(
+	     watch_handle->info_handle->output_buffer,
+	     watch_handle->info_handle->notify_stream,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		goto on_error;
+	}
+	watch_handle->info_handle->output_buffer->data_offset = 0;
+
+	watch_handle->number_of_records += 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* Discard a partial record
+	 */
+	watch_handle->info_handle->output_buffer->data_offset = 0;
+
+	return( -1 );
+}
+
+/* Watches the directory until abort is signalled
+ * Returns 1 if successful or -1 on error
+ */
+int watch_handle_run(
+     watch_handle_t *watch_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "watch_handle_run";
+
+	if( watch_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid watch handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( watch_handle->watcher == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid watch handle - missing watcher.",
+		 function );
+
+		return( -1 );
+	}
+	while( watch_handle->abort == 0 )
+	{
+		if( libscca_watcher_wait(
+		     watch_handle->watcher,
+		     WATCH_HANDLE_ABORT_CHECK_INTERVAL,
+		     &watch_handle_watcher_callback,
+		     (void *) watch_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for changes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,118 @@
+/*
+ * Watch handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _WATCH_HANDLE_H )
+#define _WATCH_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "sccatools_libcerror.h"
+#include "sccatools_libscca.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The time in milliseconds after which the watch loop checks if abort was signalled
+ */
+#define WATCH_HANDLE_ABORT_CHECK_INTERVAL	1000
+
+/* The default time in milliseconds a file must not have changed before it is processed
+ */
+#define WATCH_HANDLE_DEFAULT_DEBOUNCE_TIME	500
+
+typedef struct watch_handle watch_handle_t;
+
+struct watch_handle
+{
+	/* The info handle, used to format the records
+	 */
+	info_handle_t *info_handle;
+
+	/* The libscca watcher
+	 */
+	libscca_watcher_t *watcher;
+
+	/* The number of records printed
+	 */
+	uint64_t number_of_records;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int watch_handle_initialize(
+     watch_handle_t **watch_handle,
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int watch_handle_free(
+     watch_handle_t **watch_handle,
+     libcerror_error_t **error );
+
+int watch_handle_signal_abort(
+     watch_handle_t *watch_handle,
+     libcerror_error_t **error );
+
+int watch_handle_open(
+     watch_handle_t *watch_handle,
+     const system_character_t *directory_path,
+     uint32_t debounce_time,
+     libcerror_error_t **error );
+
+int watch_handle_filenames_append(
+     watch_handle_t *watch_handle,
+     libscca_file_t *file,
+     libscca_diff_t *diff,
+     int entry_type,
+     libcerror_error_t **error );
+
+int watch_handle_record_append(
+     watch_handle_t *watch_handle,
+     const char *filename,
+     libscca_file_t *file,
+     libscca_diff_t *diff,
+     libscca_file_t *previous_file,
+     const uint64_t *filetimes,
+     int number_of_filetimes,
+     libcerror_error_t **error );
+
+int watch_handle_watcher_callback(
+     const char *filename,
+     libscca_file_t *previous_file,
+     libscca_file_t *file,
+     libscca_diff_t *diff,
+     void *callback_arguments );
+
+int watch_handle_run(
+     watch_handle_t *watch_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _WATCH_HANDLE_H ) */
+
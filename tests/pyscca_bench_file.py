@@ -0,0 +1,375 @@
+#!/usr/bin/env python
+#
+# Benchmarks the ways to open files and retrieve their values with pyscca
+#
+# Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import glob
+import io
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+import pyscca
+
+
+timer = getattr(time, "perf_counter", time.time)
+
+
+def OpenPath(path, data):
+  """Opens a file by its path."""
+  return pyscca.open(path)
+
+
+def OpenBytesIO(path, data):
+  """Opens a file from a BytesIO file-like object that is read at once."""
+  return pyscca.open_file_object(io.BytesIO(data))
+
+
+def OpenBytesIOWithoutReadAhead(path, data):
+  """Opens a file from a BytesIO file-like object with a callback per read."""
+  return pyscca.open_file_object(io.BytesIO(data), read_ahead_size=0)
+
+
+def OpenFileObject(path, data):
+  """Opens a file from a file object that is read at once."""
+  with open(path, "rb") as file_object:
+    return pyscca.open_file_object(file_object)
+
+
+def OpenFileObjectWithoutReadAhead(path, data):
+  """Opens a file from a file object with a callback per read."""
+  with open(path, "rb") as file_object:
+    return pyscca.open_file_object(file_object, read_ahead_size=0)
+
+
+def OpenBytes(path, data):
+  """Opens a file from bytes."""
+  return pyscca.open_bytes(data)
+
+
+# The open benchmarks, every file is opened, its executable filename and
+# number of filenames are retrieved and it is closed again.
+OPEN_BENCHMARKS = [
+    ("open", OpenPath),
+    ("open_file_object_bytesio", OpenBytesIO),
+    ("open_file_object_bytesio_no_read_ahead", OpenBytesIOWithoutReadAhead),
+    ("open_file_object_file", OpenFileObject),
+    ("open_file_object_file_no_read_ahead", OpenFileObjectWithoutReadAhead),
+    ("open_bytes", OpenBytes)]
+
+
+def GetFilenamesPerEntry(scca_file):
+  """Retrieves the filenames one at a time."""
+  number_of_filenames = scca_file.get_number_of_filenames()
+  for filename_index in range(number_of_filenames):
+    _ = scca_file.get_filename(filename_index)
+  return number_of_filenames
+
+
+def GetFilenamesBulk(scca_file):
+  """Retrieves the filenames as a tuple."""
+  return len(scca_file.get_filenames_tuple())
+
+
+def GetFileMetricsPerEntry(scca_file):
+  """Retrieves the file metrics entries and their values one at a time."""
+  number_of_entries = scca_file.get_number_of_file_metrics_entries()
+  for entry_index in range(number_of_entries):
+    file_metrics = scca_file.get_file_metrics_entry(entry_index)
+    _ = file_metrics.filename
+    _ = file_metrics.file_reference
+  return number_of_entries
+
+
+def GetFileMetricsBulk(scca_file):
+  """Retrieves the file metrics entries as records."""
+  records = scca_file.get_file_metrics_records()
+  for record in records:
+    _ = record.filename
+    _ = record.file_reference
+  return len(records)
+
+
+def GetVolumesPerEntry(scca_file):
+  """Retrieves the volumes and their values one at a time."""
+  number_of_volumes = scca_file.get_number_of_volumes()
+  for volume_index in range(number_of_volumes):
+    volume_information = scca_file.get_volume_information(volume_index)
+    _ = volume_information.device_path
+    _ = volume_information.serial_number
+  return number_of_volumes
+
+
+def GetVolumesBulk(scca_file):
+  """Retrieves the volumes as records."""
+  records = scca_file.get_volume_records()
+  for record in records:
+    _ = record.device_path
+    _ = record.serial_number
+  return len(records)
+
+
+# The accessor benchmarks, every file is opened from bytes before the
+# accessor is timed, since bulk accessors cache their values until close.
+ACCESSOR_BENCHMARKS = [
+    ("filenames_per_entry", GetFilenamesPerEntry),
+    ("filenames_bulk", GetFilenamesBulk),
+    ("file_metrics_per_entry", GetFileMetricsPerEntry),
+    ("file_metrics_bulk", GetFileMetricsBulk),
+    ("volumes_per_entry", GetVolumesPerEntry),
+    ("volumes_bulk", GetVolumesBulk)]
+
+
+def GetPercentile(values, percentile):
+  """Retrieves a percentile of sorted values.
+
+  Args:
+    values (list[int]): sorted values.
+    percentile (int): percentile.
+
+  Returns:
+    int: value of the percentile.
+  """
+  index = ((len(values) - 1) * percentile) // 100
+  return values[index]
+
+
+def GenerateCorpus(generator, path, number_of_files):
+  """Generates a synthetic corpus.
+
+  Args:
+    generator (str): path of the scca_generate executable.
+    path (str): path of the directory to generate the corpus in.
+    number_of_files (int): number of files to generate.
+
+  Returns:
+    list[str]: paths of the generated files.
+
+  Raises:
+    RuntimeError: if the generator failed.
+  """
+  arguments = [
+      generator, "-n", "{0:d}".format(number_of_files), "-s", "1", "-m", "256",
+      "-f", "256", "-v", "2", os.path.join(path, "corpus")]
+
+  with open(os.devnull, "wb") as null_file:
+    result = subprocess.call(arguments, stdout=null_file)
+
+  if result != 0:
+    raise RuntimeError("generator failed with: {0:d}".format(result))
+
+  return sorted(glob.glob(os.path.join(path, "corpus*.pf")))
+
+
+def RunOpenBenchmark(function, corpus, iterations):
+  """Runs an open benchmark.
+
+  Args:
+    function (function): function that opens a file.
+    corpus (list[tuple[str, bytes]]): paths and data of the files.
+    iterations (int): number of passes over the corpus.
+
+  Returns:
+    tuple[list[int], int]: sorted nanoseconds per pass and number of entries
+        per pass.
+  """
+  values = []
+  number_of_entries = 0
+  for _ in range(iterations):
+    number_of_entries = 0
+
+    start_time = timer()
+    for path, data in corpus:
+      scca_file = function(path, data)
+      _ = scca_file.executable_filename
+      number_of_entries += scca_file.number_of_filenames
+      scca_file.close()
+
+    values.append(int((timer() - start_time) * 1000000000))
+
+  return sorted(values), number_of_entries
+
+
+def RunAccessorBenchmark(function, corpus, iterations):
+  """Runs an accessor benchmark.
+
+  Args:
+    function (function): function that retrieves values and returns the
+        number of entries.
+    corpus (list[tuple[str, bytes]]): paths and data of the files.
+    iterations (int): number of passes over the corpus.
+
+  Returns:
+    tuple[list[int], int]: sorted nanoseconds per pass and number of entries
+        per pass.
+  """
+  values = []
+  number_of_entries = 0
+  for _ in range(iterations):
+    number_of_entries = 0
+    elapsed_time = 0
+
+    for _, data in corpus:
+      scca_file = pyscca.open_bytes(data)
+
+      start_time = timer()
+      number_of_entries += function(scca_file)
+      elapsed_time += timer() - start_time
+
+      scca_file.close()
+
+    values.append(int(elapsed_time * 1000000000))
+
+  return sorted(values), number_of_entries
+
+
+def PrintResult(
+    output_format, benchmark_type, number_of_files, number_of_entries, values):
+  """Prints the result of a benchmark.
+
+  Args:
+    output_format (str): output format, either text or jsonl.
+    benchmark_type (str): benchmark type.
+    number_of_files (int): number of files per pass.
+    number_of_entries (int): number of entries per pass.
+    values (list[int]): sorted nanoseconds per pass.
+  """
+  p50 = max(GetPercentile(values, 50), 1)
+
+  files_per_second = (number_of_files * 1000000000.0) / p50
+  file_ns = p50 // number_of_files
+  entry_ns = 0
+  if number_of_entries > 0:
+    entry_ns = p50 // number_of_entries
+
+  if output_format == "jsonl":
+    sys.stdout.write((
+        "{{\"type\": \"{0:s}\", \"number_of_runs\": {1:d}"
+        ", \"number_of_files\": {2:d}, \"number_of_entries\": {3:d}"
+        ", \"files_per_second\": {4:.1f}, \"file_p50_ns\": {5:d}"
+        ", \"entry_p50_ns\": {6:d}, \"pass_minimum_ns\": {7:d}"
+        ", \"pass_maximum_ns\": {8:d}}}\n").format(
+            benchmark_type, len(values), number_of_files, number_of_entries,
+            files_per_second, file_ns, entry_ns, values[0], values[-1]))
+  else:
+    sys.stdout.write((
+        "{0:s}\n\truns\t\t: {1:d}\n\tfiles\t\t: {2:d}\n\tentries\t\t: {3:d}\n"
+        "\tfiles/second\t: {4:.1f}\n\tper file\t: {5:d} ns\n"
+        "\tper entry\t: {6:d} ns\n\n").format(
+            benchmark_type, len(values), number_of_files, number_of_entries,
+            files_per_second, file_ns, entry_ns))
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      "Benchmarks the ways to open files and retrieve their values with "
+      "pyscca."))
+
+  argument_parser.add_argument(
+      "-g", "--generator", dest="generator", action="store", default=None,
+      metavar="PATH", help=(
+          "path of the scca_generate executable, used to generate a synthetic "
+          "corpus if no sources are specified."))
+
+  argument_parser.add_argument(
+      "-i", "--iterations", dest="iterations", type=int, default=10,
+      help="number of passes over the corpus per benchmark, default is 10.")
+
+  argument_parser.add_argument(
+      "-n", "--number_of_files", dest="number_of_files", type=int,
+      default=64, help=(
+          "number of files of the generated corpus, default is 64."))
+
+  argument_parser.add_argument(
+      "-o", "--output", dest="output_format", choices=["text", "jsonl"],
+      default="text", help="output format, default is text.")
+
+  argument_parser.add_argument(
+      "sources", nargs="*", metavar="PATH", default=[],
+      help="paths of the prefetch files of the corpus.")
+
+  options = argument_parser.parse_args()
+
+  if options.iterations < 1:
+    sys.stderr.write("Unsupported number of iterations.\n")
+    return False
+
+  if not options.sources and not options.generator:
+    sys.stderr.write("Missing sources or generator.\n")
+    return False
+
+  temporary_directory = None
+  sources = options.sources
+
+  try:
+    if not sources:
+      if options.number_of_files < 1:
+        sys.stderr.write("Unsupported number of files.\n")
+        return False
+
+      temporary_directory = tempfile.mkdtemp()
+      sources = GenerateCorpus(
+          options.generator, temporary_directory, options.number_of_files)
+
+    # The data is read before the benchmarks so that the open benchmarks
+    # that do not read from the file system only measure the parsing.
+    corpus = []
+    for path in sources:
+      with open(path, "rb") as file_object:
+        corpus.append((path, file_object.read()))
+
+    if not corpus:
+      sys.stderr.write("Missing corpus.\n")
+      return False
+
+    for benchmark_type, function in OPEN_BENCHMARKS:
+      values, number_of_entries = RunOpenBenchmark(
+          function, corpus, options.iterations)
+      PrintResult(
+          options.output_format, benchmark_type, len(corpus),
+          number_of_entries, values)
+
+    for benchmark_type, function in ACCESSOR_BENCHMARKS:
+      values, number_of_entries = RunAccessorBenchmark(
+          function, corpus, options.iterations)
+      PrintResult(
+          options.output_format, benchmark_type, len(corpus),
+          number_of_entries, values)
+
+  finally:
+    if temporary_directory:
+      shutil.rmtree(temporary_directory, True)
+
+  return True
+
+
+if __name__ == "__main__":
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
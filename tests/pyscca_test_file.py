@@ -21,9 +21,16 @@
 
 import argparse
 import os
+import pickle
 import sys
+import threading
 import unittest
 
+try:
+  import asyncio
+except ImportError:
+  asyncio = None
+
 import pyscca
 
 
@@ -81,6 +88,277 @@ class FileTypeTests(unittest.TestCase):
       with self.assertRaises(ValueError):
         scca_file.open_file_object(file_object, mode="w")
 
+  def test_open_file_object_read_ahead_size(self):
+    """Tests the open_file_object function with a read ahead size."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    number_of_file_metrics_entries = []
+
+    for read_ahead_size in (0, 1, 16 * 1024 * 1024):
+      scca_file = pyscca.file()
+
+      with open(unittest.source, "rb") as file_object:
+        scca_file.open_file_object(
+            file_object, read_ahead_size=read_ahead_size)
+
+        number_of_file_metrics_entries.append(
+            scca_file.get_number_of_file_metrics_entries())
+
+        scca_file.close()
+
+    self.assertEqual(len(set(number_of_file_metrics_entries)), 1)
+
+    with open(unittest.source, "rb") as file_object:
+      with self.assertRaises(ValueError):
+        scca_file.open_file_object(file_object, read_ahead_size=-1)
+
+  def test_open_bytes(self):
+    """Tests the open_bytes function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with open(unittest.source, "rb") as file_object:
+      data = file_object.read()
+
+    scca_file = pyscca.file()
+
+    scca_file.open_bytes(data)
+
+    with self.assertRaises(IOError):
+      scca_file.open_bytes(data)
+
+    scca_file.close()
+
+    scca_file.open_bytes(memoryview(data))
+    scca_file.close()
+
+    with self.assertRaises(TypeError):
+      scca_file.open_bytes(None)
+
+    with self.assertRaises(ValueError):
+      scca_file.open_bytes(data, mode="w")
+
+  def test_open_async(self):
+    """Tests the open_async function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    if asyncio is None or not hasattr(asyncio, "get_running_loop"):
+      raise unittest.SkipTest("missing asyncio")
+
+    with open(unittest.source, "rb") as file_object:
+      data = file_object.read()
+
+    def _OpenAsync(*sources):
+      event_loop = asyncio.new_event_loop()
+      try:
+        futures = []
+        # open_async must be called from within the running event loop.
+        event_loop.call_soon(lambda: futures.extend(
+            pyscca.open_async(source) for source in sources))
+        event_loop.run_until_complete(asyncio.sleep(0))
+        return event_loop.run_until_complete(asyncio.gather(*futures))
+      finally:
+        event_loop.close()
+
+    scca_files = _OpenAsync(unittest.source, data)
+    self.assertEqual(len(scca_files), 2)
+
+    for scca_file in scca_files:
+      self.assertEqual(
+          scca_file.get_number_of_filenames(),
+          scca_files[0].get_number_of_filenames())
+      scca_file.close()
+
+    with self.assertRaises(IOError):
+      _OpenAsync(b"invalid")
+
+    with self.assertRaises(RuntimeError):
+      pyscca.open_async(data)
+
+  def test_get_snapshot(self):
+    """Tests the get_snapshot and open_snapshot functions."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    snapshot = scca_file.get_snapshot()
+    self.assertEqual(len(snapshot), scca_file.get_snapshot_size())
+
+    buffer = bytearray(len(snapshot))
+    self.assertEqual(scca_file.write_snapshot(buffer), len(snapshot))
+    self.assertEqual(bytes(buffer), snapshot)
+
+    with self.assertRaises(ValueError):
+      scca_file.write_snapshot(bytearray(8))
+
+    snapshot_file = pyscca.open_snapshot(snapshot)
+    self.assertEqual(
+        snapshot_file.get_filenames_tuple(), scca_file.get_filenames_tuple())
+    snapshot_file.close()
+
+    with self.assertRaises(IOError):
+      pyscca.open_snapshot(b"invalid")
+
+    scca_file.close()
+
+  def test_pickle(self):
+    """Tests pickling a file."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    unpickled_file = pickle.loads(pickle.dumps(scca_file))
+    self.assertEqual(
+        unpickled_file.executable_filename, scca_file.executable_filename)
+    self.assertEqual(
+        unpickled_file.get_filenames_tuple(), scca_file.get_filenames_tuple())
+    unpickled_file.close()
+
+    scca_file.close()
+
+  def test_to_shared_memory(self):
+    """Tests the to_shared_memory function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    try:
+      from multiprocessing import shared_memory
+    except ImportError:
+      raise unittest.SkipTest("missing multiprocessing.shared_memory")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    shared_memory_object = scca_file.to_shared_memory()
+    try:
+      attached_memory = shared_memory.SharedMemory(
+          name=shared_memory_object.name)
+
+      snapshot_file = pyscca.open_snapshot(attached_memory.buf)
+      self.assertEqual(
+          snapshot_file.get_filenames_tuple(), scca_file.get_filenames_tuple())
+      snapshot_file.close()
+
+      attached_memory.close()
+
+    finally:
+      shared_memory_object.close()
+      shared_memory_object.unlink()
+
+    scca_file.close()
+
+  def test_parse_many(self):
+    """Tests the parse_many function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    scca_file = pyscca.file()
+    scca_file.open(unittest.source)
+
+    executable_filename = scca_file.get_executable_filename()
+    run_count = scca_file.get_run_count()
+
+    scca_file.close()
+
+    records = pyscca.parse_many(
+        [unittest.source, unittest.source, "nonexistent.pf"], workers=2)
+    self.assertEqual(len(records), 3)
+
+    for record in records[:2]:
+      self.assertEqual(record["path"], unittest.source)
+      self.assertIsNone(record["error"])
+      self.assertEqual(record["executable_filename"], executable_filename)
+      self.assertEqual(record["run_count"], run_count)
+      self.assertIsInstance(record["last_run_times"], list)
+      self.assertIsInstance(record["filenames"], list)
+
+    self.assertIsNotNone(records[2]["error"])
+
+    self.assertEqual(pyscca.parse_many([]), [])
+
+    with self.assertRaises(ValueError):
+      pyscca.parse_many([unittest.source], workers=0)
+
+    with self.assertRaises(TypeError):
+      pyscca.parse_many([None])
+
+  def test_parse_directory(self):
+    """Tests the parse_directory function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(unittest.source):
+      raise unittest.SkipTest("source not a regular file")
+
+    directory = os.path.dirname(os.path.abspath(unittest.source))
+
+    records = pyscca.parse_directory(directory, workers=2)
+
+    paths = [record["path"] for record in records]
+    self.assertEqual(paths, sorted(paths))
+
+    if unittest.source.lower().endswith(".pf"):
+      self.assertIn(os.path.abspath(unittest.source), paths)
+
+  def test_open_header_only(self):
+    """Tests the open function with flags and sections."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    prefetch_hash = scca_file.get_prefetch_hash()
+    number_of_filenames = scca_file.get_number_of_filenames()
+    number_of_volumes = scca_file.get_number_of_volumes()
+
+    scca_file.close()
+
+    scca_file.open(unittest.source, flags=pyscca.OPEN_HEADER_ONLY)
+
+    self.assertEqual(scca_file.get_prefetch_hash(), prefetch_hash)
+
+    # The skipped sections are read on first access.
+    self.assertEqual(scca_file.get_number_of_filenames(), number_of_filenames)
+    self.assertEqual(scca_file.get_number_of_volumes(), number_of_volumes)
+
+    scca_file.close()
+
+    scca_file.open(unittest.source, sections=("header", "filenames"))
+
+    self.assertEqual(scca_file.get_number_of_filenames(), number_of_filenames)
+    self.assertEqual(scca_file.get_number_of_volumes(), number_of_volumes)
+
+    scca_file.close()
+
+    with self.assertRaises(ValueError):
+      scca_file.open(unittest.source, sections=("bogus",))
+
+    with self.assertRaises(ValueError):
+      scca_file.open(unittest.source, flags=0)
+
   def test_close(self):
     """Tests the close function."""
     if not unittest.source:
@@ -122,6 +400,57 @@ class FileTypeTests(unittest.TestCase):
         del file_object
         scca_file.close()
 
+  def test_open_close_threaded(self):
+    """Tests the open and close functions from multiple threads."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    results = []
+
+    def _OpenClose():
+      scca_file = pyscca.file()
+
+      scca_file.open(unittest.source)
+
+      results.append(scca_file.get_number_of_file_metrics_entries())
+
+      scca_file.close()
+
+    threads = [threading.Thread(target=_OpenClose) for _ in range(4)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+
+    self.assertEqual(len(results), 4)
+    self.assertEqual(len(set(results)), 1)
+
+  def test_shared_file_threaded(self):
+    """Tests a file that is shared by multiple threads."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source, sections=["file_metrics"])
+
+    results = []
+
+    def _GetFilenames():
+      results.append(scca_file.get_filenames_tuple())
+
+    threads = [threading.Thread(target=_GetFilenames) for _ in range(8)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+
+    self.assertEqual(len(results), 8)
+    for filenames in results:
+      self.assertIs(filenames, results[0])
+
+    scca_file.close()
+
   def test_get_format_version(self):
     """Tests the get_format_version function and format_version property."""
     if not unittest.source:
@@ -202,6 +531,110 @@ class FileTypeTests(unittest.TestCase):
 
     scca_file.close()
 
+  def test_get_file_metrics_table(self):
+    """Tests the get_file_metrics_table function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    file_metrics_table = scca_file.get_file_metrics_table()
+    self.assertIsNotNone(file_metrics_table)
+
+    self.assertEqual(
+        len(file_metrics_table), scca_file.get_number_of_file_metrics_entries())
+
+    file_metrics_columns = scca_file.get_file_metrics_table(columnar=True)
+    self.assertIsNotNone(file_metrics_columns)
+
+    self.assertEqual(sorted(file_metrics_columns.keys()), [
+        "duration", "file_reference", "filename", "flags", "start_time"])
+
+    for column_values in file_metrics_columns.values():
+      self.assertEqual(len(column_values), len(file_metrics_table))
+
+    if file_metrics_table:
+      self.assertEqual(
+          file_metrics_columns["start_time"][0], file_metrics_table[0][0])
+      self.assertEqual(
+          file_metrics_columns["filename"][0], file_metrics_table[0][4])
+
+    raw_file_metrics_table = scca_file.get_file_metrics_table(raw_names=True)
+    self.assertEqual(len(raw_file_metrics_table), len(file_metrics_table))
+
+    for raw_values, values in zip(raw_file_metrics_table, file_metrics_table):
+      self.assertEqual(raw_values[:4], values[:4])
+      if values[4] is None:
+        self.assertIsNone(raw_values[4])
+      else:
+        self.assertEqual(raw_values[4].decode("utf-16-le"), values[4])
+
+    scca_file.close()
+
+  def test_get_file_metrics_records(self):
+    """Tests the get_file_metrics_records function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    file_metrics_records = scca_file.get_file_metrics_records()
+    self.assertIsNotNone(file_metrics_records)
+
+    file_metrics_table = scca_file.get_file_metrics_table()
+    self.assertEqual(len(file_metrics_records), len(file_metrics_table))
+
+    for record, values in zip(file_metrics_records, file_metrics_table):
+      self.assertIsInstance(record, pyscca.file_metrics_record)
+      self.assertEqual(tuple(record), values)
+      self.assertEqual(record.start_time, values[0])
+      self.assertEqual(record.filename, values[4])
+
+    scca_file.close()
+
+  def test_get_file_metrics_arrays(self):
+    """Tests the get_file_metrics_arrays function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    file_metrics_arrays = scca_file.get_file_metrics_arrays()
+    self.assertIsNotNone(file_metrics_arrays)
+
+    self.assertEqual(sorted(file_metrics_arrays.keys()), [
+        "duration", "file_reference", "filename_index", "flags", "start_time"])
+
+    file_metrics_columns = scca_file.get_file_metrics_table(columnar=True)
+
+    for column_name in (
+        "start_time", "duration", "flags", "file_reference"):
+      self.assertEqual(
+          list(file_metrics_arrays[column_name]),
+          file_metrics_columns[column_name])
+
+    scca_file.close()
+
+  def test_get_trace_chain_load_counts_array(self):
+    """Tests the get_trace_chain_load_counts_array function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    load_counts = scca_file.get_trace_chain_load_counts_array()
+    self.assertIsNotNone(load_counts)
+
+    scca_file.close()
+
   def test_get_number_of_filenames(self):
     """Tests the get_number_of_filenames function and number_of_filenames property."""
     if not unittest.source:
@@ -218,6 +651,203 @@ class FileTypeTests(unittest.TestCase):
 
     scca_file.close()
 
+  def test_get_filenames_tuple(self):
+    """Tests the get_filenames_tuple function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    filenames = scca_file.get_filenames_tuple()
+    self.assertIsInstance(filenames, tuple)
+    self.assertEqual(len(filenames), scca_file.get_number_of_filenames())
+
+    self.assertIs(scca_file.get_filenames_tuple(), filenames)
+
+    if filenames:
+      self.assertIs(scca_file.get_filename(0), filenames[0])
+
+    self.assertEqual(list(scca_file.filenames), list(filenames))
+
+    raw_filenames = scca_file.get_filenames_tuple(raw=True)
+    self.assertIsInstance(raw_filenames, tuple)
+    self.assertEqual(len(raw_filenames), len(filenames))
+
+    for raw_filename, filename in zip(raw_filenames, filenames):
+      if filename is None:
+        self.assertIsNone(raw_filename)
+      else:
+        self.assertIsInstance(raw_filename, bytes)
+        self.assertEqual(raw_filename.decode("utf-16-le"), filename)
+
+    scca_file.close()
+
+  def test_iter_filenames(self):
+    """Tests the iter_filenames function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    filenames = scca_file.get_filenames_tuple()
+
+    self.assertEqual(list(scca_file.iter_filenames()), list(filenames))
+
+    if filenames:
+      last_filename = filenames[-1]
+
+      matching_filenames = list(scca_file.iter_filenames(
+          pattern=last_filename.lower()))
+      self.assertIn(last_filename, matching_filenames)
+
+      matching_filenames = list(scca_file.iter_filenames(
+          pattern="*{0:s}".format(last_filename[-4:])))
+      self.assertEqual(matching_filenames, [
+          filename for filename in filenames
+          if filename.upper().endswith(last_filename[-4:].upper())])
+
+      iterator = scca_file.iter_filenames()
+      self.assertEqual(next(iterator), filenames[0])
+
+    self.assertEqual(list(scca_file.iter_filenames(pattern="*")), list(filenames))
+
+    with self.assertRaises(ValueError):
+      scca_file.iter_filenames(pattern="A*B")
+
+    with self.assertRaises(TypeError):
+      scca_file.iter_filenames(pattern=1)
+
+    scca_file.close()
+
+  def test_iter_file_metrics(self):
+    """Tests the iter_file_metrics function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    file_metrics_table = scca_file.get_file_metrics_table()
+
+    file_metrics = list(scca_file.iter_file_metrics())
+    self.assertEqual(len(file_metrics), len(file_metrics_table))
+
+    for file_metrics_entry, values in zip(file_metrics, file_metrics_table):
+      self.assertEqual(file_metrics_entry.filename, values[4])
+
+    if file_metrics_table and file_metrics_table[0][4]:
+      filename = file_metrics_table[0][4]
+
+      file_metrics = list(scca_file.iter_file_metrics(
+          pattern=filename, case_sensitive=True))
+      self.assertEqual(
+          [file_metrics_entry.filename for file_metrics_entry in file_metrics],
+          [values[4] for values in file_metrics_table if values[4] == filename])
+
+    scca_file.close()
+
+  def test_get_last_run_times(self):
+    """Tests the get_last_run_times function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    filetimes = scca_file.get_last_run_times(as_integers=True)
+    self.assertIsInstance(filetimes, list)
+    self.assertLessEqual(len(filetimes), 8)
+    self.assertNotIn(0, filetimes)
+
+    last_run_times = scca_file.get_last_run_times()
+    self.assertEqual(len(last_run_times), len(filetimes))
+
+    last_run_time = scca_file.get_last_run_time_as_integer(0)
+    if last_run_time:
+      self.assertEqual(filetimes[0], last_run_time)
+
+    scca_file.close()
+
+  def test_get_last_run_times_array(self):
+    """Tests the get_last_run_times_array function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    filetimes = scca_file.get_last_run_times_array()
+    self.assertEqual(
+        list(filetimes), scca_file.get_last_run_times(as_integers=True))
+
+    scca_file.close()
+
+  def test_get_stats(self):
+    """Tests the get_stats function and stats property."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    stats = scca_file.get_stats()
+    self.assertIsInstance(stats, dict)
+    self.assertGreater(stats["bytes_read"], 0)
+
+    for key in (
+        "decompressed_blocks", "cache_hits", "cache_misses", "allocations",
+        "allocated_size", "maximum_allocated_size"):
+      self.assertGreaterEqual(stats[key], 0)
+
+    for key in (
+        "file_header_read_time", "file_information_read_time",
+        "file_metrics_read_time", "filenames_read_time", "volumes_read_time",
+        "compressed_header_read_time", "compressed_blocks_read_time",
+        "trace_chain_read_time"):
+      self.assertIn(key, stats)
+
+    self.assertEqual(scca_file.stats["bytes_read"], stats["bytes_read"])
+
+    scca_file.close()
+
+  def test_timestamps_as_integers(self):
+    """Tests the timestamps_as_integers property."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    self.assertFalse(scca_file.timestamps_as_integers)
+
+    filetime = scca_file.get_last_run_time_as_integer(0)
+
+    scca_file.timestamps_as_integers = True
+    self.assertTrue(scca_file.timestamps_as_integers)
+
+    self.assertEqual(scca_file.get_last_run_time(0), filetime)
+    self.assertEqual(
+        scca_file.get_last_run_times(),
+        scca_file.get_last_run_times(as_integers=True))
+
+    posix_times = scca_file.get_last_run_times(as_posix_time=True)
+    for index, value in enumerate(scca_file.get_last_run_times()):
+      self.assertEqual(posix_times[index], (value // 10) - 11644473600000000)
+
+    scca_file.set_timestamps_as_integers(False)
+    self.assertFalse(scca_file.timestamps_as_integers)
+
+    scca_file.close()
+
   def test_get_number_of_volumes(self):
     """Tests the get_number_of_volumes function and number_of_volumes property."""
     if not unittest.source:
@@ -234,6 +864,34 @@ class FileTypeTests(unittest.TestCase):
 
     scca_file.close()
 
+  def test_get_volume_records(self):
+    """Tests the get_volume_records function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    scca_file = pyscca.file()
+
+    scca_file.open(unittest.source)
+
+    volume_records = scca_file.get_volume_records()
+    self.assertIsNotNone(volume_records)
+
+    self.assertEqual(len(volume_records), scca_file.get_number_of_volumes())
+
+    for volume_index, record in enumerate(volume_records):
+      self.assertIsInstance(record, pyscca.volume_record)
+
+      volume_information = scca_file.get_volume_information(volume_index)
+      self.assertEqual(record.device_path, volume_information.device_path)
+      self.assertEqual(record.serial_number, volume_information.serial_number)
+      self.assertEqual(
+          list(record.file_references), volume_information.file_references)
+      self.assertEqual(
+          len(record.directory_strings),
+          volume_information.number_of_directory_strings)
+
+    scca_file.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
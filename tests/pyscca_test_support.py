@@ -35,6 +35,19 @@ class SupportFunctionsTests(unittest.TestCase):
     version = pyscca.get_version()
     self.assertIsNotNone(version)
 
+  def test_type_objects(self):
+    """Tests the type objects, which can be added to the module on first use."""
+    type_object_names = [
+        "file", "file_metrics", "file_metrics_entries", "filenames",
+        "iterator", "parse_cache", "volume_information", "volumes"]
+
+    for name in type_object_names:
+      self.assertIn(name, dir(pyscca))
+      self.assertIsInstance(getattr(pyscca, name), type)
+
+    with self.assertRaises(AttributeError):
+      _ = pyscca.bogus
+
   def test_check_file_signature(self):
     """Tests the check_file_signature function."""
     if not unittest.source:
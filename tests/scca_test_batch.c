@@ -0,0 +1,1206 @@
+/*
+ * Library batch functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libbfio.h"
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#if !defined( LIBSCCA_HAVE_BFIO )
+
+LIBSCCA_EXTERN \
+int libscca_batch_open_file_io_pool(
+     libbfio_pool_t *file_io_pool,
+     int number_of_threads,
+     int maximum_number_of_open_handles,
+     int access_flags,
+     int batch_flags,
+     int (*callback_function)(
+            int entry,
+            libscca_file_t *file,
+            libscca_error_t *error,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libscca_error_t **error );
+
+#endif /* !defined( LIBSCCA_HAVE_BFIO ) */
+
+/* Callback function that records which paths were processed
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_batch_callback(
+     int path_index,
+     libscca_file_t *file,
+     libcerror_error_t *error,
+     void *callback_arguments )
+{
+	int *processed_paths = (int *) callback_arguments;
+
+	if( ( path_index < 0 )
+	 || ( path_index >= 2 ) )
+	{
+		return( -1 );
+	}
+	/* The paths in the test do not exist hence the file should not be opened
+	 */
+	if( ( file != NULL )
+	 || ( error == NULL ) )
+	{
+		return( -1 );
+	}
+	processed_paths[ path_index ] += 1;
+
+	return( 1 );
+}
+
+/* Tests the libscca_batch_open_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_batch_open_paths(
+     void )
+{
+	char *paths[ 2 ]         = {
+		"_scca_test_batch_missing1.pf",
+		"_scca_test_batch_missing2.pf" };
+
+	int processed_paths[ 2 ] = { 0, 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_batch_open_paths(
+	          paths,
+	          2,
+	          2,
+	          LIBSCCA_OPEN_READ,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 0 ]",
+	 processed_paths[ 0 ],
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 1 ]",
+	 processed_paths[ 1 ],
+	 1 );
+
+	result = libscca_batch_open_paths(
+	          paths,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 0 ]",
+	 processed_paths[ 0 ],
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 1 ]",
+	 processed_paths[ 1 ],
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_batch_open_paths(
+	          NULL,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths(
+	          paths,
+	          -1,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths(
+	          paths,
+	          2,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths(
+	          paths,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          NULL,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_batch_open_paths_with_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_batch_open_paths_with_flags(
+     void )
+{
+	char *paths[ 2 ]         = {
+		"_scca_test_batch_missing1.pf",
+		"_scca_test_batch_missing2.pf" };
+
+	int batch_flags[ 3 ]     = {
+		LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY,
+		LIBSCCA_BATCH_FLAG_PIN_THREADS,
+		LIBSCCA_BATCH_FLAG_PIN_THREADS | LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY };
+
+	int processed_paths[ 2 ] = { 0, 0 };
+	libcerror_error_t *error = NULL;
+	int flags_index          = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	for( flags_index = 0;
+	     flags_index < 3;
+	     flags_index++ )
+	{
+		result = libscca_batch_open_paths_with_flags(
+		          paths,
+		          2,
+		          2,
+		          LIBSCCA_OPEN_READ,
+		          batch_flags[ flags_index ],
+		          &scca_test_batch_callback,
+		          (void *) processed_paths,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "processed_paths[ 0 ]",
+		 processed_paths[ 0 ],
+		 flags_index + 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "processed_paths[ 1 ]",
+		 processed_paths[ 1 ],
+		 flags_index + 1 );
+	}
+	/* Test error cases
+	 */
+	result = libscca_batch_open_paths_with_flags(
+	          paths,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0xff,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_batch_open_memory_buffers function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_batch_open_memory_buffers(
+     void )
+{
+	uint8_t data[ 16 ]                 = {
+		0x1e, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	const uint8_t *buffers[ 3 ]        = { data, data, NULL };
+	size_t buffer_sizes[ 3 ]           = { 16, 8, 16 };
+	libscca_batch_result_t results[ 3 ];
+	libcerror_error_t *error           = NULL;
+	int flags_index                    = 0;
+	int result                         = 0;
+	int result_index                   = 0;
+
+	/* Test regular cases
+	 */
+	for( flags_index = 0;
+	     flags_index < 2;
+	     flags_index++ )
+	{
+		for( result_index = 0;
+		     result_index < 3;
+		     result_index++ )
+		{
+			results[ result_index ].result = 0;
+		}
+		result = libscca_batch_open_memory_buffers(
+		          buffers,
+		          buffer_sizes,
+		          3,
+		          2,
+		          LIBSCCA_OPEN_READ,
+		          ( flags_index == 0 ) ? 0 : LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY,
+		          results,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The buffers do not contain a valid file hence every result should indicate the open failed
+		 */
+		for( result_index = 0;
+		     result_index < 3;
+		     result_index++ )
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "results[ result_index ].result",
+			 results[ result_index ].result,
+			 -1 );
+		}
+	}
+	result = libscca_batch_open_memory_buffers(
+	          buffers,
+	          buffer_sizes,
+	          0,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_batch_open_memory_buffers(
+	          NULL,
+	          buffer_sizes,
+	          3,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_memory_buffers(
+	          buffers,
+	          NULL,
+	          3,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_memory_buffers(
+	          buffers,
+	          buffer_sizes,
+	          -1,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_memory_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_memory_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0xff,
+	          results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_memory_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_batch_open_paths_pipelined function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_batch_open_paths_pipelined(
+     void )
+{
+	char *paths[ 2 ]         = {
+		"_scca_test_batch_missing1.pf",
+		"_scca_test_batch_missing2.pf" };
+
+	int processed_paths[ 2 ] = { 0, 0 };
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          1,
+	          2,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 0 ]",
+	 processed_paths[ 0 ],
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 1 ]",
+	 processed_paths[ 1 ],
+	 1 );
+
+	/* Test with a single buffer that is reused for both paths
+	 */
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          2,
+	          1,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 0 ]",
+	 processed_paths[ 0 ],
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 1 ]",
+	 processed_paths[ 1 ],
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_batch_open_paths_pipelined(
+	          NULL,
+	          2,
+	          1,
+	          1,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          -1,
+	          1,
+	          1,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          0,
+	          1,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          1,
+	          0,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          1,
+	          1,
+	          0,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          1,
+	          1,
+	          1,
+	          -1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          1,
+	          1,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          LIBSCCA_BATCH_FLAG_PIN_THREADS,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_paths_pipelined(
+	          paths,
+	          2,
+	          1,
+	          1,
+	          1,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          NULL,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_batch_open_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_batch_open_file_io_pool(
+     void )
+{
+	char *paths[ 2 ]                 = {
+		"_scca_test_batch_missing1.pf",
+		"_scca_test_batch_missing2.pf" };
+
+	int processed_paths[ 2 ]         = { 0, 0 };
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	int entry                        = 0;
+	int path_index                   = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          paths[ path_index ],
+		          narrow_string_length(
+		           paths[ path_index ] ),
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          file_io_pool,
+		          &entry,
+		          file_io_handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_io_handle = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_batch_open_file_io_pool(
+	          file_io_pool,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 0 ]",
+	 processed_paths[ 0 ],
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 1 ]",
+	 processed_paths[ 1 ],
+	 1 );
+
+	result = libscca_batch_open_file_io_pool(
+	          file_io_pool,
+	          2,
+	          0,
+	          LIBSCCA_OPEN_READ,
+	          LIBSCCA_BATCH_FLAG_SPLIT_BY_LOCALITY,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 0 ]",
+	 processed_paths[ 0 ],
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "processed_paths[ 1 ]",
+	 processed_paths[ 1 ],
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_batch_open_file_io_pool(
+	          NULL,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_file_io_pool(
+	          file_io_pool,
+	          0,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_file_io_pool(
+	          file_io_pool,
+	          2,
+	          -1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_file_io_pool(
+	          file_io_pool,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0xff,
+	          &scca_test_batch_callback,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_batch_open_file_io_pool(
+	          file_io_pool,
+	          2,
+	          1,
+	          LIBSCCA_OPEN_READ,
+	          0,
+	          NULL,
+	          (void *) processed_paths,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_batch_open_paths",
+	 scca_test_batch_open_paths )
+
+	SCCA_TEST_RUN(
+	 "libscca_batch_open_paths_with_flags",
+	 scca_test_batch_open_paths_with_flags )
+
+	SCCA_TEST_RUN(
+	 "libscca_batch_open_memory_buffers",
+	 scca_test_batch_open_memory_buffers )
+
+	SCCA_TEST_RUN(
+	 "libscca_batch_open_paths_pipelined",
+	 scca_test_batch_open_paths_pipelined )
+
+	SCCA_TEST_RUN(
+	 "libscca_batch_open_file_io_pool",
+	 scca_test_batch_open_file_io_pool )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1068 @@
+/*
+ * Library block cache functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_block_cache.h"
+
+/* Tests the libscca_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_block_cache_t *block_cache = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_block_cache_initialize(
+	          &block_cache,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_block_cache_initialize(
+	          NULL,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libscca_block_cache_t *) 0x12345678UL;
+
+	result = libscca_block_cache_initialize(
+	          &block_cache,
+	          65536,
+	          &error );
+
+	block_cache = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_initialize(
+	          &block_cache,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libscca_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_block_cache_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_block_cache_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_block_cache_get_statistics(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_block_cache_t *block_cache = NULL;
+	size64_t size                      = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_block_cache_initialize(
+	          &block_cache,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_block_cache_get_statistics(
+	          NULL,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          &size,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          &size,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libscca_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_block_cache_set_data and libscca_block_cache_get_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_block_cache_set_and_get_data(
+     void )
+{
+	uint8_t data[ 16 ];
+	uint8_t uncompressed_data[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_block_cache_t *block_cache = NULL;
+	size64_t size                      = 0;
+	size_t data_size                   = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     uncompressed_data,
+	     'A',
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* The block cache can contain at most 2 entries of 16 bytes
+	 */
+	result = libscca_block_cache_initialize(
+	          &block_cache,
+	          2 * ( sizeof( libscca_block_cache_entry_t ) + 16 ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          16,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          data,
+	          uncompressed_data,
+	          16 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A lookup with a different block offset must not match
+	 */
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          16,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Adding 2 more entries removes the least recently used entry
+	 */
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          16,
+	          32,
+	          16,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          24,
+	          32,
+	          16,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) ( 2 * ( sizeof( libscca_block_cache_entry_t ) + 16 ) ) );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 3 );
+
+	/* Empty data is not cached
+	 */
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          32,
+	          32,
+	          16,
+	          uncompressed_data,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_block_cache_get_data(
+	          NULL,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          NULL,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          data,
+	          16,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_set_data(
+	          NULL,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          16,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          16,
+	          NULL,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libscca_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_block_cache_trim function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_block_cache_trim(
+     void )
+{
+	uint8_t data[ 16 ];
+	uint8_t uncompressed_data[ 16 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_block_cache_t *block_cache = NULL;
+	size64_t size                      = 0;
+	size_t data_size                   = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     uncompressed_data,
+	     'A',
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_block_cache_initialize(
+	          &block_cache,
+	          2 * ( sizeof( libscca_block_cache_entry_t ) + 16 ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          16,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_set_data(
+	          block_cache,
+	          0x8877665544332211ULL,
+	          48,
+	          32,
+	          16,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_block_cache_trim(
+	          block_cache,
+	          sizeof( libscca_block_cache_entry_t ) + 16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) ( sizeof( libscca_block_cache_entry_t ) + 16 ) );
+
+	/* The least recently used entry was removed
+	 */
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x1122334455667788ULL,
+	          8,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_get_data(
+	          block_cache,
+	          0x8877665544332211ULL,
+	          48,
+	          32,
+	          data,
+	          16,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A maximum size of 0 empties the block cache
+	 */
+	result = libscca_block_cache_trim(
+	          block_cache,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_block_cache_get_statistics(
+	          block_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_block_cache_trim(
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libscca_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_block_cache_initialize",
+	 scca_test_block_cache_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_block_cache_free",
+	 scca_test_block_cache_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_block_cache_get_statistics",
+	 scca_test_block_cache_get_statistics );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_block_cache_set_and_get_data",
+	 scca_test_block_cache_set_and_get_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_block_cache_trim",
+	 scca_test_block_cache_trim );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,449 @@
+/*
+ * Library Bloom filter functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_bloom_filter.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Returns a pseudo random 64-bit test hash
+ */
+uint64_t scca_test_bloom_filter_get_hash(
+          uint64_t value )
+{
+	value += 0x9e3779b97f4a7c15ULL;
+	value  = ( value ^ ( value >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	value  = ( value ^ ( value >> 27 ) ) * 0x94d049bb133111ebULL;
+
+	return( value ^ ( value >> 31 ) );
+}
+
+/* Tests the libscca_bloom_filter_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_bloom_filter_get_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t bloom_filter_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_bloom_filter_get_size(
+	          0,
+	          &bloom_filter_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "bloom_filter_size",
+	 bloom_filter_size,
+	 (size_t) 8 );
+
+	result = libscca_bloom_filter_get_size(
+	          100,
+	          &bloom_filter_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "bloom_filter_size",
+	 bloom_filter_size,
+	 (size_t) 128 );
+
+	/* Test error cases
+	 */
+	result = libscca_bloom_filter_get_size(
+	          -1,
+	          &bloom_filter_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_bloom_filter_get_size(
+	          100,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_bloom_filter_build and libscca_bloom_filter_contains_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_bloom_filter_build(
+     void )
+{
+	uint64_t hashes[ 256 ];
+	uint8_t bloom_filter[ 320 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t bloom_filter_size   = 0;
+	int number_of_false_hits   = 0;
+	int result                 = 0;
+	int value_index            = 0;
+
+	for( value_index = 0;
+	     value_index < 256;
+	     value_index++ )
+	{
+		hashes[ value_index ] = scca_test_bloom_filter_get_hash(
+		                         (uint64_t) value_index );
+	}
+	result = libscca_bloom_filter_get_size(
+	          256,
+	          &bloom_filter_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "bloom_filter_size",
+	 bloom_filter_size,
+	 (size_t) 320 );
+
+	/* Test regular cases
+	 */
+	result = libscca_bloom_filter_build(
+	          bloom_filter,
+	          bloom_filter_size,
+	          7,
+	          hashes,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A Bloom filter has no false negatives
+	 */
+	for( value_index = 0;
+	     value_index < 256;
+	     value_index++ )
+	{
+		result = libscca_bloom_filter_contains_hash(
+		          bloom_filter,
+		          bloom_filter_size,
+		          7,
+		          hashes[ value_index ],
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The false positive rate should be about 1 percent
+	 */
+	for( value_index = 256;
+	     value_index < 10256;
+	     value_index++ )
+	{
+		result = libscca_bloom_filter_contains_hash(
+		          bloom_filter,
+		          bloom_filter_size,
+		          7,
+		          scca_test_bloom_filter_get_hash(
+		           (uint64_t) value_index ),
+		          &error );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		number_of_false_hits += result;
+	}
+	SCCA_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_false_hits",
+	 number_of_false_hits,
+	 300 );
+
+	/* Test an empty Bloom filter
+	 */
+	result = libscca_bloom_filter_build(
+	          bloom_filter,
+	          8,
+	          7,
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_bloom_filter_contains_hash(
+	          bloom_filter,
+	          8,
+	          7,
+	          hashes[ 0 ],
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_bloom_filter_build(
+	          NULL,
+	          bloom_filter_size,
+	          7,
+	          hashes,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_bloom_filter_build(
+	          bloom_filter,
+	          0,
+	          7,
+	          hashes,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_bloom_filter_build(
+	          bloom_filter,
+	          bloom_filter_size,
+	          7,
+	          NULL,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_bloom_filter_build(
+	          bloom_filter,
+	          bloom_filter_size,
+	          0,
+	          hashes,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_bloom_filter_contains_hash(
+	          NULL,
+	          bloom_filter_size,
+	          7,
+	          hashes[ 0 ],
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_bloom_filter_contains_hash(
+	          bloom_filter,
+	          bloom_filter_size,
+	          33,
+	          hashes[ 0 ],
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_bloom_filter_get_size",
+	 scca_test_bloom_filter_get_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_bloom_filter_build",
+	 scca_test_bloom_filter_build );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
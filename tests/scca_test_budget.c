@@ -0,0 +1,654 @@
+/*
+ * Library budget functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_budget.h"
+#include "../libscca/libscca_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_budget_check_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_budget_check_number_of_entries(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_budget_t budget;
+	int abort                = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &budget,
+	     0,
+	     sizeof( libscca_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_budget_check_number_of_entries(
+	          &budget,
+	          17,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 0 );
+
+	budget.maximum_number_of_entries = 16;
+
+	result = libscca_budget_check_number_of_entries(
+	          &budget,
+	          16,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_budget_check_number_of_entries(
+	          &budget,
+	          17,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_budget_check_number_of_entries(
+	          NULL,
+	          16,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_budget_check_number_of_entries(
+	          &budget,
+	          16,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_budget_check_uncompressed_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_budget_check_uncompressed_data_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_budget_t budget;
+	int abort                = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &budget,
+	     0,
+	     sizeof( libscca_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_budget_check_uncompressed_data_size(
+	          &budget,
+	          65537,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 0 );
+
+	budget.maximum_uncompressed_data_size = 65536;
+
+	result = libscca_budget_check_uncompressed_data_size(
+	          &budget,
+	          65536,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_budget_check_uncompressed_data_size(
+	          &budget,
+	          65537,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_budget_check_uncompressed_data_size(
+	          NULL,
+	          65536,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_budget_check_uncompressed_data_size(
+	          &budget,
+	          65536,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_budget_add_steps function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_budget_add_steps(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_budget_t budget;
+	int abort                = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &budget,
+	     0,
+	     sizeof( libscca_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_budget_add_steps(
+	          &budget,
+	          9,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "budget.number_of_steps",
+	 budget.number_of_steps,
+	 (uint64_t) 9 );
+
+	budget.maximum_number_of_steps = 16;
+	budget.number_of_steps         = 0;
+
+	result = libscca_budget_add_steps(
+	          &budget,
+	          8,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_budget_add_steps(
+	          &budget,
+	          9,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	result = libcerror_error_matches(
+	          error,
+	          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	          LIBSCCA_BUDGET_RUNTIME_ERROR_EXCEEDED );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_budget_add_steps(
+	          NULL,
+	          8,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_budget_add_steps(
+	          &budget,
+	          8,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_budget_check_deadline function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_budget_check_deadline(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_budget_t budget;
+	uint64_t timestamp       = 0;
+	int abort                = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     &budget,
+	     0,
+	     sizeof( libscca_budget_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_budget_check_deadline(
+	          &budget,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	budget.deadline = (uint64_t) 0x7fffffffffffffffULL;
+
+	result = libscca_budget_check_deadline(
+	          &budget,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "abort",
+	 abort,
+	 0 );
+
+	/* The deadline is only checked if a monotonic clock is available
+	 */
+	if( libscca_statistics_get_timestamp(
+	     &timestamp ) == 1 )
+	{
+		budget.deadline = 1;
+
+		result = libscca_budget_add_steps(
+		          &budget,
+		          1,
+		          &abort,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		result = libcerror_error_matches(
+		          error,
+		          LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		          LIBSCCA_BUDGET_RUNTIME_ERROR_DEADLINE_EXCEEDED );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "abort",
+		 abort,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT8(
+		 "budget.deadline_exceeded",
+		 budget.deadline_exceeded,
+		 (uint8_t) 1 );
+	}
+	/* Test error cases
+	 */
+	result = libscca_budget_check_deadline(
+	          NULL,
+	          &abort,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_budget_check_deadline(
+	          &budget,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_budget_check_number_of_entries",
+	 scca_test_budget_check_number_of_entries );
+
+	SCCA_TEST_RUN(
+	 "libscca_budget_check_uncompressed_data_size",
+	 scca_test_budget_check_uncompressed_data_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_budget_add_steps",
+	 scca_test_budget_add_steps );
+
+	SCCA_TEST_RUN(
+	 "libscca_budget_check_deadline",
+	 scca_test_budget_check_deadline );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
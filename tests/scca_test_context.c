@@ -0,0 +1,834 @@
+/*
+ * Library context functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_context.h"
+
+/* Tests the libscca_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_context_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libscca_context_t *context = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_context_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	context = (libscca_context_t *) 0x12345678UL;
+
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	context = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	/* Test libscca_context_initialize with malloc failing
+	 */
+	scca_test_malloc_attempts_before_fail = 0;
+
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	if( scca_test_malloc_attempts_before_fail != -1 )
+	{
+		scca_test_malloc_attempts_before_fail = -1;
+
+		if( context != NULL )
+		{
+			libscca_context_free(
+			 &context,
+			 NULL );
+		}
+	}
+	else
+	{
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "context",
+		 context );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libscca_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_context_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_context_get_scratch_buffers_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_context_get_scratch_buffers_size(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libscca_context_t *context  = NULL;
+	size_t scratch_buffers_size = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_context_get_scratch_buffers_size(
+	          context,
+	          &scratch_buffers_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "scratch_buffers_size",
+	 scratch_buffers_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_context_get_scratch_buffers_size(
+	          NULL,
+	          &scratch_buffers_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_context_get_scratch_buffers_size(
+	          context,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libscca_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_context_take_buffer and libscca_context_release_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_context_take_buffer(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	libscca_context_t *context  = NULL;
+	uint8_t *buffer             = NULL;
+	uint8_t *large_buffer       = NULL;
+	size_t buffer_size          = 0;
+	size_t scratch_buffers_size = 0;
+	int result                  = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an empty context hands out no buffer
+	 */
+	result = libscca_context_take_buffer(
+	          (libscca_internal_context_t *) context,
+	          LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a released buffer is retained
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * 64 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	buffer_size = 64;
+
+	result = libscca_context_release_buffer(
+	          (libscca_internal_context_t *) context,
+	          LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the largest released buffer is retained
+	 */
+	large_buffer = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * 128 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "large_buffer",
+	 large_buffer );
+
+	buffer      = large_buffer;
+	buffer_size = 128;
+
+	result = libscca_context_release_buffer(
+	          (libscca_internal_context_t *) context,
+	          LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * 32 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	buffer_size = 32;
+
+	result = libscca_context_release_buffer(
+	          (libscca_internal_context_t *) context,
+	          LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_context_get_scratch_buffers_size(
+	          context,
+	          &scratch_buffers_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "scratch_buffers_size",
+	 scratch_buffers_size,
+	 (size_t) 128 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_context_take_buffer(
+	          (libscca_internal_context_t *) context,
+	          LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer",
+	 (intptr_t) buffer,
+	 (intptr_t) large_buffer );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) 128 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	/* Test error cases
+	 */
+	result = libscca_context_take_buffer(
+	          NULL,
+	          LIBSCCA_CONTEXT_BUFFER_TYPE_SECTION_DATA,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_context_take_buffer(
+	          (libscca_internal_context_t *) context,
+	          LIBSCCA_CONTEXT_NUMBER_OF_BUFFER_TYPES,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_context_release_buffer(
+	          (libscca_internal_context_t *) context,
+	          -1,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( context != NULL )
+	{
+		libscca_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_context_attach_file and libscca_context_detach_file functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_context_attach_file(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libscca_context_t *context = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_context_attach_file(
+	          (libscca_internal_context_t *) context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a context that is used by a file cannot be freed
+	 */
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_context_detach_file(
+	          (libscca_internal_context_t *) context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_context_detach_file(
+	          (libscca_internal_context_t *) context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_context_attach_file(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libscca_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_context_initialize",
+	 scca_test_context_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_context_free",
+	 scca_test_context_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_context_get_scratch_buffers_size",
+	 scca_test_context_get_scratch_buffers_size );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_context_take_buffer",
+	 scca_test_context_take_buffer );
+
+	SCCA_TEST_RUN(
+	 "libscca_context_attach_file",
+	 scca_test_context_attach_file );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
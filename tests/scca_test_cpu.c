@@ -0,0 +1,135 @@
+/*
+ * Library processor feature functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_cpu.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_cpu_get_features and libscca_cpu_set_features functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_cpu_features(
+     void )
+{
+	uint32_t detected_features = 0;
+	uint32_t features          = 0;
+
+	detected_features = libscca_cpu_detect_features();
+
+	/* Test that only features for which kernels were compiled are detected
+	 */
+#if !defined( LIBSCCA_CPU_HAVE_X86_KERNELS )
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "x86 features",
+	 (uint32_t) ( detected_features & ( LIBSCCA_CPU_FEATURE_SSE2 | LIBSCCA_CPU_FEATURE_AVX2 | LIBSCCA_CPU_FEATURE_AVX512BW ) ),
+	 (uint32_t) 0 );
+#endif
+#if !defined( LIBSCCA_CPU_HAVE_NEON_KERNELS )
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "NEON features",
+	 (uint32_t) ( detected_features & LIBSCCA_CPU_FEATURE_NEON ),
+	 (uint32_t) 0 );
+#endif
+
+	/* Test regular cases
+	 */
+	features = libscca_cpu_get_features();
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "features",
+	 features,
+	 detected_features );
+
+	libscca_cpu_set_features(
+	 0 );
+
+	features = libscca_cpu_get_features();
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "features",
+	 features,
+	 (uint32_t) 0 );
+
+	/* Test that features that were not detected are ignored
+	 */
+	libscca_cpu_set_features(
+	 0xffffffffUL );
+
+	features = libscca_cpu_get_features();
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "features",
+	 features,
+	 detected_features );
+
+	return( 1 );
+
+on_error:
+	libscca_cpu_set_features(
+	 0xffffffffUL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_cpu_features",
+	 scca_test_cpu_features );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
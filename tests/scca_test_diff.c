@@ -0,0 +1,929 @@
+/*
+ * Library diff functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_diff.h"
+
+/* Tests the libscca_diff_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_diff_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_diff_t *diff     = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_diff_initialize(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_diff_free(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_diff_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	diff = (libscca_diff_t *) 0x12345678UL;
+
+	result = libscca_diff_initialize(
+	          &diff,
+	          &error );
+
+	diff = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libscca_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_diff_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_diff_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_diff_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_diff_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_diff_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_diff_t *diff     = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_diff_initialize(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	number_of_entries = -1;
+
+	result = libscca_diff_get_number_of_entries(
+	          diff,
+	          LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_diff_get_number_of_entries(
+	          NULL,
+	          LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_diff_get_number_of_entries(
+	          diff,
+	          0,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_diff_get_number_of_entries(
+	          diff,
+	          LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_diff_get_entry with an entry index value out of bounds
+	 */
+	result = libscca_diff_get_entry(
+	          diff,
+	          LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	          0,
+	          &number_of_entries,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_diff_free(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libscca_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_diff_get_new_last_run_times function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_diff_get_new_last_run_times(
+     void )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	libcerror_error_t *error = NULL;
+	libscca_diff_t *diff     = NULL;
+	int number_of_filetimes  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_diff_initialize(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	number_of_filetimes = -1;
+
+	result = libscca_diff_get_new_last_run_times(
+	          diff,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_filetimes",
+	 number_of_filetimes,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_diff_get_new_last_run_times(
+	          NULL,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_diff_get_new_last_run_times(
+	          diff,
+	          NULL,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_diff_get_new_last_run_times(
+	          diff,
+	          filetimes,
+	          1,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_diff_get_new_last_run_times(
+	          diff,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_diff_free(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libscca_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_internal_diff_build_hash_table and libscca_internal_diff_match_set_values functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_diff_match_set_values(
+     void )
+{
+	uint8_t data1[ 6 ] = {
+		'a', 0, 'b', 0, 'c', 0 };
+	uint8_t data2[ 6 ] = {
+		'a', 0, 'b', 0, 'd', 0 };
+
+	libcerror_error_t *error = NULL;
+	libscca_diff_t *diff     = NULL;
+	int result               = 0;
+	int set_value_index      = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_diff_initialize(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add more set values than the minimum hash table size
+	 * with colliding hashes to test the probing
+	 */
+	for( set_value_index = 0;
+	     set_value_index < 100;
+	     set_value_index++ )
+	{
+		result = libscca_internal_diff_append_set_value(
+		          (libscca_internal_diff_t *) diff,
+		          (uint64_t) ( set_value_index % 4 ),
+		          (uint64_t) set_value_index,
+		          data1,
+		          6,
+		          NULL,
+		          -1,
+		          set_value_index,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_internal_diff_build_hash_table(
+	          (libscca_internal_diff_t *) diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_table_size",
+	 ( (libscca_internal_diff_t *) diff )->hash_table_size,
+	 (uint32_t) 256 );
+
+	/* Test regular cases
+	 */
+	result = libscca_internal_diff_match_set_values(
+	          (libscca_internal_diff_t *) diff,
+	          3,
+	          99,
+	          data1,
+	          6 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "is_matched",
+	 ( (libscca_internal_diff_t *) diff )->set_values[ 99 ].is_matched,
+	 (uint8_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "is_matched",
+	 ( (libscca_internal_diff_t *) diff )->set_values[ 95 ].is_matched,
+	 (uint8_t) 0 );
+
+	result = libscca_internal_diff_match_set_values(
+	          (libscca_internal_diff_t *) diff,
+	          3,
+	          95,
+	          data2,
+	          6 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_internal_diff_match_set_values(
+	          (libscca_internal_diff_t *) diff,
+	          3,
+	          95,
+	          data1,
+	          4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_internal_diff_match_set_values(
+	          NULL,
+	          3,
+	          99,
+	          data1,
+	          6 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_internal_diff_build_hash_table(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_diff_free(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libscca_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_internal_diff_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_diff_append_entry(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_diff_t *diff     = NULL;
+	int entry_index          = 0;
+	int item_index           = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+	int volume_index         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_diff_initialize(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "diff",
+	 diff );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( entry_index = 0;
+	     entry_index < 40;
+	     entry_index++ )
+	{
+		result = libscca_internal_diff_append_entry(
+		          (libscca_internal_diff_t *) diff,
+		          LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING,
+		          1,
+		          entry_index,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_diff_get_number_of_entries(
+	          diff,
+	          LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 40 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_diff_get_entry(
+	          diff,
+	          LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING,
+	          39,
+	          &volume_index,
+	          &item_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "volume_index",
+	 volume_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "item_index",
+	 item_index,
+	 39 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_internal_diff_append_entry(
+	          NULL,
+	          LIBSCCA_DIFF_ENTRY_TYPE_ADDED_FILENAME,
+	          -1,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_diff_append_entry(
+	          (libscca_internal_diff_t *) diff,
+	          LIBSCCA_DIFF_ENTRY_TYPE_REMOVED_DIRECTORY_STRING + 1,
+	          -1,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_diff_free(
+	          &diff,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( diff != NULL )
+	{
+		libscca_diff_free(
+		 &diff,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_diff_initialize",
+	 scca_test_diff_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_diff_free",
+	 scca_test_diff_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_diff_get_number_of_entries",
+	 scca_test_diff_get_number_of_entries );
+
+	SCCA_TEST_RUN(
+	 "libscca_diff_get_new_last_run_times",
+	 scca_test_diff_get_new_last_run_times );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_diff_match_set_values",
+	 scca_test_internal_diff_match_set_values );
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_diff_append_entry",
+	 scca_test_internal_diff_append_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2675 @@
+/*
+ * Library differential test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_functions.h"
+#include "scca_test_getopt.h"
+#include "scca_test_libbfio.h"
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_libuna.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+/* The differential test opens every source with the reference parser, which is
+ * a file IO handle opened without any of the optional access flags, and with
+ * every fast path and asserts that the results are identical field by field.
+ * A source that the reference parser fails to open must fail to open on every
+ * fast path, which allows the test to be run on fuzzer generated inputs, for
+ * example: "scca_test_differential corpus/id_*"
+ */
+
+#if !defined( LIBSCCA_HAVE_BFIO )
+
+LIBSCCA_EXTERN \
+int libscca_file_open_file_io_handle(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libscca_error_t **error );
+
+#endif /* !defined( LIBSCCA_HAVE_BFIO ) */
+
+/* The maximum size of the strings that are compared
+ */
+#define SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE	32768
+
+/* The maximum number of last run times
+ */
+#define SCCA_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES	8
+
+/* The access flags of the fast paths of the file IO handle
+ */
+int scca_test_differential_access_flags[ 6 ] = {
+	LIBSCCA_ACCESS_FLAG_CONTIGUOUS_DATA,
+	LIBSCCA_ACCESS_FLAG_CACHE_UTF8_FILENAMES,
+	LIBSCCA_ACCESS_FLAG_PARALLEL_DECOMPRESSION,
+	LIBSCCA_ACCESS_FLAG_FILENAME_BLOOM_FILTER,
+	LIBSCCA_ACCESS_FLAG_FRONT_CODED_FILENAMES,
+	LIBSCCA_ACCESS_FLAG_CONTIGUOUS_DATA | LIBSCCA_ACCESS_FLAG_CACHE_UTF8_FILENAMES | LIBSCCA_ACCESS_FLAG_PARALLEL_DECOMPRESSION | LIBSCCA_ACCESS_FLAG_FILENAME_BLOOM_FILTER | LIBSCCA_ACCESS_FLAG_FRONT_CODED_FILENAMES };
+
+/* The names of the fast paths of the file IO handle
+ */
+const char *scca_test_differential_access_flags_names[ 6 ] = {
+	"contiguous data",
+	"cache UTF-8 filenames",
+	"parallel decompression",
+	"filename bloom filter",
+	"front coded filenames",
+	"all access flags" };
+
+/* The sizes of the chunks the parser is fed with
+ */
+size_t scca_test_differential_parser_chunk_sizes[ 2 ] = {
+	509,
+	65536 };
+
+typedef struct scca_test_differential_stream scca_test_differential_stream_t;
+
+struct scca_test_differential_stream
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+};
+
+/* Compares the result and data of a value retrieved from the reference and the fast path
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_data(
+     const char *name,
+     int reference_result,
+     const uint8_t *reference_data,
+     size_t reference_data_size,
+     int result,
+     const uint8_t *data,
+     size_t data_size )
+{
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 name,
+	 result,
+	 reference_result );
+
+	if( result == 1 )
+	{
+		SCCA_TEST_ASSERT_EQUAL_SIZE(
+		 name,
+		 data_size,
+		 reference_data_size );
+
+		if( data_size > 0 )
+		{
+			result = memory_compare(
+			          data,
+			          reference_data,
+			          data_size );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 name,
+			 result,
+			 0 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Compares the file header values
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_header(
+     libscca_file_t *reference_file,
+     libscca_file_t *file )
+{
+	uint64_t reference_filetimes[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+	uint64_t filetimes[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+	uint16_t reference_utf16_string[ 256 ];
+	uint16_t utf16_string[ 256 ];
+	uint8_t reference_utf8_string[ 256 ];
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error           = NULL;
+	size_t reference_string_size       = 0;
+	size_t string_size                 = 0;
+	uint32_t reference_value_32bit     = 0;
+	uint32_t value_32bit               = 0;
+	int number_of_filetimes            = 0;
+	int reference_number_of_filetimes  = 0;
+	int reference_result               = 0;
+	int result                         = 0;
+
+	reference_result = libscca_file_get_format_version(
+	                    reference_file,
+	                    &reference_value_32bit,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_format_version(
+	          file,
+	          &value_32bit,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "format_version",
+	          reference_result,
+	          (uint8_t *) &reference_value_32bit,
+	          sizeof( uint32_t ),
+	          result,
+	          (uint8_t *) &value_32bit,
+	          sizeof( uint32_t ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	reference_result = libscca_file_get_prefetch_hash(
+	                    reference_file,
+	                    &reference_value_32bit,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_prefetch_hash(
+	          file,
+	          &value_32bit,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "prefetch_hash",
+	          reference_result,
+	          (uint8_t *) &reference_value_32bit,
+	          sizeof( uint32_t ),
+	          result,
+	          (uint8_t *) &value_32bit,
+	          sizeof( uint32_t ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	reference_result = libscca_file_get_run_count(
+	                    reference_file,
+	                    &reference_value_32bit,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_run_count(
+	          file,
+	          &value_32bit,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "run_count",
+	          reference_result,
+	          (uint8_t *) &reference_value_32bit,
+	          sizeof( uint32_t ),
+	          result,
+	          (uint8_t *) &value_32bit,
+	          sizeof( uint32_t ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	reference_result = libscca_file_get_corruption_flags(
+	                    reference_file,
+	                    &reference_value_32bit,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_corruption_flags(
+	          file,
+	          &value_32bit,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "corruption_flags",
+	          reference_result,
+	          (uint8_t *) &reference_value_32bit,
+	          sizeof( uint32_t ),
+	          result,
+	          (uint8_t *) &value_32bit,
+	          sizeof( uint32_t ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	reference_result = libscca_file_get_last_run_times(
+	                    reference_file,
+	                    reference_filetimes,
+	                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	                    &reference_number_of_filetimes,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_times(
+	          file,
+	          filetimes,
+	          SCCA_TEST_DIFFERENTIAL_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "last_run_times",
+	          reference_result,
+	          (uint8_t *) reference_filetimes,
+	          sizeof( uint64_t ) * reference_number_of_filetimes,
+	          result,
+	          (uint8_t *) filetimes,
+	          sizeof( uint64_t ) * number_of_filetimes );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	reference_result = libscca_file_get_utf8_executable_filename_size(
+	                    reference_file,
+	                    &reference_string_size,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename_size(
+	          file,
+	          &string_size,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "utf8_executable_filename_size",
+	 result,
+	 reference_result );
+
+	reference_result = libscca_file_get_utf8_executable_filename(
+	                    reference_file,
+	                    reference_utf8_string,
+	                    256,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          256,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "utf8_executable_filename",
+	          reference_result,
+	          reference_utf8_string,
+	          reference_string_size,
+	          result,
+	          utf8_string,
+	          string_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	reference_result = libscca_file_get_utf16_executable_filename_size(
+	                    reference_file,
+	                    &reference_string_size,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename_size(
+	          file,
+	          &string_size,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "utf16_executable_filename_size",
+	 result,
+	 reference_result );
+
+	reference_result = libscca_file_get_utf16_executable_filename(
+	                    reference_file,
+	                    reference_utf16_string,
+	                    256,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
+	          file,
+	          utf16_string,
+	          256,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "utf16_executable_filename",
+	          reference_result,
+	          (uint8_t *) reference_utf16_string,
+	          sizeof( uint16_t ) * reference_string_size,
+	          result,
+	          (uint8_t *) utf16_string,
+	          sizeof( uint16_t ) * string_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Compares the file metrics entries
+ * The per entry values of the reference are compared with the per entry values and
+ * the bulk export of the file metrics table of the fast path
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_file_metrics(
+     libscca_file_t *reference_file,
+     libscca_file_t *file )
+{
+	uint8_t reference_utf8_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE ];
+	uint8_t utf8_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE ];
+
+	libcerror_error_t *error                        = NULL;
+	libscca_file_metrics_t *file_metrics            = NULL;
+	libscca_file_metrics_t *reference_file_metrics  = NULL;
+	uint64_t *file_references                       = NULL;
+	uint64_t *reference_file_references             = NULL;
+	uint32_t *durations                             = NULL;
+	uint32_t *reference_durations                   = NULL;
+	uint32_t *reference_start_times                 = NULL;
+	uint32_t *start_times                           = NULL;
+	size_t reference_string_size                    = 0;
+	size_t string_size                              = 0;
+	uint64_t file_reference                         = 0;
+	uint64_t reference_file_reference               = 0;
+	int entry_index                                 = 0;
+	int number_of_entries                           = 0;
+	int reference_number_of_entries                 = 0;
+	int reference_result                            = 0;
+	int result                                      = 0;
+
+	reference_result = libscca_file_get_number_of_file_metrics_entries(
+	                    reference_file,
+	                    &reference_number_of_entries,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_entries,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_metrics_entries",
+	 result,
+	 reference_result );
+
+	if( result != 1 )
+	{
+		return( 1 );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_metrics_entries",
+	 number_of_entries,
+	 reference_number_of_entries );
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		reference_result = libscca_file_get_file_metrics_entry(
+		                    reference_file,
+		                    entry_index,
+		                    &reference_file_metrics,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_get_file_metrics_entry(
+		          file,
+		          entry_index,
+		          &file_metrics,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "file_metrics_entry",
+		 result,
+		 reference_result );
+
+		if( result != 1 )
+		{
+			continue;
+		}
+		reference_result = libscca_file_metrics_get_utf8_filename_size(
+		                    reference_file_metrics,
+		                    &reference_string_size,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_metrics_get_utf8_filename_size(
+		          file_metrics,
+		          &string_size,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "file_metrics_utf8_filename_size",
+		 result,
+		 reference_result );
+
+		reference_result = libscca_file_metrics_get_utf8_filename(
+		                    reference_file_metrics,
+		                    reference_utf8_string,
+		                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_metrics_get_utf8_filename(
+		          file_metrics,
+		          utf8_string,
+		          SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "file_metrics_utf8_filename",
+		          reference_result,
+		          reference_utf8_string,
+		          reference_string_size,
+		          result,
+		          utf8_string,
+		          string_size );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		reference_result = libscca_file_metrics_get_file_reference(
+		                    reference_file_metrics,
+		                    &reference_file_reference,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_metrics_get_file_reference(
+		          file_metrics,
+		          &file_reference,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "file_metrics_file_reference",
+		          reference_result,
+		          (uint8_t *) &reference_file_reference,
+		          sizeof( uint64_t ),
+		          result,
+		          (uint8_t *) &file_reference,
+		          sizeof( uint64_t ) );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		libscca_file_metrics_free(
+		 &reference_file_metrics,
+		 NULL );
+
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	reference_start_times = (uint32_t *) memory_allocate(
+	                                      sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_start_times",
+	 reference_start_times );
+
+	reference_durations = (uint32_t *) memory_allocate(
+	                                    sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_durations",
+	 reference_durations );
+
+	reference_file_references = (uint64_t *) memory_allocate(
+	                                          sizeof( uint64_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_file_references",
+	 reference_file_references );
+
+	start_times = (uint32_t *) memory_allocate(
+	                            sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "start_times",
+	 start_times );
+
+	durations = (uint32_t *) memory_allocate(
+	                          sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "durations",
+	 durations );
+
+	file_references = (uint64_t *) memory_allocate(
+	                                sizeof( uint64_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_references",
+	 file_references );
+
+	reference_result = libscca_file_get_file_metrics_table(
+	                    reference_file,
+	                    reference_start_times,
+	                    reference_durations,
+	                    NULL,
+	                    reference_file_references,
+	                    NULL,
+	                    number_of_entries,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_file_metrics_table(
+	          file,
+	          start_times,
+	          durations,
+	          NULL,
+	          file_references,
+	          NULL,
+	          number_of_entries,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_metrics_table",
+	 result,
+	 reference_result );
+
+	if( result == 1 )
+	{
+		result = scca_test_differential_compare_data(
+		          "file_metrics_table_start_times",
+		          1,
+		          (uint8_t *) reference_start_times,
+		          sizeof( uint32_t ) * number_of_entries,
+		          1,
+		          (uint8_t *) start_times,
+		          sizeof( uint32_t ) * number_of_entries );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = scca_test_differential_compare_data(
+		          "file_metrics_table_durations",
+		          1,
+		          (uint8_t *) reference_durations,
+		          sizeof( uint32_t ) * number_of_entries,
+		          1,
+		          (uint8_t *) durations,
+		          sizeof( uint32_t ) * number_of_entries );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = scca_test_differential_compare_data(
+		          "file_metrics_table_file_references",
+		          1,
+		          (uint8_t *) reference_file_references,
+		          sizeof( uint64_t ) * number_of_entries,
+		          1,
+		          (uint8_t *) file_references,
+		          sizeof( uint64_t ) * number_of_entries );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The bulk export must match the per entry values of the reference
+		 */
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			reference_result = libscca_file_get_file_metrics_entry(
+			                    reference_file,
+			                    entry_index,
+			                    &reference_file_metrics,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+
+			if( reference_result != 1 )
+			{
+				continue;
+			}
+			reference_result = libscca_file_metrics_get_file_reference(
+			                    reference_file_metrics,
+			                    &reference_file_reference,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+
+			libscca_file_metrics_free(
+			 &reference_file_metrics,
+			 NULL );
+
+			if( reference_result != 1 )
+			{
+				continue;
+			}
+			SCCA_TEST_ASSERT_EQUAL_UINT64(
+			 "file_metrics_table_file_reference",
+			 file_references[ entry_index ],
+			 reference_file_reference );
+		}
+	}
+	memory_free(
+	 file_references );
+
+	memory_free(
+	 durations );
+
+	memory_free(
+	 start_times );
+
+	memory_free(
+	 reference_file_references );
+
+	memory_free(
+	 reference_durations );
+
+	memory_free(
+	 reference_start_times );
+
+	return( 1 );
+
+on_error:
+	if( reference_file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &reference_file_metrics,
+		 NULL );
+	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( durations != NULL )
+	{
+		memory_free(
+		 durations );
+	}
+	if( start_times != NULL )
+	{
+		memory_free(
+		 start_times );
+	}
+	if( reference_file_references != NULL )
+	{
+		memory_free(
+		 reference_file_references );
+	}
+	if( reference_durations != NULL )
+	{
+		memory_free(
+		 reference_durations );
+	}
+	if( reference_start_times != NULL )
+	{
+		memory_free(
+		 reference_start_times );
+	}
+	return( 0 );
+}
+
+/* Compares the trace chain
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_trace_chain(
+     libscca_file_t *reference_file,
+     libscca_file_t *file )
+{
+	libcerror_error_t *error         = NULL;
+	uint32_t *load_counts            = NULL;
+	uint32_t *reference_load_counts  = NULL;
+	int number_of_entries            = 0;
+	int reference_number_of_entries  = 0;
+	int reference_result             = 0;
+	int result                       = 0;
+
+	reference_result = libscca_file_get_number_of_trace_chain_entries(
+	                    reference_file,
+	                    &reference_number_of_entries,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_number_of_trace_chain_entries(
+	          file,
+	          &number_of_entries,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_trace_chain_entries",
+	 result,
+	 reference_result );
+
+	if( result != 1 )
+	{
+		return( 1 );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_trace_chain_entries",
+	 number_of_entries,
+	 reference_number_of_entries );
+
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	reference_load_counts = (uint32_t *) memory_allocate(
+	                                      sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_load_counts",
+	 reference_load_counts );
+
+	load_counts = (uint32_t *) memory_allocate(
+	                            sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "load_counts",
+	 load_counts );
+
+	reference_result = libscca_file_copy_trace_chain_load_counts(
+	                    reference_file,
+	                    reference_load_counts,
+	                    number_of_entries,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_copy_trace_chain_load_counts(
+	          file,
+	          load_counts,
+	          number_of_entries,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_compare_data(
+	          "trace_chain_load_counts",
+	          reference_result,
+	          (uint8_t *) reference_load_counts,
+	          sizeof( uint32_t ) * number_of_entries,
+	          result,
+	          (uint8_t *) load_counts,
+	          sizeof( uint32_t ) * number_of_entries );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 load_counts );
+
+	memory_free(
+	 reference_load_counts );
+
+	return( 1 );
+
+on_error:
+	if( load_counts != NULL )
+	{
+		memory_free(
+		 load_counts );
+	}
+	if( reference_load_counts != NULL )
+	{
+		memory_free(
+		 reference_load_counts );
+	}
+	return( 0 );
+}
+
+/* Compares the filenames
+ * The UTF-8 filenames of the fast path are compared with the UTF-16 streams
+ * of the reference transcoded by libuna and with the packed filenames table
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_filenames(
+     libscca_file_t *reference_file,
+     libscca_file_t *file )
+{
+	uint16_t reference_utf16_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE / 2 ];
+	uint16_t utf16_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE / 2 ];
+	uint8_t reference_utf8_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE ];
+	uint8_t utf8_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE ];
+
+	libcerror_error_t *error          = NULL;
+	const uint8_t *utf16_stream       = NULL;
+	size_t *utf8_string_offsets       = NULL;
+	uint8_t *utf8_strings             = NULL;
+	size_t reference_string_size      = 0;
+	size_t string_size                = 0;
+	size_t utf16_stream_size          = 0;
+	size_t utf8_strings_size          = 0;
+	int filename_index                = 0;
+	int number_of_filenames           = 0;
+	int reference_number_of_filenames = 0;
+	int reference_result              = 0;
+	int result                        = 0;
+	int table_result                  = 0;
+
+	reference_result = libscca_file_get_number_of_filenames(
+	                    reference_file,
+	                    &reference_number_of_filenames,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          &number_of_filenames,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_filenames",
+	 result,
+	 reference_result );
+
+	if( result != 1 )
+	{
+		return( 1 );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_filenames",
+	 number_of_filenames,
+	 reference_number_of_filenames );
+
+	if( number_of_filenames == 0 )
+	{
+		return( 1 );
+	}
+	table_result = libscca_file_get_utf8_filenames_table_size(
+	                file,
+	                &utf8_strings_size,
+	                &error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( table_result == 1 )
+	{
+		utf8_strings = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * utf8_strings_size );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_strings",
+		 utf8_strings );
+
+		utf8_string_offsets = (size_t *) memory_allocate(
+		                                  sizeof( size_t ) * number_of_filenames );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "utf8_string_offsets",
+		 utf8_string_offsets );
+
+		table_result = libscca_file_get_utf8_filenames_table(
+		                file,
+		                utf8_strings,
+		                utf8_strings_size,
+		                utf8_string_offsets,
+		                number_of_filenames,
+		                &error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		reference_result = libscca_file_get_utf8_filename_size(
+		                    reference_file,
+		                    filename_index,
+		                    &reference_string_size,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_get_utf8_filename_size(
+		          file,
+		          filename_index,
+		          &string_size,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "utf8_filename_size",
+		 result,
+		 reference_result );
+
+		reference_result = libscca_file_get_utf8_filename(
+		                    reference_file,
+		                    filename_index,
+		                    reference_utf8_string,
+		                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_get_utf8_filename(
+		          file,
+		          filename_index,
+		          utf8_string,
+		          SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "utf8_filename",
+		          reference_result,
+		          reference_utf8_string,
+		          reference_string_size,
+		          result,
+		          utf8_string,
+		          string_size );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( ( reference_result == 1 )
+		 && ( table_result == 1 ) )
+		{
+			SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+			 "utf8_string_offset",
+			 (uint64_t) utf8_string_offsets[ filename_index ],
+			 (uint64_t) utf8_strings_size );
+
+			result = scca_test_differential_compare_data(
+			          "utf8_filenames_table",
+			          1,
+			          reference_utf8_string,
+			          reference_string_size,
+			          1,
+			          &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ),
+			          narrow_string_length( (char *) &( utf8_strings[ utf8_string_offsets[ filename_index ] ] ) ) + 1 );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		/* The UTF-8 filename of the fast path must match the reference transcoding by libuna
+		 */
+		reference_result = libscca_file_get_utf16_filename_stream(
+		                    reference_file,
+		                    filename_index,
+		                    &utf16_stream,
+		                    &utf16_stream_size,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		if( reference_result == 1 )
+		{
+			reference_result = libuna_utf8_string_size_from_utf16_stream(
+			                    utf16_stream,
+			                    utf16_stream_size,
+			                    LIBUNA_ENDIAN_LITTLE,
+			                    &reference_string_size,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		if( reference_result == 1 )
+		{
+			reference_result = libuna_utf8_string_copy_from_utf16_stream(
+			                    reference_utf8_string,
+			                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+			                    utf16_stream,
+			                    utf16_stream_size,
+			                    LIBUNA_ENDIAN_LITTLE,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+		}
+		if( reference_result == 1 )
+		{
+			result = libscca_file_get_utf8_filename(
+			          file,
+			          filename_index,
+			          utf8_string,
+			          SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+			          &error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = scca_test_differential_compare_data(
+			          "utf8_filename_transcoding",
+			          reference_result,
+			          reference_utf8_string,
+			          reference_string_size,
+			          result,
+			          utf8_string,
+			          string_size );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		reference_result = libscca_file_get_utf16_filename_size(
+		                    reference_file,
+		                    filename_index,
+		                    &reference_string_size,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_get_utf16_filename_size(
+		          file,
+		          filename_index,
+		          &string_size,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "utf16_filename_size",
+		 result,
+		 reference_result );
+
+		reference_result = libscca_file_get_utf16_filename(
+		                    reference_file,
+		                    filename_index,
+		                    reference_utf16_string,
+		                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE / 2,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_get_utf16_filename(
+		          file,
+		          filename_index,
+		          utf16_string,
+		          SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE / 2,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "utf16_filename",
+		          reference_result,
+		          (uint8_t *) reference_utf16_string,
+		          sizeof( uint16_t ) * reference_string_size,
+		          result,
+		          (uint8_t *) utf16_string,
+		          sizeof( uint16_t ) * string_size );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( 1 );
+
+on_error:
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	return( 0 );
+}
+
+/* Compares the volume information
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_volumes(
+     libscca_file_t *reference_file,
+     libscca_file_t *file )
+{
+	uint8_t reference_utf8_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE ];
+	uint8_t utf8_string[ SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE ];
+
+	libcerror_error_t *error                                  = NULL;
+	libscca_volume_information_t *reference_volume_information = NULL;
+	libscca_volume_information_t *volume_information           = NULL;
+	uint64_t *file_references                                 = NULL;
+	uint64_t *reference_file_references                       = NULL;
+	size_t reference_string_size                              = 0;
+	size_t string_size                                        = 0;
+	uint64_t reference_value_64bit                            = 0;
+	uint64_t value_64bit                                      = 0;
+	uint32_t reference_value_32bit                            = 0;
+	uint32_t value_32bit                                      = 0;
+	int number_of_values                                      = 0;
+	int number_of_volumes                                     = 0;
+	int reference_number_of_values                            = 0;
+	int reference_number_of_volumes                           = 0;
+	int reference_result                                      = 0;
+	int result                                                = 0;
+	int value_index                                           = 0;
+	int volume_index                                          = 0;
+
+	reference_result = libscca_file_get_number_of_volumes(
+	                    reference_file,
+	                    &reference_number_of_volumes,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 result,
+	 reference_result );
+
+	if( result != 1 )
+	{
+		return( 1 );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 reference_number_of_volumes );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		reference_result = libscca_file_get_volume_information(
+		                    reference_file,
+		                    volume_index,
+		                    &reference_volume_information,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_get_volume_information(
+		          file,
+		          volume_index,
+		          &volume_information,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "volume_information",
+		 result,
+		 reference_result );
+
+		if( result != 1 )
+		{
+			continue;
+		}
+		reference_result = libscca_volume_information_get_creation_time(
+		                    reference_volume_information,
+		                    &reference_value_64bit,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_volume_information_get_creation_time(
+		          volume_information,
+		          &value_64bit,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "volume_creation_time",
+		          reference_result,
+		          (uint8_t *) &reference_value_64bit,
+		          sizeof( uint64_t ),
+		          result,
+		          (uint8_t *) &value_64bit,
+		          sizeof( uint64_t ) );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		reference_result = libscca_volume_information_get_serial_number(
+		                    reference_volume_information,
+		                    &reference_value_32bit,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_volume_information_get_serial_number(
+		          volume_information,
+		          &value_32bit,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "volume_serial_number",
+		          reference_result,
+		          (uint8_t *) &reference_value_32bit,
+		          sizeof( uint32_t ),
+		          result,
+		          (uint8_t *) &value_32bit,
+		          sizeof( uint32_t ) );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		reference_result = libscca_volume_information_get_utf8_device_path_size(
+		                    reference_volume_information,
+		                    &reference_string_size,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_volume_information_get_utf8_device_path_size(
+		          volume_information,
+		          &string_size,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "volume_utf8_device_path_size",
+		 result,
+		 reference_result );
+
+		reference_result = libscca_volume_information_get_utf8_device_path(
+		                    reference_volume_information,
+		                    reference_utf8_string,
+		                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_volume_information_get_utf8_device_path(
+		          volume_information,
+		          utf8_string,
+		          SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "volume_utf8_device_path",
+		          reference_result,
+		          reference_utf8_string,
+		          reference_string_size,
+		          result,
+		          utf8_string,
+		          string_size );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		reference_result = libscca_volume_information_get_number_of_file_references(
+		                    reference_volume_information,
+		                    &reference_number_of_values,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_volume_information_get_number_of_file_references(
+		          volume_information,
+		          &number_of_values,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "volume_number_of_file_references",
+		          reference_result,
+		          (uint8_t *) &reference_number_of_values,
+		          sizeof( int ),
+		          result,
+		          (uint8_t *) &number_of_values,
+		          sizeof( int ) );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( ( reference_result == 1 )
+		 && ( number_of_values > 0 ) )
+		{
+			reference_file_references = (uint64_t *) memory_allocate(
+			                                          sizeof( uint64_t ) * number_of_values );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "reference_file_references",
+			 reference_file_references );
+
+			file_references = (uint64_t *) memory_allocate(
+			                                sizeof( uint64_t ) * number_of_values );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "file_references",
+			 file_references );
+
+			reference_result = libscca_volume_information_copy_file_references(
+			                    reference_volume_information,
+			                    reference_file_references,
+			                    number_of_values,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libscca_volume_information_copy_file_references(
+			          volume_information,
+			          file_references,
+			          number_of_values,
+			          &error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = scca_test_differential_compare_data(
+			          "volume_file_references",
+			          reference_result,
+			          (uint8_t *) reference_file_references,
+			          sizeof( uint64_t ) * number_of_values,
+			          result,
+			          (uint8_t *) file_references,
+			          sizeof( uint64_t ) * number_of_values );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			memory_free(
+			 file_references );
+
+			file_references = NULL;
+
+			memory_free(
+			 reference_file_references );
+
+			reference_file_references = NULL;
+		}
+		reference_result = libscca_volume_information_get_number_of_directory_strings(
+		                    reference_volume_information,
+		                    &reference_number_of_values,
+		                    &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_volume_information_get_number_of_directory_strings(
+		          volume_information,
+		          &number_of_values,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_compare_data(
+		          "volume_number_of_directory_strings",
+		          reference_result,
+		          (uint8_t *) &reference_number_of_values,
+		          sizeof( int ),
+		          result,
+		          (uint8_t *) &number_of_values,
+		          sizeof( int ) );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( reference_result != 1 )
+		{
+			number_of_values = 0;
+		}
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			reference_result = libscca_volume_information_get_utf8_directory_string_size(
+			                    reference_volume_information,
+			                    value_index,
+			                    &reference_string_size,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libscca_volume_information_get_utf8_directory_string_size(
+			          volume_information,
+			          value_index,
+			          &string_size,
+			          &error );
+
+			libcerror_error_free(
+			 &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "volume_utf8_directory_string_size",
+			 result,
+			 reference_result );
+
+			reference_result = libscca_volume_information_get_utf8_directory_string(
+			                    reference_volume_information,
+			                    value_index,
+			                    reference_utf8_string,
+			                    SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+			                    &error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = libscca_volume_information_get_utf8_directory_string(
+			          volume_information,
+			          value_index,
+			          utf8_string,
+			          SCCA_TEST_DIFFERENTIAL_MAXIMUM_STRING_SIZE,
+			          &error );
+
+			libcerror_error_free(
+			 &error );
+
+			result = scca_test_differential_compare_data(
+			          "volume_utf8_directory_string",
+			          reference_result,
+			          reference_utf8_string,
+			          reference_string_size,
+			          result,
+			          utf8_string,
+			          string_size );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+		libscca_volume_information_free(
+		 &reference_volume_information,
+		 NULL );
+
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	return( 1 );
+
+on_error:
+	if( file_references != NULL )
+	{
+		memory_free(
+		 file_references );
+	}
+	if( reference_file_references != NULL )
+	{
+		memory_free(
+		 reference_file_references );
+	}
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	if( reference_volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &reference_volume_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Compares a file opened by a fast path with the file opened by the reference parser
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_compare_files(
+     libscca_file_t *reference_file,
+     libscca_file_t *file )
+{
+	if( scca_test_differential_compare_header(
+	     reference_file,
+	     file ) != 1 )
+	{
+		return( 0 );
+	}
+	if( scca_test_differential_compare_file_metrics(
+	     reference_file,
+	     file ) != 1 )
+	{
+		return( 0 );
+	}
+	if( scca_test_differential_compare_trace_chain(
+	     reference_file,
+	     file ) != 1 )
+	{
+		return( 0 );
+	}
+	if( scca_test_differential_compare_filenames(
+	     reference_file,
+	     file ) != 1 )
+	{
+		return( 0 );
+	}
+	if( scca_test_differential_compare_volumes(
+	     reference_file,
+	     file ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads data from memory for the libscca_file_open_stream fast path
+ * Returns the number of bytes read, 0 at the end of the stream or -1 on error
+ */
+ssize_t scca_test_differential_read_stream(
+         uint8_t *buffer,
+         size_t buffer_size,
+         void *read_arguments )
+{
+	scca_test_differential_stream_t *stream = NULL;
+
+	if( ( buffer == NULL )
+	 || ( read_arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	stream = (scca_test_differential_stream_t *) read_arguments;
+
+	if( stream->data_offset >= stream->data_size )
+	{
+		return( 0 );
+	}
+	/* Return less data than requested to exercise partial reads
+	 */
+	if( buffer_size > 4093 )
+	{
+		buffer_size = 4093;
+	}
+	if( buffer_size > ( stream->data_size - stream->data_offset ) )
+	{
+		buffer_size = stream->data_size - stream->data_offset;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( stream->data[ stream->data_offset ] ),
+	     buffer_size ) == NULL )
+	{
+		return( -1 );
+	}
+	stream->data_offset += buffer_size;
+
+	return( (ssize_t) buffer_size );
+}
+
+/* Opens a file by feeding the data to the incremental parser in chunks
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_differential_open_parser(
+     libscca_file_t *file,
+     const uint8_t *data,
+     size_t data_size,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	libscca_parser_t *parser = NULL;
+	static char *function    = "scca_test_differential_open_parser";
+	size_t data_offset       = 0;
+	size_t read_size         = 0;
+	ssize_t feed_count       = 0;
+	int state                = 0;
+
+	if( libscca_parser_initialize(
+	     &parser,
+	     file,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize parser.",
+		 function );
+
+		goto on_error;
+	}
+	state = LIBSCCA_PARSER_STATE_NEED_DATA;
+
+	while( state == LIBSCCA_PARSER_STATE_NEED_DATA )
+	{
+		read_size = data_size - data_offset;
+
+		if( read_size > chunk_size )
+		{
+			read_size = chunk_size;
+		}
+		/* A read size of 0 signals the end of the data
+		 */
+		feed_count = libscca_parser_feed(
+		              parser,
+		              &( data[ data_offset ] ),
+		              read_size,
+		              error );
+
+		if( feed_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to feed data to parser.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += (size_t) feed_count;
+
+		if( libscca_parser_get_state(
+		     parser,
+		     &state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parser state.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( read_size == 0 )
+		 && ( state == LIBSCCA_PARSER_STATE_NEED_DATA ) )
+		{
+			break;
+		}
+	}
+	if( state != LIBSCCA_PARSER_STATE_COMPLETE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: parser did not complete.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_parser_free(
+	     &parser,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free parser.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( parser != NULL )
+	{
+		libscca_parser_free(
+		 &parser,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the open result and values of a fast path with the reference
+ * The file is closed and freed
+ * Returns 1 if identical or 0 if not
+ */
+int scca_test_differential_check_fast_path(
+     const char *fast_path_name,
+     libscca_file_t *reference_file,
+     int reference_result,
+     libscca_file_t **file,
+     int result )
+{
+	int compare_result = 0;
+
+	if( result != reference_result )
+	{
+		fprintf(
+		 stdout,
+		 "Open result of fast path: %s (%d) differs from reference (%d)\n",
+		 fast_path_name,
+		 result,
+		 reference_result );
+
+		goto on_error;
+	}
+	if( result == 1 )
+	{
+		compare_result = scca_test_differential_compare_files(
+		                  reference_file,
+		                  *file );
+
+		libscca_file_close(
+		 *file,
+		 NULL );
+
+		if( compare_result != 1 )
+		{
+			fprintf(
+			 stdout,
+			 "Values of fast path: %s differ from reference\n",
+			 fast_path_name );
+
+			goto on_error;
+		}
+	}
+	libscca_file_free(
+	 file,
+	 NULL );
+
+	return( 1 );
+
+on_error:
+	libscca_file_free(
+	 file,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the fast paths against the reference parser
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_differential(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	scca_test_differential_stream_t stream;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *file             = NULL;
+	libscca_file_t *reference_file   = NULL;
+	libscca_file_t *shared_file      = NULL;
+	libscca_file_t *shared_reference = NULL;
+	uint8_t *data                    = NULL;
+	uint8_t *snapshot_data           = NULL;
+	size64_t file_size               = 0;
+	size_t data_size                 = 0;
+	size_t snapshot_data_size        = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int access_flags_index           = 0;
+	int chunk_size_index             = 0;
+	int reference_result             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) SSIZE_MAX );
+
+	data_size = (size_t) file_size;
+
+	/* Allocate at least 1 byte so that empty inputs are handled
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( data_size + 1 ) );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              data_size,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) data_size );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Open the source with the reference parser
+	 */
+	result = libscca_file_initialize(
+	          &reference_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	reference_result = libscca_file_open_file_io_handle(
+	                    reference_file,
+	                    file_io_handle,
+	                    LIBSCCA_OPEN_READ,
+	                    &error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the access flags of the file IO handle
+	 */
+	for( access_flags_index = 0;
+	     access_flags_index < 6;
+	     access_flags_index++ )
+	{
+		result = libscca_file_initialize(
+		          &file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libscca_file_open_file_io_handle(
+		          file,
+		          file_io_handle,
+		          LIBSCCA_OPEN_READ | scca_test_differential_access_flags[ access_flags_index ],
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_check_fast_path(
+		          scca_test_differential_access_flags_names[ access_flags_index ],
+		          reference_file,
+		          reference_result,
+		          &file,
+		          result );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test libscca_file_open_memory
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          data_size,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_check_fast_path(
+	          "open memory",
+	          reference_file,
+	          reference_result,
+	          &file,
+	          result );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test libscca_file_open with memory-mapped access
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_file_open(
+	          file,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_check_fast_path(
+	          "memory mapped",
+	          reference_file,
+	          reference_result,
+	          &file,
+	          result );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test libscca_file_open_stream
+	 */
+	stream.data        = data;
+	stream.data_size   = data_size;
+	stream.data_offset = 0;
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_file_open_stream(
+	          file,
+	          scca_test_differential_read_stream,
+	          (void *) &stream,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_differential_check_fast_path(
+	          "open stream",
+	          reference_file,
+	          reference_result,
+	          &file,
+	          result );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test the incremental parser
+	 */
+	for( chunk_size_index = 0;
+	     chunk_size_index < 2;
+	     chunk_size_index++ )
+	{
+		result = libscca_file_initialize(
+		          &file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = scca_test_differential_open_parser(
+		          file,
+		          data,
+		          data_size,
+		          scca_test_differential_parser_chunk_sizes[ chunk_size_index ],
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_check_fast_path(
+		          "incremental parser",
+		          reference_file,
+		          reference_result,
+		          &file,
+		          result );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	/* Test the snapshot of the reference
+	 */
+	if( reference_result == 1 )
+	{
+		result = libscca_file_get_snapshot_size(
+		          reference_file,
+		          &snapshot_data_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		snapshot_data = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * snapshot_data_size );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "snapshot_data",
+		 snapshot_data );
+
+		result = libscca_file_write_snapshot(
+		          reference_file,
+		          snapshot_data,
+		          snapshot_data_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_initialize(
+		          &file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libscca_file_open_snapshot(
+		          file,
+		          snapshot_data,
+		          snapshot_data_size,
+		          LIBSCCA_OPEN_READ,
+		          &error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = scca_test_differential_check_fast_path(
+		          "open snapshot",
+		          reference_file,
+		          reference_result,
+		          &file,
+		          result );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		memory_free(
+		 snapshot_data );
+
+		snapshot_data = NULL;
+	}
+	/* Test the shared file of the reference
+	 */
+	if( reference_result == 1 )
+	{
+		result = libscca_file_share(
+		          reference_file,
+		          &shared_file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "shared_file",
+		 shared_file );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Sharing a shared file adds a reference to the same file
+		 */
+		result = libscca_file_share(
+		          shared_file,
+		          &shared_reference,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "shared_reference",
+		 (int) ( shared_reference == shared_file ),
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = scca_test_differential_compare_files(
+		          reference_file,
+		          shared_file );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* A shared file cannot be freed
+		 */
+		result = libscca_file_free(
+		          &shared_file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = libscca_file_release(
+		          &shared_reference,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "shared_reference",
+		 shared_reference );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_release(
+		          &shared_file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "shared_file",
+		 shared_file );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	if( reference_result == 1 )
+	{
+		result = libscca_file_close(
+		          reference_file,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_file_free(
+	          &reference_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( shared_reference != NULL )
+	{
+		libscca_file_release(
+		 &shared_reference,
+		 NULL );
+	}
+	if( shared_file != NULL )
+	{
+		libscca_file_release(
+		 &shared_file,
+		 NULL );
+	}
+	if( reference_file != NULL )
+	{
+		libscca_file_free(
+		 &reference_file,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_integer_t option = 0;
+
+	while( ( option = scca_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Every source is tested, which allows a corpus to be tested at once
+	 */
+	while( optind < argc )
+	{
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "differential",
+		 scca_test_differential,
+		 argv[ optind ] );
+
+		optind++;
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
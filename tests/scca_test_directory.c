@@ -0,0 +1,1038 @@
+/*
+ * Library directory functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_directory.h"
+
+/* The UTF-16 little-endian string: "kernel32.dll"
+ */
+uint8_t scca_test_directory_utf16_stream1[ 26 ] = {
+	'k', 0, 'e', 0, 'r', 0, 'n', 0, 'e', 0, 'l', 0, '3', 0, '2', 0, '.', 0, 'd', 0, 'l', 0, 'l', 0, 0, 0 };
+
+/* The UTF-16 little-endian string: "NTDLL.DLL"
+ */
+uint8_t scca_test_directory_utf16_stream2[ 20 ] = {
+	'N', 0, 'T', 0, 'D', 0, 'L', 0, 'L', 0, '.', 0, 'D', 0, 'L', 0, 'L', 0, 0, 0 };
+
+/* Tests the libscca_directory_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_directory_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_directory_t *directory = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_free(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_directory_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory = (libscca_directory_t *) 0x12345678UL;
+
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
+
+	directory = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libscca_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_directory_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_directory_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_directory_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_directory_open function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_directory_open(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_directory_t *directory = NULL;
+	int result                     = 0;
+
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_directory_open(
+	          NULL,
+	          ".",
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_directory_open(
+	          directory,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_directory_open(
+	          directory,
+	          "",
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_directory_free(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libscca_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_directory_get_number_of_executables function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_directory_get_number_of_executables(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_directory_t *directory = NULL;
+	int number_of_executables      = 0;
+	int number_of_failed_files     = 0;
+	int result                     = 0;
+
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_directory_get_number_of_executables(
+	          directory,
+	          &number_of_executables,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_executables",
+	 number_of_executables,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_get_number_of_failed_files(
+	          directory,
+	          &number_of_failed_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_failed_files",
+	 number_of_failed_files,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_directory_get_number_of_executables(
+	          NULL,
+	          &number_of_executables,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_directory_get_number_of_executables(
+	          directory,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_directory_get_executable_number_of_volumes(
+	          directory,
+	          0,
+	          &number_of_executables,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_directory_free(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libscca_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_internal_directory_append_label function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_directory_append_label(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_directory_t *directory = NULL;
+	size_t label_offset            = 0;
+	size_t label_size              = 0;
+	int result                     = 0;
+
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_internal_directory_append_label(
+	          (libscca_internal_directory_t *) directory,
+	          (uint8_t *) "CMD.EXE-4A81B364.pf",
+	          19,
+	          &label_offset,
+	          &label_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "label_offset",
+	 label_offset,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "label_size",
+	 label_size,
+	 (size_t) 20 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) ( (libscca_internal_directory_t *) directory )->labels_data,
+	          "CMD.EXE-4A81B364.pf",
+	          20 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test an empty label
+	 */
+	result = libscca_internal_directory_append_label(
+	          (libscca_internal_directory_t *) directory,
+	          NULL,
+	          0,
+	          &label_offset,
+	          &label_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "label_offset",
+	 label_offset,
+	 (size_t) 20 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "label_size",
+	 label_size,
+	 (size_t) 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_internal_directory_append_label(
+	          NULL,
+	          (uint8_t *) "label",
+	          5,
+	          &label_offset,
+	          &label_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_directory_append_label(
+	          (libscca_internal_directory_t *) directory,
+	          (uint8_t *) "label",
+	          5,
+	          NULL,
+	          &label_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_directory_free(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libscca_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_internal_directory_intern_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_directory_intern_string(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error       = NULL;
+	libscca_directory_t *directory = NULL;
+	size_t utf8_string_size        = 0;
+	uint64_t case_folded_hash      = 0;
+	uint32_t string_identifier1    = 0;
+	uint32_t string_identifier2    = 0;
+	uint32_t string_identifier3    = 0;
+	int number_of_strings          = 0;
+	int result                     = 0;
+	int string_index               = 0;
+
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_internal_directory_intern_string(
+	          (libscca_internal_directory_t *) directory,
+	          scca_test_directory_utf16_stream1,
+	          26,
+	          &string_identifier1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_directory_intern_string(
+	          (libscca_internal_directory_t *) directory,
+	          scca_test_directory_utf16_stream2,
+	          20,
+	          &string_identifier2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	 "string_identifier2",
+	 (int) string_identifier2,
+	 (int) string_identifier1 );
+
+	/* Test that a string is only stored once
+	 */
+	result = libscca_internal_directory_intern_string(
+	          (libscca_internal_directory_t *) directory,
+	          scca_test_directory_utf16_stream1,
+	          26,
+	          &string_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_identifier3",
+	 string_identifier3,
+	 string_identifier1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_get_number_of_strings(
+	          directory,
+	          &number_of_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_get_utf8_string_size(
+	          directory,
+	          (int) string_identifier2,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 10 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_get_utf8_string(
+	          directory,
+	          (int) string_identifier2,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "NTDLL.DLL",
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the case insensitive lookup of a string
+	 */
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) "ntdll.dll",
+	          9,
+	          &case_folded_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_get_next_string_index_by_filename_hash(
+	          directory,
+	          0,
+	          case_folded_hash,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "string_index",
+	 string_index,
+	 (int) string_identifier2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_directory_get_next_string_index_by_filename_hash(
+	          directory,
+	          string_index + 1,
+	          case_folded_hash,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that no executable refers to the string
+	 */
+	result = libscca_directory_get_next_executable_index_by_string_index(
+	          directory,
+	          0,
+	          (int) string_identifier2,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_internal_directory_intern_string(
+	          NULL,
+	          scca_test_directory_utf16_stream1,
+	          26,
+	          &string_identifier1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_directory_intern_string(
+	          (libscca_internal_directory_t *) directory,
+	          scca_test_directory_utf16_stream1,
+	          26,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_directory_get_utf8_string_size(
+	          directory,
+	          -1,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_directory_get_next_string_index_by_filename_hash(
+	          directory,
+	          -1,
+	          case_folded_hash,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_directory_free(
+	          &directory,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		libscca_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_directory_initialize",
+	 scca_test_directory_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_directory_free",
+	 scca_test_directory_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_directory_open",
+	 scca_test_directory_open );
+
+	SCCA_TEST_RUN(
+	 "libscca_directory_get_number_of_executables",
+	 scca_test_directory_get_number_of_executables );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_directory_append_label",
+	 scca_test_internal_directory_append_label );
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_directory_intern_string",
+	 scca_test_internal_directory_intern_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -37,6 +38,7 @@
 #include "scca_test_libscca.h"
 #include "scca_test_macros.h"
 #include "scca_test_memory.h"
+#include "scca_test_unused.h"
 
 #include "../libscca/libscca_file.h"
 
@@ -384,6 +386,169 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libscca_file_initialize_with_context function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_initialize_with_context(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libscca_context_t *context = NULL;
+	libscca_file_t *file       = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_context_initialize(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_initialize_with_context(
+	          &file,
+	          context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the context cannot be freed while it is used by the file
+	 */
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_initialize_with_context(
+	          &file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_initialize_with_context(
+	          NULL,
+	          context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_context_free(
+	          &context,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		libscca_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libscca_file_free function
  * Returns 1 if successful or 0 if not
  */
@@ -597,15 +762,13 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libscca_file_open_wide function
+/* Tests the libscca_file_open function with the memory mapped access flag
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_open_wide(
+int scca_test_file_open_memory_mapped(
      const system_character_t *source )
 {
-	wchar_t wide_source[ 256 ];
+	char narrow_source[ 256 ];
 
 	libcerror_error_t *error = NULL;
 	libscca_file_t *file     = NULL;
@@ -613,9 +776,9 @@ int scca_test_file_open_wide(
 
 	/* Initialize test
 	 */
-	result = scca_test_get_wide_source(
+	result = scca_test_get_narrow_source(
 	          source,
-	          wide_source,
+	          narrow_source,
 	          256,
 	          &error );
 
@@ -647,10 +810,10 @@ int scca_test_file_open_wide(
 
 	/* Test open
 	 */
-	result = libscca_file_open_wide(
+	result = libscca_file_open(
 	          file,
-	          wide_source,
-	          LIBSCCA_OPEN_READ,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -662,30 +825,12 @@ int scca_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test open when already opened
 	 */
-	result = libscca_file_open_wide(
-	          NULL,
-	          wide_source,
-	          LIBSCCA_OPEN_READ,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_open_wide(
+	result = libscca_file_open(
 	          file,
-	          NULL,
-	          LIBSCCA_OPEN_READ,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -700,44 +845,36 @@ int scca_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_wide(
+	/* Test close and reopen, which reuses the mapped file
+	 */
+	result = libscca_file_close(
 	          file,
-	          wide_source,
-	          -1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test open when already opened
-	 */
-	result = libscca_file_open_wide(
+	result = libscca_file_open(
 	          file,
-	          wide_source,
-	          LIBSCCA_OPEN_READ,
+	          narrow_source,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_MEMORY_MAPPED,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	/* Clean up
 	 */
 	result = libscca_file_free(
@@ -774,24 +911,26 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Tests the libscca_file_open_file_io_handle function
+/* Tests the libscca_file_open_wide function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_open_file_io_handle(
+int scca_test_file_open_wide(
      const system_character_t *source )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libscca_file_t *file             = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
+	result = scca_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -799,51 +938,22 @@ int scca_test_file_open_file_io_handle(
 	 result,
 	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
-	          source,
-	          string_length,
+	result = libscca_file_initialize(
+	          &file,
 	          &error );
-#endif
+
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = libscca_file_initialize(
-	          &file,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -851,9 +961,9 @@ int scca_test_file_open_file_io_handle(
 
 	/* Test open
 	 */
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_open_wide(
 	          file,
-	          file_io_handle,
+	          wide_source,
 	          LIBSCCA_OPEN_READ,
 	          &error );
 
@@ -868,9 +978,9 @@ int scca_test_file_open_file_io_handle(
 
 	/* Test error cases
 	 */
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_open_wide(
 	          NULL,
-	          file_io_handle,
+	          wide_source,
 	          LIBSCCA_OPEN_READ,
 	          &error );
 
@@ -886,7 +996,7 @@ int scca_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_open_wide(
 	          file,
 	          NULL,
 	          LIBSCCA_OPEN_READ,
@@ -904,9 +1014,9 @@ int scca_test_file_open_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_open_wide(
 	          file,
-	          file_io_handle,
+	          wide_source,
 	          -1,
 	          &error );
 
@@ -924,9 +1034,9 @@ int scca_test_file_open_file_io_handle(
 
 	/* Test open when already opened
 	 */
-	result = libscca_file_open_file_io_handle(
+	result = libscca_file_open_wide(
 	          file,
-	          file_io_handle,
+	          wide_source,
 	          LIBSCCA_OPEN_READ,
 	          &error );
 
@@ -961,23 +1071,6 @@ int scca_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -992,65 +1085,67 @@ on_error:
 		 &file,
 		 NULL );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_close function
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libscca_file_open_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_close(
-     void )
+int scca_test_file_open_file_io_handle(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *file             = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libscca_file_close(
-	          NULL,
+	result = libbfio_file_initialize(
+	          &file_io_handle,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
+	string_length = system_string_length(
+	                 source );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libscca_file_open and libscca_file_close functions
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error = NULL;
-	libscca_file_t *file     = NULL;
-	int result               = 0;
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
 	result = libscca_file_initialize(
 	          &file,
 	          &error );
@@ -1068,21 +1163,13 @@ int scca_test_file_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test open
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libscca_file_open_wide(
-	          file,
-	          source,
-	          LIBSCCA_OPEN_READ,
-	          &error );
-#else
-	result = libscca_file_open(
+	result = libscca_file_open_file_io_handle(
 	          file,
-	          source,
+	          file_io_handle,
 	          LIBSCCA_OPEN_READ,
 	          &error );
-#endif
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1093,57 +1180,82 @@ int scca_test_file_open_close(
 	 "error",
 	 error );
 
-	result = libscca_file_close(
-	          file,
+	/* Test error cases
+	 */
+	result = libscca_file_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libscca_file_open_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_file_io_handle(
 	          file,
-	          source,
+	          NULL,
 	          LIBSCCA_OPEN_READ,
 	          &error );
-#else
-	result = libscca_file_open(
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_file_io_handle(
 	          file,
-	          source,
-	          LIBSCCA_OPEN_READ,
+	          file_io_handle,
+	          -1,
 	          &error );
-#endif
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libscca_file_close(
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libscca_file_open_file_io_handle(
 	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libscca_file_free(
@@ -1163,6 +1275,23 @@ int scca_test_file_open_close(
 	 "error",
 	 error );
 
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1177,22 +1306,32 @@ on_error:
 		 &file,
 		 NULL );
 	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_signal_abort function
+/* Tests the libscca_file_open_memory function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_signal_abort(
-     libscca_file_t *file )
+int scca_test_file_open_memory(
+     void )
 {
+	uint8_t data[ 16 ] = {
+		0x1e, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libscca_file_signal_abort(
-	          file,
+	result = libscca_file_initialize(
+	          &file,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1200,14 +1339,21 @@ int scca_test_file_signal_abort(
 	 result,
 	 1 );
 
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libscca_file_signal_abort(
+	result = libscca_file_open_memory(
 	          NULL,
+	          data,
+	          16,
+	          LIBSCCA_OPEN_READ,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1222,32 +1368,310 @@ int scca_test_file_signal_abort(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libscca_file_open_memory(
+	          file,
+	          NULL,
+	          16,
+	          LIBSCCA_OPEN_READ,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          16,
+	          LIBSCCA_OPEN_WRITE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with data that is too small to contain a file header
+	 */
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          16,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
 		libcerror_error_free(
 		 &error );
 	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_format_version function
+/* Tests the libscca_file_get_open_error function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_format_version(
-     libscca_file_t *file )
+int scca_test_file_get_open_error(
+     void )
 {
+	uint8_t data[ 16 ] = {
+		0x1e, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 	libcerror_error_t *error = NULL;
-	uint32_t format_version  = 0;
+	libscca_file_t *file     = NULL;
+	int error_code           = 0;
+	int error_domain         = 0;
 	int result               = 0;
 
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
-	result = libscca_file_get_format_version(
+	result = libscca_file_get_open_error(
 	          file,
-	          &format_version,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with lightweight errors and data that is too small to contain a file header
+	 */
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          16,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_LIGHTWEIGHT_ERRORS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_open_error(
+	          file,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_domain",
+	 error_domain,
+	 LIBSCCA_ERROR_DOMAIN_IO );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "error_code",
+	 error_code,
+	 LIBSCCA_IO_ERROR_READ_FAILED );
+
+	/* Test open without lightweight errors
+	 */
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          16,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_open_error(
+	          file,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_open_error(
+	          NULL,
+	          &error_domain,
+	          &error_code,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_open_error(
+	          file,
+	          NULL,
+	          &error_code,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_open_error(
+	          file,
+	          &error_domain,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1255,15 +1679,3829 @@ int scca_test_file_get_format_version(
 	 result,
 	 1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_format_version(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_corruption_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_corruption_flags(
+     void )
+{
+	/* Version 17 file with a volumes information offset beyond the end of the file
+	 */
+	uint8_t data[ 152 ] = {
+		0x11, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x0f, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+		0x43, 0x00, 0x4d, 0x00, 0x44, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x7b, 0x08,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x4e, 0x3d, 0x2c, 0x1b, 0x0a, 0xcc, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error  = NULL;
+	libscca_file_t *file      = NULL;
+	uint32_t corruption_flags = 0;
+	uint32_t run_count        = 0;
+	int number_of_volumes     = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open without partial data recovery
+	 */
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          152,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with partial data recovery
+	 */
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          152,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_corruption_flags(
+	          file,
+	          &corruption_flags,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "corruption_flags",
+	 corruption_flags,
+	 (uint32_t) LIBSCCA_CORRUPTION_FLAG_VOLUMES );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_run_count(
+	          file,
+	          &run_count,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "run_count",
+	 run_count,
+	 (uint32_t) 5 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_number_of_volumes(
+	          file,
+	          &number_of_volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_corruption_flags(
+	          NULL,
+	          &corruption_flags,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_corruption_flags(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_open_file_io_handle_with_prefix function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_file_io_handle_with_prefix(
+     void )
+{
+	/* Version 17 file with a volumes information offset beyond the end of the file
+	 */
+	uint8_t data[ 152 ] = {
+		0x11, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x0f, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+		0x43, 0x00, 0x4d, 0x00, 0x44, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x7b, 0x08,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x4e, 0x3d, 0x2c, 0x1b, 0x0a, 0xcc, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *file             = NULL;
+	uint64_t number_of_bytes_read    = 0;
+	uint32_t run_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          152,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with all the data in the prefix, which reads nothing from the file IO handle
+	 */
+	result = libscca_file_open_file_io_handle_with_prefix(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA,
+	          data,
+	          152,
+	          152,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_run_count(
+	          file,
+	          &run_count,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "run_count",
+	 run_count,
+	 (uint32_t) 5 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_statistic(
+	          file,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          &number_of_bytes_read,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes_read",
+	 number_of_bytes_read,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with part of the data in the prefix and an unknown file size
+	 */
+	result = libscca_file_open_file_io_handle_with_prefix(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_RECOVER_PARTIAL_DATA,
+	          data,
+	          16,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_statistic(
+	          file,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          &number_of_bytes_read,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes_read",
+	 number_of_bytes_read,
+	 (uint64_t) 136 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_open_file_io_handle_with_prefix(
+	          NULL,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          data,
+	          152,
+	          152,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_file_io_handle_with_prefix(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          NULL,
+	          152,
+	          152,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_file_io_handle_with_prefix(
+	          file,
+	          file_io_handle,
+	          LIBSCCA_OPEN_READ,
+	          data,
+	          152,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_open_snapshot function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_snapshot(
+     void )
+{
+	uint8_t snapshot_data[ 80 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 snapshot_data,
+	 0,
+	 80 );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_open_snapshot(
+	          NULL,
+	          snapshot_data,
+	          80,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_snapshot(
+	          file,
+	          NULL,
+	          80,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_snapshot(
+	          file,
+	          snapshot_data,
+	          63,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_snapshot(
+	          file,
+	          snapshot_data,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with snapshot data without a signature
+	 */
+	result = libscca_file_open_snapshot(
+	          file,
+	          snapshot_data,
+	          80,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with snapshot data with a mismatching checksum
+	 */
+	memory_copy(
+	 snapshot_data,
+	 "SCCASNAP",
+	 8 );
+
+	snapshot_data[ 8 ]  = 1;
+	snapshot_data[ 12 ] = 64;
+	snapshot_data[ 16 ] = 16;
+
+	result = libscca_file_open_snapshot(
+	          file,
+	          snapshot_data,
+	          80,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with snapshot data with a data size that exceeds the snapshot data
+	 */
+	snapshot_data[ 16 ] = 17;
+
+	result = libscca_file_open_snapshot(
+	          file,
+	          snapshot_data,
+	          80,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Reads data from a file stream for the libscca_file_open_stream test
+ * The data is read in small parts to test reads that return less bytes than requested
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t scca_test_file_read_file_stream(
+         uint8_t *buffer,
+         size_t buffer_size,
+         void *read_arguments )
+{
+	if( read_arguments == NULL )
+	{
+		return( -1 );
+	}
+	if( buffer_size > 4093 )
+	{
+		buffer_size = 4093;
+	}
+	return( (ssize_t) file_stream_read(
+	                   (FILE *) read_arguments,
+	                   buffer,
+	                   buffer_size ) );
+}
+
+/* Fails to read data for the libscca_file_open_stream test
+ * Returns -1
+ */
+ssize_t scca_test_file_read_error(
+         uint8_t *buffer SCCA_TEST_ATTRIBUTE_UNUSED,
+         size_t buffer_size SCCA_TEST_ATTRIBUTE_UNUSED,
+         void *read_arguments SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( buffer )
+	SCCA_TEST_UNREFERENCED_PARAMETER( buffer_size )
+	SCCA_TEST_UNREFERENCED_PARAMETER( read_arguments )
+
+	return( -1 );
+}
+
+/* Tests the libscca_file_open_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_stream(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	FILE *stream             = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = scca_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	stream = file_stream_open(
+	          narrow_source,
+	          "rb" );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libscca_file_open_stream(
+	          file,
+	          &scca_test_file_read_file_stream,
+	          (void *) stream,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_open_stream(
+	          NULL,
+	          &scca_test_file_read_file_stream,
+	          (void *) stream,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libscca_file_open_stream(
+	          file,
+	          &scca_test_file_read_file_stream,
+	          (void *) stream,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_open_stream(
+	          file,
+	          NULL,
+	          (void *) stream,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_open_stream(
+	          file,
+	          &scca_test_file_read_file_stream,
+	          (void *) stream,
+	          LIBSCCA_OPEN_WRITE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with a read function that fails
+	 */
+	result = libscca_file_open_stream(
+	          file,
+	          &scca_test_file_read_error,
+	          NULL,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with a stream that is at its end
+	 */
+	result = libscca_file_open_stream(
+	          file,
+	          &scca_test_file_read_file_stream,
+	          (void *) stream,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_close(
+	          stream );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_file_close(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_open and libscca_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#else
+	result = libscca_file_open(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#else
+	result = libscca_file_open(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with the compressed data decompressed into a single buffer
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_CONTIGUOUS_DATA,
+	          &error );
+#else
+	result = libscca_file_open(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ | LIBSCCA_ACCESS_FLAG_CONTIGUOUS_DATA,
+	          &error );
+#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close with only the file header and file information read
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libscca_file_open_wide(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ_HEADER_ONLY,
+	          &error );
+#else
+	result = libscca_file_open(
+	          file,
+	          source,
+	          LIBSCCA_OPEN_READ_HEADER_ONLY,
+	          &error );
+#endif
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_signal_abort(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_signal_abort(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_signal_abort(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_set_parse_budget and libscca_file_get_parse_budget functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_parse_budget(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error                = NULL;
+	uint64_t maximum_number_of_steps        = 0;
+	uint64_t maximum_uncompressed_data_size = 0;
+	uint64_t number_of_steps                = 0;
+	uint32_t maximum_number_of_entries      = 0;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_set_parse_budget(
+	          file,
+	          1024,
+	          1048576,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_parse_budget(
+	          file,
+	          &maximum_number_of_entries,
+	          &maximum_uncompressed_data_size,
+	          &maximum_number_of_steps,
+	          &number_of_steps,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "maximum_number_of_entries",
+	 maximum_number_of_entries,
+	 (uint32_t) 1024 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_uncompressed_data_size",
+	 maximum_uncompressed_data_size,
+	 (uint64_t) 1048576 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_number_of_steps",
+	 maximum_number_of_steps,
+	 (uint64_t) 65536 );
+
+	/* Reset the budget to unlimited for the remaining tests
+	 */
+	result = libscca_file_set_parse_budget(
+	          file,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_set_parse_budget(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_parse_budget(
+	          NULL,
+	          &maximum_number_of_entries,
+	          &maximum_uncompressed_data_size,
+	          &maximum_number_of_steps,
+	          &number_of_steps,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_parse_budget(
+	          file,
+	          NULL,
+	          &maximum_uncompressed_data_size,
+	          &maximum_number_of_steps,
+	          &number_of_steps,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_parse_budget(
+	          file,
+	          &maximum_number_of_entries,
+	          NULL,
+	          &maximum_number_of_steps,
+	          &number_of_steps,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_parse_budget(
+	          file,
+	          &maximum_number_of_entries,
+	          &maximum_uncompressed_data_size,
+	          NULL,
+	          &number_of_steps,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_parse_budget(
+	          file,
+	          &maximum_number_of_entries,
+	          &maximum_uncompressed_data_size,
+	          &maximum_number_of_steps,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_set_deadline and libscca_file_get_deadline functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_deadline(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t deadline        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_set_deadline(
+	          file,
+	          (uint64_t) 0x7fffffffffffffffULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_deadline(
+	          file,
+	          &deadline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "deadline",
+	 deadline,
+	 (uint64_t) 0x7fffffffffffffffULL );
+
+	/* Reset the deadline for the remaining tests
+	 */
+	result = libscca_file_set_deadline(
+	          file,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_set_deadline(
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_deadline(
+	          NULL,
+	          &deadline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_deadline(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_format_version function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_format_version(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t format_version  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_format_version(
+	          file,
+	          &format_version,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_format_version(
+	          NULL,
+	          &format_version,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_format_version(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf8_executable_filename_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_executable_filename_size(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_executable_filename_size(
+	          file,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_executable_filename_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename_size(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf8_executable_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_executable_filename(
+     libscca_file_t *file )
+{
+	uint8_t utf8_string[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_executable_filename(
+	          NULL,
+	          utf8_string,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          NULL,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_executable_filename(
+	          file,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf16_executable_filename_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf16_executable_filename_size(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf16_executable_filename_size(
+	          file,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf16_executable_filename_size(
+	          NULL,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename_size(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf16_executable_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf16_executable_filename(
+     libscca_file_t *file )
+{
+	uint16_t utf16_string[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf16_executable_filename(
+	          file,
+	          utf16_string,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf16_executable_filename(
+	          NULL,
+	          utf16_string,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
+	          file,
+	          NULL,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
+	          file,
+	          utf16_string,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_executable_filename(
+	          file,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_prefetch_hash(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t prefetch_hash   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_prefetch_hash(
+	          file,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_prefetch_hash(
+	          NULL,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_prefetch_hash(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_last_run_time function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_last_run_time(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_last_run_time(
+	          file,
+	          0,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_last_run_time(
+	          NULL,
+	          0,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_time(
+	          file,
+	          -1,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_time(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_last_run_times function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_last_run_times(
+     libscca_file_t *file )
+{
+	uint64_t filetimes[ LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t filetime        = 0;
+	int number_of_filetimes  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_last_run_times(
+	          file,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_filetimes",
+	 number_of_filetimes,
+	 -1 );
+
+	SCCA_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_filetimes",
+	 number_of_filetimes,
+	 LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES + 1 );
+
+	result = libscca_file_get_last_run_time(
+	          file,
+	          0,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( filetime != 0 )
+	{
+		SCCA_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_filetimes",
+		 number_of_filetimes,
+		 0 );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT64(
+		 "filetimes[ 0 ]",
+		 filetimes[ 0 ],
+		 filetime );
+	}
+	/* Test error cases
+	 */
+	result = libscca_file_get_last_run_times(
+	          NULL,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_times(
+	          file,
+	          NULL,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_times(
+	          file,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES - 1,
+	          &number_of_filetimes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_last_run_times(
+	          file,
+	          filetimes,
+	          LIBSCCA_MAXIMUM_NUMBER_OF_LAST_RUN_TIMES,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_run_count function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_run_count(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t run_count       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_run_count(
+	          file,
+	          &run_count,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_run_count(
+	          NULL,
+	          &run_count,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_run_count(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_number_of_file_metrics_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_number_of_file_metrics_entries(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error           = NULL;
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          NULL,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_file_metrics_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_file_metrics_entry(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error             = NULL;
+	libscca_file_metrics_t *file_metrics = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_file_metrics_entry(
+	          file,
+	          0,
+	          &file_metrics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics",
+	 file_metrics );
+
+	result = libscca_file_metrics_free(
+	          &file_metrics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_file_metrics_entry(
+	          NULL,
+	          0,
+	          &file_metrics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics",
+	 file_metrics );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_file_metrics_entry(
+	          file,
+	          -1,
+	          &file_metrics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics",
+	 file_metrics );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_file_metrics_entry(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics",
+	 file_metrics );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_file_metrics_table function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_file_metrics_table(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error           = NULL;
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_file_metrics_table(
+	          file,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_file_metrics_table(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_file_metrics_entries > 0 )
+	{
+		result = libscca_file_get_file_metrics_table(
+		          file,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          number_of_file_metrics_entries - 1,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_file_metrics_columns function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_file_metrics_columns(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error           = NULL;
+	const uint32_t *start_times        = NULL;
+	const int *filename_indexes        = NULL;
+	int number_of_entries              = 0;
+	int number_of_file_metrics_entries = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_file_metrics_columns(
+	          file,
+	          &start_times,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &filename_indexes,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 number_of_file_metrics_entries );
+
+	if( number_of_entries > 0 )
+	{
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "start_times",
+		 start_times );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "filename_indexes",
+		 filename_indexes );
+	}
+	/* Test error cases
+	 */
+	result = libscca_file_get_file_metrics_columns(
+	          NULL,
+	          &start_times,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &filename_indexes,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_file_metrics_columns(
+	          file,
+	          &start_times,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &filename_indexes,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_iterator functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_iterator(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error                               = NULL;
+	libscca_file_metrics_t *file_metrics                   = NULL;
+	libscca_file_metrics_iterator_t *file_metrics_iterator = NULL;
+	int number_of_entries                                  = 0;
+	int number_of_file_metrics_entries                     = 0;
+	int number_of_iterated_entries                         = 0;
+	int result                                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_number_of_file_metrics_entries(
+	          file,
+	          &number_of_file_metrics_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_iterator_initialize(
+	          &file_metrics_iterator,
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_iterator",
+	 file_metrics_iterator );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_iterator_get_number_of_entries(
+	          file_metrics_iterator,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 number_of_file_metrics_entries );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		file_metrics = NULL;
+
+		result = libscca_file_metrics_iterator_next(
+		          file_metrics_iterator,
+		          &file_metrics,
+		          &error );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "file_metrics",
+			 file_metrics );
+
+			number_of_iterated_entries++;
+		}
+	}
+	while( result == 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_iterated_entries",
+	 number_of_iterated_entries,
+	 number_of_file_metrics_entries );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_iterator_next(
+	          NULL,
+	          &file_metrics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_iterator_next(
+	          file_metrics_iterator,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_iterator_initialize(
+	          &file_metrics_iterator,
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_iterator_free(
+	          &file_metrics_iterator,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_iterator",
+	 file_metrics_iterator );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_iterator_initialize(
+	          NULL,
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_iterator_initialize(
+	          &file_metrics_iterator,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_iterator_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_iterator != NULL )
+	{
+		libscca_file_metrics_iterator_free(
+		 &file_metrics_iterator,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_number_of_filenames function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_number_of_filenames(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_filenames  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          &number_of_filenames,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_number_of_filenames(
+	          NULL,
+	          &number_of_filenames,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf8_filename_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_filename_size(
+     libscca_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	size_t utf8_filename_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_filename_size(
+	          file,
+	          0,
+	          &utf8_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_filename_size(
+	          NULL,
+	          0,
+	          &utf8_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename_size(
+	          file,
+	          -1,
+	          &utf8_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename_size(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_get_utf8_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_filename(
+     libscca_file_t *file )
+{
+	uint8_t utf8_filename[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          0,
+	          utf8_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_get_utf8_filename(
+	          NULL,
+	          0,
+	          utf8_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          -1,
+	          utf8_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          0,
+	          NULL,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          0,
+	          utf8_filename,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          0,
+	          utf8_filename,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_set_mount_points, libscca_file_get_utf8_mapped_filename_size
+ * and libscca_file_get_utf8_mapped_filename functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_get_utf8_mapped_filename(
+     libscca_file_t *file )
+{
+	char device_path[ 512 ];
+	uint8_t mapped_filename[ 512 ];
+	uint8_t utf8_filename[ 512 ];
+
+	const char *device_paths[ 1 ]      = { device_path };
+	const char *mount_point_paths[ 1 ] = { "C:" };
+	libcerror_error_t *error           = NULL;
+	size_t device_path_length          = 0;
+	size_t mapped_filename_size        = 0;
+	size_t utf8_filename_size          = 0;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_file_get_utf8_filename_size(
+	          file,
+	          0,
+	          &utf8_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_utf8_filename(
+	          file,
+	          0,
+	          utf8_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Without mount points the filename is returned unchanged
+	 */
+	result = libscca_file_get_utf8_mapped_filename_size(
+	          file,
+	          0,
+	          &mapped_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "mapped_filename_size",
+	 mapped_filename_size,
+	 utf8_filename_size );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_utf8_mapped_filename(
+	          file,
+	          0,
+	          mapped_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) mapped_filename,
+	          (char *) utf8_filename,
+	          utf8_filename_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Map the first path segment of the filename, such as "\VOLUME{...}", to "C:"
+	 */
+	for( device_path_length = 1;
+	     device_path_length < utf8_filename_size;
+	     device_path_length++ )
+	{
+		if( ( utf8_filename[ device_path_length ] == '\\' )
+		 || ( utf8_filename[ device_path_length ] == 0 ) )
+		{
+			break;
+		}
+	}
+	if( ( utf8_filename[ 0 ] == '\\' )
+	 && ( device_path_length < utf8_filename_size )
+	 && ( utf8_filename[ device_path_length ] == '\\' ) )
+	{
+		memory_copy(
+		 device_path,
+		 utf8_filename,
+		 device_path_length );
+
+		device_path[ device_path_length ] = 0;
+
+		result = libscca_file_set_mount_points(
+		          file,
+		          device_paths,
+		          mount_point_paths,
+		          1,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_get_utf8_mapped_filename_size(
+		          file,
+		          0,
+		          &mapped_filename_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_SIZE(
+		 "mapped_filename_size",
+		 mapped_filename_size,
+		 utf8_filename_size - device_path_length + 2 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_get_utf8_mapped_filename(
+		          file,
+		          0,
+		          mapped_filename,
+		          512,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          (char *) &( mapped_filename[ 2 ] ),
+		          (char *) &( utf8_filename[ device_path_length ] ),
+		          utf8_filename_size - device_path_length );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libscca_file_set_mount_points(
+		          file,
+		          NULL,
+		          NULL,
+		          0,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_file_set_mount_points(
+	          NULL,
+	          device_paths,
+	          mount_point_paths,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_set_mount_points(
+	          file,
+	          device_paths,
+	          mount_point_paths,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_mapped_filename_size(
+	          NULL,
+	          0,
+	          &mapped_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_mapped_filename_size(
+	          file,
+	          -1,
+	          &mapped_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf8_mapped_filename(
 	          NULL,
-	          &format_version,
+	          0,
+	          mapped_filename,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1278,9 +5516,11 @@ int scca_test_file_get_format_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_format_version(
+	result = libscca_file_get_utf8_mapped_filename(
 	          file,
+	          0,
 	          NULL,
+	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1303,24 +5543,32 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	libscca_file_set_mount_points(
+	 file,
+	 NULL,
+	 NULL,
+	 0,
+	 NULL );
+
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_executable_filename_size function
+/* Tests the libscca_file_get_utf16_filename_size function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_executable_filename_size(
+int scca_test_file_get_utf16_filename_size(
      libscca_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf8_string_size  = 0;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	size_t utf16_filename_size = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_get_utf16_filename_size(
 	          file,
-	          &utf8_string_size,
+	          0,
+	          &utf16_filename_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1334,9 +5582,10 @@ int scca_test_file_get_utf8_executable_filename_size(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_get_utf16_filename_size(
 	          NULL,
-	          &utf8_string_size,
+	          0,
+	          &utf16_filename_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1351,8 +5600,27 @@ int scca_test_file_get_utf8_executable_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename_size(
+	result = libscca_file_get_utf16_filename_size(
+	          file,
+	          -1,
+	          &utf16_filename_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_filename_size(
 	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1379,29 +5647,30 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_executable_filename function
+/* Tests the libscca_file_get_utf16_filename function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_executable_filename(
+int scca_test_file_get_utf16_filename(
      libscca_file_t *file )
 {
-	uint8_t utf8_string[ 512 ];
+	uint16_t utf16_filename[ 512 ];
 
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_utf16_filename(
 	          file,
-	          utf8_string,
+	          0,
+	          utf16_filename,
 	          512,
 	          &error );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1409,9 +5678,10 @@ int scca_test_file_get_utf8_executable_filename(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_utf16_filename(
 	          NULL,
-	          utf8_string,
+	          0,
+	          utf16_filename,
 	          512,
 	          &error );
 
@@ -1427,8 +5697,28 @@ int scca_test_file_get_utf8_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_utf16_filename(
+	          file,
+	          -1,
+	          utf16_filename,
+	          512,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_filename(
 	          file,
+	          0,
 	          NULL,
 	          512,
 	          &error );
@@ -1445,9 +5735,10 @@ int scca_test_file_get_utf8_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_utf16_filename(
 	          file,
-	          utf8_string,
+	          0,
+	          utf16_filename,
 	          0,
 	          &error );
 
@@ -1463,9 +5754,10 @@ int scca_test_file_get_utf8_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_executable_filename(
+	result = libscca_file_get_utf16_filename(
 	          file,
-	          utf8_string,
+	          0,
+	          utf16_filename,
 	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
@@ -1492,21 +5784,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_executable_filename_size function
+/* Tests the libscca_file_get_utf16_filename_stream function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_executable_filename_size(
+int scca_test_file_get_utf16_filename_stream(
      libscca_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf16_string_size = 0;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	const uint8_t *utf16_stream = NULL;
+	size_t utf16_stream_size    = 0;
+	int number_of_filenames     = 0;
+	int result                  = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf16_executable_filename_size(
+	result = libscca_file_get_number_of_filenames(
 	          file,
-	          &utf16_string_size,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1518,11 +5812,40 @@ int scca_test_file_get_utf16_executable_filename_size(
 	 "error",
 	 error );
 
+	if( number_of_filenames > 0 )
+	{
+		result = libscca_file_get_utf16_filename_stream(
+		          file,
+		          0,
+		          &utf16_stream,
+		          &utf16_stream_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "utf16_stream",
+		 utf16_stream );
+
+		SCCA_TEST_ASSERT_EQUAL_SIZE(
+		 "utf16_stream_size % 2",
+		 utf16_stream_size % 2,
+		 (size_t) 0 );
+	}
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf16_executable_filename_size(
+	result = libscca_file_get_utf16_filename_stream(
 	          NULL,
-	          &utf16_string_size,
+	          0,
+	          &utf16_stream,
+	          &utf16_stream_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1537,9 +5860,30 @@ int scca_test_file_get_utf16_executable_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_executable_filename_size(
+	result = libscca_file_get_utf16_filename_stream(
+	          file,
+	          -1,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_utf16_filename_stream(
 	          file,
+	          0,
 	          NULL,
+	          &utf16_stream_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1565,23 +5909,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_executable_filename function
+/* Tests the libscca_file_get_utf8_filenames_table_size function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_executable_filename(
+int scca_test_file_get_utf8_filenames_table_size(
      libscca_file_t *file )
 {
-	uint16_t utf16_string[ 512 ];
-
 	libcerror_error_t *error = NULL;
+	size_t utf8_strings_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_utf8_filenames_table_size(
 	          file,
-	          utf16_string,
-	          512,
+	          &utf8_strings_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1595,10 +5937,9 @@ int scca_test_file_get_utf16_executable_filename(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_utf8_filenames_table_size(
 	          NULL,
-	          utf16_string,
-	          512,
+	          &utf8_strings_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1613,10 +5954,9 @@ int scca_test_file_get_utf16_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_utf8_filenames_table_size(
 	          file,
 	          NULL,
-	          512,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1631,74 +5971,121 @@ int scca_test_file_get_utf16_executable_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_executable_filename(
-	          file,
-	          utf16_string,
-	          0,
-	          &error );
+	return( 1 );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+/* Tests the libscca_file_may_contain_filename and libscca_file_may_contain_filename_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_may_contain_filename(
+     libscca_file_t *file )
+{
+	uint8_t utf8_string[ 512 ];
 
-	libcerror_error_free(
-	 &error );
+	libcerror_error_t *error  = NULL;
+	uint64_t case_folded_hash = 0;
+	int number_of_filenames   = 0;
+	int result                = 0;
 
-	result = libscca_file_get_utf16_executable_filename(
+	result = libscca_file_get_number_of_filenames(
 	          file,
-	          utf16_string,
-	          (size_t) SSIZE_MAX + 1,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test regular cases
+	 */
+	if( number_of_filenames > 0 )
+	{
+		result = libscca_file_get_utf8_filename(
+		          file,
+		          0,
+		          utf8_string,
+		          512,
+		          &error );
 
-	return( 1 );
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-/* Tests the libscca_file_get_prefetch_hash function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_prefetch_hash(
-     libscca_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t prefetch_hash   = 0;
-	int result               = 0;
+		/* A filename that is contained is never ruled out
+		 */
+		result = libscca_file_may_contain_filename(
+		          file,
+		          utf8_string,
+		          narrow_string_length(
+		           (char *) utf8_string ),
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_get_filename_case_folded_hash(
+		          file,
+		          0,
+		          &case_folded_hash,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_file_may_contain_filename_hash(
+		          file,
+		          case_folded_hash,
+		          &error );
 
-	/* Test regular cases
-	 */
-	result = libscca_file_get_prefetch_hash(
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_file_may_contain_filename(
 	          file,
-	          &prefetch_hash,
+	          (uint8_t *) "\\NON\\EXISTING\\FILENAME.TXT",
+	          26,
 	          &error );
 
-	SCCA_TEST_ASSERT_EQUAL_INT(
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1706,9 +6093,10 @@ int scca_test_file_get_prefetch_hash(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_prefetch_hash(
+	result = libscca_file_may_contain_filename(
 	          NULL,
-	          &prefetch_hash,
+	          (uint8_t *) "FILENAME.TXT",
+	          12,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1723,9 +6111,27 @@ int scca_test_file_get_prefetch_hash(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_prefetch_hash(
+	result = libscca_file_may_contain_filename(
 	          file,
 	          NULL,
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_may_contain_filename_hash(
+	          NULL,
+	          case_folded_hash,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1751,22 +6157,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_last_run_time function
+/* Tests the libscca_file_get_number_of_volumes function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_last_run_time(
+int scca_test_file_get_number_of_volumes(
      libscca_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	uint64_t filetime        = 0;
+	int number_of_volumes    = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_number_of_volumes(
 	          file,
-	          0,
-	          &filetime,
+	          &number_of_volumes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1780,28 +6185,9 @@ int scca_test_file_get_last_run_time(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_number_of_volumes(
 	          NULL,
-	          0,
-	          &filetime,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_last_run_time(
-	          file,
-	          -1,
-	          &filetime,
+	          &number_of_volumes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1816,9 +6202,8 @@ int scca_test_file_get_last_run_time(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_last_run_time(
+	result = libscca_file_get_number_of_volumes(
 	          file,
-	          0,
 	          NULL,
 	          &error );
 
@@ -1845,21 +6230,22 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_run_count function
+/* Tests the libscca_file_get_volume_information function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_run_count(
+int scca_test_file_get_volume_information(
      libscca_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t run_count       = 0;
-	int result               = 0;
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	int result                                       = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_run_count(
+	result = libscca_file_get_volume_information(
 	          file,
-	          &run_count,
+	          0,
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1871,28 +6257,29 @@ int scca_test_file_get_run_count(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_run_count(
-	          NULL,
-	          &run_count,
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	result = libscca_volume_information_free(
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_run_count(
-	          file,
+	/* Test error cases
+	 */
+	result = libscca_file_get_volume_information(
 	          NULL,
+	          0,
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -1900,6 +6287,10 @@ int scca_test_file_get_run_count(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1907,54 +6298,20 @@ int scca_test_file_get_run_count(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libscca_file_get_number_of_file_metrics_entries function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_number_of_file_metrics_entries(
-     libscca_file_t *file )
-{
-	libcerror_error_t *error           = NULL;
-	int number_of_file_metrics_entries = 0;
-	int result                         = 0;
-
-	/* Test regular cases
-	 */
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_volume_information(
 	          file,
-	          &number_of_file_metrics_entries,
+	          -1,
+	          &volume_information,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libscca_file_get_number_of_file_metrics_entries(
-	          NULL,
-	          &number_of_file_metrics_entries,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	 "volume_information",
+	 volume_information );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1963,8 +6320,9 @@ int scca_test_file_get_number_of_file_metrics_entries(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_number_of_file_metrics_entries(
+	result = libscca_file_get_volume_information(
 	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1973,6 +6331,10 @@ int scca_test_file_get_number_of_file_metrics_entries(
 	 result,
 	 -1 );
 
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1988,25 +6350,33 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_file_metrics_entry function
+/* Tests the libscca_file_get_fingerprint function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_file_metrics_entry(
+int scca_test_file_get_fingerprint(
      libscca_file_t *file )
 {
-	libcerror_error_t *error             = NULL;
-	libscca_file_metrics_t *file_metrics = NULL;
-	int result                           = 0;
+	uint8_t fingerprint[ 16 ];
+	uint8_t second_fingerprint[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_fingerprint(
 	          file,
-	          0,
-	          &file_metrics,
+	          fingerprint,
+	          16,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2018,12 +6388,12 @@ int scca_test_file_get_file_metrics_entry(
 	 "error",
 	 error );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file_metrics",
-	 file_metrics );
-
-	result = libscca_file_metrics_free(
-	          &file_metrics,
+	/* The fingerprint is stable across calls
+	 */
+	result = libscca_file_get_fingerprint(
+	          file,
+	          second_fingerprint,
+	          16,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2035,12 +6405,22 @@ int scca_test_file_get_file_metrics_entry(
 	 "error",
 	 error );
 
+	result = memory_compare(
+	          fingerprint,
+	          second_fingerprint,
+	          16 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_fingerprint(
 	          NULL,
-	          0,
-	          &file_metrics,
+	          fingerprint,
+	          16,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2048,10 +6428,6 @@ int scca_test_file_get_file_metrics_entry(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_metrics",
-	 file_metrics );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2059,10 +6435,10 @@ int scca_test_file_get_file_metrics_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_fingerprint(
 	          file,
-	          -1,
-	          &file_metrics,
+	          NULL,
+	          16,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2070,10 +6446,6 @@ int scca_test_file_get_file_metrics_entry(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_metrics",
-	 file_metrics );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2081,10 +6453,10 @@ int scca_test_file_get_file_metrics_entry(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_file_metrics_entry(
+	result = libscca_file_get_fingerprint(
 	          file,
-	          0,
-	          NULL,
+	          fingerprint,
+	          8,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2092,10 +6464,6 @@ int scca_test_file_get_file_metrics_entry(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "file_metrics",
-	 file_metrics );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2111,30 +6479,55 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_metrics != NULL )
-	{
-		libscca_file_metrics_free(
-		 &file_metrics,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_number_of_filenames function
+/* Tests the libscca_file_get_statistic function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_number_of_filenames(
+int scca_test_file_get_statistic(
      libscca_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	int number_of_filenames  = 0;
+	uint64_t value           = 0;
 	int result               = 0;
 
-	/* Test regular cases
-	 */
-	result = libscca_file_get_number_of_filenames(
+	/* Test regular cases
+	 */
+	result = libscca_file_get_statistic(
+	          file,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_statistic(
+	          file,
+	          LIBSCCA_STATISTIC_TYPE_FILE_HEADER_READ_TIME,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_statistic(
 	          file,
-	          &number_of_filenames,
+	          LIBSCCA_STATISTIC_TYPE_UNCOMPRESSED_DATA_SIZE,
+	          &value,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2142,15 +6535,21 @@ int scca_test_file_get_number_of_filenames(
 	 result,
 	 1 );
 
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0 );
+
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_number_of_filenames(
+	result = libscca_file_get_statistic(
 	          NULL,
-	          &number_of_filenames,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          &value,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2165,8 +6564,27 @@ int scca_test_file_get_number_of_filenames(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_number_of_filenames(
+	result = libscca_file_get_statistic(
+	          file,
+	          -1,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_statistic(
 	          file,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
 	          NULL,
 	          &error );
 
@@ -2193,22 +6611,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_filename_size function
+/* Tests the libscca_file_get_memory_usage function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_filename_size(
+int scca_test_file_get_memory_usage(
      libscca_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	size_t utf8_filename_size = 0;
-	int result                = 0;
+	libcerror_error_t *error        = NULL;
+	uint64_t allocated_size         = 0;
+	uint64_t maximum_allocated_size = 0;
+	uint64_t number_of_allocations  = 0;
+	int result                      = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_memory_usage(
 	          file,
-	          0,
-	          &utf8_filename_size,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &maximum_allocated_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2220,12 +6641,25 @@ int scca_test_file_get_utf8_filename_size(
 	 "error",
 	 error );
 
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "allocated_size",
+	 allocated_size,
+	 (uint64_t) 0 );
+
+	/* The allocated size cannot exceed its high-water mark
+	 */
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "allocated_size",
+	 allocated_size,
+	 maximum_allocated_size + 1 );
+
 	/* Test error cases
 	 */
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_memory_usage(
 	          NULL,
-	          0,
-	          &utf8_filename_size,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &maximum_allocated_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2240,10 +6674,11 @@ int scca_test_file_get_utf8_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_memory_usage(
 	          file,
-	          -1,
-	          &utf8_filename_size,
+	          NULL,
+	          &allocated_size,
+	          &maximum_allocated_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2258,9 +6693,29 @@ int scca_test_file_get_utf8_filename_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename_size(
+	result = libscca_file_get_memory_usage(
 	          file,
-	          0,
+	          &number_of_allocations,
+	          NULL,
+	          &maximum_allocated_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_get_memory_usage(
+	          file,
+	          &number_of_allocations,
+	          &allocated_size,
 	          NULL,
 	          &error );
 
@@ -2287,99 +6742,150 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf8_filename function
+/* Tests the libscca_file_compare_and_update function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf8_filename(
+int scca_test_file_compare_and_update(
      libscca_file_t *file )
 {
-	uint8_t utf8_filename[ 512 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	uint32_t run_count          = 0;
+	uint32_t update_flags       = 0;
+	uint32_t updated_run_count  = 0;
+	int number_of_filenames     = 0;
+	int number_of_volumes       = 0;
+	int result                  = 0;
+	int updated_number_of_items = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libscca_file_get_utf8_filename(
+	result = libscca_file_get_run_count(
 	          file,
-	          0,
-	          utf8_filename,
-	          512,
+	          &run_count,
 	          &error );
 
-	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_utf8_filename(
-	          NULL,
-	          0,
-	          utf8_filename,
-	          512,
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf8_filename(
+	result = libscca_file_get_number_of_volumes(
 	          file,
-	          -1,
-	          utf8_filename,
-	          512,
+	          &number_of_volumes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test regular cases
+	 */
+	result = libscca_file_compare_and_update(
+	          file,
+	          &update_flags,
+	          &error );
 
-	result = libscca_file_get_utf8_filename(
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "update_flags",
+	 update_flags,
+	 (uint32_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the retained sections are still available
+	 */
+	result = libscca_file_get_run_count(
 	          file,
-	          0,
-	          NULL,
-	          512,
+	          &updated_run_count,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "updated_run_count",
+	 updated_run_count,
+	 run_count );
+
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libscca_file_get_number_of_filenames(
+	          file,
+	          &updated_number_of_items,
+	          &error );
 
-	result = libscca_file_get_utf8_filename(
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "updated_number_of_items",
+	 updated_number_of_items,
+	 number_of_filenames );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_get_number_of_volumes(
 	          file,
-	          0,
-	          utf8_filename,
-	          0,
+	          &updated_number_of_items,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "updated_number_of_items",
+	 updated_number_of_items,
+	 number_of_volumes );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_compare_and_update(
+	          NULL,
+	          &update_flags,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2394,11 +6900,9 @@ int scca_test_file_get_utf8_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf8_filename(
+	result = libscca_file_compare_and_update(
 	          file,
-	          0,
-	          utf8_filename,
-	          (size_t) SSIZE_MAX + 1,
+	          NULL,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2424,22 +6928,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_file_get_utf16_filename_size function
+/* Tests the libscca_file_get_snapshot_size and libscca_file_write_snapshot functions
  * Returns 1 if successful or 0 if not
  */
-int scca_test_file_get_utf16_filename_size(
+int scca_test_file_write_snapshot(
      libscca_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	size_t utf16_filename_size = 0;
-	int result                 = 0;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *snapshot_file    = NULL;
+	uint8_t *snapshot_data           = NULL;
+	size_t snapshot_size             = 0;
+	uint64_t case_folded_hash        = 0;
+	uint32_t format_version          = 0;
+	uint32_t snapshot_format_version = 0;
+	int number_of_filenames          = 0;
+	int result                       = 0;
 
 	/* Test regular cases
 	 */
-	result = libscca_file_get_utf16_filename_size(
+	result = libscca_file_get_snapshot_size(
 	          file,
-	          0,
-	          &utf16_filename_size,
+	          &snapshot_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2451,147 +6960,147 @@ int scca_test_file_get_utf16_filename_size(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_utf16_filename_size(
-	          NULL,
-	          0,
-	          &utf16_filename_size,
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "snapshot_size",
+	 (uint64_t) snapshot_size,
+	 (uint64_t) 64 );
+
+	snapshot_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * snapshot_size );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot_data",
+	 snapshot_data );
+
+	result = libscca_file_write_snapshot(
+	          file,
+	          snapshot_data,
+	          snapshot_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf16_filename_size(
-	          file,
-	          -1,
-	          &utf16_filename_size,
+	/* Test the snapshot data can be opened and contains the same values
+	 */
+	result = libscca_file_initialize(
+	          &snapshot_file,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libscca_file_get_utf16_filename_size(
-	          file,
-	          0,
-	          NULL,
+	result = libscca_file_open_snapshot(
+	          snapshot_file,
+	          snapshot_data,
+	          snapshot_size,
+	          LIBSCCA_OPEN_READ,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libscca_file_get_utf16_filename function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_utf16_filename(
-     libscca_file_t *file )
-{
-	uint16_t utf16_filename[ 512 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libscca_file_get_utf16_filename(
+	result = libscca_file_get_format_version(
 	          file,
-	          0,
-	          utf16_filename,
-	          512,
+	          &format_version,
 	          &error );
 
-	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_utf16_filename(
-	          NULL,
-	          0,
-	          utf16_filename,
-	          512,
+	result = libscca_file_get_format_version(
+	          snapshot_file,
+	          &snapshot_format_version,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "snapshot_format_version",
+	 snapshot_format_version,
+	 format_version );
 
-	result = libscca_file_get_utf16_filename(
+	result = libscca_file_get_number_of_filenames(
 	          file,
-	          -1,
-	          utf16_filename,
-	          512,
+	          &number_of_filenames,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	if( number_of_filenames > 0 )
+	{
+		result = libscca_file_get_filename_case_folded_hash(
+		          file,
+		          number_of_filenames - 1,
+		          &case_folded_hash,
+		          &error );
 
-	result = libscca_file_get_utf16_filename(
-	          file,
-	          0,
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_snapshot_may_contain_filename_hash(
+		          snapshot_data,
+		          snapshot_size,
+		          case_folded_hash,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_snapshot_may_contain_filename_hash(
 	          NULL,
-	          512,
+	          snapshot_size,
+	          case_folded_hash,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2606,30 +7115,28 @@ int scca_test_file_get_utf16_filename(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_utf16_filename(
-	          file,
-	          0,
-	          utf16_filename,
-	          0,
+	result = libscca_file_close(
+	          snapshot_file,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Test open with snapshot data that was changed
+	 */
+	snapshot_data[ snapshot_size - 1 ] ^= 0xff;
 
-	result = libscca_file_get_utf16_filename(
-	          file,
-	          0,
-	          utf16_filename,
-	          (size_t) SSIZE_MAX + 1,
+	result = libscca_file_open_snapshot(
+	          snapshot_file,
+	          snapshot_data,
+	          snapshot_size,
+	          LIBSCCA_OPEN_READ,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2644,32 +7151,8 @@ int scca_test_file_get_utf16_filename(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libscca_file_get_number_of_volumes function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_number_of_volumes(
-     libscca_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_volumes    = 0;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
-	result = libscca_file_get_number_of_volumes(
-	          file,
-	          &number_of_volumes,
+	result = libscca_file_free(
+	          &snapshot_file,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2683,9 +7166,9 @@ int scca_test_file_get_number_of_volumes(
 
 	/* Test error cases
 	 */
-	result = libscca_file_get_number_of_volumes(
+	result = libscca_file_get_snapshot_size(
 	          NULL,
-	          &number_of_volumes,
+	          &snapshot_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2700,7 +7183,7 @@ int scca_test_file_get_number_of_volumes(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_number_of_volumes(
+	result = libscca_file_get_snapshot_size(
 	          file,
 	          NULL,
 	          &error );
@@ -2717,67 +7200,28 @@ int scca_test_file_get_number_of_volumes(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libscca_file_get_volume_information function
- * Returns 1 if successful or 0 if not
- */
-int scca_test_file_get_volume_information(
-     libscca_file_t *file )
-{
-	libcerror_error_t *error                         = NULL;
-	libscca_volume_information_t *volume_information = NULL;
-	int result                                       = 0;
-
-	/* Test regular cases
-	 */
-	result = libscca_file_get_volume_information(
-	          file,
-	          0,
-	          &volume_information,
+	result = libscca_file_write_snapshot(
+	          NULL,
+	          snapshot_data,
+	          snapshot_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_information",
-	 volume_information );
-
-	result = libscca_volume_information_free(
-	          &volume_information,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libscca_file_get_volume_information(
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_write_snapshot(
+	          file,
 	          NULL,
-	          0,
-	          &volume_information,
+	          snapshot_size,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2785,10 +7229,6 @@ int scca_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2796,10 +7236,10 @@ int scca_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_volume_information(
+	result = libscca_file_write_snapshot(
 	          file,
-	          -1,
-	          &volume_information,
+	          snapshot_data,
+	          snapshot_size - 1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2807,10 +7247,6 @@ int scca_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2818,10 +7254,10 @@ int scca_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
-	result = libscca_file_get_volume_information(
+	result = libscca_file_write_snapshot(
 	          file,
-	          0,
-	          NULL,
+	          snapshot_data,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -2829,10 +7265,6 @@ int scca_test_file_get_volume_information(
 	 result,
 	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "volume_information",
-	 volume_information );
-
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2840,6 +7272,11 @@ int scca_test_file_get_volume_information(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	memory_free(
+	 snapshot_data );
+
 	return( 1 );
 
 on_error:
@@ -2848,12 +7285,17 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( volume_information != NULL )
+	if( snapshot_file != NULL )
 	{
-		libscca_volume_information_free(
-		 &volume_information,
+		libscca_file_free(
+		 &snapshot_file,
 		 NULL );
 	}
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
 	return( 0 );
 }
 
@@ -2910,10 +7352,34 @@ int main(
 	 "libscca_file_initialize",
 	 scca_test_file_initialize );
 
+	SCCA_TEST_RUN(
+	 "libscca_file_initialize_with_context",
+	 scca_test_file_initialize_with_context );
+
 	SCCA_TEST_RUN(
 	 "libscca_file_free",
 	 scca_test_file_free );
 
+	SCCA_TEST_RUN(
+	 "libscca_file_open_memory",
+	 scca_test_file_open_memory );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_get_open_error",
+	 scca_test_file_get_open_error );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_get_corruption_flags",
+	 scca_test_file_get_corruption_flags );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_open_file_io_handle_with_prefix",
+	 scca_test_file_open_file_io_handle_with_prefix );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_open_snapshot",
+	 scca_test_file_open_snapshot );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2979,6 +7445,11 @@ int main(
 		 scca_test_file_open,
 		 source );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_open_memory_mapped",
+		 scca_test_file_open_memory_mapped,
+		 source );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 		SCCA_TEST_RUN_WITH_ARGS(
@@ -2993,6 +7464,11 @@ int main(
 		 scca_test_file_open_file_io_handle,
 		 source );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_open_stream",
+		 scca_test_file_open_stream,
+		 source );
+
 		SCCA_TEST_RUN(
 		 "libscca_file_close",
 		 scca_test_file_close );
@@ -3027,6 +7503,16 @@ int main(
 		 scca_test_file_signal_abort,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_parse_budget",
+		 scca_test_file_parse_budget,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_deadline",
+		 scca_test_file_deadline,
+		 file );
+
 #if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
 
 		/* TODO: add tests for libscca_file_open_read */
@@ -3068,6 +7554,11 @@ int main(
 		 scca_test_file_get_last_run_time,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_last_run_times",
+		 scca_test_file_get_last_run_times,
+		 file );
+
 		SCCA_TEST_RUN_WITH_ARGS(
 		 "libscca_file_get_run_count",
 		 scca_test_file_get_run_count,
@@ -3083,6 +7574,21 @@ int main(
 		 scca_test_file_get_file_metrics_entry,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_file_metrics_table",
+		 scca_test_file_get_file_metrics_table,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_file_metrics_columns",
+		 scca_test_file_get_file_metrics_columns,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_metrics_iterator",
+		 scca_test_file_metrics_iterator,
+		 file );
+
 		SCCA_TEST_RUN_WITH_ARGS(
 		 "libscca_file_get_number_of_filenames",
 		 scca_test_file_get_number_of_filenames,
@@ -3098,6 +7604,11 @@ int main(
 		 scca_test_file_get_utf8_filename,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_utf8_mapped_filename",
+		 scca_test_file_get_utf8_mapped_filename,
+		 file );
+
 		SCCA_TEST_RUN_WITH_ARGS(
 		 "libscca_file_get_utf16_filename_size",
 		 scca_test_file_get_utf16_filename_size,
@@ -3108,6 +7619,21 @@ int main(
 		 scca_test_file_get_utf16_filename,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_utf16_filename_stream",
+		 scca_test_file_get_utf16_filename_stream,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_utf8_filenames_table_size",
+		 scca_test_file_get_utf8_filenames_table_size,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_may_contain_filename",
+		 scca_test_file_may_contain_filename,
+		 file );
+
 		SCCA_TEST_RUN_WITH_ARGS(
 		 "libscca_file_get_number_of_volumes",
 		 scca_test_file_get_number_of_volumes,
@@ -3118,6 +7644,31 @@ int main(
 		 scca_test_file_get_volume_information,
 		 file );
 
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_fingerprint",
+		 scca_test_file_get_fingerprint,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_statistic",
+		 scca_test_file_get_statistic,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_get_memory_usage",
+		 scca_test_file_get_memory_usage,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_write_snapshot",
+		 scca_test_file_write_snapshot,
+		 file );
+
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "libscca_file_compare_and_update",
+		 scca_test_file_compare_and_update,
+		 file );
+
 		/* Clean up
 		 */
 		result = scca_test_file_close_source(
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -416,6 +417,248 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libscca_file_header_get_utf8_executable_filename_size and libscca_file_header_get_utf8_executable_filename functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_header_get_utf8_executable_filename(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_file_header_t *file_header = NULL;
+	size_t utf8_string_size            = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_header",
+	 file_header );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_header_read_data(
+	          file_header,
+	          scca_test_file_header_data1,
+	          84,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "file_header->utf8_executable_filename_size",
+	 file_header->utf8_executable_filename_size,
+	 (size_t) 15 );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_header_get_utf8_executable_filename_size(
+	          file_header,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 15 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_header_get_utf8_executable_filename(
+	          file_header,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "DOWNLOADER.EXE",
+	          15 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_file_header_get_utf8_executable_filename_size(
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_header_get_utf8_executable_filename_size(
+	          file_header,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_header_get_utf8_executable_filename(
+	          NULL,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_header_get_utf8_executable_filename(
+	          file_header,
+	          NULL,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_header_get_utf8_executable_filename(
+	          file_header,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_header_get_utf8_executable_filename(
+	          file_header,
+	          utf8_string,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_header_free(
+	          &file_header,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_header",
+	 file_header );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_header != NULL )
+	{
+		libscca_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
 
 /* The main program
@@ -449,6 +692,10 @@ int main(
 
 	/* TODO add tests for libscca_file_header_read_data_stream */
 
+	SCCA_TEST_RUN(
+	 "libscca_file_header_get_utf8_executable_filename",
+	 scca_test_file_header_get_utf8_executable_filename );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -378,6 +378,20 @@ int scca_test_file_metrics_read_data(
 	 "error",
 	 error );
 
+	result = libscca_io_handle_set_format_version(
+	          io_handle,
+	          17,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libscca_filename_strings_initialize(
 	          &filename_strings,
 	          &error );
@@ -0,0 +1,1426 @@
+/*
+ * Library file metrics values functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_file_metrics_values.h"
+#include "../libscca/libscca_filename_strings.h"
+#include "../libscca/libscca_format_layout.h"
+
+uint8_t scca_test_file_metrics_values_v17_data[ 40 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00 };
+
+uint8_t scca_test_file_metrics_values_v23_data[ 64 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x3a, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_file_metrics_values_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_metrics_values = (libscca_file_metrics_values_t *) 0x12345678UL;
+
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	file_metrics_values = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_file_metrics_values_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_file_metrics_values_initialize(
+		          &file_metrics_values,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( file_metrics_values != NULL )
+			{
+				libscca_file_metrics_values_free(
+				 &file_metrics_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "file_metrics_values",
+			 file_metrics_values );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_values_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_values_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_clear(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v17,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_metrics_values_clear(
+	          file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->number_of_entries",
+	 file_metrics_values->number_of_entries,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->number_of_allocated_entries",
+	 file_metrics_values->number_of_allocated_entries,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_clear(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_values_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_read_data(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v17,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->number_of_entries",
+	 file_metrics_values->number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->start_times[ 1 ]",
+	 file_metrics_values->start_times[ 1 ],
+	 3 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->durations[ 1 ]",
+	 file_metrics_values->durations[ 1 ],
+	 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->filename_string_offsets[ 1 ]",
+	 file_metrics_values->filename_string_offsets[ 1 ],
+	 0x2e );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->filename_string_numbers_of_characters[ 1 ]",
+	 file_metrics_values->filename_string_numbers_of_characters[ 1 ],
+	 0x0c );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->flags[ 1 ]",
+	 file_metrics_values->flags[ 1 ],
+	 0x00000300UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "file_metrics_values->has_file_references",
+	 file_metrics_values->has_file_references,
+	 0 );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v30,
+	          scca_test_file_metrics_values_v23_data,
+	          64,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->start_times[ 0 ]",
+	 file_metrics_values->start_times[ 0 ],
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->filename_string_offsets[ 0 ]",
+	 file_metrics_values->filename_string_offsets[ 0 ],
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->filename_string_numbers_of_characters[ 0 ]",
+	 file_metrics_values->filename_string_numbers_of_characters[ 0 ],
+	 0x16 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->flags[ 0 ]",
+	 file_metrics_values->flags[ 0 ],
+	 0x00000200UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "file_metrics_values->file_references[ 0 ]",
+	 file_metrics_values->file_references[ 0 ],
+	 (uint64_t) 0x0002000000003f3aULL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->filename_string_offsets[ 1 ]",
+	 file_metrics_values->filename_string_offsets[ 1 ],
+	 0x2e );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "file_metrics_values->has_file_references",
+	 file_metrics_values->has_file_references,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_metrics_values->filename_indexes[ 1 ]",
+	 file_metrics_values->filename_indexes[ 1 ],
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_read_data(
+	          NULL,
+	          &libscca_format_layout_v17,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          NULL,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v17,
+	          NULL,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v17,
+	          scca_test_file_metrics_values_v17_data,
+	          (size_t) SSIZE_MAX + 1,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v23,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v17,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_values_resolve_filename_index function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_resolve_filename_index(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	libscca_filename_strings_t *filename_strings       = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_strings_initialize(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_read_data(
+	          file_metrics_values,
+	          &libscca_format_layout_v17,
+	          scca_test_file_metrics_values_v17_data,
+	          40,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_file_metrics_values_resolve_filename_index(
+	          file_metrics_values,
+	          filename_strings,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_metrics_values->filename_indexes[ 1 ]",
+	 file_metrics_values->filename_indexes[ 1 ],
+	 -1 );
+
+	result = libscca_file_metrics_values_resolve_filename_indexes(
+	          file_metrics_values,
+	          filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_resolve_filename_index(
+	          NULL,
+	          filename_strings,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_resolve_filename_index(
+	          file_metrics_values,
+	          NULL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_resolve_filename_index(
+	          file_metrics_values,
+	          filename_strings,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_resolve_filename_indexes(
+	          NULL,
+	          filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_free(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_values_sort_by_start_time function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_sort_by_start_time(
+     void )
+{
+	uint32_t start_times[ 6 ] = {
+		0x00020001UL, 0x00000005UL, 0x01000000UL, 0x00000005UL, 0x00000001UL, 0x00020000UL };
+
+	int expected_entry_indexes[ 6 ] = {
+		4, 1, 3, 5, 0, 2 };
+
+	int entry_indexes[ 6 ];
+	int scratch_entry_indexes[ 6 ];
+
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	int entry_index                                    = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_resize(
+	          file_metrics_values,
+	          6,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 6;
+	     entry_index++ )
+	{
+		file_metrics_values->start_times[ entry_index ] = start_times[ entry_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libscca_file_metrics_values_sort_by_start_time(
+	          file_metrics_values,
+	          entry_indexes,
+	          scratch_entry_indexes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 6;
+	     entry_index++ )
+	{
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "entry_indexes[ entry_index ]",
+		 entry_indexes[ entry_index ],
+		 expected_entry_indexes[ entry_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_sort_by_start_time(
+	          NULL,
+	          entry_indexes,
+	          scratch_entry_indexes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_sort_by_start_time(
+	          file_metrics_values,
+	          NULL,
+	          scratch_entry_indexes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_sort_by_start_time(
+	          file_metrics_values,
+	          entry_indexes,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_file_metrics_values_build_filename_hash_table and
+ * libscca_file_metrics_values_get_entry_index_by_filename_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_file_metrics_values_get_entry_index_by_filename_hash(
+     void )
+{
+	/* The case folded hashes of filenames 0 and 2 share the lower 32-bit
+	 * to force probing in the hash table
+	 */
+	uint64_t case_folded_hashes[ 3 ] = {
+		0x1111111100000003ULL, 0x2222222200000004ULL, 0x3333333300000003ULL };
+
+	int filename_indexes[ 5 ] = {
+		2, 0, -1, 2, 1 };
+
+	uint32_t hash_table[ 16 ];
+
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	int entry_index                                    = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_resize(
+	          file_metrics_values,
+	          5,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( entry_index = 0;
+	     entry_index < 5;
+	     entry_index++ )
+	{
+		file_metrics_values->filename_indexes[ entry_index ] = filename_indexes[ entry_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libscca_file_metrics_values_build_filename_hash_table(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          0,
+	          0x3333333300000003ULL,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          1,
+	          0x3333333300000003ULL,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          4,
+	          0x3333333300000003ULL,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          0,
+	          0x1111111100000003ULL,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          0,
+	          0x4444444400000003ULL,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_file_metrics_values_build_filename_hash_table(
+	          NULL,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_build_filename_hash_table(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          5,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_file_metrics_values_get_entry_index_by_filename_hash(
+	          file_metrics_values,
+	          case_folded_hashes,
+	          3,
+	          hash_table,
+	          16,
+	          0,
+	          0x3333333300000003ULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_initialize",
+	 scca_test_file_metrics_values_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_free",
+	 scca_test_file_metrics_values_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_clear",
+	 scca_test_file_metrics_values_clear );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_read_data",
+	 scca_test_file_metrics_values_read_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_resolve_filename_index",
+	 scca_test_file_metrics_values_resolve_filename_index );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_sort_by_start_time",
+	 scca_test_file_metrics_values_sort_by_start_time );
+
+	SCCA_TEST_RUN(
+	 "libscca_file_metrics_values_get_entry_index_by_filename_hash",
+	 scca_test_file_metrics_values_get_entry_index_by_filename_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
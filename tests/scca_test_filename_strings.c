@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -35,6 +36,10 @@
 
 #include "../libscca/libscca_filename_strings.h"
 
+uint8_t scca_test_filename_strings_data1[ 22 ] = {
+	0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00,
+	0x00, 0x00, 0x47, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
 
 /* Tests the libscca_filename_strings_initialize function
@@ -270,6 +275,219 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libscca_filename_strings_get_index_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_strings_get_index_by_offset(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	int filename_index                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_strings_initialize(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_read_data(
+	          filename_strings,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          0,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          10,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          18,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an offset that is not the start of a filename
+	 */
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          6,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          0xffffffffUL,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_get_index_by_offset(
+	          NULL,
+	          0,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_get_index_by_offset(
+	          filename_strings,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_strings_free(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libscca_filename_strings_get_number_of_filenames function
  * Returns 1 if successful or 0 if not
  */
@@ -393,50 +611,1467 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libscca_filename_strings_read_utf8_strings function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
-#endif
+int scca_test_filename_strings_read_utf8_strings(
+     void )
 {
-	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
-	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t utf8_string[ 16 ];
 
-#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+	libcerror_error_t *error                     = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	size_t utf8_string_size                      = 0;
+	int result                                   = 0;
 
-	SCCA_TEST_RUN(
-	 "libscca_filename_strings_initialize",
-	 scca_test_filename_strings_initialize );
+	/* Initialize test
+	 */
+	result = libscca_filename_strings_initialize(
+	          &filename_strings,
+	          &error );
 
-	SCCA_TEST_RUN(
-	 "libscca_filename_strings_free",
-	 scca_test_filename_strings_free );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libscca_filename_strings_clear */
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings",
+	 filename_strings );
 
-	/* TODO: add tests for libscca_filename_strings_read */
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libscca_filename_strings_get_index_by_offset */
+	filename_strings->use_utf8_cache = 1;
 
-	SCCA_TEST_RUN(
-	 "libscca_filename_strings_get_number_of_filenames",
-	 scca_test_filename_strings_get_number_of_filenames );
+	/* Test regular cases
+	 */
+	result = libscca_filename_strings_read_data(
+	          filename_strings,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
 
-	/* TODO: add tests for libscca_filename_strings_get_utf8_filename_size */
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libscca_filename_strings_get_utf8_filename */
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libscca_filename_strings_get_utf16_filename_size */
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings->utf8_strings",
+	 filename_strings->utf8_strings );
 
-	/* TODO: add tests for libscca_filename_strings_get_utf16_filename */
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "filename_strings->utf8_strings_size",
+	 filename_strings->utf8_strings_size,
+	 (size_t) 11 );
+
+	result = libscca_filename_strings_get_utf8_filename_size(
+	          filename_strings,
+	          2,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_utf8_filename(
+	          filename_strings,
+	          2,
+	          utf8_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "DEF",
+	          4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_get_utf8_filename(
+	          filename_strings,
+	          4,
+	          utf8_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_get_utf8_filename(
+	          filename_strings,
+	          2,
+	          utf8_string,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_read_utf8_strings(
+	          NULL,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_read_utf8_strings(
+	          filename_strings,
+	          NULL,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_strings_free(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_strings_read_front_coded_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_strings_read_front_coded_strings(
+     void )
+{
+	uint16_t utf16_pattern[ 1 ] = { 'e' };
+	uint16_t utf16_string[ 16 ];
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error                     = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	const uint8_t *string_data                   = NULL;
+	size_t string_data_size                      = 0;
+	size_t utf16_string_size                     = 0;
+	size_t utf8_string_size                      = 0;
+	int filename_index                           = 0;
+	int number_of_filenames                      = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_strings_initialize(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filename_strings->use_front_coding = 1;
+	filename_strings->use_utf8_cache   = 1;
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_strings_read_data(
+	          filename_strings,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings->front_coded_strings",
+	 filename_strings->front_coded_strings );
+
+	/* Front-coded filenames are already stored UTF-8 encoded
+	 */
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings->utf8_strings",
+	 filename_strings->utf8_strings );
+
+	result = libscca_filename_strings_get_number_of_filenames(
+	          filename_strings,
+	          &number_of_filenames,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_filenames",
+	 number_of_filenames,
+	 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_utf8_filename_size(
+	          filename_strings,
+	          2,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_utf8_filename(
+	          filename_strings,
+	          2,
+	          utf8_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "DEF",
+	          4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_filename_strings_get_utf16_filename_size(
+	          filename_strings,
+	          1,
+	          &utf16_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_utf16_filename(
+	          filename_strings,
+	          1,
+	          utf16_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "utf16_string[ 1 ]",
+	 utf16_string[ 1 ],
+	 (uint16_t) 'C' );
+
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          filename_strings,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_get_string_data(
+	          filename_strings,
+	          2,
+	          &string_data,
+	          &string_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_read_front_coded_strings(
+	          filename_strings,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_strings_free(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Counts the visited filenames and stops at the filename with the index in the callback arguments
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int scca_test_filename_strings_visit_callback(
+     int filename_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     void *callback_arguments )
+{
+	int *visit_values = (int *) callback_arguments;
+
+	if( ( utf16_stream == NULL )
+	 || ( utf16_stream_size < 2 )
+	 || ( visit_values[ 0 ] != filename_index ) )
+	{
+		return( -1 );
+	}
+	visit_values[ 0 ] += 1;
+
+	if( filename_index == 2 )
+	{
+		visit_values[ 2 ] = (int) utf16_stream_size;
+	}
+	if( filename_index == visit_values[ 1 ] )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libscca_filename_strings_visit_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_strings_visit_data(
+     void )
+{
+	int visit_values[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	visit_values[ 0 ] = 0;
+	visit_values[ 1 ] = -1;
+	visit_values[ 2 ] = 0;
+
+	result = libscca_filename_strings_visit_data(
+	          scca_test_filename_strings_data1,
+	          22,
+	          &scca_test_filename_strings_visit_callback,
+	          visit_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_visited_filenames",
+	 visit_values[ 0 ],
+	 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "utf16_stream_size",
+	 visit_values[ 2 ],
+	 8 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test stopping the visit
+	 */
+	visit_values[ 0 ] = 0;
+	visit_values[ 1 ] = 1;
+	visit_values[ 2 ] = 0;
+
+	result = libscca_filename_strings_visit_data(
+	          scca_test_filename_strings_data1,
+	          22,
+	          &scca_test_filename_strings_visit_callback,
+	          visit_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_visited_filenames",
+	 visit_values[ 0 ],
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_visit_data(
+	          NULL,
+	          22,
+	          &scca_test_filename_strings_visit_callback,
+	          visit_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_visit_data(
+	          scca_test_filename_strings_data1,
+	          22,
+	          NULL,
+	          visit_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test the callback function failing
+	 */
+	visit_values[ 0 ] = 1;
+	visit_values[ 1 ] = -1;
+
+	result = libscca_filename_strings_visit_data(
+	          scca_test_filename_strings_data1,
+	          22,
+	          &scca_test_filename_strings_visit_callback,
+	          visit_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_strings_match_string_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_strings_match_string_data(
+     void )
+{
+	uint16_t utf16_pattern1[ 3 ] = { 'D', 'E', 'F' };
+	uint16_t utf16_pattern2[ 4 ] = { 'd', 'e', 'f', 'g' };
+
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern1,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern2,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern2,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern1,
+	          2,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern1,
+	          2,
+	          LIBSCCA_FILENAME_MATCH_TYPE_PREFIX,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          &( utf16_pattern1[ 1 ] ),
+	          2,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          &( utf16_pattern1[ 1 ] ),
+	          2,
+	          LIBSCCA_FILENAME_MATCH_TYPE_PREFIX,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          &( utf16_pattern2[ 1 ] ),
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern2,
+	          4,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          &( utf16_pattern2[ 3 ] ),
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_match_string_data(
+	          NULL,
+	          8,
+	          utf16_pattern1,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          (size_t) SSIZE_MAX + 1,
+	          utf16_pattern1,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          NULL,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern1,
+	          3,
+	          -1,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_match_string_data(
+	          &( scca_test_filename_strings_data1[ 10 ] ),
+	          8,
+	          utf16_pattern1,
+	          3,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0x80,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_strings_get_index_by_utf16_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_strings_get_index_by_utf16_pattern(
+     void )
+{
+	uint16_t utf16_pattern[ 2 ] = { 'e', 'g' };
+
+	libcerror_error_t *error                     = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	int filename_index                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_strings_initialize(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_read_data(
+	          filename_strings,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          filename_strings,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          filename_strings,
+	          &( utf16_pattern[ 1 ] ),
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          filename_strings,
+	          &( utf16_pattern[ 1 ] ),
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          0,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          NULL,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          filename_strings,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_filename_strings_get_index_by_utf16_pattern(
+	          filename_strings,
+	          NULL,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_strings_free(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_filename_strings_get_next_index_by_utf16_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_filename_strings_get_next_index_by_utf16_pattern(
+     void )
+{
+	uint16_t utf16_pattern[ 2 ] = { 'e', 'g' };
+
+	libcerror_error_t *error                     = NULL;
+	libscca_filename_strings_t *filename_strings = NULL;
+	int filename_index                           = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_filename_strings_initialize(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_read_data(
+	          filename_strings,
+	          scca_test_filename_strings_data1,
+	          22,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_filename_strings_get_next_index_by_utf16_pattern(
+	          filename_strings,
+	          0,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Continue after the previous match
+	 */
+	result = libscca_filename_strings_get_next_index_by_utf16_pattern(
+	          filename_strings,
+	          filename_index + 1,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_filename_strings_get_next_index_by_utf16_pattern(
+	          filename_strings,
+	          3,
+	          &( utf16_pattern[ 1 ] ),
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_EXACT,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filename_index",
+	 filename_index,
+	 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A first filename index beyond the last filename does not match
+	 */
+	result = libscca_filename_strings_get_next_index_by_utf16_pattern(
+	          filename_strings,
+	          8,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_filename_strings_get_next_index_by_utf16_pattern(
+	          filename_strings,
+	          -1,
+	          utf16_pattern,
+	          1,
+	          LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING,
+	          LIBSCCA_FILENAME_MATCH_FLAG_CASE_INSENSITIVE,
+	          &filename_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_filename_strings_free(
+	          &filename_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filename_strings",
+	 filename_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filename_strings != NULL )
+	{
+		libscca_filename_strings_free(
+		 &filename_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_initialize",
+	 scca_test_filename_strings_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_free",
+	 scca_test_filename_strings_free );
+
+	/* TODO: add tests for libscca_filename_strings_clear */
+
+	/* TODO: add tests for libscca_filename_strings_read */
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_read_utf8_strings",
+	 scca_test_filename_strings_read_utf8_strings );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_read_front_coded_strings",
+	 scca_test_filename_strings_read_front_coded_strings );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_visit_data",
+	 scca_test_filename_strings_visit_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_get_index_by_offset",
+	 scca_test_filename_strings_get_index_by_offset );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_get_number_of_filenames",
+	 scca_test_filename_strings_get_number_of_filenames );
+
+	/* TODO: add tests for libscca_filename_strings_get_utf8_filename_size */
+
+	/* TODO: add tests for libscca_filename_strings_get_utf8_filename */
+
+	/* TODO: add tests for libscca_filename_strings_get_utf16_filename_size */
+
+	/* TODO: add tests for libscca_filename_strings_get_utf16_filename */
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_match_string_data",
+	 scca_test_filename_strings_match_string_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_get_index_by_utf16_pattern",
+	 scca_test_filename_strings_get_index_by_utf16_pattern );
+
+	SCCA_TEST_RUN(
+	 "libscca_filename_strings_get_next_index_by_utf16_pattern",
+	 scca_test_filename_strings_get_next_index_by_utf16_pattern );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
 
@@ -0,0 +1,393 @@
+/*
+ * Library format layout functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_format_layout.h"
+#include "../libscca/scca_file_information.h"
+#include "../libscca/scca_file_metrics_array.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_format_layout_get_by_format_version function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_format_layout_get_by_format_version(
+     void )
+{
+	const libscca_format_layout_t *format_layout = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_format_layout_get_by_format_version(
+	          17,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "format_layout",
+	 (intptr_t) format_layout,
+	 (intptr_t) &libscca_format_layout_v17 );
+
+	result = libscca_format_layout_get_by_format_version(
+	          30,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "format_layout",
+	 (intptr_t) format_layout,
+	 (intptr_t) &libscca_format_layout_v30 );
+
+	result = libscca_format_layout_get_by_format_version(
+	          99,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_format_layout_get_by_format_version(
+	          17,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_format_layout_get_by_metrics_array_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_format_layout_get_by_metrics_array_offset(
+     void )
+{
+	const libscca_format_layout_t *format_layout = NULL;
+	libcerror_error_t *error                     = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          &libscca_format_layout_v23,
+	          0x00000098UL,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "format_layout",
+	 (intptr_t) format_layout,
+	 (intptr_t) &libscca_format_layout_v23 );
+
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          &libscca_format_layout_v30,
+	          0x00000128UL,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "format_layout",
+	 (intptr_t) format_layout,
+	 (intptr_t) &libscca_format_layout_v30_2 );
+
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          &libscca_format_layout_v30,
+	          0x00000130UL,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "format_layout",
+	 (intptr_t) format_layout,
+	 (intptr_t) &libscca_format_layout_v30 );
+
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          &libscca_format_layout_v30,
+	          0x00000100UL,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          NULL,
+	          0x00000130UL,
+	          &format_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_format_layout_get_by_metrics_array_offset(
+	          &libscca_format_layout_v30,
+	          0x00000130UL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests that the format layout offsets correspond with the on-disk structures
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_format_layout_offsets(
+     void )
+{
+	scca_file_information_v17_t file_information_v17;
+	scca_file_information_v23_t file_information_v23;
+	scca_file_information_v26_t file_information_v26;
+	scca_file_information_v30_2_t file_information_v30_2;
+	scca_file_metrics_array_entry_v17_t file_metrics_entry_v17;
+	scca_file_metrics_array_entry_v23_t file_metrics_entry_v23;
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "last_run_times_offset",
+	 libscca_format_layout_v17.last_run_times_offset,
+	 (size_t) ( file_information_v17.last_run_time - (uint8_t *) &file_information_v17 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "run_count_offset",
+	 libscca_format_layout_v17.run_count_offset,
+	 (size_t) ( file_information_v17.run_count - (uint8_t *) &file_information_v17 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "last_run_times_offset",
+	 libscca_format_layout_v23.last_run_times_offset,
+	 (size_t) ( file_information_v23.last_run_time - (uint8_t *) &file_information_v23 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "run_count_offset",
+	 libscca_format_layout_v23.run_count_offset,
+	 (size_t) ( file_information_v23.run_count - (uint8_t *) &file_information_v23 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "last_run_times_offset",
+	 libscca_format_layout_v26.last_run_times_offset,
+	 (size_t) ( file_information_v26.last_run_time - (uint8_t *) &file_information_v26 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "run_count_offset",
+	 libscca_format_layout_v26.run_count_offset,
+	 (size_t) ( file_information_v26.run_count - (uint8_t *) &file_information_v26 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "run_count_offset",
+	 libscca_format_layout_v30.run_count_offset,
+	 (size_t) ( file_information_v26.run_count - (uint8_t *) &file_information_v26 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "last_run_times_offset",
+	 libscca_format_layout_v30_2.last_run_times_offset,
+	 (size_t) ( file_information_v30_2.last_run_time - (uint8_t *) &file_information_v30_2 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "run_count_offset",
+	 libscca_format_layout_v30_2.run_count_offset,
+	 (size_t) ( file_information_v30_2.run_count - (uint8_t *) &file_information_v30_2 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "filename_string_offset_offset",
+	 libscca_format_layout_v17.filename_string_offset_offset,
+	 (size_t) ( file_metrics_entry_v17.filename_string_offset - (uint8_t *) &file_metrics_entry_v17 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "file_metrics_flags_offset",
+	 libscca_format_layout_v17.file_metrics_flags_offset,
+	 (size_t) ( file_metrics_entry_v17.flags - (uint8_t *) &file_metrics_entry_v17 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "filename_string_offset_offset",
+	 libscca_format_layout_v23.filename_string_offset_offset,
+	 (size_t) ( file_metrics_entry_v23.filename_string_offset - (uint8_t *) &file_metrics_entry_v23 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "file_metrics_flags_offset",
+	 libscca_format_layout_v23.file_metrics_flags_offset,
+	 (size_t) ( file_metrics_entry_v23.flags - (uint8_t *) &file_metrics_entry_v23 ) );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_format_layout_get_by_format_version",
+	 scca_test_format_layout_get_by_format_version );
+
+	SCCA_TEST_RUN(
+	 "libscca_format_layout_get_by_metrics_array_offset",
+	 scca_test_format_layout_get_by_metrics_array_offset );
+
+	SCCA_TEST_RUN(
+	 "libscca_format_layout_offsets",
+	 scca_test_format_layout_offsets );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
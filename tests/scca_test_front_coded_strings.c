@@ -0,0 +1,646 @@
+/*
+ * Library front-coded strings functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_front_coded_strings.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+#define SCCA_TEST_FRONT_CODED_STRINGS_NUMBER_OF_ASCII_STRINGS	20
+
+static const char *scca_test_front_coded_strings_ascii_strings[ SCCA_TEST_FRONT_CODED_STRINGS_NUMBER_OF_ASCII_STRINGS ] = {
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\NTDLL.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\KERNEL32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\KERNELBASE.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\LOCALE.NLS",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\USER32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\GDI32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\IMM32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\MSVCRT.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\ADVAPI32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\SECHOST.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\RPCRT4.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\COMBASE.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\UCRTBASE.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\OLE32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\SHELL32.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\SHLWAPI.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\SYSTEM32\\SHCORE.DLL",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS\\NOTEPAD.EXE",
+	"\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\PROGRAM FILES\\NOTEPAD.EXE",
+	"" };
+
+/* A filename with a 2, 3 and 4 byte UTF-8 character
+ */
+static const uint8_t scca_test_front_coded_strings_utf16_stream[ 16 ] = {
+	0x5c, 0x00, 0x41, 0x00, 0xe9, 0x00, 0xac, 0x20, 0x3d, 0xd8, 0x00, 0xde, 0x00, 0x00 };
+
+static const uint8_t scca_test_front_coded_strings_utf8_string[ 13 ] = {
+	0x5c, 0x41, 0xc3, 0xa9, 0xe2, 0x82, 0xac, 0xf0, 0x9f, 0x98, 0x80, 0x00 };
+
+/* Copies an ASCII string into UTF-16 little-endian string data
+ * Returns the size of the UTF-16 little-endian string data
+ */
+size_t scca_test_front_coded_strings_copy_utf16_stream(
+        uint8_t *data,
+        const char *ascii_string,
+        int has_end_of_string )
+{
+	size_t data_offset = 0;
+
+	while( *ascii_string != 0 )
+	{
+		data[ data_offset++ ] = (uint8_t) *ascii_string;
+		data[ data_offset++ ] = 0;
+
+		ascii_string++;
+	}
+	if( has_end_of_string != 0 )
+	{
+		data[ data_offset++ ] = 0;
+		data[ data_offset++ ] = 0;
+	}
+	return( data_offset );
+}
+
+/* Tests the libscca_front_coded_strings_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_front_coded_strings_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libscca_front_coded_strings_t *front_coded_strings = NULL;
+	int result                                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_front_coded_strings_initialize(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "front_coded_strings",
+	 front_coded_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_front_coded_strings_free(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "front_coded_strings",
+	 front_coded_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_front_coded_strings_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	front_coded_strings = (libscca_front_coded_strings_t *) 0x12345678UL;
+
+	result = libscca_front_coded_strings_initialize(
+	          &front_coded_strings,
+	          &error );
+
+	front_coded_strings = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( front_coded_strings != NULL )
+	{
+		libscca_front_coded_strings_free(
+		 &front_coded_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_front_coded_strings_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_front_coded_strings_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_front_coded_strings_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_front_coded_strings_read_utf16_streams function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_front_coded_strings_read_utf16_streams(
+     void )
+{
+	uint8_t data[ 4096 ];
+	uint8_t utf8_string[ 128 ];
+	uint32_t offsets[ SCCA_TEST_FRONT_CODED_STRINGS_NUMBER_OF_ASCII_STRINGS + 2 ];
+
+	libcerror_error_t *error                           = NULL;
+	libscca_front_coded_strings_t *front_coded_strings = NULL;
+	uint8_t *utf16_stream                              = NULL;
+	size_t data_size                                   = 0;
+	size_t stream_size                                 = 0;
+	size_t utf16_stream_size                           = 0;
+	size_t utf8_string_size                            = 0;
+	int number_of_offsets                              = 0;
+	int result                                         = 0;
+	int string_index                                   = 0;
+
+	/* Initialize test
+	 */
+	for( string_index = 0;
+	     string_index < SCCA_TEST_FRONT_CODED_STRINGS_NUMBER_OF_ASCII_STRINGS;
+	     string_index++ )
+	{
+		offsets[ number_of_offsets++ ] = (uint32_t) data_size;
+
+		data_size += scca_test_front_coded_strings_copy_utf16_stream(
+		              &( data[ data_size ] ),
+		              scca_test_front_coded_strings_ascii_strings[ string_index ],
+		              1 );
+	}
+	offsets[ number_of_offsets++ ] = (uint32_t) data_size;
+
+	memory_copy(
+	 &( data[ data_size ] ),
+	 scca_test_front_coded_strings_utf16_stream,
+	 14 );
+
+	data_size += 14;
+
+	/* The last string has no end of string character
+	 */
+	offsets[ number_of_offsets++ ] = (uint32_t) data_size;
+
+	data_size += scca_test_front_coded_strings_copy_utf16_stream(
+	              &( data[ data_size ] ),
+	              "\\VOLUME{01D0A1B2C3D4E5F6-12345678}\\WINDOWS",
+	              0 );
+
+	result = libscca_front_coded_strings_initialize(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "front_coded_strings",
+	 front_coded_strings );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_front_coded_strings_read_utf16_streams(
+	          front_coded_strings,
+	          data,
+	          data_size,
+	          offsets,
+	          number_of_offsets,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "front_coded_strings->number_of_strings",
+	 front_coded_strings->number_of_strings,
+	 number_of_offsets );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "front_coded_strings->number_of_blocks",
+	 front_coded_strings->number_of_blocks,
+	 2 );
+
+	/* The shared prefixes are only stored once per block
+	 */
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "front_coded_strings->data_size",
+	 (uint64_t) front_coded_strings->data_size,
+	 (uint64_t) ( data_size / 4 ) );
+
+	/* Every string is restored exactly
+	 */
+	for( string_index = 0;
+	     string_index < number_of_offsets;
+	     string_index++ )
+	{
+		if( ( string_index + 1 ) < number_of_offsets )
+		{
+			stream_size = offsets[ string_index + 1 ] - offsets[ string_index ];
+		}
+		else
+		{
+			stream_size = data_size - offsets[ string_index ];
+		}
+		result = libscca_front_coded_strings_get_utf16_stream(
+		          front_coded_strings,
+		          string_index,
+		          &utf16_stream,
+		          &utf16_stream_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "utf16_stream",
+		 utf16_stream );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SCCA_TEST_ASSERT_EQUAL_SIZE(
+		 "utf16_stream_size",
+		 utf16_stream_size,
+		 stream_size );
+
+		result = memory_compare(
+		          utf16_stream,
+		          &( data[ offsets[ string_index ] ] ),
+		          stream_size );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 utf16_stream );
+
+		utf16_stream = NULL;
+
+		result = libscca_front_coded_strings_get_utf8_string_size(
+		          front_coded_strings,
+		          string_index,
+		          &utf8_string_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_front_coded_strings_copy_utf8_string(
+		          front_coded_strings,
+		          string_index,
+		          utf8_string,
+		          128,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( string_index < SCCA_TEST_FRONT_CODED_STRINGS_NUMBER_OF_ASCII_STRINGS )
+		{
+			SCCA_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_size",
+			 utf8_string_size,
+			 (size_t) narrow_string_length( scca_test_front_coded_strings_ascii_strings[ string_index ] ) + 1 );
+
+			result = narrow_string_compare(
+			          (char *) utf8_string,
+			          scca_test_front_coded_strings_ascii_strings[ string_index ],
+			          utf8_string_size );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else if( string_index == SCCA_TEST_FRONT_CODED_STRINGS_NUMBER_OF_ASCII_STRINGS )
+		{
+			SCCA_TEST_ASSERT_EQUAL_SIZE(
+			 "utf8_string_size",
+			 utf8_string_size,
+			 (size_t) 12 );
+
+			result = memory_compare(
+			          utf8_string,
+			          scca_test_front_coded_strings_utf8_string,
+			          12 );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libscca_front_coded_strings_copy_utf8_string(
+	          front_coded_strings,
+	          1,
+	          utf8_string,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_front_coded_strings_get_utf8_string_size(
+	          front_coded_strings,
+	          number_of_offsets,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_front_coded_strings_read_utf16_streams(
+	          front_coded_strings,
+	          data,
+	          data_size,
+	          offsets,
+	          number_of_offsets,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_front_coded_strings_free(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a filename with an unpaired surrogate is not stored front-coded
+	 */
+	result = libscca_front_coded_strings_initialize(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ offsets[ 1 ] + 2 ] = 0x00;
+	data[ offsets[ 1 ] + 3 ] = 0xd8;
+
+	result = libscca_front_coded_strings_read_utf16_streams(
+	          front_coded_strings,
+	          data,
+	          data_size,
+	          offsets,
+	          number_of_offsets,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "front_coded_strings->data",
+	 front_coded_strings->data );
+
+	result = libscca_front_coded_strings_free(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf16_stream != NULL )
+	{
+		memory_free(
+		 utf16_stream );
+	}
+	if( front_coded_strings != NULL )
+	{
+		libscca_front_coded_strings_free(
+		 &front_coded_strings,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_front_coded_strings_initialize",
+	 scca_test_front_coded_strings_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_front_coded_strings_free",
+	 scca_test_front_coded_strings_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_front_coded_strings_read_utf16_streams",
+	 scca_test_front_coded_strings_read_utf16_streams );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1630 @@
+/*
+ * Library index functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_index.h"
+
+uint8_t scca_test_index_data1[ 16 ] = {
+	0x53, 0x43, 0x43, 0x41, 0x49, 0x4e, 0x44, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libscca_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_index_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_index_t *index   = NULL;
+	int result               = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_index_initialize(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_free(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_index_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index = (libscca_index_t *) 0x12345678UL;
+
+	result = libscca_index_initialize(
+	          &index,
+	          &error );
+
+	index = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_index_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_index_initialize(
+		          &index,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( index != NULL )
+			{
+				libscca_index_free(
+				 &index,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "index",
+			 index );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_index_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_index_initialize(
+		          &index,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( index != NULL )
+			{
+				libscca_index_free(
+				 &index,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "index",
+			 index );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libscca_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_index_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_index_open_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_index_open_data(
+     void )
+{
+	uint8_t data[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_index_t *index   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_index_initialize(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_index_open_data(
+	          NULL,
+	          scca_test_index_data1,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_index_open_data(
+	          index,
+	          NULL,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data too small to contain the header
+	 */
+	result = libscca_index_open_data(
+	          index,
+	          scca_test_index_data1,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data with an unsupported signature
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     128 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_index_open_data(
+	          index,
+	          data,
+	          128,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_index_free(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libscca_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests building, writing and opening an index
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_index_write_data(
+     void )
+{
+	uint8_t utf8_label[ 16 ];
+
+	libcerror_error_t *error    = NULL;
+	libscca_index_t *index      = NULL;
+	libscca_index_t *read_index = NULL;
+	uint8_t *data               = NULL;
+	uint64_t number_of_postings = 0;
+	size_t data_size            = 0;
+	size_t utf8_label_size      = 0;
+	uint32_t string_index1      = 0;
+	uint32_t string_index2      = 0;
+	uint32_t string_index3      = 0;
+	int file_index              = 0;
+	int metrics_entry_index     = 0;
+	int number_of_files         = 0;
+	int number_of_strings       = 0;
+	int result                  = 0;
+	int string_index            = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_index_initialize(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append a first file that loaded NTDLL.DLL and KERNEL32.DLL
+	 */
+	result = libscca_internal_index_append_string(
+	          (libscca_internal_index_t *) index,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &string_index1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_posting(
+	          (libscca_internal_index_t *) index,
+	          string_index1,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_string(
+	          (libscca_internal_index_t *) index,
+	          (uint8_t *) "KERNEL32.DLL",
+	          12,
+	          &string_index2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_index2",
+	 string_index2,
+	 (uint32_t) 1 );
+
+	result = libscca_internal_index_append_posting(
+	          (libscca_internal_index_t *) index,
+	          string_index2,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_file_entry(
+	          (libscca_internal_index_t *) index,
+	          (uint8_t *) "A.pf",
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append a second file that loaded NTDLL.DLL, the string is not appended again
+	 */
+	result = libscca_internal_index_append_string(
+	          (libscca_internal_index_t *) index,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &string_index3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_index3",
+	 string_index3,
+	 string_index1 );
+
+	result = libscca_internal_index_append_posting(
+	          (libscca_internal_index_t *) index,
+	          string_index3,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_file_entry(
+	          (libscca_internal_index_t *) index,
+	          (uint8_t *) "B.pf",
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_index_get_data_size(
+	          index,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "data_size",
+	 (uint64_t) data_size,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libscca_index_write_data(
+	          index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_initialize(
+	          &read_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "read_index",
+	 read_index );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_open_data(
+	          read_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_number_of_files(
+	          read_index,
+	          &number_of_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_number_of_strings(
+	          read_index,
+	          &number_of_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_utf8_file_label_size(
+	          read_index,
+	          1,
+	          &utf8_label_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_label_size",
+	 utf8_label_size,
+	 (size_t) 5 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_utf8_file_label(
+	          read_index,
+	          1,
+	          utf8_label,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_label,
+	          "B.pf",
+	          5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a filename that was loaded by both files
+	 */
+	result = libscca_index_get_string_index_by_utf8_filename(
+	          read_index,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_number_of_postings(
+	          read_index,
+	          string_index,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_postings",
+	 number_of_postings,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_posting(
+	          read_index,
+	          string_index,
+	          1,
+	          &file_index,
+	          &metrics_entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "metrics_entry_index",
+	 metrics_entry_index,
+	 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a filename that was loaded by one file
+	 */
+	result = libscca_index_get_string_index_by_utf8_filename(
+	          read_index,
+	          (uint8_t *) "KERNEL32.DLL",
+	          12,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_posting(
+	          read_index,
+	          string_index,
+	          0,
+	          &file_index,
+	          &metrics_entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "metrics_entry_index",
+	 metrics_entry_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a filename that was not loaded, the comparison is case-sensitive
+	 */
+	result = libscca_index_get_string_index_by_utf8_filename(
+	          read_index,
+	          (uint8_t *) "ntdll.dll",
+	          9,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_index_get_posting(
+	          read_index,
+	          string_index,
+	          2,
+	          &file_index,
+	          &metrics_entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_index_write_data(
+	          index,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_index_open_data(
+	          read_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_index_free(
+	          &read_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data with a truncated section
+	 */
+	result = libscca_index_initialize(
+	          &read_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_open_data(
+	          read_index,
+	          data,
+	          data_size - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_index_free(
+	          &read_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libscca_index_free(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_index != NULL )
+	{
+		libscca_index_free(
+		 &read_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( index != NULL )
+	{
+		libscca_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_index_append_index function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_index_append_index(
+     void )
+{
+	uint8_t utf8_label[ 16 ];
+
+	libcerror_error_t *error      = NULL;
+	libscca_index_t *index        = NULL;
+	libscca_index_t *merged_index = NULL;
+	libscca_index_t *source_index = NULL;
+	uint8_t *data                 = NULL;
+	uint8_t *merged_data          = NULL;
+	uint64_t number_of_postings   = 0;
+	size_t data_size              = 0;
+	size_t merged_data_size       = 0;
+	uint32_t string_index1        = 0;
+	int file_index                = 0;
+	int metrics_entry_index       = 0;
+	int number_of_files           = 0;
+	int result                    = 0;
+	int string_index              = 0;
+
+	/* Initialize test, the source index contains one file that loaded NTDLL.DLL
+	 */
+	result = libscca_index_initialize(
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_string(
+	          (libscca_internal_index_t *) source_index,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &string_index1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_posting(
+	          (libscca_internal_index_t *) source_index,
+	          string_index1,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_index_append_file_entry(
+	          (libscca_internal_index_t *) source_index,
+	          (uint8_t *) "A.pf",
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_data_size(
+	          source_index,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libscca_index_write_data(
+	          source_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_free(
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_initialize(
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_open_data(
+	          source_index,
+	          data,
+	          data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_initialize(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the file indexes of the second source follow those of the first
+	 */
+	result = libscca_index_append_index(
+	          index,
+	          source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_append_index(
+	          index,
+	          source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_data_size(
+	          index,
+	          &merged_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	merged_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * merged_data_size );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "merged_data",
+	 merged_data );
+
+	result = libscca_index_write_data(
+	          index,
+	          merged_data,
+	          merged_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_initialize(
+	          &merged_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_open_data(
+	          merged_index,
+	          merged_data,
+	          merged_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_number_of_files(
+	          merged_index,
+	          &number_of_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_utf8_file_label(
+	          merged_index,
+	          1,
+	          utf8_label,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_label,
+	          "A.pf",
+	          5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_index_get_string_index_by_utf8_filename(
+	          merged_index,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &string_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_number_of_postings(
+	          merged_index,
+	          string_index,
+	          &number_of_postings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_postings",
+	 number_of_postings,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_get_posting(
+	          merged_index,
+	          string_index,
+	          1,
+	          &file_index,
+	          &metrics_entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "metrics_entry_index",
+	 metrics_entry_index,
+	 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_index_append_index(
+	          NULL,
+	          source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_index_append_index(
+	          index,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An opened index cannot be appended to
+	 */
+	result = libscca_index_append_index(
+	          merged_index,
+	          source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_index_free(
+	          &merged_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_free(
+	          &index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_index_free(
+	          &source_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 merged_data );
+
+	merged_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merged_index != NULL )
+	{
+		libscca_index_free(
+		 &merged_index,
+		 NULL );
+	}
+	if( merged_data != NULL )
+	{
+		memory_free(
+		 merged_data );
+	}
+	if( index != NULL )
+	{
+		libscca_index_free(
+		 &index,
+		 NULL );
+	}
+	if( source_index != NULL )
+	{
+		libscca_index_free(
+		 &source_index,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_index_initialize",
+	 scca_test_index_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_index_free",
+	 scca_test_index_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_index_open_data",
+	 scca_test_index_open_data );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_index_write_data",
+	 scca_test_index_write_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_index_append_index",
+	 scca_test_index_append_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
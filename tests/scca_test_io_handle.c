@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,7 +34,18 @@
 #include "scca_test_memory.h"
 #include "scca_test_unused.h"
 
+#include "../libscca/libscca_file_metrics_values.h"
 #include "../libscca/libscca_io_handle.h"
+#include "../libscca/libscca_volume_information.h"
+#include "../libscca/libscca_volumes.h"
+
+uint8_t scca_test_io_handle_volumes_information_data1[ 88 ] = {
+	0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3e, 0xd5, 0xde, 0xb1, 0x9d, 0x01,
+	0x78, 0x56, 0x34, 0x12, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x4f, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x41, 0x00, 0x42, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
 #if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
 
@@ -398,52 +410,851 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+/* Tests the libscca_io_handle_get_section_data_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_io_handle_get_section_data_buffer(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_io_handle_t *io_handle = NULL;
+	uint8_t *section_data          = NULL;
+	int result                     = 0;
 
-/* The main program
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_io_handle_get_section_data_buffer(
+	          io_handle,
+	          64,
+	          &section_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "section_data",
+	 section_data );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->section_data_size",
+	 io_handle->section_data_size,
+	 (size_t) 64 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the buffer is retained when the IO handle is cleared
+	 */
+	result = libscca_io_handle_clear(
+	          io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->section_data_size",
+	 io_handle->section_data_size,
+	 (size_t) 64 );
+
+	result = libscca_io_handle_get_section_data_buffer(
+	          io_handle,
+	          32,
+	          &section_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->section_data_size",
+	 io_handle->section_data_size,
+	 (size_t) 64 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_get_section_data_buffer(
+	          io_handle,
+	          128,
+	          &section_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->section_data_size",
+	 io_handle->section_data_size,
+	 (size_t) 128 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_io_handle_get_section_data_buffer(
+	          NULL,
+	          64,
+	          &section_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_get_section_data_buffer(
+	          io_handle,
+	          0,
+	          &section_data,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_get_section_data_buffer(
+	          io_handle,
+	          64,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_io_handle_read_file_metrics_array_data function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
-#endif
+int scca_test_io_handle_read_file_metrics_array_data(
+     void )
 {
-	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
-	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t file_metrics_array_data[ 64 ];
 
-#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+	libcerror_error_t *error                           = NULL;
+	libscca_file_metrics_values_t *file_metrics_values = NULL;
+	libscca_io_handle_t *io_handle                     = NULL;
+	int result                                         = 0;
 
-	SCCA_TEST_RUN(
-	 "libscca_io_handle_initialize",
-	 scca_test_io_handle_initialize );
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	SCCA_TEST_RUN(
-	 "libscca_io_handle_free",
-	 scca_test_io_handle_free );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	SCCA_TEST_RUN(
-	 "libscca_io_handle_clear",
-	 scca_test_io_handle_clear );
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	/* TODO: add tests for libscca_io_handle_read_compressed_file_header */
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libscca_io_handle_read_compressed_blocks */
+	memory_set(
+	 file_metrics_array_data,
+	 0,
+	 64 );
 
-	/* TODO: add tests for libscca_io_handle_read_uncompressed_file_header */
+	result = libscca_io_handle_set_format_version(
+	          io_handle,
+	          17,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libscca_io_handle_read_file_metrics_array */
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libscca_io_handle_read_trace_chain_array */
+	result = libscca_file_metrics_values_initialize(
+	          &file_metrics_values,
+	          &error );
 
-	/* TODO: add tests for libscca_io_handle_read_volumes_information */
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_io_handle_read_file_metrics_array_data(
+	          io_handle,
+	          file_metrics_array_data,
+	          64,
+	          3,
+	          file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libscca_io_handle_read_segment_data */
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_metrics_values->number_of_entries",
+	 file_metrics_values->number_of_entries,
+	 3 );
 
-	/* TODO: add tests for libscca_io_handle_seek_segment_offset */
+	/* Test error cases
+	 */
+	result = libscca_io_handle_read_file_metrics_array_data(
+	          NULL,
+	          file_metrics_array_data,
+	          64,
+	          1,
+	          file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_read_file_metrics_array_data(
+	          io_handle,
+	          NULL,
+	          64,
+	          1,
+	          file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_read_file_metrics_array_data(
+	          io_handle,
+	          file_metrics_array_data,
+	          64,
+	          0,
+	          file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_read_file_metrics_array_data(
+	          io_handle,
+	          file_metrics_array_data,
+	          64,
+	          1,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_io_handle_read_file_metrics_array_data with abort signalled
+	 */
+	io_handle->abort = 1;
+
+	result = libscca_io_handle_read_file_metrics_array_data(
+	          io_handle,
+	          file_metrics_array_data,
+	          64,
+	          1,
+	          file_metrics_values,
+	          &error );
+
+	io_handle->abort = 0;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_metrics_values_free(
+	          &file_metrics_values,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file_metrics_values",
+	 file_metrics_values );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_metrics_values != NULL )
+	{
+		libscca_file_metrics_values_free(
+		 &file_metrics_values,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_io_handle_read_volumes_information_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_io_handle_read_volumes_information_data(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libscca_internal_volume_information_t *volume_information = NULL;
+	libscca_io_handle_t *io_handle                            = NULL;
+	libscca_volumes_t *volumes                                = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_set_format_version(
+	          io_handle,
+	          17,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volumes_initialize(
+	          &volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volumes",
+	 volumes );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_io_handle_read_volumes_information_data(
+	          io_handle,
+	          scca_test_io_handle_volumes_information_data1,
+	          88,
+	          1,
+	          volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "volumes->number_of_volumes",
+	 volumes->number_of_volumes,
+	 1 );
+
+	result = libscca_volumes_get_volume_information_by_index(
+	          volumes,
+	          0,
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_information->serial_number",
+	 volume_information->serial_number,
+	 (uint32_t) 0x12345678UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_information->device_path_size",
+	 volume_information->device_path_size,
+	 6 );
+
+	result = memory_compare(
+	          volume_information->device_path,
+	          "V\0O\0L\0",
+	          6 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "volume_information->number_of_file_references",
+	 volume_information->number_of_file_references,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "volume_information->file_references[ 1 ]",
+	 volume_information->file_references[ 1 ],
+	 (uint64_t) 0x0002000000000006ULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "volume_information->number_of_directory_strings",
+	 volume_information->number_of_directory_strings,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_information->directory_strings_data_size",
+	 volume_information->directory_strings_data_size,
+	 (size_t) 8 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "volume_information->directory_string_offsets_are_set",
+	 volume_information->directory_string_offsets_are_set,
+	 0 );
+
+	result = memory_compare(
+	          volume_information->directory_strings_data,
+	          "\x02\0A\0B\0\0\0",
+	          8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_io_handle_read_volumes_information_data(
+	          NULL,
+	          scca_test_io_handle_volumes_information_data1,
+	          88,
+	          1,
+	          volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_read_volumes_information_data(
+	          io_handle,
+	          NULL,
+	          88,
+	          1,
+	          volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_read_volumes_information_data(
+	          io_handle,
+	          scca_test_io_handle_volumes_information_data1,
+	          88,
+	          0,
+	          volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_io_handle_read_volumes_information_data(
+	          io_handle,
+	          scca_test_io_handle_volumes_information_data1,
+	          88,
+	          1,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_io_handle_read_volumes_information_data with data too small for the device path
+	 */
+	result = libscca_io_handle_read_volumes_information_data(
+	          io_handle,
+	          scca_test_io_handle_volumes_information_data1,
+	          44,
+	          1,
+	          volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "volumes->number_of_volumes",
+	 volumes->number_of_volumes,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libscca_volumes_free(
+	          &volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volumes",
+	 volumes );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volumes != NULL )
+	{
+		libscca_volumes_free(
+		 &volumes,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_initialize",
+	 scca_test_io_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_free",
+	 scca_test_io_handle_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_clear",
+	 scca_test_io_handle_clear );
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_get_section_data_buffer",
+	 scca_test_io_handle_get_section_data_buffer );
+
+	/* TODO: add tests for libscca_io_handle_read_compressed_file_header */
+
+	/* TODO: add tests for libscca_io_handle_read_compressed_blocks */
+
+	/* TODO: add tests for libscca_io_handle_read_uncompressed_file_header */
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_read_file_metrics_array_data",
+	 scca_test_io_handle_read_file_metrics_array_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_io_handle_read_volumes_information_data",
+	 scca_test_io_handle_read_volumes_information_data );
+
+	/* TODO: add tests for libscca_io_handle_read_trace_chain_array */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
 
@@ -0,0 +1,1087 @@
+/*
+ * Library LZXpress Huffman decompression functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_lzxpress.h"
+
+/* A single chunk with 9-bit codes for all symbols, which contains 4 literals,
+ * a match with an 8-bit extended length, a literal, a match with a 16-bit
+ * extended length and the end-of-block symbol
+ */
+uint8_t scca_test_lzxpress_compressed_data1[ 272 ] = {
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+	0x90, 0x20, 0x64, 0x88, 0x78, 0x49, 0x97, 0x78, 0x0a, 0x00, 0xb0, 0x00, 0x00, 0xff, 0x29, 0x01 };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Checks the uncompressed data of scca_test_lzxpress_compressed_data1
+ * Returns 1 if the data matches or 0 if not
+ */
+int scca_test_lzxpress_check_uncompressed_data1(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size )
+{
+	size_t data_offset = 0;
+
+	if( uncompressed_data_size != 333 )
+	{
+		return( 0 );
+	}
+	for( data_offset = 0;
+	     data_offset < 28;
+	     data_offset++ )
+	{
+		if( uncompressed_data[ data_offset ] != "ABCD"[ data_offset % 4 ] )
+		{
+			return( 0 );
+		}
+	}
+	for( data_offset = 28;
+	     data_offset < 333;
+	     data_offset++ )
+	{
+		if( uncompressed_data[ data_offset ] != "ABCDx"[ ( data_offset - 28 ) % 5 ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libscca_lzxpress_huffman_decoder_build function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_lzxpress_huffman_decoder_build(
+     void )
+{
+	uint8_t code_sizes_data[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_lzxpress_huffman_decoder_t decoder;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_lzxpress_huffman_decoder_build(
+	          &decoder,
+	          scca_test_lzxpress_compressed_data1,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoder.number_of_codes[ 9 ]",
+	 decoder.number_of_codes[ 9 ],
+	 512 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "decoder.lookup_table[ 0x0100 << 2 ]",
+	 decoder.lookup_table[ 0x0100 << 2 ],
+	 0x1009 );
+
+	/* Test code sizes without codes
+	 */
+	if( memory_set(
+	     code_sizes_data,
+	     0,
+	     256 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_lzxpress_huffman_decoder_build(
+	          &decoder,
+	          code_sizes_data,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test code sizes with overlapping codes
+	 */
+	if( memory_set(
+	     code_sizes_data,
+	     0x11,
+	     256 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_lzxpress_huffman_decoder_build(
+	          &decoder,
+	          code_sizes_data,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_lzxpress_huffman_decoder_build(
+	          NULL,
+	          scca_test_lzxpress_compressed_data1,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decoder_build(
+	          &decoder,
+	          NULL,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decoder_build(
+	          &decoder,
+	          scca_test_lzxpress_compressed_data1,
+	          255,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_lzxpress_huffman_decoder_cache_initialize and libscca_lzxpress_huffman_decoder_cache_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_lzxpress_huffman_decoder_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                                = NULL;
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache = NULL;
+	int result                                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_initialize(
+	          &decoder_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder_cache",
+	 decoder_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_lzxpress_huffman_decoder_cache_free(
+	          &decoder_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "decoder_cache",
+	 decoder_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decoder_cache = (libscca_lzxpress_huffman_decoder_cache_t *) 0x12345678UL;
+
+	result = libscca_lzxpress_huffman_decoder_cache_initialize(
+	          &decoder_cache,
+	          &error );
+
+	decoder_cache = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decoder_cache_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder_cache != NULL )
+	{
+		libscca_lzxpress_huffman_decoder_cache_free(
+		 &decoder_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_lzxpress_huffman_decoder_cache_get_decoder function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_lzxpress_huffman_decoder_cache_get_decoder(
+     void )
+{
+	uint8_t code_sizes_data[ 256 ];
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error                                = NULL;
+	libscca_lzxpress_huffman_decoder_cache_t *decoder_cache = NULL;
+	libscca_lzxpress_huffman_decoder_t *cached_decoder      = NULL;
+	libscca_lzxpress_huffman_decoder_t *decoder             = NULL;
+	size_t uncompressed_data_size                           = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_initialize(
+	          &decoder_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder_cache",
+	 decoder_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          decoder_cache,
+	          scca_test_lzxpress_compressed_data1,
+	          256,
+	          &cached_decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_decoder",
+	 cached_decoder );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "cached_decoder->number_of_codes[ 9 ]",
+	 cached_decoder->number_of_codes[ 9 ],
+	 512 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "decoder_cache->number_of_misses",
+	 decoder_cache->number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Test that the same code sizes are retrieved from the cache
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          decoder_cache,
+	          scca_test_lzxpress_compressed_data1,
+	          256,
+	          &decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "decoder",
+	 (intptr_t) decoder,
+	 (intptr_t) cached_decoder );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "decoder_cache->number_of_hits",
+	 decoder_cache->number_of_hits,
+	 (uint64_t) 1 );
+
+	/* Test that code sizes that do not form a valid prefix code are not cached
+	 */
+	if( memory_set(
+	     code_sizes_data,
+	     0,
+	     256 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          decoder_cache,
+	          code_sizes_data,
+	          256,
+	          &decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test decompression with the decoder cache
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          decoder_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_lzxpress_check_uncompressed_data1(
+	          uncompressed_data,
+	          uncompressed_data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "decoder_cache->number_of_hits",
+	 decoder_cache->number_of_hits,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          NULL,
+	          scca_test_lzxpress_compressed_data1,
+	          256,
+	          &decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          decoder_cache,
+	          NULL,
+	          256,
+	          &decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          decoder_cache,
+	          scca_test_lzxpress_compressed_data1,
+	          255,
+	          &decoder,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decoder_cache_get_decoder(
+	          decoder_cache,
+	          scca_test_lzxpress_compressed_data1,
+	          256,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_lzxpress_huffman_decoder_cache_free(
+	          &decoder_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder_cache != NULL )
+	{
+		libscca_lzxpress_huffman_decoder_cache_free(
+		 &decoder_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_lzxpress_huffman_decompress_fast function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_lzxpress_huffman_decompress_fast(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_lzxpress_check_uncompressed_data1(
+	          uncompressed_data,
+	          uncompressed_data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test data that cannot be decompressed by the fast path
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          260,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 64;
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          NULL,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          NULL,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_lzxpress_huffman_decompress_fast(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_lzxpress_huffman_decompress_two_phase function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_lzxpress_huffman_decompress_two_phase(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress_two_phase(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_lzxpress_check_uncompressed_data1(
+	          uncompressed_data,
+	          uncompressed_data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test with an uncompressed data buffer that is too small
+	 */
+	uncompressed_data_size = 64;
+
+	result = libscca_lzxpress_huffman_decompress_two_phase(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with truncated compressed data
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress_two_phase(
+	          scca_test_lzxpress_compressed_data1,
+	          260,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_lzxpress_huffman_decompress_two_phase(
+	          NULL,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_lzxpress_huffman_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_lzxpress_huffman_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_lzxpress_check_uncompressed_data1(
+	          uncompressed_data,
+	          uncompressed_data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test with the two-phase flag, which falls back to the fast path for small data
+	 */
+	uncompressed_data_size = 512;
+
+	result = libscca_lzxpress_huffman_decompress(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          LIBSCCA_LZXPRESS_HUFFMAN_FLAG_TWO_PHASE,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_lzxpress_check_uncompressed_data1(
+	          uncompressed_data,
+	          uncompressed_data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_lzxpress_huffman_decompress(
+	          scca_test_lzxpress_compressed_data1,
+	          272,
+	          uncompressed_data,
+	          NULL,
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_lzxpress_huffman_decoder_build",
+	 scca_test_lzxpress_huffman_decoder_build );
+
+	SCCA_TEST_RUN(
+	 "libscca_lzxpress_huffman_decoder_cache_initialize",
+	 scca_test_lzxpress_huffman_decoder_cache_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_lzxpress_huffman_decoder_cache_get_decoder",
+	 scca_test_lzxpress_huffman_decoder_cache_get_decoder );
+
+	SCCA_TEST_RUN(
+	 "libscca_lzxpress_huffman_decompress_fast",
+	 scca_test_lzxpress_huffman_decompress_fast );
+
+	SCCA_TEST_RUN(
+	 "libscca_lzxpress_huffman_decompress_two_phase",
+	 scca_test_lzxpress_huffman_decompress_two_phase );
+
+	SCCA_TEST_RUN(
+	 "libscca_lzxpress_huffman_decompress",
+	 scca_test_lzxpress_huffman_decompress );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -211,6 +211,13 @@
 		goto on_error; \
 	}
 
+#define SCCA_TEST_ASSERT_GREATER_THAN_UINT64( name, value, expected_value ) \
+	if( value <= expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIu64 ") <= %" PRIu64 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
 #define SCCA_TEST_ASSERT_LESS_THAN_UINT64( name, value, expected_value ) \
 	if( value >= expected_value ) \
 	{ \
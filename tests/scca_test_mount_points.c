@@ -0,0 +1,775 @@
+/*
+ * Library mount points functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_mount_points.h"
+
+const char *scca_test_mount_points_device_paths[ 3 ] = {
+	"\\VOLUME{01d08f4a24cc8b06-3a2b12a8}",
+	"\\DEVICE\\HARDDISKVOLUME2\\",
+	"\\Device\\HarddiskVolume2\\Users" };
+
+const char *scca_test_mount_points_mount_point_paths[ 3 ] = {
+	"C:",
+	"D:\\",
+	"E:" };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Copies an ASCII string to an UTF-16 little-endian stream including the end of string character
+ * Returns the size of the UTF-16 stream
+ */
+size_t scca_test_mount_points_copy_to_utf16_stream(
+        const char *string,
+        uint8_t *utf16_stream,
+        size_t utf16_stream_size )
+{
+	size_t string_index = 0;
+	size_t string_size  = narrow_string_length( string ) + 1;
+
+	if( ( string_size * 2 ) > utf16_stream_size )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_size;
+	     string_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( utf16_stream[ string_index * 2 ] ),
+		 (uint16_t) string[ string_index ] );
+	}
+	return( string_size * 2 );
+}
+
+/* Tests the libscca_mount_points_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mount_points_initialize(
+     void )
+{
+	const char *invalid_device_paths[ 1 ] = { "\\" };
+
+	libcerror_error_t *error             = NULL;
+	libscca_mount_points_t *mount_points = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          scca_test_mount_points_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "mount_points->number_of_mount_points",
+	 mount_points->number_of_mount_points,
+	 3 );
+
+	/* The trailing path separator of the device path is ignored
+	 */
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "mount_points->device_path_offsets[ 2 ]",
+	 mount_points->device_path_offsets[ 2 ],
+	 (size_t) 57 );
+
+	result = libscca_mount_points_free(
+	          &mount_points,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_mount_points_initialize(
+	          NULL,
+	          scca_test_mount_points_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mount_points = (libscca_mount_points_t *) 0x12345678UL;
+
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          scca_test_mount_points_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          3,
+	          &error );
+
+	mount_points = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          NULL,
+	          scca_test_mount_points_mount_point_paths,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          scca_test_mount_points_device_paths,
+	          NULL,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          scca_test_mount_points_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A device path that only consists of a path separator is not supported
+	 */
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          invalid_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mount_points != NULL )
+	{
+		libscca_mount_points_free(
+		 &mount_points,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mount_points_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mount_points_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_mount_points_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mount_points_get_index_by_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mount_points_get_index_by_utf16_stream(
+     void )
+{
+	uint8_t utf16_stream[ 128 ];
+
+	libcerror_error_t *error             = NULL;
+	libscca_mount_points_t *mount_points = NULL;
+	size_t utf16_stream_size             = 0;
+	int mount_point_index                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          scca_test_mount_points_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	utf16_stream_size = scca_test_mount_points_copy_to_utf16_stream(
+	                     "\\device\\harddiskvolume2\\windows\\notepad.exe",
+	                     utf16_stream,
+	                     128 );
+
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          mount_points,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &mount_point_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "mount_point_index",
+	 mount_point_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the longest matching device path is used
+	 */
+	utf16_stream_size = scca_test_mount_points_copy_to_utf16_stream(
+	                     "\\DEVICE\\HARDDISKVOLUME2\\USERS\\TEST\\NTUSER.DAT",
+	                     utf16_stream,
+	                     128 );
+
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          mount_points,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &mount_point_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "mount_point_index",
+	 mount_point_index,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a device path that is not followed by a path separator
+	 */
+	utf16_stream_size = scca_test_mount_points_copy_to_utf16_stream(
+	                     "\\DEVICE\\HARDDISKVOLUME2\\USERSDATA\\TEST.DAT",
+	                     utf16_stream,
+	                     128 );
+
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          mount_points,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &mount_point_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "mount_point_index",
+	 mount_point_index,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf16_stream_size = scca_test_mount_points_copy_to_utf16_stream(
+	                     "\\DEVICE\\HARDDISKVOLUME20\\TEST.DAT",
+	                     utf16_stream,
+	                     128 );
+
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          mount_points,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &mount_point_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "mount_point_index",
+	 mount_point_index,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          NULL,
+	          utf16_stream,
+	          utf16_stream_size,
+	          &mount_point_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          mount_points,
+	          NULL,
+	          utf16_stream_size,
+	          &mount_point_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_get_index_by_utf16_stream(
+	          mount_points,
+	          utf16_stream,
+	          utf16_stream_size,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_mount_points_free(
+	          &mount_points,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mount_points != NULL )
+	{
+		libscca_mount_points_free(
+		 &mount_points,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_mount_points_get_mount_point function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_mount_points_get_mount_point(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libscca_mount_points_t *mount_points = NULL;
+	const uint8_t *utf8_string           = NULL;
+	size_t utf8_string_length            = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_mount_points_initialize(
+	          &mount_points,
+	          scca_test_mount_points_device_paths,
+	          scca_test_mount_points_mount_point_paths,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_mount_points_get_mount_point(
+	          mount_points,
+	          1,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The trailing path separator of the mount point is ignored
+	 */
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "D:",
+	          2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_mount_points_get_mount_point(
+	          NULL,
+	          1,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_get_mount_point(
+	          mount_points,
+	          3,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_mount_points_get_mount_point(
+	          mount_points,
+	          1,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_mount_points_free(
+	          &mount_points,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "mount_points",
+	 mount_points );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mount_points != NULL )
+	{
+		libscca_mount_points_free(
+		 &mount_points,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_mount_points_initialize",
+	 scca_test_mount_points_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_mount_points_free",
+	 scca_test_mount_points_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_mount_points_get_index_by_utf16_stream",
+	 scca_test_mount_points_get_index_by_utf16_stream );
+
+	/* TODO: add tests for libscca_mount_points_get_device_path_size */
+
+	SCCA_TEST_RUN(
+	 "libscca_mount_points_get_mount_point",
+	 scca_test_mount_points_get_mount_point );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
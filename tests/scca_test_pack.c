@@ -0,0 +1,1024 @@
+/*
+ * Library pack functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_pack.h"
+
+uint8_t scca_test_pack_data1[ 16 ] = {
+	0x53, 0x43, 0x43, 0x41, 0x50, 0x41, 0x43, 0x4b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libscca_pack_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_pack_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_pack_t *pack     = NULL;
+	int result               = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_pack_initialize(
+	          &pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "pack",
+	 pack );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_pack_free(
+	          &pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "pack",
+	 pack );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_pack_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pack = (libscca_pack_t *) 0x12345678UL;
+
+	result = libscca_pack_initialize(
+	          &pack,
+	          &error );
+
+	pack = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_pack_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_pack_initialize(
+		          &pack,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( pack != NULL )
+			{
+				libscca_pack_free(
+				 &pack,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "pack",
+			 pack );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_pack_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_pack_initialize(
+		          &pack,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( pack != NULL )
+			{
+				libscca_pack_free(
+				 &pack,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "pack",
+			 pack );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pack != NULL )
+	{
+		libscca_pack_free(
+		 &pack,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_pack_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_pack_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_pack_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_pack_open_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_pack_open_data(
+     void )
+{
+	uint8_t data[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	libscca_pack_t *pack     = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_pack_initialize(
+	          &pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "pack",
+	 pack );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_pack_open_data(
+	          NULL,
+	          scca_test_pack_data1,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_pack_open_data(
+	          pack,
+	          NULL,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data too small to contain the trailer
+	 */
+	result = libscca_pack_open_data(
+	          pack,
+	          scca_test_pack_data1,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data with an unsupported signature
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     128 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_pack_open_data(
+	          pack,
+	          data,
+	          128,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_pack_free(
+	          &pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "pack",
+	 pack );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pack != NULL )
+	{
+		libscca_pack_free(
+		 &pack,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests building, writing and opening a pack
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_pack_write_index_data(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	libscca_pack_t *pack      = NULL;
+	libscca_pack_t *read_pack = NULL;
+	uint8_t *data             = NULL;
+	size_t index_data_size    = 0;
+	size_t utf8_string_size   = 0;
+	uint32_t format_version   = 0;
+	uint32_t prefetch_hash    = 0;
+	int file_index            = 0;
+	int number_of_files       = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_pack_initialize(
+	          &pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append the file entries of 32 bytes of file data, the third file
+	 * has the same path as the first but a different host
+	 */
+	result = libscca_internal_pack_append_file_entry(
+	          (libscca_internal_pack_t *) pack,
+	          (uint8_t *) "host1",
+	          5,
+	          (uint8_t *) "A.pf",
+	          4,
+	          0x4a81b364UL,
+	          30,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_pack_append_file_entry(
+	          (libscca_internal_pack_t *) pack,
+	          (uint8_t *) "host1",
+	          5,
+	          (uint8_t *) "B.pf",
+	          4,
+	          0x0a5b2c94UL,
+	          30,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_pack_append_file_entry(
+	          (libscca_internal_pack_t *) pack,
+	          (uint8_t *) "host2",
+	          5,
+	          (uint8_t *) "A.pf",
+	          4,
+	          0x4a81b364UL,
+	          17,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending a file with a key that was already appended
+	 */
+	result = libscca_internal_pack_append_file_entry(
+	          (libscca_internal_pack_t *) pack,
+	          (uint8_t *) "host1",
+	          5,
+	          (uint8_t *) "A.pf",
+	          4,
+	          0x4a81b364UL,
+	          30,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_pack_get_index_data_size(
+	          pack,
+	          &index_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    32 + index_data_size );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	if( memory_set(
+	     data,
+	     0,
+	     32 + index_data_size ) == NULL )
+	{
+		goto on_error;
+	}
+	result = libscca_pack_write_index_data(
+	          pack,
+	          &( data[ 32 ] ),
+	          index_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the index data is too small
+	 */
+	result = libscca_pack_write_index_data(
+	          pack,
+	          &( data[ 32 ] ),
+	          index_data_size - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test opening the pack
+	 */
+	result = libscca_pack_initialize(
+	          &read_pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_pack_open_data(
+	          read_pack,
+	          data,
+	          32 + index_data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_pack_get_number_of_files(
+	          read_pack,
+	          &number_of_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 3 );
+
+	/* Test retrieving a file by its key
+	 */
+	result = libscca_pack_get_file_index_by_utf8_key(
+	          read_pack,
+	          (uint8_t *) "host2",
+	          5,
+	          (uint8_t *) "A.pf",
+	          4,
+	          &file_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 2 );
+
+	result = libscca_pack_get_file_index_by_utf8_key(
+	          read_pack,
+	          (uint8_t *) "host1",
+	          5,
+	          (uint8_t *) "B.pf",
+	          4,
+	          &file_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 1 );
+
+	result = libscca_pack_get_file_index_by_utf8_key(
+	          read_pack,
+	          (uint8_t *) "host3",
+	          5,
+	          (uint8_t *) "A.pf",
+	          4,
+	          &file_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the files by their prefetch hash
+	 */
+	result = libscca_pack_get_next_file_index_by_prefetch_hash(
+	          read_pack,
+	          0,
+	          0x4a81b364UL,
+	          &file_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 0 );
+
+	result = libscca_pack_get_next_file_index_by_prefetch_hash(
+	          read_pack,
+	          file_index + 1,
+	          0x4a81b364UL,
+	          &file_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_index",
+	 file_index,
+	 2 );
+
+	result = libscca_pack_get_next_file_index_by_prefetch_hash(
+	          read_pack,
+	          file_index + 1,
+	          0x4a81b364UL,
+	          &file_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving the values of a file
+	 */
+	result = libscca_pack_get_utf8_file_host_size(
+	          read_pack,
+	          2,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	result = libscca_pack_get_utf8_file_host(
+	          read_pack,
+	          2,
+	          utf8_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "host2",
+	          6 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_pack_get_utf8_file_path(
+	          read_pack,
+	          2,
+	          utf8_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "A.pf",
+	          5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_pack_get_file_prefetch_hash(
+	          read_pack,
+	          1,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x0a5b2c94UL );
+
+	result = libscca_pack_get_file_format_version(
+	          read_pack,
+	          2,
+	          &format_version,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "format_version",
+	 format_version,
+	 (uint32_t) 17 );
+
+	/* Test error case where the file index is out of bounds
+	 */
+	result = libscca_pack_get_file_prefetch_hash(
+	          read_pack,
+	          3,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_pack_free(
+	          &read_pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libscca_pack_free(
+	          &pack,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_pack != NULL )
+	{
+		libscca_pack_free(
+		 &read_pack,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( pack != NULL )
+	{
+		libscca_pack_free(
+		 &pack,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_pack_initialize",
+	 scca_test_pack_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_pack_free",
+	 scca_test_pack_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_pack_open_data",
+	 scca_test_pack_open_data );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_pack_write_index_data",
+	 scca_test_pack_write_index_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,805 @@
+/*
+ * Library parse cache functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+/* Tests the libscca_parse_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parse_cache_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_parse_cache_t *parse_cache = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_parse_cache_initialize(
+	          &parse_cache,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_parse_cache_initialize(
+	          NULL,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parse_cache = (libscca_parse_cache_t *) 0x12345678UL;
+
+	result = libscca_parse_cache_initialize(
+	          &parse_cache,
+	          65536,
+	          &error );
+
+	parse_cache = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_initialize(
+	          &parse_cache,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_cache != NULL )
+	{
+		libscca_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parse_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parse_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_parse_cache_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parse_cache_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parse_cache_get_statistics(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_parse_cache_t *parse_cache = NULL;
+	size64_t size                      = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_parse_cache_initialize(
+	          &parse_cache,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_parse_cache_get_statistics(
+	          parse_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_parse_cache_get_statistics(
+	          NULL,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_get_statistics(
+	          parse_cache,
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_get_statistics(
+	          parse_cache,
+	          &size,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_get_statistics(
+	          parse_cache,
+	          &size,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_cache != NULL )
+	{
+		libscca_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+uint8_t scca_test_parse_cache_data1[ 16 ] = {
+	0x11, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libscca_parse_cache_open_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parse_cache_open_memory(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_file_t *file               = NULL;
+	libscca_parse_cache_t *parse_cache = NULL;
+	size64_t size                      = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_parse_cache_initialize(
+	          &parse_cache,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_parse_cache_open_memory(
+	          NULL,
+	          scca_test_parse_cache_data1,
+	          16,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_open_memory(
+	          parse_cache,
+	          NULL,
+	          16,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_open_memory(
+	          parse_cache,
+	          scca_test_parse_cache_data1,
+	          0,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_open_memory(
+	          parse_cache,
+	          scca_test_parse_cache_data1,
+	          16,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file = (libscca_file_t *) 0x12345678UL;
+
+	result = libscca_parse_cache_open_memory(
+	          parse_cache,
+	          scca_test_parse_cache_data1,
+	          16,
+	          &file,
+	          &error );
+
+	file = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_parse_cache_open_memory with data that is too small to be parsed
+	 */
+	result = libscca_parse_cache_open_memory(
+	          parse_cache,
+	          scca_test_parse_cache_data1,
+	          16,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The data that could not be parsed is not cached
+	 */
+	result = libscca_parse_cache_get_statistics(
+	          parse_cache,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	/* Clean up
+	 */
+	result = libscca_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parse_cache != NULL )
+	{
+		libscca_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parse_cache_release_file function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parse_cache_release_file(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_file_t *file               = NULL;
+	libscca_parse_cache_t *parse_cache = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_parse_cache_initialize(
+	          &parse_cache,
+	          65536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "parse_cache",
+	 parse_cache );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_parse_cache_release_file(
+	          NULL,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parse_cache_release_file(
+	          parse_cache,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_parse_cache_release_file with a file that was not opened using the parse cache
+	 */
+	result = libscca_parse_cache_release_file(
+	          parse_cache,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parse_cache_free(
+	          &parse_cache,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( parse_cache != NULL )
+	{
+		libscca_parse_cache_free(
+		 &parse_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_parse_cache_initialize",
+	 scca_test_parse_cache_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_parse_cache_free",
+	 scca_test_parse_cache_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_parse_cache_get_statistics",
+	 scca_test_parse_cache_get_statistics );
+
+	SCCA_TEST_RUN(
+	 "libscca_parse_cache_open_memory",
+	 scca_test_parse_cache_open_memory );
+
+	SCCA_TEST_RUN(
+	 "libscca_parse_cache_release_file",
+	 scca_test_parse_cache_release_file );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1182 @@
+/*
+ * Library parser functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+uint8_t scca_test_parser_data1[ 32 ] = {
+	0x11, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x0f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t scca_test_parser_data2[ 16 ] = {
+	0x4d, 0x41, 0x4d, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libscca_parser_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parser_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	libscca_parser_t *parser = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "parser",
+	 parser );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parser_free(
+	          &parser,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "parser",
+	 parser );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_parser_initialize(
+	          NULL,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	parser = (libscca_parser_t *) 0x12345678UL;
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	parser = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          NULL,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_WRITE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	/* Test libscca_parser_initialize with malloc failing
+	 */
+	scca_test_malloc_attempts_before_fail = 0;
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	if( scca_test_malloc_attempts_before_fail != -1 )
+	{
+		scca_test_malloc_attempts_before_fail = -1;
+
+		if( parser != NULL )
+		{
+			libscca_parser_free(
+			 &parser,
+			 NULL );
+		}
+	}
+	else
+	{
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "parser",
+		 parser );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libscca_parser_free(
+		 &parser,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parser_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parser_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_parser_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parser_feed function with uncompressed data
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parser_feed_uncompressed(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	libscca_parser_t *parser = NULL;
+	size64_t size            = 0;
+	ssize_t feed_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+	int state                = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_parser_get_required_data(
+	          parser,
+	          &offset,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 16 );
+
+	feed_count = libscca_parser_feed(
+	              parser,
+	              scca_test_parser_data1,
+	              10,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) 10 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parser_get_required_data(
+	          parser,
+	          &offset,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 10 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 6 );
+
+	feed_count = libscca_parser_feed(
+	              parser,
+	              &( scca_test_parser_data1[ 10 ] ),
+	              6,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) 6 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file size in the file header determines the required data
+	 */
+	result = libscca_parser_get_required_data(
+	          parser,
+	          &offset,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 16 );
+
+	/* The data is too small to contain the file information
+	 */
+	feed_count = libscca_parser_feed(
+	              parser,
+	              &( scca_test_parser_data1[ 16 ] ),
+	              16,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_state(
+	          parser,
+	          &state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "state",
+	 state,
+	 LIBSCCA_PARSER_STATE_FAILED );
+
+	result = libscca_parser_get_required_data(
+	          parser,
+	          &offset,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	feed_count = libscca_parser_feed(
+	              parser,
+	              scca_test_parser_data1,
+	              16,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_free(
+	          &parser,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libscca_parser_feed with a data size that is smaller than the file size
+	 */
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parser_set_data_size(
+	          parser,
+	          24,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	feed_count = libscca_parser_feed(
+	              parser,
+	              scca_test_parser_data1,
+	              32,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_parser_free(
+	          &parser,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libscca_parser_free(
+		 &parser,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parser_feed function with compressed data
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parser_feed_compressed(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	libscca_parser_t *parser = NULL;
+	size64_t size            = 0;
+	ssize_t feed_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+	int state                = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	feed_count = libscca_parser_feed(
+	              parser,
+	              scca_test_parser_data2,
+	              16,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) 16 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The size of the compressed data is not known
+	 */
+	result = libscca_parser_get_required_data(
+	          parser,
+	          &offset,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 16 );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	result = libscca_parser_get_state(
+	          parser,
+	          &state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "state",
+	 state,
+	 LIBSCCA_PARSER_STATE_NEED_DATA );
+
+	/* Signal the end of the data, which is too small to be decompressed
+	 */
+	feed_count = libscca_parser_feed(
+	              parser,
+	              NULL,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_state(
+	          parser,
+	          &state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "state",
+	 state,
+	 LIBSCCA_PARSER_STATE_FAILED );
+
+	/* Clean up
+	 */
+	result = libscca_parser_free(
+	          &parser,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libscca_parser_free(
+		 &parser,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_parser functions with invalid arguments
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_parser_arguments(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	libscca_parser_t *parser = NULL;
+	size64_t size            = 0;
+	ssize_t feed_count       = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+	int state                = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_parser_initialize(
+	          &parser,
+	          file,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	feed_count = libscca_parser_feed(
+	              NULL,
+	              scca_test_parser_data1,
+	              16,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	feed_count = libscca_parser_feed(
+	              parser,
+	              NULL,
+	              16,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	feed_count = libscca_parser_feed(
+	              parser,
+	              scca_test_parser_data1,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_set_data_size(
+	          NULL,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_set_data_size(
+	          parser,
+	          15,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_state(
+	          NULL,
+	          &state,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_state(
+	          parser,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_required_data(
+	          NULL,
+	          &offset,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_required_data(
+	          parser,
+	          NULL,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_parser_get_required_data(
+	          parser,
+	          &offset,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_parser_feed with an end of data before the file header
+	 */
+	feed_count = libscca_parser_feed(
+	              parser,
+	              NULL,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "feed_count",
+	 feed_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_parser_free(
+	          &parser,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parser != NULL )
+	{
+		libscca_parser_free(
+		 &parser,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_parser_initialize",
+	 scca_test_parser_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_parser_free",
+	 scca_test_parser_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_parser_feed_uncompressed",
+	 scca_test_parser_feed_uncompressed );
+
+	SCCA_TEST_RUN(
+	 "libscca_parser_feed_compressed",
+	 scca_test_parser_feed_compressed );
+
+	SCCA_TEST_RUN(
+	 "libscca_parser_arguments",
+	 scca_test_parser_arguments );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,734 @@
+/*
+ * Library prefetch hash functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_prefetch_hash.h"
+
+const char *scca_test_prefetch_hash_notepad_path = \
+	"\\DEVICE\\HARDDISKVOLUME2\\WINDOWS\\SYSTEM32\\NOTEPAD.EXE";
+
+const char *scca_test_prefetch_hash_notepad_lower_case_path = \
+	"\\device\\harddiskvolume2\\windows\\system32\\notepad.exe";
+
+const char *scca_test_prefetch_hash_cmd_path = \
+	"\\DEVICE\\HARDDISKVOLUME1\\WINDOWS\\SYSTEM32\\CMD.EXE";
+
+/* Tests the libscca_compute_prefetch_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_compute_prefetch_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t prefetch_hash   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_path,
+	          narrow_string_length( scca_test_prefetch_hash_notepad_path ),
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0xd8414f97UL );
+
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_lower_case_path,
+	          narrow_string_length( scca_test_prefetch_hash_notepad_lower_case_path ),
+	          LIBSCCA_PREFETCH_HASH_TYPE_2008,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0xd8414f97UL );
+
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_path,
+	          narrow_string_length( scca_test_prefetch_hash_notepad_path ),
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x2f2d61e1UL );
+
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_path,
+	          0,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x0004cb2fUL );
+
+	/* Test error cases
+	 */
+	result = libscca_compute_prefetch_hash(
+	          NULL,
+	          narrow_string_length( scca_test_prefetch_hash_notepad_path ),
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_path,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_path,
+	          narrow_string_length( scca_test_prefetch_hash_notepad_path ),
+	          -1,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_prefetch_hash(
+	          (uint8_t *) scca_test_prefetch_hash_notepad_path,
+	          narrow_string_length( scca_test_prefetch_hash_notepad_path ),
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_compute_prefetch_hash_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_compute_prefetch_hash_utf16(
+     void )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error   = NULL;
+	size_t string_index        = 0;
+	size_t utf16_string_length = 0;
+	uint32_t prefetch_hash     = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	utf16_string_length = narrow_string_length(
+	                       scca_test_prefetch_hash_cmd_path );
+
+	for( string_index = 0;
+	     string_index < utf16_string_length;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = (uint16_t) scca_test_prefetch_hash_cmd_path[ string_index ];
+	}
+	/* Test regular cases
+	 */
+	result = libscca_compute_prefetch_hash_utf16(
+	          utf16_string,
+	          utf16_string_length,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x89305d47UL );
+
+	result = libscca_compute_prefetch_hash_utf16(
+	          utf16_string,
+	          utf16_string_length,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x087b4001UL );
+
+	/* Test error cases
+	 */
+	result = libscca_compute_prefetch_hash_utf16(
+	          NULL,
+	          utf16_string_length,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &prefetch_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_prefetch_hash_utf16(
+	          utf16_string,
+	          utf16_string_length,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_compute_prefetch_hashes function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_compute_prefetch_hashes(
+     void )
+{
+	const char *utf8_strings[ 3 ];
+	uint32_t prefetch_hashes[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	utf8_strings[ 0 ] = scca_test_prefetch_hash_notepad_path;
+	utf8_strings[ 1 ] = scca_test_prefetch_hash_cmd_path;
+	utf8_strings[ 2 ] = scca_test_prefetch_hash_notepad_lower_case_path;
+
+	/* Test regular cases
+	 */
+	result = libscca_compute_prefetch_hashes(
+	          utf8_strings,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hashes[ 0 ]",
+	 prefetch_hashes[ 0 ],
+	 (uint32_t) 0xd8414f97UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hashes[ 1 ]",
+	 prefetch_hashes[ 1 ],
+	 (uint32_t) 0x89305d47UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hashes[ 2 ]",
+	 prefetch_hashes[ 2 ],
+	 (uint32_t) 0xd8414f97UL );
+
+	result = libscca_compute_prefetch_hashes(
+	          utf8_strings,
+	          0,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_compute_prefetch_hashes(
+	          NULL,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_prefetch_hashes(
+	          utf8_strings,
+	          -1,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          prefetch_hashes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_prefetch_hashes(
+	          utf8_strings,
+	          3,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_prefetch_hash_update function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_update(
+     void )
+{
+	uint8_t data[ 19 ] = {
+		'A', 0, 'B', 0, 'C', 0, 'D', 0, 'E', 0, 'F', 0, 'G', 0, 'H', 0, 'I', 0, 'J' };
+
+	uint32_t expected_hash_value = 0;
+	uint32_t hash_value          = 0;
+	size_t data_index            = 0;
+	size_t data_size             = 0;
+
+	/* Test that the unrolled and the byte-wise calculation match
+	 */
+	for( data_size = 0;
+	     data_size <= 19;
+	     data_size++ )
+	{
+		expected_hash_value = LIBSCCA_PREFETCH_HASH_VISTA_INITIAL_VALUE;
+
+		for( data_index = 0;
+		     data_index < data_size;
+		     data_index++ )
+		{
+			expected_hash_value = ( expected_hash_value * 37 ) + data[ data_index ];
+		}
+		hash_value = libscca_prefetch_hash_update(
+		              LIBSCCA_PREFETCH_HASH_VISTA_INITIAL_VALUE,
+		              data,
+		              data_size );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT32(
+		 "hash_value",
+		 hash_value,
+		 expected_hash_value );
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libscca_prefetch_hash_get_upper_case_character function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_get_upper_case_character(
+     void )
+{
+	uint16_t character = 0;
+
+	character = libscca_prefetch_hash_get_upper_case_character(
+	             (uint16_t) 'a' );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 'A' );
+
+	character = libscca_prefetch_hash_get_upper_case_character(
+	             (uint16_t) '\\' );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) '\\' );
+
+	character = libscca_prefetch_hash_get_upper_case_character(
+	             0x00e9 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x00c9 );
+
+	character = libscca_prefetch_hash_get_upper_case_character(
+	             0x00f7 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x00f7 );
+
+	character = libscca_prefetch_hash_get_upper_case_character(
+	             0x00ff );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0178 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libscca_prefetch_hash_get_type_by_format_version function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_get_type_by_format_version(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int hash_type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_prefetch_hash_get_type_by_format_version(
+	          17,
+	          &hash_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "hash_type",
+	 hash_type,
+	 LIBSCCA_PREFETCH_HASH_TYPE_XP );
+
+	result = libscca_prefetch_hash_get_type_by_format_version(
+	          30,
+	          &hash_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "hash_type",
+	 hash_type,
+	 LIBSCCA_PREFETCH_HASH_TYPE_VISTA );
+
+	result = libscca_prefetch_hash_get_type_by_format_version(
+	          99,
+	          &hash_type,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_prefetch_hash_get_type_by_format_version(
+	          17,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_compute_prefetch_hash",
+	 scca_test_compute_prefetch_hash );
+
+	SCCA_TEST_RUN(
+	 "libscca_compute_prefetch_hash_utf16",
+	 scca_test_compute_prefetch_hash_utf16 );
+
+	SCCA_TEST_RUN(
+	 "libscca_compute_prefetch_hashes",
+	 scca_test_compute_prefetch_hashes );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_update",
+	 scca_test_prefetch_hash_update );
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_get_upper_case_character",
+	 scca_test_prefetch_hash_get_upper_case_character );
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_get_type_by_format_version",
+	 scca_test_prefetch_hash_get_type_by_format_version );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,708 @@
+/*
+ * Library prefetch hash table functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_prefetch_hash_table.h"
+
+const char *scca_test_prefetch_hash_table_notepad_path = \
+	"\\DEVICE\\HARDDISKVOLUME2\\WINDOWS\\SYSTEM32\\NOTEPAD.EXE";
+
+/* Tests the libscca_prefetch_hash_table_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_table_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_prefetch_hash_table_get_number_of_entries(
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_prefetch_hash_table_get_number_of_entries(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_prefetch_hash_table_get_entries_by_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_table_get_entries_by_hash(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	int entry_index          = 0;
+	int first_entry_index    = 0;
+	int found_path           = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0xd8414f97UL,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	for( entry_index = first_entry_index;
+	     entry_index < first_entry_index + number_of_entries;
+	     entry_index++ )
+	{
+		result = libscca_prefetch_hash_table_get_utf8_path(
+		          entry_index,
+		          utf8_string,
+		          256,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( narrow_string_compare(
+		     (char *) utf8_string,
+		     scca_test_prefetch_hash_table_notepad_path,
+		     narrow_string_length( scca_test_prefetch_hash_table_notepad_path ) + 1 ) == 0 )
+		{
+			found_path = 1;
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "found_path",
+	 found_path,
+	 1 );
+
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0xd8414f97UL,
+	          LIBSCCA_PREFETCH_HASH_TYPE_2008,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0x2f2d61e1UL,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The Vista hash of the path is not an XP hash in the table
+	 */
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0xd8414f97UL,
+	          LIBSCCA_PREFETCH_HASH_TYPE_XP,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0xd8414f97UL,
+	          0,
+	          &first_entry_index,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0xd8414f97UL,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_entries_by_hash(
+	          (uint32_t) 0xd8414f97UL,
+	          LIBSCCA_PREFETCH_HASH_TYPE_VISTA,
+	          &first_entry_index,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_prefetch_hash_table_get_utf8_path_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_table_get_utf8_path_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	result = libscca_prefetch_hash_table_get_number_of_entries(
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_prefetch_hash_table_get_utf8_path_size(
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "utf8_string_size",
+	 (int) utf8_string_size,
+	 (int) LIBSCCA_PREFETCH_HASH_TABLE_DEVICE_PREFIX_SIZE );
+
+	/* Test error cases
+	 */
+	result = libscca_prefetch_hash_table_get_utf8_path_size(
+	          -1,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_utf8_path_size(
+	          number_of_entries,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_utf8_path_size(
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_prefetch_hash_table_get_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_table_get_utf8_path(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	result = libscca_prefetch_hash_table_get_utf8_path_size(
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_prefetch_hash_table_get_utf8_path(
+	          0,
+	          utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 narrow_string_length( (char *) utf8_string ) + 1,
+	 utf8_string_size );
+
+	/* Test error cases
+	 */
+	result = libscca_prefetch_hash_table_get_utf8_path(
+	          0,
+	          NULL,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_utf8_path(
+	          0,
+	          utf8_string,
+	          utf8_string_size - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_utf8_path(
+	          -1,
+	          utf8_string,
+	          256,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests if the entries of the prefetch hash table are sorted and match the computed prefetch hashes
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_prefetch_hash_table_entries(
+     void )
+{
+	uint8_t utf8_string[ 256 ];
+
+	const libscca_prefetch_hash_table_entry_t *entry          = NULL;
+	const libscca_prefetch_hash_table_entry_t *previous_entry = NULL;
+	libcerror_error_t *error                                  = NULL;
+	size_t utf8_string_size                                   = 0;
+	uint32_t prefetch_hash                                    = 0;
+	int entry_index                                           = 0;
+	int is_sorted                                             = 0;
+	int result                                                = 0;
+
+	for( entry_index = 0;
+	     entry_index < libscca_prefetch_hash_table_number_of_entries;
+	     entry_index++ )
+	{
+		result = libscca_prefetch_hash_table_get_entry_by_index(
+		          entry_index,
+		          &entry,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( previous_entry != NULL )
+		{
+			is_sorted = ( previous_entry->prefetch_hash < entry->prefetch_hash )
+			         || ( ( previous_entry->prefetch_hash == entry->prefetch_hash )
+			          &&  ( previous_entry->hash_type <= entry->hash_type ) );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "is_sorted",
+			 is_sorted,
+			 1 );
+		}
+		result = libscca_prefetch_hash_table_get_utf8_path_size(
+		          entry_index,
+		          &utf8_string_size,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_prefetch_hash_table_get_utf8_path(
+		          entry_index,
+		          utf8_string,
+		          256,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_compute_prefetch_hash(
+		          utf8_string,
+		          utf8_string_size - 1,
+		          (int) entry->hash_type,
+		          &prefetch_hash,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT32(
+		 "prefetch_hash",
+		 prefetch_hash,
+		 entry->prefetch_hash );
+
+		previous_entry = entry;
+	}
+	/* Test error cases
+	 */
+	result = libscca_prefetch_hash_table_get_entry_by_index(
+	          libscca_prefetch_hash_table_number_of_entries,
+	          &entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_prefetch_hash_table_get_entry_by_index(
+	          0,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_table_get_number_of_entries",
+	 scca_test_prefetch_hash_table_get_number_of_entries );
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_table_get_entries_by_hash",
+	 scca_test_prefetch_hash_table_get_entries_by_hash );
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_table_get_utf8_path_size",
+	 scca_test_prefetch_hash_table_get_utf8_path_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_table_get_utf8_path",
+	 scca_test_prefetch_hash_table_get_utf8_path );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_prefetch_hash_table_entries",
+	 scca_test_prefetch_hash_table_entries );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,336 @@
+/*
+ * Library probe functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_probe.h"
+
+uint8_t scca_test_probe_data1[ 152 ] = {
+	0x11, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x0f, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x4d, 0x00, 0x44, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x7b, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x4e, 0x3d, 0x2c, 0x1b, 0x0a, 0xcc, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t scca_test_probe_data2[ 16 ] = {
+	0x4d, 0x41, 0x4d, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+libscca_probe_result_t scca_test_probe_result;
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_probe_uncompressed_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_probe_uncompressed_data(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_probe_uncompressed_data(
+	          scca_test_probe_data1,
+	          152,
+	          &scca_test_probe_result );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "scca_test_probe_result.format_version",
+	 scca_test_probe_result.format_version,
+	 (uint32_t) 17 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "scca_test_probe_result.executable_filename_length",
+	 scca_test_probe_result.executable_filename_length,
+	 (size_t) 7 );
+
+	/* Test with data too small to contain the file information
+	 */
+	result = libscca_probe_uncompressed_data(
+	          scca_test_probe_data1,
+	          120,
+	          &scca_test_probe_result );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an unsupported format version
+	 */
+	scca_test_probe_data1[ 0 ] = 0x63;
+
+	result = libscca_probe_uncompressed_data(
+	          scca_test_probe_data1,
+	          152,
+	          &scca_test_probe_result );
+
+	scca_test_probe_data1[ 0 ] = 0x11;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_probe_uncompressed_data(
+	          NULL,
+	          152,
+	          &scca_test_probe_result );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_probe_uncompressed_data(
+	          scca_test_probe_data1,
+	          152,
+	          NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_probe function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_probe(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_probe(
+	          scca_test_probe_data1,
+	          152,
+	          &scca_test_probe_result,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "scca_test_probe_result.file_type",
+	 scca_test_probe_result.file_type,
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "scca_test_probe_result.format_version",
+	 scca_test_probe_result.format_version,
+	 (uint32_t) 17 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "scca_test_probe_result.executable_filename_length",
+	 scca_test_probe_result.executable_filename_length,
+	 (size_t) 7 );
+
+	result = memory_compare(
+	          scca_test_probe_result.executable_filename,
+	          &( scca_test_probe_data1[ 16 ] ),
+	          14 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "scca_test_probe_result.prefetch_hash",
+	 scca_test_probe_result.prefetch_hash,
+	 (uint32_t) 0x087b4001UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "scca_test_probe_result.run_count",
+	 scca_test_probe_result.run_count,
+	 (uint32_t) 5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "scca_test_probe_result.number_of_last_run_times",
+	 scca_test_probe_result.number_of_last_run_times,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "scca_test_probe_result.last_run_times[ 0 ]",
+	 scca_test_probe_result.last_run_times[ 0 ],
+	 (uint64_t) 0x01cc0a1b2c3d4e5fULL );
+
+	/* Test with compressed data that cannot be decompressed
+	 */
+	result = libscca_probe(
+	          scca_test_probe_data2,
+	          16,
+	          &scca_test_probe_result,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "scca_test_probe_result.file_type",
+	 scca_test_probe_result.file_type,
+	 0 );
+
+	/* Test with data without a signature
+	 */
+	result = libscca_probe(
+	          &( scca_test_probe_data1[ 16 ] ),
+	          136,
+	          &scca_test_probe_result,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_probe(
+	          NULL,
+	          152,
+	          &scca_test_probe_result,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_probe(
+	          scca_test_probe_data1,
+	          152,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_probe_uncompressed_data",
+	 scca_test_probe_uncompressed_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_probe",
+	 scca_test_probe );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
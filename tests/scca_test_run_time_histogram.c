@@ -0,0 +1,918 @@
+/*
+ * Library run time histogram functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_run_time_histogram.h"
+
+/* The bucket width of an hour in number of 100th nano seconds
+ */
+#define SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH	36000000000ULL
+
+/* Tests the libscca_run_time_histogram_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_run_time_histogram_initialize(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libscca_run_time_histogram_t *run_time_histogram = NULL;
+	int result                                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_run_time_histogram_initialize(
+	          &run_time_histogram,
+	          SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "run_time_histogram",
+	 run_time_histogram );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_free(
+	          &run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "run_time_histogram",
+	 run_time_histogram );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_run_time_histogram_initialize(
+	          NULL,
+	          SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	run_time_histogram = (libscca_run_time_histogram_t *) 0x12345678UL;
+
+	result = libscca_run_time_histogram_initialize(
+	          &run_time_histogram,
+	          SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	run_time_histogram = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_run_time_histogram_initialize(
+	          &run_time_histogram,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "run_time_histogram",
+	 run_time_histogram );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( run_time_histogram != NULL )
+	{
+		libscca_run_time_histogram_free(
+		 &run_time_histogram,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_run_time_histogram_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_run_time_histogram_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_run_time_histogram_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_run_time_histogram_append_run_times function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_run_time_histogram_append_run_times(
+     void )
+{
+	uint8_t utf8_executable_filename[ LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE ];
+	uint64_t filetimes[ 8 ];
+
+	libcerror_error_t *error                         = NULL;
+	libscca_run_time_histogram_t *run_time_histogram = NULL;
+	uint64_t bucket_start_time                       = 0;
+	uint64_t number_of_runs                          = 0;
+	uint32_t prefetch_hash                           = 0;
+	int entry_index                                  = 0;
+	int filetime_index                               = 0;
+	int iteration                                    = 0;
+	int number_of_entries                            = 0;
+	int number_of_files                              = 0;
+	int result                                       = 0;
+
+	result = libscca_run_time_histogram_initialize(
+	          &run_time_histogram,
+	          SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "run_time_histogram",
+	 run_time_histogram );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The runs within the same hour are counted in the same bucket
+	 * and a filetime of 0 is not counted
+	 */
+	filetimes[ 0 ] = ( 10 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH ) + 5;
+	filetimes[ 1 ] = 0;
+	filetimes[ 2 ] = ( 10 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH ) + 1000;
+	filetimes[ 3 ] = ( 12 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH );
+
+	result = libscca_run_time_histogram_append_run_times(
+	          run_time_histogram,
+	          (uint8_t *) "CMD.EXE",
+	          8,
+	          0x4a81b364UL,
+	          filetimes,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_number_of_entries(
+	          run_time_histogram,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_entry(
+	          run_time_histogram,
+	          0,
+	          utf8_executable_filename,
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+	          &prefetch_hash,
+	          &bucket_start_time,
+	          &number_of_runs,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "memory_compare",
+	 memory_compare(
+	  utf8_executable_filename,
+	  "CMD.EXE",
+	  8 ),
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "prefetch_hash",
+	 prefetch_hash,
+	 (uint32_t) 0x4a81b364UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "bucket_start_time",
+	 bucket_start_time,
+	 (uint64_t) ( 10 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH ) );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_runs",
+	 number_of_runs,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The same executable filename with another prefetch hash is a different key
+	 */
+	result = libscca_run_time_histogram_append_run_times(
+	          run_time_histogram,
+	          (uint8_t *) "CMD.EXE",
+	          8,
+	          0x12345678UL,
+	          filetimes,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add enough distinct buckets to resize the buckets of the entries hash table
+	 * twice, where every bucket is added once in each iteration
+	 */
+	for( iteration = 0;
+	     iteration < 2;
+	     iteration++ )
+	{
+		for( entry_index = 0;
+		     entry_index < 1024;
+		     entry_index += 8 )
+		{
+			for( filetime_index = 0;
+			     filetime_index < 8;
+			     filetime_index++ )
+			{
+				filetimes[ filetime_index ] = (uint64_t) ( 100 + entry_index + filetime_index ) * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH;
+			}
+			result = libscca_run_time_histogram_append_run_times(
+			          run_time_histogram,
+			          (uint8_t *) "NOTEPAD.EXE",
+			          12,
+			          0xdeadbeefUL,
+			          filetimes,
+			          8,
+			          &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libscca_run_time_histogram_get_number_of_entries(
+	          run_time_histogram,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 + 1024 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_entry(
+	          run_time_histogram,
+	          3 + 1023,
+	          utf8_executable_filename,
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+	          &prefetch_hash,
+	          &bucket_start_time,
+	          &number_of_runs,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "bucket_start_time",
+	 bucket_start_time,
+	 (uint64_t) ( 1123 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH ) );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_runs",
+	 number_of_runs,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_number_of_files(
+	          run_time_histogram,
+	          &number_of_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 + 256 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_run_time_histogram_append_run_times(
+	          NULL,
+	          (uint8_t *) "CMD.EXE",
+	          8,
+	          0x4a81b364UL,
+	          filetimes,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_run_time_histogram_append_run_times(
+	          run_time_histogram,
+	          (uint8_t *) "CMD.EXE",
+	          8,
+	          0x4a81b364UL,
+	          filetimes,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_run_time_histogram_append_run_times(
+	          run_time_histogram,
+	          (uint8_t *) "CMD.EXE",
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE + 1,
+	          0x4a81b364UL,
+	          filetimes,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_run_time_histogram_get_entry(
+	          run_time_histogram,
+	          0,
+	          utf8_executable_filename,
+	          4,
+	          &prefetch_hash,
+	          &bucket_start_time,
+	          &number_of_runs,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_run_time_histogram_get_entry(
+	          run_time_histogram,
+	          number_of_entries,
+	          utf8_executable_filename,
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+	          &prefetch_hash,
+	          &bucket_start_time,
+	          &number_of_runs,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_run_time_histogram_free(
+	          &run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( run_time_histogram != NULL )
+	{
+		libscca_run_time_histogram_free(
+		 &run_time_histogram,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_run_time_histogram_merge function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_run_time_histogram_merge(
+     void )
+{
+	uint8_t utf8_executable_filename[ LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE ];
+	uint64_t filetimes[ 2 ];
+
+	libcerror_error_t *error                                = NULL;
+	libscca_run_time_histogram_t *other_run_time_histogram  = NULL;
+	libscca_run_time_histogram_t *run_time_histogram        = NULL;
+	libscca_run_time_histogram_t *source_run_time_histogram = NULL;
+	uint64_t bucket_start_time                              = 0;
+	uint64_t number_of_runs                                 = 0;
+	uint32_t prefetch_hash                                  = 0;
+	int number_of_entries                                   = 0;
+	int number_of_files                                     = 0;
+	int result                                              = 0;
+
+	result = libscca_run_time_histogram_initialize(
+	          &run_time_histogram,
+	          SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_initialize(
+	          &source_run_time_histogram,
+	          SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	filetimes[ 0 ] = ( 20 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH ) + 1;
+	filetimes[ 1 ] = ( 21 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH ) + 1;
+
+	result = libscca_run_time_histogram_append_run_times(
+	          run_time_histogram,
+	          (uint8_t *) "CMD.EXE",
+	          8,
+	          0x4a81b364UL,
+	          filetimes,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_append_run_times(
+	          source_run_time_histogram,
+	          (uint8_t *) "CMD.EXE",
+	          8,
+	          0x4a81b364UL,
+	          filetimes,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_run_time_histogram_merge(
+	          run_time_histogram,
+	          source_run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_number_of_entries(
+	          run_time_histogram,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_entry(
+	          run_time_histogram,
+	          0,
+	          utf8_executable_filename,
+	          LIBSCCA_BATCH_RESULT_EXECUTABLE_FILENAME_SIZE,
+	          &prefetch_hash,
+	          &bucket_start_time,
+	          &number_of_runs,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_runs",
+	 number_of_runs,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_get_number_of_files(
+	          run_time_histogram,
+	          &number_of_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_run_time_histogram_merge(
+	          run_time_histogram,
+	          run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_run_time_histogram_initialize(
+	          &other_run_time_histogram,
+	          2 * SCCA_TEST_RUN_TIME_HISTOGRAM_BUCKET_WIDTH,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_merge(
+	          run_time_histogram,
+	          other_run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_run_time_histogram_free(
+	          &other_run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_free(
+	          &source_run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_run_time_histogram_free(
+	          &run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( other_run_time_histogram != NULL )
+	{
+		libscca_run_time_histogram_free(
+		 &other_run_time_histogram,
+		 NULL );
+	}
+	if( source_run_time_histogram != NULL )
+	{
+		libscca_run_time_histogram_free(
+		 &source_run_time_histogram,
+		 NULL );
+	}
+	if( run_time_histogram != NULL )
+	{
+		libscca_run_time_histogram_free(
+		 &run_time_histogram,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_run_time_histogram_initialize",
+	 scca_test_run_time_histogram_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_run_time_histogram_free",
+	 scca_test_run_time_histogram_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_run_time_histogram_append_run_times",
+	 scca_test_run_time_histogram_append_run_times );
+
+	SCCA_TEST_RUN(
+	 "libscca_run_time_histogram_merge",
+	 scca_test_run_time_histogram_merge );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
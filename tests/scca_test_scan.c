@@ -0,0 +1,468 @@
+/*
+ * Library scan functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+/* The size of the test buffer, which is larger than the scan chunk size
+ */
+#define SCCA_TEST_SCAN_BUFFER_SIZE	( ( 4 * 1024 * 1024 ) + 4096 )
+
+/* The offset of the file header that straddles the first chunk boundary
+ */
+#define SCCA_TEST_SCAN_BOUNDARY_OFFSET	( ( 4 * 1024 * 1024 ) - 2 )
+
+typedef struct scca_test_scan_results scca_test_scan_results_t;
+
+struct scca_test_scan_results
+{
+	/* The number of file headers found
+	 */
+	int number_of_results;
+
+	/* The offsets
+	 */
+	size_t offsets[ 8 ];
+
+	/* The file types
+	 */
+	int file_types[ 8 ];
+
+	/* The data sizes
+	 */
+	uint32_t data_sizes[ 8 ];
+};
+
+/* Callback function that records the file headers found
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_scan_callback(
+     size_t offset,
+     int file_type,
+     uint32_t data_size,
+     void *callback_arguments )
+{
+	scca_test_scan_results_t *results = (scca_test_scan_results_t *) callback_arguments;
+
+	if( results->number_of_results >= 8 )
+	{
+		return( -1 );
+	}
+	results->offsets[ results->number_of_results ]    = offset;
+	results->file_types[ results->number_of_results ] = file_type;
+	results->data_sizes[ results->number_of_results ] = data_size;
+
+	results->number_of_results += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the result with a specific offset
+ * Returns the index or -1 if not found
+ */
+int scca_test_scan_get_result_index(
+     scca_test_scan_results_t *results,
+     size_t offset )
+{
+	int result_index = 0;
+
+	for( result_index = 0;
+	     result_index < results->number_of_results;
+	     result_index++ )
+	{
+		if( results->offsets[ result_index ] == offset )
+		{
+			return( result_index );
+		}
+	}
+	return( -1 );
+}
+
+/* Writes an uncompressed file header to the buffer
+ */
+void scca_test_scan_set_file_header(
+     uint8_t *buffer,
+     uint32_t format_version,
+     uint32_t file_size )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 buffer,
+	 format_version );
+
+	buffer[ 4 ] = (uint8_t) 'S';
+	buffer[ 5 ] = (uint8_t) 'C';
+	buffer[ 6 ] = (uint8_t) 'C';
+	buffer[ 7 ] = (uint8_t) 'A';
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer[ 12 ] ),
+	 file_size );
+}
+
+/* Writes a compressed file header to the buffer
+ */
+void scca_test_scan_set_compressed_file_header(
+     uint8_t *buffer,
+     uint32_t uncompressed_data_size )
+{
+	buffer[ 0 ] = (uint8_t) 'M';
+	buffer[ 1 ] = (uint8_t) 'A';
+	buffer[ 2 ] = (uint8_t) 'M';
+	buffer[ 3 ] = 0x04;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( buffer[ 4 ] ),
+	 uncompressed_data_size );
+}
+
+/* Tests the libscca_scan_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_scan_buffer(
+     void )
+{
+	scca_test_scan_results_t results;
+
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+	int result_index         = 0;
+
+	/* Initialize test
+	 */
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * SCCA_TEST_SCAN_BUFFER_SIZE );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	memory_set(
+	 buffer,
+	 'S',
+	 SCCA_TEST_SCAN_BUFFER_SIZE );
+
+	scca_test_scan_set_file_header(
+	 &( buffer[ 1000 ] ),
+	 17,
+	 2000 );
+
+	/* A file header with an unsupported format version
+	 */
+	scca_test_scan_set_file_header(
+	 &( buffer[ 3000 ] ),
+	 18,
+	 2000 );
+
+	scca_test_scan_set_compressed_file_header(
+	 &( buffer[ 4096 ] ),
+	 1000 );
+
+	/* A compressed file header with an uncompressed data size that is too small
+	 */
+	scca_test_scan_set_compressed_file_header(
+	 &( buffer[ 5000 ] ),
+	 10 );
+
+	scca_test_scan_set_file_header(
+	 &( buffer[ SCCA_TEST_SCAN_BOUNDARY_OFFSET ] ),
+	 30,
+	 84 );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 2;
+	     number_of_threads++ )
+	{
+		results.number_of_results = 0;
+
+		result = libscca_scan_buffer(
+		          buffer,
+		          SCCA_TEST_SCAN_BUFFER_SIZE,
+		          1,
+		          number_of_threads,
+		          &scca_test_scan_callback,
+		          (void *) &results,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "results.number_of_results",
+		 results.number_of_results,
+		 3 );
+
+		result_index = scca_test_scan_get_result_index(
+		                &results,
+		                1000 );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result_index",
+		 result_index,
+		 -1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "results.file_types[ result_index ]",
+		 results.file_types[ result_index ],
+		 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT32(
+		 "results.data_sizes[ result_index ]",
+		 results.data_sizes[ result_index ],
+		 (uint32_t) 2000 );
+
+		result_index = scca_test_scan_get_result_index(
+		                &results,
+		                4096 );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result_index",
+		 result_index,
+		 -1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "results.file_types[ result_index ]",
+		 results.file_types[ result_index ],
+		 LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT32(
+		 "results.data_sizes[ result_index ]",
+		 results.data_sizes[ result_index ],
+		 (uint32_t) 1000 );
+
+		result_index = scca_test_scan_get_result_index(
+		                &results,
+		                SCCA_TEST_SCAN_BOUNDARY_OFFSET );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result_index",
+		 result_index,
+		 -1 );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT32(
+		 "results.data_sizes[ result_index ]",
+		 results.data_sizes[ result_index ],
+		 (uint32_t) 84 );
+	}
+	results.number_of_results = 0;
+
+	result = libscca_scan_buffer(
+	          buffer,
+	          SCCA_TEST_SCAN_BUFFER_SIZE,
+	          512,
+	          1,
+	          &scca_test_scan_callback,
+	          (void *) &results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "results.number_of_results",
+	 results.number_of_results,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "results.offsets[ 0 ]",
+	 results.offsets[ 0 ],
+	 (size_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libscca_scan_buffer(
+	          NULL,
+	          SCCA_TEST_SCAN_BUFFER_SIZE,
+	          1,
+	          1,
+	          &scca_test_scan_callback,
+	          (void *) &results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_scan_buffer(
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          1,
+	          &scca_test_scan_callback,
+	          (void *) &results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_scan_buffer(
+	          buffer,
+	          SCCA_TEST_SCAN_BUFFER_SIZE,
+	          0,
+	          1,
+	          &scca_test_scan_callback,
+	          (void *) &results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_scan_buffer(
+	          buffer,
+	          SCCA_TEST_SCAN_BUFFER_SIZE,
+	          1,
+	          0,
+	          &scca_test_scan_callback,
+	          (void *) &results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_scan_buffer(
+	          buffer,
+	          SCCA_TEST_SCAN_BUFFER_SIZE,
+	          1,
+	          1,
+	          NULL,
+	          (void *) &results,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_scan_buffer",
+	 scca_test_scan_buffer )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
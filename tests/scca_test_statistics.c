@@ -0,0 +1,623 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_statistics.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_statistics_add_section_read_time function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_statistics_add_section_read_time(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libscca_statistics_t statistics;
+	int result                      = 0;
+
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libscca_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_statistics_start_timer(
+	          &statistics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read times are not measured unless requested
+	 */
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.timestamp",
+	 statistics.timestamp,
+	 (uint64_t) 0 );
+
+	result = libscca_statistics_add_section_read_time(
+	          &statistics,
+	          LIBSCCA_STATISTICS_SECTION_FILE_HEADER,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "statistics.has_section_read_times",
+	 statistics.has_section_read_times,
+	 0 );
+
+	statistics.measure_read_times = 1;
+
+	result = libscca_statistics_start_timer(
+	          &statistics,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_statistics_add_section_read_time(
+	          &statistics,
+	          LIBSCCA_STATISTICS_SECTION_FILE_HEADER,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read times are only measured if a monotonic clock is available
+	 */
+	if( statistics.timestamp == 0 )
+	{
+		SCCA_TEST_ASSERT_EQUAL_UINT8(
+		 "statistics.has_section_read_times",
+		 statistics.has_section_read_times,
+		 0 );
+	}
+	else
+	{
+		SCCA_TEST_ASSERT_EQUAL_UINT8(
+		 "statistics.has_section_read_times",
+		 statistics.has_section_read_times,
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libscca_statistics_add_section_read_time(
+	          NULL,
+	          LIBSCCA_STATISTICS_SECTION_FILE_HEADER,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_statistics_add_section_read_time(
+	          &statistics,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_statistics_add_section_read_time(
+	          &statistics,
+	          LIBSCCA_STATISTICS_NUMBER_OF_SECTIONS,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_statistics_add_allocation function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_statistics_add_allocation(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libscca_statistics_t statistics;
+	int result                      = 0;
+
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libscca_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libscca_statistics_add_allocation(
+	          &statistics,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_statistics_add_allocated_size(
+	          &statistics,
+	          1024,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.number_of_allocations",
+	 statistics.number_of_allocations,
+	 (uint64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.allocated_size",
+	 statistics.allocated_size,
+	 (uint64_t) 5120 );
+
+	result = libscca_statistics_remove_allocated_size(
+	          &statistics,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.allocated_size",
+	 statistics.allocated_size,
+	 (uint64_t) 1024 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.maximum_allocated_size",
+	 statistics.maximum_allocated_size,
+	 (uint64_t) 5120 );
+
+	/* The allocated size does not drop below 0
+	 */
+	result = libscca_statistics_remove_allocated_size(
+	          &statistics,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "statistics.allocated_size",
+	 statistics.allocated_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_statistics_add_allocation(
+	          NULL,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_statistics_add_allocated_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_statistics_remove_allocated_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_statistics_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_statistics_get_value(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libscca_statistics_t statistics;
+	uint64_t value                  = 0;
+	int result                      = 0;
+
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( libscca_statistics_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	statistics.number_of_bytes_read    = 4096;
+	statistics.number_of_block_lookups = 5;
+	statistics.number_of_block_reads   = 2;
+
+	/* Test regular cases
+	 */
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 4096 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_HITS,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_CACHE_MISSES,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read times are not available until they were measured
+	 */
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_FILE_HEADER_READ_TIME,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	statistics.section_read_times[ LIBSCCA_STATISTICS_SECTION_VOLUMES ]     = 1000;
+	statistics.section_read_times[ LIBSCCA_STATISTICS_SECTION_TRACE_CHAIN ] = 2000;
+	statistics.has_section_read_times                                       = 1;
+
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_VOLUMES_READ_TIME,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1000 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_TRACE_CHAIN_READ_TIME,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 2000 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_statistics_get_value(
+	          NULL,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          0,
+	          &value,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_statistics_get_value(
+	          &statistics,
+	          LIBSCCA_STATISTIC_TYPE_NUMBER_OF_BYTES_READ,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_statistics_add_section_read_time",
+	 scca_test_statistics_add_section_read_time );
+
+	SCCA_TEST_RUN(
+	 "libscca_statistics_add_allocation",
+	 scca_test_statistics_add_allocation );
+
+	SCCA_TEST_RUN(
+	 "libscca_statistics_get_value",
+	 scca_test_statistics_get_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1314 @@
+/*
+ * Library concurrency stress test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_getopt.h"
+#include "scca_test_libbfio.h"
+#include "scca_test_libcerror.h"
+#include "scca_test_libcthreads.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../bench/bench_timer.h"
+
+/* The stress test reads the values of a source from many threads at once,
+ * in the following modes:
+ * file           threads share a single file that is opened with a file IO handle
+ *                and read on first access, which relies on the locking of the file
+ * shared_file    threads share the read-only file created by libscca_file_share
+ * shared_caches  every thread opens its own files, which share a block cache,
+ *                a string pool and a volume dictionary
+ * The values read by every thread are compared with the values read by a single
+ * thread and the throughput per number of threads is printed with the scaling
+ * efficiency relative to a single thread. The test is intended to be run on
+ * a build with ThreadSanitizer, for example: "scca_test_stress -t 16 input.pf"
+ */
+
+#if !defined( LIBSCCA_HAVE_BFIO )
+
+LIBSCCA_EXTERN \
+int libscca_file_open_file_io_handle(
+     libscca_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libscca_error_t **error );
+
+#endif /* !defined( LIBSCCA_HAVE_BFIO ) */
+
+/* The maximum number of threads
+ */
+#define SCCA_TEST_STRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The default maximum number of threads
+ */
+#define SCCA_TEST_STRESS_DEFAULT_NUMBER_OF_THREADS	8
+
+/* The default number of iterations per thread
+ */
+#define SCCA_TEST_STRESS_DEFAULT_NUMBER_OF_ITERATIONS	20
+
+/* The maximum size of the strings that are read
+ */
+#define SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE		32768
+
+/* The size of the shared block cache
+ */
+#define SCCA_TEST_STRESS_BLOCK_CACHE_SIZE		( 4 * 1024 * 1024 )
+
+enum SCCA_TEST_STRESS_MODES
+{
+	SCCA_TEST_STRESS_MODE_FILE			= 0,
+	SCCA_TEST_STRESS_MODE_SHARED_FILE		= 1,
+	SCCA_TEST_STRESS_MODE_SHARED_CACHES		= 2
+};
+
+/* The number of modes
+ */
+#define SCCA_TEST_STRESS_NUMBER_OF_MODES		3
+
+const char *scca_test_stress_mode_names[ SCCA_TEST_STRESS_NUMBER_OF_MODES ] = {
+	"file",
+	"shared_file",
+	"shared_caches" };
+
+typedef struct scca_test_stress_worker scca_test_stress_worker_t;
+
+struct scca_test_stress_worker
+{
+	/* The mode
+	 */
+	int mode;
+
+	/* The file that is shared by the threads, contains NULL in shared caches mode
+	 */
+	libscca_file_t *file;
+
+	/* The data of the source
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The shared block cache
+	 */
+	libscca_block_cache_t *block_cache;
+
+	/* The shared string pool
+	 */
+	libscca_string_pool_t *string_pool;
+
+	/* The shared volume dictionary
+	 */
+	libscca_volume_dictionary_t *volume_dictionary;
+
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The checksum of the values read by a single thread
+	 */
+	uint64_t reference_checksum;
+
+	/* The number of iterations of which the checksum differs from the reference checksum
+	 */
+	int number_of_mismatches;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Updates a FNV-1a checksum with data
+ * Returns the updated checksum
+ */
+uint64_t scca_test_stress_update_checksum(
+          uint64_t checksum,
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		checksum ^= data[ data_offset ];
+		checksum *= 0x100000001b3ULL;
+	}
+	return( checksum );
+}
+
+/* Reads the file metrics entries, filenames and volumes of a file
+ * The values that are not available are not part of the checksum
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_stress_read_values(
+     libscca_file_t *file,
+     uint64_t *checksum,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE ];
+
+	libscca_file_metrics_t *file_metrics             = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	static char *function                            = "scca_test_stress_read_values";
+	size_t utf8_string_size                          = 0;
+	uint64_t file_reference                          = 0;
+	uint64_t safe_checksum                           = 0xcbf29ce484222325ULL;
+	uint32_t serial_number                           = 0;
+	int entry_index                                  = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
+
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_get_number_of_file_metrics_entries(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file metrics entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_file_get_file_metrics_entry(
+		     file,
+		     entry_index,
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		result = libscca_file_metrics_get_utf8_filename_size(
+		          file_metrics,
+		          &utf8_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( utf8_string_size <= SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE ) )
+		{
+			result = libscca_file_metrics_get_utf8_filename(
+			          file_metrics,
+			          utf8_string,
+			          SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE,
+			          error );
+		}
+		if( result == 1 )
+		{
+			safe_checksum = scca_test_stress_update_checksum(
+			                 safe_checksum,
+			                 utf8_string,
+			                 utf8_string_size );
+		}
+		else
+		{
+			libcerror_error_free(
+			 error );
+		}
+		result = libscca_file_metrics_get_file_reference(
+		          file_metrics,
+		          &file_reference,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file reference of file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			safe_checksum = scca_test_stress_update_checksum(
+			                 safe_checksum,
+			                 (uint8_t *) &file_reference,
+			                 sizeof( uint64_t ) );
+		}
+		if( libscca_file_metrics_free(
+		     &file_metrics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file metrics entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libscca_file_get_number_of_filenames(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of filenames.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libscca_file_get_utf8_filename_size(
+		          file,
+		          entry_index,
+		          &utf8_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( utf8_string_size <= SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE ) )
+		{
+			result = libscca_file_get_utf8_filename(
+			          file,
+			          entry_index,
+			          utf8_string,
+			          SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE,
+			          error );
+		}
+		if( result == 1 )
+		{
+			safe_checksum = scca_test_stress_update_checksum(
+			                 safe_checksum,
+			                 utf8_string,
+			                 utf8_string_size );
+		}
+		else
+		{
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( libscca_file_get_number_of_volumes(
+	     file,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libscca_file_get_volume_information(
+		     file,
+		     entry_index,
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume: %d information.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libscca_volume_information_get_serial_number(
+		     volume_information,
+		     &serial_number,
+		     error ) == 1 )
+		{
+			safe_checksum = scca_test_stress_update_checksum(
+			                 safe_checksum,
+			                 (uint8_t *) &serial_number,
+			                 sizeof( uint32_t ) );
+		}
+		else
+		{
+			libcerror_error_free(
+			 error );
+		}
+		result = libscca_volume_information_get_utf8_device_path_size(
+		          volume_information,
+		          &utf8_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( utf8_string_size <= SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE ) )
+		{
+			result = libscca_volume_information_get_utf8_device_path(
+			          volume_information,
+			          utf8_string,
+			          SCCA_TEST_STRESS_MAXIMUM_STRING_SIZE,
+			          error );
+		}
+		if( result == 1 )
+		{
+			safe_checksum = scca_test_stress_update_checksum(
+			                 safe_checksum,
+			                 utf8_string,
+			                 utf8_string_size );
+		}
+		else
+		{
+			libcerror_error_free(
+			 error );
+		}
+		if( libscca_volume_information_free(
+		     &volume_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume: %d information.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	*checksum = safe_checksum;
+
+	return( 1 );
+
+on_error:
+	if( volume_information != NULL )
+	{
+		libscca_volume_information_free(
+		 &volume_information,
+		 NULL );
+	}
+	if( file_metrics != NULL )
+	{
+		libscca_file_metrics_free(
+		 &file_metrics,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens a file from the data of the source that uses the shared caches
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_stress_open_file_with_shared_caches(
+     scca_test_stress_worker_t *worker,
+     libscca_file_t **file,
+     libcerror_error_t **error )
+{
+	static char *function = "scca_test_stress_open_file_with_shared_caches";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( libscca_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_set_block_cache(
+	     *file,
+	     worker->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_set_string_pool(
+	     *file,
+	     worker->string_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set string pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_set_volume_dictionary(
+	     *file,
+	     worker->volume_dictionary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set volume dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	if( libscca_file_open_memory(
+	     *file,
+	     worker->data,
+	     worker->data_size,
+	     LIBSCCA_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libscca_file_free(
+		 file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the values of the source a number of iterations
+ * Callback function of the stress threads
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_stress_worker_callback(
+     scca_test_stress_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+	libscca_file_t *file     = NULL;
+	uint64_t checksum        = 0;
+	int iteration            = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = -1;
+
+	for( iteration = 0;
+	     iteration < worker->number_of_iterations;
+	     iteration++ )
+	{
+		if( worker->mode == SCCA_TEST_STRESS_MODE_SHARED_CACHES )
+		{
+			if( scca_test_stress_open_file_with_shared_caches(
+			     worker,
+			     &file,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			file = worker->file;
+		}
+		if( scca_test_stress_read_values(
+		     file,
+		     &checksum,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( checksum != worker->reference_checksum )
+		{
+			worker->number_of_mismatches += 1;
+		}
+		if( worker->mode == SCCA_TEST_STRESS_MODE_SHARED_CACHES )
+		{
+			if( libscca_file_close(
+			     file,
+			     &error ) != 0 )
+			{
+				goto on_error;
+			}
+			if( libscca_file_free(
+			     &file,
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		file = NULL;
+	}
+	worker->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( file != NULL )
+	 && ( file != worker->file ) )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs the stress workers on a number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_stress_run(
+     scca_test_stress_worker_t *template_worker,
+     int number_of_threads,
+     uint64_t *elapsed_time )
+{
+	scca_test_stress_worker_t workers[ SCCA_TEST_STRESS_MAXIMUM_NUMBER_OF_THREADS ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ SCCA_TEST_STRESS_MAXIMUM_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+#endif
+	uint64_t end_timestamp   = 0;
+	uint64_t start_timestamp = 0;
+	int thread_index         = 0;
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "template_worker",
+	 template_worker );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
+	SCCA_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 SCCA_TEST_STRESS_MAXIMUM_NUMBER_OF_THREADS + 1 );
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		workers[ thread_index ] = *template_worker;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		threads[ thread_index ] = NULL;
+#endif
+	}
+	bench_timer_get_timestamp(
+	 &start_timestamp );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &scca_test_stress_worker_callback,
+		          (void *) &( workers[ thread_index ] ),
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#else
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		scca_test_stress_worker_callback(
+		 &( workers[ thread_index ] ) );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	bench_timer_get_timestamp(
+	 &end_timestamp );
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "workers[ thread_index ].result",
+		 workers[ thread_index ].result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "workers[ thread_index ].number_of_mismatches",
+		 workers[ thread_index ].number_of_mismatches,
+		 0 );
+	}
+	*elapsed_time = end_timestamp - start_timestamp;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+#endif
+	return( 0 );
+}
+
+/* Tests the concurrent reads of a source
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_stress(
+     const system_character_t *source,
+     int maximum_number_of_threads,
+     int number_of_iterations )
+{
+	scca_test_stress_worker_t worker;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libscca_file_t *file             = NULL;
+	libscca_file_t *shared_file      = NULL;
+	uint8_t *data                    = NULL;
+	size64_t file_size               = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	uint64_t elapsed_time            = 0;
+	uint64_t single_thread_time      = 0;
+	double efficiency                = 0.0;
+	double iterations_per_second     = 0.0;
+	int mode                         = 0;
+	int number_of_threads            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "file_size",
+	 (uint64_t) file_size,
+	 (uint64_t) SSIZE_MAX );
+
+	/* Allocate at least 1 byte so that empty inputs are handled
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * ( (size_t) file_size + 1 ) );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) file_size,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) file_size );
+
+	if( memory_set(
+	     &worker,
+	     0,
+	     sizeof( scca_test_stress_worker_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	worker.data                 = data;
+	worker.data_size            = (size_t) file_size;
+	worker.number_of_iterations = number_of_iterations;
+
+	/* The values read by a single thread are the reference, a source that is
+	 * not a supported prefetch file is not stressed
+	 */
+	result = libscca_file_initialize(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_file_open_memory(
+	          file,
+	          data,
+	          (size_t) file_size,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		goto on_success;
+	}
+	result = scca_test_stress_read_values(
+	          file,
+	          &( worker.reference_checksum ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_file_close(
+	          file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_block_cache_initialize(
+	          &( worker.block_cache ),
+	          SCCA_TEST_STRESS_BLOCK_CACHE_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_string_pool_initialize(
+	          &( worker.string_pool ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_volume_dictionary_initialize(
+	          &( worker.volume_dictionary ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( mode = 0;
+	     mode < SCCA_TEST_STRESS_NUMBER_OF_MODES;
+	     mode++ )
+	{
+		worker.mode = mode;
+
+		number_of_threads = 1;
+
+		while( number_of_threads <= maximum_number_of_threads )
+		{
+			/* Every run uses a newly opened file, so that the sections that are
+			 * read on first access are read concurrently
+			 */
+			if( mode != SCCA_TEST_STRESS_MODE_SHARED_CACHES )
+			{
+				result = libscca_file_open_file_io_handle(
+				          file,
+				          file_io_handle,
+				          LIBSCCA_OPEN_READ,
+				          &error );
+
+				SCCA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SCCA_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				worker.file = file;
+			}
+			if( mode == SCCA_TEST_STRESS_MODE_SHARED_FILE )
+			{
+				result = libscca_file_share(
+				          file,
+				          &shared_file,
+				          &error );
+
+				SCCA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				SCCA_TEST_ASSERT_IS_NOT_NULL(
+				 "shared_file",
+				 shared_file );
+
+				worker.file = shared_file;
+			}
+			result = scca_test_stress_run(
+			          &worker,
+			          number_of_threads,
+			          &elapsed_time );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			if( shared_file != NULL )
+			{
+				result = libscca_file_release(
+				          &shared_file,
+				          &error );
+
+				SCCA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+			}
+			if( mode != SCCA_TEST_STRESS_MODE_SHARED_CACHES )
+			{
+				result = libscca_file_close(
+				          file,
+				          &error );
+
+				SCCA_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+
+				worker.file = NULL;
+			}
+			if( elapsed_time == 0 )
+			{
+				elapsed_time = 1;
+			}
+			if( number_of_threads == 1 )
+			{
+				single_thread_time = elapsed_time;
+			}
+			/* Every thread does the same number of iterations, hence with perfect
+			 * scaling the elapsed time does not change when threads are added
+			 */
+			iterations_per_second = ( (double) number_of_threads * number_of_iterations * 1000000000.0 ) / (double) elapsed_time;
+			efficiency            = ( (double) single_thread_time * 100.0 ) / (double) elapsed_time;
+
+			fprintf(
+			 stdout,
+			 "%s: threads: %d iterations/second: %.1f efficiency: %.1f%%\n",
+			 scca_test_stress_mode_names[ mode ],
+			 number_of_threads,
+			 iterations_per_second,
+			 efficiency );
+
+			if( number_of_threads == maximum_number_of_threads )
+			{
+				break;
+			}
+			number_of_threads *= 2;
+
+			if( number_of_threads > maximum_number_of_threads )
+			{
+				number_of_threads = maximum_number_of_threads;
+			}
+		}
+	}
+	/* Clean up
+	 */
+	result = libscca_volume_dictionary_free(
+	          &( worker.volume_dictionary ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_string_pool_free(
+	          &( worker.string_pool ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_block_cache_free(
+	          &( worker.block_cache ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+on_success:
+	result = libscca_file_free(
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_file != NULL )
+	{
+		libscca_file_release(
+		 &shared_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libscca_file_free(
+		 &file,
+		 NULL );
+	}
+	if( worker.volume_dictionary != NULL )
+	{
+		libscca_volume_dictionary_free(
+		 &( worker.volume_dictionary ),
+		 NULL );
+	}
+	if( worker.string_pool != NULL )
+	{
+		libscca_string_pool_free(
+		 &( worker.string_pool ),
+		 NULL );
+	}
+	if( worker.block_cache != NULL )
+	{
+		libscca_block_cache_free(
+		 &( worker.block_cache ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *option_number_of_iterations = NULL;
+	system_character_t *option_number_of_threads    = NULL;
+	system_integer_t option                         = 0;
+	int maximum_number_of_threads                   = SCCA_TEST_STRESS_DEFAULT_NUMBER_OF_THREADS;
+	int number_of_iterations                        = SCCA_TEST_STRESS_DEFAULT_NUMBER_OF_ITERATIONS;
+
+	while( ( option = scca_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "i:t:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'i':
+				option_number_of_iterations = optarg;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+		}
+	}
+	if( option_number_of_iterations != NULL )
+	{
+		number_of_iterations = (int) system_string_to_long(
+		                              option_number_of_iterations );
+
+		if( number_of_iterations < 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of iterations.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( option_number_of_threads != NULL )
+	{
+		maximum_number_of_threads = (int) system_string_to_long(
+		                                   option_number_of_threads );
+
+		if( ( maximum_number_of_threads < 1 )
+		 || ( maximum_number_of_threads > SCCA_TEST_STRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of threads.\n" );
+
+			return( EXIT_FAILURE );
+		}
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the workers are run sequentially
+	 */
+	maximum_number_of_threads = 1;
+#endif
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Every source is tested, which allows a corpus to be tested at once
+	 */
+	while( optind < argc )
+	{
+		SCCA_TEST_RUN_WITH_ARGS(
+		 "stress",
+		 scca_test_stress,
+		 argv[ optind ],
+		 maximum_number_of_threads,
+		 number_of_iterations );
+
+		optind++;
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,675 @@
+/*
+ * Library string pool functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_string_pool.h"
+
+/* Tests the libscca_string_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_string_pool_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_string_pool_t *string_pool = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_string_pool_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_pool = (libscca_string_pool_t *) 0x12345678UL;
+
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	string_pool = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libscca_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_string_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_string_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_string_pool_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_string_pool_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_string_pool_get_statistics(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_string_pool_t *string_pool = NULL;
+	size64_t size                      = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	int number_of_strings              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_string_pool_get_statistics(
+	          string_pool,
+	          &number_of_strings,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_string_pool_get_statistics(
+	          NULL,
+	          &number_of_strings,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_string_pool_get_statistics(
+	          string_pool,
+	          NULL,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libscca_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_string_pool_intern_string and libscca_string_pool_get_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_string_pool_intern_string(
+     void )
+{
+	uint8_t string_data[ 8 ];
+
+	libcerror_error_t *error           = NULL;
+	libscca_string_pool_t *string_pool = NULL;
+	const uint8_t *data                = NULL;
+	size64_t size                      = 0;
+	size_t data_size                   = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	uint32_t string_identifier1        = 0;
+	uint32_t string_identifier2        = 0;
+	uint32_t string_identifier3        = 0;
+	uint32_t string_index              = 0;
+	int number_of_strings              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "string_pool",
+	 string_pool );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_string_pool_intern_string(
+	          string_pool,
+	          (uint8_t *) "N\0T\0D\0L\0L\0\0\0",
+	          12,
+	          &string_identifier1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_string_pool_intern_string(
+	          string_pool,
+	          (uint8_t *) "K\0E\0R\0N\0\0\0",
+	          10,
+	          &string_identifier2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_identifier2",
+	 string_identifier2,
+	 (uint32_t) 1 );
+
+	/* Test that a string that is already in the pool is shared
+	 */
+	result = libscca_string_pool_intern_string(
+	          string_pool,
+	          (uint8_t *) "N\0T\0D\0L\0L\0\0\0",
+	          12,
+	          &string_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_identifier3",
+	 string_identifier3,
+	 string_identifier1 );
+
+	result = libscca_string_pool_get_string(
+	          string_pool,
+	          string_identifier2,
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 10 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "K\0E\0R\0N\0\0\0",
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_string_pool_get_statistics(
+	          string_pool,
+	          &number_of_strings,
+	          &size,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 22 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the identifiers remain valid when the buckets are resized
+	 */
+	for( string_index = 0;
+	     string_index < ( 2 * LIBSCCA_STRING_POOL_MINIMUM_NUMBER_OF_BUCKETS );
+	     string_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 string_data,
+		 string_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( string_data[ 4 ] ),
+		 0 );
+
+		result = libscca_string_pool_intern_string(
+		          string_pool,
+		          string_data,
+		          8,
+		          &string_identifier3,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_string_pool_intern_string(
+	          string_pool,
+	          (uint8_t *) "K\0E\0R\0N\0\0\0",
+	          10,
+	          &string_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_identifier3",
+	 string_identifier3,
+	 string_identifier2 );
+
+	/* Test error cases
+	 */
+	result = libscca_string_pool_intern_string(
+	          NULL,
+	          (uint8_t *) "K\0E\0R\0N\0\0\0",
+	          10,
+	          &string_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_string_pool_intern_string(
+	          string_pool,
+	          NULL,
+	          10,
+	          &string_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_string_pool_get_string(
+	          string_pool,
+	          (uint32_t) number_of_strings + ( 2 * LIBSCCA_STRING_POOL_MINIMUM_NUMBER_OF_BUCKETS ),
+	          &data,
+	          &data_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libscca_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_string_pool_initialize",
+	 scca_test_string_pool_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_string_pool_free",
+	 scca_test_string_pool_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_string_pool_get_statistics",
+	 scca_test_string_pool_get_statistics );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_string_pool_intern_string",
+	 scca_test_string_pool_intern_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
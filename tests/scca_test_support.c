@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -39,6 +40,10 @@
 #include "scca_test_memory.h"
 #include "scca_test_unused.h"
 
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+#include "../libscca/libscca_front_coded_strings.h"
+#endif
+
 #if !defined( LIBSCCA_HAVE_BFIO )
 
 LIBSCCA_EXTERN \
@@ -199,117 +204,158 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libscca_check_file_signature function
- * Returns 1 if successful or 0 if not
+/* Allocation function for testing libscca_set_allocator
+ * Returns a pointer to the buffer or NULL on error
  */
-int scca_test_check_file_signature(
-     const system_character_t *source )
+void *scca_test_allocator_allocate(
+       size_t size,
+       void *user_data )
 {
-	char narrow_source[ 256 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	int *number_of_allocations = (int *) user_data;
 
-	if( source != NULL )
-	{
-		/* Initialize test
-		 */
-		result = scca_test_get_narrow_source(
-		          source,
-		          narrow_source,
-		          256,
-		          &error );
+	*number_of_allocations += 1;
 
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	return( memory_allocate(
+	         size ) );
+}
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+/* Reallocation function for testing libscca_set_allocator
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *scca_test_allocator_reallocate(
+       void *buffer,
+       size_t size,
+       void *user_data )
+{
+	int *number_of_allocations = (int *) user_data;
 
-		/* Test check file signature
-		 */
-		result = libscca_check_file_signature(
-		          narrow_source,
-		          &error );
+	if( buffer == NULL )
+	{
+		*number_of_allocations += 1;
+	}
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
 
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+/* Free function for testing libscca_set_allocator
+ */
+void scca_test_allocator_free(
+      void *buffer,
+      void *user_data )
+{
+	int *number_of_allocations = (int *) user_data;
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	if( buffer != NULL )
+	{
+		*number_of_allocations -= 1;
 	}
-	/* Test error cases
+	memory_free(
+	 buffer );
+}
+
+/* Tests the libscca_set_allocator function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_set_allocator(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_string_pool_t *string_pool = NULL;
+	int number_of_allocations          = 0;
+	int result                         = 0;
+
+	/* Test regular cases
 	 */
-	result = libscca_check_file_signature(
-	          NULL,
+	result = libscca_set_allocator(
+	          &scca_test_allocator_allocate,
+	          &scca_test_allocator_reallocate,
+	          &scca_test_allocator_free,
+	          (void *) &number_of_allocations,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
 
-	result = libscca_check_file_signature(
-	          "",
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+	result = libscca_string_pool_free(
+	          &string_pool,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
 
-	if( source != NULL )
-	{
-#if defined( HAVE_SCCA_TEST_MEMORY )
+	result = libscca_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
 
-		/* Test libscca_check_file_signature with malloc failing in libbfio_file_initialize
-		 */
-		scca_test_malloc_attempts_before_fail = 0;
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		result = libscca_check_file_signature(
-		          narrow_source,
-		          &error );
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( scca_test_malloc_attempts_before_fail != -1 )
-		{
-			scca_test_malloc_attempts_before_fail = -1;
-		}
-		else
-		{
-			SCCA_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+	/* Test error cases
+	 */
+	result = libscca_set_allocator(
+	          &scca_test_allocator_allocate,
+	          NULL,
+	          &scca_test_allocator_free,
+	          (void *) &number_of_allocations,
+	          &error );
 
-			SCCA_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-			libcerror_error_free(
-			 &error );
-		}
-#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
-	}
 	return( 1 );
 
 on_error:
@@ -318,123 +364,1436 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( string_pool != NULL )
+	{
+		libscca_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	libscca_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libscca_check_file_signature_wide function
+/* Tests that the allocations of the timeline, directory, run time histogram
+ * and front-coded strings are routed through libscca_set_allocator
  * Returns 1 if successful or 0 if not
  */
-int scca_test_check_file_signature_wide(
-     const system_character_t *source )
+int scca_test_set_allocator_allocations(
+     void )
 {
-	wchar_t wide_source[ 256 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	if( source != NULL )
-	{
-		/* Initialize test
-		 */
-		result = scca_test_get_wide_source(
-		          source,
-		          wide_source,
-		          256,
-		          &error );
-
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	libcerror_error_t *error                         = NULL;
+	libscca_directory_t *directory                   = NULL;
+	libscca_run_time_histogram_t *run_time_histogram = NULL;
+	libscca_timeline_t *timeline                     = NULL;
+	int number_of_allocations                        = 0;
+	int result                                       = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+	libscca_front_coded_strings_t *front_coded_strings = NULL;
+#endif
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	result = libscca_set_allocator(
+	          &scca_test_allocator_allocate,
+	          &scca_test_allocator_reallocate,
+	          &scca_test_allocator_free,
+	          (void *) &number_of_allocations,
+	          &error );
 
-		/* Test check file signature
-		 */
-		result = libscca_check_file_signature_wide(
-		          wide_source,
-		          &error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
+	/* Test the timeline allocations
 	 */
-	result = libscca_check_file_signature_wide(
-	          NULL,
+	result = libscca_timeline_initialize(
+	          &timeline,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
 
-	result = libscca_check_file_signature_wide(
-	          L"",
+	result = libscca_timeline_free(
+	          &timeline,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
 
-	if( source != NULL )
-	{
-#if defined( HAVE_SCCA_TEST_MEMORY )
+	/* Test the directory allocations
+	 */
+	result = libscca_directory_initialize(
+	          &directory,
+	          &error );
 
-		/* Test libscca_check_file_signature_wide with malloc failing in libbfio_file_initialize
-		 */
-		scca_test_malloc_attempts_before_fail = 0;
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		result = libscca_check_file_signature_wide(
-		          wide_source,
-		          &error );
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		if( scca_test_malloc_attempts_before_fail != -1 )
-		{
-			scca_test_malloc_attempts_before_fail = -1;
-		}
-		else
-		{
-			SCCA_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
 
-			SCCA_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+	result = libscca_directory_free(
+	          &directory,
+	          &error );
 
-			libcerror_error_free(
-			 &error );
-		}
-#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
-	}
-	return( 1 );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+	/* Test the run time histogram allocations
+	 */
+	result = libscca_run_time_histogram_initialize(
+	          &run_time_histogram,
+	          36000000000UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+	result = libscca_run_time_histogram_free(
+	          &run_time_histogram,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	/* Test the front-coded strings allocations
+	 */
+	result = libscca_front_coded_strings_initialize(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+	result = libscca_front_coded_strings_free(
+	          &front_coded_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	result = libscca_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libscca_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libscca_directory_free(
+		 &directory,
+		 NULL );
+	}
+	if( run_time_histogram != NULL )
+	{
+		libscca_run_time_histogram_free(
+		 &run_time_histogram,
+		 NULL );
+	}
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+	if( front_coded_strings != NULL )
+	{
+		libscca_front_coded_strings_free(
+		 &front_coded_strings,
+		 NULL );
+	}
+#endif
+	libscca_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Allocation function for testing libscca_set_memory_pressure_function
+ * Fails the number of allocations the user data references
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *scca_test_memory_pressure_allocate(
+       size_t size,
+       void *user_data )
+{
+	int *number_of_failures = (int *) user_data;
+
+	if( *number_of_failures > 0 )
+	{
+		*number_of_failures -= 1;
+
+		return( NULL );
+	}
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Reallocation function for testing libscca_set_memory_pressure_function
+ * Returns a pointer to the buffer or NULL on error
+ */
+void *scca_test_memory_pressure_reallocate(
+       void *buffer,
+       size_t size,
+       void *user_data SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Free function for testing libscca_set_memory_pressure_function
+ */
+void scca_test_memory_pressure_free(
+      void *buffer,
+      void *user_data SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( user_data )
+
+	memory_free(
+	 buffer );
+}
+
+/* Memory pressure function for testing libscca_set_memory_pressure_function
+ * Returns 1 if memory was released or 0 if not
+ */
+int scca_test_memory_pressure_release(
+     size_t size SCCA_TEST_ATTRIBUTE_UNUSED,
+     void *user_data )
+{
+	int *number_of_calls = (int *) user_data;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( size )
+
+	*number_of_calls += 1;
+
+	return( 1 );
+}
+
+/* Tests the libscca_set_memory_pressure_function function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_set_memory_pressure_function(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_string_pool_t *string_pool = NULL;
+	int number_of_calls                = 0;
+	int number_of_failures             = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_set_allocator(
+	          &scca_test_memory_pressure_allocate,
+	          &scca_test_memory_pressure_reallocate,
+	          &scca_test_memory_pressure_free,
+	          (void *) &number_of_failures,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_set_memory_pressure_function(
+	          &scca_test_memory_pressure_release,
+	          (void *) &number_of_calls,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A failed allocation is retried once after the memory pressure function released memory
+	 */
+	number_of_failures = 1;
+
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 1 );
+
+	result = libscca_string_pool_free(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An allocation that fails again after the retry fails
+	 */
+	number_of_failures = 2;
+
+	result = libscca_string_pool_initialize(
+	          &string_pool,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "string_pool",
+	 string_pool );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_calls",
+	 number_of_calls,
+	 2 );
+
+	/* Clean up
+	 */
+	result = libscca_set_memory_pressure_function(
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_set_allocator(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_pool != NULL )
+	{
+		libscca_string_pool_free(
+		 &string_pool,
+		 NULL );
+	}
+	libscca_set_memory_pressure_function(
+	 NULL,
+	 NULL,
+	 NULL );
+
+	libscca_set_allocator(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libscca_check_file_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_check_file_signature(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = scca_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test check file signature
+		 */
+		result = libscca_check_file_signature(
+		          narrow_source,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_check_file_signature(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_file_signature(
+	          "",
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( source != NULL )
+	{
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+		/* Test libscca_check_file_signature with malloc failing in libbfio_file_initialize
+		 */
+		scca_test_malloc_attempts_before_fail = 0;
+
+		result = libscca_check_file_signature(
+		          narrow_source,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libscca_check_file_signature_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_check_file_signature_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = scca_test_get_wide_source(
+		          source,
+		          wide_source,
+		          256,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test check file signature
+		 */
+		result = libscca_check_file_signature_wide(
+		          wide_source,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_check_file_signature_wide(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_file_signature_wide(
+	          L"",
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( source != NULL )
+	{
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+		/* Test libscca_check_file_signature_wide with malloc failing in libbfio_file_initialize
+		 */
+		scca_test_malloc_attempts_before_fail = 0;
+
+		result = libscca_check_file_signature_wide(
+		          wide_source,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the libscca_check_file_signature_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_check_file_signature_file_io_handle(
+     const system_character_t *source )
+{
+	uint8_t empty_block[ 8192 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	void *memset_result              = NULL;
+	size_t source_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 8192 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	if( source != NULL )
+	{
+		/* Initialize test
+		 */
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		source_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          source_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          source_length,
+		          &error );
+#endif
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_open(
+		          file_io_handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test check file signature
+		 */
+		result = libscca_check_file_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_check_file_signature_file_io_handle(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	if( source != NULL )
+	{
+		result = libbfio_handle_close(
+		          file_io_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test check file signature with data too small
+	 */
+	result = scca_test_open_file_io_handle(
+	          &file_io_handle,
+	          empty_block,
+	          sizeof( uint8_t ) * 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_check_file_signature_file_io_handle(
+	          file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scca_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test check file signature with empty block
+	 */
+	result = scca_test_open_file_io_handle(
+	          &file_io_handle,
+	          empty_block,
+	          sizeof( uint8_t ) * 8192,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_check_file_signature_file_io_handle(
+	          file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scca_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_check_file_header_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_check_file_header_data(
+     void )
+{
+	uint8_t compressed_file_header_data[ 8 ] = {
+		0x4d, 0x41, 0x4d, 0x04, 0x00, 0x10, 0x00, 0x00 };
+
+	uint8_t file_header_data[ 16 ] = {
+		0x1e, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00 };
+
+	uint8_t empty_block[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 16 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libscca_check_file_header_data(
+	          file_header_data,
+	          16,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_check_file_header_data(
+	          compressed_file_header_data,
+	          8,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a file size that is smaller than the file size in the file header
+	 */
+	result = libscca_check_file_header_data(
+	          file_header_data,
+	          16,
+	          2048,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data too small
+	 */
+	result = libscca_check_file_header_data(
+	          file_header_data,
+	          8,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with empty block
+	 */
+	result = libscca_check_file_header_data(
+	          empty_block,
+	          16,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an unsupported format version
+	 */
+	file_header_data[ 0 ] = 0x63;
+
+	result = libscca_check_file_header_data(
+	          file_header_data,
+	          16,
+	          0,
+	          &error );
+
+	file_header_data[ 0 ] = 0x1e;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_check_file_header_data(
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_file_header_data(
+	          file_header_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_check_signature_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_check_signature_buffer(
+     void )
+{
+	uint8_t compressed_file_header_data[ 8 ] = {
+		0x4d, 0x41, 0x4d, 0x04, 0x00, 0x10, 0x00, 0x00 };
+
+	uint8_t file_header_data[ 16 ] = {
+		0x1e, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00 };
+
+	uint8_t empty_block[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	uint32_t file_size       = 0;
+	int file_type            = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 16 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libscca_check_signature_buffer(
+	          file_header_data,
+	          16,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_size",
+	 file_size,
+	 (uint32_t) 8192 );
+
+	result = libscca_check_signature_buffer(
+	          compressed_file_header_data,
+	          8,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_size",
+	 file_size,
+	 (uint32_t) 4096 );
+
+	/* Test with data too small to contain the file size
+	 */
+	result = libscca_check_signature_buffer(
+	          file_header_data,
+	          8,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_size",
+	 file_size,
+	 (uint32_t) 0 );
+
+	/* Test with data too small to contain the signature
+	 */
+	result = libscca_check_signature_buffer(
+	          file_header_data,
+	          4,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_type",
+	 file_type,
+	 0 );
+
+	/* Test with empty block
+	 */
+	result = libscca_check_signature_buffer(
+	          empty_block,
+	          16,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_check_signature_buffer(
+	          NULL,
+	          16,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_signature_buffer(
+	          file_header_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &file_type,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_signature_buffer(
+	          file_header_data,
+	          16,
+	          NULL,
+	          &file_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_signature_buffer(
+	          file_header_data,
+	          16,
+	          &file_type,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
 
 on_error:
 	if( error != NULL )
@@ -445,112 +1804,116 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the libscca_check_file_signature_file_io_handle function
+/* Tests the libscca_check_signature_buffers function
  * Returns 1 if successful or 0 if not
  */
-int scca_test_check_file_signature_file_io_handle(
-     const system_character_t *source )
+int scca_test_check_signature_buffers(
+     void )
 {
-	uint8_t empty_block[ 8192 ];
+	uint8_t compressed_file_header_data[ 8 ] = {
+		0x4d, 0x41, 0x4d, 0x04, 0x00, 0x10, 0x00, 0x00 };
 
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	void *memset_result              = NULL;
-	size_t source_length             = 0;
-	int result                       = 0;
+	uint8_t file_header_data[ 16 ] = {
+		0x1e, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x11, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00 };
+
+	uint8_t empty_block[ 16 ];
+
+	const uint8_t *buffers[ 3 ];
+	size_t buffer_sizes[ 3 ];
+	uint32_t file_sizes[ 3 ];
+	int file_types[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
 
 	/* Initialize test
 	 */
 	memset_result = memory_set(
 	                 empty_block,
 	                 0,
-	                 sizeof( uint8_t ) * 8192 );
+	                 sizeof( uint8_t ) * 16 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "memset_result",
 	 memset_result );
 
-	if( source != NULL )
-	{
-		/* Initialize test
-		 */
-		result = libbfio_file_initialize(
-		          &file_io_handle,
-		          &error );
-
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		SCCA_TEST_ASSERT_IS_NOT_NULL(
-		 "file_io_handle",
-		 file_io_handle );
+	buffers[ 0 ]      = file_header_data;
+	buffer_sizes[ 0 ] = 16;
+	buffers[ 1 ]      = empty_block;
+	buffer_sizes[ 1 ] = 16;
+	buffers[ 2 ]      = compressed_file_header_data;
+	buffer_sizes[ 2 ] = 8;
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	/* Test regular cases
+	 */
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          file_types,
+	          file_sizes,
+	          &error );
 
-		source_length = system_string_length(
-		                 source );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 2 );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libbfio_file_set_name_wide(
-		          file_io_handle,
-		          source,
-		          source_length,
-		          &error );
-#else
-		result = libbfio_file_set_name(
-		          file_io_handle,
-		          source,
-		          source_length,
-		          &error );
-#endif
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_types[ 0 ]",
+	 file_types[ 0 ],
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
 
-		result = libbfio_handle_open(
-		          file_io_handle,
-		          LIBBFIO_OPEN_READ,
-		          &error );
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_sizes[ 0 ]",
+	 file_sizes[ 0 ],
+	 (uint32_t) 8192 );
 
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_types[ 1 ]",
+	 file_types[ 1 ],
+	 0 );
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "file_types[ 2 ]",
+	 file_types[ 2 ],
+	 LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "file_sizes[ 2 ]",
+	 file_sizes[ 2 ],
+	 (uint32_t) 4096 );
+
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          buffer_sizes,
+	          0,
+	          file_types,
+	          file_sizes,
+	          &error );
 
-		/* Test check file signature
-		 */
-		result = libscca_check_file_signature_file_io_handle(
-		          file_io_handle,
-		          &error );
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = libscca_check_file_signature_file_io_handle(
+	result = libscca_check_signature_buffers(
 	          NULL,
+	          buffer_sizes,
+	          3,
+	          file_types,
+	          file_sizes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -565,63 +1928,32 @@ int scca_test_check_file_signature_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	if( source != NULL )
-	{
-		result = libbfio_handle_close(
-		          file_io_handle,
-		          &error );
-
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
-
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		result = libbfio_handle_free(
-		          &file_io_handle,
-		          &error );
-
-		SCCA_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "file_io_handle",
-		 file_io_handle );
-
-		SCCA_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test check file signature with data too small
-	 */
-	result = scca_test_open_file_io_handle(
-	          &file_io_handle,
-	          empty_block,
-	          sizeof( uint8_t ) * 1,
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          NULL,
+	          3,
+	          file_types,
+	          file_sizes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libscca_check_file_signature_file_io_handle(
-	          file_io_handle,
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          buffer_sizes,
+	          -1,
+	          file_types,
+	          file_sizes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
@@ -636,66 +1968,72 @@ int scca_test_check_file_signature_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = scca_test_close_file_io_handle(
-	          &file_io_handle,
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          NULL,
+	          file_sizes,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test check file signature with empty block
-	 */
-	result = scca_test_open_file_io_handle(
-	          &file_io_handle,
-	          empty_block,
-	          sizeof( uint8_t ) * 8192,
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          file_types,
+	          NULL,
 	          &error );
 
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	SCCA_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	SCCA_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libscca_check_file_signature_file_io_handle(
-	          file_io_handle,
-	          &error );
-
-	SCCA_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	SCCA_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
-	result = scca_test_close_file_io_handle(
-	          &file_io_handle,
+	/* Test with a NULL buffer
+	 */
+	buffers[ 1 ] = NULL;
+
+	result = libscca_check_signature_buffers(
+	          buffers,
+	          buffer_sizes,
+	          3,
+	          file_types,
+	          file_sizes,
 	          &error );
 
+	buffers[ 1 ] = empty_block;
+
 	SCCA_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	SCCA_TEST_ASSERT_IS_NULL(
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -704,12 +2042,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	return( 0 );
 }
 
@@ -765,6 +2097,30 @@ int main(
 	 "libscca_set_codepage",
 	 scca_test_set_codepage );
 
+	SCCA_TEST_RUN(
+	 "libscca_set_allocator",
+	 scca_test_set_allocator );
+
+	SCCA_TEST_RUN(
+	 "libscca_set_allocator_allocations",
+	 scca_test_set_allocator_allocations );
+
+	SCCA_TEST_RUN(
+	 "libscca_set_memory_pressure_function",
+	 scca_test_set_memory_pressure_function );
+
+	SCCA_TEST_RUN(
+	 "libscca_check_file_header_data",
+	 scca_test_check_file_header_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_check_signature_buffer",
+	 scca_test_check_signature_buffer );
+
+	SCCA_TEST_RUN(
+	 "libscca_check_signature_buffers",
+	 scca_test_check_signature_buffers );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	SCCA_TEST_RUN_WITH_ARGS(
@@ -0,0 +1,914 @@
+/*
+ * Library timeline functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_timeline.h"
+
+/* Tests the libscca_timeline_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_timeline_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libscca_timeline_t *timeline = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline",
+	 timeline );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_timeline_free(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "timeline",
+	 timeline );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_timeline_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timeline = (libscca_timeline_t *) 0x12345678UL;
+
+	result = libscca_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	timeline = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libscca_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_timeline_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_timeline_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_timeline_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_timeline_get_next_event function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_timeline_get_next_event(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libscca_timeline_t *timeline = NULL;
+	uint64_t filetime            = 0;
+	int file_index               = 0;
+	int result                   = 0;
+	int run_slot                 = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline",
+	 timeline );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_timeline_get_next_event(
+	          timeline,
+	          &filetime,
+	          &file_index,
+	          &run_slot,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_timeline_get_next_event(
+	          NULL,
+	          &filetime,
+	          &file_index,
+	          &run_slot,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_timeline_get_next_event(
+	          timeline,
+	          NULL,
+	          &file_index,
+	          &run_slot,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_timeline_get_next_event(
+	          timeline,
+	          &filetime,
+	          NULL,
+	          &run_slot,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_timeline_get_next_event(
+	          timeline,
+	          &filetime,
+	          &file_index,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_timeline_append_file(
+	          timeline,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_timeline_free(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "timeline",
+	 timeline );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libscca_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_internal_timeline_append_input function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_timeline_append_input(
+     void )
+{
+	/* The last run times are stored most recent first, with unset run slots
+	 */
+	uint64_t last_run_times1[ 8 ] = {
+		600, 400, 200, 0, 0, 0, 0, 0 };
+
+	uint64_t last_run_times2[ 8 ] = {
+		500, 0, 300, 100, 0, 0, 0, 0 };
+
+	uint64_t last_run_times3[ 1 ] = {
+		400 };
+
+	uint64_t last_run_times4[ 1 ] = {
+		0 };
+
+	uint64_t expected_filetimes[ 8 ] = {
+		100, 200, 300, 400, 400, 500, 600 };
+
+	int expected_file_indexes[ 8 ] = {
+		1, 0, 1, 0, 2, 1, 0 };
+
+	int expected_run_slots[ 8 ] = {
+		3, 2, 2, 1, 0, 0, 0 };
+
+	libcerror_error_t *error                       = NULL;
+	libscca_file_t *file                           = NULL;
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	libscca_timeline_t *timeline                   = NULL;
+	uint64_t filetime                              = 0;
+	int event_index                                = 0;
+	int file_index                                 = 0;
+	int number_of_files                            = 0;
+	int pass_index                                 = 0;
+	int result                                     = 0;
+	int run_slot                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "timeline",
+	 timeline );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_timeline = (libscca_internal_timeline_t *) timeline;
+
+	/* Test regular cases
+	 */
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          (libscca_file_t *) last_run_times1,
+	          last_run_times1,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          (libscca_file_t *) last_run_times2,
+	          last_run_times2,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          (libscca_file_t *) last_run_times3,
+	          last_run_times3,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          (libscca_file_t *) last_run_times4,
+	          last_run_times4,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_timeline_get_number_of_files(
+	          timeline,
+	          &number_of_files,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_timeline_get_file(
+	          timeline,
+	          2,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INTPTR(
+	 "file",
+	 (intptr_t) file,
+	 (intptr_t) last_run_times3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The events are retrieved a second time after a reset
+	 */
+	for( pass_index = 0;
+	     pass_index < 2;
+	     pass_index++ )
+	{
+		for( event_index = 0;
+		     event_index < 7;
+		     event_index++ )
+		{
+			result = libscca_timeline_get_next_event(
+			          timeline,
+			          &filetime,
+			          &file_index,
+			          &run_slot,
+			          &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SCCA_TEST_ASSERT_EQUAL_UINT64(
+			 "filetime",
+			 filetime,
+			 expected_filetimes[ event_index ] );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "file_index",
+			 file_index,
+			 expected_file_indexes[ event_index ] );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "run_slot",
+			 run_slot,
+			 expected_run_slots[ event_index ] );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libscca_timeline_get_next_event(
+		          timeline,
+		          &filetime,
+		          &file_index,
+		          &run_slot,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_timeline_reset(
+		          timeline,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_internal_timeline_append_input(
+	          NULL,
+	          (libscca_file_t *) last_run_times1,
+	          last_run_times1,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          NULL,
+	          last_run_times1,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          (libscca_file_t *) last_run_times1,
+	          NULL,
+	          8,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_timeline_append_input(
+	          internal_timeline,
+	          (libscca_file_t *) last_run_times1,
+	          last_run_times1,
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_timeline_get_file(
+	          timeline,
+	          4,
+	          &file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_timeline_free(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "timeline",
+	 timeline );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libscca_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests merging the events of many inputs
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_timeline_merge(
+     void )
+{
+	uint64_t last_run_times[ 8 ];
+
+	libcerror_error_t *error                       = NULL;
+	libscca_internal_timeline_t *internal_timeline = NULL;
+	libscca_timeline_t *timeline                   = NULL;
+	uint64_t filetime                              = 0;
+	uint64_t previous_filetime                     = 0;
+	int file_index                                 = 0;
+	int input_index                                = 0;
+	int number_of_events                           = 0;
+	int result                                     = 0;
+	int run_slot                                   = 0;
+	int run_slot_index                             = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_timeline_initialize(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_timeline = (libscca_internal_timeline_t *) timeline;
+
+	/* Test regular cases
+	 */
+	for( input_index = 0;
+	     input_index < 100;
+	     input_index++ )
+	{
+		for( run_slot_index = 0;
+		     run_slot_index < 8;
+		     run_slot_index++ )
+		{
+			last_run_times[ run_slot_index ] = 1 + ( ( ( input_index * 37 ) + ( ( 7 - run_slot_index ) * 101 ) ) % 997 );
+		}
+		result = libscca_internal_timeline_append_input(
+		          internal_timeline,
+		          (libscca_file_t *) &( last_run_times[ 0 ] ),
+		          last_run_times,
+		          8,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	do
+	{
+		result = libscca_timeline_get_next_event(
+		          timeline,
+		          &filetime,
+		          &file_index,
+		          &run_slot,
+		          &error );
+
+		SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			SCCA_TEST_ASSERT_EQUAL_UINT64(
+			 "filetime",
+			 filetime,
+			 (uint64_t) ( 1 + ( ( ( file_index * 37 ) + ( ( 7 - run_slot ) * 101 ) ) % 997 ) ) );
+
+			SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+			 "previous_filetime",
+			 previous_filetime,
+			 filetime + 1 );
+
+			previous_filetime = filetime;
+
+			number_of_events++;
+		}
+	}
+	while( result == 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 800 );
+
+	/* Clean up
+	 */
+	result = libscca_timeline_free(
+	          &timeline,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timeline != NULL )
+	{
+		libscca_timeline_free(
+		 &timeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_timeline_initialize",
+	 scca_test_timeline_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_timeline_free",
+	 scca_test_timeline_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_timeline_get_next_event",
+	 scca_test_timeline_get_next_event );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_timeline_append_input",
+	 scca_test_internal_timeline_append_input );
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_timeline_merge",
+	 scca_test_internal_timeline_merge );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,870 @@
+/*
+ * Tools archive_handle type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/archive_handle.h"
+#include "../sccatools/deflate_stream.h"
+
+/* Tests the archive_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_archive_handle_initialize(
+     void )
+{
+	archive_handle_t *archive_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = archive_handle_initialize(
+	          &archive_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "archive_handle",
+	 archive_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = archive_handle_free(
+	          &archive_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "archive_handle",
+	 archive_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = archive_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	archive_handle = (archive_handle_t *) 0x12345678UL;
+
+	result = archive_handle_initialize(
+	          &archive_handle,
+	          &error );
+
+	archive_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test archive_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = archive_handle_initialize(
+		          &archive_handle,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( archive_handle != NULL )
+			{
+				archive_handle_free(
+				 &archive_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "archive_handle",
+			 archive_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test archive_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = archive_handle_initialize(
+		          &archive_handle,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( archive_handle != NULL )
+			{
+				archive_handle_free(
+				 &archive_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "archive_handle",
+			 archive_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( archive_handle != NULL )
+	{
+		archive_handle_free(
+		 &archive_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the archive_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_archive_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = archive_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the archive_handle_name_has_prefetch_extension function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_archive_handle_name_has_prefetch_extension(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = archive_handle_name_has_prefetch_extension(
+	          "Windows/Prefetch/CMD.EXE-4A81B364.pf",
+	          37 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = archive_handle_name_has_prefetch_extension(
+	          "CMD.EXE-4A81B364.PF",
+	          20 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = archive_handle_name_has_prefetch_extension(
+	          "Windows/Prefetch/Layout.ini",
+	          28 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = archive_handle_name_has_prefetch_extension(
+	          ".pf",
+	          4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = archive_handle_name_has_prefetch_extension(
+	          NULL,
+	          37 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the archive_handle_tar_read_number function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_archive_handle_tar_read_number(
+     void )
+{
+	uint8_t base256_data[ 12 ] = {
+		0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = archive_handle_tar_read_number(
+	          (uint8_t *) "00000012345",
+	          12,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 012345 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = archive_handle_tar_read_number(
+	          base256_data,
+	          12,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x100000000ULL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = archive_handle_tar_read_number(
+	          (uint8_t *) "00000012389",
+	          12,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = archive_handle_tar_read_number(
+	          NULL,
+	          12,
+	          &value_64bit,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = archive_handle_tar_read_number(
+	          (uint8_t *) "00000012345",
+	          12,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Sets a ustar header with a name, member size and type flag
+ */
+void scca_test_tools_archive_handle_set_tar_header(
+      uint8_t *tar_header,
+      const char *name,
+      size_t name_length,
+      uint32_t member_size,
+      uint8_t type_flag )
+{
+	uint32_t checksum = 0;
+	int digit_index   = 0;
+	int header_offset = 0;
+
+	memory_set(
+	 tar_header,
+	 0,
+	 ARCHIVE_HANDLE_TAR_BLOCK_SIZE );
+
+	memory_copy(
+	 tar_header,
+	 name,
+	 name_length );
+
+	for( digit_index = 10;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		tar_header[ 124 + digit_index ] = (uint8_t) '0' + (uint8_t) ( member_size & 0x07 );
+
+		member_size >>= 3;
+	}
+	tar_header[ 156 ] = type_flag;
+
+	memory_copy(
+	 &( tar_header[ 257 ] ),
+	 "ustar\0" "00",
+	 8 );
+
+	memory_set(
+	 &( tar_header[ 148 ] ),
+	 (int) ' ',
+	 8 );
+
+	for( header_offset = 0;
+	     header_offset < ARCHIVE_HANDLE_TAR_BLOCK_SIZE;
+	     header_offset++ )
+	{
+		checksum += tar_header[ header_offset ];
+	}
+	for( digit_index = 5;
+	     digit_index >= 0;
+	     digit_index-- )
+	{
+		tar_header[ 148 + digit_index ] = (uint8_t) '0' + (uint8_t) ( checksum & 0x07 );
+
+		checksum >>= 3;
+	}
+	tar_header[ 154 ] = 0;
+}
+
+/* Counts the members and checks their name and data
+ * Callback function for archive_handle_tar_append_data
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_tools_archive_handle_member_callback(
+     const char *member_name,
+     const uint8_t *member_data,
+     size_t member_data_size,
+     void *callback_arguments,
+     libcerror_error_t **error SCCA_TEST_ATTRIBUTE_UNUSED )
+{
+	int *number_of_members = NULL;
+
+	SCCA_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( member_name == NULL )
+	 || ( member_data == NULL )
+	 || ( callback_arguments == NULL ) )
+	{
+		return( -1 );
+	}
+	/* The name of the member is set by the preceding GNU long name
+	 */
+	if( memory_compare(
+	     member_name,
+	     "Prefetch/LONG.EXE-1.pf",
+	     23 ) != 0 )
+	{
+		return( -1 );
+	}
+	if( ( member_data_size != 6 )
+	 || ( memory_compare(
+	       member_data,
+	       "SCCA\x11\x00",
+	       6 ) != 0 ) )
+	{
+		return( -1 );
+	}
+	number_of_members = (int *) callback_arguments;
+
+	*number_of_members += 1;
+
+	return( 1 );
+}
+
+/* Tests the archive_handle_tar_append_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_archive_handle_tar_append_data(
+     void )
+{
+	uint8_t tar_data[ 7 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ];
+
+	archive_handle_t *archive_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	size_t data_size                 = 0;
+	int number_of_members            = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 tar_data,
+	 0,
+	 7 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE );
+
+	/* A GNU long name that applies to the next member
+	 */
+	scca_test_tools_archive_handle_set_tar_header(
+	 tar_data,
+	 "././@LongLink",
+	 13,
+	 22,
+	 (uint8_t) 'L' );
+
+	memory_copy(
+	 &( tar_data[ ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] ),
+	 "Prefetch/LONG.EXE-1.pf",
+	 22 );
+
+	scca_test_tools_archive_handle_set_tar_header(
+	 &( tar_data[ 2 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] ),
+	 "Prefetch/LONG.EXE-1",
+	 19,
+	 6,
+	 (uint8_t) '0' );
+
+	memory_copy(
+	 &( tar_data[ 3 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] ),
+	 "SCCA\x11\x00",
+	 6 );
+
+	/* A member without the prefetch extension is skipped
+	 */
+	scca_test_tools_archive_handle_set_tar_header(
+	 &( tar_data[ 4 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] ),
+	 "Layout.ini",
+	 10,
+	 6,
+	 (uint8_t) '0' );
+
+	memory_copy(
+	 &( tar_data[ 5 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] ),
+	 "layout",
+	 6 );
+
+	result = archive_handle_initialize(
+	          &archive_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "archive_handle",
+	 archive_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	archive_handle->member_callback_function  = &scca_test_tools_archive_handle_member_callback;
+	archive_handle->member_callback_arguments = (void *) &number_of_members;
+
+	/* Test regular cases
+	 * The data is appended in parts that do not align with the blocks
+	 */
+	while( data_offset < ( 7 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ) )
+	{
+		data_size = ( 7 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ) - data_offset;
+
+		if( data_size > 100 )
+		{
+			data_size = 100;
+		}
+		result = archive_handle_tar_append_data(
+		          &( tar_data[ data_offset ] ),
+		          data_size,
+		          archive_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		data_offset += data_size;
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_members",
+	 number_of_members,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "archive_handle->number_of_members",
+	 archive_handle->number_of_members,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "archive_handle->tar_end_of_archive",
+	 archive_handle->tar_end_of_archive,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	archive_handle->tar_end_of_archive = 0;
+
+	tar_data[ 2 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] = (uint8_t) 'X';
+
+	result = archive_handle_tar_append_data(
+	          &( tar_data[ 2 * ARCHIVE_HANDLE_TAR_BLOCK_SIZE ] ),
+	          ARCHIVE_HANDLE_TAR_BLOCK_SIZE,
+	          archive_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = archive_handle_tar_append_data(
+	          NULL,
+	          ARCHIVE_HANDLE_TAR_BLOCK_SIZE,
+	          archive_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = archive_handle_tar_append_data(
+	          tar_data,
+	          ARCHIVE_HANDLE_TAR_BLOCK_SIZE,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = archive_handle_free(
+	          &archive_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "archive_handle",
+	 archive_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( archive_handle != NULL )
+	{
+		archive_handle_free(
+		 &archive_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the deflate_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_archive_handle_calculate_crc32(
+     void )
+{
+	uint32_t crc32 = 0;
+
+	/* Test regular cases
+	 */
+	crc32 = deflate_calculate_crc32(
+	         0,
+	         (uint8_t *) "123456789",
+	         9 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	/* The CRC-32 can be calculated over multiple parts
+	 */
+	crc32 = deflate_calculate_crc32(
+	         0,
+	         (uint8_t *) "1234",
+	         4 );
+
+	crc32 = deflate_calculate_crc32(
+	         crc32,
+	         (uint8_t *) "56789",
+	         5 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "archive_handle_initialize",
+	 scca_test_tools_archive_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "archive_handle_free",
+	 scca_test_tools_archive_handle_free );
+
+	SCCA_TEST_RUN(
+	 "archive_handle_name_has_prefetch_extension",
+	 scca_test_tools_archive_handle_name_has_prefetch_extension );
+
+	SCCA_TEST_RUN(
+	 "archive_handle_tar_read_number",
+	 scca_test_tools_archive_handle_tar_read_number );
+
+	SCCA_TEST_RUN(
+	 "archive_handle_tar_append_data",
+	 scca_test_tools_archive_handle_tar_append_data );
+
+	SCCA_TEST_RUN(
+	 "deflate_calculate_crc32",
+	 scca_test_tools_archive_handle_calculate_crc32 );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
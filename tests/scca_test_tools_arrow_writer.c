@@ -0,0 +1,822 @@
+/*
+ * Tools Arrow writer functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/arrow_writer.h"
+#include "../sccatools/output_buffer.h"
+
+/* Tests the arrow_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_arrow_writer_initialize(
+     void )
+{
+	arrow_writer_t *arrow_writer = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          stdout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_free(
+	          &arrow_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = arrow_writer_initialize(
+	          NULL,
+	          stdout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arrow_writer = (arrow_writer_t *) 0x12345678UL;
+
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          stdout,
+	          &error );
+
+	arrow_writer = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the arrow_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_arrow_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = arrow_writer_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the arrow_writer_append_string_value function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_arrow_writer_append_string_value(
+     void )
+{
+	arrow_writer_t *arrow_writer = NULL;
+	libcerror_error_t *error     = NULL;
+	uint32_t dictionary_index    = 0;
+	int result                   = 0;
+	int value_index              = 0;
+
+	/* Initialize test
+	 */
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          stdout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          "filename",
+	          ARROW_WRITER_COLUMN_TYPE_STRING,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = arrow_writer_append_string_value(
+	          arrow_writer,
+	          0,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_string_value(
+	          arrow_writer,
+	          0,
+	          (uint8_t *) "KERNEL32.DLL",
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_string_value(
+	          arrow_writer,
+	          0,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Equal strings share a dictionary entry
+	 */
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_dictionary_entries",
+	 arrow_writer->columns[ 0 ].number_of_dictionary_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "values->data_offset",
+	 arrow_writer->columns[ 0 ].values->data_offset,
+	 (size_t) 12 );
+
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( arrow_writer->columns[ 0 ].values->data[ value_index * 4 ] ),
+		 dictionary_index );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT32(
+		 "dictionary_index",
+		 dictionary_index,
+		 (uint32_t) ( value_index % 2 ) );
+	}
+	/* Test error cases
+	 */
+	result = arrow_writer_append_string_value(
+	          NULL,
+	          0,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_append_string_value(
+	          arrow_writer,
+	          1,
+	          (uint8_t *) "NTDLL.DLL",
+	          9,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = arrow_writer_append_uint32_value(
+	          arrow_writer,
+	          0,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = arrow_writer_free(
+	          &arrow_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "arrow_writer",
+	 arrow_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the arrow_writer_append_encoded_rows function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_arrow_writer_append_encoded_rows(
+     void )
+{
+	uint8_t end_of_stream[ 8 ];
+	uint8_t message_prefix[ 8 ];
+
+	arrow_writer_t *arrow_writer   = NULL;
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	FILE *stream                   = NULL;
+	uint64_t value_64bit           = 0;
+	uint32_t value_32bit           = 0;
+	long stream_size               = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = arrow_writer_initialize(
+	          &arrow_writer,
+	          stream,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          "source",
+	          ARROW_WRITER_COLUMN_TYPE_STRING,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          "run_count",
+	          ARROW_WRITER_COLUMN_TYPE_UINT32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_append_column(
+	          arrow_writer,
+	          "last_run_time",
+	          ARROW_WRITER_COLUMN_TYPE_UINT64,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_encode_string(
+	          output_buffer,
+	          (uint8_t *) "CMD.EXE-087B4001.pf",
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_encode_uint32(
+	          output_buffer,
+	          5,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_encode_uint64(
+	          output_buffer,
+	          0x01d0a4b4c2b6e2f4UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = arrow_writer_append_encoded_rows(
+	          arrow_writer,
+	          output_buffer->data,
+	          output_buffer->data_offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 arrow_writer->number_of_rows,
+	 1 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 arrow_writer->columns[ 1 ].values->data,
+	 value_32bit );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 5 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 arrow_writer->columns[ 2 ].values->data,
+	 value_64bit );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x01d0a4b4c2b6e2f4UL );
+
+	result = arrow_writer_close(
+	          arrow_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_rows",
+	 arrow_writer->number_of_rows,
+	 0 );
+
+	/* The stream starts with the schema message and ends with the end of stream marker
+	 */
+	stream_size = ftell(
+	               stream );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "stream_size",
+	 (int) stream_size,
+	 16 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "stream_size % 8",
+	 (int) ( stream_size % 8 ),
+	 0 );
+
+	rewind(
+	 stream );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "fread",
+	 fread(
+	  message_prefix,
+	  1,
+	  8,
+	  stream ),
+	 (size_t) 8 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 message_prefix,
+	 value_32bit );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "continuation",
+	 value_32bit,
+	 (uint32_t) 0xffffffffUL );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( message_prefix[ 4 ] ),
+	 value_32bit );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_size % 8",
+	 value_32bit % 8,
+	 (uint32_t) 0 );
+
+	result = fseek(
+	          stream,
+	          stream_size - 8,
+	          SEEK_SET );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "fread",
+	 fread(
+	  end_of_stream,
+	  1,
+	  8,
+	  stream ),
+	 (size_t) 8 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 end_of_stream,
+	 value_64bit );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "end_of_stream",
+	 value_64bit,
+	 (uint64_t) 0x00000000ffffffffUL );
+
+	/* Test error cases
+	 */
+	result = arrow_writer_append_encoded_rows(
+	          NULL,
+	          output_buffer->data,
+	          output_buffer->data_offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a truncated row
+	 */
+	result = arrow_writer_append_encoded_rows(
+	          arrow_writer,
+	          output_buffer->data,
+	          output_buffer->data_offset - 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = arrow_writer_free(
+	          &arrow_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fclose(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( arrow_writer != NULL )
+	{
+		arrow_writer_free(
+		 &arrow_writer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		fclose(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "arrow_writer_initialize",
+	 scca_test_tools_arrow_writer_initialize )
+
+	SCCA_TEST_RUN(
+	 "arrow_writer_free",
+	 scca_test_tools_arrow_writer_free )
+
+	SCCA_TEST_RUN(
+	 "arrow_writer_append_string_value",
+	 scca_test_tools_arrow_writer_append_string_value )
+
+	SCCA_TEST_RUN(
+	 "arrow_writer_append_encoded_rows",
+	 scca_test_tools_arrow_writer_append_encoded_rows )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
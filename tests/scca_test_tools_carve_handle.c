@@ -0,0 +1,430 @@
+/*
+ * Tools carve_handle type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/carve_handle.h"
+
+/* Tests the carve_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_initialize(
+     void )
+{
+	carve_handle_t *carve_handle    = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = carve_handle_free(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = carve_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carve_handle = (carve_handle_t *) 0x12345678UL;
+
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          &error );
+
+	carve_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test carve_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = carve_handle_initialize(
+		          &carve_handle,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( carve_handle != NULL )
+			{
+				carve_handle_free(
+				 &carve_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "carve_handle",
+			 carve_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test carve_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = carve_handle_initialize(
+		          &carve_handle,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( carve_handle != NULL )
+			{
+				carve_handle_free(
+				 &carve_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "carve_handle",
+			 carve_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &carve_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the carve_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = carve_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the carve_handle_scan_callback function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_carve_handle_scan_callback(
+     void )
+{
+	carve_handle_t *carve_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = carve_handle_initialize(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	carve_handle->window_offset    = CARVE_HANDLE_WINDOW_SIZE;
+	carve_handle->window_data_size = CARVE_HANDLE_WINDOW_SIZE;
+
+	/* Test regular cases
+	 */
+	result = carve_handle_scan_callback(
+	          4096,
+	          LIBSCCA_FILE_TYPE_COMPRESSED_WINDOWS10,
+	          1000,
+	          (void *) carve_handle );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "carve_handle->number_of_results",
+	 carve_handle->number_of_results,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "carve_handle->results[ 0 ].offset",
+	 (int64_t) carve_handle->results[ 0 ].offset,
+	 (int64_t) CARVE_HANDLE_WINDOW_SIZE + 4096 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "carve_handle->results[ 0 ].data_size",
+	 carve_handle->results[ 0 ].data_size,
+	 (uint32_t) 1000 );
+
+	/* A file header in the overlap is not recorded
+	 */
+	result = carve_handle_scan_callback(
+	          CARVE_HANDLE_WINDOW_SIZE,
+	          LIBSCCA_FILE_TYPE_UNCOMPRESSED,
+	          84,
+	          (void *) carve_handle );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "carve_handle->number_of_results",
+	 carve_handle->number_of_results,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = carve_handle_scan_callback(
+	          0,
+	          LIBSCCA_FILE_TYPE_UNCOMPRESSED,
+	          84,
+	          NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = carve_handle_free(
+	          &carve_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "carve_handle",
+	 carve_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &carve_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "carve_handle_initialize",
+	 scca_test_tools_carve_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "carve_handle_free",
+	 scca_test_tools_carve_handle_free );
+
+	SCCA_TEST_RUN(
+	 "carve_handle_scan_callback",
+	 scca_test_tools_carve_handle_scan_callback );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1042 @@
+/*
+ * Tools daemon_handle type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/daemon_handle.h"
+#include "../sccatools/info_handle.h"
+
+#if defined( HAVE_DAEMON_SUPPORT )
+#include <sys/socket.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+#endif
+
+/* Tests the daemon_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_daemon_handle_initialize(
+     void )
+{
+	daemon_handle_t *daemon_handle  = NULL;
+	info_handle_t *info_handle      = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 5;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = daemon_handle_initialize(
+	          &daemon_handle,
+	          info_handle,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "daemon_handle",
+	 daemon_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "daemon_handle->number_of_workers",
+	 daemon_handle->number_of_workers,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "daemon_handle->output_format",
+	 daemon_handle->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_JSONL );
+
+	result = daemon_handle_free(
+	          &daemon_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "daemon_handle",
+	 daemon_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = daemon_handle_initialize(
+	          NULL,
+	          info_handle,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	daemon_handle = (daemon_handle_t *) 0x12345678UL;
+
+	result = daemon_handle_initialize(
+	          &daemon_handle,
+	          info_handle,
+	          1,
+	          &error );
+
+	daemon_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_handle_initialize(
+	          &daemon_handle,
+	          NULL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_handle_initialize(
+	          &daemon_handle,
+	          info_handle,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = daemon_handle_initialize(
+	          &daemon_handle,
+	          info_handle,
+	          DAEMON_HANDLE_MAXIMUM_NUMBER_OF_WORKERS + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test daemon_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = daemon_handle_initialize(
+		          &daemon_handle,
+		          info_handle,
+		          1,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( daemon_handle != NULL )
+			{
+				daemon_handle_free(
+				 &daemon_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "daemon_handle",
+			 daemon_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test daemon_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = daemon_handle_initialize(
+		          &daemon_handle,
+		          info_handle,
+		          1,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( daemon_handle != NULL )
+			{
+				daemon_handle_free(
+				 &daemon_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "daemon_handle",
+			 daemon_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( daemon_handle != NULL )
+	{
+		daemon_handle_free(
+		 &daemon_handle,
+		 NULL );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the daemon_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_daemon_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = daemon_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the daemon_handle_parse_output_format function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_daemon_handle_parse_output_format(
+     void )
+{
+	int output_format = 0;
+	int result        = 0;
+
+	/* Test regular cases
+	 */
+	result = daemon_handle_parse_output_format(
+	          "csv",
+	          3,
+	          &output_format );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "output_format",
+	 output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_CSV );
+
+	result = daemon_handle_parse_output_format(
+	          "snapshot",
+	          8,
+	          &output_format );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "output_format",
+	 output_format,
+	 DAEMON_HANDLE_OUTPUT_FORMAT_SNAPSHOT );
+
+	/* The arrow output format is a stream that cannot be split into records
+	 */
+	result = daemon_handle_parse_output_format(
+	          "arrow",
+	          5,
+	          &output_format );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = daemon_handle_parse_output_format(
+	          "jsonl2",
+	          6,
+	          &output_format );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = daemon_handle_parse_output_format(
+	          NULL,
+	          3,
+	          &output_format );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = daemon_handle_parse_output_format(
+	          "csv",
+	          3,
+	          NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the daemon_handle_parse_request function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_daemon_handle_parse_request(
+     void )
+{
+	const char *argument   = NULL;
+	size_t argument_length = 0;
+	int request_type       = 0;
+	int result             = 0;
+
+	/* Test regular cases
+	 */
+	result = daemon_handle_parse_request(
+	          "path C:\\Windows\\Prefetch\\CMD.EXE-4A81B364.pf",
+	          44,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "request_type",
+	 request_type,
+	 DAEMON_HANDLE_REQUEST_TYPE_PATH );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "argument_length",
+	 argument_length,
+	 (size_t) 39 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "argument[ 0 ]",
+	 (int) argument[ 0 ],
+	 (int) 'C' );
+
+	result = daemon_handle_parse_request(
+	          "data 1024",
+	          9,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "request_type",
+	 request_type,
+	 DAEMON_HANDLE_REQUEST_TYPE_DATA );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "argument_length",
+	 argument_length,
+	 (size_t) 4 );
+
+	result = daemon_handle_parse_request(
+	          "format jsonl",
+	          12,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "request_type",
+	 request_type,
+	 DAEMON_HANDLE_REQUEST_TYPE_FORMAT );
+
+	result = daemon_handle_parse_request(
+	          "metrics",
+	          7,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "request_type",
+	 request_type,
+	 DAEMON_HANDLE_REQUEST_TYPE_METRICS );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "argument",
+	 argument );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "argument_length",
+	 argument_length,
+	 (size_t) 0 );
+
+	/* A request without an argument or with an unknown keyword is not valid
+	 */
+	result = daemon_handle_parse_request(
+	          "path ",
+	          5,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = daemon_handle_parse_request(
+	          "path",
+	          4,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = daemon_handle_parse_request(
+	          "metrics all",
+	          11,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = daemon_handle_parse_request(
+	          "open file.pf",
+	          12,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = daemon_handle_parse_request(
+	          NULL,
+	          9,
+	          &request_type,
+	          &argument,
+	          &argument_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the daemon_handle_parse_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_daemon_handle_parse_data_size(
+     void )
+{
+	size_t data_size = 0;
+	int result       = 0;
+
+	/* Test regular cases
+	 */
+	result = daemon_handle_parse_data_size(
+	          "65536",
+	          5,
+	          &data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 65536 );
+
+	result = daemon_handle_parse_data_size(
+	          "67108865",
+	          8,
+	          &data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = daemon_handle_parse_data_size(
+	          "12a",
+	          3,
+	          &data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = daemon_handle_parse_data_size(
+	          "",
+	          0,
+	          &data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = daemon_handle_parse_data_size(
+	          NULL,
+	          5,
+	          &data_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( HAVE_DAEMON_SUPPORT )
+
+/* Tests the daemon_worker_serve_connection function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_daemon_worker_serve_connection(
+     void )
+{
+	char response[ 256 ];
+
+	const char *expected_response   = "ok 0\nerror unsupported format\nerror unable to open data\nerror invalid request\n";
+	const char *requests            = "format csv\r\nformat arrow\ndata 4\nABCDbogus\npath ignored.pf\n";
+	daemon_connection_t *connection = NULL;
+	daemon_handle_t *daemon_handle  = NULL;
+	info_handle_t *info_handle      = NULL;
+	libcerror_error_t *error        = NULL;
+	size_t response_size            = 0;
+	ssize_t read_count              = 0;
+	ssize_t write_count             = 0;
+	int socket_descriptors[ 2 ]     = { -1, -1 };
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = socketpair(
+	          AF_UNIX,
+	          SOCK_STREAM,
+	          0,
+	          socket_descriptors );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_handle_initialize(
+	          &daemon_handle,
+	          info_handle,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = daemon_connection_initialize(
+	          &connection,
+	          socket_descriptors[ 0 ],
+	          daemon_handle->output_format,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	socket_descriptors[ 0 ] = -1;
+
+	write_count = write(
+	               socket_descriptors[ 1 ],
+	               requests,
+	               narrow_string_length(
+	                requests ) );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) narrow_string_length( requests ) );
+
+	shutdown(
+	 socket_descriptors[ 1 ],
+	 SHUT_WR );
+
+	/* Test regular cases
+	 * The invalid request ends the connection, hence the last request is not served
+	 */
+	result = daemon_worker_serve_connection(
+	          daemon_handle->workers[ 0 ],
+	          connection,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "connection->output_format",
+	 connection->output_format,
+	 INFO_HANDLE_OUTPUT_FORMAT_CSV );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_failed_requests",
+	 daemon_handle->workers[ 0 ]->number_of_failed_requests,
+	 (uint64_t) 1 );
+
+	result = daemon_connection_free(
+	          &connection,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		read_count = read(
+		              socket_descriptors[ 1 ],
+		              &( response[ response_size ] ),
+		              255 - response_size );
+
+		if( read_count > 0 )
+		{
+			response_size += (size_t) read_count;
+		}
+	}
+	while( ( read_count > 0 )
+	    && ( response_size < 255 ) );
+
+	response[ response_size ] = 0;
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "response_size",
+	 response_size,
+	 narrow_string_length( expected_response ) );
+
+	result = narrow_string_compare(
+	          response,
+	          expected_response,
+	          response_size );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = daemon_worker_serve_connection(
+	          NULL,
+	          connection,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	close(
+	 socket_descriptors[ 1 ] );
+
+	result = daemon_handle_free(
+	          &daemon_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( connection != NULL )
+	{
+		daemon_connection_free(
+		 &connection,
+		 NULL );
+	}
+	if( daemon_handle != NULL )
+	{
+		daemon_handle_free(
+		 &daemon_handle,
+		 NULL );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	if( socket_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 0 ] );
+	}
+	if( socket_descriptors[ 1 ] != -1 )
+	{
+		close(
+		 socket_descriptors[ 1 ] );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_DAEMON_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "daemon_handle_initialize",
+	 scca_test_tools_daemon_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "daemon_handle_free",
+	 scca_test_tools_daemon_handle_free );
+
+	SCCA_TEST_RUN(
+	 "daemon_handle_parse_output_format",
+	 scca_test_tools_daemon_handle_parse_output_format );
+
+	SCCA_TEST_RUN(
+	 "daemon_handle_parse_request",
+	 scca_test_tools_daemon_handle_parse_request );
+
+	SCCA_TEST_RUN(
+	 "daemon_handle_parse_data_size",
+	 scca_test_tools_daemon_handle_parse_data_size );
+
+#if defined( HAVE_DAEMON_SUPPORT )
+
+	SCCA_TEST_RUN(
+	 "daemon_worker_serve_connection",
+	 scca_test_tools_daemon_worker_serve_connection );
+
+#endif /* defined( HAVE_DAEMON_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,672 @@
+/*
+ * Tools filter_expression type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/filter_expression.h"
+
+/* Tests the filter_expression_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_filter_expression_initialize(
+     void )
+{
+	filter_expression_t *filter_expression = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = filter_expression_initialize(
+	          &filter_expression,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filter_expression",
+	 filter_expression );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = filter_expression_free(
+	          &filter_expression,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "filter_expression",
+	 filter_expression );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = filter_expression_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter_expression = (filter_expression_t *) 0x12345678UL;
+
+	result = filter_expression_initialize(
+	          &filter_expression,
+	          &error );
+
+	filter_expression = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter_expression != NULL )
+	{
+		filter_expression_free(
+		 &filter_expression,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the filter_expression_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_filter_expression_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = filter_expression_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the filter_expression_parse_date function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_filter_expression_parse_date(
+     void )
+{
+	uint64_t filetime = 0;
+	int result        = 0;
+
+	/* Test regular cases
+	 */
+	result = filter_expression_parse_date(
+	          (uint8_t *) "1601-01-01",
+	          10,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 0 );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "2024-01-01",
+	          10,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 133485408000000000UL );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "2024-02-29T12:30:15",
+	          19,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 133536834150000000UL );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "1970-01-01T00:01",
+	          16,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 116444736600000000UL );
+
+	/* Test error cases
+	 */
+	result = filter_expression_parse_date(
+	          (uint8_t *) "2023-02-29",
+	          10,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "2024-13-01",
+	          10,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "1600-12-31",
+	          10,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "2024-01-01T12",
+	          13,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = filter_expression_parse_date(
+	          (uint8_t *) "2024-1-01",
+	          9,
+	          &filetime );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the filter_expression_compile function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_filter_expression_compile(
+     void )
+{
+	const system_character_t *invalid_expressions[ 12 ] = {
+		_SYSTEM_STRING( "" ),
+		_SYSTEM_STRING( "run_count >" ),
+		_SYSTEM_STRING( "run_count > 1 run_count" ),
+		_SYSTEM_STRING( "(run_count > 1" ),
+		_SYSTEM_STRING( "bogus > 1" ),
+		_SYSTEM_STRING( "run_count ~ \"x\"" ),
+		_SYSTEM_STRING( "filename ~ \"x\"" ),
+		_SYSTEM_STRING( "any(filename ~ \"\")" ),
+		_SYSTEM_STRING( "any(filename != \"x\")" ),
+		_SYSTEM_STRING( "format_version > 2024-01-01" ),
+		_SYSTEM_STRING( "executable_filename == \"x\\y\"" ),
+		_SYSTEM_STRING( "run_count > 99999999999999999999" ) };
+
+	filter_expression_node_t *node         = NULL;
+	filter_expression_t *filter_expression = NULL;
+	libcerror_error_t *error               = NULL;
+	int expression_index                   = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = filter_expression_initialize(
+	          &filter_expression,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "filter_expression",
+	 filter_expression );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = filter_expression_compile(
+	          filter_expression,
+	          _SYSTEM_STRING( "any(filename ~ \"\\\\TEMP\\\\\") and run_count > 0x0a and last_run_time > 2024-01-01" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "filter_expression->number_of_nodes",
+	 filter_expression->number_of_nodes,
+	 5 );
+
+	/* The filename match is the most expensive term and is evaluated last
+	 */
+	node = &( filter_expression->nodes[ filter_expression->root_node_index ] );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "node->type",
+	 node->type,
+	 FILTER_EXPRESSION_NODE_TYPE_AND );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "first node->type",
+	 filter_expression->nodes[ node->first_node_index ].type,
+	 FILTER_EXPRESSION_NODE_TYPE_COMPARE_INTEGER );
+
+	node = &( filter_expression->nodes[ node->second_node_index ] );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "node->type",
+	 node->type,
+	 FILTER_EXPRESSION_NODE_TYPE_AND );
+
+	node = &( filter_expression->nodes[ node->second_node_index ] );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "node->type",
+	 node->type,
+	 FILTER_EXPRESSION_NODE_TYPE_ANY_FILENAME );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "node->string_length",
+	 node->string_length,
+	 (size_t) 6 );
+
+	result = narrow_string_compare(
+	          (char *) &( filter_expression->string[ node->string_offset ] ),
+	          "\\TEMP\\",
+	          6 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = filter_expression_compile(
+	          filter_expression,
+	          _SYSTEM_STRING( "run_count > 1" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = filter_expression_free(
+	          &filter_expression,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( expression_index = 0;
+	     expression_index < 12;
+	     expression_index++ )
+	{
+		result = filter_expression_initialize(
+		          &filter_expression,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = filter_expression_compile(
+		          filter_expression,
+		          invalid_expressions[ expression_index ],
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		result = filter_expression_free(
+		          &filter_expression,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = filter_expression_compile(
+	          NULL,
+	          _SYSTEM_STRING( "run_count > 1" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter_expression != NULL )
+	{
+		filter_expression_free(
+		 &filter_expression,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the filter_expression_compare_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_filter_expression_compare_strings(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) "cmd.exe",
+	          7,
+	          FILTER_EXPRESSION_OPERATOR_EQUAL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) "cmd",
+	          3,
+	          FILTER_EXPRESSION_OPERATOR_EQUAL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) "cmd",
+	          3,
+	          FILTER_EXPRESSION_OPERATOR_NOT_EQUAL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) "cmd",
+	          3,
+	          FILTER_EXPRESSION_OPERATOR_STARTS_WITH );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) ".exe",
+	          4,
+	          FILTER_EXPRESSION_OPERATOR_ENDS_WITH );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) "d.e",
+	          3,
+	          FILTER_EXPRESSION_OPERATOR_CONTAINS );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          (uint8_t *) "exe.",
+	          4,
+	          FILTER_EXPRESSION_OPERATOR_CONTAINS );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = filter_expression_compare_strings(
+	          (uint8_t *) "CMD",
+	          3,
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          FILTER_EXPRESSION_OPERATOR_CONTAINS );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "filter_expression_initialize",
+	 scca_test_tools_filter_expression_initialize );
+
+	SCCA_TEST_RUN(
+	 "filter_expression_free",
+	 scca_test_tools_filter_expression_free );
+
+	SCCA_TEST_RUN(
+	 "filter_expression_parse_date",
+	 scca_test_tools_filter_expression_parse_date );
+
+	SCCA_TEST_RUN(
+	 "filter_expression_compile",
+	 scca_test_tools_filter_expression_compile );
+
+	SCCA_TEST_RUN(
+	 "filter_expression_compare_strings",
+	 scca_test_tools_filter_expression_compare_strings );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
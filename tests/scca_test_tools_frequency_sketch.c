@@ -0,0 +1,570 @@
+/*
+ * Tools frequency_sketch type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/frequency_sketch.h"
+
+/* Formats a test key
+ * Returns the key length
+ */
+size_t scca_test_tools_frequency_sketch_format_key(
+        char *key,
+        int key_index )
+{
+	size_t key_length = 0;
+	int divisor       = 1;
+
+	key[ key_length++ ] = 'F';
+	key[ key_length++ ] = 'I';
+	key[ key_length++ ] = 'L';
+	key[ key_length++ ] = 'E';
+
+	while( ( key_index / divisor ) >= 10 )
+	{
+		divisor *= 10;
+	}
+	while( divisor > 0 )
+	{
+		key[ key_length++ ] = (char) ( '0' + ( ( key_index / divisor ) % 10 ) );
+
+		divisor /= 10;
+	}
+	key[ key_length ] = 0;
+
+	return( key_length );
+}
+
+/* Tests the frequency_sketch_natural_logarithm function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_frequency_sketch_natural_logarithm(
+     void )
+{
+	double result = 0.0;
+
+	result = frequency_sketch_natural_logarithm(
+	          1.0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 (int) ( result * 1000000.0 ),
+	 0 );
+
+	result = frequency_sketch_natural_logarithm(
+	          10.0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 (int) ( result * 1000000.0 ),
+	 2302585 );
+
+	result = frequency_sketch_natural_logarithm(
+	          0.5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 (int) ( result * 1000000.0 ),
+	 -693147 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the frequency_sketch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_frequency_sketch_initialize(
+     void )
+{
+	frequency_sketch_t *frequency_sketch = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = frequency_sketch_initialize(
+	          &frequency_sketch,
+	          FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = frequency_sketch_free(
+	          &frequency_sketch,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "frequency_sketch",
+	 frequency_sketch );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = frequency_sketch_initialize(
+	          NULL,
+	          FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	frequency_sketch = (frequency_sketch_t *) 0x12345678UL;
+
+	result = frequency_sketch_initialize(
+	          &frequency_sketch,
+	          FREQUENCY_SKETCH_DEFAULT_NUMBER_OF_ENTRIES,
+	          &error );
+
+	frequency_sketch = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = frequency_sketch_initialize(
+	          &frequency_sketch,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = frequency_sketch_initialize(
+	          &frequency_sketch,
+	          FREQUENCY_SKETCH_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frequency_sketch != NULL )
+	{
+		frequency_sketch_free(
+		 &frequency_sketch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the frequency_sketch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_frequency_sketch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = frequency_sketch_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the frequency_sketch_append function
+ * Key i of the first 1000 keys is appended 1000 / ( i + 1 ) times
+ * and 20000 keys are appended once, which are about 27500 observations
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_frequency_sketch_append(
+     void )
+{
+	char key[ 32 ];
+
+	frequency_sketch_entry_t *entry      = NULL;
+	frequency_sketch_t *frequency_sketch = NULL;
+	libcerror_error_t *error             = NULL;
+	uint64_t estimate                    = 0;
+	uint64_t number_of_distinct_keys     = 0;
+	size_t key_length                    = 0;
+	int entry_index                      = 0;
+	int key_index                        = 0;
+	int repeat_index                     = 0;
+	int result                           = 0;
+
+	result = frequency_sketch_initialize(
+	          &frequency_sketch,
+	          50,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( key_index = 0;
+	     key_index < 21000;
+	     key_index++ )
+	{
+		key_length = scca_test_tools_frequency_sketch_format_key(
+		              key,
+		              key_index );
+
+		for( repeat_index = 0;
+		     ( repeat_index == 0 ) || ( ( key_index < 1000 ) && ( repeat_index < ( 1000 / ( key_index + 1 ) ) ) );
+		     repeat_index++ )
+		{
+			result = frequency_sketch_append(
+			          frequency_sketch,
+			          (uint8_t *) key,
+			          key_length,
+			          &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* The count-min sketch never underestimates
+	 */
+	key_length = scca_test_tools_frequency_sketch_format_key(
+	              key,
+	              0 );
+
+	estimate = frequency_sketch_count_min_get_estimate(
+	            frequency_sketch,
+	            frequency_sketch_calculate_hash(
+	             (uint8_t *) key,
+	             key_length ) );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "estimate",
+	 estimate,
+	 (uint64_t) 999 );
+
+	/* The HyperLogLog estimate is within a few percent of the actual number of distinct keys
+	 */
+	result = frequency_sketch_get_number_of_distinct_keys(
+	          frequency_sketch,
+	          &number_of_distinct_keys,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "number_of_distinct_keys",
+	 number_of_distinct_keys,
+	 (uint64_t) 19999 );
+
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_distinct_keys",
+	 number_of_distinct_keys,
+	 (uint64_t) 22001 );
+
+	/* The most common key appears more than the number of observations divided
+	 * by the number of heavy hitters, hence it is guaranteed to be tracked
+	 */
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 frequency_sketch->heavy_hitters->number_of_entries,
+	 50 );
+
+	result = frequency_sketch_table_find_entry(
+	          frequency_sketch->heavy_hitters,
+	          frequency_sketch_calculate_hash(
+	           (uint8_t *) key,
+	           key_length ),
+	          (uint8_t *) key,
+	          key_length,
+	          &entry_index );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	entry = &( frequency_sketch->heavy_hitters->entries[ entry_index ] );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "entry->count",
+	 entry->count,
+	 (uint64_t) 999 );
+
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "entry->count",
+	 entry->count - entry->error,
+	 (uint64_t) 1001 );
+
+	/* The rare candidates only contain keys that were appended once
+	 */
+	frequency_sketch_rare_candidates_refresh(
+	 frequency_sketch );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_entries",
+	 frequency_sketch->rare_candidates->number_of_entries,
+	 10 );
+
+	for( entry_index = 0;
+	     entry_index < frequency_sketch->rare_candidates->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( frequency_sketch->rare_candidates->entries[ entry_index ] );
+
+		SCCA_TEST_ASSERT_EQUAL_UINT64(
+		 "entry->count",
+		 entry->count,
+		 (uint64_t) 1 );
+	}
+	/* Test error cases
+	 */
+	result = frequency_sketch_append(
+	          NULL,
+	          (uint8_t *) key,
+	          key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = frequency_sketch_append(
+	          frequency_sketch,
+	          NULL,
+	          key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = frequency_sketch_append(
+	          frequency_sketch,
+	          (uint8_t *) key,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = frequency_sketch_free(
+	          &frequency_sketch,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( frequency_sketch != NULL )
+	{
+		frequency_sketch_free(
+		 &frequency_sketch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "frequency_sketch_natural_logarithm",
+	 scca_test_tools_frequency_sketch_natural_logarithm );
+
+	SCCA_TEST_RUN(
+	 "frequency_sketch_initialize",
+	 scca_test_tools_frequency_sketch_initialize );
+
+	SCCA_TEST_RUN(
+	 "frequency_sketch_free",
+	 scca_test_tools_frequency_sketch_free );
+
+	SCCA_TEST_RUN(
+	 "frequency_sketch_append",
+	 scca_test_tools_frequency_sketch_append );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
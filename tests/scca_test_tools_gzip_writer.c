@@ -0,0 +1,835 @@
+/*
+ * Tools gzip writer functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/gzip_writer.h"
+
+/* Tests the gzip_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_gzip_writer_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	gzip_writer_t *gzip_writer = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = gzip_writer_initialize(
+	          &gzip_writer,
+	          stdout,
+	          GZIP_WRITER_DEFAULT_COMPRESSION_LEVEL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "gzip_writer",
+	 gzip_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_writer_free(
+	          &gzip_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "gzip_writer",
+	 gzip_writer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = gzip_writer_initialize(
+	          NULL,
+	          stdout,
+	          GZIP_WRITER_DEFAULT_COMPRESSION_LEVEL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	gzip_writer = (gzip_writer_t *) 0x12345678UL;
+
+	result = gzip_writer_initialize(
+	          &gzip_writer,
+	          stdout,
+	          GZIP_WRITER_DEFAULT_COMPRESSION_LEVEL,
+	          1,
+	          &error );
+
+	gzip_writer = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_writer_initialize(
+	          &gzip_writer,
+	          NULL,
+	          GZIP_WRITER_DEFAULT_COMPRESSION_LEVEL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_writer_initialize(
+	          &gzip_writer,
+	          stdout,
+	          10,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_writer_initialize(
+	          &gzip_writer,
+	          stdout,
+	          GZIP_WRITER_DEFAULT_COMPRESSION_LEVEL,
+	          GZIP_WRITER_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( gzip_writer != NULL )
+	{
+		gzip_writer_free(
+		 &gzip_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_gzip_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = gzip_writer_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_writer_build_code_sizes and gzip_writer_build_codes functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_gzip_writer_build_codes(
+     void )
+{
+	uint32_t frequencies[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint8_t code_sizes[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+	uint16_t codes[ GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS ];
+
+	libcerror_error_t *error  = NULL;
+	uint32_t kraft_sum        = 0;
+	uint16_t symbol           = 0;
+	int number_of_code_sizes  = 0;
+	int result                = 0;
+
+	/* Test regular cases with frequencies that would exceed the maximum code size
+	 */
+	frequencies[ 0 ] = 1;
+	frequencies[ 1 ] = 1;
+
+	for( symbol = 2;
+	     symbol < GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS;
+	     symbol++ )
+	{
+		if( symbol < 32 )
+		{
+			frequencies[ symbol ] = frequencies[ symbol - 1 ] + frequencies[ symbol - 2 ];
+		}
+		else
+		{
+			frequencies[ symbol ] = 0;
+		}
+	}
+	result = gzip_writer_build_code_sizes(
+	          frequencies,
+	          GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS,
+	          GZIP_WRITER_MAXIMUM_CODE_SIZE,
+	          code_sizes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( symbol = 0;
+	     symbol < GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS;
+	     symbol++ )
+	{
+		SCCA_TEST_ASSERT_LESS_THAN_INT(
+		 "code_sizes[ symbol ]",
+		 (int) code_sizes[ symbol ],
+		 GZIP_WRITER_MAXIMUM_CODE_SIZE + 1 );
+
+		if( symbol < 32 )
+		{
+			SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+			 "code_sizes[ symbol ]",
+			 (int) code_sizes[ symbol ],
+			 0 );
+
+			kraft_sum += (uint32_t) 1 << ( GZIP_WRITER_MAXIMUM_CODE_SIZE - code_sizes[ symbol ] );
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "code_sizes[ symbol ]",
+			 (int) code_sizes[ symbol ],
+			 0 );
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "kraft_sum",
+	 kraft_sum,
+	 (uint32_t) 1 << GZIP_WRITER_MAXIMUM_CODE_SIZE );
+
+	result = gzip_writer_build_codes(
+	          code_sizes,
+	          GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS,
+	          codes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with a single used symbol
+	 */
+	memory_set(
+	 frequencies,
+	 0,
+	 sizeof( uint32_t ) * GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS );
+
+	frequencies[ 5 ] = 100;
+
+	result = gzip_writer_build_code_sizes(
+	          frequencies,
+	          GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS,
+	          GZIP_WRITER_MAXIMUM_CODE_SIZE,
+	          code_sizes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "code_sizes[ 5 ]",
+	 (int) code_sizes[ 5 ],
+	 1 );
+
+	for( symbol = 0;
+	     symbol < GZIP_WRITER_NUMBER_OF_DISTANCE_SYMBOLS;
+	     symbol++ )
+	{
+		if( code_sizes[ symbol ] != 0 )
+		{
+			number_of_code_sizes++;
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_code_sizes",
+	 number_of_code_sizes,
+	 2 );
+
+	/* Test regular cases with canonical codes from RFC 1951 section 3.2.2
+	 */
+	code_sizes[ 0 ] = 3;
+	code_sizes[ 1 ] = 3;
+	code_sizes[ 2 ] = 3;
+	code_sizes[ 3 ] = 3;
+	code_sizes[ 4 ] = 3;
+	code_sizes[ 5 ] = 2;
+	code_sizes[ 6 ] = 4;
+	code_sizes[ 7 ] = 4;
+
+	result = gzip_writer_build_codes(
+	          code_sizes,
+	          8,
+	          codes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The codes are stored bit reversed, F = 00, A = 010 and H = 1111
+	 */
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "codes[ 5 ]",
+	 codes[ 5 ],
+	 (uint16_t) 0x0000 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "codes[ 0 ]",
+	 codes[ 0 ],
+	 (uint16_t) 0x0002 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "codes[ 4 ]",
+	 codes[ 4 ],
+	 (uint16_t) 0x0003 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "codes[ 7 ]",
+	 codes[ 7 ],
+	 (uint16_t) 0x000f );
+
+	/* Test error cases
+	 */
+	result = gzip_writer_build_code_sizes(
+	          NULL,
+	          GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS,
+	          GZIP_WRITER_MAXIMUM_CODE_SIZE,
+	          code_sizes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_writer_build_codes(
+	          NULL,
+	          GZIP_WRITER_NUMBER_OF_LITERAL_SYMBOLS,
+	          codes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the gzip_writer_get_length_code and gzip_writer_get_distance_code functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_gzip_writer_get_codes(
+     void )
+{
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "length_code",
+	 (int) gzip_writer_get_length_code( 3 ),
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "length_code",
+	 (int) gzip_writer_get_length_code( 10 ),
+	 7 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "length_code",
+	 (int) gzip_writer_get_length_code( 12 ),
+	 8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "length_code",
+	 (int) gzip_writer_get_length_code( 257 ),
+	 27 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "length_code",
+	 (int) gzip_writer_get_length_code( 258 ),
+	 28 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "distance_code",
+	 (int) gzip_writer_get_distance_code( 1 ),
+	 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "distance_code",
+	 (int) gzip_writer_get_distance_code( 6 ),
+	 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "distance_code",
+	 (int) gzip_writer_get_distance_code( 24576 ),
+	 28 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "distance_code",
+	 (int) gzip_writer_get_distance_code( 32768 ),
+	 29 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the gzip_writer_calculate_crc32 function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_gzip_writer_calculate_crc32(
+     void )
+{
+	uint32_t crc32 = 0;
+
+	crc32 = gzip_writer_calculate_crc32(
+	         0,
+	         (uint8_t *) "123456789",
+	         9 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	/* Test calculating the checksum in multiple parts
+	 */
+	crc32 = gzip_writer_calculate_crc32(
+	         0,
+	         (uint8_t *) "1234",
+	         4 );
+
+	crc32 = gzip_writer_calculate_crc32(
+	         crc32,
+	         (uint8_t *) "56789",
+	         5 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0xcbf43926UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the gzip_writer_write and gzip_writer_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_gzip_writer_write(
+     void )
+{
+	uint8_t compressed_data[ 64 ];
+
+	libcerror_error_t *error     = NULL;
+	gzip_writer_t *gzip_writer   = NULL;
+	FILE *stream                 = NULL;
+	size_t compressed_data_size  = 0;
+	uint32_t crc32               = 0;
+	uint32_t uncompressed_size   = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Test regular cases with stored blocks
+	 */
+	result = gzip_writer_initialize(
+	          &gzip_writer,
+	          stream,
+	          0,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_writer_write(
+	          gzip_writer,
+	          (uint8_t *) "hello",
+	          5,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_writer_close(
+	          gzip_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = gzip_writer_free(
+	          &gzip_writer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	rewind(
+	 stream );
+
+	compressed_data_size = fread(
+	                        compressed_data,
+	                        1,
+	                        64,
+	                        stream );
+
+	/* The member consists of a 10-byte header, a 5-byte stored block header,
+	 * 5 bytes of data and an 8-byte trailer
+	 */
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 28 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 0 ]",
+	 compressed_data[ 0 ],
+	 (uint8_t) 0x1f );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 1 ]",
+	 compressed_data[ 1 ],
+	 (uint8_t) 0x8b );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 2 ]",
+	 compressed_data[ 2 ],
+	 (uint8_t) 0x08 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "compressed_data[ 10 ]",
+	 compressed_data[ 10 ],
+	 (uint8_t) 0x01 );
+
+	result = memory_compare(
+	          &( compressed_data[ 15 ] ),
+	          "hello",
+	          5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 20 ] ),
+	 crc32 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "crc32",
+	 crc32,
+	 (uint32_t) 0x3610a686UL );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( compressed_data[ 24 ] ),
+	 uncompressed_size );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "uncompressed_size",
+	 uncompressed_size,
+	 (uint32_t) 5 );
+
+	/* Test error cases
+	 */
+	result = gzip_writer_write(
+	          NULL,
+	          (uint8_t *) "hello",
+	          5,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = gzip_writer_close(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	fclose(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( gzip_writer != NULL )
+	{
+		gzip_writer_free(
+		 &gzip_writer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		fclose(
+		 stream );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "gzip_writer_initialize",
+	 scca_test_tools_gzip_writer_initialize )
+
+	SCCA_TEST_RUN(
+	 "gzip_writer_free",
+	 scca_test_tools_gzip_writer_free )
+
+	SCCA_TEST_RUN(
+	 "gzip_writer_build_codes",
+	 scca_test_tools_gzip_writer_build_codes )
+
+	SCCA_TEST_RUN(
+	 "gzip_writer_get_codes",
+	 scca_test_tools_gzip_writer_get_codes )
+
+	SCCA_TEST_RUN(
+	 "gzip_writer_calculate_crc32",
+	 scca_test_tools_gzip_writer_calculate_crc32 )
+
+	SCCA_TEST_RUN(
+	 "gzip_writer_write",
+	 scca_test_tools_gzip_writer_write )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1025 @@
+/*
+ * Tools image handle functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libbfio.h"
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/image_handle.h"
+#include "../sccatools/image_io_handle.h"
+
+/* The size of the test image, the last block of the image is not a full block
+ */
+#define SCCA_TEST_IMAGE_SIZE	( ( 4 * IMAGE_HANDLE_BLOCK_SIZE ) + 100 )
+
+/* Fills the test image data with a pattern that differs per offset
+ */
+void scca_test_tools_image_handle_fill_data(
+      uint8_t *data,
+      size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) ^ ( data_offset >> 8 ) );
+	}
+}
+
+/* Creates a file IO handle of the test image data
+ * Returns 1 if successful or -1 on error
+ */
+int scca_test_tools_image_handle_open_data(
+     image_handle_t *image_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( image_handle_open_file_io_handle(
+	         image_handle,
+	         *file_io_handle,
+	         error ) );
+}
+
+/* Tests the image_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_image_handle_initialize(
+     void )
+{
+	image_handle_t *image_handle = NULL;
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = image_handle_initialize(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "image_handle",
+	 image_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = image_handle_free(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "image_handle",
+	 image_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = image_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_handle != NULL )
+	{
+		image_handle_free(
+		 &image_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the image_handle_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_image_handle_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 256 ];
+
+	image_handle_t *image_handle     = NULL;
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *data                    = NULL;
+	uint64_t number_of_bytes_read    = 0;
+	uint64_t number_of_hits          = 0;
+	uint64_t number_of_misses        = 0;
+	uint64_t number_of_reads         = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    SCCA_TEST_IMAGE_SIZE );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	scca_test_tools_image_handle_fill_data(
+	 data,
+	 SCCA_TEST_IMAGE_SIZE );
+
+	result = image_handle_initialize(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scca_test_tools_image_handle_open_data(
+	          image_handle,
+	          &file_io_handle,
+	          data,
+	          SCCA_TEST_IMAGE_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read that reads ahead the missing blocks with a single read
+	 */
+	read_count = image_handle_read_buffer_at_offset(
+	              image_handle,
+	              10,
+	              buffer,
+	              16,
+	              ( 3 * IMAGE_HANDLE_BLOCK_SIZE ) - 26,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 10 ] ),
+	          16 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that spans cached blocks
+	 */
+	read_count = image_handle_read_buffer_at_offset(
+	              image_handle,
+	              ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) - 100,
+	              buffer,
+	              200,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 200 );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) - 100 ] ),
+	          200 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = image_handle_get_statistics(
+	          image_handle,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_bytes_read",
+	 number_of_bytes_read,
+	 (uint64_t) ( 3 * IMAGE_HANDLE_BLOCK_SIZE ) );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	/* Test a read of the last block that is not a full block
+	 */
+	read_count = image_handle_read_buffer_at_offset(
+	              image_handle,
+	              SCCA_TEST_IMAGE_SIZE - 50,
+	              buffer,
+	              200,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 50 );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ SCCA_TEST_IMAGE_SIZE - 50 ] ),
+	          50 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = image_handle_read_buffer_at_offset(
+	              image_handle,
+	              SCCA_TEST_IMAGE_SIZE,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	result = image_handle_get_statistics(
+	          image_handle,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	read_count = image_handle_read_buffer_at_offset(
+	              NULL,
+	              0,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = image_handle_read_buffer_at_offset(
+	              image_handle,
+	              -1,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = image_handle_close(
+	          image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = image_handle_free(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_handle != NULL )
+	{
+		image_handle_free(
+		 &image_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the image_io_handle_parse_extents_line function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_image_io_handle_parse_extents_line(
+     void )
+{
+	const char *invalid_lines[ 5 ] = {
+		"invalid 0+10 name",
+		"10 0 name",
+		"10 0+10",
+		"20 0+10 name",
+		"10 0+0 name" };
+
+	image_handle_t *image_handle       = NULL;
+	image_io_handle_t *image_io_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	const char *line                   = "100000 0x20000+65536,0x30000+65536,0+65536 \\Windows\\Prefetch\\CMD.EXE-4A81B364.pf";
+	size_t name_index                  = 0;
+	int line_index                     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = image_handle_initialize(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_io_handle_initialize(
+	          &image_io_handle,
+	          image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = image_io_handle_parse_extents_line(
+	          image_io_handle,
+	          line,
+	          narrow_string_length(
+	           line ),
+	          &name_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first two extents are adjacent in the image, hence they are merged
+	 */
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 image_io_handle->number_of_extents,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "extents[ 0 ].size",
+	 (uint64_t) image_io_handle->extents[ 0 ].size,
+	 (uint64_t) 131072 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "extents[ 1 ].image_offset",
+	 (uint64_t) image_io_handle->extents[ 1 ].image_offset,
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 (uint64_t) image_io_handle->data_size,
+	 (uint64_t) 100000 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "name_index",
+	 name_index,
+	 (size_t) 43 );
+
+	/* Test error cases
+	 */
+	for( line_index = 0;
+	     line_index < 5;
+	     line_index++ )
+	{
+		result = image_io_handle_free(
+		          &image_io_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = image_io_handle_initialize(
+		          &image_io_handle,
+		          image_handle,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = image_io_handle_parse_extents_line(
+		          image_io_handle,
+		          invalid_lines[ line_index ],
+		          narrow_string_length(
+		           invalid_lines[ line_index ] ),
+		          &name_index,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = image_io_handle_free(
+	          &image_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_handle_free(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( image_io_handle != NULL )
+	{
+		image_io_handle_free(
+		 &image_io_handle,
+		 NULL );
+	}
+	if( image_handle != NULL )
+	{
+		image_handle_free(
+		 &image_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading the data of extents with the image IO handle
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_image_io_handle_read(
+     void )
+{
+	image_handle_t *image_handle       = NULL;
+	image_io_handle_t *image_io_handle = NULL;
+	libbfio_handle_t *file_io_handle   = NULL;
+	libbfio_handle_t *image_file       = NULL;
+	libcerror_error_t *error           = NULL;
+	uint8_t *buffer                    = NULL;
+	uint8_t *data                      = NULL;
+	uint64_t number_of_bytes_read      = 0;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	uint64_t number_of_reads           = 0;
+	size64_t size                      = 0;
+	ssize_t read_count                 = 0;
+	off64_t offset                     = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    SCCA_TEST_IMAGE_SIZE );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	scca_test_tools_image_handle_fill_data(
+	 data,
+	 SCCA_TEST_IMAGE_SIZE );
+
+	buffer = (uint8_t *) memory_allocate(
+	                      SCCA_TEST_IMAGE_SIZE );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = image_handle_initialize(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scca_test_tools_image_handle_open_data(
+	          image_handle,
+	          &image_file,
+	          data,
+	          SCCA_TEST_IMAGE_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_io_handle_initialize(
+	          &image_io_handle,
+	          image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The file consists of the third and fourth block followed by the first 1000 bytes of the first block
+	 */
+	result = image_io_handle_append_extent(
+	          image_io_handle,
+	          2 * IMAGE_HANDLE_BLOCK_SIZE,
+	          2 * IMAGE_HANDLE_BLOCK_SIZE,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_io_handle_append_extent(
+	          image_io_handle,
+	          0,
+	          4096,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_io_handle_set_data_size(
+	          image_io_handle,
+	          ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) + 1000,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_io_handle_initialize_file_io_handle(
+	          &file_io_handle,
+	          &image_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "image_io_handle",
+	 image_io_handle );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) + 1000 );
+
+	/* Test regular cases
+	 */
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              SCCA_TEST_IMAGE_SIZE,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) + 1000 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 2 * IMAGE_HANDLE_BLOCK_SIZE ] ),
+	          2 * IMAGE_HANDLE_BLOCK_SIZE );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ 2 * IMAGE_HANDLE_BLOCK_SIZE ] ),
+	          data,
+	          1000 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read that spans the extents
+	 */
+	offset = libbfio_handle_seek_offset(
+	          file_io_handle,
+	          ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) - 10,
+	          SEEK_SET,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( 2 * IMAGE_HANDLE_BLOCK_SIZE ) - 10 );
+
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              20,
+	              &error );
+
+	SCCA_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 20 );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ ( 4 * IMAGE_HANDLE_BLOCK_SIZE ) - 10 ] ),
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( buffer[ 10 ] ),
+	          data,
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The adjacent blocks of the first extent are read with a single read
+	 */
+	result = image_handle_get_statistics(
+	          image_handle,
+	          &number_of_reads,
+	          &number_of_bytes_read,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 2 );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = image_handle_close(
+	          image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = image_handle_free(
+	          &image_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_free(
+	          &image_file,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 buffer );
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( image_io_handle != NULL )
+	{
+		image_io_handle_free(
+		 &image_io_handle,
+		 NULL );
+	}
+	if( image_handle != NULL )
+	{
+		image_handle_free(
+		 &image_handle,
+		 NULL );
+	}
+	if( image_file != NULL )
+	{
+		libbfio_handle_free(
+		 &image_file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "image_handle_initialize",
+	 scca_test_tools_image_handle_initialize )
+
+	SCCA_TEST_RUN(
+	 "image_handle_read_buffer_at_offset",
+	 scca_test_tools_image_handle_read_buffer_at_offset )
+
+	SCCA_TEST_RUN(
+	 "image_io_handle_parse_extents_line",
+	 scca_test_tools_image_io_handle_parse_extents_line )
+
+	SCCA_TEST_RUN(
+	 "image_io_handle_read",
+	 scca_test_tools_image_io_handle_read )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
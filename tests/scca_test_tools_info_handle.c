@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -268,6 +269,152 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the info_handle_set_match_type function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_info_handle_set_match_type(
+     void )
+{
+	info_handle_t *info_handle = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->match_type",
+	 info_handle->match_type,
+	 LIBSCCA_FILENAME_MATCH_TYPE_SUBSTRING );
+
+	/* Test regular cases
+	 */
+	result = info_handle_set_match_type(
+	          info_handle,
+	          _SYSTEM_STRING( "suffix" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->match_type",
+	 info_handle->match_type,
+	 LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX );
+
+	result = info_handle_set_match_type(
+	          info_handle,
+	          _SYSTEM_STRING( "bogus" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "info_handle->match_type",
+	 info_handle->match_type,
+	 LIBSCCA_FILENAME_MATCH_TYPE_SUFFIX );
+
+	/* Test error cases
+	 */
+	result = info_handle_set_match_type(
+	          NULL,
+	          _SYSTEM_STRING( "exact" ),
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = info_handle_set_match_type(
+	          info_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = info_handle_free(
+	          &info_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "info_handle",
+	 info_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +438,10 @@ int main(
 	 "info_handle_free",
 	 scca_test_tools_info_handle_free );
 
+	SCCA_TEST_RUN(
+	 "info_handle_set_match_type",
+	 scca_test_tools_info_handle_set_match_type );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,757 @@
+/*
+ * Tools journal_handle type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/journal_handle.h"
+
+/* Tests the journal_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_journal_handle_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	journal_handle_t *journal_handle  = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = journal_handle_initialize(
+	          &journal_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "journal_handle",
+	 journal_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = journal_handle_free(
+	          &journal_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "journal_handle",
+	 journal_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = journal_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	journal_handle = (journal_handle_t *) 0x12345678UL;
+
+	result = journal_handle_initialize(
+	          &journal_handle,
+	          &error );
+
+	journal_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test journal_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = journal_handle_initialize(
+		          &journal_handle,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( journal_handle != NULL )
+			{
+				journal_handle_free(
+				 &journal_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "journal_handle",
+			 journal_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test journal_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = journal_handle_initialize(
+		          &journal_handle,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( journal_handle != NULL )
+			{
+				journal_handle_free(
+				 &journal_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "journal_handle",
+			 journal_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( journal_handle != NULL )
+	{
+		journal_handle_free(
+		 &journal_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the journal_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_journal_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = journal_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the journal_handle_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_journal_handle_calculate_hash(
+     void )
+{
+	uint64_t hash = 0;
+
+	hash = journal_handle_calculate_hash(
+	        "/prefetch/CMD.EXE-4A81B364.pf",
+	        29,
+	        4096,
+	        1600000000 );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) hash,
+	 (int64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 journal_handle_calculate_hash(
+	  "/prefetch/CMD.EXE-4A81B364.pf",
+	  29,
+	  4096,
+	  1600000000 ),
+	 hash );
+
+	/* A file that was changed has a different hash
+	 */
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) journal_handle_calculate_hash(
+	            "/prefetch/CMD.EXE-4A81B364.pf",
+	            29,
+	            8192,
+	            1600000000 ),
+	 (int64_t) hash );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "hash",
+	 (int64_t) journal_handle_calculate_hash(
+	            "/prefetch/CMD.EXE-4A81B364.pf",
+	            29,
+	            4096,
+	            1600000001 ),
+	 (int64_t) hash );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the journal_handle_insert_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_journal_handle_insert_hash(
+     void )
+{
+	journal_handle_t *journal_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint64_t hash                    = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = journal_handle_initialize(
+	          &journal_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "journal_handle",
+	 journal_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = journal_handle_contains_hash(
+	          journal_handle,
+	          1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Insert more hashes than the initial number of slots so that the hash set is resized
+	 */
+	for( hash = 1;
+	     hash <= 3 * JOURNAL_HANDLE_INITIAL_NUMBER_OF_SLOTS;
+	     hash++ )
+	{
+		result = journal_handle_insert_hash(
+		          journal_handle,
+		          hash * 0x9e3779b97f4a7c15ULL,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "journal_handle->number_of_hashes",
+	 journal_handle->number_of_hashes,
+	 (size_t) ( 3 * JOURNAL_HANDLE_INITIAL_NUMBER_OF_SLOTS ) );
+
+	for( hash = 1;
+	     hash <= 3 * JOURNAL_HANDLE_INITIAL_NUMBER_OF_SLOTS;
+	     hash++ )
+	{
+		result = journal_handle_contains_hash(
+		          journal_handle,
+		          hash * 0x9e3779b97f4a7c15ULL );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	result = journal_handle_insert_hash(
+	          journal_handle,
+	          0x9e3779b97f4a7c15ULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = journal_handle_contains_hash(
+	          journal_handle,
+	          2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = journal_handle_insert_hash(
+	          NULL,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = journal_handle_insert_hash(
+	          journal_handle,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = journal_handle_free(
+	          &journal_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "journal_handle",
+	 journal_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( journal_handle != NULL )
+	{
+		journal_handle_free(
+		 &journal_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the journal_handle_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_journal_handle_read_data(
+     void )
+{
+	const char *data                 = "4096 1600000000 -1 /prefetch/CMD.EXE-4A81B364.pf\n"
+	                                   "not a record\n"
+	                                   "8192 -5 1024 /prefetch/with space.pf\n"
+	                                   "16 7 8 /prefetch/partial";
+	journal_handle_t *journal_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	size_t data_offset               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = journal_handle_initialize(
+	          &journal_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "journal_handle",
+	 journal_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = journal_handle_read_data(
+	          journal_handle,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          &data_offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The partial record at the end is not read
+	 */
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 99 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "journal_handle->number_of_hashes",
+	 journal_handle->number_of_hashes,
+	 (size_t) 2 );
+
+	result = journal_handle_contains_hash(
+	          journal_handle,
+	          journal_handle_calculate_hash(
+	           "/prefetch/CMD.EXE-4A81B364.pf",
+	           29,
+	           4096,
+	           1600000000 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = journal_handle_contains_hash(
+	          journal_handle,
+	          journal_handle_calculate_hash(
+	           "/prefetch/with space.pf",
+	           23,
+	           8192,
+	           -5 ) );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = journal_handle_read_data(
+	          NULL,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          &data_offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = journal_handle_read_data(
+	          journal_handle,
+	          NULL,
+	          narrow_string_length(
+	           data ),
+	          &data_offset,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = journal_handle_read_data(
+	          journal_handle,
+	          (uint8_t *) data,
+	          narrow_string_length(
+	           data ),
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = journal_handle_free(
+	          &journal_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "journal_handle",
+	 journal_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( journal_handle != NULL )
+	{
+		journal_handle_free(
+		 &journal_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the journal_handle_get_output_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_journal_handle_get_output_offset(
+     void )
+{
+	int64_t offset = 0;
+
+	/* Test error cases
+	 */
+	offset = journal_handle_get_output_offset(
+	          NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "journal_handle_initialize",
+	 scca_test_tools_journal_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "journal_handle_free",
+	 scca_test_tools_journal_handle_free );
+
+	SCCA_TEST_RUN(
+	 "journal_handle_calculate_hash",
+	 scca_test_tools_journal_handle_calculate_hash );
+
+	SCCA_TEST_RUN(
+	 "journal_handle_insert_hash",
+	 scca_test_tools_journal_handle_insert_hash );
+
+	SCCA_TEST_RUN(
+	 "journal_handle_read_data",
+	 scca_test_tools_journal_handle_read_data );
+
+	SCCA_TEST_RUN(
+	 "journal_handle_get_output_offset",
+	 scca_test_tools_journal_handle_get_output_offset );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
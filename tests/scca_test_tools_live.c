@@ -0,0 +1,197 @@
+/*
+ * Tools live system functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/sccatools_live.h"
+
+/* Tests the sccatools_live_enable_backup_privilege function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_live_enable_backup_privilege(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* The backup privilege is only held by an elevated process on Windows
+	 */
+	result = sccatools_live_enable_backup_privilege(
+	          &error );
+
+	SCCA_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the sccatools_live_get_prefetch_directory_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_live_get_prefetch_directory_path(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	system_character_t *directory_path = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = sccatools_live_get_prefetch_directory_path(
+	          &directory_path,
+	          &error );
+
+#if defined( WINAPI )
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_path",
+	 directory_path );
+
+	memory_free(
+	 directory_path );
+
+	directory_path = NULL;
+#else
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "directory_path",
+	 directory_path );
+#endif
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = sccatools_live_get_prefetch_directory_path(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_path = (system_character_t *) 0x12345678UL;
+
+	result = sccatools_live_get_prefetch_directory_path(
+	          &directory_path,
+	          &error );
+
+	directory_path = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_path != NULL )
+	{
+		memory_free(
+		 directory_path );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "sccatools_live_enable_backup_privilege",
+	 scca_test_tools_live_enable_backup_privilege )
+
+	SCCA_TEST_RUN(
+	 "sccatools_live_get_prefetch_directory_path",
+	 scca_test_tools_live_get_prefetch_directory_path )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,849 @@
+/*
+ * Tools merge handle functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/merge_handle.h"
+
+/* Writes a string to a temporary stream
+ * Returns the stream if successful or NULL on error
+ */
+FILE *scca_test_tools_merge_handle_open_stream(
+       const char *string )
+{
+	FILE *stream         = NULL;
+	size_t string_length = 0;
+
+	stream = tmpfile();
+
+	if( stream == NULL )
+	{
+		return( NULL );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( ( file_stream_write(
+	       stream,
+	       string,
+	       string_length ) != string_length )
+	 || ( file_stream_seek_offset(
+	       stream,
+	       0,
+	       SEEK_SET ) != 0 ) )
+	{
+		file_stream_close(
+		 stream );
+
+		return( NULL );
+	}
+	return( stream );
+}
+
+/* Merges strings into a string
+ * Returns 1 if successful, 0 if the merge failed or -1 on error
+ */
+int scca_test_tools_merge_handle_merge_strings(
+     const char *first_string,
+     const char *second_string,
+     char *output_string,
+     size_t output_string_size )
+{
+	libcerror_error_t *error      = NULL;
+	merge_handle_t *merge_handle  = NULL;
+	FILE *output_stream           = NULL;
+	FILE *stream                  = NULL;
+	size_t read_count             = 0;
+	int result                    = -1;
+
+	if( merge_handle_initialize(
+	     &merge_handle,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	stream = scca_test_tools_merge_handle_open_stream(
+	          first_string );
+
+	if( merge_handle_append_input_stream(
+	     merge_handle,
+	     stream,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	stream = scca_test_tools_merge_handle_open_stream(
+	          second_string );
+
+	if( merge_handle_append_input_stream(
+	     merge_handle,
+	     stream,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	stream = NULL;
+
+	output_stream = tmpfile();
+
+	if( output_stream == NULL )
+	{
+		goto on_error;
+	}
+	result = merge_handle_merge(
+	          merge_handle,
+	          output_stream,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		result = 0;
+	}
+	else
+	{
+		if( file_stream_seek_offset(
+		     output_stream,
+		     0,
+		     SEEK_SET ) != 0 )
+		{
+			goto on_error;
+		}
+		read_count = file_stream_read(
+		              output_stream,
+		              output_string,
+		              output_string_size - 1 );
+
+		output_string[ read_count ] = 0;
+	}
+	file_stream_close(
+	 output_stream );
+
+	if( merge_handle_free(
+	     &merge_handle,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( output_stream != NULL )
+	{
+		file_stream_close(
+		 output_stream );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the merge_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_merge_handle_initialize(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	merge_handle_t *merge_handle = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = merge_handle_free(
+	          &merge_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = merge_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	merge_handle = (merge_handle_t *) 0x12345678UL;
+
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	merge_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the merge_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_merge_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = merge_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the merge_handle_determine_input_format function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_merge_handle_determine_input_format(
+     void )
+{
+	int input_format = 0;
+
+	input_format = merge_handle_determine_input_format(
+	                "source,format_version",
+	                21 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "input_format",
+	 input_format,
+	 MERGE_HANDLE_INPUT_FORMAT_CSV );
+
+	input_format = merge_handle_determine_input_format(
+	                "{\"source\":\"A.pf\"}",
+	                17 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "input_format",
+	 input_format,
+	 MERGE_HANDLE_INPUT_FORMAT_JSONL );
+
+	input_format = merge_handle_determine_input_format(
+	                "sccainfo 20110704",
+	                17 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "input_format",
+	 input_format,
+	 MERGE_HANDLE_INPUT_FORMAT_UNKNOWN );
+
+	input_format = merge_handle_determine_input_format(
+	                NULL,
+	                0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "input_format",
+	 input_format,
+	 MERGE_HANDLE_INPUT_FORMAT_UNKNOWN );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the merge_handle_get_record_key function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_merge_handle_get_record_key(
+     void )
+{
+	char key[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t key_length        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_JSONL,
+	          "{\"source\":\"C:\\\\A \\\"B\\\"\\u00e9\\ud83d\\ude00.pf\",\"run_count\":1}",
+	          59,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "key_length",
+	 key_length,
+	 (size_t) 17 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          key,
+	          "C:\\A \"B\"\xc3\xa9\xf0\x9f\x98\x80.pf",
+	          18 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_CSV,
+	          "\"A,\"\"B\"\".pf\",30",
+	          15,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "key_length",
+	 key_length,
+	 (size_t) 8 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          key,
+	          "A,\"B\".pf",
+	          8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_CSV,
+	          "A.pf,30",
+	          7,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "key_length",
+	 key_length,
+	 (size_t) 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test records without a source
+	 */
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_JSONL,
+	          "{\"run_count\":1}",
+	          15,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_JSONL,
+	          "{\"source\":\"A.pf",
+	          15,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_UNKNOWN,
+	          "A.pf,30",
+	          7,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_CSV,
+	          NULL,
+	          7,
+	          key,
+	          64,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_CSV,
+	          "A.pf,30",
+	          7,
+	          key,
+	          7,
+	          &key_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_get_record_key(
+	          MERGE_HANDLE_INPUT_FORMAT_CSV,
+	          "A.pf,30",
+	          7,
+	          key,
+	          64,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the merge_handle_merge function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_merge_handle_merge(
+     void )
+{
+	char output_string[ 256 ];
+
+	libcerror_error_t *error     = NULL;
+	merge_handle_t *merge_handle = NULL;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = scca_test_tools_merge_handle_merge_strings(
+	          "{\"source\":\"A.pf\",\"shard\":0}\n{\"source\":\"C.pf\",\"shard\":0}\n",
+	          "{\"source\":\"B.pf\",\"shard\":1}\n{\"source\":\"D.pf\",\"shard\":1}\n",
+	          output_string,
+	          256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = narrow_string_compare(
+	          output_string,
+	          "{\"source\":\"A.pf\",\"shard\":0}\n{\"source\":\"B.pf\",\"shard\":1}\n"
+	          "{\"source\":\"C.pf\",\"shard\":0}\n{\"source\":\"D.pf\",\"shard\":1}\n",
+	          113 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the CSV header is written once and an empty shard is merged
+	 */
+	result = scca_test_tools_merge_handle_merge_strings(
+	          "source,run_count\nB.pf,2\n",
+	          "source,run_count\n",
+	          output_string,
+	          256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = narrow_string_compare(
+	          output_string,
+	          "source,run_count\nB.pf,2\n",
+	          25 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a source is sorted before the sources it is a prefix of
+	 */
+	result = scca_test_tools_merge_handle_merge_strings(
+	          "source,run_count\nAB.pf,1\n",
+	          "source,run_count\nA,1\n",
+	          output_string,
+	          256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = narrow_string_compare(
+	          output_string,
+	          "source,run_count\nA,1\nAB.pf,1\n",
+	          30 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = scca_test_tools_merge_handle_merge_strings(
+	          "{\"source\":\"B.pf\"}\n{\"source\":\"A.pf\"}\n",
+	          "{\"source\":\"C.pf\"}\n",
+	          output_string,
+	          256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = scca_test_tools_merge_handle_merge_strings(
+	          "source,run_count\nA.pf,1\n",
+	          "{\"source\":\"B.pf\"}\n",
+	          output_string,
+	          256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = scca_test_tools_merge_handle_merge_strings(
+	          "source,run_count\nA.pf,1\n",
+	          "source,prefetch_hash\nB.pf,0x12345678\n",
+	          output_string,
+	          256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = merge_handle_initialize(
+	          &merge_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "merge_handle",
+	 merge_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = merge_handle_merge(
+	          NULL,
+	          stdout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = merge_handle_merge(
+	          merge_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = merge_handle_free(
+	          &merge_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge_handle != NULL )
+	{
+		merge_handle_free(
+		 &merge_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "merge_handle_initialize",
+	 scca_test_tools_merge_handle_initialize )
+
+	SCCA_TEST_RUN(
+	 "merge_handle_free",
+	 scca_test_tools_merge_handle_free )
+
+	SCCA_TEST_RUN(
+	 "merge_handle_determine_input_format",
+	 scca_test_tools_merge_handle_determine_input_format )
+
+	SCCA_TEST_RUN(
+	 "merge_handle_get_record_key",
+	 scca_test_tools_merge_handle_get_record_key )
+
+	SCCA_TEST_RUN(
+	 "merge_handle_merge",
+	 scca_test_tools_merge_handle_merge )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
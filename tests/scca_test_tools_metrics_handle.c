@@ -0,0 +1,1114 @@
+/*
+ * Tools metrics_handle type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/metrics_handle.h"
+#include "../sccatools/output_buffer.h"
+
+/* Tests the metrics_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	metrics_handle_t *metrics_handle  = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 3;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = metrics_handle_initialize(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "metrics_handle",
+	 metrics_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_handle_free(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "metrics_handle",
+	 metrics_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = metrics_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metrics_handle = (metrics_handle_t *) 0x12345678UL;
+
+	result = metrics_handle_initialize(
+	          &metrics_handle,
+	          &error );
+
+	metrics_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test metrics_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = metrics_handle_initialize(
+		          &metrics_handle,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( metrics_handle != NULL )
+			{
+				metrics_handle_free(
+				 &metrics_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "metrics_handle",
+			 metrics_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test metrics_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = metrics_handle_initialize(
+		          &metrics_handle,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( metrics_handle != NULL )
+			{
+				metrics_handle_free(
+				 &metrics_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "metrics_handle",
+			 metrics_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metrics_handle != NULL )
+	{
+		metrics_handle_free(
+		 &metrics_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = metrics_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_handle_get_bucket_index function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_get_bucket_index(
+     void )
+{
+	int bucket_index = 0;
+
+	/* Test regular cases
+	 */
+	bucket_index = metrics_handle_get_bucket_index(
+	                0 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 0 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                1536 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 0 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                1537 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 1 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                2048 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 1 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                2049 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 2 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                (uint64_t) 1 << 36 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 2 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                ( (uint64_t) 1 << 36 ) + 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 1 );
+
+	bucket_index = metrics_handle_get_bucket_index(
+	                0xffffffffffffffffUL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "bucket_index",
+	 bucket_index,
+	 METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the metrics_handle_get_bucket_upper_bound function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_get_bucket_upper_bound(
+     void )
+{
+	uint64_t upper_bound = 0;
+	int bucket_index     = 0;
+	int result           = 0;
+
+	/* Test regular cases
+	 */
+	result = metrics_handle_get_bucket_upper_bound(
+	          0,
+	          &upper_bound );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_bound",
+	 upper_bound,
+	 (uint64_t) 1536 );
+
+	result = metrics_handle_get_bucket_upper_bound(
+	          2,
+	          &upper_bound );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "upper_bound",
+	 upper_bound,
+	 (uint64_t) 3072 );
+
+	result = metrics_handle_get_bucket_upper_bound(
+	          METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 1,
+	          &upper_bound );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Every value is in the bucket of which it does not exceed the upper bound
+	 */
+	for( bucket_index = 0;
+	     bucket_index < ( METRICS_HANDLE_HISTOGRAM_NUMBER_OF_BUCKETS - 1 );
+	     bucket_index++ )
+	{
+		result = metrics_handle_get_bucket_upper_bound(
+		          bucket_index,
+		          &upper_bound );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "bucket_index",
+		 metrics_handle_get_bucket_index(
+		  upper_bound ),
+		 bucket_index );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "bucket_index",
+		 metrics_handle_get_bucket_index(
+		  upper_bound + 1 ),
+		 bucket_index + 1 );
+	}
+	/* Test error cases
+	 */
+	result = metrics_handle_get_bucket_upper_bound(
+	          -1,
+	          &upper_bound );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = metrics_handle_get_bucket_upper_bound(
+	          0,
+	          NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the metrics_handle_append_seconds function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_append_seconds(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	output_buffer_t *output_buffer  = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = metrics_handle_append_seconds(
+	          output_buffer,
+	          1500000000UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_character(
+	          output_buffer,
+	          ' ',
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_handle_append_seconds(
+	          output_buffer,
+	          2000000000UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = output_buffer_append_character(
+	          output_buffer,
+	          ' ',
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_handle_append_seconds(
+	          output_buffer,
+	          1536,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_offset",
+	 output_buffer->data_offset,
+	 (size_t) 17 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "1.5 2 0.000001536",
+	          17 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_handle_add_failed_file function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_add_failed_file(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcerror_error_t *file_error    = NULL;
+	metrics_handle_t *metrics_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = metrics_handle_initialize(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The domain of an error is the domain it was created with
+	 */
+	libcerror_error_set(
+	 &file_error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_READ_FAILED,
+	 "test: unable to read." );
+
+	libcerror_error_set(
+	 &file_error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+	 "test: unable to retrieve." );
+
+	result = metrics_handle_add_failed_file(
+	          metrics_handle,
+	          file_error,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &file_error );
+
+	result = metrics_handle_add_failed_file(
+	          metrics_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "metrics_handle->number_of_failed_files",
+	 metrics_handle->number_of_failed_files,
+	 (uint64_t) 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "metrics_handle->number_of_errors[ 3 ]",
+	 metrics_handle->number_of_errors[ 3 ],
+	 (uint64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "metrics_handle->number_of_errors[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS - 1 ]",
+	 metrics_handle->number_of_errors[ METRICS_HANDLE_NUMBER_OF_ERROR_DOMAINS - 1 ],
+	 (uint64_t) 1 );
+
+	/* Test error cases
+	 */
+	result = metrics_handle_add_failed_file(
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = metrics_handle_free(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( file_error != NULL )
+	{
+		libcerror_error_free(
+		 &file_error );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metrics_handle != NULL )
+	{
+		metrics_handle_free(
+		 &metrics_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_handle_add_queue_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_add_queue_depth(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	metrics_handle_t *metrics_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = metrics_handle_initialize(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = metrics_handle_add_queue_depth(
+	          metrics_handle,
+	          METRICS_HANDLE_QUEUE_CONNECTIONS,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = metrics_handle_add_queue_depth(
+	          metrics_handle,
+	          METRICS_HANDLE_QUEUE_CONNECTIONS,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "metrics_handle->queue_depths[ METRICS_HANDLE_QUEUE_CONNECTIONS ]",
+	 metrics_handle->queue_depths[ METRICS_HANDLE_QUEUE_CONNECTIONS ],
+	 (int64_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT64(
+	 "metrics_handle->maximum_queue_depths[ METRICS_HANDLE_QUEUE_CONNECTIONS ]",
+	 metrics_handle->maximum_queue_depths[ METRICS_HANDLE_QUEUE_CONNECTIONS ],
+	 (int64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = metrics_handle_add_queue_depth(
+	          metrics_handle,
+	          METRICS_HANDLE_NUMBER_OF_QUEUES,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = metrics_handle_free(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metrics_handle != NULL )
+	{
+		metrics_handle_free(
+		 &metrics_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the metrics_handle_append_text function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_metrics_handle_append_text(
+     void )
+{
+	const char *expected_text        = "# HELP scca_files_parsed_total Number of prefetch files that were parsed.\n"
+	                                   "# TYPE scca_files_parsed_total counter\n"
+	                                   "scca_files_parsed_total 0\n";
+	const char *expected_bucket      = "scca_stage_latency_seconds_bucket{stage=\"parse\",le=\"0.000001536\"} 1\n";
+	const char *expected_sum         = "scca_stage_latency_seconds_sum{stage=\"parse\"} 0.000001001\n";
+
+	libcerror_error_t *error         = NULL;
+	metrics_handle_t *metrics_handle = NULL;
+	output_buffer_t *output_buffer   = NULL;
+	size_t data_offset               = 0;
+	size_t expected_length           = 0;
+	int found                        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = metrics_handle_initialize(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = metrics_handle_add_stage_latency(
+	          metrics_handle,
+	          METRICS_HANDLE_STAGE_PARSE,
+	          1001,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_handle_append_text(
+	          metrics_handle,
+	          output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_length = narrow_string_length(
+	                   expected_text );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "output_buffer->data_offset",
+	 (int) output_buffer->data_offset,
+	 (int) expected_length );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          expected_text,
+	          expected_length );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The histogram of the parse stage is the only histogram
+	 */
+	expected_length = narrow_string_length(
+	                   expected_bucket );
+
+	for( data_offset = 0;
+	     ( data_offset + expected_length ) <= output_buffer->data_offset;
+	     data_offset++ )
+	{
+		if( memory_compare(
+		     &( output_buffer->data[ data_offset ] ),
+		     expected_bucket,
+		     expected_length ) == 0 )
+		{
+			found++;
+		}
+	}
+	expected_length = narrow_string_length(
+	                   expected_sum );
+
+	for( data_offset = 0;
+	     ( data_offset + expected_length ) <= output_buffer->data_offset;
+	     data_offset++ )
+	{
+		if( memory_compare(
+		     &( output_buffer->data[ data_offset ] ),
+		     expected_sum,
+		     expected_length ) == 0 )
+		{
+			found++;
+		}
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "found",
+	 found,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = metrics_handle_append_text(
+	          NULL,
+	          output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = metrics_handle_append_text(
+	          metrics_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = metrics_handle_free(
+	          &metrics_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( metrics_handle != NULL )
+	{
+		metrics_handle_free(
+		 &metrics_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_initialize",
+	 scca_test_tools_metrics_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_free",
+	 scca_test_tools_metrics_handle_free );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_get_bucket_index",
+	 scca_test_tools_metrics_handle_get_bucket_index );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_get_bucket_upper_bound",
+	 scca_test_tools_metrics_handle_get_bucket_upper_bound );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_append_seconds",
+	 scca_test_tools_metrics_handle_append_seconds );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_add_failed_file",
+	 scca_test_tools_metrics_handle_add_failed_file );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_add_queue_depth",
+	 scca_test_tools_metrics_handle_add_queue_depth );
+
+	SCCA_TEST_RUN(
+	 "metrics_handle_append_text",
+	 scca_test_tools_metrics_handle_append_text );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
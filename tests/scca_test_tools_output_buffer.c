@@ -0,0 +1,759 @@
+/*
+ * Tools output buffer functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/output_buffer.h"
+
+/* Tests the output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = output_buffer_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (output_buffer_t *) 0x12345678UL;
+
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	output_buffer = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = output_buffer_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_decimal, output_buffer_append_signed_decimal
+ * and output_buffer_append_hexadecimal_32bit functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_buffer_append_numbers(
+     void )
+{
+	const char *expected_data      = "0 18446744073709551615 -12 0x0012abcd";
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_append_decimal(
+	          output_buffer,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_character(
+	          output_buffer,
+	          ' ',
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_decimal(
+	          output_buffer,
+	          0xffffffffffffffffUL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_character(
+	          output_buffer,
+	          ' ',
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_signed_decimal(
+	          output_buffer,
+	          -12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_character(
+	          output_buffer,
+	          ' ',
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_hexadecimal_32bit(
+	          output_buffer,
+	          0x0012abcdUL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_offset",
+	 output_buffer->data_offset,
+	 (size_t) 37 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          expected_data,
+	          37 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_decimal(
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_quoted_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_buffer_append_quoted_string(
+     void )
+{
+	const char *expected_csv_data  = "\"a\"\"b\\\"";
+	const char *expected_json_data = "\"a\\\"b\\\\\\n\\u001f\"";
+	const char *expected_sql_data  = "'a''b\"'";
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_append_quoted_string(
+	          output_buffer,
+	          (uint8_t *) "a\"b\\",
+	          4,
+	          OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_offset",
+	 output_buffer->data_offset,
+	 (size_t) 7 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          expected_csv_data,
+	          7 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_offset = 0;
+
+	result = output_buffer_append_quoted_string(
+	          output_buffer,
+	          (uint8_t *) "a\"b\\\n\x1f",
+	          6,
+	          OUTPUT_BUFFER_ESCAPE_MODE_JSON,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_offset",
+	 output_buffer->data_offset,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          expected_json_data,
+	          16 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_offset = 0;
+
+	result = output_buffer_append_quoted_string(
+	          output_buffer,
+	          (uint8_t *) "a'b\"",
+	          4,
+	          OUTPUT_BUFFER_ESCAPE_MODE_SQL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_offset",
+	 output_buffer->data_offset,
+	 (size_t) 7 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          expected_sql_data,
+	          7 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_quoted_string(
+	          output_buffer,
+	          NULL,
+	          4,
+	          OUTPUT_BUFFER_ESCAPE_MODE_CSV,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = output_buffer_append_quoted_string(
+	          output_buffer,
+	          (uint8_t *) "a\"b\\",
+	          4,
+	          -1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the output_buffer_append_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_output_buffer_append_filetime(
+     void )
+{
+	const char *expected_data      = "Jan 01, 1601 00:00:00.000000000Mar 20, 2020 16:38:11.013743500Sep 14, 30828 02:48:05.477580800";
+	libcerror_error_t *error       = NULL;
+	output_buffer_t *output_buffer = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = output_buffer_initialize(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = output_buffer_append_filetime(
+	          output_buffer,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_filetime(
+	          output_buffer,
+	          132291958910137435UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = output_buffer_append_filetime(
+	          output_buffer,
+	          0x8000000000000000UL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_offset",
+	 output_buffer->data_offset,
+	 (size_t) 94 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          expected_data,
+	          94 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = output_buffer_append_filetime(
+	          NULL,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "output_buffer_initialize",
+	 scca_test_tools_output_buffer_initialize )
+
+	SCCA_TEST_RUN(
+	 "output_buffer_free",
+	 scca_test_tools_output_buffer_free )
+
+	SCCA_TEST_RUN(
+	 "output_buffer_append_numbers",
+	 scca_test_tools_output_buffer_append_numbers )
+
+	SCCA_TEST_RUN(
+	 "output_buffer_append_quoted_string",
+	 scca_test_tools_output_buffer_append_quoted_string )
+
+	SCCA_TEST_RUN(
+	 "output_buffer_append_filetime",
+	 scca_test_tools_output_buffer_append_filetime )
+
+	/* TODO add tests for output_buffer_write */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,744 @@
+/*
+ * Tools path list functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/path_list.h"
+
+/* Tests the path_list_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	path_list_t *path_list   = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = path_list_initialize(
+	          &path_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "path_list",
+	 path_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = path_list_free(
+	          &path_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "path_list",
+	 path_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = path_list_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_list = (path_list_t *) 0x12345678UL;
+
+	result = path_list_initialize(
+	          &path_list,
+	          &error );
+
+	path_list = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the path_list_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = path_list_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the path_list_append_path function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_append_path(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	path_list_t *path_list   = NULL;
+	int path_index           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = path_list_initialize(
+	          &path_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "path_list",
+	 path_list );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, more paths than the initial allocation
+	 */
+	for( path_index = 0;
+	     path_index < 100;
+	     path_index++ )
+	{
+		result = path_list_append_path(
+		          path_list,
+		          _SYSTEM_STRING( "CMD.EXE-087B4001.pf" ),
+		          19,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "path_list->number_of_paths",
+	 path_list->number_of_paths,
+	 100 );
+
+	result = system_string_compare(
+	          path_list->paths[ 99 ],
+	          _SYSTEM_STRING( "CMD.EXE-087B4001.pf" ),
+	          20 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = path_list_append_path(
+	          NULL,
+	          _SYSTEM_STRING( "CMD.EXE-087B4001.pf" ),
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_list_append_path(
+	          path_list,
+	          NULL,
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_list_append_path(
+	          path_list,
+	          _SYSTEM_STRING( "CMD.EXE-087B4001.pf" ),
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = path_list_free(
+	          &path_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the path_list_has_prefetch_extension function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_has_prefetch_extension(
+     void )
+{
+	int result = 0;
+
+	result = path_list_has_prefetch_extension(
+	          _SYSTEM_STRING( "CMD.EXE-087B4001.pf" ),
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = path_list_has_prefetch_extension(
+	          _SYSTEM_STRING( "CMD.EXE-087B4001.PF" ),
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = path_list_has_prefetch_extension(
+	          _SYSTEM_STRING( "Layout.ini" ),
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = path_list_has_prefetch_extension(
+	          _SYSTEM_STRING( "pf" ),
+	          2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = path_list_has_prefetch_extension(
+	          NULL,
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the path_list_compare_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_compare_paths(
+     void )
+{
+	const system_character_t *first_path  = _SYSTEM_STRING( "A.pf" );
+	const system_character_t *second_path = _SYSTEM_STRING( "AB.pf" );
+	int result                            = 0;
+
+	result = path_list_compare_paths(
+	          &first_path,
+	          &second_path );
+
+	SCCA_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = path_list_compare_paths(
+	          &second_path,
+	          &first_path );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = path_list_compare_paths(
+	          &first_path,
+	          &first_path );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the path_list_calculate_shard_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_calculate_shard_hash(
+     void )
+{
+	uint32_t hash = 0;
+
+	hash = path_list_calculate_shard_hash(
+	        _SYSTEM_STRING( "" ) );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	hash = path_list_calculate_shard_hash(
+	        _SYSTEM_STRING( "a" ) );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	hash = path_list_calculate_shard_hash(
+	        NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the path_list_select_shard function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_path_list_select_shard(
+     void )
+{
+	system_character_t path[ 8 ];
+
+	libcerror_error_t *error    = NULL;
+	path_list_t *path_list      = NULL;
+	int number_of_removed_paths = 0;
+	int number_of_paths         = 0;
+	int path_index              = 0;
+	int result                  = 0;
+	int shard_index             = 0;
+
+	/* Test regular cases, every path is part of exactly 1 of 4 shards
+	 */
+	for( shard_index = 0;
+	     shard_index < 4;
+	     shard_index++ )
+	{
+		result = path_list_initialize(
+		          &path_list,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Append the paths in reverse order to test that the shard is sorted
+		 */
+		for( path_index = 99;
+		     path_index >= 0;
+		     path_index-- )
+		{
+			path[ 0 ] = (system_character_t) 'A' + ( path_index / 10 );
+			path[ 1 ] = (system_character_t) '0' + ( path_index % 10 );
+			path[ 2 ] = (system_character_t) '.';
+			path[ 3 ] = (system_character_t) 'p';
+			path[ 4 ] = (system_character_t) 'f';
+			path[ 5 ] = 0;
+
+			result = path_list_append_path(
+			          path_list,
+			          path,
+			          5,
+			          &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		number_of_removed_paths = path_list_select_shard(
+		                           path_list,
+		                           shard_index,
+		                           4,
+		                           &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "number_of_removed_paths",
+		 number_of_removed_paths,
+		 100 - path_list->number_of_paths );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( path_index = 0;
+		     path_index < path_list->number_of_paths;
+		     path_index++ )
+		{
+			SCCA_TEST_ASSERT_EQUAL_UINT32(
+			 "shard_index",
+			 path_list_calculate_shard_hash(
+			  path_list->paths[ path_index ] ) % 4,
+			 (uint32_t) shard_index );
+
+			if( path_index > 0 )
+			{
+				result = path_list_compare_paths(
+				          &( path_list->paths[ path_index - 1 ] ),
+				          &( path_list->paths[ path_index ] ) );
+
+				SCCA_TEST_ASSERT_LESS_THAN_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+		}
+		number_of_paths += path_list->number_of_paths;
+
+		result = path_list_free(
+		          &path_list,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_paths",
+	 number_of_paths,
+	 100 );
+
+	/* Initialize test
+	 */
+	result = path_list_initialize(
+	          &path_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = path_list_select_shard(
+	          NULL,
+	          0,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_list_select_shard(
+	          path_list,
+	          0,
+	          0,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_list_select_shard(
+	          path_list,
+	          4,
+	          4,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = path_list_free(
+	          &path_list,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_list != NULL )
+	{
+		path_list_free(
+		 &path_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "path_list_initialize",
+	 scca_test_tools_path_list_initialize )
+
+	SCCA_TEST_RUN(
+	 "path_list_free",
+	 scca_test_tools_path_list_free )
+
+	SCCA_TEST_RUN(
+	 "path_list_append_path",
+	 scca_test_tools_path_list_append_path )
+
+	/* TODO add tests for path_list_append_directory */
+
+	SCCA_TEST_RUN(
+	 "path_list_has_prefetch_extension",
+	 scca_test_tools_path_list_has_prefetch_extension )
+
+	SCCA_TEST_RUN(
+	 "path_list_compare_paths",
+	 scca_test_tools_path_list_compare_paths )
+
+	SCCA_TEST_RUN(
+	 "path_list_calculate_shard_hash",
+	 scca_test_tools_path_list_calculate_shard_hash )
+
+	SCCA_TEST_RUN(
+	 "path_list_select_shard",
+	 scca_test_tools_path_list_select_shard )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,802 @@
+/*
+ * Tools summary_handle type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../sccatools/summary_handle.h"
+
+/* Tests the summary_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_summary_handle_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	summary_handle_t *summary_handle  = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 9;
+	int number_of_memset_fail_tests   = 8;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = summary_handle_initialize(
+	          &summary_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "summary_handle",
+	 summary_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = summary_handle_free(
+	          &summary_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "summary_handle",
+	 summary_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = summary_handle_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	summary_handle = (summary_handle_t *) 0x12345678UL;
+
+	result = summary_handle_initialize(
+	          &summary_handle,
+	          &error );
+
+	summary_handle = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test summary_handle_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = summary_handle_initialize(
+		          &summary_handle,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( summary_handle != NULL )
+			{
+				summary_handle_free(
+				 &summary_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "summary_handle",
+			 summary_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test summary_handle_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = summary_handle_initialize(
+		          &summary_handle,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( summary_handle != NULL )
+			{
+				summary_handle_free(
+				 &summary_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "summary_handle",
+			 summary_handle );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( summary_handle != NULL )
+	{
+		summary_handle_free(
+		 &summary_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the summary_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_summary_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = summary_handle_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the summary_table_get_entry_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_summary_table_get_entry_by_key(
+     void )
+{
+	uint8_t key[ 4 ];
+
+	libcerror_error_t *error        = NULL;
+	summary_entry_t *first_entry    = NULL;
+	summary_entry_t *summary_entry  = NULL;
+	summary_table_t *summary_table  = NULL;
+	uint32_t key_index              = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = summary_table_initialize(
+	          &summary_table,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "summary_table",
+	 summary_table );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = summary_table_get_entry_by_key(
+	          summary_table,
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          &first_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "first_entry",
+	 first_entry );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_table->number_of_entries",
+	 summary_table->number_of_entries,
+	 1 );
+
+	/* Add enough keys for the table to be resized more than once
+	 */
+	for( key_index = 0;
+	     key_index < 4 * SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS;
+	     key_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 key,
+		 key_index );
+
+		result = summary_table_get_entry_by_key(
+		          summary_table,
+		          key,
+		          4,
+		          &summary_entry,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		summary_entry->value = (uint64_t) key_index;
+	}
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_table->number_of_entries",
+	 summary_table->number_of_entries,
+	 ( 4 * SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS ) + 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "summary_table->number_of_buckets",
+	 summary_table->number_of_buckets,
+	 (uint32_t) ( 8 * SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS ) );
+
+	/* An existing key returns the same entry after the resize
+	 */
+	result = summary_table_get_entry_by_key(
+	          summary_table,
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          &summary_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_entry == first_entry",
+	 ( summary_entry == first_entry ),
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_table->number_of_entries",
+	 summary_table->number_of_entries,
+	 ( 4 * SUMMARY_TABLE_INITIAL_NUMBER_OF_BUCKETS ) + 1 );
+
+	/* Test error cases
+	 */
+	result = summary_table_get_entry_by_key(
+	          NULL,
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          &summary_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = summary_table_get_entry_by_key(
+	          summary_table,
+	          NULL,
+	          7,
+	          &summary_entry,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = summary_table_get_entry_by_key(
+	          summary_table,
+	          (uint8_t *) "CMD.EXE",
+	          7,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = summary_table_free(
+	          &summary_table,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "summary_table",
+	 summary_table );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( summary_table != NULL )
+	{
+		summary_table_free(
+		 &summary_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the summary_handle_append_record function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_tools_summary_handle_append_record(
+     void )
+{
+	uint8_t filenames[ 32 ]             = {
+		'N', 'T', 'D', 'L', 'L', '.', 'D', 'L', 'L', 0,
+		'C', 'M', 'D', '.', 'E', 'X', 'E', 0,
+		'N', 'T', 'D', 'L', 'L', '.', 'D', 'L', 'L', 0,
+		0, 0, 0, 0 };
+	size_t filename_offsets[ 3 ]        = { 0, 10, 18 };
+	uint32_t volume_serial_numbers[ 2 ] = { 0x12345678UL, 0x9abcdef0UL };
+
+	summary_entry_t **sorted_entries    = NULL;
+	summary_handle_t *summary_handle    = NULL;
+	summary_record_t summary_record;
+	libcerror_error_t *error            = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = summary_handle_initialize(
+	          &summary_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "summary_handle",
+	 summary_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &summary_record,
+	 0,
+	 sizeof( summary_record_t ) );
+
+	summary_record.executable_filename      = &( filenames[ 10 ] );
+	summary_record.executable_filename_size = 8;
+	summary_record.run_count                = 3;
+	summary_record.filenames                = filenames;
+	summary_record.filenames_size           = 28;
+	summary_record.filename_offsets         = filename_offsets;
+	summary_record.number_of_filenames      = 3;
+	summary_record.volume_serial_numbers    = volume_serial_numbers;
+	summary_record.number_of_volumes        = 1;
+
+	/* Test regular cases
+	 */
+	result = summary_handle_append_record(
+	          summary_handle,
+	          &summary_record,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	summary_record.run_count         = 5;
+	summary_record.number_of_volumes = 2;
+
+	result = summary_handle_append_record(
+	          summary_handle,
+	          &summary_record,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_handle->number_of_files",
+	 summary_handle->number_of_files,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_handle->executables_table->number_of_entries",
+	 summary_handle->executables_table->number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_handle->filenames_table->number_of_entries",
+	 summary_handle->filenames_table->number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "summary_handle->volumes_table->number_of_entries",
+	 summary_handle->volumes_table->number_of_entries,
+	 2 );
+
+	/* The run counts are added and every file is counted once
+	 * even if a filename is stored more than once in a file
+	 */
+	result = summary_table_get_sorted_entries(
+	          summary_handle->executables_table,
+	          &sorted_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "sorted_entries",
+	 sorted_entries );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "sorted_entries[ 0 ]->value",
+	 sorted_entries[ 0 ]->value,
+	 (uint64_t) 8 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sorted_entries[ 0 ]->number_of_files",
+	 sorted_entries[ 0 ]->number_of_files,
+	 2 );
+
+	memory_free(
+	 sorted_entries );
+
+	sorted_entries = NULL;
+
+	result = summary_table_get_sorted_entries(
+	          summary_handle->filenames_table,
+	          &sorted_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "sorted_entries",
+	 sorted_entries );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sorted_entries[ 0 ]->number_of_files",
+	 sorted_entries[ 0 ]->number_of_files,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sorted_entries[ 1 ]->number_of_files",
+	 sorted_entries[ 1 ]->number_of_files,
+	 2 );
+
+	memory_free(
+	 sorted_entries );
+
+	sorted_entries = NULL;
+
+	/* The volumes that appear in the most files are sorted first
+	 */
+	result = summary_table_get_sorted_entries(
+	          summary_handle->volumes_table,
+	          &sorted_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "sorted_entries",
+	 sorted_entries );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sorted_entries[ 0 ]->number_of_files",
+	 sorted_entries[ 0 ]->number_of_files,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "sorted_entries[ 1 ]->number_of_files",
+	 sorted_entries[ 1 ]->number_of_files,
+	 1 );
+
+	memory_free(
+	 sorted_entries );
+
+	sorted_entries = NULL;
+
+	/* Test error cases
+	 */
+	result = summary_handle_append_record(
+	          NULL,
+	          &summary_record,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = summary_handle_append_record(
+	          summary_handle,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = summary_handle_free(
+	          &summary_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "summary_handle",
+	 summary_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sorted_entries != NULL )
+	{
+		memory_free(
+		 sorted_entries );
+	}
+	if( summary_handle != NULL )
+	{
+		summary_handle_free(
+		 &summary_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "summary_handle_initialize",
+	 scca_test_tools_summary_handle_initialize );
+
+	SCCA_TEST_RUN(
+	 "summary_handle_free",
+	 scca_test_tools_summary_handle_free );
+
+	SCCA_TEST_RUN(
+	 "summary_table_get_entry_by_key",
+	 scca_test_tools_summary_table_get_entry_by_key );
+
+	SCCA_TEST_RUN(
+	 "summary_handle_append_record",
+	 scca_test_tools_summary_handle_append_record );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1047 @@
+/*
+ * Library trace_chain type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_memory.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_io_handle.h"
+#include "../libscca/libscca_trace_chain.h"
+
+uint8_t scca_test_trace_chain_data1[ 24 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+	0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_trace_chain_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_trace_chain_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_trace_chain_t *trace_chain = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libscca_trace_chain_initialize(
+	          &trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "trace_chain",
+	 trace_chain );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_free(
+	          &trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "trace_chain",
+	 trace_chain );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_trace_chain_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	trace_chain = (libscca_trace_chain_t *) 0x12345678UL;
+
+	result = libscca_trace_chain_initialize(
+	          &trace_chain,
+	          &error );
+
+	trace_chain = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SCCA_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_trace_chain_initialize with malloc failing
+		 */
+		scca_test_malloc_attempts_before_fail = test_number;
+
+		result = libscca_trace_chain_initialize(
+		          &trace_chain,
+		          &error );
+
+		if( scca_test_malloc_attempts_before_fail != -1 )
+		{
+			scca_test_malloc_attempts_before_fail = -1;
+
+			if( trace_chain != NULL )
+			{
+				libscca_trace_chain_free(
+				 &trace_chain,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "trace_chain",
+			 trace_chain );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libscca_trace_chain_initialize with memset failing
+		 */
+		scca_test_memset_attempts_before_fail = test_number;
+
+		result = libscca_trace_chain_initialize(
+		          &trace_chain,
+		          &error );
+
+		if( scca_test_memset_attempts_before_fail != -1 )
+		{
+			scca_test_memset_attempts_before_fail = -1;
+
+			if( trace_chain != NULL )
+			{
+				libscca_trace_chain_free(
+				 &trace_chain,
+				 NULL );
+			}
+		}
+		else
+		{
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "trace_chain",
+			 trace_chain );
+
+			SCCA_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SCCA_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace_chain != NULL )
+	{
+		libscca_trace_chain_free(
+		 &trace_chain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_trace_chain_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_trace_chain_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_trace_chain_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_trace_chain_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_trace_chain_read_data(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libscca_io_handle_t *io_handle     = NULL;
+	libscca_trace_chain_t *trace_chain = NULL;
+	uint32_t load_counts[ 2 ];
+	uint32_t next_entry_indexes[ 2 ];
+	int number_of_entries              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_set_format_version(
+	          io_handle,
+	          17,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_initialize(
+	          &trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "trace_chain",
+	 trace_chain );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          io_handle,
+	          scca_test_trace_chain_data1,
+	          24,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_get_number_of_entries(
+	          trace_chain,
+	          &number_of_entries,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_copy_load_counts(
+	          trace_chain,
+	          load_counts,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "load_counts[ 0 ]",
+	 load_counts[ 0 ],
+	 (uint32_t) 3 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "load_counts[ 1 ]",
+	 load_counts[ 1 ],
+	 (uint32_t) 5 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_copy_next_entry_indexes(
+	          trace_chain,
+	          next_entry_indexes,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "next_entry_indexes[ 0 ]",
+	 next_entry_indexes[ 0 ],
+	 (uint32_t) 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "next_entry_indexes[ 1 ]",
+	 next_entry_indexes[ 1 ],
+	 (uint32_t) 0xffffffffUL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_trace_chain_copy_load_counts(
+	          trace_chain,
+	          load_counts,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          io_handle,
+	          scca_test_trace_chain_data1,
+	          24,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_clear(
+	          trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_read_data(
+	          NULL,
+	          io_handle,
+	          scca_test_trace_chain_data1,
+	          24,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          NULL,
+	          scca_test_trace_chain_data1,
+	          24,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          io_handle,
+	          NULL,
+	          24,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          io_handle,
+	          scca_test_trace_chain_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          io_handle,
+	          scca_test_trace_chain_data1,
+	          24,
+	          3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_trace_chain_free(
+	          &trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "trace_chain",
+	 trace_chain );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace_chain != NULL )
+	{
+		libscca_trace_chain_free(
+		 &trace_chain,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_trace_chain_decode_v30_load_counts function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_trace_chain_decode_v30_load_counts(
+     void )
+{
+	uint32_t cpu_features[ 5 ] = {
+		0,
+		LIBSCCA_CPU_FEATURE_SSE2,
+		LIBSCCA_CPU_FEATURE_SSE2 | LIBSCCA_CPU_FEATURE_AVX2,
+		LIBSCCA_CPU_FEATURE_NEON,
+		0xffffffffUL };
+
+	uint8_t data[ 8 * 37 ];
+	uint32_t load_counts[ 37 ];
+
+	uint32_t entry_index       = 0;
+	uint32_t expected_value    = 0;
+	uint32_t number_of_entries = 0;
+	int features_index         = 0;
+
+	for( entry_index = 0;
+	     entry_index < 37;
+	     entry_index++ )
+	{
+		expected_value = 0x01020304UL * ( entry_index + 1 );
+
+		data[ entry_index * 8 ]         = (uint8_t) ( expected_value & 0xff );
+		data[ ( entry_index * 8 ) + 1 ] = (uint8_t) ( ( expected_value >> 8 ) & 0xff );
+		data[ ( entry_index * 8 ) + 2 ] = (uint8_t) ( ( expected_value >> 16 ) & 0xff );
+		data[ ( entry_index * 8 ) + 3 ] = (uint8_t) ( ( expected_value >> 24 ) & 0xff );
+		data[ ( entry_index * 8 ) + 4 ] = 0xa5;
+		data[ ( entry_index * 8 ) + 5 ] = 0x5a;
+		data[ ( entry_index * 8 ) + 6 ] = 0xff;
+		data[ ( entry_index * 8 ) + 7 ] = (uint8_t) entry_index;
+	}
+	for( features_index = 0;
+	     features_index < 5;
+	     features_index++ )
+	{
+		libscca_cpu_set_features(
+		 cpu_features[ features_index ] );
+
+		/* Test every number of entries relative to the vector blocks
+		 */
+		for( number_of_entries = 0;
+		     number_of_entries <= 37;
+		     number_of_entries++ )
+		{
+			for( entry_index = 0;
+			     entry_index < 37;
+			     entry_index++ )
+			{
+				load_counts[ entry_index ] = 0xdeadbeefUL;
+			}
+			libscca_trace_chain_decode_v30_load_counts(
+			 data,
+			 number_of_entries,
+			 load_counts );
+
+			for( entry_index = 0;
+			     entry_index < 37;
+			     entry_index++ )
+			{
+				if( entry_index < number_of_entries )
+				{
+					expected_value = 0x01020304UL * ( entry_index + 1 );
+				}
+				else
+				{
+					expected_value = 0xdeadbeefUL;
+				}
+				SCCA_TEST_ASSERT_EQUAL_UINT32(
+				 "load_counts[ entry_index ]",
+				 load_counts[ entry_index ],
+				 expected_value );
+			}
+		}
+	}
+	libscca_cpu_set_features(
+	 0xffffffffUL );
+
+	return( 1 );
+
+on_error:
+	libscca_cpu_set_features(
+	 0xffffffffUL );
+
+	return( 0 );
+}
+
+/* Tests the libscca_trace_chain_get_range_load_counts function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_trace_chain_get_range_load_counts(
+     void )
+{
+	uint32_t first_entry_indexes[ 5 ]  = { 0, 1, 1, 2, 0 };
+	uint32_t numbers_of_entries[ 5 ]   = { 2, 1, 5, 1, 0 };
+	libcerror_error_t *error           = NULL;
+	libscca_io_handle_t *io_handle     = NULL;
+	libscca_trace_chain_t *trace_chain = NULL;
+	uint64_t range_load_counts[ 5 ];
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_set_format_version(
+	          io_handle,
+	          17,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_initialize(
+	          &trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "trace_chain",
+	 trace_chain );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_trace_chain_read_data(
+	          trace_chain,
+	          io_handle,
+	          scca_test_trace_chain_data1,
+	          24,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_trace_chain_get_range_load_counts(
+	          trace_chain,
+	          first_entry_indexes,
+	          numbers_of_entries,
+	          5,
+	          range_load_counts,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "range_load_counts[ 0 ]",
+	 range_load_counts[ 0 ],
+	 (uint64_t) 8 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "range_load_counts[ 1 ]",
+	 range_load_counts[ 1 ],
+	 (uint64_t) 5 );
+
+	/* A range that extends beyond the last entry is truncated
+	 */
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "range_load_counts[ 2 ]",
+	 range_load_counts[ 2 ],
+	 (uint64_t) 5 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "range_load_counts[ 3 ]",
+	 range_load_counts[ 3 ],
+	 (uint64_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "range_load_counts[ 4 ]",
+	 range_load_counts[ 4 ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_trace_chain_get_range_load_counts(
+	          NULL,
+	          first_entry_indexes,
+	          numbers_of_entries,
+	          5,
+	          range_load_counts,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_get_range_load_counts(
+	          trace_chain,
+	          NULL,
+	          numbers_of_entries,
+	          5,
+	          range_load_counts,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_get_range_load_counts(
+	          trace_chain,
+	          first_entry_indexes,
+	          NULL,
+	          5,
+	          range_load_counts,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_trace_chain_get_range_load_counts(
+	          trace_chain,
+	          first_entry_indexes,
+	          numbers_of_entries,
+	          5,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_trace_chain_free(
+	          &trace_chain,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "trace_chain",
+	 trace_chain );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( trace_chain != NULL )
+	{
+		libscca_trace_chain_free(
+		 &trace_chain,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libscca_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_trace_chain_initialize",
+	 scca_test_trace_chain_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_trace_chain_free",
+	 scca_test_trace_chain_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_trace_chain_read_data",
+	 scca_test_trace_chain_read_data );
+
+	SCCA_TEST_RUN(
+	 "libscca_trace_chain_decode_v30_load_counts",
+	 scca_test_trace_chain_decode_v30_load_counts );
+
+	SCCA_TEST_RUN(
+	 "libscca_trace_chain_get_range_load_counts",
+	 scca_test_trace_chain_get_range_load_counts );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
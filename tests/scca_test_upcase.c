@@ -0,0 +1,600 @@
+/*
+ * Library upcase functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_upcase.h"
+
+const char *scca_test_upcase_notepad_path = \
+	"\\DEVICE\\HARDDISKVOLUME2\\WINDOWS\\SYSTEM32\\NOTEPAD.EXE";
+
+const char *scca_test_upcase_notepad_lower_case_path = \
+	"\\device\\harddiskvolume2\\windows\\system32\\notepad.exe";
+
+/* "\CAFÉ.ΑΒΓ" and "\café.αβγ" in UTF-8
+ */
+const char *scca_test_upcase_non_ascii_path = \
+	"\\CAF\xc3\x89.\xce\x91\xce\x92\xce\x93";
+
+const char *scca_test_upcase_non_ascii_lower_case_path = \
+	"\\caf\xc3\xa9.\xce\xb1\xce\xb2\xce\xb3";
+
+/* "\café.αβγ" in UTF-16
+ */
+uint16_t scca_test_upcase_non_ascii_lower_case_utf16_path[ 9 ] = {
+	0x005c, 0x0063, 0x0061, 0x0066, 0x00e9, 0x002e, 0x03b1, 0x03b2, 0x03b3 };
+
+/* Tests the libscca_compute_case_folded_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_compute_case_folded_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t expected_hash   = 0;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_notepad_path,
+	          narrow_string_length( scca_test_upcase_notepad_path ),
+	          &expected_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_notepad_lower_case_path,
+	          narrow_string_length( scca_test_upcase_notepad_lower_case_path ),
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* Test that the end-of-string character is not hashed
+	 */
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_notepad_lower_case_path,
+	          narrow_string_length( scca_test_upcase_notepad_lower_case_path ) + 1,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_non_ascii_path,
+	          narrow_string_length( scca_test_upcase_non_ascii_path ),
+	          &expected_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_non_ascii_lower_case_path,
+	          narrow_string_length( scca_test_upcase_non_ascii_lower_case_path ),
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* The hash of an empty string is the XXH64 of empty data
+	 */
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_notepad_path,
+	          0,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xef46db3751d8e999ULL );
+
+	/* Test error cases
+	 */
+	result = libscca_compute_case_folded_hash(
+	          NULL,
+	          narrow_string_length( scca_test_upcase_notepad_path ),
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_notepad_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_notepad_path,
+	          narrow_string_length( scca_test_upcase_notepad_path ),
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_compute_case_folded_hash_utf16 function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_compute_case_folded_hash_utf16(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t expected_hash   = 0;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_compute_case_folded_hash(
+	          (uint8_t *) scca_test_upcase_non_ascii_path,
+	          narrow_string_length( scca_test_upcase_non_ascii_path ),
+	          &expected_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_compute_case_folded_hash_utf16(
+	          scca_test_upcase_non_ascii_lower_case_utf16_path,
+	          9,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* Test error cases
+	 */
+	result = libscca_compute_case_folded_hash_utf16(
+	          NULL,
+	          9,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_case_folded_hash_utf16(
+	          scca_test_upcase_non_ascii_lower_case_utf16_path,
+	          (size_t) SSIZE_MAX,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_compute_case_folded_hash_utf16(
+	          scca_test_upcase_non_ascii_lower_case_utf16_path,
+	          9,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_upcase_get_character function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_upcase_get_character(
+     void )
+{
+	uint16_t character = 0;
+
+	character = libscca_upcase_get_character(
+	             (uint16_t) 'a' );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 'A' );
+
+	character = libscca_upcase_get_character(
+	             (uint16_t) '1' );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) '1' );
+
+	character = libscca_upcase_get_character(
+	             0x00ff );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0178 );
+
+	character = libscca_upcase_get_character(
+	             0x03b1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0391 );
+
+	character = libscca_upcase_get_character(
+	             0x0430 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0x0410 );
+
+	character = libscca_upcase_get_character(
+	             0xff41 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0xff21 );
+
+	character = libscca_upcase_get_character(
+	             0xd800 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT16(
+	 "character",
+	 character,
+	 (uint16_t) 0xd800 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libscca_upcase_calculate_hash_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_upcase_calculate_hash_utf16_stream(
+     void )
+{
+	uint8_t utf16_stream[ 20 ] = {
+		0x5c, 0x00, 0x43, 0x00, 0x41, 0x00, 0x46, 0x00, 0xc9, 0x00,
+		0x2e, 0x00, 0x91, 0x03, 0x92, 0x03, 0x93, 0x03, 0x00, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	uint64_t expected_hash   = 0;
+	uint64_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_compute_case_folded_hash_utf16(
+	          scca_test_upcase_non_ascii_lower_case_utf16_path,
+	          9,
+	          &expected_hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_upcase_calculate_hash_utf16_stream(
+	          utf16_stream,
+	          20,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 expected_hash );
+
+	/* Test error cases
+	 */
+	result = libscca_upcase_calculate_hash_utf16_stream(
+	          NULL,
+	          20,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_upcase_calculate_hash_utf16_stream(
+	          utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &hash,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_upcase_calculate_hash_utf16_stream(
+	          utf16_stream,
+	          20,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_compute_case_folded_hash",
+	 scca_test_compute_case_folded_hash );
+
+	SCCA_TEST_RUN(
+	 "libscca_compute_case_folded_hash_utf16",
+	 scca_test_compute_case_folded_hash_utf16 );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_upcase_get_character",
+	 scca_test_upcase_get_character );
+
+	SCCA_TEST_RUN(
+	 "libscca_upcase_calculate_hash_utf16_stream",
+	 scca_test_upcase_calculate_hash_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
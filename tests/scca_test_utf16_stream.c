@@ -0,0 +1,679 @@
+/*
+ * Library UTF-16 stream functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_cpu.h"
+#include "../libscca/libscca_utf16_stream.h"
+
+/* "NTOSKRNL.EXE" followed by an end of string character
+ */
+uint8_t scca_test_utf16_stream_data1[ 26 ] = {
+	0x4e, 0x00, 0x54, 0x00, 0x4f, 0x00, 0x53, 0x00, 0x4b, 0x00, 0x52, 0x00, 0x4e, 0x00, 0x4c, 0x00,
+	0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00, 0x00, 0x00 };
+
+/* "CAFÉ.EXE" followed by an end of string character
+ */
+uint8_t scca_test_utf16_stream_data2[ 18 ] = {
+	0x43, 0x00, 0x41, 0x00, 0x46, 0x00, 0xc9, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00,
+	0x00, 0x00 };
+
+/* "A", "BCDEF", "G" each followed by an end of string character and "HI" without
+ */
+uint8_t scca_test_utf16_stream_data3[ 24 ] = {
+	0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x49, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_utf16_stream_get_ascii_length function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_utf16_stream_get_ascii_length(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t ascii_length      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_utf16_stream_get_ascii_length(
+	          scca_test_utf16_stream_data1,
+	          26,
+	          &ascii_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 12 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream without an end of string character
+	 */
+	result = libscca_utf16_stream_get_ascii_length(
+	          scca_test_utf16_stream_data1,
+	          10,
+	          &ascii_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_length",
+	 ascii_length,
+	 (size_t) 5 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream with a character outside the ASCII range
+	 */
+	result = libscca_utf16_stream_get_ascii_length(
+	          scca_test_utf16_stream_data2,
+	          18,
+	          &ascii_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream with an odd size
+	 */
+	result = libscca_utf16_stream_get_ascii_length(
+	          scca_test_utf16_stream_data1,
+	          25,
+	          &ascii_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_utf16_stream_get_ascii_length(
+	          NULL,
+	          26,
+	          &ascii_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_utf16_stream_get_ascii_length(
+	          scca_test_utf16_stream_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &ascii_length,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_utf16_stream_get_ascii_length(
+	          scca_test_utf16_stream_data1,
+	          26,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_utf16_stream_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_utf16_stream_copy_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_utf16_stream_get_utf8_string_size(
+	          scca_test_utf16_stream_data1,
+	          26,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 13 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_utf16_stream_copy_to_utf8_string(
+	          scca_test_utf16_stream_data1,
+	          26,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "NTOSKRNL.EXE",
+	          13 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_utf16_stream_copy_to_utf8_string(
+	          scca_test_utf16_stream_data1,
+	          26,
+	          NULL,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_utf16_stream_copy_to_utf8_string(
+	          scca_test_utf16_stream_data1,
+	          26,
+	          utf8_string,
+	          12,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_utf16_stream_get_string_offsets function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_utf16_stream_get_string_offsets(
+     void )
+{
+	uint32_t string_offsets[ 4 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_strings    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_utf16_stream_get_string_offsets(
+	          scca_test_utf16_stream_data3,
+	          24,
+	          NULL,
+	          0,
+	          &number_of_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_utf16_stream_get_string_offsets(
+	          scca_test_utf16_stream_data3,
+	          24,
+	          string_offsets,
+	          4,
+	          &number_of_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_strings",
+	 number_of_strings,
+	 4 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_offsets[ 0 ]",
+	 string_offsets[ 0 ],
+	 (uint32_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_offsets[ 1 ]",
+	 string_offsets[ 1 ],
+	 (uint32_t) 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_offsets[ 2 ]",
+	 string_offsets[ 2 ],
+	 (uint32_t) 16 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "string_offsets[ 3 ]",
+	 string_offsets[ 3 ],
+	 (uint32_t) 20 );
+
+	/* Test error cases
+	 */
+	result = libscca_utf16_stream_get_string_offsets(
+	          NULL,
+	          24,
+	          string_offsets,
+	          4,
+	          &number_of_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_utf16_stream_get_string_offsets(
+	          scca_test_utf16_stream_data3,
+	          24,
+	          string_offsets,
+	          3,
+	          &number_of_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_utf16_stream_get_string_offsets(
+	          scca_test_utf16_stream_data3,
+	          24,
+	          string_offsets,
+	          4,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the UTF-16 stream kernels with every set of processor features
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_utf16_stream_kernels(
+     void )
+{
+	uint32_t cpu_features[ 5 ] = {
+		0,
+		LIBSCCA_CPU_FEATURE_SSE2,
+		LIBSCCA_CPU_FEATURE_SSE2 | LIBSCCA_CPU_FEATURE_AVX2,
+		LIBSCCA_CPU_FEATURE_NEON,
+		0xffffffffUL };
+
+	uint8_t utf16_stream[ 300 ];
+	uint32_t string_offsets[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t ascii_length      = 0;
+	size_t stream_index      = 0;
+	int character_index      = 0;
+	int features_index       = 0;
+	int number_of_strings    = 0;
+	int result               = 0;
+	int string_index         = 0;
+
+	for( features_index = 0;
+	     features_index < 5;
+	     features_index++ )
+	{
+		libscca_cpu_set_features(
+		 cpu_features[ features_index ] );
+
+		/* Test an end of string character and a character outside the ASCII range
+		 * at every position relative to the vector blocks
+		 */
+		for( character_index = 0;
+		     character_index < 150;
+		     character_index++ )
+		{
+			for( stream_index = 0;
+			     stream_index < 300;
+			     stream_index += 2 )
+			{
+				utf16_stream[ stream_index ]     = 0x41;
+				utf16_stream[ stream_index + 1 ] = 0x00;
+			}
+			utf16_stream[ character_index * 2 ] = 0x00;
+
+			stream_index = libscca_utf16_stream_scan_end_of_string(
+			                utf16_stream,
+			                300,
+			                0 );
+
+			SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+			 "stream_index",
+			 (uint64_t) stream_index,
+			 (uint64_t) ( ( character_index * 2 ) + 1 ) );
+
+			result = libscca_utf16_stream_get_ascii_length(
+			          utf16_stream,
+			          300,
+			          &ascii_length,
+			          &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SCCA_TEST_ASSERT_EQUAL_SIZE(
+			 "ascii_length",
+			 ascii_length,
+			 (size_t) character_index );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			utf16_stream[ character_index * 2 ]         = 0x41;
+			utf16_stream[ ( character_index * 2 ) + 1 ] = 0x01;
+
+			result = libscca_utf16_stream_get_ascii_length(
+			          utf16_stream,
+			          300,
+			          &ascii_length,
+			          &error );
+
+			SCCA_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			SCCA_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test a stream with an end of string character every 7 characters
+		 */
+		for( stream_index = 0;
+		     stream_index < 300;
+		     stream_index += 2 )
+		{
+			if( ( ( stream_index / 2 ) % 7 ) == 6 )
+			{
+				utf16_stream[ stream_index ] = 0x00;
+			}
+			else
+			{
+				utf16_stream[ stream_index ] = 0x41;
+			}
+			utf16_stream[ stream_index + 1 ] = 0x00;
+		}
+		result = libscca_utf16_stream_get_string_offsets(
+		          utf16_stream,
+		          300,
+		          string_offsets,
+		          32,
+		          &number_of_strings,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "number_of_strings",
+		 number_of_strings,
+		 22 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( string_index = 0;
+		     string_index < number_of_strings;
+		     string_index++ )
+		{
+			SCCA_TEST_ASSERT_EQUAL_UINT32(
+			 "string_offsets[ string_index ]",
+			 string_offsets[ string_index ],
+			 (uint32_t) ( string_index * 14 ) );
+		}
+	}
+	libscca_cpu_set_features(
+	 0xffffffffUL );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libscca_cpu_set_features(
+	 0xffffffffUL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_utf16_stream_get_ascii_length",
+	 scca_test_utf16_stream_get_ascii_length );
+
+	SCCA_TEST_RUN(
+	 "libscca_utf16_stream_copy_to_utf8_string",
+	 scca_test_utf16_stream_copy_to_utf8_string );
+
+	SCCA_TEST_RUN(
+	 "libscca_utf16_stream_get_string_offsets",
+	 scca_test_utf16_stream_get_string_offsets );
+
+	SCCA_TEST_RUN(
+	 "libscca_utf16_stream_kernels",
+	 scca_test_utf16_stream_kernels );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,718 @@
+/*
+ * Library volume dictionary functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_volume_dictionary.h"
+
+/* Tests the libscca_volume_dictionary_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_dictionary_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libscca_volume_dictionary_t *volume_dictionary = NULL;
+	int result                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_dictionary_initialize(
+	          &volume_dictionary,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_dictionary",
+	 volume_dictionary );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_dictionary_free(
+	          &volume_dictionary,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_dictionary",
+	 volume_dictionary );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_dictionary_initialize(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_dictionary = (libscca_volume_dictionary_t *) 0x12345678UL;
+
+	result = libscca_volume_dictionary_initialize(
+	          &volume_dictionary,
+	          &error );
+
+	volume_dictionary = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_dictionary != NULL )
+	{
+		libscca_volume_dictionary_free(
+		 &volume_dictionary,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_volume_dictionary_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_dictionary_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_volume_dictionary_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_volume_dictionary_get_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_dictionary_get_number_of_volumes(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libscca_volume_dictionary_t *volume_dictionary = NULL;
+	int number_of_volumes                          = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_dictionary_initialize(
+	          &volume_dictionary,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_dictionary",
+	 volume_dictionary );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_dictionary_get_number_of_volumes(
+	          volume_dictionary,
+	          &number_of_volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_dictionary_get_number_of_volumes(
+	          NULL,
+	          &number_of_volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_dictionary_get_number_of_volumes(
+	          volume_dictionary,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_volume_dictionary_free(
+	          &volume_dictionary,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_dictionary != NULL )
+	{
+		libscca_volume_dictionary_free(
+		 &volume_dictionary,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_volume_dictionary_get_volume_identifier function and the volume getters
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_dictionary_get_volume_identifier(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                       = NULL;
+	libscca_volume_dictionary_t *volume_dictionary = NULL;
+	size_t utf8_string_size                        = 0;
+	uint64_t filetime                              = 0;
+	uint32_t serial_number                         = 0;
+	uint32_t volume_identifier1                    = 0;
+	uint32_t volume_identifier2                    = 0;
+	uint32_t volume_identifier3                    = 0;
+	uint32_t volume_index                          = 0;
+	int number_of_volumes                          = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_dictionary_initialize(
+	          &volume_dictionary,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_dictionary",
+	 volume_dictionary );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_dictionary_get_volume_identifier(
+	          volume_dictionary,
+	          (uint8_t *) "\\\0V\0O\0L\0\0\0",
+	          10,
+	          0x12345678UL,
+	          0x01d1f2a3b4c5d6e7ULL,
+	          &volume_identifier1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_identifier1",
+	 volume_identifier1,
+	 (uint32_t) 0 );
+
+	/* Test that a volume with the same device path and another serial number is distinct
+	 */
+	result = libscca_volume_dictionary_get_volume_identifier(
+	          volume_dictionary,
+	          (uint8_t *) "\\\0V\0O\0L\0\0\0",
+	          10,
+	          0x87654321UL,
+	          0x01d1f2a3b4c5d6e7ULL,
+	          &volume_identifier2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_identifier2",
+	 volume_identifier2,
+	 (uint32_t) 1 );
+
+	/* Test that a volume that is already in the dictionary retains its identifier
+	 */
+	result = libscca_volume_dictionary_get_volume_identifier(
+	          volume_dictionary,
+	          (uint8_t *) "\\\0V\0O\0L\0\0\0",
+	          10,
+	          0x12345678UL,
+	          0x01d1f2a3b4c5d6e7ULL,
+	          &volume_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_identifier3",
+	 volume_identifier3,
+	 volume_identifier1 );
+
+	result = libscca_volume_dictionary_get_number_of_volumes(
+	          volume_dictionary,
+	          &number_of_volumes,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_dictionary_get_serial_number(
+	          volume_dictionary,
+	          (int) volume_identifier2,
+	          &serial_number,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "serial_number",
+	 serial_number,
+	 (uint32_t) 0x87654321UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_dictionary_get_creation_time(
+	          volume_dictionary,
+	          (int) volume_identifier1,
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 (uint64_t) 0x01d1f2a3b4c5d6e7ULL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_dictionary_get_utf8_device_path_size(
+	          volume_dictionary,
+	          (int) volume_identifier1,
+	          &utf8_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 5 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_dictionary_get_utf8_device_path(
+	          volume_dictionary,
+	          (int) volume_identifier1,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "\\VOL",
+	          5 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the identifiers remain valid when the buckets are resized
+	 */
+	for( volume_index = 0;
+	     volume_index < ( 2 * LIBSCCA_VOLUME_DICTIONARY_MINIMUM_NUMBER_OF_BUCKETS );
+	     volume_index++ )
+	{
+		result = libscca_volume_dictionary_get_volume_identifier(
+		          volume_dictionary,
+		          (uint8_t *) "\\\0V\0O\0L\0\0\0",
+		          10,
+		          volume_index,
+		          0,
+		          &volume_identifier3,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libscca_volume_dictionary_get_volume_identifier(
+	          volume_dictionary,
+	          (uint8_t *) "\\\0V\0O\0L\0\0\0",
+	          10,
+	          0x87654321UL,
+	          0x01d1f2a3b4c5d6e7ULL,
+	          &volume_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "volume_identifier3",
+	 volume_identifier3,
+	 volume_identifier2 );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_dictionary_get_volume_identifier(
+	          NULL,
+	          (uint8_t *) "\\\0V\0O\0L\0\0\0",
+	          10,
+	          0x12345678UL,
+	          0x01d1f2a3b4c5d6e7ULL,
+	          &volume_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_dictionary_get_volume_identifier(
+	          volume_dictionary,
+	          NULL,
+	          10,
+	          0x12345678UL,
+	          0x01d1f2a3b4c5d6e7ULL,
+	          &volume_identifier3,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_dictionary_get_serial_number(
+	          volume_dictionary,
+	          -1,
+	          &serial_number,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_dictionary_get_creation_time(
+	          volume_dictionary,
+	          number_of_volumes + ( 2 * LIBSCCA_VOLUME_DICTIONARY_MINIMUM_NUMBER_OF_BUCKETS ),
+	          &filetime,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_volume_dictionary_free(
+	          &volume_dictionary,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_dictionary != NULL )
+	{
+		libscca_volume_dictionary_free(
+		 &volume_dictionary,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_dictionary_initialize",
+	 scca_test_volume_dictionary_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_dictionary_free",
+	 scca_test_volume_dictionary_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_dictionary_get_number_of_volumes",
+	 scca_test_volume_dictionary_get_number_of_volumes );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_dictionary_get_volume_identifier",
+	 scca_test_volume_dictionary_get_volume_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -1092,6 +1093,840 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libscca_volume_information_get_utf16_device_path_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_information_get_utf16_device_path_stream(
+     void )
+{
+	uint8_t device_path[ 8 ] = {
+		'C', 0, ':', 0, '\\', 0, 'x', 0 };
+
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	const uint8_t *utf16_stream                      = NULL;
+	size_t utf16_stream_size                         = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_information_initialize(
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libscca_internal_volume_information_t *) volume_information )->device_path      = device_path;
+	( (libscca_internal_volume_information_t *) volume_information )->device_path_size = 8;
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_information_get_utf16_device_path_stream(
+	          volume_information,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "utf16_stream",
+	 utf16_stream );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_size",
+	 utf16_stream_size,
+	 (size_t) 8 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_information_get_utf16_device_path_stream(
+	          NULL,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_utf16_device_path_stream(
+	          volume_information,
+	          NULL,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_utf16_device_path_stream(
+	          volume_information,
+	          &utf16_stream,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	( (libscca_internal_volume_information_t *) volume_information )->device_path = NULL;
+
+	result = libscca_internal_volume_information_free(
+	          (libscca_internal_volume_information_t **) &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_information != NULL )
+	{
+		( (libscca_internal_volume_information_t *) volume_information )->device_path = NULL;
+
+		libscca_internal_volume_information_free(
+		 (libscca_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_volume_information_copy_file_references function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_information_copy_file_references(
+     void )
+{
+	uint64_t file_references[ 2 ] = {
+		0x0001000000000005UL, 0x00020000000000a0UL };
+
+	uint64_t copied_file_references[ 2 ];
+
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	int number_of_file_references                    = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_information_initialize(
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libscca_internal_volume_information_t *) volume_information )->file_references           = file_references;
+	( (libscca_internal_volume_information_t *) volume_information )->number_of_file_references = 2;
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_information_get_number_of_file_references(
+	          volume_information,
+	          &number_of_file_references,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_file_references",
+	 number_of_file_references,
+	 2 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_information_copy_file_references(
+	          volume_information,
+	          copied_file_references,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "copied_file_references[ 1 ]",
+	 copied_file_references[ 1 ],
+	 (uint64_t) 0x00020000000000a0UL );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_information_copy_file_references(
+	          NULL,
+	          copied_file_references,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_copy_file_references(
+	          volume_information,
+	          NULL,
+	          2,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_copy_file_references(
+	          volume_information,
+	          copied_file_references,
+	          1,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	( (libscca_internal_volume_information_t *) volume_information )->file_references = NULL;
+
+	result = libscca_internal_volume_information_free(
+	          (libscca_internal_volume_information_t **) &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_information != NULL )
+	{
+		( (libscca_internal_volume_information_t *) volume_information )->file_references = NULL;
+
+		libscca_internal_volume_information_free(
+		 (libscca_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_volume_information_get_number_of_directory_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_information_get_number_of_directory_strings(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	int number_of_directory_strings                  = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_information_initialize(
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_information_get_number_of_directory_strings(
+	          volume_information,
+	          &number_of_directory_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directory_strings",
+	 number_of_directory_strings,
+	 0 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_information_get_number_of_directory_strings(
+	          NULL,
+	          &number_of_directory_strings,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_number_of_directory_strings(
+	          volume_information,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_internal_volume_information_free(
+	          (libscca_internal_volume_information_t **) &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_information != NULL )
+	{
+		libscca_internal_volume_information_free(
+		 (libscca_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_volume_information_get_utf8_directory_string function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_information_get_utf8_directory_string(
+     void )
+{
+	uint8_t utf8_directory_string[ 16 ];
+
+	uint8_t directory_strings_data[ 14 ] = {
+		1, 0, 'A', 0, 0, 0, 2, 0, 'B', 0, 'C', 0, 0, 0 };
+
+	uint32_t directory_string_offsets[ 2 ] = {
+		0, 0 };
+
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	size_t utf8_directory_string_size                = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_information_initialize(
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data      = directory_strings_data;
+	( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data_size = 14;
+	( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets    = directory_string_offsets;
+	( (libscca_internal_volume_information_t *) volume_information )->number_of_directory_strings = 2;
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_information_get_utf8_directory_string_size(
+	          volume_information,
+	          1,
+	          &utf8_directory_string_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_directory_string_size",
+	 utf8_directory_string_size,
+	 (size_t) 3 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libscca_volume_information_get_utf8_directory_string(
+	          volume_information,
+	          1,
+	          utf8_directory_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_directory_string,
+	          "BC",
+	          3 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_information_get_utf8_directory_string(
+	          NULL,
+	          0,
+	          utf8_directory_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_utf8_directory_string(
+	          volume_information,
+	          2,
+	          utf8_directory_string,
+	          16,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data   = NULL;
+	( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets = NULL;
+
+	result = libscca_internal_volume_information_free(
+	          (libscca_internal_volume_information_t **) &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_information != NULL )
+	{
+		( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data   = NULL;
+		( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets = NULL;
+
+		libscca_internal_volume_information_free(
+		 (libscca_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_volume_information_get_utf16_directory_string_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_volume_information_get_utf16_directory_string_stream(
+     void )
+{
+	uint8_t directory_strings_data[ 14 ] = {
+		1, 0, 'A', 0, 0, 0, 2, 0, 'B', 0, 'C', 0, 0, 0 };
+
+	uint32_t directory_string_offsets[ 2 ] = {
+		0, 0 };
+
+	libcerror_error_t *error                         = NULL;
+	libscca_volume_information_t *volume_information = NULL;
+	const uint8_t *utf16_stream                      = NULL;
+	size_t utf16_stream_size                         = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libscca_volume_information_initialize(
+	          &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data      = directory_strings_data;
+	( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data_size = 14;
+	( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets    = directory_string_offsets;
+	( (libscca_internal_volume_information_t *) volume_information )->number_of_directory_strings = 2;
+
+	/* Test regular cases
+	 */
+	result = libscca_volume_information_get_utf16_directory_string_stream(
+	          volume_information,
+	          1,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The stream references the directory strings data without copying it
+	 */
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "utf16_stream",
+	 (int) ( utf16_stream == &( directory_strings_data[ 8 ] ) ),
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_size",
+	 utf16_stream_size,
+	 (size_t) 6 );
+
+	/* The directory string offsets are determined on first access
+	 */
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "directory_string_offsets_are_set",
+	 ( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets_are_set,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "directory_string_offsets[ 1 ]",
+	 directory_string_offsets[ 1 ],
+	 (uint32_t) 6 );
+
+	/* Test error cases
+	 */
+	result = libscca_volume_information_get_utf16_directory_string_stream(
+	          NULL,
+	          0,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_utf16_directory_string_stream(
+	          volume_information,
+	          2,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_utf16_directory_string_stream(
+	          volume_information,
+	          0,
+	          NULL,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_volume_information_get_utf16_directory_string_stream(
+	          volume_information,
+	          0,
+	          &utf16_stream,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data   = NULL;
+	( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets = NULL;
+
+	result = libscca_internal_volume_information_free(
+	          (libscca_internal_volume_information_t **) &volume_information,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "volume_information",
+	 volume_information );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_information != NULL )
+	{
+		( (libscca_internal_volume_information_t *) volume_information )->directory_strings_data   = NULL;
+		( (libscca_internal_volume_information_t *) volume_information )->directory_string_offsets = NULL;
+
+		libscca_internal_volume_information_free(
+		 (libscca_internal_volume_information_t **) &volume_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
 
 /* The main program
@@ -1149,6 +1984,30 @@ int main(
 
 #endif /* defined( __GNUC__ ) && defined( TODO ) */
 
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_information_get_utf16_device_path_stream",
+	 scca_test_volume_information_get_utf16_device_path_stream );
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_information_copy_file_references",
+	 scca_test_volume_information_copy_file_references );
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_information_get_number_of_directory_strings",
+	 scca_test_volume_information_get_number_of_directory_strings );
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_information_get_utf8_directory_string",
+	 scca_test_volume_information_get_utf8_directory_string );
+
+	SCCA_TEST_RUN(
+	 "libscca_volume_information_get_utf16_directory_string_stream",
+	 scca_test_volume_information_get_utf16_directory_string_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
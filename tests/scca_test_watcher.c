@@ -0,0 +1,649 @@
+/*
+ * Library watcher functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_watcher.h"
+
+/* Tests the libscca_watcher_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_watcher_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libscca_watcher_t *watcher = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 * Directory change notifications are not supported on every platform
+	 */
+	result = libscca_watcher_initialize(
+	          &watcher,
+	          ".",
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	if( result == 1 )
+	{
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "watcher",
+		 watcher );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libscca_watcher_free(
+		          &watcher,
+		          &error );
+
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "watcher",
+		 watcher );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	else
+	{
+		SCCA_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SCCA_TEST_ASSERT_IS_NULL(
+		 "watcher",
+		 watcher );
+
+		SCCA_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test error cases
+	 */
+	result = libscca_watcher_initialize(
+	          NULL,
+	          ".",
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	watcher = (libscca_watcher_t *) 0x12345678UL;
+
+	result = libscca_watcher_initialize(
+	          &watcher,
+	          ".",
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	watcher = NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_watcher_initialize(
+	          &watcher,
+	          NULL,
+	          LIBSCCA_OPEN_READ,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( watcher != NULL )
+	{
+		libscca_watcher_free(
+		 &watcher,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_watcher_free function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_watcher_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_watcher_free(
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_watcher_wait function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_watcher_wait(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libscca_watcher_wait(
+	          NULL,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_internal_watcher_is_prefetch_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_watcher_is_prefetch_filename(
+     void )
+{
+	int result = 0;
+
+	result = libscca_internal_watcher_is_prefetch_filename(
+	          "CMD.EXE-4A81B364.pf",
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_internal_watcher_is_prefetch_filename(
+	          "CMD.EXE-4A81B364.PF",
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libscca_internal_watcher_is_prefetch_filename(
+	          "Layout.ini",
+	          10 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* A filename must contain more than the extension
+	 */
+	result = libscca_internal_watcher_is_prefetch_filename(
+	          ".pf",
+	          3 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libscca_internal_watcher_is_prefetch_filename(
+	          NULL,
+	          19 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libscca_internal_watcher_change_filename and libscca_internal_watcher_remove_filename functions
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_internal_watcher_change_filename(
+     void )
+{
+	libscca_internal_watcher_t internal_watcher;
+
+	libcerror_error_t *error = NULL;
+	uint64_t filename_hash   = 0;
+	int entry_index          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &internal_watcher,
+	          0,
+	          sizeof( libscca_internal_watcher_t ) ) != NULL;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libscca_internal_watcher_change_filename(
+	          &internal_watcher,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          100,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_changed_entries",
+	 internal_watcher.number_of_changed_entries,
+	 1 );
+
+	/* A change of a known filename postpones the debounce time
+	 */
+	result = libscca_internal_watcher_change_filename(
+	          &internal_watcher,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          200,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_changed_entries",
+	 internal_watcher.number_of_changed_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_watcher.entries[ 0 ].change_timestamp",
+	 internal_watcher.entries[ 0 ].change_timestamp,
+	 (uint64_t) 200 );
+
+	/* Filenames without the prefetch file extension are ignored
+	 */
+	result = libscca_internal_watcher_change_filename(
+	          &internal_watcher,
+	          "Layout.ini",
+	          10,
+	          300,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 1 );
+
+	result = libscca_internal_watcher_change_filename(
+	          &internal_watcher,
+	          "NOTEPAD.EXE-D8414F97.pf",
+	          23,
+	          300,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_changed_entries",
+	 internal_watcher.number_of_changed_entries,
+	 2 );
+
+	/* The last entry replaces a removed entry
+	 */
+	result = libscca_internal_watcher_remove_filename(
+	          &internal_watcher,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_changed_entries",
+	 internal_watcher.number_of_changed_entries,
+	 1 );
+
+	result = libscca_internal_watcher_get_entry_by_filename(
+	          &internal_watcher,
+	          "NOTEPAD.EXE-D8414F97.pf",
+	          23,
+	          &filename_hash,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	result = libscca_internal_watcher_get_entry_by_filename(
+	          &internal_watcher,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &filename_hash,
+	          &entry_index,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Removing an unknown filename is not an error
+	 */
+	result = libscca_internal_watcher_remove_filename(
+	          &internal_watcher,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libscca_internal_watcher_change_filename(
+	          NULL,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          100,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_internal_watcher_remove_filename(
+	          NULL,
+	          "CMD.EXE-4A81B364.pf",
+	          19,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libscca_internal_watcher_remove_filename(
+	          &internal_watcher,
+	          "NOTEPAD.EXE-D8414F97.pf",
+	          23,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "internal_watcher.number_of_entries",
+	 internal_watcher.number_of_entries,
+	 0 );
+
+	memory_free(
+	 internal_watcher.entries );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	while( internal_watcher.number_of_entries > 0 )
+	{
+		internal_watcher.number_of_entries -= 1;
+
+		memory_free(
+		 internal_watcher.entries[ internal_watcher.number_of_entries ].filename );
+	}
+	if( internal_watcher.entries != NULL )
+	{
+		memory_free(
+		 internal_watcher.entries );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SCCA_TEST_RUN(
+	 "libscca_watcher_initialize",
+	 scca_test_watcher_initialize );
+
+	SCCA_TEST_RUN(
+	 "libscca_watcher_free",
+	 scca_test_watcher_free );
+
+	SCCA_TEST_RUN(
+	 "libscca_watcher_wait",
+	 scca_test_watcher_wait );
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_watcher_is_prefetch_filename",
+	 scca_test_internal_watcher_is_prefetch_filename );
+
+	SCCA_TEST_RUN(
+	 "libscca_internal_watcher_change_filename",
+	 scca_test_internal_watcher_change_filename );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,626 @@
+/*
+ * Library workspace functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "scca_test_libcerror.h"
+#include "scca_test_libscca.h"
+#include "scca_test_macros.h"
+#include "scca_test_unused.h"
+
+#include "../libscca/libscca_workspace.h"
+
+/* Format version 17 data with 1 file metrics entry, 2 filenames and 1 volume
+ */
+uint8_t scca_test_workspace_data1[ 250 ] = {
+	0x11, 0x00, 0x00, 0x00, 0x53, 0x43, 0x43, 0x41, 0x0f, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x4d, 0x00, 0x44, 0x00, 0x2e, 0x00, 0x45, 0x00, 0x58, 0x00, 0x45, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x7b, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x5f, 0x4e, 0x3d, 0x2c, 0x1b, 0x0a, 0xcc, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x41, 0x00, 0x42, 0x00,
+	0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5f, 0x4e,
+	0x3d, 0x2c, 0x1b, 0x0a, 0xcc, 0x01, 0x78, 0x56, 0x34, 0x12, 0x28, 0x00, 0x00, 0x00, 0x10, 0x00,
+	0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00,
+	0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x00, 0x00, 0x00 };
+
+uint8_t scca_test_workspace[ 4096 ];
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+/* Tests the libscca_workspace_get_layout function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_workspace_get_layout(
+     void )
+{
+	libscca_workspace_layout_t workspace_layout;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_workspace_get_layout(
+	          250,
+	          &workspace_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "workspace_layout.data_offset % 16",
+	 workspace_layout.data_offset % 16,
+	 (size_t) 0 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "workspace_layout.string_offsets_offset",
+	 workspace_layout.string_offsets_offset,
+	 workspace_layout.data_offset + 256 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "workspace_layout.maximum_number_of_string_offsets",
+	 workspace_layout.maximum_number_of_string_offsets,
+	 126 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "workspace_layout.volumes_offset",
+	 workspace_layout.volumes_offset,
+	 workspace_layout.string_offsets_offset + 512 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "workspace_layout.maximum_number_of_volumes",
+	 workspace_layout.maximum_number_of_volumes,
+	 6 );
+
+	/* Test error cases
+	 */
+	result = libscca_workspace_get_layout(
+	          0,
+	          &workspace_layout,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_workspace_get_layout(
+	          250,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+/* Tests the libscca_get_workspace_size function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_get_workspace_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t workspace_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_get_workspace_size(
+	          250,
+	          &workspace_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_GREATER_THAN_UINT64(
+	 "workspace_size",
+	 (uint64_t) workspace_size,
+	 (uint64_t) 250 );
+
+	SCCA_TEST_ASSERT_LESS_THAN_UINT64(
+	 "workspace_size",
+	 (uint64_t) workspace_size,
+	 (uint64_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libscca_get_workspace_size(
+	          250,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libscca_workspace_parse function
+ * Returns 1 if successful or 0 if not
+ */
+int scca_test_workspace_parse(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libscca_workspace_view_t *view = NULL;
+	const uint8_t *utf16_stream    = NULL;
+	size_t utf16_stream_size       = 0;
+	uint64_t file_reference        = 0;
+	uint32_t flags                 = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libscca_workspace_parse(
+	          scca_test_workspace_data1,
+	          250,
+	          &( scca_test_workspace[ 1 ] ),
+	          4095,
+	          &view,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "view",
+	 view );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "view->file_type",
+	 view->file_type,
+	 LIBSCCA_FILE_TYPE_UNCOMPRESSED );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "view->format_version",
+	 view->format_version,
+	 (uint32_t) 17 );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "view->executable_filename_length",
+	 view->executable_filename_length,
+	 (size_t) 7 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "view->prefetch_hash",
+	 view->prefetch_hash,
+	 (uint32_t) 0x087b4001UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "view->run_count",
+	 view->run_count,
+	 (uint32_t) 5 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "view->last_run_times[ 0 ]",
+	 view->last_run_times[ 0 ],
+	 (uint64_t) 0x01cc0a1b2c3d4e5fULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "view->number_of_file_metrics_entries",
+	 view->number_of_file_metrics_entries,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "view->number_of_filenames",
+	 view->number_of_filenames,
+	 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "view->number_of_volumes",
+	 view->number_of_volumes,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "view->volumes[ 0 ].serial_number",
+	 view->volumes[ 0 ].serial_number,
+	 (uint32_t) 0x12345678UL );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "view->volumes[ 0 ].device_path_size",
+	 view->volumes[ 0 ].device_path_size,
+	 (size_t) 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "view->volumes[ 0 ].number_of_file_references",
+	 view->volumes[ 0 ].number_of_file_references,
+	 1 );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "view->volumes[ 0 ].number_of_directory_strings",
+	 view->volumes[ 0 ].number_of_directory_strings,
+	 1 );
+
+	/* Test libscca_workspace_view_get_filename
+	 */
+	result = libscca_workspace_view_get_filename(
+	          view,
+	          1,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_size",
+	 utf16_stream_size,
+	 (size_t) 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "utf16_stream[ 0 ]",
+	 utf16_stream[ 0 ],
+	 (uint8_t) 'C' );
+
+	result = libscca_workspace_view_get_filename(
+	          view,
+	          2,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libscca_workspace_view_get_file_metrics_entry
+	 */
+	result = libscca_workspace_view_get_file_metrics_entry(
+	          view,
+	          0,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &flags,
+	          &file_reference,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_size",
+	 utf16_stream_size,
+	 (size_t) 2 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "utf16_stream[ 0 ]",
+	 utf16_stream[ 0 ],
+	 (uint8_t) 'C' );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT32(
+	 "flags",
+	 flags,
+	 (uint32_t) 0x00000200UL );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 0 );
+
+	/* Test libscca_workspace_view_get_file_reference
+	 */
+	result = libscca_workspace_view_get_file_reference(
+	          view,
+	          0,
+	          0,
+	          &file_reference,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT64(
+	 "file_reference",
+	 file_reference,
+	 (uint64_t) 0x0001000000000005ULL );
+
+	/* Test libscca_workspace_view_get_directory_string
+	 */
+	result = libscca_workspace_view_get_directory_string(
+	          view,
+	          0,
+	          0,
+	          &utf16_stream,
+	          &utf16_stream_size,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SCCA_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_size",
+	 utf16_stream_size,
+	 (size_t) 4 );
+
+	SCCA_TEST_ASSERT_EQUAL_UINT8(
+	 "utf16_stream[ 0 ]",
+	 utf16_stream[ 0 ],
+	 (uint8_t) 'D' );
+
+	/* Test parsing without an error, which does not allocate memory
+	 */
+	view = NULL;
+
+	result = libscca_workspace_parse(
+	          scca_test_workspace_data1,
+	          250,
+	          scca_test_workspace,
+	          4096,
+	          &view,
+	          NULL );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "view",
+	 view );
+
+	/* Test with an invalid number of volumes
+	 */
+	scca_test_workspace_data1[ 112 ] = 0x02;
+
+	result = libscca_workspace_parse(
+	          scca_test_workspace_data1,
+	          250,
+	          scca_test_workspace,
+	          4096,
+	          &view,
+	          &error );
+
+	scca_test_workspace_data1[ 112 ] = 0x01;
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libscca_workspace_parse(
+	          scca_test_workspace_data1,
+	          250,
+	          scca_test_workspace,
+	          250,
+	          &view,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_workspace_parse(
+	          scca_test_workspace_data1,
+	          250,
+	          NULL,
+	          4096,
+	          &view,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libscca_workspace_parse(
+	          scca_test_workspace_data1,
+	          250,
+	          scca_test_workspace,
+	          4096,
+	          NULL,
+	          &error );
+
+	SCCA_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SCCA_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SCCA_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SCCA_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SCCA_TEST_UNREFERENCED_PARAMETER( argc )
+	SCCA_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT )
+
+	SCCA_TEST_RUN(
+	 "libscca_workspace_get_layout",
+	 scca_test_workspace_get_layout );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSCCA_DLL_IMPORT ) */
+
+	SCCA_TEST_RUN(
+	 "libscca_get_workspace_size",
+	 scca_test_get_workspace_size );
+
+	SCCA_TEST_RUN(
+	 "libscca_workspace_parse",
+	 scca_test_workspace_parse );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
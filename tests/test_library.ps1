@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "compressed_block error file_header file_information file_metrics filename_strings io_handle notify volume_information"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "arena batch block_cache bloom_filter budget compressed_block context cpu diff directory error file_header file_information file_metrics file_metrics_values filename_strings format_layout front_coded_strings hash index io_handle lzxpress mount_points notify pack parse_cache parser prefetch_hash prefetch_hash_table probe run_time_histogram scan statistics string_pool timeline trace_chain upcase utf16_stream volume_dictionary volume_information volumes watcher workspace"
+$LibraryTestsWithInput = "differential file support"
 $OptionSets = ""
 
 $InputGlob = "*"
@@ -0,0 +1,216 @@
+#!/bin/bash
+# Performance regression testing script
+#
+# Version: 20201014
+#
+# The test only runs when CHECK_WITH_PERFORMANCE is set to a non-empty value,
+# since its results depend on the system it runs on.
+#
+# When PERFORMANCE_BASELINE is set it contains the path of the baseline file,
+# otherwise performance.baseline in the tests directory is used.
+#
+# When PERFORMANCE_TOLERANCE is set it contains the percentage the throughput
+# is allowed to drop below the baseline, otherwise 10 is used.
+#
+# When PERFORMANCE_UPDATE_BASELINE is set to a non-empty value the measured
+# throughput is stored in the baseline file instead of compared against it.
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+# The profiles of the fixed corpus, every profile is generated with the same seed.
+PROFILES=("format_17" "format_23" "format_26" "format_30" "format_30_compressed");
+OPTIONS_PER_PROFILE=("-F 17" "-F 23" "-F 26" "-F 30" "-F 30 -c");
+
+CORPUS_OPTIONS="-n 8 -s 1 -m 256 -f 256 -t 4096 -v 2";
+BENCH_OPTIONS="-i 200 -o jsonl";
+METRICS="files_per_second mebibytes_per_second";
+
+if test -z "${CHECK_WITH_PERFORMANCE}";
+then
+	exit ${EXIT_IGNORE};
+fi
+
+BENCH_EXECUTABLE="../bench/scca_bench";
+
+if ! test -x "${BENCH_EXECUTABLE}";
+then
+	BENCH_EXECUTABLE="../bench/scca_bench.exe";
+fi
+
+if ! test -x "${BENCH_EXECUTABLE}";
+then
+	echo "Missing benchmark executable: ${BENCH_EXECUTABLE}";
+	echo "Run: 'make scca_bench scca_generate' in bench first.";
+
+	exit ${EXIT_IGNORE};
+fi
+
+GENERATE_EXECUTABLE="../bench/scca_generate";
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	GENERATE_EXECUTABLE="../bench/scca_generate.exe";
+fi
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	echo "Missing generator executable: ${GENERATE_EXECUTABLE}";
+	echo "Run: 'make scca_bench scca_generate' in bench first.";
+
+	exit ${EXIT_IGNORE};
+fi
+
+BASELINE="${PERFORMANCE_BASELINE}";
+
+if test -z "${BASELINE}";
+then
+	BASELINE="performance.baseline";
+fi
+
+TOLERANCE="${PERFORMANCE_TOLERANCE}";
+
+if test -z "${TOLERANCE}";
+then
+	TOLERANCE=10;
+fi
+
+if test -z "${PERFORMANCE_UPDATE_BASELINE}" && ! test -f "${BASELINE}";
+then
+	echo "Missing performance baseline: ${BASELINE}";
+	echo "Run with PERFORMANCE_UPDATE_BASELINE=1 to store one.";
+
+	exit ${EXIT_IGNORE};
+fi
+
+# Retrieves a metric from the total record of the benchmark output.
+#
+# Arguments:
+#   a string containing the benchmark output in JSON Lines
+#   a string containing the name of the metric
+#
+# Returns:
+#   a string containing the value of the metric
+#
+get_total_metric()
+{
+	local OUTPUT=$1;
+	local METRIC=$2;
+
+	echo "${OUTPUT}" | sed -n "s/^{\"type\": \"total\".*\"${METRIC}\": \([0-9.]*\).*$/\1/p";
+}
+
+# Retrieves a metric from the baseline file.
+#
+# Arguments:
+#   a string containing the path of the baseline file
+#   a string containing the name of the profile
+#   a string containing the name of the metric
+#
+# Returns:
+#   a string containing the value of the metric or an empty string if not available
+#
+get_baseline_metric()
+{
+	local BASELINE=$1;
+	local PROFILE=$2;
+	local METRIC=$3;
+
+	sed -n "s/^${PROFILE} ${METRIC} \([0-9.]*\)$/\1/p" "${BASELINE}";
+}
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+if test -n "${PERFORMANCE_UPDATE_BASELINE}";
+then
+	echo "# Performance baseline of test_performance.sh" > ${TMPDIR}/baseline;
+	echo "# profile metric value" >> ${TMPDIR}/baseline;
+fi
+
+RESULT=${EXIT_SUCCESS};
+
+for PROFILE_INDEX in ${!PROFILES[*]};
+do
+	TEST_PROFILE=${PROFILES[${PROFILE_INDEX}]};
+
+	IFS=" " read -a OPTIONS <<< "${OPTIONS_PER_PROFILE[${PROFILE_INDEX}]} ${CORPUS_OPTIONS}";
+
+	${GENERATE_EXECUTABLE} ${OPTIONS[@]} ${TMPDIR}/${TEST_PROFILE} > /dev/null;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate corpus of profile: ${TEST_PROFILE}";
+
+		break;
+	fi
+	OUTPUT=`${BENCH_EXECUTABLE} ${BENCH_OPTIONS} ${TMPDIR}/${TEST_PROFILE}-*.pf`;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to benchmark corpus of profile: ${TEST_PROFILE}";
+
+		break;
+	fi
+	for METRIC in ${METRICS};
+	do
+		VALUE=$(get_total_metric "${OUTPUT}" "${METRIC}");
+
+		if test -z "${VALUE}";
+		then
+			echo "Missing ${METRIC} in benchmark output of profile: ${TEST_PROFILE}";
+
+			RESULT=${EXIT_FAILURE};
+
+			break;
+		fi
+		if test -n "${PERFORMANCE_UPDATE_BASELINE}";
+		then
+			echo "${TEST_PROFILE} ${METRIC} ${VALUE}" >> ${TMPDIR}/baseline;
+
+			echo "Performance baseline of ${TEST_PROFILE} ${METRIC}: ${VALUE}";
+
+			continue;
+		fi
+		BASELINE_VALUE=$(get_baseline_metric "${BASELINE}" "${TEST_PROFILE}" "${METRIC}");
+
+		if test -z "${BASELINE_VALUE}";
+		then
+			echo "Performance of ${TEST_PROFILE} ${METRIC}: ${VALUE} (no baseline) (SKIP)";
+
+			continue;
+		fi
+		# The comparison is done by awk since the shell only supports integer arithmetic.
+		awk -v value=${VALUE} -v baseline=${BASELINE_VALUE} -v tolerance=${TOLERANCE} 'BEGIN { exit ( value < baseline * ( 100 - tolerance ) / 100 ) }';
+
+		if test $? -eq ${EXIT_SUCCESS};
+		then
+			echo "Performance of ${TEST_PROFILE} ${METRIC}: ${VALUE} baseline: ${BASELINE_VALUE} (PASS)";
+		else
+			echo "Performance of ${TEST_PROFILE} ${METRIC}: ${VALUE} baseline: ${BASELINE_VALUE} tolerance: ${TOLERANCE}% (FAIL)";
+
+			RESULT=${EXIT_FAILURE};
+		fi
+	done
+	rm -f ${TMPDIR}/${TEST_PROFILE}*;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		break;
+	fi
+done
+
+if test ${RESULT} -eq ${EXIT_SUCCESS} && test -n "${PERFORMANCE_UPDATE_BASELINE}";
+then
+	cp ${TMPDIR}/baseline "${BASELINE}";
+fi
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+
@@ -0,0 +1,129 @@
+#!/bin/bash
+# Concurrency stress testing script
+#
+# Version: 20201015
+#
+# The test only runs when CHECK_WITH_STRESS is set to a non-empty value,
+# since it takes long and is intended to be run on a build with ThreadSanitizer,
+# for example a build configured with:
+# CFLAGS="-fsanitize=thread -g -O1" LDFLAGS="-fsanitize=thread" ./configure --enable-multi-threading-support
+#
+# When STRESS_THREADS is set it contains the maximum number of threads,
+# otherwise 16 is used.
+#
+# When STRESS_ITERATIONS is set it contains the number of iterations
+# per thread, otherwise 20 is used.
+#
+# The stress test is run on a generated corpus and on the files in the
+# test input directory.
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+CORPUS_OPTIONS="-n 4 -s 1 -m 256 -f 256 -v 2";
+
+if test -z "${CHECK_WITH_STRESS}";
+then
+	exit ${EXIT_IGNORE};
+fi
+
+TEST_EXECUTABLE="./scca_test_stress";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="./scca_test_stress.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+GENERATE_EXECUTABLE="../bench/scca_generate";
+
+if ! test -x "${GENERATE_EXECUTABLE}";
+then
+	GENERATE_EXECUTABLE="../bench/scca_generate.exe";
+fi
+
+THREADS="${STRESS_THREADS}";
+
+if test -z "${THREADS}";
+then
+	THREADS=16;
+fi
+
+ITERATIONS="${STRESS_ITERATIONS}";
+
+if test -z "${ITERATIONS}";
+then
+	ITERATIONS=20;
+fi
+
+# A data race is reported as a failure instead of a warning.
+if test -z "${TSAN_OPTIONS}";
+then
+	export TSAN_OPTIONS="halt_on_error=1 second_deadlock_stack=1";
+fi
+
+TMPDIR="tmp$$";
+
+rm -rf ${TMPDIR};
+mkdir ${TMPDIR};
+
+if test -x "${GENERATE_EXECUTABLE}";
+then
+	${GENERATE_EXECUTABLE} ${CORPUS_OPTIONS} ${TMPDIR}/corpus > /dev/null;
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Unable to generate corpus";
+
+		rm -rf ${TMPDIR};
+
+		exit ${EXIT_FAILURE};
+	fi
+fi
+
+SOURCES=`ls ${TMPDIR}/* input/*/* 2> /dev/null`;
+
+if test -z "${SOURCES}";
+then
+	echo "No files found to stress test";
+	echo "Run: 'make scca_generate' in bench or add files to the test input directory.";
+
+	rm -rf ${TMPDIR};
+
+	exit ${EXIT_IGNORE};
+fi
+
+RESULT=${EXIT_SUCCESS};
+
+for SOURCE in ${SOURCES};
+do
+	if ! test -f "${SOURCE}";
+	then
+		continue;
+	fi
+	echo "Stress testing: ${SOURCE}";
+
+	${TEST_EXECUTABLE} -i ${ITERATIONS} -t ${THREADS} "${SOURCE}";
+	RESULT=$?;
+
+	if test ${RESULT} -ne ${EXIT_SUCCESS};
+	then
+		echo "Stress testing: ${SOURCE} (FAIL)";
+
+		break;
+	fi
+	echo "Stress testing: ${SOURCE} (PASS)";
+done
+
+rm -rf ${TMPDIR};
+
+exit ${RESULT};
+
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$ToolsTests = "info_handle output signal"
+$ToolsTests = "archive_handle arrow_writer carve_handle daemon_handle filter_expression frequency_sketch gzip_writer image_handle info_handle journal_handle live merge_handle metrics_handle output output_buffer path_list progress_handle signal summary_handle"
 $ToolsTestsWithInput = ""
 
 $InputGlob = "*"
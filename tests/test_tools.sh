@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="info_handle output signal";
+TOOLS_TESTS="archive_handle arrow_writer carve_handle daemon_handle filter_expression frequency_sketch gzip_writer image_handle info_handle journal_handle live merge_handle metrics_handle output output_buffer path_list progress_handle signal summary_handle";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 